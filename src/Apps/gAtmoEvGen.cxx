@@ -28,7 +28,13 @@
                        [--unphysical-event-mask mask]
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
-                       [--cache-file root_file]
+                       [--cache-file root_file] [--cache-read-only]
+                       [--stratify n_zenith_bands] [--strata-jobs n_jobs]
+                       [--flux-cache flux_cache_file]
+                       [--checkpoint file] [--checkpoint-interval n]
+                       [--resume]
+                       [--plan n]
+                       [--natural-targets]
 
          *** Options :
 
@@ -166,6 +172,58 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --cache-read-only
+              Use the cache file only to warm-start the job, without writing
+              it back. Many concurrent jobs can share a read-only cache file.
+           --stratify
+              Generates the events in strata of neutrino species, energy decade
+              (within the -E range) and zenith angle, with the given number of
+              equal cos(zenith angle) bands, rather than all at once. The -n
+              events are split equally among the strata, so that the statistics
+              are balanced across the flux phase space (eg at high energy and for
+              upward directions). The events of each stratum are written in a
+              separate file ([prefix].s[stratum].[run_number].ghep.root) and the
+              exposure weight of each stratum is written in a summary file
+              ([prefix].[run_number].strata.txt): weighting the events of each
+              stratum by it, the combined sample is equivalent to that of a
+              single, unstratified run throwing the same number of flux neutrinos.
+              The geometry and its max path-lengths (see -m) are shared by all
+              strata. Each stratum uses its own random number stream (seed + the
+              stratum number).
+           --strata-jobs
+              Number of strata generated concurrently, in forked processes.
+              [default: 1]
+           --flux-cache
+              Binary file caching the flux histograms filled from the input
+              flux files. Subsequent jobs using the same flux files reload them
+              from it rather than parsing the files again; the cache is updated
+              if the flux files have changed.
+              [default: $GATMOFLUXCACHE if set, no cache otherwise]
+           --checkpoint
+              A file where the state of the job (random number streams, flux
+              and event counters) is saved, along with a flush of the output
+              file, every --checkpoint-interval events [default: 10000] and
+              when the job ends or is stopped by a SIGTERM. With --resume, an
+              interrupted job restarts from its last checkpoint (or afresh if
+              there is none), copying its events from the previous output
+              file (moved aside as [output_file].interrupted), and generates
+              the same events as an uninterrupted job would. Not available
+              with --stratify. See GMCJCheckpoint.
+           --plan
+              Job-planning dry run: runs the initialization and generates n
+              events only (unstratified, with no checkpoints and ignoring -n
+              and -e), written in [output_event_file_prefix].plan. Reports the
+              initialization time, the exposure per event (as flux neutrinos
+              on the generation surface over the interaction probability
+              scale), the process mix, the events/s per process and the output
+              size per event, and the projections for 1M events.
+              See GMCJPlanner.
+           --natural-targets
+              Collapses the isotopes of each natural element of the geometry
+              (or target mix) into a single target when computing the
+              interaction probabilities of the flux neutrinos; the isotope is
+              chosen once the element is selected. Only elements whose
+              isotopes are in their natural proportions are collapsed.
 
          *** Examples:
 
@@ -216,19 +274,31 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <csignal>
 #include <cctype>
 #include <string>
 #include <vector>
 #include <sstream>
 #include <map>
+#include <fstream>
+#include <iomanip>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
+#include <TMath.h>
 #include <TRotation.h>
+#include <TSystem.h>
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/GMCJCheckpoint.h"
+#include "Framework/EventGen/GMCJPlanner.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/PathLengthList.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
@@ -260,14 +330,40 @@ using std::string;
 using std::vector;
 using std::map;
 using std::ostringstream;
+using std::ofstream;
+using std::setw;
+using std::endl;
 
 using namespace genie;
 using namespace genie::flux;
 
+// A stratum of the flux phase space, for stratified generation (--stratify)
+struct Stratum_t {
+  int    nu_pdg;   // neutrino species
+  double emin;     // energy range (GeV)
+  double emax;
+  double cmin;     // cos(zenith angle) range
+  double cmax;
+  int    nev;      // number of events to generate
+};
+// what was generated in each stratum (in shared memory, filled by the workers)
+struct StratumResult_t {
+  double done;     // 1 if the stratum was generated
+  double nev;      // generated events
+  double nflux;    // flux neutrinos thrown
+  double flux;     // flux within the stratum
+  double pscale;   // interaction probability scale
+};
+
 void            GetCommandLineArgs (int argc, char ** argv);
 void            PrintSyntax        (void);
-GFluxI *        GetFlux            (void);
+GFluxI *        GetFlux            (const Stratum_t * stratum = 0);
 GeomAnalyzerI * GetGeometry        (void);
+void            BuildStrata        (vector<Stratum_t> & strata);
+void            GenerateStrata     (GeomAnalyzerI * geom_driver);
+void            GenerateStratum    (unsigned int istratum, const Stratum_t & stratum,
+                                    GeomAnalyzerI * geom_driver, string maxpl_xml,
+                                    StratumResult_t & result);
 
 // User-specified options:
 //
@@ -285,11 +381,24 @@ int             gOptNev = -1;                  // exposure - in terms of number
 double          gOptKtonYrExposure = -1;       // exposure - in terms of kton*yrs
 double          gOptEvMin;                     // minimum neutrino energy
 double          gOptEvMax;                     // maximum neutrino energy
+int             gOptNZenithBands = 0;          // stratified generation: # of cos(zenith angle) bands (0: no strata)
+int             gOptNStrataJobs  = 1;          // stratified generation: # of strata generated concurrently
+string          gOptFluxCacheFile;             // binary file caching the flux histograms
+long int        gStrataSeed;                   // stratified generation: base random number seed
 string          gOptEvFilePrefix;              // event file prefix
 TRotation       gOptRot;                       // coordinate rotation matrix: topocentric horizontal -> user-defined topocentric system
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
 
+bool            gSigTERM = false;              // was TERM signal sent?
+GMCJPlanner *   gPlan = 0;                     // job-planning dry run, if requested
+
+static void gsSIGTERMhandler(int /* s */)
+{
+  gSigTERM = true;
+  std::cerr << "Caught SIGTERM" << std::endl;
+}
+
 // Defaults:
 //
 NtpMCFormat_t   kDefOptNtpFormat    = kNFGHEP; // def event tree format
@@ -305,6 +414,10 @@ int main(int argc, char** argv)
   // Parse command line arguments
   GetCommandLineArgs(argc,argv);
 
+  if(RunOpt::Instance()->PlanEvents() > 0) {
+    gPlan = new GMCJPlanner(RunOpt::Instance()->PlanEvents());
+  }
+
   if ( ! RunOpt::Instance()->Tune() ) {
     LOG("gmkspl", pFATAL) << " No TuneId in RunOption";
     exit(-1);
@@ -313,30 +426,75 @@ int main(int argc, char** argv)
 
   // Iinitialization of random number generators, cross-section table, messenger, cache etc...
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::CacheFile(
+     RunOpt::Instance()->CacheFile(), RunOpt::Instance()->CacheReadOnly());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, true);
 
-  // get flux driver
-  GFluxI * flux_driver = GetFlux();
-
   // get geometry driver
   GeomAnalyzerI * geom_driver = GetGeometry();
 
+  // stratified generation?
+  if(gOptNZenithBands > 0) {
+    if(RunOpt::Instance()->CheckpointFile().size() > 0) {
+      LOG("gevgen_atmo", pWARN)
+        << "Stratified jobs can not be checkpointed - Ignoring --checkpoint";
+    }
+    GenerateStrata(geom_driver);
+    delete geom_driver;
+    return 0;
+  }
+
+  // get flux driver
+  GFluxI * flux_driver = GetFlux();
+
   // create the GENIE monte carlo job driver
   GMCJDriver* mcj_driver = new GMCJDriver;
   mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
   mcj_driver->UseFluxDriver(flux_driver);
   mcj_driver->UseGeomAnalyzer(geom_driver);
+  if(gOptExtMaxPlXml.size() > 0) {
+    mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
+  }
   mcj_driver->Configure();
   mcj_driver->UseSplines();
   mcj_driver->ForceSingleProbScale();
 
+  // checkpoints of the job, if requested
+  GMCJCheckpoint ckpt(
+     (gPlan) ? "" : RunOpt::Instance()->CheckpointFile(),
+     RunOpt::Instance()->CheckpointInterval());
+  bool resume = RunOpt::Instance()->Resume() && ckpt.IsEnabled();
+  if(resume && gSystem->AccessPathName(ckpt.Filename().c_str())) {
+    LOG("gevgen_atmo", pNOTICE)
+      << "No checkpoint to resume from: " << ckpt.Filename() << " - Starting the job";
+    resume = false;
+  }
+  // end the job gracefully on a SIGTERM, so that it can be resumed
+  if(ckpt.IsEnabled()) signal(SIGTERM,gsSIGTERMhandler);
+
   // initialize an ntuple writer
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilenamePrefix((gPlan) ? gOptEvFilePrefix + ".plan" : gOptEvFilePrefix);
+  string prev_evfile = "";
+  if(resume) prev_evfile = ckpt.MoveAside(ntpw.Filename());
   ntpw.Initialize();
 
+  // resuming an interrupted job: copy its events & restore its state
+  int nev0 = 0;
+  if(resume) {
+    long int nprev = ckpt.ResumeEvents();
+    bool resumed = (nprev >= 0 && prev_evfile.size() > 0 &&
+                    ntpw.CopyEvents(prev_evfile, nprev) &&
+                    ckpt.Restore(*mcj_driver));
+    if(!resumed) {
+      LOG("gevgen_atmo", pFATAL)
+        << "Could not resume the job from the checkpoint: " << ckpt.Filename();
+      exit(1);
+    }
+    nev0 = (int) nprev;
+  }
+
   // Create a MC job monitor for a periodically updated status file
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
@@ -344,11 +502,16 @@ int main(int argc, char** argv)
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
+  if(gPlan) gPlan->SetMCJDriver(mcj_driver);
+
   // event loop
-  for(int iev = 0; iev < gOptNev; iev++) {
+  int iev = nev0;
+  for( ; iev < gOptNev && !gSigTERM; iev++) {
 
     // generate next event
+    if(gPlan) gPlan->StartEvent();
     EventRecord* event = mcj_driver->GenerateEvent();
+    if(gPlan) gPlan->EndEvent(event);
 
     // set weight (if using a weighted flux)
     //event->SetWeight(event->Weight()*flux_driver->Weight());
@@ -362,11 +525,33 @@ int main(int argc, char** argv)
 
     // clean-up
     delete event;
+
+    if(ckpt.IsDue(iev+1)) {
+      ntpw.Checkpoint();
+      ckpt.Save(iev+1, *mcj_driver);
+    }
+  }
+
+  // final checkpoint: a job stopped by a SIGTERM can be resumed from here
+  if(ckpt.IsEnabled()) {
+    ntpw.Checkpoint();
+    ckpt.Save(iev, *mcj_driver);
   }
 
   // save the event file
   ntpw.Save();
 
+  if(gPlan) {
+    double psc = mcj_driver->GlobProbScale();
+    if(psc > 0) {
+      gPlan->SetExposure(
+        mcj_driver->NFluxNeutrinos() / psc, "flux neutrinos on the generation surface");
+    }
+    gPlan->SetOutputFile(ntpw.Filename());
+    gPlan->Report();
+    delete gPlan;
+  }
+
   // clean-up
   delete geom_driver;
   delete flux_driver;
@@ -375,6 +560,238 @@ int main(int argc, char** argv)
   return 0;
 }
 //________________________________________________________________________________________
+void BuildStrata(vector<Stratum_t> & strata)
+{
+// One stratum per neutrino species, energy decade within [gOptEvMin, gOptEvMax]
+// and cos(zenith angle) band. The requested events are split equally.
+
+  vector<double> energies;
+  energies.push_back(gOptEvMin);
+  double edecade = TMath::Power(10., TMath::Floor(TMath::Log10(gOptEvMin)) + 1);
+  for( ; edecade < gOptEvMax * (1-1E-9); edecade *= 10) {
+    if(edecade > gOptEvMin * (1+1E-9)) energies.push_back(edecade);
+  }
+  energies.push_back(gOptEvMax);
+
+  strata.clear();
+  map<int,string>::const_iterator file_iter = gOptFluxFiles.begin();
+  for( ; file_iter != gOptFluxFiles.end(); ++file_iter) {
+    for(unsigned int ie = 0; ie < energies.size()-1; ie++) {
+      for(int ic = 0; ic < gOptNZenithBands; ic++) {
+        Stratum_t stratum;
+        stratum.nu_pdg = file_iter->first;
+        stratum.emin   = energies[ie];
+        stratum.emax   = energies[ie+1];
+        stratum.cmin   = -1. + 2. *  ic    / gOptNZenithBands;
+        stratum.cmax   = -1. + 2. * (ic+1) / gOptNZenithBands;
+        stratum.nev    = 0;
+        strata.push_back(stratum);
+      }
+    }
+  }
+
+  int nstrata = strata.size();
+  for(int is = 0; is < nstrata; is++) {
+    strata[is].nev = gOptNev / nstrata + ((is < gOptNev % nstrata) ? 1 : 0);
+  }
+}
+//________________________________________________________________________________________
+void GenerateStrata(GeomAnalyzerI * geom_driver)
+{
+// Generate the strata in forked worker processes (at most gOptNStrataJobs at
+// a time; GENIE's singletons are not safe for concurrent threads) sharing the
+// geometry already loaded here and its max path-lengths, computed only once.
+// The workers pass back what they generated in shared memory, from which the
+// exposure weight of each stratum is computed.
+
+  vector<Stratum_t> strata;
+  BuildStrata(strata);
+  unsigned int nstrata = strata.size();
+
+  LOG("gevgen_atmo", pNOTICE)
+    << "Generating " << gOptNev << " events in " << nstrata << " strata, "
+    << gOptNStrataJobs << " at a time";
+
+  // max path-lengths, shared by all strata
+  string maxpl_xml = gOptExtMaxPlXml;
+  if(maxpl_xml.size() == 0) {
+    ostringstream maxpl_name;
+    maxpl_name << gOptEvFilePrefix << "." << gOptRunNu << ".maxpl.xml";
+    maxpl_xml = maxpl_name.str();
+    geom_driver->ComputeMaxPathLengths().SaveAsXml(maxpl_xml);
+  }
+
+  // independent random number streams: seed + stratum number
+  gStrataSeed = (gOptRanSeed > 0) ? gOptRanSeed : RandomGen::Instance()->GetSeed();
+
+  size_t nbytes = nstrata * sizeof(StratumResult_t);
+  StratumResult_t * results = (StratumResult_t *) mmap(0, nbytes,
+       PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if((void *) results == MAP_FAILED) {
+    LOG("gevgen_atmo", pFATAL) << "Couldn't allocate shared memory for the strata";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  for(unsigned int is = 0; is < nstrata; is++) {
+    results[is].done = results[is].nev = results[is].nflux = 0;
+    results[is].flux = results[is].pscale = 0;
+  }
+
+  map<pid_t, unsigned int> running;
+  unsigned int inext = 0;
+  while(inext < nstrata || running.size() > 0) {
+    while(inext < nstrata && (int) running.size() < gOptNStrataJobs) {
+      pid_t pid = fork();
+      if(pid == 0) {
+        GenerateStratum(inext, strata[inext], geom_driver, maxpl_xml, results[inext]);
+        _exit(0);
+      }
+      if(pid < 0) {
+        LOG("gevgen_atmo", pWARN)
+          << "Couldn't fork a worker for stratum " << inext << ": generating it here";
+        GenerateStratum(inext, strata[inext], geom_driver, maxpl_xml, results[inext]);
+      } else {
+        running.insert(map<pid_t, unsigned int>::value_type(pid, inext));
+      }
+      inext++;
+    }
+    if(running.size() == 0) continue;
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    map<pid_t, unsigned int>::iterator it = running.find(pid);
+    if(it == running.end()) continue;
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      results[it->second].done = 0;
+    }
+    running.erase(it);
+  }
+
+  // Exposure weights: an unstratified run throwing all the flux neutrinos
+  // thrown in the strata would have thrown, in stratum s, a fraction
+  // flux_s/flux_tot of them, and would have used the largest probability
+  // scale of all strata. So w_s = (flux_s/flux_tot) * (nflux_tot/nflux_s)
+  // * (pscale_s/pscale_max).
+  bool   ok         = true;
+  double flux_tot   = 0;
+  double nflux_tot  = 0;
+  double pscale_max = 0;
+  for(unsigned int is = 0; is < nstrata; is++) {
+    if(results[is].done != 1.) {
+      LOG("gevgen_atmo", pERROR) << "Stratum " << is << " failed!";
+      ok = false;
+      continue;
+    }
+    flux_tot  += results[is].flux;
+    nflux_tot += results[is].nflux;
+    pscale_max = TMath::Max(pscale_max, results[is].pscale);
+  }
+
+  ostringstream summary_name;
+  summary_name << gOptEvFilePrefix << "." << gOptRunNu << ".strata.txt";
+  ofstream summary(summary_name.str().c_str());
+  ostringstream table;
+  table << "# stratum   nu_pdg     Emin(GeV)     Emax(GeV)  cos8min  cos8max"
+        << "      nev         nflux          flux        pscale        weight"
+        << endl;
+  for(unsigned int is = 0; is < nstrata; is++) {
+    const StratumResult_t & r = results[is];
+    double weight = 0;
+    if(r.done == 1. && r.nev > 0 && r.nflux > 0 && flux_tot > 0 && pscale_max > 0) {
+      weight = (r.flux/flux_tot) * (nflux_tot/r.nflux) * (r.pscale/pscale_max);
+    }
+    table << setw(9)  << is
+          << setw(9)  << strata[is].nu_pdg
+          << setw(14) << strata[is].emin
+          << setw(14) << strata[is].emax
+          << setw(9)  << strata[is].cmin
+          << setw(9)  << strata[is].cmax
+          << setw(9)  << (long int) r.nev
+          << setw(14) << (long int) r.nflux
+          << setw(14) << r.flux
+          << setw(14) << r.pscale
+          << setw(14) << weight
+          << endl;
+  }
+  summary << table.str();
+  summary.close();
+
+  LOG("gevgen_atmo", pNOTICE)
+    << "Strata (exposure weights written in " << summary_name.str() << "):\n"
+    << table.str();
+
+  munmap((void *) results, nbytes);
+
+  if(!ok) {
+    LOG("gevgen_atmo", pFATAL) << "Not all strata were generated";
+    gAbortingInErr = true;
+    exit(1);
+  }
+}
+//________________________________________________________________________________________
+void GenerateStratum(
+   unsigned int istratum, const Stratum_t & stratum,
+   GeomAnalyzerI * geom_driver, string maxpl_xml, StratumResult_t & result)
+{
+  LOG("gevgen_atmo", pNOTICE)
+    << "Generating " << stratum.nev << " events in stratum " << istratum
+    << ": nu = " << stratum.nu_pdg
+    << ", E = [" << stratum.emin << ", " << stratum.emax << "] GeV"
+    << ", cos(theta) = [" << stratum.cmin << ", " << stratum.cmax << "]";
+
+  RandomGen::Instance()->SetSeed(gStrataSeed + istratum);
+
+  GFluxI * flux_driver = GetFlux(&stratum);
+
+  double flux = 0;
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+  GAtmoFlux * atmo_flux_driver = dynamic_cast<GAtmoFlux *>(flux_driver);
+  if(atmo_flux_driver) flux = atmo_flux_driver->SelectedFlux();
+#endif
+  if(flux <= 0 || stratum.nev <= 0) {
+    LOG("gevgen_atmo", pWARN)
+      << "Nothing to generate in stratum " << istratum << " (flux = " << flux << ")";
+    result.flux = flux;
+    result.done = 1.;
+    delete flux_driver;
+    return;
+  }
+
+  GMCJDriver* mcj_driver = new GMCJDriver;
+  mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  mcj_driver->UseFluxDriver(flux_driver);
+  mcj_driver->UseGeomAnalyzer(geom_driver);
+  mcj_driver->UseMaxPathLengths(maxpl_xml);
+  mcj_driver->Configure();
+  mcj_driver->UseSplines();
+  mcj_driver->ForceSingleProbScale();
+
+  ostringstream prefix;
+  prefix << gOptEvFilePrefix << ".s" << istratum;
+  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  ntpw.CustomizeFilenamePrefix(prefix.str());
+  ntpw.Initialize();
+
+  GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
+
+  long int nflux0 = mcj_driver->NFluxNeutrinos();
+  for(int iev = 0; iev < stratum.nev; iev++) {
+    EventRecord* event = mcj_driver->GenerateEvent();
+    LOG("gevgen_atmo", pINFO) << "Generated event: " << *event;
+    ntpw.AddEventRecord(iev, event);
+    delete event;
+  }
+  ntpw.Save();
+
+  result.nev    = stratum.nev;
+  result.nflux  = mcj_driver->NFluxNeutrinos() - nflux0;
+  result.flux   = flux;
+  result.pscale = mcj_driver->GlobProbScale();
+  result.done   = 1.;
+
+  delete flux_driver;
+  delete mcj_driver;
+}
+//________________________________________________________________________________________
 GeomAnalyzerI* GetGeometry(void)
 {
   GeomAnalyzerI * geom_driver = 0;
@@ -438,8 +855,11 @@ GeomAnalyzerI* GetGeometry(void)
   return geom_driver;
 }
 //________________________________________________________________________________________
-GFluxI* GetFlux(void)
+GFluxI* GetFlux(const Stratum_t * stratum)
 {
+// Get the flux driver: for all the input neutrino species within the -E
+// energy range or, for stratified generation, for the given stratum only.
+
   GFluxI * flux_driver = 0;
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
@@ -464,15 +884,24 @@ GFluxI* GetFlux(void)
   }
   // Configure GAtmoFlux options (common to all concrete atmospheric flux drivers)
   // set min/max energy:
-  atmo_flux_driver->ForceMinEnergy (gOptEvMin * units::GeV);
-  atmo_flux_driver->ForceMaxEnergy (gOptEvMax * units::GeV);
+  atmo_flux_driver->ForceMinEnergy ((stratum ? stratum->emin : gOptEvMin) * units::GeV);
+  atmo_flux_driver->ForceMaxEnergy ((stratum ? stratum->emax : gOptEvMax) * units::GeV);
+  // set min/max cos(zenith angle):
+  if(stratum) {
+    atmo_flux_driver->ForceMinCosTheta (stratum->cmin);
+    atmo_flux_driver->ForceMaxCosTheta (stratum->cmax);
+  }
   // set flux files:
   map<int,string>::const_iterator file_iter = gOptFluxFiles.begin();
   for( ; file_iter != gOptFluxFiles.end(); ++file_iter) {
     int neutrino_code = file_iter->first;
     string filename   = file_iter->second;
+    if(stratum && neutrino_code != stratum->nu_pdg) continue;
     atmo_flux_driver->AddFluxFile(neutrino_code, filename);
   }
+  if(gOptFluxCacheFile.size() > 0) {
+    atmo_flux_driver->SetCacheFile(gOptFluxCacheFile);
+  }
   atmo_flux_driver->LoadFluxData();
   // configure flux generation surface:
   atmo_flux_driver->SetRadii(1, 1);
@@ -549,6 +978,12 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptKtonYrExposure = parser.ArgAsDouble('e');
     have_required_statistics = true;
   }//-e?
+  // or, for a job-planning dry run, a fixed number of events
+  if( RunOpt::Instance()->PlanEvents() > 0 ) {
+    gOptNev = RunOpt::Instance()->PlanEvents();
+    gOptKtonYrExposure = -1;
+    have_required_statistics = true;
+  }
   if(!have_required_statistics) {
     LOG("gevgen_atmo", pFATAL)
        << "You must request exposure either in terms of number of events and  kton*yrs"
@@ -859,6 +1294,37 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  //
+  // *** stratified generation
+  //
+  if( parser.OptionExists("stratify") && RunOpt::Instance()->PlanEvents() > 0 ) {
+    LOG("gevgen_atmo", pWARN) << "Planning the job: --stratify is ignored";
+  }
+  else
+  if( parser.OptionExists("stratify") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading number of zenith angle bands";
+    gOptNZenithBands = parser.ArgAsInt("stratify");
+    if(gOptNZenithBands <= 0) {
+      LOG("gevgen_atmo", pFATAL)
+        << "The number of zenith angle bands must be positive";
+      PrintSyntax();
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+  if( parser.OptionExists("strata-jobs") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading number of concurrent strata";
+    gOptNStrataJobs = TMath::Max(1, parser.ArgAsInt("strata-jobs"));
+  }
+
+  //
+  // *** flux cache file
+  //
+  if( parser.OptionExists("flux-cache") ) {
+    LOG("gevgen_atmo", pINFO) << "Reading flux cache file";
+    gOptFluxCacheFile = parser.ArgAsString("flux-cache");
+  }
+
   //
   // print-out summary
   //
@@ -904,6 +1370,11 @@ void GetCommandLineArgs(int argc, char ** argv)
   ostringstream expinfo;
   if(gOptNev > 0)            { expinfo << gOptNev            << " events";   }
   if(gOptKtonYrExposure > 0) { expinfo << gOptKtonYrExposure << " kton*yrs"; }
+  if(gOptNZenithBands > 0) {
+    expinfo << ", in strata of neutrino species, energy decade and "
+            << gOptNZenithBands << " zenith angle bands ("
+            << gOptNStrataJobs << " concurrent jobs)";
+  }
 
   ostringstream rotation;
   rotation << "\t| " <<  gOptRot.XX() << "  " << gOptRot.XY() << "  " << gOptRot.XZ() << " |\n";
@@ -968,7 +1439,11 @@ void PrintSyntax(void)
    << "\n           [--unphysical-event-mask mask]"
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
-   << "\n           [--cache-file root_file]"
+   << "\n           [--cache-file root_file] [--cache-read-only]"
+   << "\n           [--stratify n_zenith_bands] [--strata-jobs n_jobs]"
+   << "\n           [--flux-cache flux_cache_file]"
+   << "\n           [--checkpoint file] [--checkpoint-interval n] [--resume]"
+   << "\n           [--plan n] [--natural-targets]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << "\n";
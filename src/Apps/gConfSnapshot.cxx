@@ -0,0 +1,132 @@
+//____________________________________________________________________________
+/*!
+
+\program gconfsnapshot
+
+\brief   Saves all configuration sets of a tune (the algorithm configurations,
+         the global parameter lists, the common lists and the tune generator
+         list) in a binary snapshot, that AlgConfigPool loads in one read
+         instead of parsing the XML configuration files.
+
+         The snapshot records the XML files it was built from and a hash of
+         their contents and of the XML search path. The XML files remain the
+         source of truth: the snapshot is ignored (and the XML files are
+         parsed) whenever any of them has changed or the XML search path
+         resolves to other files.
+
+         Syntax :
+           gconfsnapshot [-o output_file] [--tune tune_name]
+                         [--xml-path path] [--message-thresholds xml_file]
+
+         Options :
+           -o
+              output file. By default, the snapshot is written where it is
+              found automatically: $GCONFSNAPSHOTDIR/[tune_name].gconfsnap,
+              or $GENIE/config/[tune_name].gconfsnap if $GCONFSNAPSHOTDIR is
+              not set.
+           --tune
+              the tune whose configuration is saved.
+           --xml-path
+              A directory to load XML files from - overrides $GXMLPATH and
+              $GENIE/config.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Examples :
+
+           shell% gconfsnapshot --tune G18_10a_02_11a
+           shell% export GCONFSNAPSHOTDIR=/data/gconf
+           shell% gconfsnapshot --tune G18_10a_02_11a
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string gOutFile;  ///< output file
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gconfsnapshot", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  AlgConfigPool * pool = AlgConfigPool::Instance();
+
+  if(gOutFile.size() == 0) gOutFile = pool->SnapshotFile();
+
+  LOG("gconfsnapshot", pNOTICE)
+     << " ****** Saving the configuration of tune "
+     << RunOpt::Instance()->Tune()->Name() << " into : " << gOutFile;
+
+  if(!pool->SaveSnapshot(gOutFile)) {
+    LOG("gconfsnapshot", pFATAL) << "Could not write: " << gOutFile;
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gconfsnapshot", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("gconfsnapshot", pINFO) << "Reading output file";
+    gOutFile = parser.ArgAsString('o');
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gconfsnapshot", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gconfsnapshot  [-o output_file] [--tune tune_name]\n"
+    << "                  [--xml-path path] [--message-thresholds xml_file]\n";
+
+}
+//____________________________________________________________________________
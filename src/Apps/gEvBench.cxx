@@ -0,0 +1,526 @@
+//____________________________________________________________________________
+/*!
+
+\program gevbench
+
+\brief   Event generation throughput benchmark.
+
+         Generates events for the input tune, neutrino, target (or target
+         mix) and energy (or flux), without writing them out, and reports:
+          - the event generation rate (events/s),
+          - the time spent generating events of each process,
+          - the time spent in each event record visitor (the event generation
+            modules, as timed by the EventGenerator), with the number of times
+            each module ran and stopped the event generation thread,
+          - the number of rejection-loop trials of each kinematics generator,
+          - the number of hadron interactions the INTRANUKE hadron transport
+            rejected (eg as Pauli blocked) and simulated again, per event,
+          - the number of memory allocations per event.
+         The results are written in JSON, so that the performance of different
+         tunes or GENIE builds can be compared directly.
+
+         Syntax :
+           gevbench -n nev -e energy (or energy range) -p neutrino_pdg
+                    -t target_pdg (or target mix) --tune tune_name
+                   [-f flux_description] [-o output_json_file]
+                   [--seed random_number_seed] [--cross-sections xml_file]
+                   [--event-generator-list list_name]
+                   [--message-thresholds xml_file]
+
+         Options :
+           [] Denotes an optional argument.
+           -n
+              Number of events to generate.
+           -e
+              Neutrino energy, or energy range if a flux is given
+              (as in gevgen).
+           -p
+              Neutrino PDG code.
+           -t
+              Target PDG code, or target mix (as in gevgen).
+           -f
+              Neutrino flux, as a functional form of E (as in gevgen).
+              Flux inputs and target mixes need GENIE to be built with the
+              flux and geometry drivers enabled.
+           -o
+              Output JSON file. By default, the results are printed out.
+           --seed
+              Random number seed.
+           --cross-sections
+              Input cross-section splines. Without them, the benchmark includes
+              the cross section calculations needed for selecting interactions.
+           --tune, --event-generator-list, --message-thresholds
+              As in gevgen.
+
+         Examples :
+           shell% gevbench -n 10000 -e 2 -p 14 -t 1000260560 \
+                           --tune G18_10a_02_11a --cross-sections xsec.xml \
+                           -o bench_G18_10a_02_11a.json
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cassert>
+#include <new>
+#include <string>
+#include <vector>
+#include <map>
+#include <fstream>
+#include <iostream>
+
+#include <TF1.h>
+#include <TH1D.h>
+#include <TVector3.h>
+#include <TStopwatch.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/EventGen/EventGenerator.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/EventGen/GFluxI.h"
+#include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/Common/KineGeneratorWithCache.h"
+#include "Physics/HadronTransport/HadronTransporter.h"
+#include "Physics/HadronTransport/Intranuke2018.h"
+
+#ifdef __GENIE_FLUX_DRIVERS_ENABLED__
+#ifdef __GENIE_GEOM_DRIVERS_ENABLED__
+#define __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
+#include "Tools/Flux/GCylindTH1Flux.h"
+#include "Tools/Flux/GMonoEnergeticFlux.h"
+#include "Tools/Geometry/PointGeomAnalyzer.h"
+#endif
+#endif
+
+using std::string;
+using std::vector;
+using std::map;
+using std::ostream;
+using std::ofstream;
+using std::cout;
+using std::endl;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// Count all memory allocations of the job
+//
+static long gNAlloc = 0;
+
+void * operator new (std::size_t size)
+{
+  gNAlloc++;
+  void * p = std::malloc(size > 0 ? size : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+#if __cplusplus >= 201103L
+void operator delete (void * p) noexcept { std::free(p); }
+#else
+void operator delete (void * p) throw()  { std::free(p); }
+#endif
+
+//____________________________________________________________________________
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+void GenerateEvents     (GEVGDriver * evg_driver, GMCJDriver * mcj_driver);
+void AddModuleStats     (const EventGeneratorList * evgl);
+void PrintResults       (ostream & out);
+
+#ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
+GFluxI * FluxDriver (void);
+#endif
+
+//User-specified options:
+int             gOptNevents = 0;        // n-events to generate
+double          gOptNuEnergy = 0;       // neutrino E, or min neutrino energy in spectrum
+double          gOptNuEnergyRange = -1; // energy range in input spectrum
+int             gOptNuPdgCode = 0;      // neutrino PDG code
+map<int,double> gOptTgtMix;             // target mix (each with its relative weight)
+string          gOptFlux;               // flux functional form
+bool            gOptUsingFluxOrTgtMix = false;
+long int        gOptRanSeed = -1;       // random number seed
+string          gOptInpXSecFile;        // cross-section splines
+string          gOptOutFileName;        // output JSON file
+
+//Results:
+double            gInitTime   = 0;      // driver configuration time (s)
+double            gGenTime    = 0;      // event generation time  (s)
+long              gNAttempts  = 0;      // # of event generation attempts
+long              gGenNAlloc  = 0;      // # of allocations during event generation
+map<string, long>   gProcNEvents;       // # of events per process
+map<string, double> gProcTime;          // generation time per process (s)
+map<string, long>   gModNRuns;          // # of runs per module
+map<string, long>   gModNStops;         // # of thread stops per module
+map<string, double> gModTime;           // time per module (s)
+map<string, long>   gModNTrials;        // # of kinematics trials per kinematics generator
+map<string, long>   gModNRetries;       // # of hadron interaction retries per hadron transporter
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevbench", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::XSecTable(gOptInpXSecFile, false);
+
+  TStopwatch watch;
+  watch.Start();
+
+  GEVGDriver * evg_driver  = 0;
+  GMCJDriver * mcj_driver  = 0;
+  GFluxI *     flux_driver = 0;
+  GeomAnalyzerI * geom_driver = 0;
+
+  if(gOptUsingFluxOrTgtMix) {
+#ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
+    flux_driver = FluxDriver();
+    geom_driver = new geometry::PointGeomAnalyzer(gOptTgtMix);
+    mcj_driver  = new GMCJDriver;
+    mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    mcj_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+    mcj_driver->UseFluxDriver(flux_driver);
+    mcj_driver->UseGeomAnalyzer(geom_driver);
+    mcj_driver->Configure();
+    mcj_driver->UseSplines();
+    mcj_driver->ForceSingleProbScale();
+#else
+    LOG("gevbench", pFATAL)
+      << "\n   To be able to generate neutrino events from a flux and/or a target mix"
+      << "\n   you need to add the following config options at your GENIE installation:"
+      << "\n   --enable-flux-drivers  --enable-geom-drivers \n" ;
+    exit(1);
+#endif
+  } else {
+    InitialState init_state(gOptTgtMix.begin()->first, gOptNuPdgCode);
+    evg_driver = new GEVGDriver;
+    evg_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    evg_driver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+    evg_driver->Configure(init_state);
+    evg_driver->UseSplines();
+  }
+
+  watch.Stop();
+  gInitTime = watch.RealTime();
+
+  GenerateEvents(evg_driver, mcj_driver);
+
+  // collect the module statistics
+  if(evg_driver) AddModuleStats(evg_driver->EventGenerators());
+  if(mcj_driver && mcj_driver->EventGenDriverPool()) {
+    const GEVGPool * pool = mcj_driver->EventGenDriverPool();
+    GEVGPool::const_iterator piter = pool->begin();
+    for( ; piter != pool->end(); ++piter) {
+      if(piter->second) AddModuleStats(piter->second->EventGenerators());
+    }
+  }
+
+  if(gOptOutFileName.size() > 0) {
+    ofstream out(gOptOutFileName.c_str());
+    PrintResults(out);
+    out.close();
+    LOG("gevbench", pNOTICE) << "Results written in: " << gOptOutFileName;
+  } else {
+    PrintResults(cout);
+  }
+
+  delete evg_driver;
+  delete mcj_driver;
+  delete flux_driver;
+  delete geom_driver;
+
+  return 0;
+}
+//____________________________________________________________________________
+void GenerateEvents(GEVGDriver * evg_driver, GMCJDriver * mcj_driver)
+{
+  TLorentzVector nu_p4(0., 0., gOptNuEnergy, gOptNuEnergy);
+
+  // Reuse the event record storage, as in gevgen
+  EventRecordPool::Instance()->SetMaxSize(1);
+
+  TStopwatch total, watch;
+  long nalloc = gNAlloc;
+  total.Start();
+
+  int ievent = 0;
+  while (ievent < gOptNevents) {
+     watch.Start(kTRUE);
+     gNAttempts++;
+
+     EventRecord * event = (evg_driver) ?
+        evg_driver->GenerateEvent(nu_p4) : mcj_driver->GenerateEvent();
+
+     watch.Stop();
+
+     string proc = (event) ? event->Summary()->ProcInfo().AsString() : "failed";
+     gProcNEvents[proc] += (event) ? 1 : 0;
+     gProcTime   [proc] += watch.RealTime();
+
+     if(!event) continue;
+
+     LOG("gevbench", pINFO) << "Generated event: " << ievent;
+     EventRecordPool::Instance()->Recycle(event);
+     ievent++;
+  }
+
+  total.Stop();
+  gGenTime   = total.RealTime();
+  gGenNAlloc = gNAlloc - nalloc;
+}
+//____________________________________________________________________________
+void AddModuleStats(const EventGeneratorList * evgl)
+{
+// Sum up the module statistics of all event generators in the list.
+// The kinematics trials and hadron transport retries are counted by the
+// (shared) module itself.
+
+  if(!evgl) return;
+
+  EventGeneratorList::const_iterator eiter = evgl->begin();
+  for( ; eiter != evgl->end(); ++eiter) {
+    const EventGenerator * evg = dynamic_cast<const EventGenerator *> (*eiter);
+    if(!evg) continue;
+    const vector<const EventRecordVisitorI *> & modules = evg->Modules();
+    for(unsigned int istep = 0; istep < modules.size(); istep++) {
+      if(!modules[istep]) continue;
+      string key = modules[istep]->Id().Key();
+      gModNRuns [key] += evg->NModuleRuns (istep);
+      gModNStops[key] += evg->NModuleStops(istep);
+      gModTime  [key] += evg->ModuleTime  (istep);
+      const KineGeneratorWithCache * kine =
+         dynamic_cast<const KineGeneratorWithCache *> (modules[istep]);
+      if(kine) gModNTrials[key] = kine->NTrials();
+      const HadronTransporter * transp =
+         dynamic_cast<const HadronTransporter *> (modules[istep]);
+      const Intranuke2018 * inuke = (transp) ?
+         dynamic_cast<const Intranuke2018 *> (transp->Model()) : 0;
+      if(inuke) gModNRetries[key] = inuke->NRetries();
+    }
+  }
+}
+//____________________________________________________________________________
+void PrintResults(ostream & out)
+{
+  double rate = (gGenTime > 0) ? gOptNevents / gGenTime : 0.;
+
+  out << "{" << endl;
+  out << "  \"tune\": \"" << RunOpt::Instance()->Tune()->Name() << "\"," << endl;
+  out << "  \"event_generator_list\": \""
+      << RunOpt::Instance()->EventGeneratorList() << "\"," << endl;
+  out << "  \"nevents\": "          << gOptNevents  << "," << endl;
+  out << "  \"attempts\": "         << gNAttempts   << "," << endl;
+  out << "  \"init_time_s\": "      << gInitTime    << "," << endl;
+  out << "  \"gen_time_s\": "       << gGenTime     << "," << endl;
+  out << "  \"events_per_s\": "     << rate         << "," << endl;
+  out << "  \"allocs_per_event\": "
+      << ((gOptNevents > 0) ? double(gGenNAlloc) / gOptNevents : 0.) << "," << endl;
+
+  out << "  \"processes\": {";
+  map<string, double>::const_iterator piter = gProcTime.begin();
+  for( ; piter != gProcTime.end(); ++piter) {
+    long nev = gProcNEvents[piter->first];
+    out << ((piter == gProcTime.begin()) ? "" : ",") << endl
+        << "    \"" << piter->first << "\": { \"events\": " << nev
+        << ", \"time_s\": " << piter->second
+        << ", \"time_per_event_s\": " << ((nev > 0) ? piter->second / nev : 0.)
+        << " }";
+  }
+  out << endl << "  }," << endl;
+
+  out << "  \"modules\": {";
+  map<string, double>::const_iterator miter = gModTime.begin();
+  for( ; miter != gModTime.end(); ++miter) {
+    const string & key = miter->first;
+    out << ((miter == gModTime.begin()) ? "" : ",") << endl
+        << "    \"" << key << "\": { \"runs\": " << gModNRuns[key]
+        << ", \"stops\": " << gModNStops[key]
+        << ", \"time_s\": " << miter->second;
+    if(gModNTrials.count(key) > 0) {
+      long ntrials = gModNTrials[key];
+      out << ", \"kine_trials\": " << ntrials
+          << ", \"kine_trials_per_run\": "
+          << ((gModNRuns[key] > 0) ? double(ntrials) / gModNRuns[key] : 0.);
+    }
+    if(gModNRetries.count(key) > 0) {
+      long nretries = gModNRetries[key];
+      out << ", \"inuke_retries\": " << nretries
+          << ", \"inuke_retries_per_run\": "
+          << ((gModNRuns[key] > 0) ? double(nretries) / gModNRuns[key] : 0.);
+    }
+    out << " }";
+  }
+  out << endl << "  }" << endl;
+  out << "}" << endl;
+}
+//____________________________________________________________________________
+#ifdef __CAN_GENERATE_EVENTS_USING_A_FLUX_OR_TGTMIX__
+GFluxI * FluxDriver(void)
+{
+  if(gOptNuEnergyRange < 0) {
+    return new flux::GMonoEnergeticFlux(gOptNuEnergy, gOptNuPdgCode);
+  }
+
+  double emin = gOptNuEnergy;
+  double emax = gOptNuEnergy + gOptNuEnergyRange;
+
+  TF1 input_func("input_func", gOptFlux.c_str(), emin, emax);
+  TH1D * spectrum = new TH1D("spectrum","neutrino flux", 300, emin, emax);
+  spectrum->SetDirectory(0);
+  spectrum->FillRandom("input_func", 100000);
+
+  flux::GCylindTH1Flux * flux = new flux::GCylindTH1Flux;
+  flux->SetNuDirection      (TVector3(0,0,1));
+  flux->SetBeamSpot         (TVector3(0,0,0));
+  flux->SetTransverseRadius (-1);
+  flux->AddEnergySpectrum   (gOptNuPdgCode, spectrum);
+
+  return flux;
+}
+#endif
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gevbench", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->EnableBareXSecPreCalc(true);
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  // number of events
+  if( parser.OptionExists('n') ) {
+    gOptNevents = parser.ArgAsInt('n');
+  } else {
+    LOG("gevbench", pFATAL) << "Unspecified number of events - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // output file
+  if( parser.OptionExists('o') ) {
+    gOptOutFileName = parser.ArgAsString('o');
+  }
+
+  // flux functional form
+  bool using_flux = false;
+  if( parser.OptionExists('f') ) {
+    gOptFlux = parser.ArgAsString('f');
+    using_flux = true;
+  }
+
+  // neutrino energy
+  if( parser.OptionExists('e') ) {
+    string nue = parser.ArgAsString('e');
+    if(nue.find(",") != string::npos) {
+       vector<string> nurange = utils::str::Split(nue, ",");
+       assert(nurange.size() == 2);
+       double emin = atof(nurange[0].c_str());
+       double emax = atof(nurange[1].c_str());
+       assert(emax>emin && emin>=0);
+       gOptNuEnergy      = emin;
+       gOptNuEnergyRange = (using_flux) ? emax-emin : -1;
+    } else {
+       gOptNuEnergy      = atof(nue.c_str());
+       gOptNuEnergyRange = -1;
+    }
+  } else {
+    LOG("gevbench", pFATAL) << "Unspecified neutrino energy - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // neutrino PDG code
+  if( parser.OptionExists('p') ) {
+    gOptNuPdgCode = parser.ArgAsInt('p');
+  } else {
+    LOG("gevbench", pFATAL) << "Unspecified neutrino PDG code - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // target mix (PDG codes with their weights, as in gevgen)
+  bool using_tgtmix = false;
+  if( parser.OptionExists('t') ) {
+    vector<string> tgtmix = utils::str::Split(parser.ArgAsString('t'), ",");
+    if(tgtmix.size() == 1) {
+      gOptTgtMix[atoi(tgtmix[0].c_str())] = 1.0;
+    } else {
+      using_tgtmix = true;
+      for(unsigned int i = 0; i < tgtmix.size(); i++) {
+        string::size_type open_bracket  = tgtmix[i].find("[");
+        string::size_type close_bracket = tgtmix[i].find("]");
+        int    pdg = atoi(tgtmix[i].substr(0, open_bracket).c_str());
+        double wgt = atof(tgtmix[i].substr(
+                       open_bracket+1, close_bracket-open_bracket-1).c_str());
+        gOptTgtMix[pdg] = wgt;
+      }
+    }
+  } else {
+    LOG("gevbench", pFATAL) << "Unspecified target PDG code - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  gOptUsingFluxOrTgtMix = using_flux || using_tgtmix;
+
+  if( parser.OptionExists("seed") ) {
+    gOptRanSeed = parser.ArgAsLong("seed");
+  }
+  if( parser.OptionExists("cross-sections") ) {
+    gOptInpXSecFile = parser.ArgAsString("cross-sections");
+  }
+
+  LOG("gevbench", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gevbench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "\n      gevbench [-h]"
+    << "\n               -n nev"
+    << "\n               -e energy (or energy range) "
+    << "\n               -p neutrino_pdg"
+    << "\n               -t target_pdg "
+    << "\n               --tune tune_name"
+    << "\n              [-f flux_description]"
+    << "\n              [-o output_json_file]"
+    << "\n              [--seed random_number_seed]"
+    << "\n              [--cross-sections xml_file]"
+    << "\n              [--event-generator-list list_name]"
+    << "\n              [--message-thresholds xml_file]"
+    << "\n\n" ;
+}
+//____________________________________________________________________________
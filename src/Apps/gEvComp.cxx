@@ -9,13 +9,20 @@
          sample is specified)
 
          Syntax :
-           gevcomp -f sample [-r reference_sample]
+           gevcomp -f sample [-r reference_sample] [-m max_cache_size]
+                   [-j nthreads]
 
          Options:
            [] Denotes an optional argument
            -f Specifies the GENIE/ROOT file with the generated event sample
 	   -r Specifies another GENIE/ROOT event sample file for comparison 
            -n Specifies how many events to analyze [default: all]
+           -m Specifies the max memory (in MB) used for caching each sample
+              in memory [default: 2000]. The plots are made from many
+              TTree::Draw() calls: with the sample cached, the file is only
+              read once. Use 0 to disable caching.
+           -j Specifies the number of threads used by ROOT for reading and
+              decompressing the event tree branches [default: 0, off]
 
          Notes:
            The input ROOT files are the gst summary ntuples generated by 
@@ -40,6 +47,7 @@
 #include <string>
 
 #include <TSystem.h>
+#include <TROOT.h>
 #include <TFile.h>
 #include <TDirectory.h>
 #include <TTree.h>
@@ -73,16 +81,29 @@ void   PrintSyntax          (void);
 bool   CheckRootFilename    (string filename);
 string OutputFileName       (string input_file_name);
 void   CreatePlots          (string filename, string filename_ref);
+void   CacheTree            (TTree * tree);
 
 // command-line arguments
 string   gOptInpFile     = ""; // (-f) input GENIE event sample file
 string   gOptInpFileRef  = ""; // (-r) input GENIE event sample file (reference)
+int      gOptMaxCacheMB  = 2000; // (-m) max memory for caching each sample, in MB
+int      gOptNThreads    = 0; // (-j) number of ROOT threads
 
 //_________________________________________________________________________________
 int main(int argc, char ** argv)
 {
   GetCommandLineArgs(argc,argv);
   utils::style::SetDefaultStyle();
+
+  if(gOptNThreads > 0) {
+#ifdef R__USE_IMT
+    ROOT::EnableImplicitMT(gOptNThreads);
+#else
+    LOG("gevcomp", pWARN)
+      << "ROOT was built without implicit multi-threading support";
+#endif
+  }
+
   CreatePlots(gOptInpFile,gOptInpFileRef);
   
   LOG("gevcomp", pINFO)  << "Done!";
@@ -109,6 +130,9 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
      gst_1 = (TTree *) fin_1->Get("gst");
      assert(gst_1);
   }
+
+            CacheTree(gst_0);
+  if(gst_1) CacheTree(gst_1);
   
   gst_0->SetLineColor(kBlack);
   gst_0->SetLineWidth(3);
@@ -1979,6 +2003,25 @@ void CreatePlots(string inp_filename, string inp_filename_ref)
   }
 }
 //_________________________________________________________________________________
+void CacheTree(TTree * tree)
+{
+// Load all baskets of the tree in memory (if they fit in -m MB) so that
+// repeated TTree::Draw() calls don't re-read the input file
+
+  if(gOptMaxCacheMB <= 0) return;
+
+  Long64_t maxmem = (Long64_t) gOptMaxCacheMB * 1024 * 1024;
+  Int_t nb = tree->LoadBaskets(maxmem);
+  if(nb < 0) {
+    LOG("gevcomp", pWARN)
+      << "Sample doesn't fit in " << gOptMaxCacheMB 
+      << " MB: It won't be cached in memory";
+    return;
+  }
+  LOG("gevcomp", pNOTICE) 
+    << "Cached " << nb << " baskets of the sample tree in memory";
+}
+//_________________________________________________________________________________
 string OutputFileName(string inpname)
 {
 // Builds the output filename based on the name of the input filename
@@ -2021,13 +2064,26 @@ void GetCommandLineArgs(int argc, char ** argv)
   } else {
     LOG("gevcomp", pNOTICE) << "Unspecified 'reference' event sample";
   }
+
+  // max memory for caching each sample
+  if( parser.OptionExists('m') ) {
+    LOG("gevcomp", pINFO) << "Reading max sample cache size";
+    gOptMaxCacheMB = parser.ArgAsInt('m');
+  }
+
+  // number of threads
+  if( parser.OptionExists('j') ) {
+    LOG("gevcomp", pINFO) << "Reading number of threads";
+    gOptNThreads = parser.ArgAsInt('j');
+  }
 }
 //_________________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevcomp", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]\n";
+    << " gevcomp -f sample.root [-n nev] [-r reference_sample.root]\n"
+    << "         [-m max_cache_size] [-j nthreads]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
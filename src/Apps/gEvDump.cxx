@@ -9,6 +9,7 @@
 
          gevdump -f filename 
                 [-n n1[,n2]] 
+                [-e iev1[,iev2]]
                 [--event-record-print-level]
 
          [] denotes an optional argument
@@ -17,6 +18,11 @@
             Specifies a GENIE GHEP/ROOT event file.
          -n 
             Specifies range of events to print-out (default: all)
+         -e
+            Specifies range of events to print-out by event number (the
+            ievent of the event record header) rather than by tree entry.
+            If the file has an event index tree (gidx), only the index and
+            the matching events are read.
          --event-record-print-level
             Allows users to set the level of information shown when the event
             record is printed in the screen. See GHepRecord::Print().
@@ -32,6 +38,9 @@
          3. Print out the event 178 from /data/sample.ghep.root 
             shell$ gevdump -f /data/sample.ghep.root -n 178
 
+         4. Print out the event numbered 1023 in /data/sample.ghep.root
+            shell$ gevdump -f /data/sample.ghep.root -e 1023
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -44,6 +53,7 @@
 //____________________________________________________________________________
 
 #include <string>
+#include <vector>
 
 #include <TFile.h>
 #include <TTree.h>
@@ -54,6 +64,7 @@
 #include "Framework/Ntuple/NtpMCFormat.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/CmdLnArgParser.h"
@@ -65,14 +76,20 @@
 #endif 
 
 using std::string;
+using std::vector;
 using namespace genie;
 
 void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 void GetEventRange      (Long64_t nev, Long64_t & n1, Long64_t & n2);
+void GetEntriesByEvtNum (TFile & file, TTree * ghep_tree, 
+                         NtpMCEventRecord * & mcrec, vector<Long64_t> & entries);
 
 Long64_t gOptNEvtL;
 Long64_t gOptNEvtH;
+Long64_t gOptIEvtL = -1;
+Long64_t gOptIEvtH = -1;
+bool     gOptByEvtNum = false;
 string   gOptInpFilename;
 
 //___________________________________________________________________
@@ -166,10 +183,16 @@ int main(int argc, char ** argv)
   // event loop
   //
 
-  Long64_t n1,n2;
-  GetEventRange(nev,n1,n2);
-  for(Long64_t i = n1; i <= n2; i++) {
-    ghep_tree->GetEntry(i);
+  vector<Long64_t> entries;
+  if(gOptByEvtNum) {
+    GetEntriesByEvtNum(file, ghep_tree, mcrec, entries);
+  } else {
+    Long64_t n1,n2;
+    GetEventRange(nev,n1,n2);
+    for(Long64_t i = n1; i <= n2; i++) entries.push_back(i);
+  }
+  for(unsigned int ie = 0; ie < entries.size(); ie++) {
+    ghep_tree->GetEntry(entries[ie]);
 
     // retrieve GHEP event record abd print it out.
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -234,6 +257,44 @@ void GetEventRange(Long64_t nev, Long64_t & n1, Long64_t & n2)
   }
 }
 //___________________________________________________________________
+void GetEntriesByEvtNum(TFile & file, TTree * ghep_tree, 
+                        NtpMCEventRecord * & mcrec, vector<Long64_t> & entries)
+{
+// Find the tree entries of the events numbered gOptIEvtL to gOptIEvtH.
+// Only the event number branch of the event index is read if the file has
+// one, otherwise every event record is read.
+
+  Long64_t nev = ghep_tree->GetEntries();
+
+  TTree * index_tree = 
+     dynamic_cast <TTree *> (file.Get(NtpEventIndex::TreeName()));
+  TBranch * brIEv = (index_tree && index_tree->GetEntries() == nev) ? 
+     index_tree->GetBranch("iev") : 0;
+  if(brIEv) {
+    int iev = 0;
+    brIEv->SetAddress(&iev);
+    for(Long64_t i = 0; i < nev; i++) {
+      brIEv->GetEntry(i);
+      if(iev >= gOptIEvtL && iev <= gOptIEvtH) entries.push_back(i);
+    }
+    brIEv->ResetAddress();
+  } else {
+    LOG("gevdump", pNOTICE) 
+       << "No event index: Reading all events to find the requested ones";
+    for(Long64_t i = 0; i < nev; i++) {
+      ghep_tree->GetEntry(i);
+      Long64_t iev = mcrec->hdr.ievent;
+      if(iev >= gOptIEvtL && iev <= gOptIEvtH) entries.push_back(i);
+      mcrec->Clear();
+    }
+  }
+
+  if(entries.size() == 0) {
+    LOG("gevdump", pWARN) 
+       << "No events numbered " << gOptIEvtL << " to " << gOptIEvtH;
+  }
+}
+//___________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevdump", pINFO) << "*** Parsing command line arguments";
@@ -284,6 +345,27 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNEvtH = -1;
   }
 
+  // event numbers:
+  if ( parser.OptionExists('e') ) {
+    LOG("gevdump", pINFO) << "Reading event numbers to analyze";
+    string iev =  parser.ArgAsString('e');
+    if (iev.find(",") != string::npos) {
+      vector<long> vecn = parser.ArgAsLongTokens('e',",");
+      if(vecn.size()!=2 || vecn[1] < vecn[0]) {
+         LOG("gevdump", pFATAL) << "Invalid syntax";
+         PrintSyntax();
+         gAbortingInErr = true;
+         exit(1);
+      }
+      gOptIEvtL = vecn[0];
+      gOptIEvtH = vecn[1];       
+    } else {
+      gOptIEvtL = parser.ArgAsLong('e');
+      gOptIEvtH = gOptIEvtL;
+    }
+    gOptByEvtNum = true;
+  }
+
   
 }
 //_________________________________________________________________________________
@@ -291,6 +373,7 @@ void PrintSyntax(void)
 {
   LOG("gevdump", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << "   gevdump -f sample.root [-n n1[,n2]] [--event-record-print-level]\n";
+    << "   gevdump -f sample.root [-n n1[,n2]] [-e iev1[,iev2]]\n"
+    << "           [--event-record-print-level]\n";
 }
 //_________________________________________________________________________________
@@ -25,6 +25,7 @@
                   [-f flux_description]
                   [-o outfile_name]
                   [-w]
+                  [--workers n]
                   [--seed random_number_seed]
                   [--cross-sections xml_file]
                   [--event-generator-list list_name]
@@ -33,8 +34,20 @@
                   [--unphysical-event-mask mask]
                   [--event-record-print-level level]
                   [--mc-job-status-refresh-rate  rate]
-                  [--cache-file root_file]
+                  [--mc-job-stats-file json_file]
+                  [--cache-file root_file] [--cache-read-only]
+                  [--xsec-bias selector:factor,...]
                   [--xml-path config_xml_dir]
+                  [--startup-timing output_file] [--instr-summary output_file]
+                  [--output-compression algorithm[:level]]
+                  [--output-basket-size bytes]
+                  [--output-autosave n] [--output-autoflush n]
+                  [--output-writer-thread [queue_size]] [--output-imt nthreads]
+                  [--output-gst] [--output-gst-only] [--disable-event-index]
+                  [--output-compact-ghep] [--output-event-cost]
+                  [--alt-tunes tune,tune,...]
+                  [--plan n]
+                  [--natural-targets]
 
          Options :
            [] Denotes an optional argument.
@@ -78,6 +91,15 @@
               scheme for the generated kinematics of individual processes can
               still be in effect if enabled..
               ** Only use that option if you understand what it means **
+           --workers
+              Number of worker processes generating the events [default: 1].
+              The workers are forked once the job is initialized, sharing
+              the loaded splines and configured drivers. Worker i generates
+              the events i, i+n, i+2n, ... with the random number streams
+              reseeded for every event from the seed and the event index, in
+              its own output file: the output file name with .w[worker]
+              inserted before its extension (eg gntp.w0.[run].ghep.root).
+              Only the first worker refreshes the status file.
            --seed
               Random number seed.
            --cross-sections
@@ -102,11 +124,102 @@
               record is printed in the screen. See GHepRecord::Print().
            --mc-job-status-refresh-rate
               Allows users to customize the refresh rate of the status file.
+           --mc-job-stats-file
+              Write the job statistics (event rate, flux neutrinos per event,
+              events per process, run / rejection counts and cpu time per
+              event generation module) in the given JSON file, updated at
+              every status file refresh.
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --cache-read-only
+              Use the cache file only to warm-start the job, without writing
+              it back. Many concurrent jobs can share a read-only cache file.
+           --xsec-bias
+              Bias the selection of rare processes, with a comma-separated list
+              of <selector>:<factor> entries, eg COH:20,1Kaon:100: The cross
+              section of the matching interactions is multiplied by the factor
+              when selecting the interaction to generate, and the event weight
+              compensates for it (the total cross section and the exposure are
+              not changed). A selector is a scattering type, or, if it contains
+              a ':', a part of the interaction string (eg proc:Weak[CC],RES).
+              See PhysInteractionSelector.
            --xml-path
               A directory to load XML files from - overrides $GXMLPATH, and $GENIE/config
+           --startup-timing
+              Measure the wall-clock time, CPU time and memory growth of each
+              initialization phase (loading the configuration, the splines,
+              the hadron transport data, configuring the drivers, ...) and
+              write a tab-separated summary in the given file at exit
+              (use - for the standard output).
+           --instr-summary
+              In builds configured with --enable-instrumentation, write the
+              time spent in each instrumented call path (event generation
+              modules, cross section algorithms and integrators, flux and
+              geometry drivers) at exit in the given file, as folded stacks
+              for flamegraph.pl. A call tree summary is always printed.
+           --output-compression
+              Compression of the output event file: zlib, lzma, lz4 or zstd,
+              optionally followed by the compression level (eg lz4:4), or a
+              ROOT compression setting number (100*algorithm+level).
+              [default: the ROOT default]
+           --output-basket-size
+              Basket size (in bytes) of the output event branch.
+              [default: 32000]
+           --output-autosave, --output-autoflush
+              Autosave and autoflush settings of the output event tree, as in
+              TTree::SetAutoSave() and TTree::SetAutoFlush() (>0: number of
+              entries, <0: number of bytes).
+              [default: autosave at 200000000, ROOT default autoflush]
+           --output-writer-thread
+              Fill the output event tree (streaming, compression, basket
+              flushing) in a separate thread, with up to queue_size events
+              waiting to be written. The output file is unchanged.
+              [default queue_size: 8]
+           --output-imt
+              Enable ROOT's implicit multi-threading, compressing the output
+              baskets in parallel in the given number of threads.
+           --output-gst
+              Write the GENIE summary tree (gst, as written by gntpc -f gst)
+              in the output file, alongside the GHEP event tree.
+           --output-gst-only
+              Write the GENIE summary tree (gst) instead of the GHEP event
+              tree.
+           --disable-event-index
+              Do not write the event index tree (gidx), a light-weight tree
+              next to the GHEP event tree with the event type, probe, target
+              and final state multiplicities of each event. See gevpick and
+              gevdump.
+           --output-compact-ghep
+              Write the GHEP event record particles in a compact form (single
+              precision momenta and positions, packed status words), roughly
+              halving the size of the GHEP event tree. The files are read as
+              usual by all GENIE applications.
+           --output-event-cost
+              Write the cost of generating each event (cpu time, kinematics
+              selection trials, hadron transport steps, hadronization
+              retries; see GHepEventCost) in a gcost branch of the GHEP
+              event tree, to find out which events dominate the run time.
+           --alt-tunes
+              Comma separated list of alternate tunes whose event weights
+              are written in a gtunewght branch of the GHEP event tree (one
+              leaf per tune): the ratio of the alternate and current tune
+              cross section splines for the interaction of each event, at
+              its energy. Their splines must be in the input cross section
+              file. Meant for tunes with the same models and phase space.
+           --plan
+              Job-planning dry run: runs the initialization and generates n
+              events only (in a single process, ignoring -n), written in
+              gntp.plan.[run].ghep.root, or in [outfile_name] with .plan
+              inserted before the extension. Reports the initialization time,
+              the flux neutrinos thrown per event, the process mix, the
+              events/s per process and the output size per event, and the
+              projections for 1M events. See GMCJPlanner.
+           --natural-targets
+              With a flux and a target mix: treats the isotopes of each
+              element of the mix given in their natural proportions as a
+              single target when computing the interaction probabilities;
+              the isotope is chosen once the element is selected.
 
         ***  See the User Manual for more details and examples. ***
 
@@ -143,10 +256,12 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GMCJPlanner.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
@@ -193,6 +308,8 @@ GFluxI *        TH1FluxDriver           (void);
 #endif
 
 void GenerateEventsAtFixedInitState (void);
+string WorkerFilename (string filename, int iworker);
+string TaggedFilename (string filename, string tag);
 
 //Default options (override them using the command line arguments):
 int           kDefOptNevents   = 0;       // n-events to generate
@@ -213,11 +330,17 @@ long int        gOptRanSeed;      // random number seed
 string          gOptInpXSecFile;  // cross-section splines
 string          gOptOutFileName;  // Optional outfile name
 string          gOptStatFileName; // Status file name, set if gOptOutFileName was set.
+int             gOptNWorkers = 1; // number of worker processes
+
+GMCJPlanner *   gPlan = 0;        // job-planning dry run, if requested
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
   GetCommandLineArgs(argc,argv);
+  if(RunOpt::Instance()->PlanEvents() > 0) {
+    gPlan = new GMCJPlanner(RunOpt::Instance()->PlanEvents());
+  }
   Initialize();
 
   // throw on NaNs and Infs...
@@ -240,6 +363,7 @@ int main(int argc, char ** argv)
   } else {
      GenerateEventsAtFixedInitState();
   }
+  delete gPlan;
   return 0;
 }
 //____________________________________________________________________________
@@ -255,7 +379,8 @@ void Initialize()
   // Initialization of random number generators, cross-section table,
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::CacheFile(
+     RunOpt::Instance()->CacheFile(), RunOpt::Instance()->CacheReadOnly());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
 
@@ -279,12 +404,20 @@ void GenerateEventsAtFixedInitState(void)
   evg_driver.SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
   evg_driver.Configure(init_state);
 
+  // Fork the worker processes, if any, sharing the configured driver
+  int iworker = utils::system::ForkWorkers(gOptNWorkers);
+  if (iworker < 0) return;
+
   // Initialize an Ntuple Writer
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
 
   // If an output file name has been specified... use it
   if (!gOptOutFileName.empty()){
-    ntpw.CustomizeFilename(gOptOutFileName);
+    ntpw.CustomizeFilename(WorkerFilename(gOptOutFileName, iworker));
+  } else if (gOptNWorkers > 1) {
+    ntpw.CustomizeFilenamePrefix(WorkerFilename("gntp", iworker));
+  } else if (gPlan) {
+    ntpw.CustomizeFilenamePrefix("gntp.plan");
   }
   ntpw.Initialize();
 
@@ -292,6 +425,7 @@ void GenerateEventsAtFixedInitState(void)
   // Create an MC Job Monitor
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  mcjmonitor.SetEvGenDriver(&evg_driver);
 
   // If a status file name has been given... use it
   if (!gOptStatFileName.empty()){
@@ -303,14 +437,26 @@ void GenerateEventsAtFixedInitState(void)
     << "\n ** Will generate " << gOptNevents << " events for \n"
     << init_state << " at Ev = " << Ev << " GeV";
 
+  // Reuse the event record storage: events are copied to the ntuple
+  EventRecordPool::Instance()->SetMaxSize(1);
+
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
+  int ievent  = iworker;
+  int iseeded = -1;
   while (ievent < gOptNevents) {
      LOG("gevgen", pNOTICE)
         << " *** Generating event............ " << ievent;
 
+     // workers: make each event depend only on the seed and its index
+     if (gOptNWorkers > 1 && iseeded != ievent) {
+        RandomGen::Instance()->SetEventIndex(ievent);
+        iseeded = ievent;
+     }
+
      // generate a single event
+     if (gPlan) gPlan->StartEvent();
      EventRecord * event = evg_driver.GenerateEvent(nu_p4);
+     if (gPlan) gPlan->EndEvent(event);
 
      if(!event) {
         LOG("gevgen", pNOTICE)
@@ -323,13 +469,43 @@ void GenerateEventsAtFixedInitState(void)
 
      // add event at the output ntuple, refresh the mc job monitor & clean up
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
-     ievent++;
-     delete event;
+     if (iworker == 0) mcjmonitor.Update(ievent,event);
+     ievent += gOptNWorkers;
+     EventRecordPool::Instance()->Recycle(event);
   }
 
   // Save the generated MC events
   ntpw.Save();
+
+  if (gPlan) {
+    gPlan->SetOutputFile(ntpw.Filename());
+    gPlan->Report();
+  }
+}
+//____________________________________________________________________________
+string WorkerFilename(string filename, int iworker)
+{
+// Output file name of a worker, with .w[worker] inserted before the
+// extension (after a file name prefix). Unchanged without workers.
+
+  if (gOptNWorkers <= 1) return filename;
+
+  ostringstream tag;
+  tag << ".w" << iworker;
+
+  return TaggedFilename(filename, tag.str());
+}
+//____________________________________________________________________________
+string TaggedFilename(string filename, string tag)
+{
+// File name with the tag inserted before the extension, if any
+
+  size_t dot   = filename.find_last_of(".");
+  size_t slash = filename.find_last_of("/");
+  if (dot == string::npos || (slash != string::npos && dot < slash)) {
+    return filename + tag;
+  }
+  return filename.substr(0, dot) + tag + filename.substr(dot);
 }
 //____________________________________________________________________________
 
@@ -352,18 +528,35 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   if(!gOptWeighted)
         mcj_driver->ForceSingleProbScale();
 
+  // Fork the worker processes, if any, sharing the configured drivers.
+  // Worker i returns the events i, i+n, i+2n, ...
+  int iworker = utils::system::ForkWorkers(gOptNWorkers);
+  if (iworker < 0) {
+    delete flux_driver;
+    delete geom_driver;
+    delete mcj_driver;
+    return;
+  }
+  if (gOptNWorkers > 1) mcj_driver->SetWorkerSlot(iworker, gOptNWorkers);
+
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
 
   // If an output file name has been specified... use it
   if (!gOptOutFileName.empty()){
-    ntpw.CustomizeFilename(gOptOutFileName);
+    ntpw.CustomizeFilename(WorkerFilename(gOptOutFileName, iworker));
+  } else if (gOptNWorkers > 1) {
+    ntpw.CustomizeFilenamePrefix(WorkerFilename("gntp", iworker));
+  } else if (gPlan) {
+    ntpw.CustomizeFilenamePrefix("gntp.plan");
   }
   ntpw.Initialize();
 
   // Create an MC Job Monitor
   GMCJMonitor mcjmonitor(gOptRunNu);
   mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+  mcjmonitor.SetMCJDriver(mcj_driver);
+  if (gPlan) gPlan->SetMCJDriver(mcj_driver);
 
   // If a status file name has been given... use it
   if (!gOptStatFileName.empty()){
@@ -371,27 +564,37 @@ void GenerateEventsUsingFluxOrTgtMix(void)
   }
 
 
+  // Reuse the event record storage: events are copied to the ntuple
+  EventRecordPool::Instance()->SetMaxSize(1);
+
   // Generate events / print the GHEP record / add it to the ntuple
-  int ievent = 0;
+  int ievent = iworker;
   while ( ievent < gOptNevents) {
 
      LOG("gevgen", pNOTICE) << " *** Generating event............ " << ievent;
 
      // generate a single event for neutrinos coming from the specified flux
+     if (gPlan) gPlan->StartEvent();
      EventRecord * event = mcj_driver->GenerateEvent();
+     if (gPlan) gPlan->EndEvent(event);
 
      LOG("gevgen", pNOTICE) << "Generated Event GHEP Record: " << *event;
 
      // add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
-     ievent++;
-     delete event;
+     if (iworker == 0) mcjmonitor.Update(ievent,event);
+     ievent += gOptNWorkers;
+     EventRecordPool::Instance()->Recycle(event);
   }
 
   // Save the generated MC events
   ntpw.Save();
 
+  if (gPlan) {
+    gPlan->SetOutputFile(ntpw.Filename());
+    gPlan->Report();
+  }
+
   delete flux_driver;
   delete geom_driver;
   delete mcj_driver;;
@@ -715,6 +918,32 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if(gOptNWorkers < 1) {
+      LOG("gevgen", pFATAL) << "Invalid number of workers: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    gOptNWorkers = 1;
+  }
+
+  // a job-planning dry run generates a fixed number of events, in a single
+  // process, next to the output file it is planning for
+  if( RunOpt::Instance()->PlanEvents() > 0 ) {
+    if(gOptNWorkers > 1) {
+      LOG("gevgen", pWARN) << "Planning the job: --workers is ignored";
+    }
+    gOptNWorkers = 1;
+    gOptNevents  = RunOpt::Instance()->PlanEvents();
+    if(!gOptOutFileName.empty()) {
+      gOptOutFileName = TaggedFilename(gOptOutFileName, ".plan");
+    }
+  }
+
   //
   // print-out the command line options
   //
@@ -732,6 +961,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   }
   LOG("gevgen", pNOTICE)
        << "Number of events requested: " << gOptNevents;
+  LOG("gevgen", pNOTICE)
+       << "Number of worker processes: " << gOptNWorkers;
   if(gOptInpXSecFile.size() > 0) {
      LOG("gevgen", pNOTICE)
        << "Using cross-section splines read from: " << gOptInpXSecFile;
@@ -781,6 +1012,7 @@ void PrintSyntax(void)
     << "\n              [-f flux_description]"
     << "\n              [-o outfile_name]"
     << "\n              [-w]"
+    << "\n              [--workers n]"
     << "\n              [--seed random_number_seed]"
     << "\n              [--cross-sections xml_file]"
     << "\n              [--event-generator-list list_name]"
@@ -788,8 +1020,19 @@ void PrintSyntax(void)
     << "\n              [--unphysical-event-mask mask]"
     << "\n              [--event-record-print-level level]"
     << "\n              [--mc-job-status-refresh-rate  rate]"
-    << "\n              [--cache-file root_file]"
+    << "\n              [--mc-job-stats-file json_file]"
+    << "\n              [--cache-file root_file] [--cache-read-only]"
+    << "\n              [--xsec-bias selector:factor,...]"
     << "\n              [--xml-path config_xml_dir]"
+    << "\n              [--startup-timing output_file] [--instr-summary output_file]"
+    << "\n              [--output-compression algorithm[:level]]"
+    << "\n              [--output-basket-size bytes]"
+    << "\n              [--output-autosave n] [--output-autoflush n]"
+    << "\n              [--output-writer-thread [queue_size]] [--output-imt nthreads]"
+    << "\n              [--output-gst] [--output-gst-only] [--disable-event-index]"
+    << "\n              [--output-compact-ghep] [--output-event-cost]"
+    << "\n              [--alt-tunes tune,tune,...]"
+    << "\n              [--plan n] [--natural-targets]"
     << "\n";
 }
 //____________________________________________________________________________
@@ -29,13 +29,14 @@
                      [-w]
                      [--seed random_number_seed]
                      [--cross-sections xml_file]
+                     [--dm-spline-family file_stem]
                      [--event-generator-list list_name]
                      [--tune genie_tune]
                      [--message-thresholds xml_file]
                      [--unphysical-event-mask mask]
                      [--event-record-print-level level]
                      [--mc-job-status-refresh-rate  rate]
-                     [--cache-file root_file]
+                     [--cache-file root_file] [--cache-read-only]
 
          Options :
            [] Denotes an optional argument.
@@ -90,6 +91,11 @@
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
+           --dm-spline-family
+              Name stem of a family of cross section spline files, built by
+              gmkspl_dm over a grid of DM masses, mediator mass ratios and
+              couplings. The splines of the nearest grid point are loaded,
+              and rescaled exactly to the requested coupling.
            --event-generator-list
               List of event generators to load in event generation drivers.
               [default: "Default"].
@@ -112,6 +118,9 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --cache-read-only
+              Use the cache file only to warm-start the job, without writing
+              it back. Many concurrent jobs can share a read-only cache file.
 
         ***  See the User Manual for more details and examples. ***
 
@@ -174,6 +183,7 @@
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/BoostedDarkMatter/XSection/DMUtils.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
@@ -228,6 +238,7 @@ bool            gOptWeighted;     //
 bool            gOptUsingFluxOrTgtMix = false;
 long int        gOptRanSeed;      // random number seed
 string          gOptInpXSecFile;  // cross-section splines
+string          gOptDMSplineFamily; // spline family file name stem
 string          gOptOutFileName;  // Optional outfile name
 string          gOptStatFileName; // Status file name, set if gOptOutFileName was set.
 
@@ -280,9 +291,20 @@ void Initialize()
   // Initialization of random number generators, cross-section table,
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::CacheFile(
+     RunOpt::Instance()->CacheFile(), RunOpt::Instance()->CacheReadOnly());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
+  if(gOptDMSplineFamily.size() > 0) {
+    bool loaded = utils::dm::LoadSplineFamily(
+       gOptDMSplineFamily, gOptDMMass, gOptMedRatio, utils::dm::ZpCoupling());
+    if(!loaded) {
+      LOG("gevgen_dm", pFATAL)
+        << "Could not load the spline family: " << gOptDMSplineFamily;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
@@ -775,6 +797,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // dark matter spline family
+  if( parser.OptionExists("dm-spline-family") ) {
+    LOG("gevgen_dm", pINFO) << "Reading spline family file name stem";
+    gOptDMSplineFamily = parser.ArgAsString("dm-spline-family");
+  } else {
+    gOptDMSplineFamily = "";
+  }
+
   //
   // print-out the command line options
   //
@@ -799,6 +829,10 @@ void GetCommandLineArgs(int argc, char ** argv)
      LOG("gevgen_dm", pNOTICE)
        << "No input cross-section spline file";
   }
+  if(gOptDMSplineFamily.size() > 0) {
+     LOG("gevgen_dm", pNOTICE)
+       << "Using the cross-section spline family: " << gOptDMSplineFamily;
+  }
   LOG("gevgen_dm", pNOTICE)
        << "Flux: " << gOptFlux;
   LOG("gevgen_dm", pNOTICE)
@@ -847,12 +881,13 @@ void PrintSyntax(void)
     << "\n                [-w]"
     << "\n                [--seed random_number_seed]"
     << "\n                [--cross-sections xml_file]"
+    << "\n                [--dm-spline-family file_stem]"
     << "\n                [--event-generator-list list_name]"
     << "\n                [--message-thresholds xml_file]"
     << "\n                [--unphysical-event-mask mask]"
     << "\n                [--event-record-print-level level]"
     << "\n                [--mc-job-status-refresh-rate  rate]"
-    << "\n                [--cache-file root_file]"
+    << "\n                [--cache-file root_file] [--cache-read-only]"
     << "\n";
 }
 //____________________________________________________________________________
@@ -10,6 +10,7 @@
            gevgen_hadron [-n nev] -p probe -t tgt [-r run#] -k KE
                          [-f flux] [-o prefix] [-m mode]
                          [--seed random_number_seed]
+                         [--grid grid_file [-j nworkers] [--fate-summary file]]
                          [--message-thresholds xml_file]
                          [--event-record-print-level level]
                          [--mc-job-status-refresh-rate  rate]
@@ -43,6 +44,22 @@
               INTRANUKE mode <hA, hN> (default: hA)
            --seed
               Random number seed.
+           --grid
+              Batched mode: Generates -n events for each (probe, target, KE)
+              point listed in the input text file, one point per line as
+              `probe_pdg target_pdg KE' (KE in GeV, `#' starts a comment).
+              The -p, -t, -k and -f options are not used. No GHEP ntuple is
+              written: the events are classified by hA fate on the fly (as
+              by gtestINukeHadroXSec) and only the per-point fate counts and
+              cross sections are saved.
+              The random number streams are reseeded for each point, so the
+              results do not depend on the number of workers.
+           -j
+              Batched mode: Number of worker processes generating the grid
+              points in parallel (default: 1).
+           --fate-summary
+              Batched mode: Output fate summary file
+              (default: <prefix>.fates.txt).
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -67,6 +84,11 @@
              distributed as f(KE) = 1/KE in the [165 MeV, 1200 MeV] range:
              % ghAevgen -n gevgen_hadron -p 211 -t 1000260560 -k 0.165,1.200 -f '1/x'
 
+         (4) Generate 100k events for each point of grid.txt with 8 workers
+             and save the hA fate cross sections in fates.txt:
+             % gevgen_hadron -n 100000 -m hA2018 --grid grid.txt -j 8
+                             --fate-summary fates.txt
+
 \authors  Steve Dytman, Minsuk Kim and Aaron Meyer
           University of Pittsburgh
 
@@ -85,6 +107,13 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
 #include <TSystem.h>
 #include <TFile.h>
@@ -94,6 +123,7 @@
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GMCJMonitor.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -108,6 +138,7 @@
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
@@ -123,6 +154,16 @@ using namespace genie::controls;
 
 using namespace genie::utils::intranuke;
 
+using std::ofstream;
+using std::vector;
+
+// (probe, target, KE) point of the batched mode
+struct GridPoint_t {
+  int    probe;  // probe  PDG code
+  int    tgt;    // target PDG code
+  double ke;     // probe kinetic energy (GeV)
+};
+
 // Function prototypes
 void                        GetCommandLineArgs    (int argc, char ** argv);
 const EventRecordVisitorI * GetIntranuke          (void);
@@ -130,6 +171,12 @@ double                      GenProbeKineticEnergy (void);
 EventRecord *               InitializeEvent       (void);
 void                        BuildSpectrum         (void);
 void                        PrintSyntax           (void);
+void                        ReadGrid              (void);
+void                        RunGrid               (const EventRecordVisitorI * intranuke);
+void                        GenerateGridPoints    (const EventRecordVisitorI * intranuke,
+                                                   int * counts, volatile int * next_task);
+void                        WriteFateSummary      (const int * counts);
+int                         FateBin               (INukeFateHA_t fate);
 
 // Default options
 int     kDefOptNevents      = 10000;   // n-events to generate
@@ -150,9 +197,22 @@ string   gOptFlux;             // input flux (function or flux file)
 string   gOptEvFilePrefix;     // event file prefix
 bool     gOptUsingFlux=false;  // using kinetic energy distribution?
 long int gOptRanSeed ;         // random number seed
+string   gOptGridFile;         // (probe, target, KE) grid file - batched mode
+int      gOptNWorkers = 1;     // number of worker processes - batched mode
+string   gOptFateSummaryFile;  // output fate summary file - batched mode
 
 TH1D * gSpectrum  = 0;
 
+vector<GridPoint_t> gGrid;     // (probe, target, KE) points - batched mode
+
+// fate bins of the batched mode summary (the main hA fate types, as in
+// gtestINukeHadroXSec)
+const int     kNFateBins = 9;
+INukeFateHA_t kFateBins[kNFateBins] = {
+  kIHAFtUndefined, kIHAFtNoInteraction, kIHAFtCEx, kIHAFtElas, kIHAFtInelas,
+  kIHAFtAbs, kIHAFtKo, kIHAFtPiProd, kIHAFtDCEx
+};
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -171,6 +231,9 @@ int main(int argc, char ** argv)
   utils::app_init::RandGen(gOptRanSeed);
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
+  // Read the (probe, target, KE) grid, in batched mode
+  if(gOptGridFile.size() > 0) ReadGrid();
+
   // Build the incident hadron kinetic energy spectrum, if required
   BuildSpectrum();
 
@@ -179,6 +242,12 @@ int main(int argc, char ** argv)
   // Get the specified INTRANUKE model
   const EventRecordVisitorI * intranuke = GetIntranuke();
 
+  // Batched mode: generate all grid points & write out the fate summary
+  if(gOptGridFile.size() > 0) {
+    RunGrid(intranuke);
+    return 0;
+  }
+
   // Initialize an Ntuple Writer to save GHEP records into a ROOT tree
   NtpWriter ntpw(kNFGHEP, gOptRunNu);
   ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
@@ -230,6 +299,246 @@ int main(int argc, char ** argv)
   return 0;
 }
 //____________________________________________________________________________
+void ReadGrid(void)
+{
+// Read the (probe, target, KE) points of the batched mode
+
+  std::ifstream grid_file(gOptGridFile.c_str());
+  if(!grid_file.is_open()) {
+    LOG("gevgen_hadron", pFATAL)
+      << "Couldn't open grid file: " << gOptGridFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+
+  string line;
+  int iline = 0;
+  while(std::getline(grid_file, line)) {
+    iline++;
+    string::size_type icomment = line.find("#");
+    if(icomment != string::npos) line = line.substr(0, icomment);
+    line = utils::str::TrimSpaces(line);
+    if(line.size() == 0) continue;
+
+    std::istringstream sline(line);
+    GridPoint_t point;
+    sline >> point.probe >> point.tgt >> point.ke;
+    if(sline.fail() || point.ke <= 0. ||
+       !pdglib->Find(point.probe) || !pdglib->Find(point.tgt)) {
+      LOG("gevgen_hadron", pFATAL)
+        << "Invalid grid point at line " << iline << " of "
+        << gOptGridFile << ": " << line;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    gGrid.push_back(point);
+  }
+
+  if(gGrid.size() == 0) {
+    LOG("gevgen_hadron", pFATAL) << "No grid points in: " << gOptGridFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  LOG("gevgen_hadron", pNOTICE)
+    << "Read " << gGrid.size() << " grid points from: " << gOptGridFile;
+}
+//____________________________________________________________________________
+void RunGrid(const EventRecordVisitorI * intranuke)
+{
+// Batched mode: generate gOptNevents events for every grid point and save
+// the per-point fate counts. With more than one worker, worker processes
+// claim grid points from a counter in shared memory and fill the fate
+// counts, also in shared memory.
+
+  int nbins = gGrid.size() * kNFateBins;
+
+  if(gOptNWorkers <= 1) {
+    vector<int> counts(nbins, 0);
+    GenerateGridPoints(intranuke, &counts[0], 0);
+    WriteFateSummary(&counts[0]);
+    return;
+  }
+
+  size_t shmsize = (nbins + 1) * sizeof(int);
+  int * shm = (int *) mmap(0, shmsize,
+       PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if((void *) shm == MAP_FAILED) {
+    LOG("gevgen_hadron", pFATAL) << "Couldn't allocate shared fate counts";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  volatile int * next_task = shm;
+  int *          counts    = shm + 1;
+  *next_task = 0;
+  for(int i = 0; i < nbins; i++) counts[i] = 0;
+
+  vector<pid_t> wpids;
+  for(int iw = 0; iw < gOptNWorkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("gevgen_hadron", pFATAL) << "Couldn't fork worker " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) {
+      // worker
+      LOG("gevgen_hadron", pNOTICE) << "Starting worker " << iw;
+      GenerateGridPoints(intranuke, counts, next_task);
+      _exit(0);
+    }
+    wpids.push_back(pid);
+  }
+
+  bool failed = false;
+  for(int iw = 0; iw < gOptNWorkers; iw++) {
+    int status = 0;
+    waitpid(wpids[iw], &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("gevgen_hadron", pERROR) << "Worker " << iw << " failed";
+      failed = true;
+    }
+  }
+
+  if(failed) {
+    munmap((void *) shm, shmsize);
+    LOG("gevgen_hadron", pFATAL) << "At least one worker failed - Exiting";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  WriteFateSummary(counts);
+  munmap((void *) shm, shmsize);
+}
+//____________________________________________________________________________
+void GenerateGridPoints(
+   const EventRecordVisitorI * intranuke, int * counts, volatile int * next_task)
+{
+// Generate the grid points claimed from the shared task counter (or all of
+// them, if there is none) and count the events of each fate.
+// The random number streams are reseeded for each grid point.
+
+  int npoints = gGrid.size();
+  int ipoint  = (next_task) ? __sync_fetch_and_add(next_task, 1) : 0;
+
+  gOptUsingFlux = false;
+
+  while(ipoint < npoints) {
+    gOptProbePdgCode = gGrid[ipoint].probe;
+    gOptTgtPdgCode   = gGrid[ipoint].tgt;
+    gOptProbeKE      = gGrid[ipoint].ke;
+
+    LOG("gevgen_hadron", pNOTICE)
+       << "Generating grid point " << ipoint << ": probe = "
+       << gOptProbePdgCode << ", target = " << gOptTgtPdgCode
+       << ", KE = " << gOptProbeKE << " GeV";
+
+    RandomGen::Instance()->SetEventIndex(ipoint);
+
+    int * point_counts = counts + ipoint * kNFateBins;
+    for(int ievent = 0; ievent < gOptNevents; ievent++) {
+      EventRecord * evrec = InitializeEvent();
+      intranuke->ProcessEventRecord(evrec);
+
+      INukeFateHA_t fate = FindhAFate(evrec);
+      point_counts[FateBin(fate)]++;
+
+      delete evrec;
+    }
+
+    ipoint = (next_task) ? __sync_fetch_and_add(next_task, 1) : ipoint+1;
+  }
+}
+//____________________________________________________________________________
+int FateBin(INukeFateHA_t fate)
+{
+// Summary bin of the input hA fate (the pion production fates are merged)
+
+  switch (fate) {
+    case kIHAFtUndefined     : return 0;
+    case kIHAFtNoInteraction : return 1;
+    case kIHAFtCEx           : return 2;
+    case kIHAFtElas          : return 3;
+    case kIHAFtInelas        : return 4;
+    case kIHAFtAbs           : return 5;
+    case kIHAFtKo            : return 6;
+    case kIHAFtDCEx          : return 8;
+    default                  : break;
+  }
+  if(kIHAFtPiProd <= fate && fate <= kIHAFtInclPi0) return 7;
+
+  LOG("gevgen_hadron", pWARN) << "Undefined fate from FindhAFate() : " << fate;
+  return 0;
+}
+//____________________________________________________________________________
+void WriteFateSummary(const int * counts)
+{
+// Write the fate counts & cross sections of all grid points in a text file.
+// The cross sections are computed as in gtestINukeHadroXSec, over the area
+// of a disk with the hadron tracking radius (NR = 3, R0 = 1.4 fm).
+
+  const double fm2tomb = units::fm2 / units::mb;
+  const double NR      = 3;
+  const double R0      = 1.4;
+  const double dnev    = (double) gOptNevents;
+
+  ofstream out(gOptFateSummaryFile.c_str());
+  if(!out.is_open()) {
+    LOG("gevgen_hadron", pFATAL)
+      << "Couldn't open fate summary file: " << gOptFateSummaryFile;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  out << "# gevgen_hadron fate summary - mode: " << gOptMode
+      << ", events per point: " << gOptNevents
+      << ", seed: " << gOptRanSeed << "\n";
+  out << "# probe target KE(GeV) sigtot(mb) sigtot_err(mb)";
+  for(int k = 0; k < kNFateBins; k++) {
+    if(k == 1) continue;
+    string name = INukeHadroFates::AsString(kFateBins[k]);
+    out << " [" << name << "](mb) err(mb)";
+  }
+  out << " ; then the event counts of all fates:";
+  for(int k = 0; k < kNFateBins; k++) {
+    out << " " << INukeHadroFates::AsString(kFateBins[k]);
+  }
+  out << "\n";
+
+  for(unsigned int ipoint = 0; ipoint < gGrid.size(); ipoint++) {
+    const int * point_counts = counts + ipoint * kNFateBins;
+
+    int    A    = pdg::IonPdgCodeToA(gGrid[ipoint].tgt);
+    double R    = NR * R0 * TMath::Power(A, 1./3.); // fm
+    double area = fm2tomb * TMath::Pi() * R * R;    // mb
+
+    int cnttot = 0;
+    for(int k = 0; k < kNFateBins; k++) {
+      if(k != 1) cnttot += point_counts[k];
+    }
+    double ratio = cnttot / dnev;
+
+    out << gGrid[ipoint].probe << " " << gGrid[ipoint].tgt << " "
+        << gGrid[ipoint].ke << " "
+        << area * ratio << " " << area * TMath::Sqrt(cnttot)/dnev;
+    for(int k = 0; k < kNFateBins; k++) {
+      if(k == 1) continue;
+      double r   = point_counts[k] / dnev;
+      double err = area * TMath::Sqrt(r*(1-r)/dnev);
+      if(err == 0) err = area * TMath::Sqrt(point_counts[k])/dnev;
+      out << " " << area * r << " " << err;
+    }
+    for(int k = 0; k < kNFateBins; k++) out << " " << point_counts[k];
+    out << "\n";
+  }
+  out.close();
+
+  LOG("gevgen_hadron", pNOTICE)
+     << "Saved the fate summary of " << gGrid.size()
+     << " grid points in: " << gOptFateSummaryFile;
+}
+//____________________________________________________________________________
 const EventRecordVisitorI * GetIntranuke(void)
 {
 // get the requested INTRANUKE module
@@ -404,6 +713,23 @@ void GetCommandLineArgs(int argc, char ** argv)
 
   CmdLnArgParser parser(argc,argv);
 
+  // (probe, target, KE) grid - batched mode
+  if( parser.OptionExists("grid") ) {
+    LOG("gevgen_hadron", pINFO) << "Reading (probe, target, KE) grid file";
+    gOptGridFile = parser.ArgAsString("grid");
+  }
+  bool batched = (gOptGridFile.size() > 0);
+
+  // number of worker processes - batched mode
+  if( parser.OptionExists('j') ) {
+    LOG("gevgen_hadron", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt('j');
+    if(!batched) {
+      LOG("gevgen_hadron", pWARN)
+        << "Worker processes are only used in batched mode (--grid)";
+    }
+  }
+
   // number of events
   if( parser.OptionExists('n') ) {
     LOG("gevgen_hadron", pINFO) << "Reading number of events to generate";
@@ -427,7 +753,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   if( parser.OptionExists('p') ) {
     LOG("gevgen_hadron", pINFO) << "Reading rescattering particle PDG code";
     gOptProbePdgCode = parser.ArgAsInt('p');
-  } else {
+  } else if(!batched) {
     LOG("gevgen_hadron", pFATAL) << "Unspecified PDG code - Exiting";
     PrintSyntax();
     gAbortingInErr = true;
@@ -438,7 +764,7 @@ void GetCommandLineArgs(int argc, char ** argv)
   if( parser.OptionExists('t') ) {
     LOG("gevgen_hadron", pINFO) << "Reading target PDG code";
     gOptTgtPdgCode = parser.ArgAsInt('t');
-  } else {
+  } else if(!batched) {
     LOG("gevgen_hadron", pFATAL) << "Unspecified target PDG code - Exiting";
     PrintSyntax();
     gAbortingInErr = true;
@@ -493,7 +819,7 @@ void GetCommandLineArgs(int argc, char ** argv)
           exit(1);
        }
     }
-  } else {
+  } else if(!batched) {
     LOG("gevgen_hadron", pFATAL) << "Unspecified kinetic energy - Exiting";
     PrintSyntax();
     gAbortingInErr = true;
@@ -510,6 +836,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptEvFilePrefix = kDefOptEvFilePrefix;
   } //-o
 
+  // fate summary file - batched mode
+  if( parser.OptionExists("fate-summary") ) {
+    LOG("gevgen_hadron", pINFO) << "Reading the fate summary filename";
+    gOptFateSummaryFile = parser.ArgAsString("fate-summary");
+  } else {
+    gOptFateSummaryFile = gOptEvFilePrefix + ".fates.txt";
+  }
+
   // INTRANUKE mode
   if( parser.OptionExists('m') ) {
     LOG("gevgen_hadron", pINFO) << "Reading mode";
@@ -538,6 +872,14 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gevgen_hadron", pNOTICE) << "Random number seed = " << gOptRanSeed;
   LOG("gevgen_hadron", pNOTICE) << "Mode               = " << gOptMode;
   LOG("gevgen_hadron", pNOTICE) << "Number of events   = " << gOptNevents;
+  if(batched) {
+    LOG("gevgen_hadron", pNOTICE) << "Grid file          = " << gOptGridFile;
+    LOG("gevgen_hadron", pNOTICE) << "Number of workers  = " << gOptNWorkers;
+    LOG("gevgen_hadron", pNOTICE) << "Fate summary file  = " << gOptFateSummaryFile;
+    LOG("gevgen_hadron", pNOTICE) << "\n";
+    LOG("gevgen_hadron", pNOTICE) << *RunOpt::Instance();
+    return;
+  }
   LOG("gevgen_hadron", pNOTICE) << "Probe PDG code     = " << gOptProbePdgCode;
   LOG("gevgen_hadron", pNOTICE) << "Target PDG code    = " << gOptTgtPdgCode;
   if(gOptProbeKEmin<0 && gOptProbeKEmax<0) {
@@ -566,6 +908,7 @@ void PrintSyntax(void)
     << "   gevgen_hadron [-r run] [-n nev] -p hadron_pdg -t tgt_pdg -k KE [-m mode] "
     << "                 [-f flux] "
     << "                 [--seed random_number_seed]"
+    << "                 [--grid grid_file [-j nworkers] [--fate-summary file]]"
     << "                 [--message-thresholds xml_file]"
     << "                 [--event-record-print-level level]"
     << "                 [--mc-job-status-refresh-rate rate]"
@@ -28,13 +28,15 @@
                        [-d debug flags]
                        [--seed random_number_seed]
                        [ --cross-sections xml_file]
+                       [--dm-spline-family file_stem]
                        [--event-generator-list list_name]
                        [--tune genie_tune]
                        [--message-thresholds xml_file]
                        [--unphysical-event-mask mask]
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
-                       [--cache-file root_file]
+                       [--cache-file root_file] [--cache-read-only]
+                       [--artifact-store directory]
 
          *** Options :
 
@@ -192,6 +194,11 @@
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
+           --dm-spline-family
+              Name stem of a family of cross section spline files, built by
+              gmkspl_dm over a grid of DM masses, mediator mass ratios and
+              couplings. The splines of the nearest grid point are loaded,
+              and rescaled exactly to the requested coupling.
            --tune
               Specifies a GENIE comprehensive neutrino interaction model tune.
               [default: "Default"].
@@ -211,6 +218,16 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --cache-read-only
+              Use the cache file only to warm-start the job, without writing
+              it back. Many concurrent jobs can share a read-only cache file.
+           --artifact-store
+              A directory where the maximum path-lengths of the input geometry
+              are stored, keyed by the job setup (geometry contents, top volume,
+              units, flux file, fiducial cut, geometry scan settings). Jobs with
+              the same setup read them back instead of scanning the geometry
+              again. Many concurrent jobs can share the store.
+              See GMCJArtifactStore.
 
          *** Examples:
 
@@ -280,6 +297,7 @@
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GMCJArtifactStore.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Ntuple/NtpWriter.h"
@@ -295,6 +313,7 @@
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/SystemUtils.h"
+#include "Physics/BoostedDarkMatter/XSection/DMUtils.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #include "Tools/Flux/GFluxDriverFactory.h"
@@ -370,6 +389,7 @@ string          gOptEvFilePrefix;              // event file prefix
 int             gOptDebug = 0;                 // debug flags
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+string          gOptDMSplineFamily;            // spline family file name stem
 
 bool            gSigTERM = false;              // was TERM signal sent?
 
@@ -401,9 +421,20 @@ int main(int argc, char ** argv)
   // Initialization of random number generators, cross-section table,
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::CacheFile(
+     RunOpt::Instance()->CacheFile(), RunOpt::Instance()->CacheReadOnly());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, false);
+  if(gOptDMSplineFamily.size() > 0) {
+    bool loaded = utils::dm::LoadSplineFamily(
+       gOptDMSplineFamily, gOptDMMass, gOptMedRatio, utils::dm::ZpCoupling());
+    if(!loaded) {
+      LOG("gevgen_lardm", pFATAL)
+        << "Could not load the spline family: " << gOptDMSplineFamily;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
@@ -550,18 +581,37 @@ int main(int argc, char ** argv)
   mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
   mcj_driver->UseFluxDriver(flux_driver);
   mcj_driver->UseGeomAnalyzer(geom_driver);
+
+  // without an input max path lengths XML file, look for the max path
+  // lengths computed by an earlier job with the same setup, if an artifact
+  // store is used
+  GMCJArtifactStore artifacts(RunOpt::Instance()->ArtifactStore());
+  if ( gOptUsingRootGeom ) {
+    artifacts.AddFileKey ("geom",   gOptRootGeom);
+    artifacts.AddKey     ("topvol", gOptRootGeomTopVol);
+    artifacts.AddKey     ("lunits", gOptGeomLUnits);
+    artifacts.AddKey     ("dunits", gOptGeomDUnits);
+    artifacts.AddKey     ("fidcut", gOptFidCut);
+    artifacts.AddKey     ("nscan",  gOptNScan);
+    artifacts.AddKey     ("zmin",   gOptZmin);
+    artifacts.AddFilesKey("flux",   gOptFluxFile);
+    artifacts.AddKey     ("dmmass", gOptDMMass);
+  }
   if ( ( gOptExtMaxPlXml != "" ) && ! gOptWriteMaxPlXml ) {
     mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
+  } else if ( gOptUsingRootGeom ) {
+    artifacts.UseMaxPathLengths(mcj_driver);
   }
   mcj_driver->Configure();
   mcj_driver->UseSplines();
   mcj_driver->ForceSingleProbScale();
+  if ( gOptUsingRootGeom ) artifacts.SaveMaxPathLengths(mcj_driver);
 
   if ( ( gOptExtMaxPlXml != "" ) && gOptWriteMaxPlXml ) {
     geometry::ROOTGeomAnalyzer * rgeom =
       dynamic_cast<geometry::ROOTGeomAnalyzer *>(geom_driver);
     if ( rgeom ) {
-      const genie::PathLengthList& maxpath = rgeom->GetMaxPathLengths();
+      const genie::PathLengthList& maxpath = mcj_driver->MaxPathLengths();
       std::string maxplfile = gOptExtMaxPlXml;
       maxpath.SaveAsXml(maxplfile);
       // append extra info to file
@@ -1036,6 +1086,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // dark matter spline family
+  if( parser.OptionExists("dm-spline-family") ) {
+    LOG("gevgen_lardm", pINFO) << "Reading spline family file name stem";
+    gOptDMSplineFamily = parser.ArgAsString("dm-spline-family");
+  } else {
+    gOptDMSplineFamily = "";
+  }
+
   //
   // >>> print the command line options
   //
@@ -1080,6 +1138,8 @@ void GetCommandLineArgs(int argc, char ** argv)
       << "\n - Run number: " << gOptRunNu
       << "\n - Random number seed: " << gOptRanSeed
       << "\n - Using cross-section file: " << gOptInpXSecFile
+      << "\n - Using cross-section spline family: "
+      << ((gOptDMSplineFamily.size()==0) ? "<none>" : gOptDMSplineFamily)
       << "\n - Flux     @ " << fluxinfo.str()
       << "\n - Geometry @ " << gminfo.str()
       << "\n - Exposure @ " << exposure.str();
@@ -1102,12 +1162,14 @@ void PrintSyntax(void)
    << "\n            [-z zmin_start]"
    << "\n            [--seed random_number_seed]"
    << "\n             --cross-sections xml_file"
+   << "\n            [--dm-spline-family file_stem]"
    << "\n            [--event-generator-list list_name]"
    << "\n            [--message-thresholds xml_file]"
    << "\n            [--unphysical-event-mask mask]"
    << "\n            [--event-record-print-level level]"
    << "\n            [--mc-job-status-refresh-rate  rate]"
-   << "\n            [--cache-file root_file]"
+   << "\n            [--cache-file root_file] [--cache-read-only]"
+   << "\n            [--artifact-store directory]"
    << "\n"
    << " Please also read the detailed documentation at "
    << "$GENIE/src/Apps/gFNALExptEvGen.cxx"
@@ -32,6 +32,10 @@
            e) NC coherent scattering. 
            Each such NC1pi0 source contributes differently to the pion momentum distribution.
 
+         Event files with an event index tree (gidx, written by default at
+         generation time - see NtpEventIndex) are selected by reading the
+         index only: just the picked GHEP event records are deserialized.
+
          Synopsis:
            gevpick -i list_of_input_files -t topology  
                    [-o output_file]
@@ -121,6 +125,7 @@
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -138,7 +143,7 @@ using namespace genie;
 // func prototypes
 void   GetCommandLineArgs (int argc, char ** argv);
 void   RunCherryPicker    (void);
-bool   AcceptEvent        (const EventRecord & event);
+bool   AcceptEvent        (const NtpEventIndex & index);
 void   PrintSyntax        (void);
 string DefaultOutputFile  (void);
 
@@ -241,21 +246,37 @@ void RunCherryPicker(void)
      LOG("gevpick", pNOTICE) 
           << "Input tree header: " << *thdr;
 
+     // use the event index, if there is one, to select events without
+     // reading the GHEP records
+     NtpEventIndex index;
+     TTree * index_tree = 
+        dynamic_cast <TTree *> ( fin.Get(NtpEventIndex::TreeName()) );
+     bool use_index = 
+        (index_tree != 0 && index_tree->GetEntries() == nmax);
+     if(use_index) {
+        index.ReadTree(index_tree);
+        LOG("gevpick", pNOTICE) << "Selecting events using the event index";
+     }
+
      //
      // Loop over events in current file
      //
 
      for(Long64_t iev = 0; iev < nmax; iev++) {
+       if(use_index) {
+         index_tree->GetEntry(iev);
+         if(!AcceptEvent(index)) continue;
+       }
        ghep_tree->GetEntry(iev);
        NtpMCRecHeader rec_header = mcrec->hdr;
        EventRecord &  event      = *(mcrec->event);
        LOG("gevpick", pDEBUG) << rec_header;
        LOG("gevpick", pDEBUG) << event;
-       if(AcceptEvent(event)) {
+       if(!use_index) index.Set(iev, event);
+       if(AcceptEvent(index)) {
           brOrigFilename->SetString(chEl->GetTitle());
           brOrigEvtNum = iev;
-          EventRecord * event_copy = new EventRecord(event);
-          ntpw.AddEventRecord(iev_glob,event_copy);
+          ntpw.AddEventRecord(iev_glob,&event);
           iev_glob++;
        }
        mcrec->Clear();
@@ -269,78 +290,26 @@ void RunCherryPicker(void)
   LOG("gevpick", pFATAL) << "Done!";
 }
 //____________________________________________________________________________________
-bool AcceptEvent(const EventRecord & event)
+bool AcceptEvent(const NtpEventIndex & index)
 {
   if ( gPickedTopology == kPtAll       ) return true;
   if ( gPickedTopology == kPtUndefined ) return false;
 
-  const Interaction * interaction = event.Summary();
-
-  int  nupdg     = event.Probe()->Pdg();
+  int  nupdg     = index.probe;
   bool isnumu    = (nupdg == kPdgNuMu);
   bool isnumubar = (nupdg == kPdgAntiNuMu);
-  bool iscc      = interaction->ProcInfo().IsWeakCC();
-  bool isnc      = interaction->ProcInfo().IsWeakNC();
-
-  int NfP        = 0; // number of protons         in final state
-  int NfPbar     = 0; // number of anti-protons    in final state
-  int NfN        = 0; // number of neutrons        in final state
-  int NfNbar     = 0; // number of anti-neutrons   in final state
-  int NfPip      = 0; // number of \pi^+'s         in final state
-  int NfPim      = 0; // number of \pi^-'s         in final state
-  int NfPi0      = 0; // number of \pi^0's         in final state
-  int NfKp       = 0; // number of \K^+'s          in final state
-  int NfKm       = 0; // number of \K^-'s          in final state
-  int NfK0       = 0; // number of \K^0's          in final state
-  int NfK0bar    = 0; // number of \bar{\K^0}'s    in final state
-  int NfSigmap   = 0; // number of \Sigma^+'s      in final state
-  int NfSigma0   = 0; // number of \Sigma^0's      in final state
-  int NfSigmam   = 0; // number of \Sigma^-'s      in final state
-  int NfLambda0  = 0; // number of \Lambda^0's     in final state
-  int NfXi0      = 0; // number of \Xi^0's         in final state
-  int NfXim      = 0; // number of \Xi^-'s         in final state
-  int NfOmegam   = 0; // number of \Omega^-'s      in final state
-  int NfOther    = 0; // number of other particles in final state
-
-  TObjArrayIter piter(&event);
-  GHepParticle * p = 0;
-  int ip=-1;
-  while( (p = (GHepParticle *) piter.Next())) {
-    ip++;
-    int pdgc = p->Pdg();
-    int ist  = p->Status();
-    // only final state particles
-    if(ist!=kIStStableFinalState) continue;
-    // don't count final state lepton as part of the hadronic system
-    if(event.Particle(ip)->FirstMother()==0) continue;
-    // skip pseudo-particles
-    if(pdg::IsPseudoParticle(pdgc)) continue;
-    // count ...
-    if      (pdgc == kPdgProton     ) NfP++;
-    else if (pdgc == kPdgAntiProton ) NfPbar++;
-    else if (pdgc == kPdgNeutron    ) NfN++;
-    else if (pdgc == kPdgAntiNeutron) NfNbar++;
-    else if (pdgc == kPdgPiP        ) NfPip++;
-    else if (pdgc == kPdgPiM        ) NfPim++;
-    else if (pdgc == kPdgPi0        ) NfPi0++;
-    else if (pdgc == kPdgKP         ) NfKp++;
-    else if (pdgc == kPdgKM         ) NfKm++;
-    else if (pdgc == kPdgK0         ) NfK0++;
-    else if (pdgc == kPdgAntiK0     ) NfK0bar++;
-    else if (pdgc == kPdgSigmaP     ) NfSigmap++;
-    else if (pdgc == kPdgSigma0     ) NfSigma0++;
-    else if (pdgc == kPdgSigmaM     ) NfSigmam++;
-    else if (pdgc == kPdgLambda     ) NfLambda0++;
-    else if (pdgc == kPdgXi0        ) NfXi0++;
-    else if (pdgc == kPdgXiM        ) NfXim++;
-    else if (pdgc == kPdgOmegaM     ) NfOmegam++;
-    else                              NfOther++;
-  }
+  bool iscc      = (index.intt == kIntWeakCC);
+  bool isnc      = (index.intt == kIntWeakNC);
+
+  int NfPip      = index.nfpip; // number of \pi^+'s   in final state
+  int NfPim      = index.nfpim; // number of \pi^-'s   in final state
+  int NfPi0      = index.nfpi0; // number of \pi^0's   in final state
+  int NfHyperon  = index.nfhyp; // number of hyperons  in final state
 
   bool is1pipX  = (NfPip==1 && NfPi0==0 && NfPim==0);
   bool is1pi0X  = (NfPip==0 && NfPi0==1 && NfPim==0);
   bool is1pimX  = (NfPip==0 && NfPi0==0 && NfPim==1);
-  bool has_hype = (NfSigmap+NfSigma0+NfSigmam+NfLambda0+NfXi0+NfXim+NfOmegam > 0);
+  bool has_hype = (NfHyperon > 0);
 
   if ( gPickedTopology == kPtNumuCC1pip ) {
     if(isnumu && iscc && is1pipX) return true;
@@ -10,6 +10,7 @@
              -f ghep_event_file 
             [-o output_error_log_file]
             [-n nev1[,nev2]]
+            [-j nthreads]
             [--add-event-printout-in-error-log]
             [--max-num-of-errors-shown n]
             [--event-record-print-level level]
@@ -22,6 +23,15 @@
             [--check-decayer-consistency]
             [--all]
 
+         All requested checks are run in a single pass over the event tree,
+         optionally split in entry ranges scanned by concurrent threads (-j).
+         The error log lists the events failing each check in entry order,
+         check by check, as if the checks were run one after the other.
+         With --max-num-of-errors-shown, the scan stops once every requested
+         per-event check has found as many failing events (unless a check
+         needing the whole sample, ie the vertex distribution or decayer
+         consistency check, was requested).
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -40,10 +50,16 @@
 #include <iomanip>
 #include <sstream>
 #include <fstream>
+#include <map>
+#include <algorithm>
+#include <pthread.h>
 
+#include <RVersion.h>
+#include <TROOT.h>
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TObjArray.h>
 #include <TH1D.h>
 #include <TLorentzVector.h>
 
@@ -66,6 +82,7 @@ using std::ostringstream;
 using std::ofstream;
 using std::string;
 using std::vector;
+using std::map;
 using std::setw;
 using std::setprecision;
 using std::setfill;
@@ -79,12 +96,14 @@ void GetCommandLineArgs (int argc, char ** argv);
 void PrintSyntax        (void);
 bool CheckRootFilename  (string filename);
 
-// checks
-void CheckEnergyMomentumConservation (void);
-void CheckChargeConservation (void);
-void CheckForPseudoParticlesInFinState (void);
-void CheckForOffMassShellParticlesInFinState (void);
-void CheckForNumFinStateNucleonsInconsistentWithTarget (void);
+// per-event checks (true if the event passes or can not be checked)
+bool EnergyMomentumIsConserved (EventRecord & event);
+bool ChargeIsConserved (EventRecord & event);
+bool HasNoPseudoParticlesInFinState (EventRecord & event);
+bool HasNoOffMassShellParticlesInFinState (EventRecord & event);
+bool NumFinStateNucleonsIsConsistentWithTarget (EventRecord & event);
+
+// checks over the whole sample
 void CheckVertexDistribution (void);
 void CheckDecayerConsistency (void);
 
@@ -102,6 +121,7 @@ bool     gOptCheckForOffMassShellParticlesInFinState = false;
 bool     gOptCheckForNumFinStateNucleonsInconsistentWithTarget = false;
 bool     gOptCheckVertexDistribution = false;
 bool     gOptCheckDecayerConsistency = false;
+int      gOptNThreads = 1;
 
 Long64_t gFirstEventNum = -1;
 Long64_t gLastEventNum  = -1;
@@ -110,6 +130,71 @@ TTree *            gEventTree = 0;
 NtpMCEventRecord * gMCRec = 0;
 ofstream           gErrLog;
 
+// the per-event checks, in the order they are reported
+struct EvtCheck_t {
+  bool * enabled;
+  bool (*passes)(EventRecord & event);
+  const char * mesg;          // start of check message
+  const char * errlog_title;  // error log section title
+  const char * error;         // error message for a failing event
+  const char * summary;       // summary message (after the # of failing events)
+  bool         errlog_endl;   // end line after each failing event in the error log
+};
+const EvtCheck_t kEvtChecks[] = {
+  { &gOptCheckEnergyMomentumConservation, EnergyMomentumIsConserved,
+    "Checking energy/momentum conservation...",
+    "Events failing the energy-momentum conservation test:",
+    "Energy-momentum non-conservation in event: ",
+    " events failing the energy/momentum conservation test", false },
+  { &gOptCheckChargeConservation, ChargeIsConserved,
+    "Checking charge conservation...",
+    "Events failing the charge conservation test:",
+    "Charge non-conservation in event: ",
+    " events failing the charge conservation test", true },
+  { &gOptCheckForPseudoParticlesInFinState, HasNoPseudoParticlesInFinState,
+    "Checking for pseudo-particles appearing in final state...",
+    "Events with pseudo-particles in final state:",
+    "Pseudo-particle final state particle in event: ",
+    " events with pseudo-particles in  final state", true },
+  { &gOptCheckForOffMassShellParticlesInFinState, HasNoOffMassShellParticlesInFinState,
+    "Checking for off-mass-shell particles appearing in the final state...",
+    "Events with off-mass-shell particles in final state:",
+    "Off-mass-shell final state particle in event: ",
+    " events with off-mass-shell particles in final state", true },
+  { &gOptCheckForNumFinStateNucleonsInconsistentWithTarget, NumFinStateNucleonsIsConsistentWithTarget,
+    "Checking for number of final state nucleons inconsistent with target...",
+    "Events with number of final state nucleons inconsistent with target:",
+    "Number of final state nucleons inconsistent with target in event: ",
+    " events with a number of final state nucleons inconsistent with target", true }
+};
+const int kNEvtChecks = sizeof(kEvtChecks) / sizeof(EvtCheck_t);
+
+// vertex distribution binning (fm)
+const int    kVtxNBins = 150;
+const double kVtxRMax  = 30.;
+
+// the results of scanning a range of entries
+struct EvScanRange_t {
+  Long64_t                  first;
+  Long64_t                  last;
+  TTree *                   tree;  // 0: read through a new TFile
+  bool                      ok;
+  vector<Long64_t>          errors[kNEvtChecks];    // failing events, per check
+  vector<int>               final_state_particles;  // in order of first appearance
+  vector<int>               decayed_particles;      // in order of first appearance
+  int                       vtx_target;             // first nuclear target seen (1000*Z+A)
+  map<int, vector<double> > vtx_r;                  // vertex r distribution, per target
+
+  EvScanRange_t() : first(0), last(-1), tree(0), ok(true), vtx_target(0) { }
+};
+EvScanRange_t gScan; // merged results
+
+void   ScanEvents             (void);
+void * ScanEventRange         (void * arg);
+void   ReportEventCheck       (int k);
+void   FillVertexDistribution (EventRecord & event, EvScanRange_t & range);
+void   FillDecayerLists       (EventRecord & event, EvScanRange_t & range);
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -166,20 +251,12 @@ int main(int argc, char ** argv)
      gErrLog << "# " << endl;
   }
 
-  if (gOptCheckEnergyMomentumConservation) {
-	  CheckEnergyMomentumConservation();
-  }
-  if (gOptCheckChargeConservation) {
-          CheckChargeConservation();
-  }
-  if (gOptCheckForPseudoParticlesInFinState) {
-          CheckForPseudoParticlesInFinState();
-  }
-  if (gOptCheckForOffMassShellParticlesInFinState) {
-          CheckForOffMassShellParticlesInFinState();
-  }
-  if (gOptCheckForNumFinStateNucleonsInconsistentWithTarget) {
-          CheckForNumFinStateNucleonsInconsistentWithTarget();
+  ScanEvents();
+
+  for(int k = 0; k < kNEvtChecks; k++) {
+    if (*kEvtChecks[k].enabled) {
+          ReportEventCheck(k);
+    }
   }
   if (gOptCheckVertexDistribution) {
           CheckVertexDistribution();
@@ -196,417 +273,389 @@ int main(int argc, char ** argv)
   return 0;
 }
 //____________________________________________________________________________
-void CheckEnergyMomentumConservation (void)
+void ScanEvents(void)
 {
-  LOG("gevscan", pNOTICE) << "Checking energy/momentum conservation...";
-
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events failing the energy-momentum conservation test:" << endl;
-    gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
+// Run all requested checks in a single pass over the requested entries.
+// The entry range is split in contiguous sub-ranges, scanned by concurrent
+// threads, each reading the input file through its own TFile/TTree. The
+// results of each sub-range are merged in entry order, so the reports are
+// identical to those of a scan in a single thread.
 
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
+  Long64_t nev      = gLastEventNum - gFirstEventNum + 1;
+  int      nthreads = (int) TMath::Min((Long64_t) gOptNThreads, nev);
 
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+  // initialize the shared libraries used in the per-event checks
+  PDGLibrary::Instance();
 
-    double E_init  = 0, E_fin  = 0; // E
-    double px_init = 0, px_fin = 0; // px
-    double py_init = 0, py_fin = 0; // py
-    double pz_init = 0, pz_fin = 0; // pz
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-      GHepStatus_t ist  = p->Status();
+  vector<EvScanRange_t> ranges(nthreads);
+  Long64_t nslice = (nev + nthreads - 1) / nthreads;
+  for(int it = 0; it < nthreads; it++) {
+    ranges[it].first = gFirstEventNum + it*nslice;
+    ranges[it].last  = TMath::Min(ranges[it].first + nslice - 1, gLastEventNum);
+    ranges[it].tree  = (it == 0) ? gEventTree : 0;
+    ranges[it].ok    = true;
+  }
 
-      if(ist == kIStInitialState) 
-      {
-         E_init  += p->E();
-         px_init += p->Px();
-         py_init += p->Py();
-         pz_init += p->Pz();
-       }
-       if(ist == kIStStableFinalState || 
-          ist == kIStFinalStateNuclearRemnant) 
-       {
-         E_fin   += p->E();
-         px_fin  += p->Px();
-         py_fin  += p->Py();
-         pz_fin  += p->Pz();
-       }
-    }//p
-
-    double epsilon = 1E-3; 
-
-    bool E_conserved  = TMath::Abs(E_init  - E_fin)  < epsilon;
-    bool px_conserved = TMath::Abs(px_init - px_fin) < epsilon;
-    bool py_conserved = TMath::Abs(py_init - py_fin) < epsilon;
-    bool pz_conserved = TMath::Abs(pz_init - pz_fin) < epsilon;
-
-    bool ok = E_conserved  && 
-              px_conserved &&
-              py_conserved &&
-              pz_conserved;
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Energy-momentum non-conservation in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-           gErrLog << i;
-           if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-           }
-       }
-       nerr++;
+  LOG("gevscan", pNOTICE)
+    << "Scanning events " << gFirstEventNum << " to " << gLastEventNum
+    << " (" << nthreads << " thread(s))...";
+
+  vector<pthread_t> threads(nthreads);
+  vector<bool>      started(nthreads, false);
+  if(nthreads > 1) {
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+    ROOT::EnableThreadSafety();
+    for(int it = 1; it < nthreads; it++) {
+      started[it] =
+        (pthread_create(&threads[it], 0, ScanEventRange, &ranges[it]) == 0);
     }
-    
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
+#else
+    LOG("gevscan", pWARN)
+      << "Multi-threaded scanning needs ROOT >= 6 - Using a single thread";
+#endif
   }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the energy/momentum conservation test";
-}
-//____________________________________________________________________________
-void CheckChargeConservation(void)
-{
-  LOG("gevscan", pNOTICE) << "Checking charge conservation...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events failing the charge conservation test:" << endl;
-     gErrLog << "# " << endl;
+  ScanEventRange(&ranges[0]);
+  for(int it = 1; it < nthreads; it++) {
+    if(started[it]) pthread_join(threads[it], 0);
+    else            ScanEventRange(&ranges[it]);
   }
 
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    // Can't run the test for neutrinos scattered off nuclear targets
-    // because of intranuclear rescattering effects and the presence, in the event
-    // record, of a charged nuclear remnant pseudo-particle whose charge is not stored.
-    // To check charge conservation in the primary interaction, use a sample generated
-    // for a free nucleon targets.
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event in nuclear target - Skipping test...";
+  // merge
+  for(int it = 0; it < nthreads; it++) {
+    const EvScanRange_t & range = ranges[it];
+    if(!range.ok) {
+      LOG("gevscan", pFATAL)
+        << "Couldn't read events " << range.first << " to " << range.last;
+      gAbortingInErr = true;
+      exit(1);
     }
-    else {
-      double Q_init  = 0;
-      double Q_fin   = 0; 
-
-      GHepParticle * p = 0;
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-        GHepStatus_t ist  = p->Status();
-
-        if(ist == kIStInitialState) 
-        {
-           Q_init  += p->Charge();
-         }
-         if(ist == kIStStableFinalState)
-         {
-           Q_fin  += p->Charge();
-         }
-      }//p
-
-      double epsilon = 1E-3; 
-      bool ok = TMath::Abs(Q_init - Q_fin)  < epsilon;
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Charge non-conservation in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-            gErrLog << i << endl;    
-            if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-            }
-         }
-         nerr++;
+    for(int k = 0; k < kNEvtChecks; k++) {
+      vector<Long64_t> & errors = gScan.errors[k];
+      errors.insert(errors.end(), range.errors[k].begin(), range.errors[k].end());
+      if(gOptMaxNumErrs != -1 && (int) errors.size() > gOptMaxNumErrs) {
+        errors.resize(gOptMaxNumErrs);
+      }
+    }
+    gScan.final_state_particles.insert(gScan.final_state_particles.end(),
+       range.final_state_particles.begin(), range.final_state_particles.end());
+    gScan.decayed_particles.insert(gScan.decayed_particles.end(),
+       range.decayed_particles.begin(), range.decayed_particles.end());
+    if(gScan.vtx_target == 0) gScan.vtx_target = range.vtx_target;
+    map<int, vector<double> >::const_iterator vtx_iter = range.vtx_r.begin();
+    for( ; vtx_iter != range.vtx_r.end(); ++vtx_iter) {
+      vector<double> & counts = gScan.vtx_r[vtx_iter->first];
+      counts.resize(vtx_iter->second.size(), 0.);
+      for(unsigned int ib = 0; ib < counts.size(); ib++) {
+        counts[ib] += vtx_iter->second[ib];
       }
-      
     }
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
-
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
   }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events failing the charge conservation test";
 }
 //____________________________________________________________________________
-void CheckForPseudoParticlesInFinState(void)
+void * ScanEventRange(void * arg)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for pseudo-particles appearing in final state...";
-
-  if(gErrLog.is_open()) {
-     gErrLog << "# Events with pseudo-particles in final state:" << endl;
-     gErrLog << "# " << endl;
+  EvScanRange_t * range = (EvScanRange_t *) arg;
+
+  bool sample_checks = gOptCheckVertexDistribution || gOptCheckDecayerConsistency;
+  bool event_checks  = false;
+  for(int k = 0; k < kNEvtChecks; k++) event_checks |= *kEvtChecks[k].enabled;
+  if(!event_checks && !sample_checks) return 0;
+
+  // each thread but the first reads through its own file
+  TFile *            file  = 0;
+  TTree *            tree  = range->tree;
+  NtpMCEventRecord * mcrec = 0;
+  if(!tree) {
+    file = new TFile(gOptInpFilename.c_str(),"READ");
+    tree = dynamic_cast <TTree *> (file->Get("gtree"));
+    if(!tree) {
+      range->ok = false;
+      delete file;
+      return 0;
+    }
   }
+  tree->SetBranchAddress("gmcrec", &mcrec);
 
-  int nerr = 0;
+  // only the event record is needed
+  TObjArray * branches = tree->GetListOfBranches();
+  for(int ib = 0; ib < branches->GetEntries(); ib++) {
+    string name = branches->At(ib)->GetName();
+    if(name != "gmcrec") tree->SetBranchStatus(name.c_str(), 0);
+  }
 
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
+  for(Long64_t i = range->first; i <= range->last; i++)
   {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+    // stop as soon as all checks have found as many errors as will be shown
+    bool done = !sample_checks;
+    for(int k = 0; k < kNEvtChecks; k++) {
+      if(!*kEvtChecks[k].enabled) continue;
+      bool capped = (gOptMaxNumErrs != -1 &&
+                     (int) range->errors[k].size() >= gOptMaxNumErrs);
+      done = done && capped;
+    }
+    if(done) break;
 
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    bool ok = true;
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    tree->GetEntry(i);
+    EventRecord & event = *(mcrec->event);
 
-      GHepStatus_t ist = p->Status();
-      if(ist != kIStStableFinalState) continue;
-      int pdgc = p->Pdg();      
-      if(pdg::IsPseudoParticle(pdgc))
-      {
-        ok = false;
-        break;
-      }      
-    }//p
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Pseudo-particle final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
-       }
-       nerr++;
+    for(int k = 0; k < kNEvtChecks; k++) {
+      if(!*kEvtChecks[k].enabled) continue;
+      if(gOptMaxNumErrs != -1 &&
+         (int) range->errors[k].size() >= gOptMaxNumErrs) continue;
+      if(! kEvtChecks[k].passes(event)) range->errors[k].push_back(i);
+    }
+    if(gOptCheckVertexDistribution) {
+      FillVertexDistribution(event, *range);
+    }
+    if(gOptCheckDecayerConsistency) {
+      FillDecayerLists(event, *range);
     }
 
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
+    mcrec->Clear(); // clear out explicitly to prevent memory leak w/Root6
   }//i
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-        gErrLog << "none" << endl;    
-     }
+  if(file) {
+    file->Close();
+    delete file;
   }
-
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with pseudo-particles in  final state";
+  else {
+    // restore the branch address used for the reports
+    tree->SetBranchAddress("gmcrec", &gMCRec);
+    delete mcrec;
+  }
+  return 0;
 }
 //____________________________________________________________________________
-void CheckForOffMassShellParticlesInFinState(void)
+void ReportEventCheck(int k)
 {
-  LOG("gevscan", pNOTICE) 
-      << "Checking for off-mass-shell particles appearing in the final state...";
+  const EvtCheck_t &       check  = kEvtChecks[k];
+  const vector<Long64_t> & errors = gScan.errors[k];
+
+  LOG("gevscan", pNOTICE) << check.mesg;
 
   if(gErrLog.is_open()) {
-     gErrLog << "# Events with off-mass-shell particles in final state:" << endl;
-     gErrLog << "# " << endl;
+    gErrLog << "# " << check.errlog_title << endl;
+    gErrLog << "# " << endl;
   }
 
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
+  int nerr = errors.size();
+  for(int ierr = 0; ierr < nerr; ierr++)
   {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
-
+    Long64_t i = errors[ierr];
     gEventTree->GetEntry(i);
+    EventRecord & event = *(gMCRec->event);
 
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    bool ok = true;
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-
-      GHepStatus_t ist = p->Status();
-      if(ist != kIStStableFinalState) continue;
-      if(p->IsOffMassShell())
-      {
-        ok = false;
-        break;
-      }      
-    }//p
-
-    if(!ok) {
-       LOG("gevscan", pERROR) 
-         << " ** Off-mass-shell final state particle in event: " << i 
-         << "\n"
-         << event;
-       if(gErrLog.is_open()) {
-          gErrLog << i << endl;    
-          if(gOptAddEventPrintoutInErrLog) {
-               gErrLog << event;
-          }
+    LOG("gevscan", pERROR)
+      << " ** " << check.error << i
+      << "\n"
+      << event;
+    if(gErrLog.is_open()) {
+       gErrLog << i;
+       if(check.errlog_endl) gErrLog << endl;
+       if(gOptAddEventPrintoutInErrLog) {
+           gErrLog << event;
        }
-       nerr++;
     }
-
     gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
+  }
 
   if(gErrLog.is_open()) {
      if(nerr == 0) {
-        gErrLog << "none" << endl;    
+         gErrLog << "none" << endl;
      }
   }
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with off-mass-shell particles in final state";
+  LOG("gevscan", pNOTICE)
+     << "Found " << nerr << check.summary;
 }
 //____________________________________________________________________________
-void CheckForNumFinStateNucleonsInconsistentWithTarget(void)
+bool EnergyMomentumIsConserved(EventRecord & event)
 {
-  LOG("gevscan", pNOTICE) 
-     << "Checking for number of final state nucleons inconsistent with target...";
-
-  if(gErrLog.is_open()) {
-    gErrLog << "# Events with number of final state nucleons inconsistent with target:" << endl;
-    gErrLog << "# " << endl;
-  }
-
-  int nerr = 0;
-
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    if(gOptMaxNumErrs != -1 && nerr >= gOptMaxNumErrs) break;
+  double E_init  = 0, E_fin  = 0; // E
+  double px_init = 0, px_fin = 0; // px
+  double py_init = 0, py_fin = 0; // py
+  double pz_init = 0, pz_fin = 0; // pz
+
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+
+    GHepStatus_t ist  = p->Status();
+
+    if(ist == kIStInitialState) 
+    {
+       E_init  += p->E();
+       px_init += p->Px();
+       py_init += p->Py();
+       pz_init += p->Pz();
+     }
+     if(ist == kIStStableFinalState || 
+        ist == kIStFinalStateNuclearRemnant) 
+     {
+       E_fin   += p->E();
+       px_fin  += p->Px();
+       py_fin  += p->Py();
+       pz_fin  += p->Pz();
+     }
+  }//p
 
-    gEventTree->GetEntry(i);
+  double epsilon = 1E-3; 
 
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
+  bool E_conserved  = TMath::Abs(E_init  - E_fin)  < epsilon;
+  bool px_conserved = TMath::Abs(px_init - px_fin) < epsilon;
+  bool py_conserved = TMath::Abs(py_init - py_fin) < epsilon;
+  bool pz_conserved = TMath::Abs(pz_init - pz_fin) < epsilon;
 
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
+  return E_conserved  && 
+         px_conserved &&
+         py_conserved &&
+         pz_conserved;
+}
+//____________________________________________________________________________
+bool ChargeIsConserved(EventRecord & event)
+{
+  // Can't run the test for neutrinos scattered off nuclear targets
+  // because of intranuclear rescattering effects and the presence, in the event
+  // record, of a charged nuclear remnant pseudo-particle whose charge is not stored.
+  // To check charge conservation in the primary interaction, use a sample generated
+  // for a free nucleon targets.
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (nucltgt) return true;
+
+  double Q_init  = 0;
+  double Q_fin   = 0; 
+
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+
+    GHepStatus_t ist  = p->Status();
+
+    if(ist == kIStInitialState) 
+    {
+       Q_init  += p->Charge();
+     }
+     if(ist == kIStStableFinalState)
+     {
+       Q_fin  += p->Charge();
+     }
+  }//p
 
-    // get target nucleus
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (!nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping test...";
+  double epsilon = 1E-3; 
+  return TMath::Abs(Q_init - Q_fin)  < epsilon;
+}
+//____________________________________________________________________________
+bool HasNoPseudoParticlesInFinState(EventRecord & event)
+{
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    int pdgc = p->Pdg();      
+    if(pdg::IsPseudoParticle(pdgc)) return false;
+  }//p
+  return true;
+}
+//____________________________________________________________________________
+bool HasNoOffMassShellParticlesInFinState(EventRecord & event)
+{
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    if(p->IsOffMassShell()) return false;
+  }//p
+  return true;
+}
+//____________________________________________________________________________
+bool NumFinStateNucleonsIsConsistentWithTarget(EventRecord & event)
+{
+  // get target nucleus
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (!nucltgt) return true;
+
+  GHepParticle * p = 0;
+
+  int Z = 0;
+  int N = 0;
+
+  // get number of spectator nucleons 
+  int fd = nucltgt->FirstDaughter();
+  int ld = nucltgt->LastDaughter();
+  for(int d = fd; d <= ld; d++) {
+    p = event.Particle(d);
+    if(!p) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsIon(pdgc)) {
+      Z = p->Z();
+      N = p->A() - p->Z();
     }
-    else {
-      GHepParticle * p = 0;
-
-      int Z = 0;
-      int N = 0;
-
-      // get number of spectator nucleons 
-      int fd = nucltgt->FirstDaughter();
-      int ld = nucltgt->LastDaughter();
-      for(int d = fd; d <= ld; d++) {
-        p = event.Particle(d);
-        if(!p) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsIon(pdgc)) {
-          Z = p->Z();
-          N = p->A() - p->Z();
-        }
-      }
-      // add nucleons from the primary interaction
-      TIter event_iter(&event);
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStHadronInTheNucleus) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Z++; }
-        if(pdg::IsNeutron(pdgc)) { N++; }
-      }//p
-
-      LOG("gevscan", pINFO)
-         << "Before intranuclear hadron transport: Z = " << Z << ", N = " << N;
-
-      // count final state nucleons
-      int Zf = 0;
-      int Nf = 0;
-      event_iter.Reset();
-      while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-        GHepStatus_t ist = p->Status();
-        if(ist != kIStStableFinalState) continue;
-        int pdgc = p->Pdg();
-        if(pdg::IsProton (pdgc)) { Zf++; }
-        if(pdg::IsNeutron(pdgc)) { Nf++; }
-      }
-      LOG("gevscan", pINFO)
-         << "In the final state: Z = " << Zf << ", N = " << Nf;
-
-      bool ok = (Zf <= Z && Nf <= N);
-      if(!ok) {
-         LOG("gevscan", pERROR) 
-           << " ** Number of final state nucleons inconsistent with target in event: " << i 
-           << "\n"
-           << event;
-         if(gErrLog.is_open()) {
-             gErrLog << i << endl;    
-             if(gOptAddEventPrintoutInErrLog) {
-                 gErrLog << event;
-             }
-         }
-         nerr++;
-      }
-    } //nucltgt
+  }
+  // add nucleons from the primary interaction
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStHadronInTheNucleus) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsProton (pdgc)) { Z++; }
+    if(pdg::IsNeutron(pdgc)) { N++; }
+  }//p
+
+  // count final state nucleons
+  int Zf = 0;
+  int Nf = 0;
+  event_iter.Reset();
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    if(ist != kIStStableFinalState) continue;
+    int pdgc = p->Pdg();
+    if(pdg::IsProton (pdgc)) { Zf++; }
+    if(pdg::IsNeutron(pdgc)) { Nf++; }
+  }
+
+  return (Zf <= Z && Nf <= N);
+}
+//____________________________________________________________________________
+void FillVertexDistribution(EventRecord & event, EvScanRange_t & range)
+{
+// Histogram the vertex position, in the binning of the r_distr_mc histogram
+// of CheckVertexDistribution(), separately for each nuclear target
 
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
+  GHepParticle * nucltgt = event.TargetNucleus();
+  if (!nucltgt) return;
 
-  }//i
+  int target = 1000*nucltgt->Z() + nucltgt->A();
+  if(range.vtx_target == 0) range.vtx_target = target;
 
+  vector<double> & counts = range.vtx_r[target];
+  if(counts.size() == 0) counts.resize(kVtxNBins+2, 0.);
 
-  if(gErrLog.is_open()) {
-     if(nerr == 0) {
-         gErrLog << "none" << endl;    
-     }
-  }
+  GHepParticle * probe = event.Particle(0);
+  double r = probe->X4()->Vect().Mag();
 
-  LOG("gevscan", pNOTICE) 
-     << "Found " << nerr 
-     << " events with a number of final state nucleons inconsistent with target";
+  int bin = 0;
+  if      (r <  0.       ) bin = 0;
+  else if (r >= kVtxRMax ) bin = kVtxNBins+1;
+  else                     bin = 1 + int(kVtxNBins*r/kVtxRMax);
+  counts[bin]++;
+}
+//____________________________________________________________________________
+void FillDecayerLists(EventRecord & event, EvScanRange_t & range)
+{
+  GHepParticle * p = 0;
+  TIter event_iter(&event);
+  while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
+    GHepStatus_t ist = p->Status();
+    int pdgc = p->Pdg();
+    vector<int> * list = 0;
+    if(ist == kIStStableFinalState) { list = &range.final_state_particles; }
+    if(ist == kIStDecayedState    ) { list = &range.decayed_particles;     }
+    if(list && std::find(list->begin(), list->end(), pdgc) == list->end()) {
+      list->push_back(pdgc);
+    }
+  }//p
 }
 //____________________________________________________________________________
 void CheckVertexDistribution(void)
@@ -619,50 +668,21 @@ void CheckVertexDistribution(void)
     gErrLog << "# " << endl;
   }
 
-  TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      150,0,30); //fm
-  TH1D * r_distr_expected = new TH1D("r_distr_expected","",150,0,30); //fm
+  TH1D * r_distr_mc       = new TH1D("r_distr_mc","",      kVtxNBins,0,kVtxRMax); //fm
+  TH1D * r_distr_expected = new TH1D("r_distr_expected","",kVtxNBins,0,kVtxRMax); //fm
 
-  int Z = -1;
+  // this test is run on a MC sample for a given target (the one seen first)
   int A = -1;
-
-  // get vertex position distribution
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    // get target nucleus
-    GHepParticle * nucltgt = event.TargetNucleus();
-    if (!nucltgt) {
-      LOG("gevscan", pINFO)
-           << "Event not in nuclear target - Skipping...";
+  if(gScan.vtx_target != 0) {
+    A = gScan.vtx_target % 1000;
+    const vector<double> & counts = gScan.vtx_r[gScan.vtx_target];
+    double nentries = 0;
+    for(int ir = 0; ir <= kVtxNBins+1; ir++) {
+      r_distr_mc->SetBinContent(ir, counts[ir]);
+      nentries += counts[ir];
     }
-    else {
-      if(Z == -1 && A == -1) {
-         Z = nucltgt->Z();
-         A = nucltgt->A();
-      }
-
-      // this test is run on a MC sample for a given target
-      if(Z != nucltgt->Z() || A != nucltgt->A()) {
-        LOG("gevscan", pINFO)
-             << "Event not in nuclear target seen first - Skipping...";
-      }
-      else {
-        GHepParticle * probe = event.Particle(0);
-        double r = probe->X4()->Vect().Mag();
-
-        r_distr_mc->Fill(r);
-      }
-    } //nucltgt
-
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-
-  }//i
+    r_distr_mc->SetEntries(nentries);
+  }
 
   if(A > 1) {
     // get expected vertex position distribution
@@ -728,25 +748,13 @@ void CheckDecayerConsistency(void)
   PDGCodeList final_state_particles(allowdup);
   PDGCodeList decayed_particles(allowdup);
 
-  for(Long64_t i = gFirstEventNum; i <= gLastEventNum; i++) 
-  {
-    gEventTree->GetEntry(i);
-
-    NtpMCRecHeader rec_header = gMCRec->hdr;
-    EventRecord &  event      = *(gMCRec->event);
-
-    LOG("gevscan", pINFO) << "Checking event.... " << i;
-
-    GHepParticle * p = 0;
-    TIter event_iter(&event);
-    while ( (p = dynamic_cast<GHepParticle *>(event_iter.Next())) ) {
-      GHepStatus_t ist = p->Status();
-      int pdgc = p->Pdg();
-      if(ist == kIStStableFinalState) { final_state_particles.push_back(pdgc); }
-      if(ist == kIStDecayedState    ) { decayed_particles.push_back(pdgc);     }
-    }//p
-    gMCRec->Clear(); // clear out explicitly to prevent memory leak w/Root6
-  }//i
+  // in the order the particles were first seen in the scanned events
+  for(unsigned int ip = 0; ip < gScan.final_state_particles.size(); ip++) {
+    final_state_particles.push_back(gScan.final_state_particles[ip]);
+  }
+  for(unsigned int ip = 0; ip < gScan.decayed_particles.size(); ip++) {
+    decayed_particles.push_back(gScan.decayed_particles[ip]);
+  }
 
   // find particles which appear in both lists
   PDGCodeList particles_in_both_lists(allowdup);
@@ -889,6 +897,11 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNEvtH = -1;
   }
 
+  // number of threads
+  if( parser.OptionExists('j') ) {
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt('j'));
+  }
+
   gOptAddEventPrintoutInErrLog =
      parser.OptionExists("add-event-printout-in-error-log");
 
@@ -920,7 +933,7 @@ void PrintSyntax(void)
 {
   LOG("gevscan", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << " gevscan -f sample.root [-n n1[,n2]] [-o errlog] [check names]\n";
+    << " gevscan -f sample.root [-n n1[,n2]] [-j nthreads] [-o errlog] [check names]\n";
 }
 //_________________________________________________________________________________
 bool CheckRootFilename(string filename)
@@ -37,6 +37,7 @@
                        [-S nrays]
                        [-z zmin]
                        [-d debug flags]
+                       [--workers n]
                        [--seed random_number_seed]
                         --cross-sections xml_file
                        [--event-generator-list list_name]
@@ -45,7 +46,13 @@
                        [--unphysical-event-mask mask]
                        [--event-record-print-level level]
                        [--mc-job-status-refresh-rate  rate]
-                       [--cache-file root_file]
+                       [--cache-file root_file] [--cache-read-only]
+                       [--artifact-store directory]
+                       [--xsec-bias selector:factor,...]
+                       [--checkpoint file] [--checkpoint-interval n]
+                       [--resume]
+                       [--plan n]
+                       [--natural-targets]
 
          *** Options :
 
@@ -204,6 +211,16 @@
               The default output filename is:
               gntp.[run_number].ghep.root
               This cmd line arguments lets you override 'gntp'
+           --workers
+              Number of worker processes generating the events [default: 1].
+              The workers are forked once the job is initialized (splines
+              loaded, geometry scanned, drivers configured), sharing all of
+              it. Worker i generates the events i, i+n, i+2n, ... (or 1/n of
+              the requested POTs) reading every n-th flux ntuple entry, with
+              the random number streams reseeded for every event, in its own
+              output file: [prefix].w[worker].[run_number].ghep.root
+              Each file stores the exposure of its own events, and only the
+              first worker refreshes the status file.
            --seed
               Random number seed.
            --cross-sections
@@ -228,6 +245,52 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --cache-read-only
+              Use the cache file only to warm-start the job, without writing
+              it back. Many concurrent jobs can share a read-only cache file.
+           --xsec-bias
+              Bias the selection of rare processes, with a comma-separated list
+              of <selector>:<factor> entries, eg COH:20,1Kaon:100: The cross
+              section of the matching interactions is multiplied by the factor
+              when selecting the interaction to generate, and the event weight
+              compensates for it (the total cross section and the exposure are
+              not changed). A selector is a scattering type, or, if it contains
+              a ':', a part of the interaction string (eg proc:Weak[CC],RES).
+              See PhysInteractionSelector.
+           --artifact-store
+              A directory where the maximum path-lengths of the input geometry
+              are stored, keyed by the job setup (geometry contents, top volume,
+              units, flux files, detector location, flavours, fiducial cut,
+              geometry scan settings). Jobs with the same setup read them back
+              instead of scanning the geometry again. Many concurrent jobs can
+              share the store. See GMCJArtifactStore.
+           --checkpoint
+              A file where the state of the job (random number streams, flux
+              ntuple position & exposure, event counters) is saved, along with
+              a flush of the output file, every --checkpoint-interval events
+              [default: 10000] and at the end of the job (including on a
+              SIGTERM). With --resume, an interrupted job is restarted from
+              its last checkpoint: its events are copied from the previous
+              output file, moved aside as [output_file].interrupted, and the
+              generation continues as if the job was never interrupted.
+              With --resume and no checkpoint file, the job starts afresh.
+              With several workers, each one has its own checkpoint file:
+              [file].w[worker]. Only the gsimple and numi flux drivers
+              can be checkpointed. See GMCJCheckpoint.
+           --plan
+              Job-planning dry run: runs the initialization and generates n
+              events only (in a single process, with no checkpoints and
+              ignoring -n and -e), written in [output_event_file_prefix].plan.
+              Reports the initialization time, the POT per event, the process
+              mix, the events/s per process and the output size per event,
+              and the projections for 1M events. See GMCJPlanner.
+           --natural-targets
+              Collapses the isotopes of each natural element of the geometry
+              into a single target when computing the interaction
+              probabilities of the flux neutrinos; the isotope is chosen once
+              the element is selected. Only elements whose isotopes are in
+              their natural proportions are collapsed. See GMCJDriver::
+              UseNaturalElementTargets().
 
          *** Examples:
 
@@ -296,6 +359,9 @@
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GMCJArtifactStore.h"
+#include "Framework/EventGen/GMCJCheckpoint.h"
+#include "Framework/EventGen/GMCJPlanner.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Ntuple/NtpWriter.h"
@@ -391,8 +457,10 @@ string          gOptEvFilePrefix;              // event file prefix
 int             gOptDebug = 0;                 // debug flags
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+int             gOptNWorkers = 1;              // number of worker processes
 
 bool            gSigTERM = false;              // was TERM signal sent?
+GMCJPlanner *   gPlan = 0;                     // job-planning dry run, if requested
 
 static void gsSIGTERMhandler(int /* s */)
 {
@@ -406,6 +474,10 @@ int main(int argc, char ** argv)
   LoadExtraOptions();
   GetCommandLineArgs(argc,argv);
 
+  if ( RunOpt::Instance()->PlanEvents() > 0 ) {
+    gPlan = new GMCJPlanner(RunOpt::Instance()->PlanEvents());
+  }
+
   if ( ! RunOpt::Instance()->Tune() ) {
     LOG("gmkspl", pFATAL) << " No TuneId in RunOption";
     exit(-1);
@@ -415,9 +487,9 @@ int main(int argc, char ** argv)
   // Initialization of random number generators, cross-section table,
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::CacheFile(
+     RunOpt::Instance()->CacheFile(), RunOpt::Instance()->CacheReadOnly());
   utils::app_init::RandGen(gOptRanSeed);
-  utils::app_init::XSecTable(gOptInpXSecFile, false);
 
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
@@ -602,6 +674,14 @@ int main(int argc, char ** argv)
     }
   }
 
+  // *************************************************************************
+  // * Load the cross-section splines needed for the flux neutrinos and
+  // * target nuclei of this job only
+  // *************************************************************************
+  XSecSplineList::Instance()->SetLoadFilter(
+     flux_driver->FluxParticles(), geom_driver->ListOfTargetNuclei());
+  utils::app_init::XSecTable(gOptInpXSecFile, false);
+
   // *************************************************************************
   // * Create/configure the event generation driver
   // *************************************************************************
@@ -609,18 +689,42 @@ int main(int argc, char ** argv)
   mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
   mcj_driver->UseFluxDriver(flux_driver);
   mcj_driver->UseGeomAnalyzer(geom_driver);
+
+  // without an input max path lengths XML file, look for the max path
+  // lengths computed by an earlier job with the same setup, if an artifact
+  // store is used (the geometry scan depends on the flux if scanning with it)
+  GMCJArtifactStore artifacts(RunOpt::Instance()->ArtifactStore());
+  if ( gOptUsingRootGeom ) {
+    ostringstream nulist;
+    nulist << gOptFluxPdg;
+    artifacts.AddFileKey("geom",     gOptRootGeom);
+    artifacts.AddKey    ("topvol",   gOptRootGeomTopVol);
+    artifacts.AddKey    ("lunits",   gOptGeomLUnits);
+    artifacts.AddKey    ("dunits",   gOptGeomDUnits);
+    artifacts.AddKey    ("fidcut",   gOptFidCut);
+    artifacts.AddKey    ("nscan",    gOptNScan);
+    artifacts.AddKey    ("zmin",     gOptZmin);
+    artifacts.AddKey    ("fluxdrv",  gOptFluxDriver);
+    if ( gOptUsingHistFlux ) artifacts.AddFileKey ("flux", gOptFluxFile);
+    else                     artifacts.AddFilesKey("flux", gOptFluxFile);
+    artifacts.AddKey    ("location", gOptDetectorLocation);
+    artifacts.AddKey    ("flavours", nulist.str());
+  }
   if ( ( gOptExtMaxPlXml != "" ) && ! gOptWriteMaxPlXml ) {
     mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
+  } else if ( gOptUsingRootGeom ) {
+    artifacts.UseMaxPathLengths(mcj_driver);
   }
   mcj_driver->Configure();
   mcj_driver->UseSplines();
   mcj_driver->ForceSingleProbScale();
+  if ( gOptUsingRootGeom ) artifacts.SaveMaxPathLengths(mcj_driver);
 
   if ( ( gOptExtMaxPlXml != "" ) && gOptWriteMaxPlXml ) {
     geometry::ROOTGeomAnalyzer * rgeom =
       dynamic_cast<geometry::ROOTGeomAnalyzer *>(geom_driver);
     if ( rgeom ) {
-      const genie::PathLengthList& maxpath = rgeom->GetMaxPathLengths();
+      const genie::PathLengthList& maxpath = mcj_driver->MaxPathLengths();
       std::string maxplfile = gOptExtMaxPlXml;
       maxpath.SaveAsXml(maxplfile);
       // append extra info to file
@@ -647,13 +751,61 @@ int main(int argc, char ** argv)
     }
   }
 
+  // *************************************************************************
+  // * Fork the worker processes, if any, sharing all of the above
+  // *************************************************************************
+
+  // define handler to allow signal to end job gracefully (also to have the
+  // waiting parent process outlive its workers)
+  signal(SIGTERM,gsSIGTERMhandler);
+
+  int iworker = utils::system::ForkWorkers(gOptNWorkers);
+  if ( iworker < 0 ) {
+    delete geom_driver;
+    delete flux_driver;
+    delete mcj_driver;
+    LOG("gevgen_fnal", pNOTICE) << "Done!";
+    return 0;
+  }
+  string evfile_prefix = gOptEvFilePrefix;
+  if ( gOptNWorkers > 1 ) {
+    // worker i returns the events i, i+n, i+2n, ... using its own flux entries
+    mcj_driver->SetWorkerSlot(iworker, gOptNWorkers);
+    if ( fluxFileConfigI ) fluxFileConfigI->SplitEntryRange(iworker, gOptNWorkers);
+    ostringstream prefix;
+    prefix << gOptEvFilePrefix << ".w" << iworker;
+    evfile_prefix = prefix.str();
+  }
+  if ( gPlan ) {
+    evfile_prefix += ".plan";
+    gPlan->SetMCJDriver(mcj_driver);
+  }
+  double pot_target = gOptPOT / gOptNWorkers;
+
+  // Checkpoints of the job, if requested (one file per worker)
+  string ckpt_file = (gPlan) ? "" : RunOpt::Instance()->CheckpointFile();
+  if ( gOptNWorkers > 1 && ckpt_file.size() > 0 ) {
+    ostringstream wfile;
+    wfile << ckpt_file << ".w" << iworker;
+    ckpt_file = wfile.str();
+  }
+  GMCJCheckpoint ckpt(ckpt_file, RunOpt::Instance()->CheckpointInterval());
+  bool resume = RunOpt::Instance()->Resume() && ckpt.IsEnabled();
+  if ( resume && gSystem->AccessPathName(ckpt_file.c_str()) ) {
+    LOG("gevgen_fnal", pNOTICE)
+      << "No checkpoint to resume from: " << ckpt_file << " - Starting the job";
+    resume = false;
+  }
+
   // *************************************************************************
   // * Prepare for writing the output event tree & status file
   // *************************************************************************
 
   // Initialize an Ntuple Writer to save GHEP records into a TTree
   NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
+  ntpw.CustomizeFilenamePrefix(evfile_prefix);
+  string prev_evfile = "";
+  if ( resume ) prev_evfile = ckpt.MoveAside(ntpw.Filename());
   ntpw.Initialize();
 
 
@@ -707,10 +859,23 @@ int main(int argc, char ** argv)
   // * Event generation loop
   // *************************************************************************
 
-  // define handler to allow signal to end job gracefully
-  signal(SIGTERM,gsSIGTERMhandler);
+  int ievent  = iworker;
+  int nevents = 0;
+
+  // Resuming an interrupted job: copy its events & restore its state
+  if ( resume ) {
+    nevents = ckpt.ResumeEvents();
+    bool resumed = ( nevents >= 0 && prev_evfile.size() > 0 &&
+                     ntpw.CopyEvents(prev_evfile, nevents) &&
+                     ckpt.Restore(*mcj_driver) );
+    if ( ! resumed ) {
+      LOG("gevgen_fnal", pFATAL)
+        << "Could not resume the job from the checkpoint: " << ckpt.Filename();
+      exit(1);
+    }
+    ievent = iworker + nevents * gOptNWorkers;
+  }
 
-  int ievent = 0;
   while ( ! gSigTERM )
   {
      LOG("gevgen_fnal", pINFO)
@@ -718,7 +883,7 @@ int main(int argc, char ** argv)
 
      // In case the required statistics was expressed as 'number of events'
      // then quit if that number has been generated
-     if ( ievent == gOptNev ) break;
+     if ( gOptNev >= 0 && ievent >= gOptNev ) break;
 
      // In case the required statistics was expressed as 'number of POT'
      // then exit the event loop if the requested POT has been generated.
@@ -726,12 +891,14 @@ int main(int argc, char ** argv)
         double fpot = fluxExposureI->GetTotalExposure(); // current POTs used
         double psc  = mcj_driver->GlobProbScale();  // interaction prob. scale
         double pot  = fpot / psc;                   // POTs for generated sample
-        if ( pot >= gOptPOT ) break;
+        if ( pot >= pot_target ) break;
      }
 
      // Generate a single event using neutrinos coming from the specified flux
      // and hitting the specified geometry or target mix
+     if ( gPlan ) gPlan->StartEvent();
      EventRecord * event = mcj_driver->GenerateEvent();
+     if ( gPlan ) gPlan->EndEvent(event);
 
      // Check whether a null event was returned due to the flux driver reaching
      // the end of the input flux ntuple - exit the event generation loop
@@ -754,12 +921,24 @@ int main(int argc, char ** argv)
 
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     if ( iworker == 0 ) mcjmonitor.Update(ievent,event);
      delete event;
-     ievent++;
+     ievent += gOptNWorkers;
+     nevents++;
+
+     if ( ckpt.IsDue(nevents) ) {
+       ntpw.Checkpoint();
+       ckpt.Save(nevents, *mcj_driver);
+     }
 
   } //1
 
+  // Final checkpoint: a job stopped by a SIGTERM can be resumed from here
+  if ( ckpt.IsEnabled() ) {
+    ntpw.Checkpoint();
+    ckpt.Save(nevents, *mcj_driver);
+  }
+
   // Copy metadata tree, if available
   if ( fluxFileConfigI ) {
     TTree* t1 = fluxFileConfigI->GetMetaDataTree();
@@ -807,7 +986,7 @@ int main(int argc, char ** argv)
        LOG("gevgen_fnal", pFATAL) << "MCJobDriver GlobalProbScale was " << psc;
     }
     double pot   = fpot / psc;                       // POT for generated sample
-    long int nev = ievent;
+    long int nev = nevents;
 
     LOG("gevgen_fnal", pNOTICE)
         << "\n >> Interaction probability scaling factor:  " << psc
@@ -820,6 +999,7 @@ int main(int argc, char ** argv)
 
     ntpw.EventTree()->SetWeight(pot); // store POT
 
+    if ( gPlan ) gPlan->SetExposure(pot, exposureUnits);
   }
 
   // *************************************************************************
@@ -829,6 +1009,12 @@ int main(int argc, char ** argv)
   // Save the generated event tree & close the output file
   ntpw.Save();
 
+  if ( gPlan ) {
+    gPlan->SetOutputFile(ntpw.Filename());
+    gPlan->Report();
+    delete gPlan;
+  }
+
   // Clean-up
   delete geom_driver;
   delete flux_driver;
@@ -1150,6 +1336,30 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  // number of worker processes
+  if( parser.OptionExists("workers") ) {
+    LOG("gevgen_fnal", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt("workers");
+    if( gOptNWorkers < 1 ) {
+      LOG("gevgen_fnal", pFATAL) << "Invalid number of workers: " << gOptNWorkers;
+      PrintSyntax();
+      exit(1);
+    }
+  } else {
+    gOptNWorkers = 1;
+  }
+
+
+  // A job-planning dry run generates a fixed number of events, in a single
+  // process
+  if( RunOpt::Instance()->PlanEvents() > 0 ) {
+    if( gOptNWorkers > 1 ) {
+      LOG("gevgen_fnal", pWARN) << "Planning the job: --workers is ignored";
+    }
+    gOptNWorkers = 1;
+    gOptNev = RunOpt::Instance()->PlanEvents();
+    gOptPOT = -1;
+  }
 
   //
   // >>> perform 'sanity' checks on command line arguments
@@ -1264,7 +1474,8 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n - Using cross-section file: " << gOptInpXSecFile
      << "\n - Flux     @ " << fluxinfo.str()
      << "\n - Geometry @ " << gminfo.str()
-     << "\n - Exposure @ " << exposure.str();
+     << "\n - Exposure @ " << exposure.str()
+     << "\n - Worker processes: " << gOptNWorkers;
 
   LOG("gevgen_fnal", pNOTICE) << *RunOpt::Instance();
 }
@@ -1281,6 +1492,7 @@ void PrintSyntax(void)
    << "\n            [-o output_event_file_prefix]"
    << "\n            [-F fid_cut_string] [-S nrays_scan]"
    << "\n            [-z zmin_start]"
+   << "\n            [--workers n]"
    << "\n            [--seed random_number_seed]"
    << "\n             --cross-sections xml_file"
    << "\n            [--event-generator-list list_name]"
@@ -1288,7 +1500,11 @@ void PrintSyntax(void)
    << "\n            [--unphysical-event-mask mask]"
    << "\n            [--event-record-print-level level]"
    << "\n            [--mc-job-status-refresh-rate  rate]"
-   << "\n            [--cache-file root_file]"
+   << "\n            [--cache-file root_file] [--cache-read-only]"
+   << "\n            [--artifact-store directory]"
+   << "\n            [--xsec-bias selector:factor,...]"
+   << "\n            [--checkpoint file] [--checkpoint-interval n] [--resume]"
+   << "\n            [--plan n] [--natural-targets]"
    << "\n"
    << " Please also read the detailed documentation at "
    << "$GENIE/src/Apps/gFNALExptEvGen.cxx"
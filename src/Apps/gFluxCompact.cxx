@@ -0,0 +1,281 @@
+//____________________________________________________________________________
+/*!
+
+\program gfluxcompact
+
+\brief   GENIE utility program converting beam simulation flux ntuples
+         (gsimple or gnumi) into the compact, memory-mappable flux format
+         read by the GCompactFlux flux driver.
+
+         Only what is needed for event generation (pdg code, 4-momentum,
+         4-position, weight and decay distance) is kept for each flux entry,
+         along with its entry number in the input ntuples (for going back to
+         the full ancestry information). Positions and momenta are stored in
+         the user coordinate system of the requested detector location, and
+         weights are stored as given by the input flux driver (the compact
+         flux driver does its own unweighting).
+
+         Syntax :
+           gfluxcompact -f flux_files -t flux_type [-l det_loc]
+                        [-o output_file] [-n max_entries] [-b block_size]
+                        [--seed random_number_seed]
+                        [--message-thresholds xml_file]
+
+         Options :
+           -f
+              Input flux files (comma separated list, wildcards allowed as
+              supported by the input flux driver)
+           -t
+              Input flux type: 'gsimple' or 'gnumi'
+           -l
+              Detector location (for 'gnumi' the name of the XML config
+              param_set, for 'gsimple' options passed to the driver)
+              [ default: "" ]
+           -o
+              Name of output compact flux file [ default: flux.gcmp ]
+           -n
+              Maximum number of entries to convert [ default: all entries ]
+           -b
+              Number of entries per block [ default: 65536 ]
+          --seed
+              Random number seed.
+          --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example:
+
+           gfluxcompact -t gnumi -f g4numi_*.root -l MINOS-NearDet -o nd.gcmp
+
+           will convert all entries of the g4numi files, seen from the MINOS
+           near detector location, into the nd.gcmp compact flux file.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TChain.h>
+
+#include "Framework/EventGen/GFluxI.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Tools/Flux/GFluxDriverFactory.h"
+#include "Tools/Flux/GFluxExposureI.h"
+#include "Tools/Flux/GFluxFileConfigI.h"
+#include "Tools/Flux/GSimpleNtpFlux.h"
+#include "Tools/Flux/GNuMIFlux.h"
+#include "Tools/Flux/GCompactFlux.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+using namespace genie::flux;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+// Defaults for optional options:
+string    kDefOptOutFilename  = "flux.gcmp";  // default output filename
+long int  kDefOptBlockSize    = 65536;        // default entries / block
+
+// User-specified options:
+vector<string> gOptFluxFiles;               // input flux files
+string    gOptFluxType        = "";         // input flux type
+string    gOptDetLoc          = "";         // detector location
+string    gOptOutFilename     = "";         // output filename
+long int  gOptMaxEntries      = -1;         // max number of entries
+long int  gOptBlockSize       = 0;          // entries / block
+long int  gOptRanSeed         = -1;         // random number seed
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  // Create & configure the input flux driver
+  string driver_name = "";
+  if      (gOptFluxType == "gsimple") driver_name = "genie::flux::GSimpleNtpFlux";
+  else if (gOptFluxType == "gnumi"  ) driver_name = "genie::flux::GNuMIFlux";
+  else {
+    LOG("gfluxcompact", pFATAL) << "Unsupported flux type: " << gOptFluxType;
+    PrintSyntax();
+    exit(1);
+  }
+  GFluxI * flux = GFluxDriverFactory::Instance().GetFluxDriver(driver_name);
+  GFluxFileConfigI * fcfg = dynamic_cast<GFluxFileConfigI *>(flux);
+  GFluxExposureI *   fexp = dynamic_cast<GFluxExposureI *>  (flux);
+  if (!flux || !fcfg || !fexp) {
+    LOG("gfluxcompact", pFATAL) << "Couldn't create flux driver: " << driver_name;
+    exit(1);
+  }
+
+  PDGCodeList nus;
+  nus.push_back(kPdgNuMu);  nus.push_back(kPdgAntiNuMu);
+  nus.push_back(kPdgNuE);   nus.push_back(kPdgAntiNuE);
+  nus.push_back(kPdgNuTau); nus.push_back(kPdgAntiNuTau);
+
+  fcfg->LoadBeamSimData(gOptFluxFiles, gOptDetLoc);
+  fcfg->SetFluxParticles(nus);
+  fcfg->SetNumOfCycles(0);
+  flux->GenerateWeighted(true);
+
+  GSimpleNtpFlux * gsimple = dynamic_cast<GSimpleNtpFlux *>(flux);
+  GNuMIFlux *      gnumi   = dynamic_cast<GNuMIFlux *>     (flux);
+
+  GCompactFluxWriter writer(gOptOutFilename, gOptBlockSize);
+  if (!writer.IsOpen()) exit(1);
+
+  // The input drivers start at a random entry and cycle through their
+  // files: Stop when back at the first entry converted
+  long int first = -1;
+  long int nconv = 0;
+  while ( gOptMaxEntries < 0 || nconv < gOptMaxEntries ) {
+    bool ok = flux->GenerateNext();
+    if (flux->End()) break;
+    long int ientry = flux->Index();
+    if (first < 0) first = ientry;
+    else if (ientry == first) break;
+    if (!ok) continue;
+
+    double dist  = 0;
+    int    ifile = -1;
+    if (gsimple) {
+      dist  = gsimple->GetDecayDist();
+      ifile = gsimple->GetFluxTChain()->GetTreeNumber();
+    }
+    if (gnumi) {
+      dist  = gnumi->GetDecayDist();
+    }
+    writer.Fill(flux->PdgCode(), flux->Momentum(), flux->Position(),
+                flux->Weight(), dist, ifile, ientry);
+    nconv++;
+
+    if (nconv % 1000000 == 0) {
+      LOG("gfluxcompact", pNOTICE) << "Converted " << nconv << " entries";
+    }
+  }
+
+  // the POTs represented by the converted entries
+  writer.SetPOTs(fexp->GetTotalExposure());
+  writer.Close();
+
+  LOG("gfluxcompact", pNOTICE)
+    << "Converted " << nconv << " entries (" << fexp->GetTotalExposure()
+    << " POTs) into " << gOptOutFilename;
+
+  delete flux;
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gfluxcompact", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // input flux files
+  if( parser.OptionExists('f') ) {
+    LOG("gfluxcompact", pDEBUG) << "Reading input flux files";
+    gOptFluxFiles = parser.ArgAsStringTokens('f', ",");
+  } else {
+    LOG("gfluxcompact", pFATAL) << "Unspecified input flux files - Exiting";
+    PrintSyntax();
+    exit(1);
+  } // -f
+
+  // input flux type
+  if( parser.OptionExists('t') ) {
+    LOG("gfluxcompact", pDEBUG) << "Reading input flux type";
+    gOptFluxType = parser.ArgAsString('t');
+  } else {
+    LOG("gfluxcompact", pFATAL) << "Unspecified input flux type - Exiting";
+    PrintSyntax();
+    exit(1);
+  } // -t
+
+  // detector location
+  if( parser.OptionExists('l') ) {
+    LOG("gfluxcompact", pDEBUG) << "Reading detector location";
+    gOptDetLoc = parser.ArgAsString('l');
+  } // -l
+
+  // output file name
+  if( parser.OptionExists('o') ) {
+    LOG("gfluxcompact", pDEBUG) << "Reading output filename";
+    gOptOutFilename = parser.ArgAsString('o');
+  } else {
+    LOG("gfluxcompact", pDEBUG)
+       << "Unspecified output filename - Using default";
+    gOptOutFilename = kDefOptOutFilename;
+  } // -o
+
+  // max number of entries
+  if( parser.OptionExists('n') ) {
+    LOG("gfluxcompact", pDEBUG) << "Reading max number of entries";
+    gOptMaxEntries = parser.ArgAsLong('n');
+  } // -n
+
+  // block size
+  if( parser.OptionExists('b') ) {
+    LOG("gfluxcompact", pDEBUG) << "Reading block size";
+    gOptBlockSize = parser.ArgAsLong('b');
+  } else {
+    gOptBlockSize = kDefOptBlockSize;
+  } // -b
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    LOG("gfluxcompact", pINFO) << "Reading random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("gfluxcompact", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+
+  LOG("gfluxcompact", pNOTICE)
+    << "\n"
+    << "\n Input flux type     : " << gOptFluxType
+    << "\n Detector location   : " << gOptDetLoc
+    << "\n Output file         : " << gOptOutFilename
+    << "\n Max entries         : " << gOptMaxEntries
+    << "\n Block size          : " << gOptBlockSize
+    << "\n Random number seed  : " << gOptRanSeed;
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gfluxcompact", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gfluxcompact -f flux_files -t flux_type [-l det_loc]\n"
+    << "                [-o output_file] [-n max_entries] [-b block_size]\n"
+    << "                [--seed random_number_seed]\n"
+    << "                [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
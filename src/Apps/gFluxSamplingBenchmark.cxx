@@ -0,0 +1,324 @@
+//____________________________________________________________________________
+/*!
+
+\program gfluxbench
+
+\brief   GENIE utility program benchmarking the histogram-based flux
+         sampling of the GCylindTH1Flux driver.
+
+         A set of energy spectra (one per neutrino species, sharing the same
+         binning) is created and the driver's GenerateNext() is timed against
+         the former sampling algorithm: a TH1D::GetRandom() energy draw from
+         the combined spectrum followed by a linear search over the species
+         fractions in the selected energy bin. Beside the sampling rates, the
+         program reports the sampled flux fractions of each species and the
+         chi2 compatibility of the two energy distributions, as a check that
+         the faster sampler reproduces the input spectra.
+
+         Syntax :
+           gfluxbench [-b nbins] [-s nspecies] [-n nneutrinos] [-e emax]
+                      [--seed random_number_seed]
+                      [--message-thresholds xml_file]
+
+         Options :
+           -b
+              Number of energy bins of the input spectra [ default: 1000 ]
+           -s
+              Number of neutrino species (1 to 6) [ default: 4 ]
+           -n
+              Number of flux neutrinos to generate [ default: 1000000 ]
+           -e
+              Maximum energy of the input spectra (GeV) [ default: 20 ]
+           --seed
+              Random number seed.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example:
+
+           gfluxbench -b 5000 -s 6 -n 10000000
+
+           will time the generation of 1E+7 flux neutrinos from 6 spectra
+           with 5000 energy bins each.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TH1D.h>
+#include <TStopwatch.h>
+#include <TVector3.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Tools/Flux/GCylindTH1Flux.h"
+
+using std::string;
+using std::vector;
+using std::ostringstream;
+using std::setw;
+using std::setprecision;
+
+using namespace genie;
+using namespace genie::flux;
+
+// Prototypes:
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+// Defaults for optional options:
+int    kDefOptNBins        = 1000;      // default number of energy bins
+int    kDefOptNSpecies     = 4;         // default number of neutrino species
+long   kDefOptNNeutrinos   = 1000000;   // default number of flux neutrinos
+double kDefOptEmax         = 20.;       // default max energy (GeV)
+
+// User-specified options:
+int       gOptNBins           = 0;           // number of energy bins
+int       gOptNSpecies        = 0;           // number of neutrino species
+long      gOptNNeutrinos      = 0;           // number of flux neutrinos
+double    gOptEmax            = 0;           // max energy
+long int  gOptRanSeed         = -1;          // random number seed
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  const int nuspecies[6] = { kPdgNuMu, kPdgAntiNuMu, kPdgNuE,
+                             kPdgAntiNuE, kPdgNuTau, kPdgAntiNuTau };
+
+  // Create the input spectra: falling spectra peaking at different energies,
+  // with random bin-to-bin fluctuations so that no two bins are alike
+  TRandom3 & rnd = RandomGen::Instance()->RndFlux();
+
+  vector<TH1D *> spectra(gOptNSpecies);
+  for(int inu = 0; inu < gOptNSpecies; inu++) {
+    ostringstream name;
+    name << "spectrum_" << nuspecies[inu];
+    spectra[inu] = new TH1D(name.str().c_str(), "", gOptNBins, 0., gOptEmax);
+    spectra[inu]->SetDirectory(0);
+    double epeak = (1.+inu) * gOptEmax/(4.*gOptNSpecies);
+    for(int ib = 1; ib <= gOptNBins; ib++) {
+      double E = spectra[inu]->GetBinCenter(ib);
+      double f = (E/epeak) * TMath::Exp(1.-E/epeak) / (1.+inu);
+      spectra[inu]->SetBinContent(ib, f * (0.5 + rnd.Rndm()));
+    }
+  }
+
+  // Create the flux driver (it adopts its own copies of the spectra)
+  LOG("gfluxbench", pINFO) << "Creating a GCylindTH1Flux driver";
+
+  GCylindTH1Flux * flux = new GCylindTH1Flux;
+  flux->SetNuDirection(TVector3(0.,0.,1.));
+  flux->SetBeamSpot   (TVector3(0.,0.,0.));
+  flux->SetTransverseRadius(-1);
+  for(int inu = 0; inu < gOptNSpecies; inu++) {
+    flux->AddEnergySpectrum(nuspecies[inu], new TH1D(*spectra[inu]));
+  }
+
+  TH1D * total = new TH1D(*spectra[0]);
+  total->SetDirectory(0);
+  for(int inu = 1; inu < gOptNSpecies; inu++) total->Add(spectra[inu]);
+
+  TH1D * ealias = new TH1D("ealias", "", gOptNBins, 0., gOptEmax);
+  TH1D * eref   = new TH1D("eref",   "", gOptNBins, 0., gOptEmax);
+  ealias -> SetDirectory(0);
+  eref   -> SetDirectory(0);
+  vector<long> nalias(gOptNSpecies, 0), nref(gOptNSpecies, 0);
+
+  TStopwatch watch;
+
+  // The flux driver (alias table sampling)
+  LOG("gfluxbench", pNOTICE) << "Timing GCylindTH1Flux::GenerateNext()";
+  vector<double> Ev(gOptNNeutrinos);
+  vector<int>    pdg(gOptNNeutrinos);
+  watch.Start(true);
+  for(long i = 0; i < gOptNNeutrinos; i++) {
+    flux->GenerateNext();
+    Ev [i] = flux->Momentum().E();
+    pdg[i] = flux->PdgCode();
+  }
+  watch.Stop();
+  double alias_rtime = watch.RealTime();
+  double alias_ctime = watch.CpuTime();
+
+  for(long i = 0; i < gOptNNeutrinos; i++) {
+    ealias->Fill(Ev[i]);
+    for(int inu = 0; inu < gOptNSpecies; inu++) {
+      if(pdg[i] == nuspecies[inu]) { nalias[inu]++; break; }
+    }
+  }
+
+  // The reference algorithm (combined spectrum + species fractions)
+  LOG("gfluxbench", pNOTICE) << "Timing TH1D::GetRandom() + species selection";
+  vector<double> cumul(gOptNSpecies);
+  watch.Start(true);
+  for(long i = 0; i < gOptNNeutrinos; i++) {
+    double E  = total->GetRandom();
+    int    ib = spectra[0]->FindBin(E);
+    double sum = 0;
+    for(int inu = 0; inu < gOptNSpecies; inu++) {
+      sum += spectra[inu]->GetBinContent(ib);
+      cumul[inu] = sum;
+    }
+    double R = sum * rnd.Rndm();
+    int sel = gOptNSpecies-1;
+    for(int inu = 0; inu < gOptNSpecies; inu++) {
+      if(R < cumul[inu]) { sel = inu; break; }
+    }
+    Ev [i] = E;
+    pdg[i] = sel;
+  }
+  watch.Stop();
+  double ref_rtime = watch.RealTime();
+  double ref_ctime = watch.CpuTime();
+
+  for(long i = 0; i < gOptNNeutrinos; i++) {
+    eref->Fill(Ev[i]);
+    nref[pdg[i]]++;
+  }
+
+  // Report
+  double nnu = TMath::Max(1L, gOptNNeutrinos);
+
+  ostringstream report;
+  report
+    << "\n" << utils::print::PrintFramedMesg("gfluxbench results") << "\n"
+    << "Energy bins x species   : " << gOptNBins << " x " << gOptNSpecies << "\n"
+    << "Flux neutrinos          : " << gOptNNeutrinos << "\n"
+    << "\n"
+    << "Alias table sampling    : "
+    << alias_rtime << " s real, " << alias_ctime << " s cpu, "
+    << (alias_rtime > 0 ? gOptNNeutrinos/alias_rtime : 0) << " nu/s\n"
+    << "TH1D::GetRandom() + sel.: "
+    << ref_rtime << " s real, " << ref_ctime << " s cpu, "
+    << (ref_rtime > 0 ? gOptNNeutrinos/ref_rtime : 0) << " nu/s\n"
+    << "Speed-up                : "
+    << (alias_ctime > 0 ? ref_ctime/alias_ctime : 0) << "\n"
+    << "Energy spectra chi2 p   : " << ealias->Chi2Test(eref, "UU") << "\n"
+    << "\n"
+    << "Sampled flux fractions:\n"
+    << setw(15) << "pdg" << setw(15) << "input"
+    << setw(15) << "alias" << setw(15) << "reference" << "\n";
+
+  double itot = total->Integral();
+  for(int inu = 0; inu < gOptNSpecies; inu++) {
+    report
+      << setw(15) << nuspecies[inu]
+      << setw(15) << setprecision(5) << spectra[inu]->Integral()/itot
+      << setw(15) << setprecision(5) << nalias[inu]/nnu
+      << setw(15) << setprecision(5) << nref[inu]/nnu << "\n";
+  }
+
+  LOG("gfluxbench", pNOTICE) << report.str();
+
+  delete flux;
+  delete total;
+  delete ealias;
+  delete eref;
+  for(int inu = 0; inu < gOptNSpecies; inu++) delete spectra[inu];
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gfluxbench", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // number of energy bins
+  if( parser.OptionExists('b') ) {
+    LOG("gfluxbench", pDEBUG) << "Reading number of energy bins";
+    gOptNBins = parser.ArgAsInt('b');
+  } else {
+    gOptNBins = kDefOptNBins;
+  } //-b
+
+  // number of neutrino species
+  if( parser.OptionExists('s') ) {
+    LOG("gfluxbench", pDEBUG) << "Reading number of neutrino species";
+    gOptNSpecies = parser.ArgAsInt('s');
+  } else {
+    gOptNSpecies = kDefOptNSpecies;
+  } //-s
+
+  // number of flux neutrinos
+  if( parser.OptionExists('n') ) {
+    LOG("gfluxbench", pDEBUG) << "Reading number of flux neutrinos";
+    gOptNNeutrinos = parser.ArgAsLong('n');
+  } else {
+    gOptNNeutrinos = kDefOptNNeutrinos;
+  } //-n
+
+  // max energy
+  if( parser.OptionExists('e') ) {
+    LOG("gfluxbench", pDEBUG) << "Reading max energy";
+    gOptEmax = parser.ArgAsDouble('e');
+  } else {
+    gOptEmax = kDefOptEmax;
+  } //-e
+
+  if(gOptNBins < 1 || gOptNSpecies < 1 || gOptNSpecies > 6 ||
+     gOptNNeutrinos < 1 || gOptEmax <= 0) {
+    LOG("gfluxbench", pFATAL) << "Invalid benchmark options - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    LOG("gfluxbench", pINFO) << "Reading random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("gfluxbench", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+
+  LOG("gfluxbench", pNOTICE)
+    << "\n"
+    << "\n Energy bins         : " << gOptNBins
+    << "\n Neutrino species    : " << gOptNSpecies
+    << "\n Flux neutrinos      : " << gOptNNeutrinos
+    << "\n Max energy          : " << gOptEmax
+    << "\n Random number seed  : " << gOptRanSeed;
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gfluxbench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gfluxbench [-b nbins] [-s nspecies] [-n nneutrinos] [-e emax]\n"
+    << "              [--seed random_number_seed]\n"
+    << "              [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
@@ -0,0 +1,471 @@
+//____________________________________________________________________________
+/*!
+
+\program ggeombench
+
+\brief   GENIE utility program benchmarking the ROOT geometry driver.
+
+         Rays are thrown uniformly over a (parallelogram) flux window and
+         the geometry driver's ComputeMaxPathLengths(), ComputePathLengths()
+         and GenerateVertex() methods are timed separately. For each of them
+         the program reports the ray throughput and, for the path length
+         calculation, the geometry navigation steps and path segments per ray
+         as well as per-material path segment statistics.
+         The numbers can be used to compare geometry descriptions and geometry
+         driver options objectively.
+
+         Syntax :
+           ggeombench -f geom_file -w window [-d direction] [-n nrays]
+                 [-L length_units] [-D density_units] [-t top_vol_name]
+                 [-s np,nr] [-b]
+                 [--seed random_number_seed]
+                 [--message-thresholds xml_file]
+
+         Options :
+           -f
+              A ROOT file containing a ROOT/GEANT geometry description
+           -w
+              The flux window, given as 3 corners x0,y0,z0,x1,y1,z1,x2,y2,z2
+              (master coordinates & geometry length units). The window is
+              the parallelogram spanned by the corner 0 and the edges 0->1
+              and 0->2.
+           -d
+              Ray direction dx,dy,dz [ default: the flux window normal ]
+           -n
+              Number of rays to throw [ default: 100000 ]
+           -L
+              Geometry length units [ default: mm ]
+           -D
+              Geometry density units [ default: gr/cm3 ]
+           -t
+              Top volume name [ default: "" ]
+           -s
+              Number of scanning points / surface and, optionally, rays / point
+              used for the max path lengths calculation
+              [ default: see geom driver's defaults ]
+           -b
+              Use the geometry driver's analytic box navigation
+           --seed
+              Random number seed.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Example:
+
+           ggeombench -f mygeometry.root -L cm -D g_cm3 -n 50000
+                      -w -200,-200,-500,200,-200,-500,-200,200,-500
+
+           will throw 5E+4 rays along +z through a 4m x 4m window upstream
+           of the detector described in mygeometry.root.
+
+\author  Costas Andreopoulos <C.V.Andreopoulos@rl.ac.uk>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cassert>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <TMath.h>
+#include <TStopwatch.h>
+#include <TLorentzVector.h>
+#include <TVector3.h>
+#include <TGeoMaterial.h>
+
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Tools/Geometry/ROOTGeomAnalyzer.h"
+#include "Tools/Geometry/PathSegmentList.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/UnitUtils.h"
+#include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+
+using std::string;
+using std::vector;
+using std::map;
+using std::ostringstream;
+using std::setw;
+using std::setprecision;
+
+using namespace genie;
+using namespace genie::geometry;
+
+// Prototypes:
+void     GetCommandLineArgs (int argc, char ** argv);
+void     PrintSyntax        (void);
+TVector3 GetVec3            (string s);
+
+// Defaults for optional options:
+int    kDefOptNRays        = 100000;  // default number of rays
+string kDefOptGeomLUnits   = "mm";    // default geometry length units
+string kDefOptGeomDUnits   = "g_cm3"; // default geometry density units
+
+// User-specified options:
+string    gOptGeomFilename    = "";          // input geometry file
+string    gOptRootGeomTopVol  = "";          // input root geometry top vol name
+double    gOptGeomLUnits      = 0;           // input geometry length units
+double    gOptGeomDUnits      = 0;           // input geometry density units
+TVector3  gOptWinCorner[3];                  // flux window corners
+TVector3  gOptRayDir;                        // ray direction
+int       gOptNRays           = 0;           // number of rays to throw
+int       gOptNPoints         = -1;          // input number of points / surf
+int       gOptNScanRays       = -1;          // input number of rays / point
+bool      gOptUseBoxNav       = false;       // use analytic box navigation?
+long int  gOptRanSeed         = -1;          // random number seed
+
+// Per-material path segment statistics
+struct MatStat_t {
+  MatStat_t() : nseg(0), step(0) { }
+  long int nseg;   // number of path segments
+  double   step;   // summed (trimmed) step, in top vol units
+};
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::RandGen(gOptRanSeed);
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  // Create the geometry driver
+  LOG("ggeombench", pINFO)
+     << "Creating/configuring a ROOT geom. driver";
+
+  ROOTGeomAnalyzer * geom = new ROOTGeomAnalyzer(gOptGeomFilename);
+  geom -> SetLengthUnits       (gOptGeomLUnits);
+  geom -> SetDensityUnits      (gOptGeomDUnits);
+  geom -> SetWeightWithDensity (true);
+  geom -> SetTopVolName        (gOptRootGeomTopVol);
+  geom -> SetUseBoxNavigation  (gOptUseBoxNav);
+
+  if(gOptNPoints   > 0) geom->SetScannerNPoints(gOptNPoints);
+  if(gOptNScanRays > 0) geom->SetScannerNRays  (gOptNScanRays);
+
+  const PDGCodeList & tgtlist = geom->ListOfTargetNuclei();
+
+  // Throw the rays over the flux window, in SI units
+  LOG("ggeombench", pINFO)
+     << "Generating " << gOptNRays << " rays over the flux window";
+
+  TRandom3 & rnd = RandomGen::Instance()->RndGeom();
+  TVector3 edge1 = gOptWinCorner[1] - gOptWinCorner[0];
+  TVector3 edge2 = gOptWinCorner[2] - gOptWinCorner[0];
+  TLorentzVector p4(gOptRayDir.Unit(), 1.);
+
+  vector<TLorentzVector> x4(gOptNRays);
+  for(int iray = 0; iray < gOptNRays; iray++) {
+    TVector3 pos = gOptWinCorner[0] + rnd.Rndm()*edge1 + rnd.Rndm()*edge2;
+    pos *= gOptGeomLUnits;
+    x4[iray].SetVect(pos);
+    x4[iray].SetT(0.);
+  }
+
+  TStopwatch watch;
+
+  // Max path lengths
+  LOG("ggeombench", pNOTICE) << "Timing ComputeMaxPathLengths()";
+  geom->ResetNavigationSteps();
+  watch.Start(true);
+  geom->ComputeMaxPathLengths();
+  watch.Stop();
+  long int maxpl_nsteps = geom->NavigationSteps();
+  double   maxpl_rtime  = watch.RealTime();
+  double   maxpl_ctime  = watch.CpuTime();
+
+  // Path lengths, collecting the step & segment statistics
+  LOG("ggeombench", pNOTICE) << "Timing ComputePathLengths()";
+  map<const TGeoMaterial *, MatStat_t> matstats;
+  vector<int> vtxtgt(gOptNRays, 0);
+  long int nsegtot = 0;
+  int      nhit    = 0;
+
+  geom->ResetNavigationSteps();
+  watch.Reset();
+  for(int iray = 0; iray < gOptNRays; iray++) {
+    watch.Start(false);
+    const PathLengthList & pl = geom->ComputePathLengths(x4[iray], p4);
+    watch.Stop();
+
+    // pick the target with the longest path length for the vertex timing
+    double plmax = 0;
+    PathLengthList::const_iterator pliter = pl.begin();
+    for( ; pliter != pl.end(); ++pliter) {
+      if(pliter->second > plmax) {
+        plmax = pliter->second;
+        vtxtgt[iray] = pliter->first;
+      }
+    }
+    if(plmax > 0) nhit++;
+
+    const PathSegmentList * psl = geom->GetCurrentPathSegmentList();
+    if(!psl) continue;
+    const PathSegmentList::PathSegmentV_t & segs = psl->GetPathSegmentV();
+    nsegtot += segs.size();
+    PathSegmentList::PathSegVCItr_t siter = segs.begin();
+    for( ; siter != segs.end(); ++siter) {
+      MatStat_t & stat = matstats[siter->fMaterial];
+      stat.nseg++;
+      stat.step += siter->GetSummedStepRange();
+    }
+  }
+  double   pl_time   = watch.RealTime();
+  double   pl_ctime  = watch.CpuTime();
+  long int pl_nsteps = geom->NavigationSteps();
+
+  // Vertices, for the rays crossing some material
+  LOG("ggeombench", pNOTICE) << "Timing GenerateVertex()";
+  geom->ResetNavigationSteps();
+  watch.Start(true);
+  for(int iray = 0; iray < gOptNRays; iray++) {
+    if(vtxtgt[iray] == 0) continue;
+    geom->GenerateVertex(x4[iray], p4, vtxtgt[iray]);
+  }
+  watch.Stop();
+  long int vtx_nsteps = geom->NavigationSteps();
+  double   vtx_rtime  = watch.RealTime();
+  double   vtx_ctime  = watch.CpuTime();
+
+  // Report
+  double nrays = TMath::Max(1, gOptNRays);
+  double nvtx  = TMath::Max(1, nhit);
+
+  ostringstream report;
+  report
+    << "\n" << utils::print::PrintFramedMesg("ggeombench results") << "\n"
+    << "Target nuclei           : " << tgtlist.size() << "\n"
+    << "Rays thrown (hit matter): " << gOptNRays << " (" << nhit << ")\n"
+    << "\n"
+    << "ComputeMaxPathLengths() : "
+    << maxpl_rtime << " s real, " << maxpl_ctime << " s cpu, "
+    << maxpl_nsteps << " navigation steps\n"
+    << "ComputePathLengths()    : "
+    << pl_time << " s real, " << pl_ctime << " s cpu, "
+    << (pl_time > 0 ? gOptNRays/pl_time : 0) << " rays/s\n"
+    << "   navigation steps/ray : " << pl_nsteps/nrays << "\n"
+    << "   path segments/ray    : " << nsegtot/nrays << "\n"
+    << "GenerateVertex()        : "
+    << vtx_rtime << " s real, " << vtx_ctime << " s cpu, "
+    << (vtx_rtime > 0 ? nhit/vtx_rtime : 0) << " vertices/s\n"
+    << "   navigation steps/vtx : " << vtx_nsteps/nvtx << "\n"
+    << "\n"
+    << "Path segments per material (steps in top vol units):\n"
+    << setw(25) << "material" << setw(15) << "segments"
+    << setw(15) << "segments/ray" << setw(15) << "step/ray" << "\n";
+
+  map<const TGeoMaterial *, MatStat_t>::const_iterator miter = matstats.begin();
+  for( ; miter != matstats.end(); ++miter) {
+    string name = (miter->first) ? miter->first->GetName() : "(none)";
+    report
+      << setw(25) << name
+      << setw(15) << miter->second.nseg
+      << setw(15) << setprecision(4) << miter->second.nseg/nrays
+      << setw(15) << setprecision(4) << miter->second.step/nrays << "\n";
+  }
+
+  LOG("ggeombench", pNOTICE) << report.str();
+
+  delete geom;
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("ggeombench", pINFO) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  // input geometry file
+  if( parser.OptionExists('f') ) {
+    LOG("ggeombench", pDEBUG)
+       << "Reading ROOT/GEANT geometry filename";
+    gOptGeomFilename = parser.ArgAsString('f');
+  } else {
+    LOG("ggeombench", pFATAL)
+       << "No geometry file was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  } //-f
+
+  // flux window
+  if( parser.OptionExists('w') ) {
+    LOG("ggeombench", pDEBUG) << "Reading flux window";
+    vector<string> win = utils::str::Split(parser.ArgAsString('w'), ",");
+    if(win.size() != 9) {
+      LOG("ggeombench", pFATAL)
+         << "The flux window needs 9 numbers (3 corners) - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    for(int i = 0; i < 3; i++) {
+      gOptWinCorner[i].SetXYZ( atof(win[3*i  ].c_str()),
+                               atof(win[3*i+1].c_str()),
+                               atof(win[3*i+2].c_str()) );
+    }
+  } else {
+    LOG("ggeombench", pFATAL)
+       << "No flux window was specified - Exiting";
+    PrintSyntax();
+    exit(1);
+  } //-w
+
+  // ray direction
+  if( parser.OptionExists('d') ) {
+    LOG("ggeombench", pDEBUG) << "Reading ray direction";
+    gOptRayDir = GetVec3(parser.ArgAsString('d'));
+  } else {
+    LOG("ggeombench", pDEBUG)
+       << "Unspecified ray direction - Using the flux window normal";
+    gOptRayDir = (gOptWinCorner[1] - gOptWinCorner[0]).Cross(
+                  gOptWinCorner[2] - gOptWinCorner[0]);
+  } //-d
+  if(gOptRayDir.Mag() <= 0) {
+    LOG("ggeombench", pFATAL)
+       << "Null ray direction (degenerate flux window?) - Exiting";
+    exit(1);
+  }
+
+  // number of rays
+  if( parser.OptionExists('n') ) {
+    LOG("ggeombench", pDEBUG) << "Reading number of rays";
+    gOptNRays = parser.ArgAsInt('n');
+  } else {
+    LOG("ggeombench", pDEBUG)
+       << "Unspecified number of rays - Using default";
+    gOptNRays = kDefOptNRays;
+  } //-n
+
+  // legth & density units
+  string lunits, dunits;
+  if( parser.OptionExists('L') ) {
+    LOG("ggeombench", pDEBUG) << "Checking for input geometry length units";
+    lunits = parser.ArgAsString('L');
+  } else {
+    LOG("ggeombench", pDEBUG) << "Using default geometry length units";
+    lunits = kDefOptGeomLUnits;
+  } // -L
+  if( parser.OptionExists('D') ) {
+    LOG("ggeombench", pDEBUG) << "Checking for input geometry density units";
+    dunits = parser.ArgAsString('D');
+  } else {
+    LOG("ggeombench", pDEBUG) << "Using default geometry density units";
+    dunits = kDefOptGeomDUnits;
+  } // -D
+  gOptGeomLUnits = genie::utils::units::UnitFromString(lunits);
+  gOptGeomDUnits = genie::utils::units::UnitFromString(dunits);
+
+  // root geometry top volume name
+  if( parser.OptionExists('t') ) {
+    LOG("ggeombench", pDEBUG)
+       << "Reading root geometry top volume name";
+    gOptRootGeomTopVol = parser.ArgAsString('t');
+  } else {
+    LOG("ggeombench", pDEBUG)
+       << "Unspecified geometry top volume - Using default";
+    gOptRootGeomTopVol = "";
+  } // -t
+
+  // max path length scanner settings
+  if( parser.OptionExists('s') ) {
+    LOG("ggeombench", pDEBUG)
+       << "Reading max path length scanner settings";
+    vector<string> scan = utils::str::Split(parser.ArgAsString('s'), ",");
+    gOptNPoints = atoi(scan[0].c_str());
+    if(scan.size() > 1) gOptNScanRays = atoi(scan[1].c_str());
+  } else {
+    LOG("ggeombench", pDEBUG)
+      << "Unspecified scanner settings - Using driver's defaults";
+  } //-s
+
+  // analytic box navigation
+  gOptUseBoxNav = parser.OptionExists('b');
+
+  // random number seed
+  if( parser.OptionExists("seed") ) {
+    LOG("ggeombench", pINFO) << "Reading random number seed";
+    gOptRanSeed = parser.ArgAsLong("seed");
+  } else {
+    LOG("ggeombench", pINFO) << "Unspecified random number seed - Using default";
+    gOptRanSeed = -1;
+  }
+
+  // print the command line arguments
+  LOG("ggeombench", pNOTICE)
+     << "\n"
+     << utils::print::PrintFramedMesg("ggeombench job inputs");
+  LOG("ggeombench", pNOTICE) << "Command line arguments";
+  LOG("ggeombench", pNOTICE) << "Input ROOT geometry     : " << gOptGeomFilename;
+  LOG("ggeombench", pNOTICE) << "Geometry length units   : " << gOptGeomLUnits;
+  LOG("ggeombench", pNOTICE) << "Geometry density units  : " << gOptGeomDUnits;
+  LOG("ggeombench", pNOTICE) << "Top volume              : " << gOptRootGeomTopVol;
+  LOG("ggeombench", pNOTICE) << "Flux window corner 0    : "
+                             << utils::print::Vec3AsString(&gOptWinCorner[0]);
+  LOG("ggeombench", pNOTICE) << "Flux window corner 1    : "
+                             << utils::print::Vec3AsString(&gOptWinCorner[1]);
+  LOG("ggeombench", pNOTICE) << "Flux window corner 2    : "
+                             << utils::print::Vec3AsString(&gOptWinCorner[2]);
+  LOG("ggeombench", pNOTICE) << "Ray direction           : "
+                             << utils::print::Vec3AsString(&gOptRayDir);
+  LOG("ggeombench", pNOTICE) << "Number of rays          : " << gOptNRays;
+  LOG("ggeombench", pNOTICE) << "Scanner points/surface  : " << gOptNPoints;
+  LOG("ggeombench", pNOTICE) << "Scanner rays/point      : " << gOptNScanRays;
+  LOG("ggeombench", pNOTICE) << "Box navigation          : " << gOptUseBoxNav;
+  LOG("ggeombench", pNOTICE) << "Random number seed      : " << gOptRanSeed;
+
+  LOG("ggeombench", pNOTICE) << "\n";
+  LOG("ggeombench", pNOTICE) << *RunOpt::Instance();
+}
+//____________________________________________________________________________
+TVector3 GetVec3(string s)
+{
+  vector<string> v = utils::str::Split(s, ",");
+  if(v.size() != 3) {
+    LOG("ggeombench", pFATAL)
+       << "Can not parse a 3-vector from: " << s << " - Exiting";
+    PrintSyntax();
+    exit(1);
+  }
+  return TVector3( atof(v[0].c_str()), atof(v[1].c_str()), atof(v[2].c_str()) );
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("ggeombench", pNOTICE)
+      << "\n\n" << "Syntax:" << "\n"
+      << "   ggeombench"
+      << " -f geom_file"
+      << " -w x0,y0,z0,x1,y1,z1,x2,y2,z2"
+      << " [-d dx,dy,dz]"
+      << " [-n nrays]"
+      << " [-L length_units]"
+      << " [-D density_units]"
+      << " [-t top_volume_name]"
+      << " [-s np[,nr]] [-b]"
+      << " [--seed random_number_seed]"
+      << " [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
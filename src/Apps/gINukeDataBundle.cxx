@@ -0,0 +1,122 @@
+//____________________________________________________________________________
+/*!
+
+\program ginukebundle
+
+\brief   Builds the binary bundle of the INTRANUKE (2018) hadron data: all the
+         hadron x-section splines, the hN angular distribution grids and the
+         pi+A fraction graphs built by INukeHadroData2018 from the text data
+         files in $GINUKEHADRONDATA (or $GENIE/data/evgen/intranuke) are saved
+         in a single file that is memory-mapped at start-up instead of parsing
+         the text files.
+
+         The bundle records a hash of the contents of the text data files,
+         which remain the source of truth: it is ignored (and the text files
+         are read) whenever they have changed.
+
+         Syntax :
+           ginukebundle [-o output_file]
+                        [--message-thresholds xml_file]
+
+         Options :
+           -o 
+              output binary file. By default, the bundle is written in the
+              hadron data directory, where it is found automatically.
+              Otherwise, set $GINUKEHADRONBUNDLE to the bundle file.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Notes :
+           Bundles are written in the native byte order and can only be read
+           on machines with the same endianness. 
+
+         Examples :
+
+           shell% ginukebundle -o /data/inuke/intranuke-2018.ginukebin
+           shell% export GINUKEHADRONBUNDLE=/data/inuke/intranuke-2018.ginukebin
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/HadronTransport/INukeHadroData2018.h"
+
+using std::string;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string gOutFile;   ///< output binary file
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  // builds the data from the text files (or from an existing bundle, if it
+  // still matches them)
+  INukeHadroData2018 * hd = INukeHadroData2018::Instance();
+
+  if(gOutFile.size() == 0) gOutFile = hd->DefaultBundle();
+
+  LOG("ginukebundle", pNOTICE) 
+     << " ****** Saving the INTRANUKE hadron data into : " << gOutFile;
+  if(!hd->SaveBundle(gOutFile)) {
+    LOG("ginukebundle", pFATAL) << "Could not write: " << gOutFile;
+    exit(1);
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("ginukebundle", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. 
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("ginukebundle", pINFO) << "Reading output file name";
+    gOutFile = parser.ArgAsString('o');
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("ginukebundle", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   ginukebundle  [-o output_file]\n"
+    << "                 [--message-thresholds xml_file]\n";
+
+}
+//____________________________________________________________________________
@@ -0,0 +1,140 @@
+//____________________________________________________________________________
+/*!
+
+\program gmectensor2bin
+
+\brief   Converts the text MEC hadron tensor tables (Nieves et al.) in
+         $GENIE/data/evgen/mectensor/nieves into the binary format that is
+         memory-mapped by MECHadronTensor when the tensors of a target are
+         first needed, instead of parsing the text tables.
+
+         One binary file is written per target. It holds a self-describing
+         header (tensor types and components, grid dimensions and ranges)
+         and a hash of the contents of the text tables, which remain the
+         source of truth: the binary file is ignored (and the text tables
+         are read) whenever they have changed.
+
+         Syntax :
+           gmectensor2bin [-t target_pdg_codes] [-o output_directory]
+                          [--message-thresholds xml_file]
+
+         Options :
+           -t
+              comma separated list of target PDG codes. By default, all
+              targets with hadron tensor tables are converted.
+           -o
+              output directory. By default, the binary files are written next
+              to the text tables, where they are found automatically.
+              Otherwise, set $GMECTENSORBINDIR to the output directory.
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Notes :
+           Binary files are written in the native byte order and can only be
+           read on machines with the same endianness.
+
+         Examples :
+
+           shell% gmectensor2bin -t 1000060120,1000080160 -o /data/mec
+           shell% export GMECTENSORBINDIR=/data/mec
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <TSystem.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/Multinucleon/XSection/MECHadronTensor.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+vector<int> gTargets;  ///< targets to convert
+string      gOutDir;   ///< output directory
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  // the output directory is where the binary files are looked up
+  if(gOutDir.size() > 0) gSystem->Setenv("GMECTENSORBINDIR", gOutDir.c_str());
+
+  MECHadronTensor * hadtensor = MECHadronTensor::Instance();
+
+  if(gTargets.size() == 0) gTargets = hadtensor->KnownTensors();
+
+  for(unsigned int i = 0; i < gTargets.size(); i++) {
+    string outfile = hadtensor->BinaryTableFile(gTargets[i]);
+    LOG("gmectensor2bin", pNOTICE)
+       << " ****** Saving the MEC hadron tensors for target " << gTargets[i]
+       << " into : " << outfile;
+    if(!hadtensor->SaveBinaryTables(gTargets[i], outfile)) {
+      LOG("gmectensor2bin", pFATAL) << "Could not write: " << outfile;
+      exit(1);
+    }
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gmectensor2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+
+  if( parser.OptionExists('t') ) {
+    LOG("gmectensor2bin", pINFO) << "Reading target PDG codes";
+    gTargets = parser.ArgAsIntTokens('t', ",");
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("gmectensor2bin", pINFO) << "Reading output directory";
+    gOutDir = parser.ArgAsString('o');
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gmectensor2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gmectensor2bin  [-t target_pdg_codes] [-o output_directory]\n"
+    << "                   [--message-thresholds xml_file]\n";
+
+}
+//____________________________________________________________________________
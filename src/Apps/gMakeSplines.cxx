@@ -15,7 +15,13 @@
                   -f geometry_file>
                   <-o | --output-cross-sections> output_xml_xsec_file
                   [-n nknots]
+                  [--knot-precision relative_precision]
                   [-e max_energy]
+                  [-j number_of_workers]
+                  [--distributed shared_directory [--rank rank,nranks]]
+                  [--checkpoint checkpoint_file [--resume]]
+                  [--max-xsec-cache cache_file]
+                  [--xsec-sum]
                   [--no-copy]
                   [--seed random_number_seed]
                   [--input-cross-sections xml_file]
@@ -44,10 +50,68 @@
                Number of knots per spline.
                Default: 15 knots per decade of energy range with a minimum
                of 30 knots totally.
+               With --knot-precision, this is the max number of knots.
+           --knot-precision
+               Place the knots of each spline adaptively rather than uniformly:
+               intervals are bisected until the spline and the cross section
+               computed at the mid-point agree to the given relative precision
+               (eg 0.005). This needs fewer cross section calculations than
+               uniform knots in smooth regions, and adds knots near thresholds
+               and structures.
+               Default: uniform knots.
            -e
                Maximum energy in spline.
                Default: The max energy in the validity range of the spline
                generating thread.
+           -j
+               Number of worker processes computing splines in parallel.
+               Workers pick the next neutrino+target initial state to process
+               from a shared counter, so that the load is balanced even if
+               the cost per initial state varies a lot. The splines computed
+               by all workers are collected in a single output file, which is 
+               identical to the one obtained with a single worker.
+               Default: 1.
+           --distributed
+               Share the job among several gmkspl processes, eg with one per
+               node of a batch allocation, all given the same options and the
+               same directory on a shared file system (a new one per job).
+               Each process claims the initial states to compute from that
+               directory (by exclusively creating a claim file in it), so
+               the load is balanced dynamically across all processes and, with
+               -j, their workers. The heaviest nuclei are handed out first, as
+               they cost much more than light nuclei and free nucleons.
+               Each process writes the splines it computed in the directory;
+               rank 0 waits for all of them and writes the output file. The
+               splines are the same as the ones of a single process.
+               Checkpoint files get the rank as a suffix.
+           --rank
+               The rank of this process and the number of processes, as
+               rank,nranks. If not given, they are taken from the environment
+               set by the job launcher: $SLURM_PROCID / $SLURM_NTASKS (srun),
+               $OMPI_COMM_WORLD_RANK / $OMPI_COMM_WORLD_SIZE (Open MPI mpirun)
+               or $PMI_RANK / $PMI_SIZE (MPICH, Intel MPI mpirun). MPI is used
+               only to launch the processes: gmkspl does not link to it.
+           --checkpoint
+               Name of a file where every computed spline knot is recorded
+               as soon as it is available, so that no work is lost if the
+               job is killed (eg on preemptible batch resources).
+           --resume
+               Resume a killed job: The knots found in the checkpoint file
+               are re-used instead of being recomputed.
+           --max-xsec-cache
+               Name of a ROOT cache file where the max differential cross
+               sections used by the kinematics generators are tabulated, at
+               the knots of each computed spline. Event generation jobs using
+               this file (--cache-file, see gevgen) need no warm-up phase for
+               finding these maxima. It can be shared by concurrent jobs with
+               --cache-read-only.
+           --xsec-sum
+               Also save the sum of the splines of all interactions for each
+               initial state (the total cross section used by GMCJDriver to
+               select initial states), so that event generation jobs do not
+               need to sum the splines at start-up. Each sum spline is keyed
+               by a hash of its constituent splines, and is ignored by jobs
+               loading other splines.
            --no-copy
                Does not write out the input cross-sections in the output file
            --seed
@@ -84,29 +148,46 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cerrno>
 #include <cstdlib>
 #include <string>
+#include <sstream>
 #include <vector>
+#include <algorithm>
 
 #if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
 #include <fenv.h> // for `feenableexcept`
 #endif
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
 #include <TSystem.h>
 
 #include "Framework/Conventions/GBuild.h"
+#include "Framework/EventGen/EventGenerator.h"
+#include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/StringUtils.h"
 //#include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/Common/KineGeneratorWithCache.h"
 
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
@@ -114,6 +195,8 @@
 
 using std::string;
 using std::vector;
+using std::pair;
+using std::ostringstream;
 
 using namespace genie;
 
@@ -126,13 +209,38 @@ void          GetCommandLineArgs (int argc, char ** argv);
 void          PrintSyntax        (void);
 PDGCodeList * GetNeutrinoCodes   (void);
 PDGCodeList * GetTargetCodes     (void);
+void          MakeSplines        (const PDGCodeList & neutrinos, 
+                                  const PDGCodeList & targets, 
+                                  volatile int * next_task);
+void          MakeSplinesInWorkers (const PDGCodeList & neutrinos, 
+                                    const PDGCodeList & targets);
+vector<int>   TaskOrder          (const PDGCodeList & neutrinos,
+                                  const PDGCodeList & targets);
+int           NextTask           (const vector<int> & order, int k,
+                                  volatile int * next_task);
+string        RankSplineFile     (int rank);
+void          SaveRankSplines    (bool save_all);
+void          GatherRankSplines  (void);
+void          TabulateMaxXSec    (const PDGCodeList & neutrinos, 
+                                  const PDGCodeList & targets);
+void          AddXSecSumSplines  (const PDGCodeList & neutrinos, 
+                                  const PDGCodeList & targets);
 
 // User-specified options:
 string   gOptNuPdgCodeList  = "";
 string   gOptTgtPdgCodeList = "";
 string   gOptGeomFilename   = "";
 int      gOptNKnots         = -1;
+double   gOptKnotPrecision  = -1.;  // relative precision for adaptive knots
 double   gOptMaxE           = -1.;
+int      gOptNWorkers       = 1;    // number of worker processes
+string   gOptDistribDir     = "";   // shared directory of a distributed job
+int      gOptRank           = 0;    // rank of this process in a distributed job
+int      gOptNRanks         = 1;    // number of processes in a distributed job
+string   gOptCheckpointFile = "";   // checkpoint file for computed knots
+bool     gOptResume         = false;// resume from checkpoint file?
+string   gOptMaxXSecFile    = "";   // output max{dxsec/dK} cache file
+bool     gOptXSecSum        = false;// save the sum splines too?
 bool     gOptNoCopy         = false;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
@@ -158,7 +266,6 @@ int main(int argc, char ** argv)
   // Init
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::RandGen(gOptRanSeed);
-  utils::app_init::XSecTable(gOptInpXSecFile, false);
 
   // Get list of neutrinos and nuclear targets
 
@@ -179,28 +286,62 @@ int main(int argc, char ** argv)
   LOG("gmkspl", pINFO) << "Neutrinos: " << *neutrinos;
   LOG("gmkspl", pINFO) << "Targets: "   << *targets;
 
-  // Loop over all possible input init states and ask the GEVGDriver
-  // to build splines for all the interactions that its loaded list
-  // of event generators can generate.
-
-  PDGCodeList::const_iterator nuiter;
-  PDGCodeList::const_iterator tgtiter;
-  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
-    for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
-      int nupdgc  = *nuiter;
-      int tgtpdgc = *tgtiter;
-      InitialState init_state(tgtpdgc, nupdgc);
-      GEVGDriver driver;
-      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-      driver.Configure(init_state);
-      driver.CreateSplines(gOptNKnots, gOptMaxE);
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  xspl->SetKnotPrecision(gOptKnotPrecision);
+  bool save_init = !gOptNoCopy;
+
+  // Start a new checkpoint file, unless resuming a previous job
+  if(gOptCheckpointFile.size() > 0 && !gOptResume) {
+    FILE * ckpt = fopen(gOptCheckpointFile.c_str(), "w");
+    if(ckpt) fclose(ckpt);
+  }
+
+  // Are only computed splines in the list (all to be saved)?
+  bool only_computed = false;
+
+  if(gOptNWorkers > 1) {
+    // Compute splines in worker processes. Each worker loads the input
+    // cross-section file itself & writes out only the splines it computed.
+    MakeSplinesInWorkers(*neutrinos, *targets);
+    only_computed = true;
+  } 
+  else {
+    utils::app_init::XSecTable(gOptInpXSecFile, false);
+    MakeSplines(*neutrinos, *targets, 0);
+  }
+
+  // Distributed job: hand the computed splines over to rank 0, which
+  // collects the splines computed by all processes
+  if(gOptDistribDir.size() > 0) {
+    SaveRankSplines(only_computed);
+    if(gOptRank != 0) {
+      LOG("gmkspl", pNOTICE) 
+        << "Rank " << gOptRank << " done - Rank 0 writes the output file";
+      delete neutrinos;
+      delete targets;
+      return 0;
     }
+    GatherRankSplines();
+    only_computed = true;
+  }
+
+  // Add the input splines to the output, unless asked not to
+  if(only_computed && save_init) {
+    utils::app_init::XSecTable(gOptInpXSecFile, false, true);
+  }
+
+  // Add the sum splines for all initial states
+  if(gOptXSecSum) {
+    AddXSecSumSplines(*neutrinos, *targets);
   }
 
   // Save the splines at the requested XML file
-  XSecSplineList * xspl = XSecSplineList::Instance();
-  bool save_init = !gOptNoCopy;
-  xspl->SaveAsXml(gOptOutXSecFile, save_init);
+  xspl->SaveAsXml(gOptOutXSecFile, only_computed ? true : save_init);
+
+  // Tabulate the max differential cross sections at the spline knots
+  if(gOptMaxXSecFile.size() > 0) {
+    TabulateMaxXSec(*neutrinos, *targets);
+  }
 
   delete neutrinos;
   delete targets;
@@ -208,6 +349,318 @@ int main(int argc, char ** argv)
   return 0;
 }
 //____________________________________________________________________________
+void MakeSplines(
+  const PDGCodeList & neutrinos, const PDGCodeList & targets, 
+  volatile int * next_task)
+{
+// Loop over all possible input init states and ask the GEVGDriver
+// to build splines for all the interactions that its loaded list
+// of event generators can generate.
+// If a shared task counter is given, then only process the init states 
+// claimed from that counter.
+// The random number streams are reseeded for each init state, so that any
+// MC integration gives results which do not depend on the order in which 
+// the init states are processed (and on the number of workers / processes).
+
+  if(gOptCheckpointFile.size() > 0) {
+    bool ok = XSecSplineList::Instance()->OpenCheckpoint(gOptCheckpointFile, true);
+    if(!ok) {
+      LOG("gmkspl", pFATAL) 
+        << "Couldn't open checkpoint file: " << gOptCheckpointFile;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+
+  vector<int> order = TaskOrder(neutrinos, targets);
+  int ntasks = order.size();
+  int k      = NextTask(order, -1, next_task);
+
+  while(k < ntasks) {
+    int itask   = order[k];
+    int nupdgc  = neutrinos[itask / targets.size()];
+    int tgtpdgc = targets  [itask % targets.size()];
+
+    RandomGen::Instance()->SetEventIndex(itask);
+
+    InitialState init_state(tgtpdgc, nupdgc);
+    GEVGDriver driver;
+    driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    driver.Configure(init_state);
+    driver.CreateSplines(gOptNKnots, gOptMaxE);
+
+    k = NextTask(order, k, next_task);
+  }
+
+  XSecSplineList::Instance()->CloseCheckpoint();
+}
+//____________________________________________________________________________
+vector<int> TaskOrder(
+          const PDGCodeList & neutrinos, const PDGCodeList & targets)
+{
+// The order in which the init states (tasks) are handed out: The cost of an
+// init state grows steeply with the target mass number, so the heavy nuclei
+// come first and the light nuclei / free nucleons fill in the gaps at the
+// end. Ties are kept in the command-line order.
+
+  vector< pair<int,int> > tasks;
+  for(unsigned int itask = 0; itask < neutrinos.size() * targets.size(); itask++) {
+    int tgtpdgc = targets[itask % targets.size()];
+    int A = pdg::IsIon(tgtpdgc) ? pdg::IonPdgCodeToA(tgtpdgc) : 1;
+    tasks.push_back(pair<int,int>(-A, itask));
+  }
+  std::sort(tasks.begin(), tasks.end());
+
+  vector<int> order;
+  for(unsigned int i = 0; i < tasks.size(); i++) {
+    order.push_back(tasks[i].second);
+  }
+  return order;
+}
+//____________________________________________________________________________
+int NextTask(const vector<int> & order, int k, volatile int * next_task)
+{
+// Position, in the task order, of the next init state this process should
+// compute after the one at position k (-1 at start): The next one claimed from
+// the shared task counter of the workers, if any. In a distributed job, the
+// init states already claimed by another process are skipped.
+
+  int ntasks = order.size();
+  while(true) {
+    k = (next_task) ? __sync_fetch_and_add(next_task, 1) : k+1;
+    if(k >= ntasks || gOptDistribDir.size() == 0) return k;
+
+    ostringstream claim;
+    claim << gOptDistribDir << "/task" << order[k] << ".claim";
+    int fd = open(claim.str().c_str(), O_WRONLY | O_CREAT | O_EXCL, 0644);
+    if(fd >= 0) {
+      close(fd);
+      return k;
+    }
+    if(errno != EEXIST) {
+      LOG("gmkspl", pFATAL) << "Couldn't create claim file: " << claim.str();
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+}
+//____________________________________________________________________________
+string RankSplineFile(int rank)
+{
+  ostringstream file;
+  file << gOptDistribDir << "/splines.rank" << rank << ".xml";
+  return file.str();
+}
+//____________________________________________________________________________
+void SaveRankSplines(bool save_all)
+{
+// Write the splines computed by this process in the shared directory. The
+// file is renamed into place once complete, as rank 0 waits for it to exist.
+
+  string file = RankSplineFile(gOptRank);
+  ostringstream tmpfile;
+  tmpfile << file << "." << getpid() << ".tmp";
+
+  XSecSplineList::Instance()->SaveAsXml(tmpfile.str(), save_all);
+  if(rename(tmpfile.str().c_str(), file.c_str()) != 0) {
+    LOG("gmkspl", pFATAL) << "Couldn't write: " << file;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  LOG("gmkspl", pNOTICE) << "Saved the splines of rank " << gOptRank << " in: " << file;
+}
+//____________________________________________________________________________
+void GatherRankSplines(void)
+{
+// Rank 0: wait for the spline files of all ranks and load them (replacing
+// the splines in the list, which are those of rank 0 plus the input ones)
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  int nwait = 0;
+  for(int rank = 0; rank < gOptNRanks; rank++) {
+    string file = RankSplineFile(rank);
+    while(gSystem->AccessPathName(file.c_str())) {
+      if(nwait++ % 30 == 0) {
+        LOG("gmkspl", pNOTICE) << "Waiting for the splines of rank " << rank;
+      }
+      sleep(10);
+    }
+    XmlParserStatus_t status = xspl->LoadFromXml(file, rank > 0);
+    if(status != kXmlOK) {
+      LOG("gmkspl", pFATAL) << "Couldn't read the splines of rank " << rank
+                            << " from: " << file;
+      gAbortingInErr = true;
+      exit(1);
+    }
+  }
+}
+//____________________________________________________________________________
+void TabulateMaxXSec(
+          const PDGCodeList & neutrinos, const PDGCodeList & targets)
+{
+// For every interaction with a spline, ask the kinematics generators of the
+// corresponding event generator to compute max{dxsec/dK} at the spline knots
+// and store it in the cache, which is then written out to the cache file
+
+  Cache * cache = Cache::Instance();
+  cache->OpenCacheFile(gOptMaxXSecFile);
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  for(unsigned int inu = 0; inu < neutrinos.size(); inu++) {
+    for(unsigned int itgt = 0; itgt < targets.size(); itgt++) {
+
+      InitialState init_state(targets[itgt], neutrinos[inu]);
+      GEVGDriver driver;
+      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver.Configure(init_state);
+
+      const EventGeneratorList * evglist = driver.EventGenerators();
+      EventGeneratorList::const_iterator evgliter = evglist->begin();
+      for( ; evgliter != evglist->end(); ++evgliter) {
+        const EventGenerator * evgen = 
+                       dynamic_cast<const EventGenerator *> (*evgliter);
+        if(!evgen) continue;
+
+        InteractionList * ilst = 
+             evgen->IntListGenerator()->CreateInteractionList(init_state);
+        if(!ilst) continue;
+
+        // kinematics generators may query the running thread
+        RunningThreadInfo::Instance()->UpdateRunningThread(evgen);
+
+        const XSecAlgorithmI * alg = evgen->CrossSectionAlg();
+        const vector<const EventRecordVisitorI *> & modules = evgen->Modules();
+
+        InteractionList::const_iterator intliter = ilst->begin();
+        for( ; intliter != ilst->end(); ++intliter) {
+          const Interaction * interaction = *intliter;
+          if(!xspl->SplineExists(alg, interaction)) continue;
+          const Spline * spl = xspl->GetSpline(alg, interaction);
+
+          vector<double> energies(spl->NKnots());
+          for(int i = 0; i < spl->NKnots(); i++) {
+            energies[i] = spl->GetKnotX(i);
+          }
+          for(unsigned int im = 0; im < modules.size(); im++) {
+            const KineGeneratorWithCache * kinegen = 
+               dynamic_cast<const KineGeneratorWithCache *> (modules[im]);
+            if(!kinegen) continue;
+            kinegen->TabulateMaxXSec(alg, interaction, energies);
+          }
+        }
+        delete ilst;
+      }
+    }
+  }
+
+  cache->Sync();
+}
+//____________________________________________________________________________
+void AddXSecSumSplines(
+          const PDGCodeList & neutrinos, const PDGCodeList & targets)
+{
+// For every init state, sum the splines of all interactions over the valid
+// energy range (25 knots per decade, at least 100) and add the sum spline to
+// the spline list
+
+  for(unsigned int inu = 0; inu < neutrinos.size(); inu++) {
+    for(unsigned int itgt = 0; itgt < targets.size(); itgt++) {
+
+      InitialState init_state(targets[itgt], neutrinos[inu]);
+      GEVGDriver driver;
+      driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+      driver.Configure(init_state);
+      driver.UseSplines();
+
+      Range1D_t rE  = driver.ValidEnergyRange();
+      double    min = rE.min;
+      double    max = (gOptMaxE > 0 && gOptMaxE < rE.max) ? gOptMaxE : rE.max;
+      int       nk  = TMath::Max(100,
+                        TMath::Nint(25 * TMath::Log10(max/min)));
+
+      LOG("gmkspl", pNOTICE)
+        << "Summing the splines for init state: " << init_state.AsString();
+
+      driver.CreateXSecSumSpline(nk, min, max, true);
+      driver.StoreXSecSumSpline();
+    }
+  }
+}
+//____________________________________________________________________________
+void MakeSplinesInWorkers(
+          const PDGCodeList & neutrinos, const PDGCodeList & targets)
+{
+// Fork gOptNWorkers worker processes computing splines for the init states
+// they claim from a counter in shared memory. Once all workers are done, 
+// the splines each one wrote in a temporary XML file are loaded back.
+
+  volatile int * next_task = (volatile int *) mmap(0, sizeof(int), 
+       PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if((void *) next_task == MAP_FAILED) {
+    LOG("gmkspl", pFATAL) << "Couldn't allocate shared task counter";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  *next_task = 0;
+
+  vector<string> wfiles;
+  vector<pid_t>  wpids;
+
+  for(int iw = 0; iw < gOptNWorkers; iw++) {
+    ostringstream wfile;
+    wfile << gOptOutXSecFile << ".worker" << iw << "." << getpid();
+    wfiles.push_back(wfile.str());
+
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("gmkspl", pFATAL) << "Couldn't fork spline worker " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) {
+      // worker
+      LOG("gmkspl", pNOTICE) << "Starting spline worker " << iw;
+      utils::app_init::XSecTable(gOptInpXSecFile, false);
+      MakeSplines(neutrinos, targets, next_task);
+      XSecSplineList::Instance()->SaveAsXml(wfiles[iw], false);
+      _exit(0);
+    }
+    wpids.push_back(pid);
+  }
+
+  bool failed = false;
+  for(int iw = 0; iw < gOptNWorkers; iw++) {
+    int status = 0;
+    waitpid(wpids[iw], &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("gmkspl", pERROR) << "Spline worker " << iw << " failed";
+      failed = true;
+    }
+  }
+  munmap((void *) next_task, sizeof(int));
+
+  if(failed) {
+    LOG("gmkspl", pFATAL) << "At least one spline worker failed - Exiting";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  for(int iw = 0; iw < gOptNWorkers; iw++) {
+    XmlParserStatus_t status = xspl->LoadFromXml(wfiles[iw], true);
+    if(status != kXmlOK) {
+      LOG("gmkspl", pFATAL) 
+        << "Couldn't read splines computed by worker " << iw 
+        << " from: " << wfiles[iw];
+      gAbortingInErr = true;
+      exit(1);
+    }
+    unlink(wfiles[iw].c_str());
+  }
+}
+//____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gmkspl", pINFO) << "Parsing command line arguments";
@@ -246,6 +699,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptNKnots = -1;
   }
 
+  // adaptive knot placement
+  if( parser.OptionExists("knot-precision") ) {
+    LOG("gmkspl", pINFO) << "Reading relative precision for adaptive knots";
+    gOptKnotPrecision = parser.ArgAsDouble("knot-precision");
+  } else {
+    gOptKnotPrecision = -1.;
+  }
+
   // max spline energy (if < max of validity range)
   if( parser.OptionExists('e') ) {
     LOG("gmkspl", pINFO) << "Reading maximum spline energy";
@@ -256,6 +717,83 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptMaxE = -1;
   }
 
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+    LOG("gmkspl", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt('j'));
+  } else {
+    gOptNWorkers = 1;
+  }
+
+  // distributed job
+  if( parser.OptionExists("distributed") ) {
+    LOG("gmkspl", pINFO) << "Reading shared directory of distributed job";
+    gOptDistribDir = parser.ArgAsString("distributed");
+    const char * rank   = 0;
+    const char * nranks = 0;
+    if( parser.OptionExists("rank") ) {
+      vector<string> rankv = utils::str::Split(parser.ArgAsString("rank"), ",");
+      if(rankv.size() == 2) {
+        gOptRank   = atoi(rankv[0].c_str());
+        gOptNRanks = atoi(rankv[1].c_str());
+      } else {
+        gOptNRanks = 0;
+      }
+    }
+    else if( (rank = getenv("SLURM_PROCID"))         && (nranks = getenv("SLURM_NTASKS"))          ) {}
+    else if( (rank = getenv("OMPI_COMM_WORLD_RANK")) && (nranks = getenv("OMPI_COMM_WORLD_SIZE")) ) {}
+    else if( (rank = getenv("PMI_RANK"))             && (nranks = getenv("PMI_SIZE"))              ) {}
+    else {
+      LOG("gmkspl", pFATAL) 
+        << "No --rank given and no rank found in the environment - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    if(rank) {
+      gOptRank   = atoi(rank);
+      gOptNRanks = atoi(nranks);
+    }
+    if(gOptNRanks < 1 || gOptRank < 0 || gOptRank >= gOptNRanks) {
+      LOG("gmkspl", pFATAL) 
+        << "Invalid rank: " << gOptRank << " of " << gOptNRanks << " - Exiting";
+      PrintSyntax();
+      exit(1);
+    }
+    gSystem->mkdir(gOptDistribDir.c_str(), true);
+  }
+
+  // checkpointing
+  if( parser.OptionExists("checkpoint") ) {
+    LOG("gmkspl", pINFO) << "Reading checkpoint file name";
+    gOptCheckpointFile = parser.ArgAsString("checkpoint");
+    if(gOptDistribDir.size() > 0) {
+      ostringstream ckpt;
+      ckpt << gOptCheckpointFile << ".rank" << gOptRank;
+      gOptCheckpointFile = ckpt.str();
+    }
+  }
+  if( parser.OptionExists("resume") ) {
+    if(gOptCheckpointFile.size() == 0) {
+      LOG("gmkspl", pFATAL) << "You need to specify a --checkpoint file to resume from";
+      PrintSyntax();
+      exit(1);
+    }
+    LOG("gmkspl", pINFO) << "Resuming from checkpoint file";
+    gOptResume = true;
+  }
+
+  // max{dxsec/dK} cache file
+  if( parser.OptionExists("max-xsec-cache") ) {
+    LOG("gmkspl", pINFO) << "Reading max xsec cache file name";
+    gOptMaxXSecFile = parser.ArgAsString("max-xsec-cache");
+  }
+
+  // save the sum splines too?
+  if( parser.OptionExists("xsec-sum") ) {
+    LOG("gmkspl", pINFO) << "Saving the sum splines";
+    gOptXSecSum = true;
+  }
+
   // write out input splines?
   if( parser.OptionExists("no-copy") ) {
     LOG("gmkspl", pINFO) << "Not copying input splines to output";
@@ -338,6 +876,15 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
      << "\n Random number seed : " << gOptRanSeed
+     << "\n Knot precision : " << gOptKnotPrecision
+     << (gOptKnotPrecision > 0 ? "" : " (uniform knots)")
+     << "\n Number of workers : " << gOptNWorkers
+     << "\n Distributed job directory : " << gOptDistribDir
+     << " (rank " << gOptRank << " of " << gOptNRanks << ")"
+     << "\n Checkpoint file : " << gOptCheckpointFile
+     << (gOptResume ? " (resuming)" : "")
+     << "\n Max xsec cache file : " << gOptMaxXSecFile
+     << "\n Save sum splines : " << utils::print::BoolAsYNString(gOptXSecSum)
      << "\n";
 
   LOG("gmkspl", pNOTICE) << *RunOpt::Instance();
@@ -349,7 +896,10 @@ void PrintSyntax(void)
     << "\n\n" << "Syntax:" << "\n"
     << "   gmkspl -p nupdg <-t tgtpdg, -f geomfile> "
     << " <-o | --output-cross-section> xsec_xml_file_name"
-    << " [-n nknots] [-e max_energy] "
+    << " [-n nknots] [--knot-precision relerr] [-e max_energy] [-j nworkers]"
+    << " [--distributed shared_dir [--rank rank,nranks]]"
+    << " [--checkpoint file [--resume]]"
+    << " [--max-xsec-cache cache_file] [--xsec-sum]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
@@ -19,6 +19,8 @@
                   [-n nknots]
                   [-e max_energy]
                   [--no-copy]
+                  [--grid-job job_index,njobs]
+                  [--max-xsec-cache cache_file]
                   [--seed random_number_seed]
                   [--input-cross-sections xml_file]
                   [--event-generator-list list_name]
@@ -41,6 +43,12 @@
            -o, --output-cross-sections
                Name of output XML file containing computed cross-section data.
                Default: `xsec_splines.xml'.
+               If several DM masses, mediator mass ratios or couplings are
+               given, the splines of each grid point are instead saved in a
+               spline family file <name>.dm_m<mass>_r<ratio>_g<coupling>.xml,
+               where <name> is the output file name without its .xml
+               extension. Family files are loaded by gevgen_dm and
+               gevgen_lardm with --dm-spline-family <name>.
            -g
                A comma separated list of Z' coupling constants
                Default: Value in UserPhysicsOptions.xml
@@ -58,6 +66,18 @@
                generating thread.
            --no-copy
                Does not write out the input cross-sections in the output file
+           --grid-job
+               Splits the grid of (DM mass, mediator mass ratio) points among
+               njobs jobs (eg the jobs of a cluster array): This job builds
+               the family files of the points with index % njobs == job_index.
+               The cross sections scale as the 4th power of the Z' coupling,
+               so the splines of each point are computed once and rescaled to
+               each coupling.
+           --max-xsec-cache
+               Name of a ROOT cache file where the max differential cross
+               sections used by the kinematics generators are tabulated, at
+               the knots of each computed spline and for each grid point (see
+               gmkspl). Concurrent grid jobs need separate cache files.
            --seed
               Random number seed.
            --input-cross-sections
@@ -92,6 +112,8 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -99,29 +121,42 @@
 #include <fenv.h> // for `feenableexcept`
 #endif
 
+#include <TMath.h>
 #include <TSystem.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/GBuild.h"
+#include "Framework/EventGen/EventGenerator.h"
+#include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
 #include "Framework/Utils/StringUtils.h"
 //#include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Physics/BoostedDarkMatter/XSection/DMUtils.h"
+#include "Physics/Common/KineGeneratorWithCache.h"
 
 #ifdef __GENIE_GEOM_DRIVERS_ENABLED__
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
 #endif
 
+using std::map;
+using std::set;
 using std::string;
 using std::vector;
 
@@ -135,6 +170,9 @@ using namespace genie::geometry;
 void          GetCommandLineArgs (int argc, char ** argv);
 void          PrintSyntax        (void);
 PDGCodeList * GetTargetCodes     (void);
+void          SetDarkMatterPoint (double mass, double ratio, double gzp);
+void          MakeSplines        (const PDGCodeList & targets);
+void          TabulateMaxXSec    (const PDGCodeList & targets);
 
 // User-specified options:
 string   gOptTgtPdgCodeList = "";
@@ -148,6 +186,9 @@ bool     gOptNoCopy         = false;
 long int gOptRanSeed        = -1;   // random number seed
 string   gOptInpXSecFile    = "";   // input cross-section file
 string   gOptOutXSecFile    = "";   // output cross-section file
+string   gOptMaxXSecFile    = "";   // output max{dxsec/dK} cache file
+unsigned int gOptGridJob    = 0;    // this job handles the (mass, ratio) points
+unsigned int gOptNGridJobs  = 1;    // with index % gOptNGridJobs == gOptGridJob
 
 //____________________________________________________________________________
 int main(int argc, char ** argv)
@@ -161,72 +202,204 @@ int main(int argc, char ** argv)
   }
   RunOpt::Instance()->BuildTune();
 
+  // Init
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::RandGen(gOptRanSeed);
+
+  // throw on NaNs and Infs...
+#if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
+  feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
+#endif
+
+  // Get list of nuclear targets
+  PDGCodeList * targets = GetTargetCodes();
+  if(!targets || targets->size() == 0 ) {
+    LOG("gmkspl_dm", pFATAL) << "Empty target PDG code list";
+    PrintSyntax();
+    exit(3);
+  }
+  LOG("gmkspl_dm", pINFO) << "Targets: "   << *targets;
+
+  if(gOptMaxXSecFile.size() > 0) {
+    Cache::Instance()->OpenCacheFile(gOptMaxXSecFile);
+  }
+
+  // A single grid point is saved in the requested XML file, as usual.
+  // Otherwise, the splines of each point are saved in a spline family file
+  // named after the requested one (see utils::dm::SplineFamilyFile()).
+  bool single_point =
+    gOptDMMasses.size() * gOptMedRatios.size() * gOptZpCouplings.size() == 1;
+  string family_stem = gOptOutXSecFile;
+  if(family_stem.size() > 4 &&
+     family_stem.substr(family_stem.size()-4) == ".xml") {
+    family_stem.erase(family_stem.size()-4);
+  }
+
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  bool save_init = !gOptNoCopy;
+
+  unsigned int ipoint = 0;
   for (vector<double>::iterator mass = gOptDMMasses.begin(); mass != gOptDMMasses.end(); ++mass) {
     for (vector<double>::iterator ratio = gOptMedRatios.begin(); ratio != gOptMedRatios.end(); ++ratio) {
-      for (vector<double>::iterator coup = gOptZpCouplings.begin(); coup != gOptZpCouplings.end(); ++coup) {
-        // Add dark matter to the table
-        PDGLibrary::Instance()->ReloadDBase();
-        PDGLibrary::Instance()->AddDarkMatter(*mass,*ratio);
-        if (*coup > 0.) {
-            Registry * r = AlgConfigPool::Instance()->CommonList("Param", "BoostedDarkMatter");
-            r->UnLock();
-            r->Set("ZpCoupling", *coup);
-            r->Lock();
-        }
 
+      // (mass, ratio) points handled by this job
+      if ( (ipoint++) % gOptNGridJobs != gOptGridJob ) continue;
 
-        // throw on NaNs and Infs...
-#if defined(HAVE_FENV_H) && defined(HAVE_FEENABLEEXCEPT)
-        feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
-#endif
+      LOG("gmkspl_dm", pNOTICE)
+        << "*** DM mass = " << *mass << ", mediator mass ratio = " << *ratio;
 
-        // Init
-        utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-        utils::app_init::RandGen(gOptRanSeed);
-        utils::app_init::XSecTable(gOptInpXSecFile, false);
+      // The splines are only computed for the first coupling: The cross
+      // sections of the others follow from the g^4 scaling
+      SetDarkMatterPoint(*mass, *ratio, gOptZpCouplings[0]);
+      double gzp0 = utils::dm::ZpCoupling();
 
-        // Get list of neutrinos and nuclear targets
+      xspl->ClearSplines();
+      utils::app_init::XSecTable(gOptInpXSecFile, false);
+      set<string> input_keys;
+      const vector<string> * keys = xspl->GetSplineKeys();
+      if(keys) {
+        input_keys.insert(keys->begin(), keys->end());
+        delete keys;
+      }
 
-        //  PDGCodeList * neutrinos = GetNeutrinoCodes();
-        PDGCodeList * targets   = GetTargetCodes();
+      MakeSplines(*targets);
 
-        if(!targets || targets->size() == 0 ) {
-          LOG("gmkspl_dm", pFATAL) << "Empty target PDG code list";
-          PrintSyntax();
-          exit(3);
+      if(single_point) {
+        xspl->SaveAsXml(gOptOutXSecFile, save_init);
+        if(gOptMaxXSecFile.size() > 0) TabulateMaxXSec(*targets);
+        continue;
+      }
+
+      // Keep the splines computed at the first coupling
+      map<string, Spline *> splines;
+      keys = xspl->GetSplineKeys();
+      if(keys) {
+        for(unsigned int i = 0; i < keys->size(); i++) {
+          const string & key = (*keys)[i];
+          if(input_keys.count(key) == 1) continue;
+          splines[key] = new Spline(*xspl->GetSpline(key));
         }
+        delete keys;
+      }
 
-        LOG("gmkspl_dm", pINFO) << "Targets: "   << *targets;
-
-        // Loop over all possible input init states and ask the GEVGDriver
-        // to build splines for all the interactions that its loaded list
-        // of event generators can generate.
-
-        //  PDGCodeList::const_iterator nuiter;
-        PDGCodeList::const_iterator tgtiter;
-        //  for(nuiter = neutrinos->begin(); nuiter != neutrinos->end(); ++nuiter) {
-        for(tgtiter = targets->begin(); tgtiter != targets->end(); ++tgtiter) {
-          int dmpdgc  = kPdgDarkMatter;
-          int tgtpdgc = *tgtiter;
-          InitialState init_state(tgtpdgc, dmpdgc);
-          GEVGDriver driver;
-          driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
-          driver.Configure(init_state);
-          driver.CreateSplines(gOptNKnots, gOptMaxE);
+      for (unsigned int ig = 0; ig < gOptZpCouplings.size(); ig++) {
+        if(ig > 0) SetDarkMatterPoint(*mass, *ratio, gOptZpCouplings[ig]);
+        double gzp = utils::dm::ZpCoupling();
+        double scale = TMath::Power(gzp/gzp0, 4);
+        map<string, Spline *>::iterator it = splines.begin();
+        for( ; it != splines.end(); ++it) {
+          Spline spline(*(it->second));
+          spline.Multiply(scale);
+          xspl->AddSpline(it->first, spline);
         }
-        delete targets;
+        xspl->SaveAsXml(
+          utils::dm::SplineFamilyFile(family_stem, *mass, *ratio, gzp), save_init);
+
+        // The max xsec is tabulated for each coupling, as it is cached
+        // under the DM model parameters
+        if(gOptMaxXSecFile.size() > 0) TabulateMaxXSec(*targets);
       }
+
+      map<string, Spline *>::iterator it = splines.begin();
+      for( ; it != splines.end(); ++it) delete it->second;
     }
   }
-  //  }
+  delete targets;
+
+  if(gOptMaxXSecFile.size() > 0) {
+    Cache::Instance()->Sync();
+  }
+
+  return 0;
+}
+//____________________________________________________________________________
+void SetDarkMatterPoint(double mass, double ratio, double gzp)
+{
+// Add the dark matter and mediator to the particle table, set the Z'
+// coupling (if > 0; otherwise the configured one is used), and reconfigure
+// the algorithms, as they look up the masses and coupling at configuration
+
+  PDGLibrary::Instance()->ReloadDBase();
+  PDGLibrary::Instance()->AddDarkMatter(mass,ratio);
+  if (gzp > 0.) {
+    Registry * r = AlgConfigPool::Instance()->CommonList("Param", "BoostedDarkMatter");
+    r->UnLock();
+    r->Set("ZpCoupling", gzp);
+    r->Lock();
+  }
+  AlgFactory::Instance()->ForceReconfiguration();
+}
+//____________________________________________________________________________
+void MakeSplines(const PDGCodeList & targets)
+{
+// Loop over all possible input init states and ask the GEVGDriver
+// to build splines for all the interactions that its loaded list
+// of event generators can generate.
+
+  PDGCodeList::const_iterator tgtiter;
+  for(tgtiter = targets.begin(); tgtiter != targets.end(); ++tgtiter) {
+    int dmpdgc  = kPdgDarkMatter;
+    int tgtpdgc = *tgtiter;
+    InitialState init_state(tgtpdgc, dmpdgc);
+    GEVGDriver driver;
+    driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    driver.Configure(init_state);
+    driver.CreateSplines(gOptNKnots, gOptMaxE);
+  }
+}
+//____________________________________________________________________________
+void TabulateMaxXSec(const PDGCodeList & targets)
+{
+// For every interaction with a spline, ask the kinematics generators of the
+// corresponding event generator to compute max{dxsec/dK} at the spline knots
+// and store it in the cache (see gmkspl)
 
-  // Save the splines at the requested XML file
   XSecSplineList * xspl = XSecSplineList::Instance();
-  bool save_init = !gOptNoCopy;
-  xspl->SaveAsXml(gOptOutXSecFile, save_init);
 
+  for(unsigned int itgt = 0; itgt < targets.size(); itgt++) {
 
-  return 0;
+    InitialState init_state(targets[itgt], kPdgDarkMatter);
+    GEVGDriver driver;
+    driver.SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+    driver.Configure(init_state);
+
+    const EventGeneratorList * evglist = driver.EventGenerators();
+    EventGeneratorList::const_iterator evgliter = evglist->begin();
+    for( ; evgliter != evglist->end(); ++evgliter) {
+      const EventGenerator * evgen =
+                     dynamic_cast<const EventGenerator *> (*evgliter);
+      if(!evgen) continue;
+
+      InteractionList * ilst =
+           evgen->IntListGenerator()->CreateInteractionList(init_state);
+      if(!ilst) continue;
+
+      // kinematics generators may query the running thread
+      RunningThreadInfo::Instance()->UpdateRunningThread(evgen);
+
+      const XSecAlgorithmI * alg = evgen->CrossSectionAlg();
+      const vector<const EventRecordVisitorI *> & modules = evgen->Modules();
+
+      InteractionList::const_iterator intliter = ilst->begin();
+      for( ; intliter != ilst->end(); ++intliter) {
+        const Interaction * interaction = *intliter;
+        if(!xspl->SplineExists(alg, interaction)) continue;
+        const Spline * spl = xspl->GetSpline(alg, interaction);
+
+        vector<double> energies(spl->NKnots());
+        for(int i = 0; i < spl->NKnots(); i++) {
+          energies[i] = spl->GetKnotX(i);
+        }
+        for(unsigned int im = 0; im < modules.size(); im++) {
+          const KineGeneratorWithCache * kinegen =
+             dynamic_cast<const KineGeneratorWithCache *> (modules[im]);
+          if(!kinegen) continue;
+          kinegen->TabulateMaxXSec(alg, interaction, energies);
+        }
+      }
+      delete ilst;
+    }
+  }
 }
 //____________________________________________________________________________
 void GetCommandLineArgs(int argc, char ** argv)
@@ -398,6 +571,28 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptRanSeed = -1;
   }
 
+  // split the (mass, ratio) grid among jobs
+  if( parser.OptionExists("grid-job") ) {
+    LOG("gmkspl_dm", pINFO) << "Reading grid job index and number of jobs";
+    vector<string> job = utils::str::Split(parser.ArgAsString("grid-job"), ",");
+    if(job.size() != 2 || atoi(job[1].c_str()) < 1 ||
+       atoi(job[0].c_str()) < 0 || atoi(job[0].c_str()) >= atoi(job[1].c_str())) {
+      LOG("gmkspl_dm", pFATAL)
+         << "Invalid grid job: " << parser.ArgAsString("grid-job")
+         << " (expected: job_index,njobs with 0 <= job_index < njobs)";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptGridJob   = atoi(job[0].c_str());
+    gOptNGridJobs = atoi(job[1].c_str());
+  }
+
+  // max{dxsec/dK} cache file
+  if( parser.OptionExists("max-xsec-cache") ) {
+    LOG("gmkspl_dm", pINFO) << "Reading max xsec cache file name";
+    gOptMaxXSecFile = parser.ArgAsString("max-xsec-cache");
+  }
+
   // input cross-section file
   if( parser.OptionExists("input-cross-sections") ) {
     LOG("gmkspl_dm", pINFO) << "Reading cross-section file";
@@ -417,6 +612,8 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n Input ROOT geometry : " << gOptGeomFilename
      << "\n Output cross-section file : " << gOptOutXSecFile
      << "\n Input cross-section file : " << gOptInpXSecFile
+     << "\n Max xsec cache file : " << gOptMaxXSecFile
+     << "\n Grid job : " << gOptGridJob << " of " << gOptNGridJobs
      << "\n Random number seed : " << gOptRanSeed
      << "\n";
 
@@ -446,6 +643,8 @@ void PrintSyntax(void)
     << " [-g zp_couplings] "
     << " [-z med_ratios] "
     << " [-n nknots] [-e max_energy] "
+    << " [--grid-job job_index,njobs]"
+    << " [--max-xsec-cache cache_file]"
     << " [--seed seed_number]"
     << " [--input-cross-section xml_file]"
     << " [--event-generator-list list_name]"
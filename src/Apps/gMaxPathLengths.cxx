@@ -20,6 +20,7 @@
          Syntax :
            gmxpl -f geom_file [-L length_units] [-D density_units] 
                  [-t top_vol_name] [-o output_xml_file] [-n np] [-r nr]
+                 [-a nr_refine[,tolerance]]
                  [-seed random_number_seed]
                  [--message-thresholds xml_file]
 
@@ -36,6 +37,12 @@
                Number of  scanning points / surface [ default: see geom driver's defaults ]
            -r  
                Number of scanning rays / point [ default: see geom driver's defaults ]
+           -a  
+               Refine the max path lengths found by the scan, by shooting
+               the given number of rays / material / iteration around the
+               rays giving the current max path lengths, until no max path
+               length grows by more than the (optional) relative tolerance 
+               [ default: no refinement; tolerance: see geom driver's defaults ]
            -o  
                Name of output XML file [ default: maxpl.xml ]
            --seed 
@@ -70,7 +77,9 @@
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
 #include <string>
+#include <vector>
 
 #include <TMath.h>
 
@@ -81,10 +90,12 @@
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/UnitUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/RunOpt.h"
 
 using std::string;
+using std::vector;
 
 using namespace genie;
 using namespace genie::geometry;
@@ -106,6 +117,8 @@ double    gOptGeomLUnits      = 0;           // input geometry length units
 double    gOptGeomDUnits      = 0;           // input geometry density units
 int       gOptNPoints         = -1;          // input number of points / surf
 int       gOptNRays           = -1;          // input number of rays / point
+int       gOptNRefineRays     = -1;          // input number of refinement rays
+double    gOptRefineTol       = -1;          // input refinement tolerance
 long int  gOptRanSeed         = -1;          // random number seed
 
 //____________________________________________________________________________
@@ -131,6 +144,8 @@ int main(int argc, char ** argv)
 
   if(gOptNPoints > 0) geom->SetScannerNPoints(gOptNPoints);
   if(gOptNRays   > 0) geom->SetScannerNRays  (gOptNRays);
+  if(gOptNRefineRays > 0) geom->SetScannerNRefineRays (gOptNRefineRays);
+  if(gOptRefineTol   > 0) geom->SetScannerRefineTol   (gOptRefineTol);
 
   // Compute the maximum path lengths
   LOG("gmxpl", pINFO)
@@ -218,6 +233,19 @@ void GetCommandLineArgs(int argc, char ** argv)
       << "Unspecified number of rays - Using driver's default";
   } //-r
 
+  // number of refinement rays / material / iteration & tolerance
+  if( parser.OptionExists('a') ) {
+    LOG("gmxpl", pDEBUG) 
+       << "Reading input max path length refinement options";
+    vector<string> refopt = 
+        utils::str::Split(parser.ArgAsString('a'), ",");
+    gOptNRefineRays = atoi(refopt[0].c_str());
+    if(refopt.size() > 1) gOptRefineTol = atof(refopt[1].c_str());
+  } else {
+    LOG("gmxpl", pDEBUG)
+      << "No max path length refinement";
+  } //-a
+
   // input geometry file
   if( parser.OptionExists('f') ) {
     LOG("gmxpl", pDEBUG) 
@@ -250,6 +278,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gmxpl", pNOTICE) << "Geometry density units  : " << gOptGeomDUnits;
   LOG("gmxpl", pNOTICE) << "Scanner points/surface  : " << gOptNPoints;
   LOG("gmxpl", pNOTICE) << "Scanner rays/point      : " << gOptNRays;
+  LOG("gmxpl", pNOTICE) << "Refinement rays         : " << gOptNRefineRays;
+  LOG("gmxpl", pNOTICE) << "Refinement tolerance    : " << gOptRefineTol;
   LOG("gmxpl", pNOTICE) << "Random number seed      : " << gOptRanSeed;
 
   LOG("gmxpl", pNOTICE) << "\n";
@@ -266,6 +296,7 @@ void PrintSyntax(void)
       << " [-D density_units]" 
       << " [-t top_volume_name]"
       << " [-o output_xml_file]"
+      << " [-n np] [-r nr] [-a nr_refine[,tolerance]]"
       << " [-seed random_number_seed]"
       << " [--message-thresholds xml_file]\n";
 
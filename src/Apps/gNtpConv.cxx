@@ -8,6 +8,7 @@
 
          Syntax:
            gntpc -i input_file [-o output_file] -f format [-n nev] [-v vrs] [-c] 
+                 [-j nworkers]
                  [--seed random_number_seed]
                  [--message-thresholds xml_file]
                  [--event-record-print-level level]
@@ -25,6 +26,13 @@
               (optional, default: use latest version of each format)
            -c 
               Copy MC job metadata (gconfig and genv TFolders) from the input GHEP file.
+           -j 
+              Number of worker processes. Each worker converts a contiguous
+              range of entries into a temporary file, and the outputs are
+              then merged in order. The output is identical to that of a
+              sequential conversion. Supported for the gst, rootracker
+              (all variants) and ginuke formats only.
+              (optional, default: 1)
            -f 
               A string that specifies the output file format. 
               >>
@@ -125,12 +133,16 @@
 #include <vector>
 #include <algorithm>
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
 
 #include <TSystem.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TChain.h>
 #include <TFolder.h>
 #include <TBits.h>
 #include <TObjString.h>
@@ -145,6 +157,7 @@
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/GHEP/GHepUtils.h"
 #include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/Ntuple/NtpGSTTree.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpWriter.h"
@@ -188,6 +201,8 @@ void   ConvertToGTracker         (void);
 void   ConvertToGRooTracker      (void);
 void   ConvertToGHad             (void);
 void   ConvertToGINuke           (void);
+void   Convert                   (void);
+bool   ConvertInWorkers          (void);
 void   GetCommandLineArgs        (int argc, char ** argv);
 void   PrintSyntax               (void);
 string DefaultOutputFile         (void);
@@ -218,6 +233,11 @@ int        gOptVersion;             ///< output file format version
 Long64_t   gOptN;                   ///< number of events to process
 bool       gOptCopyJobMeta = false; ///< copy MC job metadata (gconfig, genv TFolders)
 long int   gOptRanSeed;             ///< random number seed
+int        gOptNWorkers = 1;        ///< number of worker processes
+
+//range of input entries to convert (set for worker processes)
+Long64_t gFirstEntry =  0;
+Long64_t gLastEntry  = -1; ///< one past the last entry (-1: up to nev)
 
 //genie version used to generate the input event file 
 int gFileMajorVrs = -1;
@@ -237,7 +257,19 @@ int main(int argc, char ** argv)
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
   PDGLibrary::Instance()->AddDarkMatter( 1.0, 0.5 ) ;
-  
+
+  // Convert entry ranges in worker processes, if requested and supported
+  if(gOptNWorkers > 1) {
+    if(ConvertInWorkers()) return 0;
+  }
+
+  Convert();
+
+  return 0;
+}
+//____________________________________________________________________________________
+void Convert(void)
+{
   // Call the appropriate conversion function
   switch(gOptOutFileFormat) {
 
@@ -287,221 +319,140 @@ int main(int argc, char ** argv)
      gAbortingInErr = true;
      exit(3);
   }
-  return 0;
+}
+//____________________________________________________________________________________
+bool ConvertInWorkers(void)
+{
+// Splits the input entries in gOptNWorkers contiguous ranges, converted by
+// forked worker processes (each with its own input file reader and output
+// tree) into temporary files. The worker outputs are then merged in order.
+// Returns false, for a sequential conversion, if the output format is not
+// supported.
+
+  string tree_name = "";
+  switch(gOptOutFileFormat) {
+   case (kConvFmt_gst)                  : tree_name = "gst";         break;
+   case (kConvFmt_rootracker          ) :
+   case (kConvFmt_rootracker_mock_data) :
+   case (kConvFmt_t2k_rootracker      ) :
+   case (kConvFmt_numi_rootracker     ) : tree_name = "gRooTracker"; break;
+   case (kConvFmt_ginuke)               : tree_name = "ginuke";      break;
+   default:
+     LOG("gntpc", pWARN)
+       << "No parallel conversion for the requested format - "
+       << "Converting sequentially";
+     return false;
+  }
+
+  // figure out how many events to convert
+  Long64_t nev    = 0;
+  double   weight = 1.;
+  {
+    TFile fin(gOptInpFileName.c_str(),"READ");
+    TTree * gtree = dynamic_cast <TTree *> ( fin.Get("gtree") );
+    if (!gtree) {
+      LOG("gntpc", pERROR) << "Null input GHEP event tree";
+      return false;
+    }
+    nev = (gOptN<0) ?
+       gtree->GetEntries() : TMath::Min( gtree->GetEntries(), gOptN );
+    weight = gtree->GetWeight();
+    fin.Close();
+  }
+  int nworkers = (int) TMath::Min( (Long64_t) gOptNWorkers, nev );
+  if (nworkers < 2) return false;
+
+  LOG("gntpc", pNOTICE)
+    << "*** Converting " << nev << " events in " << nworkers << " worker processes";
+
+  string outfile = gOptOutFileName;
+
+  vector<string> parts;
+  vector<pid_t>  pids;
+  for(int iw = 0; iw < nworkers; iw++) {
+    ostringstream part;
+    part << outfile << ".part" << iw;
+    parts.push_back(part.str());
+
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("gntpc", pFATAL) << "Couldn't fork conversion worker " << iw;
+      gAbortingInErr = true;
+      exit(4);
+    }
+    if(pid == 0) {
+      gFirstEntry     = (iw*nev)/nworkers;
+      gLastEntry      = ((iw+1)*nev)/nworkers;
+      gOptOutFileName = parts[iw];
+      gOptCopyJobMeta = false;
+      Convert();
+      _exit(0);
+    }
+    pids.push_back(pid);
+  }
+
+  bool ok = true;
+  for(int iw = 0; iw < nworkers; iw++) {
+    int status = 0;
+    waitpid(pids[iw], &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("gntpc", pERROR) << "Conversion worker " << iw << " failed";
+      ok = false;
+    }
+  }
+  if(!ok) {
+    for(int iw = 0; iw < nworkers; iw++) gSystem->Unlink(parts[iw].c_str());
+    LOG("gntpc", pFATAL) << "Parallel conversion failed";
+    gAbortingInErr = true;
+    exit(4);
+  }
+
+  // merge the worker outputs, in entry order
+  LOG("gntpc", pNOTICE) << "*** Merging the worker outputs into: " << outfile;
+
+  TChain chain(tree_name.c_str());
+  for(int iw = 0; iw < nworkers; iw++) chain.Add(parts[iw].c_str());
+
+  TFile fout(outfile.c_str(),"recreate");
+  TTree * tree = chain.CloneTree(-1,"fast");
+  if(tree_name == "gRooTracker") {
+    // POT normalization of the generated sample
+    tree->SetWeight(weight);
+  }
+
+  // Copy MC job metadata (gconfig and genv TFolders)
+  if(gOptCopyJobMeta) {
+    TFile fin(gOptInpFileName.c_str(),"READ");
+    TFolder * genv    = (TFolder*) fin.Get("genv");
+    TFolder * gconfig = (TFolder*) fin.Get("gconfig");
+    fout.cd();
+    genv    -> Write("genv");
+    gconfig -> Write("gconfig");
+    fin.Close();
+  }
+
+  fout.Write();
+  fout.Close();
+
+  for(int iw = 0; iw < nworkers; iw++) gSystem->Unlink(parts[iw].c_str());
+
+  LOG("gntpc", pINFO) << "\nDone converting GENIE's GHEP ntuple";
+
+  return true;
 }
 //____________________________________________________________________________________
 // GENIE GHEP EVENT TREE FORMAT -> GENIE SUMMARY NTUPLE 
 //____________________________________________________________________________________
 void ConvertToGST(void)
 {
-  // Some constants
-  const double e_h = 1.3; // typical e/h ratio used for computing mean `calorimetric response'
-
-  // Define branch variables
-  //
-  int    brIev         = 0;      // Event number 
-  int    brNeutrino    = 0;      // Neutrino pdg code
-  int    brFSPrimLept  = 0;      // Final state primary lepton pdg code
-  int    brTarget      = 0;      // Nuclear target pdg code (10LZZZAAAI)
-  int    brTargetZ     = 0;      // Nuclear target Z (extracted from pdg code above)
-  int    brTargetA     = 0;      // Nuclear target A (extracted from pdg code above)
-  int    brHitNuc      = 0;      // Hit nucleon pdg code      (not set for COH,IMD and NuEL events)
-  int    brHitQrk      = 0;      // Hit quark pdg code        (set for DIS events only)
-  bool   brFromSea     = false;  // Hit quark is from sea     (set for DIS events only)
-  int    brResId       = 0;      // Produced baryon resonance (set for resonance events only)
-  bool   brIsQel       = false;  // Is QEL?
-  bool   brIsRes       = false;  // Is RES?
-  bool   brIsDis       = false;  // Is DIS?
-  bool   brIsCoh       = false;  // Is Coherent?
-  bool   brIsMec       = false;  // Is MEC?
-  bool   brIsDfr       = false;  // Is Diffractive?
-  bool   brIsImd       = false;  // Is IMD?
-  bool   brIsSingleK   = false;  // Is single kaon?  
-  bool   brIsImdAnh    = false;  // Is IMD annihilation?
-  bool   brIsNuEL      = false;  // Is ve elastic?
-  bool   brIsEM        = false;  // Is EM process?
-  bool   brIsCC        = false;  // Is Weak CC process?
-  bool   brIsNC        = false;  // Is Weak NC process?
-  bool   brIsCharmPro  = false;  // Produces charm?
-  bool   brIsAMNuGamma = false;  // is anomaly mediated nu gamma
-  int    brCodeNeut    = 0;      // The equivalent NEUT reaction code (if any)
-  int    brCodeNuance  = 0;      // The equivalent NUANCE reaction code (if any)
-  double brWeight      = 0;      // Event weight
-  double brKineXs      = 0;      // Bjorken x as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineYs      = 0;      // Inelasticity y as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineTs      = 0;      // Energy transfer to nucleus at COH events as was generated during kinematical selection
-  double brKineQ2s     = 0;      // Momentum transfer Q^2 as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineWs      = 0;      // Hadronic invariant mass W as was generated during kinematical selection; takes fermi momentum / off-shellness into account
-  double brKineX       = 0;      // Experimental-like Bjorken x; neglects fermi momentum / off-shellness 
-  double brKineY       = 0;      // Experimental-like inelasticity y; neglects fermi momentum / off-shellness 
-  double brKineT       = 0;      // Experimental-like energy transfer to nucleus at COH events 
-  double brKineQ2      = 0;      // Experimental-like momentum transfer Q^2; neglects fermi momentum / off-shellness
-  double brKineW       = 0;      // Experimental-like hadronic invariant mass W; neglects fermi momentum / off-shellness 
-  double brEvRF        = 0;      // Neutrino energy @ the rest-frame of the hit-object (eg nucleon for CCQE, e- for ve- elastic,...)
-  double brEv          = 0;      // Neutrino energy @ LAB
-  double brPxv         = 0;      // Neutrino px @ LAB
-  double brPyv         = 0;      // Neutrino py @ LAB
-  double brPzv         = 0;      // Neutrino pz @ LAB
-  double brEn          = 0;      // Initial state hit nucleon energy @ LAB
-  double brPxn         = 0;      // Initial state hit nucleon px @ LAB
-  double brPyn         = 0;      // Initial state hit nucleon py @ LAB
-  double brPzn         = 0;      // Initial state hit nucleon pz @ LAB
-  double brEl          = 0;      // Final state primary lepton energy @ LAB
-  double brPxl         = 0;      // Final state primary lepton px @ LAB
-  double brPyl         = 0;      // Final state primary lepton py @ LAB
-  double brPzl         = 0;      // Final state primary lepton pz @ LAB
-  double brPl          = 0;      // Final state primary lepton p  @ LAB
-  double brCosthl      = 0;      // Final state primary lepton cos(theta) wrt to neutrino direction
-  int    brNfP         = 0;      // Nu. of final state p's + \bar{p}'s (after intranuclear rescattering)
-  int    brNfN         = 0;      // Nu. of final state n's + \bar{n}'s
-  int    brNfPip       = 0;      // Nu. of final state pi+'s
-  int    brNfPim       = 0;      // Nu. of final state pi-'s
-  int    brNfPi0       = 0;      // Nu. of final state pi0's (
-  int    brNfKp        = 0;      // Nu. of final state K+'s
-  int    brNfKm        = 0;      // Nu. of final state K-'s
-  int    brNfK0        = 0;      // Nu. of final state K0's + \bar{K0}'s
-  int    brNfEM        = 0;      // Nu. of final state gammas and e-/e+ 
-  int    brNfOther     = 0;      // Nu. of heavier final state hadrons (D+/-,D0,Ds+/-,Lamda,Sigma,Lamda_c,Sigma_c,...)
-  int    brNiP         = 0;      // Nu. of `primary' (: before intranuclear rescattering) p's + \bar{p}'s  
-  int    brNiN         = 0;      // Nu. of `primary' n's + \bar{n}'s  
-  int    brNiPip       = 0;      // Nu. of `primary' pi+'s 
-  int    brNiPim       = 0;      // Nu. of `primary' pi-'s 
-  int    brNiPi0       = 0;      // Nu. of `primary' pi0's 
-  int    brNiKp        = 0;      // Nu. of `primary' K+'s  
-  int    brNiKm        = 0;      // Nu. of `primary' K-'s  
-  int    brNiK0        = 0;      // Nu. of `primary' K0's + \bar{K0}'s 
-  int    brNiEM        = 0;      // Nu. of `primary' gammas and e-/e+ 
-  int    brNiOther     = 0;      // Nu. of other `primary' hadron shower particles
-  int    brNf          = 0;      // Nu. of final state particles in hadronic system
-  int    brPdgf  [kNPmax];       // Pdg code of k^th final state particle in hadronic system
-  double brEf    [kNPmax];       // Energy     of k^th final state particle in hadronic system @ LAB
-  double brPxf   [kNPmax];       // Px         of k^th final state particle in hadronic system @ LAB
-  double brPyf   [kNPmax];       // Py         of k^th final state particle in hadronic system @ LAB
-  double brPzf   [kNPmax];       // Pz         of k^th final state particle in hadronic system @ LAB
-  double brPf    [kNPmax];       // P          of k^th final state particle in hadronic system @ LAB
-  double brCosthf[kNPmax];       // cos(theta) of k^th final state particle in hadronic system @ LAB wrt to neutrino direction
-  int    brNi          = 0;      // Nu. of particles in 'primary' hadronic system (before intranuclear rescattering)
-  int    brPdgi[kNPmax];         // Pdg code of k^th particle in 'primary' hadronic system 
-  int    brResc[kNPmax];         // FSI code of k^th particle in 'primary' hadronic system 
-  double brEi  [kNPmax];         // Energy   of k^th particle in 'primary' hadronic system @ LAB
-  double brPxi [kNPmax];         // Px       of k^th particle in 'primary' hadronic system @ LAB
-  double brPyi [kNPmax];         // Py       of k^th particle in 'primary' hadronic system @ LAB
-  double brPzi [kNPmax];         // Pz       of k^th particle in 'primary' hadronic system @ LAB
-  double brVtxX;                 // Vertex x in detector coord system (SI)
-  double brVtxY;                 // Vertex y in detector coord system (SI)
-  double brVtxZ;                 // Vertex z in detector coord system (SI)
-  double brVtxT;                 // Vertex t in detector coord system (SI)
-  double brSumKEf;               // Sum of kinetic energies of all final state particles
-  double brCalResp0;             // Approximate calorimetric response to the hadronic system computed as sum of
-				 //  - (kinetic energy) for pi+, pi-, p, n 
-                                 //  - (energy + 2*mass) for antiproton, antineutron
-                                 //  - ((e/h) * energy)   for pi0, gamma, e-, e+, where e/h is set to 1.3
-                                 //  - (kinetic energy) for other particles
-
   // Open output file & create output summary tree & create the tree branches
   //
   LOG("gntpc", pNOTICE) 
        << "*** Saving summary tree to: " << gOptOutFileName;
   TFile fout(gOptOutFileName.c_str(),"recreate");
 
-  TTree * s_tree = new TTree("gst","GENIE Summary Event Tree");
-
-  // Create tree branches
-  //
-  s_tree->Branch("iev",           &brIev,           "iev/I"         );
-  s_tree->Branch("neu",	          &brNeutrino,      "neu/I"	    );
-  s_tree->Branch("fspl",	      &brFSPrimLept,    "fspl/I"	    );
-  s_tree->Branch("tgt",           &brTarget,        "tgt/I"	    );
-  s_tree->Branch("Z",             &brTargetZ,       "Z/I"	    );
-  s_tree->Branch("A",             &brTargetA,       "A/I"	    );
-  s_tree->Branch("hitnuc",        &brHitNuc,        "hitnuc/I"      );
-  s_tree->Branch("hitqrk",        &brHitQrk,        "hitqrk/I"      );
-  s_tree->Branch("resid",         &brResId,	    "resid/I"	    );
-  s_tree->Branch("sea",	          &brFromSea,       "sea/O"	    );
-  s_tree->Branch("qel",	          &brIsQel,	    "qel/O"	    );
-  s_tree->Branch("mec",	          &brIsMec,	    "mec/O"	    );
-  s_tree->Branch("res",	          &brIsRes,	    "res/O"	    );
-  s_tree->Branch("dis",	          &brIsDis,	    "dis/O"	    );
-  s_tree->Branch("coh",           &brIsCoh,         "coh/O"	    );
-  s_tree->Branch("dfr",           &brIsDfr,         "dfr/O"	    );
-  s_tree->Branch("imd",	          &brIsImd,	    "imd/O"	    );
-  s_tree->Branch("imdanh",        &brIsImdAnh,	    "imdanh/O"	    );
-  s_tree->Branch("singlek",       &brIsSingleK,     "singlek/O"     );  
-  s_tree->Branch("nuel",          &brIsNuEL,        "nuel/O"	    );
-  s_tree->Branch("em",	          &brIsEM,	    "em/O"	    );
-  s_tree->Branch("cc",	          &brIsCC,	    "cc/O"	    );
-  s_tree->Branch("nc",	          &brIsNC,	    "nc/O"	    );
-  s_tree->Branch("charm",         &brIsCharmPro,    "charm/O"	    );
-  s_tree->Branch("amnugamma",     &brIsAMNuGamma,    "amnugamma/O"	    );
-  s_tree->Branch("neut_code",     &brCodeNeut,      "neut_code/I"   );
-  s_tree->Branch("nuance_code",   &brCodeNuance,    "nuance_code/I" );
-  s_tree->Branch("wght",          &brWeight,        "wght/D"	    );
-  s_tree->Branch("xs",	          &brKineXs,        "xs/D"	    );
-  s_tree->Branch("ys",	          &brKineYs,        "ys/D"	    );
-  s_tree->Branch("ts",	          &brKineTs,        "ts/D"	    );
-  s_tree->Branch("Q2s",	          &brKineQ2s,       "Q2s/D"	    );
-  s_tree->Branch("Ws",	          &brKineWs,        "Ws/D"	    );
-  s_tree->Branch("x",	          &brKineX,	    "x/D"	    );
-  s_tree->Branch("y",	          &brKineY,	    "y/D"	    );
-  s_tree->Branch("t",	          &brKineT,	    "t/D"	    );
-  s_tree->Branch("Q2",	          &brKineQ2,        "Q2/D"	    );
-  s_tree->Branch("W",	          &brKineW,	    "W/D"	    );
-  s_tree->Branch("EvRF",	      &brEvRF,	    "EvRF/D"	    );
-  s_tree->Branch("Ev",	          &brEv,	    "Ev/D"	    );
-  s_tree->Branch("pxv",	          &brPxv,	    "pxv/D"	    );
-  s_tree->Branch("pyv",	          &brPyv,	    "pyv/D"	    );
-  s_tree->Branch("pzv",	          &brPzv,	    "pzv/D"	    );
-  s_tree->Branch("En",	          &brEn,	    "En/D"	    );
-  s_tree->Branch("pxn",	          &brPxn,	    "pxn/D"	    );
-  s_tree->Branch("pyn",	          &brPyn,	    "pyn/D"	    );
-  s_tree->Branch("pzn",	          &brPzn,	    "pzn/D"	    );
-  s_tree->Branch("El",	          &brEl,	    "El/D"	    );
-  s_tree->Branch("pxl",	          &brPxl,	    "pxl/D"	    );
-  s_tree->Branch("pyl",	          &brPyl,	    "pyl/D"	    );
-  s_tree->Branch("pzl",	          &brPzl,	    "pzl/D"	    );
-  s_tree->Branch("pl",            &brPl,            "pl/D"          );
-  s_tree->Branch("cthl",          &brCosthl,        "cthl/D"        );
-  s_tree->Branch("nfp",	          &brNfP,	    "nfp/I"	    );
-  s_tree->Branch("nfn",	          &brNfN,	    "nfn/I"	    );
-  s_tree->Branch("nfpip",         &brNfPip,	    "nfpip/I"	    );
-  s_tree->Branch("nfpim",         &brNfPim,	    "nfpim/I"	    );
-  s_tree->Branch("nfpi0",         &brNfPi0,	    "nfpi0/I"	    );
-  s_tree->Branch("nfkp",          &brNfKp,	    "nfkp/I"	    );
-  s_tree->Branch("nfkm",          &brNfKm,	    "nfkm/I"	    );
-  s_tree->Branch("nfk0",          &brNfK0,	    "nfk0/I"	    );
-  s_tree->Branch("nfem",          &brNfEM,	    "nfem/I"	    );
-  s_tree->Branch("nfother",       &brNfOther,       "nfother/I"     );
-  s_tree->Branch("nip",	          &brNiP,	    "nip/I"	    );
-  s_tree->Branch("nin",	          &brNiN,	    "nin/I"	    );
-  s_tree->Branch("nipip",         &brNiPip,	    "nipip/I"	    );
-  s_tree->Branch("nipim",         &brNiPim,	    "nipim/I"	    );
-  s_tree->Branch("nipi0",         &brNiPi0,	    "nipi0/I"	    );
-  s_tree->Branch("nikp",          &brNiKp,	    "nikp/I"	    );
-  s_tree->Branch("nikm",          &brNiKm,	    "nikm/I"	    );
-  s_tree->Branch("nik0",          &brNiK0,	    "nik0/I"	    );
-  s_tree->Branch("niem",          &brNiEM,	    "niem/I"	    );
-  s_tree->Branch("niother",       &brNiOther,       "niother/I"     );
-  s_tree->Branch("ni",	         &brNi,	            "ni/I"	    );
-  s_tree->Branch("pdgi",          brPdgi,	    "pdgi[ni]/I"   );
-  s_tree->Branch("resc",          brResc,	    "resc[ni]/I"   );
-  s_tree->Branch("Ei",	          brEi,	            "Ei[ni]/D"      );
-  s_tree->Branch("pxi",	          brPxi,	    "pxi[ni]/D"     );
-  s_tree->Branch("pyi",	          brPyi,	    "pyi[ni]/D"     );
-  s_tree->Branch("pzi",	          brPzi,	    "pzi[ni]/D"     );
-  s_tree->Branch("nf",	         &brNf,	            "nf/I"	    );
-  s_tree->Branch("pdgf",          brPdgf,	    "pdgf[nf]/I"   );
-  s_tree->Branch("Ef",	          brEf,	            "Ef[nf]/D"      );
-  s_tree->Branch("pxf",	          brPxf,	    "pxf[nf]/D"     );
-  s_tree->Branch("pyf",	          brPyf,	    "pyf[nf]/D"     );
-  s_tree->Branch("pzf",	          brPzf,	    "pzf[nf]/D"     );
-  s_tree->Branch("pf",            brPf,             "pf[nf]/D"      );
-  s_tree->Branch("cthf",          brCosthf,         "cthf[nf]/D"    );
-  s_tree->Branch("vtxx",         &brVtxX,	    "vtxx/D"        );
-  s_tree->Branch("vtxy",         &brVtxY,	    "vtxy/D"        );
-  s_tree->Branch("vtxz",         &brVtxZ,	    "vtxz/D"        );
-  s_tree->Branch("vtxt",         &brVtxT,	    "vtxt/D"        );
-  s_tree->Branch("sumKEf",       &brSumKEf,	    "sumKEf/D"      );
-  s_tree->Branch("calresp0",     &brCalResp0,	    "calresp0/D"    );
+  NtpGSTTree gst;
+  gst.CreateTree();
 
   // Open the ROOT file and get the TTree & its header
   TFile fin(gOptInpFileName.c_str(),"READ");
@@ -531,12 +482,13 @@ void ConvertToGST(void)
     return;
   }
 
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+  // restrict to the entry range of this worker process, if any
+  if (gLastEntry >= 0) nmax = TMath::Min(nmax, gLastEntry);
 
-  TLorentzVector pdummy(0,0,0,0);
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gFirstEntry << " events";
 
   // Event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gFirstEntry; iev < nmax; iev++) {
     er_tree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -545,519 +497,9 @@ void ConvertToGST(void)
     LOG("gntpc", pINFO) << rec_header;
     LOG("gntpc", pINFO) << event;
 
-    // Go further only if the event is physical
-    bool is_unphysical = event.IsUnphysical();
-    if(is_unphysical) {
-      LOG("gntpc", pINFO) << "Skipping unphysical event";
-      mcrec->Clear();
-      continue;
-    }
-
-    // Clean-up arrays
-    //
-    for(int j=0; j<kNPmax; j++) {
-       brPdgi   [j] =  0;     
-       brResc   [j] = -1;     
-       brEi     [j] =  0;     
-       brPxi    [j] =  0;     
-       brPyi    [j] =  0;     
-       brPzi    [j] =  0;     
-       brPdgf   [j] =  0;     
-       brEf     [j] =  0;     
-       brPxf    [j] =  0;     
-       brPyf    [j] =  0;     
-       brPzf    [j] =  0;     
-       brPf     [j] =  0;     
-       brCosthf [j] =  0;     
-    }
-
-    // Computing event characteristics
-    //
-
-    //input particles
-    GHepParticle * neutrino = event.Probe();
-    GHepParticle * target = event.Particle(1);
-    assert(target);
-    GHepParticle * fsl = event.FinalStatePrimaryLepton();
-    GHepParticle * hitnucl = event.HitNucleon();
-
-    int tgtZ = 0;
-    int tgtA = 0;
-    if(pdg::IsIon(target->Pdg())) {
-       tgtZ = pdg::IonPdgCodeToZ(target->Pdg());
-       tgtA = pdg::IonPdgCodeToA(target->Pdg());
-    } 
-    if(target->Pdg() == kPdgProton   ) { tgtZ = 1; tgtA = 1; }    
-    if(target->Pdg() == kPdgNeutron  ) { tgtZ = 0; tgtA = 1; }    
-  
-    // Summary info
-    const Interaction * interaction = event.Summary();
-    const InitialState & init_state = interaction->InitState();
-    const ProcessInfo &  proc_info  = interaction->ProcInfo();
-    const Kinematics &   kine       = interaction->Kine();
-    const XclsTag &      xcls       = interaction->ExclTag();
-    const Target &       tgt        = init_state.Tgt();
-
-    // Vertex in detector coord system
-    TLorentzVector * vtx = event.Vertex();
-
-    // Process id
-    bool is_qel    = proc_info.IsQuasiElastic();
-    bool is_res    = proc_info.IsResonant();
-    bool is_dis    = proc_info.IsDeepInelastic();
-    bool is_coh    = proc_info.IsCoherent();
-    bool is_dfr    = proc_info.IsDiffractive();
-    bool is_imd    = proc_info.IsInverseMuDecay();
-    bool is_imdanh = proc_info.IsIMDAnnihilation();
-    bool is_singlek = proc_info.IsSingleKaon();    
-    bool is_nuel      = proc_info.IsNuElectronElastic();
-    bool is_em        = proc_info.IsEM();
-    bool is_weakcc    = proc_info.IsWeakCC();
-    bool is_weaknc    = proc_info.IsWeakNC();
-    bool is_mec       = proc_info.IsMEC();
-    bool is_amnugamma = proc_info.IsAMNuGamma();
-
-    if (!hitnucl && neutrino) {
-        assert(is_coh || is_imd || is_imdanh || is_nuel | is_amnugamma);
-    }
-  
-    // Hit quark - set only for DIS events
-    int  qrk  = (is_dis) ? tgt.HitQrkPdg() : 0;     
-    bool seaq = (is_dis) ? tgt.HitSeaQrk() : false; 
-
-    // Resonance id ($GENIE/src/BaryonResonance/BaryonResonance.h) -
-    // set only for resonance neutrinoproduction
-    int resid = (is_res) ? EResonance(xcls.Resonance()) : -99;
-
-    // (qel or dis) charm production?
-    bool charm = xcls.IsCharmEvent();
-
-    // Get NEUT and NUANCE equivalent reaction codes (if any)
-    brCodeNeut    = utils::ghep::NeutReactionCode(&event);
-    brCodeNuance  = utils::ghep::NuanceReactionCode(&event);
-
-    // Get event weight
-    double weight = event.Weight();
-
-    // Access kinematical params _exactly_ as they were selected internally
-    // (at the hit nucleon rest frame; 
-    // for bound nucleons: taking into account fermi momentum and off-shell kinematics)
-    //
-    bool get_selected = true;
-    double xs  = kine.x (get_selected);
-    double ys  = kine.y (get_selected);
-    double ts  = (is_coh || is_dfr) ? kine.t (get_selected) : -1;
-    double Q2s = kine.Q2(get_selected);
-    double Ws  = kine.W (get_selected);
-
-    LOG("gntpc", pDEBUG) 
-       << "[Select] Q2 = " << Q2s << ", W = " << Ws 
-       << ", x = " << xs << ", y = " << ys << ", t = " << ts;
-
-    // Calculate the same kinematical params but now as an experimentalist would 
-    // measure them by neglecting the fermi momentum and off-shellness of bound nucleons
-    //
-
-    const TLorentzVector & k1 = (neutrino) ? *(neutrino->P4()) : pdummy;  // v 4-p (k1)
-    const TLorentzVector & k2 = (fsl)      ? *(fsl->P4())      : pdummy;  // l 4-p (k2)
-    const TLorentzVector & p1 = (hitnucl)  ? *(hitnucl->P4())  : pdummy;  // N 4-p (p1)      
-
-    double M  = kNucleonMass; 
-    TLorentzVector q  = k1-k2;                     // q=k1-k2, 4-p transfer
-    double Q2 = -1 * q.M2();                       // momemtum transfer
-    
-    double v  = (hitnucl) ? q.Energy()       : -1; // v (E transfer to the nucleus)
-    double x, y, W2, W;
-    if(!is_coh){ 
-    
-       x  = (hitnucl) ? 0.5*Q2/(M*v)     : -1; // Bjorken x
-       y  = (hitnucl) ? v/k1.Energy()    : -1; // Inelasticity, y = q*P1/k1*P1
-
-       W2 = (hitnucl) ? M*M + 2*M*v - Q2 : -1; // Hadronic Invariant mass ^ 2
-       W  = (hitnucl) ? TMath::Sqrt(W2)  : -1; 
-    } else{
-
-       v = q.Energy();
-       x  =  0.5*Q2/(M*v);      // Bjorken x
-       y  = v/k1.Energy();    // Inelasticity, y = q*P1/k1*P1
-
-       W2 = M*M + 2*M*v - Q2;  // Hadronic Invariant mass ^ 2
-       W  = TMath::Sqrt(W2); 
-
-    }
-  
-    double t  = (is_coh || is_dfr) ? kine.t (get_selected) : -1;
-
-    // Get v 4-p at hit nucleon rest-frame
-    TLorentzVector k1_rf = k1;         
-    if(hitnucl) {
-       k1_rf.Boost(-1.*p1.BoostVector());
-    }
-
-//    if(is_mec){
-//      v = q.Energy();
-//      x = 0.5*Q2/(M*v);
-//      y = v/k1.Energy();
-//      W2 = M*M + 2*M*v - Q2;
-//      W = TMath::Sqrt(W2);
-//    }
-
-    LOG("gntpc", pDEBUG) 
-       << "[Calc] Q2 = " << Q2 << ", W = " << W 
-       << ", x = " << x << ", y = " << y << ", t = " << t;
-
-    // Extract more info on the hadronic system
-    // Only for QEL/RES/DIS/COH/MEC events
-    //
-    bool study_hadsyst = (is_qel || is_res || is_dis || is_coh || is_dfr || is_mec || is_singlek);
-    
-    //
-    TObjArrayIter piter(&event);
-    GHepParticle * p = 0;
-    int ip=-1;
-
-    //
-    // Extract the final state system originating from the hadronic vertex 
-    // (after the intranuclear rescattering step)
-    //
-
-    LOG("gntpc", pDEBUG) << "Extracting final state hadronic system";
-
-    vector<int> final_had_syst;
-    while( (p = (GHepParticle *) piter.Next()) && study_hadsyst)
-    {
-      ip++;
-      // don't count final state lepton as part hadronic system 
-      //if(!is_coh && event.Particle(ip)->FirstMother()==0) continue;
-      if(event.Particle(ip)->FirstMother()==0) continue;
-      if(pdg::IsPseudoParticle(p->Pdg())) continue;
-      int pdgc = p->Pdg();
-      int ist  = p->Status();
-      if(ist==kIStStableFinalState) {
-         if (pdgc == kPdgGamma || pdgc == kPdgElectron || pdgc == kPdgPositron)  {
-            int igmom = p->FirstMother();
-            if(igmom!=-1) {
-	      // only count e+'s e-'s or gammas not from decay of pi0
-	      if(event.Particle(igmom)->Pdg() != kPdgPi0) { final_had_syst.push_back(ip); }
-            }
-         } else {
-            final_had_syst.push_back(ip);
-         }
-      }
-      // now add pi0's that were decayed as short lived particles
-      else if(pdgc == kPdgPi0){
-	int ifd = p->FirstDaughter();
-	int fd_pdgc = event.Particle(ifd)->Pdg();
-	// just require that first daughter is one of gamma, e+ or e-  
-	if(fd_pdgc == kPdgGamma || fd_pdgc == kPdgElectron || fd_pdgc == kPdgPositron){
-	  final_had_syst.push_back(ip);
-	}
-      }
-    }//particle-loop
-
-    if( count(final_had_syst.begin(), final_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
-    }
-
-    //
-    // Extract info on the primary hadronic system (before any intranuclear rescattering)
-    // looking for particles with status_code == kIStHadronInTheNucleus 
-    // An exception is the coherent production and scattering off free nucleon targets 
-    // (no intranuclear rescattering) in which case primary hadronic system is set to be 
-    // 'identical' with the final  state hadronic system
-    //
-
-    LOG("gntpc", pDEBUG) << "Extracting primary hadronic system";
-    
-    ip = -1;
-    TObjArrayIter piter_prim(&event);
-
-    vector<int> prim_had_syst;
-    if(study_hadsyst) {
-      // if coherent or free nucleon target set primary states equal to final states
-      
-      if(!pdg::IsIon(target->Pdg()) || (is_coh)) {
-
-	for( vector<int>::const_iterator hiter = final_had_syst.begin();
-	     hiter != final_had_syst.end(); ++hiter) {
-
-	  prim_had_syst.push_back(*hiter);
-	}
-      } 
-      
-      else {
-
-	// otherwise loop over all particles and store indices of those which are hadrons
-	// created within the nucleus
-	/*      else {
-		while( (p = (GHepParticle *) piter_prim.Next()) ){
-		ip++;      
-		int ist_comp  = p->Status();
-		if(ist_comp==kIStHadronInTheNucleus) {
-		prim_had_syst.push_back(ip); 
-		}
-		}//particle-loop   */
-	//
-
-
-	//to find the true particles emitted from the principal vertex,
-	// looping over all Ist=14 particles ok for hA, but doesn't
-	// work for hN.  We must now look specifically for these particles.
-	int ist_store = -10;
-	if(is_res){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStDecayedState) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    //	  LOG("gntpc",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}
-	if(is_dis){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStDISPreFragmHadronicState) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}
-	if(is_qel){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStNucleonTarget) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    //	  LOG("gntpc",pNOTICE) << p->FirstMother()<< "  "<<ist_store;
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}      
-	if(is_mec){
-	  while( (p = (GHepParticle *) piter_prim.Next()) ){
-	    ip++;      
-	    int ist_comp  = p->Status();
-	    if(ist_comp==kIStDecayedState) {
-	      ist_store = ip;    //store this mother
-	      continue;
-	    }
-	    //	  LOG("gntpc",pNOTICE) << "MEC: " << p->FirstMother()<< "  "<<ist_store;
-	    if(p->FirstMother()==ist_store) {
-	      prim_had_syst.push_back(ip);
-	    }
-	  }
-	}
-	
-	
-	// also include gammas from nuclear de-excitations (appearing in the daughter list of the 
-	// hit nucleus, earlier than the primary hadronic system extracted above)
-	for(int i = target->FirstDaughter(); i <= target->LastDaughter(); i++) {
-	  if(i<0) continue;
-	  if(event.Particle(i)->Status()==kIStStableFinalState) { prim_had_syst.push_back(i); }
-	}      
-
-	
-      } // else from ( not ion or coherent ) 
-      
-    }//study_hadsystem?
-    
-    if( count(prim_had_syst.begin(), prim_had_syst.end(), -1) > 0) {
-        mcrec->Clear();
- 	continue;
-    }
-
-    //
-    // Al information has been assembled -- Start filling up the tree branches
-    //
-    brIev        = (int) iev;      
-    brNeutrino   = (neutrino) ? neutrino->Pdg() : 0;      
-    brFSPrimLept = (fsl) ? fsl->Pdg() : 0;
-    brTarget     = target->Pdg(); 
-    brTargetZ    = tgtZ;
-    brTargetA    = tgtA;   
-    brHitNuc     = (hitnucl) ? hitnucl->Pdg() : 0;      
-    brHitQrk     = qrk;     
-    brFromSea    = seaq;  
-    brResId      = resid;
-    brIsQel      = is_qel;
-    brIsRes      = is_res;
-    brIsDis      = is_dis;  
-    brIsCoh      = is_coh;  
-    brIsDfr      = is_dfr;  
-    brIsImd      = is_imd;
-    brIsSingleK  = is_singlek;    
-    brIsNuEL     = is_nuel;  
-    brIsEM       = is_em;  
-    brIsMec      = is_mec;
-    brIsCC       = is_weakcc;  
-    brIsNC       = is_weaknc;  
-    brIsCharmPro = charm;
-    brIsAMNuGamma= is_amnugamma;
-    brWeight     = weight;      
-    brKineXs     = xs;      
-    brKineYs     = ys;      
-    brKineTs     = ts;      
-    brKineQ2s    = Q2s;            
-    brKineWs     = Ws;      
-    brKineX      = x;      
-    brKineY      = y;      
-    brKineT      = t;      
-    brKineQ2     = Q2;      
-    brKineW      = W;      
-    brEvRF       = k1_rf.Energy();      
-    brEv         = k1.Energy();      
-    brPxv        = k1.Px();  
-    brPyv        = k1.Py();  
-    brPzv        = k1.Pz();  
-    brEn         = (hitnucl) ? p1.Energy() : 0;      
-    brPxn        = (hitnucl) ? p1.Px()     : 0;      
-    brPyn        = (hitnucl) ? p1.Py()     : 0;      
-    brPzn        = (hitnucl) ? p1.Pz()     : 0;            
-    brEl         = k2.Energy();      
-    brPxl        = k2.Px();      
-    brPyl        = k2.Py();      
-    brPzl        = k2.Pz();      
-    brPl         = k2.P();
-    brCosthl     = TMath::Cos( k2.Vect().Angle(k1.Vect()) );
-
-    // Primary hadronic system (from primary neutrino interaction, before FSI)
-    brNiP        = 0;
-    brNiN        = 0;    
-    brNiPip      = 0;    
-    brNiPim      = 0;    
-    brNiPi0      = 0;    
-    brNiKp       = 0;  
-    brNiKm       = 0;  
-    brNiK0       = 0;  
-    brNiEM       = 0;  
-    brNiOther    = 0;  
-    brNi = prim_had_syst.size();
-    for(int j=0; j<brNi; j++) {
-      p = event.Particle(prim_had_syst[j]);
-      assert(p);
-      brPdgi[j] = p->Pdg();     
-      brResc[j] = p->RescatterCode();     
-      brEi  [j] = p->Energy();     
-      brPxi [j] = p->Px();     
-      brPyi [j] = p->Py();     
-      brPzi [j] = p->Pz();     
-
-      if      (p->Pdg() == kPdgProton  || p->Pdg() == kPdgAntiProton)   brNiP++;
-      else if (p->Pdg() == kPdgNeutron || p->Pdg() == kPdgAntiNeutron)  brNiN++;
-      else if (p->Pdg() == kPdgPiP) brNiPip++; 
-      else if (p->Pdg() == kPdgPiM) brNiPim++; 
-      else if (p->Pdg() == kPdgPi0) brNiPi0++; 
-      else if (p->Pdg() == kPdgKP)  brNiKp++;  
-      else if (p->Pdg() == kPdgKM)  brNiKm++;  
-      else if (p->Pdg() == kPdgK0    || p->Pdg() == kPdgAntiK0)  brNiK0++; 
-      else if (p->Pdg() == kPdgGamma || p->Pdg() == kPdgElectron || p->Pdg() == kPdgPositron) brNiEM++;
-      else brNiOther++;
-
-      LOG("gntpc", pINFO) 
-        << "Counting in primary hadronic system: idx = " << prim_had_syst[j]
-        << " -> " << p->Name();
-    }
-
-    LOG("gntpc", pINFO) 
-     << "N(p):"             << brNiP
-     << ", N(n):"           << brNiN
-     << ", N(pi+):"         << brNiPip
-     << ", N(pi-):"         << brNiPim
-     << ", N(pi0):"         << brNiPi0
-     << ", N(K+,K-,K0):"    << brNiKp+brNiKm+brNiK0
-     << ", N(gamma,e-,e+):" << brNiEM
-     << ", N(etc):"         << brNiOther << "\n";
-
-    // Final state (visible) hadronic system
-    brNfP        = 0;
-    brNfN        = 0;    
-    brNfPip      = 0;    
-    brNfPim      = 0;    
-    brNfPi0      = 0;    
-    brNfKp       = 0;  
-    brNfKm       = 0;  
-    brNfK0       = 0;  
-    brNfEM       = 0;  
-    brNfOther    = 0;  
-
-    brSumKEf     = (fsl) ? fsl->KinE() : 0;
-    brCalResp0   = 0;
-
-    brNf = final_had_syst.size();
-    for(int j=0; j<brNf; j++) {
-      p = event.Particle(final_had_syst[j]);
-      assert(p);
-
-      int    hpdg = p->Pdg();     
-      double hE   = p->Energy();     
-      double hKE  = p->KinE();     
-      double hpx  = p->Px();     
-      double hpy  = p->Py();     
-      double hpz  = p->Pz();     
-      double hp   = TMath::Sqrt(hpx*hpx + hpy*hpy + hpz*hpz);
-      double hm   = p->Mass();     
-      double hcth = TMath::Cos( p->P4()->Vect().Angle(k1.Vect()) );
-
-      brPdgf  [j] = hpdg;
-      brEf    [j] = hE;
-      brPxf   [j] = hpx;
-      brPyf   [j] = hpy;
-      brPzf   [j] = hpz;
-      brPf    [j] = hp;
-      brCosthf[j] = hcth;
-
-      brSumKEf += hKE;
-
-      if      ( hpdg == kPdgProton      )  { brNfP++;     brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiProton  )  { brNfP++;     brCalResp0 += (hE + 2*hm);}
-      else if ( hpdg == kPdgNeutron     )  { brNfN++;     brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiNeutron )  { brNfN++;     brCalResp0 += (hE + 2*hm);}
-      else if ( hpdg == kPdgPiP         )  { brNfPip++;   brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgPiM         )  { brNfPim++;   brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgPi0         )  { brNfPi0++;   brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgKP          )  { brNfKp++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgKM          )  { brNfKm++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgK0          )  { brNfK0++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgAntiK0      )  { brNfK0++;    brCalResp0 += hKE;        }
-      else if ( hpdg == kPdgGamma       )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgElectron    )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else if ( hpdg == kPdgPositron    )  { brNfEM++;    brCalResp0 += (e_h * hE); }
-      else                                 { brNfOther++; brCalResp0 += hKE;        }
-
-      LOG("gntpc", pINFO) 
-        << "Counting in f/s system from hadronic vtx: idx = " << final_had_syst[j]
-        << " -> " << p->Name();
-    }
-
-    LOG("gntpc", pINFO) 
-     << "N(p):"             << brNfP
-     << ", N(n):"           << brNfN
-     << ", N(pi+):"         << brNfPip
-     << ", N(pi-):"         << brNfPim
-     << ", N(pi0):"         << brNfPi0
-     << ", N(K+,K-,K0):"    << brNfKp+brNfKm+brNfK0
-     << ", N(gamma,e-,e+):" << brNfEM
-     << ", N(etc):"         << brNfOther << "\n";
-
-    brVtxX = vtx->X();   
-    brVtxY = vtx->Y();   
-    brVtxZ = vtx->Z();   
-    brVtxT = vtx->T();
-
-    s_tree->Fill();
+    // compute the event summary and fill the gst tree
+    // (unphysical events are skipped)
+    gst.Fill((int) iev, event);
 
     mcrec->Clear();
 
@@ -2147,10 +1589,14 @@ void ConvertToGRooTracker(void)
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
+
+  // restrict to the entry range of this worker process, if any
+  if (gLastEntry >= 0) nmax = TMath::Min(nmax, gLastEntry);
+
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gFirstEntry << " events";
 
   //-- event loop
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  for(Long64_t iev = gFirstEntry; iev < nmax; iev++) {
     gtree->GetEntry(iev);
 
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -2846,9 +2292,13 @@ TTree * tEvtTree = new TTree("ginuke","GENIE INuke Summary Tree");
     LOG("gntpc", pERROR) << "Number of events = 0";
     return;
   }
-  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax << " events";
 
-  for(Long64_t iev = 0; iev < nmax; iev++) {
+  // restrict to the entry range of this worker process, if any
+  if (gLastEntry >= 0) nmax = TMath::Min(nmax, gLastEntry);
+
+  LOG("gntpc", pNOTICE) << "*** Analyzing: " << nmax-gFirstEntry << " events";
+
+  for(Long64_t iev = gFirstEntry; iev < nmax; iev++) {
     brIEv = iev; 
     er_tree->GetEntry(iev);
     NtpMCRecHeader rec_header = mcrec->hdr;
@@ -3059,6 +2509,12 @@ void GetCommandLineArgs(int argc, char ** argv)
   // check whether to copy MC job metadata (only if output file is in ROOT format)
   gOptCopyJobMeta = parser.OptionExists('c');
 
+  // number of worker processes
+  if( parser.OptionExists('j') ) {
+    LOG("gntpc", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = TMath::Max(1, parser.ArgAsInt('j'));
+  }
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gntpc", pINFO) << "Reading random number seed";
@@ -3074,6 +2530,7 @@ void GetCommandLineArgs(int argc, char ** argv)
                         << ", vrs = " << gOptVersion;
   LOG("gntpc", pNOTICE) << "Number of events to be converted = " << gOptN;
   LOG("gntpc", pNOTICE) << "Copy metadata? = " << ((gOptCopyJobMeta) ? "Yes" : "No");
+  LOG("gntpc", pNOTICE) << "Number of worker processes = " << gOptNWorkers;
   LOG("gntpc", pNOTICE) << "Random number seed = " << gOptRanSeed;
 
   LOG("gntpc", pNOTICE) << *RunOpt::Instance();
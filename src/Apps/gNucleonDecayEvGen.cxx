@@ -17,6 +17,7 @@
                      [-D geometry_density_units]
                      [-t geometry_top_volume_name]
                      [-o output_event_file_prefix]
+                     [-j n_of_workers]
                      [--seed random_number_seed]
                      [--message-thresholds xml_file]
                      [--event-record-print-level level]
@@ -97,6 +98,12 @@
               The default output filename is: 
               gntp.[run_number].ghep.root
               This cmd line arguments lets you override 'gntp'
+           -j
+              Batched mode: Number of worker processes generating the events
+              in parallel [default: 1]. Each worker generates a contiguous
+              block of events in its own output file, with the prefix
+              [prefix].w[worker], and the random number streams are reseeded
+              for every event from the seed and the event index.
            --seed
               Random number seed.
 
@@ -118,6 +125,9 @@
 #include <vector>
 #include <sstream>
 
+#include <unistd.h>
+#include <sys/wait.h>
+
 #include <TSystem.h> 
 
 #include "Framework/Algorithm/AlgFactory.h"
@@ -149,6 +159,9 @@ using namespace genie;
 // function prototypes
 void  GetCommandLineArgs (int argc, char ** argv);
 void  PrintSyntax        (void);
+void  GenerateEvents     (const EventRecordVisitorI * mcgen, int ifirst, int nev,
+                          string prefix, GMCJMonitor * mcjmonitor);
+void  GenerateEventsInWorkers (const EventRecordVisitorI * mcgen);
 int   SelectInitState    (void);
 const EventRecordVisitorI * NucleonDecayGenerator(void);
 
@@ -171,6 +184,7 @@ string             gOptRootGeomTopVol = "";                // input geometry top
 double             gOptGeomLUnits = 0;                     // input geometry length units 
 double             gOptGeomDUnits = 0;                     // input geometry density units 
 long int           gOptRanSeed = -1;                       // random number seed
+int                gOptNWorkers = 1;                       // number of worker processes - batched mode
 
 //_________________________________________________________________________________________
 int main(int argc, char ** argv)
@@ -182,44 +196,60 @@ int main(int argc, char ** argv)
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   utils::app_init::RandGen(gOptRanSeed);
 
-  // Initialize an Ntuple Writer to save GHEP records into a TTree
-  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
-  ntpw.CustomizeFilenamePrefix(gOptEvFilePrefix);
-  ntpw.Initialize();
-
-  // Create a MC job monitor for a periodically updated status file
-  GMCJMonitor mcjmonitor(gOptRunNu);
-  mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
-
   // Set GHEP print level
   GHepRecord::SetPrintLevel(RunOpt::Instance()->EventRecordPrintLevel());
 
   // Get the nucleon decay generator
   const EventRecordVisitorI * mcgen = NucleonDecayGenerator();
 
-  // Event loop
-  int ievent = 0;
+  if(gOptNWorkers > 1) {
+    GenerateEventsInWorkers(mcgen);
+  } else {
+    GMCJMonitor mcjmonitor(gOptRunNu);
+    mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+    GenerateEvents(mcgen, 0, gOptNev, gOptEvFilePrefix, &mcjmonitor);
+  }
+
+  LOG("gevgen_ndcy", pNOTICE) << "Done!";
+
+  return 0;
+}
+//_________________________________________________________________________________________
+void GenerateEvents(
+  const EventRecordVisitorI * mcgen, int ifirst, int nev, string prefix,
+  GMCJMonitor * mcjmonitor)
+{
+// Generate events ifirst ... ifirst+nev-1 and save them in the output file
+// with the given prefix. In batched mode, the random number streams are
+// reseeded for every event, so that each event depends only on the seed and
+// on its index.
+
+  // Initialize an Ntuple Writer to save GHEP records into a TTree
+  NtpWriter ntpw(kDefOptNtpFormat, gOptRunNu);
+  ntpw.CustomizeFilenamePrefix(prefix);
+  ntpw.Initialize();
+
   int dpdg = 0;
   if (gOptDecayedNucleon > 0) {
     dpdg = gOptDecayedNucleon;
   } else {
     dpdg = utils::nucleon_decay::DecayedNucleonPdgCode(gOptDecayMode);
-  }  
+  }
 
-  while (1)
+  for(int ievent = ifirst; ievent < ifirst + nev; ievent++)
   {
-     if(ievent == gOptNev) break;
-
      LOG("gevgen_ndcy", pNOTICE)
           << " *** Generating event............ " << ievent;
 
+     if(gOptNWorkers > 1) RandomGen::Instance()->SetEventIndex(ievent);
+
      EventRecord * event = new EventRecord;
      int target = SelectInitState();
      int decay  = (int)gOptDecayMode;
      Interaction * interaction = Interaction::NDecay(target,decay,dpdg);
      event->AttachSummary(interaction);
 
-     // Simulate decay     
+     // Simulate decay
      mcgen->ProcessEventRecord(event);
 
      LOG("gevgen_ndcy", pINFO)
@@ -227,18 +257,65 @@ int main(int argc, char ** argv)
 
      // Add event at the output ntuple, refresh the mc job monitor & clean-up
      ntpw.AddEventRecord(ievent, event);
-     mcjmonitor.Update(ievent,event);
+     if(mcjmonitor) mcjmonitor->Update(ievent,event);
      delete event;
-
-     ievent++;
   } // event loop
 
   // Save the generated event tree & close the output file
   ntpw.Save();
+}
+//_________________________________________________________________________________________
+void GenerateEventsInWorkers(const EventRecordVisitorI * mcgen)
+{
+// Batched mode: split the events in gOptNWorkers contiguous blocks, each one
+// generated by a forked worker process (GENIE's singletons are not safe for
+// concurrent threads) in its own output file, [prefix].w[worker].[run]...
+// The events keep their global index, so the worker files can be chained.
+// The status file is only refreshed by the first worker.
+
+  vector<pid_t> wpids;
+  for(int iw = 0; iw < gOptNWorkers; iw++) {
+    int ifirst = (int) ((long int) gOptNev *  iw    / gOptNWorkers);
+    int ilast  = (int) ((long int) gOptNev * (iw+1) / gOptNWorkers);
+    ostringstream prefix;
+    prefix << gOptEvFilePrefix << ".w" << iw;
+
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("gevgen_ndcy", pFATAL) << "Couldn't fork worker " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) {
+      // worker
+      LOG("gevgen_ndcy", pNOTICE)
+         << "Starting worker " << iw << ": events " << ifirst << " - " << ilast-1;
+      if(iw == 0) {
+        GMCJMonitor mcjmonitor(gOptRunNu);
+        mcjmonitor.SetRefreshRate(RunOpt::Instance()->MCJobStatusRefreshRate());
+        GenerateEvents(mcgen, ifirst, ilast-ifirst, prefix.str(), &mcjmonitor);
+      } else {
+        GenerateEvents(mcgen, ifirst, ilast-ifirst, prefix.str(), 0);
+      }
+      _exit(0);
+    }
+    wpids.push_back(pid);
+  }
 
-  LOG("gevgen_ndcy", pNOTICE) << "Done!";
-
-  return 0;
+  bool failed = false;
+  for(int iw = 0; iw < gOptNWorkers; iw++) {
+    int status = 0;
+    waitpid(wpids[iw], &status, 0);
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("gevgen_ndcy", pERROR) << "Worker " << iw << " failed";
+      failed = true;
+    }
+  }
+  if(failed) {
+    LOG("gevgen_ndcy", pFATAL) << "At least one worker failed - Exiting";
+    gAbortingInErr = true;
+    exit(1);
+  }
 }
 //_________________________________________________________________________________________
 int SelectInitState(void)
@@ -491,6 +568,14 @@ void GetCommandLineArgs(int argc, char ** argv)
   } //-o
 
 
+  // number of worker processes - batched mode
+  if( parser.OptionExists('j') ) {
+    LOG("gevgen_ndcy", pINFO) << "Reading number of worker processes";
+    gOptNWorkers = parser.ArgAsInt('j');
+  } else {
+    gOptNWorkers = 1;
+  } //-j
+
   // random number seed
   if( parser.OptionExists("seed") ) {
     LOG("gevgen_ndcy", pINFO) << "Reading random number seed";
@@ -536,7 +621,8 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n @@ Random number seed: " << gOptRanSeed
      << "\n @@ Decay channel $ " << utils::nucleon_decay::AsString(gOptDecayMode, gOptDecayedNucleon)
      << "\n @@ Geometry      $ " << gminfo.str()
-     << "\n @@ Statistics    $ " << gOptNev << " events";
+     << "\n @@ Statistics    $ " << gOptNev << " events"
+     << "\n @@ Workers       $ " << gOptNWorkers;
 
   //
   // Temporary warnings...
@@ -565,6 +651,7 @@ void PrintSyntax(void)
    << "\n             [-D density_units_at_geom]"
    << "\n              -n n_of_events "
    << "\n             [-o output_event_file_prefix]"
+   << "\n             [-j n_of_workers]"
    << "\n             [--seed random_number_seed]"
    << "\n             [--message-thresholds xml_file]"
    << "\n             [--event-record-print-level level]"
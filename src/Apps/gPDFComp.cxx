@@ -6,6 +6,7 @@
 \brief   PDF comparison tool
 
 \syntax  gpdfcomp --pdf-set pdf_set [-o output]
+                  [--threads n] [--cache-file root_file]
 
          --pdf-set :
           Specifies a comma separated list of GENIE PDFs.
@@ -17,6 +18,18 @@
           Specifies a name to be used in the output files.
           Default: pdf_comp
 
+         --threads :
+          Specifies the number of threads evaluating the PDFs on the plotted
+          (x,Q2) grids. Each thread uses its own instance of the PDF model.
+          Models using LHAPDF, which is not thread-safe, are always evaluated
+          in a single thread.
+          Default: 1
+
+         --cache-file :
+          Specifies a ROOT file where the evaluated grids are cached, keyed
+          by model and configuration, so that re-running with the same PDF
+          sets (eg to restyle the plots) does not evaluate them again.
+
 \example gpdfcomp --pdf-set genie::GRV98LO/Default,genie::BYPDF/Default 
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -32,6 +45,9 @@
 
 #include <vector>
 #include <string>
+#include <sstream>
+#include <stdint.h>
+#include <pthread.h>
 
 #include <TNtuple.h>
 #include <TFile.h>
@@ -51,6 +67,10 @@
 #include "Physics/PartonDistributions/PDFModelI.h"
 //#include "Physics/PartonDistributions/LHAPDF5.h"
 #include "Physics/PartonDistributions/PDF.h"
+#include "Physics/PartonDistributions/PDFt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/Style.h"
@@ -62,12 +82,33 @@ using namespace genie::utils;
 // globals
 string        gOptPDFSet  = "";         // --pdf-set argument
 string        gOptOutFile = "pdf_comp"; // -o argument
+int           gOptNThreads = 1;         // --threads argument
+string        gOptCacheFile = "";       // --cache-file argument
 vector<const PDFModelI *> gPDFAlgList;
 
 // function prototypes
 void GetCommandLineArgs (int argc, char ** argv);
 void GetAlgorithms (void);
 void MakePlots     (void);
+void EvaluatePDFs  (unsigned int im, const vector<double> & x,
+                    const vector<double> & Q2, vector<PDF_t> & pdfs);
+
+// a slice of the grid points, evaluated in one thread
+struct PDFGridSlice_t {
+  const PDFModelI * model;
+  const double *    x;
+  const double *    Q2;
+  PDF_t *           pdfs;
+  int               n;
+};
+static void * EvaluatePDFGridSlice(void * arg)
+{
+  PDFGridSlice_t * slice = (PDFGridSlice_t *) arg;
+  if(slice->n > 0) {
+    slice->model->AllPDFs(slice->x, slice->Q2, slice->pdfs, slice->n);
+  }
+  return 0;
+}
 
 //___________________________________________________________________
 int main(int argc, char ** argv)
@@ -75,6 +116,7 @@ int main(int argc, char ** argv)
   utils::style::SetDefaultStyle();
 
   GetCommandLineArgs (argc,argv);   // Get command line arguments
+  utils::app_init::CacheFile(gOptCacheFile);
   GetAlgorithms();                  // Get requested PDF algorithms
   MakePlots();   // Produce all output plots and fill output n-tuple
 
@@ -141,6 +183,31 @@ void MakePlots (void)
   }
 
 
+  // Evaluate the PDFs of each model at all (x,Q2) points of the 1-D plots
+  // and at the bin centres of the 2-D plots up front
+  vector<double> x_1d, Q2_1d;
+  for(unsigned int ix=0; ix < nx; ix++) {
+    for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
+      x_1d .push_back(x_arr [ix]);
+      Q2_1d.push_back(Q2_arr[iq2]);
+    }
+  }
+  TH2D h2_grid("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
+  vector<double> x_2d, Q2_2d;
+  for(int ibinx = 1; ibinx <= h2_grid.GetXaxis()->GetNbins(); ibinx++) {
+    for(int ibinq2 = 1; ibinq2 <= h2_grid.GetYaxis()->GetNbins(); ibinq2++) {
+      x_2d .push_back(h2_grid.GetXaxis()->GetBinCenter(ibinx));
+      Q2_2d.push_back(h2_grid.GetYaxis()->GetBinCenter(ibinq2));
+    }
+  }
+  const int nbinsQ2_2d = h2_grid.GetYaxis()->GetNbins();
+  vector< vector<PDF_t> > pdfs_1d(gPDFAlgList.size());
+  vector< vector<PDF_t> > pdfs_2d(gPDFAlgList.size());
+  for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
+    EvaluatePDFs(im, x_1d, Q2_1d, pdfs_1d[im]);
+    EvaluatePDFs(im, x_2d, Q2_2d, pdfs_2d[im]);
+  }
+
   // Output ntuple
   TNtuple * ntpl = new TNtuple("nt","pdfs","i:uv:dv:us:ds:s:g:x:Q2");
 
@@ -226,18 +293,15 @@ void MakePlots (void)
     double max_gr_xglu_Q2 = -9E9;
     
     for(unsigned int im=0; im < gPDFAlgList.size(); im++) {
-      PDF pdf;
-      pdf.SetModel(gPDFAlgList[im]);
       for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
         double Q2 = Q2_arr[iq2];
-        pdf.Calculate(x, Q2);
-      //LOG("gpdfcomp", pINFO) << "PDFs:\n" << pdf;
-        double xuv  = pdf.UpValence();
-        double xdv  = pdf.DownValence();
-        double xus  = pdf.UpSea();
-        double xds  = pdf.DownSea();
-        double xstr = pdf.Strange();
-        double xglu = pdf.Gluon();
+        const PDF_t & pdf = pdfs_1d[im][ix*nQ2 + iq2];
+        double xuv  = pdf.uval;
+        double xdv  = pdf.dval;
+        double xus  = pdf.usea;
+        double xds  = pdf.dsea;
+        double xstr = pdf.str;
+        double xglu = pdf.gl;
         xuv_arr  [im][iq2] = x * xuv;
         xdv_arr  [im][iq2] = x * xdv;
         xus_arr  [im][iq2] = x * xus;
@@ -363,22 +427,18 @@ void MakePlots (void)
     h2_xds [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xstr[im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_xglu[im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
-    PDF pdf;
-    pdf.SetModel(gPDFAlgList[im]);
     for(int ibinx = 1; 
             ibinx <= h2_xuv[im]->GetXaxis()->GetNbins(); ibinx++) {
       double x = h2_xuv[im]->GetXaxis()->GetBinCenter(ibinx);
       for(int ibinq2 = 1; 
               ibinq2 <= h2_xuv[im]->GetYaxis()->GetNbins(); ibinq2++) {
-         double Q2 = h2_xuv[im]->GetYaxis()->GetBinCenter(ibinq2);
-         pdf.Calculate(x, Q2);
-       //LOG("gpdfcomp", pINFO) << "PDFs:\n" << pdf;
-         double xuv  = x * pdf.UpValence();
-         double xdv  = x * pdf.DownValence();
-         double xus  = x * pdf.UpSea();
-         double xds  = x * pdf.DownSea();
-         double xstr = x * pdf.Strange();
-         double xglu = x * pdf.Gluon();
+         const PDF_t & pdf = pdfs_2d[im][(ibinx-1)*nbinsQ2_2d + ibinq2-1];
+         double xuv  = x * pdf.uval;
+         double xdv  = x * pdf.dval;
+         double xus  = x * pdf.usea;
+         double xds  = x * pdf.dsea;
+         double xstr = x * pdf.str;
+         double xglu = x * pdf.gl;
          h2_xuv [im] -> SetBinContent(ibinx, ibinq2, xuv );
          h2_xdv [im] -> SetBinContent(ibinx, ibinq2, xdv ); 
          h2_xus [im] -> SetBinContent(ibinx, ibinq2, xus ); 
@@ -674,6 +734,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptOutFile = parser.Arg('o');
   }
 
+  if(parser.OptionExists("threads")){
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt("threads"));
+  }
+
+  if(parser.OptionExists("cache-file")){
+    gOptCacheFile = parser.ArgAsString("cache-file");
+  }
+
 }
 //_________________________________________________________________________________
 void GetAlgorithms(void)
@@ -720,3 +788,112 @@ void GetAlgorithms(void)
 }
 //_________________________________________________________________________________
 
+void EvaluatePDFs(unsigned int im,
+   const vector<double> & x, const vector<double> & Q2, vector<PDF_t> & pdfs)
+{
+// Evaluate the PDFs of the im-th model at the input (x,Q2) points, using the
+// batched PDFModelI::AllPDFs(). The points are split in contiguous slices,
+// one per thread, and each thread uses its own instance of the model.
+// The results are kept in the GENIE cache (saved in the --cache-file), keyed
+// by the model, the contents of its configuration and the points.
+
+  const PDFModelI * pdf_alg = gPDFAlgList[im];
+  int n = x.size();
+  pdfs.resize(n);
+
+  ostringstream config;
+  config << pdf_alg->GetConfig();
+  string config_str = config.str();
+
+  uint64_t hash = 14695981039346656037ULL;
+  const char * bytes[3] = {
+     config_str.data(), (const char *) &x[0], (const char *) &Q2[0] };
+  size_t nbytes[3] = {
+     config_str.size(), n*sizeof(double), n*sizeof(double) };
+  for(int ib = 0; ib < 3; ib++) {
+    for(size_t i = 0; i < nbytes[ib]; i++) {
+      hash ^= (unsigned char) bytes[ib][i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  ostringstream grid;
+  grid << std::hex << hash << "/" << std::dec << n;
+
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey("gpdfcomp", pdf_alg->Id().Key(), grid.str());
+
+  const int nf = 6; // uval, dval, usea, dsea, str, gl
+  CacheBranchFx * cache_branch =
+      dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(cache_branch && (int) cache_branch->Map().size() == nf*n) {
+    LOG("gpdfcomp", pNOTICE)
+      << "Using cached grid for " << pdf_alg->Id().Key();
+    map<double,double>::const_iterator it = cache_branch->Map().begin();
+    for(int i = 0; i < n; i++) {
+      pdfs[i].uval = (it++)->second;
+      pdfs[i].dval = (it++)->second;
+      pdfs[i].usea = (it++)->second;
+      pdfs[i].dsea = (it++)->second;
+      pdfs[i].str  = (it++)->second;
+      pdfs[i].gl   = (it++)->second;
+    }
+    return;
+  }
+
+  // LHAPDF is not thread-safe
+  int nthreads = TMath::Min(gOptNThreads, n);
+  if(pdf_alg->Id().Name().find("LHAPDF") != string::npos ||
+     config_str.find("LHAPDF") != string::npos) nthreads = 1;
+
+  vector<const PDFModelI *> models(nthreads, pdf_alg);
+  AlgFactory * algf = AlgFactory::Instance();
+  for(int it = 1; it < nthreads; it++) {
+    models[it] = dynamic_cast<const PDFModelI *> (
+                    algf->AdoptAlgorithm(pdf_alg->Id()));
+    if(!models[it]) models[it] = pdf_alg;
+  }
+
+  vector<PDFGridSlice_t> slices(nthreads);
+  int nslice = (n + nthreads - 1) / nthreads;
+  for(int it = 0; it < nthreads; it++) {
+    int first = TMath::Min(it*nslice, n);
+    slices[it].model = models[it];
+    slices[it].x     = &x[0]    + first;
+    slices[it].Q2    = &Q2[0]   + first;
+    slices[it].pdfs  = &pdfs[0] + first;
+    slices[it].n     = TMath::Min(nslice, n-first);
+  }
+  // run the slices in worker threads and the first one in this thread,
+  // falling back to this thread for any slice whose thread can not start
+  // (or that would share the model instance with an other one)
+  vector<pthread_t> threads(nthreads);
+  vector<bool>      started(nthreads, false);
+  for(int it = 1; it < nthreads; it++) {
+    if(models[it] == pdf_alg) continue;
+    started[it] =
+      (pthread_create(&threads[it], 0, EvaluatePDFGridSlice, &slices[it]) == 0);
+  }
+  EvaluatePDFGridSlice(&slices[0]);
+  for(int it = 1; it < nthreads; it++) {
+    if(started[it]) {
+      pthread_join(threads[it], 0);
+    } else {
+      EvaluatePDFGridSlice(&slices[it]);
+    }
+    if(models[it] != pdf_alg) delete models[it];
+  }
+
+  if(!cache_branch) {
+    cache_branch = new CacheBranchFx("gpdfcomp grid");
+    cache->AddCacheBranch(key, cache_branch);
+  }
+  for(int i = 0; i < n; i++) {
+    cache_branch->AddValues(nf*i,   pdfs[i].uval);
+    cache_branch->AddValues(nf*i+1, pdfs[i].dval);
+    cache_branch->AddValues(nf*i+2, pdfs[i].usea);
+    cache_branch->AddValues(nf*i+3, pdfs[i].dsea);
+    cache_branch->AddValues(nf*i+4, pdfs[i].str );
+    cache_branch->AddValues(nf*i+5, pdfs[i].gl  );
+  }
+}
+//_________________________________________________________________________________
@@ -6,6 +6,7 @@
 \brief   Structure function comparison tool
 
 \syntax  gsfcomp --structure-func sf_set [-o output]
+                 [--threads n] [--cache-file root_file]
 
          --structure-func :
           Specifies a comma separated list of GENIE structure function models.
@@ -17,6 +18,18 @@
           Specifies a name to be used in the output files.
           Default: sf_comp
 
+         --threads :
+          Specifies the number of threads evaluating the structure functions
+          on the plotted (x,Q2) grids. Each thread uses its own instance of
+          the structure function model. Models using LHAPDF, which is not
+          thread-safe, are always evaluated in a single thread.
+          Default: 1
+
+         --cache-file :
+          Specifies a ROOT file where the evaluated grids are cached, keyed
+          by model and configuration, so that re-running with the same models
+          (eg to restyle the plots) does not evaluate them again.
+
 \example gsfcomp --structure-func genie::Blah/Default,genie::Blah/Tweaked
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
@@ -32,6 +45,9 @@
 
 #include <vector>
 #include <string>
+#include <sstream>
+#include <stdint.h>
+#include <pthread.h>
 
 #include <TNtuple.h>
 #include <TFile.h>
@@ -52,6 +68,9 @@
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/Style.h"
@@ -63,12 +82,53 @@ using namespace genie::utils;
 // globals
 string        gOptSF      = "";         // --structure-func argument
 string        gOptOutFile = "sf_comp";  // -o argument
+int           gOptNThreads = 1;         // --threads argument
+string        gOptCacheFile = "";       // --cache-file argument
 vector<const DISStructureFuncModelI *> gSFAlgList;
 
+// structure functions F1,...,F6 at a grid point
+struct StrucFunc_t {
+  double F[6];
+};
+
 // function prototypes
 void GetCommandLineArgs (int argc, char ** argv);
 void GetAlgorithms      (void);
 void MakePlots          (void);
+void EvaluateSFs        (unsigned int im, const vector<double> & x,
+                         const vector<double> & Q2, vector<StrucFunc_t> & sfs);
+
+// a slice of the grid points, evaluated in one thread
+struct SFGridSlice_t {
+  const DISStructureFuncModelI * model;
+  const double *                 x;
+  const double *                 Q2;
+  StrucFunc_t *                  sfs;
+  int                            n;
+};
+static void * EvaluateSFGridSlice(void * arg)
+{
+  SFGridSlice_t * slice = (SFGridSlice_t *) arg;
+  if(slice->n <= 0) return 0;
+
+  DISStructureFunc sf;
+  sf.SetModel(slice->model);
+  Interaction * interaction = Interaction::DISCC(kPdgTgtFreeP,kPdgProton,kPdgNuMu);
+  for(int i = 0; i < slice->n; i++) {
+    interaction->KinePtr()->Setx (slice->x [i]);
+    interaction->KinePtr()->SetQ2(slice->Q2[i]);
+    sf.Calculate(interaction);
+    double * F = slice->sfs[i].F;
+    F[0] = sf.F1();
+    F[1] = sf.F2();
+    F[2] = sf.F3();
+    F[3] = sf.F4();
+    F[4] = sf.F5();
+    F[5] = sf.F6();
+  }
+  delete interaction;
+  return 0;
+}
 
 //___________________________________________________________________
 int main(int argc, char ** argv)
@@ -76,6 +136,7 @@ int main(int argc, char ** argv)
   utils::style::SetDefaultStyle();
 
   GetCommandLineArgs (argc,argv);   // Get command line arguments
+  utils::app_init::CacheFile(gOptCacheFile);
   GetAlgorithms();                  // Get requested SF algorithms
   MakePlots();   // Produce all output plots and fill output n-tuple
 
@@ -141,6 +202,31 @@ void MakePlots (void)
      x_bin_edges_2d[ix] = x;
   }
 
+  // Evaluate the structure functions of each model at all (x,Q2) points of
+  // the 1-D plots and at the bin centres of the 2-D plots up front
+  vector<double> x_1d, Q2_1d;
+  for(unsigned int ix=0; ix < nx; ix++) {
+    for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
+      x_1d .push_back(x_arr [ix]);
+      Q2_1d.push_back(Q2_arr[iq2]);
+    }
+  }
+  TH2D h2_grid("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
+  vector<double> x_2d, Q2_2d;
+  for(int ibinx = 1; ibinx <= h2_grid.GetXaxis()->GetNbins(); ibinx++) {
+    for(int ibinq2 = 1; ibinq2 <= h2_grid.GetYaxis()->GetNbins(); ibinq2++) {
+      x_2d .push_back(h2_grid.GetXaxis()->GetBinCenter(ibinx));
+      Q2_2d.push_back(h2_grid.GetYaxis()->GetBinCenter(ibinq2));
+    }
+  }
+  const int nbinsQ2_2d = h2_grid.GetYaxis()->GetNbins();
+  vector< vector<StrucFunc_t> > sfs_1d(gSFAlgList.size());
+  vector< vector<StrucFunc_t> > sfs_2d(gSFAlgList.size());
+  for(unsigned int im=0; im < gSFAlgList.size(); im++) {
+    EvaluateSFs(im, x_1d, Q2_1d, sfs_1d[im]);
+    EvaluateSFs(im, x_2d, Q2_2d, sfs_2d[im]);
+  }
+
   // Output ntuple
   TNtuple * ntpl = new TNtuple("nt","structure functions","i:F1:F2:F3:F4:F5:F6:x:Q2");
 
@@ -218,21 +304,15 @@ void MakePlots (void)
     double F5_arr [nm][nQ2];
     double F6_arr [nm][nQ2];
     for(unsigned int im=0; im < gSFAlgList.size(); im++) {
-      DISStructureFunc sf;
-      sf.SetModel(gSFAlgList[im]);
       for(unsigned int iq2 = 0; iq2 < nQ2; iq2++) {
         double Q2 = Q2_arr[iq2];
-        Interaction * interaction = Interaction::DISCC(kPdgTgtFreeP,kPdgProton,kPdgNuMu);
-      //LOG("gsfcomp", pNOTICE) << "Setting x = " << x << ", Q2 = " << Q2;
-        interaction->KinePtr()->Setx(x);
-        interaction->KinePtr()->SetQ2(Q2);
-        sf.Calculate(interaction);
-        double F1 = sf.F1();
-        double F2 = sf.F2();
-        double F3 = sf.F3();
-        double F4 = sf.F4();
-        double F5 = sf.F5();
-        double F6 = sf.F6();
+        const double * F = sfs_1d[im][ix*nQ2 + iq2].F;
+        double F1 = F[0];
+        double F2 = F[1];
+        double F3 = F[2];
+        double F4 = F[3];
+        double F5 = F[4];
+        double F6 = F[5];
         F1_arr [im][iq2] = F1;
         F2_arr [im][iq2] = F2;
         F3_arr [im][iq2] = F3;
@@ -240,7 +320,6 @@ void MakePlots (void)
         F5_arr [im][iq2] = F5;
         F6_arr [im][iq2] = F6;
         ntpl->Fill(im,F1,F2,F3,F4,F5,F6,x,Q2);
-        delete interaction;
       }//iq2
 
       gr_F1_Q2 [im] = new TGraph (nQ2, Q2_arr, F1_arr [im]);
@@ -329,32 +408,23 @@ void MakePlots (void)
     h2_F4 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F5 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
     h2_F6 [im] = new TH2D("","", nx_2d-1, x_bin_edges_2d, nQ2_2d-1, Q2_bin_edges_2d);
-    DISStructureFunc sf;
-    sf.SetModel(gSFAlgList[im]);
     for(int ibinx = 1; 
             ibinx <= h2_F1[im]->GetXaxis()->GetNbins(); ibinx++) {
-      double x = h2_F1[im]->GetXaxis()->GetBinCenter(ibinx);
       for(int ibinq2 = 1; 
               ibinq2 <= h2_F1[im]->GetYaxis()->GetNbins(); ibinq2++) {
-         double Q2 = h2_F1[im]->GetYaxis()->GetBinCenter(ibinq2);
-         Interaction * interaction = Interaction::DISCC(kPdgTgtFreeP,kPdgProton,kPdgNuMu);
-       //LOG("gsfcomp", pNOTICE) << "Setting x (bin " << ibinx << ") = " << x << ", Q2 (bin " << ibinq2 << ") = " << Q2;
-         interaction->KinePtr()->Setx(x);
-         interaction->KinePtr()->SetQ2(Q2);
-         sf.Calculate(interaction);
-         double F1 = sf.F1();
-         double F2 = sf.F2();
-         double F3 = sf.F3();
-         double F4 = sf.F4();
-         double F5 = sf.F5();
-         double F6 = sf.F6();
+         const double * F = sfs_2d[im][(ibinx-1)*nbinsQ2_2d + ibinq2-1].F;
+         double F1 = F[0];
+         double F2 = F[1];
+         double F3 = F[2];
+         double F4 = F[3];
+         double F5 = F[4];
+         double F6 = F[5];
          h2_F1 [im] -> SetBinContent(ibinx, ibinq2, F1);
          h2_F2 [im] -> SetBinContent(ibinx, ibinq2, F2); 
          h2_F3 [im] -> SetBinContent(ibinx, ibinq2, F3); 
          h2_F4 [im] -> SetBinContent(ibinx, ibinq2, F4); 
          h2_F5 [im] -> SetBinContent(ibinx, ibinq2, F5); 
          h2_F6 [im] -> SetBinContent(ibinx, ibinq2, F6); 
-         delete interaction;
       }
     }
 
@@ -634,6 +704,14 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptOutFile = parser.Arg('o');
   }
 
+  if(parser.OptionExists("threads")){
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt("threads"));
+  }
+
+  if(parser.OptionExists("cache-file")){
+    gOptCacheFile = parser.ArgAsString("cache-file");
+  }
+
 }
 //_________________________________________________________________________________
 void GetAlgorithms(void)
@@ -680,3 +758,102 @@ void GetAlgorithms(void)
 }
 //_________________________________________________________________________________
 
+void EvaluateSFs(unsigned int im,
+   const vector<double> & x, const vector<double> & Q2, vector<StrucFunc_t> & sfs)
+{
+// Evaluate the structure functions of the im-th model at the input (x,Q2)
+// points. The points are split in contiguous slices, one per thread, and each
+// thread uses its own instance of the model (the models keep the last
+// calculated values in data members). The results are kept in the GENIE
+// cache (saved in the --cache-file), keyed by the model, the contents of its
+// configuration and the points.
+
+  const DISStructureFuncModelI * sf_alg = gSFAlgList[im];
+  int n = x.size();
+  sfs.resize(n);
+
+  ostringstream config;
+  config << sf_alg->GetConfig();
+  string config_str = config.str();
+
+  uint64_t hash = 14695981039346656037ULL;
+  const char * bytes[3] = {
+     config_str.data(), (const char *) &x[0], (const char *) &Q2[0] };
+  size_t nbytes[3] = {
+     config_str.size(), n*sizeof(double), n*sizeof(double) };
+  for(int ib = 0; ib < 3; ib++) {
+    for(size_t i = 0; i < nbytes[ib]; i++) {
+      hash ^= (unsigned char) bytes[ib][i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  ostringstream grid;
+  grid << std::hex << hash << "/" << std::dec << n;
+
+  Cache * cache = Cache::Instance();
+  string key = cache->CacheBranchKey("gsfcomp", sf_alg->Id().Key(), grid.str());
+
+  const int nf = 6;
+  CacheBranchFx * cache_branch =
+      dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(cache_branch && (int) cache_branch->Map().size() == nf*n) {
+    LOG("gsfcomp", pNOTICE)
+      << "Using cached grid for " << sf_alg->Id().Key();
+    map<double,double>::const_iterator it = cache_branch->Map().begin();
+    for(int i = 0; i < n; i++) {
+      for(int k = 0; k < nf; k++, ++it) sfs[i].F[k] = it->second;
+    }
+    return;
+  }
+
+  // LHAPDF is not thread-safe
+  int nthreads = TMath::Min(gOptNThreads, n);
+  if(config_str.find("LHAPDF") != string::npos) nthreads = 1;
+
+  vector<const DISStructureFuncModelI *> models(nthreads, sf_alg);
+  AlgFactory * algf = AlgFactory::Instance();
+  for(int it = 1; it < nthreads; it++) {
+    models[it] = dynamic_cast<const DISStructureFuncModelI *> (
+                    algf->AdoptAlgorithm(sf_alg->Id()));
+    if(!models[it]) models[it] = sf_alg;
+  }
+
+  vector<SFGridSlice_t> slices(nthreads);
+  int nslice = (n + nthreads - 1) / nthreads;
+  for(int it = 0; it < nthreads; it++) {
+    int first = TMath::Min(it*nslice, n);
+    slices[it].model = models[it];
+    slices[it].x     = &x[0]   + first;
+    slices[it].Q2    = &Q2[0]  + first;
+    slices[it].sfs   = &sfs[0] + first;
+    slices[it].n     = TMath::Min(nslice, n-first);
+  }
+  // run the slices in worker threads and the first one in this thread,
+  // falling back to this thread for any slice whose thread can not start
+  // (or that would share the model instance with an other one)
+  vector<pthread_t> threads(nthreads);
+  vector<bool>      started(nthreads, false);
+  for(int it = 1; it < nthreads; it++) {
+    if(models[it] == sf_alg) continue;
+    started[it] =
+      (pthread_create(&threads[it], 0, EvaluateSFGridSlice, &slices[it]) == 0);
+  }
+  EvaluateSFGridSlice(&slices[0]);
+  for(int it = 1; it < nthreads; it++) {
+    if(started[it]) {
+      pthread_join(threads[it], 0);
+    } else {
+      EvaluateSFGridSlice(&slices[it]);
+    }
+    if(models[it] != sf_alg) delete models[it];
+  }
+
+  if(!cache_branch) {
+    cache_branch = new CacheBranchFx("gsfcomp grid");
+    cache->AddCacheBranch(key, cache_branch);
+  }
+  for(int i = 0; i < n; i++) {
+    for(int k = 0; k < nf; k++) cache_branch->AddValues(nf*i+k, sfs[i].F[k]);
+  }
+}
+//_________________________________________________________________________________
@@ -24,7 +24,11 @@
               See $GENIE/config/Messenger.xml for the XML schema.
 
          Notes :
-           There must be at least 2 files for the merges to work
+           There must be at least 2 files for the merges to work.
+           The splines are copied from the input XML files as they are,
+           without building them, in the order they are found. If a spline
+           of the same tune and name appears in more than one input file,
+           the first one is kept.
 
          Examples :
 
@@ -50,11 +54,16 @@
 */
 //____________________________________________________________________________
 
-#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include "libxml/xmlreader.h"
+
 #include <TSystem.h>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
@@ -62,20 +71,25 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/AppInit.h"
-#include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 
 using std::string;
 using std::vector;
+using std::map;
+using std::set;
+using std::ofstream;
+using std::endl;
 using std::ostringstream;
 
 using namespace genie;
 
-vector<string> GetAllInputFiles   (void);
-void           GetCommandLineArgs (int argc, char ** argv);
-void           PrintSyntax        (void);
+vector<string>    GetAllInputFiles   (void);
+void              GetCommandLineArgs (int argc, char ** argv);
+void              PrintSyntax        (void);
+XmlParserStatus_t ScanFile           (const string & filename);
+XmlParserStatus_t CopySplines        (const string & filename, const string & tune, ofstream & out);
 
 //User-specified options:
 string         gOutFile;   ///< output XML file
@@ -83,6 +97,10 @@ vector<string> gInpFiles;  ///< list of input XML files
 vector<string> gInpDirs;   ///< list of input dirs (to look for XML files)
 vector<string> gAllFiles;  ///< list of all input files
 
+set<string>               gTunes;   ///< tunes found in the input files
+map<string, set<string> > gCopied;  ///< tune -> names of splines written out
+int                       gUseLog = -1; ///< uselog attribute of the input files
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -90,25 +108,169 @@ int main(int argc, char ** argv)
 
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
   
-  XSecSplineList * xspl = XSecSplineList::Instance();
-
+  // find the tunes in the input files (and check them)
   vector<string>::const_iterator file_iter = gAllFiles.begin();
   for( ; file_iter != gAllFiles.end(); ++file_iter) {
     string filename = *file_iter;
-    LOG("gspladd", pNOTICE) << " ---- >> Loading file : " << filename;
-    XmlParserStatus_t ist = xspl->LoadFromXml(filename, true);
-    assert(ist==kXmlOK);
+    LOG("gspladd", pNOTICE) << " ---- >> Scanning file : " << filename;
+    XmlParserStatus_t ist = ScanFile(filename);
+    if(ist != kXmlOK) {
+      LOG("gspladd", pFATAL)
+        << "Couldn't read: " << filename << " (" << XmlParserStatus::AsString(ist) << ")";
+      exit(1);
+    }
   }
 
-  LOG("gspladd",pDEBUG) << *xspl ;
-
   LOG("gspladd", pNOTICE) 
-     << " ****** Saving all loaded splines into : " << gOutFile;
-  xspl->SaveAsXml(gOutFile);
+     << " ****** Saving all splines into : " << gOutFile;
+
+  ofstream outxml(gOutFile.c_str());
+  if(!outxml.is_open()) {
+    LOG("gspladd", pFATAL) << "Couldn't create file = " << gOutFile;
+    exit(1);
+  }
+  outxml << "<?xml version=\"1.0\" encoding=\"ISO-8859-1\"?>";
+  outxml << endl << endl;
+  outxml << "<!-- generated by gspladd -->";
+  outxml << endl << endl;
+  outxml << "<genie_xsec_spline_list "
+         << "version=\"3.00\" uselog=\"" << (gUseLog == 1 ? 1 : 0) << "\">";
+  outxml << endl << endl;
+
+  // copy the splines of each tune, from all files, in a single tune element
+  set<string>::const_iterator tune_iter = gTunes.begin();
+  for( ; tune_iter != gTunes.end(); ++tune_iter) {
+    string tune = *tune_iter;
+    outxml << "  <genie_tune name=\"" << tune << "\">";
+    outxml << endl << endl;
+    for(file_iter = gAllFiles.begin(); file_iter != gAllFiles.end(); ++file_iter) {
+      XmlParserStatus_t ist = CopySplines(*file_iter, tune, outxml);
+      if(ist != kXmlOK) {
+        LOG("gspladd", pFATAL)
+          << "Couldn't read: " << *file_iter << " (" << XmlParserStatus::AsString(ist) << ")";
+        exit(1);
+      }
+    }
+    outxml << "  </genie_tune>" << endl;
+    LOG("gspladd", pNOTICE) 
+       << "Tune " << tune << ": " << gCopied[tune].size() << " splines";
+  }
+
+  outxml << "</genie_xsec_spline_list>" << endl;
+  outxml.close();
 
   return 0;
 }
 //____________________________________________________________________________
+XmlParserStatus_t ScanFile(const string & filename)
+{
+// Check the root element of an input file and get the names of its tunes,
+// skipping over the spline elements
+
+  const int kNodeTypeStartElement = 1;
+
+  xmlTextReaderPtr reader = xmlNewTextReaderFilename(filename.c_str());
+  if(!reader) return kXmlNotParsed;
+
+  XmlParserStatus_t status = kXmlOK;
+
+  int ret = xmlTextReaderRead(reader);
+  while(ret == 1) {
+    int    type  = xmlTextReaderNodeType(reader);
+    int    depth = xmlTextReaderDepth(reader);
+    string name  = (const char *) xmlTextReaderConstName(reader);
+
+    if(type == kNodeTypeStartElement && depth == 0) {
+      if(name != "genie_xsec_spline_list") {
+        status = kXmlInvalidRoot;
+        break;
+      }
+      xmlChar * xinlog = xmlTextReaderGetAttribute(reader,(const xmlChar*)"uselog");
+      int uselog = xinlog ? atoi((const char *)xinlog) : 0;
+      xmlFree(xinlog);
+      if(gUseLog < 0) gUseLog = uselog;
+      else if(uselog != gUseLog) {
+        LOG("gspladd", pWARN)
+          << "The uselog attribute of " << filename
+          << " differs from the one of the first input file";
+      }
+    }
+    if(type == kNodeTypeStartElement && name == "genie_tune") {
+      xmlChar * xtune = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+      gTunes.insert(utils::str::TrimSpaces(xtune ? (const char *)xtune : ""));
+      xmlFree(xtune);
+    }
+    if(type == kNodeTypeStartElement && name == "spline") {
+      ret = xmlTextReaderNext(reader);
+      continue;
+    }
+    ret = xmlTextReaderRead(reader);
+  }
+  xmlFreeTextReader(reader);
+
+  if(status == kXmlOK && ret != 0) status = kXmlNotParsed;
+  return status;
+}
+//____________________________________________________________________________
+XmlParserStatus_t CopySplines(
+   const string & filename, const string & tune, ofstream & out)
+{
+// Copy the spline elements of the input tune, unless a spline with the same
+// name was already written out, without parsing the knots
+
+  const int kNodeTypeStartElement = 1;
+  const int kNodeTypeEndElement   = 15;
+
+  xmlTextReaderPtr reader = xmlNewTextReaderFilename(filename.c_str());
+  if(!reader) return kXmlNotParsed;
+
+  set<string> & copied = gCopied[tune];
+  bool in_tune = false;
+
+  int ret = xmlTextReaderRead(reader);
+  while(ret == 1) {
+    int    type = xmlTextReaderNodeType(reader);
+    string name = (const char *) xmlTextReaderConstName(reader);
+
+    if(name == "genie_tune") {
+      if(type == kNodeTypeStartElement && !xmlTextReaderIsEmptyElement(reader)) {
+        xmlChar * xtune = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+        in_tune = (utils::str::TrimSpaces(xtune ? (const char *)xtune : "") == tune);
+        xmlFree(xtune);
+        if(!in_tune) {
+          ret = xmlTextReaderNext(reader);
+          continue;
+        }
+      }
+      else if(type == kNodeTypeEndElement) in_tune = false;
+    }
+    else if(name == "spline" && type == kNodeTypeStartElement) {
+      if(in_tune) {
+        xmlChar * xname = xmlTextReaderGetAttribute(reader,(const xmlChar*)"name");
+        string spline_name = utils::str::TrimSpaces(xname ? (const char *)xname : "");
+        xmlFree(xname);
+        if(copied.insert(spline_name).second) {
+          LOG("gspladd", pINFO) << "Copying spline: " << spline_name;
+          xmlChar * xml = xmlTextReaderReadOuterXml(reader);
+          if(xml) out << "    " << (const char *) xml << endl;
+          xmlFree(xml);
+        } else {
+          LOG("gspladd", pWARN)
+            << "Spline: " << spline_name << " (tune: " << tune
+            << ") was already copied from another file. Skipping the one in: "
+            << filename;
+        }
+      }
+      ret = xmlTextReaderNext(reader);
+      continue;
+    }
+    ret = xmlTextReaderRead(reader);
+  }
+  xmlFreeTextReader(reader);
+
+  return (ret == 0) ? kXmlOK : kXmlNotParsed;
+}
+//____________________________________________________________________________
 vector<string> GetAllInputFiles(void)
 {
   vector<string> files;
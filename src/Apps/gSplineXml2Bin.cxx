@@ -0,0 +1,145 @@
+//____________________________________________________________________________
+/*!
+
+\program gspl2bin
+
+\brief   Converts XML files containing GENIE cross section splines into the
+         compact, memory-mappable binary spline format. Binary spline files 
+         can be passed to all GENIE apps (--cross-sections option) in place
+         of the XML ones and load much faster.
+
+         Syntax :
+           gspl2bin -f file_list -o output_file
+                    [--message-thresholds xml_file]
+
+         Options :
+           -f 
+              A list of input xml cross-section files. If more than one then 
+              separate using commas. All splines (for all tunes) are copied.
+           -o 
+              output binary file
+           --message-thresholds
+              Allows users to customize the message stream thresholds.
+              The thresholds are specified using an XML file.
+              See $GENIE/config/Messenger.xml for the XML schema.
+
+         Notes :
+           Binary spline files are written in the native byte order and can
+           only be read on machines with the same endianness. 
+           ROOT files written by gspl2root can not be converted as they do
+           not retain the spline keys.
+
+         Examples :
+
+           shell% gspl2bin -f xsec_Ar40.xml -o xsec_Ar40.gsplbin
+
+\author  The GENIE Collaboration
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "Framework/Conventions/XmlParserStatus.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+
+using std::string;
+using std::vector;
+
+using namespace genie;
+
+void GetCommandLineArgs (int argc, char ** argv);
+void PrintSyntax        (void);
+
+//User-specified options:
+string         gOutFile;   ///< output binary file
+vector<string> gInpFiles;  ///< list of input XML files
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc,argv);
+
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  
+  XSecSplineList * xspl = XSecSplineList::Instance();
+
+  vector<string>::const_iterator file_iter = gInpFiles.begin();
+  for( ; file_iter != gInpFiles.end(); ++file_iter) {
+    string filename = *file_iter;
+    LOG("gspl2bin", pNOTICE) << " ---- >> Loading file : " << filename;
+    XmlParserStatus_t ist = XSecSplineList::IsBinaryFile(filename) ?
+       xspl->LoadFromBinary(filename, true) : xspl->LoadFromXml(filename, true);
+    if(ist != kXmlOK) {
+      LOG("gspl2bin", pFATAL) 
+        << "Problem reading file: " << filename 
+        << " (" << XmlParserStatus::AsString(ist) << ")";
+      exit(1);
+    }
+  }
+
+  LOG("gspl2bin", pNOTICE) 
+     << " ****** Saving all loaded splines into : " << gOutFile;
+  xspl->SaveAsBinary(gOutFile);
+
+  return 0;
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gspl2bin", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options. 
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  // Parse run options for this app
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('f') ) {
+    LOG("gspl2bin", pINFO) << "Reading input files";
+    string inpfiles = parser.ArgAsString('f');
+    if(inpfiles.find(",") != string::npos) {
+       // split the comma separated list
+       gInpFiles = utils::str::Split(inpfiles, ",");
+    } else {
+       // there is just one file
+       gInpFiles.push_back(inpfiles);
+    }
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an input file name";
+    PrintSyntax();
+    exit(1);
+  }
+
+  if( parser.OptionExists('o') ) {
+    LOG("gspl2bin", pINFO) << "Reading output file name";
+    gOutFile = parser.ArgAsString('o');
+  } else {
+    LOG("gspl2bin", pFATAL) << "You must specify an output file name";
+    PrintSyntax();
+    exit(1);
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gspl2bin", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gspl2bin  -f file_list -o output_file\n"
+    << "             [--message-thresholds xml_file]\n";
+
+}
+//____________________________________________________________________________
@@ -8,7 +8,7 @@
 
          Syntax :
            gspl2root -f xml_file -p nu -t tgt [-e emax]
-                     [-o root_file] [-w] [-k]
+                     [-o root_file] [-w] [-k] [--threads n]
                      [--message-thresholds xml_file]
                      [--event-generator-list list_name]
 
@@ -28,7 +28,14 @@
            -w
               write out plots in a postscipt file
            -k
-              keep spline knot points  (not yet implemented).
+              keep spline knot points: store the graphs at the knots of the
+              input splines (within the plotted energy range) rather than at
+              a dense set of equi-spaced energies. The graphs are much smaller
+              and, since the knots of all splines of a set are typically the
+              same, the totals are exact sums of the stored channels.
+           --threads
+              the number of threads evaluating the splines of each initial
+              state [default: 1]
            --message-thresholds
               Allows users to customize the message stream thresholds.
            --event-generator-list
@@ -82,6 +89,9 @@
 #include <string>
 #include <sstream>
 #include <vector>
+#include <map>
+#include <algorithm>
+#include <pthread.h>
 
 #include <TSystem.h>
 #include <TFile.h>
@@ -116,6 +126,7 @@
 
 using std::string;
 using std::vector;
+using std::map;
 using std::ostringstream;
 
 using namespace genie;
@@ -130,6 +141,9 @@ void       SaveNtupleToRootFile (void);
 void       GetCommandLineArgs   (int argc, char ** argv);
 void       PrintSyntax          (void);
 PDGCodeList GetPDGCodeListFromString(std::string s);
+void       EvaluateXSecSplines  (const GEVGDriver & evg_driver,
+                                 const vector<double> & e,
+                                 map<const Interaction *, vector<double> > & xsec);
 
 //User-specified options:
 string gOptXMLFilename;  // input XML filename
@@ -140,7 +154,8 @@ PDGCodeList gOptTgtPdgList;    // list of target PDG codes
 int    gOptProbePdgCode; // probe PDG code (currently being processed)
 int    gOptTgtPdgCode;   // target PDG code
 bool   gWriteOutPlots;   // write out a postscript file with plots
-//bool   gKeepSplineKnots; // use spline abscissa points rather than equi-spaced
+bool   gKeepSplineKnots; // use spline abscissa points rather than equi-spaced
+int    gOptNThreads;     // number of threads evaluating the splines
 
 //Globals & constants
 double gEmin;
@@ -150,6 +165,25 @@ int    kNSplineP = 1000;
 const int    kPsType   = 111;  // ps type: portrait
 const double kEmin     = 0.01; // minimum energy in plots (GeV)
 
+// splines evaluated in one thread
+struct XSecSplineSlice_t {
+  const Spline *   const * splines;
+  vector<double> * const * xsec;
+  const double *           e;
+  int                      np;
+  int                      n;
+};
+static void * EvaluateXSecSplineSlice(void * arg)
+{
+  XSecSplineSlice_t * slice = (XSecSplineSlice_t *) arg;
+  for(int is = 0; is < slice->n; is++) {
+    vector<double> & xs = *(slice->xsec[is]);
+    slice->splines[is]->Evaluate(slice->e, &xs[0], slice->np);
+    for(int i = 0; i < slice->np; i++) xs[i] *= (1E+38/units::cm2);
+  }
+  return 0;
+}
+
 //____________________________________________________________________________
 int main(int argc, char ** argv)
 {
@@ -568,13 +602,36 @@ void SaveGraphsToRootFile(void)
   topdir = froot->mkdir(dptr.str().c_str(),dtitle.str().c_str());
   topdir->cd();
 
-  double   de = (gEmax-gEmin)/(kNSplineP-1);
-  double * e  = new double[kNSplineP];
-  for(int i=0; i<kNSplineP; i++) {  e[i]  = gEmin + i*de; }
+  //-- energies of the graph points: the spline knots in the plotted range
+  //   or equi-spaced
+  vector<double> energies;
+  InteractionList::const_iterator ilistiter = ilist->begin();
+  if(gKeepSplineKnots) {
+    for(; ilistiter != ilist->end(); ++ilistiter) {
+      const Spline * spl = evg_driver.XSecSpline(*ilistiter);
+      if(!spl) continue;
+      for(int iknot=0; iknot<spl->NKnots(); iknot++) {
+        double eknot = spl->GetKnotX(iknot);
+        if(eknot >= gEmin && eknot <= gEmax) energies.push_back(eknot);
+      }
+    }
+    std::sort(energies.begin(), energies.end());
+    energies.erase(
+       std::unique(energies.begin(), energies.end()), energies.end());
+  }
+  if(energies.size() < 2) {
+    energies.resize(kNSplineP);
+    double de = (gEmax-gEmin)/(kNSplineP-1);
+    for(int i=0; i<kNSplineP; i++) {  energies[i] = gEmin + i*de; }
+  }
+  const int np = energies.size();
+  double * e = &energies[0];
 
-  double * xs = new double[kNSplineP];
+  //-- evaluate all splines once, at all energies
+  map<const Interaction *, vector<double> > xsec_table;
+  EvaluateXSecSplines(evg_driver, energies, xsec_table);
 
-  InteractionList::const_iterator ilistiter = ilist->begin();
+  ilistiter = ilist->begin();
 
   for(; ilistiter != ilist->end(); ++ilistiter) {
 
@@ -659,11 +716,9 @@ void SaveGraphsToRootFile(void)
     }
 
     const Spline * spl = evg_driver.XSecSpline(interaction);
-    for(int i=0; i<kNSplineP; i++) {
-      xs[i] = spl->Evaluate(e[i]) * (1E+38/units::cm2);
-    }
+    const double * xs = &xsec_table[interaction][0];
 
-    TGraph * gr = new TGraph(kNSplineP, e, xs);
+    TGraph * gr = new TGraph(np, e, xs);
     gr->SetName(title.str().c_str());
     FormatXSecGraph(gr);
     gr->SetTitle(spl->GetName());
@@ -684,11 +739,11 @@ void SaveGraphsToRootFile(void)
     // add-up all res channels
     //
 
-    double * xsresccp = new double[kNSplineP];
-    double * xsresccn = new double[kNSplineP];
-    double * xsresncp = new double[kNSplineP];
-    double * xsresncn = new double[kNSplineP];
-    for(int i=0; i<kNSplineP; i++) {
+    double * xsresccp = new double[np];
+    double * xsresccn = new double[np];
+    double * xsresncp = new double[np];
+    double * xsresncn = new double[np];
+    for(int i=0; i<np; i++) {
        xsresccp[i] = 0;
        xsresccn[i] = 0;
        xsresncp[i] = 0;
@@ -701,43 +756,43 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const double * xsec = &xsec_table[interaction][0];
 
        if (proc.IsResonant() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsresccp[i] += xsec[i];
          }
        }
        if (proc.IsResonant() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsresccn[i] += xsec[i];
          }
        }
        if (proc.IsResonant() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsresncp[i] += xsec[i];
          }
        }
        if (proc.IsResonant() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsresncn[i] += xsec[i];
          }
        }
     }
 
-    TGraph * gr_resccp = new TGraph(kNSplineP, e, xsresccp);
+    TGraph * gr_resccp = new TGraph(np, e, xsresccp);
     gr_resccp->SetName("res_cc_p");
     FormatXSecGraph(gr_resccp);
     topdir->Add(gr_resccp);
-    TGraph * gr_resccn = new TGraph(kNSplineP, e, xsresccn);
+    TGraph * gr_resccn = new TGraph(np, e, xsresccn);
     gr_resccn->SetName("res_cc_n");
     FormatXSecGraph(gr_resccn);
     topdir->Add(gr_resccn);
-    TGraph * gr_resncp = new TGraph(kNSplineP, e, xsresncp);
+    TGraph * gr_resncp = new TGraph(np, e, xsresncp);
     gr_resncp->SetName("res_nc_p");
     FormatXSecGraph(gr_resncp);
     topdir->Add(gr_resncp);
-    TGraph * gr_resncn = new TGraph(kNSplineP, e, xsresncn);
+    TGraph * gr_resncn = new TGraph(np, e, xsresncn);
     gr_resncn->SetName("res_nc_n");
     FormatXSecGraph(gr_resncn);
     topdir->Add(gr_resncn);
@@ -746,11 +801,11 @@ void SaveGraphsToRootFile(void)
     // add-up all dis channels
     //
 
-    double * xsdisccp = new double[kNSplineP];
-    double * xsdisccn = new double[kNSplineP];
-    double * xsdisncp = new double[kNSplineP];
-    double * xsdisncn = new double[kNSplineP];
-    for(int i=0; i<kNSplineP; i++) {
+    double * xsdisccp = new double[np];
+    double * xsdisccn = new double[np];
+    double * xsdisncp = new double[np];
+    double * xsdisncn = new double[np];
+    for(int i=0; i<np; i++) {
        xsdisccp[i] = 0;
        xsdisccn[i] = 0;
        xsdisncp[i] = 0;
@@ -763,44 +818,44 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const double * xsec = &xsec_table[interaction][0];
 
        if(xcls.IsCharmEvent()) continue;
 
        if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsdisccp[i] += xsec[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsdisccn[i] += xsec[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsdisncp[i] += xsec[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsdisncn[i] += xsec[i];
          }
        }
     }
-    TGraph * gr_disccp = new TGraph(kNSplineP, e, xsdisccp);
+    TGraph * gr_disccp = new TGraph(np, e, xsdisccp);
     gr_disccp->SetName("dis_cc_p");
     FormatXSecGraph(gr_disccp);
     topdir->Add(gr_disccp);
-    TGraph * gr_disccn = new TGraph(kNSplineP, e, xsdisccn);
+    TGraph * gr_disccn = new TGraph(np, e, xsdisccn);
     gr_disccn->SetName("dis_cc_n");
     FormatXSecGraph(gr_disccn);
     topdir->Add(gr_disccn);
-    TGraph * gr_disncp = new TGraph(kNSplineP, e, xsdisncp);
+    TGraph * gr_disncp = new TGraph(np, e, xsdisncp);
     gr_disncp->SetName("dis_nc_p");
     FormatXSecGraph(gr_disncp);
     topdir->Add(gr_disncp);
-    TGraph * gr_disncn = new TGraph(kNSplineP, e, xsdisncn);
+    TGraph * gr_disncn = new TGraph(np, e, xsdisncn);
     gr_disncn->SetName("dis_nc_n");
     FormatXSecGraph(gr_disncn);
     topdir->Add(gr_disncn);
@@ -809,7 +864,7 @@ void SaveGraphsToRootFile(void)
     // add-up all charm dis channels
     //
 
-    for(int i=0; i<kNSplineP; i++) {
+    for(int i=0; i<np; i++) {
       xsdisccp[i] = 0;
       xsdisccn[i] = 0;
       xsdisncp[i] = 0;
@@ -822,44 +877,44 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const double * xsec = &xsec_table[interaction][0];
 
       if(!xcls.IsCharmEvent()) continue;
 
       if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsProton(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xsdisccp[i] += xsec[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsWeakCC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xsdisccn[i] += xsec[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsProton(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xsdisncp[i] += xsec[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsWeakNC() && pdg::IsNeutron(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xsdisncn[i] += xsec[i];
         }
       }
     }
-    TGraph * gr_disccp_charm = new TGraph(kNSplineP, e, xsdisccp);
+    TGraph * gr_disccp_charm = new TGraph(np, e, xsdisccp);
     gr_disccp_charm->SetName("dis_cc_p_charm");
     FormatXSecGraph(gr_disccp_charm);
     topdir->Add(gr_disccp_charm);
-    TGraph * gr_disccn_charm = new TGraph(kNSplineP, e, xsdisccn);
+    TGraph * gr_disccn_charm = new TGraph(np, e, xsdisccn);
     gr_disccn_charm->SetName("dis_cc_n_charm");
     FormatXSecGraph(gr_disccn_charm);
     topdir->Add(gr_disccn_charm);
-    TGraph * gr_disncp_charm = new TGraph(kNSplineP, e, xsdisncp);
+    TGraph * gr_disncp_charm = new TGraph(np, e, xsdisncp);
     gr_disncp_charm->SetName("dis_nc_p_charm");
     FormatXSecGraph(gr_disncp_charm);
     topdir->Add(gr_disncp_charm);
-    TGraph * gr_disncn_charm = new TGraph(kNSplineP, e, xsdisncn);
+    TGraph * gr_disncn_charm = new TGraph(np, e, xsdisncn);
     gr_disncn_charm->SetName("dis_nc_n_charm");
     FormatXSecGraph(gr_disncn_charm);
     topdir->Add(gr_disncn_charm);
@@ -868,9 +923,9 @@ void SaveGraphsToRootFile(void)
     // add-up all mec channels
     //
 
-    double * xsmeccc = new double[kNSplineP];
-    double * xsmecnc = new double[kNSplineP];
-    for(int i=0; i<kNSplineP; i++) {
+    double * xsmeccc = new double[np];
+    double * xsmecnc = new double[np];
+    for(int i=0; i<np; i++) {
        xsmeccc[i] = 0;
        xsmecnc[i] = 0;
     }
@@ -879,25 +934,25 @@ void SaveGraphsToRootFile(void)
        const Interaction * interaction = *ilistiter;
        const ProcessInfo &  proc = interaction->ProcInfo();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const double * xsec = &xsec_table[interaction][0];
 
        if (proc.IsMEC() && proc.IsWeakCC()) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsmeccc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsmeccc[i] += xsec[i];
          }
        }
        if (proc.IsMEC() && proc.IsWeakNC()) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsmecnc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsmecnc[i] += xsec[i];
          }
        }
     }
 
-    TGraph * gr_meccc = new TGraph(kNSplineP, e, xsmeccc);
+    TGraph * gr_meccc = new TGraph(np, e, xsmeccc);
     gr_meccc->SetName("mec_cc");
     FormatXSecGraph(gr_meccc);
     topdir->Add(gr_meccc);
-    TGraph * gr_mecnc = new TGraph(kNSplineP, e, xsmecnc);
+    TGraph * gr_mecnc = new TGraph(np, e, xsmecnc);
     gr_mecnc->SetName("mec_nc");
     FormatXSecGraph(gr_mecnc);
     topdir->Add(gr_mecnc);
@@ -905,13 +960,13 @@ void SaveGraphsToRootFile(void)
     //
     // total cross sections
     //
-    double * xstotcc  = new double[kNSplineP];
-    double * xstotccp = new double[kNSplineP];
-    double * xstotccn = new double[kNSplineP];
-    double * xstotnc  = new double[kNSplineP];
-    double * xstotncp = new double[kNSplineP];
-    double * xstotncn = new double[kNSplineP];
-    for(int i=0; i<kNSplineP; i++) {
+    double * xstotcc  = new double[np];
+    double * xstotccp = new double[np];
+    double * xstotccn = new double[np];
+    double * xstotnc  = new double[np];
+    double * xstotncp = new double[np];
+    double * xstotncn = new double[np];
+    for(int i=0; i<np; i++) {
       xstotcc [i] = 0;
       xstotccp[i] = 0;
       xstotccn[i] = 0;
@@ -925,7 +980,7 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const double * xsec = &xsec_table[interaction][0];
 
       bool iscc = proc.IsWeakCC();
       bool isnc = proc.IsWeakNC();
@@ -933,65 +988,63 @@ void SaveGraphsToRootFile(void)
       bool offn = pdg::IsNeutron(tgt.HitNucPdg());
 
       if (iscc && offp) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotccp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotccp[i] += xsec[i];
         }
       }
       if (iscc && offn) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotccn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotccn[i] += xsec[i];
         }
       }
       if (isnc && offp) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotncp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotncp[i] += xsec[i];
         }
       }
       if (isnc && offn) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotncn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotncn[i] += xsec[i];
         }
       }
 
       if (iscc) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotcc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotcc[i] += xsec[i];
         }
       }
       if (isnc) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotnc[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotnc[i] += xsec[i];
         }
       }
     }
 
-    TGraph * gr_totcc = new TGraph(kNSplineP, e, xstotcc);
+    TGraph * gr_totcc = new TGraph(np, e, xstotcc);
     gr_totcc->SetName("tot_cc");
     FormatXSecGraph(gr_totcc);
     topdir->Add(gr_totcc);
-    TGraph * gr_totccp = new TGraph(kNSplineP, e, xstotccp);
+    TGraph * gr_totccp = new TGraph(np, e, xstotccp);
     gr_totccp->SetName("tot_cc_p");
     FormatXSecGraph(gr_totccp);
     topdir->Add(gr_totccp);
-    TGraph * gr_totccn = new TGraph(kNSplineP, e, xstotccn);
+    TGraph * gr_totccn = new TGraph(np, e, xstotccn);
     gr_totccn->SetName("tot_cc_n");
     FormatXSecGraph(gr_totccn);
     topdir->Add(gr_totccn);
-    TGraph * gr_totnc = new TGraph(kNSplineP, e, xstotnc);
+    TGraph * gr_totnc = new TGraph(np, e, xstotnc);
     gr_totnc->SetName("tot_nc");
     FormatXSecGraph(gr_totnc);
     topdir->Add(gr_totnc);
-    TGraph * gr_totncp = new TGraph(kNSplineP, e, xstotncp);
+    TGraph * gr_totncp = new TGraph(np, e, xstotncp);
     gr_totncp->SetName("tot_nc_p");
     FormatXSecGraph(gr_totncp);
     topdir->Add(gr_totncp);
-    TGraph * gr_totncn = new TGraph(kNSplineP, e, xstotncn);
+    TGraph * gr_totncn = new TGraph(np, e, xstotncn);
     gr_totncn->SetName("tot_nc_n");
     FormatXSecGraph(gr_totncn);
     topdir->Add(gr_totncn);
 
-    delete [] e;
-    delete [] xs;
     delete [] xsresccp;
     delete [] xsresccn;
     delete [] xsresncp;
@@ -1022,9 +1075,9 @@ void SaveGraphsToRootFile(void)
     // add-up all res channels
     //
 
-    double * xsresemp = new double[kNSplineP];
-    double * xsresemn = new double[kNSplineP];
-    for(int i=0; i<kNSplineP; i++) {
+    double * xsresemp = new double[np];
+    double * xsresemn = new double[np];
+    for(int i=0; i<np; i++) {
        xsresemp[i] = 0;
        xsresemn[i] = 0;
     }
@@ -1035,25 +1088,25 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const double * xsec = &xsec_table[interaction][0];
 
        if (proc.IsResonant() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsresemp[i] += xsec[i];
          }
        }
        if (proc.IsResonant() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsresemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsresemn[i] += xsec[i];
          }
        }
     }
 
-    TGraph * gr_resemp = new TGraph(kNSplineP, e, xsresemp);
+    TGraph * gr_resemp = new TGraph(np, e, xsresemp);
     gr_resemp->SetName("res_em_p");
     FormatXSecGraph(gr_resemp);
     topdir->Add(gr_resemp);
-    TGraph * gr_resemn = new TGraph(kNSplineP, e, xsresemn);
+    TGraph * gr_resemn = new TGraph(np, e, xsresemn);
     gr_resemn->SetName("res_em_n");
     FormatXSecGraph(gr_resemn);
     topdir->Add(gr_resemn);
@@ -1062,9 +1115,9 @@ void SaveGraphsToRootFile(void)
     // add-up all dis channels
     //
 
-    double * xsdisemp = new double[kNSplineP];
-    double * xsdisemn = new double[kNSplineP];
-    for(int i=0; i<kNSplineP; i++) {
+    double * xsdisemp = new double[np];
+    double * xsdisemn = new double[np];
+    for(int i=0; i<np; i++) {
        xsdisemp[i] = 0;
        xsdisemn[i] = 0;
     }
@@ -1075,26 +1128,26 @@ void SaveGraphsToRootFile(void)
        const InitialState & init = interaction->InitState();
        const Target &       tgt  = init.Tgt();
 
-       const Spline * spl = evg_driver.XSecSpline(interaction);
+       const double * xsec = &xsec_table[interaction][0];
 
        if(xcls.IsCharmEvent()) continue;
 
        if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsdisemp[i] += xsec[i];
          }
        }
        if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
-         for(int i=0; i<kNSplineP; i++) {
-             xsdisemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+         for(int i=0; i<np; i++) {
+             xsdisemn[i] += xsec[i];
          }
        }
     }
-    TGraph * gr_disemp = new TGraph(kNSplineP, e, xsdisemp);
+    TGraph * gr_disemp = new TGraph(np, e, xsdisemp);
     gr_disemp->SetName("dis_em_p");
     FormatXSecGraph(gr_disemp);
     topdir->Add(gr_disemp);
-    TGraph * gr_disemn = new TGraph(kNSplineP, e, xsdisemn);
+    TGraph * gr_disemn = new TGraph(np, e, xsdisemn);
     gr_disemn->SetName("dis_em_n");
     FormatXSecGraph(gr_disemn);
     topdir->Add(gr_disemn);
@@ -1103,7 +1156,7 @@ void SaveGraphsToRootFile(void)
     // add-up all charm dis channels
     //
 
-    for(int i=0; i<kNSplineP; i++) {
+    for(int i=0; i<np; i++) {
       xsdisemp[i] = 0;
       xsdisemn[i] = 0;
     }
@@ -1114,26 +1167,26 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const double * xsec = &xsec_table[interaction][0];
 
       if(!xcls.IsCharmEvent()) continue;
 
       if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsProton(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xsdisemp[i] += xsec[i];
         }
       }
       if (proc.IsDeepInelastic() && proc.IsEM() && pdg::IsNeutron(tgt.HitNucPdg())) {
-        for(int i=0; i<kNSplineP; i++) {
-            xsdisemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xsdisemn[i] += xsec[i];
         }
       }
     }
-    TGraph * gr_disemp_charm = new TGraph(kNSplineP, e, xsdisemp);
+    TGraph * gr_disemp_charm = new TGraph(np, e, xsdisemp);
     gr_disemp_charm->SetName("dis_em_p_charm");
     FormatXSecGraph(gr_disemp_charm);
     topdir->Add(gr_disemp_charm);
-    TGraph * gr_disemn_charm = new TGraph(kNSplineP, e, xsdisemn);
+    TGraph * gr_disemn_charm = new TGraph(np, e, xsdisemn);
     gr_disemn_charm->SetName("dis_em_n_charm");
     FormatXSecGraph(gr_disemn_charm);
     topdir->Add(gr_disemn_charm);
@@ -1141,10 +1194,10 @@ void SaveGraphsToRootFile(void)
     //
     // total cross sections
     //
-    double * xstotem  = new double[kNSplineP];
-    double * xstotemp = new double[kNSplineP];
-    double * xstotemn = new double[kNSplineP];
-    for(int i=0; i<kNSplineP; i++) {
+    double * xstotem  = new double[np];
+    double * xstotemp = new double[np];
+    double * xstotemn = new double[np];
+    for(int i=0; i<np; i++) {
       xstotem [i] = 0;
       xstotemp[i] = 0;
       xstotemn[i] = 0;
@@ -1155,44 +1208,42 @@ void SaveGraphsToRootFile(void)
       const InitialState & init = interaction->InitState();
       const Target &       tgt  = init.Tgt();
 
-      const Spline * spl = evg_driver.XSecSpline(interaction);
+      const double * xsec = &xsec_table[interaction][0];
 
       bool isem = proc.IsEM();
       bool offp = pdg::IsProton (tgt.HitNucPdg());
       bool offn = pdg::IsNeutron(tgt.HitNucPdg());
 
       if (isem && offp) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotemp[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotemp[i] += xsec[i];
         }
       }
       if (isem && offn) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotemn[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotemn[i] += xsec[i];
         }
       }
       if (isem) {
-        for(int i=0; i<kNSplineP; i++) {
-            xstotem[i] += (spl->Evaluate(e[i]) * (1E+38/units::cm2));
+        for(int i=0; i<np; i++) {
+            xstotem[i] += xsec[i];
         }
       }
     }
 
-    TGraph * gr_totem = new TGraph(kNSplineP, e, xstotem);
+    TGraph * gr_totem = new TGraph(np, e, xstotem);
     gr_totem->SetName("tot_em");
     FormatXSecGraph(gr_totem);
     topdir->Add(gr_totem);
-    TGraph * gr_totemp = new TGraph(kNSplineP, e, xstotemp);
+    TGraph * gr_totemp = new TGraph(np, e, xstotemp);
     gr_totemp->SetName("tot_em_p");
     FormatXSecGraph(gr_totemp);
     topdir->Add(gr_totemp);
-    TGraph * gr_totemn = new TGraph(kNSplineP, e, xstotemn);
+    TGraph * gr_totemn = new TGraph(np, e, xstotemn);
     gr_totemn->SetName("tot_em_n");
     FormatXSecGraph(gr_totemn);
     topdir->Add(gr_totemn);
 
-    delete [] e;
-    delete [] xs;
     delete [] xsresemp;
     delete [] xsresemn;
     delete [] xsdisemp;
@@ -1317,7 +1368,14 @@ void GetCommandLineArgs(int argc, char ** argv)
   gWriteOutPlots = parser.OptionExists('w');
 
   // use same abscissa points as splines
-  //not yet//gKeepSplineKnots = parser.OptionExists('k');
+  gKeepSplineKnots = parser.OptionExists('k');
+
+  // number of threads
+  if( parser.OptionExists("threads") ) {
+    gOptNThreads = TMath::Max(1, parser.ArgAsInt("threads"));
+  } else {
+    gOptNThreads = 1;
+  }
 
 
   gEmin  = kEmin;
@@ -1330,7 +1388,8 @@ void GetCommandLineArgs(int argc, char ** argv)
   LOG("gspl2root", pINFO) << "  Probe PDG code  = " << gOptProbePdgCode;
   LOG("gspl2root", pINFO) << "  Target PDG code = " << gOptTgtPdgCode;
   LOG("gspl2root", pINFO) << "  Max neutrino E  = " << gOptNuEnergy;
-  //not yet//LOG("gspl2root", pINFO) << "  Keep spline knots  = " << (gKeepSplineKnots?"true":"false");
+  LOG("gspl2root", pINFO) << "  Keep spline knots = " << (gKeepSplineKnots?"true":"false");
+  LOG("gspl2root", pINFO) << "  Threads         = " << gOptNThreads;
 }
 //____________________________________________________________________________
 void PrintSyntax(void)
@@ -1338,7 +1397,8 @@ void PrintSyntax(void)
   LOG("gspl2root", pNOTICE)
       << "\n\n" << "Syntax:" << "\n"
       << "   gspl2root -f xml_file -p probe_pdg -t target_pdg"
-      << "            [-e emax] [-o output_root_file] [-w]\n"
+      << "            [-e emax] [-o output_root_file] [-w] [-k]\n"
+      << "            [--threads n]\n"
       << "            [--message-thresholds xml_file]\n";
 }
 //____________________________________________________________________________
@@ -1356,3 +1416,63 @@ PDGCodeList GetPDGCodeListFromString(std::string s)
 
 }
 //____________________________________________________________________________
+void EvaluateXSecSplines(const GEVGDriver & evg_driver,
+   const vector<double> & e, map<const Interaction *, vector<double> > & xsec)
+{
+// Evaluate the cross section spline of each interaction of the driver at the
+// input energies (in 1E-38 cm^2), so that the graphs of the individual
+// channels and of all totals are built from a single evaluation per spline.
+// The splines are split in as many slices as the requested threads.
+// The driver configuration itself goes through the shared algorithm
+// registries and is kept sequential (one initial state at a time).
+
+  const InteractionList * ilist = evg_driver.Interactions();
+  int np = e.size();
+
+  vector<const Spline *>   splines;
+  vector<vector<double> *> outputs;
+  InteractionList::const_iterator ilistiter = ilist->begin();
+  for(; ilistiter != ilist->end(); ++ilistiter) {
+    const Interaction * interaction = *ilistiter;
+    vector<double> & xs = xsec[interaction];
+    xs.assign(np, 0.);
+    const Spline * spl = evg_driver.XSecSpline(interaction);
+    if(!spl) {
+      LOG("gspl2root", pWARN)
+         << "Can't get spline for: " << interaction->AsString();
+      continue;
+    }
+    // builds the (lazily computed) interpolation coefficients in this thread
+    spl->Evaluate(e[0]);
+    splines.push_back(spl);
+    outputs.push_back(&xs);
+  }
+  int nspl = splines.size();
+  if(nspl == 0) return;
+
+  int nthreads = TMath::Min(gOptNThreads, nspl);
+  vector<XSecSplineSlice_t> slices(nthreads);
+  int nslice = (nspl + nthreads - 1) / nthreads;
+  for(int it = 0; it < nthreads; it++) {
+    int first = TMath::Min(it*nslice, nspl);
+    slices[it].splines = &splines[0] + first;
+    slices[it].xsec    = &outputs[0] + first;
+    slices[it].e       = &e[0];
+    slices[it].np      = np;
+    slices[it].n       = TMath::Min(nslice, nspl-first);
+  }
+  // the first slice is evaluated in this thread, as is any slice whose
+  // thread could not be started
+  vector<pthread_t> threads(nthreads);
+  vector<bool>      started(nthreads, false);
+  for(int it = 1; it < nthreads; it++) {
+    started[it] = (pthread_create(
+      &threads[it], 0, EvaluateXSecSplineSlice, &slices[it]) == 0);
+  }
+  EvaluateXSecSplineSlice(&slices[0]);
+  for(int it = 1; it < nthreads; it++) {
+    if(started[it]) pthread_join(threads[it], 0);
+    else            EvaluateXSecSplineSlice(&slices[it]);
+  }
+}
+//____________________________________________________________________________
@@ -24,6 +24,8 @@
                       [-t top_volume_name_at_geom || -t +Vol1-Vol2...]
                       [-P pre_gen_prob_file_name]
                       [-S] [output_name]
+                      [--flux-prob-slice islice/nslices]
+                      [--importance-sample-flux]
                       [-m max_path_lengths_xml_file]
                       [-L length_units_at_geom]
                       [-D density_units_at_geom]
@@ -39,7 +41,9 @@
                       [--unphysical-event-mask mask]
                       [--event-record-print-level level]
                       [--mc-job-status-refresh-rate  rate]
-                      [--cache-file root_file]
+                      [--cache-file root_file] [--cache-read-only]
+                      [--artifact-store directory]
+                      [--xsec-bias selector:factor,...]
 
          *** Options :
 
@@ -97,6 +101,9 @@
               via this option) corresponding to the flux file input in this job.
               For complex geometries this will dramatically speed up event generation!
               If this option is chosen then no max path length file needs to be provided.
+              With the --artifact-store option the file name can be omitted:
+              The probabilities are then read from the store or, for the first
+              job with the given setup, calculated and added to it.
               Instead of calculating the interaction probabilities on the fly
               per job you can pre-generate them using a dedicated job (see the
               -S option) and tell the event generator to use them via the -P option.
@@ -120,6 +127,20 @@
               Introducing multiple functionality to the executable is not
               desirable but is less error prone than duplicating a lot of the
               functionality in a separate application.
+           --flux-prob-slice
+              Used together with the -S option, to split the pre-generation
+              of flux interaction probabilities for large flux files across
+              nslices jobs: The current job handles every nslices-th flux
+              entry, starting from entry islice (0 <= islice < nslices).
+              The output files of all slices must be merged (eg using hadd)
+              into a single file before being used via the -P option.
+           --importance-sample-flux
+              Used together with the -P option: Rather than reading all flux
+              entries in sequence and rejecting most of them, sample the flux
+              entries directly according to their pre-calculated interaction 
+              probability times their flux weight, so that every sampled flux
+              neutrino interacts. The requested POT exposure is converted to
+              a number of events using the pre-calculated probabilities.
            -m
               An XML file (generated by gmxpl) with the max (density weighted)
               path-lengths for each target material in the input ROOT geometry.
@@ -319,6 +340,27 @@
            --cache-file
               Allows users to specify a cache file so that the cache can be
               re-used in subsequent MC jobs.
+           --cache-read-only
+              Use the cache file only to warm-start the job, without writing
+              it back. Many concurrent jobs can share a read-only cache file.
+           --xsec-bias
+              Bias the selection of rare processes, with a comma-separated list
+              of <selector>:<factor> entries, eg COH:20,1Kaon:100: The cross
+              section of the matching interactions is multiplied by the factor
+              when selecting the interaction to generate, and the event weight
+              compensates for it (the total cross section and the exposure are
+              not changed). A selector is a scattering type, or, if it contains
+              a ':', a part of the interaction string (eg proc:Weak[CC],RES).
+              See PhysInteractionSelector.
+           --artifact-store
+              A directory where the maximum path-lengths of the input geometry
+              and the pre-calculated flux interaction probabilities are stored,
+              keyed by the job setup (geometry contents, top volume, units, flux
+              files, detector location and flavours and, for the probabilities,
+              the tune, event generator list and cross sections). Jobs with the
+              same setup read them back instead of computing them again. With
+              the store, -P can be given without a file name. Many concurrent
+              jobs can share the store. See GMCJArtifactStore.
 
          *** Examples:
 
@@ -433,6 +475,7 @@
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GMCJDriver.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GMCJArtifactStore.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/ParticleData/PDGLibrary.h"
@@ -504,6 +547,9 @@ bool            gOptUseFluxProbs = false;      // use pre-calculated flux intera
 bool            gOptSaveFluxProbsFile = false; // special mode: no events generated, calculate and save flux interaction probs to root file
 string          gOptFluxProbFileName;          // filename for file containg flux probs
 string          gOptSaveFluxProbsFileName;     // output filename for pre-generated flux probabilities
+unsigned int    gOptFluxProbSlice = 0;         // slice of flux entries for which flux probs are pre-generated
+unsigned int    gOptNFluxProbSlices = 1;       // number of slices in which the flux probs pre-generation is split
+bool            gOptImportanceSampleFlux = false; // sample flux entries using the pre-calculated flux probs
 bool            gOptRandomFluxOffset = false;  // start looping over flux file from random start entry
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
@@ -524,7 +570,8 @@ int main(int argc, char ** argv)
   // Initialization of random number generators, cross-section table,
   // messenger thresholds, cache file
   utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
-  utils::app_init::CacheFile(RunOpt::Instance()->CacheFile());
+  utils::app_init::CacheFile(
+     RunOpt::Instance()->CacheFile(), RunOpt::Instance()->CacheReadOnly());
   utils::app_init::RandGen(gOptRanSeed);
   utils::app_init::XSecTable(gOptInpXSecFile, true);
 
@@ -651,12 +698,33 @@ int main(int argc, char ** argv)
   mcj_driver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
   mcj_driver->UseFluxDriver(flux_driver);
   mcj_driver->UseGeomAnalyzer(geom_driver);
-  mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
+
+  // the max path lengths are read from the input XML file or, if none was
+  // given, from the artifact store (if any) where jobs with the same geometry
+  // setup left them
+  GMCJArtifactStore artifacts(RunOpt::Instance()->ArtifactStore());
+  if(gOptUsingRootGeom) {
+    artifacts.AddFileKey("geom",   gOptRootGeom);
+    artifacts.AddKey    ("topvol", gOptRootGeomTopVol);
+    artifacts.AddKey    ("lunits", gOptGeomLUnits);
+    artifacts.AddKey    ("dunits", gOptGeomDUnits);
+  } else {
+    ostringstream tgtmix;
+    map<int,double>::const_iterator tgt_iter = gOptTgtMix.begin();
+    for( ; tgt_iter != gOptTgtMix.end(); ++tgt_iter) {
+      tgtmix << tgt_iter->first << "[" << tgt_iter->second << "] ";
+    }
+    artifacts.AddKey("tgtmix", tgtmix.str());
+  }
+  if(gOptExtMaxPlXml.size() > 0) mcj_driver->UseMaxPathLengths(gOptExtMaxPlXml);
+  else artifacts.UseMaxPathLengths(mcj_driver);
+
   // do not calculate probability scales if using pre-generated flux probs
   bool calc_prob_scales = (gOptSaveFluxProbsFile || gOptUseFluxProbs) ? false : true;
   mcj_driver->Configure(calc_prob_scales);
   mcj_driver->UseSplines();
   mcj_driver->ForceSingleProbScale();
+  artifacts.SaveMaxPathLengths(mcj_driver);
 
   // *************************************************************************
   // * If specified use pre-calculated flux interaction probabilities instead
@@ -680,12 +748,25 @@ int main(int argc, char ** argv)
       if(gOptSaveFluxProbsFileName.size()>0) name = gOptSaveFluxProbsFileName;
       // Tell the driver save pre-generated probabilities to an output file
       mcj_driver->SaveFluxProbabilities(name);
+      mcj_driver->SetFluxProbabilitiesSlice(gOptFluxProbSlice, gOptNFluxProbSlices);
     }
 
     // Either load pre-generated flux probabilities
     if(gOptFluxProbFileName.size() > 0){
       success = mcj_driver->LoadFluxProbabilities(gOptFluxProbFileName);
     }
+    // Or take them from the artifact store, where they are added if missing
+    else if(gOptUseFluxProbs){
+      ostringstream nulist;
+      nulist << gOptFluxNtpNuList;
+      artifacts.AddFilesKey("flux",     gOptFluxFile);
+      artifacts.AddKey     ("location", gOptDetectorLocation);
+      artifacts.AddKey     ("flavours", nulist.str());
+      artifacts.AddKey     ("tune",     RunOpt::Instance()->Tune()->Name());
+      artifacts.AddKey     ("evgenlist",RunOpt::Instance()->EventGeneratorList());
+      artifacts.AddFileKey ("xsec",     gOptInpXSecFile);
+      success = artifacts.PreCalcFluxProbabilities(mcj_driver);
+    }
     // Or pre-calculate them
     else success = mcj_driver->PreCalcFluxProbabilities();
 
@@ -726,6 +807,25 @@ int main(int argc, char ** argv)
       return 1;
     }
 
+    // Sample interacting flux neutrinos directly. The flux driver cycles no 
+    // longer measure the exposure: Convert the requested POT to events.
+    if(gOptImportanceSampleFlux){
+      mcj_driver->UseFluxImportanceSampling(true);
+      if(gOptPOT > 0) {
+        double ntot_per_pot = 0.0;
+        map<int, double> sum_probs_map = mcj_driver->SumFluxIntProbs();
+        map<int, double>::const_iterator sum_probs_it = sum_probs_map.begin();
+        for(; sum_probs_it != sum_probs_map.end(); sum_probs_it++){
+          ntot_per_pot += sum_probs_it->second / jparc_flux_driver->POT_1cycle();
+        }
+        gOptNev = (int) TMath::Max(1., TMath::Floor(gOptPOT*ntot_per_pot + 0.5));
+        gOptPOT = -1;
+        LOG("gevgen_t2k", pNOTICE)
+          << "Importance sampling flux neutrinos: Will generate " << gOptNev 
+          << " events for the requested POT";
+      }
+    }
+
     // Exit now if just pre-generating interaction probabilities
     if(gOptSaveFluxProbsFile){
       LOG("gevgen_t2k", pNOTICE)
@@ -921,6 +1021,7 @@ int main(int argc, char ** argv)
   delete geom_driver;
   delete flux_driver;
   delete mcj_driver;
+  artifacts.Commit(); // the flux probabilities file is closed by now
   map<int,TH1D*>::iterator it = gOptFluxHst.begin();
   for( ; it != gOptFluxHst.end(); ++it) {
     TH1D * spectrum = it->second;
@@ -1221,6 +1322,10 @@ void GetCommandLineArgs(int argc, char ** argv)
         exit(1);
       }
     }
+    else if(RunOpt::Instance()->ArtifactStore().size() > 0){
+      // read from, or added to, the artifact store
+      gOptUseFluxProbs = true;
+    }
     else {
       LOG("gevgen_t2k", pFATAL)
         << "No flux interaction probabilites were specified - exiting";
@@ -1235,6 +1340,34 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptSaveFluxProbsFileName = parser.ArgAsString('S');
   }
 
+  // pre-generating interaction probs for a slice of the flux entries
+  if( parser.OptionExists("flux-prob-slice") ){
+    vector<string> slice = 
+       utils::str::Split(parser.ArgAsString("flux-prob-slice"), "/");
+    int islice  = (slice.size() == 2) ? atoi(slice[0].c_str()) : -1;
+    int nslices = (slice.size() == 2) ? atoi(slice[1].c_str()) : -1;
+    if(!gOptSaveFluxProbsFile || islice < 0 || nslices <= islice){
+      LOG("gevgen_t2k", pFATAL)
+       << "The --flux-prob-slice option requires -S and a valid "
+       << "islice/nslices argument!";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptFluxProbSlice   = islice;
+    gOptNFluxProbSlices = nslices;
+  }
+
+  // sampling flux entries using the pre-calculated interaction probs
+  if( parser.OptionExists("importance-sample-flux") ){
+    if(!gOptUseFluxProbs){
+      LOG("gevgen_t2k", pFATAL)
+       << "The --importance-sample-flux option requires -P!";
+      PrintSyntax();
+      exit(1);
+    }
+    gOptImportanceSampleFlux = true;
+  }
+
   // cannot save and run at the same time
   if(gOptUseFluxProbs && gOptSaveFluxProbsFile){
     LOG("gevgen_t2k", pFATAL)
@@ -1472,6 +1605,8 @@ void PrintSyntax(void)
    << "\n           [-t top_volume_name_at_geom]"
    << "\n           [-P pre_gen_prob_file]"
    << "\n           [-S] [output_name]"
+   << "\n           [--flux-prob-slice islice/nslices]"
+   << "\n           [--importance-sample-flux]"
    << "\n           [-m max_path_lengths_xml_file]"
    << "\n           [-L length_units_at_geom]"
    << "\n           [-D density_units_at_geom]"
@@ -1487,7 +1622,9 @@ void PrintSyntax(void)
    << "\n           [--unphysical-event-mask mask]"
    << "\n           [--event-record-print-level level]"
    << "\n           [--mc-job-status-refresh-rate  rate]"
-   << "\n           [--cache-file root_file]"
+   << "\n           [--cache-file root_file] [--cache-read-only]"
+   << "\n           [--artifact-store directory]"
+   << "\n           [--xsec-bias selector:factor,...]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
    << " or look at the source code: $GENIE/src/Apps/gT2KEvGen.cxx"
@@ -15,6 +15,7 @@
                         -g rock_composition
                        [--seed random_number_seed]
                         --cross-sections xml_file
+                       [--emu-pdf-cache root_file]
                        [--message-thresholds xml_file]
 
          *** Options :
@@ -57,6 +58,11 @@
            --cross-sections
               Name (incl. full path) of an XML file with pre-computed
               cross-section values used for constructing splines.
+           --emu-pdf-cache
+              Name of a ROOT file caching the 3-D Emu|Enu,costheta pdfs.
+              If the file exists and holds the pdfs computed for the tune in
+              use, they are read back rather than computed again, otherwise
+              they are computed and written in the file.
            --message-thresholds
               Allows users to customize the message stream thresholds.
               The thresholds are specified using an XML file.
@@ -97,10 +103,14 @@
 #include <vector>
 #include <sstream>
 #include <map>
+#include <algorithm>
 
 #include <TRotation.h>
 #include <TH1D.h>
 #include <TH3D.h>
+#include <TFile.h>
+#include <TSystem.h>
+#include <TNamed.h>
 #include <TTree.h>
 #include <TLorentzVector.h>
 
@@ -125,6 +135,7 @@
 #include "Framework/Utils/AppInit.h"
 #include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/TuneId.h"
 
 #ifdef __GENIE_FLUX_DRIVERS_ENABLED__
 #include "Tools/Flux/GFLUKAAtmoFlux.h"
@@ -135,17 +146,32 @@ using std::string;
 using std::vector;
 using std::map;
 using std::ostringstream;
+using std::upper_bound;
 
 using namespace genie;
 using namespace genie::flux;
 using namespace genie::constants;
 
+// Cumulative Emu distributions for each (Enu,costheta) bin of a 3-D pdf,
+// to select muon energies without projecting the pdf for every neutrino
+struct EmuSampler_t {
+  const TH3D *   pdf3d;
+  int            nEmu;     // # of Emu bins used
+  int            nEnu;
+  int            ncostheta;
+  vector<double> cdf;      // per (Enu,costheta) bin: nEmu+1 cumulative bin contents
+  vector<double> weight;   // per (Enu,costheta) bin: Emu pdf integral
+};
+
 void       GetCommandLineArgs     (int argc, char ** argv);
 void       PrintSyntax            (void);
 GFluxI *   GetFlux                (void);
 void       GenerateUpNu           (GFluxI * flux_driver);
+TH3D *     GetEmuEnuCosThetaPdf   (int nu_code);
 TH3D *     BuildEmuEnuCosThetaPdf (int nu_code);
-TH1D *     GetEmuPdf              (double Enu, double costheta, const TH3D* pdf3d);
+void       BuildEmuSampler        (const TH3D * pdf3d, EmuSampler_t & sampler);
+double     SelectEmu              (double Enu, double costheta,
+                                   const EmuSampler_t & sampler, double & weight);
 TVector3   GetDetectorVertex      (double CosTheta, double Enu);
 double     GetCrossSection        (int nu_code, double Enu, double Emu);
 double     ProbabilityEmu         (int nu_code, double Enu, double Emu);
@@ -159,6 +185,7 @@ int             gOptNev = -1;                  // exposure - in terms of number
 double          gOptDetectorSide;              // detector side length, in mm.
 long int        gOptRanSeed;                   // random number seed
 string          gOptInpXSecFile;               // cross-section splines
+string          gOptEmuPdfCacheFile;           // file caching the Emu|Enu,costheta pdfs
 
 // Constants
 const double a = 2e+6;           // a = 2 MeV / (g cm-2)
@@ -217,8 +244,14 @@ int main(int argc, char** argv)
 
   // Build 3-D pdfs describing the the probability of a muon neutrino (or anti-neutrino)
   // of energy Enu and zenith angle costheta producing a mu- (or mu+) of energy E_mu
-  TH3D * pdf3d_numu    = BuildEmuEnuCosThetaPdf (kPdgNuMu    );
-  TH3D * pdf3d_numubar = BuildEmuEnuCosThetaPdf (kPdgAntiNuMu);
+  TH3D * pdf3d_numu    = GetEmuEnuCosThetaPdf (kPdgNuMu    );
+  TH3D * pdf3d_numubar = GetEmuEnuCosThetaPdf (kPdgAntiNuMu);
+
+  // and the cumulative Emu distributions used for selecting the muon energy
+  EmuSampler_t sampler_numu;
+  EmuSampler_t sampler_numubar;
+  BuildEmuSampler(pdf3d_numu,    sampler_numu   );
+  BuildEmuSampler(pdf3d_numubar, sampler_numubar);
 
   // Up-going muon event loop
   for(brIev = 0; brIev < gOptNev; brIev++) {
@@ -238,13 +271,11 @@ int main(int argc, char** argv)
         << ", cos(theta) = " << brCosTheta
         << ", weight = " << brWghtFlxNu;
 
-    // Get Emu pdf my slicing the 3-D Enu,Emu,costheta pdf.
-    TH3D * pdf3d  = (brNuCode == kPdgNuMu) ? pdf3d_numu : pdf3d_numubar;
-    TH1D * pdfEmu = GetEmuPdf(brEnu,brCosTheta,pdf3d);
-
-    // Get a random Emu from the pdf, and get the weight for that Emu.
-    brEmu        = pdfEmu->GetRandom();
-    brWghtEmuPdf = pdfEmu->Integral("width");
+    // Get a random Emu from the Emu pdf of the Enu,costheta bin of the
+    // 3-D Enu,Emu,costheta pdf, and get the weight for that Emu.
+    const EmuSampler_t & sampler =
+         (brNuCode == kPdgNuMu) ? sampler_numu : sampler_numubar;
+    brEmu = SelectEmu(brEnu,brCosTheta,sampler,brWghtEmuPdf);
     LOG("gevgen_upmu", pNOTICE)
         << "Selected muon has energy Emu = " << brEmu
         << " and Emu pdg weight = " << brWghtEmuPdf;
@@ -264,9 +295,6 @@ int main(int argc, char** argv)
 
     // save all relevant values to the ntuple
     ntupmuflux->Fill();
-
-    // Clean-up
-    delete pdfEmu;
   }
 
   // Save the muon ntuple and calculate 3-D pdfs
@@ -432,6 +460,57 @@ void GenerateUpNu(GFluxI * flux_driver)
   }
 }
 //________________________________________________________________________________________
+TH3D * GetEmuEnuCosThetaPdf(int nu_code)
+{
+// Get the 3D Emu,Enu,CosTheta pdf from the --emu-pdf-cache file, if it is
+// there and was computed with the current tune, or build it (and write it
+// in the cache file, if any).
+
+  string name = (nu_code == kPdgNuMu) ? "pdf3d_numu" : "pdf3d_numubar";
+  string tune = RunOpt::Instance()->Tune()->Name();
+
+  if(gOptEmuPdfCacheFile.size() > 0 &&
+     ! gSystem->AccessPathName(gOptEmuPdfCacheFile.c_str()))
+  {
+    TFile cachef(gOptEmuPdfCacheFile.c_str(), "read");
+    TNamed * cache_tune = dynamic_cast<TNamed *> (cachef.Get("tune"));
+    TH3D *   cache_pdf  = dynamic_cast<TH3D *>   (cachef.Get(name.c_str()));
+    if(cache_tune && cache_pdf && tune == cache_tune->GetTitle()) {
+      LOG("gevgen_upmu", pNOTICE)
+         << "Read " << name << " from " << gOptEmuPdfCacheFile;
+      cache_pdf->SetDirectory(0);
+      cachef.Close();
+      return cache_pdf;
+    }
+    cachef.Close();
+    LOG("gevgen_upmu", pNOTICE)
+       << "No " << name << " for tune " << tune
+       << " in " << gOptEmuPdfCacheFile << " - Computing it";
+  }
+
+  TH3D * pdf3d = BuildEmuEnuCosThetaPdf(nu_code);
+  pdf3d->SetName(name.c_str());
+  pdf3d->SetDirectory(0);
+
+  if(gOptEmuPdfCacheFile.size() > 0) {
+    // drop the pdfs of any other tune
+    TFile cachef(gOptEmuPdfCacheFile.c_str(), "update");
+    TNamed * cache_tune = dynamic_cast<TNamed *> (cachef.Get("tune"));
+    if(cache_tune && tune != cache_tune->GetTitle()) {
+      cachef.Delete("*;*");
+      cache_tune = 0;
+    }
+    if(!cache_tune) {
+      TNamed tune_name("tune", tune.c_str());
+      tune_name.Write("tune", TObject::kOverwrite);
+    }
+    pdf3d->Write(name.c_str(), TObject::kOverwrite);
+    cachef.Close();
+  }
+
+  return pdf3d;
+}
+//________________________________________________________________________________________
 double ProbabilityEmu(int nu_code, double Enu, double Emu)
 {
 // Calculate the probability of an incoming neutrino of energy Enu
@@ -515,24 +594,65 @@ TH3D* BuildEmuEnuCosThetaPdf(int nu_code)
   return h3;
 }
 //________________________________________________________________________________________
-TH1D * GetEmuPdf(double Enu, double costheta, const TH3D* pdf3d)
+void BuildEmuSampler(const TH3D * pdf3d, EmuSampler_t & sampler)
 {
-  // Build 1-D Emu pdf
-  int Emu_nbins = pdf3d->GetXaxis()->GetNbins();
-  const double * Emu_bins = pdf3d->GetXaxis()->GetXbins()->GetArray();
-  TH1D * pdf_Emu = new TH1D("pdf_Emu","",Emu_nbins,Emu_bins);
-  pdf_Emu->SetDirectory(0);
-
-  // Find appropriate bins for Enu and CosTheta.
-  int Enu_bin      = pdf3d->GetYaxis()->FindBin(Enu);
-  int costheta_bin = pdf3d->GetZaxis()->FindBin(costheta);
-
-  // For those Enu and costheta bins, build Emu pdf
-  for (int Emu_bin = 1; Emu_bin < pdf_Emu->GetNbinsX(); Emu_bin++) {
-    pdf_Emu->SetBinContent(Emu_bin, pdf3d->GetBinContent(Emu_bin,Enu_bin,costheta_bin));
+// Tabulate the cumulative Emu distribution in each (Enu,costheta) bin.
+// As in BuildEmuEnuCosThetaPdf, the last Emu bin is not used.
+
+  sampler.pdf3d     = pdf3d;
+  sampler.nEmu      = pdf3d->GetXaxis()->GetNbins() - 1;
+  sampler.nEnu      = pdf3d->GetYaxis()->GetNbins();
+  sampler.ncostheta = pdf3d->GetZaxis()->GetNbins();
+
+  int nslices = sampler.nEnu * sampler.ncostheta;
+  sampler.cdf.assign(nslices * (sampler.nEmu+1), 0.);
+  sampler.weight.assign(nslices, 0.);
+
+  for (int j = 1; j <= sampler.nEnu; j++) {
+    for (int k = 1; k <= sampler.ncostheta; k++) {
+      int islice = (j-1)*sampler.ncostheta + (k-1);
+      double * cdf = &sampler.cdf[islice * (sampler.nEmu+1)];
+      double weight = 0;
+      for (int i = 1; i <= sampler.nEmu; i++) {
+        double content = pdf3d->GetBinContent(i,j,k);
+        cdf[i]  = cdf[i-1] + content;
+        weight += content * pdf3d->GetXaxis()->GetBinWidth(i);
+      }
+      sampler.weight[islice] = weight;
+    }
   }
+}
+//________________________________________________________________________________________
+double SelectEmu(
+   double Enu, double costheta, const EmuSampler_t & sampler, double & weight)
+{
+// Select a muon energy from the Emu pdf of the (Enu,costheta) bin, uniformly
+// within the selected Emu bin, and return the pdf integral as weight.
+// Outside the pdf range (or for an empty pdf) Emu and weight are 0.
+
+  weight = 0;
 
-  return pdf_Emu;
+  int Enu_bin      = sampler.pdf3d->GetYaxis()->FindBin(Enu);
+  int costheta_bin = sampler.pdf3d->GetZaxis()->FindBin(costheta);
+  if(Enu_bin      < 1 || Enu_bin      > sampler.nEnu     ) return 0;
+  if(costheta_bin < 1 || costheta_bin > sampler.ncostheta) return 0;
+
+  int islice = (Enu_bin-1)*sampler.ncostheta + (costheta_bin-1);
+  const double * cdf = &sampler.cdf[islice * (sampler.nEmu+1)];
+  double total = cdf[sampler.nEmu];
+  if(total <= 0) return 0;
+
+  weight = sampler.weight[islice];
+
+  RandomGen * rnd = RandomGen::Instance();
+  double r = total * rnd->RndGen().Rndm();
+
+  int i = upper_bound(cdf, cdf + sampler.nEmu + 1, r) - cdf;
+  i = TMath::Min(TMath::Max(i,1), sampler.nEmu);
+
+  const TAxis * Emu_axis = sampler.pdf3d->GetXaxis();
+  double u = (cdf[i] > cdf[i-1]) ? (r-cdf[i-1])/(cdf[i]-cdf[i-1]) : 1.;
+  return Emu_axis->GetBinLowEdge(i) + u * Emu_axis->GetBinWidth(i);
 }
 //________________________________________________________________________________________
 double GetCrossSection(int nu_code, double Enu, double Emu)
@@ -546,13 +666,10 @@ double GetCrossSection(int nu_code, double Enu, double Emu)
     dxsec_dxdy = 0;
   }
   else {
-    // get the algorithm factory & config pool
-    AlgFactory * algf = AlgFactory::Instance();
-
-    // instantiate some algorithms
-    AlgId id("genie::QPMDISPXSec","Default");
-    Algorithm * alg = algf->AdoptAlgorithm(id);
-    XSecAlgorithmI * xsecalg = dynamic_cast<XSecAlgorithmI*>(alg);
+    // get the cross section algorithm (once: this is called for every pdf bin)
+    static const XSecAlgorithmI * xsecalg =
+       dynamic_cast<const XSecAlgorithmI*> (
+          AlgFactory::Instance()->GetAlgorithm("genie::QPMDISPXSec","Default"));
 
     Interaction * vp = Interaction::DISCC(kPdgTgtFreeP, kPdgProton,  nu_code, Enu);
     Interaction * vn = Interaction::DISCC(kPdgTgtFreeN, kPdgNeutron, nu_code, Enu);
@@ -801,6 +918,16 @@ void GetCommandLineArgs(int argc, char ** argv)
     gOptInpXSecFile = "";
   }
 
+  //
+  // *** Emu pdf cache file
+  //
+  if( parser.OptionExists("emu-pdf-cache") ) {
+    LOG("gevgen_upmu", pINFO) << "Reading Emu pdf cache file";
+    gOptEmuPdfCacheFile = parser.ArgAsString("emu-pdf-cache");
+  } else {
+    gOptEmuPdfCacheFile = "";
+  }
+
 
   //
   // print-out summary
@@ -833,6 +960,7 @@ void GetCommandLineArgs(int argc, char ** argv)
      << "\n @@ Run number: " << gOptRunNu
      << "\n @@ Random number seed: " << gOptRanSeed
      << "\n @@ Using cross-section file: " << gOptInpXSecFile
+     << "\n @@ Using Emu pdf cache file: " << gOptEmuPdfCacheFile
      << "\n @@ Flux"
      << "\n\t" << fluxinfo.str()
      << "\n @@ Exposure"
@@ -851,6 +979,7 @@ void PrintSyntax(void)
    << "\n             [-d detector side length (mm)]"
    << "\n             [--seed random_number_seed]"
    << "\n              --cross-sections xml_file"
+   << "\n             [--emu-pdf-cache root_file]"
    << "\n            [--message-thresholds xml_file]"
    << "\n"
    << " Please also read the detailed documentation at http://www.genie-mc.org"
@@ -22,6 +22,12 @@
    Use the GetXMLFilePath() to search the potential XML config file locations
    and return the first actual file that can be found. Adapt code to use the
    utils::xml namespace.
+ @ Oct 14, 2026 - CA
+   Parse the XML config file of an algorithm only when one of its registries
+   is first looked up, rather than all files at the first Instance() call.
+ @ Oct 14, 2026 - CA
+   Added binary snapshots of all configuration sets of a tune, loaded in one
+   read instead of the XML files if they are up to date.
 */
 //____________________________________________________________________________
 
@@ -29,6 +35,11 @@
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <fstream>
+#include <pthread.h>
+#include <stdint.h>
 
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
@@ -42,6 +53,8 @@
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Registry/RegistryItemTypeDef.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/PhaseTimer.h"
 #include "Framework/Utils/XmlParserUtils.h"
 
 #include "Framework/Utils/StringUtils.h"
@@ -63,8 +76,62 @@ namespace genie {
 }
 //____________________________________________________________________________
 AlgConfigPool * AlgConfigPool::fInstance = 0;
+
+// serializes the registry look-ups and the on-demand parsing of the XML
+// config files they trigger
+static pthread_mutex_t gAlgConfigMutex = PTHREAD_MUTEX_INITIALIZER;
+
+//____________________________________________________________________________
+// Layout of a configuration snapshot (native byte order, checked at load
+// time using the byte-order mark). Strings are written as their uint32_t
+// length followed by their characters.
+//   magic, version, bom                  : char[8], uint32_t, uint32_t
+//   fingerprint                          : uint64_t, hash of the XML files
+//                                          and the XML search path
+//   tune name                            : string
+//   # of XML files, XML file paths       : uint32_t, strings
+//   # of configuration sets, and per set : uint32_t
+//      key, param set name, # of params  : string, string, uint32_t
+//      type, name, value per param       : strings
+//
+namespace {
+  const char     kConfSnapMagic[8] = { 'G','C','O','N','F','S','N','P' };
+  const uint32_t kConfSnapVersion  = 1;
+  const uint32_t kConfSnapBOM      = 0x01020304;
+
+  void fnv1a(uint64_t & hash, const char * data, size_t n)
+  {
+    for(size_t i = 0; i < n; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  void write_u32(std::ostream & out, uint32_t v)
+  {
+    out.write((const char *) &v, sizeof(v));
+  }
+  void write_str(std::ostream & out, const string & str)
+  {
+    write_u32(out, str.size());
+    out.write(str.data(), str.size());
+  }
+  bool read_u32(std::istream & in, uint32_t & v)
+  {
+    in.read((char *) &v, sizeof(v));
+    return in.good();
+  }
+  bool read_str(std::istream & in, string & str)
+  {
+    uint32_t n = 0;
+    if(!read_u32(in, n) || n > (1u<<24)) return false;
+    str.resize(n);
+    if(n > 0) in.read(&str[0], n);
+    return in.good();
+  }
+}
 //____________________________________________________________________________
-AlgConfigPool::AlgConfigPool()
+AlgConfigPool::AlgConfigPool() :
+fLoadedAll(false)
 {
   if( ! this->LoadAlgConfig() )
   LOG("AlgConfigPool", pERROR) << "Could not load XML config file";
@@ -94,6 +161,9 @@ AlgConfigPool::~AlgConfigPool()
   fRegistryPool.clear();
   fConfigFiles.clear();
   fConfigKeyList.clear();
+  fLoadedAlgs.clear();
+  fConfigSets.clear();
+  fXMLFilesRead.clear();
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -109,11 +179,18 @@ AlgConfigPool * AlgConfigPool::Instance()
 //____________________________________________________________________________
 bool AlgConfigPool::LoadAlgConfig(void)
 {
-// Loads all algorithm XML configurations and creates a map with all loaded
-// configuration registries
+// Loads the global parameter lists, the master config (which lists the XML
+// config file of each algorithm) and the tune generator list. The XML config
+// file of each algorithm is parsed when one of its registries is first
+// looked up (see FindRegistry()).
+
+  PhaseTimerGuard timer("AlgConfigPool::LoadAlgConfig");
+
+  //-- use all configuration sets from the binary snapshot, if up to date
+  if(this->LoadSnapshot(this->SnapshotFile())) return true;
 
   SLOG("AlgConfigPool", pINFO)
-        << "AlgConfigPool late initialization: Loading all XML config. files";
+        << "AlgConfigPool late initialization: Loading the master config";
 
   //-- read the global parameter lists
   if(!this->LoadGlobalParamLists()) return false;
@@ -127,30 +204,54 @@ bool AlgConfigPool::LoadAlgConfig(void)
     SLOG( "AlgConfigPool", pWARN ) << "Tune generator List not available" ;
   }
 
-  //-- loop over all XML config files and read all named configuration
-  //   sets for each algorithm
-  map<string, string>::const_iterator conf_file_iter;
+  return true;
+};
+//____________________________________________________________________________
+bool AlgConfigPool::LoadAlgConfig(string alg_name)
+{
+// Reads all named configuration sets of the input algorithm from its XML
+// config file, unless already done. Returns false if the algorithm is not
+// listed in the master config.
 
-  for(conf_file_iter = fConfigFiles.begin();
-                  conf_file_iter != fConfigFiles.end(); ++conf_file_iter) {
+  if(fLoadedAlgs.count(alg_name) == 1) return true;
 
-    string alg_name    = conf_file_iter->first;
-    string file_name   = conf_file_iter->second;
+  map<string, string>::const_iterator conf_file_iter =
+                                          fConfigFiles.find(alg_name);
+  if(conf_file_iter == fConfigFiles.end()) return false;
 
-    SLOG("AlgConfigPool", pINFO)
-         << setfill('.') << setw(40) << alg_name << " -> " << file_name;
+  fLoadedAlgs.insert(alg_name);
 
-    string full_path = utils::xml::GetXMLFilePath(file_name);
-    SLOG("AlgConfigPool", pNOTICE)
-      << "*** GENIE XML config file " << full_path;
-    bool ok = this->LoadSingleAlgConfig(alg_name, full_path);
-    if(!ok) {
-      SLOG("AlgConfigPool", pERROR)
-           << "Error in loading config sets for algorithm = " << alg_name;
-    }
+  string file_name = conf_file_iter->second;
+
+  SLOG("AlgConfigPool", pINFO)
+       << setfill('.') << setw(40) << alg_name << " -> " << file_name;
+
+  string full_path = utils::xml::GetXMLFilePath(file_name);
+  SLOG("AlgConfigPool", pNOTICE)
+    << "*** GENIE XML config file " << full_path;
+  bool ok = this->LoadSingleAlgConfig(alg_name, full_path);
+  if(!ok) {
+    SLOG("AlgConfigPool", pERROR)
+         << "Error in loading config sets for algorithm = " << alg_name;
   }
   return true;
-};
+}
+//____________________________________________________________________________
+void AlgConfigPool::LoadAllAlgConfigs(void)
+{
+// Reads all named configuration sets for all algorithms in the master config
+
+  if(fLoadedAll) return;
+
+  SLOG("AlgConfigPool", pINFO) << "Loading all XML config. files";
+
+  map<string, string>::const_iterator conf_file_iter;
+  for(conf_file_iter = fConfigFiles.begin();
+                  conf_file_iter != fConfigFiles.end(); ++conf_file_iter) {
+    this->LoadAlgConfig(conf_file_iter->first);
+  }
+  fLoadedAll = true;
+}
 //____________________________________________________________________________
 bool AlgConfigPool::LoadMasterConfig(void)
 {
@@ -174,6 +275,8 @@ bool AlgConfigPool::LoadMasterConfig(void)
      return false;
   }
 
+  fXMLFilesRead.push_back(fMasterConfig);
+
   xmlNodePtr xml_root = xmlDocGetRootElement(xml_doc);
   if(xml_root==NULL) {
      SLOG("AlgConfigPool", pERROR)
@@ -273,6 +376,8 @@ bool AlgConfigPool::LoadSingleAlgConfig(string alg_name, string file_name)
 // Loads all configuration sets for the input algorithm that can be found in 
 // the input XML file
 
+  PhaseTimerGuard timer("AlgConfigPool::LoadSingleAlgConfig");
+
   // use the algorithm name as the key prefix
   string key_prefix = alg_name;
 
@@ -301,6 +406,8 @@ bool AlgConfigPool::LoadRegistries(
      return false;
   }
 
+  fXMLFilesRead.push_back(file_name);
+
   xmlNodePtr xml_cur = xmlDocGetRootElement( xml_doc );
   if(xml_cur==NULL) {
      SLOG("AlgConfigPool", pERROR)
@@ -330,40 +437,33 @@ bool AlgConfigPool::LoadRegistries(
       ostringstream key;
       key << key_prefix << "/" << param_set;
 
-      // store the key in the key list
-      fConfigKeyList.push_back(key.str());
-
-      // create a new Registry and fill it with the configuration params
-      Registry * config = new Registry(param_set,false);
+      ConfigSet_t cs;
+      cs.key       = key.str();
+      cs.param_set = param_set;
 
       xmlNodePtr xml_param = xml_cur->xmlChildrenNode;
       while (xml_param != NULL) {
         if( (!xmlStrcmp(xml_param->name, (const xmlChar *) "param")) ) {
 
-            string param_type =
+            ConfigParam_t param;
+            param.type =
                    utils::str::TrimSpaces(
                        utils::xml::GetAttribute(xml_param, "type"));
-            string param_name =
+            param.name =
                    utils::str::TrimSpaces(
                        utils::xml::GetAttribute(xml_param, "name"));
-            string param_value =
+            param.value =
                     utils::xml::TrimSpaces(
                                xmlNodeListGetString(
                                  xml_doc, xml_param->xmlChildrenNode, 1));
-            this->AddConfigParameter(
-                             config, param_type, param_name, param_value);
+            cs.params.push_back(param);
         }
         xml_param = xml_param->next;
       }
       //xmlFree(xml_param);
       xmlFreeNode(xml_param);
-      config->SetName(param_set);
-      config->Lock();
-
-      pair<string, Registry *> single_reg(key.str(), config);
-      fRegistryPool.insert(single_reg);
 
-      SLOG("AlgConfigPool", pDEBUG) << " |---o " << key.str();
+      this->AddConfigSet(cs);
     }
     xml_cur = xml_cur->next;
   }
@@ -375,6 +475,30 @@ bool AlgConfigPool::LoadRegistries(
   return true;
 }
 //____________________________________________________________________________
+void AlgConfigPool::AddConfigSet(const ConfigSet_t & cs)
+{
+// Creates a new Registry for the input configuration set and adds it in the
+// pool under the configuration set key
+
+  // store the key in the key list
+  fConfigKeyList.push_back(cs.key);
+  fConfigSets.push_back(cs);
+
+  // create a new Registry and fill it with the configuration params
+  Registry * config = new Registry(cs.param_set,false);
+  for(unsigned int i = 0; i < cs.params.size(); i++) {
+    const ConfigParam_t & param = cs.params[i];
+    this->AddConfigParameter(config, param.type, param.name, param.value);
+  }
+  config->SetName(cs.param_set);
+  config->Lock();
+
+  pair<string, Registry *> single_reg(cs.key, config);
+  fRegistryPool.insert(single_reg);
+
+  SLOG("AlgConfigPool", pDEBUG) << " |---o " << cs.key;
+}
+//____________________________________________________________________________
 void AlgConfigPool::AddConfigParameter(
                       Registry * r, string ptype, string pname, string pvalue)
 {
@@ -533,17 +657,30 @@ Registry* AlgConfigPool::FindRegistry(string alg_name, string param_set) const
 //____________________________________________________________________________
 Registry * AlgConfigPool::FindRegistry(string key) const
 {
+// Keys are built as algorithm/param_set. The XML config file of the
+// algorithm is parsed, if not already, at the first look-up.
+
   LOG("AlgConfigPool", pDEBUG) << "Searching for registry with key " << key;
 
-  if( fRegistryPool.count(key) == 1 ) {
-     map<string, Registry *>::const_iterator config_entry =
+  pthread_mutex_lock(&gAlgConfigMutex);
+
+  map<string, Registry *>::const_iterator config_entry =
                                                    fRegistryPool.find(key);
-     return config_entry->second;
-  } else {
+  if( config_entry == fRegistryPool.end() && !fLoadedAll ) {
+     string alg_name = key.substr(0, key.find('/'));
+     if( const_cast<AlgConfigPool*>(this)->LoadAlgConfig(alg_name) ) {
+       config_entry = fRegistryPool.find(key);
+     }
+  }
+  Registry * config =
+      (config_entry != fRegistryPool.end()) ? config_entry->second : 0;
+
+  pthread_mutex_unlock(&gAlgConfigMutex);
+
+  if(!config) {
      LOG("AlgConfigPool", pDEBUG) << "No config registry for key " << key;
-     return 0;
   }
-  return 0;
+  return config;
 }
 //____________________________________________________________________________
 Registry * AlgConfigPool::GlobalParameterList(void) const
@@ -580,11 +717,20 @@ Registry * AlgConfigPool::TuneGeneratorList( void ) const
 //____________________________________________________________________________
 const vector<string> & AlgConfigPool::ConfigKeyList(void) const
 {
+// The list of all available configuration keys: all XML config files are
+// parsed first, if not already
+
+  pthread_mutex_lock(&gAlgConfigMutex);
+  const_cast<AlgConfigPool*>(this)->LoadAllAlgConfigs();
+  pthread_mutex_unlock(&gAlgConfigMutex);
+
   return fConfigKeyList;
 }
 //____________________________________________________________________________
 void AlgConfigPool::Print(ostream & stream) const
 {
+  this->ConfigKeyList(); // parse all XML config files first
+
   string frame(100,'~');
 
   typedef map<string, Registry *>::const_iterator  sregIter;
@@ -606,4 +752,205 @@ void AlgConfigPool::Print(ostream & stream) const
   }
 }
 //____________________________________________________________________________
+string AlgConfigPool::SnapshotFile(void) const
+{
+// Snapshots are looked up in $GCONFSNAPSHOTDIR, if set, or in $GENIE/config,
+// and are named after the tune
+
+  string dir = (gSystem->Getenv("GCONFSNAPSHOTDIR")) ?
+        string(gSystem->Getenv("GCONFSNAPSHOTDIR")) :
+        string(gSystem->Getenv("GENIE")) + "/config";
+
+  TuneId * tune = RunOpt::Instance()->Tune();
+  string tune_name = (tune) ? tune->Name() : "Default";
+
+  return dir + "/" + tune_name + ".gconfsnap";
+}
+//____________________________________________________________________________
+unsigned long long AlgConfigPool::XMLFingerprint(
+                                        const vector<string> & files) const
+{
+// Hash of the XML search path and of the contents of the input XML files
+
+  uint64_t hash = 14695981039346656037ULL;
+
+  string pathlist = utils::xml::GetXMLPathList();
+  fnv1a(hash, pathlist.data(), pathlist.size());
+
+  vector<char> buffer;
+  for(unsigned int i = 0; i < files.size(); i++) {
+    fnv1a(hash, files[i].data(), files[i].size());
+    std::ifstream in(files[i].c_str(), std::ios::in | std::ios::binary);
+    in.seekg(0, std::ios::end);
+    std::streamoff size = in.tellg();
+    if(size <= 0) continue;
+    buffer.resize(size);
+    in.seekg(0, std::ios::beg);
+    in.read(&buffer[0], size);
+    fnv1a(hash, &buffer[0], size);
+  }
+  return hash;
+}
+//____________________________________________________________________________
+bool AlgConfigPool::LoadSnapshot(string filename)
+{
+// Loads all configuration sets from the binary snapshot written by
+// SaveSnapshot(), if there is one for the current tune and it was built from
+// the current XML files. Returns false otherwise.
+
+  std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!in.good()) return false;
+
+  char     magic[8];
+  uint32_t version = 0, bom = 0;
+  uint64_t fingerprint = 0;
+  in.read(magic, sizeof(magic));
+  read_u32(in, version);
+  read_u32(in, bom);
+  in.read((char *) &fingerprint, sizeof(fingerprint));
+  if(!in.good() || memcmp(magic, kConfSnapMagic, sizeof(magic)) != 0 ||
+     version != kConfSnapVersion || bom != kConfSnapBOM) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Ignoring invalid or incompatible configuration snapshot: " << filename;
+    return false;
+  }
+
+  string tune_name;
+  TuneId * tune = RunOpt::Instance()->Tune();
+  if(!read_str(in, tune_name) ||
+     tune_name != ((tune) ? tune->Name() : string("Default"))) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Ignoring configuration snapshot: " << filename
+      << " built for another tune (" << tune_name << ")";
+    return false;
+  }
+
+  // the XML files it was built from must still be the ones found first in
+  // the XML search path, with the same contents
+  uint32_t nfiles = 0;
+  if(!read_u32(in, nfiles)) return false;
+  vector<string> files(nfiles);
+  for(uint32_t i = 0; i < nfiles; i++) {
+    if(!read_str(in, files[i])) return false;
+    string basename = gSystem->BaseName(files[i].c_str());
+    if(utils::xml::GetXMLFilePath(basename) != files[i]) {
+      SLOG("AlgConfigPool", pWARN)
+        << "Ignoring outdated configuration snapshot: " << filename
+        << " (" << basename << " is now found elsewhere)";
+      return false;
+    }
+  }
+  if(fingerprint != this->XMLFingerprint(files)) {
+    SLOG("AlgConfigPool", pWARN)
+      << "Ignoring outdated configuration snapshot: " << filename
+      << " (the XML config files have changed)";
+    return false;
+  }
+
+  uint32_t nsets = 0;
+  if(!read_u32(in, nsets)) return false;
+  vector<ConfigSet_t> sets(nsets);
+  for(uint32_t i = 0; i < nsets; i++) {
+    uint32_t nparams = 0;
+    if(!read_str(in, sets[i].key) || !read_str(in, sets[i].param_set) ||
+       !read_u32(in, nparams)) return false;
+    sets[i].params.resize(nparams);
+    for(uint32_t j = 0; j < nparams; j++) {
+      ConfigParam_t & param = sets[i].params[j];
+      if(!read_str(in, param.type) || !read_str(in, param.name) ||
+         !read_str(in, param.value)) return false;
+    }
+  }
+
+  for(uint32_t i = 0; i < nsets; i++) this->AddConfigSet(sets[i]);
+  fXMLFilesRead = files;
+  fLoadedAll    = true;
+
+  SLOG("AlgConfigPool", pNOTICE)
+    << "Loaded " << nsets << " configuration sets for tune " << tune_name
+    << " from the snapshot: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+bool AlgConfigPool::SaveSnapshot(string filename)
+{
+// Saves all configuration sets (algorithm configurations, global parameter
+// lists, common lists and the tune generator list) in a binary snapshot.
+// The file is written under a temporary name and then renamed, so that jobs
+// never read it partially written.
+
+  // parse all the XML config files, including all common lists found in the
+  // XML search path
+  this->ConfigKeyList();
+
+  vector<string> paths = utils::str::Split(utils::xml::GetXMLPathList(), ":;,");
+  set<string> common_ids;
+  for(unsigned int i = 0; i < paths.size(); i++) {
+    string dir = gSystem->ExpandPathName(paths[i].c_str());
+    void * dirp = gSystem->OpenDirectory(dir.c_str());
+    if(!dirp) continue;
+    const char * entry = 0;
+    while((entry = gSystem->GetDirEntry(dirp)) != 0) {
+      string name = entry;
+      if(name.size() > 10 && name.find("Common") == 0 &&
+         name.rfind(".xml") == name.size() - 4) {
+        common_ids.insert(name.substr(6, name.size() - 10));
+      }
+    }
+    gSystem->FreeDirectory(dirp);
+  }
+  for(set<string>::const_iterator it = common_ids.begin();
+                                            it != common_ids.end(); ++it) {
+    bool loaded = false;
+    string prefix = "Common" + *it + "List/";
+    for(unsigned int i = 0; i < fConfigKeyList.size() && !loaded; i++) {
+      loaded = (fConfigKeyList[i].find(prefix) == 0);
+    }
+    if(!loaded) this->LoadCommonLists(*it);
+  }
+
+  TuneId * tune = RunOpt::Instance()->Tune();
+  string tune_name = (tune) ? tune->Name() : "Default";
+
+  std::ostringstream tmpname;
+  tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+  std::ofstream out(tmpname.str().c_str(), std::ios::out | std::ios::binary);
 
+  uint64_t fingerprint = this->XMLFingerprint(fXMLFilesRead);
+  out.write(kConfSnapMagic, sizeof(kConfSnapMagic));
+  write_u32(out, kConfSnapVersion);
+  write_u32(out, kConfSnapBOM);
+  out.write((const char *) &fingerprint, sizeof(fingerprint));
+  write_str(out, tune_name);
+
+  write_u32(out, fXMLFilesRead.size());
+  for(unsigned int i = 0; i < fXMLFilesRead.size(); i++) {
+    write_str(out, fXMLFilesRead[i]);
+  }
+  write_u32(out, fConfigSets.size());
+  for(unsigned int i = 0; i < fConfigSets.size(); i++) {
+    const ConfigSet_t & cs = fConfigSets[i];
+    write_str(out, cs.key);
+    write_str(out, cs.param_set);
+    write_u32(out, cs.params.size());
+    for(unsigned int j = 0; j < cs.params.size(); j++) {
+      write_str(out, cs.params[j].type);
+      write_str(out, cs.params[j].name);
+      write_str(out, cs.params[j].value);
+    }
+  }
+  out.close();
+
+  if(out.fail() || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    LOG("AlgConfigPool", pERROR)
+      << "Could not write the configuration snapshot: " << filename;
+    std::remove(tmpname.str().c_str());
+    return false;
+  }
+  LOG("AlgConfigPool", pNOTICE)
+    << "Wrote " << fConfigSets.size() << " configuration sets for tune "
+    << tune_name << " (from " << fXMLFilesRead.size() << " XML files) in: "
+    << filename;
+  return true;
+}
+//____________________________________________________________________________
@@ -6,6 +6,16 @@
 \brief    A singleton class holding all configuration registries built while
           parsing all loaded XML configuration files. 
 
+          The XML configuration file of an algorithm is parsed only when one
+          of its configuration registries is first looked up. All files are
+          parsed when the full list of configuration keys is requested.
+
+          All configuration sets of a tune can be saved in a binary snapshot
+          (see gconfsnapshot), which is loaded in one read, if found, instead
+          of parsing the XML files. The snapshot records the XML files it was
+          built from and is ignored if any of them (or the XML search path)
+          has changed.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,6 +31,7 @@
 #define _ALG_CONFIG_POOL_H_
 
 #include <map>
+#include <set>
 #include <vector>
 #include <string>
 #include <iostream>
@@ -29,6 +40,7 @@
 #include "Framework/Registry/Registry.h"
 
 using std::map;
+using std::set;
 using std::vector;
 using std::string;
 using std::ostream;
@@ -55,6 +67,10 @@ public:
 
   const vector<string> & ConfigKeyList (void) const;
 
+  // binary snapshot of all configuration sets for the current tune
+  string SnapshotFile (void) const;
+  bool   SaveSnapshot (string filename);
+
   void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const AlgConfigPool & cp);
 
@@ -67,12 +83,31 @@ private:
   string BuildConfigKey      (string alg_name, string param_set) const;
   string BuildConfigKey      (const Algorithm * algorithm) const;
   bool   LoadAlgConfig       (void);
+  bool   LoadAlgConfig       (string alg_name);
+  void   LoadAllAlgConfigs   (void);
   bool   LoadMasterConfig    (void);
   bool   LoadGlobalParamLists(void);
   bool   LoadCommonLists( const string & file_id );
   bool   LoadTuneGeneratorList(void);
   bool   LoadSingleAlgConfig (string alg_name, string file_name);
   bool   LoadRegistries      (string key_base, string file_name, string root);
+  bool   LoadSnapshot        (string filename);
+  unsigned long long XMLFingerprint (const vector<string> & files) const;
+
+  //! a configuration parameter, as read from the XML files
+  struct ConfigParam_t {
+    string type;
+    string name;
+    string value;
+  };
+  //! a named configuration set, as read from the XML files
+  struct ConfigSet_t {
+    string                key;
+    string                param_set;
+    vector<ConfigParam_t> params;
+  };
+  void   AddConfigSet        (const ConfigSet_t & cs);
+
   void   AddConfigParameter  (Registry * r, string pt, string pn, string pv);
   void   AddBasicParameter   (Registry * r, string pt, string pn, string pv);
   void   AddRootObjParameter (Registry * r, string pt, string pn, string pv);
@@ -81,7 +116,11 @@ private:
 
   map<string, Registry *> fRegistryPool;  ///< algorithm/param_set -> Registry
   map<string, string>     fConfigFiles;   ///< algorithm -> XML config file
-  vector<string>          fConfigKeyList; ///< list of all available configuration keys
+  vector<string>          fConfigKeyList; ///< list of all loaded configuration keys
+  set<string>             fLoadedAlgs;    ///< algorithms whose XML config file was parsed
+  bool                    fLoadedAll;     ///< were all XML config files parsed?
+  vector<ConfigSet_t>     fConfigSets;    ///< all loaded configuration sets (for snapshots)
+  vector<string>          fXMLFilesRead;  ///< all XML files read (for snapshots)
   string                  fMasterConfig;  ///< lists config files for all algorithms
 
   struct Cleaner {
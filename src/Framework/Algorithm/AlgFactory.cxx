@@ -16,11 +16,17 @@
  @ Oct 20, 2009 - CA
    Added argument in ForceReconfiguration() to ignore algorithm opt-outs.
    Default is to respect opt-outs.
+ @ Oct 14, 2026 - CA
+   Added ForceReconfiguration(changed_keys), reconfiguring only the algorithms
+   depending on the modified parameters and removing their cache branches.
+   GetAlgorithm() can be called from concurrent threads.
 */
 //____________________________________________________________________________
 
 #include <iostream>
 #include <cstdlib>
+#include <set>
+#include <pthread.h>
 
 #include <TROOT.h>
 #include <TClass.h>
@@ -29,11 +35,27 @@
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/Cache.h"
 
 using std::endl;
+using std::set;
 
 using namespace genie;
 
+// Serializes access to the algorithm pool, so that algorithms can be looked
+// up from concurrent threads (see GMCJDriver::PopulateEventGenDriverPool).
+// Recursive, since configuring an algorithm looks up its sub-algorithms.
+static pthread_mutex_t gAlgPoolMutex;
+static pthread_once_t  gAlgPoolMutexOnce = PTHREAD_ONCE_INIT;
+static void InitAlgPoolMutex(void)
+{
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&gAlgPoolMutex, &attr);
+  pthread_mutexattr_destroy(&attr);
+}
+
 //____________________________________________________________________________
 namespace genie {
   ostream & operator<<(ostream & stream, const AlgFactory & algf)
@@ -100,11 +122,15 @@ const Algorithm * AlgFactory::GetAlgorithm(string name, string config)
   SLOG("AlgFactory", pDEBUG)
       << "Algorithm: " << key << " requested from AlgFactory";
 
+  pthread_once(&gAlgPoolMutexOnce, InitAlgPoolMutex);
+  pthread_mutex_lock(&gAlgPoolMutex);
+
   map<string, Algorithm *>::const_iterator alg_iter = fAlgPool.find(key);
   bool found = (alg_iter != fAlgPool.end());
 
   if(found) {
      LOG("AlgFactory", pDEBUG) << key << " algorithm found in memory";
+     pthread_mutex_unlock(&gAlgPoolMutex);
      return alg_iter->second;
   } else {
      //-- instantiate the factory
@@ -119,6 +145,7 @@ const Algorithm * AlgFactory::GetAlgorithm(string name, string config)
             << "Algorithm: " << key << " could not be instantiated";
         exit(1);
      }
+     pthread_mutex_unlock(&gAlgPoolMutex);
      return alg_base;
   }
   return 0;
@@ -153,12 +180,79 @@ void AlgFactory::ForceReconfiguration(bool ignore_alg_opt_out)
        bool skip_conf = (config=="NoConfig" || config=="");
        if(!skip_conf) {
 //         LOG("AlgFactory", pINFO) << "Reconfiguring: " << alg->Id().Key();
+           Algorithm::BeginConfiguration();
            alg->Configure(config);
+           Algorithm::EndConfiguration();
        }
     }//allow?
   }
 }
 //____________________________________________________________________________
+int AlgFactory::ForceReconfiguration(
+    const vector<string> & changed_keys, bool ignore_alg_opt_out)
+{
+// Dependencies are those recorded while the algorithms were configured:
+// the parameters each one looked up and the sub-algorithms it fetched.
+// Algorithms depending on a reconfigured one are reconfigured after it.
+
+  LOG("AlgFactory", pNOTICE)
+       << " ** Forcing reconfiguration of the algorithms using "
+       << changed_keys.size() << " modified parameters";
+
+  // algorithms directly affected
+  vector<Algorithm *> affected;
+  set<Algorithm *>    selected;
+  map<string, Algorithm *>::iterator alg_iter = fAlgPool.begin();
+  for( ; alg_iter != fAlgPool.end(); ++alg_iter) {
+    Algorithm * alg = alg_iter->second;
+    for(unsigned int ik = 0; ik < changed_keys.size(); ik++) {
+      if(alg->UsesParam(changed_keys[ik])) {
+        affected.push_back(alg);
+        selected.insert(alg);
+        break;
+      }
+    }
+  }
+
+  // algorithms using the affected ones as sub-algorithms
+  for(unsigned int ia = 0; ia < affected.size(); ia++) {
+    string sub_key = affected[ia]->Id().Key();
+    for(alg_iter = fAlgPool.begin(); alg_iter != fAlgPool.end(); ++alg_iter) {
+      Algorithm * alg = alg_iter->second;
+      if(selected.count(alg) > 0) continue;
+      if(alg->UsesSubAlg(sub_key)) {
+        affected.push_back(alg);
+        selected.insert(alg);
+      }
+    }
+  }
+
+  Cache * cache = Cache::Instance();
+
+  int nreconf = 0;
+  for(unsigned int ia = 0; ia < affected.size(); ia++) {
+    Algorithm * alg = affected[ia];
+    bool reconfig = (ignore_alg_opt_out) ? true : alg->AllowReconfig();
+    if(!reconfig) continue;
+    string config = alg->Id().Config();
+    bool skip_conf = (config=="NoConfig" || config=="");
+    if(skip_conf) continue;
+
+    LOG("AlgFactory", pINFO) << "Reconfiguring: " << alg->Id().Key();
+    Algorithm::BeginConfiguration();
+    alg->Configure(config);
+    Algorithm::EndConfiguration();
+    cache->RmMatchedCacheBranches(alg->Id().Key() + "/");
+    nreconf++;
+  }
+
+  LOG("AlgFactory", pNOTICE)
+       << " ** Reconfigured " << nreconf << " of " << fAlgPool.size()
+       << " algorithms";
+
+  return nreconf;
+}
+//____________________________________________________________________________
 Algorithm * AlgFactory::InstantiateAlgorithm(string name, string config) const
 {
 //! Instantiate the requested object based on the registration of its TClass
@@ -185,7 +279,9 @@ Algorithm * AlgFactory::InstantiateAlgorithm(string name, string config) const
   if ( skip_conf ) {
     LOG("AlgFactory", pDEBUG) << "Skipping algorithm configuration step!";
   } else {
+    Algorithm::BeginConfiguration();
     alg_base->Configure(config);
+    Algorithm::EndConfiguration();
   }
 
   return alg_base;
@@ -20,12 +20,14 @@
 #define _ALG_FACTORY_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <iostream>
 
 #include "Framework/Algorithm/AlgId.h"
 
 using std::map;
+using std::vector;
 using std::pair;
 using std::string;
 using std::ostream;
@@ -58,6 +60,14 @@ public:
   //! Use that to propagate modifications made directly at the config pool.
   void ForceReconfiguration(bool ignore_alg_opt_out=false);
 
+  //! Reconfigures only the algorithms of the factory pool that looked up any
+  //! of the input parameters when they were last configured, and then the
+  //! algorithms using any reconfigured algorithm as a sub-algorithm.
+  //! The cache branches of the reconfigured algorithms are removed.
+  //! Returns the number of reconfigured algorithms.
+  int  ForceReconfiguration(const vector<string> & changed_keys,
+                            bool ignore_alg_opt_out=false);
+
   //! print algorithm factory
   void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const AlgFactory & algf);
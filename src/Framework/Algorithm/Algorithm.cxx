@@ -14,11 +14,20 @@
    Added fAllowReconfig private data member and AllowReconfig() method.
    Algorithms can set this method to opt-out of reconfiguration. Speeds up 
    reweighting if algorithms (that don't need to be reconfigured) opt out.
+ @ Oct 14, 2026 - CA
+   Added typed parameter handles (AlgParam, BindParam) resolved at configure
+   time and, in builds with low level messages enabled, a report of GetParam
+   calls made during event generation.
+   ExtractLocalConfig() shares the registry items when all keys are local.
+   Record the parameters and sub-algorithms used since the last configuration
+   (see AlgFactory::ForceReconfiguration(changed_keys)).
+   Count the configurations, see ConfigGeneration().
 */
 //____________________________________________________________________________
 
 #include <vector>
 #include <string>
+#include <set>
 
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/Algorithm.h"
@@ -28,11 +37,16 @@
 
 using std::vector;
 using std::string;
+using std::set;
 using std::endl;
 
 using namespace genie;
 using namespace genie::utils;
 
+int Algorithm::fgNEventGen = 0;
+int Algorithm::fgNConfig   = 0;
+unsigned long Algorithm::fgConfigGeneration = 0;
+
 //____________________________________________________________________________
 namespace genie
 {
@@ -71,6 +85,8 @@ void Algorithm::Configure(const Registry & config)
 {
 // Configure the Algorithm using the input configuration Registry
 
+  fgConfigGeneration++;
+
   LOG("Algorithm", pNOTICE) << "Input configuration: " << config;
 
   if ( config.NEntries() <= 0 ) {
@@ -128,6 +144,8 @@ void Algorithm::Configure(string config)
 // Configure the Algorithm looking up at the ConfigPool singleton for a
 // configuration Registry corresponding to the input named parameter set.
 
+  fgConfigGeneration++;
+
   fID.SetConfig(config);
   this->FindConfig();
 }
@@ -142,6 +160,10 @@ void Algorithm::FindConfig(void)
 
   DeleteConfig() ;
 
+  // dependencies are recorded again by LoadConfig
+  fParamKeys.clear() ;
+  fSubAlgKeys.clear() ;
+
   AlgConfigPool * pool = AlgConfigPool::Instance();
 
   Registry * config = 0 ;
@@ -388,6 +410,8 @@ const Algorithm * Algorithm::SubAlg(const RgKey & registry_key) const
   const Algorithm * algbase = algf->GetAlgorithm(alg.name, alg.config);
   assert(algbase);
 
+  fSubAlgKeys.insert( algbase->Id().Key() ) ;
+
   return algbase;
 }
 //____________________________________________________________________________
@@ -519,9 +543,24 @@ Registry * Algorithm::ExtractLocalConfig( const Registry & in ) const {
 
   const RgIMap & rgmap = in.GetItemMap();
   Registry * out = new Registry( in.Name(), false );
-  
-  for( RgIMapConstIter reg_iter = rgmap.begin(); 
+
+  // if all keys refer to the local algorithm, the items are shared with
+  // the input registry until either is modified
+  bool all_local = true ;
+  for( RgIMapConstIter reg_iter = rgmap.begin();
        reg_iter != rgmap.end(); ++reg_iter ) {
+    if( reg_iter->first.find( '/' ) != string::npos ) {
+      all_local = false ;
+      break ;
+    }
+  }
+  if ( all_local ) {
+    out -> Append( in ) ;
+    out -> RestoreItemLocks() ;
+  }
+
+  for( RgIMapConstIter reg_iter = rgmap.begin(); 
+       ! all_local && reg_iter != rgmap.end(); ++reg_iter ) {
 
     RgKey reg_key = reg_iter->first;
     if( reg_key.find( '/' ) != string::npos) continue; 
@@ -664,3 +703,21 @@ int Algorithm::AddTopRegisties( const vector<Registry*> & rs, bool own ) {
   return fConfVect.size() ;  
 
 }
+//____________________________________________________________________________
+void Algorithm::WatchParamAccess(const RgKey & key) const
+{
+// Parameters looked up while events are generated should have been cached
+// at configuration time. Each (algorithm, key) pair is reported once.
+
+  if(fgNEventGen <= 0 || fgNConfig > 0) return;
+
+  static set<string> reported;
+  string entry = fID.Key() + " : " + key;
+  if(reported.count(entry) > 0) return;
+  reported.insert(entry);
+
+  LOG("Algorithm", pWARN)
+     << "GetParam(\"" << key << "\") called by " << fID.Key()
+     << " during event generation - cache it in LoadConfig";
+}
+//____________________________________________________________________________
@@ -27,6 +27,7 @@
 #include <iostream>
 #include <cassert>
 #include <map>
+#include <set>
 
 #include "Framework/Algorithm/AlgStatus.h"
 #include "Framework/Algorithm/AlgCmp.h"
@@ -35,10 +36,12 @@
 #include "Framework/Registry/Registry.h"
 #include "Framework/Registry/RegistryItemTypeDef.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Conventions/GBuild.h"
 
 using std::string;
 using std::ostream;
 using std::map;
+using std::set;
 
 namespace genie {
 
@@ -51,6 +54,28 @@ typedef map <string, Algorithm *>::iterator       AlgMapIter;
 typedef map <string, Algorithm *>::const_iterator AlgMapConstIter;
 typedef pair<string, Algorithm *>                 AlgMapPair;
 
+//! Typed handle to a configuration parameter.
+//! The key is looked up once, when the handle is bound (Algorithm::BindParam
+//! in LoadConfig), and the value is then read with no registry lookup.
+//! Algorithms rebind their handles whenever they are reconfigured.
+template<class T> class AlgParam {
+
+public:
+  AlgParam() : fValue(), fFound(false) { }
+
+  const T &     operator() (void) const { return fValue; }
+  operator      const T &  (void) const { return fValue; }
+  const RgKey & Key        (void) const { return fKey;   }
+  bool          Found      (void) const { return fFound; } ///< false if set to the default
+
+private:
+  friend class Algorithm;
+
+  RgKey fKey;
+  T     fValue;
+  bool  fFound;
+};
+
 class Algorithm {
 
 public:
@@ -131,10 +156,31 @@ public:
   //! data fitting or reweighting
   void AdoptSubstructure (void);
 
+  //! Dependencies recorded since the algorithm was last configured: the
+  //! parameters it looked up and the sub-algorithms it fetched with SubAlg().
+  //! Used by AlgFactory to reconfigure only the algorithms affected by a
+  //! parameter change.
+  bool UsesParam  (const RgKey & key)      const { return fParamKeys.count(key) > 0;      }
+  bool UsesSubAlg (const string & alg_key) const { return fSubAlgKeys.count(alg_key) > 0; }
+
   //! Print algorithm info
   virtual void Print(ostream & stream) const;
   friend ostream & operator << (ostream & stream, const Algorithm & alg);
 
+  //! Mark the event generation and configuration phases.
+  //! In builds with low level debug messages enabled, GetParam calls made
+  //! while an event is being generated (and no algorithm is being configured)
+  //! are reported, once per algorithm and key: these values should be cached
+  //! in LoadConfig, eg with an AlgParam handle.
+  static void BeginEventGeneration (void) { fgNEventGen++; }
+  static void EndEventGeneration   (void) { fgNEventGen--; }
+  static void BeginConfiguration   (void) { fgNConfig++;   }
+  static void EndConfiguration     (void) { fgNConfig--;   }
+
+  //! Incremented every time any algorithm is (re)configured, to let results
+  //! cached from algorithm evaluations tell whether they may be stale
+  static unsigned long ConfigGeneration (void) { return fgConfigGeneration; }
+
 protected:
   Algorithm();
   Algorithm(string name);
@@ -183,6 +229,15 @@ protected:
     bool GetParamVect( const std::string & comm_name, std::vector<T> & v,
     		           unsigned int max, bool is_top_call = true ) const ;
 
+  //! Resolve a parameter handle (to be called in LoadConfig).
+  //! Like GetParam, this aborts if the key is not found.
+  template<class T>
+    void BindParam( AlgParam<T> & p, const RgKey & name ) const ;
+
+  //! Resolve a parameter handle, setting it to def if the key is not found
+  template<class T>
+    void BindParamDef( AlgParam<T> & p, const RgKey & name, const T & def ) const ;
+
   int   AddTopRegistry( Registry * rp, bool owns = true );  ///< add registry with top priority, also update ownership
   int   AddLowRegistry( Registry * rp, bool owns = true );  ///< add registry with lowest priority, also update ownership
   int   MergeTopRegistry( const Registry & r ) ;            ///< Merge with top level registry if first reg of the vector is owned
@@ -193,6 +248,16 @@ private:
 
   Registry *   fConfig;        ///< Summary configuration derived from fConvVect, not necessarily allocated
 
+  //! Report a GetParam call made during event generation
+  void WatchParamAccess (const RgKey & key) const;
+
+  mutable set<RgKey>  fParamKeys;  ///< parameters looked up since the last configuration
+  mutable set<string> fSubAlgKeys; ///< sub-algorithms fetched since the last configuration
+
+  static int   fgNEventGen;    ///< > 0 while an event is being generated
+  static int   fgNConfig;      ///< > 0 while an algorithm is being configured
+  static unsigned long fgConfigGeneration; ///< number of Configure() calls so far
+
 };
 
 }       // genie namespace
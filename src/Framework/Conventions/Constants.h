@@ -65,7 +65,7 @@ static const double kGF2   = TMath::Power(kGF,2);
 // For simplicity, the most commonly used particle masses defined here.
 // In general, however, particle masses in GENIE classes should be obtained
 // through the genie::PDGLibrary as shown below:
-// double mass = PDGLibrary::Instance()->Find(pdg_code)->Mass();
+// double mass = PDGLibrary::Instance()->Mass(pdg_code);
 // For consistency, the values below must match whatever is used in PDGLibrary.
 //
 static const double kElectronMass   =  5.109989461e-04;        // GeV
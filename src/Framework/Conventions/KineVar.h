@@ -56,6 +56,7 @@ typedef enum EKineVar {
   kKVSelv,
   // put all new enum names right before this line
   // do not change any previous ordering (neither insert nor delete)
+  // (at most 64 values: the Kinematics class keeps a 64-bit mask of them)
   kNumOfKineVar
 
 } KineVar_t;
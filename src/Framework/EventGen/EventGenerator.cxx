@@ -16,10 +16,30 @@
  @ Feb 01, 2013 - CA
    The GUNPHYSMASK env. var is no longer used. The bit-field mask is stored
    in the GHEP record and GHepRecord::Accept() is now checked.
+ @ Oct 14, 2026 - CA
+   Added the CompiledChain option, for threads of cheap processes whose
+   per-event cost is dominated by the module loop bookkeeping.
+ @ Oct 14, 2026 - CA
+   A return step with no event record snapshot restarts the event from the
+   bootstrap record and registers the step with GHepRecordHistory, so that
+   its snapshot is kept for the following events.
+ @ Oct 14, 2026 - CA
+   Keep per-module run and stop counts and cpu times summed over all events
+   (see NModuleRuns(), NModuleStops() and ModuleTime()), e.g. for GMCJMonitor.
+ @ Oct 14, 2026 - CA
+   Record the computing cost of each event (cpu time and the counters of
+   the RunningThreadInfo) in the event record, see GHepEventCost.
+ @ Oct 14, 2026 - CA
+   Instrumented the calls to the event generation modules (ScopeProfiler).
+   Counts the generated events for the allocation tracking summary.
+ @ Oct 14, 2026 - CA
+   Resolve any deferred daughter-list updates of the event record after
+   each module, before the record snapshot.
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <ctime>
 #include <sstream>
 #include <cstdlib>
 #include <algorithm>
@@ -36,11 +56,13 @@
 #include "Framework/EventGen/InteractionListGeneratorI.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/EventGen/GVldContext.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/GHEP/GHepVirtualListFolder.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/ScopeProfiler.h"
 
 using std::ostringstream;
 
@@ -49,6 +71,14 @@ using namespace genie::utils;
 using namespace genie::controls;
 using namespace genie::exceptions;
 
+// cpu time used by the calling thread (ns)
+static Long64_t ThreadCpuTimeNs(void)
+{
+  timespec t;
+  if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t) != 0) return 0;
+  return (Long64_t) t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
 //___________________________________________________________________________
 EventGenerator::EventGenerator() :
 EventGeneratorI("genie::EventGenerator")
@@ -69,6 +99,9 @@ EventGenerator::~EventGenerator()
 
   if(fEVGModuleVec) delete fEVGModuleVec;
   if(fEVGTime)      delete fEVGTime;
+  if(fEVGTimeSum)   delete fEVGTimeSum;
+  if(fEVGNRuns)     delete fEVGNRuns;
+  if(fEVGNStops)    delete fEVGNStops;
   if(fVldContext)   delete fVldContext;
 }
 //___________________________________________________________________________
@@ -90,10 +123,19 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
   unsigned int nexceptions = 0;
 
   //-- Reset stop-watch
-  fWatch->Reset();
+  if(!fCompiledChain) fWatch->Reset();
+
+  //-- Let the modules post their thread status rather than throwing it
+  RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
+  rtinfo->EnableThreadStatus(true);
 
-  string mesgh = "Event generation thread: " + this->Id().Key() + 
-                 " -> Running module: ";
+  //-- Reset the cost counters of the event
+  GHepEventCost & cost = rtinfo->EventCost();
+  cost.Reset();
+  Long64_t cpu_start = ThreadCpuTimeNs();
+
+  //-- Let GetParam calls made by the modules be reported (debug builds)
+  Algorithm::BeginEventGeneration();
 
   //-- Loop over the event record processing modules
   int istep=0;
@@ -104,27 +146,49 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
   {
     const EventRecordVisitorI * visitor = *miter; // generation module
 
-    string mesg = mesgh + visitor->Id().Key();
-    LOG("EventGenerator", pNOTICE)
-                 << utils::print::PrintFramedMesg(mesg,0,'~');
+    LOG("EventGenerator", pNOTICE) << fModuleMesg[istep];
     if(ffwd) {
       LOG("EventGenerator", pNOTICE)
            << "Fast Forward flag was set - Skipping processing step!";
       continue;
     }
+    bool stopped = false;
+    EVGThreadException exception;
     try
     {
-      fWatch->Start();
-      visitor->ProcessEventRecord(event_rec);
-      fWatch->Stop();
-      fRecHistory.AddSnapshot(istep, event_rec);
-      (*fEVGTime)[istep] = fWatch->CpuTime(); // sec
+      GINSTR_ALG_SCOPE(visitor);
+      (*fEVGNRuns)[istep]++;
+      if(fCompiledChain) {
+        visitor->ProcessEventRecord(event_rec);
+        event_rec->DeferDaughterLists(false);
+        stopped = rtinfo->PopThreadStatus(exception);
+        if(!stopped) fRecHistory.AddSnapshot(istep, event_rec);
+      } else {
+        fWatch->Start();
+        visitor->ProcessEventRecord(event_rec);
+        event_rec->DeferDaughterLists(false);
+        fWatch->Stop();
+        (*fEVGTimeSum)[istep] += fWatch->CpuTime();
+        stopped = rtinfo->PopThreadStatus(exception);
+        if(!stopped) {
+          fRecHistory.AddSnapshot(istep, event_rec);
+          (*fEVGTime)[istep] = fWatch->CpuTime(); // sec
+        }
+      }
     }
-    catch (EVGThreadException exception)
+    catch (EVGThreadException thrown)
     {
       LOG("EventGenerator", pNOTICE)
            << "An exception was thrown and caught by EventGenerator!";
+      exception = thrown;
+      stopped   = true;
+      event_rec->DeferDaughterLists(false);
+    }
+    if(stopped)
+    {
       LOG("EventGenerator", pNOTICE) << exception;
+      (*fEVGNStops)[istep]++;
+      cost.module_stops++;
 
       nexceptions++;
       if ( nexceptions > kMaxEVGThreadExceptions ) {
@@ -166,6 +230,24 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
          if(exception.ReturnStep() >= 0 && exception.ReturnStep() <= istep) {
 
            int rstep = exception.ReturnStep();
+
+           // snapshots are only taken for known rewind targets: if there is
+           // no snapshot of the record before the return step, keep one for
+           // the coming events and restart this one from the bootstrap record
+           if(!fRecHistory.HasSnapshot(rstep-1)) {
+             LOG("EventGenerator", pWARN)
+               << "No GHEP snapshot before processing step " << rstep
+               << " - Restarting from the first processing step";
+             fRecHistory.KeepSnapshot(rstep-1);
+             rstep = 0;
+           }
+           if(!fRecHistory.HasSnapshot(rstep-1)) {
+             LOG("EventGenerator", pFATAL)
+               << "No GHEP snapshot of the bootstrap record. "
+               << "Can not return at an earlier processing step";
+             exit(1);
+           }
+
            LOG("EventGenerator", pNOTICE)
                << "Return at processing step " << rstep;
            advance(miter, rstep-istep-1);
@@ -177,39 +259,71 @@ void EventGenerator::ProcessEventRecord(GHepRecord * event_rec) const
                   << "Restoring GHEP as it was just before the return step";
            event_rec->ResetRecord();
            istep--;
-           GHepRecord * snapshot = fRecHistory[istep];
+           GHepRecord * snapshot = fRecHistory.find(istep)->second;
            fRecHistory.PurgeRecentHistory(istep+1);
            event_rec->Copy(*snapshot);
          } // valid-return-step
       } // step-back
-    } // catch exception
+    } // stopped
 
     istep++;
   }
+  rtinfo->EnableThreadStatus(false);
+  Algorithm::EndEventGeneration();
+
+  cost.cpu_ns = ThreadCpuTimeNs() - cpu_start;
+  event_rec->SetCost(cost);
 
   LOG("EventGenerator", pNOTICE)
               << utils::print::PrintFramedMesg("Thread Summary",0,'*');
   LOG("EventGenerator", pNOTICE)
            << "The EventRecord was visited by all EventRecordVisitors";
 
-  LOG("EventGenerator", pINFO) << "** Event generation timing info **";
-  istep=0;
-  for(miter = fEVGModuleVec->begin();
-                               miter != fEVGModuleVec->end(); ++miter){
-    const EventRecordVisitorI * visitor = *miter;
+  if(!fCompiledChain) {
+    LOG("EventGenerator", pINFO) << "** Event generation timing info **";
+    istep=0;
+    for(miter = fEVGModuleVec->begin();
+                                 miter != fEVGModuleVec->end(); ++miter){
+      const EventRecordVisitorI * visitor = *miter;
 
-    BLOG("EventGenerator", pINFO)
-       << "module " << visitor->Id().Key() << " -> ~"
-                        << TMath::Max(0.,(*fEVGTime)[istep++]) << " s";
+      BLOG("EventGenerator", pINFO)
+         << "module " << visitor->Id().Key() << " -> ~"
+                          << TMath::Max(0.,(*fEVGTime)[istep++]) << " s";
+    }
   }
+  GINSTR_COUNT_EVENT();
+
   LOG("EventGenerator", pNOTICE) << "Done generating event!";
 }
 //___________________________________________________________________________
+long EventGenerator::NModuleRuns(unsigned int istep) const
+{
+  if(!fEVGNRuns || istep >= fEVGNRuns->size()) return 0;
+  return (*fEVGNRuns)[istep];
+}
+//___________________________________________________________________________
+long EventGenerator::NModuleStops(unsigned int istep) const
+{
+  if(!fEVGNStops || istep >= fEVGNStops->size()) return 0;
+  return (*fEVGNStops)[istep];
+}
+//___________________________________________________________________________
+double EventGenerator::ModuleTime(unsigned int istep) const
+{
+  if(!fEVGTimeSum || istep >= fEVGTimeSum->size()) return 0;
+  return (*fEVGTimeSum)[istep];
+}
+//___________________________________________________________________________
 const InteractionListGeneratorI * EventGenerator::IntListGenerator(void) const
 {
   return fIntListGen;
 }
 //___________________________________________________________________________
+const vector<const EventRecordVisitorI *> & EventGenerator::Modules(void) const
+{
+  return *fEVGModuleVec;
+}
+//___________________________________________________________________________
 const XSecAlgorithmI * EventGenerator::CrossSectionAlg(void) const
 {
   return fXSecModel;
@@ -241,8 +355,12 @@ void EventGenerator::Init(void)
   fVldContext   = 0;
   fEVGModuleVec = 0;
   fEVGTime      = 0;
+  fEVGTimeSum   = 0;
+  fEVGNRuns     = 0;
+  fEVGNStops    = 0;
   fXSecModel    = 0;
   fIntListGen   = 0;
+  fCompiledChain = false;
 
   fFiltUnphysMask = new TBits(GHepFlags::NFlags());
   fFiltUnphysMask->ResetAllBits(false);
@@ -267,6 +385,9 @@ void EventGenerator::LoadConfig(void)
 {
   if(fEVGModuleVec) delete fEVGModuleVec;
   if(fEVGTime)      delete fEVGTime;
+  if(fEVGTimeSum)   delete fEVGTimeSum;
+  if(fEVGNRuns)     delete fEVGNRuns;
+  if(fEVGNStops)    delete fEVGNStops;
   if(fVldContext)   delete fVldContext;
 
   LOG("EventGenerator", pDEBUG) << "Loading the generator validity context";
@@ -288,6 +409,10 @@ void EventGenerator::LoadConfig(void)
 
   fEVGModuleVec = new vector<const EventRecordVisitorI *> (nsteps);
   fEVGTime      = new vector<double>(nsteps);
+  fEVGTimeSum   = new vector<double>(nsteps, 0.);
+  fEVGNRuns     = new vector<long>  (nsteps, 0);
+  fEVGNStops    = new vector<long>  (nsteps, 0);
+  fModuleMesg.assign(nsteps, "");
 
   for(int istep = 0; istep < nsteps; istep++) {
 
@@ -306,6 +431,18 @@ void EventGenerator::LoadConfig(void)
 
     (*fEVGModuleVec)[istep] = visitor;
     (*fEVGTime)[istep]      = 0;
+
+    string mesg = "Event generation thread: " + this->Id().Key() +
+                  " -> Running module: " + visitor->Id().Key();
+    fModuleMesg[istep] = utils::print::PrintFramedMesg(mesg,0,'~');
+  }
+
+  //-- skip the per-module timing and its summary?
+  //   (for threads of cheap processes, where it dominates the event time)
+  GetParamDef("CompiledChain", fCompiledChain, false);
+  if(fCompiledChain) {
+    LOG("EventGenerator", pINFO)
+      << " -- Running the modules as a compiled chain (no module timing)";
   }
 
   //-- load the interaction list generator
@@ -10,6 +10,11 @@
 
          Is a concrete implementation of the EventGeneratorI interface.
 
+         The modules are resolved once, when the generator is configured.
+         With CompiledChain set (for threads of cheap processes, such as
+         IBD or nu-e elastic) the modules are run without the per-module
+         CPU timing, whose cost is comparable to that of the modules.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -25,6 +30,7 @@
 #define _EVENT_GENERATOR_H_
 
 #include <vector>
+#include <string>
 
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/GHEP/GHepRecordHistory.h"
@@ -33,6 +39,7 @@ class TStopwatch;
 class TBits;
 
 using std::vector;
+using std::string;
 
 namespace genie {
 
@@ -51,6 +58,14 @@ public :
   const InteractionListGeneratorI * IntListGenerator (void) const;
   const XSecAlgorithmI *            CrossSectionAlg  (void) const;
 
+  //-- the event record visitors run, in order, by this generator
+  const vector<const EventRecordVisitorI *> & Modules (void) const;
+
+  //-- module statistics, summed over all events generated so far
+  long   NModuleRuns  (unsigned int istep) const; ///< # of times the module ran
+  long   NModuleStops (unsigned int istep) const; ///< # of times the module stopped the thread (rejections)
+  double ModuleTime   (unsigned int istep) const; ///< cpu time spent in the module (s), 0 if CompiledChain
+
   //-- override the Algorithm::Configure methods to load configuration
   //   data to private data members
   void Configure (const Registry & config);
@@ -64,6 +79,11 @@ private:
   //-- private data members
   vector<const EventRecordVisitorI *> * fEVGModuleVec;   ///< list of modules
   vector<double> *                      fEVGTime;        ///< module timing info
+  vector<double> *                      fEVGTimeSum;     ///< module timing, summed over all events
+  vector<long> *                        fEVGNRuns;       ///< # of runs of each module
+  vector<long> *                        fEVGNStops;      ///< # of thread stops by each module
+  vector<string>                        fModuleMesg;     ///< framed "running module" message per module
+  bool                                  fCompiledChain;  ///< run the modules without timing them?
   const XSecAlgorithmI *                fXSecModel;      ///< xsec model for events handled by thread
   const InteractionListGeneratorI *     fIntListGen;     ///< generates list of handled interactions
   GVldContext *                         fVldContext;     ///< validity context
@@ -0,0 +1,91 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         University of Liverpool & STFC Rutherford Appleton Lab 
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::fInstance = 0;
+//____________________________________________________________________________
+EventRecordPool::EventRecordPool()
+{
+  fInstance = 0;
+  fMaxSize  = 0;
+}
+//____________________________________________________________________________
+EventRecordPool::~EventRecordPool()
+{
+  fMaxSize = 0;
+  this->Trim();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+EventRecordPool * EventRecordPool::Instance()
+{
+  if(fInstance == 0) {
+    static EventRecordPool::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new EventRecordPool;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+EventRecord * EventRecordPool::Get(void)
+{
+// Returns a reset event record, reusing a recycled one if available.
+// The caller owns the returned record.
+
+  if(fFree.empty()) return new EventRecord;
+
+  EventRecord * event = fFree.back();
+  fFree.pop_back();
+  return event;
+}
+//____________________________________________________________________________
+void EventRecordPool::Recycle(EventRecord * event)
+{
+// Takes ownership of an event record that is no longer needed.
+// The record is reset (keeping its particle storage) and kept for reuse,
+// or deleted if the pool is full.
+
+  if(!event) return;
+
+  if(fFree.size() >= fMaxSize) {
+    delete event;
+    return;
+  }
+  event->RecycleRecord();
+  fFree.push_back(event);
+}
+//____________________________________________________________________________
+void EventRecordPool::SetMaxSize(unsigned int n)
+{
+  LOG("EventRecordPool", pINFO)
+     << "Keeping up to " << n << " recycled event records";
+
+  fMaxSize = n;
+  this->Trim();
+}
+//____________________________________________________________________________
+void EventRecordPool::Trim(void)
+{
+  while(fFree.size() > fMaxSize) {
+    delete fFree.back();
+    fFree.pop_back();
+  }
+}
+//____________________________________________________________________________
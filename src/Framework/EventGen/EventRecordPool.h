@@ -0,0 +1,75 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::EventRecordPool
+
+\brief    Keeps event records returned by the event generation drivers and
+          hands them back (reset, but with their particle storage kept) to
+          the interaction selectors, so that the GHepParticle array of an
+          event record is not de/allocated for every generated event.
+          Pooling is off by default (max size 0): records passed to
+          Recycle() are then simply deleted.
+
+\author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _EVENT_RECORD_POOL_H_
+#define _EVENT_RECORD_POOL_H_
+
+#include <vector>
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+
+class EventRecordPool
+{
+public:
+  static EventRecordPool * Instance(void);
+
+  EventRecord * Get        (void);
+  void          Recycle    (EventRecord * event);
+  void          SetMaxSize (unsigned int n);
+
+  unsigned int  MaxSize    (void) const { return fMaxSize;     }
+  unsigned int  Size       (void) const { return fFree.size(); }
+
+private:
+  EventRecordPool();
+  EventRecordPool(const EventRecordPool & pool);
+  virtual ~EventRecordPool();
+
+  void Trim (void);
+
+  //! self
+  static EventRecordPool * fInstance;
+
+  unsigned int          fMaxSize; ///< max number of kept records
+  vector<EventRecord *> fFree;    ///< records ready to be handed out
+
+  //! clean
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (EventRecordPool::fInstance !=0) {
+            delete EventRecordPool::fInstance;
+            EventRecordPool::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+
+#endif // _EVENT_RECORD_POOL_H_
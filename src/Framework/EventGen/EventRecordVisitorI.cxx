@@ -15,6 +15,8 @@
 //____________________________________________________________________________
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 
 using namespace genie;
 
@@ -42,3 +44,24 @@ EventRecordVisitorI::~EventRecordVisitorI()
 
 }
 //___________________________________________________________________________
+void EventRecordVisitorI::StopThread(
+                 const exceptions::EVGThreadException & status) const
+{
+// Posts the event generation thread status to the EventGenerator running
+// this module, which handles it exactly as it would handle the same status
+// thrown as an exception, but without the cost of stack unwinding.
+// The caller must return from its ProcessEventRecord() right after calling
+// this method. As the status is only checked after each module of the
+// thread, this must not be used by modules called by other modules:
+// these must keep throwing.
+// If no EventGenerator accepts posted statuses (eg the module is being run
+// on its own) the status is thrown as before.
+
+  RunningThreadInfo * rtinfo = RunningThreadInfo::Instance();
+  if(rtinfo->ThreadStatusEnabled()) {
+    rtinfo->SetThreadStatus(status);
+    return;
+  }
+  throw status;
+}
+//___________________________________________________________________________
@@ -26,6 +26,7 @@
 namespace genie {
 
 class GHepRecord;
+namespace exceptions { class EVGThreadException; }
 
 class EventRecordVisitorI : public Algorithm {
 
@@ -42,6 +43,12 @@ protected :
   EventRecordVisitorI();
   EventRecordVisitorI(string name);
   EventRecordVisitorI(string name, string config);
+
+  //-- exception-free alternative to throwing an EVGThreadException from
+  //   ProcessEventRecord(): post the status & return from ProcessEventRecord()
+  //   (throws the input status if the running thread does not accept it)
+
+  void StopThread(const exceptions::EVGThreadException & status) const;
 };
 
 }      // genie namespace
@@ -12,6 +12,7 @@
 #include <cassert>
 #include <cstdlib>
 #include <sstream>
+#include <iomanip>
 
 #include <TSystem.h>
 #include <TMath.h>
@@ -22,6 +23,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/GEVGDriver.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorList.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/ToyInteractionSelector.h"
@@ -40,6 +42,7 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/ScopeProfiler.h"
 
 using std::ostringstream;
 
@@ -156,10 +159,22 @@ void GEVGDriver::Configure(const InitialState & is)
   LOG("GEVGDriver", pNOTICE)
         << utils::print::PrintFramedMesg(mesg.str(), 0, '*');
 
+  this -> ConfigureGenerators   (init_state);
+  this -> ConfigureInteractions ();
+}
+//___________________________________________________________________________
+void GEVGDriver::ConfigureGenerators(const InitialState & is)
+{
+  InitialState init_state(is.TgtPdg(), is.ProbePdg()); // filter any other init state info
+
   this -> BuildInitialState            (init_state);
   this -> BuildGeneratorList           ();
-  this -> BuildInteractionGeneratorMap ();
   this -> BuildInteractionSelector     ();
+}
+//___________________________________________________________________________
+void GEVGDriver::ConfigureInteractions(InteractionListTemplates * templates)
+{
+  this -> BuildInteractionGeneratorMap (templates);
 
   LOG("GEVGDriver", pINFO) << "Done configuring. \n";
 }
@@ -187,7 +202,8 @@ void GEVGDriver::BuildGeneratorList(void)
   fEvGenList = evglist_assembler.AssembleGeneratorList();
 }
 //___________________________________________________________________________
-void GEVGDriver::BuildInteractionGeneratorMap(void)
+void GEVGDriver::BuildInteractionGeneratorMap(
+  InteractionListTemplates * templates)
 {
 //! Map each possible interaction, for the given initial state, to one
 //! of the generators loaded up
@@ -197,7 +213,7 @@ void GEVGDriver::BuildInteractionGeneratorMap(void)
 
   fIntGenMap = new InteractionGeneratorMap;
   fIntGenMap->UseGeneratorList(fEvGenList);
-  fIntGenMap->BuildMap(*fInitState);
+  fIntGenMap->BuildMap(*fInitState, templates);
 
   string mesgh = "Interaction -> Generator assignments for Initial State: ";
 
@@ -238,7 +254,10 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
   //   event record
   LOG("GEVGDriver", pINFO)
      << "Selecting an Interaction & Bootstraping the EventRecord";
-  fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
+  {
+    GINSTR_ALG_SCOPE(fIntSelector);
+    fCurrentRecord = fIntSelector->SelectInteraction(fIntGenMap, nu4p);
+  }
 
   if(!fCurrentRecord) {
      LOG("GEVGDriver", pWARN)
@@ -284,7 +303,10 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
          << utils::print::PrintFramedMesg(mesg,1,'=');
 
   fCurrentRecord->SetUnphysEventMask(*fUnphysEventMask);
-  evgen->ProcessEventRecord(fCurrentRecord);
+  {
+    GINSTR_ALG_SCOPE(evgen);
+    evgen->ProcessEventRecord(fCurrentRecord);
+  }
 
   //-- Check the generated event flags. The default behaviour is
   //   to reject an unphysical event and enter in recursive mode
@@ -310,7 +332,7 @@ EventRecord * GEVGDriver::GenerateEvent(const TLorentzVector & nu4p)
      } else {
        LOG("GEVGDriver", pWARN)
           << "The generated unphysical event is rejected";
-       delete fCurrentRecord;
+       EventRecordPool::Instance()->Recycle(fCurrentRecord);
        fCurrentRecord = 0;
        fNRecLevel++; // increase the nested level counter
 
@@ -387,12 +409,22 @@ double GEVGDriver::XSecSum(const TLorentzVector & nup4)
   // Get the list of all interactions that can be generated by this driver
   const InteractionList & ilst = fIntGenMap->GetInteractionList();
 
-  // Loop over all interactions & compute cross sections
-  InteractionList::const_iterator intliter;
-  for(intliter = ilst.begin(); intliter != ilst.end(); ++intliter) {
+  // Only the interactions whose energy window contains E contribute: the
+  // leading entries of the threshold-ordered list (summed in list order)
+  double E = nup4.Energy();
+  const vector<unsigned int> & channels =
+                          fIntGenMap->ChannelsByThreshold(fUseSplines);
+  unsigned int nopen = fIntGenMap->NOpenChannels(E, fUseSplines);
+  vector<double> xseclist(ilst.size(), 0.);
+
+  // Loop over the open interactions & compute cross sections
+  for(unsigned int k = 0; k < nopen; k++) {
+
+     unsigned int i = channels[k];
+     if(E > fIntGenMap->ChannelEmax(i, fUseSplines)) continue;
 
      // get current interaction
-     Interaction * interaction = new Interaction(**intliter);
+     Interaction * interaction = new Interaction(*ilst[i]);
      interaction->InitStatePtr()->SetProbeP4(nup4);
 
      string code = interaction->AsString();
@@ -408,15 +440,14 @@ double GEVGDriver::XSecSum(const TLorentzVector & nup4)
      double xsec = 0;
      bool spline_exists = xssl->SplineExists(xsec_alg, interaction);
      if (spline_exists && fUseSplines) {
-        double E = nup4.Energy();
         xsec = xssl->GetSpline(xsec_alg,interaction)->Evaluate(E);
      } else
         xsec = xsec_alg->Integral(interaction);
 
      xsec = TMath::Max(0., xsec);
 
-     // sum-up and report
-     xsec_sum += xsec;
+     // report
+     xseclist[i] = xsec;
      LOG("GEVGDriver", pDEBUG)
             << "\nInteraction   = " << code
             << "\nCross Section "
@@ -426,6 +457,8 @@ double GEVGDriver::XSecSum(const TLorentzVector & nup4)
      delete interaction;
   } // loop over event generators
 
+  for(unsigned int i = 0; i < xseclist.size(); i++) xsec_sum += xseclist[i];
+
   PDGLibrary * pdglib = PDGLibrary::Instance();
   LOG("GEVGDriver", pINFO)
     << "SumXSec("
@@ -486,6 +519,104 @@ void GEVGDriver::CreateXSecSumSpline(
   delete [] xsec;
 }
 //___________________________________________________________________________
+static ULong64_t HashBytes(ULong64_t h, const void * data, size_t n)
+{
+  const ULong64_t kFNVPrime = 1099511628211ULL;
+  const unsigned char * c = (const unsigned char *) data;
+  for(size_t i = 0; i < n; i++) {
+    h ^= c[i];
+    h *= kFNVPrime;
+  }
+  return h;
+}
+//___________________________________________________________________________
+string GEVGDriver::XSecSumSplineKey(void) const
+{
+// Key of the sum spline for the initial state of this driver. It includes an
+// (FNV-1a) hash of the keys and knots of the splines of all interactions, in
+// the order of the interaction list. Returns an empty string if any of these
+// splines is missing.
+
+  if(!fUseSplines || !fIntGenMap) return "";
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  ULong64_t h = 14695981039346656037ULL;
+
+  const InteractionList & ilst = fIntGenMap->GetInteractionList();
+  InteractionList::const_iterator intliter = ilst.begin();
+  for( ; intliter != ilst.end(); ++intliter) {
+    const Interaction * interaction = *intliter;
+    const XSecAlgorithmI * xsec_alg =
+          fIntGenMap->FindGenerator(interaction)->CrossSectionAlg();
+    if(!xssl->SplineExists(xsec_alg, interaction)) return "";
+    const Spline * spl = xssl->GetSpline(xsec_alg, interaction);
+    if(!spl) return "";
+
+    string key = xssl->BuildSplineKey(xsec_alg, interaction);
+    h = HashBytes(h, key.c_str(), key.size());
+    for(int i = 0; i < spl->NKnots(); i++) {
+      double x = 0, y = 0;
+      spl->GetKnot(i, x, y);
+      h = HashBytes(h, &x, sizeof(double));
+      h = HashBytes(h, &y, sizeof(double));
+    }
+  }
+
+  ostringstream key;
+  key << "genie::XSecSum/" << std::hex << std::setw(16) << std::setfill('0')
+      << h << std::dec << "/nu:" << fInitState->ProbePdg()
+      << ";tgt:" << fInitState->TgtPdg() << ";";
+  return key.str();
+}
+//___________________________________________________________________________
+bool GEVGDriver::LoadXSecSumSpline(double Emin, double Emax)
+{
+// Use the sum spline stored in the XSecSplineList (eg computed by gmkspl)
+// instead of summing the splines of all interactions again
+
+  string key = this->XSecSumSplineKey();
+  if(key.size() == 0) return false;
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+  if(!xssl->SplineExists(key)) return false;
+
+  const Spline * spl = xssl->GetSpline(key);
+  if(!spl) return false;
+
+  const double eps = 1E-6;
+  if(spl->XMin() > Emin*(1+eps) || spl->XMax() < Emax*(1-eps)) {
+     LOG("GEVGDriver", pINFO)
+       << "The stored sum spline (E = [" << spl->XMin() << ", " << spl->XMax()
+       << "]) doesn't cover E = [" << Emin << ", " << Emax << "]";
+     return false;
+  }
+
+  LOG("GEVGDriver", pINFO) << "Using the stored sum spline: " << key;
+
+  if (fXSecSumSpl) delete fXSecSumSpl;
+  fXSecSumSpl = new Spline(*spl);
+  return true;
+}
+//___________________________________________________________________________
+void GEVGDriver::StoreXSecSumSpline(void) const
+{
+// Add the sum spline to the XSecSplineList, so that it is saved along with
+// the splines it was computed from
+
+  if(!fXSecSumSpl) {
+     LOG("GEVGDriver", pWARN) << "No sum spline to store";
+     return;
+  }
+  string key = this->XSecSumSplineKey();
+  if(key.size() == 0) {
+     LOG("GEVGDriver", pWARN)
+       << "Can't store the sum spline: Not all splines are available";
+     return;
+  }
+  XSecSplineList::Instance()->AddSpline(key, *fXSecSumSpl);
+}
+//___________________________________________________________________________
 const Spline * GEVGDriver::XSecSpline(const Interaction * interaction) const
 {
 // Returns the cross section spline for the input interaction as was
@@ -45,6 +45,7 @@ class EventGeneratorI;
 class InteractionSelectorI;
 class InteractionGeneratorMap;
 class InteractionList;
+class InteractionListTemplates;
 class Interaction;
 class InitialState;
 class Target;
@@ -69,6 +70,17 @@ public :
   void Configure (int nu_pdgc, int Z, int A);
   void Configure (const InitialState & init_state);
 
+  // Configure the driver in two steps (Configure() does both):
+  // ConfigureGenerators() loads the event generators and the interaction
+  // selector (shared through the AlgFactory) and ConfigureInteractions()
+  // builds the interaction -> generator map, the most expensive step.
+  // The latter only reads the shared algorithms and can run concurrently
+  // for drivers of different initial states (see GMCJDriver). Drivers
+  // sharing an InteractionListTemplates get the interaction lists of
+  // targets of the same class created once.
+  void ConfigureGenerators   (const InitialState & init_state);
+  void ConfigureInteractions (InteractionListTemplates * templates = 0);
+
   // Generate single event
   EventRecord * GenerateEvent (const TLorentzVector & nu4p);
 
@@ -95,6 +107,14 @@ public :
   double XSecSum             (const TLorentzVector & nup4);
   void   CreateXSecSumSpline (int nk, double Emin, double Emax, bool inlogE=true);
 
+  // Sum splines stored in the XSecSplineList, keyed by a hash of all
+  // constituent splines (they are only used with the splines they were
+  // computed from). LoadXSecSumSpline() returns false if there is no stored
+  // sum spline covering the input energy range.
+  string XSecSumSplineKey    (void) const;
+  bool   LoadXSecSumSpline   (double Emin, double Emax);
+  void   StoreXSecSumSpline  (void) const;
+
   // Get validity range (combined validity range of loaded evg threads)
   Range1D_t ValidEnergyRange (void) const;
 
@@ -111,7 +131,7 @@ private:
   void CleanUp                      (void);
   void BuildInitialState            (const InitialState & init_state);
   void BuildGeneratorList           (void);
-  void BuildInteractionGeneratorMap (void);
+  void BuildInteractionGeneratorMap (InteractionListTemplates * templates = 0);
   void BuildInteractionSelector     (void);
   void AssertIsValidInitState       (void) const;
 
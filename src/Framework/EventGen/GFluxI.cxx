@@ -15,6 +15,7 @@
 //____________________________________________________________________________
 
 #include "Framework/EventGen/GFluxI.h"
+#include "Framework/Messenger/Messenger.h"
 
 using namespace genie;
 
@@ -29,3 +30,63 @@ GFluxI::~GFluxI()
 
 }
 //___________________________________________________________________________
+bool GFluxI::GenerateEntry(long int /*index*/)
+{
+// Random access to flux neutrinos is not supported by default. Flux drivers
+// reading flux ntuples should override this.
+
+  return false;
+}
+//___________________________________________________________________________
+int GFluxI::GenerateBatch(int n, FluxBatch & batch)
+{
+// Default implementation, looping over GenerateNext(). Flux neutrinos that
+// could not be generated are skipped, so the batch is only short of n at
+// End(). The current flux neutrino of the driver is the last one of the
+// batch. Flux drivers may override this to fill the batch directly.
+
+  batch.Clear();
+  while(batch.N() < n && !this->End()) {
+    if(!this->GenerateNext()) {
+      LOG("Flux", pWARN) << "*** Couldn't generate next flux ray! ";
+      continue;
+    }
+    batch.Add(this->PdgCode(), this->Momentum(), this->Position(),
+              this->Weight(), this->Index());
+  }
+  return batch.N();
+}
+//___________________________________________________________________________
+bool GFluxI::SaveState(TDirectory * /*dir*/) const
+{
+// MC job checkpoints are not supported by default. Flux drivers whose next 
+// flux neutrinos depend on more than the RandomGen streams (eg the position
+// in a flux ntuple) should override this and RestoreState().
+
+  return false;
+}
+//___________________________________________________________________________
+bool GFluxI::RestoreState(TDirectory * /*dir*/)
+{
+  return false;
+}
+//___________________________________________________________________________
+void FluxBatch::Clear(void)
+{
+  PdgCode.clear();
+  Momentum.clear();
+  Position.clear();
+  Weight.clear();
+  Index.clear();
+}
+//___________________________________________________________________________
+void FluxBatch::Add(int pdg, const TLorentzVector & p4, 
+                    const TLorentzVector & x4, double wgt, long int index)
+{
+  PdgCode.push_back(pdg);
+  Momentum.push_back(p4);
+  Position.push_back(x4);
+  Weight.push_back(wgt);
+  Index.push_back(index);
+}
+//___________________________________________________________________________
@@ -19,6 +19,12 @@
    GFluxI::GenerateWeighted methods needed so that can be used with the new 
    pre-generation of flux interaction probabilities functionality added to
    GMCJDriver. 
+ @ Oct 14, 2026 - CA
+   Added the optional GFluxI::GenerateBatch method (and the FluxBatch
+   container) for generating flux neutrinos a batch at a time.
+ @ Oct 14, 2026 - CA
+   Added the optional GFluxI::SaveState and GFluxI::RestoreState methods,
+   for the MC job checkpoints (see GMCJCheckpoint).
 
 */
 //____________________________________________________________________________
@@ -26,14 +32,38 @@
 #ifndef _G_FLUX_I_H_
 #define _G_FLUX_I_H_
 
+#include <vector>
+
 #include <TObject.h>
+#include <TLorentzVector.h>
 
-class TLorentzVector;
+class TDirectory;
 
 namespace genie {
 
 class PDGCodeList;
 
+/// FluxBatch:
+/// ==========
+/// A batch of flux neutrinos, with each of their properties stored in its 
+/// own array (see GFluxI::GenerateBatch)
+///
+class FluxBatch {
+public :
+  FluxBatch() { this->Clear(); }
+
+  int  N     (void) const { return (int) PdgCode.size(); }
+  void Clear (void);
+  void Add   (int pdg, const TLorentzVector & p4, const TLorentzVector & x4,
+              double wgt, long int index);
+
+  std::vector<int>             PdgCode;   ///< flux neutrino pdg codes
+  std::vector<TLorentzVector>  Momentum;  ///< flux neutrino 4-momenta
+  std::vector<TLorentzVector>  Position;  ///< flux neutrino 4-positions
+  std::vector<double>          Weight;    ///< flux neutrino weights
+  std::vector<long int>        Index;     ///< flux neutrino indices (see GFluxI::Index)
+};
+
 class GFluxI {
 
 public :
@@ -54,6 +84,14 @@ public :
   virtual void                   Clear            (Option_t * opt   ) = 0; ///< reset state variables based on opt
   virtual void                   GenerateWeighted (bool gen_weighted) = 0; ///< set whether to generate weighted or unweighted neutrinos
 
+  //
+  // optional extensions of the GFluxI interface:
+  //
+  virtual bool                   GenerateEntry    (long int index);          ///< generate the (weighted) flux neutrino with the input Index() (return false if not supported)
+  virtual int                    GenerateBatch    (int n, FluxBatch & batch); ///< generate up to n flux neutrinos into batch (returns the number generated; fewer than n only at End())
+  virtual bool                   SaveState        (TDirectory * dir) const;  ///< write the driver state (eg flux ntuple position & exposure counters) in a MC job checkpoint (return false if not supported)
+  virtual bool                   RestoreState     (TDirectory * dir);        ///< restore the driver state written by SaveState() (return false if not supported)
+
 protected:
   GFluxI();
 };
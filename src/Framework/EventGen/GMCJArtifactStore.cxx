@@ -0,0 +1,270 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <stdint.h>
+#include <glob.h>
+#include <sys/stat.h>
+
+#include <TSystem.h>
+
+#include "Framework/EventGen/GMCJArtifactStore.h"
+#include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/StringUtils.h"
+
+using std::ostringstream;
+using std::ifstream;
+using std::ofstream;
+
+using namespace genie;
+
+namespace {
+  void fnv1a(uint64_t & hash, const char * data, size_t n)
+  {
+    for(size_t i = 0; i < n; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+}
+//____________________________________________________________________________
+GMCJArtifactStore::GMCJArtifactStore(string directory) :
+fDirectory(directory)
+{
+  if(!this->IsEnabled()) return;
+
+  if(gSystem->AccessPathName(fDirectory.c_str())) {
+    gSystem->mkdir(fDirectory.c_str(), true);
+  }
+  if(gSystem->AccessPathName(fDirectory.c_str(), kWritePermission)) {
+    LOG("GMCJArtifacts", pWARN)
+      << "Can not write in the artifact store: " << fDirectory
+      << " - Disabling it";
+    fDirectory = "";
+    return;
+  }
+  LOG("GMCJArtifacts", pNOTICE) << "Using the artifact store: " << fDirectory;
+}
+//____________________________________________________________________________
+GMCJArtifactStore::~GMCJArtifactStore()
+{
+  this->Commit();
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::AddKey(string name, string value)
+{
+  fKeys.push_back(pair<string,string>(name, value));
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::AddKey(string name, double value)
+{
+  ostringstream str;
+  str << std::setprecision(17) << value;
+  this->AddKey(name, str.str());
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::AddFileKey(string name, string filename)
+{
+// Key on the file contents, so that the artifacts of an edited geometry are
+// not picked up even if the file name did not change
+
+  if(!this->IsEnabled()) return;
+
+  uint64_t hash = 14695981039346656037ULL;
+  ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!in.good()) {
+    LOG("GMCJArtifacts", pWARN) << "Can not read: " << filename;
+    this->AddKey(name, filename + " (unreadable)");
+    return;
+  }
+  vector<char> buffer(1<<20);
+  while(in) {
+    in.read(&buffer[0], buffer.size());
+    fnv1a(hash, &buffer[0], in.gcount());
+  }
+  ostringstream str;
+  str << filename << " #" << std::hex << std::setw(16)
+      << std::setfill('0') << hash;
+  this->AddKey(name, str.str());
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::AddFilesKey(string name, string patterns)
+{
+// Key on the files matching a comma separated list of (glob) patterns, as
+// given to the flux drivers. Flux ntuple sets are too large to be read, so
+// the files are identified by name, size and modification time.
+
+  if(!this->IsEnabled()) return;
+
+  ostringstream str;
+  str << patterns;
+  vector<string> pattv = utils::str::Split(patterns, ",");
+  for(unsigned int ip = 0; ip < pattv.size(); ip++) {
+    string pattern = utils::str::TrimSpaces(pattv[ip]);
+    if(pattern.size() == 0) continue;
+    glob_t g;
+    int status = glob(pattern.c_str(), 0, NULL, &g);
+    if(status == 0) {
+      for(size_t i = 0; i < g.gl_pathc; i++) {
+        struct stat info;
+        if(stat(g.gl_pathv[i], &info) != 0) continue;
+        str << " " << g.gl_pathv[i] << ":" << (long long) info.st_size
+            << ":" << (long long) info.st_mtime;
+      }
+    }
+    globfree(&g);
+  }
+  this->AddKey(name, str.str());
+}
+//____________________________________________________________________________
+string GMCJArtifactStore::Hash(void) const
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for(unsigned int i = 0; i < fKeys.size(); i++) {
+    const string & name  = fKeys[i].first;
+    const string & value = fKeys[i].second;
+    fnv1a(hash, name.data(),  name.size());
+    fnv1a(hash, "=", 1);
+    fnv1a(hash, value.data(), value.size());
+    fnv1a(hash, "\n", 1);
+  }
+  ostringstream str;
+  str << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return str.str();
+}
+//____________________________________________________________________________
+string GMCJArtifactStore::Path(string kind) const
+{
+  if(!this->IsEnabled()) return "";
+  return fDirectory + "/" + this->Hash() + "." + kind;
+}
+//____________________________________________________________________________
+bool GMCJArtifactStore::Has(string kind) const
+{
+  if(!this->IsEnabled()) return false;
+  return !(gSystem->AccessPathName(this->Path(kind).c_str()));
+}
+//____________________________________________________________________________
+bool GMCJArtifactStore::UseMaxPathLengths(GMCJDriver * driver)
+{
+// Use the stored max path-length list of this setup, if any. Otherwise
+// remember where the list computed by the driver is to be stored (see
+// SaveMaxPathLengths()). Call before GMCJDriver::Configure().
+
+  if(!this->IsEnabled()) return false;
+
+  fMaxPlFile = this->Path("maxpl.xml");
+  if(!this->Has("maxpl.xml")) {
+    LOG("GMCJArtifacts", pNOTICE)
+      << "No stored max path lengths for this setup (" << this->Hash() << ")";
+    return false;
+  }
+  LOG("GMCJArtifacts", pNOTICE)
+    << "Using the stored max path lengths: " << fMaxPlFile;
+  bool found = driver->UseMaxPathLengths(fMaxPlFile);
+  if(found) fMaxPlFile = "";
+  return found;
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::SaveMaxPathLengths(const GMCJDriver * driver)
+{
+// Store the max path-length list computed by the configured driver, unless
+// it was read from the store
+
+  if(!this->IsEnabled() || fMaxPlFile.size() == 0) return;
+
+  string tmpfile = this->TempPath(fMaxPlFile);
+  driver->MaxPathLengths().SaveAsXml(tmpfile);
+  this->WriteKeys();
+  this->Publish(tmpfile, fMaxPlFile);
+  fMaxPlFile = "";
+}
+//____________________________________________________________________________
+bool GMCJArtifactStore::PreCalcFluxProbabilities(GMCJDriver * driver)
+{
+// Load the stored flux interaction probabilities of this setup, if any, or
+// pre-calculate them and add them to the store. The driver writes the tree
+// in its probability file, which is only complete once the driver is
+// deleted: The file is added to the store at Commit().
+
+  if(!this->IsEnabled()) return driver->PreCalcFluxProbabilities();
+
+  string file = this->Path("flxprobs.root");
+  if(this->Has("flxprobs.root")) {
+    LOG("GMCJArtifacts", pNOTICE)
+      << "Using the stored flux interaction probabilities: " << file;
+    if(driver->LoadFluxProbabilities(file)) return true;
+
+    // the driver holds on to the unusable file: recalculate, without storing
+    LOG("GMCJArtifacts", pWARN)
+      << "Could not load: " << file << " - Recalculating them";
+    return driver->PreCalcFluxProbabilities();
+  }
+
+  string tmpfile = this->TempPath(file);
+  driver->SaveFluxProbabilities(tmpfile);
+  bool success = driver->PreCalcFluxProbabilities();
+  if(success) {
+    this->WriteKeys();
+    fPending.push_back(pair<string,string>(tmpfile, file));
+  } else {
+    std::remove(tmpfile.c_str());
+  }
+  return success;
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::Commit(void)
+{
+  for(unsigned int i = 0; i < fPending.size(); i++) {
+    this->Publish(fPending[i].first, fPending[i].second);
+  }
+  fPending.clear();
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::WriteKeys(void) const
+{
+// Write the keys of the current setup next to its artifacts, to be able to
+// tell what a stored artifact is relevant for
+
+  string file    = this->Path("keys.txt");
+  string tmpfile = this->TempPath(file);
+  ofstream out(tmpfile.c_str());
+  for(unsigned int i = 0; i < fKeys.size(); i++) {
+    out << fKeys[i].first << ": " << fKeys[i].second << std::endl;
+  }
+  out.close();
+  this->Publish(tmpfile, file);
+}
+//____________________________________________________________________________
+void GMCJArtifactStore::Publish(const string & tmpfile, const string & file) const
+{
+  if(std::rename(tmpfile.c_str(), file.c_str()) != 0) {
+    LOG("GMCJArtifacts", pWARN) << "Could not store: " << file;
+    std::remove(tmpfile.c_str());
+    return;
+  }
+  LOG("GMCJArtifacts", pNOTICE) << "Stored: " << file;
+}
+//____________________________________________________________________________
+string GMCJArtifactStore::TempPath(const string & file) const
+{
+  ostringstream tmpname;
+  tmpname << file << "." << gSystem->GetPid() << ".tmp";
+  return tmpname.str();
+}
+//____________________________________________________________________________
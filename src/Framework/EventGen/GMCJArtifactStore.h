@@ -0,0 +1,110 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GMCJArtifactStore
+
+\brief    A persistent, content-addressed store of the costly products of the
+          GMCJDriver initialization (the maximum path-length list of the
+          geometry and the pre-calculated flux interaction probabilities),
+          shared by the MC jobs of the experiment-specific event generation
+          applications (gevgen_fnal, gevgen_t2k, gevgen_lardm, gevgen_dm).
+
+          The application describes its job setup with a set of keys: the
+          geometry file (hashed by content), the flux file set (hashed by
+          file name, size and modification time, as flux ntuples are large),
+          the geometry selection (top volume, fiducial cut, ...) and, for the
+          flux interaction probabilities, the physics inputs (tune, event
+          generator list, cross section file). Each artifact is stored in the
+          store directory under the hash of the keys that were added before
+          it was requested, along with a text file listing the keys. A job
+          finding an artifact for its setup warm-starts from it; otherwise it
+          computes it and adds it to the store. Files are first written under
+          a temporary name, and renamed once complete, so that concurrent jobs
+          sharing the store never read a partial artifact.
+
+          Typical use (see the --artifact-store option in RunOpt):
+
+            GMCJArtifactStore store(RunOpt::Instance()->ArtifactStore());
+            store.AddFileKey ("geom", geom_file);
+            store.AddFilesKey("flux", flux_files);
+            ...
+            store.UseMaxPathLengths(mcj_driver);  // before Configure()
+            mcj_driver->Configure();
+            store.SaveMaxPathLengths(mcj_driver);
+            store.AddKey("tune", tune_name);
+            ...
+            store.PreCalcFluxProbabilities(mcj_driver);
+            ...
+            delete mcj_driver;
+            store.Commit();
+
+          An empty store directory disables the store, and all methods
+          reduce to the plain GMCJDriver calls.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_ARTIFACT_STORE_H_
+#define _G_MC_JOB_ARTIFACT_STORE_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+using std::string;
+using std::vector;
+using std::pair;
+
+namespace genie {
+
+class GMCJDriver;
+
+class GMCJArtifactStore {
+
+public :
+  GMCJArtifactStore(string directory);
+ ~GMCJArtifactStore();
+
+  bool   IsEnabled   (void) const { return fDirectory.size() > 0; }
+
+  // describe the job setup
+  void   AddKey      (string name, string value);
+  void   AddKey      (string name, double value);
+  void   AddFileKey  (string name, string filename);
+  void   AddFilesKey (string name, string patterns);
+
+  // location of an artifact for the keys added so far
+  string Hash        (void) const;
+  string Path        (string kind) const;
+  bool   Has         (string kind) const;
+
+  // warm-start the driver from the store, or add its products to it
+  bool   UseMaxPathLengths         (GMCJDriver * driver);
+  void   SaveMaxPathLengths        (const GMCJDriver * driver);
+  bool   PreCalcFluxProbabilities  (GMCJDriver * driver);
+
+  // add the artifacts still being written (call once the driver is deleted)
+  void   Commit      (void);
+
+private:
+  void   WriteKeys   (void) const;
+  void   Publish     (const string & tmpfile, const string & file) const;
+  string TempPath    (const string & file) const;
+
+  string                      fDirectory;  ///< store directory ("" if disabled)
+  vector< pair<string,string> > fKeys;     ///< keys describing the job setup
+  string                      fMaxPlFile;  ///< max path-length artifact, set by UseMaxPathLengths
+  vector< pair<string,string> > fPending;  ///< (temporary, final) artifact files to rename at Commit()
+};
+
+}      // genie namespace
+
+#endif // _G_MC_JOB_ARTIFACT_STORE_H_
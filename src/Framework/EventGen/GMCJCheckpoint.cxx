@@ -0,0 +1,259 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <sstream>
+
+#include <TSystem.h>
+#include <TFile.h>
+#include <TDirectory.h>
+#include <TParameter.h>
+
+#include "Framework/EventGen/GFluxI.h"
+#include "Framework/EventGen/GMCJCheckpoint.h"
+#include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+GMCJCheckpoint::GMCJCheckpoint(string filename, long int interval) :
+fFilename(filename),
+fInterval(interval),
+fLastSave(0),
+fMovedAside("")
+{
+  if(fInterval < 1) fInterval = 1;
+  if(!this->IsEnabled()) return;
+
+  LOG("GMCJCheckpoint", pNOTICE)
+    << "Writing a MC job checkpoint every " << fInterval
+    << " events in: " << fFilename;
+}
+//____________________________________________________________________________
+GMCJCheckpoint::~GMCJCheckpoint()
+{
+
+}
+//____________________________________________________________________________
+bool GMCJCheckpoint::IsDue(long int nevents) const
+{
+  return this->IsEnabled() && (nevents - fLastSave >= fInterval);
+}
+//____________________________________________________________________________
+bool GMCJCheckpoint::Save(long int nevents, const GMCJDriver & driver)
+{
+  if(!this->IsEnabled()) return false;
+
+  ostringstream tmpname;
+  tmpname << fFilename << "." << gSystem->GetPid() << ".tmp";
+  string tmpfile = tmpname.str();
+
+  TDirectory * cwd = gDirectory;
+  TFile * file = TFile::Open(tmpfile.c_str(), "RECREATE");
+  if(!file || file->IsZombie()) {
+    LOG("GMCJCheckpoint", pERROR)
+      << "Could not write the checkpoint file: " << tmpfile;
+    delete file;
+    if(cwd) cwd->cd();
+    return false;
+  }
+
+  GMCJCheckpoint::SaveValue(file->mkdir("job"), "NEvents", nevents);
+  RandomGen::Instance()->SaveState(file->mkdir("rng"));
+  driver.SaveState(file->mkdir("driver"));
+  bool flux_ok = driver.FluxDriverPtr()->SaveState(file->mkdir("flux"));
+
+  file->Write();
+  file->Close();
+  delete file;
+  if(cwd) cwd->cd();
+
+  if(!flux_ok) {
+    LOG("GMCJCheckpoint", pERROR)
+      << "The flux driver does not support MC job checkpoints"
+      << " - No checkpoints will be written";
+    std::remove(tmpfile.c_str());
+    fFilename = "";
+    return false;
+  }
+  if(std::rename(tmpfile.c_str(), fFilename.c_str()) != 0) {
+    LOG("GMCJCheckpoint", pERROR)
+      << "Could not rename " << tmpfile << " to " << fFilename;
+    std::remove(tmpfile.c_str());
+    return false;
+  }
+  fLastSave = nevents;
+
+  // the events of the interrupted job are all in the output file by now
+  if(fMovedAside.size() > 0) {
+    std::remove(fMovedAside.c_str());
+    fMovedAside = "";
+  }
+
+  LOG("GMCJCheckpoint", pNOTICE)
+    << "Wrote the MC job checkpoint after " << nevents << " events";
+  return true;
+}
+//____________________________________________________________________________
+string GMCJCheckpoint::MoveAside(string output_file)
+{
+// If the interrupted job was itself resuming and was killed before writing
+// a checkpoint, its own output file is incomplete while the file it was
+// resuming from is still around: that one is used
+
+  string moved = output_file + ".interrupted";
+
+  if(gSystem->AccessPathName(moved.c_str())) {
+    if(std::rename(output_file.c_str(), moved.c_str()) != 0) {
+      LOG("GMCJCheckpoint", pERROR)
+        << "Could not move aside the output file of the interrupted job: "
+        << output_file;
+      return "";
+    }
+  }
+  fMovedAside = moved;
+
+  LOG("GMCJCheckpoint", pNOTICE)
+    << "Resuming from the events of: " << moved;
+  return moved;
+}
+//____________________________________________________________________________
+long int GMCJCheckpoint::ResumeEvents(void) const
+{
+  if(!this->IsEnabled()) return -1;
+
+  TDirectory * cwd = gDirectory;
+  TFile * file = TFile::Open(fFilename.c_str(), "READ");
+  long int nevents = -1;
+  if(file && !file->IsZombie()) {
+    TDirectory * job = file->GetDirectory("job");
+    if(!job || !GMCJCheckpoint::LoadValue(job, "NEvents", nevents)) {
+      nevents = -1;
+    }
+    file->Close();
+  }
+  delete file;
+  if(cwd) cwd->cd();
+
+  if(nevents < 0) {
+    LOG("GMCJCheckpoint", pERROR)
+      << "Could not read the checkpoint file: " << fFilename;
+  }
+  return nevents;
+}
+//____________________________________________________________________________
+bool GMCJCheckpoint::Restore(GMCJDriver & driver)
+{
+  if(!this->IsEnabled()) return false;
+
+  TDirectory * cwd = gDirectory;
+  TFile * file = TFile::Open(fFilename.c_str(), "READ");
+  if(!file || file->IsZombie()) {
+    LOG("GMCJCheckpoint", pERROR)
+      << "Could not read the checkpoint file: " << fFilename;
+    delete file;
+    if(cwd) cwd->cd();
+    return false;
+  }
+
+  TDirectory * rng_dir    = file->GetDirectory("rng");
+  TDirectory * driver_dir = file->GetDirectory("driver");
+  TDirectory * flux_dir   = file->GetDirectory("flux");
+  bool ok = 
+     rng_dir    && RandomGen::Instance()->RestoreState(rng_dir) &&
+     driver_dir && driver.RestoreState(driver_dir)              &&
+     flux_dir   && driver.FluxDriverPtr()->RestoreState(flux_dir);
+
+  long int nevents = -1;
+  TDirectory * job = file->GetDirectory("job");
+  if(job) GMCJCheckpoint::LoadValue(job, "NEvents", nevents);
+
+  file->Close();
+  delete file;
+  if(cwd) cwd->cd();
+
+  if(!ok) {
+    LOG("GMCJCheckpoint", pERROR)
+      << "Could not restore the MC job state from: " << fFilename;
+    return false;
+  }
+  fLastSave = nevents;
+
+  LOG("GMCJCheckpoint", pNOTICE)
+    << "Restored the MC job state after " << nevents << " events";
+  return true;
+}
+//____________________________________________________________________________
+void GMCJCheckpoint::SaveValue(
+               TDirectory * dir, const char * name, double value)
+{
+  TParameter<double> par(name, value);
+  dir->WriteTObject(&par, name);
+}
+//____________________________________________________________________________
+void GMCJCheckpoint::SaveValue(
+               TDirectory * dir, const char * name, Long64_t value)
+{
+  TParameter<Long64_t> par(name, value);
+  dir->WriteTObject(&par, name);
+}
+//____________________________________________________________________________
+void GMCJCheckpoint::SaveValue(
+               TDirectory * dir, const char * name, long int value)
+{
+  GMCJCheckpoint::SaveValue(dir, name, (Long64_t) value);
+}
+//____________________________________________________________________________
+bool GMCJCheckpoint::LoadValue(
+               TDirectory * dir, const char * name, double & value)
+{
+  TParameter<double> * par = 0;
+  dir->GetObject(name, par);
+  if(!par) {
+    LOG("GMCJCheckpoint", pERROR) 
+      << "Missing checkpoint value: " << dir->GetName() << "/" << name;
+    return false;
+  }
+  value = par->GetVal();
+  delete par;
+  return true;
+}
+//____________________________________________________________________________
+bool GMCJCheckpoint::LoadValue(
+               TDirectory * dir, const char * name, Long64_t & value)
+{
+  TParameter<Long64_t> * par = 0;
+  dir->GetObject(name, par);
+  if(!par) {
+    LOG("GMCJCheckpoint", pERROR) 
+      << "Missing checkpoint value: " << dir->GetName() << "/" << name;
+    return false;
+  }
+  value = par->GetVal();
+  delete par;
+  return true;
+}
+//____________________________________________________________________________
+bool GMCJCheckpoint::LoadValue(
+               TDirectory * dir, const char * name, long int & value)
+{
+  Long64_t value64 = 0;
+  if(!GMCJCheckpoint::LoadValue(dir, name, value64)) return false;
+  value = (long int) value64;
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,124 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GMCJCheckpoint
+
+\brief    Periodic checkpoints of a GMCJDriver-based MC job, so that a job
+          killed before completion (eg on preemptible grid resources) can be
+          resumed where its last checkpoint was taken, producing the same
+          events as an uninterrupted job.
+
+          A checkpoint is a ROOT file holding the number of events written
+          so far, the full state of the random number generators (see
+          RandomGen::SaveState()), the GMCJDriver counters and the state of
+          the flux driver (eg the current flux ntuple entry and cycle and the
+          exposure accumulated so far, see GFluxI::SaveState()). It is first
+          written under a temporary name and then renamed, so that a job
+          killed while writing it leaves the previous checkpoint intact.
+          The events written so far must have been flushed to the output
+          file beforehand (see NtpWriter::Checkpoint()), so that they can be
+          recovered from it even if the job is killed later on.
+
+          On resuming, the output file of the interrupted job is moved aside
+          before the output file is recreated, the events of its last
+          checkpoint are copied to the new output file (see
+          NtpWriter::CopyEvents()) and the job state is restored.
+
+          Typical use (see the --checkpoint, --checkpoint-interval and
+          --resume options in RunOpt):
+
+            GMCJCheckpoint ckpt(RunOpt::Instance()->CheckpointFile(),
+                                RunOpt::Instance()->CheckpointInterval());
+            string prev_file = "";
+            if(resume) prev_file = ckpt.MoveAside(ntpw.Filename());
+            ntpw.Initialize();
+            ... (add any user-defined branches)
+            if(resume) {
+              nevents = ckpt.ResumeEvents();
+              ntpw.CopyEvents(prev_file, nevents);
+              ckpt.Restore(*mcj_driver);
+            }
+            while(...) {
+              ... (generate and write an event)
+              nevents++;
+              if(ckpt.IsDue(nevents)) {
+                ntpw.Checkpoint();
+                ckpt.Save(nevents, *mcj_driver);
+              }
+            }
+
+          Checkpoints are only written if the flux driver supports them. The
+          components of a job with state of their own implement SaveState()
+          and RestoreState() methods writing / reading named numbers in a
+          directory of the checkpoint file (see SaveValue(), LoadValue()).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_CHECKPOINT_H_
+#define _G_MC_JOB_CHECKPOINT_H_
+
+#include <string>
+
+#include <Rtypes.h>
+
+class TDirectory;
+
+using std::string;
+
+namespace genie {
+
+class GMCJDriver;
+
+class GMCJCheckpoint {
+
+public :
+  GMCJCheckpoint(string filename, long int interval);
+ ~GMCJCheckpoint();
+
+  bool     IsEnabled    (void) const { return fFilename.size() > 0; }
+  string   Filename     (void) const { return fFilename; }
+
+  //! is a checkpoint due after nevents events?
+  bool     IsDue        (long int nevents) const;
+
+  //! write a checkpoint of the job after nevents events
+  bool     Save         (long int nevents, const GMCJDriver & driver);
+
+  //! resuming: move the output file of the interrupted job aside (before
+  //! the output file is recreated) and return its new name
+  string   MoveAside    (string output_file);
+
+  //! resuming: number of events written at the last checkpoint (-1 if no
+  //! checkpoint could be read)
+  long int ResumeEvents (void) const;
+
+  //! resuming: restore the job state of the last checkpoint
+  bool     Restore      (GMCJDriver & driver);
+
+  //! named numbers of a checkpoint directory
+  static void SaveValue (TDirectory * dir, const char * name, double   value);
+  static void SaveValue (TDirectory * dir, const char * name, Long64_t value);
+  static void SaveValue (TDirectory * dir, const char * name, long int value);
+  static bool LoadValue (TDirectory * dir, const char * name, double   & value);
+  static bool LoadValue (TDirectory * dir, const char * name, Long64_t & value);
+  static bool LoadValue (TDirectory * dir, const char * name, long int & value);
+
+private:
+  string   fFilename;   ///< checkpoint file ("" if disabled)
+  long int fInterval;   ///< # of events between checkpoints
+  long int fLastSave;   ///< # of events at the last checkpoint
+  string   fMovedAside; ///< output file of the interrupted job, removed once a new checkpoint is written
+};
+
+}      // genie namespace
+
+#endif // _G_MC_JOB_CHECKPOINT_H_
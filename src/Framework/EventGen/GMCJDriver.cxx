@@ -96,10 +96,34 @@
    Modified ComputeProbScales to evalulate the cross sections at both the high
    and low edges of the energy bin when calculating the max interaction 
    probability.
+ @ Oct 14, 2026 - CA
+   PreCalcFluxProbabilities() gets the flux neutrinos a batch at a time
+   (see GFluxI::GenerateBatch). Added ComputePathLengths() and 
+   ComputeInteractionProbabilities() variants for an explicit neutrino.
+   PopulateEventGenDriverPool() can build the interaction -> generator maps
+   of the GEVGDriver objects in concurrent threads (SetNDriverThreads()).
+   The drivers share InteractionListTemplates, so that the interaction lists
+   are created once per class of targets. BootstrapXSecSplineSummation() uses
+   the sum splines stored in the spline file, if available.
+ @ Oct 14, 2026 - CA
+   Instrumented the flux and geometry driver calls (see ScopeProfiler).
+ @ Oct 14, 2026 - CA
+   Added SaveState() and RestoreState() for checkpointed MC jobs.
+ @ Oct 14, 2026 - CA
+   Added GenerateEvents(), generating many events per call from flux
+   neutrinos fetched a batch at a time. The current flux neutrino is kept
+   by the driver, rather than read back from the flux driver.
+ @ Oct 14, 2026 - CA
+   Added UseNaturalElementTargets() (or the --natural-targets option): The
+   isotopes of natural elements are collapsed into a single target in the
+   loop over materials, and the isotope is chosen once a target is selected.
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdlib>
+#include <algorithm>
+#include <pthread.h>
 
 #include <TVector3.h>
 #include <TSystem.h>
@@ -112,7 +136,9 @@
 #include "Framework/Conventions/Controls.h"
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/GMCJCheckpoint.h"
 #include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/InteractionListTemplates.h"
 #include "Framework/EventGen/GEVGPool.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/GeomAnalyzerI.h"
@@ -123,13 +149,38 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGUtils.h"
+#include "Framework/ParticleData/NaturalIsotopes.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/PhaseTimer.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Conventions/Constants.h"
 
 using namespace genie;
 using namespace genie::constants;
 
+// Work shared by the threads configuring the GEVGDriver pool: each thread
+// takes the next driver whose interaction -> generator map is not built yet
+struct DriverPoolWork_t {
+  vector<GEVGDriver *> *     drivers;
+  InteractionListTemplates * templates;
+  unsigned int               next;
+  pthread_mutex_t            mutex;
+};
+static void * ConfigureDriverInteractions(void * arg)
+{
+  DriverPoolWork_t * work = (DriverPoolWork_t *) arg;
+  while(true) {
+    pthread_mutex_lock(&work->mutex);
+    unsigned int i = work->next++;
+    pthread_mutex_unlock(&work->mutex);
+    if(i >= work->drivers->size()) break;
+    (*work->drivers)[i]->ConfigureInteractions(work->templates);
+  }
+  return 0;
+}
+
 //____________________________________________________________________________
 GMCJDriver::GMCJDriver()
 {
@@ -140,6 +191,7 @@ GMCJDriver::~GMCJDriver()
 {
   if(fUnphysEventMask) delete fUnphysEventMask;
   if (fGPool) delete fGPool;
+  this->ClearNaturalElementTable();
 
   map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
   for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
@@ -228,6 +280,53 @@ void GMCJDriver::ForceSingleProbScale()
     << "Note: That does not force unweighted event kinematics!";
 }
 //___________________________________________________________________________
+void GMCJDriver::SetMaxWeightRatio(double max_weight_ratio)
+{
+// Generate weighted events using the energy-binned, per neutrino species
+// probability scales (as in the default weighted mode), but with each scale
+// not allowed to drop below fGlobPmax/max_weight_ratio. The event weights
+// (scale/fGlobPmax) are then bounded within [1/max_weight_ratio, 1].
+// This interpolates between unweighted generation (max_weight_ratio = 1:
+// a single global scale and a very low acceptance for flux neutrinos away
+// from the probability peak, eg at low energies for broadband beams) and
+// fully weighted generation (max_weight_ratio <= 0: largest acceptance but
+// possibly a wide spread of weights). In all cases the sample normalization
+// (see GlobProbScale()) is unchanged, and weighted distributions are the
+// same as the unweighted ones.
+//
+  fGenerateUnweighted = false;
+  fMaxWeightRatio     = max_weight_ratio;
+
+  LOG("GMCJDriver", pNOTICE)
+    << "GMCJDriver will generate weighted events with a max weight ratio of " 
+    << fMaxWeightRatio << ((fMaxWeightRatio > 0) ? "" : " (unbounded)");
+}
+//___________________________________________________________________________
+double GMCJDriver::ProbScale(int nupdg, double Ev) const
+{
+// Probability scale for the input flux neutrino species & energy
+//
+  if(fGenerateUnweighted) return fGlobPmax;
+
+  map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
+  assert(pmax_iter != fPmax.end());
+  TH1D * pmax_hst = pmax_iter->second;
+  assert(pmax_hst);
+  double pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(Ev));
+
+  if(fMaxWeightRatio > 0) {
+    pmax = TMath::Max(pmax, fGlobPmax/fMaxWeightRatio);
+  }
+  return pmax;
+}
+//___________________________________________________________________________
+void GMCJDriver::SetNDriverThreads(unsigned int nthreads)
+{
+// Set the number of threads configuring the event generation drivers (one
+// per initial state) at Configure(). Default: $GEVGDRIVERTHREADS, or 1.
+  fNDriverThreads = TMath::Max(1U, nthreads);
+}
+//___________________________________________________________________________
 void GMCJDriver::PreSelectEvents(bool preselect)
 {
 // Set whether to pre-select events based on a max-path lengths file. This
@@ -289,39 +388,51 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
     TStopwatch stopwatch; 
     stopwatch.Start();
     long int first_index = -1;
+    long int ientry = 0;
     bool first_loop = true;
+    bool done = false;
+    const int nbatch = 1024; // flux neutrinos fetched from the flux driver at a time
+    FluxBatch batch;
     // loop until at end of flux ntuple
-    while(fFluxDriver->End() == false){ 
+    while(!done && fFluxDriver->End() == false){ 
 
-      // get the next flux neutrino
-      bool gotnext = fFluxDriver->GenerateNext(); 
-      if(!gotnext){
-        LOG("GMCJDriver", pWARN) << "*** Couldn't generate next flux ray! ";
-        continue;
-      }
+      // get the next batch of flux neutrinos
+      int nb = fFluxDriver->GenerateBatch(nbatch, batch);
+
+      for(int ib = 0; ib < nb; ib++) {
+        long int index = batch.Index[ib];
 
-      // stop if completed a full cycle (this check is necessary as fluxdriver
-      // may be set to loop over more than one cycle before reaching end) 
-      bool already_been_here = first_loop ? false : first_index == fFluxDriver->Index();
-      if(already_been_here) break; 
+        // stop if completed a full cycle (this check is necessary as fluxdriver
+        // may be set to loop over more than one cycle before reaching end) 
+        bool already_been_here = first_loop ? false : first_index == index;
+        if(already_been_here) { done = true; break; }
+
+        // store the first index so know when have cycled exactly once
+        if(first_loop){
+          first_index = index;
+          first_loop = false;
+        }
+
+        // skip flux entries handled by the jobs processing the other slices
+        if((ientry++) % fNFluxIntSlices != fFluxIntSlice) continue;
+
+        const TLorentzVector & nup4 = batch.Momentum[ib];
    
-      // compute the path lengths for current flux neutrino 
-      if(this->ComputePathLengths() == false){ success = false; break;}
+        // compute the path lengths for current flux neutrino 
+        if(this->ComputePathLengths(nup4, batch.Position[ib]) == false){ 
+          success = false; done = true; break;
+        }
   
-      // compute and store the interaction probability 
-      double psum = this->ComputeInteractionProbabilities(false /*Based on actual PLs*/);
-      assert(psum+controls::kASmallNum > 0.);
-      fBrFluxIntProb = psum;
-      fBrFluxIndex   = fFluxDriver->Index();
-      fBrFluxEnu     = fFluxDriver->Momentum().E();
-      fBrFluxWeight  = fFluxDriver->Weight();
-      fBrFluxPDG     = fFluxDriver->PdgCode();
-      fFluxIntTree->Fill();
-
-      // store the first index so know when have cycled exactly once
-      if(first_loop){
-        first_index = fFluxDriver->Index();
-        first_loop = false;
+        // compute and store the interaction probability 
+        double psum = this->ComputeInteractionProbabilities(
+                 false /*Based on actual PLs*/, batch.PdgCode[ib], nup4);
+        assert(psum+controls::kASmallNum > 0.);
+        fBrFluxIntProb = psum;
+        fBrFluxIndex   = index;
+        fBrFluxEnu     = nup4.E();
+        fBrFluxWeight  = batch.Weight[ib];
+        fBrFluxPDG     = batch.PdgCode[ib];
+        fFluxIntTree->Fill();
       }
     } // flux loop
     stopwatch.Stop();            
@@ -333,6 +444,13 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
     // reset the flux driver so can be used at next stage. N.B. This 
     // should also reset flux driver to throw de-weighted flux neutrinos
     fFluxDriver->Clear("CycleHistory");
+
+    if(fNFluxIntSlices > 1) {
+      LOG("GMCJDriver", pNOTICE)
+         << "Pre-calculated flux interaction probabilities for slice " 
+         << fFluxIntSlice << " of " << fNFluxIntSlices << " only. Merge the "
+         << "output files of all slices (eg using hadd) before using them.";
+    }
   }
 
   // If successfully calculated/loaded interaction probabilities then set global
@@ -340,11 +458,33 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   if(success){
     fGlobPmax = 0.0;
     double safety_factor = 1.01;
+    fFluxIntProbs.clear();
+    fFluxIntEnu.clear();
+    fFluxIntProbs.reserve(fFluxIntTree->GetEntries());
+    fFluxIntEnu.reserve(fFluxIntTree->GetEntries());
     for(int i = 0; i< fFluxIntTree->GetEntries(); i++){
       fFluxIntTree->GetEntry(i);
       // Check have non-negative probabilities
       assert(fBrFluxIntProb+controls::kASmallNum > 0.0);
       assert(fBrFluxWeight+controls::kASmallNum > 0.0);
+      // Store in the look-up tables, indexed by flux entry
+      if(fBrFluxIndex < 0) {
+        LOG("GMCJDriver", pFATAL) << 
+          "Negative FluxIndex in flux prob tree: " << fBrFluxIndex; 
+        exit(1);
+      }
+      unsigned int idx = (unsigned int) fBrFluxIndex;
+      if(idx >= fFluxIntProbs.size()) {
+        fFluxIntProbs.resize(idx+1, -1.);
+        fFluxIntEnu.resize(idx+1, -1.);
+      }
+      if(fFluxIntProbs[idx] >= 0.) {
+        LOG("GMCJDriver", pFATAL) << 
+          "Duplicate FluxIndex in flux prob tree: " << fBrFluxIndex; 
+        exit(1);
+      }
+      fFluxIntProbs[idx] = TMath::Max(0., fBrFluxIntProb);
+      fFluxIntEnu  [idx] = fBrFluxEnu;
       // Update the global maximum
       fGlobPmax = TMath::Max(fGlobPmax, fBrFluxIntProb*safety_factor); 
       // Update the sum of fBrFluxIntProb*fBrFluxWeight for different species
@@ -364,12 +504,11 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
       fFluxIntTree->Write();
     }
 
-    // Also build index for use later
-    if(fFluxIntTree->BuildIndex("FluxIndex") != fFluxIntTree->GetEntries()){
-      LOG("GMCJDriver", pFATAL) << 
-          "Cannot build index using branch \"FluxIndex\" for flux prob tree!"; 
-      exit(1);
-    } 
+    // The look-up tables filled above are used from now on, rather than
+    // the tree itself, so that no ROOT I/O is needed for each flux neutrino
+    LOG("GMCJDriver", pNOTICE) << 
+        "Holding interaction probabilities for " << fFluxIntProbs.size() <<
+        " flux entries in memory"; 
  
     // Now that have pre-generated flux probabilities need to trun off event 
     // preselection as this is only advantages when using max path lengths
@@ -381,6 +520,8 @@ bool GMCJDriver::PreCalcFluxProbabilities(void)
   else if(fFluxIntTree){ 
     delete fFluxIntTree; 
     fFluxIntTree = 0;
+    fFluxIntProbs.clear();
+    fFluxIntEnu.clear();
   }
   
   // Return whether have successfully pre-calculated flux interaction probabilities
@@ -443,11 +584,76 @@ void GMCJDriver::SaveFluxProbabilities(string outfilename)
   fFluxIntFileName = outfilename;
 }
 //___________________________________________________________________________
+void GMCJDriver::UseFluxImportanceSampling(bool on)
+{
+// Rather than reading flux neutrinos sequentially and rejecting most of them
+// (as the interacting ones are selected with probability Psum/fGlobPmax),
+// sample flux entries directly with probability proportional to 
+// FluxIntProb * FluxWeight, using an alias table built from the 
+// pre-calculated flux interaction probabilities. Every sampled flux neutrino
+// interacts. It requires that pre-calculated flux interaction probabilities 
+// are used (see PreCalcFluxProbabilities / LoadFluxProbabilities) and a flux
+// driver supporting random access to its entries (GFluxI::GenerateEntry).
+// As in the default mode, N generated events correspond to an exposure of 
+// N * GlobProbScale() / sum(SumFluxIntProbs()) flux cycles. However, the 
+// flux driver's neutrino & cycle counters no longer track that exposure.
+//
+  fUseFluxAlias = on;
+  fFluxAliasProb.clear();
+  fFluxAliasIdx.clear();
+}
+//___________________________________________________________________________
+void GMCJDriver::UseNaturalElementTargets(bool on)
+{
+// Collapse the isotopes of each natural element of the geometry into a
+// single target when computing the interaction probabilities of the flux
+// neutrinos: The element is given the abundance-weighted total cross section
+// of its isotopes (per unit mass number) and the sum of their path lengths,
+// and one spline is evaluated per element rather than one per isotope. Once
+// the element is selected as the interaction target, the isotope is chosen
+// from the path lengths and cross sections of the isotopes, so the events
+// are still generated on a specific nucleus.
+// This is exact when the isotopes of an element are in their natural
+// proportions in the detector materials. Elements whose isotopes are not
+// (as seen in the maximum path lengths), or are not natural isotopes, keep
+// separate targets. Can also be enabled with the --natural-targets option.
+//
+  fUseNatElements = on;
+}
+//___________________________________________________________________________
+void GMCJDriver::SetFluxProbabilitiesSlice(
+                                  unsigned int islice, unsigned int nslices)
+{
+// Split the pre-calculation of flux interaction probabilities in nslices 
+// jobs (eg grid jobs), each running over the full flux file but computing 
+// path lengths and probabilities only for every nslices-th flux entry, 
+// starting at entry islice. The flux entries are interleaved, rather than 
+// split in contiguous ranges, so that the flux driver need not know the 
+// number of entries in advance and the load is balanced even for ordered 
+// flux files. As the probabilities tree is indexed by flux entry, the 
+// outputs of all slices can be merged in any order (eg using hadd) into a 
+// single file to be used via LoadFluxProbabilities.
+//
+  if(nslices == 0 || islice >= nslices) {
+    LOG("GMCJDriver", pFATAL)
+      << "Invalid flux interaction probabilities slice: " 
+      << islice << " of " << nslices;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  fFluxIntSlice   = islice;
+  fNFluxIntSlices = nslices;
+}
+//___________________________________________________________________________
 void GMCJDriver::Configure(bool calc_prob_scales)
 {
+  PhaseTimerGuard timer("GMCJDriver::Configure");
+
   LOG("GMCJDriver", pNOTICE)
      << utils::print::PrintFramedMesg("Configuring GMCJDriver");
 
+  if(RunOpt::Instance()->NaturalTargets()) fUseNatElements = true;
+
   // Get the list of neutrino types from the input flux driver and the list
   // of target materials from the input geometry driver
   this->GetParticleLists();
@@ -488,9 +694,110 @@ void GMCJDriver::Configure(bool calc_prob_scales)
     // probabilities to be computed by this driver
     this->ComputeProbScales();
   }
+
+  // Lay out the per-material quantities needed for each flux neutrino
+  this->BuildMaterialTable();
+
   LOG("GMCJDriver", pNOTICE) << "Finished configuring GMCJDriver\n\n";
 }
 //___________________________________________________________________________
+void GMCJDriver::SetWorkerSlot(unsigned int iworker, unsigned int nworkers)
+{
+// Declare this driver as worker `iworker' out of `nworkers' cooperating on
+// the same MC job. Worker k returns the events with job-wide indices 
+// k, k+n, k+2n, ... so that the outputs of all workers can be interleaved
+// deterministically, irrespective of how fast each worker runs.
+// The RandomGen streams are reseeded from the job-wide index of each event,
+// so the generated sample does not depend on the number of workers.
+//
+  if(nworkers == 0 || iworker >= nworkers) {
+    LOG("GMCJDriver", pFATAL)
+      << "Invalid worker slot: " << iworker << " / " << nworkers;
+    gAbortingInErr = true;
+    exit(1);
+  }
+  fWorkerId  = iworker;
+  fNWorkers  = nworkers;
+
+  this->ReseedRandomStreamsPerEvent(true);
+
+  LOG("GMCJDriver", pNOTICE)
+     << "This driver is worker " << fWorkerId << " of " << fNWorkers;
+}
+//___________________________________________________________________________
+void GMCJDriver::ReseedRandomStreamsPerEvent(bool reseed)
+{
+// If set, the RandomGen streams are reseeded (see RandomGen::SetEventIndex)
+// before generating each event, using the job-wide index of that event.
+// Every event then depends only on the master seed and its index and can be
+// regenerated on its own. Note that this assumes a flux driver which is not
+// reading flux neutrinos sequentially from an input file.
+//
+  fReseedPerEvent = reseed;
+}
+//___________________________________________________________________________
+void GMCJDriver::Configure(const GMCJDriver & primary)
+{
+// Configure a worker driver using the init-time products of an already
+// configured primary driver. The (expensive) max path-length estimation and
+// the computation of the probability scales are not repeated. Splines are
+// taken from the XSecSplineList, already populated by the primary driver.
+// The worker gets its own GEVGPool, whereas the flux driver and geometry 
+// analyzer must have been set (one instance per worker) before calling this.
+//
+  PhaseTimerGuard timer("GMCJDriver::Configure");
+
+  LOG("GMCJDriver", pNOTICE)
+     << utils::print::PrintFramedMesg("Configuring GMCJDriver worker");
+
+  if(!fFluxDriver || !fGeomAnalyzer) {
+    LOG("GMCJDriver", pFATAL)
+      << "The flux driver and geometry analyzer of a worker driver must be "
+      << "set before configuring it";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // job configuration
+  fEventGenList       = primary.fEventGenList;
+  *fUnphysEventMask   = *primary.fUnphysEventMask;
+  fUseSplines         = primary.fUseSplines;
+  fUseLogE            = primary.fUseLogE;
+  fKeepThrowingFluxNu = primary.fKeepThrowingFluxNu;
+  fGenerateUnweighted = primary.fGenerateUnweighted;
+  fMaxWeightRatio     = primary.fMaxWeightRatio;
+  fPreSelect          = primary.fPreSelect;
+  fUseNatElements     = primary.fUseNatElements;
+  fFluxBatchSize      = primary.fFluxBatchSize;
+
+  // init-time products
+  fNuList             = primary.fNuList;
+  fTgtList            = primary.fTgtList;
+  fEmax               = primary.fEmax;
+  fMaxPathLengths     = primary.fMaxPathLengths;
+  fGlobPmax           = primary.fGlobPmax;
+
+  map<int,TH1D*>::iterator pmax_iter = fPmax.begin();
+  for( ; pmax_iter != fPmax.end(); ++pmax_iter) {
+    if(pmax_iter->second) delete pmax_iter->second;
+  }
+  fPmax.clear();
+  map<int,TH1D*>::const_iterator pmax_citer = primary.fPmax.begin();
+  for( ; pmax_citer != primary.fPmax.end(); ++pmax_citer) {
+    TH1D * pmax_hst = new TH1D(*(pmax_citer->second));
+    pmax_hst->SetDirectory(0);
+    fPmax.insert(map<int,TH1D*>::value_type(pmax_citer->first, pmax_hst));
+  }
+
+  // this worker's own event generation drivers
+  this->PopulateEventGenDriverPool();
+  this->BootstrapXSecSplines();
+  this->BootstrapXSecSplineSummation();
+  this->BuildMaterialTable();
+
+  LOG("GMCJDriver", pNOTICE) << "Finished configuring GMCJDriver worker\n\n";
+}
+//___________________________________________________________________________
 void GMCJDriver::InitJob(void)
 {
   fEventGenList       = "Default";  // <-- set of event generators to be loaded by this driver
@@ -514,11 +821,17 @@ void GMCJDriver::InitJob(void)
   fPmax.clear();               // <-- maximum interaction probability per neutrino & per energy bin
 
   fGenerateUnweighted = false; // <-- default opt to generate weighted events
+  fMaxWeightRatio     = -1;    // <-- with unbounded event weights
   fPreSelect          = true;  // <-- default to use pre-selection based on maximum path lengths 
 
   fSelTgtPdg          = 0;
   fCurEvt             = 0;
   fCurVtx.SetXYZT(0.,0.,0.,0.);
+  fCurNuPdg           = 0;
+  fCurNuWeight        = 0;
+  fCurNuIndex         = -1;
+  fFluxBatchPos       = 0;
+  fFluxBatchSize      = 256;   // <-- flux neutrinos fetched at a time by GenerateEvents()
 
   fFluxIntProbFile    = 0; 
   fFluxIntTreeName    = "gFlxIntProb";
@@ -531,6 +844,21 @@ void GMCJDriver::InitJob(void)
   fBrFluxPDG          = 0;
   fSumFluxIntProbs.clear();
 
+  fUseFluxAlias       = false; // <-- default to read flux neutrinos in sequence
+  fFluxIntSlice       = 0;     // <-- a single job pre-calculates all flux interaction probabilities
+  fNFluxIntSlices     = 1;
+
+  fWorkerId           = 0;     // <-- a single driver is worker 0 of 1
+  fNWorkers           = 1;
+  fNEvtGenerated      = 0;     // <-- number of events returned so far
+  fCurEvtIdx          = -1;    // <-- job-wide index of the last event
+  fReseedPerEvent     = false; // <-- default: a single sequence of random numbers
+  fUseNatElements     = false; // <-- default: a separate target per isotope
+
+  fNDriverThreads     = 1;     // <-- GEVGDriver pool configured serially, unless
+  const char * nthr   = std::getenv("GEVGDRIVERTHREADS"); // set here or by SetNDriverThreads()
+  if(nthr) fNDriverThreads = (unsigned int) TMath::Max(1, atoi(nthr));
+
   // Throw as many flux neutrinos as necessary till one has interacted
   // so that GenerateEvent() never  returns NULL (except when in error)
   this->KeepOnThrowingFluxNeutrinos(true);
@@ -554,11 +882,25 @@ void GMCJDriver::InitJob(void)
 
   // Clear the maximum path length list
   fMaxPathLengths.clear();
-  fCurPathLengths.clear();
+
+  // Clear the material table
+  fMatPdg.clear();
+  fMatA.clear();
+  fMatMaxPl.clear();
+  fMatCurPl.clear();
+  fMatCumulProb.clear();
+  fMatEvgDrivers.clear();
+  fMatXSecSplines.clear();
+  fMatElem.clear();
+  fElemFirstMat.clear();
+  fElemNMat.clear();
+  fElemXSecSplines.clear();
 }
 //___________________________________________________________________________
 void GMCJDriver::GetParticleLists(void)
 {
+  PhaseTimerGuard timer("GMCJDriver::GetParticleLists");
+
   // Get the list of flux neutrinos from the flux driver
   LOG("GMCJDriver", pNOTICE)
                     << "Asking the flux driver for its list of neutrinos";
@@ -576,6 +918,8 @@ void GMCJDriver::GetParticleLists(void)
 //___________________________________________________________________________
 void GMCJDriver::GetMaxPathLengthList(void)
 {
+  PhaseTimerGuard timer("GMCJDriver::GetMaxPathLengthList");
+
   if(fUseExtMaxPl) {
      LOG("GMCJDriver", pNOTICE)
        << "Loading external max path-length list for input geometry from "
@@ -585,6 +929,7 @@ void GMCJDriver::GetMaxPathLengthList(void)
   } else {
      LOG("GMCJDriver", pNOTICE)
        << "Querying the geometry driver to compute the max path-length list";
+     GINSTR_SCOPE("GeomAnalyzerI::ComputeMaxPathLengths");
      fMaxPathLengths = fGeomAnalyzer->ComputeMaxPathLengths();
   }
   // Print maximum path lengths & neutrino energy
@@ -592,8 +937,233 @@ void GMCJDriver::GetMaxPathLengthList(void)
      << "Maximum path length list: " << fMaxPathLengths;
 }
 //___________________________________________________________________________
+void GMCJDriver::BuildMaterialTable(void)
+{
+// Build a fixed-index table of the target materials, sorted by PDG code,
+// holding everything needed per material when processing a flux neutrino:
+// mass number, max path length, current path length, cumulative interaction
+// probability and (per flux neutrino species) the GEVGDriver handling the
+// corresponding initial state and its total cross section spline.
+// The table is sized once here, so that no allocation, string construction
+// or map lookup takes place in ComputePathLengths(),
+// ComputeInteractionProbabilities() and SelectTargetMaterial().
+
+  PhaseTimerGuard timer("GMCJDriver::BuildMaterialTable");
+
+  fMatPdg.assign(fTgtList.begin(), fTgtList.end());
+  sort(fMatPdg.begin(), fMatPdg.end());
+  fMatPdg.erase(unique(fMatPdg.begin(), fMatPdg.end()), fMatPdg.end());
+
+  unsigned int nmat = fMatPdg.size();
+  unsigned int nnu  = fNuList.size();
+
+  fMatA        .assign(nmat, 0);
+  fMatMaxPl    .assign(nmat, 0.);
+  fMatCurPl    .assign(nmat, 0.);
+  fMatCumulProb.assign(nmat, 0.);
+  fMatEvgDrivers.assign(nnu*nmat, (GEVGDriver*)0);
+  fMatXSecSplines.assign(nnu*nmat, (const Spline*)0);
+
+  for(unsigned int imat = 0; imat < nmat; imat++) {
+     int mpdg = fMatPdg[imat];
+     fMatA[imat] = pdg::IonPdgCodeToA(mpdg);
+     PathLengthList::const_iterator pliter = fMaxPathLengths.find(mpdg);
+     if(pliter != fMaxPathLengths.end()) fMatMaxPl[imat] = pliter->second;
+
+     for(unsigned int inu = 0; inu < nnu; inu++) {
+       InitialState init_state(mpdg, fNuList[inu]);
+       GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
+       if(!evgdriver) {
+         LOG("GMCJDriver", pFATAL)
+          << "\n * The MC Job driver isn't properly configured!"
+          << "\n * No event generation driver could be found for init state: " 
+          << init_state.AsString();
+         gAbortingInErr = true;
+         exit(1);
+       }
+       fMatEvgDrivers [inu*nmat + imat] = evgdriver;
+       fMatXSecSplines[inu*nmat + imat] = evgdriver->XSecSumSpline();
+     }
+  }
+
+  this->BuildNaturalElementTable();
+}
+//___________________________________________________________________________
+int GMCJDriver::MaterialIndex(int mpdg) const
+{
+// Position of the input material in the material table (-1 if not found)
+
+  vector<int>::const_iterator it =
+      lower_bound(fMatPdg.begin(), fMatPdg.end(), mpdg);
+  if(it == fMatPdg.end() || *it != mpdg) return -1;
+  return it - fMatPdg.begin();
+}
+//___________________________________________________________________________
+int GMCJDriver::NuIndex(int nupdg) const
+{
+// Position of the input flux neutrino in the list of flux neutrinos (the
+// outer index of the per-neutrino parts of the material table)
+
+  unsigned int nnu = fNuList.size();
+  for(unsigned int inu = 0; inu < nnu; inu++) {
+     if(fNuList[inu] == nupdg) return inu;
+  }
+  LOG("GMCJDriver", pFATAL)
+    << "\n * The MC Job driver isn't properly configured!"
+    << "\n * No event generation drivers for flux neutrino: " << nupdg;
+  gAbortingInErr = true;
+  exit(1);
+}
+//___________________________________________________________________________
+bool GMCJDriver::CurPathLengthsAreAllZero(void) const
+{
+  unsigned int nmat = fMatCurPl.size();
+  for(unsigned int imat = 0; imat < nmat; imat++) {
+     if(fMatCurPl[imat] > 0) return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+void GMCJDriver::BuildNaturalElementTable(void)
+{
+// Group the isotopes of the material table into natural elements (see
+// UseNaturalElementTargets()). The isotopes of an element are contiguous in
+// the table, sorted by PDG code (10LZZZAAAI). For each element and flux
+// neutrino, the total cross section per unit mass number
+//   sum{f_i * xsec_i(E)} / sum{f_i * A_i}
+// (f_i: natural abundance of isotope i, renormalized to the isotopes in the
+// geometry) is tabulated at the knots of all the isotope splines.
+
+  this->ClearNaturalElementTable();
+
+  unsigned int nmat = fMatPdg.size();
+  unsigned int nnu  = fNuList.size();
+  fMatElem.assign(nmat, -1);
+
+  if(!fUseNatElements) return;
+
+  // max deviation of the isotope fractions in the geometry from the natural ones
+  const double kMaxDFrac = 0.01;
+
+  NaturalIsotopes * natiso = NaturalIsotopes::Instance();
+
+  unsigned int imat = 0;
+  while(imat < nmat) {
+     if(!pdg::IsIon(fMatPdg[imat])) { imat++; continue; }
+     int Z = pdg::IonPdgCodeToZ(fMatPdg[imat]);
+     unsigned int jmat = imat + 1;
+     while(jmat < nmat && pdg::IsIon(fMatPdg[jmat]) &&
+           pdg::IonPdgCodeToZ(fMatPdg[jmat]) == Z) jmat++;
+     unsigned int first = imat;
+     unsigned int n     = jmat - imat;
+     imat = jmat;
+     if(n < 2) continue;
+
+     // natural and (as seen in the max path lengths) geometry fractions
+     vector<double> fnat(n, 0.), fgeo(n, 0.);
+     double sumnat = 0., sumgeo = 0.;
+     for(unsigned int k = 0; k < n; k++) {
+        fnat[k] = natiso->Abundance(fMatPdg[first+k]);
+        fgeo[k] = fMatMaxPl[first+k] / fMatA[first+k];
+        sumnat += fnat[k];
+        sumgeo += fgeo[k];
+     }
+     bool natural = (sumnat > 0. && sumgeo > 0.);
+     for(unsigned int k = 0; natural && k < n; k++) {
+        fnat[k] /= sumnat;
+        fgeo[k] /= sumgeo;
+        natural = (fnat[k] > 0. && TMath::Abs(fnat[k] - fgeo[k]) < kMaxDFrac);
+     }
+     if(!natural) {
+        LOG("GMCJDriver", pWARN)
+          << "The " << n << " isotopes of element Z = " << Z
+          << " are not in their natural proportions: Keeping separate targets";
+        continue;
+     }
+
+     int ielem = fElemFirstMat.size();
+     fElemFirstMat.push_back(first);
+     fElemNMat.push_back(n);
+     double Aeff = 0.;
+     for(unsigned int k = 0; k < n; k++) {
+        fMatElem[first+k] = ielem;
+        Aeff += fnat[k] * fMatA[first+k];
+     }
+     LOG("GMCJDriver", pNOTICE)
+       << "Collapsing the " << n << " isotopes of element Z = " << Z
+       << " into a single target (<A> = " << Aeff << ")";
+
+     for(unsigned int inu = 0; inu < nnu; inu++) {
+        const Spline * const * spls = &fMatXSecSplines[inu*nmat + first];
+        vector<double> E;
+        for(unsigned int k = 0; k < n; k++) {
+           if(!spls[k]) continue;
+           for(int i = 0; i < spls[k]->NKnots(); i++) {
+              E.push_back(spls[k]->GetKnotX(i));
+           }
+        }
+        sort(E.begin(), E.end());
+        E.erase(unique(E.begin(), E.end()), E.end());
+
+        Spline * spl = 0;
+        if(E.size() >= 2) {
+          vector<double> xsec(E.size(), 0.);
+          for(unsigned int ie = 0; ie < E.size(); ie++) {
+             for(unsigned int k = 0; k < n; k++) {
+                if(spls[k]) xsec[ie] += fnat[k] * spls[k]->Evaluate(E[ie]);
+             }
+             xsec[ie] /= Aeff;
+          }
+          spl = new Spline(E.size(), &E[0], &xsec[0]);
+        }
+        fElemXSecSplines.push_back(spl);
+     }
+  }
+}
+//___________________________________________________________________________
+void GMCJDriver::ClearNaturalElementTable(void)
+{
+  for(unsigned int i = 0; i < fElemXSecSplines.size(); i++) {
+     if(fElemXSecSplines[i]) delete fElemXSecSplines[i];
+  }
+  fElemXSecSplines.clear();
+  fElemFirstMat.clear();
+  fElemNMat.clear();
+  fMatElem.clear();
+}
+//___________________________________________________________________________
+int GMCJDriver::SelectElementIsotope(int imat, double u) const
+{
+// Choose the isotope of the natural element collapsed into material imat
+// (the first of its isotopes) for the current flux neutrino, with probability
+// proportional to pl_i * xsec_i(E) / A_i, using u in [0,1)
+
+  int ielem = fMatElem[imat];
+  unsigned int first = fElemFirstMat[ielem];
+  unsigned int n     = fElemNMat[ielem];
+  unsigned int nmat  = fMatPdg.size();
+  const Spline * const * spls = &fMatXSecSplines[this->NuIndex(fCurNuPdg)*nmat];
+  double E = fCurNuP4.E();
+
+  vector<double> cum(n, 0.);
+  double sum = 0.;
+  for(unsigned int k = 0; k < n; k++) {
+     unsigned int m = first + k;
+     if(fMatCurPl[m] > 0. && spls[m]) {
+        sum += fMatCurPl[m] * TMath::Max(0., spls[m]->Evaluate(E)) / fMatA[m];
+     }
+     cum[k] = sum;
+  }
+  for(unsigned int k = 0; k < n; k++) {
+     if(u * sum < cum[k]) return first + k;
+  }
+  return first;
+}
+//___________________________________________________________________________
 void GMCJDriver::GetMaxFluxEnergy(void)
 {
+  PhaseTimerGuard timer("GMCJDriver::GetMaxFluxEnergy");
+
   LOG("GMCJDriver", pNOTICE)
      << "Querying the flux driver for the maximum energy of flux neutrinos";
   fEmax = fFluxDriver->MaxEnergy();
@@ -604,6 +1174,14 @@ void GMCJDriver::GetMaxFluxEnergy(void)
 //___________________________________________________________________________
 void GMCJDriver::PopulateEventGenDriverPool(void)
 {
+// The generators and algorithms are loaded once and shared by all drivers
+// through the AlgFactory. The interaction -> generator map of each driver,
+// the most expensive part of its configuration, is built in fNDriverThreads
+// concurrent threads. The first driver is configured before starting the
+// threads, so that all shared algorithms and singletons are initialized.
+
+  PhaseTimerGuard timer("GMCJDriver::PopulateEventGenDriverPool");
+
   LOG("GMCJDriver", pDEBUG)
        << "Creating GEVGPool & adding a GEVGDriver object per init-state";
 
@@ -613,6 +1191,13 @@ void GMCJDriver::PopulateEventGenDriverPool(void)
   PDGCodeList::const_iterator nuiter;
   PDGCodeList::const_iterator tgtiter;
 
+  vector<GEVGDriver *> drivers;
+  vector<string>       keys;
+
+  // interaction lists created once per class of targets, and copied
+  // for the other targets of the same class
+  InteractionListTemplates templates;
+
   for(nuiter = fNuList.begin(); nuiter != fNuList.end(); ++nuiter) {
    for(tgtiter = fTgtList.begin(); tgtiter != fTgtList.end(); ++tgtiter) {
 
@@ -627,14 +1212,53 @@ void GMCJDriver::PopulateEventGenDriverPool(void)
 
      GEVGDriver * evgdriver = new GEVGDriver;
      evgdriver->SetEventGeneratorList(fEventGenList); // specify list of generators
-     evgdriver->Configure(init_state);
+     evgdriver->ConfigureGenerators(init_state);
+     if(drivers.size() == 0) evgdriver->ConfigureInteractions(&templates);
+     drivers.push_back(evgdriver);
+     keys.push_back(init_state.AsString());
+   } // targets
+  } // neutrinos
+
+  if(drivers.size() > 1) {
+    vector<GEVGDriver *> remaining(drivers.begin()+1, drivers.end());
+    unsigned int nthreads = TMath::Min(fNDriverThreads, (unsigned int) remaining.size());
+
+    DriverPoolWork_t work;
+    work.drivers   = &remaining;
+    work.templates = &templates;
+    work.next      = 0;
+    pthread_mutex_init(&work.mutex, 0);
+
+    LOG("GMCJDriver", pNOTICE)
+      << "Building the interaction lists of " << remaining.size()
+      << " GEVGDriver objects in " << nthreads << " threads";
+
+    vector<pthread_t> threads;
+    for(unsigned int it = 1; it < nthreads; it++) {
+      pthread_t thread;
+      if(pthread_create(&thread, 0, ConfigureDriverInteractions, &work) != 0) {
+        LOG("GMCJDriver", pWARN) << "Couldn't start driver configuration thread";
+        break;
+      }
+      threads.push_back(thread);
+    }
+    ConfigureDriverInteractions(&work);
+    for(unsigned int it = 0; it < threads.size(); it++) {
+      pthread_join(threads[it], 0);
+    }
+    pthread_mutex_destroy(&work.mutex);
+  }
+
+  for(unsigned int id = 0; id < drivers.size(); id++) {
+     GEVGDriver * evgdriver = drivers[id];
      evgdriver->UseSplines(); // check if all splines needed are loaded
 
      LOG("GMCJDriver", pDEBUG) << "Adding new GEVGDriver object to GEVGPool";
-     fGPool->insert( GEVGPool::value_type(init_state.AsString(), evgdriver) );
-   } // targets
-  } // neutrinos
+     fGPool->insert( GEVGPool::value_type(keys[id], evgdriver) );
+  }
 
+  LOG("GMCJDriver", pNOTICE)
+    << "Created " << templates.NTemplates() << " interaction list templates";
   LOG("GMCJDriver", pNOTICE)
              << "All necessary GEVGDriver object were pushed into GEVGPool\n";
 }
@@ -644,6 +1268,8 @@ void GMCJDriver::BootstrapXSecSplines(void)
 // Bootstrap cross section spline generation by the event generation drivers
 // that handle each initial state.
 
+  PhaseTimerGuard timer("GMCJDriver::BootstrapXSecSplines");
+
   if(!fUseSplines) return;
 
   LOG("GMCJDriver", pNOTICE) 
@@ -671,6 +1297,8 @@ void GMCJDriver::BootstrapXSecSplineSummation(void)
 // Sum-up the cross section splines for all the interaction that can be
 // simulated for each initial state
 
+  PhaseTimerGuard timer("GMCJDriver::BootstrapXSecSplineSummation");
+
   LOG("GMCJDriver", pNOTICE)
     << "Summing-up splines to get total cross section for each init state";
 
@@ -696,6 +1324,8 @@ void GMCJDriver::BootstrapXSecSplineSummation(void)
     double dE  = fEmax/10.;
     double min = rE.min;
     double max = (fEmax+dE < rE.max) ? fEmax+dE : rE.max;
+    // use the sum spline stored with the splines, if any (see gmkspl)
+    if(evgdriver->LoadXSecSumSpline(min,max)) continue;
     evgdriver->CreateXSecSumSpline(100,min,max,true);
   }
   LOG("GMCJDriver", pNOTICE)
@@ -715,6 +1345,8 @@ void GMCJDriver::ComputeProbScales(void)
 // proportions between differect flux neutrino species or flux neutrinos of 
 // different energies.
 
+  PhaseTimerGuard timer("GMCJDriver::ComputeProbScales");
+
   LOG("GMCJDriver", pNOTICE)
     << "Computing the max. interaction probability (probability scale)";
 
@@ -829,7 +1461,7 @@ void GMCJDriver::ComputeProbScales(void)
 //___________________________________________________________________________
 void GMCJDriver::InitEventGeneration(void)
 {
-  fCurPathLengths.clear();
+  fill(fMatCurPl.begin(), fMatCurPl.end(), 0.);
   fCurEvt    = 0;
   fSelTgtPdg = 0;
   fCurVtx.SetXYZT(0.,0.,0.,0.);
@@ -841,8 +1473,12 @@ EventRecord * GMCJDriver::GenerateEvent(void)
 
   this->InitEventGeneration();
 
+  if(fReseedPerEvent) {
+    RandomGen::Instance()->SetEventIndex(fWorkerId + fNWorkers * fNEvtGenerated);
+  }
+
   while(1) {
-    bool flux_end = fFluxDriver->End();
+    bool flux_end = (fFluxBatchPos >= fFluxBatch.N()) && fFluxDriver->End();
     if(flux_end) {
        LOG("GMCJDriver", pNOTICE) 
            << "No more neutrinos can be thrown by the flux driver";
@@ -850,7 +1486,11 @@ EventRecord * GMCJDriver::GenerateEvent(void)
     }
 
     EventRecord * event = this->GenerateEvent1Try();
-    if(event) return event;
+    if(event) {
+       fCurEvtIdx = fWorkerId + fNWorkers * fNEvtGenerated;
+       fNEvtGenerated++;
+       return event;
+    }
 
     if(fKeepThrowingFluxNu) {
          LOG("GMCJDriver", pNOTICE)
@@ -864,6 +1504,95 @@ EventRecord * GMCJDriver::GenerateEvent(void)
   return 0;
 }
 //___________________________________________________________________________
+int GMCJDriver::GenerateEvents(int n, vector<EventRecord *> & events)
+{
+// Generates up to n events, as many GenerateEvent() calls would (flux
+// neutrinos that do not interact are always thrown again), but fetching the
+// flux neutrinos from the flux driver a batch at a time (GFluxI::GenerateBatch)
+// so that the per-neutrino cost of the flux driver calls is amortized. As the
+// flux neutrinos use a random number stream of their own, the events are the
+// same as those generated one at a time, unless the flux driver fails to
+// generate some of them (they are skipped in a batch, but not by
+// GenerateEvent()). The fetched neutrinos not thrown yet are kept for the
+// next call. Flux neutrinos are not batched when sampled from, or checked
+// against, their pre-calculated interaction probabilities, which need the
+// flux driver to be positioned at each of them.
+//
+  fEvtFluxNu.Clear();
+
+  bool batched = (fFluxBatchSize > 1 && !fUseFluxAlias && !fFluxIntTree);
+
+  int nev = 0;
+  bool flux_end = false;
+  while(nev < n && !flux_end) {
+
+    this->InitEventGeneration();
+
+    if(fReseedPerEvent) {
+      RandomGen::Instance()->SetEventIndex(fWorkerId + fNWorkers * fNEvtGenerated);
+    }
+
+    EventRecord * event = 0;
+    while(!event) {
+      if(fFluxBatchPos >= fFluxBatch.N()) {
+        if(fFluxDriver->End()) { flux_end = true; break; }
+        if(batched) {
+          GINSTR_SCOPE("GFluxI::GenerateBatch");
+          fFluxDriver->GenerateBatch(fFluxBatchSize, fFluxBatch);
+          fFluxBatchPos = 0;
+          if(fFluxBatch.N() == 0) { flux_end = true; break; }
+        }
+      }
+      event = this->GenerateEvent1Try();
+    }
+    if(!event) break;
+
+    fCurEvtIdx = fWorkerId + fNWorkers * fNEvtGenerated;
+    fNEvtGenerated++;
+    events.push_back(event);
+    fEvtFluxNu.Add(fCurNuPdg, fCurNuP4, fCurNuX4, fCurNuWeight, fCurNuIndex);
+    nev++;
+  }
+
+  if(flux_end) {
+    LOG("GMCJDriver", pNOTICE)
+      << "No more neutrinos can be thrown by the flux driver";
+  }
+  return nev;
+}
+//___________________________________________________________________________
+void GMCJDriver::SetFluxBatchSize(int nbatch)
+{
+// Number of flux neutrinos fetched at a time by GenerateEvents() (1 for no
+// batching). It bounds the number of flux neutrinos already accounted for in
+// the flux driver exposure, but not thrown yet, at the end of each call.
+//
+  fFluxBatchSize = TMath::Max(1, nbatch);
+}
+//___________________________________________________________________________
+void GMCJDriver::SaveState(TDirectory * dir) const
+{
+// Everything else in the driver is set at init, or is reset for each event
+//
+  if(fFluxBatchPos < fFluxBatch.N()) {
+    LOG("GMCJDriver", pERROR)
+      << "The checkpoint does not hold the " << this->NPendingFluxNeutrinos()
+      << " flux neutrinos fetched by GenerateEvents() and not thrown yet";
+  }
+  GMCJCheckpoint::SaveValue(dir, "NFluxNeutrinos", fNFluxNeutrinos);
+  GMCJCheckpoint::SaveValue(dir, "NEvtGenerated",  fNEvtGenerated);
+  GMCJCheckpoint::SaveValue(dir, "CurEvtIdx",      fCurEvtIdx);
+}
+//___________________________________________________________________________
+bool GMCJDriver::RestoreState(TDirectory * dir)
+{
+  bool ok = 
+    GMCJCheckpoint::LoadValue(dir, "NFluxNeutrinos", fNFluxNeutrinos) &&
+    GMCJCheckpoint::LoadValue(dir, "NEvtGenerated",  fNEvtGenerated)  &&
+    GMCJCheckpoint::LoadValue(dir, "CurEvtIdx",      fCurEvtIdx);
+  return ok;
+}
+//___________________________________________________________________________
 EventRecord * GMCJDriver::GenerateEvent1Try(void)
 {
 // attempt generating a neutrino interaction by firing a single flux neutrino
@@ -874,6 +1603,8 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   double R = rnd->RndEvg().Rndm();
   LOG("GMCJDriver", pDEBUG) << "Rndm [0,1] = " << R;
 
+  if(fUseFluxAlias && fFluxAliasProb.empty()) this->BuildFluxAliasTable();
+
   // Generate a neutrino using the input GFluxI & get current pdgc/p4/x4
   bool flux_ok = this->GenerateFluxNeutrino();
   if(!flux_ok) {
@@ -900,7 +1631,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
        if(Pno<0.) {
            LOG("GMCJDriver", pFATAL) 
              << "Negative no-interaction probability! (P = " << 100*Pno << " %)"
-             << " Particle E=" << fFluxDriver->Momentum().E() << " type=" << fFluxDriver->PdgCode() << "Psum=" << Psum;
+             << " Particle E=" << fCurNuP4.E() << " type=" << fCurNuPdg << "Psum=" << Psum;
            gAbortingInErr=true;
            exit(1);
        }
@@ -917,6 +1648,9 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
   // If possible use pre-generated flux neutrino interaction probabilities 
   if(fFluxIntTree){
     Psum = this->PreGenFluxInteractionProbability(); 
+    // an importance-sampled flux neutrino always interacts: Use the random
+    // number only for selecting the target material
+    if(fUseFluxAlias) R *= Psum;
   }         
   // Else compute them in the usual manner
   else {
@@ -928,7 +1662,7 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
           << "** Rejecting current flux neutrino (err computing path-lengths)";
        return 0;
     }
-    if(fCurPathLengths.AreAllZero()) {
+    if(this->CurPathLengthsAreAllZero()) {
        LOG("GMCJDriver", pNOTICE) 
           << "** Rejecting current flux neutrino (misses generation volume)";
        return 0;
@@ -952,9 +1686,9 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
          << "Negative no interactin probability! (P = " << 100*Pno << " %)";
 
       // print info about what caused the problem
-      int                    nupdg = fFluxDriver -> PdgCode  ();
-      const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
-      const TLorentzVector & nux4  = fFluxDriver -> Position ();
+      int                    nupdg = fCurNuPdg;
+      const TLorentzVector & nup4  = fCurNuP4;
+      const TLorentzVector & nux4  = fCurNuX4;
 
       LOG("GMCJDriver", pWARN)
         << "\n [-] Problematic neutrino: "
@@ -963,8 +1697,12 @@ EventRecord * GMCJDriver::GenerateEvent1Try(void)
         << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4)
         << "\n Emax : " << fEmax;
 
+      PathLengthList cur_path_lengths(fTgtList);
+      for(unsigned int imat = 0; imat < fMatPdg.size(); imat++) {
+        cur_path_lengths.SetPathLength(fMatPdg[imat], fMatCurPl[imat]);
+      }
       LOG("GMCJDriver", pWARN)
-        << "\n Problematic path lengths:" << fCurPathLengths;
+        << "\n Problematic path lengths:" << cur_path_lengths;
 
       LOG("GMCJDriver", pWARN)
         << "\n Maximum path lengths:" << fMaxPathLengths;
@@ -1039,17 +1777,35 @@ bool GMCJDriver::GenerateFluxNeutrino(void)
 //
   LOG("GMCJDriver", pNOTICE) << "Generating a flux neutrino";
 
-  bool ok = fFluxDriver->GenerateNext();
-  if(!ok) {
-     LOG("GMCJDriver", pERROR)
-         << "*** The flux driver couldn't generate a flux neutrino!!";
-     return false;
+  if(fFluxBatchPos < fFluxBatch.N()) {
+     // the next one of the flux neutrinos fetched by GenerateEvents()
+     int ib = fFluxBatchPos++;
+     fCurNuPdg    = fFluxBatch.PdgCode [ib];
+     fCurNuP4     = fFluxBatch.Momentum[ib];
+     fCurNuX4     = fFluxBatch.Position[ib];
+     fCurNuWeight = fFluxBatch.Weight  [ib];
+     fCurNuIndex  = fFluxBatch.Index   [ib];
+  } else {
+     GINSTR_SCOPE("GFluxI::GenerateNext");
+     bool ok = (fUseFluxAlias) ? 
+        fFluxDriver->GenerateEntry(this->SampleFluxEntry()) :
+        fFluxDriver->GenerateNext();
+     if(!ok) {
+        LOG("GMCJDriver", pERROR)
+            << "*** The flux driver couldn't generate a flux neutrino!!";
+        return false;
+     }
+     fCurNuPdg    = fFluxDriver -> PdgCode  ();
+     fCurNuP4     = fFluxDriver -> Momentum ();
+     fCurNuX4     = fFluxDriver -> Position ();
+     fCurNuWeight = fFluxDriver -> Weight   ();
+     fCurNuIndex  = fFluxDriver -> Index    ();
   }
 
   fNFluxNeutrinos++;
-  int                    nupdg = fFluxDriver -> PdgCode  ();
-  const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
-  const TLorentzVector & nux4  = fFluxDriver -> Position ();
+  int                    nupdg = fCurNuPdg;
+  const TLorentzVector & nup4  = fCurNuP4;
+  const TLorentzVector & nux4  = fCurNuX4;
 
   LOG("GMCJDriver", pNOTICE)
      << "\n [-] Generated flux neutrino: "
@@ -1079,26 +1835,46 @@ bool GMCJDriver::GenerateFluxNeutrino(void)
 bool GMCJDriver::ComputePathLengths(void)
 {
 // Ask the geometry driver to compute (pathLength x density x weight frac.)
-// for all detector materials for the neutrino generated by the flux driver
-// and make sure that things look ok...
+// for all detector materials for the current flux neutrino and make sure
+// that things look ok...
 
-  fCurPathLengths.clear();
+  return this->ComputePathLengths(fCurNuP4, fCurNuX4);
+}
+//___________________________________________________________________________
+bool GMCJDriver::ComputePathLengths(
+            const TLorentzVector & nup4, const TLorentzVector & nux4)
+{
+// As above, for the input flux neutrino 4-momentum and 4-position
 
-  const TLorentzVector & nup4  = fFluxDriver -> Momentum ();
-  const TLorentzVector & nux4  = fFluxDriver -> Position ();
+  fill(fMatCurPl.begin(), fMatCurPl.end(), 0.);
 
-  fCurPathLengths = fGeomAnalyzer->ComputePathLengths(nux4, nup4);
+  GINSTR_SCOPE("GeomAnalyzerI::ComputePathLengths");
+  const PathLengthList & path_lengths =
+        fGeomAnalyzer->ComputePathLengths(nux4, nup4);
 
-  LOG("GMCJDriver", pNOTICE) << fCurPathLengths;
+  LOG("GMCJDriver", pNOTICE) << path_lengths;
 
-  if(fCurPathLengths.size() == 0) {
+  if(path_lengths.size() == 0) {
      LOG("GMCJDriver", pFATAL)
        << "\n *** Geometry driver error ***"
        << "\n Got an empty PathLengthList - No material found in geometry?";
      return false;
   }
 
-  if(fCurPathLengths.AreAllZero()) {
+  // copy into the material table (both sorted by material PDG code)
+  PathLengthList::const_iterator pliter = path_lengths.begin();
+  for( ; pliter != path_lengths.end(); ++pliter) {
+     int imat = this->MaterialIndex(pliter->first);
+     if(imat < 0) {
+       LOG("GMCJDriver", pFATAL)
+         << "\n *** Geometry driver error ***"
+         << "\n Got a path length for undeclared material: " << pliter->first;
+       return false;
+     }
+     fMatCurPl[imat] = pliter->second;
+  }
+
+  if(this->CurPathLengthsAreAllZero()) {
          LOG("GMCJDriver", pNOTICE)
                  << "current flux v doesn't cross any geometry material...";
   }
@@ -1106,49 +1882,64 @@ bool GMCJDriver::ComputePathLengths(void)
 }
 //___________________________________________________________________________
 double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
+{
+  // current flux neutrino code & 4-p
+  return this->ComputeInteractionProbabilities(
+             use_max_path_length, fCurNuPdg, fCurNuP4);
+}
+//___________________________________________________________________________
+double GMCJDriver::ComputeInteractionProbabilities(
+       bool use_max_path_length, int nupdg, const TLorentzVector & nup4)
 {
   LOG("GMCJDriver", pNOTICE)
        << "Computing relative interaction probabilities for each material";
 
-  // current flux neutrino code & 4-p
-  int                    nupdg = fFluxDriver->PdgCode();
-  const TLorentzVector & nup4  = fFluxDriver->Momentum();
+  const vector<double> & path_lengths = 
+        (use_max_path_length) ? fMatMaxPl : fMatCurPl;
+
+  unsigned int nmat = fMatPdg.size();
+  unsigned int nnu  = fNuList.size();
+  unsigned int inu  = this->NuIndex(nupdg);
 
-  fCurCumulProbMap.clear();
+  // total xsec splines for the current flux neutrino and each material
+  const Spline * const * totxsecspls = &fMatXSecSplines[inu*nmat];
 
-  const PathLengthList & path_length_list = 
-        (use_max_path_length) ? fMaxPathLengths : fCurPathLengths;
+  // natural elements: the probability of the element is given to its first
+  // isotope, using the element xsec per unit mass number and the sum of the
+  // path lengths of its isotopes (the others get none)
+  bool natelem = (fElemFirstMat.size() > 0);
+
+  // probability scale, looked up once per flux neutrino (see below)
+  double pmax = 0;
 
   double probsum=0;
-  PathLengthList::const_iterator pliter;
 
-  for(pliter = path_length_list.begin();
-                            pliter != path_length_list.end(); ++pliter) {
-     int    mpdg  = pliter->first;            // material PDG code
-     double pl    = pliter->second;           // density x path-length
-     int    A     = pdg::IonPdgCodeToA(mpdg);
+  for(unsigned int imat = 0; imat < nmat; imat++) {
+     double pl    = path_lengths[imat];       // density x path-length
+     int    A     = fMatA[imat];
      double xsec  = 0.;                       // sum of xsecs for all modelled processes for given init state
      double prob  = 0.;                       // interaction probability
      double probn = 0.;                       // normalized interaction probability
-
-     // find the GEVGDriver object that is handling the current init state
-     InitialState init_state(mpdg, nupdg);
-     GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-     if(!evgdriver) {
-       LOG("GMCJDriver", pFATAL)
-        << "\n * The MC Job driver isn't properly configured!"
-        << "\n * No event generation driver could be found for init state: " 
-        << init_state.AsString();
-       exit(1);
+     const Spline * totxsecspl = totxsecspls[imat];
+
+     int ielem = (natelem) ? fMatElem[imat] : -1;
+     if(ielem >= 0) {
+        int first = fElemFirstMat[ielem];
+        pl = 0.;
+        if((int)imat == first) {
+          for(int k = 0; k < fElemNMat[ielem]; k++) pl += path_lengths[first+k];
+          A = 1;
+          totxsecspl = fElemXSecSplines[ielem*nnu + inu];
+        }
      }
+
      // compute the interaction xsec and probability (if path-length>0)
      if(pl>0.) {
-        const Spline * totxsecspl = evgdriver->XSecSumSpline();
         if(!totxsecspl) {
             LOG("GMCJDriver", pFATAL)
               << "\n * The MC Job driver isn't properly configured!"
               << "\n * Couldn't retrieve total cross section spline for init state: " 
-              << init_state.AsString();
+              << InitialState(fMatPdg[imat], nupdg).AsString();
             exit(1);
         } else {
             xsec = totxsecspl->Evaluate( nup4.Energy() );
@@ -1160,29 +1951,22 @@ double GMCJDriver::ComputeInteractionProbabilities(bool use_max_path_length)
         // scale the interaction probability to the maximum one so as not
         // to have to throw few billions of flux neutrinos before getting
         // an interaction...
-        double pmax = 0;
-        if(fGenerateUnweighted) pmax = fGlobPmax;
-        else {
-           map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nupdg);
-           assert(pmax_iter != fPmax.end());
-           TH1D * pmax_hst = pmax_iter->second;
-           assert(pmax_hst);
-           int    ie   = pmax_hst->FindBin(nup4.Energy());
-           pmax = pmax_hst->GetBinContent(ie);
+        if(pmax <= 0) {
+          pmax = this->ProbScale(nupdg, nup4.Energy());
+          assert(pmax>0);        
+          LOG("GMCJDriver", pDEBUG)
+            << "Pmax=" << pmax;
         }
-        assert(pmax>0);        
-        LOG("GMCJDriver", pDEBUG)
-          << "Pmax=" << pmax;
         probn = prob/pmax;
      }
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
      LOG("GMCJDriver", pNOTICE)
-         << "tgt: " << mpdg << " -> TotXSec = "
+         << "tgt: " << fMatPdg[imat] << " -> TotXSec = "
          << xsec/units::cm2 << " cm^2, Norm.Prob = " << 100*probn << "%";
 #endif
 
      probsum += probn;
-     fCurCumulProbMap.insert(map<int,double>::value_type(mpdg,probsum));
+     fMatCumulProb[imat] = probsum;
   }
   return probsum;
 }
@@ -1194,11 +1978,17 @@ int GMCJDriver::SelectTargetMaterial(double R)
 
   LOG("GMCJDriver", pNOTICE) << "Selecting target material";
   int tgtpdg = 0;
-  map<int,double>::const_iterator probiter = fCurCumulProbMap.begin();
-  for( ; probiter != fCurCumulProbMap.end(); ++probiter) {
-     double prob = probiter->second;
+  unsigned int nmat = fMatCumulProb.size();
+  for(unsigned int imat = 0; imat < nmat; imat++) {
+     double prob = fMatCumulProb[imat];
      if(R<prob) {
-        tgtpdg = probiter->first;
+        // natural element: choose the isotope reusing R, rescaled within
+        // the probability of the element
+        if(fElemFirstMat.size() > 0 && fMatElem[imat] >= 0) {
+          double prev = (imat > 0) ? fMatCumulProb[imat-1] : 0.;
+          imat = this->SelectElementIsotope(imat, (R-prev)/(prob-prev));
+        }
+        tgtpdg = fMatPdg[imat];
         LOG("GMCJDriver", pNOTICE) 
           << "Selected target material = " << tgtpdg;
         return tgtpdg;
@@ -1211,18 +2001,20 @@ int GMCJDriver::SelectTargetMaterial(double R)
 //___________________________________________________________________________
 void GMCJDriver::GenerateEventKinematics(void)
 {
-  int                    nupdg = fFluxDriver->PdgCode();
-  const TLorentzVector & nup4  = fFluxDriver->Momentum();
+  int                    nupdg = fCurNuPdg;
+  const TLorentzVector & nup4  = fCurNuP4;
 
   // Find the GEVGDriver object that generates interactions for the
   // given initial state (neutrino + target)
-  InitialState init_state(fSelTgtPdg, nupdg);
-  GEVGDriver * evgdriver = fGPool->FindDriver(init_state);
-  if(!evgdriver) {
+  int imat = this->MaterialIndex(fSelTgtPdg);
+  if(imat < 0) {
      LOG("GMCJDriver", pFATAL)
-       << "No GEVGDriver object for init state: " << init_state.AsString();
+       << "No GEVGDriver object for init state: " 
+       << InitialState(fSelTgtPdg, nupdg).AsString();
      exit(1);
   }
+  GEVGDriver * evgdriver = 
+      fMatEvgDrivers[this->NuIndex(nupdg)*fMatPdg.size() + imat];
 
   // propagate current unphysical event mask 
   evgdriver->SetUnphysEventMask(*fUnphysEventMask);
@@ -1241,9 +2033,10 @@ void GMCJDriver::GenerateVertexPosition(void)
   LOG("GMCJDriver", pNOTICE)
      << "Asking the geometry analyzer to generate a vertex";
 
-  const TLorentzVector & p4 = fFluxDriver->Momentum ();
-  const TLorentzVector & x4 = fFluxDriver->Position ();
+  const TLorentzVector & p4 = fCurNuP4;
+  const TLorentzVector & x4 = fCurNuX4;
 
+  GINSTR_SCOPE("GeomAnalyzerI::GenerateVertex");
   const TVector3 & vtx = fGeomAnalyzer->GenerateVertex(x4, p4, fSelTgtPdg);
 
   TVector3 origin(x4.X(), x4.Y(), x4.Z());
@@ -1269,8 +2062,9 @@ void GMCJDriver::ComputeEventProbability(void)
   double xsec = fCurEvt->XSec();
 
   // get path length in detector along v direction for specified target material
-  PathLengthList::const_iterator pliter = fCurPathLengths.find(fSelTgtPdg);
-  double path_length = pliter->second;
+  int imat = this->MaterialIndex(fSelTgtPdg);
+  assert(imat >= 0);
+  double path_length = fMatCurPl[imat];
 
   // get target material mass number
   int A = pdg::IonPdgCodeToA(fSelTgtPdg);
@@ -1288,11 +2082,7 @@ void GMCJDriver::ComputeEventProbability(void)
  
   double weight = 1.0;
   if(!fGenerateUnweighted) {
-     map<int,TH1D*>::const_iterator pmax_iter = fPmax.find(nu_pdg);
-     assert(pmax_iter != fPmax.end());
-     TH1D * pmax_hst = pmax_iter->second;
-     assert(pmax_hst);
-     double pmax = pmax_hst->GetBinContent(pmax_hst->FindBin(Ev));
+     double pmax = this->ProbScale(nu_pdg, Ev);
      assert(pmax>0);
      weight = pmax/fGlobPmax;
   }
@@ -1321,7 +2111,7 @@ double GMCJDriver::PreGenFluxInteractionProbability()
 // neutrino index (entry number in flux file). Exit if not possible as 
 // using meaningless interaction probability leads to incorrect physics 
 //
-  if(!fFluxIntTree){
+  if(!fFluxIntTree || fFluxIntProbs.empty()){
     LOG("GMCJDriver", pERROR) << 
          "Cannot get pre-computed flux interaction probability as no tree!";
     exit(1);
@@ -1331,16 +2121,18 @@ double GMCJDriver::PreGenFluxInteractionProbability()
 
   // Check if can find relevant entry and no mismatch in energies -->
   // using correct pre-gen interaction prob file
-  bool found_entry = fFluxIntTree->GetEntryWithIndex(fFluxDriver->Index()) > 0;
+  unsigned long idx = (unsigned long) fFluxDriver->Index();
+  bool found_entry = idx < fFluxIntProbs.size() && fFluxIntProbs[idx] >= 0.;
   bool enu_match = false;
   if(found_entry){
-    double rel_err = fBrFluxEnu-fFluxDriver->Momentum().E();
-    if(fBrFluxEnu > controls::kASmallNum) rel_err /= fBrFluxEnu;
+    double enu_pre_gen = fFluxIntEnu[idx];
+    double rel_err = enu_pre_gen-fFluxDriver->Momentum().E();
+    if(enu_pre_gen > controls::kASmallNum) rel_err /= enu_pre_gen;
     enu_match = TMath::Abs(rel_err)<controls::kASmallNum;
     if(enu_match == false){
       LOG("GMCJDriver", pERROR) << 
            "Mismatch between: Enu_curr  = "<< fFluxDriver->Momentum().E() <<
-           ", Enu_pre_gen = "<< fBrFluxEnu;
+           ", Enu_pre_gen = "<< enu_pre_gen;
     } 
   }
   else {
@@ -1358,6 +2150,86 @@ double GMCJDriver::PreGenFluxInteractionProbability()
     exit(1);
   }
   assert(fGlobPmax+controls::kASmallNum>0.0);
-  return fBrFluxIntProb/fGlobPmax; 
+  return fFluxIntProbs[idx]/fGlobPmax; 
+}
+//___________________________________________________________________________
+void GMCJDriver::BuildFluxAliasTable(void)
+{
+// Build the alias table (Vose's method) used for sampling flux entries with
+// probability proportional to FluxIntProb * FluxWeight in O(1) time
+//
+  if(!fFluxIntTree || fFluxIntProbs.empty()) {
+    LOG("GMCJDriver", pFATAL) << 
+      "Importance sampling of flux neutrinos requires pre-calculated "<<
+      "flux interaction probabilities!";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  unsigned int n = fFluxIntProbs.size();
+  vector<double> q(n, 0.);
+  double qsum = 0.;
+  int first_index = -1;
+  for(int i = 0; i< fFluxIntTree->GetEntries(); i++){
+    fFluxIntTree->GetEntry(i);
+    double qi = TMath::Max(0., fBrFluxIntProb) * TMath::Max(0., fBrFluxWeight);
+    q[fBrFluxIndex] = qi;
+    qsum += qi;
+    if(qi > 0. && first_index < 0) first_index = fBrFluxIndex;
+  }
+  if(qsum <= 0.) {
+    LOG("GMCJDriver", pFATAL) << 
+      "All pre-calculated flux interaction probabilities are null!";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // check that the flux driver allows random access to its entries
+  if(!fFluxDriver->GenerateEntry(first_index)) {
+    LOG("GMCJDriver", pFATAL) << 
+      "The flux driver doesn't support random access to flux entries, "<<
+      "as needed for importance sampling of flux neutrinos!";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  fFluxAliasProb.assign(n, 1.);
+  fFluxAliasIdx.resize(n);
+
+  vector<int> small, large;
+  for(unsigned int i = 0; i < n; i++) {
+    q[i] *= n / qsum;
+    fFluxAliasIdx[i] = i;
+    if(q[i] < 1.) small.push_back(i); 
+    else          large.push_back(i);
+  }
+  while(!small.empty() && !large.empty()) {
+    int is = small.back(); small.pop_back();
+    int il = large.back();
+    fFluxAliasProb[is] = q[is];
+    fFluxAliasIdx [is] = il;
+    q[il] -= (1. - q[is]);
+    if(q[il] < 1.) {
+      large.pop_back();
+      small.push_back(il);
+    }
+  }
+  // entries left in either list have probability 1 (up to rounding errors)
+
+  LOG("GMCJDriver", pNOTICE) << 
+     "Built alias table for importance sampling of " << n << " flux entries";
+}
+//___________________________________________________________________________
+long int GMCJDriver::SampleFluxEntry(void)
+{
+// Sample a flux entry index using the alias table
+//
+  RandomGen * rnd = RandomGen::Instance();
+
+  double u = rnd->RndFlux().Rndm() * fFluxAliasProb.size();
+  unsigned int i = TMath::Min((unsigned int) u, 
+                              (unsigned int) fFluxAliasProb.size()-1);
+  double f = u - i;
+  return (f < fFluxAliasProb[i]) ? i : fFluxAliasIdx[i];
 }
 //___________________________________________________________________________
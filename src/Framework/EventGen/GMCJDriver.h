@@ -23,6 +23,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <TH1D.h>
 #include <TLorentzVector.h>
@@ -30,19 +31,24 @@
 #include <TTree.h>
 #include <TBits.h>
 
+#include "Framework/EventGen/GFluxI.h"
 #include "Framework/EventGen/PathLengthList.h"
 #include "Framework/ParticleData/PDGCodeList.h"
 
 using std::string;
 using std::map;
+using std::vector;
+
+class TDirectory;
 
 namespace genie {
 
 class EventRecord;
-class GFluxI;
 class GeomAnalyzerI;
 class GENIE;
 class GEVGPool;
+class GEVGDriver;
+class Spline;
 
 class GMCJDriver {
 
@@ -59,26 +65,64 @@ public :
   bool UseMaxPathLengths           (string xml_filename);
   void KeepOnThrowingFluxNeutrinos (bool keep_on);
   void ForceSingleProbScale        (void);
+  void SetMaxWeightRatio           (double max_weight_ratio);
   void PreSelectEvents             (bool preselect = true);
   bool PreCalcFluxProbabilities    (void);
   bool LoadFluxProbabilities       (string filename);
   void SaveFluxProbabilities       (string outfilename);
+  void SetFluxProbabilitiesSlice   (unsigned int islice, unsigned int nslices);
+  void UseFluxImportanceSampling   (bool on = true);
+  void UseNaturalElementTargets    (bool on = true);
   void Configure                   (bool calc_prob_scales = true);
 
+  // configure a worker driver sharing the init-time products of a primary one
+  void SetWorkerSlot               (unsigned int iworker, unsigned int nworkers);
+  void ReseedRandomStreamsPerEvent (bool reseed = true);
+  void SetNDriverThreads           (unsigned int nthreads);
+  void Configure                   (const GMCJDriver & primary);
+
   // generate single neutrino event for input flux & geometry
   EventRecord * GenerateEvent (void);
 
+  // generate up to n events, appended to the input vector (the caller adopts
+  // them), fetching the flux neutrinos a batch at a time; returns the number
+  // of events generated, fewer than n only at the end of the flux
+  int  GenerateEvents   (int n, vector<EventRecord *> & events);
+  void SetFluxBatchSize (int nbatch);
+
+  // flux neutrinos of the events of the last GenerateEvents() call (the flux
+  // driver's current neutrino is no longer the one of each event) and number
+  // of the fetched flux neutrinos still to be thrown (already accounted for
+  // in the flux driver exposure)
+  const FluxBatch & EventFluxNeutrinos    (void) const { return fEvtFluxNu; }
+  int               NPendingFluxNeutrinos (void) const { return fFluxBatch.N() - fFluxBatchPos; }
+
   // info needed for computing the generated sample normalization
   double   GlobProbScale  (void) const { return fGlobPmax;                  }
   long int NFluxNeutrinos (void) const { return (long int) fNFluxNeutrinos; }
   map<int, double> SumFluxIntProbs(void) const { return fSumFluxIntProbs;   }
 
+  // max path-length list of the geometry (loaded or computed at Configure())
+  const PathLengthList & MaxPathLengths (void) const { return fMaxPathLengths; }
+
+  // worker slot & global index of the last generated event (for merging)
+  unsigned int WorkerId          (void) const { return fWorkerId;          }
+  unsigned int NWorkers          (void) const { return fNWorkers;          }
+  long int     CurrentEventIndex (void) const { return fCurEvtIdx;         }
+
+  // save / restore the event counters of the job (see GMCJCheckpoint)
+  void SaveState    (TDirectory * dir) const;
+  bool RestoreState (TDirectory * dir);
+
   // input flux and geometry drivers
   const GFluxI &        FluxDriver      (void) const { return *fFluxDriver;   }
   const GeomAnalyzerI & GeomAnalyzer    (void) const { return *fGeomAnalyzer; }
   GFluxI *              FluxDriverPtr   (void) const { return  fFluxDriver;   } 
   GeomAnalyzerI *       GeomAnalyzerPtr (void) const { return  fGeomAnalyzer; }
 
+  // the event generation drivers, one per initial state
+  const GEVGPool *      EventGenDriverPool (void) const { return fGPool; }
+
 private:
  
   // private methods:
@@ -87,6 +131,13 @@ private:
   void          GetParticleLists                (void);
   void          GetMaxPathLengthList            (void);
   void          GetMaxFluxEnergy                (void);
+  void          BuildMaterialTable              (void);
+  int           MaterialIndex                   (int mpdg) const;
+  int           NuIndex                         (int nupdg) const;
+  bool          CurPathLengthsAreAllZero        (void) const;
+  void          BuildNaturalElementTable        (void);
+  void          ClearNaturalElementTable        (void);
+  int           SelectElementIsotope            (int imat, double u) const;
   void          PopulateEventGenDriverPool      (void);
   void          BootstrapXSecSplines            (void);
   void          BootstrapXSecSplineSummation    (void);
@@ -94,13 +145,18 @@ private:
   EventRecord * GenerateEvent1Try               (void);
   bool          GenerateFluxNeutrino            (void);
   bool          ComputePathLengths              (void);
+  bool          ComputePathLengths              (const TLorentzVector & nup4, const TLorentzVector & nux4);
   double	ComputeInteractionProbabilities (bool use_max_path_length);
+  double        ComputeInteractionProbabilities (bool use_max_path_length, int nupdg, const TLorentzVector & nup4);
   int           SelectTargetMaterial            (double R);
   void          GenerateEventKinematics         (void);
   void          GenerateVertexPosition          (void);
   void          ComputeEventProbability         (void);
   double        InteractionProbability          (double xsec, double pl, int A);
   double        PreGenFluxInteractionProbability(void);
+  double        ProbScale                       (int nupdg, double Ev) const;
+  void          BuildFluxAliasTable             (void);
+  long int      SampleFluxEntry                 (void);
 
   // private data members:
   GEVGPool *      fGPool;              ///< A pool of GEVGDrivers properly configured event generation drivers / one per init state
@@ -110,11 +166,30 @@ private:
   PDGCodeList     fNuList;             ///< [declared by the flux driver] list of neutrino codes 
   PDGCodeList     fTgtList;            ///< [declared by the geom driver] list of target codes 
   PathLengthList  fMaxPathLengths;     ///< [declared by the geom driver] maximum path length list 
-  PathLengthList  fCurPathLengths;     ///< [current] path length list for current flux neutrino
+  vector<int>     fMatPdg;             ///< [computed at init] material table: target codes (sorted)
+  vector<int>     fMatA;               ///< [computed at init] material table: mass numbers
+  vector<double>  fMatMaxPl;           ///< [computed at init] material table: maximum path lengths
+  vector<GEVGDriver*> fMatEvgDrivers;  ///< [computed at init] material table: GEVGDriver per flux neutrino (outer index) & material
+  vector<const Spline*> fMatXSecSplines; ///< [computed at init] material table: total xsec spline per flux neutrino (outer index) & material
+  vector<double>  fMatCurPl;           ///< [current] material table: path lengths for current flux neutrino
+  vector<double>  fMatCumulProb;       ///< [current] material table: cummulative interaction probabilities
+  bool            fUseNatElements;     ///< [config] collapse the isotopes of each natural element into a single target?
+  vector<int>     fMatElem;            ///< [computed at init] material table: natural element the material is collapsed into (-1 if none)
+  vector<int>     fElemFirstMat;       ///< [computed at init] natural elements: first of their isotopes in the material table
+  vector<int>     fElemNMat;           ///< [computed at init] natural elements: number of their isotopes (contiguous in the material table)
+  vector<Spline*> fElemXSecSplines;    ///< [computed at init] natural elements: abundance-weighted total xsec / mass number, per element (outer index) & flux neutrino
   TLorentzVector  fCurVtx;             ///< [current] interaction vertex
+  int             fCurNuPdg;           ///< [current] flux neutrino pdg code
+  TLorentzVector  fCurNuP4;            ///< [current] flux neutrino 4-momentum
+  TLorentzVector  fCurNuX4;            ///< [current] flux neutrino 4-position
+  double          fCurNuWeight;        ///< [current] flux neutrino weight
+  long int        fCurNuIndex;         ///< [current] flux neutrino index (see GFluxI::Index)
+  FluxBatch       fFluxBatch;          ///< [current] flux neutrinos fetched by GenerateEvents()
+  int             fFluxBatchPos;       ///< [current] next flux neutrino of fFluxBatch to be thrown
+  int             fFluxBatchSize;      ///< [config] flux neutrinos fetched at a time by GenerateEvents()
+  FluxBatch       fEvtFluxNu;          ///< [current] flux neutrinos of the events of the last GenerateEvents() call
   EventRecord *   fCurEvt;             ///< [current] generated event
   int             fSelTgtPdg;          ///< [current] selected target material PDG code
-  map<int,double> fCurCumulProbMap;    ///< [current] cummulative interaction probabilities
   double          fNFluxNeutrinos;     ///< [current] number of flux nuetrinos fired by the flux driver so far 
   map<int,TH1D*>  fPmax;               ///< [computed at init] interaction probability scale /neutrino /energy for given geometry
   double          fGlobPmax;           ///< [computed at init] global interaction probability scale for given flux & geometry
@@ -126,6 +201,7 @@ private:
   bool            fUseLogE;            ///< [config] build splines = f(logE) (rather than f(E)) ?
   bool            fKeepThrowingFluxNu; ///< [config] keep firing flux neutrinos till one of them interacts
   bool            fGenerateUnweighted; ///< [config] force single probability scale?
+  double          fMaxWeightRatio;     ///< [config] if >0, bound the energy-binned probability scales from below at fGlobPmax/fMaxWeightRatio
   bool            fPreSelect;          ///< [config] set whether to pre-select events using max interaction paths 
   TFile*          fFluxIntProbFile;    ///< [input] pre-generated flux interaction probability file
   TTree*          fFluxIntTree;        ///< [computed-or-loaded] pre-computed flux interaction probabilities (expected tree name is "gFlxIntProbs")
@@ -136,7 +212,20 @@ private:
   int             fBrFluxPDG;          ///< corresponding flux pdg code (set to address of branch: "FluxPDG") 
   string          fFluxIntFileName;    ///< whether to save pre-generated flux tree for use in later jobs
   string          fFluxIntTreeName;    ///< name for tree holding flux probabilities 
+  vector<double>  fFluxIntProbs;       ///< [computed-or-loaded] FluxIntProb for each flux entry, indexed by FluxIndex (-1 if not available)
+  vector<float>   fFluxIntEnu;         ///< [computed-or-loaded] FluxEnu for each flux entry, indexed by FluxIndex (for consistency checks)
+  bool            fUseFluxAlias;       ///< [config] sample flux entries from their pre-calculated interaction probabilities?
+  vector<double>  fFluxAliasProb;      ///< [computed] alias table (Vose): probability of keeping the sampled flux entry
+  vector<int>     fFluxAliasIdx;       ///< [computed] alias table (Vose): flux entry used otherwise
   map<int, double> fSumFluxIntProbs;   ///< map where the key is flux pdg code and the value is sum of fBrFluxWeight * fBrFluxIntProb for all these flux neutrinos 
+  unsigned int    fFluxIntSlice;       ///< [config] slice of flux entries whose interaction probabilities are pre-calculated by this job
+  unsigned int    fNFluxIntSlices;     ///< [config] number of slices the pre-calculation of flux interaction probabilities is split into
+  unsigned int    fWorkerId;           ///< [config] worker slot of this driver in a multi-worker job (0 for a single driver)
+  unsigned int    fNWorkers;           ///< [config] number of workers in a multi-worker job (1 for a single driver)
+  long int        fNEvtGenerated;      ///< [current] number of events returned by this driver so far
+  long int        fCurEvtIdx;          ///< [current] global (job-wide) index of the last generated event
+  bool            fReseedPerEvent;     ///< [config] reseed the RandomGen streams from the job-wide index of each event?
+  unsigned int    fNDriverThreads;     ///< [config] number of threads configuring the GEVGDriver pool
 };
 
 }      // genie namespace
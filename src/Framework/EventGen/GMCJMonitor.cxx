@@ -14,6 +14,10 @@
    fCpuTime wasn't initialized.
  @ Jan 30, 2013 - CA
    Added SetRefreshRate(int rate)
+ @ Oct 14, 2026 - CA
+   Keep job statistics (event rate, flux neutrinos per event, events per
+   process, per-module run / stop counts and timing) and optionally write
+   them in JSON at every refresh.
 
 */
 //____________________________________________________________________________
@@ -21,15 +25,24 @@
 #include <sstream>
 #include <fstream>
 #include <cstdlib>
+#include <cstdio>
 
 #include <TSystem.h>
 #include <TMath.h>
 
 #include "Framework/EventGen/EventRecord.h"
 #include "Framework/EventGen/GMCJMonitor.h"
+#include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/EventGen/EventGenerator.h"
+#include "Framework/EventGen/EventGeneratorList.h"
+#include "Framework/EventGen/EventRecordVisitorI.h"
+#include "Framework/Interaction/Interaction.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunOpt.h"
 
 using std::ostringstream;
 using std::endl;
@@ -57,10 +70,41 @@ void GMCJMonitor::SetRefreshRate(int rate)
 //____________________________________________________________________________
 void GMCJMonitor::Update(int iev, const EventRecord * event)
 {
+  // cheap per-event counters
+  fNEvents++;
+  if(event) {
+    const Interaction * in = event->Summary();
+    if(in) {
+      int key = 100 * (int) in->ProcInfo().ScatteringTypeId() +
+                      (int) in->ProcInfo().InteractionTypeId();
+      fNEvtPerProc[key]++;
+    }
+  }
+
   if(iev%fRefreshRate) return; // continue only every fRefreshRate events 
 
   fWatch.Stop();
-  fCpuTime += (fWatch.CpuTime());
+  fCpuTime  += (fWatch.CpuTime());
+  fRealTime += (fWatch.RealTime());
+
+  // sample the statistics
+  fEventRate  = (fRealTime > 0) ? fNEvents / fRealTime : 0.;
+  fNuPerEvent = (fMCJDriver && fNEvents > 0) ?
+      (double) fMCJDriver->NFluxNeutrinos() / fNEvents : 0.;
+
+  fModNRuns.clear();
+  fModNStops.clear();
+  fModTime.clear();
+  if(fMCJDriver && fMCJDriver->EventGenDriverPool()) {
+    const GEVGPool * pool = fMCJDriver->EventGenDriverPool();
+    GEVGPool::const_iterator piter = pool->begin();
+    for( ; piter != pool->end(); ++piter) {
+      if(piter->second) this->AddModuleStats(piter->second->EventGenerators());
+    }
+  }
+  if(fEvGenDriver) this->AddModuleStats(fEvGenDriver->EventGenerators());
+
+  if(fStatsFile.size() > 0) this->WriteStats();
 
   ofstream out(fStatusFile.c_str(), ios::out);
 
@@ -93,7 +137,15 @@ void GMCJMonitor::Init(void)
   // create a stopwatch
   fWatch.Reset(); 
   fWatch.Start();
-  fCpuTime = 0;
+  fCpuTime  = 0;
+  fRealTime = 0;
+
+  fMCJDriver   = 0;
+  fEvGenDriver = 0;
+  fNEvents     = 0;
+  fEventRate   = 0.;
+  fNuPerEvent  = 0.;
+  fStatsFile   = RunOpt::Instance()->MCJobStatsFile();
 
   // get rehreah rate of set default / protect from invalid refresh rates
   if( gSystem->Getenv("GMCJMONREFRESH") ) {
@@ -109,3 +161,97 @@ void GMCJMonitor::CustomizeFilename(string filename)
   fStatusFile = filename;
 }
 //____________________________________________________________________________
+void GMCJMonitor::SetMCJDriver(const GMCJDriver * mcjdriver)
+{
+  fMCJDriver = mcjdriver;
+}
+//____________________________________________________________________________
+void GMCJMonitor::SetEvGenDriver(const GEVGDriver * evgdriver)
+{
+  fEvGenDriver = evgdriver;
+}
+//____________________________________________________________________________
+void GMCJMonitor::SetStatsFile(string filename)
+{
+  fStatsFile = filename;
+}
+//____________________________________________________________________________
+void GMCJMonitor::AddModuleStats(const EventGeneratorList * evgl)
+{
+// Sum up the module statistics of all event generators in the list
+// (modules shared by several generators are summed over them)
+
+  if(!evgl) return;
+
+  EventGeneratorList::const_iterator eiter = evgl->begin();
+  for( ; eiter != evgl->end(); ++eiter) {
+    const EventGenerator * evg = dynamic_cast<const EventGenerator *> (*eiter);
+    if(!evg) continue;
+    const vector<const EventRecordVisitorI *> & modules = evg->Modules();
+    for(unsigned int istep = 0; istep < modules.size(); istep++) {
+      if(!modules[istep]) continue;
+      string key = modules[istep]->Id().Key();
+      fModNRuns [key] += evg->NModuleRuns (istep);
+      fModNStops[key] += evg->NModuleStops(istep);
+      fModTime  [key] += evg->ModuleTime  (istep);
+    }
+  }
+}
+//____________________________________________________________________________
+void GMCJMonitor::PrintStats(ostream & stream) const
+{
+  stream << "{" << endl;
+  stream << "  \"run\": "                   << fRunNu      << "," << endl;
+  stream << "  \"events\": "                << fNEvents    << "," << endl;
+  stream << "  \"cpu_time\": "              << fCpuTime    << "," << endl;
+  stream << "  \"real_time\": "             << fRealTime   << "," << endl;
+  stream << "  \"events_per_sec\": "        << fEventRate  << "," << endl;
+  stream << "  \"flux_nu_per_event\": "     << fNuPerEvent << "," << endl;
+
+  stream << "  \"events_per_process\": {";
+  map<int, long>::const_iterator piter = fNEvtPerProc.begin();
+  for( ; piter != fNEvtPerProc.end(); ++piter) {
+    ScatteringType_t  st = (ScatteringType_t)  (piter->first / 100);
+    InteractionType_t it = (InteractionType_t) (piter->first % 100);
+    stream << ((piter == fNEvtPerProc.begin()) ? "" : ",") << endl
+           << "    \"" << ScatteringType::AsString(st) << " "
+           << InteractionType::AsString(it) << "\": " << piter->second;
+  }
+  stream << endl << "  }," << endl;
+
+  stream << "  \"modules\": {";
+  map<string, long>::const_iterator miter = fModNRuns.begin();
+  for( ; miter != fModNRuns.end(); ++miter) {
+    const string & key = miter->first;
+    long   nruns  = miter->second;
+    long   nstops = fModNStops.find(key)->second;
+    double cpu    = fModTime.find(key)->second;
+    stream << ((miter == fModNRuns.begin()) ? "" : ",") << endl
+           << "    \"" << key << "\": { \"runs\": " << nruns
+           << ", \"stops\": " << nstops
+           << ", \"cpu_time_per_run\": " << ((nruns > 0) ? cpu/nruns : 0.)
+           << " }";
+  }
+  stream << endl << "  }" << endl;
+  stream << "}" << endl;
+}
+//____________________________________________________________________________
+void GMCJMonitor::WriteStats(void) const
+{
+// Write in a temporary file and rename it, so that readers polling the
+// statistics file never see it partially written
+
+  string tmpfile = fStatsFile + ".tmp";
+  ofstream out(tmpfile.c_str(), ios::out);
+  if(!out) {
+    LOG("GMCJMonitor", pWARN) << "Can not write: " << tmpfile;
+    return;
+  }
+  this->PrintStats(out);
+  out.close();
+
+  if(rename(tmpfile.c_str(), fStatsFile.c_str()) != 0) {
+    LOG("GMCJMonitor", pWARN) << "Can not write: " << fStatsFile;
+  }
+}
+//____________________________________________________________________________
@@ -7,6 +7,16 @@
          This is used to be able to keep track of an MC job status even when
          all output is suppressed or redirected to /dev/null.
 
+         The monitor also keeps job statistics: the number of events and
+         the number of events per process (counted at every event), and,
+         sampled at every refresh, the event rate, the number of flux
+         neutrinos per event (if a GMCJDriver is set) and the run count,
+         stop (rejection) count and cpu time of every event generation
+         module (if a GMCJDriver or GEVGDriver is set). If a statistics
+         file is set (see SetStatsFile() or the --mc-job-stats-file run
+         option), the statistics are written there in JSON at every refresh.
+         The file is replaced atomically, so it can be polled at any time.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,11 +31,22 @@
 #ifndef _G_MC_JOB_MONITOR_H_
 #define _G_MC_JOB_MONITOR_H_
 
+#include <map>
+#include <string>
+#include <ostream>
+
 #include <TStopwatch.h>
 
+using std::map;
+using std::string;
+using std::ostream;
+
 namespace genie {
 
 class EventRecord;
+class GMCJDriver;
+class GEVGDriver;
+class EventGeneratorList;
 
 class GMCJMonitor {
 
@@ -37,15 +58,39 @@ public :
   void Update (int iev, const EventRecord * event);
   void CustomizeFilename(string filename);
 
+  void SetMCJDriver   (const GMCJDriver * mcjdriver); ///< for flux neutrino & module statistics
+  void SetEvGenDriver (const GEVGDriver * evgdriver); ///< for module statistics
+  void SetStatsFile   (string filename);              ///< JSON statistics file, updated at every refresh
+
+  // statistics (counters updated at every event, rates at every refresh)
+  long   NEvents               (void) const { return fNEvents;    }
+  double EventRate             (void) const { return fEventRate;  } ///< events per wall-clock second
+  double FluxNeutrinosPerEvent (void) const { return fNuPerEvent; }
+  const map<int, long> & NEventsPerProcess (void) const { return fNEvtPerProc; } ///< key: 100*scattering type + interaction type
+  void   PrintStats            (ostream & stream) const; ///< as JSON
+
 private:
 
-  void Init (void);
+  void Init        (void);
+  void WriteStats  (void) const;
+  void AddModuleStats (const EventGeneratorList * evgl);
 
   Long_t     fRunNu;       ///< run number
   string     fStatusFile;  ///< name of output status file
   TStopwatch fWatch;       
   double     fCpuTime;     ///< total cpu time so far
   int        fRefreshRate; ///< update output every so many events
+  double     fRealTime;    ///< total wall-clock time so far
+  string     fStatsFile;   ///< name of output statistics file (none if empty)
+  const GMCJDriver * fMCJDriver; ///< MC job driver, for flux neutrino & module statistics
+  const GEVGDriver * fEvGenDriver; ///< event generation driver, for module statistics
+  long       fNEvents;     ///< # of events so far
+  double     fEventRate;   ///< events / s (at last refresh)
+  double     fNuPerEvent;  ///< flux neutrinos / event (at last refresh)
+  map<int, long>   fNEvtPerProc;    ///< # of events per process, key: 100*scattering type + interaction type
+  map<string, long>   fModNRuns;    ///< # of runs per module (at last refresh)
+  map<string, long>   fModNStops;   ///< # of thread stops per module (at last refresh)
+  map<string, double> fModTime;     ///< cpu time per module (at last refresh)
 };
 
 }      // genie namespace
@@ -0,0 +1,202 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <iomanip>
+#include <sstream>
+#include <sys/stat.h>
+
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GMCJDriver.h"
+#include "Framework/EventGen/GMCJPlanner.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::ostringstream;
+using std::endl;
+using std::setw;
+
+using namespace genie;
+
+namespace {
+  const double kNProjEvents = 1.E+6;
+}
+//____________________________________________________________________________
+GMCJPlanner::GMCJPlanner(long int nevents) :
+fNEvents   (nevents),
+fInitTime  (-1.),
+fNFluxNu0  (0),
+fMCJDriver (0),
+fNNull     (0),
+fExposure  (-1.),
+fExpUnits  (""),
+fOutFile   (""),
+fOutBytes  (-1)
+{
+  fAllStats.nev  = 0;
+  fAllStats.cpu  = 0.;
+  fAllStats.real = 0.;
+
+  fInitWatch.Reset();
+  fInitWatch.Start();
+}
+//____________________________________________________________________________
+GMCJPlanner::~GMCJPlanner()
+{
+
+}
+//____________________________________________________________________________
+void GMCJPlanner::SetMCJDriver(const GMCJDriver * mcjdriver)
+{
+  fMCJDriver = mcjdriver;
+}
+//____________________________________________________________________________
+void GMCJPlanner::StartEvent(void)
+{
+  if(fInitTime < 0) {
+    fInitWatch.Stop();
+    fInitTime = fInitWatch.RealTime();
+    fNFluxNu0 = (fMCJDriver) ? fMCJDriver->NFluxNeutrinos() : 0;
+  }
+  fEventWatch.Start(true);
+}
+//____________________________________________________________________________
+void GMCJPlanner::EndEvent(const EventRecord * event)
+{
+  fEventWatch.Stop();
+  double cpu  = fEventWatch.CpuTime();
+  double real = fEventWatch.RealTime();
+
+  fAllStats.cpu  += cpu;
+  fAllStats.real += real;
+
+  const Interaction * in = (event) ? event->Summary() : 0;
+  if(!in) {
+    fNNull++;
+    return;
+  }
+  fAllStats.nev++;
+
+  int key = 100 * (int) in->ProcInfo().ScatteringTypeId() +
+                  (int) in->ProcInfo().InteractionTypeId();
+  map<int, ProcStats_t>::iterator it = fProcStats.find(key);
+  if(it == fProcStats.end()) {
+    ProcStats_t stats;
+    stats.nev  = 0;
+    stats.cpu  = 0.;
+    stats.real = 0.;
+    it = fProcStats.insert(map<int, ProcStats_t>::value_type(key, stats)).first;
+  }
+  it->second.nev++;
+  it->second.cpu  += cpu;
+  it->second.real += real;
+}
+//____________________________________________________________________________
+void GMCJPlanner::SetExposure(double exposure, string units)
+{
+  fExposure = exposure;
+  fExpUnits = units;
+}
+//____________________________________________________________________________
+void GMCJPlanner::SetOutputFile(string filename)
+{
+  fOutFile  = filename;
+  fOutBytes = -1;
+
+  struct stat info;
+  if(stat(filename.c_str(), &info) == 0) {
+    fOutBytes = info.st_size;
+  } else {
+    LOG("GMCJPlanner", pWARN) << "Can not get the size of: " << filename;
+  }
+}
+//____________________________________________________________________________
+void GMCJPlanner::Print(ostream & stream) const
+{
+  long   nev  = fAllStats.nev;
+  double nevd = TMath::Max(1L, nev);
+
+  stream << endl << " ** MC job plan, from " << nev << " sampled events";
+  if(fNNull > 0) stream << " (and " << fNNull << " null ones)";
+  stream << endl;
+  if(nev < fNEvents) {
+    stream << " ** Fewer events than the requested " << fNEvents
+           << " were generated: the estimates below are less precise" << endl;
+  }
+
+  stream << endl << " Initialization time:              "
+         << TMath::Max(0., fInitTime) << " s" << endl;
+
+  if(fMCJDriver) {
+    double nflux = fMCJDriver->NFluxNeutrinos() - fNFluxNu0;
+    stream << " Interaction probability scale:    "
+           << fMCJDriver->GlobProbScale() << endl;
+    stream << " Flux neutrinos thrown / event:    " << nflux / nevd << endl;
+  }
+  if(fExposure > 0) {
+    stream << " Exposure / event:                 "
+           << fExposure / nevd << " " << fExpUnits << endl;
+  }
+  stream << " Generation cpu time / event:      "
+         << 1.E+3 * fAllStats.cpu / nevd << " ms" << endl;
+  stream << " Generation rate:                  "
+         << ((fAllStats.real > 0) ? nev / fAllStats.real : 0.)
+         << " events / s (wall-clock)" << endl;
+  if(fOutBytes >= 0) {
+    stream << " Output size / event:              "
+           << fOutBytes / nevd / 1024. << " kB (" << fOutFile << ")" << endl;
+  }
+
+  stream << endl << " Process mix:" << endl;
+  stream << setw(32) << "process" << setw(10) << "events"
+         << setw(22) << "fraction" << setw(14) << "ms / event"
+         << setw(16) << "events / s" << endl;
+  map<int, ProcStats_t>::const_iterator it = fProcStats.begin();
+  for( ; it != fProcStats.end(); ++it) {
+    ScatteringType_t  st = (ScatteringType_t)  (it->first / 100);
+    InteractionType_t in = (InteractionType_t) (it->first % 100);
+    const ProcStats_t & stats = it->second;
+    double f  = stats.nev / nevd;
+    double df = TMath::Sqrt(f * (1-f) / nevd);
+    ostringstream proc, frac;
+    proc << ScatteringType::AsString(st) << " " << InteractionType::AsString(in);
+    frac << f << " +/- " << df;
+    stream << setw(32) << proc.str() << setw(10) << stats.nev
+           << setw(22) << frac.str()
+           << setw(14) << 1.E+3 * stats.cpu / stats.nev
+           << setw(16) << ((stats.real > 0) ? stats.nev / stats.real : 0.)
+           << endl;
+  }
+
+  stream << endl << " For " << kNProjEvents << " events:" << endl;
+  if(fExposure > 0) {
+    stream << " - exposure:  "
+           << kNProjEvents * fExposure / nevd << " " << fExpUnits << endl;
+  }
+  stream << " - cpu time:  "
+         << kNProjEvents * fAllStats.cpu / nevd / 3600. << " h" << endl;
+  if(fOutBytes >= 0) {
+    stream << " - output:    "
+           << kNProjEvents * fOutBytes / nevd / (1024.*1024.*1024.) << " GB"
+           << endl;
+  }
+}
+//____________________________________________________________________________
+void GMCJPlanner::Report(void) const
+{
+  ostringstream report;
+  this->Print(report);
+  LOG("GMCJPlanner", pNOTICE) << report.str();
+}
+//____________________________________________________________________________
@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GMCJPlanner
+
+\brief    Job-planning dry run of an MC job: measures, over a short sample of
+          generated events, what a production job would need per event, so
+          that production campaigns can be sized without trial jobs.
+
+          The report gives:
+          - the initialization time (from the construction of the planner
+            to the first generated event),
+          - the exposure per event (eg POT for a beam flux, or whatever the
+            application sets with SetExposure()), along with the global
+            interaction probability scale and the flux neutrinos thrown per
+            event (if a GMCJDriver is set),
+          - the process mix of the sample,
+          - the event generation time (cpu and wall-clock) per event and the
+            event rate, overall and per process class; the time of the flux
+            neutrinos thrown before an event is included in its own,
+          - the output size per event, for the output format and options of
+            the job, measured on the output file the sample was written in
+            (see SetOutputFile()),
+          and the corresponding projections for 1M events.
+
+          Typical use (see the --plan option in RunOpt):
+
+            GMCJPlanner plan(nevents);  // as early as possible in the job
+            ... (initialization)
+            plan.SetMCJDriver(mcj_driver);
+            for(long int i = 0; i < plan.NEvents(); i++) {
+              plan.StartEvent();
+              EventRecord * event = mcj_driver->GenerateEvent();
+              plan.EndEvent(event);
+              ...
+            }
+            plan.SetExposure(pot, "POT");
+            ntpw.Save();
+            plan.SetOutputFile(ntpw.Filename());
+            plan.Report();
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_MC_JOB_PLANNER_H_
+#define _G_MC_JOB_PLANNER_H_
+
+#include <map>
+#include <string>
+#include <ostream>
+
+#include <TStopwatch.h>
+
+using std::map;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class EventRecord;
+class GMCJDriver;
+
+class GMCJPlanner {
+
+public :
+  GMCJPlanner(long int nevents);
+ ~GMCJPlanner();
+
+  //! number of events to sample
+  long int NEvents       (void) const { return fNEvents; }
+
+  void     SetMCJDriver  (const GMCJDriver * mcjdriver); ///< for the flux neutrinos & probability scale
+
+  //! time the generation of an event (null if none was generated)
+  void     StartEvent    (void);
+  void     EndEvent      (const EventRecord * event);
+
+  //! exposure of the generated sample, in the given units
+  void     SetExposure   (double exposure, string units);
+
+  //! output file the sample was written in (once closed)
+  void     SetOutputFile (string filename);
+
+  void     Print         (ostream & stream) const;
+  void     Report        (void) const; ///< print through the Messenger
+
+private:
+  struct ProcStats_t {
+    long   nev;     ///< # of events
+    double cpu;     ///< total cpu time
+    double real;    ///< total wall-clock time
+  };
+
+  long int   fNEvents;     ///< # of events to sample
+  TStopwatch fInitWatch;   ///< running from construction to the first event
+  double     fInitTime;    ///< wall-clock initialization time, -1 until the first event
+  TStopwatch fEventWatch;  ///< running while an event is generated
+  long int   fNFluxNu0;    ///< # of flux neutrinos thrown before the first event
+
+  const GMCJDriver * fMCJDriver; ///< MC job driver (not owned)
+
+  map<int, ProcStats_t> fProcStats; ///< per process, key: 100*scattering type + interaction type
+  ProcStats_t           fAllStats;  ///< all generated events
+  long       fNNull;       ///< # of null events
+  double     fExposure;    ///< exposure of the sample, <=0 if not set
+  string     fExpUnits;    ///< exposure units
+  string     fOutFile;     ///< output file of the sample
+  Long64_t   fOutBytes;    ///< output file size, -1 if not known
+};
+
+}      // genie namespace
+
+#endif // _G_MC_JOB_PLANNER_H_
@@ -15,6 +15,10 @@
 //____________________________________________________________________________
 
 #include "Framework/EventGen/GeomAnalyzerI.h"
+#include "Framework/EventGen/PathLengthList.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+
+#include <TLorentzVector.h>
 
 using namespace genie;
 
@@ -29,4 +33,24 @@ GeomAnalyzerI::~GeomAnalyzerI()
 
 }
 //____________________________________________________________________________
+void GeomAnalyzerI::ComputePathLengthMatrix(
+   int nrays, const TLorentzVector * x, const TLorentzVector * p, 
+   vector<double> & pl)
+{
+// Default implementation, one ray at a time. Geometry drivers can override
+// it to amortize the per-ray overhead.
+
+  const PDGCodeList & tgtlist = this->ListOfTargetNuclei();
+  unsigned int ntgt = tgtlist.size();
+
+  pl.assign(nrays * ntgt, 0.);
+
+  for(int iray = 0; iray < nrays; iray++) {
+    const PathLengthList & raypl = this->ComputePathLengths(x[iray], p[iray]);
+    for(unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      pl[iray * ntgt + itgt] = raypl.PathLength(tgtlist[itgt]);
+    }
+  }
+}
+//____________________________________________________________________________
 
@@ -19,6 +19,10 @@
 #ifndef _GEOMETRY_ANALYZER_I_H_
 #define _GEOMETRY_ANALYZER_I_H_
 
+#include <vector>
+
+using std::vector;
+
 class TLorentzVector;
 class TVector3;
 
@@ -47,6 +51,14 @@ public :
             GenerateVertex (
               const TLorentzVector & x, const TLorentzVector & p, int tgtpdg) = 0;
 
+  // batched version of ComputePathLengths(): path lengths for nrays rays
+  // (x[i], p[i]) as a dense matrix, pl[iray * ntgt + itgt], with the targets
+  // in the order of ListOfTargetNuclei()
+  virtual void
+            ComputePathLengthMatrix (
+              int nrays, const TLorentzVector * x, const TLorentzVector * p,
+              vector<double> & pl);
+
 protected:
 
   GeomAnalyzerI();
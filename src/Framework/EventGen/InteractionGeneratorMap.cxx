@@ -10,11 +10,18 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   BuildMap() can copy the interaction lists from InteractionListTemplates
+   and no longer copies the lists created by the list generators.
+ @ Oct 14, 2026 - CA
+   Added the energy windows of the interactions (ChannelsByThreshold(),
+   NOpenChannels(), ChannelEmax()) used to skip closed channels.
 
 */
 //____________________________________________________________________________
 
 #include <iomanip>
+#include <algorithm>
 
 #include <TMath.h>
 
@@ -23,14 +30,41 @@
 #include "Framework/EventGen/InteractionGeneratorMap.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/InteractionListTemplates.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/XSecSplineList.h"
 
 using std::setw;
 using std::setfill;
 using std::endl;
 using namespace genie;
 
+//____________________________________________________________________________
+namespace {
+  // processes for which KPhaseSpace::Threshold() is computed
+  // (it aborts for any other)
+  bool HasKinematicThreshold(const ProcessInfo & pi)
+  {
+    return pi.IsSingleKaon()    || pi.IsCoherent()         ||
+           pi.IsQuasiElastic()  || pi.IsDarkMatterElastic() ||
+           pi.IsInverseBetaDecay() || pi.IsResonant()      ||
+           pi.IsDeepInelastic() || pi.IsDarkMatterDeepInelastic() ||
+           pi.IsDiffractive()   || pi.IsInverseMuDecay()   ||
+           pi.IsIMDAnnihilation() || pi.IsNuElectronElastic() ||
+           pi.IsGlashowResonance() || pi.IsAMNuGamma()     ||
+           pi.IsMEC();
+  }
+  // order of list indices by the lower edge of their energy window
+  struct ChannelEminLess {
+    const vector<double> * emin;
+    bool operator() (unsigned int i, unsigned int j) const
+    { return (*emin)[i] < (*emin)[j]; }
+  };
+}
+
 //____________________________________________________________________________
 namespace genie {
  ostream & operator << (ostream & stream, const InteractionGeneratorMap & intl)
@@ -70,6 +104,11 @@ void InteractionGeneratorMap::Init(void)
 
   fInitState       = new InitialState;
   fInteractionList = new InteractionList;
+
+  fChanUseSplines = false;
+  fChanOrder.clear();
+  fChanEmin.clear();
+  fChanEmax.clear();
 }
 //___________________________________________________________________________
 void InteractionGeneratorMap::CleanUp(void)
@@ -87,6 +126,11 @@ void InteractionGeneratorMap::Copy(const InteractionGeneratorMap & xsmap)
   fInitState       -> Copy (*xsmap.fInitState);
   fInteractionList -> Copy (*xsmap.fInteractionList);
 
+  fChanUseSplines = xsmap.fChanUseSplines;
+  fChanOrder      = xsmap.fChanOrder;
+  fChanEmin       = xsmap.fChanEmin;
+  fChanEmax       = xsmap.fChanEmax;
+
   this->clear();
 
   InteractionGeneratorMap::const_iterator iter;
@@ -104,7 +148,8 @@ void InteractionGeneratorMap::UseGeneratorList(const EventGeneratorList * l)
   fEventGeneratorList = l;
 }
 //___________________________________________________________________________
-void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
+void InteractionGeneratorMap::BuildMap(
+  const InitialState & init_state, InteractionListTemplates * templates)
 {
   SLOG("IntGenMap", pDEBUG)
                << "Building 'interaction' -> 'generator' associations";
@@ -117,6 +162,7 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
   }
 
   fInitState->Copy(init_state);
+  fChanOrder.clear();
 
   EventGeneratorList::const_iterator evgliter; // event generator list iter
   InteractionList::iterator          intliter; // interaction list iter
@@ -133,18 +179,29 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
      SLOG("IntGenMap", pNOTICE)
         << "Querying [" << evgen->Id().Key() << "] for its InteractionList";
 
-     const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
-
-     // no point to go on if the list is NULL - continue to next iteration
-     if(!ilst) continue;
+     // the new interactions are appended to the local list directly
+     // (copied from the cached list of an identical target if available)
+     unsigned int nprev = fInteractionList->size();
+     if(templates) {
+        templates->Append(evgen, init_state, *fInteractionList);
+     } else {
+        const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
+        InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+        if(ilst) {
+          fInteractionList->insert(
+              fInteractionList->end(), ilst->begin(), ilst->end());
+          ilst->clear(); // now owned by the local list
+          delete ilst;
+        }
+     }
 
-     // append the new InteractionList to the local copy
-     fInteractionList->Append(*ilst);
+     // no point to go on if the list is empty - continue to next iteration
+     if(fInteractionList->size() == nprev) continue;
 
      // loop over all interaction that can be genererated by the current
      // EventGenerator and link all of them to iy
-     for(intliter = ilst->begin(); intliter != ilst->end(); ++intliter)
+     for(intliter = fInteractionList->begin() + nprev;
+                  intliter != fInteractionList->end(); ++intliter)
      {
         // current interaction
         Interaction * interaction = *intliter;
@@ -155,8 +212,6 @@ void InteractionGeneratorMap::BuildMap(const InitialState & init_state)
         this->insert(
              map<string, const EventGeneratorI *>::value_type(code,evgen));
      } // loop over interactions
-     delete ilst;
-     ilst = 0;
   } // loop over event generators
 }
 //___________________________________________________________________________
@@ -183,6 +238,82 @@ const InteractionList & InteractionGeneratorMap::GetInteractionList(void) const
   return *fInteractionList;
 }
 //___________________________________________________________________________
+const vector<unsigned int> & InteractionGeneratorMap::ChannelsByThreshold(
+                                                    bool use_splines) const
+{
+  if(fChanOrder.size() != fInteractionList->size() ||
+     fChanUseSplines != use_splines) {
+    this->BuildChannels(use_splines);
+  }
+  return fChanOrder;
+}
+//___________________________________________________________________________
+unsigned int InteractionGeneratorMap::NOpenChannels(
+                                          double E, bool use_splines) const
+{
+  this->ChannelsByThreshold(use_splines);
+  return std::upper_bound(fChanEmin.begin(), fChanEmin.end(), E)
+              - fChanEmin.begin();
+}
+//___________________________________________________________________________
+double InteractionGeneratorMap::ChannelEmax(
+                                   unsigned int i, bool use_splines) const
+{
+  this->ChannelsByThreshold(use_splines);
+  return fChanEmax[i];
+}
+//___________________________________________________________________________
+void InteractionGeneratorMap::BuildChannels(bool use_splines) const
+{
+// Finds the energy window of each interaction of the list: Below the
+// kinematic threshold the cross section models return 0 (and so do the
+// splines, whose knots below threshold are 0). Splines evaluate to 0 outside
+// their range, and no interaction is generated outside the validity context
+// of its generator.
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  unsigned int nint = fInteractionList->size();
+  vector<double> emin(nint, 0.);
+  fChanEmax.assign(nint, 1.E+30);
+  fChanOrder.resize(nint);
+
+  for(unsigned int i = 0; i < nint; i++) {
+    fChanOrder[i] = i;
+    const Interaction * interaction = (*fInteractionList)[i];
+    const EventGeneratorI * evgen = this->FindGenerator(interaction);
+    if(!evgen) continue;
+
+    double lo = evgen->ValidityContext().Emin();
+    double hi = evgen->ValidityContext().Emax();
+    if(HasKinematicThreshold(interaction->ProcInfo())) {
+      lo = TMath::Max(lo, interaction->PhaseSpace().Threshold());
+    }
+    const XSecAlgorithmI * xsec_alg = evgen->CrossSectionAlg();
+    if(use_splines && xsec_alg && xssl->SplineExists(xsec_alg, interaction)) {
+      const Spline * spl = xssl->GetSpline(xsec_alg, interaction);
+      lo = TMath::Max(lo, spl->XMin());
+      hi = TMath::Min(hi, spl->XMax());
+    }
+    emin[i]      = lo;
+    fChanEmax[i] = hi;
+  }
+
+  ChannelEminLess less;
+  less.emin = &emin;
+  std::stable_sort(fChanOrder.begin(), fChanOrder.end(), less);
+
+  fChanEmin.resize(nint);
+  for(unsigned int k = 0; k < nint; k++) fChanEmin[k] = emin[fChanOrder[k]];
+  fChanUseSplines = use_splines;
+
+  LOG("IntGenMap", pINFO)
+    << "Energy windows of the " << nint << " interactions of init state: "
+    << fInitState->AsString() << " - lowest threshold: "
+    << ((nint > 0) ? fChanEmin[0] : 0.) << " GeV, highest: "
+    << ((nint > 0) ? fChanEmin[nint-1] : 0.) << " GeV";
+}
+//___________________________________________________________________________
 void InteractionGeneratorMap::Print(ostream & stream) const
 {
   stream << endl;
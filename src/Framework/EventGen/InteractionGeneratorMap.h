@@ -8,6 +8,16 @@
          the input InitialState object and is being used to locate the generator
          that can generate aany given interaction.
 
+         The map also provides the energy window of each interaction of its
+         list, outside which the interaction has no cross section: From the
+         kinematic threshold (KPhaseSpace::Threshold()) and the validity
+         context of its generator, and from the range of its cross section
+         spline if splines are used. ChannelsByThreshold() orders the list
+         by the lower edge of the windows, so that the interactions open at
+         a given energy are the NOpenChannels() leading entries: The cross
+         section sums and the interaction selection need not evaluate the
+         cross section of (or look up a spline for) any of the others.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -23,12 +33,14 @@
 #define _INTERACTION_GENERATOR_MAP_H_
 
 #include <map>
+#include <vector>
 #include <string>
 #include <ostream>
 
 #include "Framework/Interaction/Interaction.h"
 
 using std::map;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -38,6 +50,7 @@ class InteractionGeneratorMap;
 class EventGeneratorI;
 class InteractionList;
 class InitialState;
+class InteractionListTemplates;
 class EventGeneratorList;
 
 ostream & operator << (ostream & stream, const InteractionGeneratorMap & xsmap);
@@ -50,11 +63,20 @@ public :
   ~InteractionGeneratorMap();
 
   void UseGeneratorList (const EventGeneratorList * list);
-  void BuildMap         (const InitialState & init_state);
+  void BuildMap         (const InitialState & init_state,
+                         InteractionListTemplates * templates = 0);
 
   const EventGeneratorI * FindGenerator      (const Interaction * in) const;
   const InteractionList & GetInteractionList (void) const;
 
+  //! interaction list indices, sorted by the lower edge of the energy window
+  //! of the interactions (use_splines: the windows include the spline ranges)
+  const vector<unsigned int> & ChannelsByThreshold (bool use_splines) const;
+  //! # of leading ChannelsByThreshold() entries whose window opens below E
+  unsigned int NOpenChannels (double E, bool use_splines) const;
+  //! upper edge of the energy window of interaction list entry i
+  double       ChannelEmax   (unsigned int i, bool use_splines) const;
+
   void Reset (void);
   void Copy  (const InteractionGeneratorMap & xsmap);
   void Print (ostream & stream) const;
@@ -64,13 +86,20 @@ public :
 
 private:
 
-  void Init    (void);
-  void CleanUp (void);
+  void Init           (void);
+  void CleanUp        (void);
+  void BuildChannels  (bool use_splines) const;
 
   const EventGeneratorList * fEventGeneratorList;
 
   InitialState *    fInitState;
   InteractionList * fInteractionList;
+
+  // energy windows of the interactions, built on first use
+  mutable bool                 fChanUseSplines; ///< windows include the spline ranges?
+  mutable vector<unsigned int> fChanOrder;      ///< list indices, by increasing window lower edge
+  mutable vector<double>       fChanEmin;       ///< window lower edges, in fChanOrder order
+  mutable vector<double>       fChanEmax;       ///< window upper edges, by list index
 };
 
 }      // genie namespace
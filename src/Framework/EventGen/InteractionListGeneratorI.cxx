@@ -10,11 +10,14 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   Added TargetClass(), used for sharing interaction lists between targets.
 
 */
 //____________________________________________________________________________
 
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/Interaction/Target.h"
 
 using namespace genie;
 
@@ -43,3 +46,18 @@ InteractionListGeneratorI::~InteractionListGeneratorI()
 
 }
 //___________________________________________________________________________
+string InteractionListGeneratorI::TargetClass(const Target & tgt) const
+{
+// The list generators check only whether the target is a free nucleon or a
+// nucleus (light nuclei, A<4, are excluded by some) and whether it contains
+// protons and / or neutrons
+
+  string tgtclass = "";
+  tgtclass += (tgt.Z() > 0)    ? "p" : "-";
+  tgtclass += (tgt.N() > 0)    ? "n" : "-";
+  tgtclass += (tgt.A() > 1)    ? "A" : "-";
+  tgtclass += (tgt.A() >= 4)   ? "4" : "-";
+
+  return tgtclass;
+}
+//___________________________________________________________________________
@@ -28,6 +28,7 @@ namespace genie {
 
 class InteractionList;
 class InitialState;
+class Target;
 
 class InteractionListGeneratorI : public Algorithm {
 
@@ -38,6 +39,12 @@ public :
   virtual InteractionList *
                  CreateInteractionList(const InitialState & init) const = 0;
 
+  //! The class of targets for which the same list is created (up to the
+  //! target pdg code). Used by InteractionListTemplates. The default uses
+  //! only whether the target is a nucleus and has protons / neutrons.
+  //! Return an empty string to always create the list.
+  virtual string TargetClass (const Target & tgt) const;
+
 protected :
 
   InteractionListGeneratorI();
@@ -0,0 +1,92 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <sstream>
+
+#include "Framework/EventGen/EventGeneratorI.h"
+#include "Framework/EventGen/InteractionList.h"
+#include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/InteractionListTemplates.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//___________________________________________________________________________
+InteractionListTemplates::InteractionListTemplates()
+{
+  pthread_mutex_init(&fMutex, 0);
+}
+//___________________________________________________________________________
+InteractionListTemplates::~InteractionListTemplates()
+{
+  map<string, InteractionList *>::iterator it = fTemplates.begin();
+  for( ; it != fTemplates.end(); ++it) {
+    if(it->second) delete it->second;
+  }
+  fTemplates.clear();
+
+  pthread_mutex_destroy(&fMutex);
+}
+//___________________________________________________________________________
+int InteractionListTemplates::Append(
+  const EventGeneratorI * evgen, const InitialState & init_state,
+  InteractionList & list)
+{
+  const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
+
+  string tgtclass = ilstgen->TargetClass(init_state.Tgt());
+
+  // no template for this list generator: create the list as usual
+  if(tgtclass.size() == 0) {
+    InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+    if(!ilst) return 0;
+    int n = ilst->size();
+    list.insert(list.end(), ilst->begin(), ilst->end());
+    ilst->clear();   // the interactions are now owned by list
+    delete ilst;
+    return n;
+  }
+
+  ostringstream key;
+  key << evgen->Id().Key() << ";" << init_state.ProbePdg() << ";" << tgtclass;
+
+  pthread_mutex_lock(&fMutex);
+
+  map<string, InteractionList *>::iterator it = fTemplates.find(key.str());
+  if(it == fTemplates.end()) {
+    LOG("IntLstTmpl", pINFO) << "Creating interaction list template: " << key.str();
+    InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+    it = fTemplates.insert(
+       map<string, InteractionList *>::value_type(key.str(), ilst)).first;
+  }
+  const InteractionList * tmpl = it->second;
+
+  pthread_mutex_unlock(&fMutex);
+
+  // the template is not modified once made, so it can be copied unlocked
+  if(!tmpl) return 0;
+
+  int tgtpdg = init_state.Tgt().Pdg();
+  InteractionList::const_iterator iter = tmpl->begin();
+  for( ; iter != tmpl->end(); ++iter) {
+    Interaction * interaction = new Interaction(**iter);
+    Target * tgt = interaction->InitStatePtr()->TgtPtr();
+    if(tgt->Pdg() != tgtpdg) tgt->SetId(tgtpdg);
+    list.push_back(interaction);
+  }
+  return tmpl->size();
+}
+//___________________________________________________________________________
@@ -0,0 +1,67 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::InteractionListTemplates
+
+\brief    A cache of the InteractionLists created by the event generators
+          for each class of initial states, used when configuring drivers
+          for many initial states (eg for geometries with many isotopes).
+
+          The interactions an event generator can simulate depend on the
+          target only through its class (see
+          InteractionListGeneratorI::TargetClass()). The list is created
+          once per (event generator, probe, target class) and the lists
+          for other targets of the same class are copies of this template
+          with the target changed. List generators for which this does not
+          hold opt out by returning an empty TargetClass().
+          Can be shared by concurrent threads.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _INTERACTION_LIST_TEMPLATES_H_
+#define _INTERACTION_LIST_TEMPLATES_H_
+
+#include <map>
+#include <string>
+#include <pthread.h>
+
+using std::map;
+using std::string;
+
+namespace genie {
+
+class EventGeneratorI;
+class InteractionList;
+class InitialState;
+
+class InteractionListTemplates {
+
+public :
+  InteractionListTemplates();
+ ~InteractionListTemplates();
+
+  //! Append to list the interactions the input event generator can simulate
+  //! for the input initial state. Returns the number of appended interactions.
+  int Append (const EventGeneratorI * evgen,
+              const InitialState & init_state, InteractionList & list);
+
+  int NTemplates (void) const { return fTemplates.size(); }
+
+private:
+
+  map<string, InteractionList *> fTemplates; ///< (generator/probe/target class) -> list (may be null)
+  pthread_mutex_t                fMutex;
+};
+
+}      // genie namespace
+
+#endif // _INTERACTION_LIST_TEMPLATES_H_
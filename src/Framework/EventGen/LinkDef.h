@@ -14,6 +14,7 @@
 #pragma link C++ class genie::EventGeneratorList;
 #pragma link C++ class genie::EventGeneratorListAssembler;
 #pragma link C++ class genie::RunningThreadInfo;
+#pragma link C++ class genie::EventRecordPool;
 #pragma link C++ class genie::InteractionSelectorI;
 #pragma link C++ class genie::ToyInteractionSelector;
 #pragma link C++ class genie::PhysInteractionSelector;
@@ -28,10 +29,15 @@
 #pragma link C++ class genie::GEVGPool;
 #pragma link C++ class genie::PathLengthList;
 #pragma link C++ class genie::GFluxI;
+#pragma link C++ class genie::FluxBatch;
 #pragma link C++ class genie::GeomAnalyzerI;
 #pragma link C++ class genie::GMCJMonitor;
+#pragma link C++ class genie::GMCJArtifactStore;
+#pragma link C++ class genie::GMCJCheckpoint;
+#pragma link C++ class genie::GMCJPlanner;
 
 #pragma link C++ class genie::XSecAlgorithmI;
+#pragma link C++ class genie::XSecReweighter;
 
 
 #endif
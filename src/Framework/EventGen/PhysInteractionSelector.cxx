@@ -17,6 +17,20 @@
    itself doesn't and its hard to diagnose problems from its actuall err mesg.
  @ Jun 23, 2008 - CA
    Protect against round off err / negative xsec
+ @ Oct 14, 2026 - CA
+   Added the UseCumXSecTable mode, selecting interactions from precomputed
+   tables of cumulative cross sections. Moved the cross section evaluation
+   to ComputeXSec().
+ @ Oct 14, 2026 - CA
+   Added the cross section biasing of the interaction selection (XSecBias
+   or --xsec-bias), with the corresponding event weights.
+ @ Oct 14, 2026 - CA
+   Compute the cross sections on a reused scratch interaction, and copy the
+   selected interaction into the summary kept by the recycled event record:
+   The selection no longer allocates Interaction objects.
+@ Oct 14, 2026 - CA
+  Only compute the cross sections of the interactions whose energy window
+  (threshold, validity context, spline range) contains the probe energy.
 */
 //____________________________________________________________________________
 
@@ -32,6 +46,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/PhysInteractionSelector.h"
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/EventRecordPool.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionList.h"
 #include "Framework/EventGen/InteractionGeneratorMap.h"
@@ -40,8 +55,11 @@
 #include "Framework/Numerical/Spline.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
 
 using std::vector;
+using std::map;
 using std::endl;
 using std::setw;
 using std::setprecision;
@@ -54,18 +72,25 @@ using namespace genie;
 PhysInteractionSelector::PhysInteractionSelector() :
 InteractionSelectorI("genie::PhysInteractionSelector")
 {
-
+  fUseSplines       = false;
+  fUseCumXSecTable  = false;
+  fCumXSecTableNE   = 0;
+  fScratchInteraction = 0;
 }
 //___________________________________________________________________________
 PhysInteractionSelector::PhysInteractionSelector(string config) :
 InteractionSelectorI("genie::PhysInteractionSelector", config)
 {
-
+  fUseSplines       = false;
+  fUseCumXSecTable  = false;
+  fCumXSecTableNE   = 0;
+  fScratchInteraction = 0;
 }
 //___________________________________________________________________________
 PhysInteractionSelector::~PhysInteractionSelector()
 {
-
+  this->ClearCumXSecTables();
+  if(fScratchInteraction) delete fScratchInteraction;
 }
 //___________________________________________________________________________
 EventRecord * PhysInteractionSelector::SelectInteraction
@@ -82,13 +107,23 @@ EventRecord * PhysInteractionSelector::SelectInteraction
      return 0;
   }
 
-  // Get the list of spline objects
-  // Should have been constructed at the job initialization
-  XSecSplineList * xssl = 0;
-  if (fUseSplines) xssl = XSecSplineList::Instance();
+  if(fUseCumXSecTable) {
+     EventRecord * evrec = this->SelectFromCumXSecTable(igmap, p4);
+     if(evrec) return evrec;
+  }
 
   const InteractionList & ilst = igmap->GetInteractionList();
-  vector<double> xseclist(ilst.size());
+  vector<double> xseclist(ilst.size(), 0.);
+
+  // only the interactions whose energy window contains E can have a non-zero
+  // cross section: the leading entries of the threshold-ordered list
+  const vector<unsigned int> & channels = igmap->ChannelsByThreshold(fUseSplines);
+  unsigned int nopen = igmap->NOpenChannels(p4.E(), fUseSplines);
+
+  // bias factors of the interactions: xsecs are multiplied by them here
+  const vector<double> * bias =
+         (fXSecBias.size() > 0) ? &(this->BiasFactors(igmap)) : 0;
+  double xsec_sum_unbiased = 0;
 
   string istate = ilst[0]->InitState().AsString();
   ostringstream msg;
@@ -98,10 +133,8 @@ EventRecord * PhysInteractionSelector::SelectInteraction
   LOG("IntSel", pNOTICE)
              << utils::print::PrintFramedMesg(msg.str(), 0, '=');
   LOG("IntSel", pNOTICE)
-     << "Computing xsecs for all relevant modeled interactions:";
-
-  unsigned int i=0;
-  InteractionList::const_iterator intliter = ilst.begin(); 
+     << "Computing xsecs for the " << nopen << " (out of " << ilst.size()
+     << ") modeled interactions above threshold:";
 
   ostringstream xsec_table_printout;
 
@@ -111,56 +144,36 @@ EventRecord * PhysInteractionSelector::SelectInteraction
       << " | cross-section (1E-38*cm^2) |" << endl
       << " |"  << setfill('-') << setw(112) << "|" << endl;
 
-  for( ; intliter != ilst.end(); ++intliter) {
+  if(!fScratchInteraction) fScratchInteraction = new Interaction;
+  Interaction * interaction = fScratchInteraction;
+
+  for(unsigned int k = 0; k < nopen; k++) {
+
+     unsigned int i = channels[k];
+     if(p4.E() > igmap->ChannelEmax(i, fUseSplines)) continue;
 
-     Interaction * interaction = new Interaction(**intliter);
+     interaction->Reset(*ilst[i]);
      interaction->InitStatePtr()->SetProbeP4(p4);
 
      SLOG("IntSel", pDEBUG)
            << "Computing xsec for: \n  " << interaction->AsString();
 
      // get the cross section for this interaction
-     const XSecAlgorithmI * xsec_alg =
-               igmap->FindGenerator(interaction)->CrossSectionAlg();
-     assert(xsec_alg);
-
-     double xsec = 0; // cross section for this interaction
-
-     bool spline_computed = xssl->SplineExists(xsec_alg, interaction);
-     bool eval = fUseSplines && spline_computed;
-     if (eval) {
-           const InitialState & init = interaction->InitState();
-           const ProcessInfo & proc  = interaction->ProcInfo();
-           // choose ref frame ('Lab' or 'Hit nucleon rest frame')
-           RefFrame_t frame = 
-              (proc.IsCoherent() || proc.IsElectronScattering()) ? 
-              kRfLab : kRfHitNucRest;
-           double E = init.ProbeE(frame);
-           if(TMath::IsNaN(E)) {
-    		 BLOG("IntSel", pFATAL) << *interaction;
-    		 BLOG("IntSel", pFATAL) << "E = " << E;
-		 abort();
-	   }
-           const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
-           if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
-           else xsec = spl->Evaluate(E);
-     } else {
-           xsec = xsec_alg->Integral(interaction);
-     }
-     TMath::Max(0., xsec);
+     double xsec = this->ComputeXSec(igmap, interaction);
 /*
      LOG("IntSel", pNOTICE)
        << interaction->AsString() 
-       << " --> xsec " << (eval ? "[**interp**]" : "[**calc**]") 
-       << " = " << xsec/genie::units::cm2 << " cm^2";
+       << " --> xsec = " << xsec/genie::units::cm2 << " cm^2";
 */
      xsec_table_printout 
            << " | " << setfill(' ') << setw(80) << interaction->AsString()
            << " | " << setfill(' ') << setw(26) << xsec/(1E-38*genie::units::cm2)
            << " | " << endl;
 
-     xseclist[i++] = xsec;
-     delete interaction;
+     xsec_sum_unbiased += xsec;
+     if(bias) xsec *= (*bias)[i];
+
+     xseclist[i] = xsec;
 
   } // loop over interaction that can be generated
 
@@ -194,7 +207,10 @@ EventRecord * PhysInteractionSelector::SelectInteraction
                << "Sum{xsec}(0->" << iint <<") = " << xseclist[iint];
 
      if( R < xseclist[iint] ) {
-       Interaction * selected_interaction = new Interaction (*ilst[iint]);
+       // bootstrap the event record
+       EventRecord * evrec = EventRecordPool::Instance()->Get();
+       evrec->AttachSummaryCopy(*ilst[iint]);
+       Interaction * selected_interaction = evrec->Summary();
        selected_interaction->InitStatePtr()->SetProbeP4(p4);
 
        // set the cross section for the selected interaction (just extract it
@@ -206,9 +222,15 @@ EventRecord * PhysInteractionSelector::SelectInteraction
        LOG("IntSel", pNOTICE)
          << "Selected interaction: " << selected_interaction->AsString();
 
-       // bootstrap the event record
-       EventRecord * evrec = new EventRecord;
-       evrec->AttachSummary(selected_interaction);
+       // undo the biasing: unbiased xsec, and weight by the ratio of the
+       // unbiased to the biased selection probability
+       if(bias) {
+         double b = (*bias)[iint];
+         xsec /= b;
+         double wght = xsec_sum / (b * xsec_sum_unbiased);
+         LOG("IntSel", pINFO) << "Process biasing weight = " << wght;
+         evrec->SetWeight(wght * evrec->Weight());
+       }
        evrec->SetXSec(xsec);
 
        return evrec;
@@ -237,5 +259,300 @@ void PhysInteractionSelector::LoadConfigData(void)
   fUseSplines = false ;
   GetParam( "UseStoredXSecs", fUseSplines ) ;
 
+  // select interactions from precomputed cumulative xsec tables (splines only)
+  GetParamDef( "UseCumXSecTable",    fUseCumXSecTable, false ) ;
+  GetParamDef( "CumXSecTableNKnots", fCumXSecTableNE,  200   ) ;
+  fCumXSecTableNE = TMath::Max(2, fCumXSecTableNE);
+
+  // process biasing (the command-line option takes precedence)
+  string bias = "";
+  GetParamDef( "XSecBias", bias, string("") ) ;
+  if(RunOpt::Instance()->XSecBias().size() > 0) {
+    bias = RunOpt::Instance()->XSecBias();
+  }
+  this->LoadXSecBias(bias);
+
+  this->ClearCumXSecTables();
+}
+//___________________________________________________________________________
+void PhysInteractionSelector::LoadXSecBias(string spec)
+{
+// Parses a bias specification: a comma-separated list of <selector>:<factor>
+// (see the class documentation). The factor follows the last ':', as
+// selectors may contain ':' themselves.
+
+  fXSecBias.clear();
+  fBiasFactors.clear();
+
+  vector<string> entries = utils::str::Split(spec, ",");
+  for(unsigned int ie = 0; ie < entries.size(); ie++) {
+    string entry = utils::str::TrimSpaces(entries[ie]);
+    if(entry.size() == 0) continue;
+    string::size_type ipos = entry.rfind(':');
+    double factor = -1;
+    if(ipos != string::npos && ipos > 0) {
+      factor = atof(entry.substr(ipos+1).c_str());
+    }
+    if(factor < 0 || ipos == string::npos || ipos == 0) {
+      LOG("IntSel", pFATAL)
+        << "Invalid cross section bias: " << entry
+        << " (expected <selector>:<factor>, with factor >= 0)";
+      gAbortingInErr = true;
+      exit(1);
+    }
+    string selector = entry.substr(0, ipos);
+    fXSecBias.push_back(pair<string,double>(selector, factor));
+    LOG("IntSel", pNOTICE)
+      << "Biasing the selection of " << selector << " interactions by x" << factor;
+  }
+}
+//___________________________________________________________________________
+const vector<double> & PhysInteractionSelector::BiasFactors(
+                              const InteractionGeneratorMap * igmap) const
+{
+// The bias factor of each interaction in the list of the input map, found
+// once per initial state
+
+  const InteractionList & ilst = igmap->GetInteractionList();
+  string istate = ilst[0]->InitState().AsString();
+
+  map<string, vector<double> >::iterator it = fBiasFactors.find(istate);
+  if(it != fBiasFactors.end() && it->second.size() == ilst.size()) {
+    return it->second;
+  }
+
+  vector<double> & bias = fBiasFactors[istate];
+  bias.assign(ilst.size(), 1.);
+  for(unsigned int iint = 0; iint < ilst.size(); iint++) {
+    const Interaction * interaction = ilst[iint];
+    string scattype = interaction->ProcInfo().ScatteringTypeAsString();
+    string intstr   = interaction->AsString();
+    for(unsigned int ib = 0; ib < fXSecBias.size(); ib++) {
+      const string & selector = fXSecBias[ib].first;
+      bool match = (selector.find(':') == string::npos) ?
+           (selector == scattype) : (intstr.find(selector) != string::npos);
+      if(!match) continue;
+      bias[iint] = fXSecBias[ib].second;
+      LOG("IntSel", pINFO)
+        << "Bias factor for " << intstr << ": " << bias[iint];
+      break;
+    }
+  }
+  return bias;
+}
+//___________________________________________________________________________
+double PhysInteractionSelector::ComputeXSec(
+   const InteractionGeneratorMap * igmap, const Interaction * interaction) const
+{
+// The cross section for the input interaction (with the probe 4-momentum set),
+// evaluated from the spline if available and UseStoredXSecs is set
+
+  const XSecAlgorithmI * xsec_alg =
+             igmap->FindGenerator(interaction)->CrossSectionAlg();
+  assert(xsec_alg);
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  double xsec = 0; // cross section for this interaction
+
+  bool eval = fUseSplines && xssl->SplineExists(xsec_alg, interaction);
+  if (eval) {
+     const InitialState & init = interaction->InitState();
+     const ProcessInfo & proc  = interaction->ProcInfo();
+     // choose ref frame ('Lab' or 'Hit nucleon rest frame')
+     RefFrame_t frame =
+        (proc.IsCoherent() || proc.IsElectronScattering()) ?
+        kRfLab : kRfHitNucRest;
+     double E = init.ProbeE(frame);
+     if(TMath::IsNaN(E)) {
+        BLOG("IntSel", pFATAL) << *interaction;
+        BLOG("IntSel", pFATAL) << "E = " << E;
+        abort();
+     }
+     const Spline * spl = xssl->GetSpline(xsec_alg,interaction);
+     if(spl->ClosestKnotValueIsZero(E,"-")) xsec = 0;
+     else xsec = spl->Evaluate(E);
+  } else {
+     xsec = xsec_alg->Integral(interaction);
+  }
+  return TMath::Max(0., xsec);
+}
+//___________________________________________________________________________
+void PhysInteractionSelector::ClearCumXSecTables(void)
+{
+  map<string, CumXSecTable_t *>::iterator it = fCumXSecTables.begin();
+  for( ; it != fCumXSecTables.end(); ++it) {
+    if(it->second) delete it->second;
+  }
+  fCumXSecTables.clear();
+}
+//___________________________________________________________________________
+const PhysInteractionSelector::CumXSecTable_t *
+  PhysInteractionSelector::CumXSecTable(const InteractionGeneratorMap * igmap) const
+{
+// Get the cumulative xsec table for the interaction list of the input map,
+// building it on first use. Returns null if a table can not be built (the
+// cross sections of some interactions are not available as splines).
+
+  const InteractionList & ilst = igmap->GetInteractionList();
+  string istate = ilst[0]->InitState().AsString();
+
+  map<string, CumXSecTable_t *>::iterator it = fCumXSecTables.find(istate);
+  if(it != fCumXSecTables.end()) {
+    if(!it->second || it->second->fNInt == ilst.size()) return it->second;
+    // a different interaction list for this init state: rebuild the table
+    delete it->second;
+    fCumXSecTables.erase(it);
+  }
+
+  XSecSplineList * xssl = XSecSplineList::Instance();
+
+  // energy range covered by the splines of all interactions
+  double emin = 0.;
+  double emax = 0.;
+  bool   ok   = fUseSplines;
+  InteractionList::const_iterator intliter = ilst.begin();
+  for( ; ok && intliter != ilst.end(); ++intliter) {
+     const Interaction * interaction = *intliter;
+     const XSecAlgorithmI * xsec_alg =
+             igmap->FindGenerator(interaction)->CrossSectionAlg();
+     if(!xssl->SplineExists(xsec_alg, interaction)) { ok = false; break; }
+     const Spline * spl = xssl->GetSpline(xsec_alg, interaction);
+     if(intliter == ilst.begin()) {
+       emin = spl->XMin();
+       emax = spl->XMax();
+     } else {
+       emin = TMath::Max(emin, spl->XMin());
+       emax = TMath::Min(emax, spl->XMax());
+     }
+  }
+  emin = TMath::Max(emin, 1E-3);
+  if(!ok || emax <= emin) {
+     LOG("IntSel", pWARN)
+       << "Can not build a cumulative xsec table for init state: " << istate
+       << " - Will compute the cross sections of all interactions per event";
+     fCumXSecTables.insert(
+        map<string, CumXSecTable_t *>::value_type(istate, (CumXSecTable_t*)0));
+     return 0;
+  }
+
+  LOG("IntSel", pNOTICE)
+     << "Building a cumulative xsec table for init state: " << istate
+     << " (" << ilst.size() << " interactions, " << fCumXSecTableNE
+     << " energies in [" << emin << ", " << emax << "] GeV)";
+
+  CumXSecTable_t * table = new CumXSecTable_t;
+  table->fNInt    = ilst.size();
+  table->fNE      = fCumXSecTableNE;
+  table->fLogEmin = TMath::Log10(emin);
+  table->fDLogE   = (TMath::Log10(emax) - table->fLogEmin) / (table->fNE - 1);
+  table->fCumXSec.resize(table->fNE * table->fNInt);
+
+  // tabulate the biased cross sections, if biasing
+  const vector<double> * bias =
+         (fXSecBias.size() > 0) ? &(this->BiasFactors(igmap)) : 0;
+  if(bias) table->fBiasNorm.resize(table->fNE, 1.);
+
+  if(!fScratchInteraction) fScratchInteraction = new Interaction;
+
+  for(unsigned int ie = 0; ie < table->fNE; ie++) {
+     double E = TMath::Power(10., table->fLogEmin + ie * table->fDLogE);
+     if(ie == table->fNE - 1) E = emax;
+     TLorentzVector p4(0., 0., E, E);
+
+     double * row = &table->fCumXSec[ie * table->fNInt];
+     double xsec_sum = 0.;
+     double xsec_sum_unbiased = 0.;
+     for(unsigned int iint = 0; iint < table->fNInt; iint++) {
+        Interaction & interaction = *fScratchInteraction;
+        interaction.Reset(*ilst[iint]);
+        interaction.InitStatePtr()->SetProbeP4(p4);
+        double xsec = this->ComputeXSec(igmap, &interaction);
+        xsec_sum_unbiased += xsec;
+        xsec_sum += (bias) ? (*bias)[iint] * xsec : xsec;
+        row[iint] = xsec_sum;
+     }
+     if(bias && xsec_sum_unbiased > 0.) {
+        table->fBiasNorm[ie] = xsec_sum / xsec_sum_unbiased;
+     }
+     for(unsigned int iint = 0; iint < table->fNInt; iint++) {
+        row[iint] = (xsec_sum > 0.) ? row[iint] / xsec_sum : -1.;
+     }
+     if(xsec_sum > 0.) row[table->fNInt - 1] = 1.;
+  }
+
+  fCumXSecTables.insert(
+       map<string, CumXSecTable_t *>::value_type(istate, table));
+  return table;
+}
+//___________________________________________________________________________
+EventRecord * PhysInteractionSelector::SelectFromCumXSecTable
+     (const InteractionGeneratorMap * igmap, const TLorentzVector & p4) const
+{
+// Select an interaction using the cumulative xsec table. Returns null if the
+// interaction can not be selected this way, so that the cross sections of
+// all interactions are computed instead.
+
+  const CumXSecTable_t * table = this->CumXSecTable(igmap);
+  if(!table) return 0;
+
+  double E = p4.E();
+  if(E <= 0.) return 0;
+
+  double x = (TMath::Log10(E) - table->fLogEmin) / table->fDLogE;
+  if(x < 0. || x > table->fNE - 1) return 0;
+
+  unsigned int ie = TMath::Min((unsigned int) x, table->fNE - 2);
+  double f = x - ie;
+
+  const double * row0 = &table->fCumXSec[ ie    * table->fNInt];
+  const double * row1 = &table->fCumXSec[(ie+1) * table->fNInt];
+  if(row0[0] < 0. || row1[0] < 0.) return 0;
+
+  RandomGen * rnd = RandomGen::Instance();
+  double R = rnd->RndISel().Rndm();
+
+  // first interaction whose interpolated cumulative xsec exceeds R
+  unsigned int lo = 0;
+  unsigned int hi = table->fNInt - 1;
+  while(lo < hi) {
+     unsigned int mid = (lo + hi) / 2;
+     double cum = (1.-f) * row0[mid] + f * row1[mid];
+     if(R < cum) hi = mid;
+     else        lo = mid + 1;
+  }
+
+  const InteractionList & ilst = igmap->GetInteractionList();
+  if(!fScratchInteraction) fScratchInteraction = new Interaction;
+  Interaction * selected_interaction = fScratchInteraction;
+  selected_interaction->Reset(*ilst[lo]);
+  selected_interaction->InitStatePtr()->SetProbeP4(p4);
+
+  double xsec = this->ComputeXSec(igmap, selected_interaction);
+  if(xsec <= 0.) {
+     // eg just below threshold, within the grid cell
+     LOG("IntSel", pINFO)
+       << "Interaction selected from the xsec table has no xsec at E = "
+       << E << " GeV - Computing the cross sections of all interactions";
+     return 0;
+  }
+
+  LOG("IntSel", pNOTICE)
+     << "Selected interaction: " << selected_interaction->AsString();
+
+  // bootstrap the event record
+  EventRecord * evrec = EventRecordPool::Instance()->Get();
+  evrec->AttachSummaryCopy(*selected_interaction);
+  evrec->SetXSec(xsec);
+
+  // weight by the ratio of the unbiased to the biased selection probability
+  if(table->fBiasNorm.size() > 0) {
+     double norm = (1.-f) * table->fBiasNorm[ie] + f * table->fBiasNorm[ie+1];
+     double wght = norm / this->BiasFactors(igmap)[lo];
+     LOG("IntSel", pINFO) << "Process biasing weight = " << wght;
+     evrec->SetWeight(wght * evrec->Weight());
+  }
+
+  return evrec;
 }
 //___________________________________________________________________________
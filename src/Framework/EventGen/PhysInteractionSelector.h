@@ -7,6 +7,35 @@
 
          Is a concrete implementation of the InteractionSelectorI interface.
 
+         The cross sections are only computed for the interactions whose
+         energy window (see InteractionGeneratorMap::ChannelsByThreshold())
+         contains the probe energy; all others are given a zero cross section
+         without evaluation.
+
+         With UseCumXSecTable, the cumulative cross sections of the
+         interaction list of each initial state (normalized to the total)
+         are tabulated once, from the splines, on a log-energy grid. An
+         interaction is then selected by interpolating between the two
+         rows bracketing the event energy and a binary search, and only the
+         selected interaction's cross section is evaluated. Events outside
+         the tabulated range, or for which the selected interaction has no
+         cross section at the event energy (near thresholds), are handled
+         by evaluating the cross sections of all interactions.
+
+         Rare processes can be generated with biased probabilities: With a
+         bias specification (the XSecBias configuration parameter, or the
+         --xsec-bias command-line option which takes precedence), given as a
+         comma-separated list of <selector>:<factor> entries, the cross
+         section of each interaction matching a selector is multiplied by
+         the factor for the selection. A selector without a ':' is a
+         scattering type (eg COH, 1Kaon, GLR), otherwise it matches the
+         interactions whose Interaction::AsString() contains it (eg
+         proc:Weak[CC],COH or N:2212). The first matching entry applies. The event weight is multiplied by
+         sum{b*xsec} / (b_selected * sum{xsec}), so that the weighted events
+         reproduce the unbiased process mix. The total cross section, hence
+         the interaction probabilities and the exposure of the drivers, are
+         not changed.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,10 +50,22 @@
 #ifndef _PHYS_INTERACTION_SELECTOR_H_
 #define _PHYS_INTERACTION_SELECTOR_H_
 
+#include <map>
+#include <vector>
+#include <string>
+#include <utility>
+
 #include "Framework/EventGen/InteractionSelectorI.h"
 
+using std::map;
+using std::vector;
+using std::string;
+using std::pair;
+
 namespace genie {
 
+class Interaction;
+
 class PhysInteractionSelector : public InteractionSelectorI {
 
 public :
@@ -42,9 +83,36 @@ public :
   void Configure (string param_set);
 
 private:
-  void LoadConfigData (void);
+
+  // cumulative cross section table of the interaction list of an initial state
+  struct CumXSecTable_t {
+    unsigned int   fNInt;    ///< # of interactions
+    unsigned int   fNE;      ///< # of energy grid points
+    double         fLogEmin; ///< log10(Emin)
+    double         fDLogE;   ///< grid step in log10(E)
+    vector<double> fCumXSec; ///< normalized cumulative xsecs, [ie*fNInt+iint]; <0 if total xsec is 0
+    vector<double> fBiasNorm; ///< sum{b*xsec}/sum{xsec} per energy (if biased)
+  };
+
+  void   LoadConfigData     (void);
+  double ComputeXSec        (const InteractionGeneratorMap * igmap,
+                             const Interaction * interaction) const;
+  void   ClearCumXSecTables (void);
+  void   LoadXSecBias       (string spec);
+  const vector<double> & BiasFactors (const InteractionGeneratorMap * igmap) const;
+  const CumXSecTable_t * CumXSecTable (const InteractionGeneratorMap * igmap) const;
+  EventRecord * SelectFromCumXSecTable
+     (const InteractionGeneratorMap * igmap, const TLorentzVector & p4) const;
 
   bool fUseSplines;
+  bool fUseCumXSecTable;   ///< select using precomputed cumulative xsec tables?
+  int  fCumXSecTableNE;    ///< # of energy grid points of the tables
+
+  vector< pair<string,double> > fXSecBias; ///< (selector, bias factor) list; no biasing if empty
+
+  mutable map<string, CumXSecTable_t *> fCumXSecTables; ///< init state -> table (null if n/a)
+  mutable map<string, vector<double> >  fBiasFactors;   ///< init state -> bias factor per interaction
+  mutable Interaction * fScratchInteraction; ///< reset to each interaction list entry to compute its xsec
 };
 
 }      // genie namespace
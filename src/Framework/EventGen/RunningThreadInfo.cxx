@@ -26,6 +26,9 @@ RunningThreadInfo * RunningThreadInfo::fInstance = 0;
 RunningThreadInfo::RunningThreadInfo()
 {
   fInstance =  0;
+
+  fThreadStatusOn  = false;
+  fHasThreadStatus = false;
 }
 //____________________________________________________________________________
 RunningThreadInfo::~RunningThreadInfo()
@@ -43,3 +46,29 @@ RunningThreadInfo * RunningThreadInfo::Instance()
   return fInstance;
 }
 //____________________________________________________________________________
+void RunningThreadInfo::EnableThreadStatus(bool on)
+{
+  fThreadStatusOn  = on;
+  fHasThreadStatus = false;
+}
+//____________________________________________________________________________
+void RunningThreadInfo::SetThreadStatus(
+                        const exceptions::EVGThreadException & status)
+{
+  fThreadStatus    = status;
+  fHasThreadStatus = true;
+}
+//____________________________________________________________________________
+bool RunningThreadInfo::PopThreadStatus(
+                        exceptions::EVGThreadException & status)
+{
+// Retrieves & clears the posted thread status. Returns false if none posted
+
+  if(!fHasThreadStatus) return false;
+
+  status           = fThreadStatus;
+  fHasThreadStatus = false;
+
+  return true;
+}
+//____________________________________________________________________________
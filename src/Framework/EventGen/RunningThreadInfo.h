@@ -23,6 +23,9 @@
 #ifndef _RUNNING_THREAD_INFO_H_
 #define _RUNNING_THREAD_INFO_H_
 
+#include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/GHEP/GHepEventCost.h"
+
 namespace genie {
 
 class EventGeneratorI;
@@ -41,6 +44,18 @@ public:
      fRunningThread = evg; 
   }
 
+  //! exception-free thread control: An event generation module can post
+  //! the status it would otherwise throw (and return) if the running thread
+  //! enabled it. See EventRecordVisitorI::StopThread()
+  void EnableThreadStatus  (bool on);
+  bool ThreadStatusEnabled (void) const { return fThreadStatusOn; }
+  void SetThreadStatus     (const exceptions::EVGThreadException & status);
+  bool PopThreadStatus     (exceptions::EVGThreadException & status);
+
+  //! computing cost counters of the event being generated, incremented by
+  //! the event generation modules (see GHepEventCost)
+  GHepEventCost & EventCost (void) { return fEventCost; }
+
 private:
   RunningThreadInfo();
   RunningThreadInfo(const RunningThreadInfo & info);
@@ -52,6 +67,14 @@ private:
   //! current thread
   const EventGeneratorI * fRunningThread;
 
+  //! posted thread status
+  bool                           fThreadStatusOn;
+  bool                           fHasThreadStatus;
+  exceptions::EVGThreadException fThreadStatus;
+
+  //! cost of the event being generated
+  GHepEventCost fEventCost;
+
   //! clean
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -16,6 +16,7 @@
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/BaryonResList.h"
 
 using namespace genie;
 
@@ -63,4 +64,31 @@ bool XSecAlgorithmI::ValidKinematics(const Interaction* interaction) const
   return true;
 }
 //___________________________________________________________________________
+void XSecAlgorithmI::ResonanceXSecs(
+   const Interaction* interaction, KinePhaseSpace_t kps,
+   const BaryonResList & reslist, vector<double> & xsec) const
+{
+// Sets each resonance in turn and computes the cross section.
+// Resonance production models override this, to compute the factors that are
+// common to all resonances only once.
+
+  Resonance_t res0 = interaction->ExclTag().Resonance();
 
+  unsigned int nres = reslist.NResonances();
+  xsec.assign(nres, 0.);
+  for(unsigned int ires = 0; ires < nres; ires++) {
+    interaction->ExclTagPtr()->SetResonance(reslist.ResonanceId(ires));
+    xsec[ires] = this->XSec(interaction, kps);
+  }
+
+  interaction->ExclTagPtr()->SetResonance(res0);
+}
+//___________________________________________________________________________
+void XSecAlgorithmI::XSecBatch(unsigned int n, const Interaction * const * in,
+                               KinePhaseSpace_t kps, double * xsec) const
+{
+  for(unsigned int i = 0; i < n; i++) {
+    xsec[i] = this->XSec(in[i], kps);
+  }
+}
+//___________________________________________________________________________
@@ -19,12 +19,18 @@
 #ifndef _XSEC_ALGORITHM_I_H_
 #define _XSEC_ALGORITHM_I_H_
 
+#include <vector>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/Interaction/Interaction.h"
 
+using std::vector;
+
 namespace genie {
 
+class BaryonResList;
+
 class XSecAlgorithmI : public Algorithm {
 
 public:
@@ -43,6 +49,24 @@ public:
   //! Is the input kinematical point a physically allowed one?
   virtual bool ValidKinematics (const Interaction* i) const;
 
+  //! Compute the cross section for the input interaction, at the same
+  //! kinematics, for each of the input baryon resonances. The resonance
+  //! of the input interaction is left unchanged.
+  virtual void ResonanceXSecs (const Interaction* i, KinePhaseSpace_t k,
+                               const BaryonResList & reslist,
+                               vector<double> & xsec) const;
+
+  //! Compute the cross section at a batch of n kinematical points, each set
+  //! in its own interaction, so that models can evaluate them at once (eg on
+  //! an accelerator, or sharing the factors that are common to the points).
+  //! The default calls XSec() for each point in turn.
+  virtual void XSecBatch (unsigned int n, const Interaction * const * in,
+                          KinePhaseSpace_t k, double * xsec) const;
+
+  //! Does the model override XSecBatch()? Integrands only set up batches
+  //! for the models that do.
+  virtual bool HasXSecBatch (void) const { return false; }
+
 protected:
   XSecAlgorithmI();
   XSecAlgorithmI(string name);
@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   BuildMap() can copy the interaction lists from InteractionListTemplates
+   and no longer copies the lists created by the list generators.
 
 */
 //____________________________________________________________________________
@@ -20,6 +23,7 @@
 #include "Framework/EventGen/XSecAlgorithmMap.h"
 #include "Framework/EventGen/EventGeneratorI.h"
 #include "Framework/EventGen/InteractionListGeneratorI.h"
+#include "Framework/EventGen/InteractionListTemplates.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 
@@ -98,7 +102,8 @@ void XSecAlgorithmMap::UseGeneratorList(const EventGeneratorList * list)
   fEventGeneratorList = list;
 }
 //___________________________________________________________________________
-void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
+void XSecAlgorithmMap::BuildMap(
+  const InitialState & init_state, InteractionListTemplates * templates)
 {
   LOG("XSecAlgMap", pNOTICE)
                 << "Building 'interaction' -> 'xsec algorithm' associations";
@@ -128,21 +133,32 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
      LOG("XSecAlgMap", pNOTICE)
         << "Querying [" << evgen->Id().Key() << "] for its InteractionList";
 
-     const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
-     InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
-
-     // no point to go on if the list is NULL - continue to next iteration
-     if(!ilst) continue;
-
-     // append the new InteractionList to the local copy
-     fInteractionList->Append(*ilst);
+     // the new interactions are appended to the local list directly
+     // (copied from the cached list of an identical target if available)
+     unsigned int nprev = fInteractionList->size();
+     if(templates) {
+        templates->Append(evgen, init_state, *fInteractionList);
+     } else {
+        const InteractionListGeneratorI * ilstgen = evgen->IntListGenerator();
+        InteractionList * ilst = ilstgen->CreateInteractionList(init_state);
+        if(ilst) {
+          fInteractionList->insert(
+              fInteractionList->end(), ilst->begin(), ilst->end());
+          ilst->clear(); // now owned by the local list
+          delete ilst;
+        }
+     }
+
+     // no point to go on if the list is empty - continue to next iteration
+     if(fInteractionList->size() == nprev) continue;
 
      // cross section algorithm used by this EventGenerator
      const XSecAlgorithmI * xsec_alg = evgen->CrossSectionAlg();
 
      // loop over all interaction that can be genererated by the current
      // EventGenerator and link all of them to the current XSecAlgorithmI
-     for(intliter = ilst->begin(); intliter != ilst->end(); ++intliter)
+     for(intliter = fInteractionList->begin() + nprev;
+                  intliter != fInteractionList->end(); ++intliter)
      {
         // current interaction
         Interaction * interaction = *intliter;
@@ -156,8 +172,6 @@ void XSecAlgorithmMap::BuildMap(const InitialState & init_state)
             map<string, const XSecAlgorithmI *>::value_type(code,xsec_alg));
 
      } // loop over interactions
-     delete ilst;
-     ilst = 0;
   } // loop over event generators
 }
 //___________________________________________________________________________
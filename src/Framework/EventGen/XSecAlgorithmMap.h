@@ -36,6 +36,7 @@ class XSecAlgorithmI;
 class Interaction;
 class InteractionList;
 class InitialState;
+class InteractionListTemplates;
 class EventGeneratorList;
 
 ostream & operator << (ostream & stream, const XSecAlgorithmMap & xsmap);
@@ -49,7 +50,8 @@ public :
   ~XSecAlgorithmMap();
 
   void UseGeneratorList (const EventGeneratorList * list);
-  void BuildMap         (const InitialState & init_state);
+  void BuildMap         (const InitialState & init_state,
+                         InteractionListTemplates * templates = 0);
 
   const XSecAlgorithmI *  FindXSecAlgorithm  (const Interaction * in) const;
   const InteractionList & GetInteractionList (void) const;
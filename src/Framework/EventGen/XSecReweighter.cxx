@@ -0,0 +1,116 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/EventGen/XSecReweighter.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Registry/Registry.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+XSecReweighter::XSecReweighter(const XSecAlgorithmI * nominal) :
+fNominal(nominal),
+fUseStoredNominal(false)
+{
+
+}
+//____________________________________________________________________________
+XSecReweighter::~XSecReweighter()
+{
+  this->ClearEvents();
+  for(unsigned int i = 0; i < fThrows.size(); i++) {
+    delete fThrows[i];
+  }
+  fThrows.clear();
+}
+//____________________________________________________________________________
+int XSecReweighter::AddThrow(const Registry & overrides)
+{
+  Algorithm * alg = AlgFactory::Instance()->AdoptAlgorithm(fNominal->Id());
+  XSecAlgorithmI * xsec_alg = dynamic_cast<XSecAlgorithmI *>(alg);
+  if(!xsec_alg) {
+    LOG("XSecReweighter", pFATAL)
+      << "Could not instantiate the cross section model: " << fNominal->Id();
+    delete alg;
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  // own the sub-algorithms (form factor models, ...), so that the overrides
+  // reach them without touching the shared instances used by the nominal
+  xsec_alg->AdoptSubstructure();
+  xsec_alg->Configure(overrides);
+
+  fThrows.push_back(xsec_alg);
+  return fThrows.size() - 1;
+}
+//____________________________________________________________________________
+bool XSecReweighter::AddEvent(const EventRecord & event)
+{
+  Event_t ev;
+  ev.interaction = 0;
+  ev.kps         = event.DiffXSecVars();
+  ev.xsec        = 0.;
+
+  const Interaction * summary = event.Summary();
+  bool use = (summary != 0 && ev.kps != kPSNull &&
+              fNominal->ValidProcess(summary));
+  if(use) {
+    Interaction * interaction = new Interaction(*summary);
+    interaction->KinePtr()->UseSelectedKinematics();
+    interaction->SetBit(kISkipProcessChk);
+
+    ev.xsec = (fUseStoredNominal) ?
+       event.DiffXSec() : fNominal->XSec(interaction, ev.kps);
+    if(ev.xsec > 0.) {
+      ev.interaction = interaction;
+    } else {
+      delete interaction;
+    }
+  }
+  fEvents.push_back(ev);
+
+  return (ev.interaction != 0);
+}
+//____________________________________________________________________________
+void XSecReweighter::ClearEvents(void)
+{
+  for(unsigned int i = 0; i < fEvents.size(); i++) {
+    delete fEvents[i].interaction;
+  }
+  fEvents.clear();
+}
+//____________________________________________________________________________
+void XSecReweighter::Weights(vector<double> & weights) const
+{
+  int nthrows = fThrows.size();
+  int nevents = fEvents.size();
+  weights.assign(nevents*nthrows, 1.);
+
+  for(int ithrow = 0; ithrow < nthrows; ithrow++) {
+    const XSecAlgorithmI * xsec_alg = fThrows[ithrow];
+    for(int iev = 0; iev < nevents; iev++) {
+      const Event_t & ev = fEvents[iev];
+      if(!ev.interaction) continue;
+      double xsec = xsec_alg->XSec(ev.interaction, ev.kps);
+      weights[iev*nthrows + ithrow] = xsec / ev.xsec;
+    }
+  }
+}
+//____________________________________________________________________________
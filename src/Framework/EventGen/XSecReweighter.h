@@ -0,0 +1,105 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::XSecReweighter
+
+\brief    Batched cross section reweighting of generated events, for many
+          throws of the parameters of a cross section model in one pass.
+
+          Each event already carries the physics inputs of its cross section,
+          as recorded at generation time: the interaction summary with the
+          selected kinematics (x, y, Q2, W, t, ... as set by the kinematics
+          generators) and the hit nucleon 4-momentum, and the differential
+          cross section and the kinematic phase space it was selected with
+          (see GHepRecord::DiffXSec() and DiffXSecVars()). AddEvent() caches
+          them once per event, in an interaction set to the selected
+          kinematics, along with the nominal cross section: the production-
+          time one, or (by default) recomputed once with the nominal model.
+          Weights() then evaluates every parameter throw on the cached
+          interactions, looping over the events for each throw in turn, so
+          that the caches of the model (eg of its form factors) are reused
+          across events, with no event record or kinematics rebuilt.
+
+          A parameter throw is an instance of the nominal model, owning its
+          sub-algorithms, configured with a registry of parameter overrides
+          (as in Algorithm::Configure(const Registry &)).
+
+          Typical use:
+
+            XSecReweighter rw(nominal_xsec_alg);
+            for(...) rw.AddThrow(overrides);
+            for(each event) rw.AddEvent(*event);
+            vector<double> weights;
+            rw.Weights(weights); // weight of event i, throw j: [i*NThrows()+j]
+
+          Events the nominal model does not handle, or with no recorded
+          differential cross section, get unit weights.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _XSEC_REWEIGHTER_H_
+#define _XSEC_REWEIGHTER_H_
+
+#include <vector>
+
+#include "Framework/Conventions/KinePhaseSpace.h"
+
+using std::vector;
+
+namespace genie {
+
+class EventRecord;
+class Interaction;
+class Registry;
+class XSecAlgorithmI;
+
+class XSecReweighter {
+
+public :
+  XSecReweighter(const XSecAlgorithmI * nominal);
+ ~XSecReweighter();
+
+  //! use the production-time cross section of the events as the nominal
+  //! one, rather than recomputing it (the events must have been generated
+  //! with the nominal model)
+  void   UseStoredNominal (bool on = true) { fUseStoredNominal = on; }
+
+  //! add a parameter throw; returns its index
+  int    AddThrow    (const Registry & overrides);
+  int    NThrows     (void) const { return fThrows.size(); }
+
+  //! cache the physics inputs of an event; false if it is not reweighted
+  //! (it then gets unit weights)
+  bool   AddEvent    (const EventRecord & event);
+  int    NEvents     (void) const { return fEvents.size(); }
+  void   ClearEvents (void);
+
+  //! weights of all cached events for all throws:
+  //! weights[ievent*NThrows() + ithrow] = xsec(throw) / xsec(nominal)
+  void   Weights     (vector<double> & weights) const;
+
+private:
+
+  struct Event_t {
+    Interaction *    interaction; ///< summary at the selected kinematics, 0 if not reweighted
+    KinePhaseSpace_t kps;         ///< phase space of the differential xsec
+    double           xsec;        ///< nominal differential xsec
+  };
+
+  const XSecAlgorithmI *   fNominal;
+  vector<XSecAlgorithmI *> fThrows;
+  vector<Event_t>          fEvents;
+  bool                     fUseStoredNominal;
+};
+
+}       // genie namespace
+#endif  // _XSEC_REWEIGHTER_H_
@@ -0,0 +1,61 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GHepEventCost
+
+\brief    The computing cost of generating an event: the cpu time spent in
+          the event generation modules and the number of times the costliest
+          loops (kinematics selection, hadron transport, hadronization) went
+          round.
+
+          The counters of the event being generated are kept in the
+          RunningThreadInfo, where the modules increment them. EventGenerator
+          resets them at the start of each event and copies them into the
+          event record (see GHepRecord::Cost()) at the end. NtpWriter can
+          write them in a side branch of the event tree (gcost, see the
+          --output-event-cost option).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _GHEP_EVENT_COST_H_
+#define _GHEP_EVENT_COST_H_
+
+#include <Rtypes.h>
+
+namespace genie {
+
+class GHepEventCost {
+
+public :
+  GHepEventCost() { this->Reset(); }
+
+  void Reset(void) {
+    cpu_ns       = 0;
+    kine_trials  = 0;
+    inuke_steps  = 0;
+    inuke_retries = 0;
+    had_retries  = 0;
+    module_stops = 0;
+  }
+
+  // Like the other flat ntuple records, a C-struct with public data members
+  // not prefaced by "f" and mostly lowercase.
+  Long64_t cpu_ns;       ///< cpu time spent in the event generation modules (ns)
+  Int_t    kine_trials;  ///< trials in the kinematics selection (rejection) loops
+  Int_t    inuke_steps;  ///< hadron transport steps in the nucleus
+  Int_t    inuke_retries; ///< hadron interactions in the nucleus that were rejected and simulated again
+  Int_t    had_retries;  ///< hadronic systems that were rejected and generated again
+  Int_t    module_stops; ///< event generation modules that stopped the thread (and were run again)
+};
+
+}      // genie namespace
+#endif // _GHEP_EVENT_COST_H_
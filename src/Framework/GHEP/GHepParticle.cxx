@@ -22,6 +22,16 @@
    Adding special ctor for ROOT I/O purposes so as to avoid memory leak due to
    memory allocated in the default ctor when objects of this class are read by 
    the ROOT Streamer. 
+ @ Oct 14, 2026 - CA
+   Serve the particle name, mass and charge from the PDGLibrary property
+   table, caching the dense particle id, rather than through TDatabasePDG
+   lookups at every call.
+ @ Oct 14, 2026 - CA
+   Added a custom streamer (class version 4) with an optional compact
+   on-disk form of the particle, see SetCompactIO().
+ @ Oct 14, 2026 - CA
+   Added a generation counter of the pdg and status codes of all particles,
+   see CodesGeneration(), used by the GHepRecord particle index.
 
 */
 //____________________________________________________________________________
@@ -31,6 +41,7 @@
 #include <iomanip>
 
 #include <TMath.h>
+#include <TBuffer.h>
 #include <TRootIOCtor.h>
 
 #include "Framework/Conventions/GBuild.h"
@@ -56,6 +67,15 @@ const double kOffShellDm = 0.002; // 2 MeV
 
 ClassImp(GHepParticle)
 
+bool GHepParticle::fCompactIO = false;
+unsigned int GHepParticle::fCodesGeneration = 1;
+
+// bits of the packed status word of the compact form
+static const int kCmpStatusMask  = 0xff;   // status, 8 bits
+static const int kCmpBoundBit    = 1 << 8; // bound particle
+static const int kCmpPolzBit     = 1 << 9; // polarization set
+static const int kCmpRescatShift = 16;     // rescattering code, 16 bits
+
 //____________________________________________________________________________
 namespace genie {
  ostream & operator<< (ostream& stream, const GHepParticle & particle)
@@ -76,6 +96,7 @@ GHepParticle::GHepParticle(int pdg, GHepStatus_t status,
         int mother1, int mother2, int daughter1, int daughter2,
         const TLorentzVector & p, const TLorentzVector & v) :
 TObject(),
+fPdgCode(0),
 fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
@@ -84,8 +105,8 @@ fLastDaughter(daughter2)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(p);
-  fX4 = new TLorentzVector(v);
+  fP4 = p;
+  fX4 = v;
 
   fRescatterCode  = -1;
   fPolzTheta      = -999; 
@@ -100,6 +121,7 @@ GHepParticle::GHepParticle(int pdg, GHepStatus_t status,
         double px, double py, double pz, double En,
         double x, double y, double z, double t) :
 TObject(),
+fPdgCode(0),
 fStatus(status),
 fFirstMother(mother1),
 fLastMother(mother2),
@@ -108,8 +130,8 @@ fLastDaughter(daughter2)
 {
   this->SetPdgCode(pdg);
 
-  fP4 = new TLorentzVector(px,py,pz,En);
-  fX4 = new TLorentzVector(x,y,z,t);
+  fP4.SetPxPyPzE(px,py,pz,En);
+  fX4.SetXYZT(x,y,z,t);
 
   fRescatterCode  = -1;
   fPolzTheta      = -999; 
@@ -135,54 +157,46 @@ fFirstMother(-1),
 fLastMother(-1),
 fFirstDaughter(-1),
 fLastDaughter(-1),
-fP4(0), 
-fX4(0),
+fP4(), 
+fX4(),
 fPolzTheta(-999.),
 fPolzPhi(-999.),
 fRemovalEnergy(0),
-fIsBound(false)
+fIsBound(false),
+fPdgId(-1),
+fPdgIdCode(0),
+fPdgIdGeneration(0)
 {
 
 }
 //___________________________________________________________________________
 GHepParticle::~GHepParticle()
 {
-  this->CleanUp();
+
 }
 //___________________________________________________________________________
 string GHepParticle::Name(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->GetName();
+  int id = this->PdgId();
+  return PDGLibrary::Instance()->Properties(id).particle->GetName();
 }
 //___________________________________________________________________________
 double GHepParticle::Mass(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Mass();
+  int id = this->PdgId();
+  return PDGLibrary::Instance()->Properties(id).mass;
 }
 //___________________________________________________________________________
 double GHepParticle::Charge(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  return p->Charge();
+  int id = this->PdgId();
+  return PDGLibrary::Instance()->Properties(id).charge;
 }
 //___________________________________________________________________________
 double GHepParticle::KinE(bool mass_from_pdg) const
 {
-  if(!fP4) {
-    LOG("GHepParticle", pWARN) << "4-momentum not yet set!";
-    return 0;
-  }
-
-  double En = fP4->Energy();
-  double M = ( (mass_from_pdg) ? this->Mass() : fP4->M() );
+  double En = fP4.Energy();
+  double M = ( (mass_from_pdg) ? this->Mass() : fP4.M() );
   double K = En - M;
 
   K = TMath::Max(K,0.);
@@ -214,17 +228,12 @@ TLorentzVector * GHepParticle::GetP4(void) const
 // see GHepParticle::P4() for a method that does not create a new object and
 // transfers its ownership 
 
-  if(fP4) {
-     TLorentzVector * p4 = new TLorentzVector(*fP4); 
+  TLorentzVector * p4 = new TLorentzVector(fP4); 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG) 
-          << "Return vp = " << utils::print::P4AsShortString(p4);
+  LOG("GHepParticle", pDEBUG) 
+       << "Return vp = " << utils::print::P4AsShortString(p4);
 #endif
-     return p4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-momentum TLorentzVector";
-    return 0;
-  }
+  return p4;
 }
 //___________________________________________________________________________
 TLorentzVector * GHepParticle::GetX4(void) const 
@@ -232,39 +241,30 @@ TLorentzVector * GHepParticle::GetX4(void) const
 // see GHepParticle::X4() for a method that does not create a new object and
 // transfers its ownership
 
-  if(fX4) {
-     TLorentzVector * x4 = new TLorentzVector(*fX4); 
+  TLorentzVector * x4 = new TLorentzVector(fX4); 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("GHepParticle", pDEBUG) 
-         << "Return x4 = " << utils::print::X4AsString(x4);
+  LOG("GHepParticle", pDEBUG) 
+      << "Return x4 = " << utils::print::X4AsString(x4);
 #endif
-     return x4;
-  } else {
-    LOG("GHepParticle", pWARN) << "NULL 4-position TLorentzVector";
-    return 0;
-  }
+  return x4;
 }
 //___________________________________________________________________________
 void GHepParticle::SetPdgCode(int code)
 {
-  fPdgCode = code;
+  if(code != fPdgCode) fCodesGeneration++;
+  fPdgCode         = code;
+  fPdgIdGeneration = 0;
   this->AssertIsKnownParticle();
 }
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(const TLorentzVector & p4)
 {
-  if(fP4)
-      fP4->SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
-  else
-      fP4 = new TLorentzVector(p4);
+  fP4.SetPxPyPzE( p4.Px(), p4.Py(), p4.Pz(), p4.Energy() );
 }
 //___________________________________________________________________________
 void GHepParticle::SetMomentum(double px, double py, double pz, double En)
 {
-  if(fP4)
-      fP4->SetPxPyPzE(px, py, pz, En);
-  else
-      fP4 = new TLorentzVector(px, py, pz, En);
+  fP4.SetPxPyPzE(px, py, pz, En);
 }
 //___________________________________________________________________________
 void GHepParticle::SetPosition(const TLorentzVector & v4)
@@ -280,8 +280,7 @@ void GHepParticle::SetPosition(double x, double y, double z, double t)
                                << y << ", z = " << z << ", t = " << t << ")";
 #endif
 
-  if(fX4) fX4->SetXYZT(x,y,z,t);
-  else    fX4 = new TLorentzVector(x,y,z,t);
+  fX4.SetXYZT(x,y,z,t);
 }
 //___________________________________________________________________________
 void GHepParticle::SetEnergy(double En)
@@ -306,12 +305,8 @@ void GHepParticle::SetPz(double pz)
 //___________________________________________________________________________
 bool GHepParticle::IsOnMassShell(void) const
 {
-  this->AssertIsKnownParticle();
-
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-
-  double Mpdg = p->Mass();
-  double M4p  = (fP4) ? fP4->M() : 0.;
+  double Mpdg = this->Mass();
+  double M4p  = fP4.M();
 
 //  return utils::math::AreEqual(Mpdg, M4p);
 
@@ -406,7 +401,11 @@ void GHepParticle::SetRemovalEnergy(double Erm)
 void GHepParticle::Init(void)
 {
   fPdgCode       = 0;
+  fPdgId         = -1;
+  fPdgIdCode     = 0;
+  fPdgIdGeneration = 0;
   fStatus        = kIStUndefined;
+  fCodesGeneration++;
   fRescatterCode = -1;
   fFirstMother   = -1;
   fLastMother    = -1;
@@ -416,18 +415,18 @@ void GHepParticle::Init(void)
   fPolzPhi       = -999;    
   fIsBound       = false;
   fRemovalEnergy = 0.;
-  fP4            = new TLorentzVector(0,0,0,0);
-  fX4            = new TLorentzVector(0,0,0,0);
+
+  fP4.SetPxPyPzE(0,0,0,0);
+  fX4.SetXYZT(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::CleanUp(void)
 {
-// deallocate memory
+// the 4-vectors are held by value: there is no memory to deallocate, only
+// reset them
 
-  if(fP4) delete fP4;
-  if(fX4) delete fX4;
-  fP4 = 0;
-  fX4 = 0;
+  fP4.SetPxPyPzE(0,0,0,0);
+  fX4.SetXYZT(0,0,0,0);
 }
 //___________________________________________________________________________
 void GHepParticle::Reset(void)
@@ -441,10 +440,10 @@ void GHepParticle::Reset(void)
 void GHepParticle::Clear(Option_t * /*option*/)
 {
 // implement the Clear(Option_t *) method so that the GHepParticle when is a
-// member of a GHepRecord, gets deleted properly when calling TClonesArray's
-// Clear("C")
+// member of a GHepRecord, gets reset properly when calling TClonesArray's
+// Clear("C") or Clear("C+K") (see GHepRecord::RecycleRecord())
 
-  this->CleanUp();
+  this->Init();
 }
 //___________________________________________________________________________
 void GHepParticle::Print(ostream & stream) const
@@ -552,8 +551,24 @@ void GHepParticle::Copy(const GHepParticle & particle)
 //___________________________________________________________________________
 void GHepParticle::AssertIsKnownParticle(void) const
 {
-  TParticlePDG * p = PDGLibrary::Instance()->Find(fPdgCode);
-  if(!p) {
+  this->PdgId();
+}
+//___________________________________________________________________________
+int GHepParticle::PdgId(void) const
+{
+// Dense PDGLibrary particle id, cached until the PDG code changes or the
+// PDG data are reloaded
+
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  if(fPdgIdCode == fPdgCode && fPdgIdGeneration == pdglib->Generation()) {
+    return fPdgId;
+  }
+
+  fPdgId           = pdglib->Id(fPdgCode);
+  fPdgIdCode       = fPdgCode;
+  fPdgIdGeneration = pdglib->Generation();
+
+  if(fPdgId < 0) {
     LOG("GHepParticle", pFATAL)
       << "\n** You are attempting to insert particle with PDG code = " 
       << fPdgCode << " into the event record."
@@ -562,6 +577,7 @@ void GHepParticle::AssertIsKnownParticle(void) const
     gAbortingInErr = true;
     exit(1);
   }
+  return fPdgId;
 }
 //___________________________________________________________________________
 bool GHepParticle::operator == (const GHepParticle & p) const
@@ -575,4 +591,157 @@ GHepParticle & GHepParticle::operator = (const GHepParticle & p)
   return (*this);
 }
 //___________________________________________________________________________
+void GHepParticle::SetCompactIO(bool compact)
+{
+  fCompactIO = compact;
+}
+//___________________________________________________________________________
+bool GHepParticle::CompactIO(void)
+{
+  return fCompactIO;
+}
+//___________________________________________________________________________
+void GHepParticle::Streamer(TBuffer & R__b)
+{
+// Versions up to 3 were written by the automatic streamer.
+// From version 4 a flag says whether the particle is in full or compact form.
+
+  if (R__b.IsReading()) {
+    UInt_t R__s, R__c;
+    Version_t R__v = R__b.ReadVersion(&R__s, &R__c);
+    if (R__v < 4) {
+      R__b.ReadClassBuffer(GHepParticle::Class(), this, R__v, R__s, R__c);
+      return;
+    }
+    fPdgId = -1;
+    fPdgIdCode = 0;
+    fPdgIdGeneration = 0;
+    fCodesGeneration++;
+    UChar_t compact = 0;
+    R__b >> compact;
+    if (compact) {
+      this->ReadCompact(R__b);
+    } else {
+      TObject::Streamer(R__b);
+      Int_t status = 0;
+      R__b >> fPdgCode;
+      R__b >> status;
+      R__b >> fRescatterCode;
+      R__b >> fFirstMother;
+      R__b >> fLastMother;
+      R__b >> fFirstDaughter;
+      R__b >> fLastDaughter;
+      fP4.Streamer(R__b);
+      fX4.Streamer(R__b);
+      R__b >> fPolzTheta;
+      R__b >> fPolzPhi;
+      R__b >> fRemovalEnergy;
+      R__b >> fIsBound;
+      fStatus = (GHepStatus_t) status;
+    }
+    R__b.CheckByteCount(R__s, R__c, GHepParticle::IsA());
+  } else {
+    UInt_t R__c = R__b.WriteVersion(GHepParticle::IsA(), kTRUE);
+    UChar_t compact = (fCompactIO) ? 1 : 0;
+    R__b << compact;
+    if (compact) {
+      this->WriteCompact(R__b);
+    } else {
+      TObject::Streamer(R__b);
+      R__b << fPdgCode;
+      R__b << (Int_t) fStatus;
+      R__b << fRescatterCode;
+      R__b << fFirstMother;
+      R__b << fLastMother;
+      R__b << fFirstDaughter;
+      R__b << fLastDaughter;
+      const_cast<TLorentzVector &>(fP4).Streamer(R__b);
+      const_cast<TLorentzVector &>(fX4).Streamer(R__b);
+      R__b << fPolzTheta;
+      R__b << fPolzPhi;
+      R__b << fRemovalEnergy;
+      R__b << fIsBound;
+    }
+    R__b.SetByteCount(R__c, kTRUE);
+  }
+}
+//___________________________________________________________________________
+void GHepParticle::WriteCompact(TBuffer & b) const
+{
+  bool polz = (fPolzTheta != -999 || fPolzPhi != -999);
+
+  Int_t packed = (fStatus & kCmpStatusMask) |
+                 ((fRescatterCode & 0xffff) << kCmpRescatShift);
+  if (fIsBound) packed |= kCmpBoundBit;
+  if (polz)     packed |= kCmpPolzBit;
+
+  Short_t ndaughters = (fFirstDaughter < 0) ? 0 :
+                       (Short_t) (fLastDaughter - fFirstDaughter + 1);
+
+  b << (Int_t) fPdgCode;
+  b << packed;
+  b << (Int_t) fFirstMother;
+  b << (Int_t) fLastMother;
+  b << (Int_t) fFirstDaughter;
+  b << ndaughters;
+
+  b << (Float_t) fP4.Px();
+  b << (Float_t) fP4.Py();
+  b << (Float_t) fP4.Pz();
+  b << (Double_t) fP4.E();
+
+  b << (Float_t) fX4.X();
+  b << (Float_t) fX4.Y();
+  b << (Float_t) fX4.Z();
+  b << (Float_t) fX4.T();
+
+  if (polz) {
+    b << (Float_t) fPolzTheta;
+    b << (Float_t) fPolzPhi;
+  }
+  if (fIsBound) {
+    b << (Float_t) fRemovalEnergy;
+  }
+}
+//___________________________________________________________________________
+void GHepParticle::ReadCompact(TBuffer & b)
+{
+  Int_t    packed = 0;
+  Short_t  ndaughters = 0;
+  Float_t  px = 0, py = 0, pz = 0, x = 0, y = 0, z = 0, t = 0;
+  Double_t E = 0;
 
+  b >> fPdgCode;
+  b >> packed;
+  b >> fFirstMother;
+  b >> fLastMother;
+  b >> fFirstDaughter;
+  b >> ndaughters;
+  b >> px; b >> py; b >> pz; b >> E;
+  b >> x;  b >> y;  b >> z;  b >> t;
+
+  fStatus        = (GHepStatus_t) (signed char) (packed & kCmpStatusMask);
+  fRescatterCode = (Short_t) ((packed >> kCmpRescatShift) & 0xffff);
+  fIsBound       = (packed & kCmpBoundBit) != 0;
+  fLastDaughter  = (fFirstDaughter < 0) ? -1 : fFirstDaughter + ndaughters - 1;
+
+  fP4.SetPxPyPzE(px, py, pz, E);
+  fX4.SetXYZT(x, y, z, t);
+
+  fPolzTheta     = -999;
+  fPolzPhi       = -999;
+  fRemovalEnergy = 0.;
+  if (packed & kCmpPolzBit) {
+    Float_t theta = 0, phi = 0;
+    b >> theta;
+    b >> phi;
+    fPolzTheta = theta;
+    fPolzPhi   = phi;
+  }
+  if (fIsBound) {
+    Float_t erm = 0;
+    b >> erm;
+    fRemovalEnergy = erm;
+  }
+}
+//___________________________________________________________________________
@@ -5,6 +5,13 @@
 
 \brief   STDHEP-like event record entry that can fit a particle or a nucleus.
 
+         The particles are written out either in full or, if compact I/O
+         is enabled (see SetCompactIO()), in a compact form: single precision
+         momenta (the energy is kept in double precision) and positions, the
+         status, bound flag and rescattering code packed in one word, and
+         the daughter list as a first daughter and a number of daughters.
+         Both forms are read back into the same GHepParticle.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -76,26 +83,26 @@ public :
   double Charge (void) const; ///< Chrg that corresponds to the PDG code
 
   // Returns the momentum & position 4-vectors
-  const TLorentzVector * P4 (void) const { return fP4; }
-  const TLorentzVector * X4 (void) const { return fX4; }
-  TLorentzVector * P4 (void) { return fP4; }
-  TLorentzVector * X4 (void) { return fX4; }
+  const TLorentzVector * P4 (void) const { return &fP4; }
+  const TLorentzVector * X4 (void) const { return &fX4; }
+  TLorentzVector * P4 (void) { return &fP4; }
+  TLorentzVector * X4 (void) { return &fX4; }
 
   // Hand over clones of the momentum & position 4-vectors (+ their ownership)
   TLorentzVector * GetP4 (void) const;
   TLorentzVector * GetX4 (void) const;
 
   // Returns the momentum & position 4-vectors components
-  double Px     (void) const { return (fP4) ? fP4->Px()     : 0; } ///< Get Px
-  double Py     (void) const { return (fP4) ? fP4->Py()     : 0; } ///< Get Py
-  double Pz     (void) const { return (fP4) ? fP4->Pz()     : 0; } ///< Get Pz 
-  double E      (void) const { return (fP4) ? fP4->Energy() : 0; } ///< Get energy
-  double Energy (void) const { return this->E();                 } ///< Get energy
-  double KinE   (bool mass_from_pdg = false) const;                ///< Get kinetic energy
-  double Vx     (void) const { return (fX4) ? fX4->X()      : 0; } ///< Get production x
-  double Vy     (void) const { return (fX4) ? fX4->Y()      : 0; } ///< Get production y
-  double Vz     (void) const { return (fX4) ? fX4->Z()      : 0; } ///< Get production z
-  double Vt     (void) const { return (fX4) ? fX4->T()      : 0; } ///< Get production time
+  double Px     (void) const { return fP4.Px();     } ///< Get Px
+  double Py     (void) const { return fP4.Py();     } ///< Get Py
+  double Pz     (void) const { return fP4.Pz();     } ///< Get Pz 
+  double E      (void) const { return fP4.Energy(); } ///< Get energy
+  double Energy (void) const { return this->E();    } ///< Get energy
+  double KinE   (bool mass_from_pdg = false) const;   ///< Get kinetic energy
+  double Vx     (void) const { return fX4.X();      } ///< Get production x
+  double Vy     (void) const { return fX4.Y();      } ///< Get production y
+  double Vz     (void) const { return fX4.Z();      } ///< Get production z
+  double Vt     (void) const { return fX4.T();      } ///< Get production time
 
   // Return removal energy /set only for bound nucleons/
   double RemovalEnergy (void) const { return fRemovalEnergy; } ///< Get removal energy 
@@ -124,7 +131,11 @@ public :
 
   // Set pdg code and status codes
   void SetPdgCode  (int c);
-  void SetStatus   (GHepStatus_t s) { fStatus = s; }
+  void SetStatus   (GHepStatus_t s) { if(s != fStatus) { fStatus = s; fCodesGeneration++; } }
+
+  // Counter bumped whenever the pdg or status code of any particle changes,
+  // telling the GHepRecord indices when they need to be rebuilt
+  static unsigned int CodesGeneration (void) { return fCodesGeneration; }
 
   // Set the rescattering code
   void SetRescatterCode(int code) { fRescatterCode = code; }
@@ -167,10 +178,17 @@ public :
   GHepParticle &   operator =  (const GHepParticle & p);
   friend ostream & operator << (ostream & stream, const GHepParticle & p);
 
+  // Compact I/O mode for the particles written from now on
+  static void SetCompactIO (bool compact);
+  static bool CompactIO    (void);
+
 private:
 
   void Init(void);
   void AssertIsKnownParticle(void) const;
+  int  PdgId                (void) const;
+  void ReadCompact          (TBuffer & b);
+  void WriteCompact         (TBuffer & b) const;
 
   int              fPdgCode;        ///< particle PDG code
   GHepStatus_t     fStatus;         ///< particle status
@@ -179,14 +197,21 @@ private:
   int              fLastMother;     ///< last mother idx
   int              fFirstDaughter;  ///< first daughter idx
   int              fLastDaughter;   ///< last daughter idx
-  TLorentzVector * fP4;             ///< momentum 4-vector (GeV)
-  TLorentzVector * fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
+  TLorentzVector   fP4;             ///< momentum 4-vector (GeV)
+  TLorentzVector   fX4;             ///< position 4-vector (in the target nucleus coordinate system / x,y,z in fm / t=0)
   double           fPolzTheta;      ///< polar polarization angle (rad)
   double           fPolzPhi;        ///< azimuthal polarization angle (rad)
   double           fRemovalEnergy;  ///< removal energy for bound nucleons (GeV)
   bool             fIsBound;        ///< 'is it a bound particle?' flag
 
-ClassDef(GHepParticle, 2)
+  mutable int          fPdgId;            //! cached PDGLibrary particle id
+  mutable int          fPdgIdCode;        //! PDG code of the cached id
+  mutable unsigned int fPdgIdGeneration;  //! PDGLibrary table generation of the cached id
+
+  static bool fCompactIO; //! write particles in the compact form?
+  static unsigned int fCodesGeneration; //! see CodesGeneration()
+
+ClassDef(GHepParticle, 4)
 
 };
 
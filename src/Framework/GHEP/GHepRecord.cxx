@@ -48,11 +48,26 @@
    set it and tweaked Print() accordingly.
  @ May 02, 2013 - CA
    Added `KinePhaseSpace_t DiffXSecVars(void) const' to return fDiffXSecPhSp.
+ @ Oct 14, 2026 - CA
+   Added a custom streamer (class version 3) streaming each particle through
+   GHepParticle::Streamer, so that particles can be written in compact form.
+   Added the (transient) computing cost of the event, see GHepEventCost.
+ @ Oct 14, 2026 - CA
+   Serve FindParticle(), ParticlePosition(), NEntries() and the positions of
+   the main entries from a transient index of the record (see UpdateIndex())
+   rather than scanning the particle array at every call.
+ @ Oct 14, 2026 - CA
+   Added DeferDaughterLists(), to resolve the daughter lists once after a
+   series of particle insertions rather than at each insertion.
+ @ Oct 14, 2026 - CA
+   RecycleRecord() keeps the summary object for AttachSummaryCopy(), which
+   resets it rather than allocating a new Interaction for every event.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <climits>
 #include <algorithm>
 #include <iomanip>
 
@@ -60,6 +75,7 @@
 #include <TVector3.h>
 #include <TSystem.h>
 #include <TRootIOCtor.h>
+#include <TBuffer.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
@@ -85,6 +101,18 @@ ClassImp(GHepRecord)
 
 int GHepRecord::fPrintLevel = 3;
 
+// cached index position or mode not worked out yet
+static const int kIdxUnset = -2;
+
+//___________________________________________________________________________
+namespace {
+  // index key of a (pdg, status) pair: entries of the same pdg are adjacent
+  ULong64_t CodesKey(int pdg, int ist)
+  {
+    return ((ULong64_t) (UInt_t) pdg << 32) | (ULong64_t) (UInt_t) ist;
+  }
+}
+
 //___________________________________________________________________________
 namespace genie {
  ostream & operator << (ostream & stream, const GHepRecord & rec)
@@ -116,13 +144,30 @@ TClonesArray("genie::GHepParticle", record.GetEntries())
 GHepRecord::GHepRecord(TRootIOCtor*) :
 TClonesArray("genie::GHepParticle"),
 fInteraction(0),
+fSpareInteraction(0),
 fVtx(0), 
 fEventFlags(0), 
 fEventMask(0),
 fWeight(0.),
 fProb(0.),
 fXSec(0.),
-fDiffXSec(0.)
+fDiffXSec(0.),
+fCostCpuNs(0),
+fCostKineTrials(0),
+fCostINukeSteps(0),
+fCostINukeRetries(0),
+fCostHadRetries(0),
+fCostModuleStops(0),
+fDeferDaughterLists(false),
+fFirstDeferred(-1),
+fIdxValid(false),
+fIdxGeneration(0),
+fIdxEntries(0),
+fIdxMode(kIdxUnset),
+fIdxProbe(kIdxUnset),
+fIdxTarget(kIdxUnset),
+fIdxHitNucleon(kIdxUnset),
+fIdxHitElectron(kIdxUnset)
 {
 
 }
@@ -145,6 +190,16 @@ void GHepRecord::AttachSummary(Interaction * interaction)
   fInteraction = interaction;
 }
 //___________________________________________________________________________
+void GHepRecord::AttachSummaryCopy(const Interaction & interaction)
+{
+  if(!fInteraction) {
+    fInteraction      = fSpareInteraction;
+    fSpareInteraction = 0;
+  }
+  if(fInteraction) fInteraction->Reset(interaction);
+  else             fInteraction = new Interaction(interaction);
+}
+//___________________________________________________________________________
 GHepParticle * GHepRecord::Particle(int position) const
 {
 // Returns the GHepParticle from the specified position of the event record.
@@ -165,11 +220,8 @@ GHepParticle * GHepRecord::FindParticle(
 // Returns the first GHepParticle with the input pdg-code and status
 // starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Status() == status && p->Pdg() == pdg) return p;
-  }
+  int pos = this->IndexedPosition(pdg, status, start);
+  if(pos > -1) return (GHepParticle *) this->UncheckedAt(pos);
 
   LOG("GHEP", pINFO)
     << "No particle found with: (pos >= " << start
@@ -184,11 +236,8 @@ int GHepRecord::ParticlePosition(
 // Returns the position of the first GHepParticle with the input pdg-code
 // and status starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Status() == status && p->Pdg() == pdg) return i;
-  }
+  int pos = this->IndexedPosition(pdg, status, start);
+  if(pos > -1) return pos;
 
   LOG("GHEP", pINFO)
     << "No particle found with: (pos >= " << start
@@ -202,10 +251,15 @@ int GHepRecord::ParticlePosition(GHepParticle * particle, int start) const
 // Returns the position of the first match with the specified GHepParticle
 // starting from the specified position of the event record.
 
-  int nentries = this->GetEntries();
-  for(int i = start; i < nentries; i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if( p->Compare(particle) ) return i;
+  // only the entries with the same pdg and status codes can match
+  this->UpdateIndex();
+  ULong64_t key = CodesKey(particle->Pdg(), particle->Status());
+  vector< pair<ULong64_t,int> >::const_iterator it = std::lower_bound(
+     fIdxCodes.begin(), fIdxCodes.end(), pair<ULong64_t,int>(key, start));
+  for( ; it != fIdxCodes.end() && it->first == key; ++it) {
+     const GHepParticle * p = 
+           (const GHepParticle *) this->UncheckedAt(it->second);
+     if( p->Compare(particle) ) return it->second;
   }
 
   LOG("GHEP", pINFO)
@@ -232,19 +286,26 @@ vector<int> * GHepRecord::GetStableDescendants(int position) const
     return descendants;
   }
 
+  // copy the status codes and mother links into contiguous arrays, so that
+  // walking up the mother chains does not touch the particle objects
+  vector<int> mother(nentries);
+  vector<int> status(nentries);
+  for(int i = 0; i < nentries; i++) {
+    const GHepParticle * p = (const GHepParticle *) this->UncheckedAt(i);
+    mother[i] = p->FirstMother();
+    status[i] = p->Status();
+  }
+
   for(int i = 0; i < nentries; i++) {
     if(i==position) continue;
-    GHepParticle * p = (GHepParticle *) (*this)[i];
-    if(p->Status() != kIStStableFinalState) continue;
-    bool is_descendant=false;
-    int mom = p->FirstMother();
-    while(mom>-1) {
-      if(mom==position) is_descendant=true;
-      if(is_descendant) {
+    if(status[i] != kIStStableFinalState) continue;
+    int mom = mother[i];
+    while(mom>-1 && mom<nentries) {
+      if(mom==position) {
 	descendants->push_back(i);
         break;
       }
-      mom = this->Particle(mom)->FirstMother();
+      mom = mother[mom];
     }
   }
   return descendants;
@@ -252,6 +313,10 @@ vector<int> * GHepRecord::GetStableDescendants(int position) const
 //___________________________________________________________________________
 GEvGenMode_t GHepRecord::EventGenerationMode(void) const
 {
+  this->UpdateIndex();
+  if(fIdxMode != kIdxUnset) return (GEvGenMode_t) fIdxMode;
+  fIdxMode = kGMdUnknown;
+
   GHepParticle * p0 = this->Particle(0);
   if(!p0) return kGMdUnknown;
   GHepParticle * p1 = this->Particle(1);
@@ -266,14 +331,14 @@ GEvGenMode_t GHepRecord::EventGenerationMode(void) const
   // is a charged or neutral lepton with status code = kIStInitialState
   if( pdg::IsLepton(p0pdg) && p0st == kIStInitialState )
   {
-    return kGMdLeptonNucleus;
+    return (GEvGenMode_t) (fIdxMode = kGMdLeptonNucleus);
   }
 
   // In dark matter mode, the 1st entry in the event record is a dark
   // matter particle
   if( pdg::IsDarkMatter(p0pdg) && p0st == kIStInitialState )
   {
-    return kGMdDarkMatterNucleus;
+    return (GEvGenMode_t) (fIdxMode = kGMdDarkMatterNucleus);
   }
 
   // In hadron+nucleon/nucleus mode, the 1st entry in the event record
@@ -283,7 +348,7 @@ GEvGenMode_t GHepRecord::EventGenerationMode(void) const
   {   
     if( (pdg::IsIon(p1pdg) || pdg::IsNucleon(p1pdg)) && p1st == kIStInitialState)
     {
-       return kGMdHadronNucleus;
+       return (GEvGenMode_t) (fIdxMode = kGMdHadronNucleus);
     }
   }
 
@@ -292,7 +357,7 @@ GEvGenMode_t GHepRecord::EventGenerationMode(void) const
   {   
     if( (pdg::IsIon(p1pdg) || pdg::IsNucleon(p1pdg)) && p1st == kIStInitialState)
     {
-       return kGMdPhotonNucleus;
+       return (GEvGenMode_t) (fIdxMode = kGMdPhotonNucleus);
     }
   }
       
@@ -307,12 +372,12 @@ GEvGenMode_t GHepRecord::EventGenerationMode(void) const
   if( pdg::IsIon(p0pdg)     && p0st == kIStInitialState &&
       pdg::IsNucleon(p1pdg) && p1st == kIStDecayedState)
   {
-     return kGMdNucleonDecay;
+     return (GEvGenMode_t) (fIdxMode = kGMdNucleonDecay);
   }
   if( pdg::IsNucleon(p0pdg) && p0st == kIStInitialState &&
       pdg::IsNucleon(p1pdg) && p1st == kIStDecayedState)
   {
-     return kGMdNucleonDecay;
+     return (GEvGenMode_t) (fIdxMode = kGMdNucleonDecay);
   }
          
   return kGMdUnknown;
@@ -392,15 +457,18 @@ int GHepRecord::ProbePosition(void) const
 // (neutrino, e,...).
 
   // The probe is *always* at slot 0.
+  this->UpdateIndex();
+  if(fIdxProbe != kIdxUnset) return fIdxProbe;
+
   GEvGenMode_t mode = this->EventGenerationMode();
   if(mode == kGMdLeptonNucleus || 
      mode == kGMdDarkMatterNucleus ||
      mode == kGMdHadronNucleus ||
      mode == kGMdPhotonNucleus) 
   {
-    return 0;
+    return (fIdxProbe = 0);
   }
-  return -1; 
+  return (fIdxProbe = -1); 
 }
 //___________________________________________________________________________
 int GHepRecord::TargetNucleusPosition(void) const
@@ -408,6 +476,10 @@ int GHepRecord::TargetNucleusPosition(void) const
 // Returns the GHEP position of the GHepParticle representing the target 
 // nucleus - or -1 if the interaction takes place at a free nucleon.
 
+  this->UpdateIndex();
+  if(fIdxTarget != kIdxUnset) return fIdxTarget;
+  fIdxTarget = -1;
+
   GEvGenMode_t mode = this->EventGenerationMode();
 
   if(mode == kGMdLeptonNucleus || 
@@ -418,13 +490,13 @@ int GHepRecord::TargetNucleusPosition(void) const
      GHepParticle * p = this->Particle(1); // If exists, it will be at slot 1
      if(!p) return -1;
      int pdgc = p->Pdg();
-     if(pdg::IsIon(pdgc) && p->Status()==kIStInitialState) return 1; 
+     if(pdg::IsIon(pdgc) && p->Status()==kIStInitialState) return (fIdxTarget = 1); 
   }
   if(mode == kGMdNucleonDecay) {
      GHepParticle * p = this->Particle(0); // If exists, it will be at slot 0
      if(!p) return -1;
      int pdgc = p->Pdg();
-     if(pdg::IsIon(pdgc) && p->Status()==kIStInitialState) return 0; 
+     if(pdg::IsIon(pdgc) && p->Status()==kIStInitialState) return (fIdxTarget = 0); 
   }
 
   return -1;
@@ -459,6 +531,10 @@ int GHepRecord::HitNucleonPosition(void) const
 // If the struck nucleon is not set (eg coherent scattering, ve- scattering) 
 // it returns 0.
 
+  this->UpdateIndex();
+  if(fIdxHitNucleon != kIdxUnset) return fIdxHitNucleon;
+  fIdxHitNucleon = -1;
+
   GHepParticle * nucleus = this->TargetNucleus();
 
   int          ipos = (nucleus) ? 2 : 1;
@@ -469,7 +545,7 @@ int GHepRecord::HitNucleonPosition(void) const
 
 //  bool isN = pdg::IsNeutronOrProton(p->Pdg());
   bool isN = pdg::IsNucleon(p->Pdg()) || pdg::Is2NucleonCluster(p->Pdg()); 
-  if(isN && p->Status()==ist) return ipos; 
+  if(isN && p->Status()==ist) return (fIdxHitNucleon = ipos); 
 
   return -1;
 }
@@ -479,6 +555,10 @@ int GHepRecord::HitElectronPosition(void) const
 // Returns the GHEP position of the GHepParticle representing a hit electron.
 // Same as above..
 
+  this->UpdateIndex();
+  if(fIdxHitElectron != kIdxUnset) return fIdxHitElectron;
+  fIdxHitElectron = -1;
+
   GHepParticle * nucleus = this->TargetNucleus();
 
   int ipos = (nucleus) ? 2 : 1;
@@ -487,7 +567,7 @@ int GHepRecord::HitElectronPosition(void) const
   if(!p) return -1;
 
   bool ise = pdg::IsElectron(p->Pdg());
-  if(ise && p->Status()==kIStInitialState) return ipos; 
+  if(ise && p->Status()==kIStInitialState) return (fIdxHitElectron = ipos); 
 
   return -1;
 }
@@ -512,22 +592,27 @@ int GHepRecord::FinalStateHadronicSystemPosition(void) const
 //___________________________________________________________________________ 
 unsigned int GHepRecord::NEntries(int pdg, GHepStatus_t ist, int start) const
 {
-  unsigned int nentries = 0;
-
-  for(int i = start; i < this->GetEntries(); i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Pdg()==pdg && p->Status()==ist) nentries++;
-  }
-  return nentries;
+  this->UpdateIndex();
+  ULong64_t key = CodesKey(pdg, ist);
+  vector< pair<ULong64_t,int> >::iterator first = std::lower_bound(
+     fIdxCodes.begin(), fIdxCodes.end(), pair<ULong64_t,int>(key, start));
+  vector< pair<ULong64_t,int> >::iterator last = std::lower_bound(
+     first, fIdxCodes.end(), pair<ULong64_t,int>(key+1, INT_MIN));
+
+  return (unsigned int) (last - first);
 }
 //___________________________________________________________________________
 unsigned int GHepRecord::NEntries(int pdg, int start) const
 {
-  unsigned int nentries = 0;
+  this->UpdateIndex();
+  ULong64_t key = (UInt_t) pdg; // pdg part of the index keys
+  vector< pair<ULong64_t,int> >::const_iterator it = std::lower_bound(
+     fIdxCodes.begin(), fIdxCodes.end(), 
+     pair<ULong64_t,int>(key << 32, INT_MIN));
 
-  for(int i = start; i < this->GetEntries(); i++) {
-     GHepParticle * p = (GHepParticle *) (*this)[i];
-     if(p->Pdg()==pdg) nentries++;
+  unsigned int nentries = 0;
+  for( ; it != fIdxCodes.end() && (it->first >> 32) == key; ++it) {
+     if(it->second >= start) nentries++;
   }
   return nentries;
 }
@@ -542,7 +627,9 @@ void GHepRecord::AddParticle(const GHepParticle & p)
   LOG("GHEP", pINFO)
     << "Adding particle with pdgc = " << p.Pdg() << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(p);
+  bool indexed = this->IndexIsCurrent();
+  this->NewParticle(pos)->Copy(p);
+  this->IndexParticle(pos, indexed);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -561,7 +648,17 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ((*this)[pos]) GHepParticle(pdg,status, mom1,mom2,dau1,dau2, p, v);
+  bool indexed = this->IndexIsCurrent();
+  GHepParticle * particle = this->NewParticle(pos);
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (p);
+  particle->SetPosition      (v);
+  this->IndexParticle(pos, indexed);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
@@ -581,18 +678,43 @@ void GHepRecord::AddParticle(
   LOG("GHEP", pINFO)
            << "Adding particle with pdgc = " << pdg << " at slot = " << pos;
 #endif
-  new ( (*this)[pos] ) GHepParticle (
-            pdg, status, mom1, mom2, dau1, dau2, px, py, pz, E, x, y, z, t);
+  bool indexed = this->IndexIsCurrent();
+  GHepParticle * particle = this->NewParticle(pos);
+  particle->SetPdgCode       (pdg);
+  particle->SetStatus        (status);
+  particle->SetFirstMother   (mom1);
+  particle->SetLastMother    (mom2);
+  particle->SetFirstDaughter (dau1);
+  particle->SetLastDaughter  (dau2);
+  particle->SetMomentum      (px, py, pz, E);
+  particle->SetPosition      (x, y, z, t);
+  this->IndexParticle(pos, indexed);
 
   // Update the mother's daughter list. If the newly inserted particle broke
   // compactification, then run CompactifyDaughterLists()
   this->UpdateDaughterLists();
 }
 //___________________________________________________________________________
+GHepParticle * GHepRecord::NewParticle(unsigned int pos)
+{
+// Returns the particle at the input slot, in its initial state. A particle
+// object left over at that slot by a previous use of the record is reused
+// rather than reconstructed.
+
+  GHepParticle * particle = (GHepParticle *) this->ConstructedAt(pos);
+  particle->Clear("K");
+  return particle;
+}
+//___________________________________________________________________________
 void GHepRecord::UpdateDaughterLists(void)
 {
   int pos = this->GetEntries() - 1; // position of last entry
 
+  if(fDeferDaughterLists) {
+    if(fFirstDeferred < 0) fFirstDeferred = pos;
+    return;
+  }
+
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GHEP", pINFO)
      << "Updating the daughter-list for the mother of particle at: " << pos;
@@ -653,6 +775,8 @@ void GHepRecord::UpdateDaughterLists(void)
 void GHepRecord::RemoveIntermediateParticles(void)
 {
   LOG("GHEP", pNOTICE) << "Removing all intermediate particles from GHEP";
+  this->ResolveDaughterLists();
+  fIdxValid = false;
   this->Compress(); 
 
   int i=0;
@@ -795,6 +919,8 @@ void GHepRecord::SwapParticles(int i, int j)
 
   if(i==j) return;
 
+  fIdxValid = false;
+
   GHepParticle * pi  = this->Particle(i);
   GHepParticle * pj  = this->Particle(j);
   GHepParticle * tmp = new GHepParticle(*pi);
@@ -860,6 +986,189 @@ void GHepRecord::FinalizeDaughterLists(void)
   }
 }
 //___________________________________________________________________________
+void GHepRecord::DeferDaughterLists(bool defer)
+{
+  fDeferDaughterLists = defer;
+  if(!defer) this->ResolveDaughterLists();
+}
+//___________________________________________________________________________
+void GHepRecord::ResolveDaughterLists(void)
+{
+// Resolves the daughter lists after the entries appended while deferred.
+// The insertions are replayed, in order, as UpdateDaughterLists() and
+// CompactifyDaughterLists() would have processed them, but on the record
+// layout only (the slot of each entry and the daughter lists). The entries
+// are then moved to their final slots, and their mother links remapped,
+// at once, instead of swapping particles and refinalizing all daughter
+// lists at every insertion breaking compactification.
+// While deferred, the mother links refer to the insertion positions.
+
+  int first = fFirstDeferred;
+  fFirstDeferred = -1;
+  if(first < 0) return;
+
+  int n = this->GetEntriesFast();
+  if(first >= n) return;
+
+  LOG("GHEP", pINFO)
+    << "Resolving the daughter lists of entries " << first << " - " << n-1;
+
+  // the layout: entry at each slot, first mother and daughter list of entries
+  // (mothers by entry, daughters by slot)
+  vector<int> order;
+  order.reserve(n);
+  vector<int> mom(n), dau1(n), dau2(n);
+  for(int i = 0; i < n; i++) {
+    const GHepParticle * p = (const GHepParticle *) this->UncheckedAt(i);
+    mom [i] = p->FirstMother();
+    dau1[i] = p->FirstDaughter();
+    dau2[i] = p->LastDaughter();
+    if(i < first) order.push_back(i);
+  }
+
+  bool moved = false;
+  for(int j = first; j < n; j++) {
+    order.push_back(j);
+    int pos = order.size() - 1;
+    int m = mom[j];
+    if(m < 0 || m > j) continue; // no mom (yet) in the record
+
+    if(dau1[m] == -1)       { dau1[m] = pos; dau2[m] = pos; continue; }
+    if(pos == dau1[m] - 1)  { dau1[m] = pos;                continue; }
+    if(pos == dau2[m] + 1)  { dau2[m] = pos;                continue; }
+
+    // daughter list compactness, as in HasCompactDaughterList()
+    bool compact = true;
+    int prev = -1;
+    for(int k = 0; k <= pos; k++) {
+      if(mom[order[k]] != m) continue;
+      if(prev > -1 && k - prev > 1) { compact = false; break; }
+      prev = k;
+    }
+    if(compact) continue;
+
+    // move the new entry just after its siblings, as the compactifier does,
+    // and refinalize all daughter lists
+    int ndp = dau2[m] + 1;
+    if(pos > ndp) {
+      order.pop_back();
+      order.insert(order.begin() + ndp, j);
+    }
+    vector<int> slot(n, -1);
+    for(int k = 0; k <= pos; k++) slot[order[k]] = k;
+    for(int k = 0; k <= pos; k++) { dau1[order[k]] = -1; dau2[order[k]] = -1; }
+    for(int k = 0; k <= pos; k++) {
+      int mk = mom[order[k]];
+      if(mk < 0 || mk >= n || slot[mk] < 0) continue;
+      if(dau1[mk] < 0 || k < dau1[mk]) dau1[mk] = k;
+      if(dau2[mk] < 0 || k > dau2[mk]) dau2[mk] = k;
+    }
+    moved = true;
+  }
+
+  // move the entries to their final slots
+  if(moved) {
+    vector<int> slot(n);
+    for(int k = 0; k < n; k++) slot[order[k]] = k;
+
+    vector<GHepParticle> entries(n);
+    for(int i = 0; i < n; i++) {
+      entries[i].Copy(* (const GHepParticle *) this->UncheckedAt(i));
+    }
+    for(int k = 0; k < n; k++) {
+      GHepParticle * p = (GHepParticle *) this->UncheckedAt(k);
+      p->Copy(entries[order[k]]);
+      int m1 = p->FirstMother();
+      int m2 = p->LastMother();
+      if(m1 >= 0 && m1 < n) p->SetFirstMother(slot[m1]);
+      if(m2 >= 0 && m2 < n) p->SetLastMother (slot[m2]);
+    }
+    fIdxValid = false;
+  }
+  for(int k = 0; k < n; k++) {
+    GHepParticle * p = (GHepParticle *) this->UncheckedAt(k);
+    p->SetFirstDaughter(dau1[order[k]]);
+    p->SetLastDaughter (dau2[order[k]]);
+  }
+}
+//___________________________________________________________________________
+bool GHepRecord::IndexIsCurrent(void) const
+{
+  return fIdxValid && 
+         fIdxGeneration == GHepParticle::CodesGeneration() &&
+         fIdxEntries    == this->GetEntriesFast();
+}
+//___________________________________________________________________________
+void GHepRecord::UpdateIndex(void) const
+{
+// Rebuilds the index of the record entries, unless it is current: the 
+// positions of the entries sorted by (pdg, status) codes, and the positions
+// of the main entries, worked out at the first query. 
+
+  if(this->IndexIsCurrent()) return;
+
+  int nentries = this->GetEntriesFast();
+  fIdxCodes.clear();
+  for(int i = 0; i < nentries; i++) {
+     const GHepParticle * p = (const GHepParticle *) this->UncheckedAt(i);
+     if(!p) continue;
+     fIdxCodes.push_back(
+          pair<ULong64_t,int>(CodesKey(p->Pdg(), p->Status()), i));
+  }
+  std::sort(fIdxCodes.begin(), fIdxCodes.end());
+
+  fIdxMode        = kIdxUnset;
+  fIdxProbe       = kIdxUnset;
+  fIdxTarget      = kIdxUnset;
+  fIdxHitNucleon  = kIdxUnset;
+  fIdxHitElectron = kIdxUnset;
+
+  fIdxEntries    = nentries;
+  fIdxGeneration = GHepParticle::CodesGeneration();
+  fIdxValid      = true;
+}
+//___________________________________________________________________________
+void GHepRecord::IndexParticle(int pos, bool was_current)
+{
+// Adds the particle just appended at the input slot to the index, if the
+// index was current before the particle was filled in
+
+  if(!was_current || pos != fIdxEntries) {
+    fIdxValid = false;
+    return;
+  }
+
+  const GHepParticle * p = (const GHepParticle *) this->UncheckedAt(pos);
+  pair<ULong64_t,int> entry(CodesKey(p->Pdg(), p->Status()), pos);
+  fIdxCodes.insert(
+     std::upper_bound(fIdxCodes.begin(), fIdxCodes.end(), entry), entry);
+
+  // the main entries are all in the first slots
+  if(pos < 3) {
+    fIdxMode        = kIdxUnset;
+    fIdxProbe       = kIdxUnset;
+    fIdxTarget      = kIdxUnset;
+    fIdxHitNucleon  = kIdxUnset;
+    fIdxHitElectron = kIdxUnset;
+  }
+
+  fIdxEntries    = pos + 1;
+  fIdxGeneration = GHepParticle::CodesGeneration();
+}
+//___________________________________________________________________________
+int GHepRecord::IndexedPosition(int pdg, GHepStatus_t ist, int start) const
+{
+// Position of the first entry with the input pdg and status codes at or
+// after the input slot, or -1
+
+  this->UpdateIndex();
+  ULong64_t key = CodesKey(pdg, ist);
+  vector< pair<ULong64_t,int> >::const_iterator it = std::lower_bound(
+     fIdxCodes.begin(), fIdxCodes.end(), pair<ULong64_t,int>(key, start));
+  if(it != fIdxCodes.end() && it->first == key) return it->second;
+  return -1;
+}
+//___________________________________________________________________________
 void GHepRecord::SetVertex(double x, double y, double z, double t)
 {
   fVtx->SetXYZT(x,y,z,t);
@@ -876,12 +1185,18 @@ void GHepRecord::InitRecord(void)
   LOG("GHEP", pDEBUG) << "Initializing GHepRecord";
 #endif
   fInteraction  = 0;
+  fSpareInteraction = 0;
   fWeight       = 1.;
   fProb         = 1.;
   fXSec         = 0.;
   fDiffXSec     = 0.;
   fDiffXSecPhSp = kPSNull;
   fVtx          = new TLorentzVector(0,0,0,0);
+  this->SetCost(GHepEventCost());
+  fIdxValid     = false;
+  fIdxEntries   = 0;
+  fDeferDaughterLists = false;
+  fFirstDeferred      = -1;
 
   fEventFlags  = new TBits(GHepFlags::NFlags());
   fEventFlags -> ResetAllBits(false);
@@ -916,11 +1231,52 @@ void GHepRecord::ResetRecord(void)
   this->InitRecord();
 }
 //___________________________________________________________________________
+void GHepRecord::RecycleRecord(void)
+{
+// Resets the record like ResetRecord() but keeps the particle objects as
+// well as the vertex and flag objects, so that the record can be refilled
+// without reallocating them
+
+  if(!fVtx || !fEventFlags || !fEventMask) {
+    this->ResetRecord();
+    return;
+  }
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("GHEP", pDEBUG) << "Recycling GHepRecord";
+#endif
+  if (fInteraction) {
+    if (fSpareInteraction) delete fSpareInteraction;
+    fSpareInteraction = fInteraction;
+  }
+  fInteraction = 0;
+
+  TClonesArray::Clear("C+K");
+  fIdxValid = false;
+  fFirstDeferred = -1;
+
+  fWeight       = 1.;
+  fProb         = 1.;
+  fXSec         = 0.;
+  fDiffXSec     = 0.;
+  fDiffXSecPhSp = kPSNull;
+  fVtx -> SetXYZT(0,0,0,0);
+  this->SetCost(GHepEventCost());
+
+  fEventFlags -> ResetAllBits(false);
+  for(unsigned int i = 0; i < GHepFlags::NFlags(); i++) {
+   fEventMask->SetBitNumber(i, true);
+  }
+}
+//___________________________________________________________________________
 void GHepRecord::Clear(Option_t * opt)
 {
   if (fInteraction) delete fInteraction;
   fInteraction=0;
 
+  if (fSpareInteraction) delete fSpareInteraction;
+  fSpareInteraction=0;
+
   if (fVtx) delete fVtx;
   fVtx=0;
 
@@ -931,6 +1287,8 @@ void GHepRecord::Clear(Option_t * opt)
   fEventMask=0;
 
   TClonesArray::Clear(opt);
+  fIdxValid = false;
+  fFirstDeferred = -1;
 
 //  if (fInteraction) delete fInteraction;
 //  delete fVtx;
@@ -942,18 +1300,18 @@ void GHepRecord::Clear(Option_t * opt)
 //___________________________________________________________________________
 void GHepRecord::Copy(const GHepRecord & record)
 {
-  // clean up
-  this->ResetRecord();
+  // clean up (keeping the storage, as everything is overwritten below)
+  this->RecycleRecord();
 
   // copy event record entries
   unsigned int ientry = 0;
   GHepParticle * p = 0;
   TIter ghepiter(&record);
   while ( (p = (GHepParticle *) ghepiter.Next()) )
-                              new ( (*this)[ientry++] ) GHepParticle(*p);
+                              this->NewParticle(ientry++)->Copy(*p);
 
   // copy summary
-  fInteraction = new Interaction( *record.fInteraction );
+  this->AttachSummaryCopy( *record.fInteraction );
 
   // copy flags & mask
   *fEventFlags = *(record.EventFlags());
@@ -969,6 +1327,31 @@ void GHepRecord::Copy(const GHepRecord & record)
   fXSec         = record.fXSec;
   fDiffXSec     = record.fDiffXSec;
   fDiffXSecPhSp = record.fDiffXSecPhSp;
+
+  // copy the computing cost
+  this->SetCost(record.Cost());
+}
+//___________________________________________________________________________
+GHepEventCost GHepRecord::Cost(void) const
+{
+  GHepEventCost cost;
+  cost.cpu_ns       = fCostCpuNs;
+  cost.kine_trials  = fCostKineTrials;
+  cost.inuke_steps  = fCostINukeSteps;
+  cost.inuke_retries = fCostINukeRetries;
+  cost.had_retries  = fCostHadRetries;
+  cost.module_stops = fCostModuleStops;
+  return cost;
+}
+//___________________________________________________________________________
+void GHepRecord::SetCost(const GHepEventCost & cost)
+{
+  fCostCpuNs       = cost.cpu_ns;
+  fCostKineTrials  = cost.kine_trials;
+  fCostINukeSteps  = cost.inuke_steps;
+  fCostINukeRetries = cost.inuke_retries;
+  fCostHadRetries  = cost.had_retries;
+  fCostModuleStops = cost.module_stops;
 }
 //___________________________________________________________________________
 void GHepRecord::SetUnphysEventMask(const TBits & mask)
@@ -1248,3 +1631,21 @@ void GHepRecord::Print(ostream & stream) const
   stream << "\n";
 }
 //___________________________________________________________________________
+void GHepRecord::Streamer(TBuffer & R__b)
+{
+// Up to version 2 the particle array was streamed member-wise, bypassing
+// GHepParticle::Streamer. From version 3 every particle is streamed by
+// GHepParticle::Streamer, which can write it in compact form.
+
+  if (R__b.IsReading()) {
+    UInt_t R__s, R__c;
+    Version_t R__v = R__b.ReadVersion(&R__s, &R__c);
+    this->BypassStreamer(R__v < 3);
+    R__b.ReadClassBuffer(GHepRecord::Class(), this, R__v, R__s, R__c);
+    fIdxValid = false;
+  } else {
+    this->BypassStreamer(kFALSE);
+    R__b.WriteClassBuffer(GHepRecord::Class(), this);
+  }
+}
+//___________________________________________________________________________
@@ -5,6 +5,13 @@
 
 \brief    GENIE's GHEP MC event record.
 
+          The searches by pdg and status code and the positions of the main
+          entries (probe, target, hit nucleon,...) are served from a transient
+          index of the record, built at the first query and kept up to date
+          as particles are appended. The index is rebuilt once the record is
+          re-arranged, or once the pdg or status code of a particle changes
+          (see GHepParticle::CodesGeneration()).
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,6 +28,7 @@
 
 #include <ostream>
 #include <vector>
+#include <utility>
 
 #include <TClonesArray.h>
 #include <TBits.h>
@@ -29,12 +37,14 @@
 #include "Framework/Conventions/KinePhaseSpace.h"
 #include "Framework/Interaction/Interaction.h" 
 #include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepEventCost.h"
 
 class TRootIOCtor;
 class TLorentzVector;
 
 using std::ostream;
 using std::vector;
+using std::pair;
 
 namespace genie {
 
@@ -60,6 +70,10 @@ public :
   virtual Interaction * Summary       (void) const;
   virtual void          AttachSummary (Interaction * interaction);
 
+  // Attach a copy of the input interaction, reset into the summary kept by
+  // a recycled record if there is one (see RecycleRecord())
+  virtual void          AttachSummaryCopy (const Interaction & interaction);
+
   // Provide a simplified wrapper of the 'new with placement'
   // TClonesArray object insertion method
   // ALWAYS use these methods to insert new particles as they check
@@ -136,6 +150,12 @@ public :
     fDiffXSec = (xsec>0) ? xsec : 0.; 
   }
 
+  // Set/get the computing cost of the event (not written by the streamer,
+  // see NtpWriter for writing it out)
+
+  virtual GHepEventCost Cost    (void) const;
+  virtual void          SetCost (const GHepEventCost & cost);
+
   // Set/get event vertex in detector coordinate system
 
   virtual TLorentzVector * Vertex (void) const { return fVtx; }
@@ -148,9 +168,17 @@ public :
   virtual void Copy        (const GHepRecord & record);
   virtual void Clear       (Option_t * opt="");
   virtual void ResetRecord (void);
+  virtual void RecycleRecord (void);
   virtual void CompactifyDaughterLists     (void);
   virtual void RemoveIntermediateParticles (void);
 
+  // Defer the daughter-list updates following particle insertions: while
+  // deferred, AddParticle() only appends to the record and the daughter
+  // lists are resolved at once when deferral is switched off. Entries keep
+  // their insertion positions until then.
+  virtual void DeferDaughterLists    (bool defer);
+  virtual bool DaughterListsDeferred (void) const { return fDeferDaughterLists; }
+
   // Set mask
   void SetUnphysEventMask(const TBits & mask);
 
@@ -167,6 +195,7 @@ protected:
 
   // Attached interaction
   Interaction * fInteraction; ///< attached summary information
+  Interaction * fSpareInteraction; //! summary kept by RecycleRecord(), for AttachSummaryCopy()
 
   // Vertex position
   TLorentzVector * fVtx;  ///< vertex in the detector coordinate system
@@ -182,23 +211,56 @@ protected:
   double           fDiffXSec;       ///< differential cross section for selected event kinematics
   KinePhaseSpace_t fDiffXSecPhSp;   ///< specifies which differential cross-section (dsig/dQ2, dsig/dQ2dW, dsig/dxdy,...)
 
+  // Computing cost of the event (see GHepEventCost)
+  Long64_t fCostCpuNs;        //! cpu time spent in the event generation modules (ns)
+  Int_t    fCostKineTrials;   //! kinematics selection trials
+  Int_t    fCostINukeSteps;   //! hadron transport steps
+  Int_t    fCostINukeRetries; //! hadron transport interaction retries
+  Int_t    fCostHadRetries;   //! hadronization retries
+  Int_t    fCostModuleStops;  //! modules that stopped the thread
+
   // Utility methods
   void InitRecord  (void);
   void CleanRecord (void);
 
+  // Transient particle index
+  bool IndexIsCurrent  (void) const;
+  void UpdateIndex     (void) const;
+  void IndexParticle   (int pos, bool was_current);
+  int  IndexedPosition (int pdg, GHepStatus_t ist, int start) const;
+
+  // Get a particle, in its initial state, at the input slot of the record
+  GHepParticle * NewParticle (unsigned int pos);
+
   // Methods used by the daughter list compactifier
   virtual void UpdateDaughterLists    (void);
   virtual bool HasCompactDaughterList (int pos);
   virtual void SwapParticles          (int i, int j);
   virtual void FinalizeDaughterLists  (void);
   virtual int  FirstNonInitStateEntry (void);
+  virtual void ResolveDaughterLists   (void);
 
   //
   static int fPrintLevel; //! print-level flag, see GHepRecord::Print()
 
+  // Deferred daughter-list updates, see DeferDaughterLists()
+  bool fDeferDaughterLists; //! are the daughter-list updates deferred?
+  int  fFirstDeferred;      //! first entry appended while deferred (-1 if none)
+
+  // Transient particle index, see UpdateIndex()
+  mutable bool         fIdxValid;       //! is the index built?
+  mutable unsigned int fIdxGeneration;  //! GHepParticle::CodesGeneration() when last updated
+  mutable int          fIdxEntries;     //! number of indexed slots
+  mutable vector< pair<ULong64_t,int> > fIdxCodes; //! sorted (pdg/status key, position) pairs
+  mutable int          fIdxMode;        //! cached event generation mode
+  mutable int          fIdxProbe;       //! cached probe position
+  mutable int          fIdxTarget;      //! cached target nucleus position
+  mutable int          fIdxHitNucleon;  //! cached hit nucleon position
+  mutable int          fIdxHitElectron; //! cached hit electron position
+
 private:
 
-ClassDef(GHepRecord, 2)
+ClassDef(GHepRecord, 3)
 
 };
 
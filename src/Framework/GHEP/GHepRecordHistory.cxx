@@ -10,6 +10,11 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   Snapshots can be kept for registered rewind steps (KeepSnapshot) on top
+   of the bootstrap record. Purged snapshot records are recycled instead of
+   being deleted. Fixed PurgeRecentHistory() which erased map entries while
+   iterating over them and leaked the purged records.
 
 */
 //____________________________________________________________________________
@@ -51,14 +56,19 @@ map<int, GHepRecord*>()
 GHepRecordHistory::~GHepRecordHistory()
 {
   this->PurgeHistory();
+
+  vector<GHepRecord *>::iterator riter = fFreeSnapshots.begin();
+  for( ; riter != fFreeSnapshots.end(); ++riter) {
+    delete *riter;
+  }
+  fFreeSnapshots.clear();
 }
 //___________________________________________________________________________
 void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
 {
 // Adds a GHepRecord 'snapshot' at the history buffer
 
-  bool go_on = (fEnabledFull || (fEnabledBootstrapStep && step==-1));
-  if(!go_on) return;
+  if(!this->WantsSnapshot(step)) return;
 
   if(!record) {
    LOG("GHEP", pWARN)
@@ -71,7 +81,16 @@ void GHepRecordHistory::AddSnapshot(int step, GHepRecord * record)
      LOG("GHEP", pNOTICE)
                      << "Adding GHEP snapshot for processing step: " << step;
 
-     GHepRecord * snapshot = new GHepRecord(*record);
+     // reuse a purged snapshot record if there is one
+     // (GHepRecord::Copy() keeps the already allocated entries)
+     GHepRecord * snapshot = 0;
+     if(fFreeSnapshots.empty()) {
+       snapshot = new GHepRecord(*record);
+     } else {
+       snapshot = fFreeSnapshots.back();
+       fFreeSnapshots.pop_back();
+       snapshot->Copy(*record);
+     }
      this->insert( map<int, GHepRecord*>::value_type(step,snapshot));
 
   } else {
@@ -95,11 +114,7 @@ void GHepRecordHistory::PurgeHistory(void)
     LOG("GHEP", pINFO) 
                   << "Deleting GHEP snapshot for processing step: " << step;
 
-    GHepRecord * record = history_iter->second;
-    if(record) {
-      delete record;
-      record = 0;
-    }
+    this->RecycleSnapshot(history_iter->second);
   }
   this->clear();
 }
@@ -127,23 +142,55 @@ void GHepRecordHistory::PurgeRecentHistory(int start_step)
     return;
   }
 
-  GHepRecordHistory::iterator history_iter;
-  for(history_iter = this->begin();
-                              history_iter != this->end(); ++history_iter) {
-
-    if(history_iter->first >= start_step) { 
-       int step = history_iter->first;
-       LOG("GHEP", pINFO) 
+  GHepRecordHistory::iterator history_iter = this->lower_bound(start_step);
+  while(history_iter != this->end()) {
+     int step = history_iter->first;
+     LOG("GHEP", pINFO) 
                   << "Deleting GHEP snapshot for processing step: " << step;
-       this->erase(history_iter); 
-    }
+     this->RecycleSnapshot(history_iter->second);
+     this->erase(history_iter++);
+  }
+}
+//___________________________________________________________________________
+void GHepRecordHistory::KeepSnapshot(int step)
+{
+// Register a processing step whose snapshot must always be taken, eg because
+// a later processing step can request to return to the step that follows it
+
+  if(fKeptSteps.insert(step).second) {
+    LOG("GHEP", pNOTICE)
+       << "GHEP snapshots will be kept for processing step: " << step;
   }
 }
 //___________________________________________________________________________
+bool GHepRecordHistory::WantsSnapshot(int step) const
+{
+  if(fEnabledFull) return true;
+  if(fEnabledBootstrapStep && step==-1) return true;
+
+  return (fKeptSteps.count(step) > 0);
+}
+//___________________________________________________________________________
+bool GHepRecordHistory::HasSnapshot(int step) const
+{
+  GHepRecordHistory::const_iterator history_iter = this->find(step);
+  return (history_iter != this->end() && history_iter->second != 0);
+}
+//___________________________________________________________________________
+void GHepRecordHistory::RecycleSnapshot(GHepRecord * record)
+{
+  if(!record) return;
+
+  record->RecycleRecord();
+  fFreeSnapshots.push_back(record);
+}
+//___________________________________________________________________________
 void GHepRecordHistory::Copy(const GHepRecordHistory & history)
 {
   this->PurgeHistory();
 
+  fKeptSteps = history.fKeptSteps;
+
   GHepRecordHistory::const_iterator history_iter;
   for(history_iter = history.begin();
                            history_iter != history.end(); ++history_iter) {
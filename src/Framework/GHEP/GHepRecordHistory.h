@@ -8,6 +8,10 @@
           The event record history can be used to step back in the generation
           sequence if a processing step is to be re-run (this the GENIE event
           generation framework equivalent of an 'Undo')
+          Snapshots are taken only for the bootstrap record (step -1) and for
+          steps registered as rewind targets with KeepSnapshot(), unless the
+          full history is enabled ($GHEPHISTENABLE=FULL). Purged snapshot
+          records are recycled by later snapshots.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -24,10 +28,14 @@
 #define _GHEP_RECORD_HISTORY_H_
 
 #include <map>
+#include <set>
+#include <vector>
 #include <string>
 #include <ostream>
 
 using std::map;
+using std::set;
+using std::vector;
 using std::string;
 using std::ostream;
 
@@ -50,6 +58,9 @@ public :
   void PurgeHistory       (void);
   void PurgeRecentHistory (int start_step);
   void ReadFlags          (void);
+  void KeepSnapshot       (int step);       ///< always take a snapshot after this step
+  bool WantsSnapshot      (int step) const; ///< is a snapshot taken after this step?
+  bool HasSnapshot        (int step) const;
 
   void Copy  (const GHepRecordHistory & history);
   void Print (ostream & stream) const;
@@ -58,8 +69,12 @@ public :
 
 private:
 
+  void RecycleSnapshot (GHepRecord * record);
+
   bool fEnabledFull;          ///< keep the full GHEP record history
   bool fEnabledBootstrapStep; ///< keep only the record that bootsrapped the generation cycle
+  set<int>             fKeptSteps;     ///< steps (rewind targets) whose snapshots are always taken
+  vector<GHepRecord *> fFreeSnapshots; ///< purged snapshot records, to be reused
 };
 
 }      // genie namespace
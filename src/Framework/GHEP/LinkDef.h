@@ -7,8 +7,12 @@
 #pragma link C++ namespace genie;
 #pragma link C++ namespace genie::utils::ghep;
 
-#pragma link C++ class genie::GHepParticle+;
-#pragma link C++ class genie::GHepRecord+;
+#pragma link C++ class genie::GHepParticle-;
+#pragma read sourceClass="genie::GHepParticle" version="[-2]" \
+             source="TLorentzVector * fP4; TLorentzVector * fX4" \
+             targetClass="genie::GHepParticle" target="fP4, fX4" \
+             code="{ if(onfile.fP4) fP4 = *onfile.fP4; if(onfile.fX4) fX4 = *onfile.fX4; }"
+#pragma link C++ class genie::GHepRecord-;
 #pragma link C++ class genie::GHepRecordHistory;
 #pragma link C++ class genie::GHepVirtualList;
 #pragma link C++ class genie::GHepVirtualListFolder;
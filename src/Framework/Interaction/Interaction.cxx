@@ -84,6 +84,19 @@ void Interaction::Reset(void)
   this->Init();
 }
 //___________________________________________________________________________
+void Interaction::Reset(const Interaction & prototype)
+{
+// Resets the interaction to a copy of the input prototype. Unlike the copy
+// constructor, it reuses the storage of the interaction and allocates nothing.
+
+  this->Copy(prototype);
+
+  this->ResetBit(kISkipProcessChk);
+  this->ResetBit(kISkipKinematicChk);
+  this->ResetBit(kIAssumeFreeNucleon);
+  this->ResetBit(kINoNuclearCorrection);
+}
+//___________________________________________________________________________
 void Interaction::Init(void)
 {
   fInitialState = new InitialState ();
@@ -273,6 +286,62 @@ string Interaction::AsString(void) const
   return interaction.str();
 }
 //___________________________________________________________________________
+ULong64_t Interaction::Signature(void) const
+{
+  return this->Signature("");
+}
+//___________________________________________________________________________
+ULong64_t Interaction::Signature(const string & prefix) const
+{
+// Code-ify the interaction in a 64-bit integer to be used as (part of a)
+// cache branch or spline look-up key. It is built from the same information
+// as AsString() (FNV-1a hash, folded with the input prefix) but it avoids
+// any string formatting, so that it can be cheaply computed for every event.
+// Equal interactions have equal signatures. The chance that two of the (at
+// most few thousand) interactions seen in a job share a signature is ~1E-13.
+
+  const ULong64_t kFNVOffset = 14695981039346656037ULL;
+  const ULong64_t kFNVPrime  = 1099511628211ULL;
+
+  ULong64_t h = kFNVOffset;
+  for(string::size_type i = 0; i < prefix.size(); i++) {
+    h ^= (ULong64_t) (unsigned char) prefix[i];
+    h *= kFNVPrime;
+  }
+
+  const Target & tgt = fInitialState->Tgt();
+
+  int code[19];
+  code[ 0] = fInitialState->ProbePdg();
+  code[ 1] = tgt.Pdg();
+  code[ 2] = tgt.HitNucIsSet() ? tgt.HitNucPdg() : 0;
+  code[ 3] = tgt.HitQrkIsSet() ? tgt.HitQrkPdg() : 0;
+  code[ 4] = tgt.HitQrkIsSet() ? (tgt.HitSeaQrk() ? 2 : 1) : 0;
+  code[ 5] = (int) fProcInfo->InteractionTypeId();
+  code[ 6] = (int) fProcInfo->ScatteringTypeId();
+  code[ 7] = fExclusiveTag->IsCharmEvent()   ? 1 : 0;
+  code[ 8] = fExclusiveTag->CharmHadronPdg();
+  code[ 9] = fExclusiveTag->IsStrangeEvent() ? 1 : 0;
+  code[10] = fExclusiveTag->StrangeHadronPdg();
+  code[11] = fExclusiveTag->NProtons();
+  code[12] = fExclusiveTag->NNeutrons();
+  code[13] = fExclusiveTag->NPi0();
+  code[14] = fExclusiveTag->NPiPlus();
+  code[15] = fExclusiveTag->NPiMinus();
+  code[16] = (int) fExclusiveTag->Resonance();
+  code[17] = fExclusiveTag->DecayMode();
+  code[18] = (int) prefix.size();
+
+  for(int i = 0; i < 19; i++) {
+    unsigned int c = (unsigned int) code[i];
+    for(int j = 0; j < 4; j++) {
+      h ^= (ULong64_t) ((c >> (8*j)) & 0xff);
+      h *= kFNVPrime;
+    }
+  }
+  return h;
+}
+//___________________________________________________________________________
 void Interaction::Print(ostream & stream) const
 {
   const string line(110, '-');
@@ -92,10 +92,16 @@ public:
 
   // Copy, reset, print itself and build string code
   void   Reset    (void);
+  void   Reset    (const Interaction & prototype);
   void   Copy     (const Interaction & i);
   string AsString (void) const;
   void   Print    (ostream & stream) const;
 
+  // Compact 64-bit hash of the information coded in AsString(), optionally
+  // folded with a prefix (eg an algorithm key) - for fast cache look-ups
+  ULong64_t Signature (void) const;
+  ULong64_t Signature (const string & prefix) const;
+
   // Overloaded operators
   Interaction &    operator =  (const Interaction & i);                   ///< copy
   friend ostream & operator << (ostream & stream, const Interaction & i); ///< print
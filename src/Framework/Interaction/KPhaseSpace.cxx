@@ -9,6 +9,11 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions :
+ @ Oct 14, 2026 - CA
+   Memoize the energy threshold and the W, Q2, q2, x and y limits, until the
+   initial state, process or exclusive tag of the interaction change.
 */
 //____________________________________________________________________________
 
@@ -76,9 +81,56 @@ double KPhaseSpace::GetTMaxDFR()
 void KPhaseSpace::UseInteraction(const Interaction * in)
 {
   fInteraction = in;
+  fMemoMask    = 0;
+}
+//___________________________________________________________________________
+void KPhaseSpace::CheckMemo(void) const
+{
+// Forget the memoized values if anything they depend on has changed since
+// they were computed. The key is built from the stored quantities only (no
+// frame transformations or allocations), so the check is cheap.
+
+  const InitialState &   init_state = fInteraction->InitState();
+  const Target &         tgt        = init_state.Tgt();
+  const ProcessInfo &    pi         = fInteraction->ProcInfo();
+  const XclsTag &        xcls       = fInteraction->ExclTag();
+  const TLorentzVector * k4         = init_state.ProbeP4Ptr();
+  const TLorentzVector * p4         = tgt.HitNucP4Ptr();
+
+  double key[kNMemoKey] = {
+    k4->E(), k4->Px(), k4->Py(), k4->Pz(),
+    (p4) ? p4->E()  : 0., (p4) ? p4->Px() : 0.,
+    (p4) ? p4->Py() : 0., (p4) ? p4->Pz() : 0.,
+    (double) init_state.ProbePdg(),
+    (double) tgt.Pdg(),
+    (double) tgt.HitNucPdg(),
+    (double) pi.ScatteringTypeId(),
+    (double) pi.InteractionTypeId(),
+    (double) xcls.IsCharmEvent(),
+    (double) xcls.CharmHadronPdg(),
+    (double) xcls.StrangeHadronPdg(),
+    (double) xcls.NProtons()
+  };
+
+  bool same = (fMemoMask != 0);
+  for(int i = 0; i < kNMemoKey; i++) {
+    if(same && key[i] != fMemoKey[i]) same = false;
+    fMemoKey[i] = key[i];
+  }
+  if(!same) fMemoMask = 0;
 }
 //___________________________________________________________________________
 double KPhaseSpace::Threshold(void) const
+{
+  this->CheckMemo();
+  if(!(fMemoMask & kMemoThreshold)) {
+    fMemoThreshold = this->ComputeThreshold();
+    fMemoMask |= kMemoThreshold;
+  }
+  return fMemoThreshold;
+}
+//___________________________________________________________________________
+double KPhaseSpace::ComputeThreshold(void) const
 {
   const ProcessInfo &  pi         = fInteraction->ProcInfo();
   const InitialState & init_state = fInteraction->InitState();
@@ -92,8 +144,8 @@ double KPhaseSpace::Threshold(void) const
     double Mi   = tgt.HitNucP4Ptr()->M(); // initial nucleon mass
     // Final nucleon can be different for K0 interaction
     double Mf = (xcls.NProtons()==1) ? kProtonMass : kNeutronMass;
-    double mk   = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass();
-  //double ml   = PDGLibrary::Instance()->Find(fInteraction->FSPrimLeptonPdg())->Mass();
+    double mk   = PDGLibrary::Instance()->Mass(kaon_pdgc);
+  //double ml   = PDGLibrary::Instance()->Mass(fInteraction->FSPrimLeptonPdg());
     double mtot = ml + mk + Mf; // total mass of FS particles
     double Ethresh = (mtot*mtot - Mi*Mi)/(2. * Mf);
     return Ethresh;
@@ -102,7 +154,7 @@ double KPhaseSpace::Threshold(void) const
   if (pi.IsCoherent()) {
     int tgtpdgc = tgt.Pdg(); // nuclear target PDG code (10LZZZAAAI)
     double mpi  = pi.IsWeakCC() ? kPionMass : kPi0Mass;
-    double MA   = PDGLibrary::Instance()->Find(tgtpdgc)->Mass();
+    double MA   = PDGLibrary::Instance()->Mass(tgtpdgc);
     double m    = ml + mpi;
     double m2   = TMath::Power(m,2);
     double Ethr = m + 0.5*m2/MA;
@@ -124,7 +176,7 @@ double KPhaseSpace::Threshold(void) const
     if ( pi.IsQuasiElastic() || pi.IsDarkMatterElastic() || pi.IsInverseBetaDecay() ) {
       int finalNucPDG = tgt.HitNucPdg();
       if ( pi.IsWeakCC() ) finalNucPDG = pdg::SwitchProtonNeutron( finalNucPDG );
-      Wmin = PDGLibrary::Instance()->Find( finalNucPDG )->Mass();
+      Wmin = PDGLibrary::Instance()->Mass( finalNucPDG );
     }
     if (pi.IsResonant()) {
         Wmin = kNucleonMass + kPhotontest;
@@ -135,7 +187,7 @@ double KPhaseSpace::Threshold(void) const
           Wmin = kNucleonMass+kLightestChmHad;
        } else {
           int cpdg = xcls.CharmHadronPdg();
-          double mchm = PDGLibrary::Instance()->Find(cpdg)->Mass();
+          double mchm = PDGLibrary::Instance()->Mass(cpdg);
           if(pi.IsQuasiElastic() || pi.IsInverseBetaDecay()) {
             Wmin = mchm + controls::kASmallNum;
           }
@@ -367,6 +419,16 @@ bool KPhaseSpace::IsAllowed(void) const
 }
 //___________________________________________________________________________
 Range1D_t KPhaseSpace::WLim(void) const
+{
+  this->CheckMemo();
+  if(!(fMemoMask & kMemoW)) {
+    fMemoW = this->ComputeWLim();
+    fMemoMask |= kMemoW;
+  }
+  return fMemoW;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeWLim(void) const
 {
 // Computes hadronic invariant mass limits.
 // For QEL the range reduces to the recoil nucleon mass.
@@ -498,6 +560,16 @@ Range1D_t KPhaseSpace::q2Lim_W(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::Q2Lim(void) const
+{
+  this->CheckMemo();
+  if(!(fMemoMask & kMemoQ2)) {
+    fMemoQ2 = this->ComputeQ2Lim();
+    fMemoMask |= kMemoQ2;
+  }
+  return fMemoQ2;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeQ2Lim(void) const
 {
   // Computes momentum transfer (Q2>0) limits irrespective of the invariant mass
   // For QEL this is identical to Q2Lim_W (since W is fixed)
@@ -537,10 +609,10 @@ Range1D_t KPhaseSpace::Q2Lim(void) const
     double W = fInteraction->RecoilNucleon()->Mass();
     if(xcls.IsCharmEvent()) {
       int charm_pdgc = xcls.CharmHadronPdg();
-      W = PDGLibrary::Instance()->Find(charm_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(charm_pdgc);
     }  else if(xcls.IsStrangeEvent()) {
       int strange_pdgc = xcls.StrangeHadronPdg();
-      W = PDGLibrary::Instance()->Find(strange_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(strange_pdgc);
     }
     if (pi.IsInverseBetaDecay()) {
       Q2l = kinematics::InelQ2Lim_W(Ev,M,ml,W,controls::kMinQ2Limit_VLE);
@@ -556,10 +628,10 @@ Range1D_t KPhaseSpace::Q2Lim(void) const
     double W = fInteraction->RecoilNucleon()->Mass();
     if(xcls.IsCharmEvent()) {
       int charm_pdgc = xcls.CharmHadronPdg();
-      W = PDGLibrary::Instance()->Find(charm_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(charm_pdgc);
     }  else if(xcls.IsStrangeEvent()) {
       int strange_pdgc = xcls.StrangeHadronPdg();
-      W = PDGLibrary::Instance()->Find(strange_pdgc)->Mass();
+      W = PDGLibrary::Instance()->Mass(strange_pdgc);
     }
     if (pi.IsInverseBetaDecay()) {
       Q2l = kinematics::DarkQ2Lim_W(Ev,M,ml,W,controls::kMinQ2Limit_VLE);
@@ -603,6 +675,16 @@ Range1D_t KPhaseSpace::q2Lim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::XLim(void) const
+{
+  this->CheckMemo();
+  if(!(fMemoMask & kMemoX)) {
+    fMemoX = this->ComputeXLim();
+    fMemoMask |= kMemoX;
+  }
+  return fMemoX;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeXLim(void) const
 {
   // Computes x-limits;
 
@@ -657,6 +739,16 @@ Range1D_t KPhaseSpace::XLim(void) const
 }
 //____________________________________________________________________________
 Range1D_t KPhaseSpace::YLim(void) const
+{
+  this->CheckMemo();
+  if(!(fMemoMask & kMemoY)) {
+    fMemoY = this->ComputeYLim();
+    fMemoMask |= kMemoY;
+  }
+  return fMemoY;
+}
+//____________________________________________________________________________
+Range1D_t KPhaseSpace::ComputeYLim(void) const
 {
   Range1D_t yl;
   yl.min = -1;
@@ -5,6 +5,12 @@
 
 \brief    Kinematical phase space 
 
+          The energy threshold and the limits that do not depend on other
+          kinematic variables (WLim, Q2Lim, q2Lim, XLim, YLim) are memoized:
+          they are recomputed only when the initial state (probe and hit
+          nucleon 4-momenta, target), the process or the exclusive channel
+          tag of the interaction change.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -71,8 +77,33 @@ public:
 private:
   void Init(void);
 
+  //! memoization of the limits that depend only on the initial state
+  enum EMemo {
+    kMemoThreshold = 1<<0,
+    kMemoW         = 1<<1,
+    kMemoQ2        = 1<<2,
+    kMemoX         = 1<<3,
+    kMemoY         = 1<<4
+  };
+  static const int kNMemoKey = 17;
+
+  void      CheckMemo      (void) const;
+  double    ComputeThreshold (void) const;
+  Range1D_t ComputeWLim    (void) const;
+  Range1D_t ComputeQ2Lim   (void) const;
+  Range1D_t ComputeXLim    (void) const;
+  Range1D_t ComputeYLim    (void) const;
+
   const Interaction * fInteraction;
 
+  mutable double    fMemoKey[kNMemoKey]; //! initial state the memoized values refer to
+  mutable int       fMemoMask;           //! memoized values (EMemo bits)
+  mutable double    fMemoThreshold;      //!
+  mutable Range1D_t fMemoW;              //!
+  mutable Range1D_t fMemoQ2;             //!
+  mutable Range1D_t fMemoX;              //!
+  mutable Range1D_t fMemoY;              //!
+
 ClassDef(KPhaseSpace,2)
 };
 
@@ -14,6 +14,10 @@
    Adding special ctor for ROOT I/O purposes so as to avoid memory leak due to
    memory allocated in the default ctor when objects of this class are read by
    the ROOT Streamer.
+ @ Oct 14, 2026 - CA
+   Hold the kinematic variables in a fixed array indexed by KineVar_t plus a
+   bit mask of the set ones, instead of a map. Files written with the map
+   (class version <= 2) are converted by a read rule (see LinkDef.h).
 
 */
 //____________________________________________________________________________
@@ -22,6 +26,7 @@
 #include <TLorentzVector.h>
 #include <TRootIOCtor.h>
 
+#include "Framework/Conventions/GBuild.h"
 #include "Framework/Interaction/Kinematics.h"
 #include "Framework/Messenger/Messenger.h"
 
@@ -55,6 +60,7 @@ TObject()
 //____________________________________________________________________________
 Kinematics::Kinematics(TRootIOCtor*) :
 TObject(),
+fKVSet(0),
 fP4Fsl(0),
 fP4HadSyst(0)
 {
@@ -68,7 +74,7 @@ Kinematics::~Kinematics()
 //____________________________________________________________________________
 void Kinematics::Init(void)
 {
-  fKV.clear();
+  fKVSet = 0;
 
   fP4Fsl     = new TLorentzVector;
   fP4HadSyst = new TLorentzVector;
@@ -76,7 +82,7 @@ void Kinematics::Init(void)
 //____________________________________________________________________________
 void Kinematics::CleanUp(void)
 {
-  fKV.clear();
+  fKVSet = 0;
 
   delete fP4Fsl;
   delete fP4HadSyst;
@@ -84,7 +90,7 @@ void Kinematics::CleanUp(void)
 //____________________________________________________________________________
 void Kinematics::Reset(void)
 {
-  fKV.clear();
+  fKVSet = 0;
 
   this->SetFSLeptonP4 (0,0,0,0);
   this->SetHadSystP4  (0,0,0,0);
@@ -94,12 +100,9 @@ void Kinematics::Copy(const Kinematics & kinematics)
 {
   this->Reset();
 
-  map<KineVar_t, double>::const_iterator iter;
-
-  for(iter = kinematics.fKV.begin(); iter != kinematics.fKV.end(); ++iter) {
-    KineVar_t kv  = iter->first;
-    double    val = iter->second;
-    this->SetKV(kv,val);
+  fKVSet = kinematics.fKVSet;
+  for(int i = 0; i < kNumOfKineVar; i++) {
+    if((fKVSet >> i) & 1) fKV[i] = kinematics.fKV[i];
   }
 
   this->SetFSLeptonP4 (*kinematics.fP4Fsl);
@@ -324,17 +327,10 @@ void Kinematics::SetHadSystP4(double px, double py, double pz, double E)
   fP4HadSyst->SetPxPyPzE(px,py,pz,E);
 }
 //____________________________________________________________________________
-bool Kinematics::KVSet(KineVar_t kv) const
-{
-  if(fKV.count(kv) == 1) return true;
-  else return false;
-}
-//____________________________________________________________________________
 double Kinematics::GetKV(KineVar_t kv) const
 {
   if(this->KVSet(kv)) {
-     map<KineVar_t, double>::const_iterator iter = fKV.find(kv);
-     return iter->second;
+     return fKV[kv];
   } else {
     LOG("Interaction", pWARN)
         << "Kinematic variable: " << KineVar::AsString(kv) << " was not set";
@@ -344,57 +340,47 @@ double Kinematics::GetKV(KineVar_t kv) const
 //____________________________________________________________________________
 void Kinematics::SetKV(KineVar_t kv, double value)
 {
+  if(kv < 0 || kv >= kNumOfKineVar) {
+    LOG("Interaction", pERROR) << "Unknown kinematic variable: " << (int)kv;
+    return;
+  }
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Interaction", pDEBUG)
             << "Setting " << KineVar::AsString(kv) << " to " << value;
+#endif
 
-  if(this->KVSet(kv)) {
-     fKV[kv] = value;
-  } else {
-     fKV.insert( map<KineVar_t, double>::value_type(kv,value) );
-  }
+  fKV[kv]  = value;
+  fKVSet  |= (1ULL << kv);
 }
 //____________________________________________________________________________
 void Kinematics::ClearRunningValues(void)
 {
 // clear the running values (leave the selected ones)
 //
-  fKV.erase( kKVx  );
-  fKV.erase( kKVy  );
-  fKV.erase( kKVQ2 );
-  fKV.erase( kKVq2 );
-  fKV.erase( kKVW  );
-  fKV.erase( kKVt  );
+  fKVSet &= ~( (1ULL << kKVx ) | (1ULL << kKVy) | (1ULL << kKVQ2) |
+               (1ULL << kKVq2) | (1ULL << kKVW) | (1ULL << kKVt ) );
 }
 //____________________________________________________________________________
 void Kinematics::UseSelectedKinematics(void)
 {
 // copy the selected kinematics into the running ones
 //
-  map<KineVar_t, double>::const_iterator iter;
-  iter = fKV.find(kKVSelx);
-  if(iter != fKV.end()) this->Setx(iter->second);
-  iter = fKV.find(kKVSely);
-  if(iter != fKV.end()) this->Sety(iter->second);
-  iter = fKV.find(kKVSelQ2);
-  if(iter != fKV.end()) this->SetQ2(iter->second);
-  iter = fKV.find(kKVSelq2);
-  if(iter != fKV.end()) this->Setq2(iter->second);
-  iter = fKV.find(kKVSelW);
-  if(iter != fKV.end()) this->SetW(iter->second);
-  iter = fKV.find(kKVSelt);
-  if(iter != fKV.end()) this->Sett(iter->second);
+  if(this->KVSet(kKVSelx )) this->Setx (fKV[kKVSelx ]);
+  if(this->KVSet(kKVSely )) this->Sety (fKV[kKVSely ]);
+  if(this->KVSet(kKVSelQ2)) this->SetQ2(fKV[kKVSelQ2]);
+  if(this->KVSet(kKVSelq2)) this->Setq2(fKV[kKVSelq2]);
+  if(this->KVSet(kKVSelW )) this->SetW (fKV[kKVSelW ]);
+  if(this->KVSet(kKVSelt )) this->Sett (fKV[kKVSelt ]);
 }
 //____________________________________________________________________________
 void Kinematics::Print(ostream & stream) const
 {
   stream << "[-] [Kinematics]" << endl;
 
-  map<KineVar_t, double>::const_iterator iter;
-
-  for(iter = fKV.begin(); iter != fKV.end(); ++iter) {
-    KineVar_t kv  = iter->first;
-    double    val = iter->second;
-    stream << " |--> " << KineVar::AsString(kv) << " = " << val << endl;
+  for(int i = 0; i < kNumOfKineVar; i++) {
+    if(!((fKVSet >> i) & 1)) continue;
+    KineVar_t kv = (KineVar_t) i;
+    stream << " |--> " << KineVar::AsString(kv) << " = " << fKV[i] << endl;
   }
 }
 //____________________________________________________________________________
@@ -3,7 +3,10 @@
 
 \class    genie::Kinematics
 
-\brief    Generated/set kinematical variables for an event
+\brief    Generated/set kinematical variables for an event.
+          The variables are held in a fixed array indexed by KineVar_t, with
+          a bit mask of the ones that are set, as they are looked up in every
+          cross section calculation.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -78,7 +81,7 @@ public:
   void   SetHadSystP4  (const TLorentzVector & p4);
   void   SetHadSystP4  (double px, double py, double pz, double E);
 
-  bool   KVSet(KineVar_t kv) const;
+  bool   KVSet(KineVar_t kv) const { return (fKVSet >> kv) & 1; }
   double GetKV(KineVar_t kv) const;
   void   SetKV(KineVar_t kv, double value);
 
@@ -100,11 +103,12 @@ private:
 
   //-- Private data members
 
-  map<KineVar_t, double> fKV;        ///< selected kinematics
-  TLorentzVector *       fP4Fsl;     ///< generated final state primary lepton 4-p  (LAB)
-  TLorentzVector *       fP4HadSyst; ///< generated final state hadronic system 4-p (LAB)
+  double           fKV[kNumOfKineVar]; ///< running & selected kinematics
+  ULong64_t        fKVSet;             ///< bit mask of the set fKV entries
+  TLorentzVector * fP4Fsl;             ///< generated final state primary lepton 4-p  (LAB)
+  TLorentzVector * fP4HadSyst;         ///< generated final state hadronic system 4-p (LAB)
 
-ClassDef(Kinematics,2)
+ClassDef(Kinematics,3)
 };
 
 }       // genie namespace
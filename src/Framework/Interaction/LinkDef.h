@@ -11,11 +11,18 @@
 #pragma link C++ class genie::Target;
 #pragma link C++ class genie::ProcessInfo;
 #pragma link C++ class genie::Kinematics+;
+#pragma read sourceClass="genie::Kinematics" version="[-2]" \
+             source="std::map<genie::KineVar_t,double> fKV" \
+             targetClass="genie::Kinematics" target="fKV, fKVSet" \
+             code="{ fKVSet = 0; std::map<genie::KineVar_t,double>::const_iterator it; \
+                     for(it = onfile.fKV.begin(); it != onfile.fKV.end(); ++it) { \
+                       if(it->first < 0 || it->first >= genie::kNumOfKineVar) continue; \
+                       fKV[it->first] = it->second; fKVSet |= (1ULL << it->first); } }"
 #pragma link C++ class genie::XclsTag;
 #pragma link C++ class genie::KPhaseSpace;
 
-#pragma link C++ class std::map<genie::KineVar_t,double>+; // in Kinematics object
-#pragma link C++ class std::pair<genie::KineVar_t,double>+; // in Kinematics object
+#pragma link C++ class std::map<genie::KineVar_t,double>+; // in Kinematics object (version <= 2)
+#pragma link C++ class std::pair<genie::KineVar_t,double>+; // in Kinematics object (version <= 2)
 
 #pragma link C++ ioctortype TRootIOCtor;
 
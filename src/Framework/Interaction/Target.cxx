@@ -193,7 +193,7 @@ void Target::SetHitNucPdg(int nucl_pdgc)
   // If it is a valid struck nucleon pdg code, initialize its 4P:
   // at-rest + on-mass-shell
   if(is_valid) {
-    double M = PDGLibrary::Instance()->Find(nucl_pdgc)->Mass();
+    double M = PDGLibrary::Instance()->Mass(nucl_pdgc);
     fHitNucP4->SetPxPyPzE(0,0,0,M);
   }
 }
@@ -253,7 +253,7 @@ double Target::HitNucMass(void) const
     LOG("Target", pWARN) << "Returning struck nucleon mass = 0";
     return 0;
   }
-  return PDGLibrary::Instance()->Find(fHitNucPDG)->Mass();
+  return PDGLibrary::Instance()->Mass(fHitNucPDG);
 }
 //___________________________________________________________________________
 int Target::HitQrkPdg(void) const
@@ -26,10 +26,14 @@
  @ Jan 31, 2013 - CA
    The $GMSGCONF var is no longer used. Instead, call 
    Messenger::SetPrioritiesFromXmlFile(string filename) explicitly.
+ @ Oct 14, 2026 - CA
+   Write messages through MsgAppender, which can hand them to a background
+   writer thread ($GMSGASYNC) and suppress repeated messages ($GMSGMAXREPEAT).
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
 #include <iostream>
 #include <vector>
 #include <iomanip>
@@ -41,6 +45,7 @@
 #include <TSystem.h>
 
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Messenger/MsgAppender.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XmlParserUtils.h"
@@ -61,6 +66,7 @@ Messenger * Messenger::fInstance = 0;
 Messenger::Messenger()
 {
   fInstance =  0;
+  fAppender =  0;
 }
 //____________________________________________________________________________
 Messenger::~Messenger()
@@ -80,8 +86,7 @@ Messenger * Messenger::Instance()
 
     fInstance = new Messenger;
 
-    log4cpp::Appender * appender;
-    appender = new log4cpp::OstreamAppender("default", &cout);
+    MsgAppender * appender = new MsgAppender("default", &cout);
     const char* layoutenv = gSystem->Getenv("GMSGLAYOUT");
     std::string layoutstr = (layoutenv) ? string(layoutenv) : "BASIC";
     if ( layoutstr == "SIMPLE" ) 
@@ -94,6 +99,12 @@ Messenger * Messenger::Instance()
 
     MSG.setAdditivity(false);
     MSG.addAppender(appender);
+    fInstance->fAppender = appender;
+
+    const char * maxrepeat = gSystem->Getenv("GMSGMAXREPEAT");
+    if(maxrepeat) fInstance->SetMaxRepeats(atol(maxrepeat));
+    const char * async = gSystem->Getenv("GMSGASYNC");
+    if(async) fInstance->SetAsyncOutput(true, atoi(async));
 
     fInstance->Configure(); // set user-defined priority levels
   }
@@ -115,6 +126,26 @@ void Messenger::SetPriorityLevel(
   MSG.setPriority(priority);
 }
 //____________________________________________________________________________
+bool Messenger::SetAsyncOutput(bool on, unsigned int queue_size)
+{
+  if(!on) {
+    fAppender->StopWriterThread();
+    return true;
+  }
+  if(queue_size == 0) queue_size = 4096;
+  bool ok = fAppender->StartWriterThread(queue_size);
+  if(!ok) {
+    SLOG("Messenger", pWARN)
+      << "Couldn't start the message writer thread - Writing synchronously";
+  }
+  return ok;
+}
+//____________________________________________________________________________
+void Messenger::SetMaxRepeats(long nmax)
+{
+  fAppender->SetMaxRepeats(nmax);
+}
+//____________________________________________________________________________
 void Messenger::Configure(void)
 {
 // The Configure() method will look for priority level xml config files, read
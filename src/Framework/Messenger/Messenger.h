@@ -75,6 +75,36 @@ using std::string;
   #define ENDL std::endl
 #endif
 
+/*!
+  \def   __GENIE_COMPILED_MESG_LEVEL__
+  \brief Least important message priority (as a log4cpp::Priority value) that
+         is compiled in. It is set at configuration time (see the
+         --with-compiled-mesg-level option) and defaults to pDEBUG, ie all
+         messages are compiled in. The bodies of less important messages are
+         dead code which the compiler removes, so that they cost nothing.
+
+  \def   GENIE_MSG_ON(stream, priority)
+  \brief True if a message of the given priority is compiled in and enabled,
+         at run time, for the given stream.
+
+  \def   GENIE_MSG_IF(stream, priority)
+  \brief Executes the message statement that follows only if GENIE_MSG_ON,
+         so that the message arguments are evaluated (and formatted) lazily.
+         Written as a for() so that it is safe to use with an unbraced if/else.
+*/
+
+#ifndef __GENIE_COMPILED_MESG_LEVEL__
+#define __GENIE_COMPILED_MESG_LEVEL__ 700
+#endif
+
+#define GENIE_MSG_ON(stream, priority) \
+           ( (priority) <= __GENIE_COMPILED_MESG_LEVEL__ && \
+             (*Messenger::Instance())(stream).isPriorityEnabled(priority) )
+
+#define GENIE_MSG_IF(stream, priority) \
+           for(bool genie_msg_on_ = GENIE_MSG_ON(stream, priority); \
+                    genie_msg_on_; genie_msg_on_ = false)
+
 /*!
   \def   SLOG(stream, priority)
   \brief A macro that returns the requested log4cpp::Category
@@ -83,6 +113,7 @@ using std::string;
 */
 
 #define SLOG(stream, priority) \
+           GENIE_MSG_IF(stream, priority) \
            (*Messenger::Instance())(stream) \
                << priority << "[s] <" \
                << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -95,6 +126,7 @@ using std::string;
 */
 
 #define LOG(stream, priority) \
+           GENIE_MSG_IF(stream, priority) \
            (*Messenger::Instance())(stream) \
                << priority << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -111,41 +143,49 @@ using std::string;
 #ifndef HIDE_GENIE_MSG_LOG_MACROS
 
 #define LOG_FATAL(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::FATAL) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::FATAL << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ALERT(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::ALERT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ALERT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_CRIT(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::CRIT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::CRIT << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_ERROR(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::ERROR) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ERROR << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_WARN(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::WARN) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::WARN << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_NOTICE(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::NOTICE) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::NOTICE << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_INFO(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::INFO) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::INFO << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LOG_DEBUG(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::DEBUG) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::DEBUG << "[n] <" \
                << __FILE__ << "::" << __FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -160,46 +200,55 @@ using std::string;
 */
 
 #define LLOG(stream, priority) \
+           GENIE_MSG_IF(stream, priority) \
            (*Messenger::Instance())(stream) \
                << priority << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_FATAL(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::FATAL) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::FATAL << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ALERT(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::ALERT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ALERT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_CRIT(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::CRIT) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::CRIT << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_ERROR(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::ERROR) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::ERROR << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_WARN(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::WARN) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::WARN << "'[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_NOTICE(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::NOTICE) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::NOTICE << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_INFO(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::INFO) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::INFO << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
 
 #define LLOG_DEBUG(stream) \
+          GENIE_MSG_IF(stream, log4cpp::Priority::DEBUG) \
           (*Messenger::Instance())(stream) \
                << log4cpp::Priority::DEBUG << "[l] <" \
                << __PRETTY_FUNCTION__ << " (" << __LINE__ << ")> : "
@@ -211,6 +260,7 @@ using std::string;
 */
 
 #define BLOG(stream, priority) \
+          GENIE_MSG_IF(stream, priority) \
           (*Messenger::Instance())(stream) << priority
 
 /*!
@@ -256,6 +306,8 @@ namespace genie {
 
 extern bool gAbortingInErr;
 
+class MsgAppender;
+
 class Messenger
 {
 public:
@@ -266,6 +318,14 @@ public:
 
   bool SetPrioritiesFromXmlFile(string filename);
 
+  //! write the messages in a background thread, through a queue of the
+  //! given size (set at start-up by $GMSGASYNC=queue_size), or stop doing so
+  bool SetAsyncOutput(bool on, unsigned int queue_size = 4096);
+
+  //! suppress identical messages (of ERROR priority or below) repeated more
+  //! than nmax times, 0 for no limit (set at start-up by $GMSGMAXREPEAT=nmax)
+  void SetMaxRepeats(long nmax);
+
 private:
   Messenger();
   Messenger(const Messenger & config_pool);
@@ -273,6 +333,8 @@ private:
 
   static Messenger * fInstance;
 
+  MsgAppender * fAppender; ///< the appender of the root category (owned by log4cpp)
+
   void Configure(void);
 
   log4cpp::Priority::Value PriorityFromString(string priority);
@@ -0,0 +1,287 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <sstream>
+#include <sched.h>
+#include <unistd.h>
+
+#include "log4cpp/Priority.hh"
+
+#include "Framework/Messenger/MsgAppender.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+namespace {
+  const unsigned int kNRepeatSlots = 1024;
+}
+//____________________________________________________________________________
+MsgAppender * MsgAppender::fAsyncAppender = 0;
+unsigned int  MsgAppender::fForkQueueSize = 0;
+//____________________________________________________________________________
+MsgAppender::MsgAppender(const string & name, std::ostream * stream) :
+log4cpp::LayoutAppender(name),
+fStream      (stream),
+fMask        (0),
+fHead        (0),
+fTail        (0),
+fNWritten    (0),
+fRunning     (false),
+fStop        (false),
+fMaxRepeats  (0),
+fNSuppressed (0)
+{
+  pthread_mutex_init(&fRepeatMutex, 0);
+}
+//____________________________________________________________________________
+MsgAppender::~MsgAppender()
+{
+  this->close();
+  if(fAsyncAppender == this) fAsyncAppender = 0;
+  pthread_mutex_destroy(&fRepeatMutex);
+}
+//____________________________________________________________________________
+bool MsgAppender::StartWriterThread(unsigned int queue_size)
+{
+  if(fRunning) return true;
+
+  unsigned long size = 2;
+  while(size < queue_size) size <<= 1;
+  fSlots.resize(size);
+  for(unsigned long i = 0; i < size; i++) fSlots[i].fSeq = i;
+  fMask     = size - 1;
+  fHead     = 0;
+  fTail     = 0;
+  fNWritten = 0;
+  fStop     = false;
+
+  if(pthread_create(&fWriterThread, 0, MsgAppender::WriterThread, this) != 0) {
+    fSlots.clear();
+    return false;
+  }
+  fRunning = true;
+
+  // registered after log4cpp was set up, so that it runs before its clean-up
+  static bool registered = false;
+  if(!registered) {
+    registered = (atexit(MsgAppender::CloseAtExit) == 0);
+    pthread_atfork(
+      MsgAppender::PrepareFork, MsgAppender::AfterFork, MsgAppender::AfterFork);
+  }
+  fAsyncAppender = this;
+
+  return true;
+}
+//____________________________________________________________________________
+void MsgAppender::StopWriterThread(void)
+{
+  if(!fRunning) return;
+
+  __atomic_store_n(&fStop, true, __ATOMIC_RELEASE);
+  pthread_join(fWriterThread, 0);
+  fRunning = false;
+  fSlots.clear();
+  fStream->flush();
+}
+//____________________________________________________________________________
+void MsgAppender::SetMaxRepeats(long nmax)
+{
+  pthread_mutex_lock(&fRepeatMutex);
+  fMaxRepeats = (nmax > 0) ? nmax : 0;
+  fRepeats.clear();
+  if(fMaxRepeats > 0) {
+    fRepeats.resize(kNRepeatSlots);
+    for(unsigned int i = 0; i < kNRepeatSlots; i++) fRepeats[i].fCount = 0;
+  }
+  pthread_mutex_unlock(&fRepeatMutex);
+}
+//____________________________________________________________________________
+bool MsgAppender::reopen(void)
+{
+  return true;
+}
+//____________________________________________________________________________
+void MsgAppender::close(void)
+{
+  this->StopWriterThread();
+
+  if(fNSuppressed > 0) {
+    ostringstream summary;
+    summary << "[Messenger] " << fNSuppressed << " repeated message(s) "
+            << "(more than " << fMaxRepeats << " of a kind) were suppressed"
+            << std::endl;
+    this->Write(summary.str());
+    fNSuppressed = 0;
+  }
+  fStream->flush();
+}
+//____________________________________________________________________________
+void MsgAppender::_append(const log4cpp::LoggingEvent & event)
+{
+  bool urgent = (event.priority <= log4cpp::Priority::CRIT);
+
+  string msg;
+  long nrepeats = (fMaxRepeats > 0 && !urgent) ? this->Repeats(event) : 0;
+  if(nrepeats > 0 && nrepeats > fMaxRepeats) return;
+  if(nrepeats > 0 && nrepeats == fMaxRepeats) {
+    ostringstream last;
+    last << event.message << " [repeated " << nrepeats
+         << " times - suppressing further ones]";
+    log4cpp::LoggingEvent last_event(
+         event.categoryName, last.str(), event.ndc, event.priority);
+    msg = _getLayout().format(last_event);
+  } else {
+    msg = _getLayout().format(event);
+  }
+
+  if(!fRunning) {
+    this->Write(msg);
+    return;
+  }
+  if(urgent) {
+    // keep the message order, and have it out before a possible exit
+    this->WaitForQueue();
+    this->Write(msg);
+    fStream->flush();
+    return;
+  }
+  // a full queue means the writer is behind: wait for it
+  while(!this->Push(msg)) sched_yield();
+}
+//____________________________________________________________________________
+long MsgAppender::Repeats(const log4cpp::LoggingEvent & event)
+{
+// Counts the repeats of the message in a fixed-size table indexed by the
+// message hash. Different messages sharing an entry reset each other's count,
+// so memory use is bounded and only messages repeated in a row are affected
+
+  string key = event.categoryName + ":" + event.message;
+
+  unsigned long hash = 2166136261UL;
+  for(unsigned int i = 0; i < key.size(); i++) {
+    hash ^= (unsigned char) key[i];
+    hash *= 16777619UL;
+  }
+
+  pthread_mutex_lock(&fRepeatMutex);
+  long nrepeats = 0;
+  if(fRepeats.size() > 0) {
+    Repeat_t & entry = fRepeats[hash % fRepeats.size()];
+    if(entry.fKey != key) {
+      entry.fKey   = key;
+      entry.fCount = 0;
+    }
+    nrepeats = ++entry.fCount;
+    if(nrepeats > fMaxRepeats) fNSuppressed++;
+  }
+  pthread_mutex_unlock(&fRepeatMutex);
+
+  return nrepeats;
+}
+//____________________________________________________________________________
+void MsgAppender::Write(const string & msg)
+{
+  (*fStream) << msg;
+}
+//____________________________________________________________________________
+bool MsgAppender::Push(const string & msg)
+{
+// Bounded multi-producer / single-consumer queue: Each slot carries the
+// queue position it is ready for. A producer claims the head position with
+// a compare-and-swap, fills the slot and publishes it by advancing its
+// sequence number. Returns false if the queue is full
+
+  unsigned long pos = __atomic_load_n(&fHead, __ATOMIC_RELAXED);
+  while(true) {
+    Slot_t & slot = fSlots[pos & fMask];
+    unsigned long seq = __atomic_load_n(&slot.fSeq, __ATOMIC_ACQUIRE);
+    long diff = (long) seq - (long) pos;
+    if(diff == 0) {
+      if(__atomic_compare_exchange_n(&fHead, &pos, pos + 1, true,
+                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+        slot.fMsg = msg;
+        __atomic_store_n(&slot.fSeq, pos + 1, __ATOMIC_RELEASE);
+        return true;
+      }
+    }
+    else if(diff < 0) return false;
+    else pos = __atomic_load_n(&fHead, __ATOMIC_RELAXED);
+  }
+}
+//____________________________________________________________________________
+bool MsgAppender::Pop(string & msg)
+{
+  Slot_t & slot = fSlots[fTail & fMask];
+  unsigned long seq = __atomic_load_n(&slot.fSeq, __ATOMIC_ACQUIRE);
+  if((long) seq - (long) (fTail + 1) < 0) return false;
+
+  // swap, so that both strings keep their capacity for the next messages
+  msg.swap(slot.fMsg);
+  __atomic_store_n(&slot.fSeq, fTail + fMask + 1, __ATOMIC_RELEASE);
+  fTail++;
+  return true;
+}
+//____________________________________________________________________________
+void MsgAppender::WaitForQueue(void)
+{
+  unsigned long head = __atomic_load_n(&fHead, __ATOMIC_ACQUIRE);
+  while(__atomic_load_n(&fNWritten, __ATOMIC_ACQUIRE) < head) sched_yield();
+}
+//____________________________________________________________________________
+void MsgAppender::CloseAtExit(void)
+{
+  if(fAsyncAppender) fAsyncAppender->close();
+}
+//____________________________________________________________________________
+void MsgAppender::PrepareFork(void)
+{
+// Drain the queue and stop the writer thread, so that neither process is left
+// with a queue nobody reads (and with a copy of the messages still in it)
+
+  fForkQueueSize = 0;
+  if(fAsyncAppender && fAsyncAppender->fRunning) {
+    fForkQueueSize = fAsyncAppender->fSlots.size();
+    fAsyncAppender->StopWriterThread();
+  }
+}
+//____________________________________________________________________________
+void MsgAppender::AfterFork(void)
+{
+  if(fAsyncAppender && fForkQueueSize > 0) {
+    fAsyncAppender->StartWriterThread(fForkQueueSize);
+  }
+}
+//____________________________________________________________________________
+void * MsgAppender::WriterThread(void * appender)
+{
+  MsgAppender * app = (MsgAppender *) appender;
+
+  string msg;
+  while(true) {
+    bool stop = __atomic_load_n(&app->fStop, __ATOMIC_ACQUIRE);
+    int nwritten = 0;
+    while(app->Pop(msg)) {
+      app->Write(msg);
+      __atomic_add_fetch(&app->fNWritten, 1, __ATOMIC_RELEASE);
+      nwritten++;
+    }
+    if(nwritten > 0) app->fStream->flush();
+    // only return once the queue was found empty after the stop request
+    if(stop) break;
+    usleep(1000);
+  }
+  return 0;
+}
+//____________________________________________________________________________
@@ -0,0 +1,120 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::MsgAppender
+
+\brief    The log4cpp appender the Messenger writes all messages with.
+
+          By default, it writes each formatted message to its stream in the
+          calling thread, as a log4cpp::OstreamAppender does. Optionally:
+
+          - Messages are handed to a background writer thread through a
+            bounded, lock-free queue, so that the generation thread does
+            not wait on the output stream (see StartWriterThread() or the
+            $GMSGASYNC variable). Messages of CRIT priority or above are
+            still written synchronously, once all queued messages are out,
+            as they often precede an exit. Queued messages are written
+            out at exit. The writer thread is stopped before a fork() and
+            restarted in both processes, as threads do not survive a fork.
+          - Identical messages (same stream and text) of ERROR priority or
+            below are suppressed after a maximum number of repeats (see
+            SetMaxRepeats() or the $GMSGMAXREPEAT variable). The number of
+            suppressed messages is reported at exit.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _MSG_APPENDER_H_
+#define _MSG_APPENDER_H_
+
+// ROOT5 has difficulty with parsing log4cpp headers
+#if !defined(__CINT__) && !defined(__MAKECINT__)
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#include "log4cpp/LayoutAppender.hh"
+#include "log4cpp/LoggingEvent.hh"
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class MsgAppender : public log4cpp::LayoutAppender {
+
+public :
+  MsgAppender(const string & name, std::ostream * stream);
+  virtual ~MsgAppender();
+
+  //! write messages in a background thread, queueing up to queue_size of
+  //! them (rounded up to a power of 2); StopWriterThread() drains the queue
+  bool StartWriterThread (unsigned int queue_size);
+  void StopWriterThread  (void);
+  bool IsAsync           (void) const { return fRunning; }
+
+  //! suppress identical messages after the given number of repeats (0: never)
+  void SetMaxRepeats     (long nmax);
+  long NSuppressed       (void) const { return fNSuppressed; }
+
+  virtual bool reopen (void);
+  virtual void close  (void);
+
+protected:
+  virtual void _append (const log4cpp::LoggingEvent & event);
+
+private:
+  struct Slot_t {
+    unsigned long fSeq;  ///< queue position the slot is ready for
+    string        fMsg;  ///< formatted message
+  };
+  struct Repeat_t {
+    string fKey;         ///< stream and message text
+    long   fCount;       ///< consecutive uses of this table entry
+  };
+
+  long   Repeats      (const log4cpp::LoggingEvent & event);
+  void   Write        (const string & msg);
+  bool   Push         (const string & msg);
+  bool   Pop          (string & msg);
+  void   WaitForQueue (void);
+
+  static void * WriterThread (void * appender);
+  static void   CloseAtExit  (void);
+  static void   PrepareFork  (void);
+  static void   AfterFork    (void);
+
+  static MsgAppender * fAsyncAppender; ///< appender with a writer thread, closed at exit
+  static unsigned int  fForkQueueSize; ///< queue size to restart the writer thread with after a fork
+
+  std::ostream *   fStream;      ///< output stream (not owned)
+
+  vector<Slot_t>   fSlots;       ///< message queue ring buffer
+  unsigned long    fMask;        ///< ring buffer size - 1
+  unsigned long    fHead;        ///< next queue position to write, by the producers
+  unsigned long    fTail;        ///< next queue position to read, by the writer
+  unsigned long    fNWritten;    ///< queued messages written so far
+  bool             fRunning;     ///< is the writer thread running?
+  bool             fStop;        ///< asks the writer thread to return once the queue is empty
+  pthread_t        fWriterThread;
+
+  long             fMaxRepeats;  ///< max identical messages, 0 for no limit
+  long             fNSuppressed; ///< suppressed messages so far
+  vector<Repeat_t> fRepeats;     ///< repeat counts, by message hash
+  pthread_mutex_t  fRepeatMutex;
+};
+
+}      // genie namespace
+
+#endif
+#endif // _MSG_APPENDER_H_
@@ -14,5 +14,7 @@
 #pragma link C++ class genie::NtpMCRecordI;
 #pragma link C++ class genie::NtpMCEventRecord;
 #pragma link C++ class genie::NtpWriter;
+#pragma link C++ class genie::NtpGSTTree;
+#pragma link C++ class genie::NtpEventIndex;
 
 #endif
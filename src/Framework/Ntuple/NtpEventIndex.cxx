@@ -0,0 +1,200 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <TTree.h>
+#include <TBits.h>
+#include <TMath.h>
+
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/GHEP/GHepStatus.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGUtils.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+NtpEventIndex::NtpEventIndex() :
+fTree(0)
+{
+  this->Init();
+}
+//____________________________________________________________________________
+NtpEventIndex::~NtpEventIndex()
+{
+// the tree belongs to the directory it was created in (or read from)
+}
+//____________________________________________________________________________
+void NtpEventIndex::Init(void)
+{
+  iev     = 0;
+  probe   = 0;
+  tgt     = 0;
+  hitnuc  = 0;
+  scat    = 0;
+  intt    = 0;
+  ev      = 0.;
+  wght    = 0.;
+  flags   = 0;
+  nfp     = 0;
+  nfpbar  = 0;
+  nfn     = 0;
+  nfnbar  = 0;
+  nfpip   = 0;
+  nfpim   = 0;
+  nfpi0   = 0;
+  nfkp    = 0;
+  nfkm    = 0;
+  nfk0    = 0;
+  nfk0bar = 0;
+  nfhyp   = 0;
+  nfother = 0;
+}
+//____________________________________________________________________________
+TTree * NtpEventIndex::CreateTree(void)
+{
+  fTree = new TTree(NtpEventIndex::TreeName(), "GENIE Event Index Tree");
+
+  fTree->Branch("iev",     &iev,     "iev/I"     );
+  fTree->Branch("probe",   &probe,   "probe/I"   );
+  fTree->Branch("tgt",     &tgt,     "tgt/I"     );
+  fTree->Branch("hitnuc",  &hitnuc,  "hitnuc/I"  );
+  fTree->Branch("scat",    &scat,    "scat/I"    );
+  fTree->Branch("intt",    &intt,    "intt/I"    );
+  fTree->Branch("ev",      &ev,      "ev/D"      );
+  fTree->Branch("wght",    &wght,    "wght/D"    );
+  fTree->Branch("flags",   &flags,   "flags/i"   );
+  fTree->Branch("nfp",     &nfp,     "nfp/I"     );
+  fTree->Branch("nfpbar",  &nfpbar,  "nfpbar/I"  );
+  fTree->Branch("nfn",     &nfn,     "nfn/I"     );
+  fTree->Branch("nfnbar",  &nfnbar,  "nfnbar/I"  );
+  fTree->Branch("nfpip",   &nfpip,   "nfpip/I"   );
+  fTree->Branch("nfpim",   &nfpim,   "nfpim/I"   );
+  fTree->Branch("nfpi0",   &nfpi0,   "nfpi0/I"   );
+  fTree->Branch("nfkp",    &nfkp,    "nfkp/I"    );
+  fTree->Branch("nfkm",    &nfkm,    "nfkm/I"    );
+  fTree->Branch("nfk0",    &nfk0,    "nfk0/I"    );
+  fTree->Branch("nfk0bar", &nfk0bar, "nfk0bar/I" );
+  fTree->Branch("nfhyp",   &nfhyp,   "nfhyp/I"   );
+  fTree->Branch("nfother", &nfother, "nfother/I" );
+
+  return fTree;
+}
+//____________________________________________________________________________
+bool NtpEventIndex::ReadTree(TTree * tree)
+{
+  fTree = tree;
+  if(!fTree) return false;
+
+  fTree->SetBranchAddress("iev",     &iev     );
+  fTree->SetBranchAddress("probe",   &probe   );
+  fTree->SetBranchAddress("tgt",     &tgt     );
+  fTree->SetBranchAddress("hitnuc",  &hitnuc  );
+  fTree->SetBranchAddress("scat",    &scat    );
+  fTree->SetBranchAddress("intt",    &intt    );
+  fTree->SetBranchAddress("ev",      &ev      );
+  fTree->SetBranchAddress("wght",    &wght    );
+  fTree->SetBranchAddress("flags",   &flags   );
+  fTree->SetBranchAddress("nfp",     &nfp     );
+  fTree->SetBranchAddress("nfpbar",  &nfpbar  );
+  fTree->SetBranchAddress("nfn",     &nfn     );
+  fTree->SetBranchAddress("nfnbar",  &nfnbar  );
+  fTree->SetBranchAddress("nfpip",   &nfpip   );
+  fTree->SetBranchAddress("nfpim",   &nfpim   );
+  fTree->SetBranchAddress("nfpi0",   &nfpi0   );
+  fTree->SetBranchAddress("nfkp",    &nfkp    );
+  fTree->SetBranchAddress("nfkm",    &nfkm    );
+  fTree->SetBranchAddress("nfk0",    &nfk0    );
+  fTree->SetBranchAddress("nfk0bar", &nfk0bar );
+  fTree->SetBranchAddress("nfhyp",   &nfhyp   );
+  fTree->SetBranchAddress("nfother", &nfother );
+
+  return true;
+}
+//____________________________________________________________________________
+void NtpEventIndex::Set(int ievent, const EventRecord & event)
+{
+  this->Init();
+
+  iev  = ievent;
+  wght = event.Weight();
+
+  GHepParticle * p = 0;
+
+  p = event.Probe();
+  if(p) {
+    probe = p->Pdg();
+    ev    = p->Energy();
+  }
+  p = event.TargetNucleus();
+  if(!p) p = event.Particle(1);
+  if(p) tgt = p->Pdg();
+  p = event.HitNucleon();
+  if(p) hitnuc = p->Pdg();
+
+  const Interaction * interaction = event.Summary();
+  if(interaction) {
+    scat = (int) interaction->ProcInfo().ScatteringTypeId();
+    intt = (int) interaction->ProcInfo().InteractionTypeId();
+  }
+
+  TBits * evflags = event.EventFlags();
+  if(evflags) {
+    unsigned int nbits = TMath::Min(GHepFlags::NFlags(), (unsigned int) 32);
+    for(unsigned int i = 0; i < nbits; i++) {
+      if(evflags->TestBitNumber(i)) flags |= (1u << i);
+    }
+  }
+
+  // count the final state particles, except the primary lepton and the
+  // pseudo-particles
+  TObjArrayIter piter(&event);
+  while( (p = (GHepParticle *) piter.Next()) ) {
+    int pdgc = p->Pdg();
+    if(p->Status() != kIStStableFinalState) continue;
+    if(p->FirstMother() == 0) continue;
+    if(pdg::IsPseudoParticle(pdgc)) continue;
+
+    if      (pdgc == kPdgProton     ) nfp++;
+    else if (pdgc == kPdgAntiProton ) nfpbar++;
+    else if (pdgc == kPdgNeutron    ) nfn++;
+    else if (pdgc == kPdgAntiNeutron) nfnbar++;
+    else if (pdgc == kPdgPiP        ) nfpip++;
+    else if (pdgc == kPdgPiM        ) nfpim++;
+    else if (pdgc == kPdgPi0        ) nfpi0++;
+    else if (pdgc == kPdgKP         ) nfkp++;
+    else if (pdgc == kPdgKM         ) nfkm++;
+    else if (pdgc == kPdgK0         ) nfk0++;
+    else if (pdgc == kPdgAntiK0     ) nfk0bar++;
+    else if (pdgc == kPdgSigmaP  || pdgc == kPdgSigma0 ||
+             pdgc == kPdgSigmaM  || pdgc == kPdgLambda ||
+             pdgc == kPdgXi0     || pdgc == kPdgXiM    ||
+             pdgc == kPdgOmegaM     ) nfhyp++;
+    else                              nfother++;
+  }
+}
+//____________________________________________________________________________
+void NtpEventIndex::Fill(int ievent, const EventRecord & event)
+{
+  if(!fTree) {
+    LOG("Ntp", pERROR) << "No index tree: Call CreateTree() first";
+    return;
+  }
+  this->Set(ievent, event);
+  fTree->Fill();
+}
+//____________________________________________________________________________
@@ -0,0 +1,93 @@
+//____________________________________________________________________________
+/*!
+
+\class   genie::NtpEventIndex
+
+\brief   A light-weight per-event index, written by NtpWriter in a flat tree
+         (gidx) next to the GHEP event tree: entry i of the index describes
+         entry i of the event tree.
+
+         Each index entry holds the event number, the probe, target and hit
+         nucleon, the probe energy, the scattering and interaction types,
+         the event flags and the final state particle multiplicities (the
+         event topology). Applications selecting events (gevpick) or
+         seeking events by event number (gevdump) can read the index
+         instead of deserializing every GHEP event record.
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+\created October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _NTP_EVENT_INDEX_H_
+#define _NTP_EVENT_INDEX_H_
+
+class TTree;
+
+namespace genie {
+
+class EventRecord;
+
+class NtpEventIndex {
+
+public :
+  NtpEventIndex();
+ ~NtpEventIndex();
+
+  static const char * TreeName (void) { return "gidx"; }
+
+  ///< create the index tree (in the current directory) and its branches
+  TTree * CreateTree (void);
+
+  ///< set the index branch addresses of an input index tree
+  bool ReadTree (TTree * tree);
+
+  ///< compute the index entry of an event (without filling the tree)
+  void Set  (int iev, const EventRecord & event);
+
+  ///< compute the index entry of an event and add it to the tree
+  void Fill (int iev, const EventRecord & event);
+
+  ///< the index tree
+  TTree * Tree (void) { return fTree; }
+
+  // Ntuple is treated like a C-struct with public data members and
+  // rule-breaking field data members not prefaced by "f" and mostly lowercase.
+  int          iev;     ///< event number
+  int          probe;   ///< probe pdg code
+  int          tgt;     ///< target pdg code
+  int          hitnuc;  ///< hit nucleon pdg code (0 if none)
+  int          scat;    ///< scattering type (see ScatteringType.h)
+  int          intt;    ///< interaction type (see InteractionType.h)
+  double       ev;      ///< probe energy @ LAB
+  double       wght;    ///< event weight
+  unsigned int flags;   ///< event flags (see GHepFlags.h), bit i = flag i
+  int          nfp;     ///< # of final state protons
+  int          nfpbar;  ///< # of final state anti-protons
+  int          nfn;     ///< # of final state neutrons
+  int          nfnbar;  ///< # of final state anti-neutrons
+  int          nfpip;   ///< # of final state pi+'s
+  int          nfpim;   ///< # of final state pi-'s
+  int          nfpi0;   ///< # of final state pi0's
+  int          nfkp;    ///< # of final state K+'s
+  int          nfkm;    ///< # of final state K-'s
+  int          nfk0;    ///< # of final state K0's
+  int          nfk0bar; ///< # of final state \bar{K0}'s
+  int          nfhyp;   ///< # of final state hyperons (Sigma+,0,-, Lambda, Xi0,-, Omega-)
+  int          nfother; ///< # of other final state particles
+
+private:
+
+  void Init (void);
+
+  TTree * fTree; ///< the index tree
+};
+
+}      // genie namespace
+#endif // _NTP_EVENT_INDEX_H_
@@ -18,6 +18,26 @@
    Added CustomizeFilename() and CustomizeFilenamePrefix() to allow the use
    to customize either the entire output name or just the prefix before the
    run number.
+ @ Oct 14, 2026 - CA
+   The NtpMCEventRecord of the event branch is created once and refilled
+   for every event, recycling its GHEP entries. The output compression,
+   basket size, autosave and autoflush settings are taken from RunOpt.
+ @ Oct 14, 2026 - CA
+   Added an optional writer thread, filling the tree from a bounded queue
+   of events, and the option to enable ROOT's implicit multi-threading.
+ @ Oct 14, 2026 - CA
+   Can write the GENIE summary tree (gst), alongside or instead of the
+   GHEP event tree, so that no gntpc pass is needed.
+ @ Oct 14, 2026 - CA
+   Writes an event index tree (see NtpEventIndex) next to the GHEP tree.
+   Writes the GHEP particles in compact form if requested (see GHepParticle).
+ @ Oct 14, 2026 - CA
+   Writes the event generation cost (see GHepEventCost) in a gcost branch
+   of the GHEP event tree, if requested.
+ @ Oct 14, 2026 - CA
+   Writes the alternate tune weights in a gtunewght branch, if requested.
+ @ Oct 14, 2026 - CA
+   Added Checkpoint() and CopyEvents(), for checkpointed MC jobs.
 
 */
 //____________________________________________________________________________
@@ -29,14 +49,22 @@
 #include <TTree.h>
 #include <TClonesArray.h>
 #include <TFolder.h>
+#include <TROOT.h>
 
 #include "Framework/EventGen/EventRecord.h"
+#include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Ntuple/NtpWriter.h"
 #include "Framework/Ntuple/NtpMCEventRecord.h"
 #include "Framework/Ntuple/NtpMCTreeHeader.h"
+#include "Framework/Ntuple/NtpGSTTree.h"
+#include "Framework/Ntuple/NtpEventIndex.h"
 #include "Framework/Ntuple/NtpMCJobConfig.h"
 #include "Framework/Ntuple/NtpMCJobEnv.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/XSecSplineList.h"
 
 #include "RVersion.h"
 
@@ -52,8 +80,24 @@ fOutFile(0),
 fOutTree(0),
 fEventBranch(0),
 fNtpMCEventRecord(0),
-fNtpMCTreeHeader(0)
+fNtpMCTreeHeader(0),
+fGSTTree(0),
+fEventIndex(0),
+fOutputTreesSet(false),
+fWriteGHEP(true),
+fWriteGST(false),
+fNOwnBranches(1),
+fWriteCost(false),
+fNMissingTuneXSec(0),
+fWriterThreadSet(false),
+fQueueSize(0),
+fWriterRunning(false),
+fWriterStop(false)
 {
+  pthread_mutex_init(&fQueueMutex,    0);
+  pthread_cond_init (&fQueueNotEmpty, 0);
+  pthread_cond_init (&fQueueNotFull,  0);
+
   LOG("Ntp", pNOTICE) << "Run number: " << runnu;
   LOG("Ntp", pNOTICE)
     << "Requested G/ROOT tree format: " << NtpMCFormat::AsString(fNtpFormat);
@@ -63,7 +107,27 @@ fNtpMCTreeHeader(0)
 //____________________________________________________________________________
 NtpWriter::~NtpWriter()
 {
+  this->StopWriterThread();
+
+  deque< pair<int, EventRecord *> >::iterator qiter = fQueue.begin();
+  for( ; qiter != fQueue.end(); ++qiter) delete qiter->second;
+  fQueue.clear();
+  vector<EventRecord *>::iterator riter = fFreeRecords.begin();
+  for( ; riter != fFreeRecords.end(); ++riter) delete *riter;
+  fFreeRecords.clear();
 
+  pthread_cond_destroy (&fQueueNotFull);
+  pthread_cond_destroy (&fQueueNotEmpty);
+  pthread_mutex_destroy(&fQueueMutex);
+
+  if(fNtpMCEventRecord) delete fNtpMCEventRecord;
+  fNtpMCEventRecord = 0;
+
+  // the gst tree itself belongs to the output file
+  if(fGSTTree) delete fGSTTree;
+  fGSTTree = 0;
+  if(fEventIndex) delete fEventIndex;
+  fEventIndex = 0;
 }
 //____________________________________________________________________________
 void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
@@ -79,13 +143,50 @@ void NtpWriter::AddEventRecord(int ievent, const EventRecord * ev_rec)
     return;
   }
 
+  // user-defined branches are filled from the caller's objects, at the
+  // time of TTree::Fill(): they can't be filled in the writer thread
+  if(fWriterRunning && fOutTree->GetNbranches() > fNOwnBranches) {
+    LOG("Ntp", pWARN)
+      << "The output tree has user-defined branches - "
+      << "Filling it without the writer thread";
+    this->StopWriterThread();
+  }
+
+  if(fWriterRunning) {
+    // wait for a free queue slot and take a written record for reuse
+    EventRecord * rec = 0;
+    pthread_mutex_lock(&fQueueMutex);
+    while(fQueue.size() >= fQueueSize) {
+      pthread_cond_wait(&fQueueNotFull, &fQueueMutex);
+    }
+    if(!fFreeRecords.empty()) {
+      rec = fFreeRecords.back();
+      fFreeRecords.pop_back();
+    }
+    pthread_mutex_unlock(&fQueueMutex);
+
+    if(!rec) rec = new EventRecord;
+    rec->Copy(*ev_rec);
+
+    pthread_mutex_lock(&fQueueMutex);
+    fQueue.push_back(pair<int, EventRecord *>(ievent, rec));
+    pthread_cond_signal(&fQueueNotEmpty);
+    pthread_mutex_unlock(&fQueueMutex);
+    return;
+  }
+
   switch (fNtpFormat) {
      case kNFGHEP:
-          fNtpMCEventRecord = new NtpMCEventRecord();
-          fNtpMCEventRecord->Fill(ievent, ev_rec);
-          fOutTree->Fill();
-          delete fNtpMCEventRecord;
-          fNtpMCEventRecord = 0;
+          // the branch object is refilled: EventRecord::Copy() reuses the
+          // GHEP entries of the previous event
+          if(fWriteGHEP) {
+            fNtpMCEventRecord->Fill(ievent, ev_rec);
+            if(fWriteCost) fCost = ev_rec->Cost();
+            if(fTuneWeights.size() > 0) this->FillTuneWeights(*ev_rec);
+            fOutTree->Fill();
+            if(fEventIndex) fEventIndex->Fill(ievent, *ev_rec);
+          }
+          if(fGSTTree) fGSTTree->Fill(ievent, *ev_rec);
           break;
      default:
         break;
@@ -96,11 +197,50 @@ void NtpWriter::Initialize()
 {
   LOG("Ntp",pINFO) << "Initializing GENIE output MC tree";
 
+  // parallel basket compression
+  int nimt = RunOpt::Instance()->OutputIMTThreads();
+  if(nimt > 0) {
+#ifdef R__USE_IMT
+    LOG("Ntp", pNOTICE)
+      << "Enabling ROOT implicit multi-threading (" << nimt << " threads)";
+    ROOT::EnableImplicitMT(nimt);
+#else
+    LOG("Ntp", pWARN)
+      << "ROOT was built without implicit multi-threading support";
+#endif
+  }
+
+  if(!fOutputTreesSet) {
+    fWriteGHEP = RunOpt::Instance()->OutputGHEP();
+    fWriteGST  = RunOpt::Instance()->OutputGST();
+  }
+
   this->OpenFile(fOutFilename); // open ROOT file
-  this->CreateTree();           // create output tree
 
-  //-- create the event branch
-  this->CreateEventBranch(); 
+  //-- create the output (GHEP) tree and the event branch
+  if(fWriteGHEP) {
+    GHepParticle::SetCompactIO(RunOpt::Instance()->OutputCompactGHEP());
+    this->CreateTree();
+    this->CreateEventBranch();
+    fWriteCost = RunOpt::Instance()->OutputEventCost();
+    if(fWriteCost) {
+      fOutTree->Branch("gcost", &fCost,
+        "cpu_ns/L:kine_trials/I:inuke_steps/I:inuke_retries/I:had_retries/I:module_stops/I");
+    }
+    this->CreateTuneWeightBranch();
+    if(RunOpt::Instance()->OutputEventIndex()) {
+      fEventIndex = new NtpEventIndex;
+      fEventIndex->CreateTree();
+    }
+  }
+
+  //-- create the summary tree
+  //   (it takes the place of the output tree if no GHEP tree is written)
+  if(fWriteGST) {
+    this->CreateGSTTree();
+    if(!fWriteGHEP) fOutTree = fGSTTree->Tree();
+  }
+  fNOwnBranches = (fOutTree) ? fOutTree->GetNbranches() : 0;
 
   //-- create the tree header
   this->CreateTreeHeader();
@@ -113,6 +253,169 @@ void NtpWriter::Initialize()
   //-- take a snapshot of the user's environment
   NtpMCJobEnv environment;
   environment.TakeSnapshot()->Write();
+
+  //-- start the writer thread, if requested
+  if(!fWriterThreadSet) {
+    fQueueSize = RunOpt::Instance()->OutputWriterQueueSize();
+  }
+  if(fQueueSize > 0 && fTuneWeights.size() > 0) {
+    LOG("Ntp", pWARN)
+      << "The tune weights are computed in the generation thread - "
+      << "Filling the output tree without the writer thread";
+    fQueueSize = 0;
+  }
+  if(fQueueSize > 0) this->StartWriterThread();
+}
+//____________________________________________________________________________
+void NtpWriter::CreateTuneWeightBranch(void)
+{
+  vector<string> tunes = utils::str::Split(RunOpt::Instance()->AltTunes(), ",");
+  for(unsigned int i = 0; i < tunes.size(); i++) {
+    string tune = utils::str::TrimSpaces(tunes[i]);
+    if(tune.size() > 0) fAltTunes.push_back(tune);
+  }
+  if(fAltTunes.empty()) return;
+
+  ostringstream leaves;
+  for(unsigned int i = 0; i < fAltTunes.size(); i++) {
+    leaves << ((i > 0) ? ":" : "") << fAltTunes[i] << "/D";
+  }
+  fTuneWeights.assign(fAltTunes.size(), 1.);
+  fOutTree->Branch("gtunewght", &fTuneWeights[0], leaves.str().c_str());
+
+  LOG("Ntp", pNOTICE)
+    << "Writing event weights for the alternate tunes: " << leaves.str();
+}
+//____________________________________________________________________________
+void NtpWriter::FillTuneWeights(const EventRecord & event)
+{
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  const Interaction * interaction = event.Summary();
+
+  double Ev   = interaction->InitState().ProbeE(kRfLab);
+  const Spline * spl = xspl->GetTuneSpline(xspl->CurrentTune(), interaction);
+  double xsec = (spl) ? spl->Evaluate(Ev) : 0.;
+
+  for(unsigned int i = 0; i < fAltTunes.size(); i++) {
+    const Spline * alt_spl = xspl->GetTuneSpline(fAltTunes[i], interaction);
+    if(!alt_spl || xsec <= 0.) {
+      fTuneWeights[i] = 1.;
+      fNMissingTuneXSec++;
+      continue;
+    }
+    fTuneWeights[i] = alt_spl->Evaluate(Ev) / xsec;
+  }
+}
+//____________________________________________________________________________
+void NtpWriter::SetOutputTrees(bool ghep, bool gst)
+{
+  if(!ghep && !gst) {
+    LOG("Ntp", pWARN)
+      << "No output tree was requested - Writing the GHEP event tree";
+    ghep = true;
+  }
+  fOutputTreesSet = true;
+  fWriteGHEP      = ghep;
+  fWriteGST       = gst;
+}
+//____________________________________________________________________________
+void NtpWriter::EnableWriterThread(unsigned int queue_size)
+{
+  if(fWriterRunning) {
+    LOG("Ntp", pWARN)
+      << "The writer thread is already running - Ignoring request";
+    return;
+  }
+  fWriterThreadSet = true;
+  fQueueSize       = queue_size;
+}
+//____________________________________________________________________________
+void * NtpWriter::WriterThread(void * writer)
+{
+  ((NtpWriter *) writer)->WriteQueuedEvents();
+  return 0;
+}
+//____________________________________________________________________________
+void NtpWriter::StartWriterThread(void)
+{
+  if(fWriterRunning || !fOutTree) return;
+
+  if(fNtpFormat != kNFGHEP) {
+    LOG("Ntp", pWARN)
+      << "No writer thread for the requested tree format";
+    return;
+  }
+
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  // the generation thread keeps using ROOT while the tree is filled
+  ROOT::EnableThreadSafety();
+#else
+  LOG("Ntp", pWARN) << "The writer thread needs ROOT >= 6";
+  return;
+#endif
+
+  fWriterStop = false;
+  if(pthread_create(&fWriterThread, 0, NtpWriter::WriterThread, this) != 0) {
+    LOG("Ntp", pWARN)
+      << "Couldn't create the writer thread - Filling the tree synchronously";
+    return;
+  }
+  fWriterRunning = true;
+
+  LOG("Ntp", pNOTICE)
+    << "Started the tree writer thread (queue size: " << fQueueSize << ")";
+}
+//____________________________________________________________________________
+void NtpWriter::StopWriterThread(void)
+{
+// Waits for the queued events to be written and stops the writer thread
+
+  if(!fWriterRunning) return;
+
+  pthread_mutex_lock(&fQueueMutex);
+  fWriterStop = true;
+  pthread_cond_signal(&fQueueNotEmpty);
+  pthread_mutex_unlock(&fQueueMutex);
+
+  pthread_join(fWriterThread, 0);
+  fWriterRunning = false;
+
+  LOG("Ntp", pINFO) << "Stopped the tree writer thread";
+}
+//____________________________________________________________________________
+void NtpWriter::WriteQueuedEvents(void)
+{
+// Body of the writer thread: fills the tree with the queued events, in
+// order. The queued record is swapped into the branch object, and the
+// record it replaces is kept for reuse.
+
+  pthread_mutex_lock(&fQueueMutex);
+  while(true) {
+    while(fQueue.empty() && !fWriterStop) {
+      pthread_cond_wait(&fQueueNotEmpty, &fQueueMutex);
+    }
+    if(fQueue.empty()) break; // asked to stop and nothing left to write
+
+    pair<int, EventRecord *> entry = fQueue.front();
+    fQueue.pop_front();
+    pthread_mutex_unlock(&fQueueMutex);
+
+    EventRecord * prev = entry.second;
+    if(fWriteGHEP) {
+      prev = fNtpMCEventRecord->event;
+      fNtpMCEventRecord->event      = entry.second;
+      fNtpMCEventRecord->hdr.ievent = entry.first;
+      if(fWriteCost) fCost = entry.second->Cost();
+      fOutTree->Fill();
+      if(fEventIndex) fEventIndex->Fill(entry.first, *entry.second);
+    }
+    if(fGSTTree) fGSTTree->Fill(entry.first, *entry.second);
+
+    pthread_mutex_lock(&fQueueMutex);
+    fFreeRecords.push_back(prev);
+    pthread_cond_signal(&fQueueNotFull);
+  }
+  pthread_mutex_unlock(&fQueueMutex);
 }
 //____________________________________________________________________________
 void NtpWriter::CustomizeFilename(string filename)
@@ -146,6 +449,22 @@ void NtpWriter::OpenFile(string filename)
   // use "TFile::Open()" instead of "new TFile()" so that it can handle
   // alternative URLs (e.g. xrootd, etc)
   fOutFile = TFile::Open(filename.c_str(),"RECREATE");
+
+  // must be set before the tree is created, as the branches take the
+  // compression setting of their file
+  int compression = RunOpt::Instance()->OutputCompression();
+  if(fOutFile && compression >= 0) {
+#if ROOT_VERSION_CODE < ROOT_VERSION(6,20,0)
+    if(compression/100 == 5) {
+      LOG("Ntp", pWARN)
+        << "ZSTD compression needs ROOT >= 6.20 - Using LZ4 instead";
+      compression = 404;
+    }
+#endif
+    LOG("Ntp", pNOTICE)
+        << "Output compression setting: " << compression;
+    fOutFile->SetCompressionSettings(compression);
+  }
 }
 //____________________________________________________________________________
 void NtpWriter::CreateTree(void)
@@ -159,7 +478,11 @@ void NtpWriter::CreateTree(void)
               << ", Format: " << NtpMCFormat::AsString(fNtpFormat);
 
   fOutTree = new TTree("gtree",title.str().c_str());
-  fOutTree->SetAutoSave(200000000);  // autosave when 0.2 Gbyte written
+
+  // autosave every 2x10^8 entries by default (see TTree::SetAutoSave())
+  fOutTree->SetAutoSave(RunOpt::Instance()->OutputAutoSave());
+  long autoflush = RunOpt::Instance()->OutputAutoFlush();
+  if(autoflush != 0) fOutTree->SetAutoFlush(autoflush);
 }
 //____________________________________________________________________________
 void NtpWriter::CreateEventBranch(void)
@@ -181,7 +504,7 @@ void NtpWriter::CreateGHEPEventBranch(void)
 {
   LOG("Ntp", pINFO) << "Creating a NtpMCEventRecord TBranch";
 
-  fNtpMCEventRecord = 0;
+  if(!fNtpMCEventRecord) fNtpMCEventRecord = new NtpMCEventRecord();
   TTree::SetBranchStyle(1);
 
 #if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
@@ -191,12 +514,27 @@ void NtpWriter::CreateGHEPEventBranch(void)
 #endif
 
   fEventBranch = fOutTree->Branch("gmcrec",
-      "genie::NtpMCEventRecord", &fNtpMCEventRecord, 32000, split);
+      "genie::NtpMCEventRecord", &fNtpMCEventRecord,
+      RunOpt::Instance()->OutputBasketSize(), split);
   // was split=1 ... but, at least w/ ROOT 6.06/04, this generates
   //   Warning in <TTree::Bronch>: genie::NtpMCEventRecord cannot be split, resetting splitlevel to 0
   // which the art framework turns into a fatal error
 }
 //____________________________________________________________________________
+void NtpWriter::CreateGSTTree(void)
+{
+  LOG("Ntp", pINFO) << "Creating the GENIE summary (gst) tree";
+
+  if(fGSTTree) delete fGSTTree;
+
+  fOutFile->cd();
+  fGSTTree = new NtpGSTTree;
+  fGSTTree->CreateTree();
+  fGSTTree->Tree()->SetAutoSave(RunOpt::Instance()->OutputAutoSave());
+  long autoflush = RunOpt::Instance()->OutputAutoFlush();
+  if(autoflush != 0) fGSTTree->Tree()->SetAutoFlush(autoflush);
+}
+//____________________________________________________________________________
 void NtpWriter::CreateTreeHeader(void)
 {
   LOG("Ntp", pINFO) << "Creating the NtpMCTreeHeader";
@@ -211,10 +549,94 @@ void NtpWriter::CreateTreeHeader(void)
   LOG("Ntp", pINFO) << *fNtpMCTreeHeader;
 }
 //____________________________________________________________________________
+vector<TTree *> NtpWriter::OutputTrees(void) const
+{
+  vector<TTree *> trees;
+  if(fWriteGHEP && fOutTree)     trees.push_back(fOutTree);
+  if(fEventIndex)                trees.push_back(fEventIndex->Tree());
+  if(fGSTTree)                   trees.push_back(fGSTTree->Tree());
+  return trees;
+}
+//____________________________________________________________________________
+void NtpWriter::Checkpoint(void)
+{
+  if(!fOutFile) {
+    LOG("Ntp", pERROR) << "No open ROOT file was found";
+    return;
+  }
+
+  // the queued events are written first
+  bool restart = fWriterRunning;
+  this->StopWriterThread();
+
+  vector<TTree *> trees = this->OutputTrees();
+  for(unsigned int i = 0; i < trees.size(); i++) {
+    trees[i]->AutoSave("SaveSelf");
+  }
+
+  if(restart) this->StartWriterThread();
+}
+//____________________________________________________________________________
+bool NtpWriter::CopyEvents(string filename, Long64_t nevents)
+{
+  if(nevents <= 0) return true;
+
+  TFile * infile = TFile::Open(filename.c_str(), "READ");
+  if(!infile || infile->IsZombie()) {
+    LOG("Ntp", pERROR) << "Could not open: " << filename;
+    delete infile;
+    return false;
+  }
+  fOutFile->cd();
+
+  bool restart = fWriterRunning;
+  this->StopWriterThread();
+
+  // the input trees are read into the branch objects of the output trees
+  bool ok = true;
+  vector<TTree *> trees = this->OutputTrees();
+  for(unsigned int i = 0; ok && i < trees.size(); i++) {
+    TTree * outtree = trees[i];
+    TTree * intree  = dynamic_cast<TTree *> (infile->Get(outtree->GetName()));
+    if(!intree || intree->GetEntries() < nevents) {
+      LOG("Ntp", pERROR)
+        << "The " << outtree->GetName() << " tree in " << filename
+        << " has fewer than " << nevents << " events";
+      ok = false;
+      break;
+    }
+    outtree->CopyAddresses(intree);
+    for(Long64_t iev = 0; iev < nevents; iev++) {
+      intree->GetEntry(iev);
+      outtree->Fill();
+    }
+    outtree->CopyAddresses(intree, true);
+  }
+
+  infile->Close();
+  delete infile;
+  fOutFile->cd();
+
+  if(ok) {
+    LOG("Ntp", pNOTICE)
+      << "Copied " << nevents << " events from: " << filename;
+  }
+  if(restart) this->StartWriterThread();
+  return ok;
+}
+//____________________________________________________________________________
 void NtpWriter::Save(void)
 {
   LOG("Ntp", pINFO) << "Saving the output tree";
 
+  this->StopWriterThread();
+
+  if(fNMissingTuneXSec > 0) {
+    LOG("Ntp", pWARN)
+      << fNMissingTuneXSec << " alternate tune weights were set to 1, "
+      << "for lack of cross section splines of the event interaction";
+  }
+
   if(fOutFile) {
 
     fOutFile->Write();
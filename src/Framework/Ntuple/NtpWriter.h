@@ -6,6 +6,40 @@
 \brief   A utility class to facilitate creating the GENIE MC Ntuple from the
          output GENIE GHEP event records.
 
+         Optionally, the events are handed over to a writer thread through a
+         bounded queue, so that the tree filling (streaming, compression and
+         basket flushing) runs in parallel with the event generation. The
+         events are written in the order they were added, so the file
+         contents do not change. The writer thread is used only while the
+         event branch is the only branch of the tree: user-defined branches
+         (see EventTree()) are filled from objects owned by the caller, so
+         the tree is then filled synchronously again.
+
+         The GENIE summary tree (gst, see NtpGSTTree) can be written in the
+         output file alongside the GHEP event tree, or instead of it. In
+         the latter case, EventTree() returns the gst tree.
+
+         Unless disabled, a light-weight event index tree (gidx, see
+         NtpEventIndex) is written alongside the GHEP event tree.
+
+         If requested (--output-event-cost), the cost of generating each
+         event (see GHepEventCost) is written in a gcost branch of the GHEP
+         event tree.
+
+         For checkpointed jobs, Checkpoint() flushes the events written so
+         far to the output file and CopyEvents() restores them, when the
+         job is resumed, from the file of the interrupted job.
+
+         If alternate tunes are requested (--alt-tunes), a gtunewght branch
+         of the GHEP event tree holds one weight per alternate tune (leaves
+         named after the tunes): the ratio of the cross section splines of
+         the alternate and current tunes for the interaction of the event,
+         at its probe energy. It reweights the process mix and its energy
+         dependence, not the kinematics of the events, so it suits tunes
+         with the same models and phase space. The splines of the alternate
+         tunes must be in the input cross section file(s). The tree is then
+         filled in the generation thread, which owns the spline list.
+
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -21,8 +55,14 @@
 #define _NTP_WRITER_H_
 
 #include <string>
+#include <deque>
+#include <vector>
+#include <utility>
+
+#include <pthread.h>
 
 #include "Framework/Ntuple/NtpMCFormat.h"
+#include "Framework/GHEP/GHepEventCost.h"
 
 class TFile;
 class TTree;
@@ -30,12 +70,17 @@ class TBranch;
 class TClonesArray;
 
 using std::string;
+using std::deque;
+using std::vector;
+using std::pair;
 
 namespace genie {
 
 class EventRecord;
 class NtpMCEventRecord;
 class NtpMCTreeHeader;
+class NtpGSTTree;
+class NtpEventIndex;
 
 class NtpWriter {
 
@@ -55,19 +100,52 @@ public :
   ///< get the even tree
   TTree *  EventTree (void) { return fOutTree; }  
 
+  ///< get the output filename (known once Initialize() was called, or
+  ///< once a custom filename was set)
+  string   Filename  (void) const { return fOutFilename; }
+
+  ///< flush all events added so far to the output file, so that it can be
+  ///< recovered after an interruption (see GMCJCheckpoint)
+  void Checkpoint (void);
+
+  ///< resuming an interrupted job: copy its first nevents events (in a
+  ///< file flushed with Checkpoint()) to the output trees, including any
+  ///< user-defined branches (to be added before the call)
+  bool CopyEvents (string filename, Long64_t nevents);
+
   ///< use before Initialize() only if you wish to override the default
   ///< filename, or the default filename prefix
   void CustomizeFilename       (string filename);   
   void CustomizeFilenamePrefix (string prefix);
 
+  ///< use before Initialize() to choose the output trees: the GHEP event
+  ///< tree and/or the summary (gst) tree. By default, they are set from
+  ///< RunOpt (--output-gst, --output-gst-only).
+  void SetOutputTrees          (bool ghep, bool gst);
+
+  ///< use before Initialize() to fill the tree in a writer thread, with up
+  ///< to queue_size events waiting to be written (0: no writer thread).
+  ///< By default, it is set from RunOpt (--output-writer-thread).
+  void EnableWriterThread      (unsigned int queue_size);
+
 private:
 
+  static void * WriterThread (void * writer);
+
+  void StartWriterThread     (void);
+  void StopWriterThread      (void);
+  void WriteQueuedEvents     (void);
+  vector<TTree *> OutputTrees (void) const;
+
   void SetDefaultFilename    (string filename_prefix="gntp");
   void OpenFile              (string filename);
   void CreateTree            (void);
   void CreateTreeHeader      (void);
   void CreateEventBranch     (void);
   void CreateGHEPEventBranch (void);
+  void CreateGSTTree         (void);
+  void CreateTuneWeightBranch(void);
+  void FillTuneWeights       (const EventRecord & event);
 
   NtpMCFormat_t      fNtpFormat;          ///< enumeration of event formats
   Long_t             fRunNu;              ///< run nu
@@ -77,6 +155,28 @@ private:
   TBranch *          fEventBranch;        ///< the generated event branch 
   NtpMCEventRecord * fNtpMCEventRecord;   ///< 
   NtpMCTreeHeader *  fNtpMCTreeHeader;    ///<
+  NtpGSTTree *       fGSTTree;            ///< fills the summary tree, if requested
+  NtpEventIndex *    fEventIndex;         ///< fills the event index tree, if requested
+  bool               fOutputTreesSet;     ///< output trees set by SetOutputTrees()?
+  bool               fWriteGHEP;          ///< write the GHEP event tree?
+  bool               fWriteGST;           ///< write the summary (gst) tree?
+  int                fNOwnBranches;       ///< # of output tree branches, before user-defined ones
+  bool               fWriteCost;          ///< write the event cost branch?
+  GHepEventCost      fCost;               ///< the event cost branch object
+  vector<string>     fAltTunes;           ///< alternate tunes, with weights in the gtunewght branch
+  vector<double>     fTuneWeights;        ///< the tune weight branch object
+  long               fNMissingTuneXSec;   ///< # of tune weights set to 1 for lack of splines
+
+  bool                 fWriterThreadSet;  ///< writer thread set by EnableWriterThread()?
+  unsigned int         fQueueSize;        ///< max # of events waiting to be written (0: no writer thread)
+  bool                 fWriterRunning;    ///< is the writer thread running?
+  bool                 fWriterStop;       ///< asks the writer thread to exit once the queue is empty
+  pthread_t            fWriterThread;     ///< the writer thread
+  pthread_mutex_t      fQueueMutex;       ///< guards the queue and the free records
+  pthread_cond_t       fQueueNotEmpty;    ///< signalled when an event is queued
+  pthread_cond_t       fQueueNotFull;     ///< signalled when an event was written
+  deque< pair<int, EventRecord *> > fQueue;       ///< events waiting to be written
+  vector<EventRecord *>             fFreeRecords; ///< written event records, to be reused
 };
 
 }      // genie namespace
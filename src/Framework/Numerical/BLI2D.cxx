@@ -17,6 +17,17 @@
    in all lines similar to `int ix = (xmax-xmin)/dx'.
  @ July 29, 2011 - AM
    Added BLI2DNonUnifGrid.
+ @ Oct 14, 2026 - CA
+   Added accessors for the grid nodes and values, used for serializing the
+   INTRANUKE hN data.
+   Fixed BLI2DUnifGrid reading past the last node in Evaluate() at x = xmax
+   or y = ymax, and taking ymax from the x nodes in the (nx,ny,x,y,z) ctor.
+ @ Oct 14, 2026 - CA
+   BLI2DNonUnifGrid finds the grid cell by index arithmetic along evenly
+   spaced axes and by binary search otherwise, rather than by a linear scan.
+   Added batch evaluation and an optional (cached) bicubic interpolation.
+ @ Oct 14, 2026 - CA
+  Added ShareZ(), for grids using node values they do not own.
 
 */
 //____________________________________________________________________________
@@ -25,12 +36,33 @@
 
 #include <cassert>
 #include <limits>
+#include <algorithm>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/BLI2D.h"
 
 using namespace genie;
 
+//___________________________________________________________________________
+static bool EvenlySpaced(const double * v, int n, double & dv)
+{
+// Are the n nodes v[] evenly spaced (to a precision well beyond that of the
+// tabulated values)? If so, dv is the node spacing.
+
+  dv = 0.;
+  if(n < 2) return false;
+
+  double range = v[n-1] - v[0];
+  if(range <= 0.) return false;
+
+  dv = range / (n-1);
+  double tol = 1E-9 * range;
+  for(int i = 1; i < n-1; i++) {
+    if(TMath::Abs(v[i] - (v[0] + i*dv)) > tol) return false;
+  }
+  return true;
+}
+
 ClassImp(BLI2DGrid)
 
 //___________________________________________________________________________
@@ -43,7 +75,7 @@ BLI2DGrid::~BLI2DGrid()
 {
   if (fX) { delete [] fX; }
   if (fY) { delete [] fY; }
-  if (fZ) { delete [] fZ; }
+  if (fZ && fOwnsZ) { delete [] fZ; }
 }
 //___________________________________________________________________________
 int BLI2DGrid::IdxZ(int ix, int iy) const
@@ -51,6 +83,28 @@ int BLI2DGrid::IdxZ(int ix, int iy) const
   return ix*fNY+iy;
 }
 //___________________________________________________________________________
+void BLI2DGrid::ShareZ(const double * z)
+{
+  if (fZ && fOwnsZ) { delete [] fZ; }
+  fZ     = const_cast<double *>(z);
+  fOwnsZ = false;
+
+  fZmin = std::numeric_limits<double>::max();
+  fZmax = std::numeric_limits<double>::min();
+  for(int i = 0; i < fNZ; i++) {
+    fZmin = TMath::Min(z[i], fZmin);
+    fZmax = TMath::Max(z[i], fZmax);
+  }
+}
+//___________________________________________________________________________
+void BLI2DGrid::Evaluate(
+  int n, const double * x, const double * y, double * z) const
+{
+  for(int i = 0; i < n; i++) {
+    z[i] = this->Evaluate(x[i], y[i]);
+  }
+}
+//___________________________________________________________________________
 //___________________________________________________________________________
 //___________________________________________________________________________
 ClassImp(BLI2DUnifGrid)
@@ -72,7 +126,7 @@ BLI2DUnifGrid::BLI2DUnifGrid(
   double xmin = x[0];
   double xmax = x[nx-1];
   double ymin = y[0];
-  double ymax = y[nx-1];
+  double ymax = y[ny-1];
 
   this->Init(nx, xmin, xmax, ny, ymin, ymax);
 
@@ -85,6 +139,11 @@ BLI2DUnifGrid::BLI2DUnifGrid(
 //___________________________________________________________________________
 bool BLI2DUnifGrid::AddPoint(double x, double y, double z)
 {
+  if(!fOwnsZ) {
+    LOG("BLI2DUnifGrid", pWARN) << "Can not add points to a grid sharing its values";
+    return false;
+  }
+
   int ix = TMath::FloorNint( (x - fXmin + fDX/2) / fDX );
   int iy = TMath::FloorNint( (y - fYmin + fDY/2) / fDY );
   int iz = this->IdxZ(ix,iy);
@@ -109,6 +168,9 @@ double BLI2DUnifGrid::Evaluate(double x, double y) const
 
   int ix_lo  = TMath::FloorNint( (x - fXmin) / fDX ); 
   int iy_lo  = TMath::FloorNint( (y - fYmin) / fDY ); 
+  // in case x = xmax or y = ymax
+  ix_lo = TMath::Min(ix_lo, fNX-2);
+  iy_lo = TMath::Min(iy_lo, fNY-2);
   int ix_hi  = ix_lo + 1;
   int iy_hi  = iy_lo + 1;
 
@@ -140,6 +202,14 @@ double BLI2DUnifGrid::Evaluate(double x, double y) const
   return z;
 }
 //___________________________________________________________________________
+void BLI2DUnifGrid::Evaluate(
+  int n, const double * x, const double * y, double * z) const
+{
+  for(int i = 0; i < n; i++) {
+    z[i] = this->BLI2DUnifGrid::Evaluate(x[i], y[i]);
+  }
+}
+//___________________________________________________________________________
 void BLI2DUnifGrid::Init(
   int nx, double xmin, double xmax, int ny, double ymin, double ymax)
 {
@@ -157,6 +227,7 @@ void BLI2DUnifGrid::Init(
   fX    = 0;
   fY    = 0;
   fZ    = 0;
+  fOwnsZ = true;
 
   if(nx>1 && ny>1) {
     fNX = nx;
@@ -217,6 +288,10 @@ BLI2DNonUnifGrid::BLI2DNonUnifGrid(
 //___________________________________________________________________________
 bool BLI2DNonUnifGrid::AddPoint(double x, double y, double z)
 {
+  if(!fOwnsZ) {
+    LOG("BLI2DNonUnifGrid", pWARN) << "Can not add points to a grid sharing its values";
+    return false;
+  }
 
   // check the x,y values' existence before moving anything
   //   if they do, use them
@@ -327,6 +402,10 @@ bool BLI2DNonUnifGrid::AddPoint(double x, double y, double z)
   fZmin = TMath::Min(z, fZmin);
   fZmax = TMath::Max(z, fZmax);
 
+  // the nodes (or values) changed
+  fAxesChecked = false;
+  fCoeff.clear();
+
   LOG("BLI2DNonUnifGrid", pDEBUG) 
     << "Added x = " << x << " (ix = " << xidx << ")"
          << " y = " << y << " (iy = " << yidx << ") -> "
@@ -342,31 +421,19 @@ double BLI2DNonUnifGrid::Evaluate(double x, double y) const
   double evaly=TMath::Min(y,fYmax);
   evaly=TMath::Max(evaly,fYmin);
 
-  int ix_lo  = -2; 
-  int iy_lo  = -2;
-  for (int i=0;i<fNFillX;i++)
-    {
-      if (evalx<=fX[fNFillX-1-i]) ix_lo=fNFillX-2-i;
-      else break;
-    }
-  for (int i=0;i<fNFillY;i++)
-    {
-      if (evaly<=fY[fNFillY-1-i]) iy_lo=fNFillY-2-i;
-      else break;
-    }
+  // if an error occurs
+  if (fNFillX<2 || fNFillY<2) return 0.;
+
+  this->CheckAxes();
+
+  int ix_lo  = this->FindCellX(evalx);
+  int iy_lo  = this->FindCellY(evaly);
+
+  if (fBicubic) return this->EvalBicubic(ix_lo, iy_lo, evalx, evaly);
+
   int ix_hi  = ix_lo + 1;
   int iy_hi  = iy_lo + 1;
 
-  // in case x = xmin
-  if (ix_lo==-1) {ix_lo++; ix_hi++;}
-  if (iy_lo==-1) {iy_lo++; iy_hi++;}
-  // in case x = xmax
-  if (ix_lo==-2) {ix_lo=fNFillX-2; ix_hi=fNFillX-1;}
-  if (iy_lo==-2) {iy_lo=fNFillY-2; iy_hi=fNFillY-1;}
-  // if an error occurs
-  if (ix_lo<0       || iy_lo<0      ) return 0.;
-  if (ix_hi>fNFillX || iy_hi>fNFillY) return 0.;
-
   double x1  = fX[ix_lo];
   double x2  = fX[ix_hi];
   double y1  = fY[iy_lo];
@@ -414,6 +481,15 @@ void BLI2DNonUnifGrid::Init(
   fX     = 0;
   fY     = 0;
   fZ     = 0;
+  fOwnsZ = true;
+
+  fBicubic     = false;
+  fAxesChecked = false;
+  fXUnif       = false;
+  fYUnif       = false;
+  fUnifDX      = 0.;
+  fUnifDY      = 0.;
+  fCoeff.clear();
 
   if(nx>1 && ny>1) {
     fNX = nx;
@@ -437,3 +513,130 @@ void BLI2DNonUnifGrid::Init(
   }
 }
 //___________________________________________________________________________
+void BLI2DNonUnifGrid::Evaluate(
+  int n, const double * x, const double * y, double * z) const
+{
+  for(int i = 0; i < n; i++) {
+    z[i] = this->BLI2DNonUnifGrid::Evaluate(x[i], y[i]);
+  }
+}
+//___________________________________________________________________________
+void BLI2DNonUnifGrid::CheckAxes(void) const
+{
+  if(fAxesChecked) return;
+
+  fXUnif = EvenlySpaced(fX, fNFillX, fUnifDX);
+  fYUnif = EvenlySpaced(fY, fNFillY, fUnifDY);
+  fAxesChecked = true;
+
+  LOG("BLI2DNonUnifGrid", pDEBUG)
+    << "Evenly spaced nodes in x? " << fXUnif << ", in y? " << fYUnif;
+}
+//___________________________________________________________________________
+int BLI2DNonUnifGrid::FindCellX(double x) const
+{
+// Index of the lower x node of the grid cell containing x. Nodes already
+// belong to the cell below them, as in the linear scan used earlier.
+
+  int ix = (fXUnif) ?
+     TMath::FloorNint( (x - fX[0]) / fUnifDX ) :
+     (int) (std::lower_bound(fX, fX+fNFillX, x) - fX) - 1;
+
+  return TMath::Max(0, TMath::Min(ix, fNFillX-2));
+}
+//___________________________________________________________________________
+int BLI2DNonUnifGrid::FindCellY(double y) const
+{
+  int iy = (fYUnif) ?
+     TMath::FloorNint( (y - fY[0]) / fUnifDY ) :
+     (int) (std::lower_bound(fY, fY+fNFillY, y) - fY) - 1;
+
+  return TMath::Max(0, TMath::Min(iy, fNFillY-2));
+}
+//___________________________________________________________________________
+double BLI2DNonUnifGrid::EvalBicubic(int ix, int iy, double x, double y) const
+{
+  if(fCoeff.empty()) this->BuildCoeff();
+
+  const double * a = &fCoeff[16 * (ix*(fNFillY-1) + iy)];
+
+  double t = (x - fX[ix]) / (fX[ix+1] - fX[ix]);
+  double u = (y - fY[iy]) / (fY[iy+1] - fY[iy]);
+
+  double z = 0.;
+  for(int p = 3; p >= 0; p--) {
+    const double * ap = a + 4*p;
+    z = z*t + (((ap[3]*u + ap[2])*u + ap[1])*u + ap[0]);
+  }
+  return z;
+}
+//___________________________________________________________________________
+void BLI2DNonUnifGrid::BuildCoeff(void) const
+{
+// Compute the bicubic coefficients of all grid cells. The derivatives at the
+// nodes are estimated with finite differences (central ones at inner nodes,
+// one-sided at the edges). In each cell, with t, u the x, y positions scaled
+// to [0,1], z(t,u) = sum_{p,q} a[p][q] t^p u^q with a = M F M^T, where F
+// holds the cell corner values and (scaled) derivatives.
+
+  const int nx = fNFillX;
+  const int ny = fNFillY;
+
+  // derivatives at the nodes
+  vector<double> dzdx(nx*ny), dzdy(nx*ny), d2zdxdy(nx*ny);
+  for(int i = 0; i < nx; i++) {
+    int im = TMath::Max(i-1, 0);
+    int ip = TMath::Min(i+1, nx-1);
+    double hx = fX[ip] - fX[im];
+    for(int j = 0; j < ny; j++) {
+      int jm = TMath::Max(j-1, 0);
+      int jp = TMath::Min(j+1, ny-1);
+      double hy = fY[jp] - fY[jm];
+      dzdx   [i*ny+j] = (fZ[this->IdxZ(ip,j)] - fZ[this->IdxZ(im,j)]) / hx;
+      dzdy   [i*ny+j] = (fZ[this->IdxZ(i,jp)] - fZ[this->IdxZ(i,jm)]) / hy;
+      d2zdxdy[i*ny+j] = (fZ[this->IdxZ(ip,jp)] - fZ[this->IdxZ(ip,jm)] -
+                         fZ[this->IdxZ(im,jp)] + fZ[this->IdxZ(im,jm)]) / (hx*hy);
+    }
+  }
+
+  static const double M[4][4] = {
+    {  1.,  0.,  0.,  0. },
+    {  0.,  0.,  1.,  0. },
+    { -3.,  3., -2., -1. },
+    {  2., -2.,  1.,  1. }
+  };
+
+  fCoeff.assign(16 * (nx-1) * (ny-1), 0.);
+
+  double F[4][4], MF[4][4];
+  for(int ix = 0; ix < nx-1; ix++) {
+    double dx = fX[ix+1] - fX[ix];
+    for(int iy = 0; iy < ny-1; iy++) {
+      double dy = fY[iy+1] - fY[iy];
+      for(int a = 0; a < 2; a++) {
+        for(int b = 0; b < 2; b++) {
+          int in = (ix+a)*ny + (iy+b);
+          F[a  ][b  ] = fZ[this->IdxZ(ix+a,iy+b)];
+          F[a  ][2+b] = dzdy[in] * dy;
+          F[2+a][b  ] = dzdx[in] * dx;
+          F[2+a][2+b] = d2zdxdy[in] * dx * dy;
+        }
+      }
+      for(int p = 0; p < 4; p++) {
+        for(int s = 0; s < 4; s++) {
+          MF[p][s] = 0.;
+          for(int r = 0; r < 4; r++) MF[p][s] += M[p][r] * F[r][s];
+        }
+      }
+      double * coeff = &fCoeff[16 * (ix*(ny-1) + iy)];
+      for(int p = 0; p < 4; p++) {
+        for(int q = 0; q < 4; q++) {
+          double sum = 0.;
+          for(int s = 0; s < 4; s++) sum += MF[p][s] * M[q][s];
+          coeff[4*p+q] = sum;
+        }
+      }
+    }
+  }
+}
+//___________________________________________________________________________
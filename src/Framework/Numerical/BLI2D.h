@@ -5,6 +5,17 @@
 
 \brief    Bilinear interpolation of 2D functions on a regular grid.
 
+          BLI2DNonUnifGrid detects its axes with evenly spaced nodes and finds
+          the grid cell by index arithmetic along those (as BLI2DUnifGrid
+          does), and by binary search along the others. It can optionally
+          interpolate bicubically, with the coefficients of each grid cell
+          computed once (from finite difference derivatives at the nodes)
+          and cached.
+
+          The node values of either grid can be used in place (eg from a
+          memory-mapped file shared by the processes of a node) rather than
+          copied, see ShareZ().
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -19,8 +30,12 @@
 #ifndef _BILLINEAR_INTERPOLATION_2D_GRID_H_
 #define _BILLINEAR_INTERPOLATION_2D_GRID_H_
 
+#include <vector>
+
 #include <TObject.h>
 
+using std::vector;
+
 namespace genie {
 
 class BLI2DGrid : public TObject {
@@ -38,6 +53,9 @@ public:
   //-- evaluate the function at the input position
   virtual double Evaluate (double x, double y) const =0;
 
+  //-- evaluate the function at n positions: z[i] = f(x[i],y[i])
+  virtual void Evaluate (int n, const double * x, const double * y, double * z) const;
+
   // report min/max values
   double XMin (void) const { return fXmin; }
   double XMax (void) const { return fXmax; }
@@ -46,6 +64,18 @@ public:
   double ZMin (void) const { return fZmin; }
   double ZMax (void) const { return fZmax; }
 
+  // access the grid nodes and values
+  int    NX   (void)           const { return fNX; }
+  int    NY   (void)           const { return fNY; }
+  double X    (int ix)         const { return fX[ix]; }
+  double Y    (int iy)         const { return fY[iy]; }
+  double Z    (int ix, int iy) const { return fZ[this->IdxZ(ix,iy)]; }
+
+  // use the input fNZ node values in place of the grid's own ones: they must
+  // outlive the grid, which can no longer be modified by AddPoint()
+  virtual void ShareZ (const double * z);
+  bool         SharesZ (void) const { return !fOwnsZ; }
+
 protected:
 
   virtual void Init (int nx, double xmin, double xmax, int ny, double ymin, double ymax) =0;
@@ -66,6 +96,7 @@ protected:
   double   fYmax;
   double   fZmin;
   double   fZmax;
+  bool     fOwnsZ; //! fZ allocated by the grid?
 
   ClassDef(BLI2DGrid, 1)
   };
@@ -84,8 +115,9 @@ public:
   //-- add another point in the grid
   bool AddPoint(double x, double y, double z);
 
-  //-- evaluate the function at the input position
+  //-- evaluate the function at the input position(s)
   double Evaluate (double x, double y) const;
+  void   Evaluate (int n, const double * x, const double * y, double * z) const;
 
 private:
 
@@ -108,15 +140,45 @@ public:
   //-- add another point in the grid
   bool AddPoint(double x, double y, double z);
 
-  //-- evaluate the function at the input position
+  //-- evaluate the function at the input position(s)
   double Evaluate (double x, double y) const;
+  void   Evaluate (int n, const double * x, const double * y, double * z) const;
+
+  //-- interpolate bicubically rather than bilinearly (not stored with the grid)
+  void UseBicubic (bool on = true) { fBicubic = on; }
+  bool Bicubic    (void) const { return fBicubic; }
+
+  //-- use the input node values in place (see BLI2DGrid)
+  void ShareZ (const double * z) { BLI2DGrid::ShareZ(z); fCoeff.clear(); }
+
+  //-- # of x, y nodes already added
+  int NFillX (void) const { return fNFillX; }
+  int NFillY (void) const { return fNFillY; }
+
+  //-- are the x, y nodes evenly spaced?
+  bool XIsUniform (void) const { this->CheckAxes(); return fXUnif; }
+  bool YIsUniform (void) const { this->CheckAxes(); return fYUnif; }
 
 private:
 
-  void Init (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  void   Init        (int nx=0, double xmin=0, double xmax=0, int ny=0, double ymin=0, double ymax=0);
+  void   CheckAxes   (void) const;
+  int    FindCellX   (double x) const;
+  int    FindCellY   (double y) const;
+  double EvalBicubic (int ix, int iy, double x, double y) const;
+  void   BuildCoeff  (void) const;
+
   int      fNFillX;
   int      fNFillY;
 
+  bool                   fBicubic;     //! bicubic interpolation?
+  mutable bool           fAxesChecked; //! fXUnif, fYUnif up to date?
+  mutable bool           fXUnif;       //! evenly spaced x nodes?
+  mutable bool           fYUnif;       //! evenly spaced y nodes?
+  mutable double         fUnifDX;      //! x node spacing, if even
+  mutable double         fUnifDY;      //! y node spacing, if even
+  mutable vector<double> fCoeff;       //! bicubic coefficients, 16 per cell
+
   ClassDef(BLI2DNonUnifGrid, 1)
   };
 
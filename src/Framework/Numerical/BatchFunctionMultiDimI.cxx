@@ -0,0 +1,43 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include "Framework/Numerical/BatchFunctionMultiDimI.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+BatchFunctionMultiDimI::BatchFunctionMultiDimI() :
+ROOT::Math::IBaseFunctionMultiDim()
+{
+
+}
+//____________________________________________________________________________
+BatchFunctionMultiDimI::~BatchFunctionMultiDimI()
+{
+
+}
+//____________________________________________________________________________
+void BatchFunctionMultiDimI::EvalBatch(
+  unsigned int n, const double * x, double * f) const
+{
+  unsigned int ndim = this->NDim();
+  for(unsigned int i = 0; i < n; i++) {
+    f[i] = (*this)(&x[i*ndim]);
+  }
+}
+//____________________________________________________________________________
+BatchFunctionMultiDimI * BatchFunctionMultiDimI::ThreadClone(void) const
+{
+  return 0;
+}
+//____________________________________________________________________________
@@ -0,0 +1,48 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::BatchFunctionMultiDimI
+
+\brief    A multi-dimensional function that can be evaluated at a batch of
+          points at once and that can be copied for concurrent evaluation.
+
+          EvalBatch() evaluates the function at n points stored one after the
+          other (point i at x[i*NDim()]); the default just loops over operator().
+          ThreadClone() returns a copy that shares no mutable state with the
+          original, so that the two can be evaluated in different threads,
+          or 0 if the function can't provide one (the default). Integrators
+          (see VegasIntegrator) use these when they are available and fall
+          back to serial, one point at a time evaluation otherwise.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _BATCH_FUNCTION_MULTIDIM_I_H_
+#define _BATCH_FUNCTION_MULTIDIM_I_H_
+
+#include <Math/IFunction.h>
+
+namespace genie {
+
+class BatchFunctionMultiDimI: public ROOT::Math::IBaseFunctionMultiDim
+{
+public:
+  virtual ~BatchFunctionMultiDimI();
+
+  virtual void EvalBatch (unsigned int n, const double * x, double * f) const;
+  virtual BatchFunctionMultiDimI * ThreadClone (void) const;
+
+protected:
+  BatchFunctionMultiDimI();
+};
+
+}      // genie namespace
+#endif // _BATCH_FUNCTION_MULTIDIM_I_H_
@@ -0,0 +1,114 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/GridSampler.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+GridSampler::GridSampler(
+  int nx, double xmin, double xmax, int ny, double ymin, double ymax) :
+fNX    (TMath::Max(1,nx)),
+fNY    (TMath::Max(1,ny)),
+fXMin  (xmin),
+fYMin  (ymin),
+fBuilt (false)
+{
+  fDX = (xmax - xmin) / fNX;
+  fDY = (ymax - ymin) / fNY;
+  fWeight.assign(fNX*fNY, 0.);
+}
+//____________________________________________________________________________
+GridSampler::~GridSampler()
+{
+
+}
+//____________________________________________________________________________
+void GridSampler::SetCell(int ix, int iy, double w)
+{
+  if(ix < 0 || ix >= fNX || iy < 0 || iy >= fNY) return;
+
+  fWeight[ix*fNY+iy] = TMath::Max(0., w);
+  fBuilt = false;
+}
+//____________________________________________________________________________
+bool GridSampler::Build(void)
+{
+  unsigned int n = fWeight.size();
+  fCDF.resize(n);
+
+  double sum = 0.;
+  for(unsigned int i = 0; i < n; i++) {
+    sum    += fWeight[i];
+    fCDF[i] = sum;
+  }
+  if(sum <= 0.) {
+    LOG("GridSampler", pWARN) << "All cell weights are 0";
+    fBuilt = false;
+    return false;
+  }
+  for(unsigned int i = 0; i < n; i++) fCDF[i] /= sum;
+  fCDF[n-1] = 1.;
+
+  fBuilt = true;
+  return true;
+}
+//____________________________________________________________________________
+void GridSampler::Generate(TRandom3 & rnd, double & x, double & y) const
+{
+  x = fXMin;
+  y = fYMin;
+  if(!fBuilt) return;
+
+  // pick a cell: the first one whose cumulative weight exceeds u
+  // (cells with 0 weight are never picked)
+  double u = rnd.Rndm();
+  unsigned int i =
+      std::upper_bound(fCDF.begin(), fCDF.end(), u) - fCDF.begin();
+  if(i >= fCDF.size()) i = fCDF.size() - 1;
+
+  int ix = i / fNY;
+  int iy = i % fNY;
+
+  x = fXMin + (ix + rnd.Rndm()) * fDX;
+  y = fYMin + (iy + rnd.Rndm()) * fDY;
+}
+//____________________________________________________________________________
+double GridSampler::Generate(TRandom3 & rnd) const
+{
+  double x = fXMin;
+  if(!fBuilt) return x;
+
+  double u = rnd.Rndm();
+  unsigned int i =
+      std::upper_bound(fCDF.begin(), fCDF.end(), u) - fCDF.begin();
+  if(i >= fCDF.size()) i = fCDF.size() - 1;
+
+  return fXMin + (i / fNY + rnd.Rndm()) * fDX;
+}
+//____________________________________________________________________________
+double GridSampler::Weight(double x, double y) const
+{
+  int ix = (int) TMath::Floor((x - fXMin) / fDX);
+  int iy = (fNY > 1) ? (int) TMath::Floor((y - fYMin) / fDY) : 0;
+  if(ix < 0 || ix >= fNX || iy < 0 || iy >= fNY) return 0.;
+
+  return fWeight[ix*fNY+iy];
+}
+//____________________________________________________________________________
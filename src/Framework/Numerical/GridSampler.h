@@ -0,0 +1,75 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::GridSampler
+
+\brief    Samples a 1-D or 2-D distribution tabulated on a regular grid of
+          cells, without rejection.
+
+          Every cell is given a non-negative weight. Build() computes the
+          cumulative distribution over all cells. Generate() then picks a
+          cell with probability proportional to its weight (inverse CDF, by
+          binary search) and returns a point uniformly distributed within
+          that cell. A histogram sampled with TH1::GetRandom() is reproduced
+          exactly by a 1-D GridSampler with the histogram bin contents as
+          cell weights. Smooth distributions should be tabulated on cells
+          fine enough for their variation within a cell to be negligible.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _GRID_SAMPLER_H_
+#define _GRID_SAMPLER_H_
+
+#include <vector>
+
+class TRandom3;
+
+using std::vector;
+
+namespace genie {
+
+class GridSampler
+{
+public:
+  GridSampler(int nx, double xmin, double xmax,
+              int ny = 1, double ymin = 0., double ymax = 1.);
+ ~GridSampler();
+
+  void   SetCell  (int ix, int iy, double w);       ///< weight (>=0) of cell (ix,iy)
+  void   SetCell  (int ix, double w) { this->SetCell(ix, 0, w); }
+  bool   Build    (void);                           ///< false if all weights are 0
+  bool   IsBuilt  (void) const { return fBuilt; }
+
+  void   Generate (TRandom3 & rnd, double & x, double & y) const;
+  double Generate (TRandom3 & rnd) const;           ///< 1-D case
+
+  double Weight   (double x, double y = 0.) const;  ///< weight of the cell containing (x,y)
+  double XCentre  (int ix) const { return fXMin + (ix + 0.5) * fDX; }
+  double YCentre  (int iy) const { return fYMin + (iy + 0.5) * fDY; }
+  int    NX       (void) const { return fNX; }
+  int    NY       (void) const { return fNY; }
+
+private:
+
+  int            fNX;     ///< # of cells along x
+  int            fNY;     ///< # of cells along y
+  double         fXMin;   ///< x range min
+  double         fYMin;   ///< y range min
+  double         fDX;     ///< cell width along x
+  double         fDY;     ///< cell width along y
+  vector<double> fWeight; ///< cell weights [ix*fNY+iy]
+  vector<double> fCDF;    ///< normalized cumulative weights [ix*fNY+iy]
+  bool           fBuilt;  ///< CDF up to date?
+};
+
+}      // genie namespace
+#endif // _GRID_SAMPLER_H_
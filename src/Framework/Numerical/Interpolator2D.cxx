@@ -5,190 +5,167 @@
  or see $GENIE/LICENSE
 
  Author: Steve Dennis <s.r.dennis \at liverpool.ac.uk>
+
+ Important revisions :
+ @ Oct 14, 2026 - CA
+   The bilinear interpolating polynomial of each cell is now computed at
+   construction and cached, instead of having GSL's spline2d (or TGraph2D,
+   for GSL < 2) work it out at each call. This also gives the derivatives
+   without GSL 2.
 */
 //____________________________________________________________________________
 
 #include <cassert>
 #include <cstdlib>
+#include <cmath>
 
 #include "Framework/Numerical/Interpolator2D.h"
-#include "gsl/gsl_version.h"
 
-using namespace genie;
+using std::vector;
 
-// Implemented primarily with the GSL v2 spline2d class.
-// However, not all sites have this, so there's a backup implementation using TGraph2D
-#if GSL_MAJOR_VERSION >= 2
-#include "gsl/gsl_spline2d.h"
+using namespace genie;
 
-// define our Pimpl structs
-struct Interpolator2D::spline2d_container
-{
-  spline2d_container() : spl(NULL) {};
-  ~spline2d_container() { if (spl) delete spl; };
-  gsl_spline2d * spl;
-};
 //____________________________________________________________________________
-struct Interpolator2D::interp_accel_container
+static bool EvenlySpaced(const vector<double> & v, double & inv_step)
 {
-  interp_accel_container() : acc(NULL) {};
-  ~interp_accel_container() { if (acc) delete acc; };
-  gsl_interp_accel * acc;
-};
-//____________________________________________________________________________
+// Are the nodes evenly spaced (to a precision well beyond that of the
+// tabulated values)? If so, inv_step is the inverse node spacing.
+
+  inv_step = 0.;
+  size_t n = v.size();
+  if(n < 2) return false;
 
-// Now define our actual code (GSL)
+  double range = v[n-1] - v[0];
+  if(range <= 0.) return false;
+
+  double step = range / (n-1);
+  double tol  = 1E-9 * range;
+  for(size_t i = 1; i < n-1; i++) {
+    if(std::fabs(v[i] - (v[0] + i*step)) > tol) return false;
+  }
+  inv_step = 1. / step;
+  return true;
+}
 //____________________________________________________________________________
 Interpolator2D::Interpolator2D(
   const size_t & size_x, const double * grid_x,
   const size_t & size_y, const double * grid_y,
   const double * knots) :
-  fSpline (new Interpolator2D::spline2d_container()     ),
-  fAcc_x  (new Interpolator2D::interp_accel_container() ),
-  fAcc_y  (new Interpolator2D::interp_accel_container() )
+  fNX (size_x),
+  fNY (size_y),
+  fX  (grid_x, grid_x + size_x),
+  fY  (grid_y, grid_y + size_y)
 {
-  fSpline->spl = gsl_spline2d_alloc(gsl_interp2d_bilinear,size_x,size_y);
-  gsl_spline2d_init(fSpline->spl,grid_x,grid_y,knots,size_x,size_y);
-  fAcc_x->acc = gsl_interp_accel_alloc();
-  fAcc_y->acc = gsl_interp_accel_alloc();
+  assert(fNX > 1 && fNY > 1);
+
+  fXUnif = EvenlySpaced(fX, fXInvStep);
+  fYUnif = EvenlySpaced(fY, fYInvStep);
+
+  fInvDX.resize(fNX-1);
+  fInvDY.resize(fNY-1);
+  for(size_t ix = 0; ix < fNX-1; ix++) fInvDX[ix] = 1. / (fX[ix+1] - fX[ix]);
+  for(size_t iy = 0; iy < fNY-1; iy++) fInvDY[iy] = 1. / (fY[iy+1] - fY[iy]);
+
+  size_t ncells = (fNX-1) * (fNY-1);
+  fA00.resize(ncells);
+  fA10.resize(ncells);
+  fA01.resize(ncells);
+  fA11.resize(ncells);
+
+  for(size_t ix = 0; ix < fNX-1; ix++) {
+    for(size_t iy = 0; iy < fNY-1; iy++) {
+      double z11 = knots[ iy   *fNX + ix  ];
+      double z21 = knots[ iy   *fNX + ix+1];
+      double z12 = knots[(iy+1)*fNX + ix  ];
+      double z22 = knots[(iy+1)*fNX + ix+1];
+      size_t ic  = ix*(fNY-1) + iy;
+      fA00[ic] = z11;
+      fA10[ic] = z21 - z11;
+      fA01[ic] = z12 - z11;
+      fA11[ic] = z11 - z21 - z12 + z22;
+    }
+  }
 }
 //____________________________________________________________________________
 Interpolator2D::~Interpolator2D()
 {
-  if (fSpline) delete fSpline;
-  if (fAcc_x ) delete fAcc_x;
-  if (fAcc_y ) delete fAcc_y;
-}
-//____________________________________________________________________________
-double Interpolator2D::Eval(const double & x, const double & y) const
-{
-  return gsl_spline2d_eval(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
-}
-//____________________________________________________________________________
-double Interpolator2D::DerivX(const double & x, const double & y) const
-{
-  return gsl_spline2d_eval_deriv_x(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
-}
-//____________________________________________________________________________
-double Interpolator2D::DerivY(const double & x, const double & y) const
-{
-  return gsl_spline2d_eval_deriv_y(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
-}
-//____________________________________________________________________________
-double Interpolator2D::DerivXX(const double & x, const double & y) const
-{
-  return gsl_spline2d_eval_deriv_xx(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
-}
-//____________________________________________________________________________
-double Interpolator2D::DerivXY(const double & x, const double & y) const
-{
-  return gsl_spline2d_eval_deriv_xy(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
-}
-//____________________________________________________________________________
-double Interpolator2D::DerivYY(const double & x, const double & y) const
-{
-  return gsl_spline2d_eval_deriv_yy(
-    fSpline->spl, x, y,
-    fAcc_x->acc,
-    fAcc_y->acc);
+
 }
 //____________________________________________________________________________
-//____________________________________________________________________________
-//____________________________________________________________________________
-// And now the TGraph2D version
-#else
-#include "TGraph2D.h"
-// define our Pimpl structs for TGraph
-struct Interpolator2D::spline2d_container
+size_t Interpolator2D::FindNode(
+  const vector<double> & grid, bool unif, double inv_step, double x) const
 {
-  spline2d_container() : spl(NULL) {};
-  ~spline2d_container() { if (spl) delete spl; };
-  TGraph2D * spl;
-};
-//____________________________________________________________________________
-struct Interpolator2D::interp_accel_container
-{
-  interp_accel_container() {};
-  ~interp_accel_container() { };
-};
-//____________________________________________________________________________
-// Now define our actual code (TGraph2D)
-//____________________________________________________________________________
-Interpolator2D::Interpolator2D(
-  const size_t & size_x, const double * grid_x,
-  const size_t & size_y, const double * grid_y,
-  const double * knots) :
-  fSpline (new spline2d_container()),
-  fAcc_x  (NULL),
-  fAcc_y  (NULL)
-{
-  fSpline->spl = new TGraph2D(size_x*size_y);
-  fSpline->spl->SetDirectory(0);
-  size_t iz = 0;
-  for (size_t iy = 0 ; iy < size_y ; iy++) {
-    for (size_t ix = 0 ; ix < size_x ; ix++) {
-      fSpline->spl->SetPoint(iz,grid_x[ix],grid_y[iy],knots[iz]);
-      iz++;
-    }
+// Index of the lower node of the cell containing x (in [0, n-2]; x is within
+// the grid). The binary search runs a fixed number of steps for a given
+// grid, with a select rather than a branch at each step.
+
+  size_t n = grid.size();
+  if(unif) {
+    size_t i = (size_t) ((x - grid[0]) * inv_step);
+    return (i < n-2) ? i : n-2;
   }
+
+  const double * g = &grid[0];
+  size_t base = 0;
+  size_t len  = n - 1;
+  while(len > 1) {
+    size_t half = len / 2;
+    base = (g[base+half] <= x) ? base + half : base;
+    len -= half;
+  }
+  return base;
 }
 //____________________________________________________________________________
-Interpolator2D::~Interpolator2D()
+size_t Interpolator2D::FindCell(
+  const double & x, const double & y, double & t, double & u) const
 {
-  if (fSpline) delete fSpline;
-  if (fAcc_x ) delete fAcc_x;
-  if (fAcc_y ) delete fAcc_y;
+  double xc = (x < fX[0]) ? fX[0] : ((x > fX[fNX-1]) ? fX[fNX-1] : x);
+  double yc = (y < fY[0]) ? fY[0] : ((y > fY[fNY-1]) ? fY[fNY-1] : y);
+
+  size_t ix = this->FindNode(fX, fXUnif, fXInvStep, xc);
+  size_t iy = this->FindNode(fY, fYUnif, fYInvStep, yc);
+
+  t = (xc - fX[ix]) * fInvDX[ix];
+  u = (yc - fY[iy]) * fInvDY[iy];
+
+  return ix*(fNY-1) + iy;
 }
 //____________________________________________________________________________
 double Interpolator2D::Eval(const double & x, const double & y) const
 {
-  return fSpline->spl->Interpolate(x,y);
+  double t, u;
+  size_t ic = this->FindCell(x, y, t, u);
+  return fA00[ic] + t * (fA10[ic] + u * fA11[ic]) + u * fA01[ic];
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivX(const double & x, const double & y) const
 {
-  assert(!"Method requires GSL version 2 or higher.");
-  return -999;
+  double t, u;
+  size_t ic = this->FindCell(x, y, t, u);
+  return (fA10[ic] + u * fA11[ic]) * fInvDX[ic / (fNY-1)];
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivY(const double & x, const double & y) const
 {
-  assert(!"Method requires GSL version 2 or higher.");
-  return -999;
+  double t, u;
+  size_t ic = this->FindCell(x, y, t, u);
+  return (fA01[ic] + t * fA11[ic]) * fInvDY[ic % (fNY-1)];
 }
 //____________________________________________________________________________
-double Interpolator2D::DerivXX(const double & x, const double & y) const
+double Interpolator2D::DerivXX(const double & /*x*/, const double & /*y*/) const
 {
-  assert(!"Method requires GSL version 2 or higher.");
-  return -999;
+  return 0.;
 }
 //____________________________________________________________________________
 double Interpolator2D::DerivXY(const double & x, const double & y) const
 {
-  assert(!"Method requires GSL version 2 or higher.");
-  return -999;
+  double t, u;
+  size_t ic = this->FindCell(x, y, t, u);
+  return fA11[ic] * fInvDX[ic / (fNY-1)] * fInvDY[ic % (fNY-1)];
 }
 //____________________________________________________________________________
-double Interpolator2D::DerivYY(const double & x, const double & y) const
+double Interpolator2D::DerivYY(const double & /*x*/, const double & /*y*/) const
 {
-  assert(!"Method requires GSL version 2 or higher.");
-  return -999;
+  return 0.;
 }
 //____________________________________________________________________________
-
-#endif // GSL_MAJOR_VERSION
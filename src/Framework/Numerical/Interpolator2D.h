@@ -3,8 +3,16 @@
 
 \class    genie::Interpolator2D
 
-\brief    A 2D interpolator using the GSL spline type
-          If GSL version is not sufficient, does an inefficient version using TGraph2D.
+\brief    A 2D (bilinear) interpolator of values tabulated on a rectangular
+          grid, the knots being stored as in GSL's spline2d: the value at
+          (grid_x[i], grid_y[j]) is knots[j*size_x+i].
+
+          The interpolating polynomial of each grid cell is computed once, at
+          construction, and stored in structure-of-arrays form, so that an
+          evaluation (or a derivative) needs only the cell search, done by
+          index arithmetic along evenly spaced axes and by a fixed-length
+          binary search otherwise, and a few multiply-adds. Positions outside
+          the grid are moved to the nearest grid edge.
 
 \author   Steve Dennis <s.r.dennis \at liverpool.ac.uk>
           University of Liverpool
@@ -18,6 +26,7 @@
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <vector>
 
 #ifndef GENIE_INTERPOLATOR2D_H_
 #define GENIE_INTERPOLATOR2D_H_
@@ -31,23 +40,36 @@ class Interpolator2D
                    const size_t & size_y, const double * grid_y,
                    const double * knots);
     ~Interpolator2D();
-    
+
     double Eval    (const double & x, const double & y) const;
     double DerivX  (const double & x, const double & y) const;
     double DerivY  (const double & x, const double & y) const;
     double DerivXX (const double & x, const double & y) const;
     double DerivXY (const double & x, const double & y) const;
     double DerivYY (const double & x, const double & y) const;
-    
+
   private:
-    // Done using PIMPL to avoid GSL vs ROOT mess in libraries
-    // Struct type declarations will be done in object code
-    struct spline2d_container    ; // stores type gsl_spline2d
-    struct interp_accel_container; // stores type gsl_interp_accel
-    // And these are our actual members
-    spline2d_container             * fSpline;
-    mutable interp_accel_container * fAcc_x;
-    mutable interp_accel_container * fAcc_y;
+    // Find the cell containing (x,y) and the position within it, in [0,1]^2
+    size_t FindCell (const double & x, const double & y, double & t, double & u) const;
+    size_t FindNode (const std::vector<double> & grid, bool unif, double inv_step, double x) const;
+
+    size_t              fNX;        ///< # of x nodes
+    size_t              fNY;        ///< # of y nodes
+    std::vector<double> fX;         ///< x nodes
+    std::vector<double> fY;         ///< y nodes
+    bool                fXUnif;     ///< evenly spaced x nodes?
+    bool                fYUnif;     ///< evenly spaced y nodes?
+    double              fXInvStep;  ///< 1 / x node spacing, if even
+    double              fYInvStep;  ///< 1 / y node spacing, if even
+    std::vector<double> fInvDX;     ///< 1 / width of each x cell
+    std::vector<double> fInvDY;     ///< 1 / width of each y cell
+
+    // coefficients of the polynomial z = a00 + a10*t + a01*u + a11*t*u of
+    // each cell [ix*(fNY-1)+iy], with t,u the position within the cell
+    std::vector<double> fA00;
+    std::vector<double> fA10;
+    std::vector<double> fA01;
+    std::vector<double> fA11;
 };
 
 } // namespace genie
@@ -12,19 +12,30 @@
  Important revisions after version 2.0.0 :
  @ Jan 24, 2013 - CA
    No longer uses the $GSEED variable for setting the random number seed.
+ @ Oct 14, 2026 - CA
+   Added Next() and FillUniform(), drawing the numbers of a stream in blocks.
+ @ Oct 14, 2026 - CA
+   Added SaveState() and RestoreState().
 
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <sstream>
 
+#include <TMath.h>
 #include <TSystem.h>
 #include <TPythia6.h>
+#include <TDirectory.h>
+#include <TArrayD.h>
+#include <TArrayL64.h>
 
 #include "Framework/Conventions/Controls.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 
+using std::ostringstream;
+
 using namespace genie::controls;
 
 namespace genie {
@@ -38,6 +49,12 @@ RandomGen::RandomGen()
 
   fInitalized = false;
   fInstance = 0;
+  fEventIndex = -1;
+  for(int i = 0; i < kNRndStreams; i++) {
+    fRandom3[i] = 0;
+    fCache[i].fPos = 0;
+    fCache[i].fN   = 0;
+  }
 /*
   // try to get this job's random number seed from the environment
   const char * seed = gSystem->Getenv("GSEED");
@@ -73,7 +90,9 @@ RandomGen::RandomGen()
 RandomGen::~RandomGen()
 {
   fInstance = 0;
-  if(fRandom3) delete fRandom3;
+  for(int i = 0; i < kNRndStreams; i++) {
+    if(fRandom3[i]) delete fRandom3[i];
+  }
 }
 //____________________________________________________________________________
 RandomGen * RandomGen::Instance()
@@ -96,25 +115,12 @@ void RandomGen::SetSeed(long int seed)
      << ((fInitalized) ? ": " : " at random number generator initialization: ")
      << seed;
 
-  // Set the seed number for all internal GENIE random number generators
-  this->RndKine ().SetSeed(seed);
-  this->RndHadro().SetSeed(seed);
-  this->RndDec  ().SetSeed(seed); 
-  this->RndFsi  ().SetSeed(seed);
-  this->RndLep  ().SetSeed(seed);
-  this->RndISel ().SetSeed(seed);
-  this->RndGeom ().SetSeed(seed);
-  this->RndFlux ().SetSeed(seed);
-  this->RndEvg  ().SetSeed(seed);
-  this->RndNum  ().SetSeed(seed); 
-  this->RndGen  ().SetSeed(seed);
-
-  // Set the seed number for ROOT's gRandom
-  gRandom ->SetSeed (seed);
-
-  // Set the PYTHIA6 seed number
-  TPythia6 * pythia6 = TPythia6::Instance();
-  pythia6->SetMRPY(1, seed);
+  fCurrSeed   = seed;
+  fEventIndex = -1;
+
+  // Set the seed number for all internal GENIE random number generators,
+  // ROOT's gRandom and PYTHIA6
+  this->SeedStreams();
 
   LOG("Rndm", pINFO) << "RndKine  seed = " << this->RndKine ().GetSeed();
   LOG("Rndm", pINFO) << "RndHadro seed = " << this->RndHadro().GetSeed();
@@ -128,12 +134,181 @@ void RandomGen::SetSeed(long int seed)
   LOG("Rndm", pINFO) << "RndNum   seed = " << this->RndNum  ().GetSeed();
   LOG("Rndm", pINFO) << "RndGen   seed = " << this->RndGen  ().GetSeed();
   LOG("Rndm", pINFO) << "gRandom  seed = " << gRandom->GetSeed();
-  LOG("Rndm", pINFO) << "PYTHIA6  seed = " << pythia6->GetMRPY(1);
+  LOG("Rndm", pINFO) << "PYTHIA6  seed = " << TPythia6::Instance()->GetMRPY(1);
+}
+//____________________________________________________________________________
+void RandomGen::SetEventIndex(long int ievent)
+{
+// Reseed all streams for generating the event with the input index.
+// Calling this before generating each event makes every event a function of
+// (master seed, event index) only, so any event can be regenerated alone and
+// events can be generated in any order (or by several workers) reproducibly.
+//
+  fEventIndex = (ievent < 0) ? -1 : ievent;
+  this->SeedStreams();
+
+  LOG("Rndm", pDEBUG)
+     << "Reseeded random number streams for event index: " << fEventIndex;
+}
+//____________________________________________________________________________
+unsigned long RandomGen::StreamSeed(long int seed, int stream, long int ievent)
+{
+// Derive the seed of a stream from the master seed, the stream id and the
+// event index using the SplitMix64 finalizer (a bijective 64-bit mixer), so
+// that nearby inputs give uncorrelated outputs. The result is folded to a
+// non-zero 32-bit number, as used by TRandom3::SetSeed (0 means `random').
+//
+  unsigned long long x = (unsigned long long) seed;
+  x ^= 0x9E3779B97F4A7C15ULL * (unsigned long long) (stream + 1);
+  x ^= 0xD1B54A32D192ED03ULL * (unsigned long long) (ievent + 1);
+
+  x += 0x9E3779B97F4A7C15ULL;
+  x  = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  x  = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+  x  =  x ^ (x >> 31);
+
+  unsigned long s32 = (unsigned long) ((x ^ (x >> 32)) & 0xFFFFFFFFULL);
+  return (s32 == 0) ? 1 : s32;
+}
+//____________________________________________________________________________
+void RandomGen::SeedStreams(void)
+{
+  for(int i = 0; i < kNRndStreams; i++) {
+    fRandom3[i]->SetSeed(RandomGen::StreamSeed(fCurrSeed, i, fEventIndex));
+    fCache[i].fPos = 0;
+    fCache[i].fN   = 0;
+  }
+
+  // ROOT's gRandom is used by some ROOT utilities called from within GENIE
+  // (eg TH1::GetRandom). Give it a stream of its own.
+  gRandom->SetSeed(RandomGen::StreamSeed(fCurrSeed, kNRndStreams, fEventIndex));
+
+  // Set the PYTHIA6 seed number (MRPY(1) is only picked-up by PYR at
+  // initialization, which is forced again by setting MRPY(2)=0)
+  TPythia6 * pythia6 = TPythia6::Instance();
+  long int pseed = (fEventIndex < 0) ? fCurrSeed :
+      (long int) (RandomGen::StreamSeed(fCurrSeed,kNRndStreams+1,fEventIndex) % 900000000);
+  pythia6->SetMRPY(1, pseed);
+  pythia6->SetMRPY(2, 0);
+}
+//____________________________________________________________________________
+void RandomGen::FillUniform(RndStream_t s, double * buf, int n) const
+{
+// Hands out the numbers still in the stream cache first, so that mixing
+// FillUniform() and Next() calls keeps the stream sequence
+
+  RndCache_t & cache = fCache[s];
+  int ncached = TMath::Min(n, cache.fN - cache.fPos);
+  for(int i = 0; i < ncached; i++) buf[i] = cache.fBuf[cache.fPos++];
+  if(n > ncached) fRandom3[s]->RndmArray(n - ncached, buf + ncached);
+}
+//____________________________________________________________________________
+void RandomGen::RefillCache(RndStream_t s) const
+{
+  RndCache_t & cache = fCache[s];
+  fRandom3[s]->RndmArray(kRndCacheSize, cache.fBuf);
+  cache.fPos = 0;
+  cache.fN   = kRndCacheSize;
+}
+//____________________________________________________________________________
+void RandomGen::SaveState(TDirectory * dir) const
+{
+// Writes each stream generator along with the numbers left in its cache, 
+// ROOT's gRandom (if it is a TRandom3), and the PYTHIA6 generator state
+// (the MRPY and RRPY arrays of its PYDATR common block)
+
+  for(int i = 0; i < kNRndStreams; i++) {
+    ostringstream name;
+    name << "Stream" << i;
+    dir->WriteTObject(fRandom3[i], name.str().c_str());
+
+    const RndCache_t & cache = fCache[i];
+    TArrayD cached(cache.fN - cache.fPos, cache.fBuf + cache.fPos);
+    name << "Cache";
+    dir->WriteObject(&cached, name.str().c_str());
+  }
+  TRandom3 * groot = dynamic_cast<TRandom3 *>(gRandom);
+  if(groot) dir->WriteTObject(groot, "gRandom");
+
+  TArrayL64 seeds(2);
+  seeds[0] = fCurrSeed;
+  seeds[1] = fEventIndex;
+  dir->WriteObject(&seeds, "Seeds");
+
+  TPythia6 * pythia6 = TPythia6::Instance();
+  TArrayL64 mrpy(6);
+  for(int i = 0; i < 6; i++) mrpy[i] = pythia6->GetMRPY(i+1);
+  TArrayD rrpy(100);
+  for(int i = 0; i < 100; i++) rrpy[i] = pythia6->GetRRPY(i+1);
+  dir->WriteObject(&mrpy, "PythiaMRPY");
+  dir->WriteObject(&rrpy, "PythiaRRPY");
+}
+//____________________________________________________________________________
+bool RandomGen::RestoreState(TDirectory * dir)
+{
+  TArrayL64 * seeds = 0;
+  dir->GetObject("Seeds", seeds);
+  if(!seeds || seeds->GetSize() != 2) {
+    LOG("Rndm", pERROR) << "No random number generator state found";
+    delete seeds;
+    return false;
+  }
+  fCurrSeed   = (*seeds)[0];
+  fEventIndex = (*seeds)[1];
+  delete seeds;
+
+  for(int i = 0; i < kNRndStreams; i++) {
+    ostringstream name;
+    name << "Stream" << i;
+    TRandom3 * rnd = 0;
+    dir->GetObject(name.str().c_str(), rnd);
+    name << "Cache";
+    TArrayD * cached = 0;
+    dir->GetObject(name.str().c_str(), cached);
+    if(!rnd || !cached || cached->GetSize() > kRndCacheSize) {
+      LOG("Rndm", pERROR) << "Missing state of random number stream " << i;
+      delete rnd;
+      delete cached;
+      return false;
+    }
+    *fRandom3[i] = *rnd;
+    RndCache_t & cache = fCache[i];
+    cache.fPos = 0;
+    cache.fN   = cached->GetSize();
+    for(int k = 0; k < cache.fN; k++) cache.fBuf[k] = (*cached)[k];
+    delete rnd;
+    delete cached;
+  }
+
+  TRandom3 * groot = dynamic_cast<TRandom3 *>(gRandom);
+  TRandom3 * groot_state = 0;
+  dir->GetObject("gRandom", groot_state);
+  if(groot && groot_state) *groot = *groot_state;
+  delete groot_state;
+
+  TArrayL64 * mrpy = 0;
+  TArrayD   * rrpy = 0;
+  dir->GetObject("PythiaMRPY", mrpy);
+  dir->GetObject("PythiaRRPY", rrpy);
+  if(mrpy && rrpy && mrpy->GetSize() == 6 && rrpy->GetSize() == 100) {
+    TPythia6 * pythia6 = TPythia6::Instance();
+    for(int i = 0; i < 6;   i++) pythia6->SetMRPY(i+1, (*mrpy)[i]);
+    for(int i = 0; i < 100; i++) pythia6->SetRRPY(i+1, (*rrpy)[i]);
+  }
+  delete mrpy;
+  delete rrpy;
+
+  LOG("Rndm", pNOTICE)
+     << "Restored the random number generator state (seed: " << fCurrSeed
+     << ", event index: " << fEventIndex << ")";
+  return true;
 }
 //____________________________________________________________________________
 void RandomGen::InitRandomGenerators(long int seed)
 {
-  fRandom3 = new TRandom3();
+  for(int i = 0; i < kNRndStreams; i++) {
+    fRandom3[i] = new TRandom3();
+  }
   this->SetSeed(seed);
 }
 //____________________________________________________________________________
@@ -9,6 +9,25 @@
           to all GENIE modules and that all modules use the preferred rndm
           number generator.
 
+          Each GENIE subsystem draws from its own random number stream.
+          The seed of every stream is derived from a single master seed
+          (and, optionally, from an event index) so that the number of 
+          draws made by one module does not shift the sequence seen by 
+          any other, and so that event N can be regenerated on its own
+          by calling SetEventIndex(N) without replaying events 0...N-1.
+
+          Rejection loops drawing several numbers per trial can use Next(),
+          which returns the numbers of a stream from a small per-stream
+          cache refilled in blocks by TRandom3::RndmArray, or FillUniform()
+          to get a whole block at once. Both give the same sequence as
+          successive Rndm() calls, but the cache draws ahead: numbers read
+          with Rndm() after Next() are taken from further along the stream.
+          Reseeding (SetSeed(), SetEventIndex()) empties the caches, so each
+          event stays a function of the master seed and event index only.
+          The full state of all streams, of ROOT's gRandom and of PYTHIA6's
+          generator can be saved and restored (SaveState(), RestoreState()),
+          eg for resuming an interrupted MC job (see GMCJCheckpoint).
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -25,8 +44,25 @@
 
 #include <TRandom3.h>
 
+class TDirectory;
+
 namespace genie {
 
+typedef enum ERndStream {
+  kRndStrKine = 0,
+  kRndStrHadro,
+  kRndStrDec,
+  kRndStrFsi,
+  kRndStrLep,
+  kRndStrISel,
+  kRndStrGeom,
+  kRndStrFlux,
+  kRndStrEvg,
+  kRndStrNum,
+  kRndStrGen,
+  kNRndStreams
+} RndStream_t;
+
 class RandomGen {
 
 public:
@@ -39,50 +75,79 @@ public:
   //!  on using several TRandom objects each with each own
   //!  "independent" run sequence).
 
-  //! At this point, since the actual random number generator
-  //! periodicity is very high, all the generators are in fact one!
-  //! However, the option to use many generators is reserved.
+  //! Each module owns a separate generator. The seed of each one is
+  //! obtained by hashing the master seed, the stream id and the current
+  //! event index, so the streams are uncorrelated and individually
+  //! reproducible.
 
   //! Currently, the preferred generator is the "Mersenne Twister"
   //! with a periodicity of 10**6000
   //! See: http://root.cern.ch/root/html/TRandom3.html
 
   //! rnd number generator used by kinematics generators
-  TRandom3 & RndKine (void) const { return *fRandom3; } 
+  TRandom3 & RndKine (void) const { return *fRandom3[kRndStrKine]; } 
 
   //! rnd number generator used by hadronization models 
-  TRandom3 & RndHadro (void) const { return *fRandom3; }
+  TRandom3 & RndHadro (void) const { return *fRandom3[kRndStrHadro]; }
 
   //! rnd number generator used by decay models 
-  TRandom3 & RndDec (void) const { return *fRandom3; }
+  TRandom3 & RndDec (void) const { return *fRandom3[kRndStrDec]; }
 
   //! rnd number generator used by intranuclear cascade monte carlos
-  TRandom3 & RndFsi (void) const { return *fRandom3; }
+  TRandom3 & RndFsi (void) const { return *fRandom3[kRndStrFsi]; }
 
   //! rnd number generator used by final state primary lepton generators
-  TRandom3 & RndLep (void) const { return *fRandom3; } 
+  TRandom3 & RndLep (void) const { return *fRandom3[kRndStrLep]; } 
 
   //! rnd number generator used by interaction selectors
-  TRandom3 & RndISel (void) const { return *fRandom3; }
+  TRandom3 & RndISel (void) const { return *fRandom3[kRndStrISel]; }
 
   //! rnd number generator used by geometry drivers
-  TRandom3 & RndGeom (void) const { return *fRandom3; }
+  TRandom3 & RndGeom (void) const { return *fRandom3[kRndStrGeom]; }
 
   //! rnd number generator used by flux drivers
-  TRandom3 & RndFlux (void) const { return *fRandom3; }
+  TRandom3 & RndFlux (void) const { return *fRandom3[kRndStrFlux]; }
 
   //! rnd number generator used by the event generation drivers
-  TRandom3 & RndEvg (void) const { return *fRandom3; }
+  TRandom3 & RndEvg (void) const { return *fRandom3[kRndStrEvg]; }
 
   //! rnd number generator used by MC integrators & other numerical methods
-  TRandom3 & RndNum (void) const { return *fRandom3; }
+  TRandom3 & RndNum (void) const { return *fRandom3[kRndStrNum]; }
 
   //! rnd number generator for generic usage
-  TRandom3 & RndGen  (void) const { return *fRandom3; }
+  TRandom3 & RndGen  (void) const { return *fRandom3[kRndStrGen]; }
+
+  //! access a stream by id
+  TRandom3 & Stream (RndStream_t s) const { return *fRandom3[s]; }
+
+  //! next uniform number in (0,1) of a stream, from the stream cache
+  double Next (RndStream_t s) const {
+    RndCache_t & cache = fCache[s];
+    if(cache.fPos == cache.fN) this->RefillCache(s);
+    return cache.fBuf[cache.fPos++];
+  }
+
+  //! fill the input array with the next n uniform numbers in (0,1) of a
+  //! stream (the numbers left in the stream cache first)
+  void FillUniform (RndStream_t s, double * buf, int n) const;
 
+  //! master seed: reseeds all streams (and resets the event index)
   long int GetSeed (void)         const { return fCurrSeed; }
   void     SetSeed (long int seed);
 
+  //! reseed all streams for generating the event with the input index,
+  //! (a negative index restores the plain master-seed streams)
+  long int EventIndex    (void)          const { return fEventIndex; }
+  void     SetEventIndex (long int ievent);
+
+  //! seed of a given stream for given master seed & event index
+  static unsigned long StreamSeed (long int seed, int stream, long int ievent);
+
+  //! write / restore the state of all generators (streams and their caches,
+  //! gRandom, PYTHIA6) in / from a ROOT directory
+  void SaveState    (TDirectory * dir) const;
+  bool RestoreState (TDirectory * dir);
+
 private:
 
   RandomGen();
@@ -91,11 +156,23 @@ private:
 
   static RandomGen * fInstance;
 
-  TRandom3 * fRandom3;    ///< Mersenne Twistor
-  long int   fCurrSeed;   ///< random number generator seed number
+  static const int kRndCacheSize = 64;
+
+  struct RndCache_t {
+    double fBuf[kRndCacheSize]; ///< numbers drawn ahead from the stream
+    int    fPos;                ///< next number to return
+    int    fN;                  ///< numbers in the cache
+  };
+
+  TRandom3 * fRandom3[kNRndStreams]; ///< Mersenne Twistor, one per stream
+  mutable RndCache_t fCache[kNRndStreams]; ///< Next() cache, one per stream
+  long int   fCurrSeed;   ///< random number generator (master) seed number
+  long int   fEventIndex; ///< event index the streams are currently seeded for
   bool       fInitalized; ///< done initializing singleton?
 
-  void InitRandomGenerators(long int seed);
+  void InitRandomGenerators (long int seed);
+  void SeedStreams          (void);
+  void RefillCache          (RndStream_t s) const;
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -33,6 +33,7 @@
 using std::endl;
 using std::setw;
 using std::setprecision;
+using std::vector;
 using std::setfill;
 using std::ios;
 
@@ -366,34 +367,10 @@ double Spline::Evaluate(double x) const
 
   double y = 0;
   if( this->IsWithinValidRange(x) ) {
-
-    // we can interpolate within the range of spline knots - be careful with
-    // strange cubic spline behaviour when close to knots with y=0
-    bool is0p = this->ClosestKnotValueIsZero(x, "+");
-    bool is0n = this->ClosestKnotValueIsZero(x, "-");
-
-    if(!is0p && !is0n) {
-      // both knots (on the left and right are non-zero) - just interpolate
-      LOG("Spline", pDEBUG) << "Point is between non-zero knots";
-      y = fInterpolator->Eval(x);
-    } else {
-      // at least one of the neighboring knots has y=0
-      if(is0p && is0n) {
-        // both neighboring knots have y=0
-        LOG("Spline", pDEBUG) << "Point is between zero knots";
-        y=0;
-      } else {
-        // just 1 neighboring knot has y=0 - do a linear interpolation
-        LOG("Spline", pDEBUG) 
-          << "Point has zero" << (is0n ? " left " : " right ") << "knot";
-        double xpknot=0, ypknot=0, xnknot=0, ynknot=0;
-        this->FindClosestKnot(x, xnknot, ynknot, "-");
-        this->FindClosestKnot(x, xpknot, ypknot, "+");
-        if(is0n) y = ypknot * (x-xnknot)/(xpknot-xnknot);
-        else     y = ynknot * (x-xnknot)/(xpknot-xnknot);
-      }
+    if(fKnotX.empty()) this->BuildCoeffTable();
+    if(!fKnotX.empty()) {
+      y = this->EvaluateInInterval(x, this->FindInterval(x, -1));
     }
-
   } else {
     LOG("Spline", pDEBUG) << "x = " << x
      << " is not within spline range [" << fXMin << ", " << fXMax << "]";
@@ -410,6 +387,103 @@ double Spline::Evaluate(double x) const
   return y;
 }
 //___________________________________________________________________________
+void Spline::Evaluate(const double * x, double * y, size_t n) const
+{
+// Evaluate the spline at the n points x[] and store the results in y[].
+// Gives identical results to calling Evaluate(double) for each point, but 
+// the knot interval found for each point is used as a hint for the next one,
+// so the search is (almost) free when the input points are sorted.
+// Points outside the spline range evaluate to 0.
+//
+  if(fKnotX.empty()) this->BuildCoeffTable();
+  bool built = !fKnotX.empty();
+
+  int k = -1;
+  for(size_t i = 0; i < n; i++) {
+    double xi = x[i];
+    assert(!TMath::IsNaN(xi));
+    if( built && this->IsWithinValidRange(xi) ) {
+      k = this->FindInterval(xi, k);
+      y[i] = this->EvaluateInInterval(xi, k);
+    } else {
+      y[i] = 0;
+    }
+    if(y[i]<0 && !fYCanBeNegative) {
+      LOG("Spline", pINFO) 
+        << "Negative y (" << y[i] << ") at x = " << xi 
+        << ", spline range [" << fXMin << ", " << fXMax << "]";
+    }
+  }
+}
+//___________________________________________________________________________
+void Spline::BuildCoeffTable(void) const
+{
+// Copy the knots and polynomial coefficients of the TSpline3 interpolator in
+// a flat array. Within the i^th interval the spline is given by
+// y(x) = y_i + dx*(b_i + dx*(c_i + dx*d_i)), with dx = x-x_i.
+//
+  fKnotX.clear();
+  fCoeff.clear();
+  if(!fInterpolator || fNKnots < 2) return;
+
+  fKnotX.resize(fNKnots);
+  fCoeff.resize(4*fNKnots);
+  for(int i = 0; i < fNKnots; i++) {
+    double * c = &fCoeff[4*i];
+    fInterpolator->GetCoeff(i, fKnotX[i], c[0], c[1], c[2], c[3]);
+  }
+}
+//___________________________________________________________________________
+int Spline::FindInterval(double x, int hint) const
+{
+// Find the knot interval k, x_k < x <= x_{k+1} (as TSpline3::FindX), in the
+// range [0, nknots-2]. If a hint is given check it and the following interval
+// before falling back to a binary search.
+//
+  int nlast = fNKnots - 2;
+  if(hint >= 0 && hint <= nlast) {
+    if(x > fKnotX[hint] && x <= fKnotX[hint+1]) return hint;
+    if(hint < nlast && x > fKnotX[hint+1] && x <= fKnotX[hint+2]) return hint+1;
+  }
+  if(x <= fKnotX[0]) return 0;
+
+  int klow = 0;
+  int khig = fNKnots - 1;
+  while(khig - klow > 1) {
+    int khalf = (klow + khig) / 2;
+    if(x > fKnotX[khalf]) klow = khalf;
+    else                  khig = khalf;
+  }
+  return TMath::Min(klow, nlast);
+}
+//___________________________________________________________________________
+double Spline::EvaluateInInterval(double x, int k) const
+{
+  // we can interpolate within the range of spline knots - be careful with
+  // strange cubic spline behaviour when close to knots with y=0
+  const double eps  = 0.001*DBL_EPSILON;
+  const double * cn = &fCoeff[4*k];
+  const double * cp = &fCoeff[4*(k+1)];
+  double yn = cn[0];
+  double yp = cp[0];
+  bool is0n = TMath::Abs(yn) < eps;
+  bool is0p = TMath::Abs(yp) < eps;
+
+  if(!is0p && !is0n) {
+    // both knots (on the left and right are non-zero) - just interpolate
+    double dx = x - fKnotX[k];
+    return yn + dx*(cn[1] + dx*(cn[2] + dx*cn[3]));
+  }
+  // both neighboring knots have y=0
+  if(is0p && is0n) return 0;
+
+  // just 1 neighboring knot has y=0 - do a linear interpolation
+  double xn = fKnotX[k];
+  double xp = fKnotX[k+1];
+  if(is0n) return yp * (x-xn)/(xp-xn);
+  else     return yn * (x-xn)/(xp-xn);
+}
+//___________________________________________________________________________
 void Spline::SaveAsXml(
                 string filename, string xtag, string ytag, string name) const
 {
@@ -589,18 +663,21 @@ void Spline::Add(const Spline & spl, double c)
     return;
   }
 
+  // splines with the same knots are added knot by knot
+  if(this->HasSameKnots(spl)) {
+    this->CombineKnots(1., 0., &spl, c);
+    return;
+  }
+
   int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
+  vector<double> x, y;
+  this->GetKnots(x,y);
 
   for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
     y[i] += (c * spl.Evaluate(x[i]));
   }
   this->ResetSpline();
-  this->BuildSpline(nknots,x,y);
-  delete [] x;
-  delete [] y;
+  this->BuildSpline(nknots,&x[0],&y[0]);
 }
 //___________________________________________________________________________
 void Spline::Multiply(const Spline & spl, double c)
@@ -615,17 +692,19 @@ void Spline::Multiply(const Spline & spl, double c)
   }
 
   int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
+  vector<double> x, y;
+  this->GetKnots(x,y);
+
+  // the product isn't linear in the knot values: the spline is rebuilt, but
+  // the knot values of splines with the same knots are used directly
+  bool same_knots = this->HasSameKnots(spl);
 
   for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    y[i] *= (c * spl.Evaluate(x[i]));
+    double yspl = same_knots ? spl.fCoeff[4*i] : spl.Evaluate(x[i]);
+    y[i] *= (c * yspl);
   }
   this->ResetSpline();
-  this->BuildSpline(nknots,x,y);
-  delete [] x;
-  delete [] y;
+  this->BuildSpline(nknots,&x[0],&y[0]);
 }
 //___________________________________________________________________________
 void Spline::Divide(const Spline & spl, double c)
@@ -640,78 +719,124 @@ void Spline::Divide(const Spline & spl, double c)
   }
 
   int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
+  vector<double> x, y;
+  this->GetKnots(x,y);
+
+  bool same_knots = this->HasSameKnots(spl);
 
   for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    double denom = c * spl.Evaluate(x[i]);
+    double yspl  = same_knots ? spl.fCoeff[4*i] : spl.Evaluate(x[i]);
+    double denom = c * yspl;
     bool denom_is_zero = TMath::Abs(denom) < DBL_EPSILON;
     if(denom_is_zero) {
         LOG("Spline", pERROR) << "** Refusing to divide spline knot by 0";
-        delete [] x;
-        delete [] y;
         return;
     }
     y[i] /= denom;
   }
   this->ResetSpline();
-  this->BuildSpline(nknots,x,y);
-  delete [] x;
-  delete [] y;
+  this->BuildSpline(nknots,&x[0],&y[0]);
 }
 //___________________________________________________________________________
 void Spline::Add(double a)
 {
-  int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
-
-  for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    y[i]+=a;
-  }
-  this->ResetSpline();
-  this->BuildSpline(nknots,x,y);
-  delete [] x;
-  delete [] y;
+  this->CombineKnots(1., a, 0, 0.);
 }
 //___________________________________________________________________________
 void Spline::Multiply(double a)
 {
-  int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
-
-  for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    y[i]*=a;
-  }
-  this->ResetSpline();
-  this->BuildSpline(nknots,x,y);
-  delete [] x;
-  delete [] y;
+  this->CombineKnots(a, 0., 0, 0.);
 }
 //___________________________________________________________________________
 void Spline::Divide(double a)
 {
   bool a_is_zero = TMath::Abs(a) < DBL_EPSILON;
-  if(a_is_zero==0) {
+  if(a_is_zero) {
     LOG("Spline", pERROR) << "** Refusing to divide spline by 0";
     return;
   }
-  int nknots = this->NKnots();
-  double * x = new double[nknots];
-  double * y = new double[nknots];
+  this->CombineKnots(1./a, 0., 0, 0.);
+}
+//___________________________________________________________________________
+void Spline::GetKnots(vector<double> & x, vector<double> & y) const
+{
+  if(fKnotX.empty()) this->BuildCoeffTable();
 
-  for(int i=0; i<nknots; i++) {  
-    this->GetKnot(i,x[i],y[i]); 
-    y[i]/=a;
+  x.resize(fNKnots);
+  y.resize(fNKnots);
+  if((int) fKnotX.size() == fNKnots) {
+    for(int i = 0; i < fNKnots; i++) {
+      x[i] = fKnotX[i];
+      y[i] = fCoeff[4*i];
+    }
+  } else {
+    for(int i = 0; i < fNKnots; i++) this->GetKnot(i,x[i],y[i]);
+  }
+}
+//___________________________________________________________________________
+bool Spline::HasSameKnots(const Spline & spl) const
+{
+// Are the knots of the input spline at exactly the same x as the knots of
+// this one (eg splines computed on the same energy grid)?
+
+  if(spl.fNKnots != fNKnots) return false;
+
+  if(fKnotX.empty())     this->BuildCoeffTable();
+  if(spl.fKnotX.empty()) spl.BuildCoeffTable();
+  if(fKnotX.empty() || spl.fKnotX.empty()) return false;
+
+  for(int i = 0; i < fNKnots; i++) {
+    if(fKnotX[i] != spl.fKnotX[i]) return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+void Spline::CombineKnots(
+     double a, double shift, const Spline * spl, double c)
+{
+// Set the knot values to y -> a*y + shift + c*y_spl, where the input spline
+// (if any) has the same knots as this one. The cubic spline interpolating
+// the knots depends linearly on the knot values (and its derivatives don't
+// depend on a constant shift), so its coefficients are combined the same
+// way and the TSpline3 is updated in place rather than rebuilt.
+
+  if(fKnotX.empty()) this->BuildCoeffTable();
+  if(fKnotX.empty()) {
+    // nothing to combine: rebuild from the TSpline3 knots
+    vector<double> x, y;
+    this->GetKnots(x,y);
+    for(int i = 0; i < fNKnots; i++) {
+      y[i] = a*y[i] + shift + (spl ? c*spl->Evaluate(x[i]) : 0.);
+    }
+    if(fNKnots > 0) {
+      this->ResetSpline();
+      this->BuildSpline(fNKnots,&x[0],&y[0]);
+    }
+    return;
+  }
+
+  // copied, as the input spline can be this one
+  vector<double> cspl;
+  if(spl) cspl = spl->fCoeff;
+
+  for(int i = 0; i < fNKnots; i++) {
+    double * cf = &fCoeff[4*i];
+    cf[0] = a*cf[0] + shift;
+    cf[1] = a*cf[1];
+    cf[2] = a*cf[2];
+    cf[3] = a*cf[3];
+    if(spl) {
+      const double * cs = &cspl[4*i];
+      cf[0] += c*cs[0];
+      cf[1] += c*cs[1];
+      cf[2] += c*cs[2];
+      cf[3] += c*cs[3];
+    }
+    fInterpolator->SetPoint     (i, fKnotX[i], cf[0]);
+    fInterpolator->SetPointCoeff(i, cf[1], cf[2], cf[3]);
+
+    if(i == 0 || cf[0] > fYMax) fYMax = cf[0];
   }
-  this->ResetSpline();
-  this->BuildSpline(nknots,x,y);
-  delete [] x;
-  delete [] y;
 }
 //___________________________________________________________________________
 void Spline::InitSpline(void)
@@ -727,6 +852,9 @@ void Spline::InitSpline(void)
 
   fYCanBeNegative = false;
 
+  fKnotX.clear();
+  fCoeff.clear();
+
   LOG("Spline", pDEBUG) << "...done initializing spline";
 }
 //___________________________________________________________________________
@@ -752,6 +880,8 @@ void Spline::BuildSpline(int nentries, double x[], double y[])
 
   fInterpolator = new TSpline3("spl3", x, y, nentries, "0");
 
+  this->BuildCoeffTable();
+
   LOG("Spline", pDEBUG) << "...done building spline";
 }
 //___________________________________________________________________________
@@ -8,6 +8,9 @@
           Uses ROOT's TSpline3 for the actual interpolation and can retrieve
           function (x,y(x)) pairs from an XML file, a flat ascii file, a
           TNtuple, a TTree or an SQL database.
+          The TSpline3 polynomial coefficients are also kept in a flat array
+          which is used for evaluating the spline, either point by point or
+          for a batch of points in a single call.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -24,6 +27,7 @@
 #define _SPLINE_H_
 
 #include <string>
+#include <vector>
 #include <fstream>
 #include <ostream>
 
@@ -78,6 +82,7 @@ public:
   double XMax               (void) const {return fXMax;  }
   double YMax               (void) const {return fYMax;  }
   double Evaluate           (double x) const;
+  void   Evaluate           (const double * x, double * y, size_t n) const;
   bool   IsWithinValidRange (double x) const;
 
   void   SetName (string name) { fName = name; }
@@ -121,6 +126,16 @@ private:
   void ResetSpline (void);
   void BuildSpline (int nentries, double x[], double y[]);
 
+  // Knot arithmetic
+  void GetKnots     (std::vector<double> & x, std::vector<double> & y) const;
+  bool HasSameKnots (const Spline & spl) const;
+  void CombineKnots (double a, double shift, const Spline * spl, double c);
+
+  // Flat knot-coefficient table used for evaluating the spline
+  void   BuildCoeffTable    (void) const;
+  int    FindInterval       (double x, int hint) const;
+  double EvaluateInInterval (double x, int k) const;
+
   // Private data members
   string     fName;
   int        fNKnots;
@@ -130,6 +145,9 @@ private:
   TSpline3 * fInterpolator;
   bool       fYCanBeNegative;
 
+  mutable std::vector<double> fKnotX; //! knot x values
+  mutable std::vector<double> fCoeff; //! cubic coefficients (y,b,c,d) of the polynomial starting at each knot
+
 ClassDef(Spline,1)
 };
 
@@ -0,0 +1,405 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include <TMath.h>
+#include <TRandom3.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BatchFunctionMultiDimI.h"
+#include "Framework/Numerical/VegasIntegrator.h"
+
+using namespace genie;
+
+static const unsigned int kNBins       = 50;     // grid bins per dimension
+static const double       kGridAlpha   = 1.5;    // grid refinement damping
+static const unsigned int kMinCalls    = 1000;   // min evaluations per iteration
+static const unsigned int kDefMaxEval  = 100000; // if no max # of evaluations is set
+static const unsigned int kDefSeed     = 4357;   // default random number seed
+
+// A slice of a batch, evaluated by one thread
+struct VegasSlice_t {
+  const BatchFunctionMultiDimI * func;
+  const double *                 x;
+  double *                       f;
+  unsigned int                   n;
+};
+static void * EvaluateVegasSlice(void * arg)
+{
+  VegasSlice_t * slice = (VegasSlice_t *) arg;
+  slice->func->EvalBatch(slice->n, slice->x, slice->f);
+  return 0;
+}
+
+//____________________________________________________________________________
+VegasIntegrator::VegasIntegrator(
+  const ROOT::Math::IBaseFunctionMultiDim & func,
+  double abstol, double reltol, unsigned int maxeval) :
+fFunc          (&func),
+fBatchFunc     (dynamic_cast<const BatchFunctionMultiDimI *>(&func)),
+fNDim          (func.NDim()),
+fAbsTol        (abstol),
+fRelTol        (reltol),
+fMaxEval       (maxeval > 0 ? maxeval : kDefMaxEval),
+fNCallsPerIter (0),
+fSeed          (kDefSeed),
+fNWorkers      (1),
+fNThreads      (1),
+fError         (0.),
+fChisq         (0.),
+fNEval         (0)
+{
+
+}
+//____________________________________________________________________________
+VegasIntegrator::~VegasIntegrator()
+{
+  this->DeleteThreadClones();
+}
+//____________________________________________________________________________
+void VegasIntegrator::SetNWorkers(int n)
+{
+  fNWorkers = TMath::Max(1, n);
+}
+//____________________________________________________________________________
+void VegasIntegrator::SetNThreads(int n)
+{
+  fNThreads = TMath::Max(1, n);
+}
+//____________________________________________________________________________
+void VegasIntegrator::SetNCallsPerIter(unsigned int n)
+{
+  fNCallsPerIter = n;
+}
+//____________________________________________________________________________
+void VegasIntegrator::SetSeed(unsigned int seed)
+{
+  fSeed = seed;
+}
+//____________________________________________________________________________
+double VegasIntegrator::Integral(const double * xmin, const double * xmax)
+{
+  const unsigned int ndim  = fNDim;
+  const unsigned int ncall = (fNCallsPerIter > 0) ? fNCallsPerIter :
+                             TMath::Max(kMinCalls, fMaxEval/10);
+
+  fError = 0.;
+  fChisq = 0.;
+  fNEval = 0;
+
+  // start from a uniform grid
+  fGrid.resize(ndim*(kNBins+1));
+  fGridWeight.assign(ndim*kNBins, 0.);
+  for(unsigned int j = 0; j < ndim; j++) {
+    for(unsigned int k = 0; k <= kNBins; k++) {
+      fGrid[j*(kNBins+1)+k] = (double)k / kNBins;
+    }
+  }
+
+  double vol = 1.;
+  for(unsigned int j = 0; j < ndim; j++) vol *= (xmax[j] - xmin[j]);
+
+  TRandom3 rnd(fSeed);
+
+  vector<double>       x   (ncall*ndim);
+  vector<double>       wgt (ncall);
+  vector<unsigned int> bins(ncall*ndim);
+  vector<double>       f   (ncall);
+
+  this->MakeThreadClones();
+
+  double sw = 0., swi = 0., swi2 = 0.; // inverse variance weighted sums
+  unsigned int nacc = 0;                // # of combined iterations
+  double result = 0.;
+
+  for(unsigned int iter = 0; iter < 2 || fNEval + ncall <= fMaxEval; iter++) {
+
+    // generate all points of this iteration
+    for(unsigned int i = 0; i < ncall; i++) {
+      double w = vol;
+      for(unsigned int j = 0; j < ndim; j++) {
+        const double * g = &fGrid[j*(kNBins+1)];
+        double pos = rnd.Rndm() * kNBins;
+        unsigned int k = TMath::Min((unsigned int) pos, kNBins-1);
+        double dg = g[k+1] - g[k];
+        double y  = g[k] + (pos - k) * dg;
+        w *= kNBins * dg;
+        x   [i*ndim+j] = xmin[j] + y * (xmax[j] - xmin[j]);
+        bins[i*ndim+j] = k;
+      }
+      wgt[i] = w;
+    }
+
+    this->Evaluate(x, f);
+    fNEval += ncall;
+
+    double s1 = 0., s2 = 0.;
+    for(unsigned int i = 0; i < ncall; i++) {
+      double wf = wgt[i] * f[i];
+      s1 += wf;
+      s2 += wf*wf;
+      for(unsigned int j = 0; j < ndim; j++) {
+        fGridWeight[j*kNBins + bins[i*ndim+j]] += wf*wf;
+      }
+    }
+    double I   = s1 / ncall;
+    double var = (s2 / ncall - I*I) / (ncall - 1);
+
+    this->RefineGrid();
+
+    // the first iteration is only used for adapting the grid
+    if(iter == 0) continue;
+
+    if(var <= 0.) {
+      // constant integrand
+      result = I;
+      fError = 0.;
+      break;
+    }
+
+    sw   += 1./var;
+    swi  += I/var;
+    swi2 += I*I/var;
+    nacc++;
+
+    result = swi / sw;
+    fError = TMath::Sqrt(1./sw);
+    fChisq = (nacc > 1) ? (swi2 - result*swi) / (nacc - 1) : 0.;
+
+    LOG("VEGAS", pDEBUG)
+      << "Iteration " << iter << ": I = " << I << " +/- " << TMath::Sqrt(var)
+      << ", combined I = " << result << " +/- " << fError;
+
+    bool converged = (fError <= fRelTol * TMath::Abs(result)) ||
+                     (TMath::Abs(result) <= fAbsTol && fError <= fAbsTol);
+    if(nacc > 1 && converged) break;
+  }
+
+  int nthreads = fThreadFuncs.size() + 1;
+  this->DeleteThreadClones();
+
+  LOG("VEGAS", pINFO)
+    << "I = " << result << " +/- " << fError << " (chi2/dof = " << fChisq
+    << ", " << fNEval << " evaluations, " << fNWorkers << " processes, "
+    << nthreads << " threads)";
+
+  return result;
+}
+//____________________________________________________________________________
+void VegasIntegrator::Evaluate(
+  const vector<double> & x, vector<double> & f) const
+{
+  unsigned int n = f.size();
+
+  if(fThreadFuncs.size() > 0 && n >= 2*(fThreadFuncs.size()+1)) {
+    this->EvaluateInThreads(x, f);
+    return;
+  }
+  if(fNWorkers > 1 && n >= (unsigned int) (2*fNWorkers)) {
+    if(this->EvaluateInWorkers(x, f)) return;
+  }
+  this->EvaluateSlice(x, &f[0], 0, n);
+}
+//____________________________________________________________________________
+void VegasIntegrator::EvaluateSlice(
+  const vector<double> & x, double * f, unsigned int begin, unsigned int end) const
+{
+  if(end <= begin) return;
+  if(fBatchFunc) {
+    fBatchFunc->EvalBatch(end - begin, &x[begin*fNDim], &f[begin]);
+    return;
+  }
+  for(unsigned int i = begin; i < end; i++) {
+    f[i] = (*fFunc)(&x[i*fNDim]);
+  }
+}
+//____________________________________________________________________________
+bool VegasIntegrator::EvaluateInWorkers(
+  const vector<double> & x, vector<double> & f) const
+{
+// Split the batch among fNWorkers processes: slice 0 is evaluated here and
+// the others in forked workers, passing the function values (and a status
+// flag per slice) back in shared memory. Slices of failed workers are
+// evaluated here. Returns false if no shared memory could be allocated.
+
+  const int          nworkers = fNWorkers;
+  const unsigned int n        = f.size();
+
+  size_t nbytes = (n + nworkers) * sizeof(double);
+  double * shared = (double *) mmap(0, nbytes, PROT_READ | PROT_WRITE,
+                                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if((void *) shared == MAP_FAILED) {
+    LOG("VEGAS", pWARN) << "Couldn't allocate shared memory for integration workers";
+    return false;
+  }
+  double * done = shared + n;
+  for(int iw = 0; iw < nworkers; iw++) done[iw] = 0.;
+
+  vector<pid_t> wpids(nworkers, -1);
+  for(int iw = 1; iw < nworkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("VEGAS", pWARN) << "Couldn't fork integration worker " << iw;
+      break;
+    }
+    if(pid == 0) {
+      this->EvaluateSlice(x, shared, (iw*n)/nworkers, ((iw+1)*n)/nworkers);
+      done[iw] = 1.;
+      _exit(0);
+    }
+    wpids[iw] = pid;
+  }
+
+  this->EvaluateSlice(x, shared, 0, n/nworkers);
+  done[0] = 1.;
+
+  for(int iw = 1; iw < nworkers; iw++) {
+    if(wpids[iw] > 0) {
+      int status = 0;
+      waitpid(wpids[iw], &status, 0);
+      if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) done[iw] = 0.;
+    }
+    if(done[iw] != 1.) {
+      LOG("VEGAS", pWARN)
+        << "Integration worker " << iw << " failed: evaluating its points here";
+      this->EvaluateSlice(x, shared, (iw*n)/nworkers, ((iw+1)*n)/nworkers);
+    }
+  }
+
+  for(unsigned int i = 0; i < n; i++) f[i] = shared[i];
+
+  munmap((void *) shared, nbytes);
+  return true;
+}
+//____________________________________________________________________________
+void VegasIntegrator::EvaluateInThreads(
+  const vector<double> & x, vector<double> & f) const
+{
+// Split the batch among the calling thread, evaluating the integrand itself,
+// and one thread per integrand clone. Slices of threads that couldn't be
+// started are evaluated here.
+
+  const unsigned int nthreads = fThreadFuncs.size() + 1;
+  const unsigned int n        = f.size();
+
+  vector<VegasSlice_t> slices(nthreads);
+  for(unsigned int it = 0; it < nthreads; it++) {
+    unsigned int begin = (it*n)/nthreads;
+    unsigned int end   = ((it+1)*n)/nthreads;
+    slices[it].func = (it == 0) ? fBatchFunc : fThreadFuncs[it-1];
+    slices[it].x    = &x[begin*fNDim];
+    slices[it].f    = &f[begin];
+    slices[it].n    = end - begin;
+  }
+
+  vector<pthread_t> threads(nthreads);
+  vector<bool>      started(nthreads, false);
+  for(unsigned int it = 1; it < nthreads; it++) {
+    started[it] =
+      (pthread_create(&threads[it], 0, EvaluateVegasSlice, &slices[it]) == 0);
+  }
+  EvaluateVegasSlice(&slices[0]);
+  for(unsigned int it = 1; it < nthreads; it++) {
+    if(started[it]) {
+      pthread_join(threads[it], 0);
+    } else {
+      EvaluateVegasSlice(&slices[it]);
+    }
+  }
+}
+//____________________________________________________________________________
+void VegasIntegrator::MakeThreadClones(void)
+{
+// One integrand copy for each thread other than the calling one, if the
+// integrand can provide them
+
+  this->DeleteThreadClones();
+  if(fNThreads < 2) return;
+
+  if(fBatchFunc) {
+    for(int it = 1; it < fNThreads; it++) {
+      BatchFunctionMultiDimI * clone = fBatchFunc->ThreadClone();
+      if(!clone) break;
+      fThreadFuncs.push_back(clone);
+    }
+  }
+  if((int) fThreadFuncs.size() != fNThreads-1) {
+    LOG("VEGAS", pWARN)
+      << "The integrand can't be evaluated concurrently: not using threads";
+    this->DeleteThreadClones();
+  }
+}
+//____________________________________________________________________________
+void VegasIntegrator::DeleteThreadClones(void)
+{
+  for(unsigned int it = 0; it < fThreadFuncs.size(); it++) {
+    delete fThreadFuncs[it];
+  }
+  fThreadFuncs.clear();
+}
+//____________________________________________________________________________
+void VegasIntegrator::RefineGrid(void)
+{
+// Move the bin edges of each dimension so that every bin holds the same
+// (damped) share of the integrand variance seen in the last iteration
+
+  vector<double> d(kNBins), r(kNBins), g(kNBins+1);
+
+  for(unsigned int j = 0; j < fNDim; j++) {
+    double * edges = &fGrid      [j*(kNBins+1)];
+    double * gw    = &fGridWeight[j*kNBins];
+
+    // smooth the bin weights over neighbouring bins
+    double dsum = 0.;
+    for(unsigned int k = 0; k < kNBins; k++) {
+      double sum = gw[k];
+      int    nb  = 1;
+      if(k > 0)        { sum += gw[k-1]; nb++; }
+      if(k < kNBins-1) { sum += gw[k+1]; nb++; }
+      d[k]  = sum / nb;
+      dsum += d[k];
+    }
+    for(unsigned int k = 0; k < kNBins; k++) gw[k] = 0.;
+    if(dsum <= 0.) continue;
+
+    double rsum = 0.;
+    for(unsigned int k = 0; k < kNBins; k++) {
+      double z = d[k] / dsum;
+      if      (z <= 0.)      r[k] = 0.;
+      else if (z >= 1.)      r[k] = 1.;
+      else r[k] = TMath::Power((z - 1.) / TMath::Log(z), kGridAlpha);
+      rsum += r[k];
+    }
+    if(rsum <= 0.) continue;
+
+    // new edges, each new bin containing rsum/kNBins
+    double delta = rsum / kNBins;
+    double acc   = 0.;
+    unsigned int k = 0;
+    g[0] = 0.;
+    for(unsigned int i = 1; i < kNBins; i++) {
+      while(acc < delta && k < kNBins) { acc += r[k]; k++; }
+      acc -= delta;
+      g[i] = (r[k-1] > 0.) ?
+          edges[k] - (edges[k] - edges[k-1]) * acc / r[k-1] : edges[k];
+    }
+    g[kNBins] = 1.;
+
+    for(unsigned int i = 0; i <= kNBins; i++) edges[i] = g[i];
+  }
+}
+//____________________________________________________________________________
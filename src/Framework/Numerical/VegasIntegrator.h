@@ -0,0 +1,107 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::VegasIntegrator
+
+\brief    Adaptive (VEGAS) Monte Carlo integrator of multi-dimensional
+          functions, whose integrand evaluations are done in batches and can
+          be split among forked worker processes.
+
+          The integration volume is mapped onto a separable grid (fixed
+          number of bins per dimension) that is refined after every
+          iteration to follow the integrand (G.P.Lepage, J.Comput.Phys.27
+          (1978) 192). All points of an iteration are generated first and
+          then evaluated as a single batch: with SetNWorkers(n), n > 1, the
+          batch is split among n processes (the calling one and n-1 forked
+          workers), passing the function values back in shared memory. The
+          points are generated in the calling process only, using a fixed
+          seed, so the result does not depend on the number of workers.
+          A batch slice whose worker failed is evaluated in the calling
+          process. Integrands that draw random numbers or that fill caches
+          used later on should not be evaluated in workers.
+          Integrands implementing BatchFunctionMultiDimI are evaluated with
+          EvalBatch() and, with SetNThreads(n), n > 1, the batch is instead
+          split among n threads, each evaluating its own ThreadClone() of the
+          integrand (the forked workers are used if it can't be cloned).
+
+          The first iteration is only used for adapting the grid. The later
+          iterations are combined with inverse variance weights, until the
+          estimated error is below the relative tolerance (or the absolute
+          tolerance, if the integral itself is no larger than that) or the
+          max number of function evaluations is reached.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _VEGAS_INTEGRATOR_H_
+#define _VEGAS_INTEGRATOR_H_
+
+#include <vector>
+
+#include <Math/IFunction.h>
+
+using std::vector;
+
+namespace genie {
+
+class BatchFunctionMultiDimI;
+
+class VegasIntegrator
+{
+public:
+  VegasIntegrator(const ROOT::Math::IBaseFunctionMultiDim & func,
+                  double abstol, double reltol, unsigned int maxeval);
+ ~VegasIntegrator();
+
+  void   SetNWorkers       (int n);             ///< # of processes evaluating each batch
+  void   SetNThreads       (int n);             ///< # of threads evaluating each batch
+  void   SetNCallsPerIter  (unsigned int n);    ///< integrand evaluations per iteration
+  void   SetSeed           (unsigned int seed);
+
+  double Integral          (const double * xmin, const double * xmax);
+
+  double       Error       (void) const { return fError;  } ///< of the last Integral()
+  double       ChisqPerDoF (void) const { return fChisq;  } ///< consistency of the iterations
+  unsigned int NEval       (void) const { return fNEval;  } ///< # of integrand evaluations
+  int          NWorkers    (void) const { return fNWorkers; }
+  int          NThreads    (void) const { return fNThreads; }
+
+private:
+
+  void   Evaluate          (const vector<double> & x, vector<double> & f) const;
+  void   EvaluateSlice     (const vector<double> & x, double * f,
+                            unsigned int begin, unsigned int end) const;
+  bool   EvaluateInWorkers (const vector<double> & x, vector<double> & f) const;
+  void   EvaluateInThreads (const vector<double> & x, vector<double> & f) const;
+  void   MakeThreadClones  (void);
+  void   DeleteThreadClones(void);
+  void   RefineGrid        (void);
+
+  const ROOT::Math::IBaseFunctionMultiDim * fFunc; ///< integrand
+  const BatchFunctionMultiDimI * fBatchFunc;       ///< integrand, if batch-capable
+  vector<BatchFunctionMultiDimI *> fThreadFuncs;   ///< integrand copies of threads 1...n-1
+  unsigned int   fNDim;         ///< # of dimensions
+  double         fAbsTol;       ///< absolute tolerance
+  double         fRelTol;       ///< relative tolerance
+  unsigned int   fMaxEval;      ///< max # of integrand evaluations
+  unsigned int   fNCallsPerIter;///< integrand evaluations per iteration (0: from fMaxEval)
+  unsigned int   fSeed;         ///< random number seed
+  int            fNWorkers;     ///< # of processes evaluating each batch
+  int            fNThreads;     ///< # of threads evaluating each batch
+  vector<double> fGrid;         ///< bin edges in [0,1], [idim*(nbins+1)+ibin]
+  vector<double> fGridWeight;   ///< (w*f)^2 summed in each bin, [idim*nbins+ibin]
+  double         fError;        ///< error of the last Integral()
+  double         fChisq;        ///< chi2/dof of the combined iterations
+  unsigned int   fNEval;        ///< # of integrand evaluations in the last Integral()
+};
+
+}      // genie namespace
+#endif // _VEGAS_INTEGRATOR_H_
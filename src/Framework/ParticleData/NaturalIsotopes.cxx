@@ -17,6 +17,9 @@
    This class was first added in version 2.3.1
  @ May 01, 2012 - CA, JD
    Pick data from new location ($GENIE/data/evgen/catalogues/iso/)
+ @ Oct 14, 2026 - CA
+   Added Abundance(), served from an index built when loading the table.
+   NElements() and ElementData() no longer copy the element vectors.
 */
 //____________________________________________________________________________
 
@@ -66,6 +69,7 @@ NaturalIsotopes::~NaturalIsotopes()
      vec.clear();
   }
   fNaturalIsotopesTable.clear();
+  fAbundances.clear();
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -91,7 +95,7 @@ int NaturalIsotopes::NElements(int Z) const
        << "Table has no elements for natural isotope  Z = " << Z;
     return 0;
   } 
-  vector<NaturalIsotopeElementData*> vec = miter->second;
+  const vector<NaturalIsotopeElementData*> & vec = miter->second;
   return vec.size();
 }
 //____________________________________________________________________________
@@ -105,7 +109,7 @@ const NaturalIsotopeElementData *
        << "Table has no elements for natural isotope  Z = " << Z;
     return 0;
   }
-  vector<NaturalIsotopeElementData*> vec = miter->second;
+  const vector<NaturalIsotopeElementData*> & vec = miter->second;
   if(ielement >= (int)vec.size() || ielement < 0) {
     LOG("NatIsotop", pWARN)  
       << "Natural isotope Z = " << Z << " has " << vec.size() << " elements"
@@ -115,6 +119,13 @@ const NaturalIsotopeElementData *
   return vec[ielement];
 }
 //____________________________________________________________________________
+double NaturalIsotopes::Abundance(int pdgc) const
+{
+  map<int, double>::const_iterator it = fAbundances.find(pdgc);
+  if(it == fAbundances.end()) return 0.;
+  return it->second;
+}
+//____________________________________________________________________________
 bool NaturalIsotopes::LoadTable(void)
 {
   // get the natural isotopes table filename
@@ -168,6 +179,7 @@ bool NaturalIsotopes::LoadTable(void)
             << ", A = " << atomicmass << ", abundance = " << abundance;
           data = new NaturalIsotopeElementData(pdgcode, abundance);
   	  vec.push_back(data);
+          fAbundances[pdgcode] = abundance/100.;
 	}
 	fNaturalIsotopesTable.insert(
            map<int,vector<NaturalIsotopeElementData*> >::value_type(Z,vec));
@@ -5,6 +5,11 @@
 
 \brief    Singleton class to load & serve tables of natural occurring isotopes
 
+          The table is read once, at the first use of the singleton. The
+          natural abundance of each isotope is also indexed by its PDG code,
+          for the (frequent) look-ups of Abundance() at the set-up of the
+          targets of a job.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -36,6 +41,10 @@ public:
   int NElements(int Z) const;
   const NaturalIsotopeElementData * ElementData (int Z, int ielement) const;
 
+  //! natural abundance (fraction, not %) of the input isotope; 0 if it is
+  //! not a natural isotope
+  double Abundance (int pdgc) const;
+
 private:
   NaturalIsotopes();
   NaturalIsotopes(const NaturalIsotopes &);
@@ -46,6 +55,7 @@ private:
   static NaturalIsotopes * fInstance;
 
   map<int, vector<NaturalIsotopeElementData*> > fNaturalIsotopesTable;
+  map<int, double> fAbundances;  ///< isotope PDG code -> natural abundance fraction
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
@@ -12,14 +12,17 @@
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
 #include <iostream>
 #include <string>
 
 #include <TSystem.h>
+#include <TList.h>
 
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/PhaseTimer.h"
 
 using std::string;
 
@@ -28,7 +31,8 @@ using namespace genie;
 //____________________________________________________________________________
 PDGLibrary * PDGLibrary::fInstance = 0;
 //____________________________________________________________________________
-PDGLibrary::PDGLibrary()
+PDGLibrary::PDGLibrary() :
+fGeneration(0)
 {
   if( ! LoadDBase() ) LOG("PDG", pERROR) << "Could not load PDG data";
 
@@ -64,9 +68,93 @@ TParticlePDG * PDGLibrary::Find(int pdgc)
 
   return fDatabasePDG->GetParticle(pdgc);
 }
+//____________________________________________________________________________
+int PDGLibrary::Id(int pdgc)
+{
+  map<int, int>::const_iterator it = fIds.find(pdgc);
+  if(it != fIds.end()) return it->second;
+
+  // not in the table yet: eg added to the TDatabasePDG after loading
+  TParticlePDG * p = fDatabasePDG->GetParticle(pdgc);
+  if(!p) return -1;
+
+  return this->AddToTable(p);
+}
+//____________________________________________________________________________
+double PDGLibrary::Mass(int pdgc)
+{
+  return fProperties[this->IdOrExit(pdgc)].mass;
+}
+//____________________________________________________________________________
+double PDGLibrary::Width(int pdgc)
+{
+  return fProperties[this->IdOrExit(pdgc)].width;
+}
+//____________________________________________________________________________
+double PDGLibrary::Charge(int pdgc)
+{
+  return fProperties[this->IdOrExit(pdgc)].charge;
+}
+//____________________________________________________________________________
+int PDGLibrary::IdOrExit(int pdgc)
+{
+  int id = this->Id(pdgc);
+  if(id < 0) {
+    LOG("PDG", pFATAL)
+      << "No particle with PDG code = " << pdgc << " in the PDG data";
+    exit(1);
+  }
+  return id;
+}
+//____________________________________________________________________________
+void PDGLibrary::BuildTable(void)
+{
+  fProperties.clear();
+  fIds.clear();
+  fGeneration++;
+
+  const TList * plist = fDatabasePDG->ParticleList();
+  if(plist) {
+    fProperties.reserve(plist->GetSize());
+    TIter iter(plist);
+    TParticlePDG * p = 0;
+    while( (p = (TParticlePDG *) iter.Next()) ) {
+      if(fIds.find(p->PdgCode()) == fIds.end()) this->AddToTable(p);
+    }
+  }
+
+  LOG("PDG", pINFO)
+    << "Particle property table built with " << fProperties.size() << " entries";
+}
+//____________________________________________________________________________
+int PDGLibrary::AddToTable(TParticlePDG * p)
+{
+  Properties_t prop;
+  prop.pdg      = p->PdgCode();
+  prop.mass     = p->Mass();
+  prop.width    = p->Width();
+  prop.charge   = p->Charge();
+  prop.stable   = p->Stable();
+  prop.particle = p;
+
+  int id = fProperties.size();
+  fProperties.push_back(prop);
+  fIds[prop.pdg] = id;
+
+  return id;
+}
 
 //____________________________________________________________________________
 bool PDGLibrary::LoadDBase(void)
+{
+  PhaseTimerGuard timer("PDGLibrary::LoadDBase");
+
+  bool loaded = this->ReadDBase();
+  this->BuildTable();
+  return loaded;
+}
+//____________________________________________________________________________
+bool PDGLibrary::ReadDBase(void)
 {
   fDatabasePDG = TDatabasePDG::Instance();
 
@@ -5,6 +5,13 @@
 
 \brief    Singleton class to load & serve a TDatabasePDG.
 
+          Also serves a compact, read-only copy of the most frequently used
+          particle properties (mass, width, charge, stability), indexed by a
+          dense particle id. The table is filled from the PDG data when they
+          are loaded; particles added to the TDatabasePDG later on are
+          appended at their first lookup. Ids remain valid until the PDG data
+          are reloaded, which increments the table Generation().
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -22,9 +29,15 @@
 #ifndef _PDG_LIBRARY_H_
 #define _PDG_LIBRARY_H_
 
+#include <map>
+#include <vector>
+
 #include <TDatabasePDG.h>
 #include <TParticlePDG.h>
 
+using std::map;
+using std::vector;
+
 namespace genie {
 
 class PDGLibrary 
@@ -37,6 +50,24 @@ public:
   TParticlePDG * Find  (int pdgc);
   void           ReloadDBase (void);
 
+  //! Frequently used particle properties
+  struct Properties_t {
+    int            pdg;      ///< PDG code
+    double         mass;     ///< mass (GeV)
+    double         width;    ///< width (GeV)
+    double         charge;   ///< charge (units of |e|/3, as in TParticlePDG)
+    bool           stable;   ///< stable?
+    TParticlePDG * particle; ///< the TDatabasePDG entry
+  };
+
+  int                  Id         (int pdgc);  ///< dense particle id, -1 if unknown
+  const Properties_t & Properties (int id) const { return fProperties[id]; }
+  unsigned int         Generation (void) const { return fGeneration; }
+
+  double Mass   (int pdgc); ///< exits if the particle is unknown
+  double Width  (int pdgc); ///< exits if the particle is unknown
+  double Charge (int pdgc); ///< exits if the particle is unknown
+
   // Add dark matter and mediator with parameters from Boosted Dark Matter app configuration
   // Ideally, this code should be in the Dark Matter app, not here.
   // But presently there is no way to edit the PDGLibrary after it has been created.
@@ -48,10 +79,18 @@ private:
   PDGLibrary(const PDGLibrary & config_pool);
   virtual ~PDGLibrary();
 
-  bool LoadDBase(void);
+  bool LoadDBase   (void);
+  bool ReadDBase   (void);
+  void BuildTable  (void);
+  int  AddToTable  (TParticlePDG * p);
+  int  IdOrExit    (int pdgc);
 
   static PDGLibrary * fInstance;
   TDatabasePDG      * fDatabasePDG;
+
+  vector<Properties_t> fProperties; ///< particle properties, indexed by id
+  map<int, int>        fIds;        ///< PDG code -> id
+  unsigned int         fGeneration; ///< incremented whenever the table is rebuilt
   
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
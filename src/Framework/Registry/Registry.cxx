@@ -19,6 +19,10 @@
    cascaded through the entire pool of instantiated algorithms.
  @ Sep 30, 2009 - CA
    Added 'RgType_t ItemType(RgKey) const', 'RgKeyList FindKeys(RgKey) const'
+ @ Oct 14, 2026 - CA
+   Registries copied from one another share their items until one of them
+   is modified (copy-on-write). Keys are passed by reference and every
+   accessor does a single map lookup.
 
 */
 //____________________________________________________________________________
@@ -97,7 +101,8 @@ namespace genie {
  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 }
 //____________________________________________________________________________
-Registry::Registry() 
+Registry::Registry() :
+fStore            ( new RgIStore_t )
 {
   this->Init();
 }
@@ -105,14 +110,17 @@ Registry::Registry()
 Registry::Registry(string name, bool isReadOnly) :
 fName             ( name       ),
 fIsReadOnly       ( isReadOnly ),
-fInhibitItemLocks ( false      )
+fInhibitItemLocks ( false      ),
+fStore            ( new RgIStore_t )
 {
 
 }
 //____________________________________________________________________________
 Registry::Registry(const Registry & registry) :
 fName("uninitialised"),
-fIsReadOnly(false)
+fIsReadOnly(false),
+fInhibitItemLocks(false),
+fStore(new RgIStore_t)
 {
   this->Copy(registry);
 }
@@ -120,6 +128,7 @@ fIsReadOnly(false)
 Registry::~Registry()
 {
   this->Clear(true);
+  this->ReleaseStore();
 }
 //____________________________________________________________________________
 void Registry::operator() (RgKey key, RgInt item)
@@ -190,10 +199,10 @@ bool Registry::ItemLocksAreActive(void) const
   return !fInhibitItemLocks;
 }
 //____________________________________________________________________________
-bool Registry::ItemIsLocal(RgKey key) const
+bool Registry::ItemIsLocal(const RgKey & key) const
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = fStore->fItems.find(key);
+  if( entry != fStore->fItems.end() ) {
      bool is_local = entry->second->IsLocal();
      return is_local;
   } else {
@@ -206,10 +215,11 @@ bool Registry::ItemIsLocal(RgKey key) const
   return false;
 }
 //____________________________________________________________________________
-void Registry::OverrideGlobalDef(RgKey key)
+void Registry::OverrideGlobalDef(const RgKey & key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+     this->DetachStore();
+     RgIMapConstIter entry = fStore->fItems.find(key);
      entry->second->SetLocal(true);
   } else {
      LOG("Registry", pWARN)
@@ -218,10 +228,11 @@ void Registry::OverrideGlobalDef(RgKey key)
   }
 }
 //____________________________________________________________________________
-void Registry::LinkToGlobalDef(RgKey key)
+void Registry::LinkToGlobalDef(const RgKey & key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+     this->DetachStore();
+     RgIMapConstIter entry = fStore->fItems.find(key);
      entry->second->SetLocal(false);
   } else {
      LOG("Registry", pWARN)
@@ -230,10 +241,10 @@ void Registry::LinkToGlobalDef(RgKey key)
   }
 }
 //____________________________________________________________________________
-bool Registry::ItemIsLocked(RgKey key) const
+bool Registry::ItemIsLocked(const RgKey & key) const
 {
-  if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = fStore->fItems.find(key);
+  if( entry != fStore->fItems.end() ) {
      bool is_locked = entry->second->IsLocked();
      return is_locked;
   } else {
@@ -246,10 +257,11 @@ bool Registry::ItemIsLocked(RgKey key) const
   return false;
 }
 //____________________________________________________________________________
-void Registry::LockItem(RgKey key)
+void Registry::LockItem(const RgKey & key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+     this->DetachStore();
+     RgIMapConstIter entry = fStore->fItems.find(key);
      entry->second->Lock();
   } else {
      LOG("Registry", pWARN)
@@ -257,10 +269,11 @@ void Registry::LockItem(RgKey key)
   }
 }
 //____________________________________________________________________________
-void Registry::UnLockItem(RgKey key)
+void Registry::UnLockItem(const RgKey & key)
 {
   if( this->Exists(key) ) {
-     RgIMapConstIter entry = fRegistry.find(key);
+     this->DetachStore();
+     RgIMapConstIter entry = fStore->fItems.find(key);
      entry->second->UnLock();
   } else {
     LOG("Registry", pWARN)
@@ -268,7 +281,7 @@ void Registry::UnLockItem(RgKey key)
   }
 }
 //____________________________________________________________________________
-bool Registry::CanSetItem(RgKey key) const
+bool Registry::CanSetItem(const RgKey & key) const
 {
   bool locked_item       = this->ItemIsLocked(key);
   bool active_item_locks = this->ItemLocksAreActive();
@@ -281,69 +294,70 @@ bool Registry::CanSetItem(RgKey key) const
 //____________________________________________________________________________
 void Registry::Set(RgIMapPair entry)
 {
-  RgKey key = entry.first;
+  const RgKey & key = entry.first;
   if( this->CanSetItem(key) ) {
     this->DeleteEntry(key);
-    fRegistry.insert(entry);
+    this->DetachStore();
+    fStore->fItems.insert(entry);
   } else {
      LOG("Registry", pWARN)
              << "*** Registry item [" << key << "] can not be set";
   }
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgBool item)
+void Registry::Set(const RgKey & key, RgBool item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgInt item)
+void Registry::Set(const RgKey & key, RgInt item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgDbl item)
+void Registry::Set(const RgKey & key, RgDbl item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgCChAr item)
+void Registry::Set(const RgKey & key, RgCChAr item)
 {
   RgStr item2 = RgStr(item); // "const char *" -> "string"
   this->Set(key, item2);
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgStr item)
+void Registry::Set(const RgKey & key, RgStr item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgAlg item)
+void Registry::Set(const RgKey & key, RgAlg item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgH1F item)
+void Registry::Set(const RgKey & key, RgH1F item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgH2F item)
+void Registry::Set(const RgKey & key, RgH2F item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Set(RgKey key, RgTree item)
+void Registry::Set(const RgKey & key, RgTree item)
 {
   SetRegistryItem(this, key, item); // call templated set method
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, const RegistryItemI * & item) const
+void Registry::Get(const RgKey & key, const RegistryItemI * & item) const
 {
   RgIMapConstIter entry = this->SafeFind(key);
   item = entry->second;
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgBool & item) const
+void Registry::Get(const RgKey & key, RgBool & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Get an RgBool item with key: " << key;
@@ -359,7 +373,7 @@ void Registry::Get(RgKey key, RgBool & item) const
   item = ri->Data();
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgInt & item) const
+void Registry::Get(const RgKey & key, RgInt & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Getting an RgInt item with key: " << key;
@@ -375,7 +389,7 @@ void Registry::Get(RgKey key, RgInt & item) const
   item = ri->Data();
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgDbl & item) const
+void Registry::Get(const RgKey & key, RgDbl & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Getting an RgDbl item with key: " << key;
@@ -391,7 +405,7 @@ void Registry::Get(RgKey key, RgDbl & item) const
   item = ri->Data();
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgStr & item) const
+void Registry::Get(const RgKey & key, RgStr & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Getting an RgStr item with  key: " << key;
@@ -407,7 +421,7 @@ void Registry::Get(RgKey key, RgStr & item) const
   item = ri->Data();
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgAlg & item) const
+void Registry::Get(const RgKey & key, RgAlg & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Getting an RgAlg item with key: " << key;
@@ -424,7 +438,7 @@ void Registry::Get(RgKey key, RgAlg & item) const
   item = ri->Data();
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgH1F & item) const
+void Registry::Get(const RgKey & key, RgH1F & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Getting an RgH1F item with key: " << key;
@@ -440,7 +454,7 @@ void Registry::Get(RgKey key, RgH1F & item) const
   }
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgH2F & item) const
+void Registry::Get(const RgKey & key, RgH2F & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Getting an RgH2F item with key: " << key;
@@ -456,7 +470,7 @@ void Registry::Get(RgKey key, RgH2F & item) const
   }
 }
 //____________________________________________________________________________
-void Registry::Get(RgKey key, RgTree & item) const
+void Registry::Get(const RgKey & key, RgTree & item) const
 {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("Registry", pDEBUG) << "Getting an RgTree item with key: " << key;
@@ -472,44 +486,44 @@ void Registry::Get(RgKey key, RgTree & item) const
   }
 }
 //____________________________________________________________________________
-RgBool Registry::GetBool(RgKey key) const
+RgBool Registry::GetBool(const RgKey & key) const
 {
   RgBool value;
   this->Get(key, value);
   return value;
 }
 //____________________________________________________________________________
-RgInt Registry::GetInt(RgKey key) const
+RgInt Registry::GetInt(const RgKey & key) const
 {
   RgInt value;
   this->Get(key, value);
   return value;
 }
 //____________________________________________________________________________
-RgDbl Registry::GetDouble(RgKey key) const
+RgDbl Registry::GetDouble(const RgKey & key) const
 {
   RgDbl value;
   this->Get(key, value);
   return value;
 }
 //____________________________________________________________________________
-RgStr Registry::GetString(RgKey key) const
+RgStr Registry::GetString(const RgKey & key) const
 {
   RgStr value;
   this->Get(key, value);
   return value;
 }
 //____________________________________________________________________________
-RgAlg Registry::GetAlg(RgKey key) const
+RgAlg Registry::GetAlg(const RgKey & key) const
 {
   RgAlg value;
   this->Get(key, value);
   return value;
 }
 //____________________________________________________________________________
-RgH1F Registry::GetH1F(RgKey key) const
+RgH1F Registry::GetH1F(const RgKey & key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = fStore->fItems.find(key);
   RegistryItemI * rib = entry->second;
   RegistryItem<RgH1F> *ri = dynamic_cast<RegistryItem<RgH1F>*> (rib);
 
@@ -517,9 +531,9 @@ RgH1F Registry::GetH1F(RgKey key) const
   return item;
 }
 //____________________________________________________________________________
-RgH2F Registry::GetH2F(RgKey key) const
+RgH2F Registry::GetH2F(const RgKey & key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = fStore->fItems.find(key);
   RegistryItemI * rib = entry->second;
   RegistryItem<RgH2F> *ri = dynamic_cast<RegistryItem<RgH2F>*> (rib);
 
@@ -527,9 +541,9 @@ RgH2F Registry::GetH2F(RgKey key) const
   return item;
 }
 //____________________________________________________________________________
-RgTree Registry::GetTree(RgKey key) const
+RgTree Registry::GetTree(const RgKey & key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
+  RgIMapConstIter entry = fStore->fItems.find(key);
   RegistryItemI * rib = entry->second;
   RegistryItem<RgTree> *ri = dynamic_cast<RegistryItem<RgTree>*> (rib);
 
@@ -537,35 +551,35 @@ RgTree Registry::GetTree(RgKey key) const
   return item;
 }
 //____________________________________________________________________________
-RgBool Registry::GetBoolDef(RgKey key, RgBool def_opt, bool set_def) 
+RgBool Registry::GetBoolDef(const RgKey & key, RgBool def_opt, bool set_def) 
 {
   return GetValueOrUseDefault(this, key, def_opt, set_def);
 }
 //____________________________________________________________________________
-int Registry::GetIntDef(RgKey key, int def_opt, bool set_def)
+int Registry::GetIntDef(const RgKey & key, int def_opt, bool set_def)
 {
   return GetValueOrUseDefault(this, key, def_opt, set_def);
 }
 //____________________________________________________________________________
-double Registry::GetDoubleDef(RgKey key, double def_opt, bool set_def) 
+double Registry::GetDoubleDef(const RgKey & key, double def_opt, bool set_def) 
 {
   return GetValueOrUseDefault(this, key, def_opt, set_def);
 }
 //____________________________________________________________________________
-string Registry::GetStringDef(RgKey key, string def_opt, bool set_def) 
+string Registry::GetStringDef(const RgKey & key, string def_opt, bool set_def) 
 {
   return GetValueOrUseDefault(this, key, def_opt, set_def);
 }
 //____________________________________________________________________________
-RgAlg Registry::GetAlgDef(RgKey key, RgAlg  def_opt, bool set_def)
+RgAlg Registry::GetAlgDef(const RgKey & key, RgAlg  def_opt, bool set_def)
 {
   return GetValueOrUseDefault(this, key, def_opt, set_def);
 }
 //____________________________________________________________________________
-RgIMapConstIter Registry::SafeFind(RgKey key) const
+RgIMapConstIter Registry::SafeFind(const RgKey & key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  if (entry!=fRegistry.end()) {
+  RgIMapConstIter entry = fStore->fItems.find(key);
+  if (entry!=fStore->fItems.end()) {
     return entry;
   }
   LOG("Registry/SafeFind", pFATAL)
@@ -575,20 +589,21 @@ RgIMapConstIter Registry::SafeFind(RgKey key) const
   exit(1);    
 }
 //____________________________________________________________________________
-bool Registry::Exists(RgKey key) const
+bool Registry::Exists(const RgKey & key) const
 {
-  RgIMapConstIter entry = fRegistry.find(key);
-  return (entry!=fRegistry.end());
+  RgIMapConstIter entry = fStore->fItems.find(key);
+  return (entry!=fStore->fItems.end());
 }
 //____________________________________________________________________________
-bool Registry::DeleteEntry(RgKey key)
+bool Registry::DeleteEntry(const RgKey & key)
 {
   if(!fIsReadOnly && Exists(key)) {
-      RgIMapIter entry = fRegistry.find(key);
+      this->DetachStore();
+      RgIMapIter entry = fStore->fItems.find(key);
       RegistryItemI * item = entry->second;
       delete item;
       item = 0;
-      fRegistry.erase(entry);
+      fStore->fItems.erase(entry);
       return true;
   }
   return false;
@@ -596,7 +611,7 @@ bool Registry::DeleteEntry(RgKey key)
 //____________________________________________________________________________
 int Registry::NEntries(void) const
 {
-  RgIMapSizeType reg_size = fRegistry.size();
+  RgIMapSizeType reg_size = fStore->fItems.size();
   return (const int) reg_size;
 }
 //____________________________________________________________________________
@@ -614,7 +629,7 @@ string Registry::Name(void) const
   return fName;
 }
 //____________________________________________________________________________
-void Registry::AssertExistence(RgKey key0) const
+void Registry::AssertExistence(const RgKey & key0) const
 {
   if ( ! this->Exists(key0) ) {
      LOG("Registry", pERROR) << (*this);
@@ -625,13 +640,13 @@ void Registry::AssertExistence(RgKey key0) const
   }
 }
 //____________________________________________________________________________
-void Registry::AssertExistence(RgKey key0, RgKey key1) const
+void Registry::AssertExistence(const RgKey & key0, const RgKey & key1) const
 {
   this->AssertExistence(key0);
   this->AssertExistence(key1);
 }
 //____________________________________________________________________________
-void Registry::AssertExistence(RgKey key0, RgKey key1, RgKey key2) const
+void Registry::AssertExistence(const RgKey & key0, const RgKey & key1, const RgKey & key2) const
 {
   this->AssertExistence(key0);
   this->AssertExistence(key1);
@@ -646,8 +661,8 @@ void Registry::CopyToFolder(TFolder * folder) const
 
   RgIMapConstIter reg_iter;
 
-  for(reg_iter = this->fRegistry.begin();
-                          reg_iter != this->fRegistry.end(); reg_iter++) {
+  for(reg_iter = fStore->fItems.begin();
+                          reg_iter != fStore->fItems.end(); reg_iter++) {
 
      ostringstream   entry;
      string          key   = reg_iter->first;
@@ -706,11 +721,11 @@ void Registry::Print(ostream & stream) const
    if(fInhibitItemLocks) { stream << "[on]";       }
    else                  { stream << "[off]";      }
 
-   stream << " - # entries: " << setfill(' ') << setw(3) << fRegistry.size()
+   stream << " - # entries: " << setfill(' ') << setw(3) << fStore->fItems.size()
           << endl;
 
-   RgIMapConstIter rcit = fRegistry.begin();
-   for( ; rcit != fRegistry.end(); rcit++) {
+   RgIMapConstIter rcit = fStore->fItems.begin();
+   for( ; rcit != fStore->fItems.end(); rcit++) {
 
      RgKey           key   = rcit->first;
      RegistryItemI * ritem = rcit->second;
@@ -755,7 +770,7 @@ void Registry::Copy(const Registry & registry)
   fInhibitItemLocks = registry.fInhibitItemLocks;
 }
 //____________________________________________________________________________
-void Registry::Append(const Registry & registry, RgKey prefix)
+void Registry::Append(const Registry & registry, const RgKey & prefix)
 {
 // Appends the input registry entries (& their locks)
 
@@ -769,14 +784,27 @@ void Registry::Append(const Registry & registry, RgKey prefix)
 
   this->InhibitItemLocks();
 
+  // Appending to an empty registry: share the input items if possible
+  if ( fStore->fItems.empty() && prefix.size() == 0 && registry.IsShareable() ) {
+    if ( fStore != registry.fStore ) {
+      this->ReleaseStore();
+      fStore = registry.fStore;
+      fStore->fNRef++;
+    }
+    return;
+  }
+
+  if ( registry.fStore->fItems.empty() ) return;
+  this->DetachStore();
+
   RgIMapConstIter reg_iter;
-  for(reg_iter = registry.fRegistry.begin();
-                      reg_iter != registry.fRegistry.end(); reg_iter++) {
+  for(reg_iter = registry.fStore->fItems.begin();
+                      reg_iter != registry.fStore->fItems.end(); reg_iter++) {
 
-     RgKey name     = reg_iter->first;
-     RgKey new_name = prefix + name;
+     const RgKey & name     = reg_iter->first;
+     RgKey         new_name = prefix + name;
 
-     if ( fRegistry.count( new_name ) > 0 ) continue ;
+     if ( fStore->fItems.count( new_name ) > 0 ) continue ;
 
      RgType_t type  = reg_iter -> second -> TypeInfo();
      string   stype = RgType::AsString(type);
@@ -785,11 +813,11 @@ void Registry::Append(const Registry & registry, RgKey prefix)
          << "Copying [" << stype << "] item named = " 
                                          << name << " as " << new_name;
 
-     RegistryItemI * cri = registry.CloneRegistryItem( name ) ; // cloned registry item
+     RegistryItemI * cri = registry.CloneRegistryItem( reg_iter ) ; // cloned registry item
 
      RgIMapPair reg_entry(new_name, cri);
 
-     if ( ! fRegistry.insert(reg_entry).second ) {
+     if ( ! fStore->fItems.insert(reg_entry).second ) {
     	 // The registry already contained an entry with key new_name
     	 //   so the new registryItem has to be deleted or we leak memory.
     	 //   This should not happened as a check is performed
@@ -799,7 +827,7 @@ void Registry::Append(const Registry & registry, RgKey prefix)
    } // loop on the incoming registry items
 }
 //____________________________________________________________________________
-void Registry::Merge(const Registry & registry, RgKey prefix)
+void Registry::Merge(const Registry & registry, const RgKey & prefix)
 {
 // Add the input registry entries (& their locks)
 // and updated entries already present
@@ -814,12 +842,15 @@ void Registry::Merge(const Registry & registry, RgKey prefix)
 
   this->InhibitItemLocks();
 
+  if ( registry.fStore->fItems.empty() ) return;
+  this->DetachStore();
+
   RgIMapConstIter reg_iter;
-  for(reg_iter = registry.fRegistry.begin();
-                      reg_iter != registry.fRegistry.end(); reg_iter++) {
+  for(reg_iter = registry.fStore->fItems.begin();
+                      reg_iter != registry.fStore->fItems.end(); reg_iter++) {
 
-     RgKey name     = reg_iter->first;
-     RgKey new_name = prefix + name;
+     const RgKey & name     = reg_iter->first;
+     RgKey         new_name = prefix + name;
 
      RgType_t type  = reg_iter -> second -> TypeInfo();
      string   stype = RgType::AsString(type);
@@ -828,23 +859,22 @@ void Registry::Merge(const Registry & registry, RgKey prefix)
          << "Copying [" << stype << "] item named = "
                                          << name << " as " << new_name;
 
-     RegistryItemI * cri = registry.CloneRegistryItem( name ) ; // cloned registry item
-
-     if ( fRegistry.count( new_name ) > 0 ) {
+     RegistryItemI * cri = registry.CloneRegistryItem( reg_iter ) ; // cloned registry item
 
-       RegistryItemI * old_ri = fRegistry[new_name] ;
-   	   delete old_ri ;
+     RgIMapIter old = fStore->fItems.find( new_name ) ;
+     if ( old != fStore->fItems.end() ) {
+       delete old -> second ;
+       old -> second = cri ;
      }
-
-     fRegistry[new_name] = cri ;
+     else fStore->fItems.insert( RgIMapPair( new_name, cri ) ) ;
 
    } // loop on the incoming registry items
 
 }//____________________________________________________________________________
-RgType_t Registry::ItemType(RgKey key) const
+RgType_t Registry::ItemType(const RgKey & key) const
 {
-  RgIMapConstIter reg_iter = fRegistry.find(key);
-  if(reg_iter != fRegistry.end()) {
+  RgIMapConstIter reg_iter = fStore->fItems.find(key);
+  if(reg_iter != fStore->fItems.end()) {
      RegistryItemI * ri = reg_iter->second;
      RgType_t type  = ri->TypeInfo();
      return type;
@@ -852,12 +882,12 @@ RgType_t Registry::ItemType(RgKey key) const
   return kRgUndefined;
 }
 //____________________________________________________________________________
-RgKeyList Registry::FindKeys(RgKey key_part) const
+RgKeyList Registry::FindKeys(const RgKey & key_part) const
 {
   RgKeyList klist;
 
-  RgIMapConstIter reg_iter = fRegistry.begin();
-  for( ; reg_iter != fRegistry.end(); reg_iter++) {
+  RgIMapConstIter reg_iter = fStore->fItems.begin();
+  for( ; reg_iter != fStore->fItems.end(); reg_iter++) {
     RgKey key = reg_iter->first;
     if (key.find(key_part) != string::npos) {
       klist.push_back(key);
@@ -889,9 +919,15 @@ void Registry::Clear(bool force)
       return;
     }
   }
+  // items shared with other registries are left to them
+  if(fStore->fNRef > 1) {
+    this->ReleaseStore();
+    fStore = new RgIStore_t;
+    return;
+  }
   RgIMapIter rit;
-  for(rit = fRegistry.begin(); rit != fRegistry.end(); rit++) {
-     RgKey           name = rit->first;
+  for(rit = fStore->fItems.begin(); rit != fStore->fItems.end(); rit++) {
+     const RgKey &   name = rit->first;
      RegistryItemI * item = rit->second;
      if(!item) {
        LOG("Registry", pWARN) << "Item with key = " << name << " is null!";
@@ -899,19 +935,25 @@ void Registry::Clear(bool force)
      delete item;
      item = 0;
   }
-  fRegistry.clear();
+  fStore->fItems.clear();
 }
 //____________________________________________________________________________
 RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
 
-	std::map<RgKey, RegistryItemI*>::const_iterator it = fRegistry.find( key ) ;
+	RgIMapConstIter it = fStore->fItems.find( key ) ;
 
-	if ( it == fRegistry.end() ) {
+	if ( it == fStore->fItems.end() ) {
 		LOG("Registry", pFATAL) << "Item " << key << " not found while cloning for registry " << Name() ;
 		exit( 0 ) ;
 	}
 
-	RegistryItemI * ri  = it -> second ;
+	return CloneRegistryItem( it ) ;
+}
+//____________________________________________________________________________
+RegistryItemI * Registry::CloneRegistryItem( RgIMapConstIter it ) const {
+
+     const RgKey &   key   = it -> first ;
+     RegistryItemI * ri    = it -> second ;
 
      bool     ilk   = ri->IsLocked();
      RgType_t type  = ri->TypeInfo();
@@ -919,17 +961,17 @@ RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
 
      RegistryItemI * cri = 0; // cloned registry item
      if (type == kRgBool)
-           cri = new RegistryItem<RgBool>( GetBool(key), ilk);
+           cri = new RegistryItem<RgBool>( ItemData<RgBool>(ri), ilk);
      else if (type == kRgDbl)
-           cri = new RegistryItem<RgDbl> ( GetDouble(key), ilk);
+           cri = new RegistryItem<RgDbl> ( ItemData<RgDbl>(ri), ilk);
      else if (type == kRgInt)
-           cri = new RegistryItem<RgInt> ( GetInt(key), ilk);
+           cri = new RegistryItem<RgInt> ( ItemData<RgInt>(ri), ilk);
      else if (type == kRgStr)
-           cri = new RegistryItem<RgStr> ( GetString(key), ilk);
+           cri = new RegistryItem<RgStr> ( ItemData<RgStr>(ri), ilk);
      else if (type == kRgAlg)
-           cri = new RegistryItem<RgAlg> ( GetAlg(key), ilk);
+           cri = new RegistryItem<RgAlg> ( ItemData<RgAlg>(ri), ilk);
      else if (type == kRgH1F) {
-           RgH1F histo = GetH1F(key);
+           RgH1F histo = ItemData<RgH1F>(ri);
            if(histo) {
                RgH1F chisto = new TH1F(*histo);
                LOG("Registry", pDEBUG) << chisto->GetName();
@@ -939,7 +981,7 @@ RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
                << "Null TH1F with key = " << key << " - not copied";
            }
      } else if (type == kRgH2F) {
-           RgH2F histo = GetH2F(key);
+           RgH2F histo = ItemData<RgH2F>(ri);
            if(histo) {
                RgH2F chisto = new TH2F(*histo);
                LOG("Registry", pDEBUG) << chisto->GetName();
@@ -949,7 +991,7 @@ RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
                << "Null TH2F with key = " << key << " - not copied";
            }
      } else if (type == kRgTree) {
-           RgTree tree = GetTree(key);
+           RgTree tree = ItemData<RgTree>(ri);
            if(tree) {
                //TTree * ctree = new TTree(*tree);
                TTree * ctree = tree->CopyTree("1");
@@ -968,4 +1010,51 @@ RegistryItemI * Registry::CloneRegistryItem( const RgKey & key ) const {
      return cri ;
 
 }
+//____________________________________________________________________________
+bool Registry::IsShareable(void) const
+{
+// Items can be shared with (rather than cloned to) another registry if that
+// would not change them: Cloning makes all items 'local' and it copies the
+// histograms and trees held by the registry.
+
+  RgIMapConstIter it = fStore->fItems.begin();
+  for( ; it != fStore->fItems.end(); ++it) {
+    RegistryItemI * ri = it->second;
+    if(!ri) return false;
+    if(!ri->IsLocal()) return false;
+    RgType_t type = ri->TypeInfo();
+    if(type == kRgH1F || type == kRgH2F || type == kRgTree) return false;
+  }
+  return true;
+}
+//____________________________________________________________________________
+void Registry::DetachStore(void)
+{
+// Called before the items are modified: get a private copy of any items
+// still shared with other registries
+
+  if(fStore->fNRef <= 1) return;
+
+  RgIStore_t * store = new RgIStore_t;
+  RgIMapConstIter it = fStore->fItems.begin();
+  for( ; it != fStore->fItems.end(); ++it) {
+    store->fItems.insert(
+       store->fItems.end(), RgIMapPair(it->first, this->CloneRegistryItem(it)));
+  }
+  fStore->fNRef--;
+  fStore = store;
+}
+//____________________________________________________________________________
+void Registry::ReleaseStore(void)
+{
+// Drop the reference to the items (deleted with the last reference)
+
+  if(!fStore) return;
+  if(--fStore->fNRef <= 0) {
+    RgIMapIter it = fStore->fItems.begin();
+    for( ; it != fStore->fItems.end(); ++it) delete it->second;
+    delete fStore;
+  }
+  fStore = 0;
+}
 
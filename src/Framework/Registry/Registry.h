@@ -6,6 +6,12 @@
 \brief    A registry. Provides the container for algorithm configuration
           parameters.
 
+          Registries copied from one another (Copy(), the copy constructor
+          and assignment, or Append() to an empty registry) share the same
+          items until one of them is modified, when it gets a private copy
+          (copy-on-write). This makes the registry copies done while
+          configuring and reconfiguring algorithms cheap.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -94,72 +100,72 @@ public:
   void   InhibitItemLocks    (void);            ///< override individual item locks
   void   RestoreItemLocks    (void);            ///< restore individual item locks
   bool   ItemLocksAreActive  (void) const;      ///< check if item locks are active
-  void   LockItem            (RgKey key);       ///< locks the registry item
-  void   UnLockItem          (RgKey key);       ///< unlocks the registry item
-  bool   ItemIsLocked        (RgKey key) const; ///< check item lock
-  bool   ItemIsLocal         (RgKey key) const; ///< local or global?
-  void   OverrideGlobalDef   (RgKey key);       ///< let item override global default   (i.e. a 'local'  item)
-  void   LinkToGlobalDef     (RgKey key);       ///< link its value to a global default (i.e. a 'global' item)
+  void   LockItem            (const RgKey & key);       ///< locks the registry item
+  void   UnLockItem          (const RgKey & key);       ///< unlocks the registry item
+  bool   ItemIsLocked        (const RgKey & key) const; ///< check item lock
+  bool   ItemIsLocal         (const RgKey & key) const; ///< local or global?
+  void   OverrideGlobalDef   (const RgKey & key);       ///< let item override global default   (i.e. a 'local'  item)
+  void   LinkToGlobalDef     (const RgKey & key);       ///< link its value to a global default (i.e. a 'global' item)
 
   // Methods to set/retrieve Registry values
   //
   void   Set (RgIMapPair entry);
-  void   Set (RgKey key, RgBool  item);
-  void   Set (RgKey key, RgInt   item);
-  void   Set (RgKey key, RgDbl   item);
-  void   Set (RgKey key, RgStr   item);
-  void   Set (RgKey key, RgAlg   item);
-  void   Set (RgKey key, RgCChAr item);
-  void   Set (RgKey key, RgH1F   item);
-  void   Set (RgKey key, RgH2F   item);
-  void   Set (RgKey key, RgTree  item);
-
-  void   Get (RgKey key, const RegistryItemI * & item) const;
-  void   Get (RgKey key, RgBool & item) const;
-  void   Get (RgKey key, RgInt &  item) const;
-  void   Get (RgKey key, RgDbl &  item) const;
-  void   Get (RgKey key, RgStr &  item) const;
-  void   Get (RgKey key, RgAlg &  item) const;
-  void   Get (RgKey key, RgH1F &  item) const;
-  void   Get (RgKey key, RgH2F &  item) const;
-  void   Get (RgKey key, RgTree & item) const;
-
-  RgBool GetBool      (RgKey key) const;
-  RgInt  GetInt       (RgKey key) const;
-  RgDbl  GetDouble    (RgKey key) const;
-  RgStr  GetString    (RgKey key) const;
-  RgAlg  GetAlg       (RgKey key) const;
-  RgH1F  GetH1F       (RgKey key) const;
-  RgH2F  GetH2F       (RgKey key) const;
-  RgTree GetTree      (RgKey key) const;
-
-  RgBool GetBoolDef   (RgKey key, RgBool def_opt, bool set_def=true);
-  RgInt  GetIntDef    (RgKey key, RgInt  def_opt, bool set_def=true);
-  RgDbl  GetDoubleDef (RgKey key, RgDbl  def_opt, bool set_def=true);
-  RgStr  GetStringDef (RgKey key, RgStr  def_opt, bool set_def=true);
-  RgAlg  GetAlgDef    (RgKey key, RgAlg  def_opt, bool set_def=true);
+  void   Set (const RgKey & key, RgBool  item);
+  void   Set (const RgKey & key, RgInt   item);
+  void   Set (const RgKey & key, RgDbl   item);
+  void   Set (const RgKey & key, RgStr   item);
+  void   Set (const RgKey & key, RgAlg   item);
+  void   Set (const RgKey & key, RgCChAr item);
+  void   Set (const RgKey & key, RgH1F   item);
+  void   Set (const RgKey & key, RgH2F   item);
+  void   Set (const RgKey & key, RgTree  item);
+
+  void   Get (const RgKey & key, const RegistryItemI * & item) const;
+  void   Get (const RgKey & key, RgBool & item) const;
+  void   Get (const RgKey & key, RgInt &  item) const;
+  void   Get (const RgKey & key, RgDbl &  item) const;
+  void   Get (const RgKey & key, RgStr &  item) const;
+  void   Get (const RgKey & key, RgAlg &  item) const;
+  void   Get (const RgKey & key, RgH1F &  item) const;
+  void   Get (const RgKey & key, RgH2F &  item) const;
+  void   Get (const RgKey & key, RgTree & item) const;
+
+  RgBool GetBool      (const RgKey & key) const;
+  RgInt  GetInt       (const RgKey & key) const;
+  RgDbl  GetDouble    (const RgKey & key) const;
+  RgStr  GetString    (const RgKey & key) const;
+  RgAlg  GetAlg       (const RgKey & key) const;
+  RgH1F  GetH1F       (const RgKey & key) const;
+  RgH2F  GetH2F       (const RgKey & key) const;
+  RgTree GetTree      (const RgKey & key) const;
+
+  RgBool GetBoolDef   (const RgKey & key, RgBool def_opt, bool set_def=true);
+  RgInt  GetIntDef    (const RgKey & key, RgInt  def_opt, bool set_def=true);
+  RgDbl  GetDoubleDef (const RgKey & key, RgDbl  def_opt, bool set_def=true);
+  RgStr  GetStringDef (const RgKey & key, RgStr  def_opt, bool set_def=true);
+  RgAlg  GetAlgDef    (const RgKey & key, RgAlg  def_opt, bool set_def=true);
   
-  RgIMapConstIter SafeFind  (RgKey key) const;
+  RgIMapConstIter SafeFind  (const RgKey & key) const;
 
   int    NEntries     (void) const;                     ///< get number of items
-  bool   Exists       (RgKey key) const;                ///< item with input key exists?
-  bool   CanSetItem   (RgKey key) const;                ///< can I set the specifed item?
-  bool   DeleteEntry  (RgKey key);                      ///< delete the spcified item
+  bool   Exists       (const RgKey & key) const;                ///< item with input key exists?
+  bool   CanSetItem   (const RgKey & key) const;                ///< can I set the specifed item?
+  bool   DeleteEntry  (const RgKey & key);                      ///< delete the spcified item
   void   SetName      (string name);                    ///< set the registry name
   string Name         (void) const;                     ///< get the registry name
   void   Print        (ostream & stream) const;         ///< print the registry to stream
   void   Copy         (const Registry &);               ///< copy the input registry
-  void   Append       (const Registry &, RgKey pfx=""); ///< append the input registry. Entries already in the registry are not updated
-  void   Merge        (const Registry &, RgKey pfx=""); ///< append the input registry. Entries already in the registry are updated
+  void   Append       (const Registry &, const RgKey & pfx=""); ///< append the input registry. Entries already in the registry are not updated
+  void   Merge        (const Registry &, const RgKey & pfx=""); ///< append the input registry. Entries already in the registry are updated
   void   Clear        (bool force = false);             ///< clear the registry
   void   Init         (void);                           ///< initialize the registry
 
-  RgType_t  ItemType (RgKey key)      const;  ///< return item type
-  RgKeyList FindKeys (RgKey key_part) const;  ///< create list with all keys containing 'key_part'
+  RgType_t  ItemType (const RgKey & key)      const;  ///< return item type
+  RgKeyList FindKeys (const RgKey & key_part) const;  ///< create list with all keys containing 'key_part'
 
   // Access key->item map
   //
-  const RgIMap & GetItemMap(void) const { return fRegistry; }
+  const RgIMap & GetItemMap(void) const { return fStore->fItems; }
 
   // Convert to TFolder (this is the primary mechanism for saving the
   // GENIE configuration in a ROOT file, along with its generated events)
@@ -168,20 +174,35 @@ public:
 
   // Assert the existence or registry items
   //
-  void AssertExistence (RgKey key0) const;
-  void AssertExistence (RgKey key0, RgKey key1) const;
-  void AssertExistence (RgKey key0, RgKey key1, RgKey key2) const;
+  void AssertExistence (const RgKey & key0) const;
+  void AssertExistence (const RgKey & key0, const RgKey & key1) const;
+  void AssertExistence (const RgKey & key0, const RgKey & key1, const RgKey & key2) const;
 
 private:
 
   RegistryItemI * CloneRegistryItem( const RgKey & key ) const ;   ///< Properly clone a registry Item according to its type
+  RegistryItemI * CloneRegistryItem( RgIMapConstIter it ) const ;  ///< as above, for an item already looked up
+
+  bool   IsShareable  (void) const;  ///< can the items be shared rather than cloned?
+  void   DetachStore  (void);        ///< get a private copy of shared items before modifying them
+  void   ReleaseStore (void);        ///< drop the reference to the items
+
+  template<class T> static const T & ItemData(const RegistryItemI * ri)
+       { return dynamic_cast<const RegistryItem<T> *>(ri)->Data(); }
+
+  //! Registry items, shared by registries copied from one another
+  struct RgIStore_t {
+    RgIStore_t() : fNRef(1) { }
+    RgIMap fItems;  ///< 'key' -> 'value' map
+    int    fNRef;   ///< # of registries sharing the items
+  };
 
   // Registry's private data members
   //
   string fName;              ///< registry's name
   bool   fIsReadOnly;        ///< is read only?
   bool   fInhibitItemLocks;  ///<
-  RgIMap fRegistry;          ///< 'key' -> 'value' map
+  RgIStore_t * fStore;       //! 'key' -> 'value' map, possibly shared
 };
 
 }        // genie namespace
@@ -11,6 +11,11 @@
 
 // for exit()
 #include <cstdlib>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <stdint.h>
+#include <sys/stat.h>
 
 #include <TSystem.h>
 
@@ -21,11 +26,40 @@
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/PhaseTimer.h"
+#include "Framework/Utils/RunOpt.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/XmlParserUtils.h"
 
+using std::ostringstream;
+
 using namespace genie;
 
+namespace {
+  // Binary copy of an XML spline file in the shared data directory, if set.
+  // The name is keyed on the XML file path, size and modification time.
+  string SharedSplineFile(const string & xmlfile)
+  {
+    string dir = utils::system::SharedDataDir();
+    struct stat st;
+    if(dir.size() == 0 || stat(xmlfile.c_str(), &st) != 0) return "";
+
+    ostringstream id;
+    id << xmlfile << ":" << (long long) st.st_size << ":" << (long long) st.st_mtime;
+    string str = id.str();
+    uint64_t hash = 14695981039346656037ULL;
+    for(unsigned int i = 0; i < str.size(); i++) {
+      hash ^= (unsigned char) str[i];
+      hash *= 1099511628211ULL;
+    }
+
+    string base = xmlfile.substr(xmlfile.find_last_of('/') + 1);
+    ostringstream file;
+    file << dir << "/" << base << "." << std::hex << std::setw(16)
+         << std::setfill('0') << hash << ".gsplbin";
+    return file.str();
+  }
+}
 //___________________________________________________________________________
 
 void genie::utils::app_init::RandGen(long int seed)
@@ -36,9 +70,13 @@ void genie::utils::app_init::RandGen(long int seed)
   }
 }
 //___________________________________________________________________________
-void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
+void genie::utils::app_init::XSecTable (
+   string inpfile, bool require_table, bool keep)
 {
-  // Load cross-section splines using file specified at the command-line.
+  PhaseTimerGuard timer("AppInit::XSecTable");
+
+  // Load cross-section splines using file specified at the command-line,
+  // adding them to the splines already in the list if keep is set.
 
   XSecSplineList * xspl = XSecSplineList::Instance();
 
@@ -58,10 +96,45 @@ void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
     }
   }
 
+  // keep the splines of the alternate tunes event weights are written for
+  vector<string> alt_tunes =
+     utils::str::Split(RunOpt::Instance()->AltTunes(), ",");
+  for (unsigned int i = 0; i < alt_tunes.size(); i++) {
+    string tune = utils::str::TrimSpaces(alt_tunes[i]);
+    if (tune.size() > 0) xspl->AddFilterTune(tune);
+  }
+
   // file was specified & exists - load table
   if (utils::system::FileExists(fullinpfile)) {
     xspl = XSecSplineList::Instance();
-    XmlParserStatus_t status = xspl->LoadFromXml(fullinpfile);
+    bool binary = XSecSplineList::IsBinaryFile(fullinpfile);
+
+    // with a shared data directory, the first job of a node converts an XML
+    // file to binary and the others map the binary copy (sharing its knots)
+    string shared = (binary) ? "" : SharedSplineFile(fullinpfile);
+    XmlParserStatus_t status = kXmlNotParsed;
+    if (shared.size() > 0 && utils::system::FileExists(shared)) {
+      status = xspl->LoadFromBinary(shared, keep);
+    }
+    if (status != kXmlOK) {
+      status = (binary) ?
+         xspl->LoadFromBinary(fullinpfile, keep) :
+         xspl->LoadFromXml(fullinpfile, keep);
+
+      // publish only complete copies of the file
+      if (status == kXmlOK && shared.size() > 0 &&
+          !keep && !xspl->HasLoadFilter()) {
+        ostringstream tmpfile;
+        tmpfile << shared << "." << gSystem->GetPid() << ".tmp";
+        xspl->SaveAsBinary(tmpfile.str());
+        if (std::rename(tmpfile.str().c_str(), shared.c_str()) != 0) {
+          LOG("AppInit", pWARN) << "Could not publish: " << shared;
+          std::remove(tmpfile.str().c_str());
+        } else {
+          LOG("AppInit", pNOTICE) << "Published the splines in: " << shared;
+        }
+      }
+    }
     if (status != kXmlOK) {
       LOG("AppInit", pFATAL)
          << "Problem reading file: " << expandedinpfile;
@@ -99,6 +172,8 @@ void genie::utils::app_init::XSecTable (string inpfile, bool require_table)
 //___________________________________________________________________________
 void genie::utils::app_init::MesgThresholds(string filelist)
 {
+  PhaseTimerGuard timer("AppInit::MesgThresholds");
+
   std::vector<std::string> files = genie::utils::str::Split(filelist,":;,");
   for (size_t i=0; i < files.size(); ++i ) {
     std::string inp_file = files[i];
@@ -115,10 +190,12 @@ void genie::utils::app_init::MesgThresholds(string filelist)
 
 }
 //___________________________________________________________________________
-void genie::utils::app_init::CacheFile(string inp_file)
+void genie::utils::app_init::CacheFile(string inp_file, bool read_only)
 {
+  PhaseTimerGuard timer("AppInit::CacheFile");
+
   if(inp_file.size() > 0) {
-    Cache::Instance()->OpenCacheFile(inp_file);
+    Cache::Instance()->OpenCacheFile(inp_file, read_only);
   }
 }
 //___________________________________________________________________________
@@ -27,9 +27,9 @@ namespace utils {
 namespace app_init
 {
   void RandGen        (long int seed);
-  void XSecTable      (string inpfile, bool require_table);
+  void XSecTable      (string inpfile, bool require_table, bool keep=false);
   void MesgThresholds (string inpfile);
-  void CacheFile      (string inpfile);
+  void CacheFile      (string inpfile, bool read_only=false);
 
 } // app_init namespace
 } // utils namespace
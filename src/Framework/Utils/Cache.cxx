@@ -14,6 +14,8 @@
    Cache is not autoloaded and use of variables $GCACHEFILE is no longer
    supported. Instead, call Cache::OpenCacheFile(string filename) explicitly.
    Now cached data are stored in the top-level 'directory'.
+ @ Oct 14, 2026 - CA
+   Implemented RmCacheBranch() and RmMatchedCacheBranches().
 */
 //____________________________________________________________________________
 
@@ -48,6 +50,7 @@ Cache::Cache()
   fInstance  = 0;
   fCacheMap  = 0;
   fCacheFile = 0;
+  fCacheReadOnly = false;
 }
 //____________________________________________________________________________
 Cache::~Cache()
@@ -99,6 +102,19 @@ void Cache::AddCacheBranch(string key, CacheBranchI * branch)
   fCacheMap->insert( map<string, CacheBranchI *>::value_type(key,branch) );
 }
 //____________________________________________________________________________
+CacheBranchI * Cache::FindCacheBranch(ULong64_t id) const
+{
+  map<ULong64_t, CacheBranchI *>::const_iterator idx_iter = fCacheIdx.find(id);
+
+  if (idx_iter == fCacheIdx.end()) return 0;
+  return idx_iter->second;
+}
+//____________________________________________________________________________
+void Cache::IndexCacheBranch(ULong64_t id, CacheBranchI * branch)
+{
+  fCacheIdx[id] = branch;
+}
+//____________________________________________________________________________
 string Cache::CacheBranchKey(string k0, string k1, string k2) const
 {
   ostringstream key;
@@ -114,6 +130,13 @@ void Cache::RmCacheBranch(string key)
 {
   LOG("Cache", pNOTICE) << "Removing cache branch: " << key;
 
+  if(!fCacheMap) return;
+  map<string, CacheBranchI *>::iterator citer = fCacheMap->find(key);
+  if(citer == fCacheMap->end()) return;
+
+  this->UnIndexCacheBranch(citer->second);
+  delete citer->second;
+  fCacheMap->erase(citer);
 }
 //____________________________________________________________________________
 void Cache::RmAllCacheBranches(void)
@@ -131,12 +154,32 @@ void Cache::RmAllCacheBranches(void)
     }
     fCacheMap->clear();
   }
+  fCacheIdx.clear();
 }
 //____________________________________________________________________________
 void Cache::RmMatchedCacheBranches(string key_substring)
 {
   LOG("Cache", pNOTICE) << "Removing cache branches: *"<< key_substring<< "*";
 
+  if(!fCacheMap) return;
+  map<string, CacheBranchI *>::iterator citer = fCacheMap->begin();
+  while(citer != fCacheMap->end()) {
+    if(citer->first.find(key_substring) == string::npos) { ++citer; continue; }
+    this->UnIndexCacheBranch(citer->second);
+    delete citer->second;
+    fCacheMap->erase(citer++);
+  }
+}
+//____________________________________________________________________________
+void Cache::UnIndexCacheBranch(const CacheBranchI * branch)
+{
+// Remove the numeric ids pointing to a cache branch about to be deleted
+
+  map<ULong64_t, CacheBranchI *>::iterator iiter = fCacheIdx.begin();
+  while(iiter != fCacheIdx.end()) {
+    if(iiter->second == branch) fCacheIdx.erase(iiter++);
+    else ++iiter;
+  }
 }
 //____________________________________________________________________________
 void Cache::Load(void)
@@ -145,6 +188,7 @@ void Cache::Load(void)
 
   if(!fCacheFile) return;
   TList * keys = (TList*) fCacheFile->Get("key_list");
+  if(!keys) return;
   TIter kiter(keys);
   TObjString * keyobj = 0;
   int ib=0;
@@ -163,7 +207,7 @@ void Cache::Load(void)
 //____________________________________________________________________________
 void Cache::Save(void)
 {
-  if(!fCacheFile) {
+  if(!fCacheFile || fCacheReadOnly) {
     return;
   }
   fCacheFile->cd();
@@ -189,7 +233,21 @@ void Cache::Save(void)
   delete keys;
 }
 //____________________________________________________________________________
-void Cache::OpenCacheFile(string filename)
+void Cache::Sync(void)
+{
+// Write the cache branches to the cache file now, rather than at the end of
+// the job, so that the file can be used to warm-start other jobs even if
+// this one does not terminate cleanly
+
+  if(!fCacheFile || fCacheReadOnly) return;
+
+  LOG("Cache", pNOTICE) << "Writing cache to: " << fCacheFile->GetName();
+
+  this->Save();
+  fCacheFile->Write();
+}
+//____________________________________________________________________________
+void Cache::OpenCacheFile(string filename, bool read_only)
 {
   if(filename.size() == 0) return;
 
@@ -200,9 +258,11 @@ void Cache::OpenCacheFile(string filename)
     }
   }
 
-  LOG("Cache", pNOTICE) << "Using cache file: " << filename;
+  LOG("Cache", pNOTICE) 
+    << "Using cache file: " << filename << (read_only ? " (read-only)" : "");
 
-  fCacheFile = new TFile(filename.c_str(),"update");
+  fCacheReadOnly = read_only;
+  fCacheFile = new TFile(filename.c_str(), read_only ? "read" : "update");
   if(!fCacheFile->IsOpen()) {
      delete fCacheFile;
      fCacheFile = 0;
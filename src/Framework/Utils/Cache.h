@@ -42,14 +42,21 @@ public:
 
   static Cache * Instance(void);
 
-  //! cache file
-  void OpenCacheFile (string filename);
+  //! cache file: a read-only cache file is used as a warm-start store that
+  //! can be shared by concurrent jobs, and is never written back
+  void OpenCacheFile (string filename, bool read_only=false);
+  void Sync          (void);   ///< write current cache branches to the cache file
 
   //! finding/adding cache branches
   CacheBranchI * FindCacheBranch (string key);
   void           AddCacheBranch  (string key, CacheBranchI * branch);
   string         CacheBranchKey  (string k0, string k1="", string k2="") const;
 
+  //! fast look-up of cache branches through an integer id (eg a hashed key,
+  //! see Interaction::Signature()) - branches are still stored by string key
+  CacheBranchI * FindCacheBranch (ULong64_t id) const;
+  void           IndexCacheBranch(ULong64_t id, CacheBranchI * branch);
+
   //! removing cache branches
   void RmCacheBranch         (string key);
   void RmAllCacheBranches    (void);
@@ -65,12 +72,17 @@ private:
   void Load (void);
   void Save (void);
 
+  //! drop the integer ids pointing to a branch about to be removed
+  void UnIndexCacheBranch (const CacheBranchI * branch);
+
   //! singleton instance
   static Cache * fInstance;
 
   //! map of cache buffers & cache file
   map<string, CacheBranchI * > * fCacheMap;
+  map<ULong64_t, CacheBranchI *> fCacheIdx;  ///< id -> branch (owned by fCacheMap)
   TFile *                        fCacheFile;
+  bool                           fCacheReadOnly;
 
   //! singleton class: constructors are private
   Cache();
@@ -1019,7 +1019,7 @@ double genie::utils::kinematics::W(const Interaction * const interaction)
   if(process_info.IsQuasiElastic()) {
     // hadronic inv. mass is equal to the recoil nucleon on-shell mass
     int rpdgc = interaction->RecoilNucleonPdg();
-    double M = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+    double M = PDGLibrary::Instance()->Mass(rpdgc);
     return M;
   }
 
@@ -23,6 +23,9 @@
 #pragma link C++ class genie::RunOpt;
 #pragma link C++ class genie::TuneId;
 #pragma link C++ class genie::Cache;
+#pragma link C++ class genie::PhaseSpaceWeightCache;
+#pragma link C++ class genie::PhaseTimer;
+#pragma link C++ class genie::ScopeProfiler;
 #pragma link C++ class genie::CacheBranchI;
 #pragma link C++ class genie::CacheBranchNtp;
 #pragma link C++ class genie::CacheBranchFx;
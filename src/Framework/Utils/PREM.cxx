@@ -16,12 +16,32 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+
 #include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Utils/PREM.h"
 
+using std::vector;
+
+using namespace genie;
+
+namespace genie {
+namespace utils {
+namespace prem {
+  // outer radii (in km) of the model layers used in Density()
+  const int    kNLayers = 10;
+  const double kLayerRadius[kNLayers] = {
+    1221.5, 3480.0, 5701.0, 5771.0, 5971.0,
+    6151.0, 6346.6, 6356.0, 6368.0, constants::kREarth/units::km };
+
+  void FillColumnDensities(double costheta, double depth, double * cd);
+}
+}
+}
+
 //___________________________________________________________________________
 double genie::utils::prem::Density(double r)
 {
@@ -82,3 +102,142 @@ double genie::utils::prem::Density(double r)
   return rho; 
 }
 //___________________________________________________________________________
+int genie::utils::prem::NLayers(void)
+{
+  return kNLayers;
+}
+//___________________________________________________________________________
+int genie::utils::prem::Layer(double r)
+{
+  r = TMath::Max(0., r/units::km); // convert to km
+
+  for(int ilayer = 0; ilayer < kNLayers; ilayer++) {
+    if(r <= kLayerRadius[ilayer]) return ilayer;
+  }
+  return -1;
+}
+//___________________________________________________________________________
+double genie::utils::prem::LayerOuterRadius(int ilayer)
+{
+  if(ilayer < 0 || ilayer >= kNLayers) return 0.;
+  return kLayerRadius[ilayer] * units::km;
+}
+//___________________________________________________________________________
+double genie::utils::prem::ColumnDensity(
+   double costheta, double depth, int ilayer)
+{
+  double cd[kNLayers];
+  FillColumnDensities(costheta, depth, cd);
+
+  if(ilayer >= 0) {
+    return (ilayer < kNLayers) ? cd[ilayer] : 0.;
+  }
+  double sum = 0.;
+  for(int i = 0; i < kNLayers; i++) sum += cd[i];
+  return sum;
+}
+//___________________________________________________________________________
+void genie::utils::prem::FillColumnDensities(
+   double costheta, double depth, double * cd)
+{
+// Integrates the density along the ray from the detector (at radius rd)
+// to the Earth surface, separately for each layer. Along the ray the
+// radius is r(s)^2 = rd^2 + s^2 + 2*rd*s*costheta, so the layer boundaries
+// are crossed at known distances s and the density is smooth in between:
+// each such interval is integrated with Simpson's rule.
+
+  for(int i = 0; i < kNLayers; i++) cd[i] = 0.;
+
+  costheta = TMath::Max(-1., TMath::Min(1., costheta));
+
+  double rE = constants::kREarth;
+  double rd = TMath::Max(0., rE - depth);
+  double b  = rd * costheta;
+
+  // distance to the Earth surface
+  double L = -b + TMath::Sqrt(TMath::Max(0., b*b - rd*rd + rE*rE));
+  if(L <= 0.) return;
+
+  // distances where layer boundaries are crossed
+  vector<double> sb;
+  sb.push_back(0.);
+  sb.push_back(L);
+  for(int i = 0; i < kNLayers-1; i++) {
+    double rb   = kLayerRadius[i] * units::km;
+    double disc = b*b - rd*rd + rb*rb;
+    if(disc <= 0.) continue;
+    double sq = TMath::Sqrt(disc);
+    double s1 = -b - sq;
+    double s2 = -b + sq;
+    if(s1 > 0. && s1 < L) sb.push_back(s1);
+    if(s2 > 0. && s2 < L) sb.push_back(s2);
+  }
+  std::sort(sb.begin(), sb.end());
+
+  const int kNSimpson = 64; // even
+  for(unsigned int is = 0; is+1 < sb.size(); is++) {
+    double s0 = sb[is];
+    double ds = sb[is+1] - s0;
+    if(ds <= 0.) continue;
+
+    double smid = s0 + 0.5*ds;
+    double rmid = TMath::Sqrt(TMath::Max(0., rd*rd + smid*smid + 2*b*smid));
+    int ilayer = Layer(rmid);
+    if(ilayer < 0) continue;
+
+    double h   = ds/kNSimpson;
+    double sum = 0.;
+    for(int k = 0; k <= kNSimpson; k++) {
+      double s = s0 + k*h;
+      double r = TMath::Sqrt(TMath::Max(0., rd*rd + s*s + 2*b*s));
+      double w = (k == 0 || k == kNSimpson) ? 1. : ( (k%2) ? 4. : 2. );
+      sum += w * Density(r);
+    }
+    cd[ilayer] += sum * h/3.;
+  }
+}
+//___________________________________________________________________________
+genie::utils::prem::ColumnDensityTable::ColumnDensityTable(
+   double depth, int ncostheta) :
+fDepth(depth),
+fNCosTheta(TMath::Max(2, ncostheta))
+{
+  int nl = kNLayers + 1; // total + individual layers
+  fTable.resize(fNCosTheta * nl, 0.);
+
+  double cd[kNLayers];
+  for(int ic = 0; ic < fNCosTheta; ic++) {
+    double costheta = -1. + 2.*ic/(fNCosTheta-1);
+    FillColumnDensities(costheta, fDepth, cd);
+    double sum = 0.;
+    for(int il = 0; il < kNLayers; il++) {
+      fTable[ic*nl + il+1] = cd[il];
+      sum += cd[il];
+    }
+    fTable[ic*nl] = sum;
+  }
+}
+//___________________________________________________________________________
+genie::utils::prem::ColumnDensityTable::~ColumnDensityTable()
+{
+
+}
+//___________________________________________________________________________
+double genie::utils::prem::ColumnDensityTable::ColumnDensity(
+   double costheta, int ilayer) const
+{
+  if(ilayer < -1 || ilayer >= kNLayers) return 0.;
+
+  int nl = kNLayers + 1;
+
+  double x  = (TMath::Max(-1., TMath::Min(1., costheta)) + 1.) 
+              * 0.5 * (fNCosTheta-1);
+  int    ic = TMath::Min((int)x, fNCosTheta-2);
+  double f  = x - ic;
+
+  double cd0 = fTable[ ic   *nl + ilayer+1];
+  double cd1 = fTable[(ic+1)*nl + ilayer+1];
+
+  return cd0 + f*(cd1-cd0);
+}
+//___________________________________________________________________________
@@ -19,6 +19,8 @@
 #ifndef _PREM_H_
 #define _PREM_H_
 
+#include <vector>
+
 namespace genie {
 namespace utils {
 
@@ -32,6 +34,43 @@ namespace prem
   //
   double Density(double r);
 
+  //
+  // the (spherically symmetric) layers of the model, from the inner core
+  // (0) to the ocean (NLayers()-1), and the layer a given radius is in
+  // (-1 if outside the Earth)
+  //
+  int    NLayers          (void);
+  int    Layer            (double r);
+  double LayerOuterRadius (int ilayer);
+
+  //
+  // column density (integral of the density in std GENIE units) seen by a
+  // detector at the given depth below the Earth surface, along the ray
+  // towards the point on the sky with the given cos(zenith angle).
+  // Upgoing neutrinos have costheta < 0. If ilayer >= 0 then only the
+  // part of the path inside that layer is included.
+  //
+  double ColumnDensity(double costheta, double depth, int ilayer = -1);
+
+  //
+  // the column density above, tabulated at initialization in equidistant
+  // bins of cos(zenith angle) for a given detector depth and (linearly)
+  // interpolated, so that it needn't be integrated for every neutrino
+  //
+  class ColumnDensityTable {
+  public:
+    ColumnDensityTable(double depth, int ncostheta = 2000);
+   ~ColumnDensityTable();
+
+    double ColumnDensity (double costheta, int ilayer = -1) const;
+    double Depth         (void) const { return fDepth; }
+
+  private:
+    double              fDepth;     ///< detector depth (std GENIE units)
+    int                 fNCosTheta; ///< number of cos(zenith) grid points
+    std::vector<double> fTable;     ///< [icostheta*(NLayers()+1) + ilayer+1]
+  };
+
 } // prem  namespace
 } // utils namespace
 } // genie namespace
@@ -0,0 +1,207 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <sstream>
+
+#include <TMath.h>
+#include <TSystem.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/PhaseSpaceWeightCache.h"
+
+using std::ostringstream;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+ ostream & operator << (ostream & stream, const PhaseSpaceWeightCache & cache)
+ {
+   cache.Print(stream);
+   return stream;
+ }
+}
+//____________________________________________________________________________
+PhaseSpaceWeightCache * PhaseSpaceWeightCache::fInstance = 0;
+//____________________________________________________________________________
+PhaseSpaceWeightCache::PhaseSpaceWeightCache()
+{
+  fInstance  = 0;
+  fCaching   = true;
+  fWBinWidth = 0.010;
+  fNTrials   = 1000;
+  fMaxEntries = 20000;
+  fNHits      = 0;
+  fNMisses    = 0;
+  fNEvictions = 0;
+
+  // $GPHSPWTCACHE=0 switches caching off, values > 1 set the max number
+  // of cached entries
+  const char * env = gSystem->Getenv("GPHSPWTCACHE");
+  if(env) {
+    int n = atoi(env);
+    if(n <= 0) fCaching = false;
+    else if(n > 1) fMaxEntries = n;
+  }
+}
+//____________________________________________________________________________
+PhaseSpaceWeightCache::~PhaseSpaceWeightCache()
+{
+  fMaxWeights.clear();
+  fLRU.clear();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+PhaseSpaceWeightCache * PhaseSpaceWeightCache::Instance()
+{
+  if(fInstance == 0) {
+    static PhaseSpaceWeightCache::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+
+    fInstance = new PhaseSpaceWeightCache;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+double PhaseSpaceWeightCache::MaxWeight(
+  TGenPhaseSpace & gen, const TLorentzVector & p4,
+  const vector<int> & pdgv, int ntrials)
+{
+  if(!fCaching) return this->TrialMax(gen, ntrials);
+
+  string key = this->Key(p4, pdgv);
+
+  map<string, Entry_t>::iterator it = fMaxWeights.find(key);
+  if(it != fMaxWeights.end()) {
+    fNHits++;
+    if(fNHits % 100000 == 0) {
+      LOG("PhSpWtCache", pNOTICE) << *this;
+    }
+    fLRU.splice(fLRU.begin(), fLRU, it->second.lru);
+    return it->second.wmax;
+  }
+  fNMisses++;
+
+  // first decay in this W bin: throw trial decays at the input W and at the
+  // W bin edges and centre
+  unsigned int n = pdgv.size();
+  double * mass = new double[n];
+  double   mass_sum = 0;
+  for(unsigned int i = 0; i < n; i++) {
+    mass[i]   = PDGLibrary::Instance()->Mass(pdgv[i]);
+    mass_sum += mass[i];
+  }
+
+  double wmax = this->TrialMax(gen, fNTrials);
+
+  double W0 = TMath::Floor(p4.M() / fWBinWidth) * fWBinWidth;
+  for(int inode = 0; inode <= 2; inode++) {
+    double W = W0 + 0.5 * inode * fWBinWidth;
+    if(W <= mass_sum) continue;
+    TLorentzVector p4node(0., 0., 0., W);
+    if(!fScratch.SetDecay(p4node, n, mass)) continue;
+    wmax = TMath::Max(wmax, this->TrialMax(fScratch, fNTrials));
+  }
+  delete [] mass;
+
+  LOG("PhSpWtCache", pINFO)
+    << "Max phase space decay weight for " << key << ": " << wmax;
+
+  if(fMaxWeights.size() >= fMaxEntries) this->Evict();
+
+  fLRU.push_front(key);
+  Entry_t & entry = fMaxWeights[key];
+  entry.wmax = wmax;
+  entry.lru  = fLRU.begin();
+
+  return wmax;
+}
+//____________________________________________________________________________
+void PhaseSpaceWeightCache::RaiseMaxWeight(
+  const TLorentzVector & p4, const vector<int> & pdgv, double w)
+{
+  if(!fCaching) return;
+
+  map<string, Entry_t>::iterator it = fMaxWeights.find(this->Key(p4, pdgv));
+  if(it == fMaxWeights.end()) return;
+
+  if(w > it->second.wmax) {
+    LOG("PhSpWtCache", pNOTICE)
+      << "Raising max phase space decay weight for " << it->first
+      << ": " << it->second.wmax << " -> " << w;
+    it->second.wmax = w;
+  }
+}
+//____________________________________________________________________________
+void PhaseSpaceWeightCache::SetMaxEntries(unsigned int n)
+{
+  fMaxEntries = TMath::Max(n, (unsigned int) 1);
+  while(fMaxWeights.size() > fMaxEntries) this->Evict();
+}
+//____________________________________________________________________________
+void PhaseSpaceWeightCache::Reset(void)
+{
+  fMaxWeights.clear();
+  fLRU.clear();
+  fNHits      = 0;
+  fNMisses    = 0;
+  fNEvictions = 0;
+}
+//____________________________________________________________________________
+void PhaseSpaceWeightCache::Evict(void)
+{
+// Drop the least recently used entry
+
+  if(fLRU.empty()) return;
+
+  fMaxWeights.erase(fLRU.back());
+  fLRU.pop_back();
+  fNEvictions++;
+}
+//____________________________________________________________________________
+double PhaseSpaceWeightCache::HitRate(void) const
+{
+  unsigned long n = fNHits + fNMisses;
+  return (n > 0) ? (double)fNHits / n : 0.;
+}
+//____________________________________________________________________________
+void PhaseSpaceWeightCache::Print(ostream & stream) const
+{
+  stream << "Phase space weight cache: "
+         << fMaxWeights.size() << "/" << fMaxEntries << " entries, "
+         << fNHits << " hits, " << fNMisses << " misses (hit rate = "
+         << 100. * this->HitRate() << "%), " << fNEvictions << " evictions";
+}
+//____________________________________________________________________________
+string PhaseSpaceWeightCache::Key(
+  const TLorentzVector & p4, const vector<int> & pdgv) const
+{
+  ostringstream key;
+  for(unsigned int i = 0; i < pdgv.size(); i++) key << pdgv[i] << ",";
+  key << "W-bin:" << (long) TMath::Floor(p4.M() / fWBinWidth);
+  return key.str();
+}
+//____________________________________________________________________________
+double PhaseSpaceWeightCache::TrialMax(TGenPhaseSpace & gen, int ntrials) const
+{
+  double wmax = -1;
+  for(int k = 0; k < ntrials; k++) {
+     double w = gen.Generate();
+     wmax = TMath::Max(wmax, w);
+  }
+  return wmax;
+}
+//____________________________________________________________________________
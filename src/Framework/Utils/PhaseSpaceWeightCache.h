@@ -0,0 +1,136 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::PhaseSpaceWeightCache
+
+\brief    Shared cache of TGenPhaseSpace maximum decay weights, used for
+          generating unweighted phase space decays (INTRANUKE, KNO
+          hadronization).
+
+          TGenPhaseSpace weights are Lorentz invariant and depend only on
+          the ordered list of decay product masses and on the invariant mass
+          W of the decaying system. The max weight is therefore estimated
+          once per (decay product list, W bin), throwing trial decays at the
+          edges and the centre of the W bin as well as at the W of the first
+          requested decay, and reused for all later decays in that bin.
+          If a larger weight is seen later on, RaiseMaxWeight() is used to
+          update the cached value.
+          With caching switched off, MaxWeight() throws trial decays of the
+          input generator at every call, as was done before.
+          The cache holds at most MaxEntries() (decay product list, W bin)
+          entries: when full, the least recently used entry is dropped.
+          Hit, miss and eviction counts are kept and can be printed.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PHASE_SPACE_WEIGHT_CACHE_H_
+#define _PHASE_SPACE_WEIGHT_CACHE_H_
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include <TGenPhaseSpace.h>
+
+using std::list;
+using std::map;
+using std::string;
+using std::vector;
+using std::ostream;
+
+namespace genie {
+
+class PhaseSpaceWeightCache;
+ostream & operator << (ostream & stream, const PhaseSpaceWeightCache & cache);
+
+class PhaseSpaceWeightCache
+{
+public:
+
+  static PhaseSpaceWeightCache * Instance(void);
+
+  //! Max weight of decays of the system with 4-momentum p4 into the
+  //! particles pdgv. The input generator must have been set up for this
+  //! decay (SetDecay()); it is only used for throwing trial decays.
+  double MaxWeight (TGenPhaseSpace & gen, const TLorentzVector & p4,
+                    const vector<int> & pdgv, int ntrials = 200);
+
+  //! Update the cached max weight if the input decay weight is larger
+  void RaiseMaxWeight (const TLorentzVector & p4,
+                       const vector<int> & pdgv, double w);
+
+  void   SetCaching     (bool on)       { fCaching   = on;    }
+  void   SetWBinWidth   (double dw)     { fWBinWidth = dw;    } ///< GeV
+  void   SetNTrials     (int ntrials)   { fNTrials   = ntrials; } ///< per W node
+  void   SetMaxEntries  (unsigned int n);
+  bool   Caching        (void) const    { return fCaching;    }
+  unsigned int MaxEntries (void) const  { return fMaxEntries; }
+  void   Reset          (void);
+
+  //! cache statistics
+  unsigned long NHits      (void) const { return fNHits;      }
+  unsigned long NMisses    (void) const { return fNMisses;    }
+  unsigned long NEvictions (void) const { return fNEvictions; }
+  double        HitRate    (void) const;
+
+  void Print (ostream & stream) const;
+  friend ostream & operator << (ostream & stream, const PhaseSpaceWeightCache & cache);
+
+private:
+
+  //! cached max weight & position in the LRU list
+  struct Entry_t {
+    double                   wmax;
+    list<string>::iterator   lru;
+  };
+
+  void   Evict       (void);
+
+  string Key         (const TLorentzVector & p4, const vector<int> & pdgv) const;
+  double TrialMax    (TGenPhaseSpace & gen, int ntrials) const;
+
+  //! singleton instance
+  static PhaseSpaceWeightCache * fInstance;
+
+  bool                fCaching;    ///< cache max weights?
+  double              fWBinWidth;  ///< W bin width (GeV)
+  int                 fNTrials;    ///< trial decays per W node on first use
+  unsigned int        fMaxEntries; ///< max number of cached entries
+  map<string, Entry_t> fMaxWeights; ///< (product list, W bin) -> max weight
+  list<string>        fLRU;        ///< keys, most recently used first
+  TGenPhaseSpace      fScratch;    ///< generator used for the W bin nodes
+  unsigned long       fNHits;      ///< # of lookups served from the cache
+  unsigned long       fNMisses;    ///< # of lookups requiring trial decays
+  unsigned long       fNEvictions; ///< # of entries dropped from a full cache
+
+  //! singleton class: constructors are private
+  PhaseSpaceWeightCache();
+  PhaseSpaceWeightCache(const PhaseSpaceWeightCache & cache);
+  virtual ~PhaseSpaceWeightCache();
+
+  //! proper de-allocation of the singleton object
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (PhaseSpaceWeightCache::fInstance !=0) {
+            delete PhaseSpaceWeightCache::fInstance;
+            PhaseSpaceWeightCache::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+#endif // _PHASE_SPACE_WEIGHT_CACHE_H_
@@ -0,0 +1,183 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+
+#include <unistd.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "Framework/Utils/PhaseTimer.h"
+
+using std::ofstream;
+using std::endl;
+using std::setprecision;
+using std::fixed;
+
+using namespace genie;
+
+//____________________________________________________________________________
+namespace genie {
+  ostream & operator << (ostream & stream, const PhaseTimer & timer)
+  {
+    timer.Print(stream);
+    return stream;
+  }
+}
+//____________________________________________________________________________
+PhaseTimer * PhaseTimer::fInstance = 0;
+//____________________________________________________________________________
+PhaseTimer::PhaseTimer() :
+fEnabled (false),
+fThread  (pthread_self()),
+fOutFile ("")
+{
+  fInstance = 0;
+  fStart    = CurrentUsage();
+}
+//____________________________________________________________________________
+PhaseTimer::~PhaseTimer()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+PhaseTimer * PhaseTimer::Instance()
+{
+  if(fInstance == 0) {
+    static PhaseTimer::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new PhaseTimer;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void PhaseTimer::Enable(const string & outfile)
+{
+  fOutFile = outfile;
+  if(fEnabled) return;
+
+  fEnabled = true;
+  fThread  = pthread_self();
+  fStart   = CurrentUsage();
+}
+//____________________________________________________________________________
+void PhaseTimer::Begin(const string & phase)
+{
+  if(!fEnabled || !pthread_equal(fThread, pthread_self())) return;
+
+  string path = fOpen.empty() ? phase : fOpen.back().first + "/" + phase;
+
+  if(fStats.count(path) == 0) {
+    PhaseStats_t stats;
+    stats.fNCalls = 0;
+    stats.fWall   = 0.;
+    stats.fCPU    = 0.;
+    stats.fMem    = 0.;
+    fStats.insert(map<string, PhaseStats_t>::value_type(path, stats));
+    fOrder.push_back(path);
+  }
+  fOpen.push_back( pair<string,Usage_t>(path, CurrentUsage()) );
+}
+//____________________________________________________________________________
+void PhaseTimer::End(void)
+{
+  if(!fEnabled || !pthread_equal(fThread, pthread_self())) return;
+  if(fOpen.empty()) return;
+
+  Usage_t now = CurrentUsage();
+  const string  & path  = fOpen.back().first;
+  const Usage_t & start = fOpen.back().second;
+
+  map<string, PhaseStats_t>::iterator it = fStats.find(path);
+  it->second.fNCalls ++;
+  it->second.fWall += now.fWall - start.fWall;
+  it->second.fCPU  += now.fCPU  - start.fCPU;
+  it->second.fMem  += now.fMem  - start.fMem;
+
+  fOpen.pop_back();
+}
+//____________________________________________________________________________
+void PhaseTimer::Print(ostream & stream) const
+{
+  Usage_t now = CurrentUsage();
+
+  stream << "# GENIE start-up phase timing" << endl;
+  stream << "# phase\tcalls\twall_s\tcpu_s\tmem_growth_MB" << endl;
+
+  vector<string>::const_iterator it = fOrder.begin();
+  for( ; it != fOrder.end(); ++it) {
+    const PhaseStats_t & stats = fStats.find(*it)->second;
+    stream << *it << "\t" << stats.fNCalls << fixed
+           << "\t" << setprecision(3) << stats.fWall
+           << "\t" << setprecision(3) << stats.fCPU
+           << "\t" << setprecision(1) << stats.fMem << endl;
+  }
+  stream << "total" << "\t" << 1 << fixed
+         << "\t" << setprecision(3) << now.fWall - fStart.fWall
+         << "\t" << setprecision(3) << now.fCPU  - fStart.fCPU
+         << "\t" << setprecision(1) << now.fMem  - fStart.fMem << endl;
+}
+//____________________________________________________________________________
+void PhaseTimer::Save(void) const
+{
+  if(!fEnabled) return;
+
+  if(fOutFile.size() == 0 || fOutFile == "-") {
+    this->Print(std::cout);
+    return;
+  }
+  ofstream out(fOutFile.c_str());
+  if(!out.is_open()) {
+    std::cerr << "PhaseTimer: Couldn't write " << fOutFile << endl;
+    return;
+  }
+  this->Print(out);
+}
+//____________________________________________________________________________
+PhaseTimer::Usage_t PhaseTimer::CurrentUsage(void)
+{
+  Usage_t usage;
+
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  usage.fWall = tv.tv_sec + 1E-6 * tv.tv_usec;
+
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  usage.fCPU = ru.ru_utime.tv_sec + 1E-6 * ru.ru_utime.tv_usec +
+               ru.ru_stime.tv_sec + 1E-6 * ru.ru_stime.tv_usec;
+
+  // current resident set size if available (Linux), else the max one
+  // (in kB on Linux, in bytes on macOS)
+  usage.fMem = -1.;
+  FILE * statm = fopen("/proc/self/statm", "r");
+  if(statm) {
+    long size = 0, resident = 0;
+    if(fscanf(statm, "%ld %ld", &size, &resident) == 2) {
+      usage.fMem = resident * (double) sysconf(_SC_PAGESIZE) / (1024.*1024.);
+    }
+    fclose(statm);
+  }
+  if(usage.fMem < 0.) {
+#ifdef __APPLE__
+    usage.fMem = ru.ru_maxrss / (1024.*1024.);
+#else
+    usage.fMem = ru.ru_maxrss / 1024.;
+#endif
+  }
+  return usage;
+}
+//____________________________________________________________________________
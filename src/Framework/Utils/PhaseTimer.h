@@ -0,0 +1,130 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::PhaseTimer
+
+\brief    Measures the wall-clock time, CPU time and memory growth of the
+          initialization phases of GENIE applications (loading the XML
+          configuration, the splines, the hadron transport data and the
+          geometry, configuring the MC job driver etc), so that the start-up
+          of an application can be broken down.
+
+          Enabled with the --startup-timing command-line option (see RunOpt).
+          Phases are delimited by PhaseTimerGuard objects and may be nested:
+          a phase started while another one is open is reported under the
+          path outer/inner. The summary is written out at exit, as a table
+          with one line per phase (tab separated: phase path, # of calls,
+          wall time [s], CPU time [s], resident memory growth [MB]).
+          Only phases of the thread that enabled the timer are measured
+          (phases started in other threads are ignored). The CPU time
+          includes any threads running within a phase.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PHASE_TIMER_H_
+#define _PHASE_TIMER_H_
+
+#include <map>
+#include <utility>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <pthread.h>
+
+using std::map;
+using std::pair;
+using std::vector;
+using std::string;
+using std::ostream;
+
+namespace genie {
+
+class PhaseTimer;
+ostream & operator << (ostream & stream, const PhaseTimer & timer);
+
+class PhaseTimer
+{
+public:
+  static PhaseTimer * Instance (void);
+
+  //! start timing; the summary is written in outfile at exit ("-": stdout)
+  void Enable    (const string & outfile);
+  bool IsEnabled (void) const { return fEnabled; }
+
+  void Begin (const string & phase); ///< start a phase (nested in any open phase)
+  void End   (void);                 ///< end the last started phase
+
+  void Print (ostream & stream) const;
+  void Save  (void) const;           ///< write the summary in the output file
+
+  friend ostream & operator << (ostream & stream, const PhaseTimer & timer);
+
+private:
+  PhaseTimer();
+  PhaseTimer(const PhaseTimer & timer);
+  virtual ~PhaseTimer();
+
+  static PhaseTimer * fInstance;
+
+  struct Usage_t {
+    double fWall;  ///< wall-clock time [s]
+    double fCPU;   ///< user+system CPU time [s]
+    double fMem;   ///< resident memory [MB]
+  };
+  struct PhaseStats_t {
+    int    fNCalls;
+    double fWall;
+    double fCPU;
+    double fMem;
+  };
+
+  static Usage_t CurrentUsage (void);
+
+  bool                           fEnabled;
+  pthread_t                      fThread;  ///< the thread whose phases are timed
+  string                         fOutFile; ///< where the summary is written
+  Usage_t                        fStart;   ///< usage when timing was enabled
+  vector< pair<string,Usage_t> > fOpen;    ///< open phases (path, usage at start)
+  map<string, PhaseStats_t>      fStats;   ///< phase path -> accumulated usage
+  vector<string>                 fOrder;   ///< phase paths, in the order first started
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (PhaseTimer::fInstance !=0) {
+            PhaseTimer::fInstance->Save();
+            delete PhaseTimer::fInstance;
+            PhaseTimer::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+// Times the phase lasting for the lifetime of the guard (if timing is on)
+class PhaseTimerGuard
+{
+public:
+  PhaseTimerGuard(const char * phase) :
+    fOn(PhaseTimer::Instance()->IsEnabled())
+  {
+    if(fOn) PhaseTimer::Instance()->Begin(phase);
+  }
+ ~PhaseTimerGuard() { if(fOn) PhaseTimer::Instance()->End(); }
+
+private:
+  bool fOn;
+};
+
+}      // genie namespace
+
+#endif // _PHASE_TIMER_H_
@@ -12,12 +12,31 @@
  Important revisions after version 2.0.0 :
  @ Jan 29, 2013 - CA
    Added in preparartion for v2.8.0, when use of env. vars was phased out.
+ @ Oct 14, 2026 - CA
+   Added the --startup-timing option (see PhaseTimer).
+   Added the --output-compression, --output-basket-size, --output-autosave
+   and --output-autoflush options, used by NtpWriter.
+   Added the --output-writer-thread and --output-imt options.
+   Added the --output-gst and --output-gst-only options.
+   Added the --disable-event-index option.
+   Added the --output-compact-ghep option.
+   Added the --mc-job-stats-file option.
+   Added the --output-event-cost option.
+   Added the --instr-summary option (see ScopeProfiler).
+   Added the --artifact-store option (see GMCJArtifactStore).
+   Added the --xsec-bias option (see PhysInteractionSelector).
+   Added the --alt-tunes option (see NtpWriter).
+   Added the --checkpoint, --checkpoint-interval and --resume options (see
+   GMCJCheckpoint).
+   Added the --plan option (see GMCJPlanner).
+   Added the --natural-targets option (see GMCJDriver).
 
 */
 //____________________________________________________________________________
 
 #include <iostream>
 #include <cstdlib>
+#include <cctype>
 
 #include <TMath.h>
 #include <TBits.h>
@@ -25,6 +44,8 @@
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Utils/CmdLnArgParser.h"
 #include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/PhaseTimer.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Utils/SystemUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Messenger/Messenger.h"
@@ -74,6 +95,7 @@ void RunOpt::Init(void)
   fTune = 0 ;
   fEnableBareXSecPreCalc = true;
   fCacheFile = "";
+  fCacheReadOnly = false;
   fMesgThresholds = "";
   fUnphysEventMask = new TBits(GHepFlags::NFlags());
 //fUnphysEventMask->ResetAllBits(true);
@@ -81,9 +103,31 @@ void RunOpt::Init(void)
    fUnphysEventMask->SetBitNumber(i, true);
   }
   fMCJobStatusRefreshRate = 50;
+  fMCJobStatsFile         = "";
+  fArtifactStore          = "";
+  fCheckpointFile         = "";
+  fCheckpointInterval     = 10000;
+  fResume                 = false;
+  fPlanEvents             = 0;
+  fNaturalTargets         = false;
+  fXSecBias               = "";
+  fAltTunes               = "";
   fEventRecordPrintLevel  = 3;
   fEventGeneratorList     = "Default";
   fXMLPath = "";
+  fStartupTimingFile = "";
+  fInstrSummaryFile  = "";
+  fOutputCompression = -1;
+  fOutputBasketSize  = 32000;
+  fOutputAutoSave    = 200000000;
+  fOutputAutoFlush   = 0;
+  fOutputWriterQueueSize = 0;
+  fOutputIMTThreads      = 0;
+  fOutputGHEP            = true;
+  fOutputGST             = false;
+  fOutputEventIndex      = true;
+  fOutputCompactGHEP     = false;
+  fOutputEventCost       = false;
 }
 //____________________________________________________________________________
 void RunOpt::SetTuneName(string tuneName)
@@ -119,6 +163,9 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
   if( parser.OptionExists("cache-file") ) {
     fCacheFile = parser.ArgAsString("cache-file");
   }
+  if( parser.OptionExists("cache-read-only") ) {
+    fCacheReadOnly = true;
+  }
 
   if( parser.OptionExists("message-thresholds") ) {
     fMesgThresholds = parser.ArgAsString("message-thresholds");
@@ -133,6 +180,40 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
         1, parser.ArgAsInt("mc-job-status-refresh-rate"));
   }
 
+  if( parser.OptionExists("mc-job-stats-file") ) {
+    fMCJobStatsFile = parser.ArgAsString("mc-job-stats-file");
+  }
+
+  if( parser.OptionExists("artifact-store") ) {
+    fArtifactStore = parser.ArgAsString("artifact-store");
+  }
+
+  if( parser.OptionExists("checkpoint") ) {
+    fCheckpointFile = parser.ArgAsString("checkpoint");
+  }
+  if( parser.OptionExists("checkpoint-interval") ) {
+    fCheckpointInterval = TMath::Max(1L, parser.ArgAsLong("checkpoint-interval"));
+  }
+  if( parser.OptionExists("resume") ) {
+    fResume = true;
+  }
+
+  if( parser.OptionExists("plan") ) {
+    fPlanEvents = TMath::Max(1L, parser.ArgAsLong("plan"));
+  }
+
+  if( parser.OptionExists("natural-targets") ) {
+    fNaturalTargets = true;
+  }
+
+  if( parser.OptionExists("xsec-bias") ) {
+    fXSecBias = parser.ArgAsString("xsec-bias");
+  }
+
+  if( parser.OptionExists("alt-tunes") ) {
+    fAltTunes = parser.ArgAsString("alt-tunes");
+  }
+
   if( parser.OptionExists("event-generator-list") ) {
     SetEventGeneratorList(parser.ArgAsString("event-generator-list"));
   }
@@ -141,6 +222,63 @@ void RunOpt::ReadFromCommandLine(int argc, char ** argv)
     fXMLPath = parser.ArgAsString("xml-path");
   }
 
+  // time the initialization phases from now on
+  if( parser.OptionExists("startup-timing") ) {
+    fStartupTimingFile = parser.ArgAsString("startup-timing");
+    if(fStartupTimingFile.size() == 0) fStartupTimingFile = "-";
+    PhaseTimer::Instance()->Enable(fStartupTimingFile);
+  }
+  if( parser.OptionExists("instr-summary") ) {
+    fInstrSummaryFile = parser.ArgAsString("instr-summary");
+#ifdef __GENIE_INSTRUMENTATION_ENABLED__
+    ScopeProfiler::Instance()->SetOutputFile(fInstrSummaryFile);
+#else
+    LOG("RunOpt", pWARN)
+      << "GENIE was built without --enable-instrumentation: "
+      << "No instrumentation summary will be written";
+#endif
+  }
+
+  if( parser.OptionExists("output-compression") ) {
+    fOutputCompression =
+       this->ParseCompressionSetting(parser.ArgAsString("output-compression"));
+  }
+  if( parser.OptionExists("output-basket-size") ) {
+    fOutputBasketSize = TMath::Max(
+        1000, parser.ArgAsInt("output-basket-size"));
+  }
+  if( parser.OptionExists("output-autosave") ) {
+    fOutputAutoSave = parser.ArgAsLong("output-autosave");
+  }
+  if( parser.OptionExists("output-autoflush") ) {
+    fOutputAutoFlush = parser.ArgAsLong("output-autoflush");
+  }
+  // the queue size is optional
+  if( parser.OptionExists("output-writer-thread") ) {
+    string qsize = parser.ArgAsString("output-writer-thread");
+    fOutputWriterQueueSize = (qsize.size() > 0) ?
+        TMath::Max(1, atoi(qsize.c_str())) : 8;
+  }
+  if( parser.OptionExists("output-gst") ) {
+    fOutputGST = true;
+  }
+  if( parser.OptionExists("output-gst-only") ) {
+    fOutputGST  = true;
+    fOutputGHEP = false;
+  }
+  if( parser.OptionExists("disable-event-index") ) {
+    fOutputEventIndex = false;
+  }
+  if( parser.OptionExists("output-compact-ghep") ) {
+    fOutputCompactGHEP = true;
+  }
+  if( parser.OptionExists("output-event-cost") ) {
+    fOutputEventCost = true;
+  }
+  if( parser.OptionExists("output-imt") ) {
+    fOutputIMTThreads = TMath::Max(0, parser.ArgAsInt("output-imt"));
+  }
+
   if( parser.OptionExists("tune") ) {
     SetTuneName( parser.ArgAsString("tune") ) ;
   }
@@ -168,20 +306,110 @@ void RunOpt::Print(ostream & stream) const
   if ( fTune ) stream << "\n GENIE tune: " << *fTune;
   stream << "\n Event generator list: " << fEventGeneratorList;
   stream << "\n User-specified message thresholds : " << fMesgThresholds;
-  stream << "\n Cache file : " << fCacheFile;
+  stream << "\n Cache file : " << fCacheFile
+         << (fCacheReadOnly ? " (read-only)" : "");
   stream << "\n Unphysical event mask (bits: "
          << GHepFlags::NFlags()-1 << " -> 0) : " << *fUnphysEventMask;
   stream << "\n Event record print level : " << fEventRecordPrintLevel;
   stream << "\n MC job status file refresh rate: " << fMCJobStatusRefreshRate;
+  if (fMCJobStatsFile.size() > 0) {
+    stream << "\n MC job statistics file: " << fMCJobStatsFile;
+  }
+  if (fArtifactStore.size() > 0) {
+    stream << "\n MC job artifact store: " << fArtifactStore;
+  }
+  if (fCheckpointFile.size() > 0) {
+    stream << "\n MC job checkpoint file: " << fCheckpointFile
+           << " (every " << fCheckpointInterval << " events)"
+           << (fResume ? " - resuming" : "");
+  }
+  if (fPlanEvents > 0) {
+    stream << "\n MC job planning dry run: " << fPlanEvents << " events";
+  }
+  if (fNaturalTargets) {
+    stream << "\n Natural elements collapsed into single targets";
+  }
+  if (fXSecBias.size() > 0) {
+    stream << "\n Process biasing: " << fXSecBias;
+  }
+  if (fAltTunes.size() > 0) {
+    stream << "\n Alternate tunes weighted: " << fAltTunes;
+  }
   stream << "\n Pre-calculate all free-nucleon cross-sections? : "
          << ((fEnableBareXSecPreCalc) ? "Yes" : "No");
 
   if (fXMLPath.size()) {
     stream << "\n XMLPath over-ride : "<<fXMLPath;
   }
+  if (fInstrSummaryFile.size()) {
+    stream << "\n Instrumentation folded stacks : " << fInstrSummaryFile;
+  }
+  if (fStartupTimingFile.size()) {
+    stream << "\n Start-up phase timing summary : "<<fStartupTimingFile;
+  }
+  stream << "\n Output compression setting : ";
+  if (fOutputCompression < 0) stream << "ROOT default";
+  else                        stream << fOutputCompression;
+  stream << "\n Output basket size : " << fOutputBasketSize;
+  stream << "\n Output autosave : " << fOutputAutoSave;
+  stream << "\n Output autoflush : ";
+  if (fOutputAutoFlush == 0) stream << "ROOT default";
+  else                       stream << fOutputAutoFlush;
+  stream << "\n Output writer thread : ";
+  if (fOutputWriterQueueSize > 0) stream << "Yes (queue size: " << fOutputWriterQueueSize << ")";
+  else                            stream << "No";
+  stream << "\n Output event trees : "
+         << (fOutputGHEP ? "GHEP " : "") << (fOutputGST ? "gst" : "");
+  stream << "\n Write the event index tree? : "
+         << ((fOutputEventIndex) ? "Yes" : "No");
+  stream << "\n Write compact GHEP event records? : "
+         << ((fOutputCompactGHEP) ? "Yes" : "No");
+  stream << "\n Write the event generation cost (gcost)? : "
+         << ((fOutputEventCost) ? "Yes" : "No");
+  if (fOutputIMTThreads > 0) {
+    stream << "\n ROOT implicit multi-threading threads : " << fOutputIMTThreads;
+  }
 
   stream << "\n";
 }
 //___________________________________________________________________________
+int RunOpt::ParseCompressionSetting(string setting) const
+{
+// Converts a compression option, given as algorithm[:level] (algorithm: zlib,
+// lzma, lz4 or zstd) or directly as a ROOT compression setting number
+// (100*algorithm+level), to a ROOT compression setting
+
+  string alg   = setting;
+  int    level = -1;
+  string::size_type ipos = setting.find(':');
+  if(ipos != string::npos) {
+    alg   = setting.substr(0,ipos);
+    level = atoi(setting.substr(ipos+1).c_str());
+  }
+  for(unsigned int i = 0; i < alg.size(); i++) alg[i] = tolower(alg[i]);
+
+  // algorithm codes and default levels as in ROOT::RCompressionSetting
+  int code = 0;
+  int deflevel = 0;
+  if      (alg == "zlib") { code = 1; deflevel = 1; }
+  else if (alg == "lzma") { code = 2; deflevel = 7; }
+  else if (alg == "lz4" ) { code = 4; deflevel = 4; }
+  else if (alg == "zstd") { code = 5; deflevel = 5; }
+  else if (alg.size() > 0 && alg.find_first_not_of("0123456789") == string::npos) {
+    return atoi(alg.c_str());
+  }
+  else {
+    LOG("RunOpt",pFATAL)
+      << "Unknown output compression algorithm: " << alg
+      << " (use zlib, lzma, lz4 or zstd)";
+    exit(1);
+  }
+
+  if(level < 0) level = deflevel;
+  level = TMath::Min(9, level);
+
+  return 100*code + level;
+}
+//___________________________________________________________________________
 
 } // genie namespace
@@ -45,12 +45,35 @@ public:
   TuneId * Tune                 (void) const { return fTune;                   }
   string EventGeneratorList     (void) const { return fEventGeneratorList;     }
   string CacheFile              (void) const { return fCacheFile;              }
+  bool   CacheReadOnly          (void) const { return fCacheReadOnly;          }
   string MesgThresholdFiles     (void) const { return fMesgThresholds;         }
   TBits* UnphysEventMask        (void) const { return fUnphysEventMask;        }
   int    EventRecordPrintLevel  (void) const { return fEventRecordPrintLevel;  }
   int    MCJobStatusRefreshRate (void) const { return fMCJobStatusRefreshRate; }
+  string MCJobStatsFile         (void) const { return fMCJobStatsFile;         }
+  string ArtifactStore          (void) const { return fArtifactStore;          }
+  string CheckpointFile         (void) const { return fCheckpointFile;         }
+  long   CheckpointInterval     (void) const { return fCheckpointInterval;     }
+  bool   Resume                 (void) const { return fResume;                 }
+  long   PlanEvents             (void) const { return fPlanEvents;             }
+  bool   NaturalTargets         (void) const { return fNaturalTargets;         }
+  string XSecBias               (void) const { return fXSecBias;               }
+  string AltTunes               (void) const { return fAltTunes;               }
   bool   BareXSecPreCalc        (void) const { return fEnableBareXSecPreCalc;  }
   string XMLPath                (void) const { return fXMLPath;  }
+  string StartupTimingFile      (void) const { return fStartupTimingFile; }
+  string InstrSummaryFile       (void) const { return fInstrSummaryFile;  }
+  int    OutputCompression      (void) const { return fOutputCompression; }
+  int    OutputBasketSize       (void) const { return fOutputBasketSize;  }
+  long   OutputAutoSave         (void) const { return fOutputAutoSave;    }
+  long   OutputAutoFlush        (void) const { return fOutputAutoFlush;   }
+  int    OutputWriterQueueSize  (void) const { return fOutputWriterQueueSize; }
+  int    OutputIMTThreads       (void) const { return fOutputIMTThreads;  }
+  bool   OutputGHEP             (void) const { return fOutputGHEP;        }
+  bool   OutputGST              (void) const { return fOutputGST;         }
+  bool   OutputEventIndex       (void) const { return fOutputEventIndex;  }
+  bool   OutputCompactGHEP      (void) const { return fOutputCompactGHEP; }
+  bool   OutputEventCost        (void) const { return fOutputEventCost;   }
 
   // If a user accesses the GENIE objects directly, then most of the options above
   // can be set directly to the relevant objects (Messenger, Cache, etc).
@@ -66,19 +89,43 @@ public:
 
 private:
 
-  void Init (void);
+  void Init                   (void);
+  int  ParseCompressionSetting (string setting) const;
 
   // options
   TuneId * fTune;                    ///< GENIE comprehensive neutrino interaction model tune.
   string fEventGeneratorList;        ///< Name of event generator list to be loaded by the event generation drivers.
   string fCacheFile;                 ///< Name of cache file, is cache is to be re-used.
+  bool   fCacheReadOnly;             ///< Use the cache file as a read-only warm-start store?
   string fMesgThresholds;            ///< List of files (delimited with : if more than one) with custom mesg stream thresholds.
   TBits* fUnphysEventMask;           ///< Unphysical event mask.
   int    fEventRecordPrintLevel;     ///< GHEP event r ecord print level.
   int    fMCJobStatusRefreshRate;    ///< MC job status file refresh rate.
+  string fMCJobStatsFile;            ///< MC job statistics (JSON) file, written by GMCJMonitor. None if empty.
+  string fArtifactStore;             ///< Directory of the GMCJDriver init-time artifacts store (see GMCJArtifactStore). None if empty.
+  string fCheckpointFile;            ///< MC job checkpoint file (see GMCJCheckpoint). No checkpoints if empty.
+  long   fCheckpointInterval;        ///< # of generated events between MC job checkpoints.
+  bool   fResume;                    ///< Resume an interrupted MC job from its checkpoint file?
+  long   fPlanEvents;                ///< # of events of a job-planning dry run (see GMCJPlanner). No dry run if 0.
+  bool   fNaturalTargets;            ///< Collapse the isotopes of natural elements into a single target? (see GMCJDriver)
+  string fXSecBias;                  ///< Process biasing of the interaction selection, as <selector>:<factor>,... (see PhysInteractionSelector). None if empty.
+  string fAltTunes;                  ///< Comma separated alternate tunes to write event weights for (see NtpWriter). None if empty.
   bool   fEnableBareXSecPreCalc;     ///< Cache calcs relevant to free-nucleon xsecs before any nuclear xsec computation?
                                      ///< The option switches on/off cacheing calculations which interfere with event reweighting.
   string fXMLPath;                   ///< An path to look for XML in. Higher priority than GXMLPATH
+  string fStartupTimingFile;         ///< Output file for the start-up phase timing summary (see PhaseTimer). Timing is off if empty.
+  string fInstrSummaryFile;          ///< Output file for the folded stacks of the instrumented builds (see ScopeProfiler).
+  int    fOutputCompression;         ///< ROOT compression setting (100*algorithm+level) of the output event trees. ROOT default if < 0.
+  int    fOutputBasketSize;          ///< Basket size (bytes) of the output event branches.
+  long   fOutputAutoSave;            ///< Output event tree autosave setting, as in TTree::SetAutoSave() (>0: entries, <0: bytes).
+  long   fOutputAutoFlush;           ///< Output event tree autoflush setting, as in TTree::SetAutoFlush() (>0: entries, <0: bytes). ROOT default if 0.
+  int    fOutputWriterQueueSize;     ///< Max # of events queued for the output tree writer thread (see NtpWriter). No writer thread if 0.
+  int    fOutputIMTThreads;          ///< # of threads for ROOT's implicit multi-threading (parallel basket compression). Off if 0.
+  bool   fOutputGHEP;                ///< Write the GHEP event tree in the output event file?
+  bool   fOutputGST;                 ///< Write the GENIE summary tree (gst) in the output event file?
+  bool   fOutputEventIndex;          ///< Write the event index tree (gidx) next to the GHEP event tree?
+  bool   fOutputCompactGHEP;         ///< Write the GHEP particles in compact form (see GHepParticle)?
+  bool   fOutputEventCost;           ///< Write the per-event generation cost (see GHepEventCost) in a gcost branch of the GHEP event tree?
 
   // Self
   static RunOpt * fInstance;
@@ -0,0 +1,367 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <ctime>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <new>
+
+#include "Framework/Utils/ScopeProfiler.h"
+
+#ifdef __GENIE_ITT_ENABLED__
+#include <ittnotify.h>
+#endif
+#ifdef __GENIE_SDT_ENABLED__
+#include <sys/sdt.h>
+#endif
+
+using std::ofstream;
+using std::endl;
+using std::setw;
+using std::setprecision;
+using std::fixed;
+
+using namespace genie;
+
+//____________________________________________________________________________
+// Heap allocations made by the calling thread so far (counted only if the
+// global operator new is replaced, see below)
+static __thread long gNAllocs    = 0;
+static __thread long gAllocBytes = 0;
+
+#ifdef __GENIE_ALLOC_TRACKING_ENABLED__
+static void * CountedAlloc(std::size_t size)
+{
+  gNAllocs++;
+  gAllocBytes += size;
+  void * p = std::malloc(size ? size : 1);
+  if(!p) throw std::bad_alloc();
+  return p;
+}
+void * operator new   (std::size_t size) { return CountedAlloc(size); }
+void * operator new[] (std::size_t size) { return CountedAlloc(size); }
+void * operator new   (std::size_t size, const std::nothrow_t &) throw()
+{
+  gNAllocs++;
+  gAllocBytes += size;
+  return std::malloc(size ? size : 1);
+}
+void * operator new[] (std::size_t size, const std::nothrow_t & nt) throw()
+{
+  return operator new(size, nt);
+}
+void operator delete   (void * p) throw() { std::free(p); }
+void operator delete[] (void * p) throw() { std::free(p); }
+void operator delete   (void * p, const std::nothrow_t &) throw() { std::free(p); }
+void operator delete[] (void * p, const std::nothrow_t &) throw() { std::free(p); }
+#endif
+
+//____________________________________________________________________________
+ScopeProfiler * ScopeProfiler::fInstance = 0;
+//____________________________________________________________________________
+ScopeProfiler::ScopeProfiler() :
+fThread    (pthread_self()),
+fNEvents   (0),
+fOutFile   (""),
+fIttDomain (0)
+{
+  fInstance = 0;
+  pthread_mutex_init(&fMutex, 0);
+#ifdef __GENIE_ITT_ENABLED__
+  fIttDomain = __itt_domain_create("GENIE");
+#endif
+}
+//____________________________________________________________________________
+ScopeProfiler::~ScopeProfiler()
+{
+  vector<InstrLabel_t *>::iterator it = fLabels.begin();
+  for( ; it != fLabels.end(); ++it) delete *it;
+  fLabels.clear();
+
+  pthread_mutex_destroy(&fMutex);
+  fInstance = 0;
+}
+//____________________________________________________________________________
+ScopeProfiler * ScopeProfiler::Instance()
+{
+  if(fInstance == 0) {
+    static ScopeProfiler::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+    fInstance = new ScopeProfiler;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+const InstrLabel_t * ScopeProfiler::Label(const string & name)
+{
+  pthread_mutex_lock(&fMutex);
+  const InstrLabel_t * label = 0;
+  map<string, const InstrLabel_t *>::const_iterator it = fNameLabels.find(name);
+  if(it != fNameLabels.end()) {
+    label = it->second;
+  } else {
+    label = this->NewLabel(name);
+    fNameLabels.insert(map<string, const InstrLabel_t *>::value_type(name, label));
+  }
+  pthread_mutex_unlock(&fMutex);
+  return label;
+}
+//____________________________________________________________________________
+const InstrLabel_t * ScopeProfiler::FindLabel(const void * key)
+{
+  pthread_mutex_lock(&fMutex);
+  const InstrLabel_t * label = 0;
+  map<const void *, const InstrLabel_t *>::const_iterator it = fAlgLabels.find(key);
+  if(it != fAlgLabels.end()) label = it->second;
+  pthread_mutex_unlock(&fMutex);
+  return label;
+}
+//____________________________________________________________________________
+const InstrLabel_t * ScopeProfiler::AddLabel(
+  const void * key, const string & name)
+{
+// Algorithms are looked up by address; algorithms of the same AlgId (e.g.
+// an algorithm that was deleted and recreated) share a label
+
+  const InstrLabel_t * label = this->Label(name);
+  pthread_mutex_lock(&fMutex);
+  fAlgLabels[key] = label;
+  pthread_mutex_unlock(&fMutex);
+  return label;
+}
+//____________________________________________________________________________
+const InstrLabel_t * ScopeProfiler::NewLabel(const string & name)
+{
+  InstrLabel_t * label = new InstrLabel_t;
+  label->fId        = fLabels.size();
+  label->fName      = name;
+  label->fIttHandle = 0;
+#ifdef __GENIE_ITT_ENABLED__
+  label->fIttHandle = __itt_string_handle_create(name.c_str());
+#endif
+  fLabels.push_back(label);
+  return label;
+}
+//____________________________________________________________________________
+bool ScopeProfiler::Begin(const InstrLabel_t * label)
+{
+  if(!pthread_equal(fThread, pthread_self())) return false;
+
+  int parent = fOpen.empty() ? -1 : fOpen.back().fNode;
+  pair<int,int> key(parent, label->fId);
+
+  int node = 0;
+  map<pair<int,int>, int>::const_iterator it = fNodeIndex.find(key);
+  if(it != fNodeIndex.end()) {
+    node = it->second;
+  } else {
+    Node_t n;
+    n.fLabel  = label->fId;
+    n.fParent = parent;
+    n.fNCalls = 0;
+    n.fTime   = 0.;
+    n.fChild  = 0.;
+    n.fNAllocs         = 0;
+    n.fChildNAllocs    = 0;
+    n.fAllocBytes      = 0;
+    n.fChildAllocBytes = 0;
+    node = fNodes.size();
+    fNodes.push_back(n);
+    fNodeIndex.insert(map<pair<int,int>, int>::value_type(key, node));
+  }
+  OpenScope_t scope;
+  scope.fNode       = node;
+  scope.fNAllocs    = gNAllocs;
+  scope.fAllocBytes = gAllocBytes;
+  scope.fStart      = Now();
+  fOpen.push_back(scope);
+  return true;
+}
+//____________________________________________________________________________
+void ScopeProfiler::End(void)
+{
+  if(fOpen.empty()) return;
+
+  const OpenScope_t & scope = fOpen.back();
+  double dt     = Now() - scope.fStart;
+  long   nalloc = gNAllocs    - scope.fNAllocs;
+  long   nbytes = gAllocBytes - scope.fAllocBytes;
+
+  Node_t & n = fNodes[scope.fNode];
+  n.fNCalls++;
+  n.fTime       += dt;
+  n.fNAllocs    += nalloc;
+  n.fAllocBytes += nbytes;
+  if(n.fParent >= 0) {
+    Node_t & parent = fNodes[n.fParent];
+    parent.fChild           += dt;
+    parent.fChildNAllocs    += nalloc;
+    parent.fChildAllocBytes += nbytes;
+  }
+  fOpen.pop_back();
+}
+//____________________________________________________________________________
+string ScopeProfiler::Path(int node) const
+{
+  string path = fLabels[fNodes[node].fLabel]->fName;
+  for(int p = fNodes[node].fParent; p >= 0; p = fNodes[p].fParent) {
+    path = fLabels[fNodes[p].fLabel]->fName + ";" + path;
+  }
+  return path;
+}
+//____________________________________________________________________________
+void ScopeProfiler::Print(ostream & stream) const
+{
+  double total = 0.;
+  for(unsigned int i = 0; i < fNodes.size(); i++) {
+    if(fNodes[i].fParent < 0) total += fNodes[i].fTime;
+  }
+
+  stream << "# GENIE instrumented call tree" << endl;
+  stream << "#  incl_s incl_%   self_s     calls  scope" << endl;
+  for(unsigned int i = 0; i < fNodes.size(); i++) {
+    if(fNodes[i].fParent < 0) this->PrintNode(stream, i, 0, total);
+  }
+}
+//____________________________________________________________________________
+void ScopeProfiler::PrintNode(
+  ostream & stream, int node, int depth, double total) const
+{
+// Prints the node and, recursively, its children, skipping call paths with
+// less than 0.1% of the total time
+
+  const Node_t & n = fNodes[node];
+  double frac = (total > 0.) ? n.fTime / total : 0.;
+  if(frac < 1E-3) return;
+
+  stream << fixed
+         << setw(9) << setprecision(3) << 1E-9 * n.fTime
+         << setw(7) << setprecision(1) << 100. * frac
+         << setw(9) << setprecision(3) << 1E-9 * (n.fTime - n.fChild)
+         << setw(10) << n.fNCalls << "  "
+         << string(2*depth, ' ') << fLabels[n.fLabel]->fName << endl;
+
+  for(unsigned int i = node+1; i < fNodes.size(); i++) {
+    if(fNodes[i].fParent == node) this->PrintNode(stream, i, depth+1, total);
+  }
+}
+//____________________________________________________________________________
+void ScopeProfiler::PrintFolded(ostream & stream) const
+{
+  for(unsigned int i = 0; i < fNodes.size(); i++) {
+    long self_us = (long) (1E-3 * (fNodes[i].fTime - fNodes[i].fChild));
+    if(self_us <= 0) continue;
+    stream << this->Path(i) << " " << self_us << endl;
+  }
+}
+//____________________________________________________________________________
+void ScopeProfiler::PrintAllocs(ostream & stream) const
+{
+// Prints the scopes (summed over call paths) that made the most heap
+// allocations themselves, i.e. not in instrumented sub-scopes
+
+  vector<long> nallocs(fLabels.size(), 0);
+  vector<long> nbytes (fLabels.size(), 0);
+  long total = 0;
+  for(unsigned int i = 0; i < fNodes.size(); i++) {
+    const Node_t & n = fNodes[i];
+    nallocs[n.fLabel] += n.fNAllocs    - n.fChildNAllocs;
+    nbytes [n.fLabel] += n.fAllocBytes - n.fChildAllocBytes;
+    total             += n.fNAllocs    - n.fChildNAllocs;
+  }
+  vector< pair<long,int> > order;
+  for(unsigned int il = 0; il < fLabels.size(); il++) {
+    if(nallocs[il] > 0) order.push_back(pair<long,int>(nallocs[il], il));
+  }
+  std::sort(order.rbegin(), order.rend());
+
+  double norm = (fNEvents > 0) ? 1000. / fNEvents : 1.;
+
+  stream << "# GENIE top heap allocating scopes, per "
+         << ((fNEvents > 0) ? "1k events" : "job")
+         << " (" << fNEvents << " events)" << endl;
+  stream << "#     allocs       kbytes  share  scope" << endl;
+  for(unsigned int i = 0; i < order.size() && i < 20; i++) {
+    int il = order[i].second;
+    stream << fixed << setprecision(0)
+           << setw(12) << norm * nallocs[il]
+           << setw(13) << norm * nbytes[il] / 1024.
+           << setw(6)  << setprecision(1)
+           << ((total > 0) ? 100. * nallocs[il] / total : 0.) << "%"
+           << "  " << fLabels[il]->fName << endl;
+  }
+}
+//____________________________________________________________________________
+void ScopeProfiler::Save(void) const
+{
+  if(fNodes.empty()) return;
+
+  this->Print(std::cout);
+#ifdef __GENIE_ALLOC_TRACKING_ENABLED__
+  this->PrintAllocs(std::cout);
+#endif
+
+  if(fOutFile.size() == 0) return;
+  ofstream out(fOutFile.c_str());
+  if(!out.is_open()) {
+    std::cerr << "ScopeProfiler: Couldn't write " << fOutFile << endl;
+    return;
+  }
+  this->PrintFolded(out);
+}
+//____________________________________________________________________________
+double ScopeProfiler::Now(void)
+{
+  timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return 1E9 * t.tv_sec + t.tv_nsec;
+}
+//____________________________________________________________________________
+InstrScope::InstrScope(const InstrLabel_t * label) :
+fLabel(label),
+fRecorded(false)
+{
+#ifdef __GENIE_ITT_ENABLED__
+  __itt_task_begin(
+    (__itt_domain *) ScopeProfiler::Instance()->IttDomain(),
+    __itt_null, __itt_null, (__itt_string_handle *) fLabel->fIttHandle);
+#endif
+#ifdef __GENIE_TRACY_ENABLED__
+  TracyCZoneN(zone, "GENIE", 1);
+  TracyCZoneName(zone, fLabel->fName.c_str(), fLabel->fName.size());
+  fZone = zone;
+#endif
+#ifdef __GENIE_SDT_ENABLED__
+  DTRACE_PROBE1(genie, scope_begin, fLabel->fName.c_str());
+#endif
+  fRecorded = ScopeProfiler::Instance()->Begin(fLabel);
+}
+//____________________________________________________________________________
+InstrScope::~InstrScope()
+{
+  if(fRecorded) ScopeProfiler::Instance()->End();
+#ifdef __GENIE_SDT_ENABLED__
+  DTRACE_PROBE1(genie, scope_end, fLabel->fName.c_str());
+#endif
+#ifdef __GENIE_TRACY_ENABLED__
+  TracyCZoneEnd(fZone);
+#endif
+#ifdef __GENIE_ITT_ENABLED__
+  __itt_task_end((__itt_domain *) ScopeProfiler::Instance()->IttDomain());
+#endif
+}
+//____________________________________________________________________________
@@ -0,0 +1,202 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::ScopeProfiler
+
+\brief    Optional instrumentation of the main GENIE call chains (event
+          generation modules, cross section algorithms and integrators,
+          flux and geometry drivers), for profiling runs.
+
+          Compiled in only with ./configure --enable-instrumentation
+          (__GENIE_INSTRUMENTATION_ENABLED__ in GBuild.h); otherwise the
+          GINSTR_* macros expand to nothing. Each instrumented call is a
+          scope (see InstrScope) labelled with the AlgId of the algorithm
+          doing the work, so that the samples of an external profiler can
+          be mapped onto GENIE's virtual algorithm chains:
+
+          - with Intel ITT (--with-ittnotify-inc/-lib), scopes are ITT tasks
+            of the "GENIE" domain, seen by VTune and other ITT collectors;
+          - with Tracy (--with-tracy-inc/-lib), scopes are named Tracy zones;
+          - if sys/sdt.h is available, scopes fire the genie:scope_begin and
+            genie:scope_end USDT probes (label as argument), which can be
+            recorded by perf (perf probe sdt_genie:scope_begin etc).
+
+          The scopes of the thread that first used the profiler are also
+          accumulated in a call tree, printed at job end as a flame-style
+          summary (inclusive and self time, # of calls per call path). The
+          tree can also be written as folded stacks, one "a;b;c self_us"
+          line per call path, that flamegraph.pl reads directly (see the
+          --instr-summary option in RunOpt).
+
+          With ./configure --enable-alloc-tracking (which also enables the
+          instrumentation) the global operator new is replaced by one that
+          counts the heap allocations of each thread, and the allocations
+          (number and bytes) made within each scope are accumulated in the
+          call tree too. The job-end summary then also lists the scopes that
+          allocate the most, per 1k generated events (see GINSTR_COUNT_EVENT).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _SCOPE_PROFILER_H_
+#define _SCOPE_PROFILER_H_
+
+#include <map>
+#include <utility>
+#include <vector>
+#include <string>
+#include <ostream>
+#include <pthread.h>
+
+#include "Framework/Conventions/GBuild.h"
+
+#ifdef __GENIE_TRACY_ENABLED__
+#include <tracy/TracyC.h>
+#endif
+
+using std::map;
+using std::pair;
+using std::vector;
+using std::string;
+using std::ostream;
+
+#ifdef __GENIE_INSTRUMENTATION_ENABLED__
+#define GINSTR_SCOPE(name) \
+   static const genie::InstrLabel_t * _ginstr_label_ = \
+         genie::ScopeProfiler::Instance()->Label(name); \
+   genie::InstrScope _ginstr_scope_(_ginstr_label_)
+#define GINSTR_ALG_SCOPE(alg) \
+   genie::InstrScope _ginstr_scope_(genie::ScopeProfiler::Instance()->AlgLabel(alg))
+#define GINSTR_COUNT_EVENT() \
+   genie::ScopeProfiler::Instance()->CountEvent()
+#else
+#define GINSTR_SCOPE(name)
+#define GINSTR_ALG_SCOPE(alg)
+#define GINSTR_COUNT_EVENT()
+#endif
+
+namespace genie {
+
+struct InstrLabel_t {
+  int    fId;
+  string fName;
+  void * fIttHandle; ///< ITT string handle, if ITT is enabled
+};
+
+class ScopeProfiler {
+
+public:
+  static ScopeProfiler * Instance (void);
+
+  //! label of a named scope (created if needed)
+  const InstrLabel_t * Label (const string & name);
+
+  //! label of a scope doing the work of an algorithm: its AlgId key
+  template<class T> const InstrLabel_t * AlgLabel (const T * alg) {
+    if(!alg) return this->Label("unknown");
+    const InstrLabel_t * label = this->FindLabel(alg);
+    return (label) ? label : this->AddLabel(alg, alg->Id().Key());
+  }
+
+  //! write the folded stacks at job end in the named file
+  void SetOutputFile (const string & filename) { fOutFile = filename; }
+
+  //! count a generated event (for the allocations per 1k events)
+  void CountEvent (void) { fNEvents++; }
+
+  //! used by InstrScope for the call tree (false if not recorded)
+  bool Begin (const InstrLabel_t * label);
+  void End   (void);
+
+  void Print       (ostream & stream) const; ///< print the call tree summary
+  void PrintFolded (ostream & stream) const; ///< print the folded stacks
+  void PrintAllocs (ostream & stream) const; ///< print the top allocating scopes
+  void Save        (void) const;
+
+  void * IttDomain (void) const { return fIttDomain; }
+
+private:
+  ScopeProfiler();
+  ScopeProfiler(const ScopeProfiler & prof);
+  virtual ~ScopeProfiler();
+
+  static ScopeProfiler * fInstance;
+
+  struct Node_t {
+    int    fLabel;   ///< label id
+    int    fParent;  ///< parent node (-1 for the roots)
+    long   fNCalls;
+    double fTime;    ///< inclusive time [ns]
+    double fChild;   ///< time of the child nodes [ns]
+    long   fNAllocs;       ///< inclusive # of heap allocations
+    long   fChildNAllocs;  ///< allocations of the child nodes
+    long   fAllocBytes;    ///< inclusive allocated bytes
+    long   fChildAllocBytes;
+  };
+  struct OpenScope_t {
+    int    fNode;
+    double fStart;       ///< time at start [ns]
+    long   fNAllocs;     ///< allocation counters at start
+    long   fAllocBytes;
+  };
+
+  const InstrLabel_t * FindLabel (const void * key);
+  const InstrLabel_t * AddLabel  (const void * key, const string & name);
+  const InstrLabel_t * NewLabel  (const string & name);
+
+  string Path        (int node) const;
+  void   PrintNode   (ostream & stream, int node, int depth, double total) const;
+
+  static double Now (void);
+
+  pthread_mutex_t                      fMutex;      ///< guards the labels
+  pthread_t                            fThread;     ///< thread whose scopes are recorded in the call tree
+  vector<InstrLabel_t *>               fLabels;
+  map<string,      const InstrLabel_t*> fNameLabels;
+  map<const void*, const InstrLabel_t*> fAlgLabels;
+  vector<Node_t>                       fNodes;
+  map<pair<int,int>, int>              fNodeIndex;  ///< (parent node, label id) -> node
+  vector<OpenScope_t>                  fOpen;       ///< open scopes
+  long                                 fNEvents;    ///< # of generated events
+  string                               fOutFile;    ///< where the folded stacks are written
+  void *                               fIttDomain;
+
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (ScopeProfiler::fInstance !=0) {
+            ScopeProfiler::fInstance->Save();
+            delete ScopeProfiler::fInstance;
+            ScopeProfiler::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+// An instrumented scope, lasting for the lifetime of the object
+class InstrScope
+{
+public:
+  InstrScope(const InstrLabel_t * label);
+ ~InstrScope();
+
+private:
+  const InstrLabel_t * fLabel;
+  bool                 fRecorded;
+#ifdef __GENIE_TRACY_ENABLED__
+  TracyCZoneCtx        fZone;
+#endif
+};
+
+}      // genie namespace
+
+#endif // _SCOPE_PROFILER_H_
@@ -14,13 +14,24 @@
    That file was added in 2.5.1
  @ Apr 20, 2012 - CA
    Added LocalTimeAsString(string format) to tag validation program outputs.
+ @ Oct 14, 2026 - CA
+   Added ForkWorkers(), to split event generation among worker processes
+   forked once the job is initialized.
+ @ Oct 14, 2026 - CA
+   Added SharedDataDir(), the node-local directory of the shared data tables.
 
 */
 //____________________________________________________________________________
 
+#include <cerrno>
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
+#include <iostream>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include <dirent.h>
 #include <ctime>
@@ -164,3 +175,65 @@ string genie::utils::system::LocalTimeAsString(string format)
   return local_time_as_string;
 }
 //___________________________________________________________________________
+int genie::utils::system::ForkWorkers(int nworkers)
+{
+// Fork the worker processes of a job once everything was initialized (the
+// configuration, splines, drivers, geometry and flux set-up), so that the
+// workers share all of it (until they modify it) at no extra start-up cost
+// or memory. Random number streams, output files and the events or flux
+// entries of each worker are the caller's business.
+
+  if(nworkers <= 1) return 0;
+
+  // have buffered output written out once, not by every process
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(0);
+
+  vector<pid_t> wpids;
+  for(int iw = 0; iw < nworkers; iw++) {
+    pid_t pid = fork();
+    if(pid < 0) {
+      LOG("SystemUtils", pFATAL) << "Couldn't fork worker " << iw;
+      gAbortingInErr = true;
+      exit(1);
+    }
+    if(pid == 0) return iw;
+    wpids.push_back(pid);
+  }
+  LOG("SystemUtils", pNOTICE)
+    << "Forked " << nworkers << " worker processes - Waiting for them";
+
+  bool failed = false;
+  for(int iw = 0; iw < nworkers; iw++) {
+    int status = 0;
+    while(waitpid(wpids[iw], &status, 0) < 0) {
+      if(errno != EINTR) { status = -1; break; }
+    }
+    if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+      LOG("SystemUtils", pERROR) << "Worker " << iw << " failed";
+      failed = true;
+    }
+  }
+  if(failed) {
+    LOG("SystemUtils", pFATAL) << "At least one worker failed - Exiting";
+    gAbortingInErr = true;
+    exit(1);
+  }
+  return -1;
+}
+//___________________________________________________________________________
+string genie::utils::system::SharedDataDir(void)
+{
+  const char * dir = gSystem->Getenv("GSHAREDATA");
+  if(!dir || strlen(dir) == 0) return "";
+
+  if(!DirectoryExists(dir) && mkdir(dir, 0777) != 0 && errno != EEXIST) {
+    LOG("System", pWARN)
+      << "Can not create the shared data directory: " << dir
+      << " - The data tables will not be shared";
+    return "";
+  }
+  return string(dir);
+}
+//___________________________________________________________________________
@@ -42,6 +42,16 @@ namespace system
 
   string LocalTimeAsString(string format);
 
+  //! fork nworkers processes sharing the memory of the caller copy-on-write;
+  //! returns the worker index in each worker and, once all the workers have
+  //! exited successfully, -1 in the caller (which exits if any of them failed)
+  int ForkWorkers(int nworkers);
+
+  //! directory where the data tables loaded by the jobs of a node are
+  //! published, for all of them to map the same copy ($GSHAREDATA, eg in
+  //! /dev/shm; created if needed); "" if the tables are not to be shared
+  string SharedDataDir(void);
+
 } // system namespace
 } // utils  namespace
 } // genie  namespace
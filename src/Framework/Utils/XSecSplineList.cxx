@@ -14,6 +14,12 @@
 
 #include <fstream>
 #include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "libxml/parser.h"
 #include "libxml/xmlmemory.h"
@@ -27,16 +33,51 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Utils/StringUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
 #include "Framework/Utils/XmlParserUtils.h"
+#include "Framework/Utils/PhaseTimer.h"
 
 using std::ofstream;
 using std::endl;
 
 namespace genie {
 
+//____________________________________________________________________________
+// Layout of the binary spline file (all numbers in native byte order, which
+// is checked at load time using the byte-order mark):
+//   header
+//   index  : one entry per spline
+//   strings: tune names and spline keys (not null-terminated)
+//   knots  : for each spline, nknots energies followed by nknots xsecs
+//
+namespace {
+  const char     kBinSplMagic[8] = { 'G','N','X','S','P','L','B','N' };
+  const uint32_t kBinSplVersion  = 1;
+  const uint32_t kBinSplBOM      = 0x01020304;
+
+  struct BinSplHeader_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t bom;
+    uint32_t uselog;
+    uint32_t nsplines;
+    uint64_t strings_offset;
+    uint64_t knots_offset;
+    uint64_t file_size;
+  };
+  struct BinSplIndexEntry_t {
+    uint32_t tune_offset;
+    uint32_t tune_length;
+    uint32_t key_offset;
+    uint32_t key_length;
+    uint32_t nknots;
+    uint32_t reserved;
+    uint64_t knots_offset;
+  };
+}
 //____________________________________________________________________________
 ostream & operator << (ostream & stream, const XSecSplineList & list)
 {
@@ -52,14 +93,30 @@ XSecSplineList::XSecSplineList()
   fCurrentTune = "";
   fUseLogE     = true;
   fNKnots      = 100;
+  fKnotPrecision = -1.;
   fEmin        =   0.01; // GeV
   fEmax        = 100.00; // GeV
+
+  fUseLoadFilter = false;
+  fFilterTunes   = false;
+
+  fCheckpointFile = 0;
 }
 //____________________________________________________________________________
 XSecSplineList::~XSecSplineList()
 {
 // Clean up.
 
+  this->ClearSplines();
+  this->CloseCheckpoint();
+  fInstance = 0;
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearSplines(void)
+{
+// Delete all splines, of all tunes (eg between the points of a parameter
+// scan building splines for each point)
+
   map<string,  map<string, Spline *> >::iterator mm_iter = fSplineMap.begin();
   for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
     // loop over splines for given tune
@@ -73,7 +130,10 @@ XSecSplineList::~XSecSplineList()
     spl_map_curr_tune.clear();
   }
   fSplineMap.clear();
-  fInstance = 0;
+  fLoadedSplineSet.clear();
+  fBinSplineMap.clear();
+  fSplineIdx.clear();
+  this->UnmapBinFiles();
 }
 //____________________________________________________________________________
 XSecSplineList * XSecSplineList::Instance()
@@ -89,6 +149,10 @@ XSecSplineList * XSecSplineList::Instance()
 bool XSecSplineList::SplineExists(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+  if(alg && interaction) {
+    ULong64_t id = interaction->Signature(fCurrentTune + "/" + alg->Id().Key());
+    if(fSplineIdx.count(id) == 1) return true;
+  }
   string key = this->BuildSplineKey(alg,interaction);
   return this->SplineExists(key);
 }
@@ -121,8 +185,22 @@ bool XSecSplineList::SplineExists(string key) const
 const Spline * XSecSplineList::GetSpline(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
+// Splines requested for each event are looked-up through the hashed
+// interaction signature, to avoid building the string key every time
+
+  if(!alg || !interaction) {
+    string key = this->BuildSplineKey(alg,interaction);
+    return this->GetSpline(key);
+  }
+
+  ULong64_t id = interaction->Signature(fCurrentTune + "/" + alg->Id().Key());
+  map<ULong64_t, const Spline *>::const_iterator idx_iter = fSplineIdx.find(id);
+  if(idx_iter != fSplineIdx.end()) return idx_iter->second;
+
   string key = this->BuildSplineKey(alg,interaction);
-  return this->GetSpline(key);
+  const Spline * spline = this->GetSpline(key);
+  if(spline) fSplineIdx[id] = spline;
+  return spline;
 }
 //____________________________________________________________________________
 const Spline * XSecSplineList::GetSpline(string key) const
@@ -151,9 +229,47 @@ const Spline * XSecSplineList::GetSpline(string key) const
       << "Couldn't find spline: " << key << " in tune: " << fCurrentTune;
     return 0;
   }
+  if(m_iter->second == 0) {
+    // spline from a binary file that is accessed for the first time
+    return this->BuildBinSpline(fCurrentTune, key);
+  }
   return m_iter->second;
 }
 //____________________________________________________________________________
+const Spline * XSecSplineList::GetTuneSpline(
+                  const string & tune, const Interaction * interaction) const
+{
+// The interaction part of the spline keys (see BuildSplineKey()) is indexed
+// once per tune, and re-indexed if splines were added to the tune since
+
+  map<string, map<string, Spline *> >::const_iterator //\/
+  mm_iter = fSplineMap.find(tune);
+  if(mm_iter == fSplineMap.end()) return 0;
+  const map<string, Spline *> & spl_map_tune = mm_iter->second;
+
+  map<string, string> & intkeys = fTuneIntKeys[tune];
+  if(fTuneIntNSpl[tune] != spl_map_tune.size()) {
+    intkeys.clear();
+    map<string, Spline *>::const_iterator m_iter = spl_map_tune.begin();
+    for( ; m_iter != spl_map_tune.end(); ++m_iter) {
+      const string & key = m_iter->first;
+      string::size_type pos = key.find('/');
+      if(pos != string::npos) pos = key.find('/', pos+1);
+      if(pos == string::npos) continue;
+      intkeys.insert(map<string, string>::value_type(key.substr(pos+1), key));
+    }
+    fTuneIntNSpl[tune] = spl_map_tune.size();
+  }
+
+  map<string, string>::const_iterator k_iter =
+                                  intkeys.find(interaction->AsString());
+  if(k_iter == intkeys.end()) return 0;
+
+  const Spline * spline = spl_map_tune.find(k_iter->second)->second;
+  if(!spline) spline = this->BuildBinSpline(tune, k_iter->second);
+  return spline;
+}
+//____________________________________________________________________________
 void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
         const Interaction * interaction, int nknots, double e_min, double e_max)
 {
@@ -167,9 +283,6 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   // rwh -- uncomment to catch NaN
   // feenableexcept(FE_DIVBYZERO|FE_INVALID|FE_OVERFLOW);
 
-  double xsec[nknots];
-  double E   [nknots];
-
   SLOG("XSecSplLst", pNOTICE)
      << "Creating cross section spline using the algorithm: " << *alg;
 
@@ -183,19 +296,94 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   if (nknots <= 2) nknots = this->NKnots();
   assert( e_min < e_max );
 
-  // Distribute the knots in the energy range (e_min,e_max) :
-  // - Will use 5 knots linearly spaced below the energy thresholds so that the
-  //   spline behaves correctly in (e_min,Ethr)
-  // - Place 1 knot exactly on the input interaction threshold
-  // - Place the remaining n-6 knots spaced either linearly or logarithmically
-  //   above the input interaction threshold
-  // The above scheme schanges appropriately if Ethr<e_min (i.e. no knots
-  // are computed below threshold)
-  //
   double Ethr = interaction->PhaseSpace().Threshold();
   SLOG("XSecSplLst", pNOTICE)
     << "Energy threshold for current interaction = " << Ethr << " GeV";
 
+  vector<double> E, xsec;
+  if(fKnotPrecision > 0.) {
+    this->AdaptiveKnots(alg, interaction, key, nknots, e_min, e_max, Ethr, E, xsec);
+    nknots = E.size();
+  }
+  else {
+    E.resize(nknots);
+    xsec.resize(nknots);
+
+    // Distribute the knots in the energy range (e_min,e_max) :
+    // - Will use 5 knots linearly spaced below the energy thresholds so that the
+    //   spline behaves correctly in (e_min,Ethr)
+    // - Place 1 knot exactly on the input interaction threshold
+    // - Place the remaining n-6 knots spaced either linearly or logarithmically
+    //   above the input interaction threshold
+    // The above scheme schanges appropriately if Ethr<e_min (i.e. no knots
+    // are computed below threshold)
+    //
+    this->UniformKnots(nknots, e_min, e_max, Ethr, &E[0]);
+
+    // Compute cross sections for the input interaction at the selected
+    // set of energies
+    //
+    for (int i = 0; i < nknots; i++) {
+      xsec[i] = this->KnotXSec(alg, interaction, key, i, nknots, E[i]);
+    }
+  }
+
+  // Warn about odd case of decreasing cross section
+  //    but allow for small variation due to integration errors
+  const double eps_xsec = 1.0e-5;
+  const double xsec_scale = (1.0-eps_xsec);
+  if ( xsec[nknots-1] < xsec[nknots-2]*xsec_scale ) {
+    SLOG("XSecSplLst", pWARN)
+      << "Last point oddity: " << key <<  " has "
+      << " xsec[nknots-1] " << xsec[nknots-1] << " < "
+      << " xsec[nknots-2] " << xsec[nknots-2];
+  }
+
+  // Build
+  //
+  Spline * spline = new Spline(nknots, &E[0], &xsec[0]);
+
+  // Save
+  //
+  map<string,  map<string, Spline *> >::iterator //\/
+  mm_iter = fSplineMap.find(fCurrentTune);
+  if(mm_iter == fSplineMap.end()) {
+    map<string, Spline *> spl_map_curr_tune;
+    fSplineMap.insert( map<string, map<string, Spline *> >::value_type(
+      fCurrentTune, spl_map_curr_tune) );
+    mm_iter = fSplineMap.find(fCurrentTune);
+  }
+  map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+  spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
+}
+//____________________________________________________________________________
+void XSecSplineList::AddSpline(const string & key, const Spline & spline)
+{
+// Add a copy of a spline computed elsewhere (eg a sum of splines, see
+// GEVGDriver::StoreXSecSumSpline()) to the splines of the current tune
+
+  if ( fCurrentTune.size() == 0 ) {
+    SLOG("XSecSplLst", pERROR) << "Spline added while CurrentTune not set" ;
+    return;
+  }
+
+  map<string, Spline *> & spl_map_curr_tune = fSplineMap[fCurrentTune];
+  map<string, Spline *>::iterator m_iter = spl_map_curr_tune.find(key);
+  if(m_iter != spl_map_curr_tune.end()) {
+    if(m_iter->second) delete m_iter->second;
+    spl_map_curr_tune.erase(m_iter);
+    fSplineIdx.clear(); // may point to the deleted spline
+  }
+  spl_map_curr_tune.insert(
+      map<string, Spline *>::value_type(key, new Spline(spline)) );
+}
+//____________________________________________________________________________
+void XSecSplineList::UniformKnots(
+   int nknots, double e_min, double e_max, double Ethr, double * E) const
+{
+// 5 knots linearly spaced below threshold (if Ethr > e_min), 1 knot at the
+// threshold and the remaining ones spaced linearly or logarithmically above
+
   int nkb = (Ethr>e_min) ? 5 : 0; // number of knots <  threshold
   int nka = nknots-nkb;           // number of knots >= threshold
 
@@ -220,61 +408,144 @@ void XSecSplineList::CreateSpline(const XSecAlgorithmI * alg,
   }
   // force last point to avoid floating point cumulative slew
   E[nknots-1] = e_max;
+}
+//____________________________________________________________________________
+double XSecSplineList::KnotXSec(const XSecAlgorithmI * alg,
+   const Interaction * interaction, const string & key,
+   int iknot, int nknots, double E)
+{
+// Cross section at the knot energy E (restored from the checkpoint file, if
+// possible, or else computed and written to the checkpoint file)
 
-  // Compute cross sections for the input interaction at the selected
-  // set of energies
-  //
-  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
-  for (int i = 0; i < nknots; i++) {
-    TLorentzVector p4(0,0,E[i],E[i]);
-    if (pr_mass > 0.) {
-      double pz = TMath::Max(0.,E[i]*E[i] - pr_mass*pr_mass);
-      pz = TMath::Sqrt(pz);
-      p4.SetPz(pz);
-    }
-    interaction->InitStatePtr()->SetProbeP4(p4);
-    xsec[i] = alg->Integral(interaction);
+  double xsec = 0.;
+  if(this->RestoreCheckpointKnot(key, iknot, nknots, E, xsec)) {
     SLOG("XSecSplLst", pNOTICE)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2";
-    if ( std::isnan(xsec[i]) ) {
-      // this sometimes happens near threshold, warn and move on
-      SLOG("XSecSplLst", pWARN)
-                       << "xsec(E = " << E[i] << ") =  "
-                       << (1E+38/units::cm2)*xsec[i] << " x 1E-38 cm^2"
-                       << " : converting NaN to 0.0";
-      xsec[i] = 0.0;
-    }
-
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2"
+                     << " (from checkpoint)";
+    return xsec;
   }
 
-  // Warn about odd case of decreasing cross section
-  //    but allow for small variation due to integration errors
-  const double eps_xsec = 1.0e-5;
-  const double xsec_scale = (1.0-eps_xsec);
-  if ( xsec[nknots-1] < xsec[nknots-2]*xsec_scale ) {
+  TLorentzVector p4(0,0,E,E);
+  double pr_mass = interaction->InitStatePtr()->Probe()->Mass();
+  if (pr_mass > 0.) {
+    double pz = TMath::Max(0.,E*E - pr_mass*pr_mass);
+    pz = TMath::Sqrt(pz);
+    p4.SetPz(pz);
+  }
+  interaction->InitStatePtr()->SetProbeP4(p4);
+  xsec = alg->Integral(interaction);
+  SLOG("XSecSplLst", pNOTICE)
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2";
+  if ( std::isnan(xsec) ) {
+    // this sometimes happens near threshold, warn and move on
     SLOG("XSecSplLst", pWARN)
-      << "Last point oddity: " << key <<  " has "
-      << " xsec[nknots-1] " << xsec[nknots-1] << " < "
-      << " xsec[nknots-2] " << xsec[nknots-2];
+                     << "xsec(E = " << E << ") =  "
+                     << (1E+38/units::cm2)*xsec << " x 1E-38 cm^2"
+                     << " : converting NaN to 0.0";
+    xsec = 0.0;
   }
+  this->WriteCheckpointKnot(key, iknot, nknots, E, xsec);
 
-  // Build
-  //
-  Spline * spline = new Spline(nknots, E, xsec);
+  return xsec;
+}
+//____________________________________________________________________________
+void XSecSplineList::AdaptiveKnots(const XSecAlgorithmI * alg,
+   const Interaction * interaction, const string & key, int nknots,
+   double e_min, double e_max, double Ethr,
+   vector<double> & E, vector<double> & xsec)
+{
+// Place at most nknots knots so that the spline reproduces the cross section
+// to a relative accuracy fKnotPrecision: starting from a coarse set of knots,
+// every interval is bisected (in log E, if UseLogE()) and the cross section
+// computed at its mid-point is compared to the spline through the knots
+// computed so far. The mid-point becomes a knot, and the two halves are
+// bisected in turn if the spline disagreed.
+// Differences smaller than a fraction fKnotPrecision of the max cross section
+// times kAdaptKnotsRelFloor are ignored (eg just above threshold), as well as
+// intervals narrower than kAdaptKnotsMinWidth (relative).
+// Checkpointed knots are numbered in the order they are computed: this is the
+// same order when resuming, as long as the restored cross sections are used.
+
+  const int    kAdaptKnotsInit     = 10;
+  const double kAdaptKnotsRelFloor = 1E-3;
+  const double kAdaptKnotsMinWidth = 1E-4;
+
+  int nkb   = (Ethr>e_min) ? 5 : 0;
+  int ninit = TMath::Min(nknots, nkb + kAdaptKnotsInit);
+  int nmax  = nknots;
+  int ikey  = -nmax; // checkpoint knot numbering differs from uniform splines
+
+  map<double, double> knots; // E -> xsec
+  double xsec_max = 0.;
+
+  vector<double> Einit(ninit);
+  this->UniformKnots(ninit, e_min, e_max, Ethr, &Einit[0]);
+  int iknot = 0;
+  for(int i = 0; i < ninit; i++) {
+    double xs = this->KnotXSec(alg, interaction, key, iknot++, ikey, Einit[i]);
+    knots[Einit[i]] = xs;
+    xsec_max = TMath::Max(xsec_max, TMath::Abs(xs));
+  }
 
-  // Save
-  //
-  map<string,  map<string, Spline *> >::iterator //\/
-  mm_iter = fSplineMap.find(fCurrentTune);
-  if(mm_iter == fSplineMap.end()) {
-    map<string, Spline *> spl_map_curr_tune;
-    fSplineMap.insert( map<string, map<string, Spline *> >::value_type(
-      fCurrentTune, spl_map_curr_tune) );
-    mm_iter = fSplineMap.find(fCurrentTune);
+  // intervals to bisect (lower edges): all those above threshold
+  double E0 = TMath::Max(Ethr,e_min);
+  vector< pair<double,double> > intervals;
+  for(int i = nkb; i < ninit-1; i++) {
+    intervals.push_back(pair<double,double>(Einit[i], Einit[i+1]));
+  }
+
+  while(intervals.size() > 0 && (int)knots.size() < nmax) {
+
+    // spline through the current knots
+    vector<double> Ek, xk;
+    for(map<double,double>::const_iterator it = knots.begin(); it != knots.end(); ++it) {
+      Ek.push_back(it->first);
+      xk.push_back(it->second);
+    }
+    Spline current(Ek.size(), &Ek[0], &xk[0]);
+
+    vector< pair<double,double> > next;
+    for(unsigned int i = 0; i < intervals.size(); i++) {
+      if((int)knots.size() >= nmax) break;
+
+      double Elo = intervals[i].first;
+      double Ehi = intervals[i].second;
+      if(Ehi - Elo <= kAdaptKnotsMinWidth * Ehi) continue;
+      double Emid = (this->UseLogE() && Elo > 0.) ?
+                       TMath::Sqrt(Elo*Ehi) : 0.5*(Elo+Ehi);
+
+      double xs = this->KnotXSec(alg, interaction, key, iknot++, ikey, Emid);
+      double xs_spl = current.Evaluate(Emid);
+      knots[Emid] = xs;
+      xsec_max = TMath::Max(xsec_max, TMath::Abs(xs));
+
+      double tol = fKnotPrecision *
+          TMath::Max(TMath::Abs(xs), kAdaptKnotsRelFloor * xsec_max);
+      if(TMath::Abs(xs - xs_spl) > tol) {
+        next.push_back(pair<double,double>(Elo,  Emid));
+        next.push_back(pair<double,double>(Emid, Ehi ));
+      }
+    }
+    intervals = next;
+  }
+
+  if(intervals.size() > 0) {
+    SLOG("XSecSplLst", pWARN)
+      << "Reached the max number of knots (" << nmax << ") for " << key
+      << " before the requested precision (" << fKnotPrecision << ")";
+  }
+  SLOG("XSecSplLst", pNOTICE)
+    << "Placed " << knots.size() << " knots (threshold: " << E0
+    << " GeV) for a relative precision of " << fKnotPrecision;
+
+  E.clear();
+  xsec.clear();
+  for(map<double,double>::const_iterator it = knots.begin(); it != knots.end(); ++it) {
+    E.push_back(it->first);
+    xsec.push_back(it->second);
   }
-  map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
-  spl_map_curr_tune.insert( map<string, Spline *>::value_type(key, spline) );
 }
 //____________________________________________________________________________
 int XSecSplineList::NSplines(void) const
@@ -307,6 +578,11 @@ void XSecSplineList::SetNKnots(int nk)
   if(fNKnots<10) fNKnots = 10; // minimum acceptable number of knots
 }
 //____________________________________________________________________________
+void XSecSplineList::SetKnotPrecision(double relerr)
+{
+  fKnotPrecision = relerr;
+}
+//____________________________________________________________________________
 void XSecSplineList::SetMinE(double Ev)
 {
   if(Ev>0) fEmin = Ev;
@@ -369,6 +645,7 @@ void XSecSplineList::SaveAsXml(const string & filename, bool save_init) const
 
       // Add current spline to output file
       Spline * spline = m_iter->second;
+      if(!spline) spline = this->BuildBinSpline(tune_name, key);
       spline->SaveAsXml(outxml,"E","xsec", key);
     }//spline loop
 
@@ -386,13 +663,19 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
 //! are added to the existing list. If false, then the existing list is reset
 //! before loading the splines.
 
+  PhaseTimerGuard timer("XSecSplineList::LoadFromXml");
+
   SLOG("XSecSplLst", pNOTICE)
     << "Loading splines from: " << filename;
   SLOG("XSecSplLst", pINFO)
     << "Option to keep pre-existing splines is switched "
     << ( (keep) ? "ON" : "OFF" );
 
-  if(!keep) fSplineMap.clear();
+  if(!keep) {
+    fSplineMap.clear();
+    fBinSplineMap.clear();
+  }
+  fSplineIdx.clear();
 
   const int kNodeTypeStartElement = 1;
   const int kNodeTypeEndElement   = 15;
@@ -403,6 +686,7 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
 
   int ret = 0, val_type = -1, iknot = 0, nknots = 0;
   double * E = 0, * xsec = 0;
+  bool skip_spline = false;
   string spline_name = "";
   string temp_tune ;
 
@@ -452,12 +736,19 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
                string snkn     = utils::str::TrimSpaces((const char *)xnkn);
 
                spline_name = sname;
-               SLOG("XSecSplLst", pNOTICE) << "Loading spline: " << spline_name;
+               skip_spline = !this->PassesLoadFilter(temp_tune, spline_name);
+               if(skip_spline) {
+                 SLOG("XSecSplLst", pINFO) << "Skipping spline: " << spline_name;
+               } else {
+                 SLOG("XSecSplLst", pNOTICE) << "Loading spline: " << spline_name;
+               }
 
                nknots = atoi( snkn.c_str() );
                iknot=0;
-               E     = new double[nknots];
-               xsec  = new double[nknots];
+               if(!skip_spline) {
+                 E     = new double[nknots];
+                 xsec  = new double[nknots];
+               }
 
                xmlFree(xname);
                xmlFree(xnkn);
@@ -466,14 +757,17 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
             if( (!xmlStrcmp(name, (const xmlChar *) "E"))    && type==kNodeTypeStartElement) { val_type = kKnotX; }
             if( (!xmlStrcmp(name, (const xmlChar *) "xsec")) && type==kNodeTypeStartElement) { val_type = kKnotY; }
 
-            if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5) {
+            if( (!xmlStrcmp(name, (const xmlChar *) "#text")) && depth==5 && !skip_spline) {
                 if      (val_type==kKnotX) E   [iknot] = atof((const char *)value);
                 else if (val_type==kKnotY) xsec[iknot] = atof((const char *)value);
             }
             if( (!xmlStrcmp(name, (const xmlChar *) "knot")) && type==kNodeTypeEndElement) {
                iknot++;
             }
-            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement) {
+            if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement && skip_spline) {
+               skip_spline = false;
+            }
+            else if( (!xmlStrcmp(name, (const xmlChar *) "spline")) && type==kNodeTypeEndElement) {
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
                LOG("XSecSplLst", pINFO) << "Done with current spline";
                for(int i=0; i<nknots; i++) {
@@ -517,6 +811,400 @@ XmlParserStatus_t XSecSplineList::LoadFromXml(const string & filename, bool keep
   return kXmlOK;
 }
 //____________________________________________________________________________
+void XSecSplineList::SaveAsBinary(const string & filename) const
+{
+//! Save XSecSplineList (all tunes) to a binary file that can be loaded with
+//! LoadFromBinary(). Unlike the XML output, knots are stored at full double
+//! precision.
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Saving XSecSplineList as binary file: " << filename;
+
+  vector<BinSplIndexEntry_t> index;
+  string                     strings;
+  vector<const Spline *>     splines;
+
+  map<string,  map<string, Spline *> >::const_iterator //\/
+  mm_iter = fSplineMap.begin();
+  for( ; mm_iter != fSplineMap.end(); ++mm_iter) {
+    string tune_name = mm_iter->first;
+    uint32_t tune_offset = strings.size();
+    strings += tune_name;
+
+    const map<string, Spline *> & spl_map_curr_tune = mm_iter->second;
+    map<string, Spline *>::const_iterator //\/
+    m_iter = spl_map_curr_tune.begin();
+    for( ; m_iter != spl_map_curr_tune.end(); ++m_iter) {
+      string key = m_iter->first;
+      const Spline * spline = m_iter->second;
+      if(!spline) spline = this->BuildBinSpline(tune_name, key);
+
+      BinSplIndexEntry_t entry;
+      entry.tune_offset  = tune_offset;
+      entry.tune_length  = tune_name.size();
+      entry.key_offset   = strings.size();
+      entry.key_length   = key.size();
+      entry.nknots       = spline->NKnots();
+      entry.reserved     = 0;
+      entry.knots_offset = 0;
+      strings += key;
+
+      index.push_back(entry);
+      splines.push_back(spline);
+    }
+  }
+
+  // compute offsets (knots are aligned at 8 bytes)
+  BinSplHeader_t header;
+  memcpy(header.magic, kBinSplMagic, sizeof(header.magic));
+  header.version  = kBinSplVersion;
+  header.bom      = kBinSplBOM;
+  header.uselog   = (fUseLogE ? 1 : 0);
+  header.nsplines = index.size();
+  header.strings_offset = sizeof(BinSplHeader_t) 
+                        + index.size() * sizeof(BinSplIndexEntry_t);
+  header.knots_offset   = (header.strings_offset + strings.size() + 7) & ~7ULL;
+
+  uint64_t offset = header.knots_offset;
+  for(unsigned int i = 0; i < index.size(); i++) {
+    index[i].knots_offset = offset;
+    offset += 2 * index[i].nknots * sizeof(double);
+  }
+  header.file_size = offset;
+
+  ofstream outbin(filename.c_str(), std::ios::out | std::ios::binary);
+  if(!outbin.is_open()) {
+    SLOG("XSecSplLst", pERROR) << "Couldn't create file = " << filename;
+    return;
+  }
+  outbin.write((const char *) &header, sizeof(header));
+  if(!index.empty()) {
+    outbin.write((const char *) &index[0], index.size()*sizeof(BinSplIndexEntry_t));
+  }
+  outbin.write(strings.data(), strings.size());
+  const char pad[8] = { 0,0,0,0,0,0,0,0 };
+  outbin.write(pad, header.knots_offset - header.strings_offset - strings.size());
+
+  for(unsigned int i = 0; i < splines.size(); i++) {
+    const Spline * spline = splines[i];
+    int nknots = spline->NKnots();
+    vector<double> knots(2*nknots);
+    for(int ik = 0; ik < nknots; ik++) {
+      spline->GetKnot(ik, knots[ik], knots[nknots+ik]);
+    }
+    outbin.write((const char *) &knots[0], 2*nknots*sizeof(double));
+  }
+  outbin.close();
+
+  SLOG("XSecSplLst", pNOTICE)
+       << "Wrote " << index.size() << " splines (" << header.file_size << " bytes)";
+}
+//____________________________________________________________________________
+bool XSecSplineList::IsBinaryFile(const string & filename)
+{
+//! Check whether the input file is a binary spline file (written by
+//! SaveAsBinary()) rather than an XML one.
+
+  std::ifstream inp(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!inp.is_open()) return false;
+  char magic[8];
+  inp.read(magic, sizeof(magic));
+  if(!inp.good()) return false;
+  return (memcmp(magic, kBinSplMagic, sizeof(magic)) == 0);
+}
+//____________________________________________________________________________
+XmlParserStatus_t XSecSplineList::LoadFromBinary(const string & filename, bool keep)
+{
+//! Load XSecSplineList from a binary file written by SaveAsBinary(). 
+//! The file is memory-mapped and only its index is read: The Spline objects
+//! are built the first time each one is requested. If keep = true, then the
+//! loaded splines are added to the existing list. If false, then the existing
+//! list is reset before loading the splines. XML parser status codes are used
+//! for reporting problems, for uniformity with LoadFromXml().
+
+  PhaseTimerGuard timer("XSecSplineList::LoadFromBinary");
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loading splines from binary file: " << filename;
+  SLOG("XSecSplLst", pINFO)
+    << "Option to keep pre-existing splines is switched "
+    << ( (keep) ? "ON" : "OFF" );
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file could not be found! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(BinSplHeader_t)) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file is empty or truncated! [filename: " << filename << "]";
+    close(fd);
+    return kXmlEmpty;
+  }
+  size_t size = st.st_size;
+  void * data = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(data == MAP_FAILED) {
+    LOG("XSecSplLst", pERROR)
+          << "\nBinary file could not be mapped! [filename: " << filename << "]";
+    return kXmlNotParsed;
+  }
+
+  const char * base = (const char *) data;
+  const BinSplHeader_t * header = (const BinSplHeader_t *) base;
+  bool valid = 
+     memcmp(header->magic, kBinSplMagic, sizeof(header->magic)) == 0 &&
+     header->version   == kBinSplVersion &&
+     header->bom       == kBinSplBOM     &&
+     header->file_size == size;
+  if(!valid) {
+    LOG("XSecSplLst", pERROR)
+      << "\nInvalid, incompatible or truncated binary spline file! [filename: " 
+      << filename << "]";
+    munmap(data, size);
+    return kXmlInvalidRoot;
+  }
+  fBinFiles.push_back( pair<void *, size_t>(data, size) );
+
+  if(!keep) {
+    fSplineMap.clear();
+    fBinSplineMap.clear();
+  }
+  fSplineIdx.clear();
+  this->SetLogE(header->uselog == 1);
+
+  const BinSplIndexEntry_t * index = 
+     (const BinSplIndexEntry_t *) (base + sizeof(BinSplHeader_t));
+  const char * strings = base + header->strings_offset;
+
+  for(uint32_t i = 0; i < header->nsplines; i++) {
+    const BinSplIndexEntry_t & entry = index[i];
+    string tune (strings + entry.tune_offset, entry.tune_length);
+    string key  (strings + entry.key_offset,  entry.key_length );
+
+    if(!this->PassesLoadFilter(tune, key)) continue;
+
+    map<string, Spline *> & spl_map_tune = fSplineMap[tune];
+    if(spl_map_tune.count(key) == 1) {
+      // keep pre-existing splines, as in LoadFromXml()
+      continue;
+    }
+    BinSpline_t bspl;
+    bspl.nknots = entry.nknots;
+    bspl.E      = (const double *) (base + entry.knots_offset);
+    bspl.xsec   = bspl.E + entry.nknots;
+
+    spl_map_tune.insert( map<string, Spline *>::value_type(key, 0) );
+    fBinSplineMap[tune][key] = bspl;
+    fLoadedSplineSet[tune].insert(key);
+  }
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Indexed " << header->nsplines << " splines from: " << filename;
+
+  return kXmlOK;
+}
+//____________________________________________________________________________
+void XSecSplineList::SetLoadFilter(
+  const PDGCodeList & probes, const PDGCodeList & targets, bool current_tune_only)
+{
+  fUseLoadFilter = true;
+  fFilterTunes   = current_tune_only;
+  fFilterProbes .clear();
+  fFilterTargets.clear();
+  fFilterProbes .insert(probes .begin(), probes .end());
+  fFilterTargets.insert(targets.begin(), targets.end());
+
+  SLOG("XSecSplLst", pNOTICE)
+    << "Loading only splines for probes: " << probes 
+    << " and targets: " << targets 
+    << (fFilterTunes ? (" in tune: " + fCurrentTune) : string(""));
+}
+//____________________________________________________________________________
+void XSecSplineList::ClearLoadFilter(void)
+{
+  fUseLoadFilter = false;
+  fFilterTunes   = false;
+  fFilterProbes .clear();
+  fFilterTargets.clear();
+  fFilterExtraTunes.clear();
+}
+//____________________________________________________________________________
+bool XSecSplineList::PassesLoadFilter(
+                               const string & tune, const string & key) const
+{
+// Decide whether to load a spline, given its tune and its key
+// (xsec_alg/xsec_config/interaction, see BuildSplineKey()). The probe and
+// target PDG codes are read from the interaction part of the key, which is
+// of the form nu:x;tgt:x;... or dm;tgt:x;... (see Interaction::AsString())
+
+  if(!fUseLoadFilter) return true;
+
+  if(fFilterTunes && fCurrentTune.size() > 0 && tune != fCurrentTune &&
+     fFilterExtraTunes.count(tune) == 0) {
+    return false;
+  }
+
+  string::size_type pos = key.find('/');
+  if(pos != string::npos) pos = key.find('/', pos+1);
+  string intkey = (pos == string::npos) ? key : key.substr(pos+1);
+
+  if(!fFilterProbes.empty()) {
+    int probe = 0;
+    if(intkey.compare(0, 3, "dm;") == 0) {
+      probe = kPdgDarkMatter;
+    } 
+    else if(intkey.compare(0, 3, "nu:") == 0) {
+      probe = atoi(intkey.c_str() + 3);
+    }
+    if(fFilterProbes.count(probe) == 0) return false;
+  }
+
+  if(!fFilterTargets.empty()) {
+    string::size_type tpos = intkey.find("tgt:");
+    if(tpos == string::npos) return false;
+    int target = atoi(intkey.c_str() + tpos + 4);
+    if(fFilterTargets.count(target) == 0) return false;
+  }
+
+  return true;
+}
+//____________________________________________________________________________
+bool XSecSplineList::OpenCheckpoint(const string & filename, bool resume)
+{
+//! Open a checkpoint file where each knot computed by CreateSpline() is
+//! appended (one line per knot: tune, key, knot index, number of knots, E,
+//! xsec). If resume = true, the knots already in the file are read-in first
+//! and CreateSpline() will re-use them instead of recomputing them.
+//! An incomplete last line, as left by a job killed while writing, is
+//! ignored. Returns false if the file can not be opened.
+
+  this->CloseCheckpoint();
+  fCheckpointKnots.clear();
+  fCheckpointNKnots.clear();
+
+  if(resume) {
+    FILE * inp = fopen(filename.c_str(), "r");
+    if(inp) {
+      int nrestored = 0;
+      char line[8192], tune[4096], key[4096];
+      int iknot = 0, nknots = 0;
+      double E = 0, xsec = 0;
+      while(fgets(line, sizeof(line), inp)) {
+        // skip incomplete lines
+        size_t len = strlen(line);
+        if(len == 0 || line[len-1] != '\n') continue;
+        int nread = sscanf(line, "%4095s %4095s %d %d %lf %lf",
+                              tune, key, &iknot, &nknots, &E, &xsec);
+        if(nread != 6) continue;
+        string ckey = string(tune) + " " + string(key);
+        map<string,int>::const_iterator it = fCheckpointNKnots.find(ckey);
+        if(it != fCheckpointNKnots.end() && it->second != nknots) {
+          // same spline computed again with different settings: start over
+          fCheckpointKnots[ckey].clear();
+        }
+        fCheckpointNKnots[ckey] = nknots;
+        fCheckpointKnots[ckey][iknot] = pair<double,double>(E, xsec);
+        nrestored++;
+      }
+      fclose(inp);
+      SLOG("XSecSplLst", pNOTICE)
+        << "Restored " << nrestored << " knots for " << fCheckpointKnots.size()
+        << " splines from checkpoint file: " << filename;
+    } else {
+      SLOG("XSecSplLst", pNOTICE)
+        << "No checkpoint file: " << filename << " - Starting from scratch";
+    }
+  }
+
+  fCheckpointFile = fopen(filename.c_str(), (resume ? "a" : "w"));
+  if(!fCheckpointFile) {
+    SLOG("XSecSplLst", pERROR) 
+      << "Couldn't open checkpoint file: " << filename;
+    return false;
+  }
+  SLOG("XSecSplLst", pNOTICE)
+    << "Checkpointing computed spline knots in: " << filename;
+  return true;
+}
+//____________________________________________________________________________
+void XSecSplineList::CloseCheckpoint(void)
+{
+  if(fCheckpointFile) {
+    fclose(fCheckpointFile);
+    fCheckpointFile = 0;
+  }
+}
+//____________________________________________________________________________
+bool XSecSplineList::RestoreCheckpointKnot(
+   const string & key, int iknot, int nknots, double E, double & xsec) const
+{
+  if(fCheckpointKnots.empty()) return false;
+
+  string ckey = fCurrentTune + " " + key;
+  map<string, map<int, pair<double,double> > >::const_iterator //\/
+  cit = fCheckpointKnots.find(ckey);
+  if(cit == fCheckpointKnots.end()) return false;
+
+  map<string,int>::const_iterator nit = fCheckpointNKnots.find(ckey);
+  if(nit == fCheckpointNKnots.end() || nit->second != nknots) return false;
+
+  map<int, pair<double,double> >::const_iterator kit = cit->second.find(iknot);
+  if(kit == cit->second.end()) return false;
+
+  // the knot must be at the same energy
+  double Ec = kit->second.first;
+  if(TMath::Abs(Ec - E) > 1E-9 * TMath::Max(1., TMath::Abs(E))) return false;
+
+  xsec = kit->second.second;
+  return true;
+}
+//____________________________________________________________________________
+void XSecSplineList::WriteCheckpointKnot(
+   const string & key, int iknot, int nknots, double E, double xsec)
+{
+  if(!fCheckpointFile) return;
+
+  // one write per line & a flush, so that lines written by concurrent jobs
+  // sharing the same checkpoint file are not interleaved
+  fprintf(fCheckpointFile, "%s %s %d %d %.17g %.17g\n", 
+          fCurrentTune.c_str(), key.c_str(), iknot, nknots, E, xsec);
+  fflush(fCheckpointFile);
+}
+//____________________________________________________________________________
+Spline * XSecSplineList::BuildBinSpline(
+                              const string & tune, const string & key) const
+{
+// Build the Spline for a key loaded from a binary file and cache it in the
+// spline map
+
+  map<string, map<string, BinSpline_t> >::const_iterator //\/
+  bm_iter = fBinSplineMap.find(tune);
+  assert(bm_iter != fBinSplineMap.end());
+  map<string, BinSpline_t>::const_iterator b_iter = bm_iter->second.find(key);
+  assert(b_iter != bm_iter->second.end());
+
+  const BinSpline_t & bspl = b_iter->second;
+
+  SLOG("XSecSplLst", pDEBUG) << "Building spline: " << key;
+
+  Spline * spline = new Spline(bspl.nknots, 
+     const_cast<double *>(bspl.E), const_cast<double *>(bspl.xsec));
+  fSplineMap[tune][key] = spline;
+  return spline;
+}
+//____________________________________________________________________________
+void XSecSplineList::UnmapBinFiles(void)
+{
+  vector< pair<void *, size_t> >::iterator it = fBinFiles.begin();
+  for( ; it != fBinFiles.end(); ++it) {
+    munmap(it->first, it->second);
+  }
+  fBinFiles.clear();
+}
+//____________________________________________________________________________
 string XSecSplineList::BuildSplineKey(
             const XSecAlgorithmI * alg, const Interaction * interaction) const
 {
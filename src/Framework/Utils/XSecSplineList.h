@@ -5,6 +5,10 @@
 
 \brief    List of cross section vs energy splines
 
+          Splines can be saved/loaded in XML format or in a compact binary
+          format (see SaveAsBinary()) which is memory-mapped at load time.
+          Splines loaded from a binary file are only built on first access.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -19,13 +23,17 @@
 #ifndef _XSEC_SPLINE_LIST_H_
 #define _XSEC_SPLINE_LIST_H_
 
+#include <cstdio>
 #include <ostream>
 #include <map>
 #include <set>
 #include <vector>
 #include <string>
 
+#include <Rtypes.h>
+
 #include "Framework/Conventions/XmlParserStatus.h"
+#include "Framework/ParticleData/PDGCodeList.h"
 
 using std::map;
 using std::set;
@@ -53,6 +61,30 @@ public:
   void               SaveAsXml   (const string & filename, bool save_init = true) const;
   XmlParserStatus_t  LoadFromXml (const string & filename, bool keep = false);
 
+  // Save/load to/from binary (memory-mappable) file
+  void               SaveAsBinary   (const string & filename) const;
+  XmlParserStatus_t  LoadFromBinary (const string & filename, bool keep = false);
+  static bool        IsBinaryFile   (const string & filename);
+
+  // Restrict the splines loaded by subsequent LoadFromXml / LoadFromBinary
+  // calls to the given probes and targets (eg the FluxParticles() of a flux
+  // driver and the ListOfTargetNuclei() of a geometry driver) and, optionally,
+  // to the current tune. An empty PDG code list does not restrict anything.
+  void   SetLoadFilter    (const PDGCodeList & probes, const PDGCodeList & targets,
+                           bool current_tune_only = true);
+  void   ClearLoadFilter  (void);
+  bool   PassesLoadFilter (const string & tune, const string & key) const;
+  bool   HasLoadFilter    (void) const { return fUseLoadFilter; }
+  // Also load the splines of the input tune when restricting to the current
+  // tune (eg the alternate tunes event weights are written for)
+  void   AddFilterTune    (const string & tune) { fFilterExtraTunes.insert(tune); }
+
+  // Checkpointing of spline creation: Once a checkpoint file is open, every
+  // knot computed by CreateSpline() is appended to it. When resuming, knots
+  // found in the checkpoint file are re-used rather than re-computed.
+  bool   OpenCheckpoint   (const string & filename, bool resume);
+  void   CloseCheckpoint  (void);
+
   // Print available splines
   void   Print (ostream & stream) const;
   friend ostream & operator << (ostream & stream, const XSecSplineList & xsl);
@@ -70,8 +102,13 @@ public:
   bool           SplineExists (string spline_key) const;
   const Spline * GetSpline    (const XSecAlgorithmI * alg, const Interaction * i) const;
   const Spline * GetSpline    (string spline_key) const;
+  // Spline of the input (not necessarily current) tune for the input
+  // interaction, whichever cross section algorithm the tune uses for it
+  const Spline * GetTuneSpline(const string & tune, const Interaction * i) const;
   void           CreateSpline (const XSecAlgorithmI * alg, const Interaction * i,
                                int nknots = -1, double e_min = -1, double e_max = -1);
+  void           AddSpline    (const string & key, const Spline & spline); ///< add (or replace) a copy of a precomputed spline
+  void           ClearSplines (void); ///< delete all splines
   int  NSplines (void) const;
   bool IsEmpty  (void) const;
 
@@ -86,10 +123,12 @@ public:
   void   SetNKnots (int    nk); ///< set default number of knots for building the spline
   void   SetMinE   (double Ev); ///< set default minimum energy for xsec splines
   void   SetMaxE   (double Ev); ///< set default maximum energy for xsec splines
+  void   SetKnotPrecision (double relerr); ///< place (at most nknots) knots adaptively for this precision (<=0: uniform knots)
   bool   UseLogE   (void) const { return fUseLogE;  }
   int    NKnots    (void) const { return fNKnots;   }
   double Emin      (void) const { return fEmin;     }
   double Emax      (void) const { return fEmax;     }
+  double KnotPrecision (void) const { return fKnotPrecision; }
 
 private:
 
@@ -103,11 +142,47 @@ private:
   int    fNKnots;
   double fEmin;
   double fEmax;
+  double fKnotPrecision; ///< target relative accuracy of adaptively placed knots (<=0: uniform knots)
 
   string fCurrentTune; ///< The `active' tune, out the many that can co-exist
 
-  map<string, map<string, Spline *> > fSplineMap;       ///< tune -> { xsec_alg/xsec_config/interaction -> Spline }
-  map<string, set<string>           > fLoadedSplineSet; ///< tune -> { set of initialy loaded splines             }
+  // Knots of a spline stored in a memory-mapped binary file
+  struct BinSpline_t {
+    const double * E;     ///< knot energies
+    const double * xsec;  ///< knot cross sections
+    int            nknots;
+  };
+
+  Spline * BuildBinSpline (const string & tune, const string & key) const;
+  void     UnmapBinFiles  (void);
+
+  mutable map<string, map<string, Spline *> > fSplineMap; ///< tune -> { xsec_alg/xsec_config/interaction -> Spline } (null until built, for binary-file splines)
+  map<string, set<string>           > fLoadedSplineSet;   ///< tune -> { set of initialy loaded splines             }
+  map<string, map<string, BinSpline_t> > fBinSplineMap;   ///< tune -> { key -> knots in memory-mapped binary file  }
+  vector< pair<void *, size_t> >   fBinFiles;             ///< memory-mapped binary spline files
+  mutable map<ULong64_t, const Spline *> fSplineIdx;      ///< hashed tune/xsec_alg/interaction signature -> Spline (fast look-up)
+  mutable map<string, map<string, string> > fTuneIntKeys; ///< tune -> { interaction -> spline key }, for GetTuneSpline()
+  mutable map<string, unsigned int>       fTuneIntNSpl;  ///< tune -> # of splines when its interaction index was built
+
+  void   UniformKnots  (int nknots, double e_min, double e_max, double Ethr, double * E) const;
+  void   AdaptiveKnots (const XSecAlgorithmI * alg, const Interaction * i, const string & key,
+                        int nknots, double e_min, double e_max, double Ethr,
+                        vector<double> & E, vector<double> & xsec);
+  double KnotXSec      (const XSecAlgorithmI * alg, const Interaction * i, const string & key,
+                        int iknot, int nknots, double E);
+
+  bool RestoreCheckpointKnot (const string & key, int iknot, int nknots, double E, double & xsec) const;
+  void WriteCheckpointKnot   (const string & key, int iknot, int nknots, double E, double xsec);
+
+  FILE * fCheckpointFile;                                 ///< knots computed so far are appended here
+  map<string, map<int, pair<double,double> > > fCheckpointKnots; ///< tune+key -> { knot -> (E,xsec) } restored from checkpoint
+  map<string, int> fCheckpointNKnots;                     ///< tune+key -> number of knots of the checkpointed spline
+
+  bool     fUseLoadFilter;      ///< restrict loaded splines?
+  bool     fFilterTunes;        ///< load only splines for the current tune?
+  set<int> fFilterProbes;       ///< probes whose splines are loaded (all, if empty)
+  set<int> fFilterTargets;      ///< targets whose splines are loaded (all, if empty)
+  set<string> fFilterExtraTunes; ///< tunes loaded along with the current one
 
   struct Cleaner {
       void DummyMethodAndSilentCompiler() { }
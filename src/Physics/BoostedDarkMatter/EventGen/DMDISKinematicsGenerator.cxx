@@ -31,6 +31,7 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Physics/BoostedDarkMatter/XSection/DMUtils.h"
 #include "Framework/ParticleData/PDGUtils.h"
 
 using namespace genie;
@@ -106,6 +107,7 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  if(!fGenerateUniformly && xsec_max <= 0) return; // thread stopped by MaxXSec()
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -117,6 +119,7 @@ void DMDISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
        LOG("DMDISKinematics", pWARN)
          << " Couldn't select kinematics after " << iter << " iterations";
@@ -236,6 +239,10 @@ void DMDISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- The max xsec depends on the DM and mediator masses and on the Z'
+  //   coupling, which are not part of the configuration
+  fCacheKey = this->Id().Key() + "/" + utils::dm::ParameterKey();
+
 }
 //____________________________________________________________________________
 double DMDISKinematicsGenerator::ComputeMaxXSec(
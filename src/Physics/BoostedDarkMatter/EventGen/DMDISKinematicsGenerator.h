@@ -50,6 +50,9 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  string CacheKey        (void) const { return fCacheKey; }
+
+  string fCacheKey; ///< max xsec cache key, incl. the DM model parameters
 };
 
 }      // genie namespace
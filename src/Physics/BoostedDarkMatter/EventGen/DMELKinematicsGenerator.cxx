@@ -31,6 +31,7 @@
 #include "Physics/BoostedDarkMatter/EventGen/DMELKinematicsGenerator.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Physics/BoostedDarkMatter/XSection/DMUtils.h"
 
 using namespace genie;
 using namespace genie::controls;
@@ -109,6 +110,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   space the max xsec is irrelevant
   LOG("DMELKinematics",pNOTICE) << "Setting max XSec";
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  if(!fGenerateUniformly && xsec_max <= 0) return; // thread stopped by MaxXSec()
   LOG("DMELKinematics",pNOTICE) << "Set max XSec to " << xsec_max;
 
   //-- Try to select a valid Q2 using the rejection method
@@ -125,6 +127,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("DMELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
@@ -200,7 +203,7 @@ void DMELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         else if(xcls.IsStrangeEvent()) { rpdgc = xcls.StrangeHadronPdg();           }
         else                    { rpdgc = interaction->RecoilNucleonPdg(); }
         assert(rpdgc);
-        double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+        double gW = PDGLibrary::Instance()->Mass(rpdgc);
 
         LOG("DMELKinematics", pNOTICE) << "Selected: W = "<< gW;
 
@@ -298,6 +301,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
   //   space the max xsec is irrelevant
 //  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
   double xsec_max = this->MaxXSec(evrec);
+  if(xsec_max <= 0) return; // thread stopped by MaxXSec()
 
   // get neutrino energy at struck nucleon rest frame and the
   // struck nucleon mass (can be off the mass shell)
@@ -321,6 +325,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("DMELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
@@ -344,7 +349,7 @@ void DMELKinematicsGenerator::SpectralFuncExperimentalCode(
      if(xcls.IsCharmEvent()) { rpdgc = xcls.CharmHadronPdg();           }
      else                    { rpdgc = interaction->RecoilNucleonPdg(); }
      assert(rpdgc);
-     gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+     gW = PDGLibrary::Instance()->Mass(rpdgc);
 
      // (W,Q2) -> (x,y)
      kinematics::WQ2toXY(E,Mn,gW,gQ2,gx,gy);
@@ -468,6 +473,10 @@ void DMELKinematicsGenerator::LoadConfig(void)
   //   an event weight?
   GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- The max xsec depends on the DM and mediator masses and on the Z'
+  //   coupling, which are not part of the configuration
+  fCacheKey = this->Id().Key() + "/" + utils::dm::ParameterKey();
+
 }
 //____________________________________________________________________________
 double DMELKinematicsGenerator::ComputeMaxXSec(
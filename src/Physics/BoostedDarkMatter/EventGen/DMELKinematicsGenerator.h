@@ -49,6 +49,9 @@ private:
 
   void   LoadConfig     (void);
   double ComputeMaxXSec (const Interaction * in) const;
+  string CacheKey       (void) const { return fCacheKey; }
+
+  string fCacheKey; ///< max xsec cache key, incl. the DM model parameters
 };
 
 }      // genie namespace
@@ -207,7 +207,7 @@ void AhrensDMELPXSec::LoadConfig(void)
   this->GetParam("ZpCoupling", fgZp ) ;
 
   // mediator mass
-  fMedMass = PDGLibrary::Instance()->Find(kPdgMediator)->Mass();
+  fMedMass = PDGLibrary::Instance()->Mass(kPdgMediator);
 
   // load XSec Integrator
   fXSecIntegrator =
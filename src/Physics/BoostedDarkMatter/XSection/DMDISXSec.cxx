@@ -33,6 +33,7 @@
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 
 using namespace genie;
@@ -60,6 +61,7 @@ DMDISXSec::~DMDISXSec()
 double DMDISXSec::Integrate(
                  const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(in) ) return 0.;
 
   const KPhaseSpace & kps = in->PhaseSpace();
@@ -162,14 +164,11 @@ double DMDISXSec::Integrate(
      if(phsp_ok) {
        ROOT::Math::IBaseFunctionMultiDim * func = 
           new utils::gsl::d2XSec_dWdQ2_E(model, interaction);
-       ROOT::Math::IntegrationMultiDim::Type ig_type = 
-           utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
            
        double abstol = 1; //We mostly care about relative tolerance.
-       ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
        double kine_min[2] = { Wl.min, Q2l.min };
        double kine_max[2] = { Wl.max, Q2l.max };
-       xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+       xsec = this->IntegrateNDim(*func, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
        delete func;
      }//phase space ok?
 
@@ -199,6 +198,7 @@ void DMDISXSec::LoadConfig(void)
   // Get GSL integration type & relative tolerance
   GetParamDef("gsl-integration-type", fGSLIntgType, string("adaptive") ) ;
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol, 1E-2 ) ;
+  BindParamDef( fGSLNWorkers, "gsl-integration-workers", 0 ) ;
 
   int max_eval, min_eval ;
   GetParamDef( "gsl-max-eval", max_eval, 500000 ) ;
@@ -291,20 +291,11 @@ void DMDISXSec::CacheFreeNucleonXSec(
             Wl.min >= 0. &&  Wl.max >= 0. &&  Wl.max >=  Wl.min);
 
        if(phsp_ok) {
-         ROOT::Math::IntegrationMultiDim::Type ig_type = 
-             utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
          double abstol = 1; //We mostly care about relative tolerance.
-         ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-         if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-            ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-              dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-            assert(cast);
-            cast->SetMinPts(fGSLMinEval);
-         }
          double kine_min[2] = { Wl.min, Q2l.min };
          double kine_max[2] = { Wl.max, Q2l.max };
-         xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+         xsec = this->IntegrateNDim(
+           *func, kine_min, kine_max, abstol, fGSLMinEval) * (1E-38 * units::cm2);
        }// phase space limits ok?
     }//Ev>threshold
 
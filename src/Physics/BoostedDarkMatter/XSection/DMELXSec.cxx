@@ -34,6 +34,7 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 
 using namespace genie;
@@ -61,6 +62,7 @@ DMELXSec::~DMELXSec()
 double DMELXSec::Integrate(
                   const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   LOG("DMELXSec",pDEBUG) << "Beginning integrate";
   if(! model->ValidProcess(in)) return 0.;
 
@@ -0,0 +1,165 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <cstdio>
+#include <set>
+#include <sstream>
+#include <vector>
+#include <glob.h>
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Registry/Registry.h"
+#include "Framework/Utils/XSecSplineList.h"
+#include "Physics/BoostedDarkMatter/XSection/DMUtils.h"
+
+using std::ostringstream;
+using std::set;
+using std::vector;
+
+using namespace genie;
+
+namespace {
+  struct FamilyFile_t {
+    string file;
+    double mass;
+    double ratio;
+    double gzp;
+  };
+  bool same(double a, double b)
+  {
+    return TMath::Abs(a-b) <= 1E-6 * TMath::Max(TMath::Abs(a), TMath::Abs(b));
+  }
+}
+//____________________________________________________________________________
+double genie::utils::dm::ZpCoupling(void)
+{
+  Registry * r = AlgConfigPool::Instance()->CommonList("Param", "BoostedDarkMatter");
+  double gzp = 0;
+  r->Get("ZpCoupling", gzp);
+  return gzp;
+}
+//____________________________________________________________________________
+string genie::utils::dm::ParameterKey(void)
+{
+  PDGLibrary * pdglib = PDGLibrary::Instance();
+  ostringstream key;
+  key.precision(10);
+  key << "mDM=" << pdglib->Mass(kPdgDarkMatter)
+      << ";mZp=" << pdglib->Mass(kPdgMediator)
+      << ";gZp=" << utils::dm::ZpCoupling();
+  return key.str();
+}
+//____________________________________________________________________________
+string genie::utils::dm::SplineFamilyFile(
+   string stem, double mass, double ratio, double gzp)
+{
+  ostringstream file;
+  file << stem << ".dm_m" << mass << "_r" << ratio << "_g" << gzp << ".xml";
+  return file.str();
+}
+//____________________________________________________________________________
+bool genie::utils::dm::LoadSplineFamily(
+   string stem, double mass, double ratio, double gzp)
+{
+  // List the family files
+  vector<FamilyFile_t> family;
+  string pattern = stem + ".dm_m*_r*_g*.xml";
+  glob_t g;
+  if(glob(pattern.c_str(), 0, NULL, &g) == 0) {
+    for(size_t i = 0; i < g.gl_pathc; i++) {
+      string file = g.gl_pathv[i];
+      FamilyFile_t ff;
+      ff.file = file;
+      if(sscanf(file.c_str() + stem.size(), ".dm_m%lf_r%lf_g%lf.xml",
+                &ff.mass, &ff.ratio, &ff.gzp) != 3) continue;
+      if(ff.mass <= 0 || ff.ratio <= 0 || ff.gzp <= 0) continue;
+      family.push_back(ff);
+    }
+  }
+  globfree(&g);
+
+  if(family.size() == 0) {
+    LOG("DMUtils", pERROR) << "No spline family files matching: " << pattern;
+    return false;
+  }
+
+  // Nearest (mass, ratio) point; the masses are gridded logarithmically
+  unsigned int inearest = 0;
+  double dmin = -1;
+  for(unsigned int i = 0; i < family.size(); i++) {
+    double dm = TMath::Log(family[i].mass  / mass);
+    double dr = TMath::Log(family[i].ratio / ratio);
+    double d  = dm*dm + dr*dr;
+    if(dmin < 0 || d < dmin) { dmin = d; inearest = i; }
+  }
+  double fmass  = family[inearest].mass;
+  double fratio = family[inearest].ratio;
+  if(!same(fmass,mass) || !same(fratio,ratio)) {
+    LOG("DMUtils", pWARN)
+      << "No spline family for DM mass = " << mass << ", mediator mass ratio = "
+      << ratio << " - Using the nearest one: DM mass = " << fmass
+      << ", mediator mass ratio = " << fratio;
+  }
+
+  // Nearest coupling at this point
+  dmin = -1;
+  for(unsigned int i = 0; i < family.size(); i++) {
+    if(!same(family[i].mass,fmass) || !same(family[i].ratio,fratio)) continue;
+    double d = TMath::Abs(TMath::Log(family[i].gzp / gzp));
+    if(dmin < 0 || d < dmin) { dmin = d; inearest = i; }
+  }
+  const FamilyFile_t & ff = family[inearest];
+
+  // Load it, remembering which splines it adds
+  XSecSplineList * xspl = XSecSplineList::Instance();
+  set<string> prior_keys;
+  const vector<string> * keys = xspl->GetSplineKeys();
+  if(keys) {
+    prior_keys.insert(keys->begin(), keys->end());
+    delete keys;
+  }
+
+  LOG("DMUtils", pNOTICE) << "Loading the spline family file: " << ff.file;
+  XmlParserStatus_t status = xspl->LoadFromXml(ff.file, true);
+  if(status != kXmlOK) {
+    LOG("DMUtils", pERROR)
+      << "Could not load: " << ff.file << " (" << XmlParserStatus::AsString(status) << ")";
+    return false;
+  }
+  if(same(ff.gzp,gzp)) return true;
+
+  // Rescale its splines to the requested coupling: xsec ~ gzp^4
+  double scale = TMath::Power(gzp/ff.gzp, 4);
+  LOG("DMUtils", pNOTICE)
+    << "Rescaling the splines from Z' coupling = " << ff.gzp
+    << " to " << gzp << " (x " << scale << ")";
+  keys = xspl->GetSplineKeys();
+  if(!keys) return true;
+  for(unsigned int i = 0; i < keys->size(); i++) {
+    const string & key = (*keys)[i];
+    if(prior_keys.count(key) == 1) continue;
+    Spline spline(*xspl->GetSpline(key));
+    spline.Multiply(scale);
+    xspl->AddSpline(key, spline);
+  }
+  delete keys;
+
+  return true;
+}
+//____________________________________________________________________________
@@ -0,0 +1,59 @@
+//____________________________________________________________________________
+/*!
+
+\namespace genie::utils::dm
+
+\brief     Dark matter utilities: the dark matter model parameters a cross
+           section calculation depends on, and the families of cross section
+           splines built by gmkspl_dm over a grid of model parameters.
+
+           A spline family is a set of XML spline files, one per (DM mass,
+           mediator mass ratio, Z' coupling) grid point, named
+           <stem>.dm_m<mass>_r<ratio>_g<coupling>.xml (see SplineFamilyFile()).
+           The DMEL and DMDIS cross sections scale exactly as the 4th power of
+           the Z' coupling, so the splines of any coupling are obtained from
+           the family file of the nearest one. Thresholds and the kinematic
+           range depend on the masses, so the splines are not interpolated
+           in mass: The nearest (mass, ratio) point is used instead.
+
+\author    Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+           University of Liverpool & STFC Rutherford Appleton Lab
+
+\created   October 14, 2026
+
+\cpright   Copyright (c) 2003-2019, The GENIE Collaboration
+           For the full text of the license visit http://copyright.genie-mc.org
+           or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _DM_UTILS_H_
+#define _DM_UTILS_H_
+
+#include <string>
+
+using std::string;
+
+namespace genie {
+namespace utils {
+namespace dm    {
+
+  //! current Z' coupling (the BoostedDarkMatter ZpCoupling common parameter)
+  double ZpCoupling (void);
+
+  //! the DM model parameters (DM mass, mediator mass, Z' coupling) as a
+  //! string, to key results depending on them (eg max xsec cache branches)
+  string ParameterKey (void);
+
+  //! name of the spline family file of the given grid point
+  string SplineFamilyFile (string stem, double mass, double ratio, double gzp);
+
+  //! load the splines of the family file nearest to the given grid point,
+  //! rescaled to the given coupling; false if no family file was found
+  bool   LoadSplineFamily (string stem, double mass, double ratio, double gzp);
+
+} // dm    namespace
+} // utils namespace
+} // genie namespace
+
+#endif // _DM_UTILS_H_
@@ -82,6 +82,7 @@ void COHElKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  if(!fGenerateUniformly && xsec_max <= 0) return; // thread stopped by MaxXSec()
 
   //-- Get the kinematical limits for the generated x,y
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -98,6 +99,7 @@ void COHElKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("COHElKinematics", pWARN)
             << "*** Could not select a valid y after " << iter << " iterations";
@@ -143,7 +143,7 @@ void COHHadronicSystemGenerator::CalculateHadronicSystem_BergerSehgalFM(GHepReco
   double t    = interaction->Kine().t(true); 
   double MA   = init_state.Tgt().Mass(); 
   // double MA2  = TMath::Power(MA, 2.);   // Unused
-  double mpi  = PDGLibrary::Instance()->Find(pion_pdgc)->Mass();
+  double mpi  = PDGLibrary::Instance()->Mass(pion_pdgc);
   double mpi2 = TMath::Power(mpi,2);
 
   SLOG("COHHadronicVtx", pINFO) 
@@ -262,7 +262,7 @@ void COHHadronicSystemGenerator::CalculateHadronicSystem_ReinSehgal(GHepRecord *
   //-- basic kinematic inputs
   double E    = nu->E();  
   double M    = kNucleonMass;
-  double mpi  = PDGLibrary::Instance()->Find(pion_pdgc)->Mass();
+  double mpi  = PDGLibrary::Instance()->Mass(pion_pdgc);
   double mpi2 = TMath::Power(mpi,2);
   double xo   = interaction->Kine().x(true); 
   double yo   = interaction->Kine().y(true); 
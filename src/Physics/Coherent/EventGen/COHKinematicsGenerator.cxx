@@ -24,6 +24,13 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - CA
+   With UseEnvelope, sample the kinematics of all models against 2-D grid
+   envelopes of the xsec per E bin (see EnvelopeXSec2D()), instead of the
+   single max xsec. In the Berger-Sehgal FM model, |t| is then sampled
+   from the exponential approximation of the nuclear form factor.
+ @ Oct 14, 2026 - CA
+   Draw the kinematics random numbers through RandomGen::Next().
 
 */
 //____________________________________________________________________________
@@ -58,6 +65,12 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+// grid of the variables (besides the envelope ones) over which the
+// envelope node values are maximized
+static const int kCOHEnvNt   = 10; // t,            Berger-Sehgal FM
+static const int kCOHEnvNEl  = 5;  // lepton energy, Alvarez-Ruso
+static const int kCOHEnvNPhi = 4;  // pion phi,      Alvarez-Ruso
+
 //___________________________________________________________________________
 COHKinematicsGenerator::COHKinematicsGenerator() :
   KineGeneratorWithCache("genie::COHKinematicsGenerator")
@@ -119,7 +132,15 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
   //   value is found.
   //
   //   TODO: We are not offering the "fGenerateUniformly" option here.
-  double xsec_max = this->MaxXSec(evrec);
+  //   When available, an envelope of the xsec in (E,Q2,y) is used instead
+  //   of the max xsec.
+  KineEnvelope_t * envelope =
+         this->Envelope(interaction, this->Energy(interaction), 2);
+  double xsec_max = -1;
+  if(!envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
 
   //-- Get the kinematical limits for the generated x,y
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -137,17 +158,30 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
   unsigned int iter = 0;
   bool accept=false;
   double xsec=-1, gy=-1, gQ2=-1;
+  double J = 1; // d(Q2,y)/d(u,v) for the envelope variables
+  int icell = -1;
 
   while(1) {
     iter++;
-    if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
+    this->CountTrial();
+    if(iter > kRjMaxIterations) {
+      this->stopOnTooManyIterations(iter,evrec);
+      return;
+    }
 
-    //-- Select unweighted kinematics using importance sampling method. 
-    // TODO: The importance sampling envelope is not used. Currently, 
-    // we just employ a standard rejection-method approach.
+    //-- Select unweighted kinematics from the envelope, or using a
+    // standard rejection-method approach.
 
-    gy  = ymin  + dy  * rnd->RndKine().Rndm(); 
-    gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm(); 
+    if(envelope) {
+      double u = 0, v = 0;
+      this->SampleEnvelope2D(*envelope, rnd->Next(kRndStrKine),
+              rnd->Next(kRndStrKine), rnd->Next(kRndStrKine), u, v, icell);
+      xsec_max = envelope->value[icell];
+      J = this->EnvelopeVars(interaction, u, v, gQ2, gy);
+    } else {
+      gy  = ymin  + dy  * rnd->Next(kRndStrKine); 
+      gQ2 = Q2min + dQ2 * rnd->Next(kRndStrKine); 
+    }
 
     LOG("COHKinematics", pINFO) << 
       "Trying: Q^2 = " << gQ2 << ", y = " << gy; /* << ", t = " << gt; */
@@ -160,7 +194,11 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
     xsec = fXSecModel->XSec(interaction, kPSQ2yfE);
 
     //-- decide whether to accept the current kinematics
-    accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
+    if(envelope && J*xsec > xsec_max) {
+      // the envelope is not a bound here: raise it
+      this->RaiseEnvelope(envelope, icell, J*xsec);
+    }
+    accept = (xsec_max * rnd->Next(kRndStrKine) < J*xsec);
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
@@ -191,7 +229,7 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgal(GHepRecord * evrec) const
       double R2    = TMath::Power(R,2.);
       double b     = 0.33333 * R2;
       double tsum  = (TMath::Exp(-b*tmin) - TMath::Exp(-b*tmax))/b; 
-      double rt    = tsum * rnd->RndKine().Rndm();
+      double rt    = tsum * rnd->Next(kRndStrKine);
       double gt    = -1.*TMath::Log(-1.*b*rt + TMath::Exp(-1.*b*tmin))/b;
 
       // TODO: If we re-install the fGenerateUniformly option, we 
@@ -233,7 +271,16 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
   //   value is found.
   //
   //   TODO: We are not offering the "fGenerateUniformly" option here.
-  double xsec_max = this->MaxXSec(evrec);
+  //   When available, an envelope of the xsec in (E,Q2,y) is used instead
+  //   of the max xsec, with t generated from the nuclear form factor (see
+  //   EnvelopeXSec2D()).
+  KineEnvelope_t * envelope =
+         this->Envelope(interaction, this->Energy(interaction), 2);
+  double xsec_max = -1;
+  if(!envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
 
   //-- Get the kinematical limits for the generated x,y
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -256,18 +303,33 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
   unsigned int iter = 0;
   bool accept=false;
   double xsec=-1, gy=-1, gt=-1, gQ2=-1;
+  double J = 1; // d(Q2,y)/d(u,v) for the envelope variables / t pdf
+  int icell = -1;
 
   while(1) {
     iter++;
-    if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
-
-    //-- Select unweighted kinematics using importance sampling method. 
-    // TODO: The importance sampling envelope is not used. Currently, 
-    // we just employ a standard rejection-method approach.
+    this->CountTrial();
+    if(iter > kRjMaxIterations) {
+      this->stopOnTooManyIterations(iter,evrec);
+      return;
+    }
 
-    gy  = ymin  + dy  * rnd->RndKine().Rndm(); 
-    gt  = tmin  + dt  * rnd->RndKine().Rndm(); 
-    gQ2 = Q2min + dQ2 * rnd->RndKine().Rndm(); 
+    //-- Select unweighted kinematics from the envelope, with t from the
+    // form factor, or using a standard rejection-method approach.
+
+    if(envelope) {
+      double u = 0, v = 0;
+      this->SampleEnvelope2D(*envelope, rnd->Next(kRndStrKine),
+              rnd->Next(kRndStrKine), rnd->Next(kRndStrKine), u, v, icell);
+      xsec_max = envelope->value[icell];
+      J  = this->EnvelopeVars(interaction, u, v, gQ2, gy);
+      gt = this->SampleFormFactorT(interaction, tmin, tmax, rnd->Next(kRndStrKine));
+      J /= this->FormFactorTPdf(interaction, tmin, tmax, gt);
+    } else {
+      gy  = ymin  + dy  * rnd->Next(kRndStrKine); 
+      gt  = tmin  + dt  * rnd->Next(kRndStrKine); 
+      gQ2 = Q2min + dQ2 * rnd->Next(kRndStrKine); 
+    }
 
     LOG("COHKinematics", pINFO) << 
       "Trying: Q^2 = " << gQ2 << ", y = " << gy << ", t = " << gt;
@@ -280,7 +342,11 @@ void COHKinematicsGenerator::CalculateKin_BergerSehgalFM(GHepRecord * evrec) con
     xsec = fXSecModel->XSec(interaction, kPSxyfE);
 
     //-- decide whether to accept the current kinematics
-    accept = (xsec_max * rnd->RndKine().Rndm() < xsec);
+    if(envelope && J*xsec > xsec_max) {
+      // the envelope is not a bound here: raise it
+      this->RaiseEnvelope(envelope, icell, J*xsec);
+    }
+    accept = (xsec_max * rnd->Next(kRndStrKine) < J*xsec);
 
     //-- If the generated kinematics are accepted, finish-up module's job
     if(accept) {
@@ -325,7 +391,15 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   When available, an envelope of the xsec in (E,x,y) is used instead of
+  //   the max xsec and the analytical importance sampling envelope.
+  KineEnvelope_t * envelope = (fGenerateUniformly) ? 0 :
+         this->Envelope(interaction, this->Energy(interaction), 2);
+  double xsec_max = -1;
+  if(!fGenerateUniformly && !envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
 
   //-- Get the kinematical limits for the generated x,y
   const KPhaseSpace & kps = interaction->PhaseSpace();
@@ -344,15 +418,29 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
   unsigned int iter = 0;
   bool accept=false;
   double xsec=-1, gx=-1, gy=-1;
+  double J = 1; // d(x,y)/d(u,v) for the envelope variables
+  int icell = -1;
 
   while(1) {
     iter++;
-    if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
+    this->CountTrial();
+    if(iter > kRjMaxIterations) {
+      this->stopOnTooManyIterations(iter,evrec);
+      return;
+    }
 
     if(fGenerateUniformly) {
       //-- Generate a x,y pair uniformly in the kinematically allowed range.
-      gx = xmin + dx * rnd->RndKine().Rndm();
-      gy = ymin + dy * rnd->RndKine().Rndm();
+      gx = xmin + dx * rnd->Next(kRndStrKine);
+      gy = ymin + dy * rnd->Next(kRndStrKine);
+
+    } else if(envelope) {
+      //-- Select unweighted kinematics using the tabulated envelope.
+      double u = 0, v = 0;
+      this->SampleEnvelope2D(*envelope, rnd->Next(kRndStrKine),
+              rnd->Next(kRndStrKine), rnd->Next(kRndStrKine), u, v, icell);
+      xsec_max = envelope->value[icell];
+      J = this->EnvelopeVars(interaction, u, v, gx, gy);
 
     } else {
       //-- Select unweighted kinematics using importance sampling method. 
@@ -378,9 +466,17 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
     xsec = fXSecModel->XSec(interaction, kPSxyfE);
 
     //-- decide whether to accept the current kinematics
-    if(!fGenerateUniformly) {
+    if(envelope) {
+      if(J*xsec > xsec_max) {
+        // the envelope is not a bound here: raise it
+        this->RaiseEnvelope(envelope, icell, J*xsec);
+      }
+      else this->AssertXSecLimits(interaction, J*xsec, xsec_max);
+      accept = (xsec_max * rnd->Next(kRndStrKine) < J*xsec);
+    }
+    else if(!fGenerateUniformly) {
       double max = fEnvelope->Eval(gx, gy);
-      double t   = max * rnd->RndKine().Rndm();
+      double t   = max * rnd->Next(kRndStrKine);
 
       this->AssertXSecLimits(interaction, xsec, max);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -419,7 +515,7 @@ void COHKinematicsGenerator::CalculateKin_ReinSehgal(GHepRecord * evrec) const
       double R2    = TMath::Power(R,2.);
       double b     = 0.33333 * R2;
       double tsum  = (TMath::Exp(-b*tmin) - TMath::Exp(-b*tmax))/b; 
-      double rt    = tsum * rnd->RndKine().Rndm();
+      double rt    = tsum * rnd->Next(kRndStrKine);
       double gt    = -1.*TMath::Log(-1.*b*rt + TMath::Exp(-1.*b*tmin))/b;
 
       LOG("COHKinematics", pNOTICE)
@@ -477,7 +573,16 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   When available, an envelope of the xsec in (E,cos(theta_l),
+  //   cos(theta_pi)) is used instead of the max xsec, the lepton energy
+  //   and the azimuthal angles being generated uniformly.
+  KineEnvelope_t * envelope = (fGenerateUniformly) ? 0 :
+         this->Envelope(interaction, this->Energy(interaction), 2);
+  double xsec_max = -1;
+  if(!fGenerateUniformly && !envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
 
   //Set up limits of integration variables
   // Primary lepton energy
@@ -503,18 +608,32 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
   bool accept=false;
   double xsec=-1, g_E_l=-1, g_theta_l=-1, g_phi_l=-1, g_theta_pi=-1, g_phi_pi=-1;
   double g_ctheta_l, g_ctheta_pi;
+  double J = 1; // d(cos(theta_l),cos(theta_pi))/d(u,v) for the envelope variables
+  int icell = -1;
 
   while(1) {
     iter++;
-    if(iter > kRjMaxIterations) this->throwOnTooManyIterations(iter,evrec);
+    this->CountTrial();
+    if(iter > kRjMaxIterations) {
+      this->stopOnTooManyIterations(iter,evrec);
+      return;
+    }
 
     //Select kinematic point
-    g_E_l = E_l_min + d_E_l * rnd->RndKine().Rndm();
-    g_ctheta_l  = ctheta_l_min  + d_ctheta_l  * rnd->RndKine().Rndm();
-    g_ctheta_pi = ctheta_pi_min + d_ctheta_pi * rnd->RndKine().Rndm();
-    g_phi_l = phi_min + d_phi * rnd->RndKine().Rndm();
+    g_E_l = E_l_min + d_E_l * rnd->Next(kRndStrKine);
+    if(envelope) {
+      double u = 0, v = 0;
+      this->SampleEnvelope2D(*envelope, rnd->Next(kRndStrKine),
+              rnd->Next(kRndStrKine), rnd->Next(kRndStrKine), u, v, icell);
+      xsec_max = envelope->value[icell];
+      J = this->EnvelopeVars(interaction, u, v, g_ctheta_l, g_ctheta_pi);
+    } else {
+      g_ctheta_l  = ctheta_l_min  + d_ctheta_l  * rnd->Next(kRndStrKine);
+      g_ctheta_pi = ctheta_pi_min + d_ctheta_pi * rnd->Next(kRndStrKine);
+    }
+    g_phi_l = phi_min + d_phi * rnd->Next(kRndStrKine);
     // random phi is relative to phi_l
-    g_phi_pi = g_phi_l + (phi_min + d_phi * rnd->RndKine().Rndm()); 
+    g_phi_pi = g_phi_l + (phi_min + d_phi * rnd->Next(kRndStrKine)); 
     g_theta_l = TMath::ACos(g_ctheta_l);
     g_theta_pi = TMath::ACos(g_ctheta_pi);
 
@@ -530,17 +649,21 @@ void COHKinematicsGenerator::CalculateKin_AlvarezRuso(GHepRecord * evrec) const
 
     if (!fGenerateUniformly) {
       //-- decide whether to accept the current kinematics
-      double t   = xsec_max * rnd->RndKine().Rndm();
+      double t   = xsec_max * rnd->Next(kRndStrKine);
 
       LOG("COHKinematics", pINFO) << "Got: xsec = " << xsec << ", t = " << 
         t << " (max_xsec = " << xsec_max << ")";
 
-      this->AssertXSecLimits(interaction, xsec, xsec_max);
+      if(envelope && J*xsec > xsec_max) {
+        // the envelope is not a bound here: raise it
+        this->RaiseEnvelope(envelope, icell, J*xsec);
+      }
+      else this->AssertXSecLimits(interaction, J*xsec, xsec_max);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
       LOG("COHKinematics", pDEBUG)
-        << "xsec= " << xsec << ", J= 1, Rnd= " << t;
+        << "xsec= " << xsec << ", J= " << J << ", Rnd= " << t;
 #endif
-      accept = (t<xsec);
+      accept = (t<J*xsec);
     }
     else {
       accept = (xsec>0);
@@ -938,6 +1061,148 @@ double COHKinematicsGenerator::MaxXSec_AlvarezRuso(const Interaction * in) const
   return max_xsec;
 }
 //___________________________________________________________________________
+double COHKinematicsGenerator::EnvelopeXSec2D(
+                    Interaction * interaction, double u, double v) const
+{
+// d^2xsec/dudv for the (E,u,v) envelope (see KineGeneratorWithCache::
+// Envelope()), with (u,v) the normalized envelope variables of the model
+// (see EnvelopeVars()). The differential xsec is maximized over the other
+// kinematic variables, that are not sampled from the envelope: t for the
+// Berger-Sehgal FM model (weighted by the inverse of the t pdf, see
+// FormFactorTPdf()), the lepton energy and pion azimuth for Alvarez-Ruso.
+// These maxima are taken over coarse grids and are not strict bounds: the
+// envelope safety factor and raising the envelope cells cover the rest.
+
+  if(!interaction->PhaseSpace().IsAboveThreshold()) return 0.;
+
+  double k1 = 0, k2 = 0;
+  double J = this->EnvelopeVars(interaction, u, v, k1, k2);
+  if(J <= 0.) return 0.;
+
+  Kinematics * kine = interaction->KinePtr();
+  string model = fXSecModel->Id().Name();
+  double xsec = 0;
+
+  if (model == "genie::ReinSehgalCOHPiPXSec") {
+    kine->Setx(k1);
+    kine->Sety(k2);
+    xsec = fXSecModel->XSec(interaction, kPSxyfE);
+  }
+  else if (model == "genie::BergerSehgalCOHPiPXSec2015") {
+    kine->SetQ2(k1);
+    kine->Sety(k2);
+    kinematics::UpdateXFromQ2Y(interaction);
+    xsec = fXSecModel->XSec(interaction, kPSQ2yfE);
+  }
+  else if (model == "genie::BergerSehgalFMCOHPiPXSec2015") {
+    kine->SetQ2(k1);
+    kine->Sety(k2);
+    const double tmin = kASmallNum;
+    const double tmax = fTMax - kASmallNum;
+    for(int it = 0; it < kCOHEnvNt; it++) {
+      double t = tmin * TMath::Power(tmax/tmin, (it + 0.5)/kCOHEnvNt);
+      kine->Sett(t);
+      double xsec_t = fXSecModel->XSec(interaction, kPSxyfE) /
+                      this->FormFactorTPdf(interaction, tmin, tmax, t);
+      xsec = TMath::Max(xsec, xsec_t);
+    }
+  }
+  else if (model == "genie::AlvarezRusoCOHPiPXSec") {
+    const double E_l_min = interaction->FSPrimLepton()->Mass();
+    const double E_l_max = 
+         interaction->InitStatePtr()->GetProbeP4(kRfLab)->E() - kPionMass;
+    if(E_l_max <= E_l_min) return 0.;
+    double theta_l  = TMath::ACos(k1);
+    double theta_pi = TMath::ACos(k2);
+    for(int iel = 0; iel < kCOHEnvNEl; iel++) {
+      double E_l = E_l_min + (E_l_max - E_l_min) * (iel + 0.5)/kCOHEnvNEl;
+      for(int iphi = 0; iphi < kCOHEnvNPhi; iphi++) {
+        double phi_pi = 2*kPi * iphi/kCOHEnvNPhi;
+        this->SetKinematics(E_l, theta_l, 0., theta_pi, phi_pi,
+                            interaction, kine);
+        double xsec_k = 
+           fXSecModel->XSec(interaction,kPSElOlOpifE) / (1E-38 * units::cm2);
+        xsec = TMath::Max(xsec, xsec_k);
+      }
+    }
+  }
+
+  return J * xsec;
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::EnvelopeVars(const Interaction * interaction,
+                    double u, double v, double & k1, double & k2) const
+{
+// Maps the envelope variables (u,v) in [0,1] to the kinematic variables
+// sampled from the envelope, and returns the Jacobian d(k1,k2)/d(u,v)
+// (0 if no phase space):
+//   Rein-Sehgal   : (x,y)  with x logarithmic and y linear in their limits
+//   Berger-Sehgal : (Q2,y) with Q2 logarithmic and y linear in their limits
+//   Alvarez-Ruso  : (cos(theta_l),cos(theta_pi)), linear in [0.4,1]
+
+  string model = fXSecModel->Id().Name();
+
+  if (model == "genie::AlvarezRusoCOHPiPXSec") {
+    const double cmin = 0.4;
+    const double cmax = 1.0 - kASmallNum;
+    k1 = cmin + (cmax - cmin) * u;
+    k2 = cmin + (cmax - cmin) * v;
+    return (cmax - cmin) * (cmax - cmin);
+  }
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t y = kps.YLim();
+  const double ymin = y.min + kASmallNum;
+  const double ymax = y.max - kASmallNum;
+  if(ymax <= ymin) return 0.;
+  k2 = ymin + (ymax - ymin) * v;
+
+  double k1min = 0, k1max = 0;
+  if (model == "genie::ReinSehgalCOHPiPXSec") {
+    k1min = kASmallNum;
+    k1max = 1. - kASmallNum;
+  } else {
+    k1min = fQ2Min + kASmallNum;
+    k1max = fQ2Max - kASmallNum;
+  }
+  if(k1min <= 0 || k1max <= k1min) return 0.;
+  double ln = TMath::Log(k1max/k1min);
+  k1 = k1min * TMath::Exp(ln * u);
+
+  return k1 * ln * (ymax - ymin);
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::FormFactorSlope(const Interaction * in) const
+{
+// Slope b of the exponential approximation exp(-b|t|) of the nuclear form
+// factor squared, b = R^2/3 with R = Ro*A^(1/3)
+
+  double A = in->InitState().Tgt().A();
+  double R = fRo * TMath::Power(A, 1./3.) * units::fermi;
+  return R*R/3.;
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::FormFactorTPdf(const Interaction * in,
+                    double tmin, double tmax, double t) const
+{
+// The exp(-b|t|) pdf of t in [tmin,tmax]
+
+  double b = this->FormFactorSlope(in);
+  double norm = TMath::Exp(-b*tmin) - TMath::Exp(-b*tmax);
+  return b * TMath::Exp(-b*t) / norm;
+}
+//___________________________________________________________________________
+double COHKinematicsGenerator::SampleFormFactorT(const Interaction * in,
+                    double tmin, double tmax, double r) const
+{
+// Samples t in [tmin,tmax] from the exp(-b|t|) pdf (see FormFactorTPdf())
+
+  double b = this->FormFactorSlope(in);
+  double emin = TMath::Exp(-b*tmin);
+  double emax = TMath::Exp(-b*tmax);
+  return -TMath::Log(emin - r * (emin - emax)) / b;
+}
+//___________________________________________________________________________
 double COHKinematicsGenerator::Energy(const Interaction * interaction) const
 {
   // Override the base class Energy() method to cache the max xsec for the
@@ -959,8 +1224,8 @@ double COHKinematicsGenerator::pionMass(const Interaction* in) const
   return m_pi;
 }
 //___________________________________________________________________________
-void COHKinematicsGenerator::throwOnTooManyIterations(unsigned int iters,
-                                                      GHepRecord* evrec) const
+void COHKinematicsGenerator::stopOnTooManyIterations(unsigned int iters,
+                                                     GHepRecord* evrec) const
 {
   LOG("COHKinematics", pWARN)
     << "*** Could not select valid kinematics after "
@@ -969,7 +1234,7 @@ void COHKinematicsGenerator::throwOnTooManyIterations(unsigned int iters,
   genie::exceptions::EVGThreadException exception;
   exception.SetReason("Couldn't select kinematics");
   exception.SwitchOnFastForward();
-  throw exception;
+  this->StopThread(exception);
 }
 //___________________________________________________________________________
 void COHKinematicsGenerator::Configure(const Registry & config)
@@ -1007,6 +1272,12 @@ void COHKinematicsGenerator::LoadConfig(void)
   GetParamDef( "MaxXSec-DiffTolerance", fMaxXSecDiffTolerance, 999999. ) ;
     assert(fMaxXSecDiffTolerance>=0);
 
+  //-- Sample the kinematics against the tabulated xsec envelopes?
+  GetParamDef( "UseEnvelope", fUseEnvelope, true ) ;
+  GetParamDef( "Envelope-SafetyFactor", fEnvelopeSafety, 1.2 ) ;
+  fEnvelopes.clear();
+  fEnvelopeEdges.clear();
+
   //-- Envelope employed when importance sampling is used 
   //   (initialize with dummy range)
   if(fEnvelope) delete fEnvelope;
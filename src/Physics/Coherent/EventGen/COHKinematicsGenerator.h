@@ -68,13 +68,22 @@ namespace genie {
     // overload KineGeneratorWithCache method to get energy
     double Energy         (const Interaction * in) const;
 
+    // overload KineGeneratorWithCache method to tabulate the xsec envelopes
+    double EnvelopeXSec2D (Interaction * in, double u, double v) const;
+    int    EnvelopeDim    (void) const { return 2; }
+
     // TODO: should fEnvelope and fRo be public? They look like they should be private
     mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
     double fRo;              ///< nuclear scale parameter
 
   private:
     double pionMass(const Interaction* in) const;
-    void   throwOnTooManyIterations(unsigned int iters, GHepRecord* evrec) const;
+    void   stopOnTooManyIterations(unsigned int iters, GHepRecord* evrec) const;
+    double EnvelopeVars     (const Interaction * in, double u, double v, 
+                             double & k1, double & k2) const;
+    double FormFactorSlope  (const Interaction * in) const;
+    double FormFactorTPdf   (const Interaction * in, double tmin, double tmax, double t) const;
+    double SampleFormFactorT(const Interaction * in, double tmin, double tmax, double r) const;
 
     double fQ2Min;  ///< lower bound of integration for Q^2 in Berger-Sehgal Model
     double fQ2Max;  ///< upper bound of integration for Q^2 in Berger-Sehgal Model
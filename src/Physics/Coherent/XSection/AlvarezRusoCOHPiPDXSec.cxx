@@ -17,6 +17,9 @@
 #include <string>
 #include <cstdlib>
 #include <complex>
+#include <list>
+#include <map>
+#include <vector>
 
 // Root
 #include <TVector3.h>
@@ -43,6 +46,9 @@ typedef std::complex<double> cdouble;
 typedef ROOT::Math::LorentzVector<ROOT::Math::PxPyPzE4D<double> > LorentzVector;
 typedef ROOT::Math::SVector< cdouble , 4> CVector;
 
+// max number of pion energies for which the wavefunctions are cached
+static const unsigned int kWFCacheSize = 500;
+
 namespace genie {
 namespace alvarezruso {
 
@@ -141,6 +147,15 @@ double AlvarezRusoCOHPiPDXSec::DXSec( const double E_nu_, const double E_l_, con
 
 
 
+bool AlvarezRusoCOHPiPDXSec::Matches(unsigned int Z_, unsigned int A_, 
+   const current_t current_, const flavour_t flavour_, const nutype_t nutype_, 
+   const formfactors_t ff_) const
+{
+  return ( fZ == Z_ && fA == A_ && current == current_ && flavour == flavour_ &&
+           nutype == nutype_ && formfactors == ff_ );
+}
+
+
 cdouble AlvarezRusoCOHPiPDXSec::H(unsigned int i, unsigned int j) const
 {
   cdouble H_ = ( conj(fJ_hadronic[i]) * fJ_hadronic[j] );
@@ -296,12 +311,33 @@ void AlvarezRusoCOHPiPDXSec::SetCurrent()
 /// This is only a function of the nucleus and pion momentum/energy
 /// so if neither of those have changed there is no need to re-calculate
 /// the wavefunction values.
-/// Such a caching has not been implemented here yet!
+/// The wavefunctions (and derivatives) are cached per pion energy: the
+/// integrators evaluate the cross section at many points sharing the
+/// same lepton (and therefore pion) energy.
 
 void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
 {
   unsigned int n_points = fNucleus->GetNDensities();
   
+  const double E_pi = fP_pi.E();
+  
+  std::map<double, std::vector<cdouble> >::const_iterator wfit = fWFCache.find(E_pi);
+  if(wfit != fWFCache.end())
+  {
+    const std::vector<cdouble> & wf = wfit->second;
+    unsigned int k = 0;
+    for(unsigned int i = 0; i != n_points; ++i)
+    {
+      for(unsigned int j = 0; j != n_points; ++j)
+      {
+        fUwave->set(i, j, wf[k++]);
+        fUwaveDr->set(i, j, wf[k++]);
+        fUwaveDtheta->set(i, j, wf[k++]);
+      }
+    }
+    return;
+  }
+  
   double x2;
   double radius;
   double cosine_rz; // angle w.r.t the pion momentum
@@ -353,6 +389,24 @@ void AlvarezRusoCOHPiPDXSec::SolveWavefunctions()
     }
   }
   
+  // Store the solution, dropping the oldest one if the cache is full
+  if(fWFCache.size() >= kWFCacheSize)
+  {
+    fWFCache.erase(fWFCacheOrder.front());
+    fWFCacheOrder.pop_front();
+  }
+  std::vector<cdouble> & wf = fWFCache[E_pi];
+  wf.reserve(3*n_points*n_points);
+  for(unsigned int i = 0; i != n_points; ++i)
+  {
+    for(unsigned int j = 0; j != n_points; ++j)
+    {
+      wf.push_back((*fUwave)[i][j]);
+      wf.push_back((*fUwaveDr)[i][j]);
+      wf.push_back((*fUwaveDtheta)[i][j]);
+    }
+  }
+  fWFCacheOrder.push_back(E_pi);
 }
 
 cdouble AlvarezRusoCOHPiPDXSec::DeltaPropagatorInMed(LorentzVector delta_momentum)
@@ -723,6 +777,157 @@ void AlvarezRusoCOHPiPDXSec::NuclearCurrent(LorentzVector q, LorentzVector pdir,
   std::vector<cdouble > jnuclear(4);
   
   
+  // The currents below are linear in bej0*uwavefunc and in the components of
+  // the distorted pion momentum, with coefficients depending only on the
+  // momentum transfer: compute the coefficients once, evaluating the currents
+  // for unit values of each of these 4 terms, rather than at every sampling
+  // point
+  CVector jc1[4], jc2[4], jc3[4], jc4[4];
+  for(int k = 0; k != 4; ++k)
+  {
+    cdouble bu = (k == 0) ? 1.0 : 0.0;
+    ppi1d      = (k == 1) ? 1.0 : 0.0;
+    ppi2d      = (k == 2) ? 1.0 : 0.0;
+    ppi3d      = (k == 3) ? 1.0 : 0.0;
+
+    j1[0] = -4.*(mdel + mn + q0)*(
+       (C5a*mdel2*mn2*q0 + C6a*mdel2*q03 + C5a*mn2*(-mn - q0)*q0*(mn + q0) -
+         C4a*mdel2*q0*q12 - C4a*mdel2*q0*q32 - C6a*q02*(mn + q0)*(q0*(mn + q0) - q12 - q32))*bu +
+       ppi1d*(-(C5a*mn2*(-mn - q0)*q1) - C6a*mdel2*q0*q1 + C4a*mdel2*(mn + q0)*q1 +
+         C6a*q0*q1*(q0*(mn + q0) - q12 - q32)) +
+       ppi3d*(-(C5a*mn2*(-mn - q0)*q3) - 
+         C6a*mdel2*q0*q3 + C4a*mdel2*(mn + q0)*q3 + C6a*q0*q3*(q0*(mn + q0) - q12 - q32))
+       );
+
+    j1[1] = (-4.*C6a*mdel3*q02*q1 - 4.*C6a*mdel2*mn*q02*q1 + 4.*C6a*mdel*mn2*q02*q1 + 4.*C6a*mn3*q02*q1 - 
+        4.*C6a*mdel2*q03*q1 + 8.*C6a*mdel*mn*q03*q1 + 12.*C6a*mn2*q03*q1 + 4.*C6a*mdel*q04*q1 + 
+        12.*C6a*mn*q04*q1 + 4.*C6a*q05*q1 + 4.*C4a*mdel2*q02*(mdel + mn + q0)*q1 + 
+        4.*C5a*mn2*q0*(mn + q0)*(mdel + mn + q0)*q1 - 4.*C6a*mdel*mn*q0*q13 - 4.*C6a*mn2*q0*q13 - 
+        4.*C6a*mdel*q02*q13 - 8.*C6a*mn*q02*q13 - 4.*C6a*q03*q13 - 
+        4.*C6a*q0*(mn + q0)*(mdel + mn + q0)*q1*q32)*bu + 
+      ppi1d*(-4.*C4a*mdel2*q0*(mn + q0)*(mdel + mn + q0) + 4.*C6a*mdel3*q12 + 4.*C6a*mdel2*mn*q12 + 
+        4.*C6a*mdel2*q0*q12 - 4.*C6a*mdel*mn*q0*q12 - 4.*C6a*mn2*q0*q12 - 4.*C6a*mdel*q02*q12 - 
+        8.*C6a*mn*q02*q12 - 4.*C6a*q03*q12 + 4.*C6a*mdel*q14 + 4.*C6a*mn*q14 + 4.*C6a*q0*q14 - 
+        4.*C5a*mn2*(mdel + mn + q0)*(mdel2 + q12) + 4.*C4a*mdel2*(mdel + mn + q0)*q32 + 
+        4.*C6a*(mdel + mn + q0)*q12*q32) +
+      ppi2d*(twoI*C4v*mdel2*(q0*(mn + q0) - q12)*q3 + 
+        twoI*C3v*mdel*mn*(2*mdel2 + 2.*mdel*mn - q0*(mn + q0) + q12)*q3 - 
+        twoI*mdel*(C4v*mdel - C3v*mn)*q33) + 
+      ppi3d*(-4.*C4a*mdel2*(mdel + mn + q0)*q1*q3 - 
+        4.*C5a*mn2*(mdel + mn + q0)*q1*q3 + 4.*C6a*(mdel + mn + q0)*q1*(mdel2 - q0*(mn + q0) + q12)*q3 + 
+        4.*C6a*(mdel + mn + q0)*q1*q33) +
+      ppi2d*twoI*C5v*mdel2*mn*q0*q3;
+    
+    j1[2] = -2.*I*(-2.*I*C5a*mdel*mn2*ppi2d*(mdel + mn + q0) - 
+        twoI*C4a*mdel*ppi2d*(mdel + mn + q0)*(q0*(mn + q0) - q12 - q32) - 
+        (ppi3d*q1 - ppi1d*q3)*(C4v*mdel*(q0*(mn + q0) - q12 - q32) + 
+        C3v*mn*(2*mdel2 + 2*mdel*mn - q0*(mn + q0) + q12 + q32)))*mdel + 
+      twoI*C5v*mdel*mn*q0*(ppi3d*q1 - ppi1d*q3)*mdel;
+
+    j1[3] = (4.*C4a*mdel2*q02*(mdel + mn + q0)*q3 - 4.*C6a*mdel2*q02*(mdel + mn + q0)*q3 + 
+        4.*C5a*mn2*q0*(mn + q0)*(mdel + mn + q0)*q3 + 4.*C6a*q0*(mn + q0)*(mdel + mn + q0)*
+        (q0*(mn + q0) - q12)*q3 - 4.*C6a*q0*(mn + q0)*(mdel + mn + q0)*q33)*bu + 
+      ppi2d*(-twoI*mdel*q1*(C4v*mdel*(q0*(mn + q0) - q12) + 
+        C3v*mn*(2.*mdel2 + 2*mdel*mn - q0*(mn + q0) + q12)) + twoI*mdel*
+        (C4v*mdel - C3v*mn)*q1*q32) +
+      ppi1d*(-4.*C4a*mdel2*(mdel + mn + q0)*q1*q3 + 
+        4.*C6a*mdel2*(mdel + mn + q0)*q1*q3 - 4.*C5a*mn2*(mdel + mn + q0)*q1*q3 - 
+        4.*C6a*(mdel + mn + q0)*q1*(q0*(mn + q0) - q12)*q3 + 4.*C6a*(mdel + mn + q0)*q1*q33) + 
+      ppi3d*(-4.*C4a*mdel2*mn*q0*(mdel + mn + q0) - 4.*C4a*mdel2*(mdel + mn + q0)*(q0 - q1)*(q0 + q1) + 
+        4.*C6a*(mdel + mn + q0)*(mdel2 - q0*(mn + q0) + q12)*q32 + 4.*C6a*(mdel + mn + q0)*q34 - 
+        4.*C5a*mn2*(mdel + mn + q0)*(mdel2 + q32)) + 
+      -twoI*C5v*mdel2*mn*ppi2d*q0*q1;
+    
+    // Crossed Delta
+    
+    j2[0]=-4.*(mdel + mn - q0)*(
+      (C5a*mdel2*mn2*q0 - C5a*mn2*(mn - q0)*(mn - q0)*q0 + C6a*mdel2*q03 - 
+        C4a*mdel2*q0*q12 - C4a*mdel2*q0*q32 - C6a*(mn - q0)*q02*((mn - q0)*q0 + q12 + q32))*bu + 
+      ppi1d*(-(C4a*mdel2*mn*q1) - C5a*mn2*(mn - q0)*q1 + C4a*mdel2*q0*q1 - 
+        C6a*mdel2*q0*q1 - C6a*q0*q1*((mn - q0)*q0 + q12 + q32)) + 
+      ppi3d*(-(C4a*mdel2*mn*q3) - C5a*mn2*(mn - q0)*q3 + C4a*mdel2*q0*q3 - 
+        C6a*mdel2*q0*q3 - C6a*q0*q3*((mn - q0)*q0 + q12 + q32)));
+
+    j2[1]=(-4.*C5a*mn2*(mn - q0)*(mdel + mn - q0)*q0*q1 - 4.*C6a*mdel3*q02*q1 - 
+        4.*C6a*mdel2*mn*q02*q1 + 4.*C6a*mdel*mn2*q02*q1 + 4.*C6a*mn3*q02*q1 + 
+        4.*C4a*mdel2*(mdel + mn - q0)*q02*q1 + 4.*C6a*mdel2*q03*q1 - 
+        8.*C6a*mdel*mn*q03*q1 - 12.*C6a*mn2*q03*q1 + 4.*C6a*mdel*q04*q1 + 
+        12.*C6a*mn*q04*q1 - 4.*C6a*q05*q1 + 4.*C6a*mdel*mn*q0*q13 + 
+        4.*C6a*mn2*q0*q13 - 4.*C6a*mdel*q02*q13 - 8.*C6a*mn*q02*q13 + 
+        4.*C6a*q03*q13 + 4.*C6a*(mn - q0)*(mdel + mn - q0)*q0*q1*q32)*bu + 
+      ppi1d*(-4.*C5a*mdel2*mn2*(mdel + mn - q0) + 4.*C4a*mdel2*mn*(mdel + mn - q0)*q0 - 
+        4.*C4a*mdel2*(mdel + mn - q0)*q02 + 4.*C6a*mdel3*q12 + 
+        4.*C6a*mdel2*mn*q12 - 4.*C5a*mn2*(mdel + mn - q0)*q12 - 
+        4.*C6a*mdel2*q0*q12 + 4.*C6a*mdel*mn*q0*q12 + 4.*C6a*mn2*q0*q12 - 
+        4.*C6a*mdel*q02*q12 - 8.*C6a*mn*q02*q12 + 4.*C6a*q03*q12 + 
+        4.*C6a*mdel*q14 + 4.*C6a*mn*q14 - 4.*C6a*q0*q14 + 
+        4.*C4a*mdel2*(mdel + mn - q0)*q32 + 4.*C6a*(mdel + mn - q0)*q12*q32) + 
+      ppi2d*(twoI*mdel*(mdel*q0*(-((C4v + C5v)*mn) + C4v*q0) + 
+        C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02))*q3 + 
+        twoI*mdel*(-(C4v*mdel) + C3v*mn)*q12*q3 - twoI*mdel*(C4v*mdel - C3v*mn)*q33) +
+      ppi3d*(-4.*C4a*mdel2*(mdel + mn - q0)*q1*q3 - 
+        4.*C5a*mn2*(mdel + mn - q0)*q1*q3 + 4.*C6a*(mdel + mn - q0)*(mdel2 + (mn - q0)*q0)*q1*q3 + 
+        4.*C6a*(mdel + mn - q0)*q13*q3 + 4.*C6a*(mdel + mn - q0)*q1*q33);
+
+    j2[2]=-(twoI*ppi2d*(-twoI*C5a*mdel*mn2*(mdel + mn - q0) +
+        twoI*C4a*mdel*(mdel + mn - q0)*((mn - q0)*q0 + q12 + q32)) - 
+      ppi3d*twoI*q1*(C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02 + q12 + q32) - 
+        mdel*(C5v*mn*q0 + C4v*((mn - q0)*q0 + q12 + q32))) + 
+      ppi1d*twoI*q3*(C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02 + q12 + q32) - 
+        mdel*(C5v*mn*q0 + C4v*((mn - q0)*q0 + q12 + q32)))
+      )*mdel;
+
+    j2[3] = (-4.*C5a*mn2*(mn - q0)*(mdel + mn - q0)*q0*q3 +
+        4.*C4a*mdel2*(mdel + mn - q0)*q02*q3 - 4.*C6a*mdel2*(mdel + mn - q0)*q02*q3 + 
+        4.*C6a*(mn - q0)*(mdel + mn - q0)*q0*((mn - q0)*q0 + q12)*q3 + 
+        4.*C6a*(mn - q0)*(mdel + mn - q0)*q0*q33)*bu + 
+      ppi2d*(-twoI*mdel*q1*(C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02 + q12) - 
+        mdel*(q0*((C4v + C5v)*mn - C4v*q0) + C4v*q12)) + 
+        twoI*mdel*(C4v*mdel - C3v*mn)*q1*q32) + 
+      ppi1d*(-4.*C4a*mdel2*(mdel + mn - q0)*q1*q3 + 4.*C6a*mdel2*(mdel + mn - q0)*q1*q3 - 
+        4.*C5a*mn2*(mdel + mn - q0)*q1*q3 + 
+        4.*C6a*(mdel + mn - q0)*q1*((mn - q0)*q0 + q12)*q3 + 
+        4.*C6a*(mdel + mn - q0)*q1*q33) + 
+      ppi3d*(-4.*C5a*mdel2*mn2*(mdel + mn - q0) + 
+        4.*C4a*mdel2*(mdel + mn - q0)*((mn - q0)*q0 + q12) -
+        4.*C5a*mn2*(mdel + mn - q0)*q32 + 
+        4.*C6a*(mdel + mn - q0)*(mdel2 + (mn - q0)*q0 + q12)*q32 + 
+        4.*C6a*(mdel + mn - q0)*q34);
+    
+    //
+    // Direct Nucleon
+    
+    j3[0]=-2.0*(FA - FP*q0)*(q02*bu - ppi1d*q1 - ppi3d*q3);
+    
+    j3[1] = 2.0*(-(FA*q0*q1) + FP*q02*q1) * bu +
+      2.0*ppi1d*(2.0*FA*mn + FA*q0 - FP*q12) -
+      twoI*(F1 + F2)*ppi2d*q3 - 2.*FP*ppi3d*q1*q3;
+
+    j3[2]=twoI*(-I*FA*ppi2d*(2.0*mn + q0) - (F1 + F2)*(ppi3d*q1 - ppi1d*q3));
+
+    j3[3]=twoI*(F1 + F2)*ppi2d*q1 - 2.0*FP*ppi1d*q1*q3 + 
+      2.0*(-(FA*q0*q3) + FP*q02*q3)*bu +
+      2.0*ppi3d*(2.0*FA*mn + FA*q0 - FP*q32);
+    
+    //
+    // Crossed Nucleon
+    
+    j4[0] = 2.0*(FA + FP*q0)*(q02  *bu - ppi1d*q1 - ppi3d*q3);
+
+    j4[1] = -2.0*(-(FA*q0*q1) - FP*q02*q1)*bu - 2.0*ppi1d*(-2.0*FA*mn + FA*q0 + FP*q12) - 
+      twoI*(F1 + F2)*ppi2d*q3 - 2.0*FP*ppi3d*q1*q3;
+
+    j4[2] = twoI*(-I*FA*ppi2d*(2.0*mn - q0) - (F1 + F2)*(ppi3d*q1 - ppi1d*q3));
+
+    j4[3] = twoI*(F1 + F2)*ppi2d*q1 - 2.0*FP*ppi1d*q1*q3 + 2.0*(FA*q0*q3 + FP*q02*q3)*bu + 
+      2.0*ppi3d*(2.0*FA*mn - FA*q0 - FP*q32);
+
+    jc1[k] = j1;
+    jc2[k] = j2;
+    jc3[k] = j3;
+    jc4[k] = j4;
+  }
+  
   for(unsigned int i = 0; i != n; ++i)
   {
     double be = fNucleus->SamplePoint1(i);
@@ -783,137 +988,14 @@ void AlvarezRusoCOHPiPDXSec::NuclearCurrent(LorentzVector q, LorentzVector pdir,
       // j2 : current for Crossed delta production
       // j3 : current for direct nucleon production
       // j4 : current for crossed nucleon production
-      j1[0] = -4.*(mdel + mn + q0)*(
-         (C5a*mdel2*mn2*q0 + C6a*mdel2*q03 + C5a*mn2*(-mn - q0)*q0*(mn + q0) -
-           C4a*mdel2*q0*q12 - C4a*mdel2*q0*q32 - C6a*q02*(mn + q0)*(q0*(mn + q0) - q12 - q32))*bej0*uwavefunc +
-         ppi1d*(-(C5a*mn2*(-mn - q0)*q1) - C6a*mdel2*q0*q1 + C4a*mdel2*(mn + q0)*q1 +
-           C6a*q0*q1*(q0*(mn + q0) - q12 - q32)) +
-         ppi3d*(-(C5a*mn2*(-mn - q0)*q3) - 
-           C6a*mdel2*q0*q3 + C4a*mdel2*(mn + q0)*q3 + C6a*q0*q3*(q0*(mn + q0) - q12 - q32))
-         );
-
-      j1[1] = (-4.*C6a*mdel3*q02*q1 - 4.*C6a*mdel2*mn*q02*q1 + 4.*C6a*mdel*mn2*q02*q1 + 4.*C6a*mn3*q02*q1 - 
-          4.*C6a*mdel2*q03*q1 + 8.*C6a*mdel*mn*q03*q1 + 12.*C6a*mn2*q03*q1 + 4.*C6a*mdel*q04*q1 + 
-          12.*C6a*mn*q04*q1 + 4.*C6a*q05*q1 + 4.*C4a*mdel2*q02*(mdel + mn + q0)*q1 + 
-          4.*C5a*mn2*q0*(mn + q0)*(mdel + mn + q0)*q1 - 4.*C6a*mdel*mn*q0*q13 - 4.*C6a*mn2*q0*q13 - 
-          4.*C6a*mdel*q02*q13 - 8.*C6a*mn*q02*q13 - 4.*C6a*q03*q13 - 
-          4.*C6a*q0*(mn + q0)*(mdel + mn + q0)*q1*q32)*bej0*uwavefunc + 
-        ppi1d*(-4.*C4a*mdel2*q0*(mn + q0)*(mdel + mn + q0) + 4.*C6a*mdel3*q12 + 4.*C6a*mdel2*mn*q12 + 
-          4.*C6a*mdel2*q0*q12 - 4.*C6a*mdel*mn*q0*q12 - 4.*C6a*mn2*q0*q12 - 4.*C6a*mdel*q02*q12 - 
-          8.*C6a*mn*q02*q12 - 4.*C6a*q03*q12 + 4.*C6a*mdel*q14 + 4.*C6a*mn*q14 + 4.*C6a*q0*q14 - 
-          4.*C5a*mn2*(mdel + mn + q0)*(mdel2 + q12) + 4.*C4a*mdel2*(mdel + mn + q0)*q32 + 
-          4.*C6a*(mdel + mn + q0)*q12*q32) +
-        ppi2d*(twoI*C4v*mdel2*(q0*(mn + q0) - q12)*q3 + 
-          twoI*C3v*mdel*mn*(2*mdel2 + 2.*mdel*mn - q0*(mn + q0) + q12)*q3 - 
-          twoI*mdel*(C4v*mdel - C3v*mn)*q33) + 
-        ppi3d*(-4.*C4a*mdel2*(mdel + mn + q0)*q1*q3 - 
-          4.*C5a*mn2*(mdel + mn + q0)*q1*q3 + 4.*C6a*(mdel + mn + q0)*q1*(mdel2 - q0*(mn + q0) + q12)*q3 + 
-          4.*C6a*(mdel + mn + q0)*q1*q33) +
-        ppi2d*twoI*C5v*mdel2*mn*q0*q3;
-    
-      j1[2] = -2.*I*(-2.*I*C5a*mdel*mn2*ppi2d*(mdel + mn + q0) - 
-          twoI*C4a*mdel*ppi2d*(mdel + mn + q0)*(q0*(mn + q0) - q12 - q32) - 
-          (ppi3d*q1 - ppi1d*q3)*(C4v*mdel*(q0*(mn + q0) - q12 - q32) + 
-          C3v*mn*(2*mdel2 + 2*mdel*mn - q0*(mn + q0) + q12 + q32)))*mdel + 
-        twoI*C5v*mdel*mn*q0*(ppi3d*q1 - ppi1d*q3)*mdel;
-
-      j1[3] = (4.*C4a*mdel2*q02*(mdel + mn + q0)*q3 - 4.*C6a*mdel2*q02*(mdel + mn + q0)*q3 + 
-          4.*C5a*mn2*q0*(mn + q0)*(mdel + mn + q0)*q3 + 4.*C6a*q0*(mn + q0)*(mdel + mn + q0)*
-          (q0*(mn + q0) - q12)*q3 - 4.*C6a*q0*(mn + q0)*(mdel + mn + q0)*q33)*bej0*uwavefunc + 
-        ppi2d*(-twoI*mdel*q1*(C4v*mdel*(q0*(mn + q0) - q12) + 
-          C3v*mn*(2.*mdel2 + 2*mdel*mn - q0*(mn + q0) + q12)) + twoI*mdel*
-          (C4v*mdel - C3v*mn)*q1*q32) +
-        ppi1d*(-4.*C4a*mdel2*(mdel + mn + q0)*q1*q3 + 
-          4.*C6a*mdel2*(mdel + mn + q0)*q1*q3 - 4.*C5a*mn2*(mdel + mn + q0)*q1*q3 - 
-          4.*C6a*(mdel + mn + q0)*q1*(q0*(mn + q0) - q12)*q3 + 4.*C6a*(mdel + mn + q0)*q1*q33) + 
-        ppi3d*(-4.*C4a*mdel2*mn*q0*(mdel + mn + q0) - 4.*C4a*mdel2*(mdel + mn + q0)*(q0 - q1)*(q0 + q1) + 
-          4.*C6a*(mdel + mn + q0)*(mdel2 - q0*(mn + q0) + q12)*q32 + 4.*C6a*(mdel + mn + q0)*q34 - 
-          4.*C5a*mn2*(mdel + mn + q0)*(mdel2 + q32)) + 
-        -twoI*C5v*mdel2*mn*ppi2d*q0*q1;
-      
-      // Crossed Delta
-      
-      j2[0]=-4.*(mdel + mn - q0)*(
-        (C5a*mdel2*mn2*q0 - C5a*mn2*(mn - q0)*(mn - q0)*q0 + C6a*mdel2*q03 - 
-          C4a*mdel2*q0*q12 - C4a*mdel2*q0*q32 - C6a*(mn - q0)*q02*((mn - q0)*q0 + q12 + q32))*bej0*uwavefunc + 
-        ppi1d*(-(C4a*mdel2*mn*q1) - C5a*mn2*(mn - q0)*q1 + C4a*mdel2*q0*q1 - 
-          C6a*mdel2*q0*q1 - C6a*q0*q1*((mn - q0)*q0 + q12 + q32)) + 
-        ppi3d*(-(C4a*mdel2*mn*q3) - C5a*mn2*(mn - q0)*q3 + C4a*mdel2*q0*q3 - 
-          C6a*mdel2*q0*q3 - C6a*q0*q3*((mn - q0)*q0 + q12 + q32)));
-
-      j2[1]=(-4.*C5a*mn2*(mn - q0)*(mdel + mn - q0)*q0*q1 - 4.*C6a*mdel3*q02*q1 - 
-          4.*C6a*mdel2*mn*q02*q1 + 4.*C6a*mdel*mn2*q02*q1 + 4.*C6a*mn3*q02*q1 + 
-          4.*C4a*mdel2*(mdel + mn - q0)*q02*q1 + 4.*C6a*mdel2*q03*q1 - 
-          8.*C6a*mdel*mn*q03*q1 - 12.*C6a*mn2*q03*q1 + 4.*C6a*mdel*q04*q1 + 
-          12.*C6a*mn*q04*q1 - 4.*C6a*q05*q1 + 4.*C6a*mdel*mn*q0*q13 + 
-          4.*C6a*mn2*q0*q13 - 4.*C6a*mdel*q02*q13 - 8.*C6a*mn*q02*q13 + 
-          4.*C6a*q03*q13 + 4.*C6a*(mn - q0)*(mdel + mn - q0)*q0*q1*q32)*bej0*uwavefunc + 
-        ppi1d*(-4.*C5a*mdel2*mn2*(mdel + mn - q0) + 4.*C4a*mdel2*mn*(mdel + mn - q0)*q0 - 
-          4.*C4a*mdel2*(mdel + mn - q0)*q02 + 4.*C6a*mdel3*q12 + 
-          4.*C6a*mdel2*mn*q12 - 4.*C5a*mn2*(mdel + mn - q0)*q12 - 
-          4.*C6a*mdel2*q0*q12 + 4.*C6a*mdel*mn*q0*q12 + 4.*C6a*mn2*q0*q12 - 
-          4.*C6a*mdel*q02*q12 - 8.*C6a*mn*q02*q12 + 4.*C6a*q03*q12 + 
-          4.*C6a*mdel*q14 + 4.*C6a*mn*q14 - 4.*C6a*q0*q14 + 
-          4.*C4a*mdel2*(mdel + mn - q0)*q32 + 4.*C6a*(mdel + mn - q0)*q12*q32) + 
-        ppi2d*(twoI*mdel*(mdel*q0*(-((C4v + C5v)*mn) + C4v*q0) + 
-          C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02))*q3 + 
-          twoI*mdel*(-(C4v*mdel) + C3v*mn)*q12*q3 - twoI*mdel*(C4v*mdel - C3v*mn)*q33) +
-        ppi3d*(-4.*C4a*mdel2*(mdel + mn - q0)*q1*q3 - 
-          4.*C5a*mn2*(mdel + mn - q0)*q1*q3 + 4.*C6a*(mdel + mn - q0)*(mdel2 + (mn - q0)*q0)*q1*q3 + 
-          4.*C6a*(mdel + mn - q0)*q13*q3 + 4.*C6a*(mdel + mn - q0)*q1*q33);
-
-      j2[2]=-(twoI*ppi2d*(-twoI*C5a*mdel*mn2*(mdel + mn - q0) +
-          twoI*C4a*mdel*(mdel + mn - q0)*((mn - q0)*q0 + q12 + q32)) - 
-        ppi3d*twoI*q1*(C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02 + q12 + q32) - 
-          mdel*(C5v*mn*q0 + C4v*((mn - q0)*q0 + q12 + q32))) + 
-        ppi1d*twoI*q3*(C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02 + q12 + q32) - 
-          mdel*(C5v*mn*q0 + C4v*((mn - q0)*q0 + q12 + q32)))
-        )*mdel;
-
-      j2[3] = (-4.*C5a*mn2*(mn - q0)*(mdel + mn - q0)*q0*q3 +
-          4.*C4a*mdel2*(mdel + mn - q0)*q02*q3 - 4.*C6a*mdel2*(mdel + mn - q0)*q02*q3 + 
-          4.*C6a*(mn - q0)*(mdel + mn - q0)*q0*((mn - q0)*q0 + q12)*q3 + 
-          4.*C6a*(mn - q0)*(mdel + mn - q0)*q0*q33)*bej0*uwavefunc + 
-        ppi2d*(-twoI*mdel*q1*(C3v*mn*(2*mdel*(mdel + mn) + mn*q0 - q02 + q12) - 
-          mdel*(q0*((C4v + C5v)*mn - C4v*q0) + C4v*q12)) + 
-          twoI*mdel*(C4v*mdel - C3v*mn)*q1*q32) + 
-        ppi1d*(-4.*C4a*mdel2*(mdel + mn - q0)*q1*q3 + 4.*C6a*mdel2*(mdel + mn - q0)*q1*q3 - 
-          4.*C5a*mn2*(mdel + mn - q0)*q1*q3 + 
-          4.*C6a*(mdel + mn - q0)*q1*((mn - q0)*q0 + q12)*q3 + 
-          4.*C6a*(mdel + mn - q0)*q1*q33) + 
-        ppi3d*(-4.*C5a*mdel2*mn2*(mdel + mn - q0) + 
-          4.*C4a*mdel2*(mdel + mn - q0)*((mn - q0)*q0 + q12) -
-          4.*C5a*mn2*(mdel + mn - q0)*q32 + 
-          4.*C6a*(mdel + mn - q0)*(mdel2 + (mn - q0)*q0 + q12)*q32 + 
-          4.*C6a*(mdel + mn - q0)*q34);
-      
-      //
-      // Direct Nucleon
-      
-      j3[0]=-2.0*(FA - FP*q0)*(q02*bej0*uwavefunc - ppi1d*q1 - ppi3d*q3);
-      
-      j3[1] = 2.0*(-(FA*q0*q1) + FP*q02*q1) * bej0 * uwavefunc +
-        2.0*ppi1d*(2.0*FA*mn + FA*q0 - FP*q12) -
-        twoI*(F1 + F2)*ppi2d*q3 - 2.*FP*ppi3d*q1*q3;
-
-      j3[2]=twoI*(-I*FA*ppi2d*(2.0*mn + q0) - (F1 + F2)*(ppi3d*q1 - ppi1d*q3));
-
-      j3[3]=twoI*(F1 + F2)*ppi2d*q1 - 2.0*FP*ppi1d*q1*q3 + 
-        2.0*(-(FA*q0*q3) + FP*q02*q3)*bej0*uwavefunc +
-        2.0*ppi3d*(2.0*FA*mn + FA*q0 - FP*q32);
-      
-      //
-      // Crossed Nucleon
-      
-      j4[0] = 2.0*(FA + FP*q0)*(q02  *bej0*uwavefunc - ppi1d*q1 - ppi3d*q3);
-
-      j4[1] = -2.0*(-(FA*q0*q1) - FP*q02*q1)*bej0*uwavefunc - 2.0*ppi1d*(-2.0*FA*mn + FA*q0 + FP*q12) - 
-        twoI*(F1 + F2)*ppi2d*q3 - 2.0*FP*ppi3d*q1*q3;
-
-      j4[2] = twoI*(-I*FA*ppi2d*(2.0*mn - q0) - (F1 + F2)*(ppi3d*q1 - ppi1d*q3));
-
-      j4[3] = twoI*(F1 + F2)*ppi2d*q1 - 2.0*FP*ppi1d*q1*q3 + 2.0*(FA*q0*q3 + FP*q02*q3)*bej0*uwavefunc + 
-        2.0*ppi3d*(2.0*FA*mn - FA*q0 - FP*q32);
+      cdouble bu = bej0*uwavefunc;
+      for(int m = 0; m != 4; ++m)
+      {
+        j1[m] = bu*jc1[0][m] + ppi1d*jc1[1][m] + ppi2d*jc1[2][m] + ppi3d*jc1[3][m];
+        j2[m] = bu*jc2[0][m] + ppi1d*jc2[1][m] + ppi2d*jc2[2][m] + ppi3d*jc2[3][m];
+        j3[m] = bu*jc3[0][m] + ppi1d*jc3[1][m] + ppi2d*jc3[2][m] + ppi3d*jc3[3][m];
+        j4[m] = bu*jc4[0][m] + ppi1d*jc4[1][m] + ppi2d*jc4[2][m] + ppi3d*jc4[3][m];
+      }
 
       cdouble pre_factor_1 = mod * I * (fs/mpi) / constants::kSqrt3 *
         exp_i_qpar_za *
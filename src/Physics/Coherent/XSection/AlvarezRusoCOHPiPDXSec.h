@@ -31,6 +31,9 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 
 #include <complex>
+#include <list>
+#include <map>
+#include <vector>
 
 namespace genie
 {
@@ -59,6 +62,11 @@ class AlvarezRusoCOHPiPDXSec
            
     void SetDebug(bool debug)  {  debug_ = debug;  };
     
+    // Can this object compute the cross section for the given settings?
+    bool Matches(unsigned int Z_, unsigned int A_, const current_t current_, 
+          const flavour_t flavour_ = kE, const nutype_t nutype = kNu, 
+          const formfactors_t ff_ = kNieves) const;
+    
     ARConstants      & GetConstants(void);
     ARSampledNucleus & GetNucleus  (void);
     
@@ -162,6 +170,10 @@ class AlvarezRusoCOHPiPDXSec
         ARWavefunction* fUwaveDr;
         ARWavefunction* fUwaveDtheta;
         
+        // Wavefunctions & derivatives, interleaved, for each pion energy
+        std::map<double, std::vector<std::complex<double> > > fWFCache;
+        std::list<double> fWFCacheOrder;  // cached pion energies, oldest first
+        
         std::complex<double>  fJ_hadronic[4];
 };
 
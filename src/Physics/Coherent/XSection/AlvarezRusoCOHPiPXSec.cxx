@@ -47,14 +47,12 @@ AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec() :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec")
 {
   fMultidiff = NULL;
-  fLastInteraction = NULL;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::AlvarezRusoCOHPiPXSec(string config) :
 XSecAlgorithmI("genie::AlvarezRusoCOHPiPXSec", config)
 {
   fMultidiff = NULL;
-  fLastInteraction = NULL;
 }
 //____________________________________________________________________________
 AlvarezRusoCOHPiPXSec::~AlvarezRusoCOHPiPXSec()
@@ -79,48 +77,49 @@ double AlvarezRusoCOHPiPXSec::XSec(
   const TLorentzVector p4_pi  = kinematics.HadSystP4();
   double E_lep = p4_lep.E();
  
-  if (fLastInteraction!=interaction) {
+  current_t current;
+  if ( interaction->ProcInfo().IsWeakCC() ) {
+    current = kCC;
+  }
+  else if ( interaction->ProcInfo().IsWeakNC() ) {
+    current = kNC;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
+    return 0.;
+  }
+  
+  flavour_t flavour;
+  if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
+    flavour=kE;
+  }
+  else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
+    flavour=kMu;
+  }
+  else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
+    flavour=kTau;
+  }
+  else {
+    LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
+    return 0.;
+  }
+
+  nutype_t nutype;
+  if ( init_state.ProbePdg() > 0) {
+    nutype = kNu;
+  } else {
+    nutype = kAntiNu;
+  }
+
+  // Keep the multi-differential cross section object (and the pion
+  // wavefunctions it has cached) for as long as the target and the process
+  // remain the same
+  if (fMultidiff == NULL || !fMultidiff->Matches(Z, A, current, flavour, nutype)) {
     if (fMultidiff != NULL) {
       delete fMultidiff;
       fMultidiff = NULL;
     }
-
-    current_t current;
-    if ( interaction->ProcInfo().IsWeakCC() ) {
-      current = kCC;
-    }
-    else if ( interaction->ProcInfo().IsWeakNC() ) {
-      current = kNC;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown current for AlvarezRuso implementation";
-      return 0.;
-    }
-    
-    flavour_t flavour;
-    if ( init_state.ProbePdg() == 12 || init_state.ProbePdg() == -12) {
-      flavour=kE;
-    }
-    else if ( init_state.ProbePdg() == 14 || init_state.ProbePdg() == -14) {
-      flavour=kMu;
-    }
-    else if ( init_state.ProbePdg() == 16 || init_state.ProbePdg() == -16) {
-      flavour=kTau;
-    }
-    else {
-      LOG("AlvarezRusoCohPi",pDEBUG)<<"Unknown probe for AlvarezRuso implementation";
-      return 0.;
-    }
-
-    nutype_t nutype;
-    if ( init_state.ProbePdg() > 0) {
-      nutype = kNu;
-    } else {
-      nutype = kAntiNu;
-    }
- 
     fMultidiff = new AlvarezRusoCOHPiPDXSec(Z, A ,current, flavour, nutype);
-    fLastInteraction = interaction;
   }
 
   double xsec = fMultidiff->DXSec(E_nu, E_lep, p4_lep.Theta(), p4_lep.Phi(), p4_pi.Theta(), p4_pi.Phi());
@@ -56,7 +56,6 @@ private:
   const XSecIntegratorI * fXSecIntegrator;
   
   mutable alvarezruso::AlvarezRusoCOHPiPDXSec * fMultidiff;
-  mutable const Interaction * fLastInteraction;
   //Parameters
   //bool fUseLookupTable;
   //double fa4;
@@ -35,6 +35,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 
 using namespace genie;
@@ -62,6 +63,7 @@ COHXSec::~COHXSec()
 double COHXSec::Integrate(
       const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(in) ) return 0.;
 
   const KPhaseSpace & kps = in->PhaseSpace();
@@ -89,21 +91,12 @@ double COHXSec::Integrate(
 
     ROOT::Math::IBaseFunctionMultiDim * func = 
       new utils::gsl::d2XSec_dxdy_E(model, interaction);
-    ROOT::Math::IntegrationMultiDim::Type ig_type = 
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
       
     double abstol = 1; //We mostly care about relative tolerance.
-    ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-    if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-      ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-        dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-      assert(cast);
-      cast->SetMinPts(fGSLMinEval);
-    }
-  
     double kine_min[2] = { xl.min, yl.min };
     double kine_max[2] = { xl.max, yl.max };
-    xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+    xsec = this->IntegrateNDim(
+      *func, kine_min, kine_max, abstol, fGSLMinEval) * (1E-38 * units::cm2);
     delete func;
   } 
   else if (model->Id().Name() == "genie::BergerSehgalCOHPiPXSec2015")
@@ -178,6 +171,7 @@ void COHXSec::LoadConfig(void)
   // Get GSL integration type & relative tolerance
   GetParamDef( "gsl-integration-type", fGSLIntgType, string("adaptive") ) ;
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol, 1E-2 ) ;
+  BindParamDef( fGSLNWorkers, "gsl-integration-workers", 0 ) ;
 
   int max_eval, min_eval ;
   GetParamDef( "gsl-max-eval", max_eval, 500000 ) ;
@@ -28,6 +28,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 
 using namespace genie;
@@ -56,6 +57,7 @@ COHXSecAR::~COHXSecAR()
 double COHXSecAR::Integrate(
       const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   const InitialState & init_state = in -> InitState();
   
   if(! model->ValidProcess(in) ) return 0.;
@@ -112,13 +114,8 @@ double COHXSecAR::Integrate(
     double kine_min[4] = { Elep_min, zero , zero    , zero    };
     double kine_max[4] = { Elep_max, pi   , pi      , twopi   };
     
-    ROOT::Math::IntegrationMultiDim::Type ig_type = 
-      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-        
     double abstol = 1; //We mostly care about relative tolerance.
-    ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-  
-    xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+    xsec = this->IntegrateNDim(*func, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
     delete func;
   }
 
@@ -149,6 +146,7 @@ void COHXSecAR::LoadConfig(void)
   fGSLMaxEval    = (unsigned int) max_eval ;
 
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol,  0.01) ;
+  BindParamDef( fGSLNWorkers, "gsl-integration-workers", 0 ) ;
   GetParamDef( "split-integral", fSplitIntegral, true ) ;
 
 }
@@ -103,7 +103,7 @@ void InitialStateAppender::AddNucleus(GHepRecord * evrec) const
   int    A    = init_state.Tgt().A();
   int    Z    = init_state.Tgt().Z();
   int    pdgc = pdg::IonPdgCode(A, Z);
-  double M    = PDGLibrary::Instance()->Find(pdgc)->Mass();
+  double M    = PDGLibrary::Instance()->Mass(pdgc);
 
   LOG("ISApp", pINFO)
           << "Adding nucleus [A = " << A << ", Z = " << Z
@@ -125,7 +125,7 @@ void InitialStateAppender::AddStruckParticle(GHepRecord * evrec) const
 
   if(hit_e) {
     int    pdgc = kPdgElectron;
-    double mass = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double mass = PDGLibrary::Instance()->Mass(pdgc);
     const TLorentzVector p4(0,0,0, mass);
     const TLorentzVector v4(0.,0.,0.,0.);
 
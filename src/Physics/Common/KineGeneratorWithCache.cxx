@@ -15,6 +15,21 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - CA
+   Added an (E, normalized kinematic variable) envelope of the xsec, that
+   subclasses can sample against instead of a single max xsec per energy.
+ @ Oct 14, 2026 - CA
+   Count the kinematics trials of the subclass rejection loops (NTrials()).
+   The trials are also counted in the cost of the event being generated.
+ @ Oct 14, 2026 - CA
+   The cache branches are keyed by CacheKey(), which subclasses can extend
+   with run-time parameters their max xsec depends on.
+ @ Oct 14, 2026 - CA
+   Added a 2-D envelope, in two normalized kinematic variables.
+ @ Oct 14, 2026 - CA
+   Added the weighted and approximate Envelope-Mode, drawing kinematics from
+   a surrogate of the xsec interpolated between the envelope nodes. The
+   envelope nodes are tabulated along with the max xsec in TabulateMaxXSec().
 
 */
 //____________________________________________________________________________
@@ -22,16 +37,19 @@
 #include <sstream>
 #include <cstdlib>
 #include <map>
+#include <algorithm>
 
 //#include <TSQLResult.h>
 //#include <TSQLRow.h>
 #include <TMath.h>
 
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Physics/Common/KineGeneratorWithCache.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepFlags.h"
 #include "Framework/Messenger/Messenger.h"
+#include "Framework/Interaction/Interaction.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Numerical/MathUtils.h"
@@ -41,21 +59,45 @@ using std::map;
 
 using namespace genie;
 
+// E-dependent xsec envelope binning
+static const int kEnvCells      = 20;  // # of cells in the normalized kinematic variable
+static const int kEnv2DCells    = 16;  // # of cells in each variable of the 2-D envelope
+static const int kEnvBinsPerDec = 25;  // # of E bins per decade
+
+// Inverse CDF of the density a*(1-t) + b*t in [0,1], at r in [0,1]
+static double LinearPdfInverse(double a, double b, double r)
+{
+  if(a + b <= 0. || TMath::Abs(b - a) < 1E-9 * (a + b)) return r;
+  return (TMath::Sqrt(a*a + (b*b - a*a) * r) - a) / (b - a);
+}
+
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fUseEnvelope(false),
+fEnvelopeSafety(1.),
+fEnvelopeMode(kEnvRejection),
+fNTrials(0)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fUseEnvelope(false),
+fEnvelopeSafety(1.),
+fEnvelopeMode(kEnvRejection),
+fNTrials(0)
 {
 
 }
 //___________________________________________________________________________
 KineGeneratorWithCache::KineGeneratorWithCache(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fUseEnvelope(false),
+fEnvelopeSafety(1.),
+fEnvelopeMode(kEnvRejection),
+fNTrials(0)
 {
 
 }
@@ -63,6 +105,12 @@ EventRecordVisitorI(name, config)
 KineGeneratorWithCache::~KineGeneratorWithCache()
 {
 
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::CountTrial(void) const
+{
+  fNTrials++;
+  RunningThreadInfo::Instance()->EventCost().kine_trials++;
 }
 //___________________________________________________________________________
 double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
@@ -96,11 +144,11 @@ double KineGeneratorWithCache::MaxXSec(GHepRecord * event_rec) const
   // reset 'trust' bits
   interaction->ResetBit(kISkipProcessChk);
   interaction->ResetBit(kISkipKinematicChk);
-  // throw exception
+  // stop the thread (callers must return if a non-positive max is returned)
   genie::exceptions::EVGThreadException exception;
   exception.SetReason("kinematics generation: max_xsec({K};E)<=0");
   exception.SwitchOnFastForward();
-  throw exception;
+  this->StopThread(exception);
 
   return 0;
 }
@@ -211,6 +259,67 @@ void KineGeneratorWithCache::CacheMaxXSec(
   }
 }
 //___________________________________________________________________________
+void KineGeneratorWithCache::TabulateMaxXSec(
+   const XSecAlgorithmI * xsec_model, 
+   const Interaction * in, const vector<double> & energies) const
+{
+// Computes and caches max{dxsec/dK} for the input interaction at each of the
+// input energies (typically the knots of the corresponding xsec spline).
+// The probe is set along z and the hit nucleon at rest, so that the input
+// energies are the ones seen by FindMaxXSec(). Once the filled cache is saved
+// to a cache file, later jobs using it need no max{dxsec/dK} warm-up phase.
+
+  fXSecModel = xsec_model;
+
+  Interaction interaction(*in);
+  interaction.SetBit(kISkipProcessChk);
+  interaction.SetBit(kISkipKinematicChk);
+
+  double m = interaction.InitState().Probe()->Mass();
+
+  int ncached = 0;
+  for(unsigned int i = 0; i < energies.size(); i++) {
+    double E = energies[i];
+    if(E < fEMin || E <= m) continue;
+
+    double p = TMath::Sqrt(TMath::Max(0., E*E - m*m));
+    TLorentzVector p4(0., 0., p, E);
+    interaction.InitStatePtr()->SetProbeP4(p4);
+
+    double max_xsec = this->ComputeMaxXSec(&interaction);
+    if(max_xsec <= 0) continue;
+
+    this->CacheMaxXSec(&interaction, max_xsec);
+    ncached++;
+  }
+
+  LOG("Kinematics", pNOTICE)
+    << "Tabulated max{dxsec/dK} at " << ncached << " energies for: " 
+    << in->AsString();
+
+  // the envelope node values, at all the E bin edges spanned by the energies
+  int ndim = this->EnvelopeDim();
+  if(!fUseEnvelope || ndim == 0) return;
+
+  int ibin_min =  1000;
+  int ibin_max = -1000;
+  for(unsigned int i = 0; i < energies.size(); i++) {
+    double E = energies[i];
+    if(E <= m) continue;
+    int ibin = TMath::FloorNint(kEnvBinsPerDec * TMath::Log10(E));
+    ibin_min = TMath::Min(ibin_min, ibin);
+    ibin_max = TMath::Max(ibin_max, ibin);
+  }
+  for(int iedge = ibin_min; iedge <= ibin_max + 1; iedge++) {
+    this->EnvelopeEdge(&interaction, iedge, ndim);
+  }
+  if(ibin_max >= ibin_min) {
+    LOG("Kinematics", pNOTICE)
+      << "Tabulated the " << ndim << "-D xsec envelope nodes at "
+      << ibin_max - ibin_min + 2 << " E bin edges for: " << in->AsString();
+  }
+}
+//___________________________________________________________________________
 double KineGeneratorWithCache::Energy(const Interaction * interaction) const
 {
 // Returns the neutrino energy at the struck nucleon rest frame. Kinematic
@@ -222,6 +331,11 @@ double KineGeneratorWithCache::Energy(const Interaction * interaction) const
   return E;
 }
 //___________________________________________________________________________
+string KineGeneratorWithCache::CacheKey(void) const
+{
+  return this->Id().Key();
+}
+//___________________________________________________________________________
 CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
                                       const Interaction * interaction) const
 {
@@ -230,13 +344,18 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
 
   Cache * cache = Cache::Instance();
 
+  // look-up the branch through the hashed algorithm/interaction signature
+  ULong64_t id = interaction->Signature(this->CacheKey());
+  CacheBranchFx * cache_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(id));
+  if(cache_branch) return cache_branch;
+
   // build the cache branch key as: namespace::algorithm/config/interaction
-  string algkey = this->Id().Key();
+  string algkey = this->CacheKey();
   string intkey = interaction->AsString();
   string key    = cache->CacheBranchKey(algkey, intkey);
 
-  CacheBranchFx * cache_branch =
-              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  cache_branch = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   if(!cache_branch) {
     //-- create the cache branch at the first pass
     LOG("Kinematics", pINFO) << "No Max d^nXSec/d{K}^n cache branch found";
@@ -246,6 +365,7 @@ CacheBranchFx * KineGeneratorWithCache::AccessCacheBranch(
     cache->AddCacheBranch(key, cache_branch);
   }
   assert(cache_branch);
+  cache->IndexCacheBranch(id, cache_branch);
 
   return cache_branch;
 }
@@ -281,3 +401,345 @@ void KineGeneratorWithCache::AssertXSecLimits(
   }
 }
 //___________________________________________________________________________
+KineGeneratorWithCache::KineEnvelope_t * KineGeneratorWithCache::Envelope(
+                      const Interaction * interaction, double E, int ndim) const
+{
+// Piecewise-constant envelope of the xsec for the E bin containing the
+// input energy E (that EnvelopeXSec() sets as probe energy at the E bin
+// edges, normally the LAB energy). The kinematic variable
+// is normalized to [0,1] by its E-dependent limits and EnvelopeXSec() gives
+// the xsec as a function of it. The majorant of each cell is the safety
+// factor times the max xsec at the nodes of the cell and of its neighbours,
+// at both E bin edges. Kinematics are then generated uniformly in a cell
+// selected according to its majorant (see SampleEnvelope()).
+// For ndim = 2 the envelope is built on a grid of kEnv2DCells x kEnv2DCells
+// cells in two normalized kinematic variables, from EnvelopeXSec2D(), and
+// is sampled with SampleEnvelope2D().
+// Returns 0 if the envelope is switched off or if the xsec vanishes at all
+// nodes, in which case the max xsec returned by MaxXSec() should be used.
+
+  if(!fUseEnvelope || E <= 0.) return 0;
+
+  string tag = (ndim == 2) ? "/env2" : "/env";
+  int ibin = TMath::FloorNint(kEnvBinsPerDec * TMath::Log10(E));
+  KineEnvelopeKey_t key(interaction->Signature(this->CacheKey() + tag), ibin);
+
+  map<KineEnvelopeKey_t, KineEnvelope_t>::iterator it = fEnvelopes.find(key);
+  if(it != fEnvelopes.end()) {
+    return (it->second.cdf.back() > 0.) ? &(it->second) : 0;
+  }
+
+  const vector<double> & xsec_lo = this->EnvelopeEdge(interaction, ibin,   ndim);
+  const vector<double> & xsec_hi = this->EnvelopeEdge(interaction, ibin+1, ndim);
+
+  int nc = (ndim == 2) ? kEnv2DCells : kEnvCells; // cells per variable
+  int ncells = (ndim == 2) ? nc*nc : nc;
+
+  KineEnvelope_t & env = fEnvelopes[key];
+  env.value.assign(ncells, 0.);
+  env.cdf  .assign(ncells, 0.);
+
+  double sum = 0.;
+  for(int icell = 0; icell < ncells; icell++) {
+    int iu = (ndim == 2) ? icell / nc : icell;
+    int iv = (ndim == 2) ? icell % nc : 0;
+    double xmax = 0.;
+    for(int ju = TMath::Max(iu-1, 0); ju <= TMath::Min(iu+2, nc); ju++) {
+      if(ndim == 2) {
+        for(int jv = TMath::Max(iv-1, 0); jv <= TMath::Min(iv+2, nc); jv++) {
+          int j = ju*(nc+1) + jv;
+          xmax = TMath::Max(xmax, TMath::Max(xsec_lo[j], xsec_hi[j]));
+        }
+      } else {
+        xmax = TMath::Max(xmax, TMath::Max(xsec_lo[ju], xsec_hi[ju]));
+      }
+    }
+    env.value[icell] = fEnvelopeSafety * xmax;
+    sum += env.value[icell];
+    env.cdf[icell] = sum;
+  }
+
+  LOG("Kinematics", pNOTICE)
+    << "Built the " << ndim << "-D max xsec envelope for "
+    << interaction->AsString() << ", E bin " << ibin << " (E = "
+    << TMath::Power(10., (double)ibin / kEnvBinsPerDec) << " - "
+    << TMath::Power(10., (double)(ibin+1) / kEnvBinsPerDec) << " GeV)";
+
+  return (sum > 0.) ? &env : 0;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::SampleEnvelope(
+      const KineEnvelope_t & env, double r1, double r2, int & icell) const
+{
+// Returns a normalized kinematic variable in [0,1], uniformly distributed
+// within a cell selected according to its majorant (inverse CDF, by binary
+// search), for the uniform random numbers r1, r2. The majorant to use in
+// the rejection method is env.value[icell].
+
+  icell = std::upper_bound(env.cdf.begin(), env.cdf.end(),
+               r1 * env.cdf.back()) - env.cdf.begin();
+  icell = TMath::Min(icell, (int)env.cdf.size() - 1);
+
+  return (icell + r2) / env.cdf.size();
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::SampleEnvelope2D(
+      const KineEnvelope_t & env, double r1, double r2, double r3,
+      double & u, double & v, int & icell) const
+{
+// As SampleEnvelope(), for an envelope in two normalized kinematic variables
+// (see Envelope()): (u,v) is uniformly distributed within the selected cell.
+
+  icell = std::upper_bound(env.cdf.begin(), env.cdf.end(),
+               r1 * env.cdf.back()) - env.cdf.begin();
+  icell = TMath::Min(icell, (int)env.cdf.size() - 1);
+
+  u = (icell / kEnv2DCells + r2) / kEnv2DCells;
+  v = (icell % kEnv2DCells + r3) / kEnv2DCells;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::RaiseEnvelope(
+                       KineEnvelope_t * env, int icell, double xsec) const
+{
+  double value = fEnvelopeSafety * xsec;
+
+  LOG("Kinematics", pWARN)
+    << "Raising the max xsec envelope in cell " << icell
+    << ": " << env->value[icell] << " -> " << value;
+
+  double diff = value - env->value[icell];
+  env->value[icell] = value;
+  for(unsigned int i = icell; i < env->cdf.size(); i++) env->cdf[i] += diff;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::SampleSurrogate(
+      const Interaction * interaction, double E, int ndim,
+      double r1, double r2, double r3, double & u, double & v) const
+{
+// Draws the normalized kinematic variables (u,v) (v = 0 for ndim = 1) from a
+// surrogate of the xsec, for the uniform random numbers r1, r2, r3, and
+// returns the value of the surrogate there (0 if there is none at E).
+// The surrogate is tabulated from the same node values as the envelope, at
+// the edges of the E bin containing E: it is interpolated linearly in
+// log10(E) between the two edges, and linearly (bilinearly for ndim = 2)
+// between the nodes. A cell is first selected according to its integral,
+// then u (and v, at that u) from the linear marginal (conditional) density
+// within the cell, so that no xsec evaluation is needed.
+
+  u = 0.;
+  v = 0.;
+  if(E <= 0.) return 0.;
+
+  double lgE  = kEnvBinsPerDec * TMath::Log10(E);
+  int    ibin = TMath::FloorNint(lgE);
+  double t    = lgE - ibin;
+
+  const vector<double> & xsec_lo = this->EnvelopeEdge(interaction, ibin,   ndim);
+  const vector<double> & xsec_hi = this->EnvelopeEdge(interaction, ibin+1, ndim);
+
+  int nc     = (ndim == 2) ? kEnv2DCells : kEnvCells; // cells per variable
+  int ncells = (ndim == 2) ? nc*nc : nc;
+
+  vector<double> node(xsec_lo.size());
+  for(unsigned int j = 0; j < node.size(); j++) {
+    node[j] = (1.-t) * xsec_lo[j] + t * xsec_hi[j];
+  }
+
+  // node values at the corners of a cell
+  double a00 = 0., a01 = 0., a10 = 0., a11 = 0.;
+
+  vector<double> cdf(ncells);
+  double sum = 0.;
+  for(int icell = 0; icell < ncells; icell++) {
+    if(ndim == 2) {
+      int j = (icell / nc) * (nc+1) + icell % nc;
+      sum += 0.25 * (node[j] + node[j+1] + node[j+nc+1] + node[j+nc+2]);
+    } else {
+      sum += 0.5 * (node[icell] + node[icell+1]);
+    }
+    cdf[icell] = sum;
+  }
+  if(sum <= 0.) return 0.;
+
+  int icell = std::upper_bound(cdf.begin(), cdf.end(), r1 * sum) - cdf.begin();
+  icell = TMath::Min(icell, ncells - 1);
+
+  if(ndim != 2) {
+    a00 = node[icell];
+    a10 = node[icell+1];
+    double fu = LinearPdfInverse(a00, a10, r2);
+    u = (icell + fu) / nc;
+    return (1.-fu) * a00 + fu * a10;
+  }
+
+  int iu = icell / nc;
+  int iv = icell % nc;
+  int j  = iu * (nc+1) + iv;
+  a00 = node[j];
+  a01 = node[j+1];
+  a10 = node[j+nc+1];
+  a11 = node[j+nc+2];
+
+  double fu = LinearPdfInverse(a00 + a01, a10 + a11, r2);
+  double c0 = (1.-fu) * a00 + fu * a10;
+  double c1 = (1.-fu) * a01 + fu * a11;
+  double fv = LinearPdfInverse(c0, c1, r3);
+
+  u = (iu + fu) / nc;
+  v = (iv + fv) / nc;
+
+  return (1.-fv) * c0 + fv * c1;
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::WeightSurrogate(
+             GHepRecord * evrec, double xsec, double surrogate) const
+{
+// For kinematics drawn from the surrogate (Envelope-Mode = weighted): the
+// event weight is multiplied by xsec / surrogate (both in the envelope
+// variables), so that the weighted events follow the exact xsec. The weights
+// average to the ratio of the xsec and surrogate integrals, 1 within the
+// accuracy of the interpolation between the envelope nodes.
+
+  if(surrogate <= 0.) return;
+
+  double wght = (xsec / surrogate) * evrec->Weight();
+  LOG("Kinematics", pINFO) << "Surrogate kinematics wght = " << xsec / surrogate;
+  evrec->SetWeight(wght);
+}
+//___________________________________________________________________________
+void KineGeneratorWithCache::LoadEnvelopeMode(void)
+{
+// Reads the Envelope-Mode used by subclasses with an envelope whose node
+// values are the xsec (see SampleSurrogate()):
+//  - rejection   : exact, unweighted (default)
+//  - weighted    : one xsec evaluation per event, weighted events
+//  - approximate : no xsec evaluation at all, the event diff xsec being
+//                  the surrogate one. Only use it if its accuracy was checked.
+
+  string mode = "rejection";
+  this->GetParamDef("Envelope-Mode", mode, string("rejection"));
+
+  if      (mode == "rejection"  ) fEnvelopeMode = kEnvRejection;
+  else if (mode == "weighted"   ) fEnvelopeMode = kEnvWeighted;
+  else if (mode == "approximate") fEnvelopeMode = kEnvApproximate;
+  else {
+    LOG("Kinematics", pFATAL)
+      << "Unknown Envelope-Mode: " << mode
+      << " (expected rejection, weighted or approximate)";
+    gAbortingInErr = true;
+    exit(1);
+  }
+
+  if(fEnvelopeMode == kEnvApproximate) {
+    LOG("Kinematics", pWARN)
+      << this->Id().Key() << ": kinematics are drawn from the tabulated "
+      << "xsec surrogate, with no exact xsec evaluation (approximate mode)";
+  }
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::EnvelopeXSec(
+                              Interaction * /*interaction*/, double /*u*/) const
+{
+// The xsec at the normalized kinematic variable u, in [0,1], for the input
+// interaction (whose probe energy is set to an E bin edge). Subclasses that
+// sample against an envelope should override it, and return 0 if the
+// interaction is below threshold. By default there is no envelope.
+
+  return 0.;
+}
+//___________________________________________________________________________
+double KineGeneratorWithCache::EnvelopeXSec2D(
+           Interaction * /*interaction*/, double /*u*/, double /*v*/) const
+{
+// As EnvelopeXSec(), for the 2-D envelope: the xsec at the normalized
+// kinematic variables (u,v), in [0,1]x[0,1]. It must include the Jacobian
+// of the transformation to (u,v) if that is not constant over the grid.
+
+  return 0.;
+}
+//___________________________________________________________________________
+const vector<double> & KineGeneratorWithCache::EnvelopeEdge(
+                  const Interaction * interaction, int iedge, int ndim) const
+{
+// The xsec at the nodes of the envelope grid (kEnvCells+1, or
+// (kEnv2DCells+1)^2 for the 2-D envelope), at the E bin edge iedge.
+// The node values are stored in a cache branch, so they are persisted
+// in the cache file (if any) and reused by later jobs.
+
+  string tag = (ndim == 2) ? "/env2" : "/env";
+  KineEnvelopeKey_t key(interaction->Signature(this->CacheKey() + tag), iedge);
+
+  map<KineEnvelopeKey_t, vector<double> >::iterator it = fEnvelopeEdges.find(key);
+  if(it != fEnvelopeEdges.end()) return it->second;
+
+  const int nu = ((ndim == 2) ? kEnv2DCells : kEnvCells) + 1;
+  const int n  = (ndim == 2) ? nu*nu : nu;
+  vector<double> & xsec = fEnvelopeEdges[key];
+  xsec.assign(n, 0.);
+
+  // look for the node values in the cache first
+  CacheBranchFx * cb = this->AccessCacheBranchEnv(interaction, ndim);
+  const map<double,double> & fmap = cb->Map();
+  int nfound = 0;
+  for(int j = 0; j < n; j++) {
+    map<double,double>::const_iterator iter = fmap.find(1000.*iedge + j);
+    if(iter == fmap.end()) break;
+    xsec[j] = iter->second;
+    nfound++;
+  }
+  if(nfound == n) return xsec;
+
+  double E = TMath::Power(10., (double)iedge / kEnvBinsPerDec);
+
+  Interaction scan(*interaction);
+  scan.InitStatePtr()->SetProbeE(E);
+  if(interaction->TestBit(kISkipProcessChk  )) scan.SetBit(kISkipProcessChk);
+  if(interaction->TestBit(kIAssumeFreeNucleon)) scan.SetBit(kIAssumeFreeNucleon);
+
+  for(int j = 0; j < n; j++) {
+    double value = (ndim == 2) ?
+      this->EnvelopeXSec2D(&scan, (double)(j/nu) / (nu-1), (double)(j%nu) / (nu-1)) :
+      this->EnvelopeXSec  (&scan, (double)j / (nu-1));
+    xsec[j] = TMath::Max(0., value);
+    cb->AddValues(1000.*iedge + j, xsec[j]);
+  }
+
+  return xsec;
+}
+//___________________________________________________________________________
+CacheBranchFx * KineGeneratorWithCache::AccessCacheBranchEnv(
+                            const Interaction * interaction, int ndim) const
+{
+// Returns the cache branch holding the envelope node values for this
+// algorithm and this interaction (keyed by 1000*E bin edge + node). If no
+// branch is found then one is created.
+
+  Cache * cache = Cache::Instance();
+
+  // look-up the branch through the hashed algorithm/interaction signature
+  string tag = (ndim == 2) ? "env2" : "env";
+  ULong64_t id = interaction->Signature(this->CacheKey() + "/" + tag);
+  CacheBranchFx * cache_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(id));
+  if(cache_branch) return cache_branch;
+
+  // build the cache branch key as: namespace::algorithm/config/interaction
+  string algkey = this->CacheKey();
+  string intkey = interaction->AsString();
+  string key    = cache->CacheBranchKey(algkey, intkey, tag);
+
+  cache_branch = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(!cache_branch) {
+    //-- create the cache branch at the first pass
+    LOG("Kinematics", pINFO) << "No max xsec envelope cache branch found";
+    LOG("Kinematics", pINFO) << "Creating cache branch - key = " << key;
+
+    cache_branch = new CacheBranchFx("max[d^nXSec/d^n{K}] envelope");
+    cache->AddCacheBranch(key, cache_branch);
+  }
+  assert(cache_branch);
+  cache->IndexCacheBranch(id, cache_branch);
+
+  return cache_branch;
+}
+//___________________________________________________________________________
@@ -28,12 +28,18 @@
 #define _KINE_GENERATOR_WITH_CACHE_H_
 
 #include <string>
+#include <vector>
+#include <map>
+#include <utility>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 #include "Framework/Utils/Range1.h"
 
 using std::string;
+using std::vector;
+using std::map;
+using std::pair;
 
 namespace genie {
 
@@ -42,6 +48,16 @@ class XSecAlgorithmI;
 
 class KineGeneratorWithCache : public EventRecordVisitorI {
 
+public:
+  // Fill the max{dxsec/dK} cache for the input interaction at the input
+  // (hit nucleon rest frame) energies, eg at spline-building time, along with
+  // the envelope node values over the E bins they span (if UseEnvelope)
+  void TabulateMaxXSec (const XSecAlgorithmI * xsec_model, 
+                        const Interaction * in, const vector<double> & energies) const;
+
+  // Statistics of the kinematics selection, summed over all events so far
+  long NTrials (void) const { return fNTrials; } ///< # of kinematics trials (rejection loop iterations)
+
 protected:
   KineGeneratorWithCache();
   KineGeneratorWithCache(string name);
@@ -54,16 +70,69 @@ protected:
   virtual void   CacheMaxXSec   (const Interaction * in, double xsec) const;
   virtual double Energy         (const Interaction * in) const;
 
+  //! key of this algorithm in the cache branch keys: its id, unless the max
+  //! xsec depends on parameters not in its configuration (eg particle masses)
+  virtual string          CacheKey          (void) const;
   virtual CacheBranchFx * AccessCacheBranch (const Interaction * in) const;
 
+  void CountTrial (void) const;
+
   virtual void AssertXSecLimits (const Interaction * in, double xsec, double xsec_max) const;
 
+  //! envelope of the xsec in one (or two) kinematic variables, normalized to
+  //! [0,1] by their E-dependent limits: majorant in each cell of a uniform
+  //! grid, per E bin
+  struct KineEnvelope_t {
+    vector<double> value; ///< majorant in each cell
+    vector<double> cdf;   ///< cumulative sum of the cell majorants
+  };
+  //! interaction signature & E bin or bin edge
+  typedef pair<ULong64_t, int> KineEnvelopeKey_t;
+
+  //! how kinematics are generated when an envelope is available (Envelope-Mode)
+  typedef enum EKineEnvelopeMode {
+    kEnvRejection = 0, ///< "rejection": accept/reject against the cell majorants (exact)
+    kEnvWeighted,      ///< "weighted": draw from the surrogate, weight by xsec/surrogate
+    kEnvApproximate    ///< "approximate": draw from the surrogate, no xsec call
+  } KineEnvelopeMode_t;
+
+  KineEnvelope_t * Envelope         (const Interaction * in, double E, int ndim = 1) const;
+  double           SampleEnvelope   (const KineEnvelope_t & env, double r1, double r2, int & icell) const;
+  void             SampleEnvelope2D (const KineEnvelope_t & env, double r1, double r2, double r3,
+                                     double & u, double & v, int & icell) const;
+  void             RaiseEnvelope    (KineEnvelope_t * env, int icell, double xsec) const;
+  virtual double   EnvelopeXSec     (Interaction * in, double u) const;
+  virtual double   EnvelopeXSec2D   (Interaction * in, double u, double v) const;
+  //! # of envelope variables of the subclass: 1 if it implements EnvelopeXSec(),
+  //! 2 for EnvelopeXSec2D(), 0 if it has no envelope
+  virtual int      EnvelopeDim      (void) const { return 0; }
+
+  //! surrogate of the xsec: the envelope node values, interpolated linearly
+  //! in log(E) and (bi)linearly between the nodes, for envelopes whose node
+  //! values are the xsec itself (not maxima over other variables)
+  double           SampleSurrogate  (const Interaction * in, double E, int ndim,
+                                     double r1, double r2, double r3,
+                                     double & u, double & v) const;
+  void             WeightSurrogate  (GHepRecord * evrec, double xsec, double surrogate) const;
+  void             LoadEnvelopeMode (void);
+
+  const vector<double> & EnvelopeEdge         (const Interaction * in, int iedge, int ndim = 1) const;
+  CacheBranchFx *        AccessCacheBranchEnv (const Interaction * in, int ndim = 1) const;
+
   mutable const XSecAlgorithmI * fXSecModel;
 
   double fSafetyFactor;         ///< maxxsec -> maxxsec * safety_factor
   double fMaxXSecDiffTolerance; ///< max{100*(xsec-maxxsec)/.5*(xsec+maxxsec)} if xsec>maxxsec
   double fEMin;                 ///< min E for which maxxsec is cached - forcing explicit calc.
   bool   fGenerateUniformly;    ///< uniform over allowed phase space + event weight?
+  bool   fUseEnvelope;          ///< sample kinematics against the envelope (if EnvelopeXSec() or EnvelopeXSec2D() is implemented)?
+  double fEnvelopeSafety;       ///< safety factor applied on the envelope node xsecs
+  KineEnvelopeMode_t fEnvelopeMode; ///< sampling mode when an envelope is available
+
+  mutable long fNTrials;        ///< # of kinematics trials so far
+
+  mutable map<KineEnvelopeKey_t, KineEnvelope_t>  fEnvelopes;     ///< per E bin
+  mutable map<KineEnvelopeKey_t, vector<double> > fEnvelopeEdges; ///< xsec at the nodes per E bin edge
 };
 
 }      // genie namespace
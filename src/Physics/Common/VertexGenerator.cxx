@@ -26,6 +26,10 @@
    can easily be reused by other classes. (Specifically LwlynSmithQELCCPXSec
    and NievesQELCCPXSec to generate a position before calculating the xsec
    when making splines).
+ @ Oct 14, 2026 - CA
+   Generate the radius of vertices distributed according to the nuclear
+   density from the tabulated cumulative distribution rather than by
+   rejection.
 */
 //____________________________________________________________________________
 
@@ -163,52 +167,19 @@ TVector3 VertexGenerator::GenerateVertex(const Interaction * interaction,
       //
       LOG("Vtx", pINFO) 
 	<< "Generating vertex according to a realistic nuclear density profile";
-      // get inputs to the rejection method
-      double ymax = -1;
+      // select the radius from the cumulative r^2 rho(r) distribution
       double rmax = 3*R;
-      double dr   = R/40.;
-      for(double r = 0; r < rmax; r+=dr) { 
-	ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,(int)A)); 
-      }
-      ymax *= 1.2;
-        
-      // select a vertex using the rejection method
-      unsigned int iter = 0;
-      while(1) {
-	iter++;
-	
-	// throw an exception if it hasn't find a solution after many attempts
-	if(iter > kRjMaxIterations) {
-	  LOG("Vtx", pWARN)
-	    << "Couldn't generate a vertex position after " << iter << " iterations";
-	  //evrec->EventFlags()->SetBitNumber(kGenericErr, true);
-	  genie::exceptions::EVGThreadException exception;
-	  exception.SetReason("Couldn't generate vertex");
-	  exception.SwitchOnFastForward();
-	  throw exception;
-	}
-	
-	double r = rmax * rnd->RndFsi().Rndm();
-	double t = ymax * rnd->RndFsi().Rndm();
-	double y = r*r * utils::nuclear::Density(r,(int)A);
-	if(y > ymax) {
-	  LOG("Vtx", pERROR)
-	    << "y = " << y << " > ymax = " << ymax 
-	    << " for r = " << r << ", A = " << A;
-	}
-	bool accept = (t < y);
-	if(accept) {
-	  double phi      = 2*kPi * rnd->RndFsi().Rndm();
-	  double cosphi   = TMath::Cos(phi);
-	  double sinphi   = TMath::Sin(phi);
-	  double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-	  double sintheta = TMath::Sqrt(1-costheta*costheta);
-	  vtx.SetX(r*sintheta*cosphi);
-	  vtx.SetY(r*sintheta*sinphi);
-	  vtx.SetZ(r*costheta);
-	  break;
-	}
-      }//w(1)
+      double r    = utils::nuclear::RadiusQuantile(
+                               (int)A, rnd->RndFsi().Rndm(), rmax);
+
+      double phi      = 2*kPi * rnd->RndFsi().Rndm();
+      double cosphi   = TMath::Cos(phi);
+      double sinphi   = TMath::Sin(phi);
+      double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+      double sintheta = TMath::Sqrt(1-costheta*costheta);
+      vtx.SetX(r*sintheta*cosphi);
+      vtx.SetY(r*sintheta*sinphi);
+      vtx.SetZ(r*costheta);
     } //use density?
     
     if(uniform) {
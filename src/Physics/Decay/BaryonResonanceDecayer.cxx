@@ -115,11 +115,11 @@ bool BaryonResonanceDecayer::Decay(
     return false;
   }
 
-  bool to_be_deleted ; 
+  bool is_piN = false ;
 
   // Select a decay channel
   TDecayChannel * selected_decay_channel =
-    this->SelectDecayChannel(decay_particle_id, event, to_be_deleted ) ;
+    this->SelectDecayChannel(decay_particle_id, event, is_piN ) ;
 
   if(!selected_decay_channel) {
     LOG("ResonanceDecay", pERROR)
@@ -131,10 +131,7 @@ bool BaryonResonanceDecayer::Decay(
   }
 
   // Decay the exclusive state and copy daughters in the event record
-  bool decayed = this->DecayExclusive(decay_particle_id, event, selected_decay_channel);
-
-  if ( to_be_deleted ) 
-    delete selected_decay_channel ; 
+  bool decayed = this->DecayExclusive(decay_particle_id, event, selected_decay_channel, is_piN);
 
   if ( ! decayed ) return false ;
 
@@ -150,7 +147,7 @@ bool BaryonResonanceDecayer::Decay(
 //____________________________________________________________________________
 TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_id, 
 							    GHepRecord * event, 
-							    bool & to_be_deleted ) const
+							    bool & is_piN ) const
 {
   // Get particle to be decayed
   GHepParticle * decay_particle = event->Particle(decay_particle_id);
@@ -160,17 +157,16 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
   TLorentzVector decay_particle_p4 = *(decay_particle->P4());
   int decay_particle_pdg_code = decay_particle->Pdg();
 
-  // Find the particle in the PDG library & quit if it does not exist
-  TParticlePDG * mother =
-     PDGLibrary::Instance()->Find(decay_particle_pdg_code);
-  if(!mother) {
+  // Find the decay channel table of the particle & quit if it does not exist
+  const DecayTable_t * table = this->DecayTable(decay_particle_pdg_code);
+  if(!table) {
      LOG("ResonanceDecay", pERROR)
         << "\n *** The particle with PDG code = " << decay_particle_pdg_code
          << " was not found in PDGLibrary";
      return 0;
   }
   LOG("ResonanceDecay", pINFO)
-    << "Decaying a " << mother->GetName()
+    << "Decaying a " << table->name
     << " with P4 = " << utils::print::P4AsString(&decay_particle_p4);
 
   // Get the resonance mass W (generally different from the mass associated
@@ -178,47 +174,46 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
   double W = decay_particle_p4.M();
   LOG("ResonanceDecay", pINFO) << "Available mass W = " << W;
 
-  // Get all decay channels
-  TObjArray * original_decay_list = mother->DecayList();
-
-  unsigned int nch = original_decay_list -> GetEntries();
+  unsigned int nch = table->fsmass.size();
   LOG("ResonanceDecay", pINFO)
-    << mother->GetName() << " has: " << nch << " decay channels";
+    << table->name << " has: " << nch << " decay channels";
 
   // Loop over the decay channels (dc) and write down the branching
   // ratios to be used for selecting a decay channel.
   // Since a baryon resonance can be created at W < Mres, explicitly
-  // check and inhibit decay channels for which W > final-state-mass
+  // check and inhibit decay channels for which W > final-state-mass.
+  // For the Deltas, the branching ratios are evolved at this W and the
+  // channels with a vanishing width are dropped.
 
   bool has_evolved_brs = BaryonResonanceDecayer::HasEvolvedBRs( decay_particle_pdg_code ) ; 
-  
-  TObjArray * actual_decay_list = nullptr ;
 
+  double BR[nch], tot_BR = 0;
+  unsigned int ich_list[nch], nlist = 0;
+
+  double widths[nch], tot_width = 0. ;
   if ( has_evolved_brs ) {
-    actual_decay_list = EvolveDeltaBR( decay_particle_pdg_code, original_decay_list, W ) ;
-    if ( ! actual_decay_list ) return nullptr ;
-    nch = actual_decay_list -> GetEntries() ;
-    to_be_deleted = true ;
-  }
-  else {
-    actual_decay_list = original_decay_list ;
-    to_be_deleted = false ;
+    for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+      tot_width += widths[ich] = this->EvolveDeltaDecayWidth( *table, ich, W ) ;
+    }
+    if ( tot_width <= 0. ) return nullptr ;
   }
 
-  double BR[nch], tot_BR = 0;
-
   for(unsigned int ich = 0; ich < nch; ich++) {
 
-    TDecayChannel * ch = (TDecayChannel *) actual_decay_list -> At(ich);
+    double br = table->br[ich];
+    if ( has_evolved_brs ) {
+      if ( widths[ich] <= 0. ) continue ;
+      br = widths[ich] / tot_width ;
+    }
 
-    double fsmass = this->FinalStateMass(ch) ;
+    double fsmass = table->fsmass[ich] ;
     if ( fsmass < W ) {
 
       SLOG("ResonanceDecay", pDEBUG)
                 << "Using channel: " << ich
                 << " with final state mass = " << fsmass << " GeV";
 
-      tot_BR += ch->BranchingRatio();
+      tot_BR += br;
 
     } else {
       SLOG("ResonanceDecay", pINFO)
@@ -226,7 +221,8 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
                 << " with final state mass = " << fsmass << " GeV";
     } // final state mass
 
-    BR[ich] = tot_BR;
+    BR[nlist] = tot_BR;
+    ich_list[nlist++] = ich;
   }//channel loop
 
   if( tot_BR <= 0. ) {
@@ -236,33 +232,28 @@ TDecayChannel * BaryonResonanceDecayer::SelectDecayChannel( int decay_particle_i
   }
 
   // Select a resonance based on the branching ratios
-  unsigned int ich = 0, sel_ich; // id of selected decay channel
+  unsigned int ilist = 0, sel_ilist; // id of selected decay channel
   RandomGen * rnd = RandomGen::Instance();
   double x = tot_BR * rnd->RndDec().Rndm();
   do {
-    sel_ich = ich;
-  } while (x > BR[ich++]);
+    sel_ilist = ilist;
+  } while (x > BR[ilist++]);
 
-  TDecayChannel * sel_ch = (TDecayChannel *) actual_decay_list -> At(sel_ich);
+  unsigned int sel_ich = ich_list[sel_ilist];
+  TDecayChannel * sel_ch = (TDecayChannel *) table->decays->At(sel_ich);
+  is_piN = table->is_piN[sel_ich];
 
   LOG("ResonanceDecay", pINFO)
     << "Selected " << sel_ch->NDaughters() << "-particle decay channel ("
-    << sel_ich << ") has BR = " << sel_ch->BranchingRatio();
-
-  if ( has_evolved_brs ) {
-
-    for ( unsigned int i = 0; i < nch; ++i) {
-      if ( sel_ich != i ) delete actual_decay_list -> At(i);
-    }
-
-    delete actual_decay_list ;
-  }
+    << sel_ich << ") has BR = " 
+    << (BR[sel_ilist] - ((sel_ilist > 0) ? BR[sel_ilist-1] : 0.));
 
   return sel_ch;
 }
 //____________________________________________________________________________
 bool BaryonResonanceDecayer::DecayExclusive(
-  int decay_particle_id, GHepRecord * event, TDecayChannel * ch) const
+  int decay_particle_id, GHepRecord * event, TDecayChannel * ch,
+  bool is_piN) const
 {
   // Find the particle to be decayed in the event record
   GHepParticle * decay_particle = event->Particle(decay_particle_id);
@@ -300,7 +291,7 @@ bool BaryonResonanceDecayer::DecayExclusive(
                    decay_particle_pdg_code == kPdgP33m1232_DeltaP  ||
                    decay_particle_pdg_code == kPdgP33m1232_Delta0);
 
-  bool is_delta_N_Pi_decay = is_delta && this->IsPiNDecayChannel(ch);
+  bool is_delta_N_Pi_decay = is_delta && is_piN;
 
   // Decay the resonance using an N-body phase space generator
   // The particle will be decayed in its rest frame and then the daughters
@@ -424,58 +415,110 @@ bool BaryonResonanceDecayer::DecayExclusive(
   return true ;
 }
 //__________________________________________________________________________________
-TObjArray *  BaryonResonanceDecayer::EvolveDeltaBR(int dec_part_pdgc, TObjArray * decay_list, double W) const {
-
-  unsigned int nch = decay_list -> GetEntries();
+const BaryonResonanceDecayer::DecayTable_t * 
+  BaryonResonanceDecayer::DecayTable(int dec_part_pdgc) const
+{
+// The decay channel table of the input resonance, built at first use:
+// final state masses, nominal branching ratios, pi N tag, and the W-
+// independent ingredients of the Delta decay width evolution
 
-  std::vector<double> widths( nch, 0. ) ;
-  double tot = 0. ;
+  std::map<int, DecayTable_t>::const_iterator it = fDecayTables.find(dec_part_pdgc);
+  if(it != fDecayTables.end()) return &(it->second);
 
-  TDecayChannel * temp = nullptr ;
+  TParticlePDG * mother = PDGLibrary::Instance()->Find(dec_part_pdgc);
+  if(!mother) return 0;
 
-  for ( unsigned int i = 0 ; i < nch ; ++i ) {
+  TObjArray * decay_list = mother->DecayList();
+  if(!decay_list) return 0;
 
-    temp = (TDecayChannel*) decay_list -> At(i) ;
-    tot += widths[i] = EvolveDeltaDecayWidth(dec_part_pdgc, temp, W ) ;
+  DecayTable_t & table = fDecayTables[dec_part_pdgc];
+  table.name   = mother->GetName();
+  table.decays = decay_list;
 
+  bool is_delta = BaryonResonanceDecayer::IsDelta( dec_part_pdgc ) ;
+  double m = 0, width = 0;
+  if ( is_delta ) {
+    Resonance_t res = genie::utils::res::FromPdgCode( dec_part_pdgc ) ;
+    m     = genie::utils::res::Mass ( res ) ;
+    width = genie::utils::res::Width( res ) ;
   }
+  double m_2 = TMath::Power(m, 2);
 
-  if ( tot <= 0. ) return nullptr ;
-
-  TObjArray * new_list = new TObjArray() ;
-
-  TDecayChannel * update = nullptr ;
+  unsigned int nch = decay_list -> GetEntries();
+  for ( unsigned int ich = 0 ; ich < nch ; ++ich ) {
+
+    TDecayChannel * ch = (TDecayChannel *) decay_list -> At(ich);
+
+    table.fsmass.push_back( this->FinalStateMass(ch) ) ;
+    table.br    .push_back( ch->BranchingRatio() ) ;
+    table.is_piN.push_back( this->IsPiNDecayChannel(ch) ) ;
+
+    DeltaWidthEvol_t evol ;
+    evol.has_pion = false ;
+    evol.mN_2     = 0. ;
+    evol.m_aux1   = 0. ;
+    evol.m_aux2   = 0. ;
+    evol.p_m      = 0. ;
+    evol.f_m      = 0. ;
+    evol.width    = 0. ;
+
+    if ( is_delta ) {
+
+      // The delta decays only in 3 ways
+      // Delta -> Charged Pi + N
+      // Delta -> Pi0 + N
+      // Delta -> Gamma + N
+      // They have evolution as a function of W that are different if the
+      // final state has pions or not, so having tagged the pion is enough
+
+      int pion_id = -1 ;
+      int nucleon_id = -1 ;
+      unsigned int nd = ch -> NDaughters() ;
+      for(unsigned int i = 0 ; i < nd; ++i ) {
+        if ( genie::pdg::IsPion( ch -> DaughterPdgCode(i) ) ) {
+          evol.has_pion = true ;
+          pion_id = i ;
+        }
+        if ( genie::pdg::IsNucleon( ch -> DaughterPdgCode(i) ) ) {
+          nucleon_id = i ;
+        }
+      }
 
-  for ( unsigned int i = 0 ; i < nch ; ++i ) {
+      double mN = ( nucleon_id >= 0 && genie::pdg::IsProton( ch -> DaughterPdgCode( nucleon_id ) ) ) ?
+                  genie::constants::kProtonMass : genie::constants::kNucleonMass ;
+      evol.mN_2 = TMath::Power( mN, 2);
 
-    if ( widths[i] <= 0. ) continue ;
+      if ( evol.has_pion ) {
+        double mPion = TMath::Abs( ch -> DaughterPdgCode( pion_id ) ) == kPdgPiP ? genie::constants::kPionMass : genie::constants::kPi0Mass ;
+        evol.m_aux1 = TMath::Power( mN + mPion, 2) ;
+        evol.m_aux2 = TMath::Power( mN - mPion, 2) ;
 
-    temp = (TDecayChannel*) decay_list -> At(i) ;
+        // momentum of the pion in the Delta reference frame, at the default Delta mass
+        evol.p_m = TMath::Sqrt((m_2-evol.m_aux1)*(m_2-evol.m_aux2))/(2*m);
+      }
+      else {
+        // energy of the photon in the Delta reference frame, and photon
+        // production form factor, at the default Delta mass
+        evol.p_m = (m_2-evol.mN_2)/(2*m);
+        evol.f_m = 1./(TMath::Power(1+evol.p_m*evol.p_m/fFFScaling, 2));
+      }
 
-    unsigned int nd = temp -> NDaughters() ;
-    std::vector<Int_t> ds( nd, 0 ) ;
-    for ( unsigned int d = 0 ; d < nd; ++d ) {
-      ds[d] = temp -> DaughterPdgCode(d) ;
+      // width of the decay in this channel at the nominal mass of the delta
+      evol.width = ch -> BranchingRatio() * width ;
     }
 
-    update = new TDecayChannel(
-        temp -> Number(),
-        temp -> MatrixElementCode(),
-        widths[i] / tot,
-        nd,
-        & ds[0]
-        ) ;
-
-    new_list -> Add( update ) ;
+    table.evol.push_back( evol ) ;
   }
 
-  new_list -> SetOwner(kFALSE);
+  LOG("ResonanceDecay", pINFO)
+    << "Built decay channel table for " << table.name
+    << " (" << nch << " channels)";
 
-  return new_list ;
+  return &table;
 }
-
 //____________________________________________________________________________
-double BaryonResonanceDecayer::EvolveDeltaDecayWidth(int dec_part_pdgc, TDecayChannel * ch, double W) const {
+double BaryonResonanceDecayer::EvolveDeltaDecayWidth(
+  const DecayTable_t & table, unsigned int ich, double W) const {
 
   /*
    * The decay widths of the Delta in Pions or in N gammas are not constant.
@@ -484,35 +527,10 @@ double BaryonResonanceDecayer::EvolveDeltaDecayWidth(int dec_part_pdgc, TDecayCh
    * returns the proper one depending on the specific decay channel.
    */
 
-  // identify the decay channel
-  // The delta decays only in 3 ways
-  // Delta -> Charged Pi + N
-  // Delta -> Pi0 + N
-  // Delta -> Gamma + N
-
-  // They have evolution as a function of W that are different if the final state has pions or not
-  // so having tagged the pion is enough for the purpose of this method.
-
-  bool has_pion = false ;
-  int pion_id = -1 ;
-  int nucleon_id = -1 ;
-  unsigned int nd = ch -> NDaughters() ;
-  for(unsigned int i = 0 ; i < nd; ++i ) {
-    if ( genie::pdg::IsPion( ch -> DaughterPdgCode(i) ) ) {
-      has_pion = true ;
-      pion_id = i ;
-    }
-
-    if ( genie::pdg::IsNucleon( ch -> DaughterPdgCode(i) ) ) {
-      nucleon_id = i ;
-    }
-  }
-
-
   // The first and most trivial evolution of the Width as a function of W
   // is that if W is lower then the final state mass the width collapses to 0.
 
-  if ( W < this -> FinalStateMass( ch ) ) {
+  if ( W < table.fsmass[ich] ) {
 
     return 0. ;
 
@@ -536,52 +554,34 @@ double BaryonResonanceDecayer::EvolveDeltaDecayWidth(int dec_part_pdgc, TDecayCh
   //  - pi_* are the momentum of the gamma and of the pion coming from the decay
   //  - F_ga is the form factor
   //
-  // So the new amplitudes are evaluated and the proper value is returned
+  // The values at the nominal Delta mass are taken from the decay table.
 
-  // Getting the delta resonance from GENIE database
-   Resonance_t res = genie::utils::res::FromPdgCode( dec_part_pdgc ) ;
-
-   double m = genie::utils::res::Mass( res ) ;
-   double m_2   = TMath::Power(m, 2);
-
-   double mN = genie::pdg::IsProton( ch -> DaughterPdgCode( nucleon_id ) ) ?  genie::constants::kProtonMass : genie::constants::kNucleonMass ;
-   double mN_2  = TMath::Power( mN,     2);
+   const DeltaWidthEvol_t & evol = table.evol[ich] ;
 
    double W_2   = TMath::Power(W,      2);
 
    double scaling = 0. ;
 
-   if ( has_pion ) {
-
-     double mPion = TMath::Abs( ch -> DaughterPdgCode( pion_id ) ) == kPdgPiP ? genie::constants::kPionMass : genie::constants::kPi0Mass ;
-     double m_aux1= TMath::Power( mN + mPion, 2) ;
-     double m_aux2= TMath::Power( mN - mPion, 2) ;
+   if ( evol.has_pion ) {
 
      // momentum of the pion in the Delta reference frame
-     double pPi_W    = TMath::Sqrt((W_2-m_aux1)*(W_2-m_aux2))/(2*W);  // at W
-     double pPi_m    = TMath::Sqrt((m_2-m_aux1)*(m_2-m_aux2))/(2*m);  // at the default Delta mass
+     double pPi_W    = TMath::Sqrt((W_2-evol.m_aux1)*(W_2-evol.m_aux2))/(2*W);  // at W
 
-     scaling = TMath::Power( pPi_W / pPi_m , 3 ) ;
+     scaling = TMath::Power( pPi_W / evol.p_m , 3 ) ;
 
    }
    else {
 
      // momentum of the photon in the Delta Reference frame = Energy of the photon
-     double Egamma_W = (W_2-mN_2)/(2*W);  // at W
-     double Egamma_m = (m_2-mN_2)/(2*m);  // at the default Delta mass
+     double Egamma_W = (W_2-evol.mN_2)/(2*W);  // at W
 
      // form factor of the photon production
      double fgamma_W = 1./(TMath::Power(1+Egamma_W*Egamma_W/fFFScaling, 2));
-     double fgamma_m = 1./(TMath::Power(1+Egamma_m*Egamma_m/fFFScaling, 2));
 
-     scaling = TMath::Power( Egamma_W / Egamma_m, 3 ) * TMath::Power( fgamma_W / fgamma_m , 2 ) ;
+     scaling = TMath::Power( Egamma_W / evol.p_m, 3 ) * TMath::Power( fgamma_W / evol.f_m , 2 ) ;
    }
 
-   // get the width of the delta and obtain the width of the decay in the channel we are evolving
-   // evaluated at the nominal mass of the delta
-   double defChWidth    = ch -> BranchingRatio() * genie::utils::res::Width( res ) ;
-
-   return defChWidth * scaling ;
+   return evol.width * scaling ;
 
 }
 //____________________________________________________________________________
@@ -780,6 +780,9 @@ void BaryonResonanceDecayer::LoadConfig(void) {
 
   this -> GetParam( "FFScaling", fFFScaling ) ;
 
+  // the decay channel tables depend on the configuration
+  fDecayTables.clear() ;
+
   this -> GetParamDef( "Delta-ThetaOnly", fDeltaThetaOnly, true ) ;
 
   bool invalid_configuration = false ;
@@ -25,6 +25,9 @@
 #ifndef _BARYON_RESONANCE_DECAYER_H_
 #define _BARYON_RESONANCE_DECAYER_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 #include <TLorentzVector.h>
 
@@ -53,13 +56,35 @@ private:
   void           UnInhibitDecay    (int pdgc, TDecayChannel * ch=0) const;
   double         Weight            (void) const;
   bool           Decay             (int dec_part_id, GHepRecord * event) const;
-  TDecayChannel* SelectDecayChannel(int dec_part_id, GHepRecord * event, bool & to_be_deleted ) const;
-  // the flag to_be_deleted is referred to the returned decay channel 
-  bool           DecayExclusive    (int dec_part_id, GHepRecord * event, TDecayChannel * ch) const;
+  TDecayChannel* SelectDecayChannel(int dec_part_id, GHepRecord * event, bool & is_piN ) const;
+  // the flag is_piN tells whether the returned decay channel is pi N
+  bool           DecayExclusive    (int dec_part_id, GHepRecord * event, TDecayChannel * ch, bool is_piN) const;
+
+  //! W-independent ingredients of the Delta decay width evolution, per channel
+  struct DeltaWidthEvol_t {
+    bool   has_pion;  ///< pi N (else gamma N) channel?
+    double mN_2;      ///< nucleon mass squared
+    double m_aux1;    ///< (mN + mpi)^2
+    double m_aux2;    ///< (mN - mpi)^2
+    double p_m;       ///< pion momentum or photon energy at the nominal Delta mass
+    double f_m;       ///< photon form factor at the nominal Delta mass
+    double width;     ///< channel width at the nominal Delta mass
+  };
+
+  //! Decay channel table of a resonance
+  struct DecayTable_t {
+    string                        name;   ///< resonance name
+    TObjArray *                   decays; ///< decay channels (owned by the PDG library)
+    std::vector<double>           fsmass; ///< final state mass per channel
+    std::vector<double>           br;     ///< nominal branching ratio per channel
+    std::vector<bool>             is_piN; ///< pi N channel?
+    std::vector<DeltaWidthEvol_t> evol;   ///< Delta width evolution (Deltas only)
+  };
+
+  const DecayTable_t * DecayTable (int dec_part_pdgc) const;
 
   // Methods specific for Delta decay
-  TObjArray *    EvolveDeltaBR        (int dec_part_pdgc, TObjArray * decay_list, double W) const;
-  double         EvolveDeltaDecayWidth(int dec_part_pdgc, TDecayChannel * ch, double W) const;
+  double         EvolveDeltaDecayWidth(const DecayTable_t & t, unsigned int ich, double W) const;
   bool           AcceptPionDecay( TLorentzVector lab_pion, int dec_part_id, const GHepRecord * event ) const ;
 
   double         FinalStateMass    ( TDecayChannel * ch ) const;
@@ -80,6 +105,8 @@ private:
 
   double fFFScaling ;  // Scaling factor of the form factor of the Delta wrt to Q2
 
+  mutable std::map<int, DecayTable_t> fDecayTables ;  ///< decay channel tables, built at first use
+
 };
 
 }         // genie namespace
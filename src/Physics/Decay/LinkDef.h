@@ -11,5 +11,6 @@
 #pragma link C++ class genie::BaryonResonanceDecayer;
 
 #pragma link C++ class genie::UnstableParticleDecayer;
+#pragma link C++ class genie::Pythia6Session;
 
 #endif
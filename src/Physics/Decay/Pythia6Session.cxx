@@ -0,0 +1,153 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+*/
+//____________________________________________________________________________
+
+#include <TPythia6.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Physics/Decay/Pythia6Session.h"
+
+using namespace genie;
+
+//____________________________________________________________________________
+Pythia6Session * Pythia6Session::fInstance = 0;
+//____________________________________________________________________________
+Pythia6Session::Pythia6Session()
+{
+  fInstance = 0;
+  fPythia   = TPythia6::Instance();
+  fCurrent  = kP6cDecayer;
+
+  // hadronization: keep pi0, K0, Lambda for the GENIE decayer / hadron
+  // transport, decay the Deltas
+  this->Override(kP6cHadronization, kPdgPi0,               0);
+  this->Override(kP6cHadronization, kPdgK0,                0);
+  this->Override(kP6cHadronization, kPdgAntiK0,            0);
+  this->Override(kP6cHadronization, kPdgLambda,            0);
+  this->Override(kP6cHadronization, kPdgAntiLambda,        0);
+  this->Override(kP6cHadronization, kPdgP33m1232_DeltaM,   1);
+  this->Override(kP6cHadronization, kPdgP33m1232_Delta0,   1);
+  this->Override(kP6cHadronization, kPdgP33m1232_DeltaP,   1);
+  this->Override(kP6cHadronization, kPdgP33m1232_DeltaPP,  1);
+
+  // charm remnant hadronization: keep pi0, decay the Deltas
+  this->Override(kP6cCharmHadronization, kPdgPi0,              0);
+  this->Override(kP6cCharmHadronization, kPdgP33m1232_DeltaM,  1);
+  this->Override(kP6cCharmHadronization, kPdgP33m1232_Delta0,  1);
+  this->Override(kP6cCharmHadronization, kPdgP33m1232_DeltaP,  1);
+  this->Override(kP6cCharmHadronization, kPdgP33m1232_DeltaPP, 1);
+}
+//____________________________________________________________________________
+Pythia6Session::~Pythia6Session()
+{
+  fInstance = 0;
+}
+//____________________________________________________________________________
+Pythia6Session * Pythia6Session::Instance()
+{
+  if(fInstance == 0) {
+    static Pythia6Session::Cleaner cleaner;
+    cleaner.DummyMethodAndSilentCompiler();
+
+    fInstance = new Pythia6Session;
+  }
+  return fInstance;
+}
+//____________________________________________________________________________
+void Pythia6Session::Use(Pythia6Consumer_t c)
+{
+  if(c == fCurrent) return;
+
+  LOG("Pythia6Session", pDEBUG)
+     << "Switching PYTHIA6 decay flags: consumer " << fCurrent << " -> " << c;
+
+  // apply the flags of the new consumer
+  for(unsigned int i = 0; i < fOvrKC[c].size(); i++) {
+    this->Write(fOvrKC[c][i], fOvrFlag[c][i]);
+  }
+  // restore the defaults for the flags overriden by the old consumer only
+  int flag = 0;
+  for(unsigned int i = 0; i < fOvrKC[fCurrent].size(); i++) {
+    int kc = fOvrKC[fCurrent][i];
+    if(this->Overrides(c, kc, flag)) continue;
+    this->Write(kc, this->Default(kc));
+  }
+  fCurrent = c;
+}
+//____________________________________________________________________________
+int Pythia6Session::Pycomp(int pdgc)
+{
+  map<int,int>::const_iterator it = fKC.find(pdgc);
+  if(it != fKC.end()) return it->second;
+
+  int kc = fPythia->Pycomp(pdgc);
+  fKC[pdgc] = kc;
+  return kc;
+}
+//____________________________________________________________________________
+int Pythia6Session::DecayFlag(int pdgc)
+{
+  return this->Default(this->Pycomp(pdgc));
+}
+//____________________________________________________________________________
+void Pythia6Session::SetDecayFlag(int pdgc, int flag)
+{
+  int kc = this->Pycomp(pdgc);
+  this->Default(kc);
+  fDefault[kc] = flag;
+
+  // write through, unless the current consumer overrides this flag
+  int ovr = 0;
+  if(!this->Overrides(fCurrent, kc, ovr)) this->Write(kc, flag);
+}
+//____________________________________________________________________________
+void Pythia6Session::Override(Pythia6Consumer_t c, int pdgc, int flag)
+{
+  fOvrKC  [c].push_back(this->Pycomp(pdgc));
+  fOvrFlag[c].push_back(flag);
+}
+//____________________________________________________________________________
+int Pythia6Session::Default(int kc)
+{
+// The default flag is read from PYTHIA6 at first use: flags not yet written
+// through this class still have their default value
+
+  map<int,int>::const_iterator it = fDefault.find(kc);
+  if(it != fDefault.end()) return it->second;
+
+  int flag = fPythia->GetMDCY(kc, 1);
+  fDefault[kc] = flag;
+  fFlag   [kc] = flag;
+  return flag;
+}
+//____________________________________________________________________________
+void Pythia6Session::Write(int kc, int flag)
+{
+  this->Default(kc);
+  if(fFlag[kc] == flag) return;
+
+  fPythia->SetMDCY(kc, 1, flag);
+  fFlag[kc] = flag;
+}
+//____________________________________________________________________________
+bool Pythia6Session::Overrides(Pythia6Consumer_t c, int kc, int & flag) const
+{
+  for(unsigned int i = 0; i < fOvrKC[c].size(); i++) {
+    if(fOvrKC[c][i] == kc) {
+      flag = fOvrFlag[c][i];
+      return true;
+    }
+  }
+  return false;
+}
+//____________________________________________________________________________
@@ -0,0 +1,101 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::Pythia6Session
+
+\brief    Manages the PYTHIA6 particle decay flags (MDCY(KC,1)) shared by the
+          GENIE modules calling PYTHIA6 (decayer, hadronizers).
+
+          Each consumer declares the decay flags it needs through Use(). The
+          flags required by a consumer are applied when it takes over PYTHIA6
+          from a different consumer, and the default flags (the ones seen
+          by the PYTHIA6 decayer, and set through SetDecayFlag()) are
+          restored for particles not overriden by the new consumer. Only the
+          flags that actually change are written to the PYTHIA6 common
+          blocks, and PYTHIA6 KC codes are cached.
+          All changes of decay flags should go through this class.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _PYTHIA6_SESSION_H_
+#define _PYTHIA6_SESSION_H_
+
+#include <map>
+#include <vector>
+
+class TPythia6;
+
+using std::map;
+using std::vector;
+
+namespace genie {
+
+typedef enum EPythia6Consumer {
+  kP6cDecayer = 0,          ///< default decay flags
+  kP6cHadronization,        ///< PYTHIA6 (and KNO/PYTHIA6) hadronization
+  kP6cCharmHadronization,   ///< hadronization of the charm remnant system
+  kNP6Consumers
+} Pythia6Consumer_t;
+
+class Pythia6Session
+{
+public:
+
+  static Pythia6Session * Instance(void);
+
+  //! Switch the PYTHIA6 decay flags to the ones required by consumer c
+  void Use          (Pythia6Consumer_t c);
+
+  int  Pycomp       (int pdgc);            ///< (cached) PYTHIA6 KC code
+  int  DecayFlag    (int pdgc);            ///< default MDCY(KC,1) of pdgc
+  void SetDecayFlag (int pdgc, int flag);  ///< set default MDCY(KC,1) of pdgc
+
+  Pythia6Consumer_t Current (void) const { return fCurrent; }
+
+private:
+
+  void Override (Pythia6Consumer_t c, int pdgc, int flag);
+  int  Default  (int kc);
+  void Write    (int kc, int flag);
+  bool Overrides(Pythia6Consumer_t c, int kc, int & flag) const;
+
+  //! singleton instance
+  static Pythia6Session * fInstance;
+
+  TPythia6 *        fPythia;   ///< PYTHIA6 wrapper class
+  Pythia6Consumer_t fCurrent;  ///< consumer whose flags are currently applied
+  map<int,int>      fKC;       ///< pdg code -> PYTHIA6 KC code
+  map<int,int>      fDefault;  ///< KC -> default MDCY(KC,1)
+  map<int,int>      fFlag;     ///< KC -> MDCY(KC,1) currently in PYTHIA6
+  vector<int>       fOvrKC   [kNP6Consumers]; ///< KC codes overriden by each consumer
+  vector<int>       fOvrFlag [kNP6Consumers]; ///< corresponding MDCY(KC,1)
+
+  //! singleton class: constructors are private
+  Pythia6Session();
+  Pythia6Session(const Pythia6Session & session);
+  virtual ~Pythia6Session();
+
+  //! proper de-allocation of the singleton object
+  struct Cleaner {
+      void DummyMethodAndSilentCompiler() { }
+      ~Cleaner() {
+         if (Pythia6Session::fInstance !=0) {
+            delete Pythia6Session::fInstance;
+            Pythia6Session::fInstance = 0;
+         }
+      }
+  };
+  friend struct Cleaner;
+};
+
+}      // genie namespace
+#endif // _PYTHIA6_SESSION_H_
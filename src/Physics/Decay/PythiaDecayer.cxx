@@ -33,6 +33,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Physics/Decay/PythiaDecayer.h"
+#include "Physics/Decay/Pythia6Session.h"
 
 using std::vector;
 
@@ -105,9 +106,14 @@ bool PythiaDecayer::Decay(int decay_particle_id, GHepRecord * event) const
   TLorentzVector decay_particle_x4 = *(decay_particle->X4());
   int decay_particle_pdg_code = decay_particle->Pdg();
 
+  // Take over PYTHIA6 with the default decay flags (switches them only if
+  // a hadronizer was run since the last decay)
+  Pythia6Session * session = Pythia6Session::Instance();
+  session->Use(kP6cDecayer);
+
   // Convert to PYTHIA6 particle code and check whether decay is inhibited
-  int kc   = fPythia->Pycomp(decay_particle_pdg_code);
-  int mdcy = fPythia->GetMDCY(kc, 1);
+  int kc   = session->Pycomp(decay_particle_pdg_code);
+  int mdcy = session->DecayFlag(decay_particle_pdg_code);
   if(mdcy == 0) {
     LOG("Pythia6Decay", pNOTICE)
        << (PDGLibrary::Instance())->Find(decay_particle_pdg_code)->GetName()
@@ -230,12 +236,13 @@ void PythiaDecayer::InhibitDecay(int pdg_code, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdg_code)) return;
 
-  int kc = fPythia->Pycomp(pdg_code);
+  Pythia6Session * session = Pythia6Session::Instance();
+  int kc = session->Pycomp(pdg_code);
 
   if(!dc) {
     LOG("Pythia6Decay", pINFO)
        << "Switching OFF ALL decay channels for particle = " << pdg_code;
-    fPythia->SetMDCY(kc, 1,0);
+    session->SetDecayFlag(pdg_code, 0);
     return;
   }
 
@@ -253,13 +260,14 @@ void PythiaDecayer::UnInhibitDecay(int pdg_code, TDecayChannel * dc) const
 {
   if(! this->IsHandled(pdg_code)) return;
 
-  int kc = fPythia->Pycomp(pdg_code);
+  Pythia6Session * session = Pythia6Session::Instance();
+  int kc = session->Pycomp(pdg_code);
 
   if(!dc) {
     LOG("Pythia6Decay", pINFO)
       << "Switching ON all PYTHIA decay channels for particle = " << pdg_code;
 
-    fPythia->SetMDCY(kc, 1,1);
+    session->SetDecayFlag(pdg_code, 1);
 
     int first_channel = fPythia->GetMDCY(kc,2);
     int last_channel  = fPythia->GetMDCY(kc,2) + fPythia->GetMDCY(kc,3) - 1;
@@ -26,6 +26,10 @@
  @ Feb 08, 2013 - CA
    Use the formation zone code from PhysUtils (also used by reweighting) 
    rather than having own implementation here
+ @ Oct 14, 2026 - CA
+   The fragmentation products are written by the hadronizer into a TClonesArray
+   owned by this class and reused for all events, rather than into a new
+   container per event.
 */
 //____________________________________________________________________________
 
@@ -35,6 +39,7 @@
 #else
 #include <TMCParticle6.h>
 #endif
+#include <TClonesArray.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
@@ -64,18 +69,18 @@ using namespace genie::utils;
 DISHadronicSystemGenerator::DISHadronicSystemGenerator() :
 HadronicSystemGenerator("genie::DISHadronicSystemGenerator")
 {
-
+  fFragmProducts = new TClonesArray("TMCParticle");
 }
 //___________________________________________________________________________
 DISHadronicSystemGenerator::DISHadronicSystemGenerator(string config) :
 HadronicSystemGenerator("genie::DISHadronicSystemGenerator", config)
 {
-
+  fFragmProducts = new TClonesArray("TMCParticle");
 }
 //___________________________________________________________________________
 DISHadronicSystemGenerator::~DISHadronicSystemGenerator()
 {
-
+  delete fFragmProducts;
 }
 //___________________________________________________________________________
 void DISHadronicSystemGenerator::ProcessEventRecord(GHepRecord * evrec) const
@@ -111,8 +116,9 @@ void DISHadronicSystemGenerator::AddFragmentationProducts(
   //-- Run the hadronization model and get the fragmentation products:
   //   A collection of ROOT TMCParticles (equiv. to a LUJETS record)
 
-  TClonesArray * plist = fHadronizationModel->Hadronize(interaction);
-  if(!plist) {
+  TClonesArray * plist = fFragmProducts;
+  bool ok = fHadronizationModel->Hadronize(interaction, *plist);
+  if(!ok) {
      LOG("DISHadronicVtx", pWARN) 
                   << "Got an empty particle list. Hadronizer failed!";
      LOG("DISHadronicVtx", pWARN) 
@@ -191,8 +197,7 @@ void DISHadronicSystemGenerator::AddFragmentationProducts(
   //   take into account that the current event might be already weighted
   evrec->SetWeight (wght * evrec->Weight());
 
-  plist->Delete();
-  delete plist;
+  plist->Clear();
 }
 //___________________________________________________________________________
 void DISHadronicSystemGenerator::SimulateFormationZone(
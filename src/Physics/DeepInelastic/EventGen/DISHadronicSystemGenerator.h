@@ -22,6 +22,8 @@
 
 #include "Physics/Common/HadronicSystemGenerator.h"
 
+class TClonesArray;
+
 namespace genie {
 
 class HadronizationModelI;
@@ -50,6 +52,8 @@ private:
 
   const HadronizationModelI * fHadronizationModel;
 
+  mutable TClonesArray * fFragmProducts; ///< fragmentation products, reused for all events
+
   bool   fFilterPreFragmEntries;
   double fR0;          ///< param controling nuclear size
   double fNR;          ///< how far beyond the nuclear boundary does the particle tracker goes?
@@ -15,12 +15,21 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - CA
+   Optionally (UseEnvelope) sample (x,y) against a 2-D envelope of the xsec
+   per E bin, instead of the single max xsec.
+ @ Oct 14, 2026 - CA
+   Draw the kinematics random numbers through RandomGen::Next().
+ @ Oct 14, 2026 - CA
+   With Envelope-Mode = weighted or approximate, draw (x,y) from the xsec
+   surrogate interpolated between the envelope nodes.
 */
 //____________________________________________________________________________
 
 #include <cfloat>
 
 #include <TMath.h>
+#include <TLorentzVector.h>
 
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Conventions/GBuild.h"
@@ -94,7 +103,8 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      genie::exceptions::EVGThreadException exception;
      exception.SetReason("No available phase space");
      exception.SwitchOnFastForward();
-     throw exception;
+     this->StopThread(exception);
+     return;
   }
 
   Range1D_t xl = kps.Limits(kKVx);
@@ -111,7 +121,19 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   When available, an envelope of the xsec in (E,x,y) is used instead of
+  //   the max xsec, selecting (x,y) in cells of the envelope according to
+  //   their majorant
+  //   With Envelope-Mode = weighted or approximate, (x,y) are drawn from the
+  //   surrogate of the xsec tabulated along with the envelope instead
+  KineEnvelope_t * envelope = (fGenerateUniformly) ? 0 :
+                     this->Envelope(interaction, this->Energy(interaction), 2);
+  bool surrogate = (envelope && fEnvelopeMode != kEnvRejection);
+  double xsec_max = -1;
+  if(!fGenerateUniformly && !envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
 
   //-- Try to select a valid (x,y) pair using the rejection method
 
@@ -123,6 +145,7 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
        LOG("DISKinematics", pWARN)
          << " Couldn't select kinematics after " << iter << " iterations";
@@ -130,15 +153,39 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        genie::exceptions::EVGThreadException exception;
        exception.SetReason("Couldn't select kinematics");
        exception.SwitchOnFastForward();
-       throw exception;
+       this->StopThread(exception);
+       return;
      }
 
      //-- random x,y
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
-     interaction->KinePtr()->Setx(gx);
-     interaction->KinePtr()->Sety(gy);
-     kinematics::UpdateWQ2FromXY(interaction);
+     int    icell = -1;
+     double J     = 1;
+     double s     = 0; // surrogate d^2xsec/dudv
+     if(surrogate) {
+        double u = 0, v = 0;
+        s = this->SampleSurrogate(interaction, this->Energy(interaction), 2,
+                rnd->Next(kRndStrKine), rnd->Next(kRndStrKine),
+                rnd->Next(kRndStrKine), u, v);
+        J = this->SetEnvelopeKine(interaction, u, v);
+        if(J <= 0. || s <= 0.) continue;
+        gx = interaction->Kine().x();
+        gy = interaction->Kine().y();
+     } else if(envelope) {
+        double u = 0, v = 0;
+        this->SampleEnvelope2D(*envelope, rnd->Next(kRndStrKine),
+                rnd->Next(kRndStrKine), rnd->Next(kRndStrKine), u, v, icell);
+        xsec_max = envelope->value[icell];
+        J  = this->SetEnvelopeKine(interaction, u, v);
+        if(J <= 0.) continue;
+        gx = interaction->Kine().x();
+        gy = interaction->Kine().y();
+     } else {
+        gx = xl.min + dx * rnd->Next(kRndStrKine);
+        gy = yl.min + dy * rnd->Next(kRndStrKine);
+        interaction->KinePtr()->Setx(gx);
+        interaction->KinePtr()->Sety(gy);
+        kinematics::UpdateWQ2FromXY(interaction);
+     }
 
      LOG("DISKinematics", pNOTICE) 
         << "Trying: x = " << gx << ", y = " << gy 
@@ -146,13 +193,20 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         << " (Q2 = " << interaction->KinePtr()->Q2() << ")";
 
      //-- compute the cross section for current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSxyfE);
+     xsec = (surrogate && fEnvelopeMode == kEnvApproximate) ?
+              s / J : fXSecModel->XSec(interaction, kPSxyfE);
 
      //-- decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
-        double t = xsec_max * rnd->RndKine().Rndm();
-	double J = 1;
+     if(surrogate) {
+        accept = (xsec>0);
+     }
+     else if(!fGenerateUniformly) {
+        if(envelope && J*xsec > xsec_max) {
+          // the envelope is not a bound here: raise it
+          this->RaiseEnvelope(envelope, icell, J*xsec);
+        }
+        else this->AssertXSecLimits(interaction, J*xsec, xsec_max);
+        double t = xsec_max * rnd->Next(kRndStrKine);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DISKinematics", pDEBUG)
@@ -191,6 +245,9 @@ void DISKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
             LOG("DISKinematics", pNOTICE) << "Current event wght = " << wght;
             evrec->SetWeight(wght);
          }
+         if(surrogate && fEnvelopeMode == kEnvWeighted) {
+            this->WeightSurrogate(evrec, J*xsec, s);
+         }
 
          // compute W,Q2 for selected x,y
          bool is_em = interaction->ProcInfo().IsEM();
@@ -243,6 +300,12 @@ void DISKinematicsGenerator::LoadConfig(void)
   //   an event weight?
     GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Sample (x,y) against an envelope of the cross section in (E,x,y)?
+    GetParamDef( "UseEnvelope",           fUseEnvelope,    false ) ;
+    GetParamDef( "Envelope-SafetyFactor", fEnvelopeSafety, 1.2   ) ;
+    this->LoadEnvelopeMode();
+    fEnvelopes.clear();
+    fEnvelopeEdges.clear();
 }
 //____________________________________________________________________________
 double DISKinematicsGenerator::ComputeMaxXSec(
@@ -385,4 +448,40 @@ double DISKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double DISKinematicsGenerator::EnvelopeXSec2D(
+                    Interaction * interaction, double u, double v) const
+{
+// d^2xsec/dudv at the (x,y) normalized to their limits, for the (E,x,y)
+// envelope (see KineGeneratorWithCache::Envelope()). The envelope is keyed
+// by the hit nucleon rest frame energy, so the hit nucleon is put at rest.
+
+  Target * tgt = interaction->InitStatePtr()->TgtPtr();
+  if(tgt->HitNucIsSet()) {
+    tgt->SetHitNucP4(TLorentzVector(0, 0, 0, tgt->HitNucMass()));
+  }
+  if(!interaction->PhaseSpace().IsAboveThreshold()) return 0.;
+
+  double J = this->SetEnvelopeKine(interaction, u, v);
+  if(J <= 0.) return 0.;
 
+  return J * fXSecModel->XSec(interaction, kPSxyfE);
+}
+//___________________________________________________________________________
+double DISKinematicsGenerator::SetEnvelopeKine(
+                    Interaction * interaction, double u, double v) const
+{
+// Sets the (x,y) at the envelope variables (u,v), normalized to the x and y
+// limits, and returns the Jacobian d(x,y)/d(u,v) (0 if no phase space)
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t xl = kps.Limits(kKVx);
+  Range1D_t yl = kps.Limits(kKVy);
+  if(xl.max <= xl.min || yl.max <= yl.min) return 0.;
+
+  interaction->KinePtr()->Setx(xl.min + (xl.max - xl.min) * u);
+  interaction->KinePtr()->Sety(yl.min + (yl.max - yl.min) * v);
+  kinematics::UpdateWQ2FromXY(interaction);
+
+  return (xl.max - xl.min) * (yl.max - yl.min);
+}
+//___________________________________________________________________________
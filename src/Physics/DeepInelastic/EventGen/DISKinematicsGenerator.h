@@ -48,6 +48,9 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  double EnvelopeXSec2D  (Interaction * interaction, double u, double v) const;
+  int    EnvelopeDim     (void) const { return 2; }
+  double SetEnvelopeKine (Interaction * interaction, double u, double v) const;
 };
 
 }      // genie namespace
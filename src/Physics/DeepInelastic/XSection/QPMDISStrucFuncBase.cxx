@@ -22,6 +22,11 @@
 
          Changes required to implement the GENIE Boosted Dark Matter module
          were installed by Josh Berger (Univ. of Wisconsin)
+
+ Important revisions :
+ @ Oct 14, 2026 - CA
+   Memoize the computed structure functions, and add an optional mode
+   interpolating them on a (log x, log Q2) grid.
 */
 //____________________________________________________________________________
 
@@ -44,19 +49,28 @@ using namespace genie::constants;
 
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase() :
-DISStructureFuncModelI()
+DISStructureFuncModelI(),
+fSFCacheSize(0),
+fSFGridStep(0.),
+fSFNode(0)
 {
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name) :
-DISStructureFuncModelI(name)
+DISStructureFuncModelI(name),
+fSFCacheSize(0),
+fSFGridStep(0.),
+fSFNode(0)
 {
   this->InitPDF();
 }
 //____________________________________________________________________________
 QPMDISStrucFuncBase::QPMDISStrucFuncBase(string name, string config):
-DISStructureFuncModelI(name, config)
+DISStructureFuncModelI(name, config),
+fSFCacheSize(0),
+fSFGridStep(0.),
+fSFNode(0)
 {
   this->InitPDF();
 }
@@ -65,6 +79,7 @@ QPMDISStrucFuncBase::~QPMDISStrucFuncBase()
 {
   delete fPDF;
   delete fPDFc;
+  delete fSFNode;
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Configure(const Registry & config)
@@ -126,6 +141,11 @@ void QPMDISStrucFuncBase::LoadConfig(void)
   GetParam( "WeinbergAngle", thw ) ;
   fSin2thw = TMath::Power(TMath::Sin(thw), 2);
 
+  //-- SF memoization & grid interpolation
+  GetParamDef( "SF-CacheSize", fSFCacheSize, 1000 ) ;
+  GetParamDef( "SF-GridStep",  fSFGridStep,  0.   ) ;
+  fSFCache.clear();
+
   LOG("DISSF", pDEBUG) << "Done loading configuration";
 }
 //____________________________________________________________________________
@@ -137,6 +157,154 @@ void QPMDISStrucFuncBase::InitPDF(void)
 }
 //____________________________________________________________________________
 void QPMDISStrucFuncBase::Calculate(const Interaction * interaction) const
+{
+// Compute the structure functions, or take them from the memoized values.
+// In grid mode, they are interpolated bilinearly in (log x, log Q2) between
+// the values (memoized as well) at the 4 surrounding grid nodes.
+
+  if(fSFCacheSize <= 0) {
+    this->CalculateSF(interaction);
+    return;
+  }
+
+  double x  = interaction->Kine().x();
+  double Q2 = this->Q2(interaction);
+
+  SFValues_t sf;
+  SFKey_t    key;
+
+  if(fSFGridStep <= 0.) {
+    if(!this->SFCacheKey(interaction, x, Q2, key)) {
+      this->CalculateSF(interaction);
+      return;
+    }
+    std::map<SFKey_t, SFValues_t>::const_iterator it = fSFCache.find(key);
+    if(it != fSFCache.end()) {
+      sf = it->second;
+    } else {
+      this->CalculateSF(interaction);
+      sf.F[0] = fF1; sf.F[1] = fF2; sf.F[2] = fF3;
+      sf.F[3] = fF4; sf.F[4] = fF5; sf.F[5] = fF6;
+      this->StoreSF(key, sf);
+    }
+  }
+  else {
+    double lx = (x  > 0.) ? TMath::Log(x)  / fSFGridStep : 0.;
+    double lq = (Q2 > 0.) ? TMath::Log(Q2) / fSFGridStep : 0.;
+    int    ix = TMath::FloorNint(lx);
+    int    iq = TMath::FloorNint(lq);
+
+    // exact SFs outside the (0 < x < 1, Q2 > 0) grid
+    if(x <= 0. || Q2 <= 0. || ix+1 > 0 ||
+       !this->SFCacheKey(interaction, ix, iq, key)) {
+      this->CalculateSF(interaction);
+      return;
+    }
+
+    double t = lx - ix;
+    double u = lq - iq;
+    double w[4] = { (1.-t)*(1.-u), t*(1.-u), (1.-t)*u, t*u };
+
+    for(int k = 0; k < 6; k++) sf.F[k] = 0.;
+    for(int inode = 0; inode < 4; inode++) {
+      int jx = ix + inode % 2;
+      int jq = iq + inode / 2;
+      key.dkey[0] = jx;
+      key.dkey[1] = jq;
+      SFValues_t sfn;
+      this->SFAtNode(interaction, key,
+         TMath::Exp(jx*fSFGridStep), TMath::Exp(jq*fSFGridStep), sfn);
+      for(int k = 0; k < 6; k++) sf.F[k] += w[inode] * sfn.F[k];
+    }
+  }
+
+  fF1 = sf.F[0];
+  fF2 = sf.F[1];
+  fF3 = sf.F[2];
+  fF4 = sf.F[3];
+  fF5 = sf.F[4];
+  fF6 = sf.F[5];
+}
+//____________________________________________________________________________
+bool QPMDISStrucFuncBase::SFCacheKey(
+  const Interaction * interaction, double x, double Q2, SFKey_t & key) const
+{
+// Build the memoization key from all inputs of the SF calculation
+// (subclasses can only modify it through x, Q2 and the hit nucleon mass)
+
+  const ProcessInfo &  proc_info  = interaction->ProcInfo();
+  const InitialState & init_state = interaction->InitState();
+  const Target & tgt = init_state.Tgt();
+
+  bool qset = tgt.HitQrkIsSet();
+  int  flags = 
+     ( interaction->TestBit(kIAssumeFreeNucleon)   ? 1 : 0 ) +
+     ( interaction->TestBit(kINoNuclearCorrection) ? 2 : 0 );
+
+  key.ikey[0] = init_state.ProbePdg();
+  key.ikey[1] = tgt.HitNucPdg();
+  key.ikey[2] = (int) proc_info.InteractionTypeId();
+  key.ikey[3] = qset ? tgt.HitQrkPdg() : 0;
+  key.ikey[4] = (qset && tgt.HitSeaQrk()) ? 1 : 0;
+  key.ikey[5] = tgt.A();
+  key.ikey[6] = tgt.Z();
+  key.ikey[7] = flags;
+  key.ikey[8] = (fSFGridStep > 0.) ? 1 : 0;
+  key.dkey[0] = x;
+  key.dkey[1] = Q2;
+  key.dkey[2] = tgt.HitNucP4Ptr()->M();
+
+  return true;
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::SFAtNode(
+  const Interaction * interaction, const SFKey_t & key,
+  double x, double Q2, SFValues_t & sf) const
+{
+// SFs at a grid node: computed for a copy of the input interaction with the
+// node (x, Q2) kinematics, and memoized
+
+  std::map<SFKey_t, SFValues_t>::const_iterator it = fSFCache.find(key);
+  if(it != fSFCache.end()) {
+    sf = it->second;
+    return;
+  }
+
+  if(!fSFNode) fSFNode = new Interaction(*interaction);
+  else         fSFNode->Copy(*interaction);
+
+  fSFNode->KinePtr()->Setx (x);
+  fSFNode->KinePtr()->SetQ2(Q2);
+
+  this->CalculateSF(fSFNode);
+
+  sf.F[0] = fF1; sf.F[1] = fF2; sf.F[2] = fF3;
+  sf.F[3] = fF4; sf.F[4] = fF5; sf.F[5] = fF6;
+  this->StoreSF(key, sf);
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::StoreSF(
+  const SFKey_t & key, const SFValues_t & sf) const
+{
+  if((int)fSFCache.size() >= fSFCacheSize) {
+    LOG("DISSF", pDEBUG) << "SF cache is full: clearing it";
+    fSFCache.clear();
+  }
+  fSFCache[key] = sf;
+}
+//____________________________________________________________________________
+bool QPMDISStrucFuncBase::SFKey_t::operator < (const SFKey_t & k) const
+{
+  for(int i = 0; i < 9; i++) {
+    if(ikey[i] != k.ikey[i]) return (ikey[i] < k.ikey[i]);
+  }
+  for(int i = 0; i < 3; i++) {
+    if(dkey[i] != k.dkey[i]) return (dkey[i] < k.dkey[i]);
+  }
+  return false;
+}
+//____________________________________________________________________________
+void QPMDISStrucFuncBase::CalculateSF(const Interaction * interaction) const
 {
   // Reset mutable members
   fF1 = 0;
@@ -7,6 +7,12 @@
           Provides common implementation for concrete objects implementing the
           DISStructureFuncModelI interface.
 
+          Computed structure functions can be memoized (configurable number
+          of entries), keyed on all of the interaction inputs they depend
+          on. Optionally, they can instead be computed at the nodes of a
+          grid uniform in (log x, log Q2) and interpolated bilinearly, the
+          grid nodes being filled as needed.
+
 \ref      For a discussion of DIS SF see for example E.A.Paschos and J.Y.Yu, 
           Phys.Rev.D 65.033002 and R.Devenish and A.Cooper-Sarkar, OUP 2004.
 
@@ -28,6 +34,8 @@
 #ifndef _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 #define _QPM_DIS_STRUCTURE_FUNCTIONS_BASE_H_
 
+#include <map>
+
 #include "Physics/DeepInelastic/XSection/DISStructureFuncModelI.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Physics/PartonDistributions/PDF.h"
@@ -70,6 +78,24 @@ protected:
   virtual double R          (const Interaction * i) const;
   virtual void   KFactors   (const Interaction * i, double & kuv, 
                                      double & kdv, double & kus, double & kds) const;
+
+  // actual SF calculation (Calculate() adds the memoization on top)
+  void CalculateSF (const Interaction * interaction) const;
+
+  //! Cached structure function inputs & values
+  struct SFKey_t {
+    int    ikey[9]; ///< probe, hit nucleon, interaction type, hit quark, sea, A, Z, flags, grid mode
+    double dkey[3]; ///< x, Q2 (or grid node indices), hit nucleon mass
+    bool operator < (const SFKey_t & k) const;
+  };
+  struct SFValues_t {
+    double F[6];
+  };
+  bool SFCacheKey  (const Interaction * i, double x, double Q2, SFKey_t & key) const;
+  void SFAtNode    (const Interaction * i, const SFKey_t & key,
+                    double x, double Q2, SFValues_t & sf) const;
+  void StoreSF     (const SFKey_t & key, const SFValues_t & sf) const;
+
   // configuration
   //
   double fQ2min;             ///< min Q^2 allowed for PDFs: PDF(Q2<Q2min):=PDF(Q2min)
@@ -88,6 +114,11 @@ protected:
   double fSin2thw;           ///<
   bool   fUse2016Corrections;///< Use 2016 SF relation corrections
   double fLowQ2CutoffF1F2;   ///< Set min for relation between 2xF1 and F2
+  int    fSFCacheSize;       ///< max number of memoized SF evaluations (<=0: no memoization)
+  double fSFGridStep;        ///< (log x, log Q2) step of the interpolation grid (<=0: exact SFs)
+
+  mutable std::map<SFKey_t, SFValues_t> fSFCache; ///< memoized SFs
+  mutable Interaction *                 fSFNode;  ///< interaction at a grid node
 
   mutable double fF1;
   mutable double fF2;
@@ -15,6 +15,10 @@
  @ Feb 06, 2013 - CA
    When the value of the differential cross-section for the selected kinematics
    is set to the event, set the corresponding KinePhaseSpace_t value too.
+ @ Oct 14, 2026 - CA
+   Sample (x,y,t) from a proposal following the exp(-b|t|), (1-y) and axial
+   propagator dependence of the xsec rather than uniformly. The max xsec, the
+   rejection test and the uniform-mode weight are taken relative to it.
 
 */
 //____________________________________________________________________________
@@ -114,7 +118,8 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      genie::exceptions::EVGThreadException exception;
      exception.SetReason("No available phase space");
      exception.SwitchOnFastForward();
-     throw exception;
+     this->StopThread(exception);
+     return;
   }
 */
 
@@ -126,19 +131,22 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
+  //   The (x,y,t) are drawn from a proposal pdf following the main
+  //   dependencies of the xsec (see ProposalPdf()), so the max xsec is the
+  //   max of xsec/pdf
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  if(!fGenerateUniformly && xsec_max <= 0) return; // thread stopped by MaxXSec()
 
   //-- Try to select a valid (x,y,t) triplet using the rejection method
 
-  double dx = xl.max - xl.min;
-  double dy = yl.max - yl.min;
-  double dt = tl.max - tl.min;
-  double gx=-1, gy=-1, gt=-1, gW=-1, gQ2=-1, xsec=-1;
+  double a0 = this->ProposalScale(interaction);
+  double gx=-1, gy=-1, gt=-1, gW=-1, gQ2=-1, xsec=-1, pdf=-1;
 
   unsigned int iter = 0;
   bool accept = false;
   while(true) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
        LOG("DFRKinematics", pWARN)
          << " Couldn't select kinematics after " << iter << " iterations";
@@ -146,13 +154,15 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
        genie::exceptions::EVGThreadException exception;
        exception.SetReason("Couldn't select kinematics");
        exception.SwitchOnFastForward();
-       throw exception;
+       this->StopThread(exception);
+       return;
      }
 
-     //-- random x,y,t
-     gx = xl.min + dx * rnd->RndKine().Rndm();
-     gy = yl.min + dy * rnd->RndKine().Rndm();
-     gt = tl.min + dt * rnd->RndKine().Rndm();
+     //-- random x,y,t from the proposal pdf
+     this->SelectProposal(xl, yl, tl, a0, rnd->RndKine().Rndm(),
+        rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), gx, gy, gt);
+     pdf = this->ProposalPdf(xl, yl, tl, a0, gx, gy, gt);
+     if(pdf <= 0.) continue;
 
      interaction->KinePtr()->Setx(gx);
      interaction->KinePtr()->Sety(gy);
@@ -166,9 +176,9 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        this->AssertXSecLimits(interaction, xsec/pdf, xsec_max);
         double n = xsec_max * rnd->RndKine().Rndm();
-        double J = 1;
+        double J = 1./pdf;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("DFRKinematics", pDEBUG)
@@ -186,12 +196,12 @@ void DFRKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
          interaction->ResetBit(kISkipProcessChk);
          interaction->ResetBit(kISkipKinematicChk);
 
-         // for uniform kinematics, compute an event weight as
-         // wght = (phase space volume)*(differential xsec)/(event total xsec)
+         // for weighted kinematics, compute an event weight as
+         // wght = (differential xsec)/(proposal pdf)/(event total xsec)
+         // (the pdf being 1/(phase space volume) for uniform sampling)
          if(fGenerateUniformly) {
-            double vol     = kinematics::PhaseSpaceVolume(interaction,kPSxytfE);
             double totxsec = evrec->XSec();
-            double wght    = (vol/totxsec)*xsec;
+            double wght    = xsec/(pdf*totxsec);
             LOG("DFRKinematics", pNOTICE)  << "Kinematics wght = "<< wght;
 
             // apply computed weight to the current event weight
@@ -256,6 +266,9 @@ void DFRKinematicsGenerator::LoadConfig(void)
 
   GetParam( "DFR-Beta", fBeta ) ;
 
+  //-- Axial mass of the propagator followed by the x proposal pdf
+  GetParamDef( "Proposal-Ma", fProposalMa, 1.1 ) ;
+
 }
 //____________________________________________________________________________
 double DFRKinematicsGenerator::ComputeMaxXSec(
@@ -265,6 +278,10 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
 // space. This method overloads KineGeneratorWithCache::ComputeMaxXSec
 // method and the value is cached at a circular cache branch for retrieval
 // during subsequent event generation.
+// The kinematics are drawn from the proposal pdf, so it is the max of
+// xsec/pdf that is needed. The pdf follows the t and x dependence of the
+// xsec, so xsec/pdf mostly varies with y (through the pion-nucleon xsec):
+// the scan is fine in y and coarse in x and t.
 // The computed max differential cross section does not need to be the exact
 // maximum. The number used in the rejection method will be scaled up by a
 // safety factor. But this needs to be fast - do not use a very fine grid.
@@ -280,9 +297,16 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
   Range1D_t yl  = kps.YLim();
   Range1D_t Wl  = kps.WLim();
 
-  int    Ny      = 20;
-  int    Nx      = 20;
-  int    Nt      = 10;
+  // proposal t range (see ProcessEventRecord())
+  Range1D_t tpl;
+  tpl.min = 0;
+  tpl.max = KPhaseSpace::GetTMaxDFR();
+
+  double a0 = this->ProposalScale(interaction);
+
+  int    Ny      = 40;
+  int    Nx      = 6;
+  int    Nt      = 6;
   double xmin    = xl.min;
   double xmax    = xl.max;
   double ymin    = yl.min;
@@ -290,14 +314,11 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
   double dx      = (xmax-xmin)/(Nx-1);
   double dy      = (ymax-ymin)/(Ny-1);
 
-
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("DFRKinematics", pDEBUG) 
     << "Searching max. in x [" << xmin << ", " << xmax 
-    << "], y [" << ymin << ", " << ymax << "], z [" << zmin << ", " << zmax << "]";
+    << "], y [" << ymin << ", " << ymax << "]";
 #endif
-  double xseclast_y = -1;
-  bool increasing_y;
 
   for(int i=0; i<Ny; i++) {
      double gy = ymin + i*dy;
@@ -329,29 +350,23 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
           double gt = tmin + k*dt;
           interaction->KinePtr()->Sett(gt);
 
-          double xsec = fXSecModel->XSec(interaction, kPSxytfE);
+          double pdf = this->ProposalPdf(xl, yl, tpl, a0, gx, gy, gt);
+          if(pdf <= 0.) continue;
+
+          double xsec = fXSecModel->XSec(interaction, kPSxytfE) / pdf;
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 	  LOG("DFRKinematics", pINFO) 
-	    << "xsec(y=" << gy << ", x=" << gx << ", t=" << gt << ") = " << xsec;
+	    << "xsec/pdf(y=" << gy << ", x=" << gx << ", t=" << gt << ") = " << xsec;
 #endif
           // update maximum xsec
           max_xsec = TMath::Max(xsec, max_xsec);
         } // t
       } // x
-    increasing_y = max_xsec-xseclast_y>=0;
-    xseclast_y   = max_xsec;
-    if(!increasing_y) {
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-      LOG("DFRKinematics", pDEBUG) 
-        << "d2xsec/dxdy stopped increasing. Exiting y loop";
-#endif
-      break;
-    }
   }// y
 
   // Apply safety factor, since value retrieved from the cache might
   // correspond to a slightly different energy
-  max_xsec *= 3;
+  max_xsec *= fSafetyFactor;
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   SLOG("DFRKinematics", pDEBUG) << interaction->AsString();
@@ -362,4 +377,86 @@ double DFRKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double DFRKinematicsGenerator::ProposalScale(
+                                       const Interaction * interaction) const
+{
+// The x proposal pdf follows the axial propagator (1 + a0*y*x)^-2, with
+// Q2 = 2*x*y*M*E: a0 = 2*M*E/Ma^2
+
+  const InitialState & init_state = interaction->InitState();
+  double E = init_state.ProbeE(kRfHitNucRest);
+  double M = init_state.Tgt().HitNucMass();
+
+  return 2.*M*E / (fProposalMa*fProposalMa);
+}
+//___________________________________________________________________________
+void DFRKinematicsGenerator::SelectProposal(
+     const Range1D_t & xl, const Range1D_t & yl, const Range1D_t & tl,
+     double a0, double r1, double r2, double r3,
+     double & x, double & y, double & t) const
+{
+// Draws (x,y,t) from the proposal pdf (see ProposalPdf()) by inverting the
+// y, x|y and t cumulative distributions, for the uniform random numbers
+// r1, r2, r3
+
+  // y ~ (1-y)
+  double dy = yl.max - yl.min;
+  double c0 = 1. - yl.min;
+  double c1 = 1. - yl.max;
+  double u  = (TMath::Abs(c1 - c0) > 1E-9 * (c0 + c1)) ?
+      (TMath::Sqrt(c0*c0 + (c1*c1 - c0*c0) * r1) - c0) / (c1 - c0) : r1;
+  y = yl.min + dy * u;
+
+  // x ~ (1 + a*x)^-2
+  double a = a0 * y;
+  double dx = xl.max - xl.min;
+  if(a * dx > 1E-6) {
+    double f0 = 1. / (1. + a * xl.min);
+    double f1 = 1. / (1. + a * xl.max);
+    x = (1. / (f0 - r2 * (f0 - f1)) - 1.) / a;
+  } else {
+    x = xl.min + dx * r2;
+  }
+
+  // t ~ exp(-b*t)
+  double dt = tl.max - tl.min;
+  if(fBeta * dt > 1E-6) {
+    t = tl.min - TMath::Log(1. - r3 * (1. - TMath::Exp(-fBeta * dt))) / fBeta;
+  } else {
+    t = tl.min + dt * r3;
+  }
+}
+//___________________________________________________________________________
+double DFRKinematicsGenerator::ProposalPdf(
+     const Range1D_t & xl, const Range1D_t & yl, const Range1D_t & tl,
+     double a0, double x, double y, double t) const
+{
+// Proposal pdf of (x,y,t), following the dependencies of the Rein DFR xsec:
+// pdf(x,y,t) = pdf(y) * pdf(x|y) * pdf(t), with pdf(y) ~ (1-y),
+// pdf(x|y) ~ (1 + a0*y*x)^-2 (the axial propagator) and pdf(t) ~ exp(-b*t)
+// in the input ranges. The remaining pion-nucleon xsec dependence is left
+// to the rejection test.
+
+  if(x < xl.min || x > xl.max || y < yl.min || y > yl.max ||
+     t < tl.min || t > tl.max) return 0.;
+
+  double dy = yl.max - yl.min;
+  double dx = xl.max - xl.min;
+  double dt = tl.max - tl.min;
+  if(dx <= 0. || dy <= 0. || dt <= 0.) return 0.;
+
+  double pdf_y = (1. - y) / (dy * (1. - 0.5 * (yl.min + yl.max)));
+
+  double a = a0 * y;
+  double pdf_x = (a * dx > 1E-6) ?
+     (1. + a * xl.min) * (1. + a * xl.max) / (dx * TMath::Power(1. + a * x, 2.)) :
+     1. / dx;
+
+  double pdf_t = (fBeta * dt > 1E-6) ?
+     fBeta * TMath::Exp(-fBeta * (t - tl.min)) / (1. - TMath::Exp(-fBeta * dt)) :
+     1. / dt;
+
+  return pdf_y * pdf_x * pdf_t;
+}
+//___________________________________________________________________________
 
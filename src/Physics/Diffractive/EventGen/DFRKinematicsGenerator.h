@@ -44,7 +44,16 @@ private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
 
-  double fBeta;
+  // (x,y,t) proposal pdf
+  double ProposalScale   (const Interaction * interaction) const;
+  void   SelectProposal  (const Range1D_t & xl, const Range1D_t & yl, const Range1D_t & tl,
+                          double a0, double r1, double r2, double r3,
+                          double & x, double & y, double & t) const;
+  double ProposalPdf     (const Range1D_t & xl, const Range1D_t & yl, const Range1D_t & tl,
+                          double a0, double x, double y, double t) const;
+
+  double fBeta;        ///< t slope b of the xsec, exp(-b|t|)
+  double fProposalMa;  ///< axial mass of the propagator of the x proposal pdf
 };
 
 }      // genie namespace
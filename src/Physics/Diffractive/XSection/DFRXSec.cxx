@@ -89,21 +89,11 @@ double DFRXSec::Integrate (const XSecAlgorithmI* model, const Interaction* in) c
 
   ROOT::Math::IBaseFunctionMultiDim * func =
     new utils::gsl::d3XSec_dxdydt_E(model, interaction);
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
   double abstol = 1; //We mostly care about relative tolerance.
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-  if (ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
-    ROOT::Math::AdaptiveIntegratorMultiDim * cast =
-      dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
-    assert(cast);
-    cast->SetMinPts(fGSLMinEval);
-  }
-
   double kine_min[3] = { xl.min, yl.min, tl.min };
   double kine_max[3] = { xl.max, yl.max, tl.max };
-  xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+  xsec = this->IntegrateNDim(
+    *func, kine_min, kine_max, abstol, fGSLMinEval) * (1E-38 * units::cm2);
   delete func;
   return xsec;
 }
@@ -128,6 +118,7 @@ void DFRXSec::LoadConfig (void)
   // Get GSL integration type & relative tolerance
   GetParamDef( "gsl-integration-type", fGSLIntgType, string("adaptive") ) ;
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol, 1E-2 ) ;
+  BindParamDef( fGSLNWorkers, "gsl-integration-workers", 0 ) ;
 
   int max, min;
   GetParamDef( "gsl-max-eval", max, 500000 ) ;
@@ -15,6 +15,8 @@
  @ Apr 24, 2010 - CA
    Add code to decay the off-the-mass-shell W- using PYTHIA6. 
    First complete version of the GLRES event thread.
+ @ Oct 14, 2026 - CA
+   Run PYTHIA6 with the default decay flags of the Pythia6Session.
 */
 //____________________________________________________________________________
 
@@ -34,6 +36,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Physics/GlashowResonance/EventGen/GLRESGenerator.h"
+#include "Physics/Decay/Pythia6Session.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -100,6 +103,7 @@ void GLRESGenerator::ProcessEventRecord(GHepRecord * event) const
   strcpy(p6frame, "CMS"    );
   strcpy(p6nu,    "nu_ebar");
   strcpy(p6tgt,   "e-"     );
+  Pythia6Session::Instance()->Use(kP6cDecayer);
   fPythia->Pyinit(p6frame, p6nu, p6tgt, mass);
   fPythia->Pyevnt();
   fPythia->Pylist(1);
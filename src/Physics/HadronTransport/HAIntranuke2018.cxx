@@ -42,10 +42,21 @@
    Added 2014 version of INTRANUKE codes (new class) for independent development.
  @ Aug 30, 2016 - SD
    Fix memory leaks - Igor. 
+ @ Oct 14, 2026 - CA
+   HadronFateHA() gets all hA fate fractions with a single FracsHA() call,
+   outside the rejection loop.
+ @ Oct 14, 2026 - CA
+   Clone / cluster particles of the hA final states are stack objects, no
+   longer allocated on the heap (which also removes a leak when the
+   absorption phase space decay throws).
+ @ Oct 14, 2026 - CA
+   PiBounce() and PnBounce() look the angle up in cumulative probability
+   tables computed at the first call, rather than summing them at each call.
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <algorithm>
 #include <sstream>
 #include <exception>
 
@@ -204,6 +215,7 @@ void HAIntranuke2018::SimulateHadronicFinalStateKinematics(
     {     
       LOG("HAIntranuke2018", pNOTICE)  
 	<< exception;
+    this->CountRetry();
     if(fNumIterations <= 100) {
       LOG("HAIntranuke2018", pNOTICE)
 	<< "Failed attempt to generate kinematics for "
@@ -237,6 +249,14 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
   LOG("HAIntranuke2018", pINFO) 
    << "Selecting hA fate for " << p->Name() << " with KE = " << ke << " MeV";
 
+  // get all hA fate fractions at once (they do not change between attempts)
+  double frac[INukeHadroData2018::kNFatesHA];
+  for(int f = 0; f < INukeHadroData2018::kNFatesHA; f++) frac[f] = 0.;
+  if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0 ||
+      pdgc==kPdgProton || pdgc==kPdgNeutron || pdgc==kPdgKP || pdgc==kPdgKM) {
+     fHadroData2018->FracsHA(pdgc, ke, nuclA, frac);
+  }
+
   // try to generate a hadron fate
   unsigned int iter = 0;
   while(iter++ < kRjMaxIterations) {
@@ -245,11 +265,11 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
     //
    if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
 
-     double frac_cex      = fHadroData2018->FracADep(pdgc, kIHAFtCEx,     ke, nuclA);
-     //     double frac_elas     = fHadroData2018->FracADep(pdgc, kIHAFtElas,    ke, nuclA);
-     double frac_inel     = fHadroData2018->FracADep(pdgc, kIHAFtInelas,  ke, nuclA);
-     double frac_abs      = fHadroData2018->FracADep(pdgc, kIHAFtAbs,     ke, nuclA);
-     double frac_piprod   = fHadroData2018->FracADep(pdgc, kIHAFtPiProd,  ke, nuclA);
+     double frac_cex      = frac[kIHAFtCEx];
+     //     double frac_elas     = frac[kIHAFtElas];
+     double frac_inel     = frac[kIHAFtInelas];
+     double frac_abs      = frac[kIHAFtAbs];
+     double frac_piprod   = frac[kIHAFtPiProd];
      LOG("HAIntranuke2018", pDEBUG) 
           << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
        //          << "\n frac{" << INukeHadroFates::AsString(kIHAFtElas)    << "} = " << frac_elas
@@ -296,12 +316,12 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
 
     // handle nucleons
     else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
-      double frac_cex      = fHadroData2018->FracAIndep(pdgc, kIHAFtCEx,    ke);
-      //double frac_elas     = fHadroData2018->FracAIndep(pdgc, kIHAFtElas,   ke);
-      double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas, ke);
-      double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,    ke);
-      double frac_pipro    = fHadroData2018->FracAIndep(pdgc, kIHAFtPiProd, ke);
-      double frac_cmp      = fHadroData2018->FracAIndep(pdgc, kIHAFtCmp   , ke);
+      double frac_cex      = frac[kIHAFtCEx];
+      //double frac_elas     = frac[kIHAFtElas];
+      double frac_inel     = frac[kIHAFtInelas];
+      double frac_abs      = frac[kIHAFtAbs];
+      double frac_pipro    = frac[kIHAFtPiProd];
+      double frac_cmp      = frac[kIHAFtCmp];
 
       LOG("HAIntranuke2018", pINFO)
           << "\n frac{" << INukeHadroFates::AsString(kIHAFtCEx)     << "} = " << frac_cex
@@ -350,8 +370,8 @@ INukeFateHA_t HAIntranuke2018::HadronFateHA(const GHepParticle * p) const
     }
     // handle kaons
     else if (pdgc==kPdgKP || pdgc==kPdgKM) {
-       double frac_inel     = fHadroData2018->FracAIndep(pdgc, kIHAFtInelas,  ke);
-       double frac_abs      = fHadroData2018->FracAIndep(pdgc, kIHAFtAbs,     ke);
+       double frac_inel     = frac[kIHAFtInelas];
+       double frac_abs      = frac[kIHAFtAbs];
 
        LOG("HAIntranuke2018", pDEBUG) 
           << "\n frac{" << INukeHadroFates::AsString(kIHAFtInelas)  << "} = " << frac_inel
@@ -388,33 +408,43 @@ double HAIntranuke2018::PiBounce(void) const
     5000., 4200., 3000., 2600., 2100., 1800., 1200., 750., 500., 230., 120.,
     35., 9., 3., 11., 18., 29., 27., 20., 14., 10., 6., 2., 0.14, 0.19 };
 
-  double angles[nprob];
-  for(int i=0; i<nprob; i++) angles[i] = 2.5*i;
+  // cumulative probabilities of the 1 deg theta bins, computed once
+  const int nbins = 60;
+  static double cumprob[nbins];
+  static bool   cumprob_init = false;
+  if(!cumprob_init) {
+    double angles[nprob];
+    for(int i=0; i<nprob; i++) angles[i] = 2.5*i;
+
+    double xsum = 0.;
+    double theta = 0.;
+    double binl  = 0.;
+    double binh  = 0.;
+    int tj = 0;
+    for(int i=0; i<nbins; i++) {
+     theta = i+0.5;
+     for(int j=0; j < nprob-1; j++) {
+       binl = angles[j];
+       binh = angles[j+1];
+       tj=j;
+       if(binl<=theta && binh>=theta) break;
+       tj=0;
+     }//j
+     int itj = tj;
+     double tfract = (theta-binl)/2.5;
+     double delp   = rprob[itj+1] - rprob[itj];
+     xsum += (rprob[itj] + tfract*delp)/denom;
+     cumprob[i] = xsum;
+    }//i
+    cumprob_init = true;
+  }
 
   RandomGen * rnd = RandomGen::Instance();
   double r = rnd->RndFsi().Rndm();
 
-  double xsum = 0.;
-  double theta = 0.;
-  double binl  = 0.;
-  double binh  = 0.;
-  int tj = 0;
-  for(int i=0; i<60; i++) {
-   theta = i+0.5;
-   for(int j=0; j < nprob-1; j++) {
-     binl = angles[j];
-     binh = angles[j+1];
-     tj=j;
-     if(binl<=theta && binh>=theta) break;
-     tj=0;
-   }//j
-   int itj = tj;
-   double tfract = (theta-binl)/2.5;
-   double delp   = rprob[itj+1] - rprob[itj];
-   xsum += (rprob[itj] + tfract*delp)/denom;
-   if(xsum>r) break;
-   theta = 0.;
-  }//i
+  // first bin where the cumulative probability exceeds r (0 if none)
+  int ibin = std::upper_bound(cumprob, cumprob + nbins, r) - cumprob;
+  double theta = (ibin < nbins) ? ibin + 0.5 : 0.;
 
   theta *= dintor;
 
@@ -441,33 +471,43 @@ double HAIntranuke2018::PnBounce(void) const
     2400., 2350., 2200., 2000., 1728., 1261., 713., 312., 106., 35., 
     6., 5., 10., 12., 11., 9., 6., 1., 1., 1. };
 
-  double angles[nprob];
-  for(int i=0; i<nprob; i++) angles[i] = 1.0*i;
+  // cumulative probabilities of the 1 deg theta bins, computed once
+  const int nbins = nprob;
+  static double cumprob[nbins];
+  static bool   cumprob_init = false;
+  if(!cumprob_init) {
+    double angles[nprob];
+    for(int i=0; i<nprob; i++) angles[i] = 1.0*i;
+
+    double xsum = 0.;
+    double theta = 0.;
+    double binl  = 0.;
+    double binh  = 0.;
+    int tj = 0;
+    for(int i=0; i<nbins; i++) {
+     theta = i+0.5;
+     for(int j=0; j < nprob-1; j++) {
+       binl = angles[j];
+       binh = angles[j+1];
+       tj=j;
+       if(binl<=theta && binh>=theta) break;
+       tj=0;
+     }//j
+     int itj = tj;
+     double tfract = (theta-binl)/2.5;
+     double delp   = rprob[itj+1] - rprob[itj];
+     xsum += (rprob[itj] + tfract*delp)/denom;
+     cumprob[i] = xsum;
+    }//i
+    cumprob_init = true;
+  }
 
   RandomGen * rnd = RandomGen::Instance();
   double r = rnd->RndFsi().Rndm();
 
-  double xsum = 0.;
-  double theta = 0.;
-  double binl  = 0.;
-  double binh  = 0.;
-  int tj = 0;
-  for(int i=0; i< nprob; i++) {
-   theta = i+0.5;
-   for(int j=0; j < nprob-1; j++) {
-     binl = angles[j];
-     binh = angles[j+1];
-     tj=j;
-     if(binl<=theta && binh>=theta) break;
-     tj=0;
-   }//j
-   int itj = tj;
-   double tfract = (theta-binl)/2.5;
-   double delp   = rprob[itj+1] - rprob[itj];
-   xsum += (rprob[itj] + tfract*delp)/denom;
-   if(xsum>r) break;
-   theta = 0.;
-  }//i
+  // first bin where the cumulative probability exceeds r (0 if none)
+  int ibin = std::upper_bound(cumprob, cumprob + nbins, r) - cumprob;
+  double theta = (ibin < nbins) ? ibin + 0.5 : 0.;
 
   theta *= dintor;
 
@@ -656,15 +696,14 @@ void HAIntranuke2018::InelasticHA(
       t.SetMomentum(0,0,0,tM);
     }
 
-  GHepParticle * cl = new GHepParticle(*p); // clone particle, to run IntBounce at proper energy
-                                            // calculate energy and momentum using invariant mass
+  GHepParticle cl(*p); // clone particle, to run IntBounce at proper energy
+                       // calculate energy and momentum using invariant mass
   double pM  = p->Mass();
   double E_p = ((*p->P4() + *t.P4()).Mag2() - tM*tM - pM*pM)/(2.0*tM);
   double P_p = TMath::Sqrt(E_p*E_p - pM*pM);
-  cl->SetMomentum(TLorentzVector(P_p,0,0,E_p)); 
+  cl.SetMomentum(TLorentzVector(P_p,0,0,E_p)); 
                   // momentum doesn't have to be in right direction, only magnitude
-  double C3CM = fHadroData2018->IntBounce(cl,tcode,scode,h_fate);
-  delete cl;
+  double C3CM = fHadroData2018->IntBounce(&cl,tcode,scode,h_fate);
   if (C3CM<-1.)   // hope this doesn't occur too often - unphysical but we just pass it on
     {
       LOG("HAIntranuke2018", pWARN) << "unphysical angle chosen in InelasicHA - put particle outside nucleus";
@@ -982,27 +1021,25 @@ void HAIntranuke2018::Inelastic(
 
 	      // create t particles w/ appropriate momenta, code, and status
 	      // Set target's mom to be the mom of the hadron that was cloned
-	      GHepParticle* t1 = new GHepParticle(*p);
-	      GHepParticle* t2 = new GHepParticle(*p);
-	      t1->SetFirstMother(p->FirstMother());
-	      t1->SetLastMother(p->LastMother());
-	      t2->SetFirstMother(p->FirstMother());
-	      t2->SetLastMother(p->LastMother());
+	      GHepParticle t1(*p);
+	      GHepParticle t2(*p);
+	      t1.SetFirstMother(p->FirstMother());
+	      t1.SetLastMother(p->LastMother());
+	      t2.SetFirstMother(p->FirstMother());
+	      t2.SetLastMother(p->LastMother());
 
 	      // adjust p to reflect scattering
-	      t1->SetPdgCode(scode);
-	      t1->SetMomentum(t4P3L);
+	      t1.SetPdgCode(scode);
+	      t1.SetMomentum(t4P3L);
 
-	      t2->SetPdgCode(s2code);
-	      t2->SetMomentum(t4P4L);
+	      t2.SetPdgCode(s2code);
+	      t2.SetMomentum(t4P4L);
 
-	      t1->SetStatus(kIStStableFinalState);
-	      t2->SetStatus(kIStStableFinalState);
+	      t1.SetStatus(kIStStableFinalState);
+	      t2.SetStatus(kIStStableFinalState);
 
-	      ev->AddParticle(*t1);
-	      ev->AddParticle(*t2);
-	      delete t1;
-	      delete t2;
+	      ev->AddParticle(t1);
+	      ev->AddParticle(t2);
 
 	      return;
 	    }
@@ -1252,11 +1289,11 @@ void HAIntranuke2018::Inelastic(
 
 	  int mom = p->FirstMother();
 
-	  GHepParticle * p0 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
-	  GHepParticle * p1 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
-	  GHepParticle * p2 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
-	  GHepParticle * p3 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
-	  GHepParticle * p4 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
+	  GHepParticle p0(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
+	  GHepParticle p1(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
+	  GHepParticle p2(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
+	  GHepParticle p3(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
+	  GHepParticle p4(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
 
 	  // To conserve 4-momenta
 	  //	  fRemnP4 -= probP4 + protP4*np_p + neutP4*(4-np_p) - *p->P4();
@@ -1313,11 +1350,11 @@ void HAIntranuke2018::Inelastic(
 		}
 		}*/
 
-	  bool success1 = utils::intranuke2018::PhaseSpaceDecay(ev,p0,*listar[0],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success2 = utils::intranuke2018::PhaseSpaceDecay(ev,p1,*listar[1],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success3 = utils::intranuke2018::PhaseSpaceDecay(ev,p2,*listar[2],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success4 = utils::intranuke2018::PhaseSpaceDecay(ev,p3,*listar[3],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success5 = utils::intranuke2018::PhaseSpaceDecay(ev,p4,*listar[4],fRemnP4,fNucRmvE,kIMdHA);
+	  bool success1 = utils::intranuke2018::PhaseSpaceDecay(ev,&p0,*listar[0],fRemnP4,fNucRmvE,kIMdHA);
+	  bool success2 = utils::intranuke2018::PhaseSpaceDecay(ev,&p1,*listar[1],fRemnP4,fNucRmvE,kIMdHA);
+	  bool success3 = utils::intranuke2018::PhaseSpaceDecay(ev,&p2,*listar[2],fRemnP4,fNucRmvE,kIMdHA);
+	  bool success4 = utils::intranuke2018::PhaseSpaceDecay(ev,&p3,*listar[3],fRemnP4,fNucRmvE,kIMdHA);
+	  bool success5 = utils::intranuke2018::PhaseSpaceDecay(ev,&p4,*listar[4],fRemnP4,fNucRmvE,kIMdHA);
 	  if(success1 && success2 && success3 && success4 && success5)
 	    {
 	      LOG("HAIntranuke2018", pINFO)<<"Successful many-body absorption - n>=18";
@@ -1364,11 +1401,6 @@ void HAIntranuke2018::Inelastic(
 	    }
 
 	  //	  delete cl;
-	  delete p0;
-	  delete p1;
-	  delete p2;
-	  delete p3;
-	  delete p4;
 
 	}
       else // less than 18 particles pion
@@ -1399,7 +1431,7 @@ void HAIntranuke2018::Inelastic(
 	  GHepStatus_t ist = kIStNucleonClusterTarget;
 	  int mom = p->FirstMother();
 
-	  GHepParticle * p0 = new GHepParticle(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
+	  GHepParticle p0(kPdgCompNuclCluster,ist, mom,-1,-1,-1,clusP4,X4);
 
 	  //set up remnant nucleus
 	  fRemnP4 -= clusP4 - *p->P4();
@@ -1457,7 +1489,7 @@ void HAIntranuke2018::Inelastic(
 	  //	  GHepParticle * cl = new GHepParticle(*p);
 	  //	  cl->SetPdgCode(kPdgDecayNuclCluster);
      	  //bool success1 = utils::intranuke2018::PhaseSpaceDecay(ev,p0,*listar[0],fRemnP4,fNucRmvE,kIMdHA);
-	  bool success = utils::intranuke2018::PhaseSpaceDecay(ev,p0,list,fRemnP4,fNucRmvE,kIMdHA);
+	  bool success = utils::intranuke2018::PhaseSpaceDecay(ev,&p0,list,fRemnP4,fNucRmvE,kIMdHA);
 	  if (success)
 	    {
 	      LOG ("HAIntranuke2018",pINFO) << "Successful many-body absorption, n<=18";
@@ -1498,7 +1530,6 @@ void HAIntranuke2018::Inelastic(
 	    exception.SetReason("Phase space generation of absorption final state failed");
 	    throw exception;
 	  }
-	  delete p0;
 	}
 	} // end multi-nucleon FS
     }
@@ -45,6 +45,13 @@
    fix memory leak, fix fates, improve NNCorr binning
  & Mar, 2018  Nicholas Suarez, SD
    add compound nucleus option to populate KE<30 MeV
+ @ Oct 14, 2026 - CA
+   Target / clone particles of the hN final states are stack objects, no
+   longer allocated on the heap.
+ @ Oct 14, 2026 - CA
+   AbsorbHN() checks the scattering angle against the Pauli-allowed range
+   of its CM frame as soon as the frame is known. Rejected interactions are
+   counted (Intranuke2018::NRetries()).
 */
 //____________________________________________________________________________
 
@@ -197,6 +204,7 @@ void HNIntranuke2018::SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p
     }
   catch(exceptions::INukeException exception)
     {
+      this->CountRetry();
       this->SimulateHadronicFinalState(ev,p);
        LOG("HNIntranuke2018", pNOTICE) 
          << "retry call to SimulateHadronicFinalState ";
@@ -475,11 +483,11 @@ void HNIntranuke2018::AbsorbHN(
     }
  
   // assign proper masses
-  M1   = pLib->Find(pcode) ->Mass();
-  M2_1 = pLib->Find(t1code)->Mass();
-  M2_2 = pLib->Find(t2code)->Mass();
-  M3   = pLib->Find(scode) ->Mass();
-  M4   = pLib->Find(s2code)->Mass();
+  M1   = pLib->Mass(pcode);
+  M2_1 = pLib->Mass(t1code);
+  M2_2 = pLib->Mass(t2code);
+  M3   = pLib->Mass(scode);
+  M4   = pLib->Mass(s2code);
 
   // handle fermi momentum 
   if(fDoFermi)
@@ -553,6 +561,24 @@ void HNIntranuke2018::AbsorbHN(
   E4CM = Et - E3CM;
   P3CM = TMath::Sqrt(E3CM*E3CM - M3*M3);
 
+  // pauli blocking (do not apply PB for Oset), checked against the range of
+  // scattering angles allowed in this CM frame before the lab momenta are built
+  //if(!fUseOset && (P3L < fFermiMomentum || P4L < fFermiMomentum))
+  double ke   = p->KinE() / units::MeV;
+  if(!fUseOset || ke > 350.0)
+    {
+      double C3min, C3max;
+      bool allowed = utils::intranuke2018::PauliAllowedCosRange(
+         beta, E3CM, E4CM, P3CM, fFermiMomentum, fFermiMomentum, C3min, C3max);
+      if(!allowed || C3CM < C3min || C3CM > C3max)
+        {
+          LOG("HNIntranuke2018", pINFO) << "AbsorbHN failed: Pauli blocking";
+          exceptions::INukeException exception;
+          exception.SetReason("hN absorption failed");
+          throw exception;
+        }
+    }
+
   // boost back to lab
   P3zL = gm*beta*E3CM + gm*P3CM*C3CM;
   P3tL = P3CM*S3CM;
@@ -586,28 +612,6 @@ void HNIntranuke2018::AbsorbHN(
       E4L  = TMath::Sqrt(P4L*P4L + M4*M4);
     }
 
-  // pauli blocking (do not apply PB for Oset)
-  //if(!fUseOset && (P3L < fFermiMomentum || P4L < fFermiMomentum))
-  double ke   = p->KinE() / units::MeV;
-  if((!fUseOset || ke > 350.0 ) && (P3L < fFermiMomentum || P4L < fFermiMomentum))
-    {
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-      LOG("HNIntranuke2018",pINFO) << "AbsorbHN failed: Pauli blocking";
-#endif
-      /*
-      p->SetStatus(kIStHadronInTheNucleus);
-      //disable until needed
-      //      utils::intranuke2018::StepParticle(p,fFreeStep,fTrackingRadius);
-      ev->AddParticle(*p);   
-      return;
-      */
-      // new attempt at error handling:
-      LOG("HNIntranuke2018", pINFO) << "AbsorbHN failed: Pauli blocking";
-      exceptions::INukeException exception;
-      exception.SetReason("hN absorption failed");
-      throw exception;
-    }
-
   // handle remnant nucleus updates
   fRemnZ--;
   fRemnA -=2;
@@ -628,14 +632,14 @@ void HNIntranuke2018::AbsorbHN(
 
   // create t particle w/ appropriate momenta, code, and status
   // set target's mom to be the mom of the hadron that was cloned
-  GHepParticle * t = new GHepParticle(*p);
-  t->SetFirstMother(p->FirstMother());
-  t->SetLastMother(p->LastMother());
+  GHepParticle t(*p);
+  t.SetFirstMother(p->FirstMother());
+  t.SetLastMother(p->LastMother());
 
   TLorentzVector t4P4L(tP4L,E4L);
-  t->SetPdgCode(s2code);
-  t->SetMomentum(t4P4L);
-  t->SetStatus(kIStHadronInTheNucleus);
+  t.SetPdgCode(s2code);
+  t.SetMomentum(t4P4L);
+  t.SetStatus(kIStHadronInTheNucleus);
 
   // adjust p to reflect scattering
   TLorentzVector t4P3L(tP3L,E3L);
@@ -651,9 +655,7 @@ void HNIntranuke2018::AbsorbHN(
 #endif
 
   ev->AddParticle(*p);
-  ev->AddParticle(*t);
-
-  delete t; // delete particle clone
+  ev->AddParticle(t);
 }
 //___________________________________________________________________________
 void HNIntranuke2018::ElasHN(
@@ -716,9 +718,9 @@ void HNIntranuke2018::ElasHN(
     }
 
   // create scattered particle
-  GHepParticle * t = new GHepParticle(*p);
-  t->SetPdgCode(tcode);
-  double Mt = t->Mass();
+  GHepParticle t(*p);
+  t.SetPdgCode(tcode);
+  double Mt = t.Mass();
   //t->SetMomentum(TLorentzVector(0,0,0,Mt));
 
   // handle fermi momentum 
@@ -731,15 +733,15 @@ void HNIntranuke2018::ElasHN(
       fNuclmodel->GenerateNucleon(target);
       TVector3 tP3L = fFermiFac * fNuclmodel->Momentum3();
       double tE = TMath::Sqrt(tP3L.Mag2() + Mt*Mt);
-      t->SetMomentum(TLorentzVector(tP3L,tE));
+      t.SetMomentum(TLorentzVector(tP3L,tE));
     }
   else
     {
-      t->SetMomentum(TLorentzVector(0,0,0,Mt));
+      t.SetMomentum(TLorentzVector(0,0,0,Mt));
     }
 
   bool pass = utils::intranuke2018::TwoBodyCollision(ev,pcode,tcode,scode,s2code,C3CM,
-						  p,t,fRemnA,fRemnZ,fRemnP4,kIMdHN);
+						  p,&t,fRemnA,fRemnZ,fRemnP4,kIMdHN);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("HNIntranuke2018",pDEBUG)
@@ -751,18 +753,15 @@ void HNIntranuke2018::ElasHN(
   if (pass==true)
   {
     ev->AddParticle(*p);
-    ev->AddParticle(*t);
+    ev->AddParticle(t);
   } else
   {
-    delete t; //fixes memory leak
     LOG("HNIntranuke2018", pINFO) << "Elastic in hN failed calling TwoBodyCollision";
     exceptions::INukeException exception;
     exception.SetReason("hN scattering kinematics through TwoBodyCollision failed");
     throw exception;
   }
 
-  delete t;
-
 }
 //___________________________________________________________________________
 void HNIntranuke2018::InelasticHN(GHepRecord* ev, GHepParticle* p) const
@@ -856,9 +855,9 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
   LOG("HNIntranuke2018", pNOTICE)
     << " scattering angle: " << C3CM;
 
-  GHepParticle * t = new GHepParticle(*p);
-  t->SetPdgCode(tcode);
-  double Mt = t->Mass();
+  GHepParticle t(*p);
+  t.SetPdgCode(tcode);
+  double Mt = t.Mass();
 
   // handle fermi momentum 
   if(fDoFermi)
@@ -870,15 +869,15 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
       fNuclmodel->GenerateNucleon(target);
       TVector3 tP3L = fFermiFac * fNuclmodel->Momentum3();
       double tE = TMath::Sqrt(tP3L.Mag2() + Mt*Mt);
-      t->SetMomentum(TLorentzVector(tP3L,tE));
+      t.SetMomentum(TLorentzVector(tP3L,tE));
     }
   else
     {
-      t->SetMomentum(TLorentzVector(0,0,0,Mt));
+      t.SetMomentum(TLorentzVector(0,0,0,Mt));
     }
 
   bool pass = utils::intranuke2018::TwoBodyCollision(ev,pcode,tcode,scode,s2code,C3CM,
-						  p,t,fRemnA,fRemnZ,fRemnP4,kIMdHN);
+						  p,&t,fRemnA,fRemnZ,fRemnP4,kIMdHN);
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("HNIntranuke2018",pDEBUG)
@@ -892,14 +891,11 @@ void HNIntranuke2018::GammaInelasticHN(GHepRecord* ev, GHepParticle* p, INukeFat
     //p->SetStatus(kIStStableFinalState);
     //t->SetStatus(kIStStableFinalState);
     ev->AddParticle(*p);
-    ev->AddParticle(*t);
+    ev->AddParticle(t);
   } else
   {
     ev->AddParticle(*p);
   }
-
-  delete t;
-
 }
 //___________________________________________________________________________
 int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int mom) const
@@ -915,14 +911,13 @@ int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int
 	{
 	  if(fRemnA>4)  //this needs to be matched to what is in PreEq and Eq
             {
-              GHepParticle * sp = new GHepParticle(*p);
-              sp->SetFirstMother(mom);
+              GHepParticle sp(*p);
+              sp.SetFirstMother(mom);
 	      // this was PreEquilibrium - now just used for hN
 	      //same arguement lists for PreEq and Eq
-	      utils::intranuke2018::Equilibrium(ev,sp,fRemnA,fRemnZ,fRemnP4,
+	      utils::intranuke2018::Equilibrium(ev,&sp,fRemnA,fRemnZ,fRemnP4,
 					       fDoFermi,fFermiFac,fNuclmodel,fNucRmvE,kIMdHN);
 
-              delete sp;
               return 2;
             }
 	  else
@@ -930,11 +925,10 @@ int HNIntranuke2018::HandleCompoundNucleus(GHepRecord* ev, GHepParticle* p, int
               // nothing left to interact with!
               LOG("HNIntranuke2018", pNOTICE)
                 << "*** Nothing left to interact with, escaping.";
-              GHepParticle * sp = new GHepParticle(*p);
-              sp->SetFirstMother(mom);
-              sp->SetStatus(kIStStableFinalState);
-              ev->AddParticle(*sp);
-              delete sp;
+              GHepParticle sp(*p);
+              sp.SetFirstMother(mom);
+              sp.SetStatus(kIStStableFinalState);
+              ev->AddParticle(sp);
               return 1;
             }
 	}
@@ -40,6 +40,9 @@ public :
   void Configure (const Registry & config);
   void Configure (string param_set);
 
+  //! the hadron transport MC in use (0 if the transport is disabled)
+  const EventRecordVisitorI * Model (void) const { return (fEnabled) ? fHadTranspModel : 0; }
+
 private:
   void  LoadConfig                (void);
   void  TransportInTransparentNuc (GHepRecord * ev) const;
@@ -12,14 +12,22 @@
  Important revisions after version 2.0.0 :
  @ Oct 01, 2009 - CA
    Was first added in v2.5.1
+ @ Oct 14, 2026 - CA
+   Sample the distance to the Delta decay or interaction directly, using
+   per-nucleus density tables, rather than stepping the Delta in fixed steps.
+   Decaying Deltas are now handed to the decayer. Fixed the particle loop,
+   which stopped at the first particle that was not an in-nucleus Delta++.
 
 */
 //____________________________________________________________________________
 
 #include <TLorentzVector.h>
+#include <TMath.h>
 #include <TVector3.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/Units.h"
 #include "Framework/EventGen/EVGThreadException.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
@@ -28,9 +36,15 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
 using namespace genie;
+using namespace genie::constants;
+
+namespace {
+  const double kDeltaTableStep = 0.05; // fm
+}
 
 //___________________________________________________________________________
 INukeDeltaPropg::INukeDeltaPropg() :
@@ -60,11 +74,10 @@ void INukeDeltaPropg::ProcessEventRecord(GHepRecord * event) const
     return;
   }
   
-  // mass number, nuclear radius, step size
+  // mass number, nuclear radius
   int A = nucltgt->A();
-  double step_sz     = fHadStep;
-  double nucl_radius = utils::nuclear::Radius(A,fR0);
-  nucl_radius *= fNR; // track the particle further out
+  const DeltaTable_t & tbl = this->Table(A);
+  double nucl_radius = tbl.radius;
 
   RandomGen * rnd = RandomGen::Instance();
 
@@ -80,13 +93,13 @@ void INukeDeltaPropg::ProcessEventRecord(GHepRecord * event) const
     // handle?     
     int pdgc = p->Pdg();
     bool delta = (pdgc == kPdgP33m1232_DeltaPP);
-    if (!delta) return;
+    if (!delta) continue;
     GHepStatus_t ist = p->Status();
     bool in_nucleus = (ist == kIStHadronInTheNucleus);
-    if (!in_nucleus) return;
+    if (!in_nucleus) continue;
      
     LOG("INukeDelta", pNOTICE)
-        << " >> Stepping a " << p->Name()
+        << " >> Propagating a " << p->Name()
         << " with kinetic E = " << p->KinE() << " GeV";
           
     // Rescatter a clone, not the original particle
@@ -95,37 +108,52 @@ void INukeDeltaPropg::ProcessEventRecord(GHepRecord * event) const
     // Set clone's mom to be the hadron that was cloned
     sp->SetFirstMother(icurr);
 
-    // Start stepping particle out of the nucleus
+    // Decay and interaction rates (1/fm): the decay rate is constant along
+    // the path and the interaction rate follows the density, so they are
+    // tracked against their sum at the density peak. A sampled point is real
+    // with probability rate(r)/max rate, and otherwise tracking goes on from
+    // there (delta tracking).
+    const TLorentzVector & p4 = *(sp->P4());
+    double Ldec  = this->DecayLength(pdgc, p4);
+    double Rdec  = (Ldec > 0.) ? 1./Ldec : 0.;
+    TLorentzVector xpeak(0., 0., tbl.rpeak, 0.);
+    double Lint  = utils::intranuke::MeanFreePath_Delta(pdgc, xpeak, p4, A);
+    double Rpeak = (Lint > 0. && tbl.rhomax > 0.) ? 1./Lint : 0.;
+    double Rmax  = Rdec + Rpeak;
+
     bool has_interacted = false;
     bool has_decayed    = false;
-    while (1) {
-
-      const TLorentzVector & p4 = *(sp->P4());
-      const TLorentzVector & x4 = *(sp->X4());
+    while (Rmax > 0.) {
 
-      bool is_in = (x4.Vect().Mag() < nucl_radius + step_sz);
-      if (!is_in) break;
+      double r = sp->X4()->Vect().Mag();
+      if (r >= nucl_radius) break;
 
-      // step
-      utils::intranuke::StepParticle(sp, step_sz, nucl_radius);
+      // step to the next candidate decay / interaction point
+      double step = -1. * TMath::Log(rnd->RndFsi().Rndm()) / Rmax;
+      utils::intranuke::StepParticle(sp, step, nucl_radius);
 
-      // check whether it decayed at this step
-      double Ldec =  0.; // calculate
-      double ddec = -1. * Ldec * TMath::Log(rnd->RndFsi().Rndm()); 
-      has_decayed = (ddec < step_sz);
-      if(has_decayed) break;
+      r = sp->X4()->Vect().Mag();
+      if (r >= nucl_radius) break;
 
-      // check whether it interacted at this step
-      double Lint = utils::intranuke::MeanFreePath_Delta(pdgc,x4,p4,A);
-      double dint = -1. * Lint * TMath::Log(rnd->RndFsi().Rndm()); 
-      has_interacted = (dint < step_sz);
-      if(has_interacted) break;
-
-    }//stepping
+      double Rint = Rpeak * this->Density(tbl,r) / tbl.rhomax;
+      double R    = rnd->RndFsi().Rndm() * Rmax;
+      if (R < Rdec) {
+         has_decayed = true;
+         break;
+      }
+      if (R < Rdec + Rint) {
+         has_interacted = true;
+         break;
+      }
+    }//tracking
 
     if(has_decayed) {
-       // the particle decays 
-
+       // the particle decays in the nucleus - leave it to the decayer
+       LOG("INukeDelta", pINFO)
+          << "Particle has decayed at location:  "
+          << sp->X4()->Vect().Mag() << " / nucl radius = " << nucl_radius;
+       sp->SetStatus(kIStPreDecayResonantState);
+       event->AddParticle(*sp);
     }
     else
     if(has_interacted)  {
@@ -152,6 +180,8 @@ void INukeDeltaPropg::ProcessEventRecord(GHepRecord * event) const
       event->AddParticle(*sp);
     }//decay? interacts? escapes?
 
+    delete sp;
+
   }//particle loop
 }
 //___________________________________________________________________________
@@ -172,8 +202,81 @@ void INukeDeltaPropg::LoadConfig (void)
 
   GetParam( "NUCL-R0", fR0 ) ;   //fm
   GetParam( "NUCL-NR", fNR ) ;
-  GetParam( "INUKE-HadStep", fHadStep ) ;  //fm
 
+  // the tables depend on the tracking radius
+  fTables.clear();
+}
+//___________________________________________________________________________
+const INukeDeltaPropg::DeltaTable_t & INukeDeltaPropg::Table(int A) const
+{
+// Returns the density table of a nucleus with mass number A, out to the
+// radius Deltas are tracked to, building it at first use
+
+  std::map<int, DeltaTable_t>::const_iterator it = fTables.find(A);
+  if(it != fTables.end()) return it->second;
+
+  DeltaTable_t & tbl = fTables[A];
+  tbl.radius = fNR * utils::nuclear::Radius(A,fR0);
+  tbl.dr     = kDeltaTableStep;
+  tbl.rhomax = 0.;
+  tbl.rpeak  = 0.;
+
+  int n = (int) TMath::Ceil(tbl.radius / tbl.dr) + 1;
+  tbl.rho.resize(n);
+  for(int k = 0; k < n; k++) {
+    double r = k * tbl.dr;
+    tbl.rho[k] = utils::nuclear::Density(r,A);
+    if(tbl.rho[k] > tbl.rhomax) {
+      tbl.rhomax = tbl.rho[k];
+      tbl.rpeak  = r;
+    }
+  }
+
+  LOG("INukeDelta", pINFO)
+    << "Tabulated the density of A = " << A << " nuclei out to "
+    << tbl.radius << " fm (peak: " << tbl.rhomax << " fm^-3 at r = "
+    << tbl.rpeak << " fm)";
+
+  return tbl;
+}
+//___________________________________________________________________________
+double INukeDeltaPropg::Density(const DeltaTable_t & tbl, double r) const
+{
+// Linear interpolation of the tabulated density, so that it never exceeds
+// the tabulated peak used as the delta tracking majorant
+
+  double x = r / tbl.dr;
+  int    k = (int) x;
+  int    n = tbl.rho.size();
+  if(k >= n-1) return tbl.rho[n-1];
+  double f = x - k;
+  return (1.-f) * tbl.rho[k] + f * tbl.rho[k+1];
+}
+//___________________________________________________________________________
+double INukeDeltaPropg::DecayLength(int pdgc, const TLorentzVector & p4) const
+{
+// Lab frame decay length (in fm) of a Delta with the input 4-momentum, for
+// the P-wave N pi width at its invariant mass. Returns -1 (no decay) below
+// the N pi threshold.
+
+  double W     = p4.M();
+  double mass  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+  double width = PDGLibrary::Instance()->Find(pdgc)->Width();
+
+  double mth_p = kNucleonMass + kPionMass;
+  double mth_m = kNucleonMass - kPionMass;
+  if(W <= mth_p || mass <= mth_p || width <= 0.) return -1.;
+
+  double W2   = W*W;
+  double m2   = mass*mass;
+  double q    = TMath::Sqrt((W2 - mth_p*mth_p) * (W2 - mth_m*mth_m)) / (2*W);
+  double q0   = TMath::Sqrt((m2 - mth_p*mth_p) * (m2 - mth_m*mth_m)) / (2*mass);
+  double gamW = width * TMath::Power(q/q0, 3);
+
+  // c*tau*beta*gamma = (p/W) / Gamma, in GeV^-1
+  double L = (p4.P() / W) / gamW;
+
+  return L / units::fm;
 }
 //___________________________________________________________________________
 
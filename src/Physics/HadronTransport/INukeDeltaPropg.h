@@ -3,7 +3,14 @@
 
 \class    genie::INukeDeltaPropg
 
-\brief    	 
+\brief    Propagates Delta resonances through the nucleus (test mode).
+
+          The Delta 4-momentum does not change along its path, so its decay
+          length and its interaction length at the density peak of the
+          nucleus are computed once per Delta. Together with a per-nucleus
+          table of the density profile, they give the distance to the next
+          decay or interaction, which is sampled directly (delta tracking
+          against the peak rate) rather than in small fixed steps.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -19,6 +26,11 @@
 #ifndef _INUKE_DELTA_PROPG_H_
 #define _INUKE_DELTA_PROPG_H_
 
+#include <map>
+#include <vector>
+
+#include <TLorentzVector.h>
+
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/EventRecordVisitorI.h"
 
@@ -40,11 +52,24 @@ public:
   void Configure(string config);
 
 private:
-  void LoadConfig (void);
+  // Density profile of a nucleus out to the tracking radius
+  struct DeltaTable_t {
+    double              radius;  ///< tracking radius [fm]
+    double              dr;      ///< grid spacing [fm]
+    std::vector<double> rho;     ///< density at r = k*dr [fm^-3]
+    double              rhomax;  ///< largest tabulated density [fm^-3]
+    double              rpeak;   ///< radius of the largest density [fm]
+  };
+
+  void                 LoadConfig  (void);
+  const DeltaTable_t & Table       (int A) const;
+  double               Density     (const DeltaTable_t & tbl, double r) const;
+  double               DecayLength (int pdgc, const TLorentzVector & p4) const;
 
   double fR0;       ///< effective nuclear size param
   double fNR;       ///< param multiplying the nuclear radius, determining how far to track hadrons beyond the "nuclear boundary"
-  double fHadStep;  ///< step size for intranuclear hadron transport
+
+  mutable std::map<int, DeltaTable_t> fTables; ///< density tables, by mass number
 };
 
 }      // genie namespace
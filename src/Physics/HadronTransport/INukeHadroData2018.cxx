@@ -32,11 +32,40 @@
    Include Oset data files.
  @ Apr, 2016 - Flor Blasczyk
    Added K+ cex data files
+ @ Oct 14, 2026 - CA
+   Added SaveBundle() / LoadBundle(): the splines, hN grids and pi+A graphs
+   can be stored in a binary bundle that is memory-mapped at start-up,
+   instead of parsing the text files (which remain the source of truth: the
+   bundle is only used if it was built from text files of same contents).
+ @ Oct 14, 2026 - CA
+   XSec() (hN angular distributions), FracADep() and FracAIndep() use tables
+   indexed by (fate, hadron, target, product) / hadron, built once, with the
+   KE clamp ranges, instead of if/else chains. Added FracsHA(), returning all
+   hA fate fractions in one pass.
+ @ Oct 14, 2026 - CA
+   The bundle can be shared by the jobs of a node (see $GSHAREDATA): It is
+   then published by the first job and the hN grids use the mapped data.
+ @ Oct 14, 2026 - CA
+   IntBounce() samples the hN angular distributions by inverting conditional
+   CDFs in cos(theta), tabulated at the KE nodes of each grid at load time,
+   unless accept/reject is asked for (UseAngularAccRej()).
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstring>
+#include <cstdio>
 #include <string>
+#include <vector>
+#include <algorithm>
+#include <fstream>
+
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdint.h>
 
 #include <TSystem.h>
 #include <TNtupleD.h>
@@ -53,13 +82,108 @@
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/PhaseTimer.h"
+#include "Framework/Utils/SystemUtils.h"
 
 using std::ostringstream;
 using std::ios;
+using std::vector;
 
 using namespace genie;
 using namespace genie::constants;
 
+//____________________________________________________________________________
+// Layout of the binary bundle (all numbers in native byte order, which is
+// checked at load time using the byte-order mark):
+//   header
+//   index : one entry per object (splines, then grids, then graphs, in the
+//           order of BundleObjects()); size = 0 for null objects
+//   data  : spline knots x[n],y[n] / grid nodes x[nx],y[ny],z[nx*ny] /
+//           graph points x[n],y[n],z[n]
+//
+namespace {
+  const char     kINukeBinMagic[8] = { 'G','N','I','N','U','K','B','N' };
+  const uint32_t kINukeBinVersion  = 1;
+  const uint32_t kINukeBinBOM      = 0x01020304;
+
+  struct INukeBinHeader_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t bom;
+    uint32_t nsplines;
+    uint32_t ngrids;
+    uint32_t ngraphs;
+    uint32_t reserved;
+    uint64_t fingerprint;
+    uint64_t file_size;
+  };
+  struct INukeBinIndexEntry_t {
+    uint32_t n1;           // # of knots / x nodes / points
+    uint32_t n2;           // # of y nodes (grids only)
+    uint64_t data_offset;
+  };
+
+  // species indices of the hN angular distribution table
+  int hn_species_index(int pdgc)
+  {
+    switch(pdgc) {
+      case kPdgProton  : return 0;
+      case kPdgNeutron : return 1;
+      case kPdgPiP     : return 2;
+      case kPdgPi0     : return 3;
+      case kPdgPiM     : return 4;
+      case kPdgKP      : return 5;
+      case kPdgGamma   : return 6;
+      default          : return -1;
+    }
+  }
+  // nucleon indices of the hN angular distribution table (2: not a nucleon)
+  int nucleon_index(int pdgc)
+  {
+    return (pdgc == kPdgProton) ? 0 : ( (pdgc == kPdgNeutron) ? 1 : 2 );
+  }
+  // species indices of the hA fate fraction table
+  int ha_species_index(int pdgc)
+  {
+    switch(pdgc) {
+      case kPdgPiP     :
+      case kPdgPi0     :
+      case kPdgPiM     : return 0;
+      case kPdgProton  : return 1;
+      case kPdgNeutron : return 2;
+      case kPdgKP      : return 3;
+      default          : return -1;
+    }
+  }
+
+  // 64-bit FNV-1a hash
+  void fnv1a(uint64_t & hash, const char * data, size_t n)
+  {
+    for(size_t i = 0; i < n; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  // relative paths of all files below dir, sorted
+  void list_files(const string & dir, const string & rel, vector<string> & files)
+  {
+    DIR * d = opendir((dir + "/" + rel).c_str());
+    if(!d) return;
+    struct dirent * e;
+    while( (e = readdir(d)) ) {
+      string name = e->d_name;
+      if(name == "." || name == "..") continue;
+      string path = rel.empty() ? name : rel + "/" + name;
+      struct stat st;
+      if(stat((dir + "/" + path).c_str(), &st) != 0) continue;
+      if     (S_ISDIR(st.st_mode)) list_files(dir, path, files);
+      else if(S_ISREG(st.st_mode)) files.push_back(path);
+    }
+    closedir(d);
+    std::sort(files.begin(), files.end());
+  }
+}
+
 //____________________________________________________________________________
 INukeHadroData2018 * INukeHadroData2018::fInstance = 0;
 //____________________________________________________________________________
@@ -67,9 +191,11 @@ double INukeHadroData2018::fMinKinEnergy   =    1.0; // MeV
 double INukeHadroData2018::fMaxKinEnergyHA =  999.0; // MeV
 double INukeHadroData2018::fMaxKinEnergyHN = 1799.0; // MeV
 //____________________________________________________________________________
-INukeHadroData2018::INukeHadroData2018()
+INukeHadroData2018::INukeHadroData2018() :
+fAngAccRej(false)
 {
   this->LoadCrossSections();
+  this->BuildDispatchTables();
   fInstance = 0;
 }
 //____________________________________________________________________________
@@ -169,7 +295,12 @@ INukeHadroData2018::~INukeHadroData2018()
   delete fFracKA_CEx;
   delete fFracKA_Inel;
   delete fFracKA_Abs;
-  
+
+  // the shared hN grids are deleted: unmap their data
+  for(unsigned int i = 0; i < fBundleMem.size(); i++) {
+    munmap(fBundleMem[i].first, fBundleMem[i].second);
+  }
+  fBundleMem.clear();
 }
 //____________________________________________________________________________
 INukeHadroData2018 * INukeHadroData2018::Instance()
@@ -187,6 +318,8 @@ void INukeHadroData2018::LoadCrossSections(void)
 {
 // Loads hadronic x-section data
 
+  PhaseTimerGuard timer("INukeHadroData2018::LoadCrossSections");
+
   //-- Get the top-level directory with input hadron cross-section data
   //   (search for $GINUKEHADRONDATA or use default location)
   string data_dir = (gSystem->Getenv("GINUKEHADRONDATA")) ?
@@ -196,6 +329,22 @@ void INukeHadroData2018::LoadCrossSections(void)
   LOG("INukeData", pINFO)
       << "Loading INTRANUKE hadron data from: " << data_dir;
 
+  fDataDir = data_dir;
+
+  //-- Use the binary bundle, if it was built from the current data files
+  //   (search for $GINUKEHADRONBUNDLE, the shared data directory or use
+  //   default location)
+  string shared_dir = utils::system::SharedDataDir();
+  string bundle = this->DefaultBundle();
+  if(gSystem->Getenv("GINUKEHADRONBUNDLE")) {
+    bundle = string(gSystem->Getenv("GINUKEHADRONBUNDLE"));
+    shared_dir = "";
+  }
+  else if(shared_dir.size() > 0) {
+    bundle = shared_dir + "/intranuke-2018.ginukebin";
+  }
+  if(this->LoadBundle(bundle)) return;
+
   //-- Build filenames
 
   string datafile_NN   = data_dir + "/tot_xsec/intranuke-xsections-NN2014.dat";
@@ -1174,7 +1323,9 @@ void INukeHadroData2018::LoadCrossSections(void)
    TGraphs_file.Close();
 
    LOG("INukeData", pINFO)  << "Done building x-section splines...";
-   
+
+   //-- Publish the bundle for the other jobs of the node to map it
+   if(shared_dir.size() > 0) this->SaveBundle(bundle);
 }
 //____________________________________________________________________________
 void INukeHadroData2018::ReadhNFile(
@@ -1227,6 +1378,479 @@ void INukeHadroData2018::ReadhNFile(
   }
 }
 //____________________________________________________________________________
+void INukeHadroData2018::BundleObjects(
+  vector<Spline **> & splines, vector<BLI2DNonUnifGrid **> & grids,
+  vector<TGraph2D **> & graphs)
+{
+// All objects saved in the binary bundle. Objects can only be appended at
+// the end of each list: otherwise kINukeBinVersion must be changed
+
+  Spline ** spl[] = {
+    &fXSecPp_Tot,   &fXSecPp_Elas,   &fXSecPp_Reac,
+    &fXSecPn_Tot,   &fXSecPn_Elas,   &fXSecPn_Reac,
+    &fXSecNn_Tot,   &fXSecNn_Elas,   &fXSecNn_Reac,
+    &fXSecPp_Cmp,   &fXSecPn_Cmp,    &fXSecNn_Cmp,
+    &fXSecPipn_Tot, &fXSecPipn_CEx,  &fXSecPipn_Elas, &fXSecPipn_Reac,
+    &fXSecPipp_Tot, &fXSecPipp_CEx,  &fXSecPipp_Elas, &fXSecPipp_Reac,
+    &fXSecPipd_Abs,
+    &fXSecPi0n_Tot, &fXSecPi0n_CEx,  &fXSecPi0n_Elas, &fXSecPi0n_Reac,
+    &fXSecPi0p_Tot, &fXSecPi0p_CEx,  &fXSecPi0p_Elas, &fXSecPi0p_Reac,
+    &fXSecPi0d_Abs,
+    &fXSecKpn_Elas, &fXSecKpp_Elas,  &fXSecKpn_CEx,   &fXSecKpN_Abs,
+    &fXSecKpN_Tot,
+    &fXSecGamp_fs,  &fXSecGamn_fs,   &fXSecGamN_Tot,
+    &fFracPA_Tot,   &fFracPA_Inel,   &fFracPA_CEx,    &fFracPA_Abs,
+    &fFracPA_PiPro,
+    &fFracNA_Tot,   &fFracNA_Inel,   &fFracNA_CEx,    &fFracNA_Abs,
+    &fFracNA_PiPro,
+    &fFracPA_Cmp,   &fFracNA_Cmp,
+    &fFracKA_Tot,   &fFracKA_Elas,   &fFracKA_CEx,    &fFracKA_Inel,
+    &fFracKA_Abs
+  };
+  BLI2DNonUnifGrid ** grd[] = {
+    &fhN2dXSecPP_Elas,        &fhN2dXSecNP_Elas,
+    &fhN2dXSecPipN_Elas,      &fhN2dXSecPi0N_Elas,      &fhN2dXSecPimN_Elas,
+    &fhN2dXSecKpN_Elas,       &fhN2dXSecKpN_CEx,        &fhN2dXSecKpP_Elas,
+    &fhN2dXSecPiN_CEx,        &fhN2dXSecPiN_Abs,
+    &fhN2dXSecGamPi0P_Inelas, &fhN2dXSecGamPi0N_Inelas,
+    &fhN2dXSecGamPipN_Inelas, &fhN2dXSecGamPimP_Inelas
+  };
+  TGraph2D ** grf[] = {
+    &TfracPipA_Abs, &TfracPipA_CEx, &TfracPipA_Inelas, &TfracPipA_PiPro
+  };
+
+  splines.assign(spl, spl + sizeof(spl)/sizeof(spl[0]));
+  grids  .assign(grd, grd + sizeof(grd)/sizeof(grd[0]));
+  graphs .assign(grf, grf + sizeof(grf)/sizeof(grf[0]));
+}
+//____________________________________________________________________________
+unsigned long long INukeHadroData2018::DataFingerprint(void) const
+{
+// Hash of the names and contents of all files in the hadron data directory
+// (the source of truth for the binary bundle)
+
+  vector<string> files;
+  list_files(fDataDir, "tot_xsec", files);
+  list_files(fDataDir, "diff_ang", files);
+
+  uint64_t hash = 14695981039346656037ULL;
+  vector<char> buffer;
+  for(unsigned int i = 0; i < files.size(); i++) {
+    fnv1a(hash, files[i].c_str(), files[i].size() + 1);
+    std::ifstream in((fDataDir + "/" + files[i]).c_str(), ios::in | ios::binary);
+    in.seekg(0, ios::end);
+    std::streamoff size = in.tellg();
+    if(size <= 0) continue;
+    buffer.resize(size);
+    in.seekg(0, ios::beg);
+    in.read(&buffer[0], size);
+    fnv1a(hash, &buffer[0], size);
+  }
+  return hash;
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::SaveBundle(string filename) const
+{
+// Save all splines, hN grids and pi+A graphs in a binary bundle that is
+// loaded instead of the text data files. The file is written under a
+// temporary name and then renamed, so that jobs never read a partially
+// written bundle.
+
+  vector<Spline **> splines;
+  vector<BLI2DNonUnifGrid **> grids;
+  vector<TGraph2D **> graphs;
+  const_cast<INukeHadroData2018 *>(this)->BundleObjects(splines, grids, graphs);
+
+  vector<INukeBinIndexEntry_t> index;
+  vector<double> data;
+
+  for(unsigned int i = 0; i < splines.size(); i++) {
+    const Spline * spl = *splines[i];
+    INukeBinIndexEntry_t entry = { 0, 0, 0 };
+    if(spl) {
+      int n = spl->NKnots();
+      entry.n1 = n;
+      size_t ix = data.size();
+      data.resize(ix + 2*n);
+      for(int ik = 0; ik < n; ik++) spl->GetKnot(ik, data[ix+ik], data[ix+n+ik]);
+    }
+    entry.data_offset = data.size();
+    index.push_back(entry);
+  }
+  for(unsigned int i = 0; i < grids.size(); i++) {
+    const BLI2DNonUnifGrid * grd = *grids[i];
+    INukeBinIndexEntry_t entry = { 0, 0, 0 };
+    if(grd) {
+      int nx = grd->NFillX();
+      int ny = grd->NFillY();
+      entry.n1 = nx;
+      entry.n2 = ny;
+      for(int ix = 0; ix < nx; ix++) data.push_back(grd->X(ix));
+      for(int iy = 0; iy < ny; iy++) data.push_back(grd->Y(iy));
+      for(int ix = 0; ix < nx; ix++) {
+        for(int iy = 0; iy < ny; iy++) data.push_back(grd->Z(ix,iy));
+      }
+    }
+    entry.data_offset = data.size();
+    index.push_back(entry);
+  }
+  for(unsigned int i = 0; i < graphs.size(); i++) {
+    const TGraph2D * grf = *graphs[i];
+    INukeBinIndexEntry_t entry = { 0, 0, 0 };
+    if(grf) {
+      int n = grf->GetN();
+      entry.n1 = n;
+      data.insert(data.end(), grf->GetX(), grf->GetX() + n);
+      data.insert(data.end(), grf->GetY(), grf->GetY() + n);
+      data.insert(data.end(), grf->GetZ(), grf->GetZ() + n);
+    }
+    entry.data_offset = data.size();
+    index.push_back(entry);
+  }
+
+  // convert the data offsets (so far, the end of each object in the data
+  // array) to the start of each object in the file
+  uint64_t data_start = sizeof(INukeBinHeader_t) + index.size() * sizeof(INukeBinIndexEntry_t);
+  uint64_t prev_end = 0;
+  for(unsigned int i = 0; i < index.size(); i++) {
+    uint64_t end = index[i].data_offset;
+    index[i].data_offset = data_start + prev_end * sizeof(double);
+    prev_end = end;
+  }
+
+  INukeBinHeader_t header;
+  memcpy(header.magic, kINukeBinMagic, sizeof(header.magic));
+  header.version     = kINukeBinVersion;
+  header.bom         = kINukeBinBOM;
+  header.nsplines    = splines.size();
+  header.ngrids      = grids.size();
+  header.ngraphs     = graphs.size();
+  header.reserved    = 0;
+  header.fingerprint = this->DataFingerprint();
+  header.file_size   = data_start + data.size() * sizeof(double);
+
+  ostringstream tmpname;
+  tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+  std::ofstream out(tmpname.str().c_str(), ios::out | ios::binary);
+  out.write((const char *) &header, sizeof(header));
+  out.write((const char *) &index[0], index.size() * sizeof(INukeBinIndexEntry_t));
+  if(!data.empty()) out.write((const char *) &data[0], data.size() * sizeof(double));
+  out.close();
+
+  if(out.fail() || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    LOG("INukeData", pERROR)
+      << "Could not write the INTRANUKE hadron data bundle: " << filename;
+    std::remove(tmpname.str().c_str());
+    return false;
+  }
+  LOG("INukeData", pNOTICE)
+    << "Wrote the INTRANUKE hadron data bundle: " << filename
+    << " (" << header.file_size << " bytes)";
+  return true;
+}
+//____________________________________________________________________________
+bool INukeHadroData2018::LoadBundle(string filename)
+{
+// Load the binary bundle written by SaveBundle(), if there is one and it was
+// built from the current data files. Returns false otherwise (the text data
+// files should then be read)
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) return false;
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(INukeBinHeader_t)) {
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void * mem = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(mem == MAP_FAILED) return false;
+
+  vector<Spline **> splines;
+  vector<BLI2DNonUnifGrid **> grids;
+  vector<TGraph2D **> graphs;
+  this->BundleObjects(splines, grids, graphs);
+
+  const char * base = (const char *) mem;
+  const INukeBinHeader_t * header = (const INukeBinHeader_t *) base;
+  bool valid =
+     memcmp(header->magic, kINukeBinMagic, sizeof(header->magic)) == 0 &&
+     header->version   == kINukeBinVersion &&
+     header->bom       == kINukeBinBOM     &&
+     header->file_size == size             &&
+     header->nsplines  == splines.size()   &&
+     header->ngrids    == grids.size()     &&
+     header->ngraphs   == graphs.size();
+  if(!valid) {
+    LOG("INukeData", pWARN)
+      << "Ignoring invalid or incompatible INTRANUKE hadron data bundle: " << filename;
+    munmap(mem, size);
+    return false;
+  }
+  if(header->fingerprint != this->DataFingerprint()) {
+    LOG("INukeData", pWARN)
+      << "Ignoring outdated INTRANUKE hadron data bundle: " << filename
+      << " (the data files in " << fDataDir << " have changed)";
+    munmap(mem, size);
+    return false;
+  }
+
+  const INukeBinIndexEntry_t * index =
+     (const INukeBinIndexEntry_t *) (base + sizeof(INukeBinHeader_t));
+  int i = 0;
+
+  // a shared bundle stays mapped (read-only: its pages are shared by all the
+  // processes mapping it), for the hN grids to use its values in place.
+  // Splines and graphs keep their own copies.
+  bool shared = (utils::system::SharedDataDir().size() > 0) &&
+                !gSystem->Getenv("GINUKEHADRONBUNDLE");
+
+  for(unsigned int is = 0; is < splines.size(); is++, i++) {
+    int n = index[i].n1;
+    double * x = (double *) (base + index[i].data_offset);
+    *splines[is] = (n > 0) ? new Spline(n, x, x + n) : 0;
+  }
+  for(unsigned int ig = 0; ig < grids.size(); ig++, i++) {
+    int nx = index[i].n1;
+    int ny = index[i].n2;
+    double * x = (double *) (base + index[i].data_offset);
+    *grids[ig] = (nx > 0) ? new BLI2DNonUnifGrid(nx, ny, x, x + nx, x + nx + ny) : 0;
+    if(shared && nx > 0) (*grids[ig])->ShareZ(x + nx + ny);
+  }
+  for(unsigned int ig = 0; ig < graphs.size(); ig++, i++) {
+    int n = index[i].n1;
+    double * x = (double *) (base + index[i].data_offset);
+    TGraph2D * grf = 0;
+    if(n > 0) {
+      grf = new TGraph2D(n, x, x + n, x + 2*n);
+      grf->SetDirectory(0);
+    }
+    *graphs[ig] = grf;
+  }
+  if(TfracPipA_Abs   ) TfracPipA_Abs   ->SetNameTitle("TfracPipA_Abs",   "TfracPipA_Abs");
+  if(TfracPipA_CEx   ) TfracPipA_CEx   ->SetNameTitle("TfracPipA_CEx",   "TfracPipA_CEx");
+  if(TfracPipA_Inelas) TfracPipA_Inelas->SetNameTitle("TfracPipA_Inelas","TfracPipA_Inelas");
+  if(TfracPipA_PiPro ) TfracPipA_PiPro ->SetNameTitle("TfracPipA_PiPro", "TfracPipA_PiPro");
+
+  if(shared) fBundleMem.push_back(std::pair<void *, size_t>(mem, size));
+  else       munmap(mem, size);
+
+  LOG("INukeData", pNOTICE)
+    << "Loaded INTRANUKE hadron data from bundle: " << filename
+    << ((shared) ? " (shared)" : "");
+  return true;
+}
+//____________________________________________________________________________
+void INukeHadroData2018::BuildDispatchTables(void)
+{
+// Build the tables used by XSec() (hN angular distributions) and by
+// FracADep(), FracAIndep() and FracsHA() (hA fate fractions)
+
+  // hN angular distributions, indexed by fate, hadron, target and product
+  // nucleon (see hn_species_index() and nucleon_index())
+  HNAngEntry_t none = { 0, 0., 0., 0., false };
+  for(int f = 0; f < kNFatesHN; f++) {
+    for(int ih = 0; ih < kNSpeciesHN; ih++) {
+      for(int it = 0; it < kNNucleonIdx; it++) {
+        for(int ip = 0; ip < kNNucleonIdx; ip++) fHNAng[f][ih][it][ip] = none;
+      }
+    }
+  }
+  const int p = 0, n = 1, pip = 2, pi0 = 3, pim = 4, kp = 5, gam = 6;
+  HNAngEntry_t pp      = { fhN2dXSecPP_Elas,         50.,  999., 0., false };
+  HNAngEntry_t np      = { fhN2dXSecNP_Elas,         50.,  999., 0., false };
+  HNAngEntry_t pp_warn = { fhN2dXSecPP_Elas,         50.,  999., 0., true  };
+  HNAngEntry_t pipN    = { fhN2dXSecPipN_Elas,       10., 1499., 0., false };
+  HNAngEntry_t pi0N    = { fhN2dXSecPi0N_Elas,       10., 1499., 0., false };
+  HNAngEntry_t pimN    = { fhN2dXSecPimN_Elas,       10., 1499., 0., false };
+  HNAngEntry_t kpn     = { fhN2dXSecKpN_Elas,       100., 1799., 0., false };
+  HNAngEntry_t kpp     = { fhN2dXSecKpP_Elas,       100., 1799., 0., false };
+  HNAngEntry_t piN_cex = { fhN2dXSecPiN_CEx,         10., 1499., 0., false };
+  HNAngEntry_t kpn_cex = { fhN2dXSecKpN_CEx,        100., 1799., 0., false };
+  HNAngEntry_t piN_abs = { fhN2dXSecPiN_Abs,         50.,  499., 0., false };
+  HNAngEntry_t kp_abs  = { 0,                         0.,    0., 1., false }; // isotropic since no data ???
+  HNAngEntry_t gpi0p   = { fhN2dXSecGamPi0P_Inelas, 160., 1199., 0., false };
+  HNAngEntry_t gpipn   = { fhN2dXSecGamPipN_Inelas, 160., 1199., 0., false };
+  HNAngEntry_t gpimp   = { fhN2dXSecGamPimP_Inelas, 160., 1199., 0., false };
+  HNAngEntry_t gpi0n   = { fhN2dXSecGamPi0N_Inelas, 160., 1199., 0., false };
+
+  for(int ip = 0; ip < kNNucleonIdx; ip++) {
+    // elastic
+    fHNAng[kIHNFtElas][p ][p][ip] = pp;
+    fHNAng[kIHNFtElas][n ][n][ip] = pp;
+    fHNAng[kIHNFtElas][p ][n][ip] = np;
+    fHNAng[kIHNFtElas][n ][p][ip] = np;
+    fHNAng[kIHNFtElas][kp][n][ip] = kpn;
+    fHNAng[kIHNFtElas][kp][p][ip] = kpp;
+    for(int it = 0; it < kNNucleonIdx; it++) {
+      fHNAng[kIHNFtElas][pip][it][ip] = pipN;
+      fHNAng[kIHNFtElas][pi0][it][ip] = pi0N;
+      fHNAng[kIHNFtElas][pim][it][ip] = pimN;
+      fHNAng[kIHNFtAbs ][kp ][it][ip] = kp_abs;
+    }
+    // charge exchange
+    for(int it = p; it <= n; it++) {
+      fHNAng[kIHNFtCEx][pip][it][ip] = piN_cex;
+      fHNAng[kIHNFtCEx][pi0][it][ip] = piN_cex;
+      fHNAng[kIHNFtCEx][pim][it][ip] = piN_cex;
+    }
+    fHNAng[kIHNFtCEx][p ][p][ip] = pp_warn;
+    fHNAng[kIHNFtCEx][n ][n][ip] = pp_warn;
+    fHNAng[kIHNFtCEx][p ][n][ip] = np;
+    fHNAng[kIHNFtCEx][n ][p][ip] = np;
+    fHNAng[kIHNFtCEx][kp][n][ip] = kpn_cex;
+    // absorption
+    for(int it = p; it <= n; it++) {
+      fHNAng[kIHNFtAbs][pip][it][ip] = piN_abs;
+      fHNAng[kIHNFtAbs][pi0][it][ip] = piN_abs;
+      fHNAng[kIHNFtAbs][pim][it][ip] = piN_abs;
+    }
+  }
+  // inelastic (photoproduction)
+  fHNAng[kIHNFtInelas][gam][p][p] = gpi0p;
+  fHNAng[kIHNFtInelas][gam][p][n] = gpipn;
+  fHNAng[kIHNFtInelas][gam][n][p] = gpimp;
+  fHNAng[kIHNFtInelas][gam][n][n] = gpi0n;
+
+  // hA fate fractions of pions (A-dependent), p, n and K+, in the order
+  // they are summed for normalization
+  for(int ih = 0; ih < kNSpeciesHA; ih++) fHAFrac[ih].clear();
+
+  HAFracEntry_t pi_fates[] = {
+    { kIHAFtCEx,    0, TfracPipA_CEx    },
+    { kIHAFtInelas, 0, TfracPipA_Inelas },
+    { kIHAFtAbs,    0, TfracPipA_Abs    },
+    { kIHAFtPiProd, 0, TfracPipA_PiPro  }
+  };
+  HAFracEntry_t p_fates[] = {
+    { kIHAFtCEx,    fFracPA_CEx,   0 },
+    { kIHAFtInelas, fFracPA_Inel,  0 },
+    { kIHAFtAbs,    fFracPA_Abs,   0 },
+    { kIHAFtPiProd, fFracPA_PiPro, 0 },
+    { kIHAFtCmp,    fFracPA_Cmp,   0 }
+  };
+  HAFracEntry_t n_fates[] = {
+    { kIHAFtCEx,    fFracNA_CEx,   0 },
+    { kIHAFtInelas, fFracNA_Inel,  0 },
+    { kIHAFtAbs,    fFracNA_Abs,   0 },
+    { kIHAFtPiProd, fFracNA_PiPro, 0 },
+    { kIHAFtCmp,    fFracNA_Cmp,   0 }
+  };
+  HAFracEntry_t kp_fates[] = {
+    { kIHAFtInelas, fFracKA_Inel,  0 },
+    { kIHAFtAbs,    fFracKA_Abs,   0 }
+  };
+  fHAFrac[0].assign(pi_fates, pi_fates + sizeof(pi_fates)/sizeof(pi_fates[0]));
+  fHAFrac[1].assign(p_fates,  p_fates  + sizeof(p_fates) /sizeof(p_fates[0]));
+  fHAFrac[2].assign(n_fates,  n_fates  + sizeof(n_fates) /sizeof(n_fates[0]));
+  fHAFrac[3].assign(kp_fates, kp_fates + sizeof(kp_fates)/sizeof(kp_fates[0]));
+
+  this->BuildAngularCDFs();
+}
+//____________________________________________________________________________
+void INukeHadroData2018::BuildAngularCDFs(void)
+{
+// Tabulate, for each hN angular distribution grid and at each of its KE
+// nodes, the distribution in cos(theta) and its integral. The grids are
+// bilinear, so that at fixed KE the distribution is linear between the
+// cos(theta) nodes (and constant beyond the first/last one), and at a KE
+// between two nodes it is the weighted sum of the distributions at both.
+// IntBounce() can then sample it exactly with two random numbers.
+
+  fHNAngCDF.clear();
+
+  for(int f = 0; f < kNFatesHN; f++) {
+   for(int ih = 0; ih < kNSpeciesHN; ih++) {
+    for(int it = 0; it < kNNucleonIdx; it++) {
+     for(int ip = 0; ip < kNNucleonIdx; ip++) {
+       HNAngEntry_t & entry = fHNAng[f][ih][it][ip];
+       entry.cdf = -1;
+       const BLI2DNonUnifGrid * grid = entry.grid;
+       if(!grid || grid->NFillX() < 2 || grid->NFillY() < 2) continue;
+
+       for(unsigned int i = 0; i < fHNAngCDF.size(); i++) {
+         if(fHNAngCDF[i].grid == grid) { entry.cdf = i; break; }
+       }
+       if(entry.cdf >= 0) continue;
+
+       HNAngCDF_t table;
+       table.grid = grid;
+       for(int ix = 0; ix < grid->NFillX(); ix++) table.ke.push_back(grid->X(ix));
+       table.costh.push_back(-1.);
+       for(int iy = 0; iy < grid->NFillY(); iy++) {
+         double c = grid->Y(iy);
+         if(c > -1. && c < 1.) table.costh.push_back(c);
+       }
+       table.costh.push_back(1.);
+
+       int nc = table.costh.size();
+       table.pdf.resize(table.ke.size() * nc);
+       table.cdf.resize(table.ke.size() * nc);
+       for(unsigned int ik = 0; ik < table.ke.size(); ik++) {
+         double * pdf = &table.pdf[ik*nc];
+         double * cdf = &table.cdf[ik*nc];
+         for(int ic = 0; ic < nc; ic++) {
+           // negative values are never accepted by accept/reject
+           pdf[ic] = TMath::Max(0., grid->Evaluate(table.ke[ik], table.costh[ic]));
+           cdf[ic] = (ic == 0) ? 0. : cdf[ic-1] +
+             0.5 * (pdf[ic-1] + pdf[ic]) * (table.costh[ic] - table.costh[ic-1]);
+         }
+       }
+       fHNAngCDF.push_back(table);
+       entry.cdf = fHNAngCDF.size() - 1;
+     }
+    }
+   }
+  }
+
+  LOG("INukeData", pINFO)
+    << "Tabulated the CDFs of " << fHNAngCDF.size() << " hN angular distributions";
+}
+//____________________________________________________________________________
+double INukeHadroData2018::SampleCosTheta(
+  const HNAngEntry_t & entry, double ke) const
+{
+// Sample cos(theta) from the tabulated CDFs of the angular distribution at
+// the input KE (MeV). Returns -2 if the distribution vanishes.
+
+  const HNAngCDF_t & table = fHNAngCDF[entry.cdf];
+  RandomGen * rnd = RandomGen::Instance();
+
+  // KE cell, clamped as in XSec() and by the grid
+  ke = TMath::Max(TMath::Min(ke, entry.kemax), entry.kemin);
+  ke = TMath::Max(TMath::Min(ke, table.ke.back()), table.ke.front());
+  int nk = table.ke.size();
+  int ik = std::upper_bound(table.ke.begin(), table.ke.end(), ke) - table.ke.begin() - 1;
+  ik = TMath::Max(0, TMath::Min(ik, nk-2));
+  double fke = (ke - table.ke[ik]) / (table.ke[ik+1] - table.ke[ik]);
+
+  // pick the KE node by the weight of its distribution in the sum
+  int nc = table.costh.size();
+  double wlo = (1.-fke) * table.cdf[ik*nc + nc-1];
+  double whi = fke      * table.cdf[(ik+1)*nc + nc-1];
+  if(!(wlo + whi > 0)) return -2.;
+  if((wlo + whi) * rnd->RndFsi().Rndm() >= wlo) ik++;
+
+  // invert its CDF: the distribution is linear within a cos(theta) cell
+  const double * pdf = &table.pdf[ik*nc];
+  const double * cdf = &table.cdf[ik*nc];
+  double r  = cdf[nc-1] * rnd->RndFsi().Rndm();
+  int    ic = std::upper_bound(cdf, cdf + nc, r) - cdf - 1;
+  ic = TMath::Max(0, TMath::Min(ic, nc-2));
+
+  double h  = table.costh[ic+1] - table.costh[ic];
+  double a  = pdf[ic];
+  double b  = pdf[ic+1];
+  double dr = r - cdf[ic];
+  double disc  = TMath::Max(0., a*a + 2.*(b-a)*dr/h);
+  double denom = a + TMath::Sqrt(disc);
+  double x  = (denom > 0) ? 2.*dr / denom : 0.;
+
+  return table.costh[ic] + TMath::Max(0., TMath::Min(x, h));
+}
+//____________________________________________________________________________
 double INukeHadroData2018::XSec(
   int hpdgc, int tgtpdgc, int nppdgc, INukeFateHN_t fate, double ke, double costh) const
 {
@@ -1240,144 +1864,38 @@ double INukeHadroData2018::XSec(
 // returns
 //      xsec    : mbarn
 
-  double ke_eval    = ke;
-  double costh_eval = costh;
+  int ih = hn_species_index(hpdgc);
+  if(ih < 0 || fate < 0 || fate >= kNFatesHN) return 0;
 
-  costh_eval = TMath::Min(costh,  1.);
-  costh_eval = TMath::Max(costh_eval, -1.);
+  const HNAngEntry_t & entry =
+     fHNAng[fate][ih][nucleon_index(tgtpdgc)][nucleon_index(nppdgc)];
 
-  if(fate==kIHNFtElas) {
-
-     if( (hpdgc==kPdgProton  && tgtpdgc==kPdgProton) ||
-         (hpdgc==kPdgNeutron && tgtpdgc==kPdgNeutron) )
-     {
-       ke_eval = TMath::Min(ke_eval, 999.);
-       ke_eval = TMath::Max(ke_eval,  50.);
-       return fhN2dXSecPP_Elas->Evaluate(ke_eval, costh_eval);
-     }
-     else
-     if( (hpdgc==kPdgProton  && tgtpdgc==kPdgNeutron) ||
-         (hpdgc==kPdgNeutron && tgtpdgc==kPdgProton) )
-     {
-       ke_eval = TMath::Min(ke_eval, 999.);
-       ke_eval = TMath::Max(ke_eval,  50.);
-       return fhN2dXSecNP_Elas->Evaluate(ke_eval, costh_eval);
-     }
-     else
-     if(hpdgc==kPdgPiP)
-     {
-       ke_eval = TMath::Min(ke_eval, 1499.);
-       ke_eval = TMath::Max(ke_eval,   10.);
-       return fhN2dXSecPipN_Elas->Evaluate(ke_eval, costh_eval);
-     }
-     else
-     if(hpdgc==kPdgPi0)
-     {
-       ke_eval = TMath::Min(ke_eval, 1499.);
-       ke_eval = TMath::Max(ke_eval,   10.);
-       return fhN2dXSecPi0N_Elas->Evaluate(ke_eval, costh_eval);
-     }
-     else
-     if(hpdgc==kPdgPiM)
-     {
-       ke_eval = TMath::Min(ke_eval, 1499.);
-       ke_eval = TMath::Max(ke_eval,   10.);
-       return fhN2dXSecPimN_Elas->Evaluate(ke_eval, costh_eval);
-     }
-     else
-     if(hpdgc==kPdgKP && tgtpdgc==kPdgNeutron)
-     {
-       ke_eval = TMath::Min(ke_eval, 1799.);
-       ke_eval = TMath::Max(ke_eval,  100.);
-       return fhN2dXSecKpN_Elas->Evaluate(ke_eval, costh_eval);
-     }
-     else
-     if(hpdgc==kPdgKP && tgtpdgc==kPdgProton)
-     {
-       ke_eval = TMath::Min(ke_eval, 1799.);
-       ke_eval = TMath::Max(ke_eval,  100.);
-       return fhN2dXSecKpP_Elas->Evaluate(ke_eval, costh_eval);
-     }
+  if(entry.warn) {
+     LOG("INukeData", pWARN)  << "Inelastic pp does not exist!";
   }
+  if(!entry.grid) return entry.value;
 
-  else if(fate == kIHNFtCEx) {
-    if( (hpdgc==kPdgPiP || hpdgc==kPdgPi0 || hpdgc==kPdgPiM) &&
-         (tgtpdgc==kPdgProton || tgtpdgc==kPdgNeutron) )
-     {
-        ke_eval = TMath::Min(ke_eval, 1499.);
-        ke_eval = TMath::Max(ke_eval,   10.);
-        return fhN2dXSecPiN_CEx->Evaluate(ke_eval, costh_eval);
-     }
-    else if( (hpdgc == kPdgProton && tgtpdgc == kPdgProton) ||
-	     (hpdgc == kPdgNeutron && tgtpdgc == kPdgNeutron) )
-      {
-	LOG("INukeData", pWARN)  << "Inelastic pp does not exist!";
-	ke_eval = TMath::Min(ke_eval, 999.);
-	ke_eval = TMath::Max(ke_eval,  50.);
-	return fhN2dXSecPP_Elas->Evaluate(ke_eval, costh_eval);
-      }
-    else if( (hpdgc == kPdgProton && tgtpdgc == kPdgNeutron) ||
-	     (hpdgc == kPdgNeutron && tgtpdgc == kPdgProton) )
-      {
-	ke_eval = TMath::Min(ke_eval, 999.);
-	ke_eval = TMath::Max(ke_eval,  50.);
-	return fhN2dXSecNP_Elas->Evaluate(ke_eval, costh_eval);
-      }
-    else if(hpdgc == kPdgKP && tgtpdgc == kPdgNeutron) {
-    	ke_eval = TMath::Min(ke_eval, 1799.);
-    	ke_eval = TMath::Max(ke_eval,  100.);
-    	return fhN2dXSecKpN_CEx->Evaluate(ke_eval, costh_eval);
-    }
-  }
-
-  else if(fate == kIHNFtAbs) {
-    if( (hpdgc==kPdgPiP || hpdgc==kPdgPi0 || hpdgc==kPdgPiM) &&
-         (tgtpdgc==kPdgProton || tgtpdgc==kPdgNeutron) )
-     {
-        ke_eval = TMath::Min(ke_eval, 499.);
-        ke_eval = TMath::Max(ke_eval,  50.);
-        return fhN2dXSecPiN_Abs->Evaluate(ke_eval, costh_eval);
-     }
-    if(hpdgc==kPdgKP) return 1.;  //isotropic since no data ???
-  }
-
-  else if(fate == kIHNFtInelas) {
-    if( hpdgc==kPdgGamma && tgtpdgc==kPdgProton  &&nppdgc==kPdgProton  )
-    {
-       ke_eval = TMath::Min(ke_eval, 1199.);
-       ke_eval = TMath::Max(ke_eval,  160.);
-       return fhN2dXSecGamPi0P_Inelas->Evaluate(ke_eval, costh_eval);
-    }
-    else
-    if( hpdgc==kPdgGamma && tgtpdgc==kPdgProton  && nppdgc==kPdgNeutron )
-    {
-       ke_eval = TMath::Min(ke_eval, 1199.);
-       ke_eval = TMath::Max(ke_eval,  160.);
-       return fhN2dXSecGamPipN_Inelas->Evaluate(ke_eval, costh_eval);
-    }
-    else
-    if( hpdgc==kPdgGamma && tgtpdgc==kPdgNeutron && nppdgc==kPdgProton  )
-    {
-       ke_eval = TMath::Min(ke_eval, 1199.);
-       ke_eval = TMath::Max(ke_eval,  160.);
-       return fhN2dXSecGamPimP_Inelas->Evaluate(ke_eval, costh_eval);
-    }
-    else
-    if( hpdgc==kPdgGamma && tgtpdgc==kPdgNeutron && nppdgc==kPdgNeutron )
-    {
-       ke_eval = TMath::Min(ke_eval, 1199.);
-       ke_eval = TMath::Max(ke_eval,  160.);
-      return fhN2dXSecGamPi0N_Inelas->Evaluate(ke_eval, costh_eval);
-    }
-  }
+  double ke_eval    = TMath::Max(TMath::Min(ke, entry.kemax), entry.kemin);
+  double costh_eval = TMath::Max(TMath::Min(costh, 1.), -1.);
 
-  return 0;
+  return entry.grid->Evaluate(ke_eval, costh_eval);
 }
 //____________________________________________________________________________
-double INukeHadroData2018::FracADep(int hpdgc, INukeFateHA_t fate, double ke, int targA) const
+bool INukeHadroData2018::FracsHA(
+  int hpdgc, double ke, int targA, double * frac) const
 {
-  // return the x-section fraction for the input fate for the particle with the input pdg
-  // code and the target with the input mass number at the input kinetic energy
+// Fill frac[fate] with the x-section fraction of every hA fate for the
+// particle with the input pdg code at the input kinetic energy (in MeV), in
+// a target with the input mass number (only used for pions). Fates that are
+// not available for this particle get 0.
+
+  for(int f = 0; f < kNFatesHA; f++) frac[f] = 0.;
+
+  int ih = ha_species_index(hpdgc);
+  if(ih < 0) {
+    LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
+    return false;
+  }
 
   ke = TMath::Max(fMinKinEnergy,   ke);  // ke >= 1 MeV
   ke = TMath::Min(fMaxKinEnergyHA, ke);  // ke <= 999 MeV
@@ -1386,31 +1904,42 @@ double INukeHadroData2018::FracADep(int hpdgc, INukeFateHA_t fate, double ke, in
 
   LOG("INukeData", pDEBUG)  << "Querying hA cross section at ke  = " << ke << " and target " << targA;
 
+  // Protect against unitarity violation due to interpolation problems
+  // by renormalizing all available fate fractions to unity.
+  const vector<HAFracEntry_t> & fates = fHAFrac[ih];
+  double total = 0.;
+  for(unsigned int i = 0; i < fates.size(); i++) {
+    double f = (fates[i].graph) ?
+       fates[i].graph->Interpolate(targA, ke) : fates[i].spline->Evaluate(ke);
+    frac[fates[i].fate] = f;
+    total += f;
+  }
+  for(unsigned int i = 0; i < fates.size(); i++) {
+    frac[fates[i].fate] /= total;
+  }
+  return true;
+}
+//____________________________________________________________________________
+double INukeHadroData2018::FracADep(int hpdgc, INukeFateHA_t fate, double ke, int targA) const
+{
+  // return the x-section fraction for the input fate for the particle with the input pdg
+  // code and the target with the input mass number at the input kinetic energy
+
   // Handle pions (currently the same cross sections are used for pi+, pi-, and pi0)
-  if ( hpdgc == kPdgPiP || hpdgc == kPdgPiM || hpdgc == kPdgPi0 ) {
-
-    double frac_cex = TfracPipA_CEx->Interpolate(targA, ke);
-    //double frac_elas = TfracPipA_Elas->Interpolate(targA, ke);
-    double frac_inelas = TfracPipA_Inelas->Interpolate(targA, ke);
-    double frac_abs = TfracPipA_Abs->Interpolate(targA, ke);
-    double frac_pipro = TfracPipA_PiPro->Interpolate(targA, ke);
-
-    // Protect against unitarity violation due to interpolation problems
-    // by renormalizing all available fate fractions to unity.
-    double total = frac_cex + frac_inelas + frac_abs + frac_pipro; // + frac_elas
-
-    if ( fate == kIHAFtCEx ) return frac_cex / total;
-  //else if ( fate == kIHAFtElas   ) return frac_elas / total;
-    else if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs    ) return frac_abs / total;
-    else if ( fate == kIHAFtPiProd ) return frac_pipro / total;
-    else {
-      std::string sign("+");
-      if ( hpdgc == kPdgPiM ) sign = "-";
-      else if ( hpdgc == kPdgPi0 ) sign = "0";
-      LOG("INukeData", pWARN) << "Pi" << sign << "'s don't have this fate: " << INukeHadroFates::AsString(fate);
-      return 0.;
+  if ( ha_species_index(hpdgc) == 0 ) {
+
+    double frac[kNFatesHA];
+    this->FracsHA(hpdgc, ke, targA, frac);
+
+    const vector<HAFracEntry_t> & fates = fHAFrac[0];
+    for(unsigned int i = 0; i < fates.size(); i++) {
+      if(fates[i].fate == fate) return frac[fate];
     }
+    std::string sign("+");
+    if ( hpdgc == kPdgPiM ) sign = "-";
+    else if ( hpdgc == kPdgPi0 ) sign = "0";
+    LOG("INukeData", pWARN) << "Pi" << sign << "'s don't have this fate: " << INukeHadroFates::AsString(fate);
+    return 0.;
   }
 
   LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
@@ -1421,77 +1950,21 @@ double INukeHadroData2018::FracAIndep(int hpdgc, INukeFateHA_t fate, double ke)
 {
   // return the x-section fraction for the input fate for the particle with the input pdg
   // code at the input kinetic energy
-  ke = TMath::Max(fMinKinEnergy,   ke);
-  ke = TMath::Min(fMaxKinEnergyHA, ke);
-
-  LOG("INukeData", pDEBUG)  << "Querying hA cross section at ke = " << ke;
-
-  // TODO: reduce code duplication here
-  if (hpdgc == kPdgProton) {
-    // handle protons
-    double frac_cex = fFracPA_CEx->Evaluate(ke);
-    double frac_inelas = fFracPA_Inel->Evaluate(ke);
-    double frac_abs = fFracPA_Abs->Evaluate(ke);
-    double frac_pipro = fFracPA_PiPro->Evaluate(ke);
-    double frac_comp = fFracPA_Cmp->Evaluate(ke);
-
-    // Protect against unitarity violation due to interpolation problems
-    // by renormalizing all available fate fractions to unity.
-    double total = frac_cex + frac_inelas + frac_abs + frac_pipro + frac_comp; // + frac_elas
-
-    if ( fate == kIHAFtCEx ) return frac_cex / total;
-  //else if ( fate == kIHAFtElas   ) return frac_elas / total;
-    else if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs    ) return frac_abs / total;
-    else if ( fate == kIHAFtPiProd ) return frac_pipro / total;
-    else if ( fate == kIHAFtCmp    ) return frac_comp / total; // cmp - add support for this later
-    else {
-      LOG("INukeData", pWARN)
-        << "Protons don't have this fate: " << INukeHadroFates::AsString(fate);
-      return 0;
-    }
-  }
-  else if (hpdgc == kPdgNeutron) {
-    // handle neutrons
-    double frac_cex = fFracNA_CEx->Evaluate(ke);
-    double frac_inelas = fFracNA_Inel->Evaluate(ke);
-    double frac_abs = fFracNA_Abs->Evaluate(ke);
-    double frac_pipro = fFracNA_PiPro->Evaluate(ke);
-    double frac_comp = fFracNA_Cmp->Evaluate(ke);
-
-    // Protect against unitarity violation due to interpolation problems
-    // by renormalizing all available fate fractions to unity.
-    double total = frac_cex + frac_inelas + frac_abs + frac_pipro + frac_comp; // + frac_elas
-
-    if ( fate == kIHAFtCEx ) return frac_cex / total;
-  //else if ( fate == kIHAFtElas   ) return frac_elas / total;
-    else if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs    ) return frac_abs / total;
-    else if ( fate == kIHAFtPiProd ) return frac_pipro / total;
-    else if ( fate == kIHAFtCmp    ) return frac_comp / total; // cmp - add support for this later
-    else {
-      LOG("INukeData", pWARN)
-        << "Neutrons don't have this fate: " << INukeHadroFates::AsString(fate);
-      return 0;
-    }
-  }
-  else if (hpdgc == kPdgKP) {
-    // handle K+
-    double frac_inelas = fFracKA_Inel->Evaluate(ke);
-  //double frac_elas = fFracKA_Elas->Evaluate(ke);
-    double frac_abs = fFracKA_Abs->Evaluate(ke);
-
-    // Protect against unitarity violation due to interpolation problems
-    // by renormalizing all available fate fractions to unity.
-    double total = frac_inelas + frac_abs; // + frac_elas
-
-    if ( fate == kIHAFtInelas ) return frac_inelas / total;
-    else if ( fate == kIHAFtAbs ) return frac_abs / total;
-    else {
-      LOG("INukeData", pWARN)
-        << "K+'s don't have this fate: " << INukeHadroFates::AsString(fate);
-      return 0.;
+
+  int ih = ha_species_index(hpdgc);
+  if ( ih > 0 ) {
+    // handle protons, neutrons and K+
+    double frac[kNFatesHA];
+    this->FracsHA(hpdgc, ke, 0, frac);
+
+    const vector<HAFracEntry_t> & fates = fHAFrac[ih];
+    for(unsigned int i = 0; i < fates.size(); i++) {
+      if(fates[i].fate == fate) return frac[fate];
     }
+    const char * name[] = { "", "Protons", "Neutrons", "K+'s" };
+    LOG("INukeData", pWARN)
+      << name[ih] << " don't have this fate: " << INukeHadroFates::AsString(fate);
+    return 0.;
   }
   LOG("INukeData", pWARN) << "Can't handle particles with pdg code = " << hpdgc;
   return 0.;
@@ -1667,7 +2140,8 @@ double INukeHadroData2018::Frac(int hpdgc, INukeFateHN_t fate, double ke, int ta
 double INukeHadroData2018::IntBounce(const GHepParticle* p, int target, int scode, INukeFateHN_t fate)
 {
   // This method returns a random cos(ang) according to a distribution
-  // based upon the particle and fate. The sampling uses the
+  // based upon the particle and fate. By default it is drawn from the
+  // CDFs tabulated by BuildAngularCDFs(). Otherwise, the sampling uses the
   // Accept/Reject method, whereby a distribution is bounded above by
   // an envelope, or in this case, a number of envelopes, which can be
   // easily sampled (here, we use uniform distributions).
@@ -1680,6 +2154,27 @@ double INukeHadroData2018::IntBounce(const GHepParticle* p, int target, int scod
 
   RandomGen * rnd = RandomGen::Instance();
 
+  double ke = (p->E() - p->Mass()) * 1000.0; // ke in MeV
+  if (TMath::Abs((int)ke-ke)<.01) ke+=.3;    // make sure ke isn't an integer,
+                                             // otherwise sometimes gives weird results
+                                             // due to ROOT's Interpolate() function
+
+  // Unless asked for accept/reject, sample the tabulated CDFs. Channels
+  // with no data (or a vanishing distribution) go through accept/reject.
+  int ih = hn_species_index(p->Pdg());
+  if(!fAngAccRej && ih >= 0 && fate >= 0 && fate < kNFatesHN) {
+    const HNAngEntry_t & entry =
+       fHNAng[fate][ih][nucleon_index(target)][nucleon_index(scode)];
+    if(entry.warn) {
+      LOG("INukeData", pWARN)  << "Inelastic pp does not exist!";
+    }
+    if(!entry.grid && entry.value > 0) return 2*rnd->RndFsi().Rndm() - 1;
+    if(entry.cdf >= 0) {
+      double costh = this->SampleCosTheta(entry, ke);
+      if(costh >= -1.) return costh;
+    }
+  }
+
   // numEnv is the number of envelopes in the total envelope,
   // that is, the number of seperate simple uniform distributions
   // that will be fit against the distribution in question in the
@@ -1692,10 +2187,6 @@ double INukeHadroData2018::IntBounce(const GHepParticle* p, int target, int scod
   double sr = 2.0 / numEnv;           // Subrange, i.e., range of an envelope
   double cstep = 2.0 / (numPoints);   // Magnitude of the step between eval. points
 
-  double ke = (p->E() - p->Mass()) * 1000.0; // ke in MeV
-  if (TMath::Abs((int)ke-ke)<.01) ke+=.3;    // make sure ke isn't an integer,
-                                             // otherwise sometimes gives weird results
-                                             // due to ROOT's Interpolate() function
   double avg = 0.0; // average value in envelop
 
   // Matrices to hold data; buff holds the distribution
@@ -21,6 +21,15 @@
           data and extrapolations, and INC model results from Mashnik et al.
           for h+Fe56.
 
+          The splines, grids and graphs built from the text data files can be
+          saved in a binary bundle (see SaveBundle() and the ginukebundle app),
+          which is memory-mapped and used instead of the text files as long as
+          it matches their contents. The bundle is found in $GINUKEHADRONBUNDLE,
+          in the shared data directory (see $GSHAREDATA) or in the hadron
+          data directory. When shared, the bundle is written by the first job
+          reading the text files and the hN grids of all the jobs mapping it
+          use its (single, per node) copy of the hN data in place.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>, Rutherford Lab.
           Steve Dytman <dytman+@pitt.edu>, Pittsburgh Univ.
 	  Aaron Meyer <asm58@pitt.edu>, Pittsburgh Univ.
@@ -38,6 +47,10 @@
 #ifndef _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 #define _INTRANUKE_HADRON_CROSS_SECTIONS_2018_H_
 
+#include <string>
+#include <vector>
+#include <utility>
+
 #include "Physics/HadronTransport/INukeHadroFates2018.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Framework/Numerical/BLI2D.h"
@@ -64,6 +77,26 @@ public:
   double Frac (int hpdgc, INukeFateHN_t fate, double ke, int targA=0, int targZ=0) const;
   double IntBounce       (const GHepParticle* p, int target, int s1, INukeFateHN_t fate);
 
+  //! IntBounce() samples the hN scattering angle cosines from conditional
+  //! CDFs in cos(theta), tabulated at the KE nodes of each angular
+  //! distribution when the data are loaded. This switches back to sampling
+  //! them by accept/reject against the distribution max, for validation.
+  void   UseAngularAccRej (bool on = true) { fAngAccRej = on; }
+  bool   AngularAccRej    (void) const     { return fAngAccRej; }
+
+  //! # of hN / hA fate codes (size of fate-indexed arrays)
+  enum { kNFatesHN = kIHNFtCmp + 1, kNFatesHA = kIHAFtDCEx + 1 };
+
+  //! All hA fate fractions for the input hadron at the input KE, in a target
+  //! of mass number targA (pions only), in one pass: frac[fate] for all
+  //! kNFatesHA fates, 0 for those not available. False if not handled.
+  bool   FracsHA (int hpdgc, double ke, int targA, double * frac) const;
+
+  //! Save the data in a binary bundle loaded instead of the text files
+  bool SaveBundle (string filename) const;
+  //! Default binary bundle location
+  string DefaultBundle (void) const { return fDataDir + "/intranuke-2018.ginukebin"; }
+
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // hN mode hadron x-section splines
@@ -152,6 +185,42 @@ private:
  ~INukeHadroData2018();
 
   void LoadCrossSections(void);
+  bool LoadBundle       (string filename);
+  void BundleObjects    (std::vector<Spline **> & splines,
+                         std::vector<BLI2DNonUnifGrid **> & grids,
+                         std::vector<TGraph2D **> & graphs);
+  unsigned long long DataFingerprint (void) const;
+  void BuildDispatchTables (void);
+
+  //-- indexed dispatch of the hN angular distributions & hA fate fractions
+  enum { kNSpeciesHN = 7, kNNucleonIdx = 3, kNSpeciesHA = 4 };
+  struct HNAngEntry_t {
+    const BLI2DNonUnifGrid * grid;   ///< angular distribution (0: return value)
+    double                   kemin;  ///< KE clamp range (MeV)
+    double                   kemax;
+    double                   value;  ///< returned if there is no grid
+    bool                     warn;   ///< warn at each call?
+    int                      cdf;    ///< index of the grid CDFs in fHNAngCDF (-1: none)
+  };
+  struct HNAngCDF_t {
+    const BLI2DNonUnifGrid * grid;
+    std::vector<double>      ke;     ///< KE nodes of the grid (MeV)
+    std::vector<double>      costh;  ///< cos(theta) knots: -1, grid nodes, 1
+    std::vector<double>      pdf;    ///< distribution at [ike*ncosth + icosth]
+    std::vector<double>      cdf;    ///< its integral from -1 up to the knot
+  };
+  struct HAFracEntry_t {
+    INukeFateHA_t            fate;
+    const Spline *           spline; ///< A-independent fraction, or
+    TGraph2D *               graph;  ///< A-dependent fraction (A, KE)
+  };
+  void   BuildAngularCDFs (void);
+  double SampleCosTheta   (const HNAngEntry_t & entry, double ke) const;
+
+  HNAngEntry_t                  fHNAng [kNFatesHN][kNSpeciesHN][kNNucleonIdx][kNNucleonIdx];
+  std::vector<HAFracEntry_t>    fHAFrac[kNSpeciesHA]; ///< fates of pi, p, n, K+ (summation order)
+  std::vector<HNAngCDF_t>       fHNAngCDF;            ///< conditional CDFs of the hN angular distributions
+  bool                          fAngAccRej;           ///< IntBounce() by accept/reject?
 
   void ReadhNFile(
          string filename, double ke, int npoints, int & curr_point,
@@ -159,6 +228,9 @@ private:
 
   static INukeHadroData2018 * fInstance;
 
+  string fDataDir;             ///< hadron data directory
+  std::vector< std::pair<void *, size_t> > fBundleMem; ///< mapped bundle, if shared
+
   Spline * fXSecPipn_Tot;      ///< pi+n hN x-section splines
   Spline * fXSecPipn_CEx;      ///<
   Spline * fXSecPipn_Elas;     ///<
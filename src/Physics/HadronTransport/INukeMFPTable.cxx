@@ -0,0 +1,282 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <TLorentzVector.h>
+#include <TParticlePDG.h>
+#include <TMath.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Physics/HadronTransport/INukeMFPTable.h"
+#include "Physics/HadronTransport/INukeUtils2018.h"
+
+using namespace genie;
+
+// table binning & accuracy
+static const int    kNR         = 192;      // # of r nodes
+static const int    kNKE        = 256;      // # of sqrt(KE) nodes
+static const double kKEMax      = 10000.;   // max tabulated KE (MeV)
+static const double kTolerance  = 5E-3;     // max rel. mfp error at the cell centres
+static const double kMassTol    = 1E-6;     // max hadron off-shellness (GeV)
+static const double kMajorantSafety = 1.25; // safety factor on interaction rate majorants
+static const int    kNCellsShell    = 12;   // # of r cells per majorant shell
+static const int    kNShells        = (kNR-1 + kNCellsShell-1) / kNCellsShell;
+
+//____________________________________________________________________________
+INukeMFPTable::INukeMFPTable(
+  int pdgc, int A, int Z, double rmax, double nRpi, double nRnuc,
+  bool useOset, bool altOset, bool xsecNNCorr, string INukeMode) :
+fPdgC       (pdgc),
+fMass       (0.),
+fA          (A),
+fZ          (Z),
+fNRpi       (nRpi),
+fNRnuc      (nRnuc),
+fUseOset    (useOset),
+fAltOset    (altOset),
+fXsecNNCorr (xsecNNCorr),
+fINukeMode  (INukeMode),
+fIsValid    (false),
+fRMax       (rmax),
+fSqrtKEMax  (TMath::Sqrt(kKEMax)),
+fKEMinTable (0.)
+{
+  fDR      = fRMax      / (kNR -1);
+  fDSqrtKE = fSqrtKEMax / (kNKE-1);
+
+  // the Oset model keeps track of the channel fractions of the last call,
+  // used later for selecting the hadron fate: never bypass it
+  bool is_pion = (pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM);
+  if(is_pion && fUseOset && fINukeMode == "hN2018") {
+    fKEMinTable = 350.;
+  }
+
+  this->Build();
+}
+//____________________________________________________________________________
+INukeMFPTable::~INukeMFPTable()
+{
+
+}
+//____________________________________________________________________________
+bool INukeMFPTable::MeanFreePath(
+  const TLorentzVector & x4, const TLorentzVector & p4, double & mfp) const
+{
+  if(!fIsValid) return false;
+
+  double M = p4.M();
+  if(TMath::Abs(M - fMass) > kMassTol) return false;
+
+  double ke = (p4.Energy() - M) / units::MeV;
+  if(ke < fKEMinTable) return false;
+
+  double xr = x4.Vect().Mag() / fDR;
+  double xk = TMath::Sqrt(TMath::Max(0., ke)) / fDSqrtKE;
+  int    ir = (int) xr;
+  int    ik = (int) xk;
+  if(ir >= kNR-1 || ik >= kNKE-1) return false;
+
+  if(!fCellOk[ir*(kNKE-1)+ik]) return false;
+
+  mfp = this->InterpolatedMFP(ir, ik, xr-ir, xk-ik, p4);
+
+  return true;
+}
+//____________________________________________________________________________
+bool INukeMFPTable::MaxRate(double ke, double & rate) const
+{
+  rate = 0;
+
+  const double * rates = 0;
+  if(!this->MaxRates(ke, rates)) return false;
+
+  for(int is = 0; is < kNShells; is++) rate = TMath::Max(rate, rates[is]);
+  return (rate > 0.);
+}
+//____________________________________________________________________________
+bool INukeMFPTable::MaxRates(double ke, const double * & rates) const
+{
+  rates = 0;
+  if(!fIsValid) return false;
+
+  int ik = (int) (TMath::Sqrt(TMath::Max(0., ke)) / fDSqrtKE);
+  if(ik >= kNKE-1) return false;
+
+  if(fMaxRate[ik*kNShells] < 0.) this->ComputeMaxRates(ik);
+
+  rates = &fMaxRate[ik*kNShells];
+  for(int is = 0; is < kNShells; is++) {
+    if(rates[is] > 0.) return true;
+  }
+  return false;
+}
+//____________________________________________________________________________
+int INukeMFPTable::NShells(void) const
+{
+  return kNShells;
+}
+//____________________________________________________________________________
+double INukeMFPTable::ShellWidth(void) const
+{
+  return kNCellsShell * fDR;
+}
+//____________________________________________________________________________
+void INukeMFPTable::ComputeMaxRates(int ik) const
+{
+// Max interaction rate in each radial shell for the KE bin ik, scanning all
+// r nodes and r cell centres at the bin edges and centre. Nodes at a shell
+// boundary count for both shells.
+
+  double * maxrate = &fMaxRate[ik*kNShells];
+  for(int is = 0; is < kNShells; is++) maxrate[is] = 0.;
+
+  for(int jk = 0; jk <= 2; jk++) {
+    double ke = TMath::Power((ik + 0.5*jk) * fDSqrtKE, 2.);
+    for(int jr = 0; jr < 2*kNR-1; jr++) {
+      double L = this->DirectMFP(0.5 * jr * fDR, ke);
+      if(L <= 0.) continue;
+      int is = TMath::Min(jr / (2*kNCellsShell), kNShells-1);
+      maxrate[is] = TMath::Max(maxrate[is], 1./L);
+      if(jr % (2*kNCellsShell) == 0 && is > 0) {
+        maxrate[is-1] = TMath::Max(maxrate[is-1], 1./L);
+      }
+    }
+  }
+  for(int is = 0; is < kNShells; is++) maxrate[is] *= kMajorantSafety;
+}
+//____________________________________________________________________________
+double INukeMFPTable::FracValid(void) const
+{
+  if(fCellOk.size() == 0) return 0.;
+
+  int nok = 0;
+  for(unsigned int i = 0; i < fCellOk.size(); i++) {
+    if(fCellOk[i]) nok++;
+  }
+  return (double)nok / fCellOk.size();
+}
+//____________________________________________________________________________
+void INukeMFPTable::Build(void)
+{
+  TParticlePDG * pdgp = PDGLibrary::Instance()->Find(fPdgC);
+  if(!pdgp) return;
+  fMass = pdgp->Mass();
+
+  fLogRho.assign(kNR*kNKE, 0.);
+  fSigTot.assign(kNR*kNKE, 0.);
+  fCellOk.assign((kNR-1)*(kNKE-1), 0);
+  vector<char> node_ok(kNR*kNKE, 0);
+
+  // sample the density & xsec at the grid nodes
+  for(int ir = 0; ir < kNR; ir++) {
+    double r = ir * fDR;
+    for(int ik = 0; ik < kNKE; ik++) {
+      double ke = TMath::Power(ik * fDSqrtKE, 2.);
+      if(ke < fKEMinTable) continue;
+      double rho = 0, sigtot = 0;
+      if(!this->Inputs(r, ke, rho, sigtot)) {
+        LOG("Intranuke2018", pINFO)
+           << "No mean free path table for pdg = " << fPdgC;
+        fLogRho.clear();
+        fSigTot.clear();
+        fCellOk.clear();
+        return;
+      }
+      int i = ir*kNKE+ik;
+      fLogRho [i] = TMath::Log(TMath::Max(rho, 1E-300));
+      fSigTot [i] = sigtot;
+      node_ok [i] = 1;
+    }
+  }
+  fIsValid = true;
+  fMaxRate.assign((kNKE-1)*kNShells, -1.);
+
+  // validate every cell at its centre
+  for(int ir = 0; ir < kNR-1; ir++) {
+    double r = (ir + 0.5) * fDR;
+    for(int ik = 0; ik < kNKE-1; ik++) {
+      int i = ir*kNKE+ik;
+      if(!node_ok[i] || !node_ok[i+1] || !node_ok[i+kNKE] || !node_ok[i+kNKE+1]) continue;
+
+      double ke = TMath::Power((ik + 0.5) * fDSqrtKE, 2.);
+      double E  = ke * units::MeV + fMass;
+      double p  = TMath::Sqrt(TMath::Max(0., E*E - fMass*fMass));
+      TLorentzVector p4(0., 0., p, E);
+
+      double direct = this->DirectMFP(r, ke);
+      double interp = this->InterpolatedMFP(ir, ik, 0.5, 0.5, p4);
+
+      bool ok = (direct > 0. && interp > 0. &&
+                 TMath::Abs(interp - direct) <= kTolerance * direct);
+      fCellOk[ir*(kNKE-1)+ik] = ok ? 1 : 0;
+    }
+  }
+
+  LOG("Intranuke2018", pNOTICE)
+     << "Built mean free path table for pdg = " << fPdgC
+     << " in A,Z = " << fA << "," << fZ << " (r < " << fRMax << " fm, KE < "
+     << kKEMax << " MeV): " << 100.*this->FracValid() << "% of cells validated";
+}
+//____________________________________________________________________________
+bool INukeMFPTable::Inputs(
+  double r, double ke, double & rho, double & sigtot) const
+{
+  double E = ke * units::MeV + fMass;
+  double p = TMath::Sqrt(TMath::Max(0., E*E - fMass*fMass));
+
+  TLorentzVector x4(0., 0., r, 0.);
+  TLorentzVector p4(0., 0., p, E);
+
+  return utils::intranuke2018::MeanFreePathInputs(
+     fPdgC, x4, p4, fA, fZ, fNRpi, fNRnuc, fUseOset, fAltOset, fINukeMode,
+     rho, sigtot);
+}
+//____________________________________________________________________________
+double INukeMFPTable::DirectMFP(double r, double ke) const
+{
+  double E = ke * units::MeV + fMass;
+  double p = TMath::Sqrt(TMath::Max(0., E*E - fMass*fMass));
+
+  TLorentzVector x4(0., 0., r, 0.);
+  TLorentzVector p4(0., 0., p, E);
+
+  return utils::intranuke2018::MeanFreePath(
+     fPdgC, x4, p4, fA, fZ, fNRpi, fNRnuc, fUseOset, fAltOset, fXsecNNCorr,
+     fINukeMode);
+}
+//____________________________________________________________________________
+double INukeMFPTable::InterpolatedMFP(
+  int ir, int ik, double fr, double fk, const TLorentzVector & p4) const
+{
+  int i00 = ir*kNKE+ik;
+  int i01 = i00 + 1;
+  int i10 = i00 + kNKE;
+  int i11 = i10 + 1;
+
+  double w00 = (1.-fr)*(1.-fk);
+  double w01 = (1.-fr)*fk;
+  double w10 = fr*(1.-fk);
+  double w11 = fr*fk;
+
+  double logrho = w00*fLogRho[i00] + w01*fLogRho[i01] +
+                  w10*fLogRho[i10] + w11*fLogRho[i11];
+  double sigtot = w00*fSigTot[i00] + w01*fSigTot[i01] +
+                  w10*fSigTot[i10] + w11*fSigTot[i11];
+
+  return utils::intranuke2018::MeanFreePathFromXSec(
+     fPdgC, p4, fA, fZ, TMath::Exp(logrho), sigtot, fXsecNNCorr);
+}
+//____________________________________________________________________________
@@ -0,0 +1,116 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::INukeMFPTable
+
+\brief    Tabulated INTRANUKE (2018) mean free path of a given hadron species
+          in a given (remnant) nucleus, as a function of the hadron radial
+          position and kinetic energy.
+
+          The nuclear density and the total hadron+nucleon cross section
+          returned by utils::intranuke2018::MeanFreePathInputs() are sampled
+          on a grid uniform in r and in sqrt(KE) when the table is built, and
+          interpolated bilinearly afterwards (the density in log scale, to
+          follow the exponential fall-off at the nuclear surface). The nuclear
+          medium correction and the mean free path are then computed as in
+          utils::intranuke2018::MeanFreePath().
+          Every grid cell is validated at its centre against the direct
+          calculation. Cells where the two differ by more than the tolerance
+          (discontinuities, eg the Coulomb barrier or the low energy nucleon
+          cut-off), as well as positions / energies outside the table and the
+          low energy pions for which the Oset model is used, are flagged so
+          that the caller falls back to the direct calculation.
+
+          The table also provides, for each kinetic energy bin, majorants of
+          the interaction rate (1/mfp) in a number of radial shells covering
+          the tabulated positions, used for delta (Woodcock) tracking: the
+          shell majorants give, in a single draw, the probability that a
+          hadron crosses the nucleus without any tentative interaction point.
+          Majorants are computed from the direct calculation when first
+          needed, and include a safety margin.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _INUKE_MFP_TABLE_H_
+#define _INUKE_MFP_TABLE_H_
+
+#include <string>
+#include <vector>
+
+class TLorentzVector;
+
+using std::string;
+using std::vector;
+
+namespace genie {
+
+class INukeMFPTable {
+
+public:
+  INukeMFPTable(int pdgc, int A, int Z, double rmax,
+                double nRpi, double nRnuc, bool useOset, bool altOset,
+                bool xsecNNCorr, string INukeMode);
+ ~INukeMFPTable();
+
+  //! Mean free path (fm) - returns false if the direct calculation is needed
+  bool MeanFreePath(const TLorentzVector & x4, const TLorentzVector & p4,
+                    double & mfp) const;
+
+  //! Majorant of the interaction rate (1/fm) at this KE (MeV) over r < RMax()
+  bool MaxRate(double ke, double & rate) const;
+
+  //! Majorants of the interaction rate (1/fm) at this KE (MeV) in each of the
+  //! NShells() radial shells [i*ShellWidth(), (i+1)*ShellWidth()]
+  bool MaxRates(double ke, const double * & rates) const;
+
+  int    NShells   (void) const;                     ///< # of radial shells
+  double ShellWidth(void) const;                     ///< radial shell width (fm)
+
+  bool   IsValid  (void) const { return fIsValid; } ///< hadron can be tabulated?
+  double RMax     (void) const { return fRMax;    } ///< tabulated radial range (fm)
+  double FracValid(void) const;                      ///< fraction of validated cells
+
+private:
+
+  void   Build          (void);
+  bool   Inputs         (double r, double ke, double & rho, double & sigtot) const;
+  double DirectMFP      (double r, double ke) const;
+  void   ComputeMaxRates(int ik) const;
+  double InterpolatedMFP(int ir, int ik, double fr, double fk,
+                         const TLorentzVector & p4) const;
+
+  int    fPdgC;          ///< hadron pdg code
+  double fMass;          ///< hadron mass (GeV)
+  int    fA;             ///< nucleus A
+  int    fZ;             ///< nucleus Z
+  double fNRpi;          ///< pion ring size (de Broglie wavelengths)
+  double fNRnuc;         ///< nucleon ring size (de Broglie wavelengths)
+  bool   fUseOset;       ///< Oset model for low energy pions?
+  bool   fAltOset;       ///< table-based Oset model?
+  bool   fXsecNNCorr;    ///< nuclear medium correction for NN xsec?
+  string fINukeMode;     ///< INTRANUKE mode (eg hN2018)
+
+  bool   fIsValid;       ///< could the table be built?
+  double fRMax;          ///< tabulated radial range [0,fRMax] (fm)
+  double fSqrtKEMax;     ///< tabulated sqrt(KE) range [0,fSqrtKEMax] (sqrt(MeV))
+  double fKEMinTable;    ///< direct calculation below this KE (MeV)
+  double fDR;            ///< r node spacing
+  double fDSqrtKE;       ///< sqrt(KE) node spacing
+  vector<float> fLogRho; ///< log(nuclear density) at the nodes [ir*nke+ik]
+  vector<float> fSigTot; ///< total xsec (fm^2) at the nodes [ir*nke+ik]
+  vector<char>  fCellOk; ///< cell validated? [ir*(nke-1)+ik]
+  mutable vector<double> fMaxRate; ///< interaction rate majorant per (KE bin, shell) [ik*nshells+is] (<0: not computed yet)
+};
+
+}      // genie namespace
+
+#endif // _INUKE_MFP_TABLE_H_
@@ -24,6 +24,17 @@ potential in (e,e'p).  GENIE code was adapted from NuWro implementation.
    lookup tables in probe KE and nuclear density (rho) stored in text files
    for He4, C12, Ca40, Fe56, Sn120, and U238.  Use values from the text
    files for KE and rho, interpolation in A.
+ @ Oct 14, 2026 - CA
+   Cache the interpolated corrections in getAvgCorrection(): they only
+   depend on the (KE,rho) table cell and A, and a TGraph was built and
+   deleted for every call (ie for every nucleon step).
+ @ Oct 14, 2026 - CA
+   Added an optional full table of AvgCorrection() values for protons and
+   neutrons as a function of (KE, rho, Z/A), which fully determine the
+   correction. It is used by getAvgCorrection(rho,A,Z,pdg,KE), with linear
+   interpolation, if useFullTable() was called. The table is computed once
+   (optionally in several worker processes, reproducibly) and then read
+   from a cache directory or from the shipped nncorr data.
 */
 //____________________________________________________________________________
 #include "Physics/HadronTransport/INukeNucleonCorr.h"
@@ -43,8 +54,16 @@ using namespace genie;
 #include <iostream>
 #include <cmath>
 #include <cstdlib>
+#include <map>
+#include <cstdio>
+
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
 
 #include <TGraph.h>
+#include <TMath.h>
+#include <TSystem.h>
 using namespace std;
 
 
@@ -73,6 +92,60 @@ const double INukeNucleonCorr::fBeta1   = -116.00 / fRho0 / 1000.0;          //
 const double INukeNucleonCorr::fLambda0 =    3.29 / (units::fermi);          // converted to GeV
 const double INukeNucleonCorr::fLambda1 =  -0.373 / (units::fermi) / fRho0;  // converted to GeV
 
+// ----- FULL TABLE BINNING ----- //
+
+// KE nodes as in the shipped tables (1/5/25 MeV steps below 0.1/0.5/1 GeV),
+// rho nodes in 0.01 fm^-3 steps, Z/A nodes covering the stable nuclei
+static const int      kTabNKE    = 201;
+static const int      kTabNRho   = 17;
+static const double   kTabDRho   = 0.01;
+static const int      kTabNZA    = 5;
+static const double   kTabZAMin  = 0.35;
+static const double   kTabDZA    = 0.05;
+static const int      kTabNPdg   = 2;      // protons, neutrons
+static const int      kTabA      = 1000;   // A, Z only enter via Z/A
+static const long int kTabSeed   = 1;      // table is independent of the job seed
+static const int      kTabNCells = kTabNPdg * kTabNZA * kTabNKE * kTabNRho;
+
+static double tableKE (const int ike)
+{
+  if (ike <= 100) return 0.001 * ike;
+  if (ike <= 180) return 0.1 + 0.005 * (ike - 100);
+  return 0.5 + 0.025 * (ike - 180);
+}
+
+static double tableKEIndex (const double ke)
+{
+  if (ke <= 0.1) return ke / 0.001;
+  if (ke <= 0.5) return 100 + (ke - 0.1) / 0.005;
+  return 180 + (ke - 0.5) / 0.025;
+}
+
+static int tableCell (const int ipdg, const int iza, const int ike, const int irho)
+{
+  return ((ipdg * kTabNZA + iza) * kTabNKE + ike) * kTabNRho + irho;
+}
+
+//! split x in [0,n-1] into a node index and the fraction towards the next node
+static void tableBin (double x, const int n, int & i, double & f)
+{
+  x = TMath::Min(TMath::Max(x, 0.), n - 1.);
+  i = TMath::Min((int) x, n - 2);
+  f = x - i;
+}
+
+INukeNucleonCorr::INukeNucleonCorr () :
+fFermiMomProton  (0.),
+fFermiMomNeutron (0.),
+fUseFullTable    (false),
+fTableWorkers    (1)
+{
+  const char * cache_dir = std::getenv("GNNCORRCACHE");
+  const char * nworkers  = std::getenv("GNNCORRWORKERS");
+  if (cache_dir) fTableCacheDir = cache_dir;
+  if (nworkers)  fTableWorkers  = TMath::Max(1, atoi(nworkers));
+}
+
 
 
 // ----- CALCULATIONS ----- //
@@ -82,8 +155,8 @@ double INukeNucleonCorr::mstar (const double rho, const double k2)
 {
   // density [fm^-3], momentum square [GeV^2]
 
-  static const double m = (PDGLibrary::Instance()->Find(kPdgProton)->Mass() +
-                           PDGLibrary::Instance()->Find(kPdgNeutron)->Mass()) / 2.0;
+  static const double m = (PDGLibrary::Instance()->Mass(kPdgProton) +
+                           PDGLibrary::Instance()->Mass(kPdgNeutron)) / 2.0;
 
   const double L = lambda (rho); // potential coefficient lambda
   const double B =   beta (rho); // potential coefficient beta
@@ -149,7 +222,7 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
 
   setFermiLevel (rho, A, Z); // set Fermi momenta for protons and neutrons
 
-  const double mass   = PDGLibrary::Instance()->Find(pdg)->Mass(); // mass of incoming nucleon
+  const double mass   = PDGLibrary::Instance()->Mass(pdg); // mass of incoming nucleon
   const double energy = Ek + mass;
 
   TLorentzVector p (0.0, 0.0, sqrt (energy * energy - mass * mass), energy); // incoming particle 4-momentum
@@ -163,7 +236,7 @@ double INukeNucleonCorr :: AvgCorrection (const double rho, const int A, const i
     // get proton vs neutron randomly based on Z/A
     const int targetPdg = rnd->RndGen().Rndm() < (double) Z / A ? kPdgProton : kPdgNeutron;
 
-    const double targetMass = PDGLibrary::Instance()->Find(targetPdg)->Mass(); // set nucleon mass
+    const double targetMass = PDGLibrary::Instance()->Mass(targetPdg); // set nucleon mass
 
     const TLorentzVector target = generateTargetNucleon (targetMass, fermiMomentum (targetPdg)); // generate target nucl
 
@@ -250,6 +323,18 @@ double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
   // return a value. Else, interpolate the needed correction table//
 //  static double cache[NRows][NColumns] = {{-1}};
   static bool ReadFile = false;
+
+  // The interpolated correction only depends on (Row, Column, A)
+  static const double kNotCached = -999.;
+  static map<double, vector<double> > cache;
+  double * cached = 0;
+  if( ReadFile == true && Row >= 0 && Row < NRows && Column >= 0 ) {
+   vector<double> & cacheA = cache[A];
+   if(cacheA.empty()) cacheA.assign(NRows*NColumns, kNotCached);
+   cached = &cacheA[Row*NColumns+Column];
+   if(*cached != kNotCached) return *cached;
+  }
+
   if( ReadFile == true ) {
    int Npoints = 6;
    TGraph * Interp = new TGraph(Npoints);
@@ -267,6 +352,7 @@ double INukeNucleonCorr :: getAvgCorrection(double rho, double A, double ke)
 	//	  << "e,r,value= " << e << "   " << r << "   " << Interpolated[e][r];
    double returnval = Interp->Eval(A);
    delete Interp;
+   if(cached) *cached = returnval;
    LOG("INukeNucleonCorr",pINFO)
       << "Nucleon Corr interpolated correction factor = "
       << returnval  //cache[Row][Column]
@@ -380,3 +466,240 @@ void  INukeNucleonCorr :: OutputFiles(int A, int Z)
   }
   outfile.close();
 }
+
+//! correction for a nucleon in a nucleus with given A, Z: from the full table if enabled
+double INukeNucleonCorr :: getAvgCorrection (const double rho, const double A, const double Z, const int pdg, const double Ek)
+{
+  if (!fUseFullTable or A <= 0) return getAvgCorrection (rho, A, Ek);
+
+  if (fTable.empty() and !buildTable())
+  {
+    LOG("INukeNucleonCorr",pWARN)
+      << "No full correction table - Using the A-interpolated tables";
+    fUseFullTable = false;
+    return getAvgCorrection (rho, A, Ek);
+  }
+
+  const int ipdg = (pdg == kPdgProton) ? 0 : 1;
+
+  int    ike, irho, iza;
+  double fke, frho, fza;
+  tableBin (tableKEIndex (Ek),            kTabNKE,  ike,  fke);
+  tableBin (rho / kTabDRho,               kTabNRho, irho, frho);
+  tableBin ((Z / A - kTabZAMin) / kTabDZA, kTabNZA,  iza,  fza);
+
+  // trilinear interpolation
+  double corr = 0.0;
+  for (int jza = 0; jza < 2; jza++)
+    for (int jke = 0; jke < 2; jke++)
+      for (int jrho = 0; jrho < 2; jrho++)
+      {
+        const double w = (jza  ? fza  : 1.0 - fza) *
+                         (jke  ? fke  : 1.0 - fke) *
+                         (jrho ? frho : 1.0 - frho);
+        if (w > 0.0) corr += w * fTable[tableCell (ipdg, iza + jza, ike + jke, irho + jrho)];
+      }
+
+  return corr;
+}
+
+//! load the full table from the cache or the shipped data, computing (and caching) it if needed
+bool INukeNucleonCorr :: buildTable ()
+{
+  const string filename = tableFileName ();
+
+  if (!fTableCacheDir.empty() and loadTable (fTableCacheDir + "/" + filename)) return true;
+  if (loadTable (dir + filename)) return true;
+
+  LOG("INukeNucleonCorr",pNOTICE)
+    << "Computing the full nucleon correction table (" << kTabNCells
+    << " cells, " << fRepeat << " samples each)";
+
+  fTable.assign (kTabNCells, 0.0);
+
+  if (fTableWorkers < 2 or !fillTableInWorkers (&fTable[0]))
+  {
+    // keep the random number streams of the job unchanged
+    RandomGen * rnd = RandomGen::Instance();
+    TRandom3 gen = rnd->RndGen();
+    TRandom3 fsi = rnd->RndFsi();
+    fillTable (&fTable[0], 0, 1);
+    rnd->RndGen() = gen;
+    rnd->RndFsi() = fsi;
+  }
+
+  // the KE = 0 nodes are undefined (0/0): use the 1 MeV values, as the
+  // nearest-cell lookup in the shipped tables does
+  for (int ipdg = 0; ipdg < kTabNPdg; ipdg++)
+    for (int iza = 0; iza < kTabNZA; iza++)
+      for (int irho = 0; irho < kTabNRho; irho++)
+        fTable[tableCell (ipdg, iza, 0, irho)] = fTable[tableCell (ipdg, iza, 1, irho)];
+
+  for (int i = 0; i < kTabNCells; i++)
+  {
+    if (!TMath::Finite (fTable[i]))
+    {
+      LOG("INukeNucleonCorr",pWARN) << "Undefined full table correction in cell " << i;
+      fTable.clear();
+      return false;
+    }
+  }
+
+  if (!fTableCacheDir.empty()) saveTable (fTableCacheDir + "/" + filename);
+
+  return true;
+}
+
+//! compute the full table cells first, first+stride, ..., each with its own random seed
+void INukeNucleonCorr :: fillTable (double * table, const int first, const int stride)
+{
+  RandomGen * rnd = RandomGen::Instance();
+
+  for (int i = first; i < kTabNCells; i += stride)
+  {
+    const int irho =  i % kTabNRho;
+    const int ike  = (i / kTabNRho) % kTabNKE;
+    const int iza  = (i / (kTabNRho * kTabNKE)) % kTabNZA;
+    const int ipdg =  i / (kTabNRho * kTabNKE * kTabNZA);
+
+    // seeded by cell: independent of the job and of the number of workers
+    rnd->RndGen().SetSeed (RandomGen::StreamSeed (kTabSeed, kRndStrGen, i));
+    rnd->RndFsi().SetSeed (RandomGen::StreamSeed (kTabSeed, kRndStrFsi, i));
+
+    const int pdg = (ipdg == 0) ? kPdgProton : kPdgNeutron;
+    const int Z   = TMath::Nint ((kTabZAMin + iza * kTabDZA) * kTabA);
+
+    table[i] = AvgCorrection (irho * kTabDRho, kTabA, Z, pdg, tableKE (ike));
+  }
+}
+
+//! compute the full table in fTableWorkers forked processes, sharing the table memory
+bool INukeNucleonCorr :: fillTableInWorkers (double * table)
+{
+  const int nworkers = fTableWorkers;
+
+  size_t nbytes = kTabNCells * sizeof(double);
+  double * shared = (double *) mmap (0, nbytes, PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if ((void *) shared == MAP_FAILED)
+  {
+    LOG("INukeNucleonCorr",pWARN) << "Couldn't allocate shared memory for table workers";
+    return false;
+  }
+
+  vector<pid_t> wpids;
+  for (int iw = 0; iw < nworkers; iw++)
+  {
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+      LOG("INukeNucleonCorr",pWARN) << "Couldn't fork table worker " << iw;
+      break;
+    }
+    if (pid == 0)
+    {
+      fillTable (shared, iw, nworkers);
+      _exit(0);
+    }
+    wpids.push_back(pid);
+  }
+
+  bool ok = ((int) wpids.size() == nworkers);
+  for (unsigned int iw = 0; iw < wpids.size(); iw++)
+  {
+    int status = 0;
+    waitpid (wpids[iw], &status, 0);
+    if (!WIFEXITED(status) or WEXITSTATUS(status) != 0)
+    {
+      LOG("INukeNucleonCorr",pWARN) << "Table worker " << iw << " failed";
+      ok = false;
+    }
+  }
+  if (ok)
+  {
+    for (int i = 0; i < kTabNCells; i++) table[i] = shared[i];
+    LOG("INukeNucleonCorr",pNOTICE)
+      << "Computed the full correction table with " << nworkers << " workers";
+  }
+  munmap ((void *) shared, nbytes);
+  return ok;
+}
+
+//! full table file name, built from a hash of everything the table depends on
+string INukeNucleonCorr :: tableFileName () const
+{
+  ostringstream cfg;
+  cfg << setprecision(12)
+      << "ke:" << kTabNKE << " " << tableKE(100) << " " << tableKE(180) << " " << tableKE(kTabNKE-1)
+      << " rho:" << kTabNRho << " " << kTabDRho
+      << " za:" << kTabNZA << " " << kTabZAMin << " " << kTabDZA << " A:" << kTabA
+      << " n:" << fRepeat << " seed:" << kTabSeed
+      << " pot:" << fRho0 << " " << fBeta1 << " " << fLambda0 << " " << fLambda1;
+
+  // 64-bit FNV-1a hash of the configuration string
+  const string cfgstr = cfg.str();
+  unsigned long long hash = 14695981039346656037ULL;
+  for (unsigned int i = 0; i < cfgstr.size(); i++)
+  {
+    hash ^= (unsigned char) cfgstr[i];
+    hash *= 1099511628211ULL;
+  }
+
+  ostringstream filename;
+  filename << "NNCorrectionTable_" << hex << setfill('0') << setw(16) << hash << ".txt";
+  return filename.str();
+}
+
+//! read the full table (one value per line, after the # comments)
+bool INukeNucleonCorr :: loadTable (const string & filename)
+{
+  ifstream in (filename.c_str());
+  if (!in.good()) return false;
+
+  vector<double> table;
+  table.reserve (kTabNCells);
+  string token;
+  while (in >> token)
+  {
+    if (token[0] == '#') {getline (in, token); continue;}
+    table.push_back (atof (token.c_str()));
+  }
+
+  if ((int) table.size() != kTabNCells)
+  {
+    LOG("INukeNucleonCorr",pWARN) << "Could not read the full correction table from " << filename;
+    return false;
+  }
+
+  fTable = table;
+  LOG("INukeNucleonCorr",pNOTICE) << "Read the full correction table from " << filename;
+  return true;
+}
+
+//! store the full table - written under a temporary name and renamed, so
+//! that jobs sharing the cache never read a partially written file
+void INukeNucleonCorr :: saveTable (const string & filename) const
+{
+  if (gSystem->AccessPathName (fTableCacheDir.c_str()))
+    gSystem->mkdir (fTableCacheDir.c_str(), true);
+
+  ostringstream tmpname;
+  tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+  ofstream out (tmpname.str().c_str());
+  out << "## AvgCorrection() for protons and neutrons, in [pdg][Z/A][KE][rho] order\n"
+      << "## KE nodes: 1/5/25 MeV steps below 0.1/0.5/1 GeV (" << kTabNKE << ")\n"
+      << "## rho nodes: 0 - " << (kTabNRho-1) * kTabDRho << " fm^-3 (" << kTabNRho << ")\n"
+      << "## Z/A nodes: " << kTabZAMin << " - " << kTabZAMin + (kTabNZA-1) * kTabDZA
+      << " (" << kTabNZA << ")\n";
+  out << setprecision(8);
+  for (int i = 0; i < kTabNCells; i++) out << fTable[i] << "\n";
+  out.close();
+
+  if (out.fail() or rename (tmpname.str().c_str(), filename.c_str()) != 0)
+  {
+    LOG("INukeNucleonCorr",pWARN) << "Could not store the full correction table in " << filename;
+    remove (tmpname.str().c_str());
+    return;
+  }
+  LOG("INukeNucleonCorr",pNOTICE) << "Stored the full correction table in " << filename;
+}
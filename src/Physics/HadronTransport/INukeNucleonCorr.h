@@ -11,6 +11,8 @@
 #define INUKE_NUCLEON_CORR_H
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <TGenPhaseSpace.h>
 #include "Framework/ParticleData/PDGCodes.h"
@@ -25,9 +27,23 @@ class INukeNucleonCorr
     //! get the correction for given four-momentum and density
     //    double getAvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek);
     double getAvgCorrection (const double rho, const double A, const double Ek);
+    //! get the correction for given nucleon, nucleus, density and kinetic energy
+    //! (from the full table if enabled, otherwise as above)
+    double getAvgCorrection (const double rho, const double A, const double Z, const int pdg, const double Ek);
     void OutputFiles(int A, int Z);
     double AvgCorrection (const double rho, const int A, const int Z, const int pdg, const double Ek);
 
+    // ----- FULL CORRECTION TABLE ----- //
+
+    //! use the full (KE, rho, Z/A) table of AvgCorrection() values for both nucleons?
+    void useFullTable (const bool use) {fUseFullTable = use;}
+    //! directory where the full table is cached (default: $GNNCORRCACHE)
+    void setTableCacheDir (const std::string & dir) {fTableCacheDir = dir;}
+    //! # of worker processes computing the full table (default: $GNNCORRWORKERS or 1)
+    void setTableWorkers (const int nworkers) {fTableWorkers = nworkers;}
+    //! load the full table from the cache or shipped files, or compute it
+    bool buildTable ();
+
   private:
   
     static INukeNucleonCorr *fInstance; //!< single instance of INukeNucleonCorr
@@ -72,10 +88,17 @@ class INukeNucleonCorr
     
     double fFermiMomProton;  // local Fermi momentum for protons
     double fFermiMomNeutron; // local Fermi momentum for neutrons
+
+    // ----- FULL TABLE ----- //
+
+    bool                fUseFullTable;  // use the full table?
+    std::string         fTableCacheDir; // full table cache directory
+    int                 fTableWorkers;  // # of worker processes computing the full table
+    std::vector<double> fTable;         // [pdg][Z/A][KE][rho] AvgCorrection() values
     
     // ----- SINGLETON "BLOCKADES"----- //
         
-    INukeNucleonCorr () {}                                 //!< private constructor (called only by getInstance())
+    INukeNucleonCorr ();                                   //!< private constructor (called only by getInstance())
     INukeNucleonCorr (const INukeNucleonCorr&);            //!< block copy constructor
     INukeNucleonCorr& operator= (const INukeNucleonCorr&); //!< block assignment operator
 
@@ -102,6 +125,12 @@ class INukeNucleonCorr
     double getCorrection (const double mass, const double rho,
                           const TVector3 &k1, const TVector3 &k2,
                           const TVector3 &k3, const TVector3 &k4); //!< calculate xsec correction
+
+    void fillTable (double * table, const int first, const int stride); //!< compute full table cells
+    bool fillTableInWorkers (double * table);                          //!< ... in fTableWorkers processes
+    std::string tableFileName () const;                                 //!< full table file name
+    bool loadTable (const std::string & filename);                      //!< read the full table
+    void saveTable (const std::string & filename) const;                //!< cache the full table
 };
 
 #endif // INUKE_NUCLEON_CORR_H
@@ -53,12 +53,12 @@ void INukeOsetFormula :: setKinematics (const double &pionTk, const bool &isPi0)
 {
   if (isPi0)
   {
-    fPionMass  = PDGLibrary::Instance()->Find(kPdgPi0)->Mass() * 1000.0; // [MeV]
+    fPionMass  = PDGLibrary::Instance()->Mass(kPdgPi0) * 1000.0; // [MeV]
     fPionMass2 = fPionMass * fPionMass;
   }
   else
   {
-    fPionMass  = PDGLibrary::Instance()->Find(kPdgPiP)->Mass() * 1000.0; // [MeV]
+    fPionMass  = PDGLibrary::Instance()->Mass(kPdgPiP) * 1000.0; // [MeV]
     fPionMass2 = fPionMass * fPionMass;
   }
 
@@ -63,15 +63,15 @@ int INukeOsetTable :: processLine (const std::string &line)
     double xsecQel, xsecCex;
     splitLine >> xsecQel >> xsecCex;
     // save them in proper vector
-    fQelCrossSectionTable[i].push_back (xsecQel);
-    fCexCrossSectionTable[i].push_back (xsecCex);
+    fCrossSectionTables[qelIndex (i)].push_back (xsecQel);
+    fCrossSectionTables[cexIndex (i)].push_back (xsecCex);
   } // channel loop
 
   // get absorption cross section
   double absorption;
   splitLine >> absorption;
   // save it in proper vector
-  fAbsorptionCrossSectionTable.push_back (absorption);
+  fCrossSectionTables[absIndex ()].push_back (absorption);
 
   return 0; // no errors
 }
@@ -156,7 +156,10 @@ void INukeOsetTable :: badFile (const char* file, const int &errorCode, const in
 }
 
 //! make bilinear interpolation between four points around (density, energy)
-double INukeOsetTable :: interpolate (const std::vector<double> &data) const
+/*! indices and weights of the four points are computed once
+ *  and applied to all cross section tables
+ */
+void INukeOsetTable :: interpolate (double *result) const
 {
   // take four points adjacent to (density, energy) = (d,E):
   // (d0, E0), (d1, E0), (d0, E1), (d1, E1)
@@ -165,40 +168,43 @@ double INukeOsetTable :: interpolate (const std::vector<double> &data) const
 
   // total bin width for normalization
   static const double totalBinWidth = fDensityBinWidth * fEnergyBinWidth;
-  
-  // extract low boundary value from table
-  double lowValue = data[fEnergyHandler.index +
-                         fDensityHandler.index * fNEnergyBins]; // (d0, E0)
+
+  // low boundary index
+  const unsigned int lowIndex = fEnergyHandler.index +
+                                fDensityHandler.index * fNEnergyBins; // (d0, E0)
   // high boundaries = low boundary if on edge
-  double highDensityValue = lowValue; // (d1, E0)
-  double highEnergyValue  = lowValue; // (d0, E1)
-  double highValue        = lowValue; // (d1, E1)
+  unsigned int highDensityIndex = lowIndex; // (d1, E0)
+  unsigned int highEnergyIndex  = lowIndex; // (d0, E1)
+  unsigned int highIndex        = lowIndex; // (d1, E1)
 
-  // extract high boundaries values from table (if not on edge)
+  // high boundaries indices (if not on edge)
   if (not fDensityHandler.isEdge)
   {
-    highDensityValue = data[fEnergyHandler.index +
-                            (fDensityHandler.index + 1) * fNEnergyBins];
+    highDensityIndex = lowIndex + fNEnergyBins;
 
     if (not fEnergyHandler.isEdge)
     {
-      highEnergyValue = data[fEnergyHandler.index + 1 +
-                             fDensityHandler.index * fNEnergyBins];
-      highValue       = data[fEnergyHandler.index + 1 +
-                             (fDensityHandler.index + 1) * fNEnergyBins];
+      highEnergyIndex = lowIndex + 1;
+      highIndex       = lowIndex + 1 + fNEnergyBins;
     }
   }
   else if (not fEnergyHandler.isEdge)
-    highEnergyValue = data[fEnergyHandler.index + 1 +
-                           fDensityHandler.index * fNEnergyBins];
+    highEnergyIndex = lowIndex + 1;
 
-  lowValue         *= fDensityHandler.lowWeight  * fEnergyHandler.lowWeight;
-  highDensityValue *= fDensityHandler.highWeight * fEnergyHandler.lowWeight;
-  highEnergyValue  *= fDensityHandler.lowWeight  * fEnergyHandler.highWeight;
-  highValue        *= fDensityHandler.highWeight * fEnergyHandler.highWeight;
-  
-  return (lowValue + highDensityValue + highEnergyValue + highValue) /
-          totalBinWidth;
+  const double lowWeight         = fDensityHandler.lowWeight  * fEnergyHandler.lowWeight;
+  const double highDensityWeight = fDensityHandler.highWeight * fEnergyHandler.lowWeight;
+  const double highEnergyWeight  = fDensityHandler.lowWeight  * fEnergyHandler.highWeight;
+  const double highWeight        = fDensityHandler.highWeight * fEnergyHandler.highWeight;
+
+  for (unsigned int i = 0; i < fNTables; i++) // cross section loop
+  {
+    const double *data = &fCrossSectionTables[i][0];
+
+    result[i] = (data[lowIndex]         * lowWeight         +
+                 data[highDensityIndex] * highDensityWeight +
+                 data[highEnergyIndex]  * highEnergyWeight  +
+                 data[highIndex]        * highWeight) / totalBinWidth;
+  }
 }
 
 //! set up table index and weights for given point
@@ -229,24 +235,28 @@ void INukeOsetTable :: PointHandler :: update (const double &newValue)
 void INukeOsetTable :: setupOset (const double &density, const double &pionTk, const int &pionPDG,
                                   const double &protonFraction)
 {
-  fNuclearDensity    = density;
-  fPionKineticEnergy = pionTk;
-  fDensityHandler.update (fNuclearDensity);    // update density index / weights
-  fEnergyHandler.update  (fPionKineticEnergy); // update energy index / weights
+  // skip interpolation if density and pion Tk did not change since last call
+  if (not (density == fDensityHandler.value and pionTk == fEnergyHandler.value))
+  {
+    fNuclearDensity    = density;
+    fPionKineticEnergy = pionTk;
+    fDensityHandler.update (fNuclearDensity);    // update density index / weights
+    fEnergyHandler.update  (fPionKineticEnergy); // update energy index / weights
+    interpolate (fInterpolated);
+  }
   setCrossSections();
   INukeOset::setCrossSections (pionPDG, protonFraction);  
 }
 
-/*! assign cross sections values to proper variables
- * using bilinear interpolation
+/*! assign interpolated cross sections values to proper variables
  */ 
 void INukeOsetTable :: setCrossSections ()
 {
     for (unsigned int i = 0; i < fNChannels; i++) // channel loop
     {
-      fQelCrossSections[i] = interpolate (fQelCrossSectionTable[i]);
-      fCexCrossSections[i] = interpolate (fCexCrossSectionTable[i]);
+      fQelCrossSections[i] = fInterpolated[qelIndex (i)];
+      fCexCrossSections[i] = fInterpolated[cexIndex (i)];
     }
 
-    fAbsorptionCrossSection = interpolate (fAbsorptionCrossSectionTable); 
+    fAbsorptionCrossSection = fInterpolated[absIndex ()]; 
 }
@@ -33,34 +33,33 @@ class INukeOsetTable : public INukeOset
   void setupOset (const double &density, const double &pionTk, const int &pionPDG, const double &protonFraction);
 
   private:
-  
-  //! quasi-elastic piN cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
-   * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
-   */
-  std::vector <double> fQelCrossSectionTable [fNChannels]; 
-  
-  //! charge-exchange piN cross section
-  /*! vector contains values in the following order:
+
+  //! number of tabulated cross sections: qel and cex for each channel + absorption
+  static const unsigned int fNTables = 2 * fNChannels + 1;
+
+  //! index of qel / cex cross section of given channel and of absorption in fCrossSectionTables
+  static unsigned int qelIndex (const unsigned int &channel) {return channel;}
+  static unsigned int cexIndex (const unsigned int &channel) {return fNChannels + channel;}
+  static unsigned int absIndex () {return 2 * fNChannels;}
+
+  //! tabulated cross sections (one vector per cross section, sharing the same grid)
+  /*! each vector contains values in the following order:
    * d0 e0, d0 e1, ... , d0 en, d1 e0 ... \n
-   * channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0
+   * qel and cex for channel = 0 -> pi+n or pi-p, 1 -> pi+p or pi-n, 2 -> pi0,
+   * then pi absorption
    */
-  std::vector <double> fCexCrossSectionTable [fNChannels];
-  
-  //! pi absorption cross section
-  /*! vector contains values in the following order:
-   * d0 e0, d0 e1, ... , d0 en, d1 e0 ...
-   */
-  std::vector <double> fAbsorptionCrossSectionTable;
+  std::vector <double> fCrossSectionTables [fNTables];
+
+  //! interpolated cross sections at last (density, energy)
+  double fInterpolated [fNTables];
 
   unsigned int fNDensityBins; //!< number of denisty bins
   unsigned int fNEnergyBins;  //!< number of energy bins
   double fDensityBinWidth;    //!< density step (must be fixed)
   double fEnergyBinWidth;     //!< energy step (must be fixed)
 
-  //! interpolate cross section (method fixed for Oset tables)
-  double interpolate (const std::vector<double> &data) const;
+  //! interpolate all cross sections at once (bins and weights are shared; method fixed for Oset tables)
+  void interpolate (double *result) const;
 
   //! process single line from table file, push values to proper vector (method fixed for Oset tables)
   int processLine (const std::string &line);
@@ -107,6 +107,10 @@ namespace intranuke
     GHepRecord* ev, GHepParticle* p, const PDGCodeList & pdgv, TLorentzVector &RemnP4,
     double NucRmvE, EINukeMode mode=kIMdHA);
 
+  //! hA fate of a hadron-nucleus event (eg generated by gevgen_hadron),
+  //! determined from its final state particles
+  INukeFateHA_t FindhAFate (const GHepRecord * evrec);
+
 }      // intranuke namespace
 }      // utils     namespace
 }      // genie     namespace
@@ -34,6 +34,25 @@
  @ Jan 9, 2015 - SD, NG, TG
    Added 2014 version of INTRANUKE codes for v2.9.0.  Uses INukeHadroData2014,
    but no changes to mean free path.
+ @ Oct 14, 2026 - CA
+   Split MeanFreePath() into MeanFreePathInputs() (nuclear density and
+   total hadron+nucleon xsec) and MeanFreePathFromXSec() (medium correction
+   and mean free path), so that the inputs can be tabulated (INukeMFPTable).
+ @ Oct 14, 2026 - CA
+   MeanFreePathFromXSec() takes the nucleus Z, passed to INukeNucleonCorr
+   for its full correction table.
+ @ Oct 14, 2026 - CA
+   PhaseSpaceDecay() takes the max decay weight from PhaseSpaceWeightCache,
+   shared with the KNO hadronization, rather than re-estimating it from 200
+   trial decays at each call.
+ @ Oct 14, 2026 - CA
+   StepParticle() counts the steps in the cost of the current event
+   (GHepEventCost).
+ @ Oct 14, 2026 - CA
+   Added PauliAllowedCosRange(). ThreeBodyKinematics() rejects Pauli
+   blocked particle 3 angles before building the rest of the final state.
+   TwoBodyKinematics() builds the CM frame axes from dot and cross products
+   instead of angles, buffer copies and vector rotations.
 */
 //____________________________________________________________________________
 
@@ -47,6 +66,7 @@
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/EventGen/EVGThreadException.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
 #include "Physics/HadronTransport/INukeException.h"
@@ -63,6 +83,7 @@
 #include "Framework/Registry/Registry.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/PhaseSpaceWeightCache.h"
 #include "Physics/HadronTransport/INukeOset.h"
 #include "Physics/HadronTransport/INukeOsetTable.h"
 #include "Physics/HadronTransport/INukeOsetFormula.h"
@@ -88,13 +109,35 @@ double genie::utils::intranuke2018::MeanFreePath(
 //  A    : Nucleus atomic mass number
 //  nRpi : Controls the pion ring size in terms of de-Broglie wavelengths
 //  nRnuc: Controls the nuclepn ring size in terms of de-Broglie wavelengths
+//
+  double rho    = 0;
+  double sigtot = 0;
+  bool ok = MeanFreePathInputs(pdgc, x4, p4, A, Z, nRpi, nRnuc,
+                               useOset, altOset, INukeMode, rho, sigtot);
+  if(!ok) return 0.;
+
+  return MeanFreePathFromXSec(pdgc, p4, A, Z, rho, sigtot, xsecNNCorr);
+}
+//____________________________________________________________________________
+bool genie::utils::intranuke2018::MeanFreePathInputs(
+   int pdgc, const TLorentzVector & x4, const TLorentzVector & p4,
+   double A, double Z, double nRpi, double nRnuc, const bool useOset, const bool altOset, string INukeMode,
+   double & rho, double & sigtot)
+{
+// Nuclear density (in fm^-3) at the hadron position and total hadron+nucleon
+// cross section (in fm^2, before the nuclear medium correction), entering
+// the mean free path calculation. Returns false if no mean free path can be
+// computed for this hadron.
 //
   bool is_pion    = pdgc == kPdgPiP || pdgc == kPdgPi0 || pdgc == kPdgPiM;
   bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
   bool is_kaon    = pdgc == kPdgKP;
   bool is_gamma   = pdgc == kPdgGamma;
 
-  if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return 0.;
+  rho    = 0;
+  sigtot = 0;
+
+  if(!is_pion && !is_nucleon && !is_kaon && !is_gamma) return false;
 
   // before getting the nuclear density at the current position
   // check whether the nucleus has to become larger by const times the
@@ -129,7 +172,7 @@ double genie::utils::intranuke2018::MeanFreePath(
 
   // get the nuclear density at the current position
   double rnow = x4.Vect().Mag();
-  double rho  = A * utils::nuclear::Density(rnow,(int) A,ring);
+  rho = A * utils::nuclear::Density(rnow,(int) A,ring);
 
   // the hadron+nucleon cross section will be evaluated within the range
   // of the input spline and assumed to be const outside that range
@@ -140,7 +183,7 @@ double genie::utils::intranuke2018::MeanFreePath(
 
   // get total xsection for the incident hadron at its current
   // kinetic energy
-  double sigtot = 0;
+  sigtot = 0;
   double ppcnt = (double) Z/ (double) A; // % of protons remaining
   INukeHadroData2018 * fHadroData2018 = INukeHadroData2018::Instance();
 
@@ -199,19 +242,32 @@ double genie::utils::intranuke2018::MeanFreePath(
     { sigtot = fHadroData2018 -> XSecGamp_fs()  -> Evaluate(ke)*ppcnt;
       sigtot+= fHadroData2018 -> XSecGamn_fs()  -> Evaluate(ke)*(1-ppcnt);}
   else {
-     return 0;
+     return false;
   }
 
   // the xsection splines in INukeHadroData return the hadron x-section in
   // mb -> convert to fm^2
   sigtot *= (units::mb / units::fm2);
 
+  return true;
+}
+//____________________________________________________________________________
+double genie::utils::intranuke2018::MeanFreePathFromXSec(
+   int pdgc, const TLorentzVector & p4, double A, double Z,
+   double rho, double sigtot, const bool xsecNNCorr)
+{
+// Mean free path (in fm) from the nuclear density (fm^-3) and total
+// hadron+nucleon cross section (fm^2) returned by MeanFreePathInputs(),
+// applying the nuclear medium correction to the NN cross section
+//
+  bool is_nucleon = pdgc == kPdgProton || pdgc == kPdgNeutron;
+
   // avoid defective error handling
   //if(sigtot<1E-6){sigtot=1E-6;}
 
   if (xsecNNCorr and is_nucleon)
     sigtot *= INukeNucleonCorr::getInstance()->
-      getAvgCorrection (rho, A, p4.E() - PDGLibrary::Instance()->Find(pdgc)->Mass());   //uses lookup tables
+      getAvgCorrection (rho, A, Z, pdgc, p4.E() - PDGLibrary::Instance()->Mass(pdgc));   //uses lookup tables
 
   // avoid defective error handling
   if(sigtot<1E-6){sigtot=1E-6;}
@@ -419,6 +475,8 @@ void genie::utils::intranuke2018::StepParticle(
       << "Stepping particle [" << p->Name() << "] by dr = " << step << " fm";
 #endif
 
+  RunningThreadInfo::Instance()->EventCost().inuke_steps++;
+
   // Step particle
   TVector3 dr = p->P4()->Vect().Unit();      // unit vector along its direction
   dr.SetMag(step);                           // spatial step size
@@ -600,12 +658,10 @@ void genie::utils::intranuke2018::PreEquilibrium(
   // change particle status for decaying particle - take out as test
   //ev->Particle(f_loc)->SetStatus(kIStIntermediateState);
   // decay a clone particle
-  GHepParticle * t = new GHepParticle(*(ev->Particle(f_loc)));
-  t->SetFirstMother(f_loc);
+  GHepParticle t(*(ev->Particle(f_loc)));
+  t.SetFirstMother(f_loc);
   //next statement was in Alex Bell's original code - PreEq, then Equilibrium using particle with highest energy.  Note it gets IST=kIStIntermediateState.
-  //genie::utils::intranuke2018::Equilibrium(ev,t,RemnA,RemnZ,RemnP4,DoFermi,FermiFac,Nuclmodel,NucRmvE,mode);
-
-  delete t;
+  //genie::utils::intranuke2018::Equilibrium(ev,&t,RemnA,RemnZ,RemnP4,DoFermi,FermiFac,Nuclmodel,NucRmvE,mode);
 }
 //___________________________________________________________________________
 // Method to handle Equilibrium reaction
@@ -711,29 +767,20 @@ bool genie::utils::intranuke2018::TwoBodyCollision(
 
   // Kinematic variables
 
-  double M1, /* M2, */ M3, M4; // rest energies, in GeV
+  double M1, M3, M4; // rest energies, in GeV
   double E3L, P3L, E4L, P4L;
-  TVector3 tP1L, tPtot, tbeta, tbetadir, tTrans, tVect;
-  TVector3 tP1zCM, tP2zCM, tP3L, tP4L;
 
   // Library instance for reference
   PDGLibrary * pLib = PDGLibrary::Instance();
 
-  // random number generator
-  //RandomGen * rnd = RandomGen::Instance();
-
-  // handle fermi target
-  Target target(ev->TargetNucleus()->Pdg());
-
   // get mass for particles
-  M1 = pLib->Find(pcode)->Mass();
-  // usused // M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(scode)->Mass();
-  M4 = pLib->Find(s2code)->Mass();
+  M1 = pLib->Mass(pcode);
+  M3 = pLib->Mass(scode);
+  M4 = pLib->Mass(s2code);
 
   // get lab energy and momenta and assign to 4 vectors
-  TLorentzVector t4P1L = *p->P4();
-  TLorentzVector t4P2L = *t->P4();
+  const TLorentzVector & t4P1L = *p->P4();
+  const TLorentzVector & t4P2L = *t->P4();
 
   // binding energy
   double bindE = 0.025; // empirical choice, might need to be improved
@@ -862,21 +909,18 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   // Gives outgoing 4-momenta of particles 3 and 4 (t4P3L, t4P4L respectively)
   //
   // All 4-momenta should be on mass shell
+  //
+  // The CM frame axes are built from dot and cross products of the input
+  // momenta, rather than from angles and rotations
 
   double E1L, E2L, P1L, P2L, E3L, P3L;
   double beta, gm; // speed and gamma for CM frame in Lab
   double S3CM; // sin of scattering angle
   double PHI3;
-  double E1CM, E2CM, E3CM, P3CM;//, E4CM, P4CM;
-  double P3zL, P3tL;//, P4zL, P4tL;
+  double E1CM, E2CM, E3CM, P3CM;
+  double P3zL, P3tL;
   double Et;
-  double theta1, theta2, theta5, P1zL, P2zL, P1tL, P2tL;
-  TVector3 tbeta, tbetadir, tTrans, tVect;
-  TVector3 tP1zCM, tP2zCM, vP3L;
-  TLorentzVector t4P1buf, t4P2buf, t4Ptot;
-
-  // Library instance for reference
-  //PDGLibrary * pLib = PDGLibrary::Instance();
+  double P1zL, P2zL, P1tL, P2tL;
 
   // random number generator
   RandomGen * rnd = RandomGen::Instance();
@@ -887,19 +931,14 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   // calculate sine from scattering angle
   S3CM = TMath::Sqrt(1.0 - C3CM*C3CM);
 
-  // fill buffers
-  t4P1buf = t4P1L;
-  t4P2buf = t4P2L;
-
   // get lab energy and momenta
-  E1L = t4P1buf.E();
-  P1L = t4P1buf.P();
-  E2L = t4P2buf.E();
-  P2L = t4P2buf.P();
-  t4Ptot = t4P1buf + t4P2buf;
+  E1L = t4P1L.E();
+  P1L = t4P1L.P();
+  E2L = t4P2L.E();
+  P2L = t4P2L.P();
+  TVector3 tPtot = t4P1L.Vect() + t4P2L.Vect();
 
   LOG("INukeUtils",pINFO) <<"M1   "<<t4P1L.M()<<  ", M2    "<<t4P2L.M();
-  LOG("INukeUtils",pINFO) <<"E1L  "<<E1L<< ", E1CM  "<<E1CM;
   LOG("INukeUtils",pINFO) <<"bindE = " << bindE;
 
   // binding energy
@@ -919,36 +958,34 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
     }
 
   // calculate beta and gamma
-  tbeta = t4Ptot.Vect() * (1.0 / (E1L + E2L));
-  tbetadir = tbeta.Unit();
-  beta = tbeta.Mag();
+  double Ptot = tPtot.Mag();
+  beta = Ptot / (E1L + E2L);
   gm = 1.0 / TMath::Sqrt(1.0 - beta*beta);
-
-  // get angle and component info
-  theta1 = t4P1buf.Angle(tbeta);
-  theta2 = t4P2buf.Angle(tbeta);
-  P1zL = P1L*TMath::Cos(theta1);
-  P2zL = P2L*TMath::Cos(theta2);
-  P1tL = TMath::Sqrt(P1L*P1L - P1zL*P1zL);
-  P2tL = -TMath::Sqrt(P2L*P2L - P2zL*P2zL);
-  tVect.SetXYZ(1,0,0);
-  if(TMath::Abs((tVect - tbetadir).Mag())<.01) tVect.SetXYZ(0,1,0);
-  theta5 = tVect.Angle(tbetadir);
-  tTrans = (tVect - TMath::Cos(theta5)*tbetadir).Unit();
-
-  // boost to CM frame to get scattered particle momenta
+  TVector3 tbetadir = (Ptot > 0) ? tPtot * (1.0 / Ptot) : TVector3(0,0,1);
+
+  // get component info
+  P1zL = t4P1L.Vect().Dot(tbetadir);
+  P2zL = t4P2L.Vect().Dot(tbetadir);
+  P1tL = TMath::Sqrt(TMath::Max(0., P1L*P1L - P1zL*P1zL));
+  P2tL = -TMath::Sqrt(TMath::Max(0., P2L*P2L - P2zL*P2zL));
+
+  // transverse axes
+  TVector3 tTrans(1,0,0);
+  if((tTrans - tbetadir).Mag2() < 1E-4) tTrans.SetXYZ(0,1,0);
+  tTrans -= tTrans.Dot(tbetadir) * tbetadir;
+  tTrans *= 1.0 / tTrans.Mag();
+  TVector3 tTrans2 = tbetadir.Cross(tTrans);
+
+  // boost to CM frame to get scattered particle energies
   E1CM = gm*E1L - gm*beta*P1zL;
-  tP1zCM = gm*P1zL*tbetadir - gm*tbeta*E1L;
   E2CM = gm*E2L - gm*beta*P2zL;
-  tP2zCM = gm*P2zL*tbetadir - gm*tbeta*E2L;
   Et = E1CM + E2CM;
 //-------
 
-  LOG("INukeUtils",pINFO) <<"M1   "<<t4P1L.M()<<  ", M2    "<<t4P2L.M();
   LOG("INukeUtils",pINFO) <<"E1L  "<<E1L<< ", E1CM  "<<E1CM;
-  LOG("INukeUtils",pINFO) <<"P1zL "<<P1zL<<", P1zCM "<<tP1zCM.Mag()<<", P1tL "<<P1tL;
+  LOG("INukeUtils",pINFO) <<"P1zL "<<P1zL<<", P1tL "<<P1tL;
   LOG("INukeUtils",pINFO) <<"E2L  "<<E2L<< ", E2CM  "<<E2CM;
-  LOG("INukeUtils",pINFO) <<"P2zL "<<P2zL<<", P2zCM "<<tP2zCM.Mag()<<", P2tL "<<P2tL;
+  LOG("INukeUtils",pINFO) <<"P2zL "<<P2zL<<", P2tL "<<P2tL;
   LOG("INukeUtils",pINFO) <<"C3CM "<<C3CM;
 
 //-------
@@ -990,12 +1027,9 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   LOG("INukeUtils",pINFO) <<"P4zL  "<<P4zL<<", P4tL "<<P4tL;
   LOG("INukeUtils",pINFO) <<"P4L   "<<P4L;
   LOG("INukeUtils",pINFO) <<"C4L   "<<P4zL/P4L;
-
-  double echeck = E1L + E2L - (E3L + E4L);
-  double pzcheck = P1zL+ P2zL - (P3zL + P4zL);
-  double ptcheck = P1tL+ P2tL - (P3tL + P4tL);
-
-  LOG("INukeUtils",pINFO) <<"Check 4-momentum conservation -  Energy  "<<echeck<<", z momentum "<<pzcheck << ",    transverse momentum  " << ptcheck ;
+  LOG("INukeUtils",pINFO) <<"Check 4-momentum conservation -  Energy  "
+    << E1L + E2L - (E3L + E4L) <<", z momentum " << P1zL+ P2zL - (P3zL + P4zL)
+    << ",    transverse momentum  " << P1tL+ P2tL - (P3tL + P4tL);
 
   // -------
 
@@ -1014,19 +1048,18 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   // get random phi angle, distributed uniformally in 360 deg
   PHI3 = 2 * kPi * rnd->RndFsi().Rndm();
 
-  vP3L = P3zL*tbetadir + P3tL*tTrans;
-  vP3L.Rotate(PHI3,tbetadir);
+  double P3t1L = P3tL * TMath::Cos(PHI3);
+  double P3t2L = P3tL * TMath::Sin(PHI3);
+  t4P3L.SetPxPyPzE(
+    P3zL*tbetadir.X() + P3t1L*tTrans.X() + P3t2L*tTrans2.X(),
+    P3zL*tbetadir.Y() + P3t1L*tTrans.Y() + P3t2L*tTrans2.Y(),
+    P3zL*tbetadir.Z() + P3t1L*tTrans.Z() + P3t2L*tTrans2.Z(), E3L);
 
-  t4P3L.SetVect(vP3L);
-  t4P3L.SetE(E3L);
-
-  t4P4L = t4P1buf + t4P2buf - t4P3L;
-  t4P4L-= TLorentzVector(0,0,0,bindE);
-  /*LOG("INukeUtils",pINFO) <<"GENIE:";
-  LOG("INukeUtils",pINFO) <<"E4L   "<<t4P4L.E();
-  LOG("INukeUtils",pINFO) <<"P4zL  "<<t4P4L.Vect()*tbetadir<<", P4tL "<<-1.*TMath::Sqrt(t4P4L.Vect().Mag2()-TMath::Power(t4P4L.Vect()*tbetadir,2.));
-  LOG("INukeUtils",pINFO) <<"P4L   "<<t4P4L.Vect().Mag();
-  LOG("INukeUtils",pINFO) <<"C4L   "<<t4P4L.Vect()*tbetadir/t4P4L.Vect().Mag();  */
+  t4P4L.SetPxPyPzE(
+    t4P1L.Px() + t4P2L.Px() - t4P3L.Px(),
+    t4P1L.Py() + t4P2L.Py() - t4P3L.Py(),
+    t4P1L.Pz() + t4P2L.Pz() - t4P3L.Pz(),
+    t4P1L.E()  + t4P2L.E()  - t4P3L.E() - bindE);
 
   if(t4P4L.Mag2()<0 || t4P4L.E()<0)
   {
@@ -1040,6 +1073,47 @@ bool genie::utils::intranuke2018::TwoBodyKinematics(
   return true;
 }
 //___________________________________________________________________________
+bool genie::utils::intranuke2018::PauliAllowedCosRange(
+  double beta, double E3CM, double E4CM, double P3CM, double kF3, double kF4,
+  double & cmin, double & cmax)
+{
+  // The lab momentum of particle 3, scattered at CM angle cosine c in a CM
+  // frame moving with velocity beta, is
+  //   P3L^2(c) = gm^2 (beta*E3CM + P3CM*c)^2 + P3CM^2 (1-c^2)
+  // a parabola in c with its minimum at c = -E3CM/(beta*P3CM) < -1, so P3L
+  // increases with c over [-1,1]: particle 3 is allowed above the root of
+  // P3L(c) = kF3. Particle 4 goes the opposite way (c -> -c, E3CM -> E4CM).
+  // A comparison fails for non-finite inputs, so these are blocked.
+
+  cmin = -1.;
+  cmax =  1.;
+
+  double gm2 = 1.0 / (1.0 - beta*beta);
+  for(int i = 0; i < 2; i++) {
+    double E  = (i==0) ? E3CM : E4CM;
+    double kF = (i==0) ? kF3  : kF4;
+    if(kF <= 0) continue;
+
+    double a = P3CM*P3CM * gm2*beta*beta;
+    double b = 2. * gm2*beta*E*P3CM;
+    double d = gm2*beta*beta*E*E + P3CM*P3CM - kF*kF;
+
+    // lab momentum^2 - kF^2, backward and forward
+    double pmin2 = a - b + d;
+    double pmax2 = a + b + d;
+    if(!(pmax2 >= 0)) return false;
+
+    double c = -1.;
+    if(pmin2 < 0) {
+      double q = TMath::Sqrt(TMath::Max(0., b*b - 4*a*d));
+      c = TMath::Min(1., 2*d / (-b - q)); // larger root, without cancellation
+    }
+    if(i==0) cmin = TMath::Max(cmin,  c);
+    else     cmax = TMath::Min(cmax, -c);
+  }
+  return (cmin <= cmax);
+}
+//___________________________________________________________________________
 bool genie::utils::intranuke2018::ThreeBodyKinematics(
   GHepRecord* ev, GHepParticle* p, int tcode, GHepParticle* s1, GHepParticle* s2, GHepParticle* s3,
   bool DoFermi, double FermiFac, double FermiMomentum, const NuclearModelI* Nuclmodel)
@@ -1074,18 +1148,17 @@ bool genie::utils::intranuke2018::ThreeBodyKinematics(
   // random number generator
   RandomGen * rnd = RandomGen::Instance();
 
-  M1 = pLib->Find(p->Pdg())->Mass();
-  M2 = pLib->Find(tcode)->Mass();
-  M3 = pLib->Find(s1->Pdg())->Mass();
-  M4 = pLib->Find(s2->Pdg())->Mass();
-  M5 = pLib->Find(s3->Pdg())->Mass();
-
-  // set up fermi target
-  Target target(ev->TargetNucleus()->Pdg());
+  M1 = pLib->Mass(p->Pdg());
+  M2 = pLib->Mass(tcode);
+  M3 = pLib->Mass(s1->Pdg());
+  M4 = pLib->Mass(s2->Pdg());
+  M5 = pLib->Mass(s3->Pdg());
 
   // handle fermi momentum
   if(DoFermi)
     {
+      // set up fermi target
+      Target target(ev->TargetNucleus()->Pdg());
       target.SetHitNucPdg(tcode);
       Nuclmodel->GenerateNucleon(target);
       tP2L = FermiFac * Nuclmodel->Momentum3();
@@ -1141,7 +1214,22 @@ bool genie::utils::intranuke2018::ThreeBodyKinematics(
   }
   P3CM = TMath::Sqrt(E3CM*E3CM - M3*M3);
 
+  // pauli blocking of particle 3, before the rest of the kinematics:
+  // it is blocked below a CM angle cosine fixed by the CM frame
+  double C3min = -1., C3max = 1.;
+  bool pauli_allowed = utils::intranuke2018::PauliAllowedCosRange(
+     beta, E3CM, EiCM, P3CM, FermiMomentum, 0., C3min, C3max);
+
   theta3 =   kPi * rnd->RndFsi().Rndm();
+  if(!pauli_allowed || TMath::Cos(theta3) < C3min)
+  {
+    LOG("INukeUtils",pNOTICE)
+      << "PionProduction fails because of Pauli blocking - retry kinematics";
+    exceptions::INukeException exception;
+    exception.SetReason("PionProduction final state not determined");
+    throw exception;
+    return false;
+  }
   theta4 =   kPi * rnd->RndFsi().Rndm();
   phi3   = 2*kPi * rnd->RndFsi().Rndm();
   phi4   = 2*kPi * rnd->RndFsi().Rndm();
@@ -1669,7 +1757,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   double   mass_sum = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m  = PDGLibrary::Instance()->Mass(pdgc);
     string nm = PDGLibrary::Instance()->Find(pdgc)->GetName();
     mass[i++] = m;
     mass_sum += m;
@@ -1725,12 +1813,9 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
   p->SetStatus(kIStNucleonClusterTarget);  //kIStDecayedState);
   p->SetPdgCode(kPdgCompNuclCluster);
   ev->AddParticle(*p);
-  // Get the maximum weight
-  double wmax = -1;
-  for(int k=0; k<200; k++) {
-     double w = GenPhaseSpace.Generate();
-     wmax = TMath::Max(wmax,w);
-  }
+  // Get the maximum weight (cached per decay product list & W bin)
+  PhaseSpaceWeightCache * wcache = PhaseSpaceWeightCache::Instance();
+  double wmax = wcache->MaxWeight(GenPhaseSpace, *pd, pdgv);
   assert(wmax>0);
 
   LOG("INukeUtils", pINFO)
@@ -1764,6 +1849,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
     if(w > wmax) {
        LOG("INukeUtils", pNOTICE)
            << "Decay weight = " << w << " > max decay weight = " << wmax;
+       wcache->RaiseMaxWeight(*pd, pdgv, w);
     }
 
     LOG("INukeUtils", pNOTICE) << "Decay weight = " << w << " / R = " << gw;
@@ -1801,7 +1887,7 @@ bool genie::utils::intranuke2018::PhaseSpaceDecay(
      //   not going at a simulated f/s particle at a "hadronic blob"
      //   representing the remnant system: do the binding energy subtraction
      //   here & update the remnant hadronic system 4p
-     double M  = PDGLibrary::Instance()->Find(pdgc)->Mass();
+     double M  = PDGLibrary::Instance()->Mass(pdgc);
      double En = p4fin->Energy();
 
      double KE = En-M;
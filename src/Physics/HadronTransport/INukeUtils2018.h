@@ -53,6 +53,17 @@ namespace intranuke2018
   double MeanFreePath(
     int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
     double Z, double nRpi=0.5, double nRnuc=1.0, const bool useOset = false, const bool altOset = false, const bool xsecNNCorr = false, string INukeMode = "XX2018");
+
+  //! Nuclear density & total hadron+nucleon xsec entering the mean free path
+  bool MeanFreePathInputs(
+    int pdgc, const TLorentzVector & x4, const TLorentzVector & p4, double A,
+    double Z, double nRpi, double nRnuc, const bool useOset, const bool altOset, string INukeMode,
+    double & rho, double & sigtot);
+
+  //! Mean free path from the nuclear density & total xsec given by MeanFreePathInputs()
+  double MeanFreePathFromXSec(
+    int pdgc, const TLorentzVector & p4, double A, double Z,
+    double rho, double sigtot, const bool xsecNNCorr = false);
  
   //! Mean free path (Delta++ **test**)
   double MeanFreePath_Delta(
@@ -83,6 +94,14 @@ namespace intranuke2018
     double M3, double M4, TLorentzVector tP1L, TLorentzVector tP2L, 
     TLorentzVector &tP3L, TLorentzVector &tP4L, double C3CM, TLorentzVector &RemnP4, double bindE=0);
 
+  //! Range [cmin,cmax] of the CM scattering angle cosine of particle 3 in a
+  //! two body final state for which neither particle is Pauli blocked (lab
+  //! momentum below kF3, kF4; 0 for no blocking). The CM frame moves with
+  //! velocity beta in the lab. False if every angle is blocked
+  bool PauliAllowedCosRange(
+    double beta, double E3CM, double E4CM, double P3CM, double kF3, double kF4,
+    double & cmin, double & cmax);
+
   bool ThreeBodyKinematics(
     GHepRecord* ev, GHepParticle* p, int tcode, GHepParticle* s1, GHepParticle* s2, GHepParticle* s3,
     bool DoFermi=false, double FermiFac=0, double FermiMomentum=0, const NuclearModelI* Nuclmodel=(const NuclearModelI*)0);
@@ -48,6 +48,9 @@
    start of the event processing and is used throughout. fInTestMode flag and
    special INTRANUKE configs not needed. ProcessEventRecord() was added by 
    factoring out code from HNIntranuke and HAIntranuke. Some comments added.
+ @ Oct 14, 2026 - CA
+   The daughter lists of the entries added by the hadron transport are
+   resolved once it is over (see GHepRecord::DeferDaughterLists()).
 
 */
 //____________________________________________________________________________
@@ -145,7 +148,11 @@ void Intranuke::ProcessEventRecord(GHepRecord * evrec) const
   // Stepping part is common for both HA and HN.
   // Once it has been estabished that an interaction takes place then
   // HA and HN specific code takes over in order to simulate the final state.
+  // The daughter lists of the cascade entries are resolved once at the end.
+  bool deferred = evrec->DaughterListsDeferred();
+  evrec->DeferDaughterLists(true);
   this->TransportHadrons(evrec);
+  evrec->DeferDaughterLists(deferred);
 }
 //___________________________________________________________________________
 void Intranuke::GenerateVertex(GHepRecord * evrec) const
@@ -52,6 +52,36 @@
    New 2014 class for latest Intranuke model
  @ Apr 26, 2018 - SD 
    Change year 2015 to 2018
+ @ Oct 14, 2026 - CA
+   The hadron mean free path is interpolated from per-(remnant nucleus,
+   hadron) tables (INukeMFPTable), built at first use, unless the
+   INUKE-UseMFPTables config param is false. The INTRANUKE mode strings are
+   resolved once at configuration rather than at every step.
+ @ Oct 14, 2026 - CA
+   Added TrackToNextInteraction(), moving hadrons to their next interaction
+   point with delta (Woodcock) tracking against the interaction rate
+   majorants of the mean free path tables, unless INUKE-DeltaTracking is
+   false (the fixed fHadStep stepping is kept as fallback).
+ @ Oct 14, 2026 - CA
+   The INUKE-NNCorrFullTable config param (default: false) switches the NN
+   xsec medium correction to the full INukeNucleonCorr table.
+ @ Oct 14, 2026 - CA
+   TransportHadrons() loops over the GHEP entries by index and steps each
+   hadron as a single reused stack clone, instead of a heap-allocated
+   GHepParticle per entry.
+ @ Oct 14, 2026 - CA
+   Delta tracking uses interaction rate majorants per radial shell. Hadrons
+   crossing the nucleus without any tentative interaction point are moved
+   to the tracking boundary after a single draw.
+ @ Oct 14, 2026 - CA
+   The daughter lists of the entries added by the hadron transport are
+   resolved once it is over (see GHepRecord::DeferDaughterLists()).
+ @ Oct 14, 2026 - CA
+   Count the hadron interactions that were rejected and simulated again
+   (NRetries(), and the inuke_retries event cost counter).
+ @ Oct 14, 2026 - CA
+   The INUKE-AngularAccRej config param (default: false) has the hN
+   scattering angles sampled by accept/reject instead of tabulated CDFs.
 
 */
 //____________________________________________________________________________
@@ -66,6 +96,8 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Framework/GHEP/GHepStatus.h"
 #include "Framework/GHEP/GHepRecord.h"
 #include "Framework/GHEP/GHepParticle.h"
@@ -73,6 +105,8 @@
 #include "Physics/HadronTransport/INukeHadroData2018.h"
 #include "Physics/HadronTransport/INukeHadroFates.h"
 #include "Physics/HadronTransport/INukeMode.h"
+#include "Physics/HadronTransport/INukeMFPTable.h"
+#include "Physics/HadronTransport/INukeNucleonCorr.h"
 #include "Physics/HadronTransport/INukeUtils2018.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
@@ -94,26 +128,29 @@ using namespace genie::controls;
 
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018() :
-EventRecordVisitorI()
+EventRecordVisitorI(),
+fNRetries(0)
 {
 
 }
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018(string name) :
-EventRecordVisitorI(name)
+EventRecordVisitorI(name),
+fNRetries(0)
 {
 
 }
 //___________________________________________________________________________
 Intranuke2018::Intranuke2018(string name, string config) :
-EventRecordVisitorI(name, config)
+EventRecordVisitorI(name, config),
+fNRetries(0)
 {
 
 }
 //___________________________________________________________________________
 Intranuke2018::~Intranuke2018()
 {
-
+  this->ClearMFPTables();
 }
 //___________________________________________________________________________
 void Intranuke2018::ProcessEventRecord(GHepRecord * evrec) const
@@ -150,7 +187,11 @@ void Intranuke2018::ProcessEventRecord(GHepRecord * evrec) const
   // Stepping part is common for both HA and HN.
   // Once it has been estabished that an interaction takes place then
   // HA and HN specific code takes over in order to simulate the final state.
+  // The daughter lists of the cascade entries are resolved once at the end.
+  bool deferred = evrec->DaughterListsDeferred();
+  evrec->DeferDaughterLists(true);
   this->TransportHadrons(evrec);
+  evrec->DeferDaughterLists(deferred);
 }
 //___________________________________________________________________________
 void Intranuke2018::GenerateVertex(GHepRecord * evrec) const
@@ -299,14 +340,15 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
   const TLorentzVector & p4nucl = *(nucl->P4());
   fRemnP4 = p4nucl; 
 
-  // Loop over GHEP and run intranuclear rescattering on handled particles
-  TObjArrayIter piter(evrec);
-  GHepParticle * p = 0;
-  int icurr = -1;
+  // Loop over GHEP and run intranuclear rescattering on handled particles.
+  // The loop also visits the entries added while rescattering, in order.
+  // Hadrons are stepped as a clone held on the stack and reused for all
+  // entries, so the cascade allocates nothing besides the GHEP slots.
+  GHepParticle sp;
 
-  while( (p = (GHepParticle *) piter.Next()) )
+  for(int icurr = 0; icurr < evrec->GetEntries(); icurr++)
   {
-    icurr++;
+    GHepParticle * p = evrec->Particle(icurr);
 
     // Check whether the particle needs rescattering, otherwise skip it
     if( ! this->NeedsRescattering(p) ) continue;
@@ -316,62 +358,50 @@ void Intranuke2018::TransportHadrons(GHepRecord * evrec) const
                         << " with kinetic E = " << p->KinE() << " GeV";
 
     // Rescatter a clone, not the original particle
-    GHepParticle * sp = new GHepParticle(*p); 
+    sp.Copy(*p);
 
     // Set clone's mom to be the hadron that was cloned
-    sp->SetFirstMother(icurr); 
+    sp.SetFirstMother(icurr); 
 
     // Check whether the particle can be rescattered 
-    if(!this->CanRescatter(sp)) {
+    if(!this->CanRescatter(&sp)) {
 
        // if I can't rescatter it, I will just take it out of the nucleus
        LOG("Intranuke2018", pNOTICE)
-              << "... Current version can't rescatter a " << sp->Name();
-       sp->SetFirstMother(icurr); 
-       sp->SetStatus(kIStStableFinalState);
-       evrec->AddParticle(*sp);
-       delete sp;
+              << "... Current version can't rescatter a " << sp.Name();
+       sp.SetFirstMother(icurr); 
+       sp.SetStatus(kIStStableFinalState);
+       evrec->AddParticle(sp);
        continue; // <-- skip to next GHEP entry
     }
 
     // Start stepping particle out of the nucleus
-    bool has_interacted = false;
-    while ( this-> IsInNucleus(sp) ) 
-    {
-      // advance the hadron by a step
-      utils::intranuke2018::StepParticle(sp, fHadStep);
-
-      // check whether it interacts
-      double d = this->GenerateStep(evrec,sp);
-      has_interacted = (d<fHadStep);
-      if(has_interacted) break;
-    }//stepping
+    bool has_interacted = this->TrackToNextInteraction(evrec,&sp);
 
     //updating the position of the original particle with the position of the clone
-    evrec->Particle(sp->FirstMother())->SetPosition(*(sp->X4()));
+    evrec->Particle(sp.FirstMother())->SetPosition(*(sp.X4()));
  
     if(has_interacted && fRemnA>0)  {
         // the particle interacts - simulate the hadronic interaction
       LOG("Intranuke2018", pNOTICE) 
           << "Particle has interacted at location:  " 
-          << sp->X4()->Vect().Mag() << " / nucl rad= " << fTrackingRadius;
-	this->SimulateHadronicFinalState(evrec,sp);
+          << sp.X4()->Vect().Mag() << " / nucl rad= " << fTrackingRadius;
+	this->SimulateHadronicFinalState(evrec,&sp);
     } else if(has_interacted && fRemnA<=0) {
         // nothing left to interact with!
       LOG("Intranuke2018", pNOTICE)
           << "*** Nothing left to interact with, escaping.";
-	sp->SetStatus(kIStStableFinalState);
-	evrec->AddParticle(*sp);
-	evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
+	sp.SetStatus(kIStStableFinalState);
+	evrec->AddParticle(sp);
+	evrec->Particle(sp.FirstMother())->SetRescatterCode(1);
     } else {
         // the exits the nucleus without interacting - Done with it! 
         LOG("Intranuke2018", pNOTICE) 
           << "*** Hadron escaped the nucleus! Done with it.";
-	sp->SetStatus(kIStStableFinalState);
-	evrec->AddParticle(*sp);
-	evrec->Particle(sp->FirstMother())->SetRescatterCode(1);
+	sp.SetStatus(kIStStableFinalState);
+	evrec->AddParticle(sp);
+	evrec->Particle(sp.FirstMother())->SetRescatterCode(1);
     }
-    delete sp;
 
     // Current snapshot
     //LOG("Intranuke2018", pINFO) << "Current event record snapshot: " << *evrec;
@@ -399,7 +429,138 @@ double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) cons
 // Computes the mean free path L and generate an 'interaction' distance d 
 // from an exp(-d/L) distribution
 
-  int pdgc = p->Pdg();
+  RandomGen * rnd = RandomGen::Instance();
+
+  double L = this->MeanFreePath(p);
+
+  if(fScaleMFP) L *= this->MFPScale(p->Pdg());
+
+  double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
+
+  /*    LOG("Intranuke2018", pDEBUG)
+    << "mode= " << fINukeMode << "; Mean free path = " << L << " fm / "
+                              << "Generated path length = " << d << " fm";
+  */
+  return d;
+}
+//___________________________________________________________________________
+bool Intranuke2018::TrackToNextInteraction(GHepRecord* ev, GHepParticle* p) const
+{
+// Move particle p to its next interaction point, along its direction.
+// Returns false if the particle leaves the nucleus without interacting.
+//
+// With delta (Woodcock) tracking, tentative interaction points are thrown
+// from the majorant of the interaction rate (in radial shells, at the
+// particle's energy) and accepted with probability rate/majorant: only one
+// mean free path evaluation per tentative point is needed, instead of one
+// per fHadStep step. A single draw of the majorant optical depth decides
+// whether the particle reaches the tracking boundary without any tentative
+// point, in which case it is moved there directly. Falls back to fixed
+// steps if no majorant is available.
+
+  const double * rates = 0;
+  int    nshells = 0;
+  double width   = 0;
+  if(fDeltaTracking && this->MaxInteractionRates(p, rates, nshells, width)) {
+
+    RandomGen * rnd = RandomGen::Instance();
+    double scale  = fScaleMFP ? this->MFPScale(p->Pdg()) : 1.;
+    double rbound = fTrackingRadius + fHadStep;
+
+    TVector3 u3 = p->P4()->Vect().Unit();
+    int    is  = TMath::Min((int) (p->X4()->Vect().Mag() / width), nshells-1);
+    double tau = -1. * TMath::Log(rnd->RndFsi().Rndm());
+
+    while ( this-> IsInNucleus(p) ) {
+      // distance to the boundary of the current shell / tracking region
+      TVector3 x3 = p->X4()->Vect();
+      double xu   = x3.Dot(u3);
+      double r2   = x3.Mag2();
+      double rout = TMath::Min((is+1) * width, rbound);
+      double dseg = -xu + TMath::Sqrt(TMath::Max(0., xu*xu - r2 + rout*rout));
+      int    next = (rout < rbound) ? is+1 : -1;
+      if(is > 0 && xu < 0.) {
+        double rin  = is * width;
+        double disc = xu*xu - r2 + rin*rin;
+        if(disc > 0.) {
+          dseg = TMath::Max(0., -xu - TMath::Sqrt(disc));
+          next = is-1;
+        }
+      }
+
+      // no tentative point in this segment: move on to the next one
+      double rate_max = rates[is] / scale;
+      if(rate_max * dseg <= tau) {
+        tau -= rate_max * dseg;
+        utils::intranuke2018::StepParticle(p, dseg);
+        if(next < 0) return false;
+        is = next;
+        continue;
+      }
+      utils::intranuke2018::StepParticle(p, tau / rate_max);
+
+      double L = this->MeanFreePath(p) * scale;
+      if(L <= 0.) return true; // as for fixed steps: d <= 0 interacts
+
+      double rate = 1./L;
+      if(rate > rate_max) {
+        LOG("Intranuke2018", pWARN)
+          << "Interaction rate majorant violated for pdg = " << p->Pdg()
+          << " at r = " << p->X4()->Vect().Mag() << " fm: "
+          << rate << " > " << rate_max;
+      }
+      if(rate_max * rnd->RndFsi().Rndm() < rate) return true;
+
+      tau = -1. * TMath::Log(rnd->RndFsi().Rndm());
+    }
+    return false;
+  }
+
+  // fixed steps
+  while ( this-> IsInNucleus(p) ) 
+  {
+    // advance the hadron by a step
+    utils::intranuke2018::StepParticle(p, fHadStep);
+
+    // check whether it interacts
+    double d = this->GenerateStep(ev,p);
+    if(d<fHadStep) return true;
+  }//stepping
+
+  return false;
+}
+//___________________________________________________________________________
+bool Intranuke2018::MaxInteractionRates(
+  const GHepParticle* p, const double * & rates, int & nshells,
+  double & width) const
+{
+// Majorants (in 1/fm, before any mean free path scaling) of the interaction
+// rate of p in the nshells radial shells of the given width, from the
+// (remnant nucleus, hadron) mean free path table
+
+  rates   = 0;
+  nshells = 0;
+  width   = 0;
+
+  const INukeMFPTable * table = this->MFPTable(p->Pdg());
+  if(!table) return false;
+
+  // the table (and its majorants) assume on-shell hadrons
+  double M  = p->P4()->M();
+  double ke = (p->P4()->Energy() - M) / units::MeV;
+  if(TMath::Abs(M - p->Mass()) > 1E-6) return false;
+  if(!table->MaxRates(ke, rates)) return false;
+
+  nshells = table->NShells();
+  width   = table->ShellWidth();
+
+  // the shells must cover the tracking region
+  return (nshells * width >= fTrackingRadius + fHadStep);
+}
+//___________________________________________________________________________
+double Intranuke2018::MFPScale(int pdgc) const
+{
+// mean free path tweaking factor for the input hadron
 
   double scale = 1.;
   if (pdgc==kPdgPiP || pdgc==kPdgPiM || pdgc==kPdgPi0) {
@@ -408,36 +569,105 @@ double Intranuke2018::GenerateStep(GHepRecord*  /*evrec*/, GHepParticle* p) cons
   else if (pdgc==kPdgProton || pdgc==kPdgNeutron) {
     scale = fNucleonMFPScale;
   }
+  return scale;
+}
+//___________________________________________________________________________
+INukeMFPTable * Intranuke2018::MFPTable(int pdgc) const
+{
+// The mean free path table for the input hadron in the current remnant
+// nucleus, built at first use
 
-  RandomGen * rnd = RandomGen::Instance();
+  if(!fUseMFPTables || fRemnA <= 0) return 0;
 
-  string fINukeMode = this->GetINukeMode();
-  string fINukeModeGen = this->GetGenINukeMode();
+  long int key = 1000000L * pdgc + 1000L * fRemnA + fRemnZ;
+  std::map<long int, INukeMFPTable *>::const_iterator it = fMFPTables.find(key);
+  if(it != fMFPTables.end()) return it->second;
 
-  double L = utils::intranuke2018::MeanFreePath(p->Pdg(), *p->X4(), *p->P4(), fRemnA,
-						fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr, fINukeMode);
+  double rmax = 1.1 * fNR * fR0 * TMath::Power(fRemnA, 1./3.) + fHadStep;
+  INukeMFPTable * table = new INukeMFPTable(pdgc, fRemnA, fRemnZ, rmax,
+        fDelRPion, fDelRNucleon, fUseOset, fAltOset, fXsecNNCorr,
+        fINukeModeName);
+  fMFPTables[key] = table;
 
-  LOG("Intranuke2018", pDEBUG)    << "mode= " << fINukeModeGen;
-  if(fINukeModeGen == "hA") L *= scale;
+  return table;
+}
+//___________________________________________________________________________
+double Intranuke2018::MeanFreePath(const GHepParticle * p) const
+{
+// Mean free path (in fm) of particle p in the current remnant nucleus,
+// interpolated from the (remnant nucleus, hadron) table whenever possible
 
-  double d = -1.*L * TMath::Log(rnd->RndFsi().Rndm());
+  const INukeMFPTable * table = this->MFPTable(p->Pdg());
+  double L = 0;
+  if(table && table->MeanFreePath(*p->X4(), *p->P4(), L)) return L;
 
-  /*    LOG("Intranuke2018", pDEBUG)
-    << "mode= " << fINukeMode << "; Mean free path = " << L << " fm / "
-                              << "Generated path length = " << d << " fm";
-  */
-  return d;
+  return utils::intranuke2018::MeanFreePath(p->Pdg(), *p->X4(), *p->P4(),
+             fRemnA, fRemnZ, fDelRPion, fDelRNucleon, fUseOset, fAltOset,
+             fXsecNNCorr, fINukeModeName);
+}
+//___________________________________________________________________________
+void Intranuke2018::ResolveModeConfig(void)
+{
+// Settings depending on the INTRANUKE mode, resolved once after the
+// concrete mode has loaded its configuration
+
+  fINukeModeName = this->GetINukeMode();
+  fScaleMFP      = (this->GetGenINukeMode() == "hA");
+
+  GetParamDef( "INUKE-UseMFPTables", fUseMFPTables, true ) ;
+  GetParamDef( "INUKE-DeltaTracking", fDeltaTracking, true ) ;
+  if(fDeltaTracking && !fUseMFPTables) {
+    LOG("Intranuke2018", pWARN)
+      << "Delta tracking needs the mean free path tables - Using fixed steps";
+    fDeltaTracking = false;
+  }
+
+  // NN xsec medium correction from the full (KE, rho, Z/A) table?
+  bool nncorr_full_table = false;
+  GetParamDef( "INUKE-NNCorrFullTable", nncorr_full_table, false ) ;
+  if(fXsecNNCorr) {
+    INukeNucleonCorr::getInstance()->useFullTable(nncorr_full_table);
+  }
+
+  // hN scattering angles by accept/reject rather than from tabulated CDFs?
+  bool ang_acc_rej = false;
+  GetParamDef( "INUKE-AngularAccRej", ang_acc_rej, false ) ;
+  fHadroData2018->UseAngularAccRej(ang_acc_rej);
+
+  // the tables depend on the configuration
+  this->ClearMFPTables();
+
+  LOG("Intranuke2018", pINFO)
+    << "Mode: " << fINukeModeName << ", MFP tables: " << fUseMFPTables
+    << ", delta tracking: " << fDeltaTracking;
+}
+//___________________________________________________________________________
+void Intranuke2018::CountRetry(void) const
+{
+  fNRetries++;
+  RunningThreadInfo::Instance()->EventCost().inuke_retries++;
+}
+//___________________________________________________________________________
+void Intranuke2018::ClearMFPTables(void)
+{
+  std::map<long int, INukeMFPTable *>::iterator it = fMFPTables.begin();
+  for( ; it != fMFPTables.end(); ++it) {
+    delete it->second;
+  }
+  fMFPTables.clear();
 }
 //___________________________________________________________________________
 void Intranuke2018::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
   this->LoadConfig();
+  this->ResolveModeConfig();
 }
 //___________________________________________________________________________
 void Intranuke2018::Configure(string param_set)
 {
   Algorithm::Configure(param_set);
   this->LoadConfig();
+  this->ResolveModeConfig();
 }
 //___________________________________________________________________________
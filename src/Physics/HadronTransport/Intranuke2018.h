@@ -30,6 +30,8 @@
 #ifndef _INTRANUKE_2018_H_
 #define _INTRANUKE_2018_H_
 
+#include <map>
+
 #include <TGenPhaseSpace.h>
 
 #include "Physics/NuclearState/NuclearModelI.h"
@@ -50,6 +52,7 @@ class INukeHadroData2018;
 class PDGCodeList;
 class HNIntranuke2018;
 class HAIntranuke2018;
+class INukeMFPTable;
 
 class Intranuke2018 : public EventRecordVisitorI {
 
@@ -72,6 +75,10 @@ public :
   virtual string GetINukeMode() const {return "XX2018";};
   virtual string GetGenINukeMode() const {return "XX";};
 
+  //! # of simulated hadron interactions that were rejected (Pauli blocking,
+  //! kinematics failures) and simulated again, so far
+  long NRetries (void) const { return fNRetries; }
+
 protected:
 
   // methods for loading configuration
@@ -85,6 +92,15 @@ protected:
   bool   IsInNucleus        (const GHepParticle* p) const;
   void   SetTrackingRadius  (const GHepParticle* p) const;
   double GenerateStep       (GHepRecord* ev, GHepParticle* p) const;
+  bool   TrackToNextInteraction (GHepRecord* ev, GHepParticle* p) const;
+  double MeanFreePath       (const GHepParticle* p) const;
+  bool   MaxInteractionRates(const GHepParticle* p, const double * & rates,
+                             int & nshells, double & width) const;
+  double MFPScale           (int pdgc) const;
+  INukeMFPTable * MFPTable  (int pdgc) const;
+  void   ResolveModeConfig  (void);
+  void   ClearMFPTables     (void);
+  void   CountRetry         (void) const;
 
   // virtual functions for individual modes
   virtual void SimulateHadronicFinalState(GHepRecord* ev, GHepParticle* p) const = 0;
@@ -100,6 +116,7 @@ protected:
   mutable int            fRemnZ;         ///< remnant nucleus Z
   mutable TLorentzVector fRemnP4;        ///< P4 of remnant system
   mutable GEvGenMode_t   fGMode;         ///< event generation mode (lepton+A, hadron+A, ...)
+  mutable long           fNRetries;      ///< # of rejected hadron interactions so far
 
   // configuration parameters
   double       fR0;           ///< effective nuclear size param
@@ -131,6 +148,14 @@ protected:
   double       fNucleonFracAbsScale;
   double       fNucleonFracPiProdScale;
 
+  // settings resolved once at configuration time
+  string       fINukeModeName; ///< INTRANUKE mode, as passed to the mean free path calculation
+  bool         fScaleMFP;      ///< apply the MFP tweaking factors (hA mode)?
+  bool         fUseMFPTables;  ///< interpolate the mean free path from per-(nucleus,hadron) tables?
+  bool         fDeltaTracking; ///< delta (Woodcock) tracking instead of fixed steps?
+
+  mutable std::map<long int, INukeMFPTable *> fMFPTables; ///< mean free path tables, built at first use
+
 };
 
 }      // genie namespace
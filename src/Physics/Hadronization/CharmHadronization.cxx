@@ -38,6 +38,7 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/Hadronization/FragmRecUtils.h"
+#include "Physics/Decay/Pythia6Session.h"
 #include "Framework/Utils/PrintUtils.h"
 
 using namespace genie;
@@ -481,19 +482,12 @@ TClonesArray * CharmHadronization::Hadronize(
      //
      // Run PYTHIA for the hadronization of remnant system
      //
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),              1,0); // don't decay pi0
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1,1); // decay Delta+
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1,1); // decay Delta++
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1,1); // decay Delta++
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1,1); // decay Delta++
-//   fPythia->SetMDCY(fPythia->Pycomp(kPdgDeltaP),  1,1); // decay Delta+
-//   fPythia->SetMDCY(fPythia->Pycomp(kPdgDeltaPP), 1,1); // decay Delta++
+     // don't decay pi0, decay the Deltas
+     Pythia6Session::Instance()->Use(kP6cCharmHadronization);
 
      int ip = 0;
      py2ent_(&ip, &qrkSyst1, &qrkSyst2, &WR); // hadronize
 
-     fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),1,1); // restore
-
      //-- Get PYTHIA's LUJETS event record
      TClonesArray * remnants = 0;
      fPythia->GetPrimaries();
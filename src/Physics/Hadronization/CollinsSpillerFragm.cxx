@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   Sample z from an inverse cumulative distribution table built at
+   configuration, instead of TF1::GetRandom().
 
 */
 //____________________________________________________________________________
@@ -21,13 +24,15 @@ using namespace genie;
 
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm() :
-FragmentationFunctionI("genie::CollinsSpillerFragm")
+FragmentationFunctionI("genie::CollinsSpillerFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 CollinsSpillerFragm::CollinsSpillerFragm(string config) :
-FragmentationFunctionI("genie::CollinsSpillerFragm", config)
+FragmentationFunctionI("genie::CollinsSpillerFragm", config),
+fFunc(0)
 {
 
 }
@@ -47,9 +52,10 @@ double CollinsSpillerFragm::Value(double z) const
 //___________________________________________________________________________
 double CollinsSpillerFragm::GenerateZ(void) const
 {
-// Return a random number using the fragmentation function as PDF
+// Return a random number using the fragmentation function as PDF, from
+// the inverse cumulative distribution tabulated at configuration
 
-  return fFunc->GetRandom();
+  return this->GenerateZFromTable();
 }
 //___________________________________________________________________________
 void CollinsSpillerFragm::Configure(const Registry & config)
@@ -66,6 +72,7 @@ void CollinsSpillerFragm::Configure(string config)
 //___________________________________________________________________________
 void CollinsSpillerFragm::BuildFunction(void)
 {
+  delete fFunc;
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::collins_spiller_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -86,6 +93,8 @@ void CollinsSpillerFragm::BuildFunction(void)
     N = 1./I;
   } 
   fFunc->SetParameters(N,e);
+
+  this->BuildZTable();
 }
 //___________________________________________________________________________
 
@@ -14,10 +14,18 @@
 */
 //____________________________________________________________________________
 
+#include <cassert>
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
 #include "Physics/Hadronization/FragmentationFunctionI.h"
 
 using namespace genie;
 
+static const int kNZBins = 2000; // # of z bins of the inverse CDF table
+
 //___________________________________________________________________________
 FragmentationFunctionI::FragmentationFunctionI() :
 Algorithm()
@@ -42,3 +50,47 @@ FragmentationFunctionI::~FragmentationFunctionI()
 
 }
 //___________________________________________________________________________  
+void FragmentationFunctionI::BuildZTable(void)
+{
+// Integrate the fragmentation function in each z bin (3-point Gauss-Legendre,
+// which never evaluates it at the z = 0, 1 end-points) and store the
+// cumulative distribution at the bin edges
+
+  const double gx[3] = { -TMath::Sqrt(0.6), 0., TMath::Sqrt(0.6) };
+  const double gw[3] = { 5./9., 8./9., 5./9. };
+
+  double dz = 1. / kNZBins;
+
+  fZCdf.assign(kNZBins+1, 0.);
+  for(int i = 0; i < kNZBins; i++) {
+    double zc = (i + 0.5) * dz;
+    double I  = 0;
+    for(int k = 0; k < 3; k++) {
+      I += gw[k] * TMath::Max(0., this->Value(zc + 0.5 * dz * gx[k]));
+    }
+    fZCdf[i+1] = fZCdf[i] + 0.5 * dz * I;
+  }
+  assert(fZCdf[kNZBins] > 0);
+
+  LOG("Fragmentation", pINFO)
+    << "Tabulated the z distribution of " << this->Id().Key()
+    << " in " << kNZBins << " bins (integral = " << fZCdf[kNZBins] << ")";
+}
+//___________________________________________________________________________
+double FragmentationFunctionI::GenerateZFromTable(void) const
+{
+// Invert the tabulated cumulative distribution, interpolating linearly
+// within the z bin
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double u = fZCdf[kNZBins] * rnd->RndHadro().Rndm();
+  int    i = TMath::BinarySearch(kNZBins+1, &fZCdf[0], u);
+  i = TMath::Min(TMath::Max(i, 0), kNZBins-1);
+
+  double dcdf = fZCdf[i+1] - fZCdf[i];
+  double f    = (dcdf > 0.) ? (u - fZCdf[i]) / dcdf : 0.5;
+
+  return (i + f) / kNZBins;
+}
+//___________________________________________________________________________
@@ -6,6 +6,10 @@
 \brief    Pure abstract base class.
           Defines the FragmentationFunctionI interface to be implemented by
           any algorithmic class implementing a fragmentation function.
+          Also provides concrete implementations with a tabulated inverse
+          cumulative distribution of z, to be built from Value() whenever
+          the function is (re)configured, for sampling z with a single
+          uniform draw.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -21,8 +25,12 @@
 #ifndef _FRAGMENTATION_FUNCTION_I_H_
 #define _FRAGMENTATION_FUNCTION_I_H_
 
+#include <vector>
+
 #include "Framework/Algorithm/Algorithm.h"
 
+using std::vector;
+
 namespace genie {
 
 class FragmentationFunctionI : public Algorithm {
@@ -41,6 +49,11 @@ protected:
   FragmentationFunctionI();
   FragmentationFunctionI(string name);
   FragmentationFunctionI(string name, string config);
+
+  void   BuildZTable        (void);       ///< tabulate the cumulative distribution of z
+  double GenerateZFromTable (void) const; ///< sample z from the tabulated distribution
+
+  vector<double> fZCdf; ///< cumulative distribution of z at uniformly spaced z nodes in [0,1]
 };
 
 }      // genie namespace
@@ -84,6 +84,48 @@ void HadronizationModelBase::ApplyRijk(
 //
   if(!mp) return;
 
+  double R2=1., R3=1.;
+  this->RijkFactors(interaction, R2, R3);
+
+  //
+  // Apply to the multiplicity probability distribution
+  //
+
+  int nbins = mp->GetNbinsX();
+  for(int i = 1; i <= nbins; i++) {
+     int n = TMath::Nint( mp->GetBinCenter(i) ); 
+
+     double R=1;
+     if      (n==2) R=R2;
+     else if (n==3) R=R3;
+
+     if(n==2 || n==3) {
+        double P   = mp->GetBinContent(i);
+        double Psc = R*P;
+        LOG("BaseHad", pDEBUG) 
+          << "n=" << n << "/ Scaling factor R = " 
+                              << R << "/ P " << P << " --> " << Psc;
+        mp->SetBinContent(i, Psc);
+     }
+     if(n>3) break;
+  }
+
+  // renormalize the histogram?
+  if(norm) {
+     double histo_norm = mp->Integral("width");
+     if(histo_norm>0) mp->Scale(1.0/histo_norm);
+  }
+}
+//____________________________________________________________________________
+void HadronizationModelBase::RijkFactors(
+       const Interaction * interaction, double & R2, double & R3) const
+{
+// Get the NEUGEN multiplicity probability scaling factors for the
+// multiplicity = 2 and 3 states of the input interaction
+//
+  R2 = 1.;
+  R3 = 1.;
+
   const InitialState & init_state = interaction->InitState();
   int probe_pdg = init_state.ProbePdg();
   int nuc_pdg   = init_state.Tgt().HitNucPdg();
@@ -95,12 +137,6 @@ void HadronizationModelBase::ApplyRijk(
   // EDIT
   bool is_dm = proc_info.IsDarkMatter();
 
-  //
-  // get the R2, R3 factors
-  //
-
-  double R2=1., R3=1.;
-
   // weak CC or NC case
   // EDIT
   if(is_CC || is_NC || is_dm) {
@@ -157,34 +193,5 @@ void HadronizationModelBase::ApplyRijk(
             << "Invalid initial state: " << init_state;
      }
   }//em?
-
-  //
-  // Apply to the multiplicity probability distribution
-  //
-
-  int nbins = mp->GetNbinsX();
-  for(int i = 1; i <= nbins; i++) {
-     int n = TMath::Nint( mp->GetBinCenter(i) ); 
-
-     double R=1;
-     if      (n==2) R=R2;
-     else if (n==3) R=R3;
-
-     if(n==2 || n==3) {
-        double P   = mp->GetBinContent(i);
-        double Psc = R*P;
-        LOG("BaseHad", pDEBUG) 
-          << "n=" << n << "/ Scaling factor R = " 
-                              << R << "/ P " << P << " --> " << Psc;
-        mp->SetBinContent(i, Psc);
-     }
-     if(n>3) break;
-  }
-
-  // renormalize the histogram?
-  if(norm) {
-     double histo_norm = mp->Integral("width");
-     if(histo_norm>0) mp->Scale(1.0/histo_norm);
-  }
 }
 //____________________________________________________________________________
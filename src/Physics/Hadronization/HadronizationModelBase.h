@@ -49,6 +49,7 @@ protected:
   double Wmin               (void) const;
   double MaxMult            (const Interaction * i) const;
   void   ApplyRijk          (const Interaction * i, bool norm, TH1D * mp) const;
+  void   RijkFactors        (const Interaction * i, double & R2, double & R3) const;
   TH1D * CreateMultProbHist (double maxmult) const;
 
   //! configuration data common to all hadronizers
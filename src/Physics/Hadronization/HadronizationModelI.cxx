@@ -10,10 +10,19 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   Added Hadronize(const Interaction *, TClonesArray &), filling a caller-
+   owned (reusable) container of fragmentation products.
 
 */
 //____________________________________________________________________________
 
+#include <RVersion.h>
+#if ROOT_VERSION_CODE >= ROOT_VERSION(5,15,6)
+#include <TMCParticle.h>
+#else
+#include <TMCParticle6.h>
+#endif
 #include <TClonesArray.h>
 #include <TH1D.h>
 
@@ -47,6 +56,22 @@ HadronizationModelI::~HadronizationModelI()
 
 }
 //____________________________________________________________________________
+bool HadronizationModelI::Hadronize(
+            const Interaction * interaction, TClonesArray & plist) const
+{
+  plist.Clear();
 
+  TClonesArray * particle_list = this->Hadronize(interaction);
+  if(!particle_list) return false;
 
+  int np = particle_list->GetEntries();
+  for(int i = 0; i < np; i++) {
+     TMCParticle * particle = (TMCParticle *) (*particle_list)[i];
+     new ( plist[i] ) TMCParticle(*particle);
+  }
+  particle_list->Delete();
+  delete particle_list;
 
+  return true;
+}
+//____________________________________________________________________________
@@ -41,10 +41,16 @@ public:
 
   virtual void           Initialize       (void)                                 const = 0;
   virtual TClonesArray * Hadronize        (const Interaction * )                 const = 0;
+  virtual bool           Hadronize        (const Interaction *, TClonesArray & plist) const;
   virtual double         Weight           (void)                                 const = 0;
   virtual PDGCodeList *  SelectParticles  (const Interaction*)                   const = 0;
   virtual TH1D *         MultiplicityProb (const Interaction*, Option_t* opt="") const = 0;
 
+  //! Note: The 2nd Hadronize() method fills a caller-owned TClonesArray of
+  //! TMCParticles, so that the container can be reused for all events. The
+  //! container is cleared first. It returns false if the hadronizer failed.
+  //! The default implementation copies the output of the 1st method.
+
 protected:
 
   HadronizationModelI();
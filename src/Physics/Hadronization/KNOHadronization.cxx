@@ -37,6 +37,7 @@
 #include <TLorentzVector.h>
 #include <TClonesArray.h>
 #include <TH1D.h>
+#include <TRandom.h>
 #include <TMath.h>
 #include <TF1.h>
 #include <TROOT.h>
@@ -45,6 +46,7 @@
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/EventGen/RunningThreadInfo.h"
 #include "Physics/Decay/DecayModelI.h"
 #include "Physics/Hadronization/KNOHadronization.h"
 #include "Framework/Interaction/Interaction.h"
@@ -56,6 +58,7 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Framework/Utils/PhaseSpaceWeightCache.h"
 #include "Framework/Utils/PrintUtils.h"
 
 using namespace genie;
@@ -63,6 +66,9 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils::print;
 
+// max multiplicity accepted by the ROOT phase space decayer
+static const int kMaxKNOMult = 18;
+
 //____________________________________________________________________________
 KNOHadronization::KNOHadronization() :
 HadronizationModelBase("genie::KNOHadronization")
@@ -98,11 +104,32 @@ TClonesArray * KNOHadronization::Hadronize(
                                         const Interaction * interaction) const
 {
 // Generate the hadronic system in a neutrino interaction using a KNO-based 
-// model. 
+// model. Returns a new TClonesArray of TMCParticles.
+
+  TClonesArray * particle_list = new TClonesArray("TMCParticle");
+
+  if(!this->Hadronize(interaction, *particle_list)) {
+    delete particle_list;
+    return 0;
+  }
+
+  //-- The container 'owns' its elements
+  particle_list->SetOwner(true);
+
+  return particle_list;
+}
+//____________________________________________________________________________
+bool KNOHadronization::Hadronize(
+         const Interaction * interaction, TClonesArray & particle_list) const
+{
+// Generate the hadronic system in a neutrino interaction using a KNO-based 
+// model, filling the input (cleared, reusable) TClonesArray of TMCParticles.
+
+  particle_list.Clear();
 
   if(!this->AssertValidity(interaction)) {
      LOG("KNOHad", pWARN) << "Returning a null particle list!";
-     return 0;
+     return false;
   }
   fWeight=1;
 
@@ -115,7 +142,7 @@ TClonesArray * KNOHadronization::Hadronize(
   if(!pdgcv) {
     LOG("KNOHad", pNOTICE) 
         << "Failed selecting particles for " << *interaction;
-    return 0;
+    return false;
   }
 
   //-- Decay the hadronic final state
@@ -132,38 +159,35 @@ TClonesArray * KNOHadronization::Hadronize(
   //      keep the option of using simple phase space decay with reweighting switched 
   //      off (for consistency with the neugen/daikon version).
   //
-  TClonesArray * particle_list = 0;
+  bool decayed = false;
   bool reweight_decays = fReWeightDecays;
   if(fUseBaryonXfPt2Param) {
     bool use_isotropic_decay = (pdgcv->size()==2 && fUseIsotropic2BDecays);
     if(use_isotropic_decay) {
-       particle_list = this->DecayMethod1(W,*pdgcv,false);
+       decayed = this->DecayMethod1(W,*pdgcv,false,particle_list);
     } else {
-       particle_list = this->DecayMethod2(W,*pdgcv,reweight_decays);
+       decayed = this->DecayMethod2(W,*pdgcv,reweight_decays,particle_list);
     }
   } else {
-   particle_list = this->DecayMethod1(W,*pdgcv,reweight_decays);
+   decayed = this->DecayMethod1(W,*pdgcv,reweight_decays,particle_list);
   }
 
-  if(!particle_list) {
+  if(!decayed) {
     LOG("KNOHad", pNOTICE) 
         << "Failed decaying a hadronic system @ W=" << W 
         << "with  multiplicity=" << pdgcv->size();
 
     // clean-up and exit
     delete pdgcv;
-    return 0;
+    return false;
   }
 
   //-- Handle unstable particle decays (if requested)
-  this->HandleDecays(particle_list);
-
-  //-- The container 'owns' its elements
-  particle_list->SetOwner(true);
+  this->HandleDecays(&particle_list);
 
   delete pdgcv;
   
-  return particle_list;
+  return true;
 }
 //____________________________________________________________________________
 PDGCodeList * KNOHadronization::SelectParticles(
@@ -188,50 +212,67 @@ PDGCodeList * KNOHadronization::SelectParticles(
    //-- Build the multiplicity probabilities for the input interaction
   LOG("KNOHad", pDEBUG) << "Building Multiplicity Probability distribution";
   LOG("KNOHad", pDEBUG) << *interaction;
-  Option_t * opt = "+LowMultSuppr+Renormalize";
-  TH1D * mprob = this->MultiplicityProb(interaction,opt);
+  double prob[kMaxKNOMult];
+  int nmult = this->MultiplicityProbs(interaction, true, true, prob);
 
-  if(!mprob) {
+  if(nmult <= 0) {
     LOG("KNOHad", pWARN) << "Null multiplicity probability distribution!";
     return 0;
   }
-  if(mprob->Integral("width")<=0) {
+
+  // cumulative distribution, sampled as TH1::GetRandom() would do
+  double cdf[kMaxKNOMult+1];
+  cdf[0] = 0.;
+  for(int i = 0; i < nmult; i++) cdf[i+1] = cdf[i] + prob[i];
+  if(cdf[nmult]<=0) {
     LOG("KNOHad", pWARN) << "Empty multiplicity probability distribution!";
-    delete mprob;
     return 0;
   }
 
+  //-- Fold in the probability that the hadronic content generated at each
+  //   multiplicity is allowed (enough charge & invariant mass), so that the
+  //   accepted multiplicity is drawn directly rather than through repeated
+  //   rejections of the whole hadronic system. Only the hadron content at
+  //   the selected multiplicity is regenerated if it is not allowed, which
+  //   leaves the distribution of accepted hadronic systems unchanged.
+  double cdf_acc[kMaxKNOMult+1];
+  cdf_acc[0] = 0.;
+  for(int i = 0; i < nmult; i++) {
+    double acc = this->HadronCodesAcceptance(i+2, maxQ, W);
+    cdf_acc[i+1] = cdf_acc[i] + (cdf[i+1] - cdf[i]) * acc;
+  }
+  if(cdf_acc[nmult]<=0) {
+    LOG("KNOHad", pERROR) 
+      << "No allowed hadronic shower @ W = " << W << ", Q = " << maxQ;
+    return 0;
+  }
+  for(int i = 1; i <= nmult; i++) cdf_acc[i] /= cdf_acc[nmult];
+
   //----- FIND AN ALLOWED SOLUTION FOR THE HADRONIC FINAL STATE
 
+  //-- Generate a hadronic multiplicity 
+  mult = 2 + TMath::BinarySearch(nmult+1, cdf_acc, gRandom->Rndm());
+
+  LOG("KNOHad", pINFO) << "Hadron multiplicity  = " << mult;
+
   bool allowed_state=false;
   unsigned int itry = 0;
+  unsigned int sel_mult = mult;
 
   while(!allowed_state) 
   {
     itry++;
+    if(itry>1) RunningThreadInfo::Instance()->EventCost().had_retries++;
 
     //-- Go in error if a solution has not been found after many attempts
     if(itry>kMaxKNOHadSystIterations) {
        LOG("KNOHad", pERROR) 
          << "Couldn't select hadronic shower particles after: " 
          << itry << " attempts!";
-       delete mprob;
        return 0;
     }
 
-    //-- Generate a hadronic multiplicity 
-    mult = TMath::Nint( mprob->GetRandom() );
-
-    LOG("KNOHad", pINFO) << "Hadron multiplicity  = " << mult;
-
-    //-- Check that the generated multiplicity is consistent with the charge
-    //   that the hadronic shower is required to have - else retry
-    if(mult < (unsigned int) TMath::Abs(maxQ)) {
-       LOG("KNOHad", pWARN) 
-        << "Multiplicity not enough to generate hadronic charge! Retrying.";
-      allowed_state = false;
-      continue;
-    }
+    mult = sel_mult;
 
     //-- Force a min multiplicity
     //   This should never happen if the multiplicity probability distribution
@@ -245,7 +286,6 @@ PDGCodeList * KNOHadronization::SelectParticles(
       } else {
         LOG("KNOHad", pWARN) 
            << "Generated multiplicity: " << mult << " is too low! Quitting";
-        delete mprob;
         return 0;
       }
     }
@@ -265,7 +305,7 @@ PDGCodeList * KNOHadronization::SelectParticles(
     vector<int>::const_iterator pdg_iter;
     for(pdg_iter = pdgcv->begin(); pdg_iter != pdgcv->end(); ++pdg_iter) {
       int pdgc = *pdg_iter;
-      double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+      double m = PDGLibrary::Instance()->Mass(pdgc);
 
       msum += m;
       LOG("KNOHad", pDEBUG) << "- PDGC=" << pdgc << ", m=" << m << " GeV";
@@ -289,8 +329,6 @@ PDGCodeList * KNOHadronization::SelectParticles(
 
   } // attempts
 
-  delete mprob;
-
   return pdgcv;
 }
 //____________________________________________________________________________
@@ -309,12 +347,40 @@ TH1D * KNOHadronization::MultiplicityProb(
 //    section reduction factor then the output histogram should not be re-
 //    normalized after applying the scaling factors.
 
-  if(!this->AssertValidity(interaction)) {
+  string option(opt);
+
+  bool apply_neugen_Rijk = option.find("+LowMultSuppr") != string::npos;
+  bool renormalize       = option.find("+Renormalize")  != string::npos;
+
+  double prob[kMaxKNOMult];
+  int nmult = this->MultiplicityProbs(
+                    interaction, apply_neugen_Rijk, renormalize, prob);
+  if(nmult <= 0) {
      LOG("KNOHad", pWARN) 
        << "Returning a null multiplicity probability distribution!";
      return 0;
   }
 
+  // Create multiplicity probability histogram
+  TH1D * mult_prob = this->CreateMultProbHist(nmult+1);
+  for(int i = 0; i < nmult; i++) {
+     mult_prob->Fill(i+2, prob[i]);
+  }
+
+  return mult_prob;
+}
+//____________________________________________________________________________
+int KNOHadronization::MultiplicityProbs(
+             const Interaction * interaction, bool apply_neugen_Rijk,
+	     bool renormalize, double * prob) const
+{
+// Computes the probabilities prob[n-2] of hadronic multiplicities n = 2,...,
+// for the input interaction, optionally applying the NeuGEN Rijk factors
+// (see MultiplicityProb()). The input array must have kMaxKNOMult entries.
+// Returns the number of multiplicities, or 0 if there is no distribution.
+
+  if(!this->AssertValidity(interaction)) return 0;
+
   const InitialState & init_state = interaction->InitState();
   int nu_pdg  = init_state.ProbePdg();
   int nuc_pdg = init_state.Tgt().HitNucPdg();
@@ -339,7 +405,7 @@ TH1D * KNOHadronization::MultiplicityProb(
   // Set maximum multiplicity so that it does not exceed the max number of
   // particles accepted by the ROOT phase space decayer (18)
   // Change this if ROOT authors remove the TGenPhaseSpace limitation.
-  if(maxmult>18) maxmult=18;
+  if(maxmult>kMaxKNOMult) maxmult=kMaxKNOMult;
 
   SLOG("KNOHad", pDEBUG) << "Computed maximum multiplicity = " << maxmult;
 
@@ -348,18 +414,15 @@ TH1D * KNOHadronization::MultiplicityProb(
      return 0;
   }
 
-  // Create multiplicity probability histogram
-  TH1D * mult_prob = this->CreateMultProbHist(maxmult);
+  // Compute the multiplicity probabilities values up to the computed 
+  // maximum multiplicity
 
-  // Compute the multiplicity probabilities values up to the bin corresponding 
-  // to the computed maximum multiplicity
+  int nmult = TMath::Nint(maxmult-1);
 
   if(maxmult>2) {
-    int nbins = mult_prob->FindBin(maxmult);
-
-    for(int i = 1; i <= nbins; i++) {
+    for(int i = 0; i < nmult; i++) {
        // KNO distribution is <n>*P(n) vs n/<n>
-       double n    = mult_prob->GetBinCenter(i);  // bin centre
+       double n    = i+2;
        double z    = n/avn;                       // z=n/<n>
        double avnP = this->KNO(nu_pdg,nuc_pdg,z); // <n>*P(n)
        double P    = avnP / avn;                  // P(n)
@@ -368,33 +431,39 @@ TH1D * KNOHadronization::MultiplicityProb(
           << "n = " << n << " (n/<n> = " << z
           << ", <n>*P = " << avnP << ") => P = " << P;
 
-       mult_prob->Fill(n,P);
+       prob[i] = P;
     }
   } else {
        SLOG("KNOHad", pDEBUG) << "Fixing multiplicity to 2";
-       mult_prob->Fill(2,1.);
+       prob[0] = 1.;
   }
 
-  double integral = mult_prob->Integral("width");
+  double integral = 0;
+  for(int i = 0; i < nmult; i++) integral += prob[i];
   if(integral>0) {
     // Normalize the probability distribution
-    mult_prob->Scale(1.0/integral);
+    for(int i = 0; i < nmult; i++) prob[i] *= (1.0/integral);
   } else {
     SLOG("KNOHad", pWARN) << "probability distribution integral = 0";
-    return mult_prob;
+    return nmult;
   }
 
-  string option(opt);
-
-  bool apply_neugen_Rijk = option.find("+LowMultSuppr") != string::npos;
-  bool renormalize       = option.find("+Renormalize")  != string::npos;
-
   // Apply the NeuGEN probability scaling factors -if requested-
   if(apply_neugen_Rijk) {
     SLOG("KNOHad", pINFO) << "Applying NeuGEN scaling factors";
      // Only do so for W<Wcut
      if(W<fWcut) {
-       this->ApplyRijk(interaction, renormalize, mult_prob);
+       double R2=1., R3=1.;
+       this->RijkFactors(interaction, R2, R3);
+       prob[0] *= R2;
+       if(nmult>1) prob[1] *= R3;
+       if(renormalize) {
+         double norm = 0;
+         for(int i = 0; i < nmult; i++) norm += prob[i];
+         if(norm>0) {
+           for(int i = 0; i < nmult; i++) prob[i] *= (1.0/norm);
+         }
+       }
      } else {
         SLOG("KNOHad", pDEBUG)  
               << "W = " << W << " < Wcut = " << fWcut 
@@ -402,7 +471,7 @@ TH1D * KNOHadronization::MultiplicityProb(
      }//<wcut?
   }//apply?
 
-  return mult_prob;
+  return nmult;
 }
 //____________________________________________________________________________
 double KNOHadronization::Weight(void) const
@@ -683,8 +752,9 @@ int KNOHadronization::HadronShowerCharge(const Interaction* interaction) const
   return hadronShowerCharge;
 }
 //____________________________________________________________________________
-TClonesArray * KNOHadronization::DecayMethod1(
-               double W, const PDGCodeList & pdgv, bool reweight_decays) const
+bool KNOHadronization::DecayMethod1(
+               double W, const PDGCodeList & pdgv, bool reweight_decays,
+               TClonesArray & plist) const
 {
 // Simple phase space decay including all generated particles.
 // The old NeuGEN decay strategy.
@@ -692,22 +762,21 @@ TClonesArray * KNOHadronization::DecayMethod1(
   LOG("KNOHad", pINFO) << "** Using Hadronic System Decay method 1";
 
   TLorentzVector p4had(0,0,0,W);
-  TClonesArray * plist = new TClonesArray("TMCParticle", pdgv.size());
 
   // do the decay
-  bool ok = this->PhaseSpaceDecay(*plist, p4had, pdgv, 0, reweight_decays); 
+  bool ok = this->PhaseSpaceDecay(plist, p4had, pdgv, 0, reweight_decays); 
 
-  // clean-up and return NULL
+  // clean-up and return
   if(!ok) {
-     plist->Delete();
-     delete plist;
-     return 0;
+     plist.Clear();
+     return false;
   }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
-TClonesArray * KNOHadronization::DecayMethod2(
-               double W, const PDGCodeList & pdgv, bool reweight_decays) const
+bool KNOHadronization::DecayMethod2(
+               double W, const PDGCodeList & pdgv, bool reweight_decays,
+               TClonesArray & plist) const
 {
 // Generate the baryon based on experimental pT^2 and xF distributions
 // Then pass the remaining system of N-1 particles to a phase space decayer.
@@ -716,13 +785,13 @@ TClonesArray * KNOHadronization::DecayMethod2(
   LOG("KNOHad", pINFO) << "** Using Hadronic System Decay method 2";
 
   // If only 2 particles are input then don't call the phase space decayer
-  if(pdgv.size() == 2) return this->DecayBackToBack(W,pdgv);
+  if(pdgv.size() == 2) return this->DecayBackToBack(W,pdgv,plist);
 
   // Now handle the more general case:
 
   // Take the baryon
   int    baryon = pdgv[0]; 
-  double MN     = PDGLibrary::Instance()->Find(baryon)->Mass();
+  double MN     = PDGLibrary::Instance()->Mass(baryon);
   double MN2    = TMath::Power(MN, 2);
 
   // Check baryon code
@@ -738,12 +807,9 @@ TClonesArray * KNOHadronization::DecayMethod2(
   vector<int>::const_iterator pdg_iter = pdgv_strip.begin();
   for( ; pdg_iter != pdgv_strip.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    mass_sum += PDGLibrary::Instance()->Find(pdgc)->Mass();
+    mass_sum += PDGLibrary::Instance()->Mass(pdgc);
   }
 
-  // Create the particle list
-  TClonesArray * plist = new TClonesArray("TMCParticle", pdgv.size());
-
   RandomGen * rnd = RandomGen::Instance();
   TLorentzVector p4had(0,0,0,W);
   TLorentzVector p4N  (0,0,0,0);
@@ -789,7 +855,7 @@ TClonesArray * KNOHadronization::DecayMethod2(
         << "Generated baryon with P4 = " << utils::print::P4AsString(&p4N);
 
     // Insert the baryon at the event record
-    new ((*plist)[0]) TMCParticle(
+    new (plist[0]) TMCParticle(
       1,baryon,-1,-1,-1, p4N.Px(),p4N.Py(),p4N.Pz(),p4N.Energy(),MN, 0,0,0,0,0);
 
     // Do a phase space decay for the N-1 particles and add them to the list
@@ -800,28 +866,20 @@ TClonesArray * KNOHadronization::DecayMethod2(
         << ", Particle masses = " << mass_sum; 
 
     bool is_ok = this->PhaseSpaceDecay(
-                          *plist, p4d, pdgv_strip, 1, reweight_decays); 
+                          plist, p4d, pdgv_strip, 1, reweight_decays); 
 
     got_hadsyst_4p = is_ok;
 
     if(!got_hadsyst_4p) { 
       got_baryon_4p = false;
-      plist->Delete(); 
+      plist.Clear(); 
     }
   }
-
-  // clean-up and return NULL
-  if(0) {
-     LOG("KNOHad", pERROR) << "*** Decay forbidden by kinematics! ***";
-     plist->Delete();
-     delete plist;
-     return 0;
-  }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
-TClonesArray * KNOHadronization::DecayBackToBack(
-                                     double W, const PDGCodeList & pdgv) const
+bool KNOHadronization::DecayBackToBack(
+              double W, const PDGCodeList & pdgv, TClonesArray & plist) const
 {
 // Handles a special case (only two particles) of the 2nd decay method 
 //
@@ -832,9 +890,6 @@ TClonesArray * KNOHadronization::DecayBackToBack(
 
   RandomGen * rnd = RandomGen::Instance();
 
-  // Create the particle list
-  TClonesArray * plist = new TClonesArray("TMCParticle", pdgv.size());
-
   // Get xF,pT2 distribution (y-) maxima for the rejection method
   double xFo  = 1.1 * fBaryonXFpdf ->GetMaximum(-1,1);
   double pT2o = 1.1 * fBaryonPT2pdf->GetMaximum( 0,1);
@@ -847,20 +902,19 @@ TClonesArray * KNOHadronization::DecayBackToBack(
 
     // Find an allowed (unweighted) phase space decay for the 2 particles 
     // and add them to the list
-    bool ok = this->PhaseSpaceDecay(*plist, p4, pdgv, 0, false);
+    bool ok = this->PhaseSpaceDecay(plist, p4, pdgv, 0, false);
 
-    // If the decay isn't allowed clean-up and return NULL
+    // If the decay isn't allowed clean-up and return
     if(!ok) {
       LOG("KNOHad", pERROR) << "*** Decay forbidden by kinematics! ***";
-      plist->Delete();
-      delete plist;
-      return 0;
+      plist.Clear();
+      return false;
     }
 
     // If the decay was allowed, then compute the baryon xF,pT2 and accept/
     // reject the phase space decays so as to reproduce the xF,pT2 PDFs
 
-    TMCParticle * baryon = (TMCParticle *) (*plist)[0];
+    TMCParticle * baryon = (TMCParticle *) plist[0];
     assert(pdg::IsNeutronOrProton(baryon->GetKF()));
 
     double px  = baryon->GetPx();
@@ -883,7 +937,7 @@ TClonesArray * KNOHadronization::DecayBackToBack(
 
     LOG("KNOHad", pINFO) << ((accepted) ? "Decay accepted":"Decay rejected");
   }
-  return plist;
+  return true;
 }
 //____________________________________________________________________________
 bool KNOHadronization::PhaseSpaceDecay(
@@ -908,7 +962,7 @@ bool KNOHadronization::PhaseSpaceDecay(
   double   sum  = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m = PDGLibrary::Instance()->Mass(pdgc);
     mass[i++] = m;
     sum += m;
   }
@@ -932,12 +986,20 @@ bool KNOHadronization::PhaseSpaceDecay(
   }
 
   // Get the maximum weight
+  // Plain phase space weights only depend on W & the decay products: their
+  // max is cached (see PhaseSpaceWeightCache). The pT re-weighting is frame
+  // dependent, so the max of the re-weighted decays is estimated each time.
   //double wmax = fPhaseSpaceGenerator.GetWtMax();
+  PhaseSpaceWeightCache * wcache = PhaseSpaceWeightCache::Instance();
   double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     if(reweight) { w *= this->ReWeightPt2(pdgv); }
-     wmax = TMath::Max(wmax,w);
+  if(reweight) {
+    for(int idec=0; idec<200; idec++) {
+       double w = fPhaseSpaceGenerator.Generate();   
+       w *= this->ReWeightPt2(pdgv);
+       wmax = TMath::Max(wmax,w);
+    }
+  } else {
+    wmax = wcache->MaxWeight(fPhaseSpaceGenerator, pd, pdgv);
   }
   assert(wmax>0);
 
@@ -965,6 +1027,7 @@ bool KNOHadronization::PhaseSpaceDecay(
      while(!accept_decay) 
      {
        itry++;
+       if(itry>1) RunningThreadInfo::Instance()->EventCost().had_retries++;
 
        if(itry>kMaxUnweightDecayIterations) {
          // report, clean-up and return
@@ -980,6 +1043,7 @@ bool KNOHadronization::PhaseSpaceDecay(
        if(w > wmax) {
           LOG("KNOHad", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
+          if(!reweight) { wcache->RaiseMaxWeight(pd, pdgv, w); }
        }
        double gw = wmax * rnd->RndHadro().Rndm();
        accept_decay = (gw<=w);
@@ -1346,45 +1410,11 @@ int KNOHadronization::GenerateBaryonPdgCode(
   // initialize to neutron & then change it to proton if you must
   int pdgc = kPdgNeutron;
 
-  // Assign a probability for the given W for the baryon to become strange
-  // using a function derived from a fit to the data in Jones et al. (1993)
-  // Don't let the probability be larger than 1.
-  double Pstr = fAhyperon + fBhyperon * TMath::Log(W*W);
-  Pstr = TMath::Min(1.,Pstr);
-  Pstr = TMath::Max(0.,Pstr);
-  
-  // Available hadronic system charge = 2
-  if(maxQ == 2) {
-     //for multiplicity ==2, force it to p
-     if(multiplicity ==2 ) pdgc = kPdgProton;
-     else {
-       if(x < 0.66667) pdgc = kPdgProton;
-     }
-  }
-  // Available hadronic system charge = 1
-  if(maxQ == 1) {
-     if(multiplicity == 2) {
-        if(x < 0.33333) pdgc = kPdgProton;
-     } else {
-        if(x < 0.50000) pdgc = kPdgProton;
-     }
-  }
+  // Probability for the baryon to become strange
+  double Pstr = this->StrangeBaryonProb(W);
 
-  // Available hadronic system charge = 0
-  if(maxQ == 0) {
-     if(multiplicity == 2) {
-        if(x < 0.66667) pdgc = kPdgProton;
-     } else {
-        if(x < 0.50000) pdgc = kPdgProton;
-     }
-  }
-  // Available hadronic system charge = -1
-  if(maxQ == -1) {
-     // for multiplicity == 2, force it to n
-     if(multiplicity != 2) {
-        if(x < 0.33333) pdgc = kPdgProton;
-     }
-  }
+  // Probability for the (non-strange) baryon to be a proton
+  if(x < this->ProtonProb(multiplicity, maxQ)) pdgc = kPdgProton;
 
   // For neutrino interactions turn protons and neutrons to Sigma+ and
   // Lambda respectively (Lambda and Sigma- respectively for anti-neutrino
@@ -1416,6 +1446,120 @@ int KNOHadronization::GenerateBaryonPdgCode(
   return pdgc;
 }
 //____________________________________________________________________________
+double KNOHadronization::ProtonProb(int multiplicity, int maxQ) const
+{
+// Probability for the remnant baryon to be assigned as a proton (rather
+// than a neutron), before it is possibly turned into a strange baryon.
+// Forced to p for ++ and to n for - I=3/2 at mult. = 2.
+
+  // Available hadronic system charge = 2
+  if(maxQ ==  2) return (multiplicity == 2) ? 1.      : 0.66667;
+  // Available hadronic system charge = 1
+  if(maxQ ==  1) return (multiplicity == 2) ? 0.33333 : 0.50000;
+  // Available hadronic system charge = 0
+  if(maxQ ==  0) return (multiplicity == 2) ? 0.66667 : 0.50000;
+  // Available hadronic system charge = -1
+  if(maxQ == -1) return (multiplicity == 2) ? 0.      : 0.33333;
+
+  return 0.;
+}
+//____________________________________________________________________________
+double KNOHadronization::StrangeBaryonProb(double W) const
+{
+// Assign a probability for the given W for the baryon to become strange
+// using a function derived from a fit to the data in Jones et al. (1993)
+// Don't let the probability be larger than 1.
+
+  double Pstr = fAhyperon + fBhyperon * TMath::Log(W*W);
+  Pstr = TMath::Min(1.,Pstr);
+  Pstr = TMath::Max(0.,Pstr);
+
+  return Pstr;
+}
+//____________________________________________________________________________
+double KNOHadronization::HadronCodesAcceptance(
+                            int multiplicity, int maxQ, double W) const
+{
+// Probability that the hadronic content generated by GenerateHadronCodes()
+// at the input multiplicity is allowed, ie it has enough particles to carry
+// the shower charge and a total mass below W.
+// The pairs of neutrals or +- hadrons are only added if there is enough
+// invariant mass left, so only the remnant baryon, the kaon conserving
+// strangeness, the pions balancing the charge and the single pi0 fixing
+// odd multiplicities can make a hadronic system forbidden. Their
+// combinations are enumerated here, following GenerateHadronCodes().
+
+  if(multiplicity < TMath::Abs(maxQ)) return 0.;
+
+  PDGLibrary * pdg = PDGLibrary::Instance();
+
+  double Pp   = this->ProtonProb(multiplicity, maxQ);
+  double Pstr = this->StrangeBaryonProb(W);
+
+  // remnant baryon (see GenerateBaryonPdgCode())
+  const int nbar = 4;
+  int    bar_pdgc[nbar];
+  double bar_prob[nbar];
+  bar_pdgc[0] = kPdgProton;                          bar_prob[0] = Pp      * (1-Pstr);
+  bar_pdgc[1] = kPdgNeutron;                         bar_prob[1] = (1-Pp)  * (1-Pstr);
+  bar_pdgc[2] = (maxQ > 0) ? kPdgSigmaP : kPdgLambda; bar_prob[2] = Pp      * Pstr;
+  bar_pdgc[3] = (maxQ > 0) ? kPdgLambda : kPdgSigmaM; bar_prob[3] = (1-Pp)  * Pstr;
+
+  double acc = 0.;
+
+  for(int ib = 0; ib < nbar; ib++) {
+    if(bar_prob[ib] <= 0.) continue;
+
+    int baryon_code = bar_pdgc[ib];
+    bool baryon_is_strange = (baryon_code == kPdgSigmaP || 
+                              baryon_code == kPdgLambda || 
+                              baryon_code == kPdgSigmaM);
+
+    int Q = maxQ;
+    if(baryon_code == kPdgProton || baryon_code == kPdgSigmaP) Q -= 1;
+    if(baryon_code == kPdgSigmaM) Q += 1;
+    double Mb = pdg->Mass(baryon_code);
+
+    // kaon conserving strangeness: K+ (k=1), K0 (k=0) or none (k=-1)
+    int    kaon[2]   = { -1, -1 };
+    double kprob[2]  = { 1., 0. };
+    if(baryon_is_strange) {
+      if(multiplicity == 2) { 
+         if      (Q == 1) kaon[0] = 1;
+         else if (Q == 0) kaon[0] = 0;
+      }
+      else if(multiplicity == 3 && Q ==  2) kaon[0] = 1;
+      else if(multiplicity == 3 && Q == -1) kaon[0] = 0;
+      else {
+         kaon[0] = 1; kprob[0] = 0.5;
+         kaon[1] = 0; kprob[1] = 0.5;
+      }
+    }
+
+    for(int ik = 0; ik < 2; ik++) {
+      if(kprob[ik] <= 0.) continue;
+
+      int    Qk        = Q;
+      int    to_add    = multiplicity - 1;
+      double msum      = Mb;
+      if(kaon[ik] == 1) { msum += pdg->Mass(kPdgKP); Qk -= 1; to_add--; }
+      if(kaon[ik] == 0) { msum += pdg->Mass(kPdgK0);          to_add--; }
+
+      // pions balancing the charge
+      int npi = TMath::Abs(Qk);
+      msum   += npi * pdg->Mass( (Qk < 0) ? kPdgPiM : kPdgPiP );
+      to_add -= npi;
+
+      // pi0 for an odd number of hadrons left to add
+      if(to_add > 0 && to_add % 2 == 1) msum += pdg->Mass(kPdgPi0);
+
+      if(W > msum) acc += bar_prob[ib] * kprob[ik];
+    }
+  }
+
+  return acc;
+}
+//____________________________________________________________________________
 void KNOHadronization::HandleDecays(TClonesArray * plist) const
 {
 // Handle decays of unstable particles if requested through the XML config.
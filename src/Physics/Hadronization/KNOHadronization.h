@@ -62,6 +62,7 @@ public:
   // implement the HadronizationModelI interface
   void           Initialize       (void)                                    const;
   TClonesArray * Hadronize        (const Interaction* )                     const;
+  bool           Hadronize        (const Interaction*, TClonesArray & plist) const;
   double         Weight           (void)                                    const;
   PDGCodeList *  SelectParticles  (const Interaction*)                      const;
   TH1D *         MultiplicityProb (const Interaction*, Option_t* opt = "")  const;
@@ -79,15 +80,20 @@ private:
   bool          AssertValidity        (const Interaction * i)        const;
   PDGCodeList * GenerateHadronCodes   (int mult, int maxQ, double W) const;
   int           GenerateBaryonPdgCode (int mult, int maxQ, double W) const;
+  double        ProtonProb            (int mult, int maxQ)           const;
+  double        StrangeBaryonProb     (double W)                     const;
+  double        HadronCodesAcceptance (int mult, int maxQ, double W) const;
   int           HadronShowerCharge    (const Interaction * )         const;
   double        KNO                   (int nu, int nuc, double z)    const;
   double        AverageChMult         (int nu, int nuc, double W)    const;
+  int           MultiplicityProbs     (const Interaction * i, bool rijk,
+                                       bool renorm, double * prob)   const;
   void          HandleDecays          (TClonesArray * particle_list) const;
   double        ReWeightPt2           (const PDGCodeList & pdgcv)    const;
 
-  TClonesArray* DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
-  TClonesArray* DecayMethod2    (double W, const PDGCodeList & pdgv, bool reweight_decays) const;
-  TClonesArray* DecayBackToBack (double W, const PDGCodeList & pdgv) const;
+  bool DecayMethod1    (double W, const PDGCodeList & pdgv, bool reweight_decays, TClonesArray & plist) const;
+  bool DecayMethod2    (double W, const PDGCodeList & pdgv, bool reweight_decays, TClonesArray & plist) const;
+  bool DecayBackToBack (double W, const PDGCodeList & pdgv, TClonesArray & plist) const;
 
   bool PhaseSpaceDecay(
          TClonesArray & pl, TLorentzVector & pd, 
@@ -13,6 +13,9 @@
  @ Feb 10, 2011
    Fixed a bug reported by Torben Ferber affecting the KNO -> PYTHIA
    model transition (the order was reversed!)
+ @ Oct 14, 2026 - CA
+   Added Hadronize(const Interaction *, TClonesArray &), forwarding to the
+   selected hadronizer.
 
 */
 //____________________________________________________________________________
@@ -87,6 +90,37 @@ TClonesArray * KNOPythiaHadronization::Hadronize(
   return particle_list;
 }
 //____________________________________________________________________________
+bool KNOPythiaHadronization::Hadronize(
+         const Interaction * interaction, TClonesArray & particle_list) const
+{
+// As above, filling the input (cleared, reusable) TClonesArray
+
+  particle_list.Clear();
+
+  double W = interaction->Kine().W();
+  LOG("HybridHad", pINFO) << "W = " << W << " GeV";
+
+  if(W <= kNucleonMass+kPionMass) {
+     LOG("HybridHad", pWARN) 
+        << "Low invariant mass, W = " << W << " GeV! Returning a null list";
+     return false;
+  }
+
+  //-- Init event weight (to be set if producing weighted events)
+  fWeight = 1.;
+
+  //-- Select hadronizer
+  const HadronizationModelI * hadronizer = this->SelectHadronizer(interaction);
+
+  //-- Run the selected hadronizer
+  bool ok = hadronizer->Hadronize(interaction, particle_list);
+
+  //-- Update the weight
+  fWeight = hadronizer->Weight();
+
+  return ok;
+}
+//____________________________________________________________________________
 PDGCodeList * KNOPythiaHadronization::SelectParticles(
                                         const Interaction * interaction) const
 {
@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   Sample z from an inverse cumulative distribution table built at
+   configuration, instead of TF1::GetRandom().
 
 */
 //____________________________________________________________________________
@@ -23,13 +26,15 @@ using namespace genie;
 
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm() :
-FragmentationFunctionI("genie::PetersonFragm")
+FragmentationFunctionI("genie::PetersonFragm"),
+fFunc(0)
 {
 
 }
 //___________________________________________________________________________
 PetersonFragm::PetersonFragm(string config) :
-FragmentationFunctionI("genie::PetersonFragm", config)
+FragmentationFunctionI("genie::PetersonFragm", config),
+fFunc(0)
 {
   this->BuildFunction();
 }
@@ -49,9 +54,10 @@ double PetersonFragm::Value(double z) const
 //___________________________________________________________________________
 double PetersonFragm::GenerateZ(void) const
 {
-// Return a random number using the fragmentation function as PDF
+// Return a random number using the fragmentation function as PDF, from
+// the inverse cumulative distribution tabulated at configuration
 
-  return fFunc->GetRandom();
+  return this->GenerateZFromTable();
 }
 //___________________________________________________________________________
 void PetersonFragm::Configure(const Registry & config)
@@ -66,8 +72,9 @@ void PetersonFragm::Configure(string config)
   this->BuildFunction();
 }
 //___________________________________________________________________________
-void PetersonFragm::BuildFunction(void) 
+void PetersonFragm::BuildFunction(void)
 {
+  delete fFunc;
   fFunc = new TF1("fFunc",genie::utils::frgmfunc::peterson_func,0,1,2);
 
   fFunc->SetParNames("Norm","Epsilon");
@@ -94,6 +101,8 @@ void PetersonFragm::BuildFunction(void)
     N = 1./I;
   }
   fFunc->SetParameters(N,e);
+
+  this->BuildZTable();
 }
 //___________________________________________________________________________
 
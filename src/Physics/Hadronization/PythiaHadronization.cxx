@@ -27,6 +27,7 @@
 #include "Framework/Conventions/GBuild.h"
 #include "Physics/Decay/DecayModelI.h"
 #include "Physics/Hadronization/PythiaHadronization.h"
+#include "Physics/Decay/Pythia6Session.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -72,11 +73,31 @@ TClonesArray *
   PythiaHadronization::Hadronize(
          const Interaction * interaction) const
 {
+// Returns a new TClonesArray of TMCParticles
+
+  TClonesArray * particle_list = new TClonesArray("TMCParticle");
+
+  if(!this->Hadronize(interaction, *particle_list)) {
+    delete particle_list;
+    return 0;
+  }
+  particle_list->SetOwner(true);
+
+  return particle_list;
+}
+//____________________________________________________________________________
+bool PythiaHadronization::Hadronize(
+         const Interaction * interaction, TClonesArray & particle_list) const
+{
+// Fills the input (cleared, reusable) TClonesArray of TMCParticles
+
+  particle_list.Clear();
+
   LOG("PythiaHad", pNOTICE) << "Running PYTHIA hadronizer";
 
   if(!this->AssertValidity(interaction)) {
      LOG("PythiaHad", pERROR) << "Returning a null particle list!";
-     return 0;
+     return false;
   }
 
   // get kinematics / init-state / process-info
@@ -141,7 +162,7 @@ TClonesArray *
     else {
       LOG("PythiaHad", pERROR)
         << "Not allowed mode. Refused to make a final quark assignment!";
-      return 0;
+      return false;
     }
   }//CC
 
@@ -225,66 +246,25 @@ TClonesArray *
         << "q = " << final_quark << ", qq = " << diquark;
   int ip = 0;
 
-  // Determine how jetset treats un-stable particles appearing in hadronization
-
-  int pi0_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgPi0),              1); 
-  int K0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgK0),               1); 
-  int K0b_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgAntiK0),           1); 
-  int L0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgLambda),           1); 
-  int L0b_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgAntiLambda),       1);
-  int Dm_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1); 
-  int D0_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1); 
-  int Dp_decflag  = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1); 
-  int Dpp_decflag = fPythia->GetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1); 
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for pi0           =  " << pi0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for K0            =  " << K0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for \bar{K0}      =  " << K0b_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for Lambda        =  " << L0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for \bar{Lambda0} =  " << L0b_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D-            =  " << Dm_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D0            =  " << D0_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D+            =  " << Dp_decflag;
-  LOG("PythiaHad", pDEBUG) << "Original decay flag for D++           =  " << Dpp_decflag;
-#endif
-
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),               1,0); // don't decay pi0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgK0),                1,0); // don't decay K0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiK0),            1,0); // don't decay \bar{K0}
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgLambda),            1,0); // don't decay Lambda0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiLambda),        1,0); // don't decay \bar{Lambda0}
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),   1,1); // decay Delta-
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),   1,1); // decay Delta0
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),   1,1); // decay Delta+
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP),  1,1); // decay Delta++
+  // Set how jetset treats un-stable particles appearing in hadronization:
+  // don't decay pi0, K0, \bar{K0}, Lambda0, \bar{Lambda0}, decay the Deltas.
+  // The decay flags are switched only if another PYTHIA6 consumer (eg the
+  // decayer) was run since the last call.
+  Pythia6Session::Instance()->Use(kP6cHadronization);
 
   // -- hadronize --
   py2ent_(&ip, &final_quark, &diquark, &W); // hadronizer
 
-  // restore pythia decay settings so as not to interfere with decayer 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgPi0),              1, pi0_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgK0),               1, K0_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiK0),           1, K0b_decflag);
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgLambda),           1, L0_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgAntiLambda),       1, L0b_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaM),  1, Dm_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_Delta0),  1, D0_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaP),  1, Dp_decflag); 
-  fPythia->SetMDCY(fPythia->Pycomp(kPdgP33m1232_DeltaPP), 1, Dpp_decflag); 
-
   // get LUJETS record
   fPythia->GetPrimaries();
   TClonesArray * pythia_particles =
        (TClonesArray *) fPythia->ImportParticles("All");
 
-  // copy PYTHIA container to a new TClonesArray so as to transfer ownership
-  // of the container and of its elements to the calling method
+  // copy PYTHIA container to the output TClonesArray, so as to transfer
+  // ownership of its elements to the calling method
 
   int np = pythia_particles->GetEntries();
   assert(np>0);
-  TClonesArray * particle_list = new TClonesArray("TMCParticle", np);
-  particle_list->SetOwner(true);
 
   unsigned int i = 0;
   TMCParticle * particle = 0;
@@ -300,9 +280,8 @@ TClonesArray *
             pdg::IsDiQuark(particle->GetKF()) ) {
                 LOG("PythiaHad", pERROR)
                   << "Hadronization failed! Bare quark/di-quarks appear in final state!";
-            particle_list->Delete();
-            delete particle_list;
-            return 0;            
+            particle_list.Clear();
+            return false;            
         }
      }
 
@@ -312,11 +291,11 @@ TClonesArray *
      particle->SetLastChild  (particle->GetLastChild()  - 1);
 
      // insert the particle in the list
-     new ( (*particle_list)[i++] ) TMCParticle(*particle);
+     new ( particle_list[i++] ) TMCParticle(*particle);
   }
 
-  utils::fragmrec::Print(particle_list);
-  return particle_list;
+  utils::fragmrec::Print(&particle_list);
+  return true;
 }
 //____________________________________________________________________________
 PDGCodeList * 
@@ -37,6 +37,7 @@ public:
   //-- implement the HadronizationModelI interface
   void           Initialize       (void)                                  const;
   TClonesArray * Hadronize        (const Interaction*)                    const;
+  bool           Hadronize        (const Interaction*, TClonesArray & plist) const;
   double         Weight           (void)                                  const;
   PDGCodeList *  SelectParticles  (const Interaction*)                    const;
   TH1D *         MultiplicityProb (const Interaction*, Option_t* opt="")  const;
@@ -103,7 +103,16 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  const double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   When available, an envelope of the xsec in (E,Q2) is used instead of
+  //   the max xsec, selecting Q2 in cells of the envelope according to their
+  //   majorant, so that almost every trial is accepted.
+  KineEnvelope_t * envelope = (fGenerateUniformly) ? 0 :
+      this->Envelope(interaction, interaction->InitState().ProbeE(kRfLab));
+  double xsec_max = -1;
+  if(!fGenerateUniformly && !envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
 
   //-- Try to select a valid Q2 using the rejection method
 
@@ -117,6 +126,7 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("IBD", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
@@ -128,7 +138,15 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      }
      
      //-- Generate a Q2 value within the allowed phase space
-     gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
+     int icell = -1;
+     if(envelope) {
+        double u = this->SampleEnvelope(*envelope,
+                     rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), icell);
+        xsec_max = envelope->value[icell];
+        gQ2 = Q2min + (Q2max-Q2min) * u;
+     } else {
+        gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
+     }
      interaction->KinePtr()->SetQ2(gQ2);
      LOG("IBD", pINFO) << "Trying: Q^2 = " << gQ2;
 
@@ -137,7 +155,11 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- Decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(envelope && xsec > xsec_max) {
+          // the envelope is not a bound here: raise it
+          this->RaiseEnvelope(envelope, icell, xsec);
+        }
+        else this->AssertXSecLimits(interaction, xsec, xsec_max);
         const double t = xsec_max * rnd->RndKine().Rndm();
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("IBD", pDEBUG)
@@ -170,7 +192,7 @@ void IBDKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         // The hadronic inv. mass is equal to the recoil nucleon on-shell mass.
         const int rpdgc = interaction->RecoilNucleonPdg();
         assert(rpdgc);
-        const double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+        const double gW = PDGLibrary::Instance()->Mass(rpdgc);
 
         LOG("IBD", pNOTICE) << "Selected: W = "<< gW;
 
@@ -237,6 +259,11 @@ void IBDKinematicsGenerator::LoadConfig(void)
 	//   an event weight?
 	GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+	//-- Sample Q2 against an envelope of the cross section in (E,Q2)?
+	GetParamDef( "UseEnvelope",           fUseEnvelope,    true ) ;
+	GetParamDef( "Envelope-SafetyFactor", fEnvelopeSafety, 1.2  ) ;
+	fEnvelopes.clear();
+	fEnvelopeEdges.clear();
 }
 //____________________________________________________________________________
 double IBDKinematicsGenerator::ComputeMaxXSec(
@@ -311,4 +338,19 @@ double IBDKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double IBDKinematicsGenerator::EnvelopeXSec(
+                             Interaction * interaction, double u) const
+{
+// dxsec/dQ2 at the Q2 normalized to its limits, for the (E,Q2) envelope
+// (see KineGeneratorWithCache::Envelope())
 
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  if(!kps.IsAboveThreshold()) return 0.;
+
+  Range1D_t rQ2 = kps.Limits(kKVQ2);
+  if(rQ2.max <= 0 || rQ2.min >= rQ2.max) return 0.;
+
+  interaction->KinePtr()->SetQ2(rQ2.min + (rQ2.max - rQ2.min) * u);
+  return fXSecModel->XSec(interaction, kPSQ2fE);
+}
+//___________________________________________________________________________
@@ -46,6 +46,8 @@ public :
 private:
   void   LoadConfig     (void);
   double ComputeMaxXSec (const Interaction * in) const;
+  double EnvelopeXSec   (Interaction * in, double u) const;
+  int    EnvelopeDim    (void) const { return 1; }
 };
 
 }      // genie namespace
@@ -19,9 +19,17 @@
    Major development leading to the first complete version of the generator.
  @ Nov 20, 2015 - CA, SD  
    Add proper exception handling for failure of phase space decay.
+ @ Oct 14, 2026 - CA
+   Select the NSV lepton kinematics against a piecewise-constant envelope of
+   the xsec over a (Tl, cos(theta_l)) grid, per target, probe and Enu bin.
+ @ Oct 14, 2026 - CA
+   Draw the kinematics random numbers through RandomGen::Next().
 */
 //____________________________________________________________________________
 
+#include <algorithm>
+#include <limits>
+
 #include <TMath.h>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
@@ -52,6 +60,10 @@ using namespace genie::utils;
 using namespace genie::constants;
 using namespace genie::controls;
 
+// NSV lepton kinematics envelope binning
+static const int kNSVEnvCells      = 30;  // # of cells in Tl and in cos(theta_l)
+static const int kNSVEnvBinsPerDec = 25;  // # of Enu bins per decade
+
 //___________________________________________________________________________
 MECGenerator::MECGenerator() :
 EventRecordVisitorI("genie::MECGenerator")
@@ -279,8 +291,8 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
      }
 
      // Generate next pair
-     double gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
-     double gW  = Wmin  + (Wmax -Wmin ) * rnd->RndKine().Rndm();
+     double gQ2 = Q2min + (Q2max-Q2min) * rnd->Next(kRndStrKine);
+     double gW  = Wmin  + (Wmax -Wmin ) * rnd->Next(kRndStrKine);
 
      // Calculate d2sigma/dQ2dW
      interaction->KinePtr()->SetQ2(gQ2);  
@@ -288,7 +300,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
      double xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
      
      // Decide whether to accept the current kinematics
-     double t = xsec_max * rnd->RndKine().Rndm();
+     double t = xsec_max * rnd->Next(kRndStrKine);
      double J = 1; // jacobean
      accept = (t < J*xsec);
 
@@ -299,7 +311,7 @@ void MECGenerator::SelectEmpiricalKinematics(GHepRecord * event) const
         double gy = 0;
  	//  More accurate calculation of the mass of the cluster than 2*Mnucl
  	int nucleon_cluster_pdg = interaction->InitState().Tgt().HitNucPdg();
- 	double M2n = PDGLibrary::Instance()->Find(nucleon_cluster_pdg)->Mass(); 
+ 	double M2n = PDGLibrary::Instance()->Mass(nucleon_cluster_pdg); 
         bool is_em = interaction->ProcInfo().IsEM();
         kinematics::WQ2toXY(Ev,M2n,gW,gQ2,gx,gy);
 
@@ -445,7 +457,7 @@ void MECGenerator::DecayNucleonCluster(GHepRecord * event) const
   double   sum  = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m = PDGLibrary::Instance()->Mass(pdgc);
     mass[i++] = m;
     sum += m;
   }
@@ -583,13 +595,6 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   // But could in principle get the no-delta component if they want (deactivated incode)
   int FullDeltaNodelta = 1;  // 1:  full, 2:  only delta, 3:  zero delta
 
-  // -- limit the maximum XS for the accept/reject loop -- //
-  // 
-  // MaxXSec parameters.  This whole calculation could be in it's own function?
-  // these need to lead to a number that is safely large enough, or crash the run.
-  double XSecMaxPar1 = 2.2504;
-  double XSecMaxPar2 = 9.41158;
-
   // -- Event Properties -----------------------------//
   Interaction * interaction = event->Summary();
   Kinematics * kinematics = interaction->KinePtr();
@@ -619,41 +624,18 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   double Q3 = 0.0; // magnitude of transfered 3 momentum
   double Q2 = 0.0; // properly Q^2 (Q squared) - transfered 4 momentum.
 
-  // Set lepton KE TMax for for throwing rndm in the accept/reject loop.
-  // We can accidentally set it too high, because the xsec will return zero.
-  // This way if someone reuses this code, they are not tripped up by it.
-  TMax = Enu - LepMass;
+  // Lepton kinetic energy and angle limits for throwing rndm in the
+  // accept/reject loop
+  this->NSVLeptonLimits(Enu, LepMass, TMin, TMax, CosthMin);
 
-  // Set Tmin for throwing rndm in the accept/reject loop
-  // the hadron tensors we expect will be limited in q3
-  // therefore also the outgoing lepton KE can't be too low or costheta too backward
-  // make the accept/reject loop more efficient by using Min values.
-  if(Enu < fQ3Max){
-    TMin = 0 ;
-    CosthMin = -1 ; 
-  } else {
-    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
-    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
-  }
+  // to save time, use a pre-calculated max cross-section XSecMax
+  // it doesn't matter what it is, as long as it is big enough.
+  double XSecMax = this->NSVXSecMax(Enu, TgtPDG);
+
+  // piecewise-constant envelope of the xsec in (T,Costh), if available
+  NSVEnvelope_t * envelope = (fNSVUseEnvelope && FullDeltaNodelta == 1) ?
+      this->NSVEnvelope(interaction, Enu) : 0;
 
-  // The accept/reject loop tests a rand against a maxxsec - must scale with A.
-  int NuclearA = 12;
-  double NuclearAfactorXSecMax = 1.0;
-  if (TgtPDG != kPdgTgtC12) {
-    if (TgtPDG > kPdgTgtFreeN && TgtPDG) {
-      NuclearA = pdg::IonPdgCodeToA(TgtPDG);
-      // The QE-like portion scales as A, but the Delta portion increases faster, not simple.
-      // so this gives additional safety factor.  Remember, we need a safe max, not precise max.
-      if (NuclearA < 12) NuclearAfactorXSecMax *= NuclearA / 12.0;
-      else NuclearAfactorXSecMax *= TMath::Power(NuclearA/12.0, 1.4);
-    } 
-    else {
-      LOG("MEC", pERROR) << "Trying to scale XSecMax for larger nuclei, but "
-          << TgtPDG << " isn't a nucleus?";
-      assert(false);
-    }
-  }
-  
   // -- Generate and Test the Kinematics----------------------------------//
 
   RandomGen * rnd = RandomGen::Instance();
@@ -675,9 +657,24 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
           throw exception;
       }
 
-      // generate random kinetic energy T and Costh
-      T = TMin + (TMax-TMin)*rnd->RndKine().Rndm();
-      Costh = CosthMin + (CosthMax-CosthMin)*rnd->RndKine().Rndm();
+      // generate random kinetic energy T and Costh: uniformly within an
+      // envelope cell selected according to its majorant, or uniformly
+      int    icell   = -1;
+      double XSecEnv = XSecMax;
+      if (envelope) {
+          double u = envelope->cdf.back() * rnd->Next(kRndStrKine);
+          icell = std::upper_bound(envelope->cdf.begin(), envelope->cdf.end(), u)
+                  - envelope->cdf.begin();
+          icell = TMath::Min(icell, kNSVEnvCells*kNSVEnvCells - 1);
+          int iT   = icell / kNSVEnvCells;
+          int icth = icell % kNSVEnvCells;
+          T     = TMin + (TMax-TMin) * (iT + rnd->Next(kRndStrKine)) / kNSVEnvCells;
+          Costh = CosthMin + (CosthMax-CosthMin) * (icth + rnd->Next(kRndStrKine)) / kNSVEnvCells;
+          XSecEnv = envelope->value[icell];
+      } else {
+          T = TMin + (TMax-TMin)*rnd->Next(kRndStrKine);
+          Costh = CosthMin + (CosthMax-CosthMin)*rnd->Next(kRndStrKine);
+      }
 
       // Calculate useful values for judging this choice
       Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));  // ok is sqrt(E2 - m2)
@@ -692,8 +689,6 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
           // decide whether to accept or reject these kinematics
           // AND set the chosen two-nucleon system
 
-          // to save time, use a pre-calculated max cross-section XSecMax
-          // it doesn't matter what it is, as long as it is big enough.
           // RIK asks can XSecMax can be pushed to the q0q3 part of the calculation
           // where the XS doesn't depend much on Enu.
           // instead, this implementation uses a rough dependence on log10(Enu).
@@ -703,12 +698,6 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
           if (FullDeltaNodelta == 1){ 
               // this block for the user who wants all CC QE-like 2p2h events
 
-              // extract xsecmax from the spline making process for C12 and other nuclei.
-              //  plot Log10(E) on horizontal and Log10(xsecmax) vertical
-              //  and fit a line.  Use that plus 1.35 safety factors to limit the accept/reject loop.
-              double XSecMax = 1.35 * TMath::Power(10.0, XSecMaxPar1 * TMath::Log10(Enu) - XSecMaxPar2);
-              if (NuclearA > 12) XSecMax *=  NuclearAfactorXSecMax;  // Scale it by A, precomputed above.
-
               LOG("MEC", pDEBUG) << " T, Costh: " << T << ", " << Costh ;
 
 
@@ -740,9 +729,13 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
 				   << " don't let this happen.";
               }
               assert(XSec <= XSecMax);
-              accept = XSec > XSecMax*rnd->RndKine().Rndm();
+              if (envelope && XSec > XSecEnv) {
+                  // the envelope is not a bound here: raise it
+                  this->RaiseNSVEnvelope(envelope, icell, XSec);
+              }
+              accept = XSec > XSecEnv*rnd->Next(kRndStrKine);
               LOG("MEC", pINFO) << "Xsec, Max, Accept: " << XSec << ", " 
-                  << XSecMax << ", " << accept; 
+                  << XSecEnv << ", " << accept; 
 
               if(accept){
                   // If it passes the All cross section we still need to do two things:
@@ -755,7 +748,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
                   bool isPDD = false;
 
                   // Find out if we should use a pn initial state
-                  double myrand = rnd->RndKine().Rndm();
+                  double myrand = rnd->Next(kRndStrKine);
                   double pnFraction = XSecPN / XSec;
                   LOG("MEC", pDEBUG) << "Test for pn: xsec_pn = " << XSecPN 
                       << "; xsec = " << XSec 
@@ -769,7 +762,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
                       interaction->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgClusterNP);
 
                       // Its a pn, so test for Delta by comparing DeltaPN/PN
-                      if (rnd->RndKine().Rndm() <= XSecDeltaPN / XSecPN) {
+                      if (rnd->Next(kRndStrKine) <= XSecDeltaPN / XSecPN) {
                           isPDD = true;
                       }
                   }
@@ -787,7 +780,7 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
                       }
                       // its not pn, so test for Delta (XSecDelta-XSecDeltaPN)/(XSec-XSecPN)
                       // right, both numerator and denominator are total not pn.
-                      if (rnd->RndKine().Rndm() <=
+                      if (rnd->Next(kRndStrKine) <=
                               (XSecDelta - XSecDeltaPN) / (XSec - XSecPN)) {
                           isPDD = true;
                       }
@@ -866,6 +859,190 @@ void MECGenerator::SelectNSVLeptonKinematics (GHepRecord * event) const
   LOG("MEC",pDEBUG) << "~~~ LEPTON DONE ~~~";
 }
 //___________________________________________________________________________
+void MECGenerator::NSVLeptonLimits(
+  double Enu, double LepMass, double & TMin, double & TMax, double & CosthMin) const
+{
+  // Set lepton KE TMax for for throwing rndm in the accept/reject loop.
+  // We can accidentally set it too high, because the xsec will return zero.
+  // This way if someone reuses this code, they are not tripped up by it.
+  TMax = Enu - LepMass;
+
+  // Set Tmin for throwing rndm in the accept/reject loop
+  // the hadron tensors we expect will be limited in q3
+  // therefore also the outgoing lepton KE can't be too low or costheta too backward
+  // make the accept/reject loop more efficient by using Min values.
+  if(Enu < fQ3Max){
+    TMin = 0 ;
+    CosthMin = -1 ; 
+  } else {
+    TMin = TMath::Sqrt(TMath::Power(LepMass, 2) + TMath::Power((Enu - fQ3Max), 2)) - LepMass;
+    CosthMin = TMath::Sqrt(1 - TMath::Power((fQ3Max / Enu ), 2));
+  }
+}
+//___________________________________________________________________________
+double MECGenerator::NSVXSecMax(double Enu, int TgtPDG) const
+{
+// Max XS for the accept/reject loop.
+// These need to lead to a number that is safely large enough, or crash the run.
+// This implementation uses a rough dependence on log10(Enu).
+// starting around 0.5 GeV, the log10(max) is linear vs. log10(Enu)
+
+  double XSecMaxPar1 = 2.2504;
+  double XSecMaxPar2 = 9.41158;
+
+  // The accept/reject loop tests a rand against a maxxsec - must scale with A.
+  int NuclearA = 12;
+  double NuclearAfactorXSecMax = 1.0;
+  if (TgtPDG != kPdgTgtC12) {
+    if (TgtPDG > kPdgTgtFreeN && TgtPDG) {
+      NuclearA = pdg::IonPdgCodeToA(TgtPDG);
+      // The QE-like portion scales as A, but the Delta portion increases faster, not simple.
+      // so this gives additional safety factor.  Remember, we need a safe max, not precise max.
+      if (NuclearA < 12) NuclearAfactorXSecMax *= NuclearA / 12.0;
+      else NuclearAfactorXSecMax *= TMath::Power(NuclearA/12.0, 1.4);
+    } 
+    else {
+      LOG("MEC", pERROR) << "Trying to scale XSecMax for larger nuclei, but "
+          << TgtPDG << " isn't a nucleus?";
+      assert(false);
+    }
+  }
+
+  // extract xsecmax from the spline making process for C12 and other nuclei.
+  //  plot Log10(E) on horizontal and Log10(xsecmax) vertical
+  //  and fit a line.  Use that plus 1.35 safety factors to limit the accept/reject loop.
+  double XSecMax = 1.35 * TMath::Power(10.0, XSecMaxPar1 * TMath::Log10(Enu) - XSecMaxPar2);
+  if (NuclearA > 12) XSecMax *=  NuclearAfactorXSecMax;  // Scale it by A
+
+  return XSecMax;
+}
+//___________________________________________________________________________
+double MECGenerator::NSVXSec(
+  Interaction * interaction, double Enu, double T, double Costh) const
+{
+// The (delta-less, all) xsec tested in the accept/reject loop, for the input
+// interaction with the given Enu and lepton kinematics
+
+  double LepMass = interaction->FSPrimLepton()->Mass();
+  double Plep = TMath::Sqrt( T * (T + (2.0 * LepMass)));
+  double Q3   = TMath::Sqrt(Plep*Plep + Enu*Enu - 2.0 * Plep * Enu * Costh);
+  if (Q3 >= fQ3Max) return 0.;
+
+  interaction->KinePtr()->SetKV(kKVTl, T);
+  interaction->KinePtr()->SetKV(kKVctl, Costh);
+
+  return fXSecModel->XSec(interaction, kPSTlctl);
+}
+//___________________________________________________________________________
+const vector<double> & MECGenerator::NSVEnvelopeEdge(
+  const Interaction * interaction, int iedge) const
+{
+// Xsec at the (kNSVEnvCells+1)^2 nodes of the envelope grid, at the Enu
+// bin edge iedge
+
+  NSVEnvelopeKey_t key(std::make_pair(
+     interaction->InitState().TgtPdg(), interaction->InitState().ProbePdg()), iedge);
+
+  map<NSVEnvelopeKey_t, vector<double> >::iterator it = fNSVEnvelopeEdges.find(key);
+  if (it != fNSVEnvelopeEdges.end()) return it->second;
+
+  vector<double> & xsec = fNSVEnvelopeEdges[key];
+
+  double Enu = TMath::Power(10., (double)iedge / kNSVEnvBinsPerDec);
+  double LepMass = interaction->FSPrimLepton()->Mass();
+  double TMin = 0, TMax = 0, CosthMin = -1, CosthMax = 1;
+  this->NSVLeptonLimits(Enu, LepMass, TMin, TMax, CosthMin);
+
+  Interaction scan(*interaction);
+  scan.InitStatePtr()->SetProbeE(Enu);
+  scan.InitStatePtr()->TgtPtr()->SetHitNucPdg(
+     (scan.InitState().ProbePdg() > 0) ? kPdgClusterNN : kPdgClusterPP);
+  scan.ExclTagPtr()->SetResonance(genie::kNoResonance);
+
+  const int n = kNSVEnvCells + 1;
+  xsec.assign(n*n, 0.);
+  if (TMax > TMin) {
+    for (int iT = 0; iT < n; iT++) {
+      double T = TMin + (TMax-TMin) * iT / kNSVEnvCells;
+      for (int icth = 0; icth < n; icth++) {
+        double Costh = CosthMin + (CosthMax-CosthMin) * icth / kNSVEnvCells;
+        xsec[iT*n+icth] = TMath::Max(0., this->NSVXSec(&scan, Enu, T, Costh));
+      }
+    }
+  }
+  return xsec;
+}
+//___________________________________________________________________________
+MECGenerator::NSVEnvelope_t * MECGenerator::NSVEnvelope(
+  const Interaction * interaction, double Enu) const
+{
+// Piecewise-constant envelope of the xsec for the Enu bin containing the
+// input Enu. The majorant of each cell is the safety factor times the max
+// xsec at the nodes of the cell and of its neighbours, at both Enu bin edges
+// (the grid is in Tl and cos(theta_l) normalized to their Enu-dependent
+// limits), capped at the max xsec used without envelope.
+// Returns 0 if the xsec vanishes at all nodes.
+
+  if (Enu <= 0.) return 0;
+
+  int ibin = TMath::FloorNint(kNSVEnvBinsPerDec * TMath::Log10(Enu));
+  int tgtpdg = interaction->InitState().TgtPdg();
+  NSVEnvelopeKey_t key(std::make_pair(
+     tgtpdg, interaction->InitState().ProbePdg()), ibin);
+
+  map<NSVEnvelopeKey_t, NSVEnvelope_t>::iterator it = fNSVEnvelopes.find(key);
+  if (it != fNSVEnvelopes.end()) {
+    return (it->second.cdf.back() > 0.) ? &(it->second) : 0;
+  }
+
+  const vector<double> & xsec_lo = this->NSVEnvelopeEdge(interaction, ibin);
+  const vector<double> & xsec_hi = this->NSVEnvelopeEdge(interaction, ibin+1);
+
+  NSVEnvelope_t & env = fNSVEnvelopes[key];
+  env.cap = this->NSVXSecMax(TMath::Power(10., (double)(ibin+1) / kNSVEnvBinsPerDec), tgtpdg);
+  env.value.assign(kNSVEnvCells*kNSVEnvCells, 0.);
+  env.cdf  .assign(kNSVEnvCells*kNSVEnvCells, 0.);
+
+  const int n = kNSVEnvCells + 1;
+  double sum = 0.;
+  for (int iT = 0; iT < kNSVEnvCells; iT++) {
+    for (int icth = 0; icth < kNSVEnvCells; icth++) {
+      double xmax = 0.;
+      for (int jT = TMath::Max(iT-1, 0); jT <= TMath::Min(iT+2, n-1); jT++) {
+        for (int jcth = TMath::Max(icth-1, 0); jcth <= TMath::Min(icth+2, n-1); jcth++) {
+          xmax = TMath::Max(xmax, TMath::Max(xsec_lo[jT*n+jcth], xsec_hi[jT*n+jcth]));
+        }
+      }
+      int icell = iT*kNSVEnvCells + icth;
+      env.value[icell] = TMath::Min(fNSVEnvelopeSafety * xmax, env.cap);
+      sum += env.value[icell];
+      env.cdf[icell] = sum;
+    }
+  }
+
+  LOG("MEC", pNOTICE)
+    << "Built the NSV lepton kinematics envelope for target " << tgtpdg
+    << ", probe " << key.first.second << ", Enu bin " << ibin
+    << " (Enu = " << TMath::Power(10., (double)ibin / kNSVEnvBinsPerDec) << " - "
+    << TMath::Power(10., (double)(ibin+1) / kNSVEnvBinsPerDec) << " GeV)";
+
+  return (sum > 0.) ? &env : 0;
+}
+//___________________________________________________________________________
+void MECGenerator::RaiseNSVEnvelope(
+  NSVEnvelope_t * env, int icell, double xsec) const
+{
+  double value = TMath::Min(fNSVEnvelopeSafety * xsec, env->cap);
+
+  LOG("MEC", pWARN)
+    << "Raising the NSV lepton kinematics envelope in cell " << icell
+    << ": " << env->value[icell] << " -> " << value;
+
+  double diff = value - env->value[icell];
+  env->value[icell] = value;
+  for (unsigned int i = icell; i < env->cdf.size(); i++) env->cdf[i] += diff;
+}
+//___________________________________________________________________________
 void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
 {
     // We need a kinematic limits accept/reject loop here, so generating the
@@ -985,7 +1162,7 @@ void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
 
         // Now write down the initial cluster four-vector for this choice
         TVector3 p3i = p31i + p32i;
-        double mass2 = PDGLibrary::Instance()->Find( initial_nucleon_cluster_pdg )->Mass();
+        double mass2 = PDGLibrary::Instance()->Mass( initial_nucleon_cluster_pdg );
         mass2 *= mass2;
         double energy = TMath::Sqrt(p3i.Mag2() + mass2);
         p4initial_cluster.SetPxPyPzE(p3i.Px(),p3i.Py(),p3i.Pz(),energy);
@@ -1011,7 +1188,7 @@ void MECGenerator::GenerateNSVInitialHadrons(GHepRecord * event) const
         // Test if the resulting four-vector corresponds to a high-enough invariant mass.
         // Fail the accept if we couldn't put this thing on-shell.
         if (p4final_cluster.M() < 
-                PDGLibrary::Instance()->Find(final_nucleon_cluster_pdg )->Mass()) {
+                PDGLibrary::Instance()->Mass(final_nucleon_cluster_pdg )) {
             accept = false;
         } else {
             accept = true;
@@ -1075,6 +1252,11 @@ void MECGenerator::LoadConfig(void)
     assert(fNuclModel);
 
     GetParam( "NSV-Q3Max", fQ3Max ) ;
+
+    GetParamDef( "NSV-UseEnvelope",    fNSVUseEnvelope,    true ) ;
+    GetParamDef( "NSV-EnvelopeSafety", fNSVEnvelopeSafety, 1.5  ) ;
+    fNSVEnvelopes.clear();
+    fNSVEnvelopeEdges.clear();
 }
 //___________________________________________________________________________
 
@@ -5,6 +5,11 @@
 
 \brief    Simulate the primary MEC interaction
 
+          For the Nieves, Simo, Vacas model, the lepton kinematics are
+          selected by rejection against a piecewise-constant envelope of the
+          cross section over a (Tl, cos(theta_l)) grid, built when first needed
+          for each target, probe and neutrino energy bin, and kept.
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -22,6 +27,9 @@
 #ifndef _MEC_GENERATOR_H_
 #define _MEC_GENERATOR_H_
 
+#include <map>
+#include <vector>
+
 #include <TGenPhaseSpace.h>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -31,6 +39,7 @@ namespace genie {
 
 class XSecAlgorithmI;
 class NuclearModelI;
+class Interaction;
 
 class MECGenerator : public EventRecordVisitorI {
 
@@ -60,12 +69,36 @@ private:
   void    SelectNSVLeptonKinematics         (GHepRecord * event) const;
   void    GenerateNSVInitialHadrons         (GHepRecord * event) const;
   PDGCodeList NucleonClusterConstituents    (int pdgc)           const;
-  
+
+  //! envelope of the NSV lepton kinematics xsec: majorant of the xsec in each
+  //! cell of a uniform grid in (Tl, cos(theta_l)) normalized to their limits
+  struct NSVEnvelope_t {
+    std::vector<double> value; ///< majorant in each cell [iT*ncells+icth]
+    std::vector<double> cdf;   ///< cumulative sum of the cell majorants
+    double              cap;   ///< max allowed majorant (see NSVXSecMax())
+  };
+  //! (target, probe) & Enu bin or bin edge
+  typedef std::pair< std::pair<int,int>, int > NSVEnvelopeKey_t;
+
+  void    NSVLeptonLimits (double Enu, double ml,
+                           double & TMin, double & TMax, double & CosthMin) const;
+  double  NSVXSecMax      (double Enu, int tgtpdg)                        const;
+  double  NSVXSec         (Interaction * interaction, double Enu,
+                           double T, double Costh)                         const;
+  NSVEnvelope_t *              NSVEnvelope     (const Interaction * interaction, double Enu) const;
+  const std::vector<double> &  NSVEnvelopeEdge (const Interaction * interaction, int iedge)   const;
+  void    RaiseNSVEnvelope(NSVEnvelope_t * env, int icell, double xsec)    const;
+
   mutable const XSecAlgorithmI * fXSecModel;
   mutable TGenPhaseSpace         fPhaseSpaceGenerator;
   const NuclearModelI *          fNuclModel;
 
   double fQ3Max;
+  bool   fNSVUseEnvelope;     ///< sample the NSV lepton kinematics against the envelope?
+  double fNSVEnvelopeSafety;  ///< safety factor applied on the scanned xsec maxima
+
+  mutable std::map<NSVEnvelopeKey_t, NSVEnvelope_t>       fNSVEnvelopes;     ///< per Enu bin
+  mutable std::map<NSVEnvelopeKey_t, std::vector<double> > fNSVEnvelopeEdges; ///< xsec at the grid nodes per Enu bin edge
 };
 
 }      // genie namespace
@@ -9,11 +9,19 @@
 //_________________________________________________________________________
 
 #include <cstdlib>
+#include <cstring>
+#include <cstdio>
 #include <string>
 #include <fstream>
 #include <cassert>
 #include <algorithm>
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <stdint.h>
+
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/Spline.h"
@@ -21,6 +29,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Numerical/BLI2D.h"
+#include "Framework/Utils/SystemUtils.h"
 #include "Physics/Multinucleon/XSection/MECHadronTensor.h"
 
 #include <TSystem.h>
@@ -33,6 +42,48 @@ using std::ios;
 using namespace genie;
 using namespace genie::constants;
 
+//_________________________________________________________________________
+// Layout of the binary tensor tables of a target (all numbers in native byte
+// order, which is checked at load time using the byte-order mark):
+//   header
+//   data : tensor values z[ntypes][ncomponents][nqz*nq0], the q0 index
+//          running fastest, on the uniform grid given in the header
+//
+namespace {
+  const char     kMECBinMagic[8] = { 'G','M','E','C','T','N','S','R' };
+  const uint32_t kMECBinVersion  = 1;
+  const uint32_t kMECBinBOM      = 0x01020304;
+
+  struct MECBinHeader_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t bom;
+    uint32_t ntypes;       // # of tensor types (in MECHadronTensorType_t order)
+    uint32_t ncomponents;  // # of tensor components per type
+    uint32_t nqz;          // # of |q| nodes
+    uint32_t nq0;          // # of q0 nodes
+    uint64_t fingerprint;  // hash of the text tables the file was built from
+    uint64_t file_size;
+    double   qzmin, qzmax; // |q| range (GeV)
+    double   q0min, q0max; // q0 range (GeV)
+  };
+
+  // text tables: 120x120 grids in 10 MeV steps, 5 tensor components
+  const int    kNTensorComponents = 5;
+  const int    kNq0Points         = 120;
+  const int    kNqzPoints         = 120;
+  const double kArrayStep         = 0.01; // GeV
+
+  // 64-bit FNV-1a hash
+  void fnv1a(uint64_t & hash, const char * data, size_t n)
+  {
+    for(size_t i = 0; i < n; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+}
+
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::fgInstance = 0;
 //_________________________________________________________________________
@@ -57,34 +108,31 @@ MECHadronTensor::MECHadronTensor()
   // likewise never want Rf208, I used the density for Pb208
   // likewise never want Ba112, I used the density for Cd112
 
-  // this one loads all known targets when instantiated, regardless of what the user wants.
-  // is there a point to being efficient, check if the requested one is loaded ?
-  // TODO  there is a fail if the spline file is missing one of the known targets
-  // and the user requests a mix of two targets.
-  vector<int>::const_iterator it=fKnownTensors.begin();
-  for( ; it!=fKnownTensors.end(); ++it) {
-    this->LoadTensorTables(*it);
-    // this method will fail silently if the target list here does not match later.   
-  }  
+  // tables are loaded when first requested (see TensorTable())
   fgInstance = 0;
 }
 //_________________________________________________________________________
 MECHadronTensor::~MECHadronTensor()
 {
-	vector<int>::const_iterator it=fKnownTensors.begin();
-	for( ; it!=fKnownTensors.end(); ++it) {
-		MECHadronTensor::MECHadronTensorTable table = fTargetTensorTables[*it];
-		for(int tensorType = 0; tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
-			vector<genie::BLI2DNonUnifGrid*> Grids = table.Table[(MECHadronTensor::MECHadronTensorType_t)tensorType];
-			for (vector<genie::BLI2DNonUnifGrid*>::iterator gridit = Grids.begin() ; gridit != Grids.end(); ++gridit){
-				genie::BLI2DNonUnifGrid *hadTensorGrid = *gridit;
-				if(hadTensorGrid) {
-				  delete hadTensorGrid;
-				  hadTensorGrid=0;
-				}
-			}
-		}
-	}  
+  map<int, MECHadronTensorTable>::iterator it = fTargetTensorTables.begin();
+  for( ; it != fTargetTensorTables.end(); ++it) {
+    map<MECHadronTensorType_t, vector<genie::BLI2DUnifGrid *> > & table =
+       it->second.Table;
+    map<MECHadronTensorType_t, vector<genie::BLI2DUnifGrid *> >::iterator
+       tit = table.begin();
+    for( ; tit != table.end(); ++tit) {
+      for(unsigned int i = 0; i < tit->second.size(); i++) {
+        delete tit->second[i];
+      }
+      tit->second.clear();
+    }
+  }
+  fTargetTensorTables.clear();
+
+  for(unsigned int i = 0; i < fBinFiles.size(); i++) {
+    munmap(fBinFiles[i].first, fBinFiles[i].second);
+  }
+  fBinFiles.clear();
 }
 //_________________________________________________________________________
 MECHadronTensor * MECHadronTensor::Instance()
@@ -121,116 +169,297 @@ bool MECHadronTensor::KnownTensor(int targetpdg)
   return std::count(fKnownTensors.begin(), fKnownTensors.end(), targetpdg)!=0;  
 }
 //_________________________________________________________________________
-const vector<genie::BLI2DNonUnifGrid *> &
+const vector<genie::BLI2DUnifGrid *> &
    MECHadronTensor::TensorTable(int targetpdg, MECHadronTensorType_t type)
 {
+  if(fTargetTensorTables.find(targetpdg) == fTargetTensorTables.end()) {
+    this->LoadTensorTables(targetpdg);
+  }
   return fTargetTensorTables[targetpdg].Table[type];
 }
 //_________________________________________________________________________
-void MECHadronTensor::LoadTensorTables(int targetpdg)
+string MECHadronTensor::DataDir(void) const
 {
-// Load the hadron tensor tables.
-// For the Nieves model they are in ${GENIE}/data/evgen/mectensor/nieves/
-  
-  // define dimensions of data in the hadron tensor files
-  int nwpoints = 5;
-  const int nq0points = 120;  
-  const int nqzpoints = 120;  
-  const int nq0qzpoints = nq0points*nqzpoints;
-  double arraystep = 0.01; // GeV
-  // if later we use tables that are not 120x120
-  // then extract these constants to the config file with the input table specs
-  // or find a way for the input tables to be self-descriptive.
-
-  string tensorLocation  = string("/data/evgen/mectensor/nieves");
-  string tensorFileStart = "HadTensor120-Nieves-";
-  string tensorFileEnd   = "-20150210.dat";
+// The hadron tensor tables for the Nieves model are in
+// ${GENIE}/data/evgen/mectensor/nieves/
+// Ideally, the xml configuration can override the default location
+
+  return string(gSystem->Getenv("GENIE")) + "/data/evgen/mectensor/nieves";
+}
+//_________________________________________________________________________
+string MECHadronTensor::TextFile(
+  int targetpdg, MECHadronTensorType_t type) const
+{
+  // possible future feature, allow a model to not deliver Delta tensors.
+  const char * tensorTypeNames[] = { "FullAll", "Fullpn", "DeltaAll", "Deltapn" };
+
+  ostringstream datafile;
+  datafile << this->DataDir() << "/HadTensor120-Nieves-" << targetpdg << "-"
+           << tensorTypeNames[type] << "-20150210.dat";
+  return datafile.str();
+}
+//_________________________________________________________________________
+string MECHadronTensor::BinaryTableFile(int targetpdg) const
+{
+// Binary tables are looked up in $GMECTENSORBINDIR, if set, in the shared
+// data directory, if set, or next to the text tables
+
+  string dir = utils::system::SharedDataDir();
+  if(gSystem->Getenv("GMECTENSORBINDIR")) {
+    dir = string(gSystem->Getenv("GMECTENSORBINDIR"));
+  }
+  else if(dir.size() == 0) {
+    dir = this->DataDir();
+  }
+
+  ostringstream binfile;
+  binfile << dir << "/HadTensor120-Nieves-" << targetpdg << "-20150210.gmecbin";
+  return binfile.str();
+}
+//_________________________________________________________________________
+unsigned long long MECHadronTensor::TextFingerprint(int targetpdg) const
+{
+// Hash of the contents of the text tables of a target (the source of truth
+// for the binary tables)
+
+  uint64_t hash = 14695981039346656037ULL;
+  vector<char> buffer;
+  for(int tensorType = 0;
+          tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
+    string filename = this->TextFile(targetpdg, (MECHadronTensorType_t)tensorType);
+    std::ifstream in(filename.c_str(), ios::in | ios::binary);
+    in.seekg(0, ios::end);
+    std::streamoff size = in.tellg();
+    if(size <= 0) continue;
+    buffer.resize(size);
+    in.seekg(0, ios::beg);
+    in.read(&buffer[0], size);
+    fnv1a(hash, &buffer[0], size);
+  }
+  return hash;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::LoadTensorTables(int targetpdg)
+{
+// Load the hadron tensor tables of the input target.
 
   if(!KnownTarget(targetpdg)){
     LOG("MECHadronTensor", pERROR) 
       << "No MEC tensor table for target with PDG code: " 
       << targetpdg;
-    return;
+    return false;
   }
 
-  // define directory of hadron tensor files
-  // Ideally, the xml configuration can override the default location
-  string data_dir = string(gSystem->Getenv("GENIE")) + tensorLocation;
+  if(this->LoadBinaryTables(targetpdg, this->BinaryTableFile(targetpdg))) {
+    return true;
+  }
 
   // define arrays to fill from data files
-  double hadtensor_q0_array[nq0points];
-  double hadtensor_qz_array[nqzpoints];
-  double hadtensor_w_array[nwpoints][nq0qzpoints];
-
-  // fill q0 array (in GeV)
   // 240 5MeV bins or 120 10 MeV bins
-  for (int a = 0; a < nq0points; a++){
-    hadtensor_q0_array[a]=double(a+1)*arraystep;
-  }
-
-  // fill qz array (in GeV)
-  for (int a = 0; a < nqzpoints; a++){
-    hadtensor_qz_array[a]=double(a+1)*arraystep;
-  }
-  
-  // possible future feature, allow a model to not deliver Delta tensors.
-  std::map<MECHadronTensor::MECHadronTensorType_t, std::string> tensorTypeNames;
-  tensorTypeNames[MECHadronTensor::kMHTValenciaFullAll]  = "FullAll";
-  tensorTypeNames[MECHadronTensor::kMHTValenciaFullpn]   = "Fullpn";
-  tensorTypeNames[MECHadronTensor::kMHTValenciaDeltaAll] = "DeltaAll";
-  tensorTypeNames[MECHadronTensor::kMHTValenciaDeltapn]  = "Deltapn";
+  // if later we use tables that are not 120x120 then extract these
+  // constants to the config file or use binary (self-descriptive) tables
+  double qzmin = kArrayStep, qzmax = kNqzPoints*kArrayStep; // GeV
+  double q0min = kArrayStep, q0max = kNq0Points*kArrayStep; // GeV
+  vector< vector<double> > hadtensor_w_array;
 
-  // iterate over all four hadron tensor types in the map above.
+  // iterate over all four hadron tensor types
   for(int tensorType = 0; 
           tensorType <= MECHadronTensor::kMHTValenciaDeltapn; ++tensorType) {
 
-    // build filenames from the bits of string
-    ostringstream datafile;
-    datafile << data_dir << "/" << tensorFileStart << targetpdg << "-" 
-	     << tensorTypeNames[(MECHadronTensor::MECHadronTensorType_t)tensorType]
-	     << tensorFileEnd;
+    string datafile = this->TextFile(targetpdg, (MECHadronTensorType_t)tensorType);
 
     // make sure data files are available
     LOG("MECHadronTensor", pDEBUG) 
-       << "Asserting that file " << datafile.str().c_str() << " exists...";      
-    assert (! gSystem->AccessPathName(datafile.str().c_str()));
+       << "Asserting that file " << datafile << " exists...";      
+    assert (! gSystem->AccessPathName(datafile.c_str()));
   
     // read data file
     ReadHadTensorqzq0File(
-      datafile.str(), nwpoints, nqzpoints, nq0points, hadtensor_w_array
+      datafile, kNTensorComponents, kNqzPoints, kNq0Points, hadtensor_w_array
     );
   
     //loop over all 5 tensors 
-    for (int i = 0; i < nwpoints; i++){
+    for (int i = 0; i < kNTensorComponents; i++){
    
-      // create a non uniform grid from tensor data
-      genie::BLI2DNonUnifGrid *hadTensorGrid = 
-           new genie::BLI2DNonUnifGrid(
-               nqzpoints, 
-               nq0points, 
-               hadtensor_qz_array, 
-               hadtensor_q0_array, 
-               hadtensor_w_array[i]
-           );
+      // create a uniform grid from tensor data
+      genie::BLI2DUnifGrid *hadTensorGrid = 
+           new genie::BLI2DUnifGrid(
+               kNqzPoints, qzmin, qzmax, kNq0Points, q0min, q0max);
+      for(int iqz = 0; iqz < kNqzPoints; iqz++) {
+        for(int iq0 = 0; iq0 < kNq0Points; iq0++) {
+          hadTensorGrid->AddPoint(hadTensorGrid->X(iqz), hadTensorGrid->Y(iq0),
+                                  hadtensor_w_array[i][iqz*kNq0Points+iq0]);
+        }
+      }
 
       // and store in a map using the target PDG as a key
       fTargetTensorTables[targetpdg].Table[
          (MECHadronTensor::MECHadronTensorType_t)tensorType].push_back(hadTensorGrid);
     }
   }
+
+  // publish the tables for the other jobs of the node to map them
+  if(!gSystem->Getenv("GMECTENSORBINDIR") &&
+     utils::system::SharedDataDir().size() > 0) {
+    this->SaveBinaryTables(targetpdg, this->BinaryTableFile(targetpdg));
+  }
+  return true;
 }
 //_________________________________________________________________________
-void MECHadronTensor::ReadHadTensorqzq0File( 
+bool MECHadronTensor::LoadBinaryTables(int targetpdg, string filename)
+{
+// Load the binary tables written by SaveBinaryTables(), if there are and
+// they were built from the current text tables. Returns false otherwise.
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) return false;
+
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(MECBinHeader_t)) {
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void * mem = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(mem == MAP_FAILED) return false;
+
+  const char * base = (const char *) mem;
+  const MECBinHeader_t * header = (const MECBinHeader_t *) base;
+  uint64_t nvalues = (uint64_t) header->ntypes * header->ncomponents *
+                                header->nqz    * header->nq0;
+  bool valid =
+     memcmp(header->magic, kMECBinMagic, sizeof(header->magic)) == 0 &&
+     header->version     == kMECBinVersion &&
+     header->bom         == kMECBinBOM     &&
+     header->file_size   == size           &&
+     header->file_size   == sizeof(MECBinHeader_t) + nvalues*sizeof(double) &&
+     header->ntypes      == (uint32_t) MECHadronTensor::kMHTValenciaDeltapn + 1 &&
+     header->ncomponents == (uint32_t) kNTensorComponents &&
+     header->nqz > 1 && header->nq0 > 1;
+  if(!valid) {
+    LOG("MECHadronTensor", pWARN)
+      << "Ignoring invalid or incompatible MEC hadron tensor file: " << filename;
+    munmap(mem, size);
+    return false;
+  }
+  if(header->fingerprint != this->TextFingerprint(targetpdg)) {
+    LOG("MECHadronTensor", pWARN)
+      << "Ignoring outdated MEC hadron tensor file: " << filename
+      << " (the text tables in " << this->DataDir() << " have changed)";
+    munmap(mem, size);
+    return false;
+  }
+
+  int nqz = header->nqz;
+  int nq0 = header->nq0;
+  const double * z = (const double *) (base + sizeof(MECBinHeader_t));
+
+  // the grids of shared tables use the mapped values, kept mapped (read-only,
+  // so all the processes mapping the file share the same physical pages)
+  bool shared = (utils::system::SharedDataDir().size() > 0);
+
+  MECHadronTensorTable & table = fTargetTensorTables[targetpdg];
+  for(unsigned int tensorType = 0; tensorType < header->ntypes; ++tensorType) {
+    vector<genie::BLI2DUnifGrid *> & grids =
+       table.Table[(MECHadronTensor::MECHadronTensorType_t)tensorType];
+    for(unsigned int i = 0; i < header->ncomponents; i++) {
+      genie::BLI2DUnifGrid * grid = new genie::BLI2DUnifGrid(
+         nqz, header->qzmin, header->qzmax, nq0, header->q0min, header->q0max);
+      if(shared) {
+        grid->ShareZ(z);
+        z += nqz*nq0;
+      } else {
+        for(int iqz = 0; iqz < nqz; iqz++) {
+          for(int iq0 = 0; iq0 < nq0; iq0++, z++) {
+            grid->AddPoint(grid->X(iqz), grid->Y(iq0), *z);
+          }
+        }
+      }
+      grids.push_back(grid);
+    }
+  }
+  if(shared) fBinFiles.push_back(pair<void *, size_t>(mem, size));
+  else       munmap(mem, size);
+
+  LOG("MECHadronTensor", pINFO)
+    << "Loaded the MEC hadron tensors for target " << targetpdg
+    << " from: " << filename << ((shared) ? " (shared)" : "");
+  return true;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::SaveBinaryTables(int targetpdg, string filename)
+{
+// Save the hadron tensor tables of the input target in a binary file that
+// is loaded instead of the text tables. The file is written under a
+// temporary name and then renamed, so that jobs never read it partially
+// written.
+
+  const vector<genie::BLI2DUnifGrid *> & first =
+     this->TensorTable(targetpdg, MECHadronTensor::kMHTValenciaFullAll);
+  if(first.empty()) return false;
+
+  MECBinHeader_t header;
+  memcpy(header.magic, kMECBinMagic, sizeof(header.magic));
+  header.version     = kMECBinVersion;
+  header.bom         = kMECBinBOM;
+  header.ntypes      = MECHadronTensor::kMHTValenciaDeltapn + 1;
+  header.ncomponents = first.size();
+  header.nqz         = first[0]->NX();
+  header.nq0         = first[0]->NY();
+  header.fingerprint = this->TextFingerprint(targetpdg);
+  header.qzmin       = first[0]->XMin();
+  header.qzmax       = first[0]->XMax();
+  header.q0min       = first[0]->YMin();
+  header.q0max       = first[0]->YMax();
+
+  vector<double> data;
+  for(unsigned int tensorType = 0; tensorType < header.ntypes; ++tensorType) {
+    const vector<genie::BLI2DUnifGrid *> & grids = this->TensorTable(
+        targetpdg, (MECHadronTensor::MECHadronTensorType_t)tensorType);
+    if(grids.size() != header.ncomponents) return false;
+    for(unsigned int i = 0; i < grids.size(); i++) {
+      for(unsigned int iqz = 0; iqz < header.nqz; iqz++) {
+        for(unsigned int iq0 = 0; iq0 < header.nq0; iq0++) {
+          data.push_back(grids[i]->Z(iqz,iq0));
+        }
+      }
+    }
+  }
+  header.file_size = sizeof(MECBinHeader_t) + data.size() * sizeof(double);
+
+  ostringstream tmpname;
+  tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+  std::ofstream out(tmpname.str().c_str(), ios::out | ios::binary);
+  out.write((const char *) &header, sizeof(header));
+  out.write((const char *) &data[0], data.size() * sizeof(double));
+  out.close();
+
+  if(out.fail() || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    LOG("MECHadronTensor", pERROR)
+      << "Could not write the MEC hadron tensor file: " << filename;
+    std::remove(tmpname.str().c_str());
+    return false;
+  }
+  LOG("MECHadronTensor", pNOTICE)
+    << "Wrote the MEC hadron tensors for target " << targetpdg
+    << " in: " << filename << " (" << header.file_size << " bytes)";
+  return true;
+}
+//_________________________________________________________________________
+bool MECHadronTensor::ReadHadTensorqzq0File( 
   string filename, int nwpoints, int nqzpoints, int nq0points, 
-  double hadtensor_w_array[][14400])
+  vector< vector<double> > & hadtensor_w_array)
 {
+  hadtensor_w_array.assign(nwpoints, vector<double>(nqzpoints*nq0points, 0.));
+
   // open file
   std::ifstream tensor_stream(filename.c_str(), ios::in);
 
   // check file exists
   if(!tensor_stream.good()){
     LOG("MECHadronTensor", pERROR) << "Bad file name: " << filename;
-    return;
+    return false;
   }
 
   double temp;  
@@ -240,5 +469,6 @@ void MECHadronTensor::ReadHadTensorqzq0File(
       hadtensor_w_array[k][ij]=temp;
     }
   }
+  return true;
 }
 //_________________________________________________________________________
@@ -10,6 +10,18 @@
 \author   Code contributed by Jackie Schwehr
           Substantial refactorization by the core GENIE group.
 
+          Tables are loaded on demand, the first time the tensors of a target
+          are requested, and interpolated on uniform (|q|, q0) grids.
+          The tables of each target are read from a binary file (a self-
+          describing header holding the grid dimensions and ranges, followed
+          by the tensor values), memory-mapped at load time, if one matching
+          the text tables is found. Otherwise the text tables are read.
+          Binary files are written by SaveBinaryTables() (see gmectensor2bin).
+          If the shared data directory is set (see $GSHAREDATA), the binary
+          file of each target is written there by the first job to read the
+          text tables, and the jobs loading it interpolate on the mapped
+          values in place, sharing a single copy of the tables per node.
+
 \ref      Hadron tensors used here are those computed by the following models:
           
           J. Nieves, I. Ruiz Simo, M.J. Vicente Vacas,
@@ -29,6 +41,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <utility>
 
 #ifndef ROOT_Rtypes
 #include "Rtypes.h"
@@ -39,6 +52,7 @@
 using std::map;
 using std::vector;
 using std::string;
+using std::pair;
 
 namespace genie {
 
@@ -67,8 +81,8 @@ public:
   {
   public:
      MECHadronTensorTable() { }
-    ~MECHadronTensorTable() { /* note: should delete the grids! */ }
-     map<MECHadronTensor::MECHadronTensorType_t, vector<genie::BLI2DNonUnifGrid *> > Table;
+    ~MECHadronTensorTable() { /* note: grids are deleted by MECHadronTensor */ }
+     map<MECHadronTensor::MECHadronTensorType_t, vector<genie::BLI2DUnifGrid *> > Table;
   };
 
   // ................................................................
@@ -81,10 +95,18 @@ public:
   // method to return whether the targetpdg is in fKnownTensors
   bool KnownTensor(int targetpdg);
 
-  // method to access a specific set of tables
-  const vector<genie::BLI2DNonUnifGrid *> &
+  // targets with explicit tensor tables
+  const vector<int> & KnownTensors(void) const { return fKnownTensors; }
+
+  // method to access a specific set of tables (loaded at the first call)
+  const vector<genie::BLI2DUnifGrid *> &
      TensorTable(int targetpdg, MECHadronTensor::MECHadronTensorType_t type);
 
+  // binary tensor tables: default file name for a target & writing them
+  // (the tables are loaded from the text files, if needed)
+  string BinaryTableFile  (int targetpdg) const;
+  bool   SaveBinaryTables (int targetpdg, string filename);
+
 private:
 
   // Ctors & dtor
@@ -95,20 +117,28 @@ private:
   // Self
   static MECHadronTensor * fgInstance;
 
-  // Load available hadron tensor tables.
-  // NOTES: All tables are loaded by the ctor - Consider loading them on demand.
-  //        This will also need to be extended to load tensors for requested model.
-  void LoadTensorTables(int targetpdg);
+  // Load the hadron tensor tables of a target (from the binary file, if
+  // there is one matching the text files, or from the text files).
+  // This will also need to be extended to load tensors for requested model.
+  bool LoadTensorTables (int targetpdg);
+  bool LoadBinaryTables (int targetpdg, string filename);
 
-  // This map holds all known tensor tables (target PDG code is the key)
+  // This map holds all loaded tensor tables (target PDG code is the key)
   std::map<int, MECHadronTensorTable> fTargetTensorTables;
 
+  // binary files used in place (shared tables), unmapped at exit
+  vector< pair<void *, size_t> > fBinFiles;
+
   // List of targets for which we can provide a calculation
   // some known targets use scale from the tensor table from another target.
   std::vector<int> fKnownTensors;
 
-  // that array size 14400 is 120x120.  Could go dynamic in the future, or not.
-  void ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints, int nq0points, double hadtensor_w_array[][14400]);
+  // text hadron tensor tables
+  string DataDir      (void) const;
+  string TextFile     (int targetpdg, MECHadronTensorType_t type) const;
+  unsigned long long TextFingerprint (int targetpdg) const;
+  bool   ReadHadTensorqzq0File(string filename, int nwpoints, int nqzpoints,
+                               int nq0points, vector< vector<double> > & hadtensor_w_array);
 
   // singleton cleaner
   struct Cleaner {
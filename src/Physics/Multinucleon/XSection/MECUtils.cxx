@@ -268,11 +268,15 @@ double genie::utils::mec::TensorContraction(
     v4q.SetZ(v4Nu.Z() - v4lep.Z());
     
     MECHadronTensor * hadtensor = MECHadronTensor::Instance();
-    const vector <genie::BLI2DNonUnifGrid *> &
+    const vector <genie::BLI2DUnifGrid *> &
          tensor_table = hadtensor->TensorTable(tensorpdg, tensor_type);
     
+    // tensors outside the tabulated range are taken at the range edges
+    const genie::BLI2DUnifGrid * grid0 = tensor_table[0];
+    double qz_eval = TMath::Min(TMath::Max(v4q.Vect().Mag(), grid0->XMin()), grid0->XMax());
+    double q0_eval = TMath::Min(TMath::Max(v4q.E(),          grid0->YMin()), grid0->YMax());
     for (int i=0 ; i < 5; i++){
-      wtotd[i] = tensor_table[i]->Evaluate(v4q.Vect().Mag(),v4q.E());
+      wtotd[i] = tensor_table[i]->Evaluate(qz_eval,q0_eval);
     }
     
     // calculate hadron tensor components
@@ -33,6 +33,7 @@
 #include "Framework/Utils/Range1.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/ScopeProfiler.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -60,6 +61,7 @@ MECXSec::~MECXSec()
 double MECXSec::Integrate(
       const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(in) ) return 0.;
   
   const KPhaseSpace & kps = in->PhaseSpace(); // only OK phase space for this
@@ -95,12 +97,8 @@ double MECXSec::Integrate(
   double abstol = 1; //We mostly care about relative tolerance.
   ROOT::Math::IBaseFunctionMultiDim * func = 
         new utils::gsl::d2Xsec_dTCosth(model, interaction);
-  ROOT::Math::IntegrationMultiDim::Type ig_type = 
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);        
-  ROOT::Math::IntegratorMultiDim ig(
-    *func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
   
-  xsec = ig.Integral(kine_min, kine_max); 
+  xsec = this->IntegrateNDim(*func, kine_min, kine_max, abstol); 
 
   delete func;
   delete interaction;   
@@ -132,6 +130,7 @@ void MECXSec::LoadConfig(void)
   fGSLMaxEval    = (unsigned int) max ;
 
   GetParamDef( "gsl-relative-tolerance", fGSLRelTol, 0.01 ) ;
+  BindParamDef( fGSLNWorkers, "gsl-integration-workers", 0 ) ;
   GetParamDef( "split-integral", fSplitIntegral, true ) ;
 
 }
@@ -140,7 +139,7 @@ void MECXSec::LoadConfig(void)
 //____________________________________________________________________________
 genie::utils::gsl::d2Xsec_dTCosth::d2Xsec_dTCosth(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -184,5 +183,23 @@ ROOT::Math::IBaseFunctionMultiDim *
     new genie::utils::gsl::d2Xsec_dTCosth(fModel,fInteraction);
 }
 //____________________________________________________________________________
+bool genie::utils::gsl::d2Xsec_dTCosth::BatchSetup(
+    const XSecAlgorithmI * & model, const Interaction * & in,
+    KinePhaseSpace_t & kps, double & scale) const
+{
+  model = fModel;
+  in    = fInteraction;
+  kps   = kPSTlctl;
+  scale = 1.;
+  return true;
+}
+//____________________________________________________________________________
+void genie::utils::gsl::d2Xsec_dTCosth::SetBatchKinematics(
+    Interaction * in, const double * xin) const
+{
+  in->KinePtr()->SetKV(kKVTl,  xin[0]);
+  in->KinePtr()->SetKV(kKVctl, xin[1]);
+}
+//____________________________________________________________________________
 
 
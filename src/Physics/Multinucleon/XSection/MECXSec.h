@@ -21,6 +21,7 @@
 #ifndef _MEC_XSEC_H_
 #define _MEC_XSEC_H_
 
+#include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 
 #include <Math/Integrator.h>
@@ -63,7 +64,7 @@ private:
  namespace utils {
   namespace gsl   {
 
-   class d2Xsec_dTCosth: public ROOT::Math::IBaseFunctionMultiDim
+   class d2Xsec_dTCosth: public XSecFuncMultiDim
    {
     public:
       d2Xsec_dTCosth(const XSecAlgorithmI * m, const Interaction * i);
@@ -72,6 +73,11 @@ private:
       unsigned int                        NDim   (void)               const;
       double                              DoEval (const double * xin) const;
       ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+    protected:
+      // genie::utils::gsl::XSecFuncMultiDim batch evaluation
+      bool BatchSetup         (const XSecAlgorithmI * & model, const Interaction * & in,
+                               KinePhaseSpace_t & kps, double & scale) const;
+      void SetBatchKinematics (Interaction * in, const double * xin) const;
     private:
       const XSecAlgorithmI * fModel;
       const Interaction *    fInteraction;
@@ -47,10 +47,44 @@ double NievesSimoVacasMECPXSec2016::XSec(
 {
 // The basic quantity calculated is d2sigma/(dTmu dcos_mu)
 
+    TargetSetup_t setup;
+    if( ! this->SetupTarget(interaction->InitState().Tgt().Pdg(), setup) ) {
+        return 0;
+    }
+    return this->XSecTarget(interaction, kps, setup);
+}
+//_________________________________________________________________________
+void NievesSimoVacasMECPXSec2016::XSecBatch(
+  unsigned int n, const Interaction * const * in,
+  KinePhaseSpace_t kps, double * xsec) const
+{
+// The hadron tensor choice and the pair scaling factors only depend on the
+// target, so they are set up once for all the points of a batch with the
+// same target (all of them, for the batches of the integrator)
+
+    TargetSetup_t setup;
+    int  setup_pdg = 0;
+    bool setup_ok  = false;
+    for(unsigned int i = 0; i < n; i++) {
+        int targetpdg = in[i]->InitState().Tgt().Pdg();
+        if(targetpdg != setup_pdg) {
+            setup_ok  = this->SetupTarget(targetpdg, setup);
+            setup_pdg = targetpdg;
+        }
+        xsec[i] = (setup_ok) ? this->XSecTarget(in[i], kps, setup) : 0.;
+    }
+}
+//_________________________________________________________________________
+bool NievesSimoVacasMECPXSec2016::SetupTarget(
+  int targetpdg, TargetSetup_t & setup) const
+{
+// Selects the hadron tensor used for the input target and the factors
+// scaling the pp, nn and pn pair contributions from the tensor nucleus.
+// Returns false if the model doesn't handle the target.
+
     // Get hadron tensor
     MECHadronTensor * hadtensor = MECHadronTensor::Instance();
 
-    int targetpdg = interaction->InitState().Tgt().Pdg();
     int Arequest = pdg::IonPdgCodeToA(targetpdg);
     int Zrequest = pdg::IonPdgCodeToZ(targetpdg);
 
@@ -86,7 +120,7 @@ double NievesSimoVacasMECPXSec2016::XSec(
             MAXLOG("NievesSimoVacasMEC", pWARN, 10)
                 << "Asked to scale to deuterium through boron "
                 << targetpdg << " nope, lets not do that.";
-            return 0;
+            return false;
         }
         else if( Arequest >= 9 && Arequest < 15){
             tensorpdg = kPdgTgtC12;
@@ -122,10 +156,42 @@ double NievesSimoVacasMECPXSec2016::XSec(
             MAXLOG("NievesSimoVacasMEC", pWARN, 10) 
                 << "Asked to scale to a nucleus " 
                 << targetpdg << " which we don't know yet.";
-            return 0;
+            return false;
         }  
     }
 
+    setup.tensorpdg = tensorpdg;
+    setup.range     = hadtensor->TensorTable(
+                tensorpdg, MECHadronTensor::kMHTValenciaFullAll)[0];
+
+    // now again, run this only if targetpdg != tensorpdg.
+    // would need to trap and treat He3, T, D special here.
+    setup.scale = ! hadtensor->KnownTensor(targetpdg);
+    if(setup.scale) {
+        // if we need to scale, figure it out here.
+
+        double PP = Zrequest;
+        double NN = Arequest - PP;
+        double P  = pdg::IonPdgCodeToZ(tensorpdg);
+        double N  = pdg::IonPdgCodeToA(tensorpdg) - P;
+
+        setup.scale_pn = TMath::Sqrt( (PP*NN)/(P*N) );
+        setup.scale_pp = TMath::Sqrt( (PP * (PP - 1.)) / (P * (P - 1.)) );
+        setup.scale_nn = TMath::Sqrt( (NN * (NN - 1.)) / (N * (N - 1.)) );
+
+        LOG("NievesSimoVacasMEC", pDEBUG) 
+            << "Scale pn pp nn for (" << targetpdg << ", " << tensorpdg << ")"
+            << " : " << setup.scale_pn << " " << setup.scale_pp << " " << setup.scale_nn;
+    }
+    return true;
+}
+//_________________________________________________________________________
+double NievesSimoVacasMECPXSec2016::XSecTarget(
+  const Interaction * interaction, KinePhaseSpace_t kps,
+  const TargetSetup_t & setup) const
+{
+    int tensorpdg = setup.tensorpdg;
+
     // Check that the input kinematical point is within the range
     // in which hadron tensors are known (for chosen target)
     double Ev    = interaction->InitState().ProbeE(kRfLab);
@@ -135,13 +201,10 @@ double NievesSimoVacasMECPXSec2016::XSec(
     double Q0    = 0;
     double Q3    = 0;
     genie::utils::mec::Getq0q3FromTlCostl(Tl, costl, Ev, ml, Q0, Q3);
-    const vector <genie::BLI2DNonUnifGrid *> &
-        tensor_table = hadtensor->TensorTable(
-                tensorpdg, MECHadronTensor::kMHTValenciaFullAll);
-    double Q0min = tensor_table[0]->XMin();
-    double Q0max = tensor_table[0]->XMax();
-    double Q3min = tensor_table[0]->YMin();
-    double Q3max = tensor_table[0]->YMax();
+    double Q0min = setup.range->XMin();
+    double Q0max = setup.range->XMax();
+    double Q3min = setup.range->YMin();
+    double Q3max = setup.range->YMax();
     if(Q0 < Q0min || Q0 > Q0max || Q3 < Q3min || Q3 > Q3max) {
         return 0.0;
     }
@@ -170,24 +233,7 @@ double NievesSimoVacasMECPXSec2016::XSec(
                 tensorpdg, MECHadronTensor::kMHTValenciaFullpn   );
     }
 
-    // now again, run this only if targetpdg != tensorpdg.
-    // would need to trap and treat He3, T, D special here.
-    if( ! hadtensor->KnownTensor(targetpdg) ) {
-        // if we need to scale, figure it out here.
-
-        double PP = Zrequest;
-        double NN = Arequest - PP;
-        double P  = pdg::IonPdgCodeToZ(tensorpdg);
-        double N  = pdg::IonPdgCodeToA(tensorpdg) - P;
-
-        double scale_pn = TMath::Sqrt( (PP*NN)/(P*N) );
-        double scale_pp = TMath::Sqrt( (PP * (PP - 1.)) / (P * (P - 1.)) );
-        double scale_nn = TMath::Sqrt( (NN * (NN - 1.)) / (N * (N - 1.)) );
-
-        LOG("NievesSimoVacasMEC", pDEBUG) 
-            << "Scale pn pp nn for (" << targetpdg << ", " << tensorpdg << ")"
-            << " : " << scale_pn << " " << scale_pp << " " << scale_nn;
-
+    if(setup.scale) {
         // this is an approximation in at least three senses.
         // we are scaling from an isoscalar nucleus using p and n counting
         // we are not using the right qvalue in the had tensor
@@ -197,12 +243,12 @@ double NievesSimoVacasMECPXSec2016::XSec(
         // and see how many percent deviation we see from the full calculation.
 
         double temp_all = xsec_all;
-        double temp_pn  = xsec_pn * scale_pn;
+        double temp_pn  = xsec_pn * setup.scale_pn;
         int nupdg = interaction->InitState().ProbePdg();
         if(nupdg > 0){
-            temp_all = xsec_pn * scale_pn + (xsec_all - xsec_pn) * scale_nn;
+            temp_all = xsec_pn * setup.scale_pn + (xsec_all - xsec_pn) * setup.scale_nn;
         } else {
-            temp_all = xsec_pn * scale_pn + (xsec_all - xsec_pn) * scale_pp;
+            temp_all = xsec_pn * setup.scale_pn + (xsec_all - xsec_pn) * setup.scale_pp;
         }
         xsec_all = temp_all;
         xsec_pn  = temp_pn;
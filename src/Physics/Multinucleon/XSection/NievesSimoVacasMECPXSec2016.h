@@ -49,6 +49,9 @@ public:
   double XSec            (const Interaction * i, KinePhaseSpace_t k) const;
   double Integral        (const Interaction * i) const;
   bool   ValidProcess    (const Interaction * i) const;
+  void   XSecBatch       (unsigned int n, const Interaction * const * in,
+                          KinePhaseSpace_t k, double * xsec) const;
+  bool   HasXSecBatch    (void) const { return true; }
 
   // override the Algorithm::Configure methods to load configuration
   // data to private data members
@@ -57,9 +60,23 @@ public:
 
 private:
 
+  // Hadron tensor and pair scaling factors used for a target
+  struct TargetSetup_t {
+    int                    tensorpdg; ///< nucleus of the hadron tensor
+    const BLI2DUnifGrid *  range;     ///< tensor table giving the (q0,q3) range
+    bool                   scale;     ///< scale from the tensor nucleus?
+    double                 scale_pn;
+    double                 scale_pp;
+    double                 scale_nn;
+  };
+
   // Load algorithm configuration
   void LoadConfig (void);
 
+  bool   SetupTarget (int targetpdg, TargetSetup_t & setup) const;
+  double XSecTarget  (const Interaction * i, KinePhaseSpace_t k,
+                      const TargetSetup_t & setup) const;
+
   double                   fXSecScale;        ///< external xsec scaling factor
 
   const XSecIntegratorI *  fXSecIntegrator; // Numerical integrator (GSL)
@@ -0,0 +1,372 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cmath>
+#include <sstream>
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
+#include "Physics/MuonEnergyLoss/MuELossTable.h"
+
+using std::ostringstream;
+using std::upper_bound;
+
+using namespace genie;
+using namespace genie::mueloss;
+using namespace genie::constants;
+
+namespace {
+  // the knots computed by one thread: i = first, first+stride, ...
+  struct MuELKnotSlice_t {
+    const MuELossI *       model;
+    MuELMaterial_t         material;
+    const vector<double> * E;
+    vector<double> *       dedx;
+    unsigned int           first;
+    unsigned int           stride;
+  };
+  void * ComputeMuELKnotSlice(void * arg)
+  {
+    MuELKnotSlice_t * slice = (MuELKnotSlice_t *) arg;
+    for(unsigned int i = slice->first; i < slice->E->size(); i += slice->stride) {
+      (*slice->dedx)[i] = slice->model->dE_dx((*slice->E)[i], slice->material);
+    }
+    return 0;
+  }
+  // cells where the total slope is this close to 1 use the log form of the range
+  const double kMuELSlopeEps = 1E-6;
+}
+//____________________________________________________________________________
+MuELossTable::MuELossTable(int nknots_per_decade)
+{
+  AlgFactory * algf = AlgFactory::Instance();
+  const MuELossI * models[kNProc] = {
+    dynamic_cast<const MuELossI *> (
+       algf->GetAlgorithm("genie::mueloss::BetheBlochModel",         "Default")),
+    dynamic_cast<const MuELossI *> (
+       algf->GetAlgorithm("genie::mueloss::PetrukhinShestakovModel", "Default")),
+    dynamic_cast<const MuELossI *> (
+       algf->GetAlgorithm("genie::mueloss::KokoulinPetrukhinModel",  "Default")),
+    dynamic_cast<const MuELossI *> (
+       algf->GetAlgorithm("genie::mueloss::BezrukovBugaevModel",     "Default"))
+  };
+  this->Init(models, nknots_per_decade);
+}
+//____________________________________________________________________________
+MuELossTable::MuELossTable(
+   const MuELossI * ionization, const MuELossI * bremsstrahlung,
+   const MuELossI * pair_production, const MuELossI * nuclear,
+   int nknots_per_decade)
+{
+  const MuELossI * models[kNProc] = {
+     ionization, bremsstrahlung, pair_production, nuclear };
+  this->Init(models, nknots_per_decade);
+}
+//____________________________________________________________________________
+MuELossTable::~MuELossTable()
+{
+  map<MuELMaterial_t, Table_t *>::iterator it = fTables.begin();
+  for( ; it != fTables.end(); ++it) delete it->second;
+  fTables.clear();
+
+  pthread_mutex_destroy(&fMutex);
+}
+//____________________________________________________________________________
+void MuELossTable::Init(const MuELossI * models[kNProc], int nknots_per_decade)
+{
+// The models are stored by the process they describe, whatever order they
+// were passed in.
+
+  for(int ip = 0; ip < kNProc; ip++) fModels[ip] = 0;
+  for(int im = 0; im < kNProc; im++) {
+    const MuELossI * model = models[im];
+    if(!model) continue;
+    int ip = (int) model->Process();
+    if(ip < 0 || ip >= kNProc) {
+      LOG("MuELoss", pWARN)
+        << "Ignoring model " << model->Id().Key()
+        << " of process " << MuELProcess::AsString(model->Process());
+      continue;
+    }
+    fModels[ip] = model;
+  }
+
+  // The table starts at 10 MeV of kinetic energy (below that the Bethe-Bloch
+  // formula without shell corrections is not reliable) and stops just below
+  // the largest energy handled by the models
+  fEmin    = kMuonMass + 0.010;
+  fEmax    = 0.999 * kMaxMuE;
+  fLogEmin = TMath::Log(fEmin);
+
+  double ndecades = TMath::Log10(fEmax/fEmin);
+  fNKnots = TMath::Max(2, (int) TMath::Ceil(ndecades * nknots_per_decade) + 1);
+  fDLogE  = (TMath::Log(fEmax) - fLogEmin) / (fNKnots-1);
+
+  fE.resize(fNKnots);
+  for(int i = 0; i < fNKnots; i++) {
+    fE[i] = TMath::Exp(fLogEmin + i*fDLogE);
+  }
+  fE[fNKnots-1] = fEmax;
+
+  fNThreads = 1;
+
+  pthread_mutex_init(&fMutex, 0);
+}
+//____________________________________________________________________________
+void MuELossTable::SetNThreads(unsigned int nthreads)
+{
+  fNThreads = TMath::Max(1U, nthreads);
+}
+//____________________________________________________________________________
+double MuELossTable::dE_dx(double E, MuELMaterial_t m, MuELProcess_t p) const
+{
+  if(m == eMuUndefined) return 0;
+
+  int ip = (p == eMupSum) ? kNProc : (int) p;
+  if(ip < 0 || ip > kNProc) return 0;
+
+  // outside the table: ask the models
+  if(E < fEmin || E > fEmax) {
+    double dedx = 0;
+    for(int i = 0; i < kNProc; i++) {
+      if(fModels[i] && (ip == kNProc || ip == i)) dedx += fModels[i]->dE_dx(E,m);
+    }
+    return dedx;
+  }
+
+  const Table_t * t = this->GetTable(m);
+
+  double logE = 0;
+  int    i    = this->FindCell(E, logE);
+  double u    = (logE - fLogEmin)/fDLogE - i;
+
+  const vector<double> & D = t->fDEDX[ip];
+  if(D[i] > 0 && D[i+1] > 0) {
+    const vector<double> & L = t->fLogDEDX[ip];
+    return TMath::Exp(L[i] + u * (L[i+1]-L[i]));
+  }
+  // a process switching on (or off) within the cell
+  return D[i] + (D[i+1]-D[i]) * (E-fE[i])/(fE[i+1]-fE[i]);
+}
+//____________________________________________________________________________
+double MuELossTable::Range(double E, MuELMaterial_t m) const
+{
+  if(m == eMuUndefined) return 0;
+  if(E <= fEmin) return 0;
+
+  const Table_t * t = this->GetTable(m);
+
+  double logE = 0;
+  int    i    = this->FindCell(E, logE);
+
+  return t->fRange[i] + this->CellRange(*t, i, E);
+}
+//____________________________________________________________________________
+double MuELossTable::Energy(double E0, double X, MuELMaterial_t m) const
+{
+  if(m == eMuUndefined) return E0;
+  if(X <= 0) return E0;
+
+  double R = this->Range(E0, m) - X;
+  if(R <= 0) return fEmin;
+
+  const Table_t * t = this->GetTable(m);
+
+  // the cell where the remaining range R ends
+  int i = upper_bound(t->fRange.begin(), t->fRange.end(), R)
+        - t->fRange.begin() - 1;
+  i = TMath::Min(TMath::Max(i,0), fNKnots-2);
+
+  // invert R - R[i] = E[i]/D[i] ((E/E[i])^(1-s) - 1)/(1-s)
+  double Ei  = fE[i];
+  double Di  = t->fDEDX[kNProc][i];
+  double s   = t->fSlope[i];
+  double arg = Di * (R - t->fRange[i]) / Ei;
+  if(TMath::Abs(1-s) < kMuELSlopeEps) {
+    return Ei * TMath::Exp(arg);
+  }
+  double base = 1 + (1-s) * arg;
+  if(base <= 0) return fEmax; // only beyond the table, for s > 1
+  return Ei * TMath::Power(base, 1/(1-s));
+}
+//____________________________________________________________________________
+void MuELossTable::Build(MuELMaterial_t m) const
+{
+  if(m == eMuUndefined) return;
+  this->GetTable(m);
+}
+//____________________________________________________________________________
+const MuELossTable::Table_t * MuELossTable::GetTable(MuELMaterial_t m) const
+{
+  pthread_mutex_lock(&fMutex);
+  map<MuELMaterial_t, Table_t *>::const_iterator it = fTables.find(m);
+  Table_t * t = 0;
+  if(it != fTables.end()) {
+    t = it->second;
+  } else {
+    t = this->BuildTable(m);
+    fTables.insert(map<MuELMaterial_t, Table_t *>::value_type(m,t));
+  }
+  pthread_mutex_unlock(&fMutex);
+  return t;
+}
+//____________________________________________________________________________
+MuELossTable::Table_t * MuELossTable::BuildTable(MuELMaterial_t m) const
+{
+  LOG("MuELoss", pINFO)
+     << "Building the muon energy loss table for "
+     << MuELMaterial::AsString(m) << " (" << fNKnots << " knots)";
+
+  Table_t * t = new Table_t;
+
+  vector<double> & Dsum = t->fDEDX[kNProc];
+  Dsum.assign(fNKnots, 0.);
+
+  for(int ip = 0; ip < kNProc; ip++) {
+    vector<double> & D = t->fDEDX[ip];
+    D.assign(fNKnots, 0.);
+    if(fModels[ip]) this->ComputeKnots(m, ip, D);
+    for(int i = 0; i < fNKnots; i++) Dsum[i] += D[i];
+  }
+
+  for(int ip = 0; ip <= kNProc; ip++) {
+    const vector<double> & D = t->fDEDX[ip];
+    vector<double> &       L = t->fLogDEDX[ip];
+    L.resize(fNKnots);
+    for(int i = 0; i < fNKnots; i++) {
+      L[i] = (D[i] > 0) ? TMath::Log(D[i]) : 0.;
+    }
+  }
+
+  // The range needs a positive total dE/dx everywhere
+  bool warned = false;
+  for(int i = 0; i < fNKnots; i++) {
+    if(Dsum[i] > 0) continue;
+    if(!warned) {
+      LOG("MuELoss", pWARN)
+        << "Non-positive total dE/dx at E = " << fE[i] << " GeV in "
+        << MuELMaterial::AsString(m) << ": the range is not reliable";
+      warned = true;
+    }
+    Dsum[i] = 1E-30;
+    t->fLogDEDX[kNProc][i] = TMath::Log(Dsum[i]);
+  }
+
+  t->fSlope.resize(fNKnots-1);
+  for(int i = 0; i < fNKnots-1; i++) {
+    t->fSlope[i] =
+      (t->fLogDEDX[kNProc][i+1] - t->fLogDEDX[kNProc][i]) / fDLogE;
+  }
+
+  t->fRange.resize(fNKnots);
+  t->fRange[0] = 0;
+  for(int i = 0; i < fNKnots-1; i++) {
+    t->fRange[i+1] = t->fRange[i] + this->CellRange(*t, i, fE[i+1]);
+  }
+
+  return t;
+}
+//____________________________________________________________________________
+void MuELossTable::ComputeKnots(
+   MuELMaterial_t m, int iproc, vector<double> & dedx) const
+{
+// Read the knots from the cache, if another table (or an earlier job, via
+// the cache file) computed them already; otherwise compute and cache them.
+
+  const MuELossI * model = fModels[iproc];
+
+  Cache * cache = Cache::Instance();
+  string  key   = this->CacheKey(m, iproc);
+
+  CacheBranchFx * cache_branch =
+      dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(cache_branch && (int) cache_branch->Map().size() == fNKnots) {
+    LOG("MuELoss", pDEBUG) << "Found cache branch with key: " << key;
+    map<double,double>::const_iterator it = cache_branch->Map().begin();
+    for(int i = 0; i < fNKnots; i++, ++it) dedx[i] = it->second;
+    return;
+  }
+
+  unsigned int nthreads =
+     TMath::Min(fNThreads, (unsigned int) fNKnots);
+
+  vector<MuELKnotSlice_t> slices(nthreads);
+  for(unsigned int it = 0; it < nthreads; it++) {
+    slices[it].model    = model;
+    slices[it].material = m;
+    slices[it].E        = &fE;
+    slices[it].dedx     = &dedx;
+    slices[it].first    = it;
+    slices[it].stride   = nthreads;
+  }
+  // run the slices in worker threads and the first one in this thread,
+  // falling back to this thread for any slice whose thread can not start
+  vector<pthread_t> threads(nthreads);
+  vector<bool>      started(nthreads, false);
+  for(unsigned int it = 1; it < nthreads; it++) {
+    started[it] =
+      (pthread_create(&threads[it], 0, ComputeMuELKnotSlice, &slices[it]) == 0);
+  }
+  ComputeMuELKnotSlice(&slices[0]);
+  for(unsigned int it = 1; it < nthreads; it++) {
+    if(started[it]) {
+      pthread_join(threads[it], 0);
+    } else {
+      ComputeMuELKnotSlice(&slices[it]);
+    }
+  }
+
+  if(!cache_branch) {
+    cache_branch = new CacheBranchFx("MuELoss table");
+    cache->AddCacheBranch(key, cache_branch);
+  }
+  for(int i = 0; i < fNKnots; i++) cache_branch->AddValues(fE[i], dedx[i]);
+}
+//____________________________________________________________________________
+string MuELossTable::CacheKey(MuELMaterial_t m, int iproc) const
+{
+  ostringstream knots;
+  knots << MuELMaterial::AsString(m) << "/" << fNKnots;
+
+  return Cache::Instance()->CacheBranchKey(
+     "mueloss::MuELossTable", fModels[iproc]->Id().Key(), knots.str());
+}
+//____________________________________________________________________________
+int MuELossTable::FindCell(double E, double & logE) const
+{
+  logE = TMath::Log(E);
+  int i = (int) TMath::Floor((logE - fLogEmin)/fDLogE);
+  return TMath::Min(TMath::Max(i,0), fNKnots-2);
+}
+//____________________________________________________________________________
+double MuELossTable::CellRange(const Table_t & t, int i, double E) const
+{
+// Integral of dE / (dE/dx) from E[i] to E, with dE/dx = D[i] (E/E[i])^s
+
+  double Ei = fE[i];
+  double Di = t.fDEDX[kNProc][i];
+  double s  = t.fSlope[i];
+  double x  = TMath::Log(E/Ei);
+  if(TMath::Abs(1-s) < kMuELSlopeEps) {
+    return Ei/Di * x;
+  }
+  return Ei/Di * (TMath::Exp((1-s)*x) - 1)/(1-s);
+}
+//____________________________________________________________________________
@@ -0,0 +1,121 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::mueloss::MuELossTable
+
+\brief    Tabulated muon energy loss: the dE/dx of each process (ionization,
+          bremsstrahlung, e+e- pair production, nuclear interaction) and in
+          total, and the CSDA range, in a given material, as a function of
+          the muon energy.
+
+          At first use of a material, the dE/dx of each MuELossI model is
+          computed on a grid uniform in log(E), optionally in concurrent
+          threads (the model integrations are independent), and is
+          interpolated linearly in log(dE/dx) vs log(E) afterwards. The knots
+          are also stored in the GENIE cache (see Cache, CacheBranchFx), so
+          that they are read back rather than recomputed by jobs using a
+          cache file (--cache-file).
+          The CSDA range R(E) is the integral of dE / (dE/dx) from the lowest
+          tabulated energy, done exactly for the interpolated total dE/dx, so
+          that Energy(E0, X) (the energy of a muon of energy E0 after a
+          distance X, in the continuous slowing down approximation) is the
+          exact inverse of Range().
+
+          Units are as in the MuELossI models: dE/dx in GeV^-2 (energy per
+          areal density) and range in GeV^-3 (areal density). To convert,
+          eg: dE_dx /= (units::MeV/(units::g/units::cm2)) and
+          range /= (units::g/units::cm2).
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _MUELOSS_TABLE_H_
+#define _MUELOSS_TABLE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+#include "Physics/MuonEnergyLoss/MuELossI.h"
+
+using std::map;
+using std::string;
+using std::vector;
+
+namespace genie   {
+namespace mueloss {
+
+class MuELossTable {
+
+public:
+  //! with the default configuration of the four GENIE muon energy loss models
+  MuELossTable(int nknots_per_decade = 50);
+  //! with the given models (any of which may be null)
+  MuELossTable(const MuELossI * ionization, const MuELossI * bremsstrahlung,
+               const MuELossI * pair_production, const MuELossI * nuclear,
+               int nknots_per_decade = 50);
+ ~MuELossTable();
+
+  //! # of threads computing the tables (1 by default)
+  void SetNThreads (unsigned int nthreads);
+
+  //! dE/dx (GeV^-2) of the given process, or in total, at muon energy E (GeV)
+  double dE_dx  (double E, MuELMaterial_t m, MuELProcess_t p = eMupSum) const;
+
+  //! CSDA range (GeV^-3) of a muon of energy E (GeV)
+  double Range  (double E, MuELMaterial_t m) const;
+
+  //! energy (GeV) of a muon of energy E0 (GeV) after a distance X (GeV^-3);
+  //! the lowest tabulated energy EMin() if the muon ranges out
+  double Energy (double E0, double X, MuELMaterial_t m) const;
+
+  double EMin   (void) const { return fEmin; }
+  double EMax   (void) const { return fEmax; }
+
+  //! build the table of this material now, rather than at first use
+  void   Build  (MuELMaterial_t m) const;
+
+private:
+  static const int kNProc = 4; ///< # of processes (ionization ... nuclear interaction)
+
+  struct Table_t {
+    vector<double> fLogDEDX[kNProc+1]; ///< log(dE/dx) per process and in total (last)
+    vector<double> fDEDX   [kNProc+1]; ///< dE/dx
+    vector<double> fSlope;             ///< d log(dE/dx) / d log(E) of the total, per cell
+    vector<double> fRange;             ///< range at the knots
+  };
+
+  void            Init       (const MuELossI * models[kNProc], int nknots_per_decade);
+  const Table_t * GetTable   (MuELMaterial_t m) const;
+  Table_t *       BuildTable (MuELMaterial_t m) const;
+  void            ComputeKnots (MuELMaterial_t m, int iproc, vector<double> & dedx) const;
+  string          CacheKey   (MuELMaterial_t m, int iproc) const;
+  int             FindCell   (double E, double & logE) const;
+  double          CellRange  (const Table_t & t, int i, double E) const;
+
+  const MuELossI *  fModels[kNProc]; ///< models, per process
+  int               fNKnots;         ///< # of energy knots
+  double            fEmin;           ///< energy range (GeV)
+  double            fEmax;
+  double            fLogEmin;
+  double            fDLogE;          ///< log(E) knot spacing
+  vector<double>    fE;              ///< energy knots
+  unsigned int      fNThreads;
+
+  mutable map<MuELMaterial_t, Table_t *> fTables;
+  mutable pthread_mutex_t                fMutex; ///< guards the tables
+};
+
+}       // mueloss namespace
+}       // genie   namespace
+
+#endif  // _MUELOSS_TABLE_H_
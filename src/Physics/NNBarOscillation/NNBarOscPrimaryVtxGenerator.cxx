@@ -10,6 +10,10 @@
  For documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   The max phase space decay weight is taken from PhaseSpaceWeightCache,
+   rather than from 200 trial decays at every event. The final state
+   reselection no longer reseeds the random number generators.
 
 */
 //____________________________________________________________________________
@@ -29,6 +33,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/PhaseSpaceWeightCache.h"
 #include "Physics/NNBarOscillation/NNBarOscPrimaryVtxGenerator.h"
 #include "Physics/NNBarOscillation/NNBarOscUtils.h"
 #include "Physics/NNBarOscillation/NNBarOscMode.h"
@@ -101,19 +106,19 @@ void NNBarOscPrimaryVtxGenerator::AddInitialState(GHepRecord * event) const
   int ipdg = fCurrInitStatePdg;
   
   // add initial nucleus
-  double Mi  = PDGLibrary::Instance()->Find(ipdg)->Mass();
+  double Mi  = PDGLibrary::Instance()->Mass(ipdg);
   TLorentzVector p4i(0,0,0,Mi);
   event->AddParticle(ipdg,stis,-1,-1,-1,-1, p4i, v4);
 
   // add oscillating neutron
   int neutpdg = kPdgNeutron;
-  double mneut = PDGLibrary::Instance()->Find(neutpdg)->Mass();
+  double mneut = PDGLibrary::Instance()->Mass(neutpdg);
   TLorentzVector p4neut(0,0,0,mneut);
   event->AddParticle(neutpdg,stdc,0,-1,-1,-1, p4neut, v4);
 
   // add annihilation nucleon
   int dpdg = genie::utils::nnbar_osc::AnnihilatingNucleonPdgCode(fCurrDecayMode);
-  double mn = PDGLibrary::Instance()->Find(dpdg)->Mass();
+  double mn = PDGLibrary::Instance()->Mass(dpdg);
   TLorentzVector p4n(0,0,0,mn);
   event->AddParticle(dpdg,stdc, 0,-1,-1,-1, p4n, v4);
 
@@ -123,7 +128,7 @@ void NNBarOscPrimaryVtxGenerator::AddInitialState(GHepRecord * event) const
   A--; A--;
   if(dpdg == kPdgProton) { Z--; }
   int rpdg = pdg::IonPdgCode(A, Z);
-  double Mf  = PDGLibrary::Instance()->Find(rpdg)->Mass();
+  double Mf  = PDGLibrary::Instance()->Mass(rpdg);
   TLorentzVector p4f(0,0,0,Mf);
   event->AddParticle(rpdg,stfs,0,-1,-1,-1, p4f, v4);
 }
@@ -146,52 +151,20 @@ void NNBarOscPrimaryVtxGenerator::GenerateOscillatingNeutronPosition(
   LOG("NNBarOsc", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
+  // select the radius from the cumulative r^2 rho(r) distribution
   double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
-  
-  // select a vertex using the rejection method 
+  double r    = utils::nuclear::RadiusQuantile(A, rnd->RndFsi().Rndm(), rmax);
+
   TLorentzVector vtx(0,0,0,0);
-  unsigned int iter = 0;
-  while(1) {
-    iter++;
-
-    // throw an exception if it hasn't find a solution after many attempts
-    if(iter > controls::kRjMaxIterations) {
-       LOG("NNBarOsc", pWARN)
-           << "Couldn't generate a vertex position after " << iter << " iterations";
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't generate vertex");
-       exception.SwitchOnFastForward();
-       throw exception;
-    }
-           
-    double r = rmax * rnd->RndFsi().Rndm();
-    double t = ymax * rnd->RndFsi().Rndm();
-    double y = r*r * utils::nuclear::Density(r,A);
-    if(y > ymax) {   
-       LOG("NNBarOsc", pERROR)
-          << "y = " << y << " > ymax = " << ymax << " for r = " << r << ", A = " << A;
-    }
-    bool accept = (t < y);
-    if(accept) {
-       double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
-       double cosphi   = TMath::Cos(phi);
-       double sinphi   = TMath::Sin(phi);
-       double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-       double sintheta = TMath::Sqrt(1-costheta*costheta);
-       vtx.SetX(r*sintheta*cosphi);
-       vtx.SetY(r*sintheta*sinphi);
-       vtx.SetZ(r*costheta);
-       vtx.SetT(0.);
-       break;
-    }
-  } // while 1
+  double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
+  double cosphi   = TMath::Cos(phi);
+  double sinphi   = TMath::Sin(phi);
+  double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+  double sintheta = TMath::Sqrt(1-costheta*costheta);
+  vtx.SetX(r*sintheta*cosphi);
+  vtx.SetY(r*sintheta*sinphi);
+  vtx.SetZ(r*costheta);
+  vtx.SetT(0.);
 
   // giving position to oscillating neutron
   GHepParticle * oscillating_neutron = event->Particle(1);
@@ -289,7 +262,7 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
   double   sum  = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m = PDGLibrary::Instance()->Mass(pdgc);
     mass[idx++] = m;
     sum += m;
   }
@@ -371,7 +344,6 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
 
     // randomly generate a number between 1 and 0
     RandomGen * rnd = RandomGen::Instance();
-    rnd->SetSeed(0);
     double p = rnd->RndNum().Rndm();
     
     // loop through all modes, figure out which one our random number corresponds to
@@ -406,7 +378,7 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
     sum = 0;
     for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
       int pdgc = *pdg_iter;
-      double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+      double m = PDGLibrary::Instance()->Mass(pdgc);
       mass[idx++] = m;
       sum += m;
     }
@@ -435,13 +407,9 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
      throw exception;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int i=0; i<200; i++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     wmax = TMath::Max(wmax,w);
-  }
+  // Get the maximum weight (cached per decay product list & W bin)
+  PhaseSpaceWeightCache * wcache = PhaseSpaceWeightCache::Instance();
+  double wmax = wcache->MaxWeight(fPhaseSpaceGenerator, *p4d, pdgv);
   assert(wmax>0);
   wmax *= 2;
 
@@ -476,6 +444,7 @@ void NNBarOscPrimaryVtxGenerator::GenerateDecayProducts(
      if(w > wmax) {
         LOG("NNBarOsc", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
+        wcache->RaiseMaxWeight(*p4d, pdgv, w);
      }
      double gw = wmax * rnd->RndHadro().Rndm();
      accept_decay = (gw<=w);
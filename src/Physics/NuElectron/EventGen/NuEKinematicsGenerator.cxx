@@ -75,8 +75,18 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
-  
+  //   When available, an envelope of the xsec in (E,y) is used instead of
+  //   the max xsec, selecting y in cells of the envelope according to their
+  //   majorant, so that almost every trial is accepted.
+  Interaction * interaction = evrec->Summary();
+  KineEnvelope_t * envelope = (fGenerateUniformly) ? 0 :
+      this->Envelope(interaction, this->Energy(interaction));
+  double xsec_max = -1;
+  if(!fGenerateUniformly && !envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
+
   //-- y range
   const KPhaseSpace & kps = evrec->Summary()->PhaseSpace();
   Range1D_t yl = kps.Limits(kKVy);
@@ -85,13 +95,13 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   double dy   = ymax-ymin;
 
   double xsec = -1;
-  Interaction * interaction = evrec->Summary();
 
   //-- Try to select a valid inelastisity y
   unsigned int iter = 0;
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("NuEKinematics", pWARN)
               << "*** Could not select a valid y after "
@@ -103,7 +113,16 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         throw exception;
      }
 
-     double y = ymin + dy * rnd->RndKine().Rndm();
+     int    icell = -1;
+     double y     = 0.;
+     if(envelope) {
+        double u = this->SampleEnvelope(*envelope,
+                     rnd->RndKine().Rndm(), rnd->RndKine().Rndm(), icell);
+        xsec_max = envelope->value[icell];
+        y = ymin + dy * u;
+     } else {
+        y = ymin + dy * rnd->RndKine().Rndm();
+     }
      interaction->KinePtr()->Sety(y);
 
      LOG("NuEKinematics", pINFO) << "Trying: y = " << y;
@@ -113,7 +132,11 @@ void NuEKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
 
      //-- decide whether to accept the current kinematics
      if(!fGenerateUniformly) {
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        if(envelope && xsec > xsec_max) {
+          // the envelope is not a bound here: raise it
+          this->RaiseEnvelope(envelope, icell, xsec);
+        }
+        else this->AssertXSecLimits(interaction, xsec, xsec_max);
 
         double t = xsec_max * rnd->RndKine().Rndm();
         LOG("NuEKinematics", pDEBUG) << "xsec= "<< xsec<< ", J= 1, Rnd= "<< t;
@@ -252,5 +275,24 @@ void NuEKinematicsGenerator::LoadConfig(void)
   //   an event weight?
 	GetParamDef( "UniformOverPhaseSpace", fGenerateUniformly, false ) ;
 
+  //-- Sample y against an envelope of the cross section in (E,y)?
+	GetParamDef( "UseEnvelope",           fUseEnvelope,    true ) ;
+	GetParamDef( "Envelope-SafetyFactor", fEnvelopeSafety, 1.2  ) ;
+	fEnvelopes.clear();
+	fEnvelopeEdges.clear();
+}
+//____________________________________________________________________________
+double NuEKinematicsGenerator::EnvelopeXSec(
+                             Interaction * interaction, double u) const
+{
+// dxsec/dy at the y normalized to its limits, for the (E,y) envelope
+// (see KineGeneratorWithCache::Envelope())
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t yl = kps.Limits(kKVy);
+  if(yl.max <= yl.min) return 0.;
+
+  interaction->KinePtr()->Sety(yl.min + (yl.max - yl.min) * u);
+  return fXSecModel->XSec(interaction, kPSyfE);
 }
 //____________________________________________________________________________
@@ -48,6 +48,8 @@ public:
   //-- overload KineGeneratorWithCache methods
   double ComputeMaxXSec (const Interaction * in) const;
   double Energy         (const Interaction * in) const;
+  double EnvelopeXSec   (Interaction * in, double u) const;
+  int    EnvelopeDim    (void) const { return 1; }
 };
 
 }      // genie namespace
@@ -28,6 +28,7 @@
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Utils/ScopeProfiler.h"
   
 using namespace genie;
 using namespace genie::constants;
@@ -53,6 +54,7 @@ NuElectronXSec::~NuElectronXSec()
 double NuElectronXSec::Integrate(
                  const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(in) ) return 0.;
 
   const KPhaseSpace & kps = in->PhaseSpace();
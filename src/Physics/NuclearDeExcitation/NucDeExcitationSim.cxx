@@ -15,6 +15,11 @@
    implementation handles 16O only.
  @ Sep 15, 2009 - CA
    IsNucleus() is no longer available in GHepParticle. Use pdg::IsIon().
+ @ Oct 14, 2026 - CA
+   The 16O level schemes are now data tables, expanded at construction into
+   the list of all de-excitation paths of each hole nucleon. Each event
+   selects one path from an alias table instead of walking the shell, level
+   and decay mode branches.
 */
 //____________________________________________________________________________
 
@@ -53,13 +58,13 @@ using namespace genie::controls;
 NucDeExcitationSim::NucDeExcitationSim() :
 EventRecordVisitorI("genie::NucDeExcitationSim")
 {
-
+  this->BuildCascadeTables();
 }
 //___________________________________________________________________________
 NucDeExcitationSim::NucDeExcitationSim(string config) :
 EventRecordVisitorI("genie::NucDeExcitationSim", config)
 {
-
+  this->BuildCascadeTables();
 }
 //___________________________________________________________________________
 NucDeExcitationSim::~NucDeExcitationSim()
@@ -79,241 +84,145 @@ void NucDeExcitationSim::ProcessEventRecord(GHepRecord * evrec) const
     return;
   }
 
-  if(nucltgt->Z()==8) this->OxygenTargetSim(evrec);
+  GHepParticle * hitnuc = evrec->HitNucleon();
+  if(!hitnuc) return;
+
+  int hole_pdg = (hitnuc->Pdg() == kPdgProton) ? kPdgProton : kPdgNeutron;
+  std::map<std::pair<int,int>, CascadeTable_t>::const_iterator it =
+      fCascadeTables.find(std::make_pair(nucltgt->Z(), hole_pdg));
+  if(it == fCascadeTables.end()) {
+    LOG("NucDeEx", pINFO) 
+      << "No de-excitation data for Z = " << nucltgt->Z();
+    return;
+  }
+
+  const Cascade_t & cascade = this->SelectCascade(it->second);
+  LOG("NucDeEx", pNOTICE) << "Selected de-excitation: " << cascade.descr;
+
+  double dt = -1;
+  for(unsigned int i = 0; i < cascade.egamma.size(); i++) {
+    this->AddPhoton(evrec, cascade.egamma[i], dt);
+  }
 
   LOG("NucDeEx", pINFO) 
      << "Done with this event";
 }
 //___________________________________________________________________________
-void NucDeExcitationSim::OxygenTargetSim(GHepRecord * evrec) const
+void NucDeExcitationSim::BuildCascadeTables(void)
 {
-  LOG("NucDeEx", pNOTICE) 
-     << "Simulating nuclear de-excitation gamma rays for Oxygen target";
-
-  //LOG("NucDeEx", pNOTICE) << *evrec;
-
-  GHepParticle * hitnuc = evrec->HitNucleon();
-  if(!hitnuc) return;
+// 16O level schemes
+// Refs: H.Ejiri, Phys.Rev.C48,1442(1993); K.Kobayashi et al.,
+//       Nucl.Phys.B (proc Suppl) 139 (2005)
+// The probability not covered by the rows (eg the non-radiative decay modes
+// of the S1/2 n-hole levels) goes to a path emitting no photon.
+
+  static const CascadeData_t kO16PHole[] = {
+    { "P1/2 shell p-hole, g.s.",                   0.25, 1.,     1.,    { 0.,      0.,      0. } },
+    { "P3/2 shell p-hole, 6.32 MeV level",         0.47, 0.872,  1.,    { 0.00632, 0.,      0. } },
+    { "P3/2 shell p-hole, 9.93 MeV level",         0.47, 0.064,  0.78,  { 0.00993, 0.,      0. } },
+    { "P3/2 shell p-hole, 9.93 MeV level cascade", 0.47, 0.064,  0.22,  { 0.00993, 0.00361, 0. } },
+    // above the particle production threshold: a ~0.5 MeV kinetic energy
+    // proton is emitted, which is neglected (the intranuke break-up nucleon
+    // cross sections are already tuned)
+    { "P3/2 shell p-hole, 10.7 MeV level",         0.47, 0.064,  1.,    { 0.,      0.,      0. } },
+    { "S1/2 shell p-hole, 3.09 MeV level",         0.28, 0.0625, 1.,    { 0.00309, 0.,      0. } },
+    { "S1/2 shell p-hole, 3.68 MeV level",         0.28, 0.1875, 1.,    { 0.00368, 0.,      0. } },
+    { "S1/2 shell p-hole, 3.85 MeV level",         0.28, 0.075,  0.013, { 0.00309, 0.,      0. } },
+    { "S1/2 shell p-hole, 3.85 MeV level",         0.28, 0.075,  0.360, { 0.00369, 0.,      0. } },
+    { "S1/2 shell p-hole, 3.85 MeV level",         0.28, 0.075,  0.625, { 0.00385, 0.,      0. } },
+    { "S1/2 shell p-hole, 4.44 MeV level",         0.28, 0.1375, 1.,    { 0.00444, 0.,      0. } },
+    { "S1/2 shell p-hole, 4.92 MeV level",         0.28, 0.1375, 1.,    { 0.00492, 0.,      0. } },
+    { "S1/2 shell p-hole, 5.11 MeV level",         0.28, 0.0125, 1.,    { 0.00511, 0.,      0. } },
+    { "S1/2 shell p-hole, 6.09 MeV level",         0.28, 0.0125, 1.,    { 0.00609, 0.,      0. } },
+    { "S1/2 shell p-hole, 6.73 MeV level",         0.28, 0.075,  0.04,  { 0.00609, 0.,      0. } },
+    { "S1/2 shell p-hole, 6.73 MeV level",         0.28, 0.075,  0.96,  { 0.00673, 0.,      0. } },
+    { "S1/2 shell p-hole, 7.01 MeV level",         0.28, 0.0563, 1.,    { 0.00701, 0.,      0. } },
+    { "S1/2 shell p-hole, 7.03 MeV level",         0.28, 0.0563, 1.,    { 0.00703, 0.,      0. } },
+    { "S1/2 shell p-hole, 7.34 MeV level",         0.28, 0.1874, 0.050, { 0.00609, 0.,      0. } },
+    { "S1/2 shell p-hole, 7.34 MeV level",         0.28, 0.1874, 0.033, { 0.00673, 0.,      0. } },
+    { "S1/2 shell p-hole, 7.34 MeV level",         0.28, 0.1874, 0.017, { 0.00734, 0.,      0. } }
+  };
+  static const CascadeData_t kO16NHole[] = {
+    { "P1/2 shell n-hole, g.s.",                   0.25, 1.,     1.,    { 0.,      0.,      0. } },
+    { "P3/2 shell n-hole, 6.18 MeV level",         0.44, 1.,     1.,    { 0.00618, 0.,      0. } },
+    { "S1/2 shell n-hole, 7.03 MeV photon",        0.09, 1.,     0.222, { 0.00703, 0.,      0. } }
+  };
+
+  fCascadeTables.clear();
+
+  this->AddCascadeTable(8, kPdgProton,  kO16PHole,
+                        sizeof(kO16PHole)/sizeof(kO16PHole[0]));
+  this->AddCascadeTable(8, kPdgNeutron, kO16NHole,
+                        sizeof(kO16NHole)/sizeof(kO16NHole[0]));
+}
+//___________________________________________________________________________
+void NucDeExcitationSim::AddCascadeTable(
+    int Z, int hole_pdg, const CascadeData_t * data, int n)
+{
+// Expands the level scheme data of a nucleus for the given hole nucleon to
+// the list of its de-excitation paths and builds their alias table
+
+  CascadeTable_t & table = fCascadeTables[std::make_pair(Z, hole_pdg)];
+  table.paths.clear();
+
+  double sum = 0;
+  for(int i = 0; i < n; i++) {
+    Cascade_t cascade;
+    cascade.descr = data[i].descr;
+    cascade.prob  = data[i].pshell * data[i].plevel * data[i].pmode;
+    for(int ig = 0; ig < 3 && data[i].egamma[ig] > 0; ig++) {
+      cascade.egamma.push_back(data[i].egamma[ig]);
+    }
+    table.paths.push_back(cascade);
+    sum += cascade.prob;
+  }
+  if(sum < 1.) {
+    Cascade_t none;
+    none.descr = "no de-excitation photon";
+    none.prob  = 1. - sum;
+    table.paths.push_back(none);
+    sum = 1.;
+  }
 
-  bool p_hole = (hitnuc->Pdg() == kPdgProton);
-  double dt   = -1;
+  const int np = table.paths.size();
+  vector<double> prob(np);
+  table.alias_prob.resize(np);
+  table.alias_idx .resize(np);
+
+  vector<int> small, large;
+  for(int i = 0; i < np; i++) {
+    prob[i] = table.paths[i].prob * np / sum;
+    table.alias_idx[i] = i;
+    if(prob[i] < 1.) small.push_back(i);
+    else             large.push_back(i);
+  }
+  while(!small.empty() && !large.empty()) {
+    int s = small.back(); small.pop_back();
+    int l = large.back();
+    table.alias_prob[s] = prob[s];
+    table.alias_idx [s] = l;
+    prob[l] -= (1. - prob[s]);
+    if(prob[l] < 1.) { large.pop_back(); small.push_back(l); }
+  }
+  // leftovers (up to rounding) are always accepted
+  for(unsigned int i = 0; i < large.size(); i++) table.alias_prob[large[i]] = 1.;
+  for(unsigned int i = 0; i < small.size(); i++) table.alias_prob[small[i]] = 1.;
 
+  LOG("NucDeEx", pINFO)
+    << "Tabulated " << np << " de-excitation paths for Z = " << Z
+    << ", hole nucleon = " << hole_pdg;
+}
+//___________________________________________________________________________
+const NucDeExcitationSim::Cascade_t & NucDeExcitationSim::SelectCascade(
+    const CascadeTable_t & table) const
+{
   RandomGen * rnd = RandomGen::Instance();
 
-  //
-  // ****** P-Hole 
-  //
-  if (p_hole) {
-    // 
-    // * Define all the data required for simulating deexcitations of p-hole states
-    //
-
-    // > probabilities for creating a p-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;              // P1/2 
-    double Pp32 = 0.47;              // P3/2 
-    double Ps12 = 1. - Pp12 - Pp32;  // S1/2 
-
-    // > excited state energy levels & probabilities for P3/2-shell p-holes
-    const int np32 = 3;
-    double p32Elv[np32] = { 0.00632, 0.00993, 0.01070 };
-    double p32Plv[np32] = { 0.872,   0.064,   0.064   }; 
-    // - probabilities for deexcitation modes of P3/2-shell p-hole state '1' 
-    double p32Plv1_1gamma  = 0.78;  // prob to decay via 1 gamma
-    double p32Plv1_cascade = 0.22;  // prob to decay via gamma cascade
-
-    // > excited state energy levels & probabilities for S1/2-shell p-holes
-    const int ns12 = 11;
-    double s12Elv[ns12] = { 
-               0.00309, 0.00368, 0.00385, 0.00444, 0.00492,
-               0.00511, 0.00609, 0.00673, 0.00701, 0.00703, 0.00734 }; 
-    double s12Plv[ns12] = { 
-               0.0625,  0.1875,  0.075,   0.1375,  0.1375,
-               0.0125,  0.0125,  0.075,   0.0563,  0.0563,  0.1874  };
-    // - gamma energies and probabilities for S1/2-shell p-hole excited 
-    //   states '2','7' and '10' with >1 deexcitation modes
-    const int ns12lv2 = 3;
-    double s12Elv2[ns12lv2]    = { 0.00309, 0.00369, 0.00385 };
-    double s12Plv2[ns12lv2]    = { 0.013,   0.360,   0.625   };
-    const int ns12lv7 = 2;
-    double s12Elv7[ns12lv7]    = { 0.00609, 0.00673 };
-    double s12Plv7[ns12lv7]    = { 0.04,    0.96    };
-    const int ns12lv10 = 3;
-    double s12Elv10[ns12lv10]  = { 0.00609, 0.00673, 0.00734 };
-    double s12Plv10[ns12lv10]  = { 0.050,   0.033,   0.017   };
-     
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE) 
-          << "Hit nucleon left a P1/2 shell p-hole. Remnant is at g.s.";
-        return;
-    } 
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left a P3/2 shell p-hole";
-        // Select one of the excited states 
-        double rdecmode  = rnd->RndDec().Rndm();        
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<np32; istate++) {
-            prob_sum += p32Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE) 
-            << "Selected P3/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        // >> 6.32 MeV state
-        if(sel_state==0) { 
-            this->AddPhoton(evrec, p32Elv[0], dt);
-        } 
-        // >> 9.93 MeV state
-        else 
-        if(sel_state==1) {    
-            double r = rnd->RndDec().Rndm();        
-            // >>> emit a single gamma 
-            if(r < p32Plv1_1gamma) {
-               this->AddPhoton(evrec, p32Elv[1], dt);
-            }
-            // >>> emit a cascade of gammas 
-            else 
-            if(r < p32Plv1_1gamma + p32Plv1_cascade) {
-               this->AddPhoton(evrec, p32Elv[1],           dt);
-               this->AddPhoton(evrec, p32Elv[1]-p32Elv[0], dt);
-            }
-        }
-        // >> 10.7 MeV state 
-        else 
-        if(sel_state==2) {
-           // Above the particle production threshold - need to emit
-           // a 0.5 MeV kinetic energy proton.
-           // Will neglect that given that it is a very low energy
-           // kinetic energy nucleon and the intranuke break-up nucleon
-           // cross sections are already tuned.
-           return;
-        }
-    } //p3/2
-    //
-    // >> S1/2 shell
-    //
-    else if (rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left an S1/2 shell p-hole";
-        // Select one of the excited states caused by a S1/2 shell hole
-        double rdecmode  = rnd->RndDec().Rndm();  
-        double prob_sum  = 0;
-        int    sel_state = -1;
-        for(int istate=0; istate<ns12; istate++) {
-            prob_sum += s12Plv[istate];
-            if(rdecmode < prob_sum) {
-              sel_state = istate;
-              break;
-            }
-        }
-        LOG("NucDeEx", pNOTICE) 
-            << "Selected S1/2 excited state = " << sel_state;
-
-        // Decay that excited state
-        bool multiple_decay_modes = 
-              (sel_state==2 || sel_state==7 || sel_state==10);
-        if(!multiple_decay_modes) {
-          this->AddPhoton(evrec, s12Elv[sel_state], dt); 
-        } else {
-          int ndec = -1;
-          double * pdec = 0, * edec = 0;
-          switch(sel_state) {
-           case(2) : 
-              ndec = ns12lv2;  pdec = s12Plv2;  edec = s12Elv2;
-              break;
-           case(7) : 
-              ndec = ns12lv7;  pdec = s12Plv7;  edec = s12Elv7;
-              break;
-           case(10) : 
-              ndec = ns12lv10; pdec = s12Plv10; edec = s12Elv10;
-              break;
-           default:
-             return;
-          }
-          double r = rnd->RndDec().Rndm();  
-          double decmode_prob_sum = 0;
-          int sel_decmode = -1;
-          for(int idecmode=0; idecmode < ndec; idecmode++) {
-             decmode_prob_sum += pdec[idecmode];
-             if(r < decmode_prob_sum) {
-                 sel_decmode = idecmode;
-                 break;
-             }
-          }
-          if(sel_decmode == -1) return;
-          this->AddPhoton(evrec, edec[sel_decmode], dt);  
-        }//mult.dec.ch 
-
-    } // s1/2
-    else {
-    }
-  } // p-hole
-
-  //
-  // ****** n-hole
-  //
-  else {
-    // 
-    // * Define all the data required for simulating deexcitations of n-hole states
-    //
-
-    // > probabilities for creating a n-hole in the P1/2, P3/2, S1/2 shells
-    double Pp12 = 0.25;  // P1/2 
-    double Pp32 = 0.44;  // P3/2 
-    double Ps12 = 0.09;  // S1/2 
-    //>
-    double p32Elv = 0.00618;
-    //>
-    double s12Elv = 0.00703;
-    double s12Plv = 0.222;
-
-    // Select one of the P1/2, P3/2 or S1/2
-    double rshell = rnd->RndDec().Rndm();
-    //
-    // >> P1/2 shell
-    //
-    if(rshell < Pp12) {
-        LOG("NucDeEx", pNOTICE) 
-          << "Hit nucleon left a P1/2 shell n-hole. Remnant is at g.s.";
-        return;
-    } 
-    //
-    // >> P3/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left a P3/2 shell n-hole";
-        this->AddPhoton(evrec, p32Elv, dt); 
-    } 
-    //
-    // >> S1/2 shell
-    //
-    else
-    if(rshell < Pp12 + Pp32 + Ps12) {
-        LOG("NucDeEx", pNOTICE) 
-            << "Hit nucleon left a S1/2 shell n-hole";
-        // only one of the deexcitation modes involve a (7.03 MeV) photon
-        double r = rnd->RndDec().Rndm();
-        if(r < s12Plv) this->AddPhoton(evrec, s12Elv,dt);
-    }
-    else {
-    }
-  } //n-hole
+  const int n = table.paths.size();
+  double u = n * rnd->RndDec().Rndm();
+  int    i = TMath::Min( (int)u, n-1 );
+
+  return table.paths[ ( (u - i) < table.alias_prob[i] ) ? i : table.alias_idx[i] ];
 }
 //___________________________________________________________________________
 void NucDeExcitationSim::AddPhoton(
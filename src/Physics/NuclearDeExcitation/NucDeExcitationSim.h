@@ -5,6 +5,12 @@
 
 \brief    Generates nuclear de-excitation gamma rays
 
+          The de-excitation of the remnant of each (nucleus, hole nucleon)
+          is tabulated at construction as the list of all its paths (hole
+          shell, excited level and decay mode) with the photons they emit,
+          and one path is selected per event from an alias table. Nuclei are
+          added by adding their level scheme data to BuildCascadeTables().
+
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
 
@@ -23,6 +29,11 @@
 #ifndef _NUCLEAR_DEEXCITATION_H_
 #define _NUCLEAR_DEEXCITATION_H_
 
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <TLorentzVector.h>
 
 #include "Framework/EventGen/EventRecordVisitorI.h"
@@ -40,10 +51,38 @@ public :
   void ProcessEventRecord (GHepRecord * evrec) const;
 
 private:
-  void           OxygenTargetSim      (GHepRecord * evrec) const;
-  void           AddPhoton            (GHepRecord * evrec, double E0, double t) const;
-  double         PhotonEnergySmearing (double E0, double t) const;
-  TLorentzVector Photon4P             (double E) const;
+  // A row of level scheme data: a hole shell, one of its excited levels and
+  // one of the level decay modes, with their probabilities and the photons
+  // emitted by that decay mode (up to 3, 0-terminated)
+  struct CascadeData_t {
+    const char * descr;      ///< hole shell / excited level
+    double       pshell;     ///< probability of the hole shell
+    double       plevel;     ///< probability of the level, given the shell
+    double       pmode;      ///< probability of the decay mode, given the level
+    double       egamma[3];  ///< photon energies (GeV)
+  };
+  // A de-excitation path and the photons it emits
+  struct Cascade_t {
+    std::string         descr;
+    double              prob;
+    std::vector<double> egamma;
+  };
+  // All de-excitation paths of a (nucleus, hole nucleon), with an alias
+  // table (Vose's method) for selecting one of them
+  struct CascadeTable_t {
+    std::vector<Cascade_t> paths;
+    std::vector<double>    alias_prob;
+    std::vector<int>       alias_idx;
+  };
+
+  void              BuildCascadeTables (void);
+  void              AddCascadeTable    (int Z, int hole_pdg, const CascadeData_t * data, int n);
+  const Cascade_t & SelectCascade      (const CascadeTable_t & table) const;
+  void              AddPhoton            (GHepRecord * evrec, double E0, double t) const;
+  double            PhotonEnergySmearing (double E0, double t) const;
+  TLorentzVector    Photon4P             (double E) const;
+
+  std::map<std::pair<int,int>, CascadeTable_t> fCascadeTables; ///< by (Z, hole nucleon pdg)
 };
 
 }      // genie namespace
@@ -25,6 +25,7 @@
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/GridSampler.h"
 #include "Framework/Utils/ConfigIsotopeMapUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 
@@ -51,15 +52,7 @@ NuclearModelI("genie::EffectiveSF", config)
 //____________________________________________________________________________
 EffectiveSF::~EffectiveSF()
 {
-  map<string, TH1D*>::iterator iter = fProbDistroMap.begin();
-  for( ; iter != fProbDistroMap.begin(); ++iter) {
-    TH1D * hst = iter->second;
-    if(hst) {
-      delete hst;
-      hst=0;
-    }
-  }
-  fProbDistroMap.clear();
+  this->ClearCache();
 }
 //____________________________________________________________________________
 // Set the removal energy, 3 momentum, and FermiMover interaction type
@@ -74,21 +67,21 @@ bool EffectiveSF::GenerateNucleon(const Target & target) const
   //
 
   if ( target.A() > 1 ) {
-    TH1D * prob = this->ProbDistro(target);
-    if(!prob) {
+    const GridSampler * sampler = this->Sampler(target);
+    if(!sampler) {
       LOG("EffectiveSF", pNOTICE)
               << "Null nucleon momentum probability distribution";
       exit(1);
     }
 
-    double p = prob->GetRandom();
+    RandomGen * rnd = RandomGen::Instance();
+
+    double p = sampler->Generate(rnd->RndGen());
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     LOG("EffectiveSF", pDEBUG) << "|p,nucleon| = " << p;
 #endif
 
-    RandomGen * rnd = RandomGen::Instance();
-
     double costheta = -1. + 2. * rnd->RndGen().Rndm();
     double sintheta = TMath::Sqrt(1.-costheta*costheta);
     double fi       = 2 * kPi * rnd->RndGen().Rndm();
@@ -130,6 +123,7 @@ double EffectiveSF::Prob(double mom, double w, const Target & target) const
 {
   if(w < 0) {
      TH1D * prob_distr = this->ProbDistro(target);
+     if(!prob_distr) return 0;
      int bin = prob_distr->FindBin(mom);
      double y  = prob_distr->GetBinContent(bin);
      double dx = prob_distr->GetBinWidth(bin);
@@ -144,8 +138,10 @@ double EffectiveSF::Prob(double mom, double w, const Target & target) const
 //____________________________________________________________________________
 TH1D * EffectiveSF::ProbDistro(const Target & target) const
 {
-  //-- return stored /if already computed/
-  map<string, TH1D*>::iterator it = fProbDistroMap.find(target.AsString());
+  //-- the distribution only depends on the nucleus: return stored
+  //   /if already computed, or known not to exist/
+  int pdgc = pdg::IonPdgCode(target.A(), target.Z());
+  map<int, TH1D*>::iterator it = fProbDistroMap.find(pdgc);
   if(it != fProbDistroMap.end()) return it->second;
 
   LOG("EffectiveSF", pNOTICE)
@@ -156,8 +152,56 @@ TH1D * EffectiveSF::ProbDistro(const Target & target) const
   //-- get information for the nuclear target
   int nucleon_pdgc = target.HitNucPdg();
   assert( pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc) );
-  return this->MakeEffectiveSF(target);
 
+  TH1D * prob = this->MakeEffectiveSF(target);
+
+  //-- store
+  fProbDistroMap.insert(map<int, TH1D*>::value_type(pdgc,prob));
+  return prob;
+}
+//____________________________________________________________________________
+// Sampler of the momentum distribution of the given target, with the bin
+// contents of the ProbDistro() histogram as cell weights.
+//____________________________________________________________________________
+const GridSampler * EffectiveSF::Sampler(const Target & target) const
+{
+  int pdgc = pdg::IonPdgCode(target.A(), target.Z());
+  map<int, GridSampler*>::iterator it = fSamplerMap.find(pdgc);
+  if(it != fSamplerMap.end()) return it->second;
+
+  GridSampler * sampler = 0;
+  TH1D * prob = this->ProbDistro(target);
+  if(prob) {
+    int nbins = prob->GetNbinsX();
+    sampler = new GridSampler(nbins,
+       prob->GetXaxis()->GetXmin(), prob->GetXaxis()->GetXmax());
+    for(int i = 0; i < nbins; i++) {
+      sampler->SetCell(i, prob->GetBinContent(i+1));
+    }
+    if(!sampler->Build()) {
+      delete sampler;
+      sampler = 0;
+    }
+  }
+  fSamplerMap.insert(map<int, GridSampler*>::value_type(pdgc,sampler));
+  return sampler;
+}
+//____________________________________________________________________________
+// Deletes the cached momentum distributions and samplers
+//____________________________________________________________________________
+void EffectiveSF::ClearCache(void) const
+{
+  map<int, TH1D*>::iterator iter = fProbDistroMap.begin();
+  for( ; iter != fProbDistroMap.end(); ++iter) {
+    delete iter->second;
+  }
+  fProbDistroMap.clear();
+
+  map<int, GridSampler*>::iterator siter = fSamplerMap.begin();
+  for( ; siter != fSamplerMap.end(); ++siter) {
+    delete siter->second;
+  }
+  fSamplerMap.clear();
 }
 //____________________________________________________________________________
 // If transverse enhancement form factor modification is enabled, we must
@@ -202,8 +246,8 @@ TH1D * EffectiveSF::MakeEffectiveSF(const Target & target) const
   return NULL;
 }
 //____________________________________________________________________________
-// Makes a momentum distribution using the factors below (see reference) and
-// inserts it into the nucleus/momentum distribution map.
+// Makes a momentum distribution using the factors below (see reference).
+// It is stored in the nucleus/momentum distribution map by ProbDistro().
 //____________________________________________________________________________
 TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
                                     double beta, double c1, double c2,
@@ -237,9 +281,6 @@ TH1D * EffectiveSF::MakeEffectiveSF(double bs, double bp, double alpha,
   //-- normalize the probability distribution
   prob->Scale( 1.0 / prob->Integral("width") );
 
-  //-- store
-  fProbDistroMap.insert(
-      map<string, TH1D*>::value_type(target.AsString(),prob));
   return prob;
 }
 //____________________________________________________________________________
@@ -284,6 +325,9 @@ void EffectiveSF::Configure(string param_set)
 //____________________________________________________________________________
 void EffectiveSF::LoadConfig(void)
 {
+  // distributions computed with the previous configuration
+  this->ClearCache();
+
   this->GetParamDef("EjectSecondNucleon2p2h", fEjectSecondNucleon2p2h, false);
 
   this->GetParamDef("MomentumMax",    fPMax,    1.0);
@@ -31,6 +31,8 @@ using std::map;
 
 namespace genie {
 
+class GridSampler;
+
 class EffectiveSF : public NuclearModelI {
 
 public:
@@ -56,6 +58,7 @@ public:
 
 private:
   TH1D * ProbDistro (const Target & t) const;
+  const GridSampler * Sampler (const Target & t) const;
 
   TH1D * MakeEffectiveSF(const Target & target) const;
 
@@ -69,7 +72,10 @@ private:
   double Returnf1p1h(const Target & target) const;
   void   LoadConfig (void);
 
-  mutable map<string, TH1D *> fProbDistroMap;
+  void ClearCache (void) const;
+
+  mutable map<int, TH1D *> fProbDistroMap;       ///< momentum distributions per nucleus PDG code (0 if none)
+  mutable map<int, GridSampler *> fSamplerMap;   ///< samplers of the fProbDistroMap distributions
   double fPMax;
   double fPCutOff;
   bool   fEjectSecondNucleon2p2h;
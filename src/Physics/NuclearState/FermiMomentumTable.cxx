@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   The Fermi momenta found for each target (exact or closest table entry)
+   are stored, so that the table is only searched once per target.
 
 */
 //____________________________________________________________________________
@@ -23,11 +26,15 @@
 using namespace genie;
 
 //____________________________________________________________________________
-FermiMomentumTable::FermiMomentumTable()
+FermiMomentumTable::FermiMomentumTable() :
+fLastTgtPdg(0),
+fLastKFSet(0)
 {
 }
 //____________________________________________________________________________
-FermiMomentumTable::FermiMomentumTable(const FermiMomentumTable & )
+FermiMomentumTable::FermiMomentumTable(const FermiMomentumTable & ) :
+fLastTgtPdg(0),
+fLastKFSet(0)
 {
 
 }
@@ -40,53 +47,80 @@ FermiMomentumTable::~FermiMomentumTable()
 void FermiMomentumTable::AddTableEntry(int tgt_pdgc, KF_t kf)
 {
   fKFSets.insert(map<int, KF_t>::value_type(tgt_pdgc, kf));
+
+  // the closest entries found so far may have changed
+  fResolvedKFSets.clear();
+  fLastTgtPdg = 0;
+  fLastKFSet  = 0;
 }
 //____________________________________________________________________________
 double FermiMomentumTable::FindClosestKF(int tgt_pdgc, int nucleon_pdgc) const
 {
+  const KF_t & kft = this->FindClosestKFSet(tgt_pdgc);
+  return pdg::IsProton(nucleon_pdgc) ? kft.p : kft.n;
+}
+//____________________________________________________________________________
+const KF_t & FermiMomentumTable::FindClosestKFSet(int tgt_pdgc) const
+{
+// Returns the proton and neutron Fermi momenta of the table entry for the
+// input target or, if there is none, of the entry with the closest Z.
+// The table is searched only once per target: most calls are for the same
+// target as the previous one, and are answered without any lookup.
+
+  if(fLastKFSet && tgt_pdgc == fLastTgtPdg) return *fLastKFSet;
+
+  map<int, KF_t>::const_iterator it = fResolvedKFSets.find(tgt_pdgc);
+  if(it == fResolvedKFSets.end()) {
+     it = fResolvedKFSets.insert(
+         map<int, KF_t>::value_type(tgt_pdgc, this->ResolveKFSet(tgt_pdgc))).first;
+  }
+  fLastTgtPdg = tgt_pdgc;
+  fLastKFSet  = &(it->second);
+
+  return *fLastKFSet;
+}
+//____________________________________________________________________________
+const KF_t & FermiMomentumTable::ResolveKFSet(int tgt_pdgc) const
+{
+  static KF_t kf0 = { 0., 0. };
+
   LOG("FermiP", pINFO)
-       << "Finding Fermi momenta table entry for (tgt = "
-                      << tgt_pdgc << ", nucl = " << nucleon_pdgc << ")";
+       << "Finding Fermi momenta table entry for tgt = " << tgt_pdgc;
 
   if(fKFSets.size()==0) {
       LOG("FermiP", pWARN)
          << "The Fermi momenta table is empty! Returning kf(tgt = "
-                  << tgt_pdgc << ", nucl = " << nucleon_pdgc << ") = 0";
-      return 0;
+                  << tgt_pdgc << ") = 0";
+      return kf0;
   }
 
-  double kf=0;
-  bool isp = pdg::IsProton(nucleon_pdgc);
-
-  if(fKFSets.count(tgt_pdgc) == 1) {
+  map<int, KF_t>::const_iterator table_iter = fKFSets.find(tgt_pdgc);
+  if(table_iter != fKFSets.end()) {
      LOG("FermiP", pDEBUG) << "Got exact match in Fermi momenta table";
-     map<int, KF_t>::const_iterator table_iter = fKFSets.find(tgt_pdgc);
-     if(isp) kf = table_iter->second.p;
-     else    kf = table_iter->second.n;
-     LOG("FermiP", pINFO) << "kF = " << kf;
-     return kf;
+     LOG("FermiP", pINFO)
+       << "kF(p) = " << table_iter->second.p
+       << ", kF(n) = " << table_iter->second.n;
+     return table_iter->second;
   }
   LOG("FermiP", pINFO) << "Couldn't find exact match in Fermi momenta table";
 
   int  Z   = pdg::IonPdgCodeToZ(tgt_pdgc);
-  int    Ac=9999, Zc=9999, dZmin=9999;
+  int    dZmin=9999;
   map<int, KF_t>::const_iterator kfiter;
+  map<int, KF_t>::const_iterator closest = fKFSets.begin();
   for(kfiter=fKFSets.begin(); kfiter!=fKFSets.end(); ++kfiter) {
     int pdgc = kfiter->first;
     int Zt = pdg::IonPdgCodeToZ(pdgc);
     int dZ = TMath::Abs(Zt-Z);
     if(dZ<dZmin) {
-      dZmin = dZ;
-      Zc = Zt;
-      Ac = pdg::IonPdgCodeToA(pdgc);
-      KF_t kft  = kfiter->second;
-      if(isp) kf=kft.p;
-      else    kf=kft.n;
+      dZmin   = dZ;
+      closest = kfiter;
     }
   }
   LOG("FermiP", pINFO)
-       << "The closest nucleus in table is pdgc = " << pdg::IonPdgCode(Ac,Zc);
-  LOG("FermiP", pINFO) << "kF = " << kf;
-  return kf;
+       << "The closest nucleus in table is pdgc = " << closest->first;
+  LOG("FermiP", pINFO)
+       << "kF(p) = " << closest->second.p << ", kF(n) = " << closest->second.n;
+  return closest->second;
 }
 //____________________________________________________________________________
@@ -37,11 +37,18 @@ public:
   FermiMomentumTable(const FermiMomentumTable & fmt);
   virtual ~FermiMomentumTable();
 
-  double FindClosestKF (int target_pdgc, int nucleon_pdgc) const;
+  double FindClosestKF    (int target_pdgc, int nucleon_pdgc) const;
+  const KF_t & FindClosestKFSet (int target_pdgc) const;
   void   AddTableEntry (int target_pdgc, KF_t kf);
 
 private:
+  const KF_t & ResolveKFSet (int target_pdgc) const;
+
   map<int, KF_t> fKFSets; // the actual Fermi momenta table
+
+  mutable map<int, KF_t> fResolvedKFSets; // table entries (or closest ones) already found per target
+  mutable int            fLastTgtPdg;     // target of the last lookup
+  mutable const KF_t *   fLastKFSet;      // Fermi momenta for fLastTgtPdg
 };
 
 }      // genie namespace
@@ -24,6 +24,9 @@
    gas model can access the radius.
    Added a check to see if a local Fermi gas model is being used. If so,
    use a local Fermi gas model when deciding whether to eject a recoil nucleon.
+ @ Oct 14, 2026 - CA
+   The Fermi momentum table is retrieved at configuration time rather than
+   for every event.
 */
 //____________________________________________________________________________
 
@@ -63,13 +66,15 @@ using namespace genie::constants;
 
 //___________________________________________________________________________
 FermiMover::FermiMover() :
-EventRecordVisitorI("genie::FermiMover")
+EventRecordVisitorI("genie::FermiMover"),
+fKFTable(0)
 {
 
 }
 //___________________________________________________________________________
 FermiMover::FermiMover(string config) :
-EventRecordVisitorI("genie::FermiMover", config)
+EventRecordVisitorI("genie::FermiMover", config),
+fKFTable(0)
 {
 
 }
@@ -211,9 +216,7 @@ void FermiMover::KickHitNucleon(GHepRecord * evrec) const
 	kF= TMath::Power(3*kPi2*numNuc*
 		  genie::utils::nuclear::Density(radius,A),1.0/3.0) *hbarc;
       }else{
-	FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-	const FermiMomentumTable * kft  = kftp->GetTable("Default");
-	kF = kft->FindClosestKF(nucleus_pdgc, nucleon_pdgc);
+	kF = fKFTable->FindClosestKF(nucleus_pdgc, nucleon_pdgc);
       }
       if (TMath::Sqrt(pF2) > kF) {
         double Pp = (nucleon->Pdg() == kPdgProton) ? 0.05 : 0.95;
@@ -276,7 +279,7 @@ void FermiMover::Emit2ndNucleonFromSRC(GHepRecord * evrec,
   double px = -1.* nucleon->Px();
   double py = -1.* nucleon->Py();
   double pz = -1.* nucleon->Pz();
-  double M  = PDGLibrary::Instance()->Find(eject_pdg_code)->Mass();
+  double M  = PDGLibrary::Instance()->Mass(eject_pdg_code);
   double E  = TMath::Sqrt(px*px+py*py+pz*pz+M*M);
 
   evrec->AddParticle(
@@ -367,5 +370,9 @@ void FermiMover::LoadConfig(void)
 
   this->GetParamDef("KeepHitNuclOnMassShell", fKeepNuclOnMassShell, false);
   this->GetParamDef("SimRecoilNucleon",       fSRCRecoilNucleon,    false);
+
+  FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+  fKFTable = kftp->GetTable("Default");
+  assert(fKFTable);
 }
 //____________________________________________________________________________
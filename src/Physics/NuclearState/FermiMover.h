@@ -26,6 +26,7 @@
 namespace genie {
 
 class NuclearModelI;
+class FermiMomentumTable;
 
 class FermiMover : public EventRecordVisitorI {
 
@@ -55,6 +56,7 @@ private:
   bool  fKeepNuclOnMassShell;          ///< keep hit bound nucleon on the mass shell?
   bool  fSRCRecoilNucleon;             ///< simulate recoil nucleon due to short range corellation?
   const NuclearModelI *  fNuclModel;   ///< nuclear model
+  const FermiMomentumTable * fKFTable; ///< kF table used for the SRC partner of non-LFG models
 };
 
 }      // genie namespace
@@ -59,18 +59,14 @@ bool LocalFGM::GenerateNucleon(const Target & target,
 
   //-- set fermi momentum vector
   //
-  TH1D * prob = this->ProbDistro(target,hitNucleonRadius);
-  if(!prob) {
-    LOG("LocalFGM", pNOTICE)
-              << "Null nucleon momentum probability distribution";
-    exit(1);
-  }
-  double p = prob->GetRandom();
-  delete prob;
-  LOG("LocalFGM", pINFO) << "|p,nucleon| = " << p;
-
+  // |phi(p)|^2 is constant below the local Fermi momentum (no correlation
+  // tail), so dP/dp ~ p^2 up to min(KF, PMax): sample its inverse CDF
   RandomGen * rnd = RandomGen::Instance();
 
+  double pmax = TMath::Min(this->LocalFermiMomentum(target,hitNucleonRadius), fPMax);
+  double p    = pmax * TMath::Power(rnd->RndGen().Rndm(), 1./3.);
+  LOG("LocalFGM", pINFO) << "|p,nucleon| = " << p;
+
   double costheta = -1. + 2. * rnd->RndGen().Rndm();
   double sintheta = TMath::Sqrt(1.-costheta*costheta);
   double fi       = 2 * kPi * rnd->RndGen().Rndm();
@@ -96,27 +92,26 @@ bool LocalFGM::GenerateNucleon(const Target & target,
 double LocalFGM::Prob(double p, double w, const Target & target,
 			     double hitNucleonRadius) const
 {
+// Probability of the momentum bin containing p, for momentum bins of 1 MeV
+// in [0, PMax]
+
   if(w<0) {
-    TH1D * prob = this->ProbDistro(target, hitNucleonRadius);
-    int bin = prob->FindBin(p);
-    double y  = prob->GetBinContent(bin);
-    double dx = prob->GetBinWidth(bin);
-    double pr  = y*dx;
-    delete prob;
-    return pr;
+    int    npbins = (int) (1000*fPMax);
+    double dp     = fPMax / npbins;
+    if(p < 0 || p >= npbins*dp) return 0;
+
+    double pmax = TMath::Min(this->LocalFermiMomentum(target,hitNucleonRadius), fPMax);
+    if(pmax <= 0) return 0;
+
+    double plo = TMath::Min(TMath::Floor(p/dp) * dp, pmax);
+    double phi = TMath::Min(plo + dp, pmax);
+    return (TMath::Power(phi,3) - TMath::Power(plo,3)) / TMath::Power(pmax,3);
   }
   return 1;
 }
 //____________________________________________________________________________
-// *** The TH1D object must be deleted after it is used ***
-TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
+double LocalFGM::LocalFermiMomentum(const Target & target, double r) const
 {
-  LOG("LocalFGM", pNOTICE)
-             << "Computing P = f(p_nucleon) for: " << target.AsString()
-	     << ", Nucleon Radius = " << r;
-  LOG("LocalFGM", pNOTICE)
-             << ", P(max) = " << fPMax;
-
   //-- get information for the nuclear target
   int nucleon_pdgc = target.HitNucPdg();
   assert(pdg::IsProton(nucleon_pdgc) || pdg::IsNeutron(nucleon_pdgc));
@@ -131,54 +126,13 @@ TH1D * LocalFGM::ProbDistro(const Target & target, double r) const
   double KF= TMath::Power(3*kPi2*numNuc*genie::utils::nuclear::Density(r,A),
 			    1.0/3.0) *hbarc;
 
-  LOG("LocalFGM",pNOTICE) << "KF = " << KF;
-
-  double a  = 2.0;
-  double C  = 4. * kPi * TMath::Power(KF,3) / 3.;
-
-  // Do not include nucleon correlation tail
-  //double R  = 1. / (1.- KF/4.);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("LocalFGM", pDEBUG) << "a  = " << a;
-  LOG("LocalFGM", pDEBUG) << "C  = " << C;
-  //LOG("LocalFGM", pDEBUG) << "R  = " << R;
-#endif
-
-  //-- create the probability distribution
-
-  int npbins = (int) (1000*fPMax);
-  TH1D * prob = new TH1D("", "", npbins, 0, fPMax);
-  prob->SetDirectory(0);
-
-  double dp = fPMax / (npbins-1);
-  double iC = (C>0) ? 1./C : 0.;
-  double kfa_pi_2 = TMath::Power(KF*a/kPi,2);
-
-  for(int i = 0; i < npbins; i++) {
-     double p  = i * dp;
-     double p2 = TMath::Power(p,2);
-
-     // calculate |phi(p)|^2
-     double phi2 = 0;
-     if (p <= KF)
-        phi2 = iC * (1. - 6.*kfa_pi_2);
-
-     // Do not include nucleon correlation tail
-     //else if ( p > KF && p < fPCutOff)
-     //   phi2 = iC * (2*R*kfa_pi_2*TMath::Power(KF/p,4.));
-
-     // calculate probability density : dProbability/dp
-     double dP_dp = 4*kPi * p2 * phi2;
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("LocalFGM", pDEBUG) << "p = " << p << ", dP/dp = " << dP_dp;
+  LOG("LocalFGM", pDEBUG)
+             << "KF = " << KF << " for: " << target.AsString()
+	     << ", Nucleon Radius = " << r;
 #endif
-     prob->Fill(p, dP_dp);
-  }
-
-  //-- normalize the probability distribution
-  prob->Scale( 1.0 / prob->Integral("width") );
 
-  return prob;
+  return KF;
 }
 //____________________________________________________________________________
 void LocalFGM::Configure(const Registry & config)
@@ -5,6 +5,8 @@
 
 \brief    local Fermi gas model. Implements the NuclearModelI 
           interface.
+          The nucleon momentum distribution at radius r is ~p^2 up to the
+          local Fermi momentum, and is sampled analytically.
 
 \ref      
 
@@ -23,8 +25,6 @@
 
 #include <map>
 
-#include <TH1D.h>
-
 #include "Physics/NuclearState/NuclearModelI.h"
 
 using std::map;
@@ -64,8 +64,8 @@ public:
   void Configure (string param_set)
 ;
 private:
-  void   LoadConfig (void);
-  TH1D * ProbDistro (const Target & t, double r) const;
+  void   LoadConfig         (void);
+  double LocalFermiMomentum (const Target & t, double r) const;
 
   map<int, double> fNucRmvE;
 
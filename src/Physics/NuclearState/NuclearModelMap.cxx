@@ -14,6 +14,9 @@
  @ Mar 18, 2016- Joe Johnston (SD)
    Update GenerateNucleon() and Prob() to accept a radius as the argument,
    and call the corresponding methods in the nuclear model with a radius.
+ @ Oct 14, 2026 - CA
+   The model selected for the last target is remembered, so that successive
+   calls for the same nucleus don't look up the refined models map.
 
 */
 //____________________________________________________________________________
@@ -41,13 +44,17 @@ using namespace genie::controls;
 
 //____________________________________________________________________________
 NuclearModelMap::NuclearModelMap() :
-NuclearModelI("genie::NuclearModelMap")
+NuclearModelI("genie::NuclearModelMap"),
+fLastZ(-1),
+fLastModel(0)
 {
 
 }
 //____________________________________________________________________________
 NuclearModelMap::NuclearModelMap(string config) :
-NuclearModelI("genie::NuclearModelMap", config)
+NuclearModelI("genie::NuclearModelMap", config),
+fLastZ(-1),
+fLastModel(0)
 {
 
 }
@@ -123,6 +130,10 @@ void NuclearModelMap::LoadConfig(void)
 {
 
   fDefGlobModel = 0;
+  fRefinedModels.clear();
+  fLastZ        = -1;
+  fLastModel    = 0;
+
   // load default global model (should work for all nuclei)
   RgAlg dgmodel ;
   GetParam( "NuclearModel", dgmodel ) ;
@@ -171,10 +182,13 @@ void NuclearModelMap::LoadConfig(void)
 const NuclearModelI * NuclearModelMap::SelectModel(const Target & t) const
 {
   int Z = t.Z();
+  if(fLastModel && Z == fLastZ) return fLastModel;
 
   map<int,const NuclearModelI*>::const_iterator it = fRefinedModels.find(Z);
 
-  if(it != fRefinedModels.end()) return it->second;
-  else return fDefGlobModel;
+  fLastZ     = Z;
+  fLastModel = (it != fRefinedModels.end()) ? it->second : fDefGlobModel;
+
+  return fLastModel;
 }
 //____________________________________________________________________________
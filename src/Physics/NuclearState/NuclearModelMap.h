@@ -64,6 +64,8 @@ private:
 
   const NuclearModelI * fDefGlobModel;            ///< default basic model (should work for all nuclei)
   map<int, const NuclearModelI *> fRefinedModels; ///< refinements for specific elements
+  mutable int                     fLastZ;         ///< Z of the last selected model
+  mutable const NuclearModelI *   fLastModel;     ///< model selected for fLastZ
 };
 
 }      // genie namespace
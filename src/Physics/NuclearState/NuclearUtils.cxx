@@ -31,10 +31,18 @@
  @ Mar 18, 2016 - JJ (SD)
    Check if a local Fermi gas model should be used when calculating the
    Fermi momentum
+ @ Oct 14, 2026 - CA
+   Density() interpolates in a density table built per nucleus at first use,
+   instead of evaluating the analytic densities in every call. Added
+   DensityParams() returning the parametrization used for each nucleus.
+   Added RadiusQuantile() for generating radii according to r^2 rho(r) from
+   the cumulative distribution stored with the density tables.
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <algorithm>
+#include <map>
 
 #include <TMath.h>
 
@@ -51,9 +59,13 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/NuclearState/NuclearModelI.h"
 
+using std::map;
+
 using namespace genie;
 using namespace genie::constants;
 
+static const double kDensityTableStep = 0.005; // fm, density table spacing
+
 
 //____________________________________________________________________________
 double genie::utils::nuclear::BindEnergy(const Target & target)
@@ -384,10 +396,147 @@ double genie::utils::nuclear::DISNuclFactor(double x, int A)
   return f;
 }
 //___________________________________________________________________________
+genie::utils::nuclear::DensityTable_t
+  genie::utils::nuclear::MakeDensityTable(int A)
+{
+// Tabulates the ring = 0 density profile of a nucleus with mass number A.
+// The table starts at -0.75c for Woods-Saxon densities, so that the profile
+// shifted by the largest ring is still covered at r = 0, and extends to where
+// the density has dropped by more than 10 orders of magnitude.
+
+  DensityTable_t tbl;
+  DensityParams(A, tbl.woods_saxon, tbl.p1, tbl.p2);
+
+  double xmax = 0.;
+  if(tbl.woods_saxon) {
+    tbl.xmin = -0.75 * tbl.p1;
+    xmax     = tbl.p1 + 25. * tbl.p2;
+  } else {
+    tbl.xmin = 0.;
+    xmax     = 6. * tbl.p1;
+  }
+  tbl.dx = kDensityTableStep;
+
+  int n = (int) TMath::Ceil((xmax - tbl.xmin) / tbl.dx) + 1;
+  tbl.rho.resize(n);
+  for(int i = 0; i < n; i++) {
+    double x = tbl.xmin + i * tbl.dx;
+    tbl.rho[i] = (tbl.woods_saxon) ?
+       DensityWoodsSaxon (x, tbl.p1, tbl.p2) :
+       DensityGaus       (x, tbl.p1, tbl.p2);
+  }
+
+  // cumulative integral of r^2 rho(r) from r = 0, at r = k*dx
+  int nr = (int) TMath::Floor(xmax / tbl.dx) + 1;
+  tbl.cdf.resize(nr);
+  tbl.cdf[0] = 0.;
+  double ylo = 0.;
+  for(int k = 1; k < nr; k++) {
+    double r  = k * tbl.dx;
+    double y  = r*r * ((tbl.woods_saxon) ?
+       DensityWoodsSaxon (r, tbl.p1, tbl.p2) :
+       DensityGaus       (r, tbl.p1, tbl.p2));
+    tbl.cdf[k] = tbl.cdf[k-1] + 0.5 * (ylo + y) * tbl.dx;
+    ylo = y;
+  }
+
+  LOG("Nuclear", pINFO)
+    << "Tabulated the density of A = " << A << " nuclei at " << n
+    << " points in [" << tbl.xmin << ", " << xmax << "] fm";
+
+  return tbl;
+}
+//___________________________________________________________________________
+const genie::utils::nuclear::DensityTable_t &
+  genie::utils::nuclear::DensityTable(int A)
+{
+// Returns the density table of a nucleus with mass number A, building it at
+// first use. The tables are shared by all callers of Density() and
+// RadiusQuantile().
+
+  static map<int, DensityTable_t> tables;
+  static int                    last_A     = -1;
+  static const DensityTable_t * last_table = 0;
+
+  if(!last_table || A != last_A) {
+    map<int, DensityTable_t>::const_iterator it = tables.find(A);
+    if(it == tables.end()) {
+      it = tables.insert(
+             map<int, DensityTable_t>::value_type(A, MakeDensityTable(A))).first;
+    }
+    last_A     = A;
+    last_table = &(it->second);
+  }
+  return *last_table;
+}
+//___________________________________________________________________________
 double genie::utils::nuclear::Density(double r, int A, double ring)
 {
 // [by S.Dytman]
 //
+// The density profile of each nucleus is tabulated at first use and then
+// linearly interpolated. Increasing the nuclear size by `ring' only shifts
+// (Woods-Saxon) or rescales (modified harmonic oscillator) the argument of
+// the ring = 0 profile, so a single table per A serves all ring sizes.
+// Outside the tabulated range the analytic densities are evaluated.
+
+  const DensityTable_t & tbl = DensityTable(A);
+
+  double x = 0.;
+  if(tbl.woods_saxon) {
+    x = r - TMath::Min(ring, 0.75*tbl.p1);
+  } else {
+    x = r * tbl.p1 / (tbl.p1 + TMath::Min(ring, 0.3*tbl.p1));
+  }
+
+  double u = (x - tbl.xmin) / tbl.dx;
+  int    i = (int) u;
+  if(u < 0 || i >= (int)tbl.rho.size() - 1) {
+    return (tbl.woods_saxon) ?
+       DensityWoodsSaxon (r, tbl.p1, tbl.p2, ring) :
+       DensityGaus       (r, tbl.p1, tbl.p2, ring);
+  }
+  return tbl.rho[i] + (u - i) * (tbl.rho[i+1] - tbl.rho[i]);
+}
+//___________________________________________________________________________
+double genie::utils::nuclear::RadiusQuantile(int A, double u, double rmax)
+{
+// Returns the radius r in [0, rmax] below which a fraction u of the r^2 rho(r)
+// distribution (truncated at rmax) lies. Vertices distributed according to
+// the nuclear density are generated, without rejection, at the radius
+// RadiusQuantile(A, u, rmax) for u uniform in [0,1]. The cumulative
+// distribution is tabulated with the density, so the radii are consistent
+// with the Density() seen by the local Fermi gas models.
+
+  const DensityTable_t & tbl = DensityTable(A);
+  const vector<double> & cdf = tbl.cdf;
+
+  int    nr   = cdf.size();
+  double umax = cdf[nr-1];
+  double kmax = rmax / tbl.dx;
+  if(kmax < nr-1) {
+    int k = (int) kmax;
+    umax = cdf[k] + (kmax - k) * (cdf[k+1] - cdf[k]);
+  }
+  double target = TMath::Min(TMath::Max(u, 0.), 1.) * umax;
+
+  int k = std::upper_bound(cdf.begin(), cdf.end(), target) - cdf.begin() - 1;
+  if(k < 0)    k = 0;
+  if(k > nr-2) return TMath::Min(rmax, (nr-1) * tbl.dx);
+
+  double dc = cdf[k+1] - cdf[k];
+  double r  = (k + ((dc > 0) ? (target - cdf[k]) / dc : 0.)) * tbl.dx;
+
+  return TMath::Min(r, rmax);
+}
+//___________________________________________________________________________
+void genie::utils::nuclear::DensityParams(
+                     int A, bool & woods_saxon, double & p1, double & p2)
+{
+// Parameters of the density profile used for a nucleus with mass number A:
+// c, z of a Woods-Saxon density for A > 20 and ap, alf of a modified harmonic
+// oscillator density otherwise   [by S.Dytman]
+
   if(A>20) {
     double c = 1., z = 1.;
 
@@ -400,10 +549,9 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
        c = TMath::Power(A,0.35); z = 0.54; 
     } //others
 
-    LOG("Nuclear",pINFO)
-	<< "r= " << r << ", ring= " << ring;
-    double rho = DensityWoodsSaxon(r,c,z,ring);
-    return rho;
+    woods_saxon = true;
+    p1 = c;
+    p2 = z;
   }
   else if (A>4) {
     double ap = 1., alf = 1.;
@@ -416,18 +564,16 @@ double genie::utils::nuclear::Density(double r, int A, double ring)
       ap=1.75; alf=-0.4+.12*A; 
     }  //others- alf=0.08 if A=4
 
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+    woods_saxon = false;
+    p1 = ap;
+    p2 = alf;
   }
   else {
     // helium
-    double ap = 1.9/TMath::Sqrt(2.);  
-    double alf=0.;    
-    double rho = DensityGaus(r,ap,alf,ring);
-    return rho;
+    woods_saxon = false;
+    p1 = 1.9/TMath::Sqrt(2.);  
+    p2 = 0.;    
   }
-
-  return 0;
 }
 //___________________________________________________________________________
 double genie::utils::nuclear::DensityGaus(
@@ -21,10 +21,12 @@
 #define _NUCLEAR_UTILS_H_
 
 #include <string>
+#include <vector>
 
 #include "Framework/Conventions/Constants.h"
 
 using std::string;
+using std::vector;
 
 namespace genie {
 
@@ -35,6 +37,17 @@ namespace utils {
 
 namespace nuclear
 {
+  // Density profile of a nucleus, tabulated on a regular grid at ring = 0
+  typedef struct EDensityTable {
+    bool           woods_saxon; ///< Woods-Saxon or modified harmonic osc. density?
+    double         p1;          ///< c (Woods-Saxon) or ap (harmonic osc.) [fm]
+    double         p2;          ///< z (Woods-Saxon) or alf (harmonic osc.)
+    double         xmin;        ///< first grid point [fm]
+    double         dx;          ///< grid spacing [fm]
+    vector<double> rho;         ///< density at the grid points [fm^-3]
+    vector<double> cdf;         ///< integral of r^2 rho from 0 to r = k*dx
+  } DensityTable_t;
+
   double BindEnergy             (const Target & target);
   double BindEnergy             (int nucA, int nucZ);
   double BindEnergyPerNucleon   (const Target & target);
@@ -55,6 +68,10 @@ namespace nuclear
   double DISNuclFactor (double x, int A);
 
   double Density           (double r, int A, double ring=0.);
+  void   DensityParams     (int A, bool & woods_saxon, double & p1, double & p2);
+  DensityTable_t MakeDensityTable (int A);
+  const DensityTable_t & DensityTable (int A);
+  double RadiusQuantile    (int A, double u, double rmax);
   double DensityGaus       (double r, double ap, double alf, double ring=0.);
   double DensityWoodsSaxon (double r, double c, double z, double ring=0.);
 
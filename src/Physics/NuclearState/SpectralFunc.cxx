@@ -12,12 +12,18 @@
  Important revisions after version 2.0.0 :
  @ May 01, 2012 - CA
    Pick spectral function data from $GENIE/data/evgen/nucl/spectral_functions
+ @ Oct 14, 2026 - CA
+   Tabulate the spectral functions on their regular (k,w) grid instead of
+   a TGraph2D, and sample hit nucleons from a GridSampler, without rejection.
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+#include <algorithm>
+
 #include <TSystem.h>
 #include <TNtupleD.h>
-#include <TGraph2D.h>
+#include <TMath.h>
 
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/Controls.h"
@@ -26,11 +32,15 @@
 #include "Physics/NuclearState/SpectralFunc.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/GridSampler.h"
 
 using namespace genie;
 using namespace genie::constants;
 using namespace genie::controls;
 
+// sampler cells per (k,w) grid cell, along each axis
+static const int kNSubCells = 4;
+
 //____________________________________________________________________________
 SpectralFunc::SpectralFunc() :
 NuclearModelI("genie::SpectralFunc")
@@ -48,85 +58,72 @@ NuclearModelI("genie::SpectralFunc", config)
 //____________________________________________________________________________
 SpectralFunc::~SpectralFunc()
 {
-//if (fSfFe56) delete fSfFe56;
-//if (fSfC12 ) delete fSfC12;
+  this->DeleteGrid(fSfFe56);
+  this->DeleteGrid(fSfC12);
 }
 //____________________________________________________________________________
 bool SpectralFunc::GenerateNucleon(const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  const SFGrid_t * sf = this->SelectSpectralFunction(target);
 
-  if(!sf) {
+  if(!sf || !sf->sampler->IsBuilt()) {
     fCurrRemovalEnergy = 0.;
     fCurrMomentum.SetXYZ(0.,0.,0.);
     return false;
   }
 
-  double kmin    = sf->GetXmin(); // momentum range
-  double kmax    = sf->GetXmax();
-  double wmin    = sf->GetYmin(); // removal energy range
-  double wmax    = sf->GetYmax();
-  double probmax = sf->GetZmax(); // maximum probability
-  probmax *= 1.1;
+  RandomGen * rnd = RandomGen::Instance();
 
-  double dk = kmax - kmin;
-  double dw = wmax - wmin;
+  double kc = 0, wc = 0;
+  sf->sampler->Generate(rnd->RndGen(), kc, wc);
 
-  LOG("SpectralFunc", pINFO) << "Momentum range = ["   << kmin << ", " << kmax << "]"; 
-  LOG("SpectralFunc", pINFO) << "Rmv energy range = [" << wmin << ", " << wmax << "]";
+  LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
+  LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
 
-  RandomGen * rnd = RandomGen::Instance();
+  // generate momentum components
+  double costheta = -1. + 2. * rnd->RndGen().Rndm();
+  double sintheta = TMath::Sqrt(1.-costheta*costheta);
+  double fi       = 2 * kPi * rnd->RndGen().Rndm();
+  double cosfi    = TMath::Cos(fi);
+  double sinfi    = TMath::Sin(fi);
 
-  unsigned int niter = 0;
-  while(1) {
-    if(niter > kRjMaxIterations) {
-       LOG("SpectralFunc", pWARN) 
-           << "Couldn't generate a hit nucleon after " << niter << " iterations";
-       return false;
-    }
-    niter++;
-
-    // random pair
-    double kc = kmin + dk * rnd->RndGen().Rndm();
-    double wc = wmin + dw * rnd->RndGen().Rndm();
-    LOG("SpectralFunc", pINFO) << "Trying p = " << kc << ", w = " << wc;
-
-    // accept/reject
-    double prob  = this->Prob(kc,wc, target);
-    double probg = probmax * rnd->RndGen().Rndm();
-    bool accept = (probg < prob);
-    if(!accept) continue;
-
-    LOG("SpectralFunc", pINFO) << "|p,nucleon| = " << kc; 
-    LOG("SpectralFunc", pINFO) << "|w,nucleon| = " << wc;
-
-    // generate momentum components
-    double costheta = -1. + 2. * rnd->RndGen().Rndm();
-    double sintheta = TMath::Sqrt(1.-costheta*costheta);
-    double fi       = 2 * kPi * rnd->RndGen().Rndm();
-    double cosfi    = TMath::Cos(fi);
-    double sinfi    = TMath::Sin(fi);
-
-    double kx = kc*sintheta*cosfi;
-    double ky = kc*sintheta*sinfi;
-    double kz = kc*costheta;
-
-    // set generated values
-    fCurrRemovalEnergy = wc;
-    fCurrMomentum.SetXYZ(kx,ky,kz);
-
-    return true;
-  }
-  return false;
+  double kx = kc*sintheta*cosfi;
+  double ky = kc*sintheta*sinfi;
+  double kz = kc*costheta;
+
+  // set generated values
+  fCurrRemovalEnergy = wc;
+  fCurrMomentum.SetXYZ(kx,ky,kz);
+
+  return true;
 }
 //____________________________________________________________________________
 double SpectralFunc::Prob(
                          double p, double w, const Target & target) const
 {
-  TGraph2D * sf = this->SelectSpectralFunction(target);
+  const SFGrid_t * sf = this->SelectSpectralFunction(target);
   if(!sf) return 0;
 
-  return sf->Interpolate(p,w);
+  return this->Interpolate(*sf, p, w);
+}
+//____________________________________________________________________________
+double SpectralFunc::Interpolate(
+                         const SFGrid_t & sf, double k, double w) const
+{
+// Bilinear interpolation of the grid values (0 outside the grid)
+
+  double xk = (k - sf.kmin) / sf.dk;
+  double xw = (w - sf.wmin) / sf.dw;
+  if(xk < 0. || xw < 0. || xk > sf.nk-1 || xw > sf.nw-1) return 0.;
+
+  int ik = TMath::Min((int) xk, sf.nk-2);
+  int iw = TMath::Min((int) xw, sf.nw-2);
+  double fk = xk - ik;
+  double fw = xw - iw;
+
+  const double * p = &sf.prob[ik*sf.nw+iw];
+  return (1.-fk) * ((1.-fw) * p[0]     + fw * p[1]) +
+             fk  * ((1.-fw) * p[sf.nw] + fw * p[sf.nw+1]);
 }
 //____________________________________________________________________________
 void SpectralFunc::Configure(const Registry & config)
@@ -160,20 +157,20 @@ void SpectralFunc::LoadConfig(void)
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_fe56.GetEntries() << " Fe56 points";
   LOG("SpectralFunc", pDEBUG) << "Loaded " << sfdata_c12.GetEntries()  << " C12 points";
 
-  if (fSfFe56) delete fSfFe56;
-  if (fSfC12 ) delete fSfC12;
+  this->DeleteGrid(fSfFe56);
+  this->DeleteGrid(fSfC12);
 
-  fSfFe56 = this->Convert2Graph(sfdata_fe56);
-  fSfC12  = this->Convert2Graph(sfdata_c12);
-
-  fSfFe56->SetName("sf_fe56");
-  fSfC12 ->SetName("sf_c12");
+  fSfFe56 = this->Convert2Grid(sfdata_fe56);
+  fSfC12  = this->Convert2Grid(sfdata_c12);
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
+SpectralFunc::SFGrid_t * SpectralFunc::Convert2Grid(TNtupleD & sfdata) const
 {
+// The spectral function data are given on a regular (k,w) grid: store the
+// values at the grid nodes and build the hit nucleon sampler, whose cells
+// are weighted by the bilinear interpolation at their centre
+
   int np = sfdata.GetEntries();
-  TGraph2D * sfgraph = new TGraph2D(np);
 
   sfdata.Draw("k:e:prob","","GOFF");
   assert(np==sfdata.GetSelectedRows());
@@ -181,18 +178,78 @@ TGraph2D * SpectralFunc::Convert2Graph(TNtupleD & sfdata) const
   double * e = sfdata.GetV2();
   double * p = sfdata.GetV3();
 
+  vector<double> kv, ev;
   for(int i=0; i<np; i++) {
-    double ki = k[i] * (units::MeV/units::GeV); // momentum
-    double ei = e[i] * (units::MeV/units::GeV); // removal energy
-    double pi = p[i] * TMath::Power(ki,2);      // probabillity
-    sfgraph->SetPoint(i, ki,ei,pi);
+    kv.push_back(k[i] * (units::MeV/units::GeV)); // momentum
+    ev.push_back(e[i] * (units::MeV/units::GeV)); // removal energy
   }
-  return sfgraph;
+  vector<double> knodes(kv), enodes(ev);
+  std::sort(knodes.begin(), knodes.end());
+  std::sort(enodes.begin(), enodes.end());
+  knodes.erase(std::unique(knodes.begin(), knodes.end()), knodes.end());
+  enodes.erase(std::unique(enodes.begin(), enodes.end()), enodes.end());
+
+  SFGrid_t * sf = new SFGrid_t;
+  sf->nk      = knodes.size();
+  sf->nw      = enodes.size();
+  sf->kmin    = knodes.front();
+  sf->wmin    = enodes.front();
+  sf->dk      = (sf->nk > 1) ? (knodes.back() - sf->kmin) / (sf->nk-1) : 0.;
+  sf->dw      = (sf->nw > 1) ? (enodes.back() - sf->wmin) / (sf->nw-1) : 0.;
+  sf->sampler = 0;
+
+  bool regular = (sf->nk > 1 && sf->nw > 1 && sf->nk * sf->nw == np);
+  for(int i=0; regular && i<sf->nk; i++) {
+    regular = TMath::Abs(knodes[i] - sf->kmin - i*sf->dk) < 1E-6 * sf->dk;
+  }
+  for(int i=0; regular && i<sf->nw; i++) {
+    regular = TMath::Abs(enodes[i] - sf->wmin - i*sf->dw) < 1E-6 * sf->dw;
+  }
+  if(!regular) {
+    LOG("SpectralFunc", pFATAL)
+      << "The spectral function data aren't given on a regular (k,w) grid";
+    exit(1);
+  }
+
+  sf->prob.assign(sf->nk * sf->nw, 0.);
+  for(int i=0; i<np; i++) {
+    int ik = TMath::Nint((kv[i] - sf->kmin) / sf->dk);
+    int iw = TMath::Nint((ev[i] - sf->wmin) / sf->dw);
+    sf->prob[ik*sf->nw+iw] = p[i] * TMath::Power(kv[i],2); // probabillity
+  }
+
+  int nck = kNSubCells * (sf->nk-1);
+  int ncw = kNSubCells * (sf->nw-1);
+  sf->sampler = new GridSampler(
+     nck, sf->kmin, sf->kmin + (sf->nk-1)*sf->dk,
+     ncw, sf->wmin, sf->wmin + (sf->nw-1)*sf->dw);
+  for(int ik=0; ik<nck; ik++) {
+    double kc = sf->sampler->XCentre(ik);
+    for(int iw=0; iw<ncw; iw++) {
+      double wc = sf->sampler->YCentre(iw);
+      sf->sampler->SetCell(ik, iw, this->Interpolate(*sf, kc, wc));
+    }
+  }
+  sf->sampler->Build();
+
+  LOG("SpectralFunc", pDEBUG)
+    << "Tabulated spectral function on a " << sf->nk << " x " << sf->nw
+    << " (k,w) grid";
+
+  return sf;
+}
+//____________________________________________________________________________
+void SpectralFunc::DeleteGrid(SFGrid_t * sf) const
+{
+  if(!sf) return;
+  delete sf->sampler;
+  delete sf;
 }
 //____________________________________________________________________________
-TGraph2D * SpectralFunc::SelectSpectralFunction(const Target & t) const
+const SpectralFunc::SFGrid_t * SpectralFunc::SelectSpectralFunction(
+                                                        const Target & t) const
 {
-  TGraph2D * sf = 0;
+  const SFGrid_t * sf = 0;
   int pdgc = t.Pdg();
 
   if      (pdgc == kPdgTgtC12)  sf = fSfC12;
@@ -5,6 +5,9 @@
 
 \brief    A realistic spectral function - based nuclear model.
           Is a concrete implementation of the NuclearModelI interface.
+          The Benhar et al. spectral functions are tabulated on a regular
+          (k, removal energy) grid and interpolated bilinearly. Hit nucleons
+          are sampled without rejection from a finer grid of cells.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -21,13 +24,18 @@
 #ifndef _SPECTRAL_FUNCTION_H_
 #define _SPECTRAL_FUNCTION_H_
 
+#include <vector>
+
 #include "Physics/NuclearState/NuclearModelI.h"
 
 class TNtupleD;
-class TGraph2D;
+
+using std::vector;
 
 namespace genie {
 
+class GridSampler;
+
 class SpectralFunc : public NuclearModelI {
 
 public:
@@ -52,12 +60,27 @@ public:
   void Configure (string config);
 
 private:
+
+  //! k^2 * spectral function at the nodes of a regular (k,w) grid
+  struct SFGrid_t {
+    int            nk;      ///< # of momentum nodes
+    int            nw;      ///< # of removal energy nodes
+    double         kmin;    ///< first momentum node
+    double         dk;      ///< momentum node spacing
+    double         wmin;    ///< first removal energy node
+    double         dw;      ///< removal energy node spacing
+    vector<double> prob;    ///< values at the nodes [ik*nw+iw]
+    GridSampler *  sampler; ///< hit nucleon (k,w) sampler
+  };
+
   void       LoadConfig             (void);
-  TGraph2D * Convert2Graph          (TNtupleD & data) const;
-  TGraph2D * SelectSpectralFunction (const Target & target) const; 
+  SFGrid_t * Convert2Grid           (TNtupleD & data) const;
+  void       DeleteGrid             (SFGrid_t * sf) const;
+  double     Interpolate            (const SFGrid_t & sf, double k, double w) const;
+  const SFGrid_t * SelectSpectralFunction (const Target & target) const; 
 
-  TGraph2D * fSfFe56;   ///< Benhar's Fe56 SF
-  TGraph2D * fSfC12;    ///< Benhar's C12 SF
+  SFGrid_t * fSfFe56;   ///< Benhar's Fe56 SF
+  SFGrid_t * fSfC12;    ///< Benhar's C12 SF
 };
 
 }      // genie namespace
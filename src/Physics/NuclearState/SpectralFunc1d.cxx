@@ -10,6 +10,9 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   Sample the hit nucleon momentum from a GridSampler rather than with the
+   rejection method.
 
 */
 //____________________________________________________________________________
@@ -25,6 +28,7 @@
 #include "Physics/NuclearState/SpectralFunc1d.h"
 #include "Framework/Numerical/RandomGen.h"
 #include "Framework/Numerical/Spline.h"
+#include "Framework/Numerical/GridSampler.h"
 #include "Framework/ParticleData/PDGCodes.h"
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
@@ -64,37 +68,14 @@ bool SpectralFunc1d::GenerateNucleon(const Target & target) const
 
   // Select fermi momentum from the integrated (over removal energies) s/f.
   //
-  spl_it = fSFk.find(Z);
-  dbl_it = fMaxProb.find(Z);
-  if(spl_it == fSFk.end() || dbl_it == fMaxProb.end()) {
+  map<int, GridSampler*>::const_iterator smp_it = fSampler.find(Z);
+  if(smp_it == fSampler.end() || !smp_it->second->IsBuilt()) {
     fCurrRemovalEnergy = 0.;
     fCurrMomentum.SetXYZ(0.,0.,0.);
     return false;
   }
 
-  double prob_max = dbl_it->second;
-  LOG("SpectralFunc1", pDEBUG) << "Max probability = " << prob_max;
-
-  double p = 0;
-  unsigned int niter = 0;
-  while(1) {
-    if(niter > kRjMaxIterations) {
-       LOG("SpectralFunc1", pWARN)
-        << "Couldn't generate a hit nucleon after " << niter << " iterations";
-       return false;
-    }
-    niter++;
-
-    if(fUseRFGMomentumCutoff) p = fPCutOff * rnd->RndGen().Rndm();
-    else p = rnd->RndGen().Rndm();
-
-    double prob  = spl_it->second->Evaluate(p);
-    double probg = prob_max * rnd->RndGen().Rndm();
-    LOG("SpectralFunc1", pDEBUG) << "Trying p = " << p << " / prob = " << prob;
-
-    bool accept = (probg<prob);
-    if(accept) break;
-  }
+  double p = smp_it->second->Generate(rnd->RndGen());
 
   LOG("SpectralFunc1", pINFO) << "|p,nucleon| = " << p;
 
@@ -184,22 +165,6 @@ void SpectralFunc1d::LoadConfig(void)
   spl = new Spline(fe56_sf1dw_file);
   fSFw.insert(map<int, Spline*>::value_type(26,spl));
 
-  // scan for max.
-  map<int, Spline*>::const_iterator spliter;
-  int    n    = 100;
-  double pmin =  0.000;
-  double dp   =  0.010;
-  for(spliter = fSFk.begin(); spliter != fSFk.end(); ++spliter) {
-    double prob_max = 0;
-    int Z = spliter->first;
-    spl = spliter->second;
-    for(int i=0; i<n; i++) {
-       double p = pmin + i*dp;
-       prob_max = TMath::Max(prob_max, spl->Evaluate(p));
-    }
-    fMaxProb.insert(map<int,double>::value_type(Z,prob_max));
-  }
-
   // Check whether to use the same removal energies as in the FG model or
   // to use the average removal energy for the selected fermi momentum
   // (computed from the spectral function itself)
@@ -211,6 +176,20 @@ void SpectralFunc1d::LoadConfig(void)
   //Get the momentum cutoff
   GetParam( "RFG-MomentumCutOff", fPCutOff ) ;
 
+  // Tabulate the SF(k) momentum distributions, in 1 MeV cells, for
+  // sampling them without rejection
+  double pmax = (fUseRFGMomentumCutoff) ? fPCutOff : 1.;
+  int    npc  = TMath::Max(100, (int) (1000*pmax));
+  map<int, Spline*>::const_iterator spliter;
+  for(spliter = fSFk.begin(); spliter != fSFk.end(); ++spliter) {
+    GridSampler * sampler = new GridSampler(npc, 0., pmax);
+    for(int i=0; i<npc; i++) {
+       sampler->SetCell(i, spliter->second->Evaluate(sampler->XCentre(i)));
+    }
+    sampler->Build();
+    fSampler.insert(map<int, GridSampler*>::value_type(spliter->first, sampler));
+  }
+
   // Removal energies as used in the FG model
   // Load removal energy for specific nuclei from either the algorithm's
   // configuration file or the UserPhysicsOptions file.
@@ -246,8 +225,12 @@ void SpectralFunc1d::CleanUp(void)
   }
   fSFk.clear();
   fSFw.clear();
+  map<int, GridSampler*>::iterator smpiter;
+  for(smpiter = fSampler.begin(); smpiter != fSampler.end(); ++smpiter) {
+    delete smpiter->second;
+  }
   fNucRmvE.clear();
-  fMaxProb.clear();
+  fSampler.clear();
 }
 //____________________________________________________________________________
 
@@ -32,6 +32,7 @@ using std::map;
 namespace genie {
 
 class Spline;
+class GridSampler;
 class SpectralFunc1d : public NuclearModelI {
 
 public:
@@ -68,7 +69,7 @@ private:
   map<int, Spline *> fSFk;     ///< All available spectral funcs integrated over removal energy
   map<int, Spline *> fSFw;     ///< Average nucleon removal as a function of pF - computed from the spectral function
   map<int, double>   fNucRmvE; ///< Removal energies as used in FG model
-  map<int, double>   fMaxProb; ///< Max SF(k) probability used in rejection method
+  map<int, GridSampler *> fSampler; ///< Samplers of the SF(k) momentum distributions
 };
 
 }         // genie namespace
@@ -12,6 +12,9 @@
  Important revisions after version 2.0.0 :
  @ Nov 03, 2008 - CA
    First added in v2.7.1
+ @ Oct 14, 2026 - CA
+   The max phase space decay weight is taken from PhaseSpaceWeightCache,
+   rather than from 200 trial decays at every event.
 
 */
 //____________________________________________________________________________
@@ -30,6 +33,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/PhaseSpaceWeightCache.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Physics/NucleonDecay/NucleonDecayPrimaryVtxGenerator.h"
 #include "Physics/NucleonDecay/NucleonDecayUtils.h"
@@ -109,13 +113,13 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
   if(fNucleonIsBound) 
   {
     // add initial nucleus
-    double Mi  = PDGLibrary::Instance()->Find(ipdg)->Mass();
+    double Mi  = PDGLibrary::Instance()->Mass(ipdg);
     TLorentzVector p4i(0,0,0,Mi);
     event->AddParticle(ipdg,stis,-1,-1,-1,-1, p4i, v4);
                
     // add decayed nucleon
     int dpdg = fCurrDecayedNucleon;
-    double mn = PDGLibrary::Instance()->Find(dpdg)->Mass();
+    double mn = PDGLibrary::Instance()->Mass(dpdg);
     TLorentzVector p4n(0,0,0,mn);  
     event->AddParticle(dpdg,stdc, 0,-1,-1,-1, p4n, v4);
      
@@ -125,7 +129,7 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
     A--;
     if(dpdg == kPdgProton) { Z--; }
     int rpdg = pdg::IonPdgCode(A, Z);
-    double Mf  = PDGLibrary::Instance()->Find(rpdg)->Mass();
+    double Mf  = PDGLibrary::Instance()->Mass(rpdg);
     TLorentzVector p4f(0,0,0,Mf);
     event->AddParticle(rpdg,stfs,0,-1,-1,-1, p4f, v4);
   }
@@ -154,7 +158,7 @@ void NucleonDecayPrimaryVtxGenerator::AddInitialState(
        throw exception;
     }
     // add initial nucleon
-    double mn  = PDGLibrary::Instance()->Find(ipdg)->Mass();
+    double mn  = PDGLibrary::Instance()->Mass(ipdg);
     TLorentzVector p4i(0,0,0,mn);
     event->AddParticle(dpdg,stis,-1,-1,-1,-1, p4i, v4);
     // add decayed nucleon
@@ -180,52 +184,20 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayedNucleonPosition(
   LOG("NucleonDecay", pINFO)
       << "Generating vertex according to a realistic nuclear density profile";
 
-  // get inputs to the rejection method
-  double ymax = -1;
+  // select the radius from the cumulative r^2 rho(r) distribution
   double rmax = 3*R;
-  double dr   = R/40.;
-  for(double r = 0; r < rmax; r+=dr) {
-      ymax = TMath::Max(ymax, r*r * utils::nuclear::Density(r,A));
-  }
-  ymax *= 1.2;
-  
-  // select a vertex using the rejection method 
-  TLorentzVector vtx(0,0,0,0);
-  unsigned int iter = 0;
-  while(1) {
-    iter++;
+  double r    = utils::nuclear::RadiusQuantile(A, rnd->RndFsi().Rndm(), rmax);
 
-    // throw an exception if it hasn't find a solution after many attempts
-    if(iter > controls::kRjMaxIterations) {
-       LOG("NucleonDecay", pWARN)
-           << "Couldn't generate a vertex position after " << iter << " iterations";
-       genie::exceptions::EVGThreadException exception;
-       exception.SetReason("Couldn't generate vertex");
-       exception.SwitchOnFastForward();
-       throw exception;
-    }
-           
-    double r = rmax * rnd->RndFsi().Rndm();
-    double t = ymax * rnd->RndFsi().Rndm();
-    double y = r*r * utils::nuclear::Density(r,A);
-    if(y > ymax) {   
-       LOG("NucleonDecay", pERROR)
-          << "y = " << y << " > ymax = " << ymax << " for r = " << r << ", A = " << A;
-    }
-    bool accept = (t < y);
-    if(accept) {
-       double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
-       double cosphi   = TMath::Cos(phi);
-       double sinphi   = TMath::Sin(phi);
-       double costheta = -1 + 2 * rnd->RndFsi().Rndm();
-       double sintheta = TMath::Sqrt(1-costheta*costheta);
-       vtx.SetX(r*sintheta*cosphi);
-       vtx.SetY(r*sintheta*sinphi);
-       vtx.SetZ(r*costheta);
-       vtx.SetT(0.);
-       break;
-    }
-  } // while 1
+  TLorentzVector vtx(0,0,0,0);
+  double phi      = 2*constants::kPi * rnd->RndFsi().Rndm();
+  double cosphi   = TMath::Cos(phi);
+  double sinphi   = TMath::Sin(phi);
+  double costheta = -1 + 2 * rnd->RndFsi().Rndm();
+  double sintheta = TMath::Sqrt(1-costheta*costheta);
+  vtx.SetX(r*sintheta*cosphi);
+  vtx.SetY(r*sintheta*sinphi);
+  vtx.SetZ(r*costheta);
+  vtx.SetT(0.);
 
   GHepParticle * decayed_nucleon = event->Particle(1);
   assert(decayed_nucleon);
@@ -293,7 +265,7 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
   double   sum  = 0;
   for(pdg_iter = pdgv.begin(); pdg_iter != pdgv.end(); ++pdg_iter) {
     int pdgc = *pdg_iter;
-    double m = PDGLibrary::Instance()->Find(pdgc)->Mass();
+    double m = PDGLibrary::Instance()->Mass(pdgc);
     mass[i++] = m;
     sum += m;
   }
@@ -328,13 +300,10 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
      throw exception;
   }
 
-  // Get the maximum weight
-  //double wmax = fPhaseSpaceGenerator.GetWtMax();
-  double wmax = -1;
-  for(int idec=0; idec<200; idec++) {
-     double w = fPhaseSpaceGenerator.Generate();   
-     wmax = TMath::Max(wmax,w);
-  }
+  // Get the maximum weight (cached per decay product list & W bin: the
+  // W of a bound nucleon varies from event to event)
+  PhaseSpaceWeightCache * wcache = PhaseSpaceWeightCache::Instance();
+  double wmax = wcache->MaxWeight(fPhaseSpaceGenerator, *p4d, pdgv);
   assert(wmax>0);
   wmax *= 2;
 
@@ -369,6 +338,7 @@ void NucleonDecayPrimaryVtxGenerator::GenerateDecayProducts(
      if(w > wmax) {
         LOG("NucleonDecay", pWARN) 
            << "Decay weight = " << w << " > max decay weight = " << wmax;
+        wcache->RaiseMaxWeight(*p4d, pdgv, w);
      }
      double gw = wmax * rnd->RndHadro().Rndm();
      accept_decay = (gw<=w);
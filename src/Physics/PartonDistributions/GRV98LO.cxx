@@ -11,6 +11,10 @@
  For the class documentation see the corresponding header file.
 
  Important revisions:
+ @ Oct 14, 2026 - CA
+   Interpolate all partons from a single (log x, log Q2) cell look-up on an
+   interleaved knot array, instead of 6 separate Interpolator2D objects.
+   Added the batched AllPDFs() evaluation.
 
 */
 //____________________________________________________________________________
@@ -30,25 +34,13 @@ using namespace genie;
 
 //____________________________________________________________________________
 GRV98LO::GRV98LO() :
-PDFModelI("genie::GRV98LO"),
- fXUVF(NULL),
- fXDVF(NULL),
- fXDEF(NULL),
- fXUDF(NULL),
- fXSF (NULL),
- fXGF (NULL)
+PDFModelI("genie::GRV98LO")
 {
   this->Initialize();
 }
 //____________________________________________________________________________
 GRV98LO::GRV98LO(string config) :
-PDFModelI("genie::GRV98LO", config),
- fXUVF(NULL),
- fXDVF(NULL),
- fXDEF(NULL),
- fXUDF(NULL),
- fXSF (NULL),
- fXGF (NULL)
+PDFModelI("genie::GRV98LO", config)
 {
   LOG("GRV98LO", pDEBUG) << "GRV98LO configuration:\n " << GetConfig() ;
 
@@ -57,12 +49,7 @@ PDFModelI("genie::GRV98LO", config),
 //____________________________________________________________________________
 GRV98LO::~GRV98LO() 
 { 
-  if (fXUVF) {delete fXUVF; fXUVF = NULL;}
-  if (fXDVF) {delete fXDVF; fXDVF = NULL;}
-  if (fXDEF) {delete fXDEF; fXDEF = NULL;}
-  if (fXUDF) {delete fXUDF; fXUDF = NULL;}
-  if (fXSF ) {delete fXSF ; fXSF  = NULL;}
-  if (fXGF ) {delete fXGF ; fXGF  = NULL;}
+
 }
 //____________________________________________________________________________
 double GRV98LO::UpValence(double x, double Q2) const
@@ -129,6 +116,25 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
     return pdf;
   }
 
+  this->Evaluate(x, Q2, pdf);
+
+  return pdf;                                               
+}
+//____________________________________________________________________________
+void GRV98LO::AllPDFs(
+   const double * x, const double * Q2, PDF_t * pdfs, int n) const
+{
+  if(!fInitialized) {
+    for(int i = 0; i < n; i++) pdfs[i] = this->AllPDFs(x[i], Q2[i]);
+    return;
+  }
+  for(int i = 0; i < n; i++) {
+    this->Evaluate(x[i], Q2[i], pdfs[i]);
+  }
+}
+//____________________________________________________________________________
+void GRV98LO::Evaluate(double x, double Q2, PDF_t & pdf) const
+{
   LOG("GRV98LO", pDEBUG) 
     << "Inputs x = " << x << ", Q2 = " << Q2;
 
@@ -149,14 +155,36 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   double x1p5  = x1*x1p4;
   double x1p7  = x1p3*x1p4;
 
-  double uv = fXUVF->Eval(logx,logQ2) * x1p3 * xv;
-  double dv = fXDVF->Eval(logx,logQ2) * x1p4 * xv;
-  double de = fXDEF->Eval(logx,logQ2) * x1p7 * xv;
-  double ud = fXUDF->Eval(logx,logQ2) * x1p7 * xs;
+  // bilinear interpolation in (logx, logQ2), as gsl_interp2d_bilinear
+  int ix = this->Cell(fGridLogXbj, kNXbj, logx);
+  int iq = this->Cell(fGridLogQ2,  kNQ2,  logQ2);
+
+  double t = (logx  - fGridLogXbj[ix]) / (fGridLogXbj[ix+1] - fGridLogXbj[ix]);
+  double u = (logQ2 - fGridLogQ2 [iq]) / (fGridLogQ2 [iq+1] - fGridLogQ2 [iq]);
+
+  double w00 = (1.0-t)*(1.0-u);
+  double w10 = t*(1.0-u);
+  double w01 = (1.0-t)*u;
+  double w11 = t*u;
+
+  const double * z00 = fKnots[iq  ][ix  ];
+  const double * z10 = fKnots[iq  ][ix+1];
+  const double * z01 = fKnots[iq+1][ix  ];
+  const double * z11 = fKnots[iq+1][ix+1];
+
+  double f[kNParton];
+  for(int ip = 0; ip < kNParton; ip++) {
+    f[ip] = w00*z00[ip] + w10*z10[ip] + w01*z01[ip] + w11*z11[ip];
+  }
+
+  double uv = f[0] * x1p3 * xv;
+  double dv = f[1] * x1p4 * xv;
+  double de = f[2] * x1p7 * xv;
+  double ud = f[3] * x1p7 * xs;
   double us = 0.5 * (ud - de);
   double ds = 0.5 * (ud + de);
-  double ss = fXSF->Eval(logx,logQ2)  * x1p7 * xs;
-  double gl = fXGF->Eval(logx,logQ2)  * x1p5 * xs;
+  double ss = f[4] * x1p7 * xs;
+  double gl = f[5] * x1p5 * xs;
   
   pdf.uval = uv;
   pdf.dval = dv; 
@@ -167,8 +195,17 @@ PDF_t GRV98LO::AllPDFs(double x, double Q2) const
   pdf.bot  = 0.;
   pdf.top  = 0.;
   pdf.gl   = gl;
-  
-  return pdf;                                               
+}
+//____________________________________________________________________________
+int GRV98LO::Cell(const double * grid, int n, double v) const
+{
+// Index i of the grid cell [grid[i], grid[i+1]] containing v (the last
+// cell for v at the upper grid edge)
+
+  int i = TMath::BinarySearch(n, grid, v);
+  if(i < 0  ) return 0;
+  if(i > n-2) return n-2;
+  return i;
 }
 //____________________________________________________________________________
 void GRV98LO::Configure(const Registry & config)
@@ -292,25 +329,11 @@ void GRV98LO::Initialize(void)
 
   grid_file.close();
 
-  // arrays for interpolation routines
+  // interpolation knots
   // 
   
-  vector<double> gridLogQ2 (kNQ2);
-  vector<double> gridLogXbj(kNXbj);
-  vector<double> knotsXUVF(kNQ2*kNXbj);
-  vector<double> knotsXDVF(kNQ2*kNXbj);
-  vector<double> knotsXDEF(kNQ2*kNXbj);
-  vector<double> knotsXUDF(kNQ2*kNXbj);
-  vector<double> knotsXSF (kNQ2*kNXbj);
-  vector<double> knotsXGF (kNQ2*kNXbj);
-
-  k=0;
   for(int i=0; i < kNQ2; i++) {
-    double logQ2 = std::log(fGridQ2[i]);
-    gridLogQ2[i] = logQ2;
     for(int j=0; j < kNXbj - 1; j++) {
-       double logx  = std::log(fGridXbj[j]);
-       gridLogXbj[j] = logx;
        double xb0v  = std::sqrt(fGridXbj[j]);
        double xb0s  = std::pow(fGridXbj[j], -0.2);
        double xb1   = 1 - fGridXbj[j];
@@ -318,32 +341,19 @@ void GRV98LO::Initialize(void)
        double xb1p4 = std::pow(xb1, 4.);
        double xb1p5 = std::pow(xb1, 5.);
        double xb1p7 = std::pow(xb1, 7.);
-       knotsXUVF[k] = fParton[0][i][j] / (xb1p3 * xb0v);
-       knotsXDVF[k] = fParton[1][i][j] / (xb1p4 * xb0v);
-       knotsXDEF[k] = fParton[2][i][j] / (xb1p7 * xb0v);
-       knotsXUDF[k] = fParton[3][i][j] / (xb1p7 * xb0s);
-       knotsXSF [k] = fParton[4][i][j] / (xb1p7 * xb0s);
-       knotsXGF [k] = fParton[5][i][j] / (xb1p5 * xb0s);
-       k++;
+       fKnots[i][j][0] = fParton[0][i][j] / (xb1p3 * xb0v);
+       fKnots[i][j][1] = fParton[1][i][j] / (xb1p4 * xb0v);
+       fKnots[i][j][2] = fParton[2][i][j] / (xb1p7 * xb0v);
+       fKnots[i][j][3] = fParton[3][i][j] / (xb1p7 * xb0s);
+       fKnots[i][j][4] = fParton[4][i][j] / (xb1p7 * xb0s);
+       fKnots[i][j][5] = fParton[5][i][j] / (xb1p5 * xb0s);
+    }
+    // the pdfs vanish at the x = 1 grid edge
+    for(int ip=0; ip < kNParton; ip++) {
+       fKnots[i][kNXbj-1][ip] = 0;
     }
-    double logxmax = TMath::Log(fGridXbj[kNXbj-1]);
-    gridLogXbj[kNXbj-1] = logxmax;
-    knotsXUVF[k] = 0;
-    knotsXDVF[k] = 0;
-    knotsXDEF[k] = 0;
-    knotsXUDF[k] = 0;
-    knotsXSF [k] = 0;
-    knotsXGF [k] = 0;
-    k++;
   }
   
-  fXUVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUVF[0]);
-  fXDVF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDVF[0]);
-  fXDEF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXDEF[0]);
-  fXUDF = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXUDF[0]);
-  fXSF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXSF [0]);
-  fXGF  = new Interpolator2D(gridLogXbj.size(),&gridLogXbj[0],gridLogQ2.size(),&gridLogQ2[0],&knotsXGF [0]);
-  
   fInitialized = true;
 }
 //____________________________________________________________________________
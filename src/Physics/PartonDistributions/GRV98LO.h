@@ -12,6 +12,11 @@
           The original code contains NLO (MSbar and DIS schemes) and LO pdf
           implementations. Only the LO pdfs are implemented here.
 
+          The 6 tabulated parton distributions are interpolated bilinearly
+          in (log x, log Q^2). Their grid knots are interleaved, so that all
+          of them are evaluated from a single cell look-up and 4 contiguous
+          memory blocks.
+
           Reference listed in original code:
           M. Glueck, E. Reya, A. Vogt,
           Eur. Phys. J. C5 (1998) 461-470; hep-ph/9806404
@@ -31,7 +36,6 @@
 #define _GRV98LO_H_
 
 #include "Physics/PartonDistributions/PDFModelI.h"
-#include "Framework/Numerical/Interpolator2D.h"
 
 namespace genie {
 
@@ -54,6 +58,8 @@ public:
   double Top         (double x, double Q2) const;
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
+  void   AllPDFs     (const double * x, const double * Q2,
+                      PDF_t * pdfs, int n) const;
 
   // override the default "Configure" implementation 
   // of the Algorithm interface
@@ -64,6 +70,8 @@ public:
 private:
 
   void Initialize   (void);
+  void Evaluate     (double x, double Q2, PDF_t & pdf) const;
+  int  Cell         (const double * grid, int n, double v) const;
 
   bool fInitialized;
 
@@ -83,14 +91,10 @@ private:
   double fGridLogXbj[kNXbj]; // log(Bjorken-x) values in grid
   double fParton    [kNParton][kNQ2][kNXbj-1]; // PARTON (NPART,NQ,NX-1) array in original code
   //
-  // arrays for the interpolation routine
+  // interpolation knots = f(logx,logQ2), with the small and large x
+  // behaviour factored out, for: xuv, xdv, xdel, xudb, xsb, xg
   //
-  Interpolator2D * fXUVF; // = f(logx,logQ2)
-  Interpolator2D * fXDVF;
-  Interpolator2D * fXDEF;
-  Interpolator2D * fXUDF;
-  Interpolator2D * fXSF;
-  Interpolator2D * fXGF;
+  double fKnots     [kNQ2][kNXbj][kNParton];
 };
 
 }         // genie namespace
@@ -49,6 +49,7 @@ public:
   double Top         (double x, double Q2) const;
   double Gluon       (double x, double Q2) const;
   PDF_t  AllPDFs     (double x, double Q2) const;
+  using PDFModelI::AllPDFs;
 
   // Override the default "Configure" implementation 
   // of the Algorithm interface
@@ -42,6 +42,14 @@ PDFModelI::~PDFModelI()
 
 }
 //____________________________________________________________________________
+void PDFModelI::AllPDFs(
+   const double * x, const double * Q2, PDF_t * pdfs, int n) const
+{
+  for(int i = 0; i < n; i++) {
+    pdfs[i] = this->AllPDFs(x[i], Q2[i]);
+  }
+}
+//____________________________________________________________________________
 
 
 
@@ -45,6 +45,12 @@ public:
   virtual double Gluon       (double x, double Q2) const = 0;
   virtual PDF_t  AllPDFs     (double x, double Q2) const = 0;
 
+  //-- batched evaluation of all PDFs at the n points (x[i], Q2[i]).
+  //   The default implementation loops over AllPDFs(x,Q2).
+
+  virtual void   AllPDFs     (const double * x, const double * Q2,
+                              PDF_t * pdfs, int n) const;
+
 protected:
 
   PDFModelI();
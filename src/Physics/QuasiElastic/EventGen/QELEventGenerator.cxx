@@ -22,6 +22,9 @@
    dipole form from the dsigma/dQ2 p.d.f.
  @ 2015 - AF
    New QELEventgenerator class replaces previous methods in QEL.
+ @ Oct 14, 2026 - CA
+   Sample cos(theta_0) from a dipole-like proposal following the fall of the
+   xsec with Q2, rather than uniformly (see CosTheta0Proposal()).
 */
 //____________________________________________________________________________
 
@@ -49,6 +52,8 @@
 
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Framework/Numerical/MathUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 
@@ -121,6 +126,12 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     //   If the kinematics are generated uniformly over the allowed phase
     //   space the max xsec is irrelevant
     double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+    if(!fGenerateUniformly && xsec_max <= 0) return; // thread stopped by MaxXSec()
+
+    // Slope of the cos(theta_0) proposal (0: uniform). When a proposal is
+    // used, xsec_max bounds xsec/h(cos(theta_0)) rather than the xsec.
+    double k_prop = (fUseProposal && !fGenerateUniformly) ?
+        this->ProposalSlope(interaction) : 0.;
 
     // For a composite nuclear target, check to make sure that the
     // final nucleus has a recognized PDG code
@@ -151,6 +162,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
     while (1) {
 
         iter++;
+        this->CountTrial();
         LOG("QELEvent", pINFO) << "Attempt #: " << iter;
         if(iter > kRjMaxIterations) {
             LOG("QELEvent", pWARN)
@@ -193,7 +205,18 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
         // probe + hit nucleon COM frame as measured in the lab frame. That is,
         // costheta = 1 means that the outgoing lepton's COM frame 3-momentum
         // points parallel to the velocity of the COM frame.
-        double costheta = rnd->RndKine().Uniform(-1., cos_theta0_max); // cosine theta
+        // When a proposal h(cos(theta_0)) is used, the xsec tested below is
+        // weighted by <h>/h (<h>: mean of h over [-1,cos_theta0_max]) so that
+        // the accepted kinematics follow the same distribution as with a
+        // uniform cos(theta_0).
+        double costheta = 0., weight = 1.;
+        if ( k_prop > 0. ) {
+          costheta = this->CosTheta0Proposal(k_prop, cos_theta0_max,
+                         rnd->RndKine().Rndm(), weight);
+        }
+        else {
+          costheta = rnd->RndKine().Uniform(-1., cos_theta0_max); // cosine theta
+        }
         double phi = rnd->RndKine().Uniform( 2.*kPi ); // phi: [0, 2pi]
 
         // Set the "bind_nucleon" flag to false in this call to ComputeFullQELPXSec
@@ -203,15 +226,15 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
           fXSecModel, costheta, phi, fEb, fHitNucleonBindingMode, fMinAngleEM, false);
 
         // select/reject event
-        this->AssertXSecLimits(interaction, xsec, xsec_max);
+        this->AssertXSecLimits(interaction, xsec*weight, xsec_max);
 
         double t = xsec_max * rnd->RndKine().Rndm();
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("QELEvent", pDEBUG)
-            << "xsec= " << xsec << ", Rnd= " << t;
+            << "xsec= " << xsec << ", weight= " << weight << ", Rnd= " << t;
 #endif
-        accept = (t < xsec);
+        accept = (t < xsec*weight);
 
         // If the generated kinematics are accepted, finish-up module's job
         if(accept) {
@@ -245,7 +268,7 @@ void QELEventGenerator::ProcessEventRecord(GHepRecord * evrec) const
                 rpdgc = interaction->RecoilNucleonPdg();
             }
             assert(rpdgc);
-            double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+            double gW = PDGLibrary::Instance()->Mass(rpdgc);
             LOG("QELEvent", pNOTICE) << "Selected: W = "<< gW;
 
             // (W,Q2) -> (x,y)
@@ -410,6 +433,12 @@ void QELEventGenerator::LoadConfig(void)
     fHitNucleonBindingMode = genie::utils::StringToQELBindingMode( binding_mode );
 
     GetParamDef( "MaxXSecNucleonThrows", fMaxXSecNucleonThrows, 800 );
+
+    // Sample cos(theta_0) from a proposal following the fall of the xsec
+    // with Q2, with the given Q2 scale (GeV^2)?
+    GetParamDef( "UseCosTheta0Proposal", fUseProposal,     true );
+    GetParamDef( "Proposal-Q2Scale",     fProposalQ2Scale, 1.0  );
+    assert(fProposalQ2Scale > 0.);
 }
 //____________________________________________________________________________
 double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
@@ -426,6 +455,10 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
     double xsec_max = -1;
     double dummy_Eb = 0.;
 
+    // With a cos(theta_0) proposal h, the max of xsec/h is needed
+    double k_prop = (fUseProposal && !fGenerateUniformly) ?
+        this->ProposalSlope(in) : 0.;
+
     // Clone the input interaction so that we can modify it a bit
     Interaction * interaction = new Interaction( *in );
     interaction->SetBit( kISkipProcessChk );
@@ -503,6 +536,7 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
                   // BindHitNucleon() above
                   double xs = genie::utils::ComputeFullQELPXSec(interaction,
                     fNuclModel, fXSecModel, costh, phi, dummy_Eb, kOnShell, fMinAngleEM, false);
+                  if ( k_prop > 0. ) xs /= this->ProposalDensity(k_prop, costh);
 
                   if (xs > this_nuc_xsec_max){
                       phi_at_xsec_max = phi;
@@ -544,3 +578,84 @@ double QELEventGenerator::ComputeMaxXSec(const Interaction * in) const
     LOG("QELEvent", pINFO) << "Computed maximum cross section to throw against - value is " << xsec_max;
     return xsec_max;
 }
+//____________________________________________________________________________
+double QELEventGenerator::ProposalSlope(const Interaction * in) const
+{
+// Slope k of the cos(theta_0) proposal h = 1/(1+k(1-cos(theta_0)))^2.
+// For a nucleon at rest Q2 ~ 2p*^2(1-cos(theta_0)), where p* is the COM
+// frame momentum, so h falls like a dipole 1/(1+Q2/Q2scale)^2. The slope
+// depends only on the energy that the max xsec is cached against.
+
+  double E = this->Energy(in);
+  double M = in->InitState().Tgt().HitNucMass();
+  double s = M*M + 2.*M*E;
+  if ( s <= 0. ) return 0.;
+
+  double pstar2 = (s - M*M) * (s - M*M) / (4.*s);
+  return 2. * pstar2 / fProposalQ2Scale;
+}
+//____________________________________________________________________________
+double QELEventGenerator::ProposalDensity(double k, double costh) const
+{
+  double d = 1. + k * (1. - costh);
+  return 1. / (d*d);
+}
+//____________________________________________________________________________
+double QELEventGenerator::CosTheta0Proposal(
+  double k, double costh_max, double u, double & weight) const
+{
+// Generates cos(theta_0) in [-1, costh_max] according to h (see
+// ProposalSlope()) by inverting its cumulative distribution, and returns
+// the weight <h>/h(cos(theta_0)), where <h> is the mean of h over the range.
+
+  double x0 = 1. - costh_max;   // x = 1-cos(theta_0), in [x0, 2]
+  double a  = 1. / (1. + k*x0);
+  double b  = 1. / (1. + k*2.);
+  double x  = (1. / (a - u*(a - b)) - 1.) / k;
+  x = TMath::Min(TMath::Max(x, x0), 2.);
+
+  double costh = 1. - x;
+  double hmean = (a - b) / (k * (2. - x0));
+  weight = hmean / this->ProposalDensity(k, costh);
+
+  return costh;
+}
+//____________________________________________________________________________
+CacheBranchFx * QELEventGenerator::AccessCacheBranch(
+                                      const Interaction * interaction) const
+{
+// With a cos(theta_0) proposal the cached max values are those of xsec/h,
+// so they are kept in a cache branch of their own
+
+  if ( !fUseProposal || fGenerateUniformly ) {
+    return KineGeneratorWithCache::AccessCacheBranch(interaction);
+  }
+
+  Cache * cache = Cache::Instance();
+
+  // look-up the branch through the hashed algorithm/interaction signature
+  ULong64_t id = interaction->Signature(this->Id().Key() + "/prop");
+  CacheBranchFx * cache_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(id));
+  if(cache_branch) return cache_branch;
+
+  // build the cache branch key as: namespace::algorithm/config/interaction
+  string algkey = this->Id().Key();
+  string intkey = interaction->AsString();
+  string key    = cache->CacheBranchKey(algkey, intkey, "prop");
+
+  cache_branch = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(!cache_branch) {
+    //-- create the cache branch at the first pass
+    LOG("Kinematics", pINFO) << "No Max d^nXSec/d{K}^n cache branch found";
+    LOG("Kinematics", pINFO) << "Creating cache branch - key = " << key;
+
+    cache_branch = new CacheBranchFx("max[d^nXSec/d^n{K} / h] over phase space");
+    cache->AddCacheBranch(key, cache_branch);
+  }
+  assert(cache_branch);
+  cache->IndexCacheBranch(id, cache_branch);
+
+  return cache_branch;
+}
+//____________________________________________________________________________
@@ -55,6 +55,13 @@ private:
 
   void AddTargetNucleusRemnant (GHepRecord * evrec) const; ///< add a recoiled nucleus remnant
 
+  // cos(theta_0) proposal h = 1/(1+k(1-cos(theta_0)))^2
+  double ProposalSlope     (const Interaction * in) const;
+  double ProposalDensity   (double k, double costh) const;
+  double CosTheta0Proposal (double k, double costh_max, double u, double & weight) const;
+
+  CacheBranchFx * AccessCacheBranch (const Interaction * in) const;
+
   const NuclearModelI *  fNuclModel;   ///< nuclear model
 
   mutable double fMinAngleEM;
@@ -67,6 +74,9 @@ private:
   /// momentum to use in ComputeMaxXSec()
   int fMaxXSecNucleonThrows;
 
+  bool   fUseProposal;      ///< sample cos(theta_0) from a proposal following the xsec fall with Q2?
+  double fProposalQ2Scale;  ///< Q2 scale (GeV^2) of the proposal
+
 }; // class definition
 
 } // genie namespace
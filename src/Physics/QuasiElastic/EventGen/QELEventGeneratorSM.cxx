@@ -53,6 +53,9 @@ using namespace genie::utils;
 namespace { // anonymous namespace (file only visibility)
   const double eps = std::numeric_limits<double>::epsilon();
 }
+
+// # of v values scanned at each Q2 node of the (E,Q2) max xsec envelope
+static const int kSMEnvNv = 12;
 //___________________________________________________________________________
 QELEventGeneratorSM::QELEventGeneratorSM() :
 KineGeneratorWithCache("genie::QELEventGeneratorSM")
@@ -108,14 +111,22 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
   // heavy nucleus is nucleus that heavier than hydrogen and deuterium
   bool isHeavyNucleus = tgt->A()>=3;
 
-  sm_utils->SetInteraction(interaction);
   // phase space for heavy nucleus is different from light one
   fkps = isHeavyNucleus?kPSQ2vfE:kPSQ2fE;
+  // envelope of the cross-section in (E,Q2), if available
+  KineEnvelope_t * envelope = (fGenerateUniformly) ? 0 :
+      this->Envelope(interaction, init_state.ProbeE(kRfLab));
+  sm_utils->SetInteraction(interaction);
   Range1D_t rQ2 = sm_utils->Q2QES_SM_lim();
   // Try to calculate the maximum cross-section in kinematical limits
   // if not pre-computed already
-  double xsec_max1  = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
-  double xsec_max2  = (fGenerateUniformly) ? -1 : (rQ2.max<fQ2Min)? 0: this->MaxXSec2(evrec);// this make correct calculation of probability
+  double xsec_max1  = -1;
+  double xsec_max2  = -1;
+  if(!fGenerateUniformly && !envelope) {
+    xsec_max1 = this->MaxXSec(evrec);
+    if(xsec_max1 <= 0) return; // thread stopped by MaxXSec()
+    xsec_max2 = (rQ2.max<fQ2Min)? 0: this->MaxXSec2(evrec);// this make correct calculation of probability
+  }
   double vmax= isHeavyNucleus?this->MaxDiffv(evrec) : 0.;
 
 
@@ -127,6 +138,7 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
   while(1)
   {
      LOG("QELEvent", pINFO) << "Attempt #: " << iter;
+     this->CountTrial();
      if(iter > kRjMaxIterations)
      {
         LOG("QELEvent", pWARN)
@@ -140,9 +152,17 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
 
          // Pick Q2 and v
      double xsec_max = 0.;
+     int    icell    = -1;
      double pth = rnd->RndKine().Rndm();
+     if (envelope)
+     {
+         // Q2 uniformly within an envelope cell selected according to its majorant
+         double u = this->SampleEnvelope(*envelope, pth, rnd->RndKine().Rndm(), icell);
+         xsec_max = envelope->value[icell];
+         gQ2 = rQ2.min + (rQ2.max-rQ2.min) * u;
+     }
      //pth < prob1/(prob1+prob2), where prob1,prob2 - probabilities to generate event in area1 (Q2<fQ2Min) and area2 (Q2>fQ2Min) which are not normalized
-     if (pth <= xsec_max1*(TMath::Min(rQ2.max, fQ2Min)-rQ2.min)/(xsec_max1*(TMath::Min(rQ2.max, fQ2Min)-rQ2.min)+xsec_max2*(rQ2.max-fQ2Min)))
+     else if (pth <= xsec_max1*(TMath::Min(rQ2.max, fQ2Min)-rQ2.min)/(xsec_max1*(TMath::Min(rQ2.max, fQ2Min)-rQ2.min)+xsec_max2*(rQ2.max-fQ2Min)))
      {
                  xsec_max = xsec_max1;
                  gQ2 = (rnd->RndKine().Rndm() * (TMath::Min(rQ2.max, fQ2Min)-rQ2.min)) + rQ2.min;
@@ -171,7 +191,11 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
 
           //-- Decide whether to accept the current kinematics
          if(!fGenerateUniformly) {
-                this->AssertXSecLimits(interaction, xsec, xsec_max);
+                if (envelope && xsec > xsec_max) {
+                  // the envelope is not a bound here: raise it
+                  this->RaiseEnvelope(envelope, icell, xsec);
+                }
+                else this->AssertXSecLimits(interaction, xsec, xsec_max);
 
                 double t = xsec_max * rnd->RndKine().Rndm();
 
@@ -262,7 +286,7 @@ void QELEventGeneratorSM::ProcessEventRecord(GHepRecord * evrec) const
 
   int rpdgc = interaction->RecoilNucleonPdg();
   assert(rpdgc);
-  double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+  double gW = PDGLibrary::Instance()->Mass(rpdgc);
   LOG("QELEvent", pNOTICE) << "Selected: W = "<< gW;
   double M = init_state.Tgt().HitNucP4().M();
   double E  = init_state.ProbeE(kRfHitNucRest);
@@ -428,6 +452,12 @@ void QELEventGeneratorSM::LoadConfig(void)
   //   an event weight?
   GetParamDef( "IsNucleonInNucleus", fGenerateNucleonInNucleus, true);
 
+  //-- Sample (Q2,v) against an envelope of the cross section in (E,Q2)?
+  GetParamDef( "UseEnvelope",            fUseEnvelope,    true);
+  GetParamDef( "Envelope-SafetyFactor",  fEnvelopeSafety, 1.5);
+  fEnvelopes.clear();
+  fEnvelopeEdges.clear();
+
   sm_utils = const_cast<genie::SmithMonizUtils *>(dynamic_cast<const genie::SmithMonizUtils *>( this -> SubAlg("sm_utils_algo") ) ) ;
 }
 //____________________________________________________________________________
@@ -627,13 +657,18 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranch2(
 
   Cache * cache = Cache::Instance();
 
+  // look-up the branch through the hashed algorithm/interaction signature
+  ULong64_t id = interaction->Signature(this->Id().Key() + "/2nd");
+  CacheBranchFx * cache_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(id));
+  if(cache_branch) return cache_branch;
+
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
   string intkey = interaction->AsString();
   string key    = cache->CacheBranchKey(algkey, intkey, "2nd");
 
-  CacheBranchFx * cache_branch =
-              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  cache_branch = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   if(!cache_branch) {
     //-- create the cache branch at the first pass
     LOG("Kinematics", pINFO) << "No Max d^nXSec/d{K}^n cache branch found";
@@ -643,6 +678,7 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranch2(
     cache->AddCacheBranch(key, cache_branch);
   }
   assert(cache_branch);
+  cache->IndexCacheBranch(id, cache_branch);
 
   return cache_branch;
 }
@@ -780,13 +816,18 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranchDiffv(
 
   Cache * cache = Cache::Instance();
 
+  // look-up the branch through the hashed algorithm/interaction signature
+  ULong64_t id = interaction->Signature(this->Id().Key() + "/diffv");
+  CacheBranchFx * cache_branch =
+              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(id));
+  if(cache_branch) return cache_branch;
+
   // build the cache branch key as: namespace::algorithm/config/interaction
   string algkey = this->Id().Key();
   string intkey = interaction->AsString();
   string key    = cache->CacheBranchKey(algkey, intkey, "diffv");
 
-  CacheBranchFx * cache_branch =
-              dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  cache_branch = dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
   if(!cache_branch) {
     //-- create the cache branch at the first pass
     LOG("Kinematics", pINFO) << "No Max vmax(Q2)-vmin(Q2) cache branch found";
@@ -796,7 +837,41 @@ CacheBranchFx * QELEventGeneratorSM::AccessCacheBranchDiffv(
     cache->AddCacheBranch(key, cache_branch);
   }
   assert(cache_branch);
+  cache->IndexCacheBranch(id, cache_branch);
 
   return cache_branch;
 }
 //___________________________________________________________________________
+double QELEventGeneratorSM::EnvelopeXSec(Interaction * interaction, double u) const
+{
+// Max (over v) xsec at the normalized Q2 u for the envelope of the xsec in
+// (E,Q2) (see KineGeneratorWithCache::Envelope()). Below threshold, the
+// interaction is moved just above it.
+
+  bool isHeavyNucleus = interaction->InitState().Tgt().A() >= 3;
+  KinePhaseSpace_t kps = isHeavyNucleus ? kPSQ2vfE : kPSQ2fE;
+
+  sm_utils->SetInteraction(interaction);
+  double Ethr = sm_utils->E_nu_thr_SM();
+  if (interaction->InitState().ProbeE(kRfLab) <= Ethr) {
+    interaction->InitStatePtr()->SetProbeE(1.001 * Ethr);
+    sm_utils->SetInteraction(interaction);
+  }
+
+  Range1D_t rQ2 = sm_utils->Q2QES_SM_lim();
+  if (rQ2.max <= rQ2.min) return 0.;
+
+  double Q2 = rQ2.min + (rQ2.max-rQ2.min) * u;
+  Range1D_t rv = sm_utils->vQES_SM_lim(Q2);
+  int nv = isHeavyNucleus ? kSMEnvNv : 1;
+  double xsec = 0.;
+  for (int k = 0; k < nv; k++) {
+    double v = isHeavyNucleus ? rv.min + (rv.max-rv.min) * (k+0.5) / nv : rv.min;
+    Kinematics * kinematics = interaction->KinePtr();
+    kinematics->SetKV(kKVQ2, Q2);
+    kinematics->SetKV(kKVv, v);
+    xsec = TMath::Max(xsec, fXSecModel->XSec(interaction, kps));
+  }
+  return xsec;
+}
+//___________________________________________________________________________
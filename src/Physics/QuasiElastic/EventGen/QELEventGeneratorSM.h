@@ -76,6 +76,10 @@ private:
   void   CacheMaxDiffv   (const Interaction * in, double xsec) const;
   CacheBranchFx * AccessCacheBranchDiffv (const Interaction * in) const;
 
+  //! max_v{xsec} at the normalized Q2 u, for the (E,Q2) envelope
+  double EnvelopeXSec (Interaction * in, double u) const;
+  int    EnvelopeDim  (void) const { return 1; }
+
   mutable KinePhaseSpace_t fkps;
 
   bool fGenerateNucleonInNucleus;           ///< generate struck nucleon in nucleus
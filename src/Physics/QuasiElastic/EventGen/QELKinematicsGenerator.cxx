@@ -23,6 +23,8 @@
  @ Mar 18, 2016 - JJ (SD)
    Store the struck nucleon position in the Target object before calling
    the xsec method for the first time
+ @ Oct 14, 2026 - CA
+   Draw the kinematics random numbers through RandomGen::Next().
 */
 //____________________________________________________________________________
 
@@ -112,7 +114,8 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      genie::exceptions::EVGThreadException exception;
      exception.SetReason("No available phase space");
      exception.SwitchOnFastForward();
-     throw exception;
+     this->StopThread(exception);
+     return;
   }
 
   //-- For the subsequent kinematic selection with the rejection method:
@@ -122,6 +125,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  if(!fGenerateUniformly && xsec_max <= 0) return; // thread stopped by MaxXSec()
 
   //-- Try to select a valid Q2 using the rejection method
 
@@ -137,6 +141,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("QELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
@@ -144,20 +149,21 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         genie::exceptions::EVGThreadException exception;
         exception.SetReason("Couldn't select kinematics");
         exception.SwitchOnFastForward();
-        throw exception;
+        this->StopThread(exception);
+        return;
      }
 
      //-- Generate a Q2 value within the allowed phase space
 /*
      if(fGenerateUniformly) {
-         gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
+         gQ2 = Q2min + (Q2max-Q2min) * rnd->Next(kRndStrKine);
      } else {
          // In unweighted mode - use transform that takes out the dipole form
-         double gQD2 = QD2min + (QD2max-QD2min) * rnd->RndKine().Rndm();
+         double gQD2 = QD2min + (QD2max-QD2min) * rnd->Next(kRndStrKine);
          gQ2  = utils::kinematics::QD2toQ2(gQD2);
      }
 */
-     gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
+     gQ2 = Q2min + (Q2max-Q2min) * rnd->Next(kRndStrKine);
      interaction->KinePtr()->SetQ2(gQ2);
      LOG("QELKinematics", pINFO) << "Trying: Q^2 = " << gQ2;
 
@@ -168,7 +174,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      if(!fGenerateUniformly) {
         this->AssertXSecLimits(interaction, xsec, xsec_max);
 
-        double t = xsec_max * rnd->RndKine().Rndm();
+        double t = xsec_max * rnd->Next(kRndStrKine);
      //double J = kinematics::Jacobian(interaction,kPSQ2fE,kPSQD2fE);
         double J = 1.;
 
@@ -211,7 +217,7 @@ void QELKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
         else if(xcls.IsStrangeEvent()) { rpdgc = xcls.StrangeHadronPdg();           }
         else                    { rpdgc = interaction->RecoilNucleonPdg(); }
         assert(rpdgc);
-        double gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+        double gW = PDGLibrary::Instance()->Mass(rpdgc);
 
         LOG("QELKinematics", pNOTICE) << "Selected: W = "<< gW;
 
@@ -308,6 +314,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
   //   space the max xsec is irrelevant
 //  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
   double xsec_max = this->MaxXSec(evrec);
+  if(xsec_max <= 0) return; // thread stopped by MaxXSec()
 
   // get neutrino energy at struck nucleon rest frame and the
   // struck nucleon mass (can be off the mass shell)
@@ -331,6 +338,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("QELKinematics", pWARN)
           << "Couldn't select a valid Q^2 after " << iter << " iterations";
@@ -342,7 +350,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
      }
 
      //-- Generate a Q2 value within the allowed phase space
-     gQ2 = Q2min + (Q2max-Q2min) * rnd->RndKine().Rndm();
+     gQ2 = Q2min + (Q2max-Q2min) * rnd->Next(kRndStrKine);
      LOG("QELKinematics", pNOTICE) << "Trying: Q^2 = " << gQ2;
 
      // The hadronic inv. mass is equal to the recoil nucleon on-shell mass.
@@ -354,7 +362,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
      if(xcls.IsCharmEvent()) { rpdgc = xcls.CharmHadronPdg();           }
      else                    { rpdgc = interaction->RecoilNucleonPdg(); }
      assert(rpdgc);
-     gW = PDGLibrary::Instance()->Find(rpdgc)->Mass();
+     gW = PDGLibrary::Instance()->Mass(rpdgc);
 
      // (W,Q2) -> (x,y)
      kinematics::WQ2toXY(E,Mn,gW,gQ2,gx,gy);
@@ -390,7 +398,7 @@ void QELKinematicsGenerator::SpectralFuncExperimentalCode(
 //     if(!fGenerateUniformly) {
         this->AssertXSecLimits(interaction, xsec, xsec_max);
 
-        double t = xsec_max * rnd->RndKine().Rndm();
+        double t = xsec_max * rnd->Next(kRndStrKine);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
         LOG("QELKinematics", pDEBUG)
             << "xsec= " << xsec << ", Rnd= " << t;
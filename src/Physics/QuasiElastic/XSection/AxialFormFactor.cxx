@@ -16,6 +16,7 @@
 
 #include <string>
 
+#include "Framework/Algorithm/Algorithm.h"
 #include "Physics/QuasiElastic/XSection/AxialFormFactor.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
@@ -61,7 +62,7 @@ void AxialFormFactor::Calculate(const Interaction * interaction)
                    << "No AxialFormFactorModelI algorithm was defined!";
     this->Reset("D");
   }
-  else {
+  else if(!this->IsCached(interaction)) {
     this->fFA = this->fModel->FA(interaction);
   }
 }
@@ -73,6 +74,8 @@ void AxialFormFactor::Reset(Option_t * opt)
 
   this->fFA = 0.;
 
+  this->fCacheModel = 0;
+
   string option(opt);
   if(option.find("D") == string::npos) {this->fModel = 0;}
 }
@@ -81,6 +84,38 @@ void AxialFormFactor::Copy(const AxialFormFactor & ff)
 {
   this->fModel = ff.fModel;
   this->fFA    = ff.fFA;
+
+  this->fCacheModel = 0;
+}
+//____________________________________________________________________________
+bool AxialFormFactor::IsCached(const Interaction * interaction)
+{
+// True if the form factor was last calculated by the attached model for the
+// same input (see ELFormFactors::IsCached())
+  const InitialState & init_state = interaction->InitState();
+  const Target &       target     = init_state.Tgt();
+
+  double        q2     = interaction->Kine().q2();
+  double        E      = init_state.ProbeP4Ptr()->Energy();
+  int           tgt    = target.Pdg();
+  int           hitnuc = target.HitNucPdg();
+  unsigned long config = Algorithm::ConfigGeneration();
+
+  bool cached = (fCacheModel     == fModel) &&
+                (fCacheConfig    == config) &&
+                (fCacheq2        == q2    ) &&
+                (fCacheE         == E     ) &&
+                (fCacheTgtPdg    == tgt   ) &&
+                (fCacheHitNucPdg == hitnuc);
+
+  fCacheModel     = fModel;
+  fCacheConfig    = config;
+  fCacheq2        = q2;
+  fCacheE         = E;
+  fCacheTgtPdg    = tgt;
+  fCacheHitNucPdg = hitnuc;
+
+  return cached;
 }
 //____________________________________________________________________________
 bool AxialFormFactor::Compare(const AxialFormFactor & ff) const
@@ -68,6 +68,16 @@ private:
   double fFA;
 
   const AxialFormFactorModelI * fModel;
+
+  // input of the last calculation, to skip repeating it (see IsCached())
+  const AxialFormFactorModelI * fCacheModel;
+  unsigned long fCacheConfig;
+  double        fCacheq2;
+  double        fCacheE;
+  int           fCacheTgtPdg;
+  int           fCacheHitNucPdg;
+
+  bool IsCached (const Interaction * interaction);
 };
 
 }        // genie namespace
@@ -14,6 +14,7 @@
 */
 //____________________________________________________________________________
 
+#include "Framework/Interaction/Interaction.h"
 #include "Physics/QuasiElastic/XSection/AxialFormFactorModelI.h"
 
 using namespace genie;
@@ -42,6 +43,20 @@ AxialFormFactorModelI::~AxialFormFactorModelI()
 
 }
 //____________________________________________________________________________
+void AxialFormFactorModelI::Calculate(const Interaction * interaction, int n,
+    const double * q2, double * fa) const
+{
+// Default implementation: Calls FA() on a copy of the input interaction, set
+// to each q2 value in turn
+
+  Interaction in(*interaction);
+  Kinematics * kine = in.KinePtr();
+  for(int i = 0; i < n; i++) {
+    kine->SetQ2(-q2[i]);
+    fa[i] = this->FA(&in);
+  }
+}
+//____________________________________________________________________________
 
 
 
@@ -37,6 +37,11 @@ public:
   //! Compute the axial form factor
   virtual double FA (const Interaction * interaction) const = 0;
 
+  //! Compute the axial form factor for the input interaction at each of the
+  //! n input q2 values (used instead of the interaction q2)
+  virtual void   Calculate (const Interaction * interaction, int n,
+                                    const double * q2, double * fa) const;
+
 protected:
   AxialFormFactorModelI();
   AxialFormFactorModelI(string name);
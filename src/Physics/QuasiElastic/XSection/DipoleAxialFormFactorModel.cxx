@@ -51,6 +51,15 @@ double DipoleAxialFormFactorModel::FA(const Interaction * interaction) const
   return fa;
 }
 //____________________________________________________________________________
+void DipoleAxialFormFactorModel::Calculate(const Interaction * /*in*/, int n,
+    const double * q2, double * fa) const
+{
+  for(int i = 0; i < n; i++) {
+    double d = 1. - q2[i]/fMa2;
+    fa[i] = fFA0 / (d*d);
+  }
+}
+//____________________________________________________________________________
 void DipoleAxialFormFactorModel::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
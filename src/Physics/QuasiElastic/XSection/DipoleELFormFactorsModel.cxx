@@ -12,6 +12,8 @@
  Important revisions after version 2.0.0 :
  @ Sep 19, 2009 - CA
    Moved into the ElFF package from its previous location               
+ @ Oct 14, 2026 - CA
+   Added the q2 array version of the form factor calculation.
 
 */
 //____________________________________________________________________________
@@ -78,6 +80,20 @@ double DipoleELFormFactorsModel::Gmn(const Interaction * interaction) const
   return gm;
 }
 //____________________________________________________________________________
+void DipoleELFormFactorsModel::Calculate(const Interaction * /*in*/, int n,
+    const double * q2, double * gep, double * gmp,
+    double * gen, double * gmn) const
+{
+  for(int i = 0; i < n; i++) {
+    double d = 1. - q2[i]/fMv2;
+    double dipole = 1. / (d*d);
+    gep[i] = dipole;
+    gmp[i] = fMuP * dipole;
+    gen[i] = 0.;
+    gmn[i] = fMuN * dipole;
+  }
+}
+//____________________________________________________________________________
 void DipoleELFormFactorsModel::Configure(const Registry & config)
 {
   Algorithm::Configure(config);
@@ -36,6 +36,9 @@ public:
   double Gmp (const Interaction * interaction) const;
   double Gen (const Interaction * interaction) const;
   double Gmn (const Interaction * interaction) const;
+  void   Calculate (const Interaction * interaction, int n,
+                     const double * q2, double * gep, double * gmp,
+                     double * gen, double * gmn) const;
 
   // overload Algorithm's Configure() 
   void   Configure  (const Registry & config);
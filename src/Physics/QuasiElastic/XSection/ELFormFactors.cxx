@@ -12,12 +12,17 @@
  Important revisions after version 2.0.0 :
  @ Sep 19, 2009 - CA
    Moved into the ElFF package from its previous location               
+ @ Oct 14, 2026 - CA
+   Calculate() keeps the form factors of the last call if its input did not
+   change, as the Llewellyn-Smith form factors ask for them several times
+   per cross section evaluation.
 
 */
 //____________________________________________________________________________
 
 #include <string>
 
+#include "Framework/Algorithm/Algorithm.h"
 #include "Physics/QuasiElastic/XSection/ELFormFactors.h"
 #include "Framework/Interaction/Interaction.h"
 #include "Framework/Messenger/Messenger.h"
@@ -63,7 +68,7 @@ void ELFormFactors::Calculate(const Interaction * interaction)
                    << "No ELFormFactorModelI algorithm was defined!";
     this->Reset("D");
   }
-  else {
+  else if(!this->IsCached(interaction)) {
     this->fGep = this->fModel->Gep(interaction);
     this->fGmp = this->fModel->Gmp(interaction);
     this->fGen = this->fModel->Gen(interaction);
@@ -81,6 +86,8 @@ void ELFormFactors::Reset(Option_t * opt)
   this->fGen = 0.;
   this->fGmn = 0.;
 
+  this->fCacheModel = 0;
+
   string option(opt);
   if(option.find("D") == string::npos) {this->fModel = 0;}
 }
@@ -92,6 +99,40 @@ void ELFormFactors::Copy(const ELFormFactors & ff)
   this->fGmp   = ff.fGmp;
   this->fGen   = ff.fGen;
   this->fGmn   = ff.fGmn;
+
+  this->fCacheModel = 0;
+}
+//____________________________________________________________________________
+bool ELFormFactors::IsCached(const Interaction * interaction)
+{
+// True if the form factors were last calculated by the attached model for
+// the same input. The models depend on q2, the target and hit nucleon and,
+// for some, the probe energy. Reconfiguring any algorithm (possibly the
+// model) invalidates the result.
+  const InitialState & init_state = interaction->InitState();
+  const Target &       target     = init_state.Tgt();
+
+  double        q2     = interaction->Kine().q2();
+  double        E      = init_state.ProbeP4Ptr()->Energy();
+  int           tgt    = target.Pdg();
+  int           hitnuc = target.HitNucPdg();
+  unsigned long config = Algorithm::ConfigGeneration();
+
+  bool cached = (fCacheModel     == fModel) &&
+                (fCacheConfig    == config) &&
+                (fCacheq2        == q2    ) &&
+                (fCacheE         == E     ) &&
+                (fCacheTgtPdg    == tgt   ) &&
+                (fCacheHitNucPdg == hitnuc);
+
+  fCacheModel     = fModel;
+  fCacheConfig    = config;
+  fCacheq2        = q2;
+  fCacheE         = E;
+  fCacheTgtPdg    = tgt;
+  fCacheHitNucPdg = hitnuc;
+
+  return cached;
 }
 //____________________________________________________________________________
 bool ELFormFactors::Compare(const ELFormFactors & ff) const
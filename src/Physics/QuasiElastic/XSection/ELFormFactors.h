@@ -79,6 +79,16 @@ private:
   double fGmn;
 
   const ELFormFactorsModelI * fModel;
+
+  // input of the last calculation, to skip repeating it (see IsCached())
+  const ELFormFactorsModelI * fCacheModel;
+  unsigned long fCacheConfig;
+  double        fCacheq2;
+  double        fCacheE;
+  int           fCacheTgtPdg;
+  int           fCacheHitNucPdg;
+
+  bool IsCached (const Interaction * interaction);
 };
 
 }        // genie namespace
@@ -12,10 +12,13 @@
  Important revisions after version 2.0.0 :
  @ Sep 19, 2009 - CA
    Moved into the ElFF package from its previous location               
+ @ Oct 14, 2026 - CA
+   Added the q2 array version of the form factor calculation.
 
 */
 //____________________________________________________________________________
 
+#include "Framework/Interaction/Interaction.h"
 #include "Physics/QuasiElastic/XSection/ELFormFactorsModelI.h"
 
 using namespace genie;
@@ -44,6 +47,25 @@ ELFormFactorsModelI::~ELFormFactorsModelI()
 
 }
 //____________________________________________________________________________
+void ELFormFactorsModelI::Calculate(const Interaction * interaction, int n,
+    const double * q2, double * gep, double * gmp,
+    double * gen, double * gmn) const
+{
+// Default implementation: Calls the single point methods on a copy of the
+// input interaction, set to each q2 value in turn. Models depending on q2 only
+// should override it with a plain loop over the q2 values.
+
+  Interaction in(*interaction);
+  Kinematics * kine = in.KinePtr();
+  for(int i = 0; i < n; i++) {
+    kine->SetQ2(-q2[i]);
+    gep[i] = this->Gep(&in);
+    gmp[i] = this->Gmp(&in);
+    gen[i] = this->Gen(&in);
+    gmn[i] = this->Gmn(&in);
+  }
+}
+//____________________________________________________________________________
 
 
 
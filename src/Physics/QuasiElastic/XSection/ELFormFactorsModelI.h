@@ -44,6 +44,12 @@ public:
   //! Compute the elastic form factor G_{mn} for the input interaction
   virtual double Gmn (const Interaction * interaction) const = 0;
 
+  //! Compute all four form factors for the input interaction at each of the
+  //! n input q2 values (used instead of the interaction q2)
+  virtual void   Calculate (const Interaction * interaction, int n,
+                     const double * q2, double * gep, double * gmp,
+                     double * gen, double * gmn) const;
+
 protected:
   ELFormFactorsModelI();
   ELFormFactorsModelI(string name);
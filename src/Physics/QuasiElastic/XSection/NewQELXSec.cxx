@@ -30,6 +30,7 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/Common/VertexGenerator.h"
 #include "Physics/NuclearState/NuclearModel.h"
@@ -52,6 +53,7 @@ NewQELXSec::NewQELXSec(std::string config) : XSecIntegratorI("genie::NewQELXSec"
 //____________________________________________________________________________
 double NewQELXSec::Integrate(const XSecAlgorithmI* model, const Interaction* in) const
 {
+  GINSTR_ALG_SCOPE(this);
   LOG("NewQELXSec",pDEBUG) << "Beginning integrate";
   if ( !model->ValidProcess(in) ) return 0.;
 
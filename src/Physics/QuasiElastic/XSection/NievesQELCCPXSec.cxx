@@ -18,6 +18,7 @@
 #include <Math/IFunction.h>
 #include <Math/Integrator.h>
 #include <complex>
+#include <sstream>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
@@ -43,6 +44,8 @@
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/PrintUtils.h"
 #include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Utils/Cache.h"
+#include "Framework/Utils/CacheBranchFx.h"
 
 #include <iostream> // Used for testing code
 #include <fstream> // Used for testing code
@@ -53,6 +56,11 @@ using namespace genie::constants;
 using namespace genie::controls;
 using namespace genie::utils;
 
+using std::ostringstream;
+
+// # of r nodes of the Coulomb potential tables
+static const int kNVcrNodes = 200;
+
 //____________________________________________________________________________
 NievesQELCCPXSec::NievesQELCCPXSec() :
 XSecAlgorithmI("genie::NievesQELCCPXSec")
@@ -472,6 +480,9 @@ void NievesQELCCPXSec::LoadConfig(void)
     std::exit(1);
   }
 
+  // Coulomb potential tables are looked up again, since Rmax may have changed
+  fVcrTables.clear();
+
   // Method to use to calculate the binding energy of the initial hit nucleon when
   // generating splines
   std::string temp_binding_mode;
@@ -808,32 +819,7 @@ double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
   if(target->IsNucleus()){
     int A = target->A();
     int Z = target->Z();
-    double Rmax = 0.;
-
-    if ( fCoulombRmaxMode == kMatchNieves ) {
-      // Rmax calculated using formula from Nieves' fortran code and default
-      // charge and neutron matter density parameters from NuclearUtils.cxx
-      if (A > 20) {
-        double c = TMath::Power(A,0.35), z = 0.54;
-        Rmax = c + 9.25*z;
-      }
-      else {
-        // c = 1.75 for A <= 20
-        Rmax = TMath::Sqrt(20.0)*1.75;
-      }
-    }
-    else if ( fCoulombRmaxMode == kMatchVertexGeneratorRmax ) {
-      // TODO: This solution is fragile. If the formula used by VertexGenerator
-      // changes, then this one will need to change too. Switch to using
-      // a common function to get Rmax for both.
-      Rmax = 3. * fR0 * std::pow(A, 1./3.);
-    }
-    else {
-      LOG("Nieves", pFATAL) << "Unrecognized setting for fCoulombRmaxMode encountered"
-        << " in NievesQELCCPXSec::vcr()";
-      gAbortingInErr = true;
-      std::exit(1);
-    }
+    double Rmax = this->CoulombRmax(A);
 
     if(Rcurr >= Rmax){
       LOG("Nieves",pNOTICE) << "Radius greater than maximum radius for coulomb corrections."
@@ -841,27 +827,104 @@ double NievesQELCCPXSec::vcr(const Target * target, double Rcurr) const{
       Rcurr = Rmax;
     }
 
-    ROOT::Math::IBaseFunctionOneDim * func = new
-      utils::gsl::wrap::NievesQELvcrIntegrand(Rcurr,A,Z);
-    ROOT::Math::IntegrationOneDim::Type ig_type =
-      utils::gsl::Integration1DimTypeFromString("adaptive");
-
-    double abstol = 1; // We mostly care about relative tolerance;
-    double reltol = 1E-4;
-    int nmaxeval = 100000;
-    ROOT::Math::Integrator ig(*func,ig_type,abstol,reltol,nmaxeval);
-    double result = ig.Integral(0,Rmax);
-    delete func;
-
-    // Multiply by Z to normalize densities to number of protons
-    // Multiply by hbarc to put result in GeV instead of fm
-    return -kAem*4*kPi*result*fhbarc;
+    // Interpolate the tabulated potential
+    std::map<int, const CacheBranchFx *>::const_iterator it =
+      fVcrTables.find(target->Pdg());
+    const CacheBranchFx * table = (it != fVcrTables.end()) ?
+      it->second : &(this->VcrTable(A, Z, Rmax));
+    fVcrTables[target->Pdg()] = table;
+
+    return (*table)(Rcurr);
   }else{
     // If target is not a nucleus the potential will be 0
     return 0.0;
   }
 }
 //____________________________________________________________________________
+double NievesQELCCPXSec::CoulombRmax(int A) const
+{
+  double Rmax = 0.;
+
+  if ( fCoulombRmaxMode == kMatchNieves ) {
+    // Rmax calculated using formula from Nieves' fortran code and default
+    // charge and neutron matter density parameters from NuclearUtils.cxx
+    if (A > 20) {
+      double c = TMath::Power(A,0.35), z = 0.54;
+      Rmax = c + 9.25*z;
+    }
+    else {
+      // c = 1.75 for A <= 20
+      Rmax = TMath::Sqrt(20.0)*1.75;
+    }
+  }
+  else if ( fCoulombRmaxMode == kMatchVertexGeneratorRmax ) {
+    // TODO: This solution is fragile. If the formula used by VertexGenerator
+    // changes, then this one will need to change too. Switch to using
+    // a common function to get Rmax for both.
+    Rmax = 3. * fR0 * std::pow(A, 1./3.);
+  }
+  else {
+    LOG("Nieves", pFATAL) << "Unrecognized setting for fCoulombRmaxMode encountered"
+      << " in NievesQELCCPXSec::vcr()";
+    gAbortingInErr = true;
+    std::exit(1);
+  }
+
+  return Rmax;
+}
+//____________________________________________________________________________
+double NievesQELCCPXSec::vcrDirect(
+  int A, int Z, double Rmax, double Rcurr) const
+{
+  ROOT::Math::IBaseFunctionOneDim * func = new
+    utils::gsl::wrap::NievesQELvcrIntegrand(Rcurr,A,Z);
+  ROOT::Math::IntegrationOneDim::Type ig_type =
+    utils::gsl::Integration1DimTypeFromString("adaptive");
+
+  double abstol = 1; // We mostly care about relative tolerance;
+  double reltol = 1E-4;
+  int nmaxeval = 100000;
+  ROOT::Math::Integrator ig(*func,ig_type,abstol,reltol,nmaxeval);
+  double result = ig.Integral(0,Rmax);
+  delete func;
+
+  // Multiply by Z to normalize densities to number of protons
+  // Multiply by hbarc to put result in GeV instead of fm
+  return -kAem*4*kPi*result*fhbarc;
+}
+//____________________________________________________________________________
+const CacheBranchFx & NievesQELCCPXSec::VcrTable(
+  int A, int Z, double Rmax) const
+{
+// The potential is smooth in r: it is computed at kNVcrNodes equidistant
+// radii in [0,Rmax] and interpolated with a cubic spline. The cache branch
+// key holds A, Z and Rmax, so that tables read from a cache file are only
+// reused with the same Rmax settings.
+
+  Cache * cache = Cache::Instance();
+
+  ostringstream tgtkey;
+  tgtkey << "A=" << A << ",Z=" << Z << ",Rmax=" << Rmax;
+  string key = cache->CacheBranchKey(this->Id().Key(), "vcr", tgtkey.str());
+
+  CacheBranchFx * cbr =
+      dynamic_cast<CacheBranchFx *> (cache->FindCacheBranch(key));
+  if(!cbr) {
+    LOG("Nieves", pNOTICE)
+      << "Tabulating the Coulomb potential - key = " << key;
+
+    cbr = new CacheBranchFx("Nieves QEL Coulomb potential vs r");
+    for(int i = 0; i < kNVcrNodes; i++) {
+      double r = i * Rmax / (kNVcrNodes-1);
+      cbr->AddValues(r, this->vcrDirect(A, Z, Rmax, r));
+    }
+    cache->AddCacheBranch(key, cbr);
+  }
+  if(!cbr->Spl()) cbr->CreateSpline();
+
+  return *cbr;
+}
+//____________________________________________________________________________
 int NievesQELCCPXSec::leviCivita(int input[]) const{
   int copy[4] = {input[0],input[1],input[2],input[3]};
   int permutations = 0;
@@ -893,6 +956,16 @@ int NievesQELCCPXSec::leviCivita(int input[]) const{
   }
 }
 //____________________________________________________________________________
+// Non-zero elements of the Levi-Civita tensor with leading indices mu<nu:
+// {a, b, sign} such that epsilon(mu,nu,a,b) = -epsilon(mu,nu,b,a) = sign
+// with a<b (used in LmunuAnumu instead of looping over all a,b)
+static const int kLeviCivitaPairs[4][4][3] = {
+  { {0,0,0}, {2,3, 1}, {1,3,-1}, {1,2, 1} },
+  { {0,0,0}, {0,0,0}, {0,3, 1}, {0,2,-1} },
+  { {0,0,0}, {0,0,0}, {0,0,0}, {0,1, 1} },
+  { {0,0,0}, {0,0,0}, {0,0,0}, {0,0,0} }
+};
+//____________________________________________________________________________
 // Calculates the constraction of the leptonic and hadronic tensors. The
 // expressions used here are valid in a frame in which the
 // initial nucleus is at rest, and qTilde must be in the z direction.
@@ -1010,7 +1083,6 @@ const Target& target, bool assumeFreeNucleon) const
   //Additional constants and variables
   const int g[4][4] = {{1,0,0,0},{0,-1,0,0},{0,0,-1,0},{0,0,0,-1}};
   const std::complex<double> iNum(0,1);
-  int leviCivitaIndexArray[4];
   double imaginaryPart = 0;
 
   std::complex<double> sum(0.0,0.0);
@@ -1026,23 +1098,22 @@ const Target& target, bool assumeFreeNucleon) const
   double axx=0.,azz=0.,a0z=0.,a00=0.,axy=0.;
   for(int mu=0;mu<4;mu++){
     for(int nu=mu;nu<4;nu++){
+      // Only Amunu elements 00, 03, 11, 22, 33 and 12 are non-zero (see below)
+      if(mu != nu && !(mu == 0 && nu == 3) && !(mu == 1 && nu == 2)) continue;
+
       imaginaryPart = 0;
       if(mu == nu){
         //if mu==nu then levi-civita = 0, so imaginary part = 0
         Lmunu = g[mu][mu]*kPrime[mu]*g[nu][nu]*k[nu]+g[nu][nu]*kPrime[nu]*g[mu][mu]*k[mu]-g[mu][nu]*kPrimek;
       }else{
         //if mu!=nu, then g[mu][nu] = 0
-        //This same leviCivitaIndex array can be used in the else portion when
-        //calculating Anumu
-        leviCivitaIndexArray[0] = mu;
-        leviCivitaIndexArray[1] = nu;
-        for(int a=0;a<4;a++){
-          for(int b=0;b<4;b++){
-            leviCivitaIndexArray[2] = a;
-            leviCivitaIndexArray[3] = b;
-            imaginaryPart += - leviCivita(leviCivitaIndexArray)*kPrime[a]*k[b];
-          }
-        }
+        //Only the two terms with {a,b} = the indices other than mu,nu are
+        //non-zero, with opposite levi-civita signs: sum them in the order
+        //of the full loop over a and b, so that the result is unchanged
+        const int * eps = kLeviCivitaPairs[mu][nu];
+        int a = eps[0], b = eps[1];
+        imaginaryPart += - eps[2]*kPrime[a]*k[b];
+        imaginaryPart +=   eps[2]*kPrime[b]*k[a];
         //real(Lmunu) is symmetric, and imag(Lmunu) is antisymmetric
         //std::complex<double> num(g[mu][mu]*kPrime[mu]*g[nu][nu]*k[nu]+g[nu][nu]*kPrime[nu]*g[mu][mu]*k[mu],imaginaryPart);
         Lmunu = g[mu][mu]*kPrime[mu]*g[nu][nu]*k[nu]+g[nu][nu]*kPrime[nu]*g[mu][mu]*k[mu] + iNum*imaginaryPart;
@@ -27,6 +27,7 @@
 #include "Physics/QuasiElastic/XSection/QELFormFactors.h"
 #include "Physics/NuclearState/FermiMomentumTable.h"
 #include <complex>
+#include <map>
 #include <Math/IFunction.h>
 #include "Physics/NuclearState/NuclearModelI.h"
 #include "Physics/NuclearState/PauliBlocker.h"
@@ -44,6 +45,7 @@ typedef enum EQELRmax {
 
 class QELFormFactorsModelI;
 class XSecIntegratorI;
+class CacheBranchFx;
 
 class NievesQELCCPXSec : public XSecAlgorithmI {
 
@@ -134,6 +136,17 @@ private:
   // Potential for coulomb correction
   double vcr(const Target * target, double r) const;
 
+  // Max radius for integrating the Coulomb potential (fm)
+  double CoulombRmax(int A) const;
+  // Coulomb potential (GeV) computed by integrating over the nuclear density
+  double vcrDirect(int A, int Z, double Rmax, double r) const;
+  // Coulomb potential table vs r in [0,Rmax] for a nucleus: computed at the
+  // first call and kept in the GENIE cache (saved to the cache file, if any)
+  const CacheBranchFx & VcrTable(int A, int Z, double Rmax) const;
+
+  /// Coulomb potential tables: target pdg code -> table owned by the Cache
+  mutable std::map<int, const CacheBranchFx *> fVcrTables;
+
   //input must be length 4. Returns 1 if input is an even permutation of 0123,
   //-1 if input is an odd permutation of 0123, and 0 if any two elements
   //are equal
@@ -307,7 +307,7 @@ void genie::utils::BindHitNucleon(genie::Interaction& interaction,
       int Af = tgt->A() - 1;
       int Zf = tgt->Z();
       if ( genie::pdg::IsProton( tgt->HitNucPdg()) ) --Zf;
-      Mf = genie::PDGLibrary::Instance()->Find( genie::pdg::IonPdgCode(Af, Zf) )->Mass();
+      Mf = genie::PDGLibrary::Instance()->Mass( genie::pdg::IonPdgCode(Af, Zf) );
 
       // Deduce the binding energy from the final nucleus mass
       Eb = Mf - Mi + mNi;
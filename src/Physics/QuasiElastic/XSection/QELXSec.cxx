@@ -45,6 +45,7 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/NuclearState/NuclearUtils.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 
 using namespace genie;
@@ -71,6 +72,7 @@ QELXSec::~QELXSec()
 double QELXSec::Integrate(
                   const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   LOG("QELXSec",pDEBUG) << "Beginning integrate";
   if(! model->ValidProcess(in)) return 0.;
 
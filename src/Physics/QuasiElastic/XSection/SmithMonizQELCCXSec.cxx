@@ -36,6 +36,7 @@
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Utils/Range1.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/QuasiElastic/XSection/SmithMonizUtils.h"
 
@@ -63,6 +64,7 @@ SmithMonizQELCCXSec::~SmithMonizQELCCXSec()
 double SmithMonizQELCCXSec::Integrate(
                   const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   LOG("SMQELXSec",pDEBUG) << "Beginning integrate";
   if(! model->ValidProcess(in)) return 0.;
   
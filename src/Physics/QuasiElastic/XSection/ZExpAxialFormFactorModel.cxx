@@ -16,6 +16,7 @@
 
 #include <TMath.h>
 #include <sstream>
+#include <vector>
 
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Conventions/Constants.h"
@@ -24,6 +25,7 @@
 #include "Framework/Messenger/Messenger.h"
 
 using std::ostringstream;
+using std::vector;
 
 using namespace genie;
 
@@ -55,15 +57,44 @@ double ZExpAxialFormFactorModel::FA(const Interaction * interaction) const
     LOG("ZExpAxialFormFactorModel",pWARN) << "Undefined expansion parameter";
     return 0.;
   }
+  // sum the expansion with Horner's rule
   double fa = 0.;
-  for (int ki=0;ki<=fKmax+(fQ4limit ? 4 : 0);ki++)
+  for (int ki=fKmax+(fQ4limit ? 4 : 0);ki>=0;ki--)
   {
-    fa = fa + TMath::Power(zparam,ki) * fZ_An[ki];
+    fa = fa * zparam + fZ_An[ki];
   }
 
   return fa;
 }
 //____________________________________________________________________________
+void ZExpAxialFormFactorModel::Calculate(const Interaction * /*in*/, int n,
+    const double * q2, double * fa) const
+{
+// The loops over the q2 values are innermost, so that they vectorize
+
+  vector<double> z(n);
+  double sqrt_t0 = TMath::Sqrt(fTcut - fT0);
+  for (int i=0;i<n;i++)
+  {
+    double sqrt_t = TMath::Sqrt(fTcut - q2[i]);
+    z[i]  = (sqrt_t - sqrt_t0) / (sqrt_t + sqrt_t0);
+    fa[i] = 0.;
+  }
+  for (int ki=fKmax+(fQ4limit ? 4 : 0);ki>=0;ki--)
+  {
+    double an = fZ_An[ki];
+    for (int i=0;i<n;i++) fa[i] = fa[i] * z[i] + an;
+  }
+  for (int i=0;i<n;i++)
+  {
+    if (z[i] != z[i]) // checks for nan
+    {
+      LOG("ZExpAxialFormFactorModel",pWARN) << "Undefined expansion parameter";
+      fa[i] = 0.;
+    }
+  }
+}
+//____________________________________________________________________________
 double ZExpAxialFormFactorModel::CalculateZ(double q2) const
 {
 
@@ -40,6 +40,8 @@ public:
 
   // implement the AxialFormFactorModelI interface
   double FA (const Interaction * interaction) const;
+  void   Calculate (const Interaction * interaction, int n,
+                                    const double * q2, double * fa) const;
 
   // overload Algorithm's Configure() 
   void   Configure  (const Registry & config);
@@ -24,10 +24,19 @@
    is set to the event, set the corresponding KinePhaseSpace_t value too.
  @ Jul 26, 2018 - IL (Afroditi Papadopoulou, Adi Ashkenazi - Massachusetts Institute of Technology)
    Included importance sampling envelop both for neutrino and electron scattering
+ @ Oct 14, 2026 - CA
+   Optionally (UseEnvelope) sample (W,QD2) against a 2-D envelope of the xsec
+   per E bin, tabulated on a grid and cached, instead of the analytical one.
+ @ Oct 14, 2026 - CA
+   Draw the kinematics random numbers through RandomGen::Next().
+ @ Oct 14, 2026 - CA
+   With Envelope-Mode = weighted or approximate, draw (W,QD2) from the xsec
+   surrogate interpolated between the envelope nodes.
 */
 //____________________________________________________________________________
 
 #include <TMath.h>
+#include <TLorentzVector.h>
 #include <TF2.h>
 #include <TROOT.h>
 
@@ -106,7 +115,8 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      genie::exceptions::EVGThreadException exception;
      exception.SetReason("No available phase space");
      exception.SwitchOnFastForward();
-     throw exception;
+     this->StopThread(exception);
+     return;
   }
 
   const InitialState & init_state = interaction -> InitState();
@@ -120,7 +130,18 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   //   value is found.
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
-  double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  //   When available, an envelope of the xsec in (E,W,Q2) is used instead of
+  //   the max xsec and of the analytical importance sampling envelope
+  //   With Envelope-Mode = weighted or approximate, (W,QD2) are drawn from
+  //   the surrogate of the xsec tabulated along with the envelope instead
+  KineEnvelope_t * envelope = (fGenerateUniformly) ? 0 :
+                     this->Envelope(interaction, this->Energy(interaction), 2);
+  bool surrogate = (envelope && fEnvelopeMode != kEnvRejection);
+  double xsec_max = -1;
+  if(!fGenerateUniformly && !envelope) {
+    xsec_max = this->MaxXSec(evrec);
+    if(xsec_max <= 0) return; // thread stopped by MaxXSec()
+  }
 
   //-- Try to select a valid W, Q2 pair using the rejection method
   double dW   = W.max - W.min;
@@ -130,6 +151,7 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
   bool accept = false;
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
          LOG("RESKinematics", pWARN)
               << "*** Could not select a valid (W,Q^2) pair after "
@@ -138,24 +160,53 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
          genie::exceptions::EVGThreadException exception;
          exception.SetReason("Couldn't select kinematics");
          exception.SwitchOnFastForward();
-         throw exception;
+         this->StopThread(exception);
+         return;
      }
 
      double gW   = 0; // current hadronic invariant mass
      double gQ2  = 0; // current momentum transfer
      double gQD2 = 0; // tranformed Q2 to take out dipole form
+     double Jenv = 1; // Jacobian d(W,Q2)/d(u,v) for the envelope variables
+     double s    = 0; // surrogate d^2xsec/dudv
+     int    icell = -1;
 
      if(fGenerateUniformly) {
        //-- Generate a W uniformly in the kinematically allowed range.
        //   For the generated W, compute the Q2 range and generate a value
        //   uniformly over that range
-       gW  = W.min + dW  * rnd->RndKine().Rndm();
+       gW  = W.min + dW  * rnd->Next(kRndStrKine);
        Range1D_t Q2 = kps.Q2Lim_W();
        if(Q2.max<=0. || Q2.min>=Q2.max) continue;
-       gQ2 = Q2.min + (Q2.max-Q2.min) * rnd->RndKine().Rndm();
+       gQ2 = Q2.min + (Q2.max-Q2.min) * rnd->Next(kRndStrKine);
 
        interaction->SetBit(kISkipKinematicChk);
 
+     } else if(surrogate) {
+
+       // Draw (W,QD2), normalized to their limits, from the xsec surrogate
+       double u = 0, v = 0;
+       s = this->SampleSurrogate(interaction, this->Energy(interaction), 2,
+               rnd->Next(kRndStrKine), rnd->Next(kRndStrKine),
+               rnd->Next(kRndStrKine), u, v);
+       Jenv = this->SetEnvelopeKine(interaction, u, v);
+       if(Jenv <= 0. || s <= 0.) continue;
+       gW  = interaction->Kine().W();
+       gQ2 = interaction->Kine().Q2();
+
+     } else if(envelope) {
+
+       // Generate (W,QD2), normalized to their limits, using the envelope of
+       // the xsec in (E,W,QD2) as PDF
+       double u = 0, v = 0;
+       this->SampleEnvelope2D(*envelope, rnd->Next(kRndStrKine),
+               rnd->Next(kRndStrKine), rnd->Next(kRndStrKine), u, v, icell);
+       xsec_max = envelope->value[icell];
+       Jenv = this->SetEnvelopeKine(interaction, u, v);
+       if(Jenv <= 0.) continue;
+       gW  = interaction->Kine().W();
+       gQ2 = interaction->Kine().Q2();
+
      } else {
 
 
@@ -221,14 +272,28 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
      interaction->KinePtr()->SetQ2(gQ2);
 
      //-- Computing cross section for the current kinematics
-     xsec = fXSecModel->XSec(interaction, kPSWQ2fE);
+     xsec = (surrogate && fEnvelopeMode == kEnvApproximate) ?
+              s / Jenv : fXSecModel->XSec(interaction, kPSWQ2fE);
 
      //-- Decide whether to accept the current kinematics
-     if(!fGenerateUniformly) {
+     if(surrogate) {
+          accept = (xsec>0);
+     }
+     else if(envelope) {
+          if(Jenv*xsec > xsec_max) {
+            // the envelope is not a bound here: raise it
+            this->RaiseEnvelope(envelope, icell, Jenv*xsec);
+          }
+          else this->AssertXSecLimits(interaction, Jenv*xsec, xsec_max);
+
+          double t = xsec_max * rnd->Next(kRndStrKine);
+          accept = (t < Jenv*xsec);
+     }
+     else if(!fGenerateUniformly) {
 
           // unified neutrino / electron scattering
           double max = fEnvelope->Eval(gQD2, gW);
-          double t   = max * rnd->RndKine().Rndm();
+          double t   = max * rnd->Next(kRndStrKine);
           double J   = kinematics::Jacobian(interaction,kPSWQ2fE,kPSWQD2fE);
 
           this->AssertXSecLimits(interaction, xsec, max);
@@ -274,6 +339,9 @@ void RESKinematicsGenerator::ProcessEventRecord(GHepRecord * evrec) const
           LOG("RESKinematics", pNOTICE) << "Current event wght = " << wght;
           evrec->SetWeight(wght);
         }
+        if(surrogate && fEnvelopeMode == kEnvWeighted) {
+          this->WeightSurrogate(evrec, Jenv*xsec, s);
+        }
 
         // lock selected kinematics & clear running values
         interaction->KinePtr()->SetQ2(gQ2, true);
@@ -320,6 +388,13 @@ void RESKinematicsGenerator::LoadConfig(void)
   // an event weight?
   this->GetParamDef("UniformOverPhaseSpace", fGenerateUniformly, false);
 
+  // Sample (W,Q2) against an envelope of the cross section in (E,W,Q2)?
+  this->GetParamDef("UseEnvelope",           fUseEnvelope,    false);
+  this->GetParamDef("Envelope-SafetyFactor", fEnvelopeSafety, 1.2  );
+  this->LoadEnvelopeMode();
+  fEnvelopes.clear();
+  fEnvelopeEdges.clear();
+
   // Envelope employed when importance sampling is used
   // (initialize with dummy range)
   if(fEnvelope) delete fEnvelope;
@@ -496,3 +571,49 @@ double RESKinematicsGenerator::ComputeMaxXSec(
   return max_xsec;
 }
 //___________________________________________________________________________
+double RESKinematicsGenerator::EnvelopeXSec2D(
+                    Interaction * interaction, double u, double v) const
+{
+// d^2xsec/dudv at the (W,QD2) normalized to their limits, for the (E,W,QD2)
+// envelope (see KineGeneratorWithCache::Envelope()). The envelope is keyed
+// by the hit nucleon rest frame energy, so the hit nucleon is put at rest.
+
+  Target * tgt = interaction->InitStatePtr()->TgtPtr();
+  if(tgt->HitNucIsSet()) {
+    tgt->SetHitNucP4(TLorentzVector(0, 0, 0, tgt->HitNucMass()));
+  }
+  if(!interaction->PhaseSpace().IsAboveThreshold()) return 0.;
+
+  double J = this->SetEnvelopeKine(interaction, u, v);
+  if(J <= 0.) return 0.;
+
+  return J * fXSecModel->XSec(interaction, kPSWQ2fE);
+}
+//___________________________________________________________________________
+double RESKinematicsGenerator::SetEnvelopeKine(
+                    Interaction * interaction, double u, double v) const
+{
+// Sets the (W,Q2) at the envelope variables (u,v): W normalized to its limits
+// and, as for the analytical envelope, QD2 (taking out the dipole form of the
+// Q2 distribution) normalized to its limits at that W. Returns the Jacobian
+// d(W,Q2)/d(u,v), or 0 if there is no phase space.
+
+  const KPhaseSpace & kps = interaction->PhaseSpace();
+  Range1D_t W = kps.Limits(kKVW);
+  if(W.max <= 0 || W.min >= W.max) return 0.;
+
+  interaction->KinePtr()->SetW(W.min + (W.max - W.min) * u);
+  Range1D_t Q2 = kps.Q2Lim_W();
+  double Q2min = Q2.min + kASmallNum;
+  double Q2max = Q2.max - kASmallNum;
+  if(Q2max <= 0 || Q2min >= Q2max) return 0.;
+
+  double QD2min = utils::kinematics::Q2toQD2(Q2max);
+  double QD2max = utils::kinematics::Q2toQD2(Q2min);
+  double QD2    = QD2min + (QD2max - QD2min) * v;
+  interaction->KinePtr()->SetQ2(utils::kinematics::QD2toQ2(QD2));
+
+  double J = kinematics::Jacobian(interaction, kPSWQ2fE, kPSWQD2fE);
+  return (W.max - W.min) * (QD2max - QD2min) * J;
+}
+//___________________________________________________________________________
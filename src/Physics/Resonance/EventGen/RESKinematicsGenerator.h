@@ -45,6 +45,9 @@ public :
 private:
   void   LoadConfig      (void);
   double ComputeMaxXSec  (const Interaction * interaction) const;
+  double EnvelopeXSec2D  (Interaction * interaction, double u, double v) const;
+  int    EnvelopeDim     (void) const { return 2; }
+  double SetEnvelopeKine (Interaction * interaction, double u, double v) const;
 
   mutable TF2 * fEnvelope; ///< 2-D envelope used for importance sampling
   double fWcut;            ///< Wcut parameter in DIS/RES join scheme
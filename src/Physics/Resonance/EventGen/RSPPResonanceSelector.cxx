@@ -14,6 +14,9 @@
    Moved into the new RES package from its previous location (EVGModules).
  @ Jul 23, 2010 - CA
    Use ResonanceCharge() from base class. Function removed from utils::res.
+ @ Oct 14, 2026 - CA
+   Compute the cross sections of all resonances with a single call to
+   XSecAlgorithmI::ResonanceXSecs().
 
 */
 //____________________________________________________________________________
@@ -98,11 +101,16 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
   const EventGeneratorI * evg = rtinfo->RunningThread();
   const XSecAlgorithmI * xsecalg = evg->CrossSectionAlg();
 
-  //-- Loop over all considered baryon resonances and compute the double
-  //   differential cross section for the selected kinematical variables
+  //-- Compute the double differential cross section for the selected
+  //   kinematical variables for all considered baryon resonances, in a
+  //   single call so that the factors common to all resonances are only
+  //   computed once
 
-  double xsec_sum  = 0;
   unsigned int nres = fResList.NResonances();
+  vector<double> res_xsec;
+  xsecalg->ResonanceXSecs(interaction,kPSWQ2fE,fResList,res_xsec);
+
+  double xsec_sum  = 0;
   vector<double> xsec_vec(nres);
 
   for(unsigned int ires = 0; ires < nres; ires++) {
@@ -110,16 +118,13 @@ Resonance_t RSPPResonanceSelector::SelectResonance(GHepRecord * evrec) const
      //-- Current resonance
      Resonance_t res = fResList.ResonanceId(ires);
 
-     //-- Set the current resonance at the interaction summary
-     //   compute the differential cross section d^2xsec/dWdQ^2
-     //   (do it only for resonances that can conserve charge)
-     interaction->ExclTagPtr()->SetResonance(res);
-
-     double xsec = 0;
+     //-- Keep the differential cross section d^2xsec/dWdQ^2
+     //   only for resonances that can conserve charge
+     double xsec = res_xsec[ires];
      bool   skip = (q_res==2 && !utils::res::IsDelta(res));
 
-     if(!skip) xsec = xsecalg->XSec(interaction,kPSWQ2fE);
-     else {
+     if(skip) {
+       xsec = 0;
        SLOG("RESSelector", pNOTICE)
                  << "RES: " << utils::res::AsString(res)
                          << " would not conserve charge -- skipping it";
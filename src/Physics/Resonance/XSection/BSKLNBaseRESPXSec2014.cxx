@@ -16,6 +16,14 @@
  @ July 4, 2018 - Afroditi Papadopoulou
    For electromagnetic (EM) interactions, the weak g2 was still used for the
    calculation of the helicity amplitude. Fixed by replacing with the correct EM g2
+ @ Oct 14, 2026 - CA
+   The FKR parameters, form factors and helicity amplitudes are tabulated in
+   (W, q2) per resonance and helicity amplitude model when first needed.
+   The helicity amplitudes are linear in the FKR parameters S, B and C, so the
+   tables also serve the KLN / BRS modified S, B, C. Added RES-UseAmplTables.
+   Split XSec() into resonance-independent kinematical factors and the
+   resonance contribution. Added ResonanceXSecs(), computing the cross
+   sections of a list of resonances at the same kinematics in one call.
 
 */
 //____________________________________________________________________________
@@ -26,6 +34,7 @@
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
+#include "Framework/ParticleData/BaryonResList.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/RefFrame.h"
@@ -50,6 +59,13 @@
 using namespace genie;
 using namespace genie::constants;
 
+// helicity amplitude table binning & accuracy
+static const int    kAmplNW        = 81;    // # of W nodes
+static const int    kAmplNQ        = 81;    // # of |q2|^(1/2) nodes
+static const double kAmplQMax      = 3.0;   // max tabulated |q2|^(1/2) (GeV)
+static const double kAmplTolerance = 2E-3;  // max rel. error at the cell centres
+static const int    kAmplNVals     = 29;    // # of tabulated values per node
+
 //____________________________________________________________________________
 BSKLNBaseRESPXSec2014::BSKLNBaseRESPXSec2014(string name) :
 XSecAlgorithmI(name)
@@ -71,8 +87,50 @@ BSKLNBaseRESPXSec2014::~BSKLNBaseRESPXSec2014()
 double BSKLNBaseRESPXSec2014::XSec(
     const Interaction * interaction, KinePhaseSpace_t kps) const
 {
-  if(! this -> ValidProcess    (interaction) ) return 0.;
-  if(! this -> ValidKinematics (interaction) ) return 0.;
+  KineFactors_t kf;
+  if(! this->KineFactors(interaction, kps, kf) ) return 0.;
+
+  // Get the input baryon resonance
+  Resonance_t resonance = interaction->ExclTag().Resonance();
+
+  return this->ResonanceXSec(resonance, kf);
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::ResonanceXSecs(
+    const Interaction * interaction, KinePhaseSpace_t kps,
+    const BaryonResList & reslist, vector<double> & xsec) const
+{
+// Compute the kinematical factors common to all resonances once, then the
+// contribution of each resonance
+
+  unsigned int nres = reslist.NResonances();
+  xsec.assign(nres, 0.);
+  if(nres == 0) return;
+
+  // the process check needs a known resonance
+  Resonance_t res0 = interaction->ExclTag().Resonance();
+  interaction->ExclTagPtr()->SetResonance(reslist.ResonanceId(0));
+
+  KineFactors_t kf;
+  bool ok = this->KineFactors(interaction, kps, kf);
+
+  interaction->ExclTagPtr()->SetResonance(res0);
+
+  if(!ok) return;
+
+  for(unsigned int ires = 0; ires < nres; ires++) {
+    xsec[ires] = this->ResonanceXSec(reslist.ResonanceId(ires), kf);
+  }
+}
+//____________________________________________________________________________
+bool BSKLNBaseRESPXSec2014::KineFactors(
+    const Interaction * interaction, KinePhaseSpace_t kps, KineFactors_t & kf) const
+{
+// Compute the factors that do not depend on the baryon resonance.
+// Returns false if the cross section vanishes for all resonances.
+
+  if(! this -> ValidProcess    (interaction) ) return false;
+  if(! this -> ValidKinematics (interaction) ) return false;
 
   const InitialState & init_state = interaction -> InitState();
   const ProcessInfo &  proc_info  = interaction -> ProcInfo();
@@ -92,15 +150,10 @@ double BSKLNBaseRESPXSec2014::XSec(
         << "RES/DIS Join Scheme: XSec[RES, W=" << W
         << " >= Wcut=" << fWcut << "] = 0";
 #endif
-      return 0;
+      return false;
     }
   }
 
-  // Get the input baryon resonance
-  Resonance_t resonance = interaction->ExclTag().Resonance();
-  string      resname   = utils::res::AsString(resonance);
-  bool        is_delta  = utils::res::IsDelta (resonance);
-
   // Get the neutrino, hit nucleon & weak current
   int  nucpdgc   = target.HitNucPdg();
   int  probepdgc = init_state.ProbePdg();
@@ -114,30 +167,6 @@ double BSKLNBaseRESPXSec2014::XSec(
   bool is_NC     = proc_info.IsWeakNC();
   bool is_EM     = proc_info.IsEM();
 
-  //  bool new_GV = fGA; //JN
-  //  bool new_GA = fGV; //JN
-
-
-  if(is_CC && !is_delta) {
-    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
-  }
-
-  // Get baryon resonance parameters
-  int    IR  = utils::res::ResonanceIndex    (resonance);
-  int    LR  = utils::res::OrbitalAngularMom (resonance);
-  double MR  = utils::res::Mass              (resonance);
-  double WR  = utils::res::Width             (resonance);
-   double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
-
-  // Following NeuGEN, avoid problems with underlying unphysical
-  // model assumptions by restricting the allowed W phase space
-  // around the resonance peak
- if (fNormBW) {
-        if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return 0.;
-        else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return 0.;
-        else if (W > MR + fGnResMaxNWidths * WR)          return 0.;
-  }
-
   // Compute auxiliary & kinematical factors
   double E      = init_state.ProbeE(kRfHitNucRest);
   double Mnuc   = target.HitNucMass();
@@ -287,67 +316,246 @@ double BSKLNBaseRESPXSec2014::XSec(
     << "Kinematical params V = " << V << ", U = " << U;
 #endif
 
-  // Calculate the Feynman-Kislinger-Ravndall parameters
+  const RSHelicityAmplModelI * hamplmod = 0;
+  if      (is_CC) { hamplmod = fHAmplModelCC; }
+  else if (is_NC) { hamplmod = (is_p) ? fHAmplModelNCp : fHAmplModelNCn; }
+  else if (is_EM) { hamplmod = (is_p) ? fHAmplModelEMp : fHAmplModelEMn; }
+  assert(hamplmod);
 
-  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
-  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
-  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+  // These lines were ~ 100 lines below, which means that, for EM interactions, the coefficients below were still calculated using the weak coupling constant - Afro
+  double g2 = kGF2;
 
-  if(fGV){
+  // For EM interaction replace  G_{Fermi} with :
+  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
+  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
+  // ISBN 0-8053-6021-2, p.112 (6.3.57)
+  // Also, take int account that the photon propagator is 1/p^2 but the
+  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
+  // Mass_{W}^4 / q^4
+  // So, overall:
+  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
+  //
 
-    LOG("BSKLNBaseRESPXSec2014",pDEBUG) <<"Using new GV";
-    double CV0 =  1./(1-q2/fMv2/4.);
-    double CV3 =  2.13 * CV0 * TMath::Power( 1-q2/fMv2,-2);
-    double CV4 = -1.51 * CV0 * TMath::Power( 1-q2/fMv2,-2);
-    double CV5 =  0.48 * CV0 * TMath::Power( 1-q2/fMv2/0.766, -2);
+  if(is_EM) {
+    double q4 = q2*q2;
+    g2 = kAem2 * kPi2 / (2.0 * fSin48w * q4);
+  }
 
-    double GV3 =  0.5 / TMath::Sqrt(3) * ( CV3 * (W + Mnuc)/Mnuc
-                  + CV4 * (W2 + q2 -Mnuc2)/2./Mnuc2
-                  + CV5 * (W2 - q2 -Mnuc2)/2./Mnuc2 );
+  if(is_CC) g2 = kGF2*fVud2;
 
-    double GV1 = - 0.5 / TMath::Sqrt(3) * ( CV3 * (Mnuc2 -q2 +Mnuc*W)/W/Mnuc
-                 + CV4 * (W2 +q2 - Mnuc2)/2./Mnuc2
-                 + CV5 * (W2 -q2 - Mnuc2)/2./Mnuc2 );
+  double sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
+  double scLR = W/Mnuc;
+  double scS  = (Mnuc/W)*(-Q2/q2);
 
-    GV = 0.5 * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR)
-         * TMath::Sqrt( 3 * GV3*GV3 + GV1*GV1);
+  // Store the factors used for all resonances
+
+  kf.hamplmod          = hamplmod;
+  kf.nucpdgc           = nucpdgc;
+  kf.W                 = W;
+  kf.q2                = q2;
+  kf.E                 = E;
+  kf.Mnuc              = Mnuc;
+  kf.Q2                = Q2;
+  kf.vstar             = vstar;
+  kf.Qstar             = Qstar;
+  kf.a                 = a;
+  kf.U2                = U2;
+  kf.V2                = V2;
+  kf.UV                = UV;
+  kf.is_nu             = is_nu;
+  kf.is_nubar          = is_nubar;
+  kf.is_lplus          = is_lplus;
+  kf.is_lminus         = is_lminus;
+  kf.is_p              = is_p;
+  kf.is_n              = is_n;
+  kf.is_CC             = is_CC;
+  kf.is_EM             = is_EM;
+  kf.is_KLN            = is_KLN;
+  kf.is_BRS            = is_BRS;
+  kf.KNL_Alambda_plus  = KNL_Alambda_plus;
+  kf.KNL_Alambda_minus = KNL_Alambda_minus;
+  kf.KNL_Qstar_plus    = KNL_Qstar_plus;
+  kf.KNL_Qstar_minus   = KNL_Qstar_minus;
+  kf.KNL_vstar_plus    = KNL_vstar_plus;
+  kf.KNL_vstar_minus   = KNL_vstar_minus;
+  kf.KNL_cL_plus       = KNL_cL_plus;
+  kf.KNL_cL_minus      = KNL_cL_minus;
+  kf.KNL_cR_plus       = KNL_cR_plus;
+  kf.KNL_cR_minus      = KNL_cR_minus;
+  kf.KNL_cS_plus       = KNL_cS_plus;
+  kf.KNL_cS_minus      = KNL_cS_minus;
+  kf.sig0              = sig0;
+  kf.scLR              = scLR;
+  kf.scS               = scS;
+
+  double scale = 1.;
+
+  // The algorithm computes d^2xsec/dWdQ2
+  // Check whether variable tranformation is needed
+  if ( kps != kPSWQ2fE ) {
+     double J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
+     scale *= J;
   }
 
-  if(fGA){
-    LOG("BSKLNBaseRESPXSec2014",pDEBUG) << "Using new GA";
+  // Apply given scaling factor
+  if      (is_CC) { scale *= fXSecScaleCC; }
+  else if (is_NC) { scale *= fXSecScaleNC; }
 
-    double CA5_0 = 1.2;
-    double CA5 = CA5_0 *  TMath::Power( 1./(1-q2/fMa2), 2);
-    //  GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5/fZeta;
-    GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5;
+  kf.scale = scale;
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"GA= " <<GA << "  C5A= " <<CA5;
+  // If requested return the free nucleon xsec even for input nuclear tgt
+  if ( interaction->TestBit(kIAssumeFreeNucleon) ) return true;
+
+  int Z = target.Z();
+  int A = target.A();
+  int N = A-Z;
+
+  // Take into account the number of scattering centers in the target
+  int NNucl = (is_p) ? Z : N;
+  scale*=NNucl; // nuclear xsec (no nuclear suppression factor)
+
+  if ( fUsePauliBlocking && A!=1 )
+  {
+    // Calculation of Pauli blocking according references:
+    //
+    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
+    //         charge exchange corrections to leptonic pion  production
+    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
+    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
+    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
+    //         oscillation experiments and the  nonperturbative disper-
+    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
+    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
+    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
+    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
+    //         [arXiv: hep-ph/0308130].
+
+    double P_Fermi = 0.0;
+
+    // Maximum value of Fermi momentum of target nucleon (GeV)
+    if ( A<6 || ! fUseRFGParametrization )
+    {
+        // look up the Fermi momentum for this target
+        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
+        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
+        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
+     }
+     else {
+        // define the Fermi momentum for this target
+        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
+        // correct the Fermi momentum for the struck nucleon
+        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
+        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
+     }
+
+     double FactorPauli_RES = 1.0;
+
+     double k0 = 0., q = 0., q0 = 0.;
+
+     if (P_Fermi > 0.)
+     {
+        k0 = (W2-Mnuc2-Q2)/(2*W);
+        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
+        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
+        q = TMath::Sqrt(q0*q0-kPionMass2);
+     }
+
+     if ( 2*P_Fermi < k-q )
+        FactorPauli_RES = 1.0;
+     if ( 2*P_Fermi >= k+q )
+        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
+     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
+        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
+
+     scale *= FactorPauli_RES;
   }
-  //JN end of new form factors code
 
-  if(is_EM) {
-    GA = 0.; // zero the axial term for EM scattering
+  kf.scale = scale;
+
+  return true;
+}
+//____________________________________________________________________________
+double BSKLNBaseRESPXSec2014::ResonanceXSec(
+    Resonance_t resonance, const KineFactors_t & kf) const
+{
+// Compute the contribution of the input resonance, given the kinematical
+// factors computed by KineFactors()
+
+  const RSHelicityAmplModelI * hamplmod          = kf.hamplmod;
+  int                          nucpdgc           = kf.nucpdgc;
+  double                       W                 = kf.W;
+  double                       q2                = kf.q2;
+  double                       Mnuc              = kf.Mnuc;
+  double                       Q2                = kf.Q2;
+  double                       vstar             = kf.vstar;
+  double                       Qstar             = kf.Qstar;
+  double                       a                 = kf.a;
+  double                       U2                = kf.U2;
+  double                       V2                = kf.V2;
+  double                       UV                = kf.UV;
+  bool                         is_nu             = kf.is_nu;
+  bool                         is_nubar          = kf.is_nubar;
+  bool                         is_lplus          = kf.is_lplus;
+  bool                         is_lminus         = kf.is_lminus;
+  bool                         is_p              = kf.is_p;
+  bool                         is_n              = kf.is_n;
+  bool                         is_CC             = kf.is_CC;
+  bool                         is_EM             = kf.is_EM;
+  bool                         is_KLN            = kf.is_KLN;
+  bool                         is_BRS            = kf.is_BRS;
+  double                       KNL_Alambda_plus  = kf.KNL_Alambda_plus;
+  double                       KNL_Alambda_minus = kf.KNL_Alambda_minus;
+  double                       KNL_Qstar_plus    = kf.KNL_Qstar_plus;
+  double                       KNL_Qstar_minus   = kf.KNL_Qstar_minus;
+  double                       KNL_vstar_plus    = kf.KNL_vstar_plus;
+  double                       KNL_vstar_minus   = kf.KNL_vstar_minus;
+  double                       KNL_cL_plus       = kf.KNL_cL_plus;
+  double                       KNL_cL_minus      = kf.KNL_cL_minus;
+  double                       KNL_cR_plus       = kf.KNL_cR_plus;
+  double                       KNL_cR_minus      = kf.KNL_cR_minus;
+  double                       KNL_cS_plus       = kf.KNL_cS_plus;
+  double                       KNL_cS_minus      = kf.KNL_cS_minus;
+  double                       sig0              = kf.sig0;
+  double                       scLR              = kf.scLR;
+  double                       scS               = kf.scS;
+
+  double Mnuc2  = TMath::Power(Mnuc, 2);
+
+  string      resname   = utils::res::AsString(resonance);
+  bool        is_delta  = utils::res::IsDelta (resonance);
+
+  if(is_CC && !is_delta) {
+    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
   }
 
-  double d      = TMath::Power(W+Mnuc,2.) - q2;
+  // Get baryon resonance parameters
+  int    IR  = utils::res::ResonanceIndex    (resonance);
+  int    LR  = utils::res::OrbitalAngularMom (resonance);
+  double MR  = utils::res::Mass              (resonance);
+  double WR  = utils::res::Width             (resonance);
+   double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+
+  // Following NeuGEN, avoid problems with underlying unphysical
+  // model assumptions by restricting the allowed W phase space
+  // around the resonance peak
+ if (fNormBW) {
+        if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return 0.;
+        else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return 0.;
+        else if (W > MR + fGnResMaxNWidths * WR)          return 0.;
+  }
+
+  // Calculate the Feynman-Kislinger-Ravndall parameters and the Rein-Sehgal
+  // helicity amplitudes, or look them up in the tables
+
+  RSAmplTerms_t terms;
+  if(!fUseAmplTables ||
+     !this->TabulatedAmplTerms(hamplmod,resonance,nucpdgc,W,q2,Mnuc,is_EM,terms)) {
+     this->DirectAmplTerms(hamplmod,resonance,W,q2,Mnuc,is_EM,terms,false);
+  }
+  double GV     = terms.GV;
+  double GA     = terms.GA;
   double sq2omg = TMath::Sqrt(2./fOmega);
   double nomg   = IR * fOmega;
-  double mq_w   = Mnuc*Q/W;
-
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
 
   //JN KNL
   double KNL_S_plus = 0;
@@ -361,11 +569,11 @@ double BSKLNBaseRESPXSec2014::XSec(
     KNL_S_plus  = (KNL_vstar_plus*vstar  - KNL_Qstar_plus *Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2; //possibly missing minus sign ()
     KNL_S_minus = (KNL_vstar_minus*vstar - KNL_Qstar_minus*Qstar )* (Mnuc2 -q2 - 3*W*Mnuc ) * GV / (6*Mnuc2)/Q2;
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<terms.S;
 
     KNL_B_plus  = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_plus  + KNL_vstar_plus *Qstar/a/Mnuc ) * GA;
     KNL_B_minus = fZeta/(3.*W*sq2omg)/Qstar * (KNL_Qstar_minus + KNL_vstar_minus*Qstar/a/Mnuc ) * GA;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"KNL B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<terms.B;
 
     KNL_C_plus = ( (KNL_Qstar_plus*Qstar - KNL_vstar_plus*vstar ) * ( 1./3. + vstar/a/Mnuc)
         + KNL_vstar_plus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
@@ -373,7 +581,7 @@ double BSKLNBaseRESPXSec2014::XSec(
     KNL_C_minus = ( (KNL_Qstar_minus*Qstar - KNL_vstar_minus*vstar ) * ( 1./3. + vstar/a/Mnuc)
         + KNL_vstar_minus*(2./3.*W +q2/a/Mnuc + nomg/3./a/Mnuc) )* fZeta * (GA/2./W/Qstar);
 
-    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    LOG("BSKLNBaseRESPXSec2014",pINFO)  <<"KNL C= "<<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<terms.C;
   }
   double BRS_S_plus = 0;
   double BRS_S_minus = 0;
@@ -401,28 +609,23 @@ double BSKLNBaseRESPXSec2014::XSec(
 
     BRS_S_plus = KNL_S_plus;
     BRS_S_minus = KNL_S_minus;
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<fFKR.S;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS S= " <<KNL_S_plus<<"\t"<<KNL_S_minus<<"\t"<<terms.S;
 
     BRS_B_plus = KNL_B_plus + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
 
     BRS_B_minus = KNL_B_minus + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
       *( 2./3 /sq2omg *(vstar + Qstar*Qstar/Mnuc/a))/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<fFKR.B;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS B= " <<KNL_B_plus<<"\t"<<KNL_B_minus<<"\t"<<terms.B;
 
     BRS_C_plus = KNL_C_plus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_plus*vstar - KNL_vstar_plus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
 
     BRS_C_minus = KNL_C_minus  + fZeta*GA/2./W/Qstar*( KNL_Qstar_minus*vstar - KNL_vstar_minus*Qstar)
       * Qstar*(2./3.*W +q2/Mnuc/a +nomg/3./a/Mnuc)/(kPionMass2 -q2);
-    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<fFKR.C;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"BRS C= " <<KNL_C_plus<<"\t"<<KNL_C_minus<<"\t"<<terms.C;
   }
 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("FKR", pDEBUG)
-    << "FKR params for RES = " << resname << " : " << fFKR;
-#endif
-
   // Calculate the Rein-Sehgal Helicity Amplitudes
   double sigL_minus = 0;
   double sigR_minus = 0;
@@ -432,37 +635,6 @@ double BSKLNBaseRESPXSec2014::XSec(
   double sigR_plus = 0;
   double sigS_plus = 0;
 
-  const RSHelicityAmplModelI * hamplmod = 0;
-  const RSHelicityAmplModelI * hamplmod_KNL_minus = 0;
-  const RSHelicityAmplModelI * hamplmod_KNL_plus = 0;
-  const RSHelicityAmplModelI * hamplmod_BRS_minus = 0;
-  const RSHelicityAmplModelI * hamplmod_BRS_plus = 0;
-
-  // These lines were ~ 100 lines below, which means that, for EM interactions, the coefficients below were still calculated using the weak coupling constant - Afro
-  double g2 = kGF2;
-
-  // For EM interaction replace  G_{Fermi} with :
-  // a_{em} * pi / ( sqrt(2) * sin^2(theta_weinberg) * Mass_{W}^2 }
-  // See C.Quigg, Gauge Theories of the Strong, Weak and E/M Interactions,
-  // ISBN 0-8053-6021-2, p.112 (6.3.57)
-  // Also, take int account that the photon propagator is 1/p^2 but the
-  // W propagator is 1/(p^2-Mass_{W}^2), so weight the EM case with
-  // Mass_{W}^4 / q^4
-  // So, overall:
-  // G_{Fermi}^2 --> a_{em}^2 * pi^2 / (2 * sin^4(theta_weinberg) * q^{4})
-  //
-
-  if(is_EM) {
-    double q4 = q2*q2;
-    g2 = kAem2 * kPi2 / (2.0 * fSin48w * q4);
-  }
-
-  if(is_CC) g2 = kGF2*fVud2;
-
-  double sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
-  double scLR = W/Mnuc;
-  double scS  = (Mnuc/W)*(-Q2/q2);
-
   double sigL =0;
   double sigR =0;
   double sigS =0;
@@ -471,77 +643,19 @@ double BSKLNBaseRESPXSec2014::XSec(
   double sigRSR =0;
   double sigRSS =0;
 
-  if(is_CC && !(is_KLN || is_BRS) ) {
-
-    hamplmod = fHAmplModelCC;
+  if(is_CC && is_KLN) {
+     this->AmplSums(hamplmod, resonance, terms, KNL_S_minus, KNL_B_minus, KNL_C_minus,
+                    sigL_minus, sigR_minus, sigS_minus);
+     this->AmplSums(hamplmod, resonance, terms, KNL_S_plus,  KNL_B_plus,  KNL_C_plus,
+                    sigL_plus,  sigR_plus,  sigS_plus);
   }
   else
-    if(is_NC) {
-      if (is_p) { hamplmod = fHAmplModelNCp;}
-      else      { hamplmod = fHAmplModelNCn;}
-    }
-    else
-      if(is_EM) {
-        if (is_p) { hamplmod = fHAmplModelEMp;}
-        else      { hamplmod = fHAmplModelEMn;}
-      }
-      else
-        if(is_CC && is_KLN ){
-          fFKR.S = KNL_S_minus;        //2 times fFKR.S?
-          fFKR.B = KNL_B_minus;
-          fFKR.C = KNL_C_minus;
-
-          hamplmod_KNL_minus = fHAmplModelCC;
-
-          assert(hamplmod_KNL_minus);
-
-          const RSHelicityAmpl & hampl_KNL_minus = hamplmod_KNL_minus->Compute(resonance, fFKR);
-
-          sigL_minus = (hampl_KNL_minus.Amp2Plus3 () + hampl_KNL_minus.Amp2Plus1 ());
-          sigR_minus = (hampl_KNL_minus.Amp2Minus3() + hampl_KNL_minus.Amp2Minus1());
-          sigS_minus = (hampl_KNL_minus.Amp20Plus () + hampl_KNL_minus.Amp20Minus());
-
-
-          fFKR.S = KNL_S_plus;
-          fFKR.B = KNL_B_plus;
-          fFKR.C = KNL_C_plus;
-          hamplmod_KNL_plus = fHAmplModelCC;
-          assert(hamplmod_KNL_plus);
-
-          const RSHelicityAmpl & hampl_KNL_plus = hamplmod_KNL_plus->Compute(resonance, fFKR);
-
-          sigL_plus = (hampl_KNL_plus.Amp2Plus3 () + hampl_KNL_plus.Amp2Plus1 ());
-          sigR_plus = (hampl_KNL_plus.Amp2Minus3() + hampl_KNL_plus.Amp2Minus1());
-          sigS_plus = (hampl_KNL_plus.Amp20Plus () + hampl_KNL_plus.Amp20Minus());
-
-        }
-        else
-          if(is_CC && is_BRS ){
-            fFKR.S = BRS_S_minus;
-            fFKR.B = BRS_B_minus;
-            fFKR.C = BRS_C_minus;
-
-            hamplmod_BRS_minus = fHAmplModelCC;
-            assert(hamplmod_BRS_minus);
-
-            const RSHelicityAmpl & hampl_BRS_minus = hamplmod_BRS_minus->Compute(resonance, fFKR);
-
-            sigL_minus = (hampl_BRS_minus.Amp2Plus3 () + hampl_BRS_minus.Amp2Plus1 ());
-            sigR_minus = (hampl_BRS_minus.Amp2Minus3() + hampl_BRS_minus.Amp2Minus1());
-            sigS_minus = (hampl_BRS_minus.Amp20Plus () + hampl_BRS_minus.Amp20Minus());
-
-            fFKR.S = BRS_S_plus;
-            fFKR.B = BRS_B_plus;
-            fFKR.C = BRS_C_plus;
-            hamplmod_BRS_plus = fHAmplModelCC;
-            assert(hamplmod_BRS_plus);
-
-            const RSHelicityAmpl & hampl_BRS_plus = hamplmod_BRS_plus->Compute(resonance, fFKR);
-
-            sigL_plus = (hampl_BRS_plus.Amp2Plus3 () + hampl_BRS_plus.Amp2Plus1 ());
-            sigR_plus = (hampl_BRS_plus.Amp2Minus3() + hampl_BRS_plus.Amp2Minus1());
-            sigS_plus = (hampl_BRS_plus.Amp20Plus () + hampl_BRS_plus.Amp20Minus());
-          }
+  if(is_CC && is_BRS) {
+     this->AmplSums(hamplmod, resonance, terms, BRS_S_minus, BRS_B_minus, BRS_C_minus,
+                    sigL_minus, sigR_minus, sigS_minus);
+     this->AmplSums(hamplmod, resonance, terms, BRS_S_plus,  BRS_B_plus,  BRS_C_plus,
+                    sigL_plus,  sigR_plus,  sigS_plus);
+  }
 
   // Compute the cross section
   if(is_KLN || is_BRS) {
@@ -559,13 +673,11 @@ double BSKLNBaseRESPXSec2014::XSec(
          << "sL,R,S plus = " << sigL_plus << "," << sigR_plus << "," << sigS_plus;
   }
   else {
-     assert(hamplmod);
-
-     const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR);
-
-     sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
-     sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
-     sigS = scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
+     this->AmplSums(hamplmod, resonance, terms, terms.S, terms.B, terms.C,
+                    sigL, sigR, sigS);
+     sigL *= scLR;
+     sigR *= scLR;
+     sigS *= scS;
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
@@ -586,7 +698,7 @@ double BSKLNBaseRESPXSec2014::XSec(
       LOG("BSKLNBaseRESPXSec2014",pINFO) << "A-="<<KNL_Alambda_minus<<" A+="<<KNL_Alambda_plus;
       // protect against sigRSR=sigRSL=sigRSS=0
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<q2<<"\t"<<xsec<<"\t"<<sig0*(V2*sigR + U2*sigL + 2*UV*sigS)<<"\t"<<xsec/TMath::Max(sig0*(V2*sigRSR + U2*sigRSL + 2*UV*sigRSS),1.0e-100);
-      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"fFKR.B="<<fFKR.B<<" fFKR.C="<<fFKR.C<<" fFKR.S="<<fFKR.S;
+      LOG("BSKLNBaseRESPXSec2014",pINFO) <<"FKR B="<<terms.B<<" FKR C="<<terms.C<<" FKR S="<<terms.S;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"CL-="<<TMath::Power(KNL_cL_minus,2)<<" CL+="<<TMath::Power(KNL_cL_plus,2)<<" U2="<<U2;
       LOG("BSKLNBaseRESPXSec2014",pINFO) <<"SL-="<<sigL_minus<<" SL+="<<sigL_plus<<" SL="<<sigRSL;
 
@@ -626,88 +738,327 @@ double BSKLNBaseRESPXSec2014::XSec(
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("BSKLNBaseRESPXSec2014", pINFO)
-      << "\n d2xsec/dQ2dW"  << "[" << interaction->AsString()
-      << "](W=" << W << ", q2=" << q2 << ", E=" << E << ") = " << xsec;
+      << "\n d2xsec/dQ2dW"  << "[RES = " << resname
+      << "](W=" << W << ", q2=" << q2 << ", E=" << kf.E << ") = " << xsec;
 #endif
 
-  // The algorithm computes d^2xsec/dWdQ2
-  // Check whether variable tranformation is needed
-  if ( kps != kPSWQ2fE ) {
-     double J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
-     xsec *= J;
+  // Apply the resonance-independent factors: scaling, Jacobian, number of
+  // scattering centres & Pauli blocking
+  xsec *= kf.scale;
+
+  return xsec;
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::FKRParams(
+    int IR, double W, double q2, double Mnuc, bool is_EM,
+    FKR & fkr, double & GV, double & GA) const
+{
+// Calculate the Feynman-Kislinger-Ravndall parameters and the vector and
+// axial form factors
+
+  double W2     = TMath::Power(W,    2);
+  double Mnuc2  = TMath::Power(Mnuc, 2);
+  double k      = 0.5 * (W2 - Mnuc2)/Mnuc;
+  double v      = k - 0.5 * q2/Mnuc;
+  double Q2     = TMath::Power(v, 2) - q2;
+  double Q      = TMath::Sqrt(Q2);
+
+  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
+  GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
+  GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+
+  if(fGV){
+
+    LOG("BSKLNBaseRESPXSec2014",pDEBUG) <<"Using new GV";
+    double CV0 =  1./(1-q2/fMv2/4.);
+    double CV3 =  2.13 * CV0 * TMath::Power( 1-q2/fMv2,-2);
+    double CV4 = -1.51 * CV0 * TMath::Power( 1-q2/fMv2,-2);
+    double CV5 =  0.48 * CV0 * TMath::Power( 1-q2/fMv2/0.766, -2);
+
+    double GV3 =  0.5 / TMath::Sqrt(3) * ( CV3 * (W + Mnuc)/Mnuc
+                  + CV4 * (W2 + q2 -Mnuc2)/2./Mnuc2
+                  + CV5 * (W2 - q2 -Mnuc2)/2./Mnuc2 );
+
+    double GV1 = - 0.5 / TMath::Sqrt(3) * ( CV3 * (Mnuc2 -q2 +Mnuc*W)/W/Mnuc
+                 + CV4 * (W2 +q2 - Mnuc2)/2./Mnuc2
+                 + CV5 * (W2 -q2 - Mnuc2)/2./Mnuc2 );
+
+    GV = 0.5 * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR)
+         * TMath::Sqrt( 3 * GV3*GV3 + GV1*GV1);
   }
 
-  // Apply given scaling factor
-  if      (is_CC) { xsec *= fXSecScaleCC; }
-  else if (is_NC) { xsec *= fXSecScaleNC; }
+  if(fGA){
+    LOG("BSKLNBaseRESPXSec2014",pDEBUG) << "Using new GA";
 
-  // If requested return the free nucleon xsec even for input nuclear tgt
-  if ( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
+    double CA5_0 = 1.2;
+    double CA5 = CA5_0 *  TMath::Power( 1./(1-q2/fMa2), 2);
+    //  GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5/fZeta;
+    GA = 0.5 * TMath::Sqrt(3.) * TMath::Power( 1 - q2/(Mnuc + W)/(Mnuc + W), 0.5-IR) * (1- (W2 +q2 -Mnuc2)/8./Mnuc2) * CA5;
 
-  int Z = target.Z();
-  int A = target.A();
-  int N = A-Z;
+    LOG("BSKLNBaseRESPXSec2014",pINFO) <<"GA= " <<GA << "  C5A= " <<CA5;
+  }
+  //JN end of new form factors code
 
-  // Take into account the number of scattering centers in the target
-  int NNucl = (is_p) ? Z : N;
-  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor)
+  if(is_EM) {
+    GA = 0.; // zero the axial term for EM scattering
+  }
 
-  if ( fUsePauliBlocking && A!=1 )
-  {
-    // Calculation of Pauli blocking according references:
-    //
-    //     [1] S.L. Adler,  S. Nussinov,  and  E.A.  Paschos,  "Nuclear
-    //         charge exchange corrections to leptonic pion  production
-    //         in  the (3,3) resonance  region,"  Phys. Rev. D 9 (1974)
-    //         2125-2143 [Erratum Phys. Rev. D 10 (1974) 1669].
-    //     [2] J.Y. Yu, "Neutrino interactions and  nuclear  effects in
-    //         oscillation experiments and the  nonperturbative disper-
-    //         sive  sector in strong (quasi-)abelian  fields,"  Ph. D.
-    //         Thesis, Dortmund U., Dortmund, 2002 (unpublished).
-    //     [3] E.A. Paschos, J.Y. Yu,  and  M. Sakuda,  "Neutrino  pro-
-    //         duction  of  resonances,"  Phys. Rev. D 69 (2004) 014013
-    //         [arXiv: hep-ph/0308130].
+  double d      = TMath::Power(W+Mnuc,2.) - q2;
+  double sq2omg = TMath::Sqrt(2./fOmega);
+  double nomg   = IR * fOmega;
+  double mq_w   = Mnuc*Q/W;
 
-    double P_Fermi = 0.0;
+  fkr.Lamda  = sq2omg * mq_w;
+  fkr.Tv     = GV / (3.*W*sq2omg);
+  fkr.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fkr.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fkr.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fkr.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fkr.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fkr.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fkr.R      = fkr.Rv;
+  fkr.Rplus  = - (fkr.Rv + fkr.Ra);
+  fkr.Rminus = - (fkr.Rv - fkr.Ra);
+  fkr.T      = fkr.Tv;
+  fkr.Tplus  = - (fkr.Tv + fkr.Ta);
+  fkr.Tminus = - (fkr.Tv - fkr.Ta);
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::DirectAmplTerms(
+    const RSHelicityAmplModelI * hamplmod, Resonance_t res,
+    double W, double q2, double Mnuc, bool is_EM,
+    RSAmplTerms_t & terms, bool derivatives) const
+{
+// Calculate the FKR parameters & form factors. If requested, also calculate
+// the helicity amplitudes and their derivatives in S, B and C (the helicity
+// amplitudes are linear in S, B and C), otherwise they are calculated from
+// the FKR parameters by AmplSums()
 
-    // Maximum value of Fermi momentum of target nucleon (GeV)
-    if ( A<6 || ! fUseRFGParametrization )
-    {
-        // look up the Fermi momentum for this target
-        FermiMomentumTablePool * kftp = FermiMomentumTablePool::Instance();
-        const FermiMomentumTable * kft = kftp->GetTable(fKFTable);
-        P_Fermi = kft->FindClosestKF(pdg::IonPdgCode(A, Z), nucpdgc);
-     }
-     else {
-        // define the Fermi momentum for this target
-        P_Fermi = utils::nuclear::FermiMomentumForIsoscalarNucleonParametrization(target);
-        // correct the Fermi momentum for the struck nucleon
-        if(is_p) { P_Fermi *= TMath::Power( 2.*Z/A, 1./3); }
-        else     { P_Fermi *= TMath::Power( 2.*N/A, 1./3); }
-     }
+  int IR = utils::res::ResonanceIndex(res);
 
-     double FactorPauli_RES = 1.0;
+  this->FKRParams(IR, W, q2, Mnuc, is_EM, terms.fkr, terms.GV, terms.GA);
 
-     double k0 = 0., q = 0., q0 = 0.;
+  terms.tabulated = false;
+  terms.S = terms.fkr.S;
+  terms.B = terms.fkr.B;
+  terms.C = terms.fkr.C;
 
-     if (P_Fermi > 0.)
-     {
-        k0 = (W2-Mnuc2-Q2)/(2*W);
-        k = TMath::Sqrt(k0*k0+Q2);  // previous value of k is overridden
-        q0 = (W2-Mnuc2+kPionMass2)/(2*W);
-        q = TMath::Sqrt(q0*q0-kPionMass2);
-     }
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("FKR", pDEBUG)
+    << "FKR params for RES = " << utils::res::AsString(res) << " : " << terms.fkr;
+#endif
 
-     if ( 2*P_Fermi < k-q )
-        FactorPauli_RES = 1.0;
-     if ( 2*P_Fermi >= k+q )
-        FactorPauli_RES = ((3*k*k+q*q)/(2*P_Fermi)-(5*TMath::Power(k,4)+TMath::Power(q,4)+10*k*k*q*q)/(40*TMath::Power(P_Fermi,3)))/(2*k);
-     if ( 2*P_Fermi >= k-q && 2*P_Fermi <= k+q )
-        FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
+  if(!derivatives) return;
+
+  for(int k = 0; k < 4; k++) {
+    FKR fkr;
+    if(k == 0) {
+      fkr = terms.fkr;
+    } else {
+      fkr.Lamda = terms.fkr.Lamda;
+      if(k == 1) fkr.S = 1.;
+      if(k == 2) fkr.B = 1.;
+      if(k == 3) fkr.C = 1.;
+    }
+    const RSHelicityAmpl & hampl = hamplmod->Compute(res, fkr);
+    terms.ampl[k][0] = hampl.AmpMinus1();
+    terms.ampl[k][1] = hampl.AmpPlus1 ();
+    terms.ampl[k][2] = hampl.AmpMinus3();
+    terms.ampl[k][3] = hampl.AmpPlus3 ();
+    terms.ampl[k][4] = hampl.Amp0Minus();
+    terms.ampl[k][5] = hampl.Amp0Plus ();
+  }
+}
+//____________________________________________________________________________
+bool BSKLNBaseRESPXSec2014::TabulatedAmplTerms(
+    const RSHelicityAmplModelI * hamplmod, Resonance_t res, int nucpdgc,
+    double W, double q2, double Mnuc, bool is_EM, RSAmplTerms_t & terms) const
+{
+// Look up the FKR parameters, form factors & helicity amplitudes in the
+// table for this resonance & helicity amplitude model.
+// Returns false if the direct calculation is needed.
+
+  const RSAmplTable_t & table =
+     this->AmplTable(hamplmod, res, nucpdgc, Mnuc, is_EM);
+
+  double xw = (W - table.Wmin) / table.dW;
+  double xq = TMath::Sqrt(TMath::Max(0., -q2)) / table.dQ;
+  if(xw < 0.) return false;
+  int iw = (int) xw;
+  int iq = (int) xq;
+  if(iw >= kAmplNW-1 || iq >= kAmplNQ-1) return false;
+
+  if(!table.cellok[iw*(kAmplNQ-1)+iq]) return false;
+
+  double fw = xw - iw;
+  double fq = xq - iq;
+  double w00 = (1.-fw)*(1.-fq);
+  double w01 = (1.-fw)*fq;
+  double w10 = fw*(1.-fq);
+  double w11 = fw*fq;
+
+  const float * v00 = &table.data[(iw*kAmplNQ+iq)*kAmplNVals];
+  const float * v01 = v00 + kAmplNVals;
+  const float * v10 = v00 + kAmplNQ*kAmplNVals;
+  const float * v11 = v10 + kAmplNVals;
+
+  double v[kAmplNVals];
+  for(int i = 0; i < kAmplNVals; i++) {
+    v[i] = w00*v00[i] + w01*v01[i] + w10*v10[i] + w11*v11[i];
+  }
+  this->UnpackAmplTerms(v, terms);
+  terms.tabulated = true;
 
-     xsec *= FactorPauli_RES;
+  return true;
+}
+//____________________________________________________________________________
+const BSKLNBaseRESPXSec2014::RSAmplTable_t & BSKLNBaseRESPXSec2014::AmplTable(
+    const RSHelicityAmplModelI * hamplmod, Resonance_t res, int nucpdgc,
+    double Mnuc, bool is_EM) const
+{
+// Table of FKR parameters, form factors & helicity amplitudes on a grid
+// uniform in W and in |q2|^(1/2), built when first needed. Every grid cell
+// is validated at its centre against the direct calculation.
+
+  RSAmplTableKey_t key(hamplmod, std::make_pair((int)res, nucpdgc));
+
+  map<RSAmplTableKey_t, RSAmplTable_t>::iterator it = fAmplTables.find(key);
+  if(it != fAmplTables.end()) return it->second;
+
+  RSAmplTable_t & table = fAmplTables[key];
+
+  // same W range as the one used for normalizing the Breit-Wigner
+  int    IR = utils::res::ResonanceIndex(res);
+  double MR = utils::res::Mass(res);
+  double WR = utils::res::Width(res);
+  double NW = fGnResMaxNWidths;
+  if(IR==2) NW = fN2ResMaxNWidths;
+  if(IR==0) NW = fN0ResMaxNWidths;
+
+  table.Wmin = Mnuc + kPionMass;
+  table.dW   = TMath::Max(MR + NW*WR - table.Wmin, WR) / (kAmplNW-1);
+  table.dQ   = kAmplQMax / (kAmplNQ-1);
+  table.data.assign(kAmplNW*kAmplNQ*kAmplNVals, 0.);
+  table.cellok.assign((kAmplNW-1)*(kAmplNQ-1), 0);
+
+  RSAmplTerms_t terms;
+  double v[kAmplNVals];
+  for(int iw = 0; iw < kAmplNW; iw++) {
+    double W = table.Wmin + iw * table.dW;
+    for(int iq = 0; iq < kAmplNQ; iq++) {
+      double q2 = -TMath::Power(iq * table.dQ, 2.);
+      this->DirectAmplTerms(hamplmod, res, W, q2, Mnuc, is_EM, terms, true);
+      this->PackAmplTerms(terms, v);
+      float * node = &table.data[(iw*kAmplNQ+iq)*kAmplNVals];
+      for(int i = 0; i < kAmplNVals; i++) node[i] = v[i];
+    }
   }
-  return xsec;
+
+  // validate every cell at its centre
+  int nok = 0;
+  RSAmplTerms_t interp;
+  double vd[kAmplNVals];
+  double vi[kAmplNVals];
+  for(int iw = 0; iw < kAmplNW-1; iw++) {
+    double W = table.Wmin + (iw + 0.5) * table.dW;
+    for(int iq = 0; iq < kAmplNQ-1; iq++) {
+      double q2 = -TMath::Power((iq + 0.5) * table.dQ, 2.);
+      this->DirectAmplTerms(hamplmod, res, W, q2, Mnuc, is_EM, terms, true);
+      this->PackAmplTerms(terms, vd);
+
+      const float * v00 = &table.data[(iw*kAmplNQ+iq)*kAmplNVals];
+      const float * v01 = v00 + kAmplNVals;
+      const float * v10 = v00 + kAmplNQ*kAmplNVals;
+      const float * v11 = v10 + kAmplNVals;
+      for(int i = 0; i < kAmplNVals; i++) {
+        vi[i] = 0.25 * (v00[i] + v01[i] + v10[i] + v11[i]);
+      }
+
+      // the helicity amplitudes are compared to the largest one (for the
+      // same S, B, C derivative), all other quantities individually
+      bool ok = true;
+      for(int i = 0; i < kAmplNVals && ok; i++) {
+        double scale = TMath::Abs(vd[i]);
+        if(i < 24) {
+          int k0 = 6 * (i/6);
+          for(int h = k0; h < k0+6; h++) scale = TMath::Max(scale, TMath::Abs(vd[h]));
+        }
+        ok = (TMath::Abs(vi[i] - vd[i]) <= kAmplTolerance * scale);
+      }
+      table.cellok[iw*(kAmplNQ-1)+iq] = ok ? 1 : 0;
+      if(ok) nok++;
+    }
+  }
+
+  LOG("BSKLNBaseRESPXSec2014", pNOTICE)
+     << "Built helicity amplitude table for RES = " << utils::res::AsString(res)
+     << ", hit nucleon = " << nucpdgc << " (W < " << table.Wmin + (kAmplNW-1)*table.dW
+     << " GeV, Q2 < " << kAmplQMax*kAmplQMax << " GeV^2): "
+     << 100.*nok/table.cellok.size() << "% of cells validated";
+
+  return table;
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::PackAmplTerms(
+    const RSAmplTerms_t & terms, double * v) const
+{
+  for(int k = 0; k < 4; k++) {
+    for(int h = 0; h < 6; h++) v[6*k+h] = terms.ampl[k][h];
+  }
+  v[24] = terms.S;
+  v[25] = terms.B;
+  v[26] = terms.C;
+  v[27] = terms.GV;
+  v[28] = terms.GA;
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::UnpackAmplTerms(
+    const double * v, RSAmplTerms_t & terms) const
+{
+  for(int k = 0; k < 4; k++) {
+    for(int h = 0; h < 6; h++) terms.ampl[k][h] = v[6*k+h];
+  }
+  terms.S  = v[24];
+  terms.B  = v[25];
+  terms.C  = v[26];
+  terms.GV = v[27];
+  terms.GA = v[28];
+}
+//____________________________________________________________________________
+void BSKLNBaseRESPXSec2014::AmplSums(
+    const RSHelicityAmplModelI * hamplmod, Resonance_t res,
+    const RSAmplTerms_t & terms, double S, double B, double C,
+    double & sigL, double & sigR, double & sigS) const
+{
+// Sums of |helicity amplitudes|^2 entering the L, R and S cross sections,
+// for the input values of the FKR parameters S, B and C
+
+  double f[6];
+  if(terms.tabulated) {
+    double dS = S - terms.S;
+    double dB = B - terms.B;
+    double dC = C - terms.C;
+    for(int h = 0; h < 6; h++) {
+      f[h] = terms.ampl[0][h] + dS * terms.ampl[1][h] +
+             dB * terms.ampl[2][h] + dC * terms.ampl[3][h];
+    }
+  } else {
+    FKR fkr = terms.fkr;
+    fkr.S = S;
+    fkr.B = B;
+    fkr.C = C;
+    const RSHelicityAmpl & hampl = hamplmod->Compute(res, fkr);
+    f[0] = hampl.AmpMinus1();
+    f[1] = hampl.AmpPlus1 ();
+    f[2] = hampl.AmpMinus3();
+    f[3] = hampl.AmpPlus3 ();
+    f[4] = hampl.Amp0Minus();
+    f[5] = hampl.Amp0Plus ();
+  }
+
+  sigL = f[3]*f[3] + f[1]*f[1];
+  sigR = f[2]*f[2] + f[0]*f[0];
+  sigS = f[5]*f[5] + f[4]*f[4];
 }
 //____________________________________________________________________________
 double BSKLNBaseRESPXSec2014::Integral(const Interaction * interaction) const
@@ -786,6 +1137,10 @@ void BSKLNBaseRESPXSec2014::LoadConfig(void)
   this->GetParam("RFG-UseParametrization", fUseRFGParametrization);
   this->GetParam("UsePauliBlockingForRES", fUsePauliBlocking);
 
+  // Tabulate the FKR parameters and helicity amplitudes?
+  this->GetParamDef( "RES-UseAmplTables", fUseAmplTables, true ) ;
+  fAmplTables.clear();
+
   // Load all the sub-algorithms needed
 
   fHAmplModelCC     = 0;
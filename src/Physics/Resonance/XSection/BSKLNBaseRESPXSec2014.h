@@ -13,6 +13,17 @@
 
           Modifications based on a MiniBooNE tune courtesy of J. Nowak, S.Dytman
 
+          The FKR parameters, form factors and helicity amplitudes depend only
+          on the resonance, W and q2 (for given nucleon and helicity amplitude
+          model). When first needed, they are tabulated on a (W, |q2|^(1/2))
+          grid and interpolated bilinearly afterwards; cells failing the
+          validation against the direct calculation at their centre, and
+          (W, q2) outside the table, use the direct calculation. As the
+          helicity amplitudes are linear in the FKR parameters S, B and C,
+          their derivatives in S, B and C are tabulated too, so that the tables
+          also apply to the lepton-kinematics dependent S, B and C of the KLN
+          and BRS models.
+
 \author   Steve Dytman
           University of Pittsburgh
 
@@ -36,6 +47,9 @@
 #ifndef _BSKLN_BASE_RES_PXSEC_2014_H_
 #define _BSKLN_BASE_RES_PXSEC_2014_H_
 
+#include <map>
+#include <vector>
+
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Physics/Resonance/XSection/FKR.h"
@@ -56,6 +70,10 @@ namespace genie {
       double Integral     (const Interaction * i) const;
       bool   ValidProcess (const Interaction * i) const;
 
+      // compute the cross section for a list of resonances in a single call
+      void   ResonanceXSecs (const Interaction * i, KinePhaseSpace_t k,
+                             const BaryonResList & reslist, vector<double> & xsec) const;
+
       // overload the Algorithm::Configure() methods to load private data
       // members from configuration options
       void Configure(const Registry & config);
@@ -68,7 +86,86 @@ namespace genie {
 
       void LoadConfig (void);
 
-      mutable FKR fFKR;
+      //! kinematical factors common to all resonances
+      struct KineFactors_t {
+        const RSHelicityAmplModelI * hamplmod;
+        int                          nucpdgc;
+        double                       W;
+        double                       q2;
+        double                       E;
+        double                       Mnuc;
+        double                       Q2;
+        double                       vstar;
+        double                       Qstar;
+        double                       a;
+        double                       U2;
+        double                       V2;
+        double                       UV;
+        bool                         is_nu;
+        bool                         is_nubar;
+        bool                         is_lplus;
+        bool                         is_lminus;
+        bool                         is_p;
+        bool                         is_n;
+        bool                         is_CC;
+        bool                         is_EM;
+        bool                         is_KLN;
+        bool                         is_BRS;
+        double                       KNL_Alambda_plus;
+        double                       KNL_Alambda_minus;
+        double                       KNL_Qstar_plus;
+        double                       KNL_Qstar_minus;
+        double                       KNL_vstar_plus;
+        double                       KNL_vstar_minus;
+        double                       KNL_cL_plus;
+        double                       KNL_cL_minus;
+        double                       KNL_cR_plus;
+        double                       KNL_cR_minus;
+        double                       KNL_cS_plus;
+        double                       KNL_cS_minus;
+        double                       sig0;
+        double                       scLR;
+        double                       scS;
+        double                       scale;  ///< scaling, Jacobian, # of scattering centres & Pauli blocking
+      };
+
+      bool   KineFactors   (const Interaction * i, KinePhaseSpace_t k, KineFactors_t & kf) const;
+      double ResonanceXSec (Resonance_t res, const KineFactors_t & kf) const;
+
+      //! FKR parameters, form factors & helicity amplitudes at given (W,q2)
+      struct RSAmplTerms_t {
+        bool   tabulated;   ///< looked up in the tables? (otherwise fkr is set)
+        FKR    fkr;         ///< FKR parameters (direct calculation only)
+        double S, B, C;     ///< FKR parameters S, B, C
+        double GV, GA;      ///< vector & axial form factors
+        double ampl[4][6];  ///< f(-1),f(+1),f(-3),f(+3),f(0-),f(0+) & d/dS, d/dB, d/dC (tables only)
+      };
+      //! helicity amplitude table for a resonance, hit nucleon & model
+      struct RSAmplTable_t {
+        double              Wmin;   ///< first W node (GeV)
+        double              dW;     ///< W node spacing (GeV)
+        double              dQ;     ///< |q2|^(1/2) node spacing (GeV)
+        std::vector<float>  data;   ///< values at the nodes [(iW*nQ+iQ)*nvals+ival]
+        std::vector<char>   cellok; ///< cell validated? [iW*(nQ-1)+iQ]
+      };
+      typedef std::pair<const RSHelicityAmplModelI *, std::pair<int,int> > RSAmplTableKey_t;
+
+      void   FKRParams          (int IR, double W, double q2, double Mnuc, bool is_EM,
+                                 FKR & fkr, double & GV, double & GA) const;
+      void   DirectAmplTerms    (const RSHelicityAmplModelI * hamplmod, Resonance_t res,
+                                 double W, double q2, double Mnuc, bool is_EM,
+                                 RSAmplTerms_t & terms, bool derivatives) const;
+      bool   TabulatedAmplTerms (const RSHelicityAmplModelI * hamplmod, Resonance_t res,
+                                 int nucpdgc, double W, double q2, double Mnuc, bool is_EM,
+                                 RSAmplTerms_t & terms) const;
+      const RSAmplTable_t &
+             AmplTable          (const RSHelicityAmplModelI * hamplmod, Resonance_t res,
+                                 int nucpdgc, double Mnuc, bool is_EM) const;
+      void   PackAmplTerms      (const RSAmplTerms_t & terms, double * v) const;
+      void   UnpackAmplTerms    (const double * v, RSAmplTerms_t & terms) const;
+      void   AmplSums           (const RSHelicityAmplModelI * hamplmod, Resonance_t res,
+                                 const RSAmplTerms_t & terms, double S, double B, double C,
+                                 double & sigL, double & sigR, double & sigS) const;
 
       const RSHelicityAmplModelI * fHAmplModelCC;
       const RSHelicityAmplModelI * fHAmplModelNCp;
@@ -94,6 +191,9 @@ namespace genie {
       string fKFTable;             ///< table of Fermi momentum (kF) constants for various nuclei
       bool fUseRFGParametrization; ///< use parametrization for fermi momentum insted of table?
       bool fUsePauliBlocking;      ///< account for Pauli blocking?
+      bool fUseAmplTables;         ///< tabulate the FKR parameters & helicity amplitudes?
+
+      mutable std::map<RSAmplTableKey_t, RSAmplTable_t> fAmplTables; ///< helicity amplitude tables
      
       double   fXSecScaleCC;       ///< external CC xsec scaling factor
       double   fXSecScaleNC;       ///< external NC xsec scaling factor
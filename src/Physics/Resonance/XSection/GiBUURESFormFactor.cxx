@@ -16,12 +16,21 @@
    Add FormFactors nested class & re-organize code
  @ May 01, 2012 - CA
    Pick data from new location ($GENIE/data/evgen/gibuu/)
+ @ Oct 14, 2026 - CA
+   Keep the form factors of a (resonance, current, nucleon) in one packed
+   table of spline coefficients on their common Q2 grid, evaluated with a
+   single knot search, and cache the tables in a binary file.
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <sstream>
 #include <string>
+#include <stdint.h>
 
 #include <TSystem.h>
 #include <TTree.h>
@@ -31,6 +40,7 @@
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/Spline.h"
 #include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/Utils/SystemUtils.h"
 #include "Physics/Resonance/XSection/GiBUURESFormFactor.h"
 
 using std::ostringstream;
@@ -42,6 +52,78 @@ using std::endl;
 using namespace genie;
 using namespace genie::utils;
 
+//____________________________________________________________________________
+// Layout of the binary form factor tables (all numbers in native byte order,
+// which is checked at load time using the byte-order mark):
+//   header
+//   for each table: table header, Q2 knots q2[nknots],
+//                   coefficients coeff[nknots][nff][4]
+//
+namespace {
+  const char     kFFBinMagic[8] = { 'G','G','B','U','U','F','F','R' };
+  const uint32_t kFFBinVersion  = 1;
+  const uint32_t kFFBinBOM      = 0x01020304;
+
+  struct FFBinHeader_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t bom;
+    uint32_t ntables;
+    uint32_t pad;
+    uint64_t fingerprint;  // hash of the text tables the file was built from
+    uint64_t file_size;
+  };
+  struct FFBinTableHeader_t {
+    uint32_t res, curr, nuc; // table indices
+    uint32_t ffirst, nff;    // form factors given
+    uint32_t nknots;
+  };
+
+  // 64-bit FNV-1a hash
+  void fnv1a(uint64_t & hash, const char * data, size_t n)
+  {
+    for(size_t i = 0; i < n; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+
+  // name of the text table of a (resonance, current, nucleon), "" if none
+  string TextTable(int r, int i, int j)
+  {
+    ostringstream name;
+    switch(r){
+      case ( 0): name << "P33_1232"; break;
+      case ( 1): name << "S11_1535"; break;
+      case ( 2): name << "D13_1520"; break;
+      case ( 3): name << "S11_1650"; break;
+      case ( 5): name << "D15_1675"; break;
+      case ( 6): name << "S31_1620"; break;
+      case ( 7): name << "D33_1700"; break;
+      case ( 8): name << "P11_1440"; break;
+      case (10): name << "P13_1720"; break;
+      case (11): name << "F15_1680"; break;
+      case (12): name << "P31_1910"; break;
+      case (14): name << "F35_1905"; break;
+      case (15): name << "F37_1950"; break;
+      default  : return "";
+    }
+    switch(i){
+      case (0): name << "_CC"; break;
+      case (1): name << "_NC"; break;
+      case (2): name << "_EM"; break;
+      default : return "";
+    }
+    switch(j){
+      case (0): name << "_neutron"; break;
+      case (1): name << "_proton";  break;
+      default : return "";
+    }
+    name << "_FFres.dat";
+    return name.str();
+  }
+}
+
 //____________________________________________________________________________
 GiBUURESFormFactor * GiBUURESFormFactor::fInstance = 0;
 //____________________________________________________________________________
@@ -88,25 +170,27 @@ double GiBUURESFormFactor::FormFactors::fMaxQ2 = 4.0; // GeV^2
 //____________________________________________________________________________
 GiBUURESFormFactor::FormFactors::FormFactors(void)
 {
-
+  for(int r=0; r<kNRes; r++) {
+    for(int i=0; i<kNCurr; i++) {
+      for(int j=0; j<kNHitNuc; j++) {
+        fFFTables[r][i][j] = 0;
+      }//j
+    }//i   
+  }//r 
 }
 //____________________________________________________________________________
 GiBUURESFormFactor::FormFactors::~FormFactors(void)
 {
   if(!gAbortingInErr) {
-    cout << "GiBUURESFormFactor singleton dtor: Deleting all f/f splines" << endl;
+    cout << "GiBUURESFormFactor singleton dtor: Deleting all f/f tables" << endl;
   }
 
-  // resonance form factor splines
+  // resonance form factor tables
   for(int r=0; r<kNRes; r++) {
     for(int i=0; i<kNCurr; i++) {
       for(int j=0; j<kNHitNuc; j++) {
-        for(int k=0; k<kNFFRes; k++) {
-           if (fFFRes[r][i][j][k]) {
-             delete fFFRes[r][i][j][k];
-             fFFRes[r][i][j][k] = 0;
-           }
-        }//k
+        delete fFFTables[r][i][j];
+        fFFTables[r][i][j] = 0;
       }//j
     }//i   
   }//r 
@@ -114,71 +198,73 @@ GiBUURESFormFactor::FormFactors::~FormFactors(void)
 //____________________________________________________________________________
 void GiBUURESFormFactor::FormFactors::LoadTables(void)
 {
-// Loads hadronic x-section data
+// Loads the resonance form factor tables: from the binary file written at a
+// previous run, if it was built from the current text tables, or else from
+// the text tables (then saving the binary file).
+// The binary file is looked up in $GGIBUUFFBINDIR, if set, in the shared
+// data directory, if set, or next to the text tables. It is only written
+// in the first two.
+
+  string data_dir = string(gSystem->Getenv("GENIE")) + 
+                    string("/data/evgen/gibuu");
 
+  LOG("GiBUURESFormFactor", pNOTICE) << "Loading GiBUU data from: " << data_dir;
+
+  // hash of the text tables
+  uint64_t fingerprint = 14695981039346656037ULL;
+  vector<char> buffer;
   for(int r=0; r<kNRes; r++) {
     for(int i=0; i<kNCurr; i++) {
       for(int j=0; j<kNHitNuc; j++) {
-        for(int k=0; k<kNFFRes; k++) {
-             fFFRes[r][i][j][k] = 0;
-        }//k
+        string table = TextTable(r,i,j);
+        if(table.size() == 0) continue;
+        string filename = data_dir + "/form_factors/" + table;
+        std::ifstream in(filename.c_str(), ios::in | ios::binary);
+        in.seekg(0, ios::end);
+        std::streamoff size = in.tellg();
+        if(size <= 0) continue;
+        buffer.resize(size);
+        in.seekg(0, ios::beg);
+        in.read(&buffer[0], size);
+        fnv1a(fingerprint, &buffer[0], size);
       }//j
     }//i   
   }//r 
 
-  string data_dir = string(gSystem->Getenv("GENIE")) + 
-                    string("/data/evgen/gibuu");
+  string bin_dir  = utils::system::SharedDataDir();
+  bool   writable = true;
+  if(gSystem->Getenv("GGIBUUFFBINDIR")) {
+    bin_dir = string(gSystem->Getenv("GGIBUUFFBINDIR"));
+  }
+  else if(bin_dir.size() == 0) {
+    bin_dir  = data_dir + "/form_factors";
+    writable = false;
+  }
+  string bin_file = bin_dir + "/GiBUU-FFres.gffbin";
 
-  LOG("GiBUURESFormFactor", pNOTICE) << "Loading GiBUU data from: " << data_dir;
+  if(this->LoadBinaryTables(bin_file, fingerprint)) return;
+
+  this->LoadTextTables(data_dir);
+  if(writable) this->SaveBinaryTables(bin_file, fingerprint);
+}
+//____________________________________________________________________________
+void GiBUURESFormFactor::FormFactors::LoadTextTables(const string & data_dir)
+{
+// Loads the form factor text tables, and packs the coefficients of the cubic
+// splines of the form factors given in each of them
 
-  //
-  // load resonance form factor data
-  //
   for(int r=0; r<kNRes; r++) {
     for(int i=0; i<kNCurr; i++) {
       for(int j=0; j<kNHitNuc; j++) {
 
-        bool skip = false;
-
         Resonance_t resonance = (Resonance_t)r;
 
-        ostringstream datafile;
-        datafile << data_dir << "/form_factors/";
-
-        switch(r){
-          case ( 0): datafile << "P33_1232"; break;
-          case ( 1): datafile << "S11_1535"; break;
-          case ( 2): datafile << "D13_1520"; break;
-          case ( 3): datafile << "S11_1650"; break;
-          case ( 5): datafile << "D15_1675"; break;
-          case ( 6): datafile << "S31_1620"; break;
-          case ( 7): datafile << "D33_1700"; break;
-          case ( 8): datafile << "P11_1440"; break;
-          case (10): datafile << "P13_1720"; break;
-          case (11): datafile << "F15_1680"; break;
-          case (12): datafile << "P31_1910"; break;
-          case (14): datafile << "F35_1905"; break;
-          case (15): datafile << "F37_1950"; break;
-          default  : skip = true;
-
-        }
-        switch(i){
-          case (0): datafile << "_CC"; break;
-          case (1): datafile << "_NC"; break;
-          case (2): datafile << "_EM"; break;
-          default : skip = true;
-        }
-        switch(j){
-          case (0): datafile << "_neutron"; break;
-          case (1): datafile << "_proton";  break;
-          default : skip = true;
-        }
-        datafile << "_FFres.dat";
-
-        if(skip) continue;
+        string table = TextTable(r,i,j);
+        if(table.size() == 0) continue;
+        string datafile = data_dir + "/form_factors/" + table;
 
         //-- Make sure that all data file exists
-        assert( ! gSystem->AccessPathName(datafile.str().c_str()) );
+        assert( ! gSystem->AccessPathName(datafile.c_str()) );
 
         //-- Read the data and fill a tree
 
@@ -188,53 +274,210 @@ void GiBUURESFormFactor::FormFactors::LoadTables(void)
         //   I=1/2 res: Qs   F_1^V  F_2^V  -----  -----  F_A    F_P    -----  ----
 
         TTree data_ffres;
-        data_ffres.ReadFile(datafile.str().c_str(), 
+        data_ffres.ReadFile(datafile.c_str(), 
                             "Q2/D:f1/D:f2/D:f3/D:f4/D:f5/D:f6/D:f7/D:f8/D");
 
         LOG("GiBUURESFormFactor", pDEBUG)  
            << "Number of data rows: " << data_ffres.GetEntries();
 
+        vector<Spline *> splines;
+        int ffirst = 0;
+
         //
         // I=3/2 resonances
         //
         if(res::IsDelta(resonance)) {
-           fFFRes[r][i][j][0]  = new Spline(&data_ffres, "Q2:f1"); // F1V = f(Q2)
-           fFFRes[r][i][j][1]  = new Spline(&data_ffres, "Q2:f2"); // F2V = f(Q2)
-           fFFRes[r][i][j][2]  = new Spline(&data_ffres, "Q2:f5"); // FA  = f(Q2)
-           fFFRes[r][i][j][3]  = new Spline(&data_ffres, "Q2:f6"); // FP  = f(Q2)
+           ffirst = 0;
+           splines.push_back(new Spline(&data_ffres, "Q2:f1")); // F1V = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f2")); // F2V = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f5")); // FA  = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f6")); // FP  = f(Q2)
         } // Delta res
         else 
         //
         // I=1/2 resonances
         //
         if(res::IsN(resonance)) {
-           fFFRes[r][i][j][4]  = new Spline(&data_ffres, "Q2:f1"); // C3V = f(Q2)
-           fFFRes[r][i][j][5]  = new Spline(&data_ffres, "Q2:f2"); // C4V = f(Q2)
-           fFFRes[r][i][j][6]  = new Spline(&data_ffres, "Q2:f3"); // C5V = f(Q2)
-           fFFRes[r][i][j][7]  = new Spline(&data_ffres, "Q2:f4"); // C6V = f(Q2)
-           fFFRes[r][i][j][8]  = new Spline(&data_ffres, "Q2:f5"); // C3A = f(Q2)
-           fFFRes[r][i][j][9]  = new Spline(&data_ffres, "Q2:f6"); // C4A = f(Q2)
-           fFFRes[r][i][j][10] = new Spline(&data_ffres, "Q2:f7"); // C5A = f(Q2)
-           fFFRes[r][i][j][11] = new Spline(&data_ffres, "Q2:f8"); // C6A = f(Q2)
+           ffirst = 4;
+           splines.push_back(new Spline(&data_ffres, "Q2:f1")); // C3V = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f2")); // C4V = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f3")); // C5V = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f4")); // C6V = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f5")); // C3A = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f6")); // C4A = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f7")); // C5A = f(Q2)
+           splines.push_back(new Spline(&data_ffres, "Q2:f8")); // C6A = f(Q2)
         } //N res
 
+        if(splines.size() == 0) continue;
+
+        // all columns of a table share the Q2 knots
+        int nff    = splines.size();
+        int nknots = splines[0]->NKnots();
+        FFTable_t * fftable = new FFTable_t;
+        fftable->ffirst = ffirst;
+        fftable->nff    = nff;
+        fftable->q2   .assign(nknots, 0.);
+        fftable->coeff.assign(4*nknots*nff, 0.);
+        for(int k = 0; k < nff; k++) {
+           TSpline3 * spl = splines[k]->GetAsTSpline();
+           assert(spl && spl->GetNp() == nknots);
+           for(int n = 0; n < nknots; n++) {
+             double x = 0;
+             double * c = &fftable->coeff[4*(n*nff + k)];
+             spl->GetCoeff(n, x, c[0], c[1], c[2], c[3]);
+             if(k == 0) fftable->q2[n] = x;
+             else assert(x == fftable->q2[n]);
+           }
+           delete splines[k];
+        }
+        fFFTables[r][i][j] = fftable;
+
       }//j
     }//i   
   }//r 
 
+  LOG("GiBUURESFormFactor", pINFO)  
+     << "Done loading all resonance form factor files...";
+}
+//____________________________________________________________________________
+bool GiBUURESFormFactor::FormFactors::LoadBinaryTables(
+                     const string & filename, unsigned long long fingerprint)
+{
+// Load the binary tables written by SaveBinaryTables(), if there are and
+// they were built from the current text tables. Returns false otherwise.
+
+  std::ifstream in(filename.c_str(), ios::in | ios::binary);
+  if(!in.good()) return false;
+
+  in.seekg(0, ios::end);
+  std::streamoff size = in.tellg();
+  in.seekg(0, ios::beg);
+  if(size < (std::streamoff) sizeof(FFBinHeader_t)) return false;
+
+  FFBinHeader_t header;
+  in.read((char *) &header, sizeof(header));
+  bool valid = in.good() &&
+     memcmp(header.magic, kFFBinMagic, sizeof(header.magic)) == 0 &&
+     header.version   == kFFBinVersion &&
+     header.bom       == kFFBinBOM     &&
+     header.file_size == (uint64_t) size;
+  if(!valid) {
+    LOG("GiBUURESFormFactor", pWARN)
+      << "Ignoring invalid or incompatible form factor file: " << filename;
+    return false;
+  }
+  if(header.fingerprint != fingerprint) {
+    LOG("GiBUURESFormFactor", pWARN)
+      << "Ignoring outdated form factor file: " << filename
+      << " (the text tables have changed)";
+    return false;
+  }
+
+  for(uint32_t it = 0; it < header.ntables && valid; it++) {
+    FFBinTableHeader_t th;
+    in.read((char *) &th, sizeof(th));
+    valid = in.good() && th.res < (uint32_t) kNRes &&
+       th.curr < (uint32_t) kNCurr && th.nuc < (uint32_t) kNHitNuc &&
+       th.ffirst + th.nff <= (uint32_t) kNFFRes && th.nknots > 1 &&
+       fFFTables[th.res][th.curr][th.nuc] == 0;
+    if(!valid) break;
+
+    FFTable_t * fftable = new FFTable_t;
+    fftable->ffirst = th.ffirst;
+    fftable->nff    = th.nff;
+    fftable->q2   .resize(th.nknots);
+    fftable->coeff.resize(4*th.nknots*th.nff);
+    in.read((char *) &fftable->q2[0],    fftable->q2.size()    * sizeof(double));
+    in.read((char *) &fftable->coeff[0], fftable->coeff.size() * sizeof(double));
+    fFFTables[th.res][th.curr][th.nuc] = fftable;
+    valid = in.good();
+  }
+
+  if(!valid) {
+    LOG("GiBUURESFormFactor", pWARN)
+      << "Ignoring corrupted form factor file: " << filename;
+    for(int r=0; r<kNRes; r++) {
+      for(int i=0; i<kNCurr; i++) {
+        for(int j=0; j<kNHitNuc; j++) {
+          delete fFFTables[r][i][j];
+          fFFTables[r][i][j] = 0;
+        }
+      }
+    }
+    return false;
+  }
+
+  LOG("GiBUURESFormFactor", pINFO)
+    << "Loaded " << header.ntables << " resonance form factor tables from: "
+    << filename;
+  return true;
+}
+//____________________________________________________________________________
+bool GiBUURESFormFactor::FormFactors::SaveBinaryTables(
+               const string & filename, unsigned long long fingerprint) const
+{
+// Save the form factor tables in a binary file that is loaded instead of
+// the text tables. The file is written under a temporary name and then
+// renamed, so that jobs never read it partially written.
+
+  FFBinHeader_t header;
+  memcpy(header.magic, kFFBinMagic, sizeof(header.magic));
+  header.version     = kFFBinVersion;
+  header.bom         = kFFBinBOM;
+  header.ntables     = 0;
+  header.pad         = 0;
+  header.fingerprint = fingerprint;
+  header.file_size   = sizeof(FFBinHeader_t);
 
   for(int r=0; r<kNRes; r++) {
     for(int i=0; i<kNCurr; i++) {
       for(int j=0; j<kNHitNuc; j++) {
-        for(int k=0; k<kNFFRes; k++) {
-             if(fFFRes[r][i][j][k]) fFFRes[r][i][j][k]->YCanBeNegative(true);
-        }//k
-      }//j
-    }//i   
-  }//r 
+        const FFTable_t * fftable = fFFTables[r][i][j];
+        if(!fftable) continue;
+        header.ntables++;
+        header.file_size += sizeof(FFBinTableHeader_t) +
+           (fftable->q2.size() + fftable->coeff.size()) * sizeof(double);
+      }
+    }
+  }
 
-  LOG("GiBUURESFormFactor", pINFO)  
-     << "Done loading all resonance form factor files...";
+  ostringstream tmpname;
+  tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+  std::ofstream out(tmpname.str().c_str(), ios::out | ios::binary);
+  out.write((const char *) &header, sizeof(header));
+  for(int r=0; r<kNRes; r++) {
+    for(int i=0; i<kNCurr; i++) {
+      for(int j=0; j<kNHitNuc; j++) {
+        const FFTable_t * fftable = fFFTables[r][i][j];
+        if(!fftable) continue;
+        FFBinTableHeader_t th;
+        th.res    = r;
+        th.curr   = i;
+        th.nuc    = j;
+        th.ffirst = fftable->ffirst;
+        th.nff    = fftable->nff;
+        th.nknots = fftable->q2.size();
+        out.write((const char *) &th, sizeof(th));
+        out.write((const char *) &fftable->q2[0],
+                  fftable->q2.size() * sizeof(double));
+        out.write((const char *) &fftable->coeff[0],
+                  fftable->coeff.size() * sizeof(double));
+      }
+    }
+  }
+  out.close();
+
+  if(out.fail() || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+    LOG("GiBUURESFormFactor", pWARN)
+      << "Could not write the form factor file: " << filename;
+    std::remove(tmpname.str().c_str());
+    return false;
+  }
+  LOG("GiBUURESFormFactor", pNOTICE)
+    << "Wrote the resonance form factor tables in: " << filename
+    << " (" << header.file_size << " bytes)";
+  return true;
 }
 //____________________________________________________________________________
 double GiBUURESFormFactor::FormFactors::C3V(
@@ -321,18 +564,52 @@ double GiBUURESFormFactor::FormFactors::FP(
   return this->FFRes(Q2,res,hit_nucleon_pdg,it,3);
 }
 //____________________________________________________________________________
+void GiBUURESFormFactor::FormFactors::All(
+    double Q2, Resonance_t res, int hit_nucleon_pdg, InteractionType_t it,
+    double * ff) const
+{
+  for(int k = 0; k < kNFFRes; k++) ff[k] = 0.;
+
+  if(Q2 < fMinQ2 || Q2 > fMaxQ2) return;
+
+  const FFTable_t * table = this->Table(res, hit_nucleon_pdg, it);
+  if(!table) return;
+
+  int n = this->FindKnot(*table, Q2);
+  if(n < 0) return;
+  for(int k = 0; k < table->nff; k++) {
+    ff[table->ffirst + k] = this->EvaluateInInterval(*table, n, k, Q2);
+  }
+}
+//____________________________________________________________________________
 double GiBUURESFormFactor::FormFactors::FFRes ( 
     double Q2, Resonance_t res, int hit_nucleon_pdg, InteractionType_t it, 
     int ffresid) const
 {
   if(Q2 < fMinQ2 || Q2 > fMaxQ2) return 0.;
 
-  int r = -1, i = -1, j = -1;
-
   if(ffresid<0 || ffresid >= kNFFRes) return 0.;
 
+  const FFTable_t * table = this->Table(res, hit_nucleon_pdg, it);
+  if(!table) return 0.;
+
+  int k = ffresid - table->ffirst;
+  if(k < 0 || k >= table->nff) return 0.;
+
+  int n = this->FindKnot(*table, Q2);
+  if(n < 0) return 0.;
+
+  return this->EvaluateInInterval(*table, n, k, Q2);
+}
+//____________________________________________________________________________
+const GiBUURESFormFactor::FormFactors::FFTable_t * 
+   GiBUURESFormFactor::FormFactors::Table(
+     Resonance_t res, int hit_nucleon_pdg, InteractionType_t it) const
+{
+  int r = -1, i = -1, j = -1;
+
   r = (int)res;
-  if(r<0 || r >= kNRes) return 0.;
+  if(r<0 || r >= kNRes) return 0;
 
   if      (it == kIntWeakCC) { i = 0; }
   else if (it == kIntWeakNC) { i = 1; }
@@ -341,11 +618,54 @@ double GiBUURESFormFactor::FormFactors::FFRes (
   if      (hit_nucleon_pdg == kPdgNeutron) { j = 0; }
   else if (hit_nucleon_pdg == kPdgProton ) { j = 1; }
 
-  const Spline * spl = fFFRes[r][i][j][ffresid];
+  if(i < 0 || j < 0) return 0;
 
-  if(!spl) return 0;
-  else {
-   return spl->Evaluate(Q2);
+  return fFFTables[r][i][j];
+}
+//____________________________________________________________________________
+int GiBUURESFormFactor::FormFactors::FindKnot(
+                                const FFTable_t & table, double Q2) const
+{
+// Knot interval n, q2_n < Q2 <= q2_{n+1} (as in Spline::Evaluate), or -1 if
+// Q2 is outside the knot range
+
+  const vector<double> & q2 = table.q2;
+  int nknots = q2.size();
+  if(Q2 < q2[0] || Q2 > q2[nknots-1]) return -1;
+
+  int klow = 0;
+  int khig = nknots - 1;
+  while(khig - klow > 1) {
+    int khalf = (klow + khig) / 2;
+    if(Q2 > q2[khalf]) klow = khalf;
+    else               khig = khalf;
   }
+  return TMath::Min(klow, nknots - 2);
+}
+//____________________________________________________________________________
+double GiBUURESFormFactor::FormFactors::EvaluateInInterval(
+             const FFTable_t & table, int n, int k, double Q2) const
+{
+// Form factor k of the table in the knot interval n. As in Spline, a linear
+// interpolation is used next to a knot where the form factor vanishes.
+
+  const double eps  = 0.001*DBL_EPSILON;
+  const double * cn = &table.coeff[4*( n   *table.nff + k)];
+  const double * cp = &table.coeff[4*((n+1)*table.nff + k)];
+  double yn = cn[0];
+  double yp = cp[0];
+  bool is0n = TMath::Abs(yn) < eps;
+  bool is0p = TMath::Abs(yp) < eps;
+
+  if(!is0p && !is0n) {
+    double dx = Q2 - table.q2[n];
+    return yn + dx*(cn[1] + dx*(cn[2] + dx*cn[3]));
+  }
+  if(is0p && is0n) return 0;
+
+  double xn = table.q2[n];
+  double xp = table.q2[n+1];
+  if(is0n) return yp * (Q2-xn)/(xp-xn);
+  else     return yn * (Q2-xn)/(xp-xn);
 }
 //____________________________________________________________________________
@@ -5,6 +5,10 @@
 
 \brief    Singleton to load and serve data tables provided by the GiBUU group
 
+          The resonance form factor tables are cached in a binary file,
+          GiBUU-FFres.gffbin, rebuilt whenever the text tables change. It is
+          kept in $GGIBUUFFBINDIR, if set, or in the shared data directory.
+
 \ref      http://gibuu.physik.uni-giessen.de/GiBUU
           Specific references for each piece of data included in given below.
 
@@ -19,12 +23,16 @@
 #ifndef _GIBUU_RES_FORM_FACTOR_H_
 #define _GIBUU_RES_FORM_FACTOR_H_
 
+#include <string>
+#include <vector>
+
 #include "Framework/ParticleData/BaryonResonance.h"
 #include "Framework/Interaction/InteractionType.h"
 
-namespace genie {
+using std::string;
+using std::vector;
 
-class Spline;
+namespace genie {
 
 class GiBUURESFormFactor
 {
@@ -49,6 +57,8 @@ public:
      FormFactors();
     ~FormFactors();
 
+     static const int kNFFRes  = 12; ///< # of form factors (see below)
+
      // the following is non-zero for I=1/2 (N) resonances
      double C3V (double Q2, Resonance_t res, int nucleon_pdg, InteractionType_t it) const;
      double C4V (double Q2, Resonance_t res, int nucleon_pdg, InteractionType_t it) const; 
@@ -65,6 +75,10 @@ public:
      double FA  (double Q2, Resonance_t res, int nucleon_pdg, InteractionType_t it) const;  
      double FP  (double Q2, Resonance_t res, int nucleon_pdg, InteractionType_t it) const; 
 
+     //! all the form factors at once, in ff[kNFFRes], in the order:
+     //! F1V,F2V,FA,FP,C3V,C4V,C5V,C6V,C3A,C4A,C5A,C6A (0 where not given)
+     void   All (double Q2, Resonance_t res, int nucleon_pdg, InteractionType_t it, double * ff) const;
+
      double Q2min (void) const { return fMinQ2; }
      double Q2max (void) const { return fMaxQ2; }
 
@@ -90,7 +104,7 @@ public:
      //   P31(1910) ->  kP31_1910           12
      //   F35(1905) ->  kF35_1905           14
      //   F37(1950) ->  kF37_1950           15
-     // The remaining 3 array indices are:
+     // The remaining 2 table indices, and the form factor index, are:
      //     0  1  2  0 1    0   1  2  3   4   5   6   7   8   9  10  11
      //   [CC,NC,EM][n,p][F1V,F2V,FA,FP,C3V,C4V,C5V,C6V,C3A,C4A,C5A,C6A]
      //                  |-------------|                                  for I=1/2 resonances
@@ -99,16 +113,31 @@ public:
      static const int kNRes    = 18;
      static const int kNCurr   =  3;
      static const int kNHitNuc =  2;
-     static const int kNFFRes  = 12;
+
+     //! form factors given for a (resonance, current, nucleon), as cubic
+     //! splines on a common Q2 grid, with the form factors of each knot
+     //! interleaved so that all of them are evaluated with one knot search
+     struct FFTable_t {
+       int            ffirst; ///< index of the first form factor given
+       int            nff;    ///< # of form factors given (4 or 8)
+       vector<double> q2;     ///< Q2 knots
+       vector<double> coeff;  ///< polynomial coefficients (y,b,c,d) at [knot][form factor]
+     };
 
      //! actual form factor data = f(Q2)
-     Spline * fFFRes [kNRes][kNCurr][kNHitNuc][kNFFRes];   
+     FFTable_t * fFFTables [kNRes][kNCurr][kNHitNuc];
 
      //! func to retrieve interpolated form factor values
      double FFRes (double Q2, Resonance_t res, int nucleon_pdg, InteractionType_t it, int ffid) const;
+     const FFTable_t * Table (Resonance_t res, int nucleon_pdg, InteractionType_t it) const;
+     int    FindKnot (const FFTable_t & table, double Q2) const;
+     double EvaluateInInterval (const FFTable_t & table, int k, int iff, double Q2) const;
 
      //! load all form factor data tables
      void LoadTables(void); 
+     void LoadTextTables (const string & data_dir);
+     bool LoadBinaryTables (const string & filename, unsigned long long fingerprint);
+     bool SaveBinaryTables (const string & filename, unsigned long long fingerprint) const;
 
      friend class GiBUURESFormFactor;
 
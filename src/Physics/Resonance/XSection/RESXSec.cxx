@@ -28,6 +28,7 @@
 #include "Framework/ParticleData/PDGUtils.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/Resonance/XSection/RESXSec.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
@@ -56,6 +57,7 @@ RESXSec::~RESXSec()
 double RESXSec::Integrate(
                  const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(in) ) return 0.;
 
   const KPhaseSpace & kps = in->PhaseSpace();
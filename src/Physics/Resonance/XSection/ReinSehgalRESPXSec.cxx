@@ -21,6 +21,10 @@
    Pick nutau/nutaubar scaling factors from new location.
  @ May 01, 2016 - Libo Jiang
    Add W dependence to Delta->N gamma
+ @ Oct 14, 2026 - CA
+   Split XSec() into resonance-independent kinematical factors and the
+   resonance contribution. Added ResonanceXSecs(), computing the cross
+   sections of a list of resonances at the same kinematics in one call.
 
 */
 //____________________________________________________________________________
@@ -31,6 +35,7 @@
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
+#include "Framework/ParticleData/BaryonResList.h"
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Constants.h"
 #include "Framework/Conventions/RefFrame.h"
@@ -79,8 +84,58 @@ ReinSehgalRESPXSec::~ReinSehgalRESPXSec()
 double ReinSehgalRESPXSec::XSec(
                  const Interaction * interaction, KinePhaseSpace_t kps) const
 {
-  if(! this -> ValidProcess    (interaction) ) return 0.;
-  if(! this -> ValidKinematics (interaction) ) return 0.;
+  KineFactors_t kf;
+  if(! this->KineFactors(interaction, kps, kf) ) return 0.;
+
+  // Get the input baryon resonance
+  Resonance_t resonance = interaction->ExclTag().Resonance();
+
+  double xsec = this->ResonanceXSec(resonance, kf);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("ReinSehgalRes", pINFO) 
+    << "\n d2xsec/dQ2dW"  << "[" << interaction->AsString()
+          << "](W=" << kf.W << ", q2=" << kf.q2 << ", E=" << kf.E << ") = " << xsec;
+#endif
+
+  return xsec;
+}
+//____________________________________________________________________________
+void ReinSehgalRESPXSec::ResonanceXSecs(
+   const Interaction * interaction, KinePhaseSpace_t kps,
+   const BaryonResList & reslist, vector<double> & xsec) const
+{
+// Compute the kinematical factors common to all resonances once, then the
+// contribution of each resonance
+
+  unsigned int nres = reslist.NResonances();
+  xsec.assign(nres, 0.);
+  if(nres == 0) return;
+
+  // the process check needs a known resonance
+  Resonance_t res0 = interaction->ExclTag().Resonance();
+  interaction->ExclTagPtr()->SetResonance(reslist.ResonanceId(0));
+
+  KineFactors_t kf;
+  bool ok = this->KineFactors(interaction, kps, kf);
+
+  interaction->ExclTagPtr()->SetResonance(res0);
+
+  if(!ok) return;
+
+  for(unsigned int ires = 0; ires < nres; ires++) {
+    xsec[ires] = this->ResonanceXSec(reslist.ResonanceId(ires), kf);
+  }
+}
+//____________________________________________________________________________
+bool ReinSehgalRESPXSec::KineFactors(
+  const Interaction * interaction, KinePhaseSpace_t kps, KineFactors_t & kf) const
+{
+// Compute the factors that do not depend on the baryon resonance.
+// Returns false if the cross section vanishes for all resonances.
+
+  if(! this -> ValidProcess    (interaction) ) return false;
+  if(! this -> ValidKinematics (interaction) ) return false;
 
   const InitialState & init_state = interaction -> InitState();
   const ProcessInfo &  proc_info  = interaction -> ProcInfo();
@@ -99,15 +154,10 @@ double ReinSehgalRESPXSec::XSec(
          << "RES/DIS Join Scheme: XSec[RES, W=" << W 
          << " >= Wcut=" << fWcut << "] = 0";
 #endif
-       return 0;
+       return false;
     }
   }
 
-  // Get the input baryon resonance
-  Resonance_t resonance = interaction->ExclTag().Resonance();
-  string      resname   = utils::res::AsString(resonance);
-  bool        is_delta  = utils::res::IsDelta (resonance);
-
   // Get the neutrino, hit nucleon & weak current
   int  nucpdgc   = target.HitNucPdg();
   int  probepdgc = init_state.ProbePdg();
@@ -121,26 +171,6 @@ double ReinSehgalRESPXSec::XSec(
   bool is_NC     = proc_info.IsWeakNC();
   bool is_EM     = proc_info.IsEM();
 
-  if(is_CC && !is_delta) {
-    if((is_nu && is_p) || (is_nubar && is_n)) return 0;
-  }
-
-  // Get baryon resonance parameters
-  int    IR  = utils::res::ResonanceIndex    (resonance);
-  int    LR  = utils::res::OrbitalAngularMom (resonance);
-  double MR  = utils::res::Mass              (resonance);
-  double WR  = utils::res::Width             (resonance);
-  double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
-
-  // Following NeuGEN, avoid problems with underlying unphysical
-  // model assumptions by restricting the allowed W phase space
-  // around the resonance peak
-  if (fNormBW) {
-	if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return 0.;
-	else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return 0.;
-	else if (W > MR + fGnResMaxNWidths * WR)          return 0.;
-  }
-
   // Compute auxiliary & kinematical factors 
   double E      = init_state.ProbeE(kRfHitNucRest);
   double Mnuc   = target.HitNucMass(); 
@@ -163,42 +193,7 @@ double ReinSehgalRESPXSec::XSec(
      << "Kinematical params V = " << V << ", U = " << U;
 #endif
 
-  // Calculate the Feynman-Kislinger-Ravndall parameters
-
-  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
-  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
-  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
-
-  if(is_EM) { 
-    GA = 0.; // zero the axial term for EM scattering
-  }
-
-  double d      = TMath::Power(W+Mnuc,2.) - q2;
-  double sq2omg = TMath::Sqrt(2./fOmega);
-  double nomg   = IR * fOmega;
-  double mq_w   = Mnuc*Q/W;
-
-  fFKR.Lamda  = sq2omg * mq_w;
-  fFKR.Tv     = GV / (3.*W*sq2omg);
-  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
-  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
-  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
-  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
-  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
-  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
-  fFKR.R      = fFKR.Rv;
-  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
-  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
-  fFKR.T      = fFKR.Tv;
-  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
-  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("FKR", pDEBUG) 
-     << "FKR params for RES = " << resname << " : " << fFKR;
-#endif
-
-  // Calculate the Rein-Sehgal Helicity Amplitudes
+  // Select the Rein-Sehgal helicity amplitude model
 
   const RSHelicityAmplModelI * hamplmod = 0;
   if(is_CC) { 
@@ -215,13 +210,6 @@ double ReinSehgalRESPXSec::XSec(
     else      { hamplmod = fHAmplModelEMn;}
   }
   assert(hamplmod);
-  
-  const RSHelicityAmpl & hampl = hamplmod->Compute(resonance, fFKR); 
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("RSHAmpl", pDEBUG)
-     << "Helicity Amplitudes for RES = " << resname << " : " << hampl;
-#endif
 
   double g2 = kGF2;
   if(is_CC) g2 = kGF2*fVud2;
@@ -240,55 +228,31 @@ double ReinSehgalRESPXSec::XSec(
     g2 = kAem2 * kPi2 / (2.0 * fSin48w * q4); 
   }
 
-  // Compute the cross section
-
-  double sig0 = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
-  double scLR = W/Mnuc;
-  double scS  = (Mnuc/W)*(-Q2/q2);
-  double sigL = scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
-  double sigR = scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
-  double sigS = scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("ReinSehgalRes", pDEBUG) << "sig_{0} = " << sig0;
-  LOG("ReinSehgalRes", pDEBUG) << "sig_{L} = " << sigL;
-  LOG("ReinSehgalRes", pDEBUG) << "sig_{R} = " << sigR;
-  LOG("ReinSehgalRes", pDEBUG) << "sig_{S} = " << sigS;
-#endif
-
-  double xsec = 0.0;
+  kf.hamplmod = hamplmod;
+  kf.W        = W;
+  kf.q2       = q2;
+  kf.E        = E;
+  kf.Mnuc     = Mnuc;
+  kf.Q2       = Q2;
+  kf.is_EM    = is_EM;
+  kf.is_CC    = is_CC;
+  kf.nu_p     = (is_nu && is_p) || (is_nubar && is_n);
+  // the L, R & S cross section weights
   if (is_nu || is_lminus) {
-     xsec = sig0*(V2*sigR + U2*sigL + 2*UV*sigS);
+     kf.wL = U2;  kf.wR = V2;  kf.wS = 2*UV;
   } 
   else 
   if (is_nubar || is_lplus) {
-     xsec = sig0*(U2*sigR + V2*sigL + 2*UV*sigS);
+     kf.wL = V2;  kf.wR = U2;  kf.wS = 2*UV;
   } 
-  xsec = TMath::Max(0.,xsec);
-
-  double mult = 1.0;
-  if(is_CC && is_delta) {
-    if((is_nu && is_p) || (is_nubar && is_n)) mult=3.0;
+  else {
+     kf.wL = 0.;  kf.wR = 0.;  kf.wS = 0.;
   }
-  xsec *= mult;
+  kf.sig0     = 0.125*(g2/kPi)*(-q2/Q2)*(W/Mnuc);
+  kf.scLR     = W/Mnuc;
+  kf.scS      = (Mnuc/W)*(-Q2/q2);
 
-  // Check whether the cross section is to be weighted with a
-  // Breit-Wigner distribution (default: true)
-  double bw = 1.0;
-  if(fWghtBW) {
-     //different Delta photon decay branch
-     if(is_delta){
-     bw = utils::bwfunc::BreitWignerLGamma(W,LR,MR,WR,NR); 
-     }
-     else{
-     bw = utils::bwfunc::BreitWignerL(W,LR,MR,WR,NR); 
-     }
-  } 
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-     LOG("ReinSehgalRes", pDEBUG) 
-       << "BreitWigner(RES=" << resname << ", W=" << W << ") = " << bw;
-#endif
-  xsec *= bw; 
+  double scale = 1.;
 
   // Apply NeuGEN nutau cross section reduction factors
   double rf = 1.0;
@@ -301,31 +265,26 @@ double ReinSehgalRESPXSec::XSec(
       if(E <spl->XMax()) rf = spl->Evaluate(E);
     }
   }
-  xsec *= rf;
+  scale *= rf;
 
   // Apply given scaling factor
   double xsec_scale = 1.;
   if      (is_CC) { xsec_scale = fXSecScaleCC; }
   else if (is_NC) { xsec_scale = fXSecScaleNC; }
-  xsec *= xsec_scale;
-
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-  LOG("ReinSehgalRes", pINFO) 
-    << "\n d2xsec/dQ2dW"  << "[" << interaction->AsString()
-          << "](W=" << W << ", q2=" << q2 << ", E=" << E << ") = " << xsec;
-#endif
+  scale *= xsec_scale;
 
   // The algorithm computes d^2xsec/dWdQ2
   // Check whether variable tranformation is needed
   if(kps!=kPSWQ2fE) {
     double J = utils::kinematics::Jacobian(interaction,kPSWQ2fE,kps);
-    xsec *= J;
+    scale *= J;
   }
 
+  kf.scale = scale;
+
   // If requested return the free nucleon xsec even for input nuclear tgt
-  if( interaction->TestBit(kIAssumeFreeNucleon) ) return xsec;
+  if( interaction->TestBit(kIAssumeFreeNucleon) ) return true;
 
-  
   int Z = target.Z();
   int A = target.A();
   int N = A-Z;
@@ -333,7 +292,7 @@ double ReinSehgalRESPXSec::XSec(
   // Take into account the number of scattering centers in the target
   int NNucl = (is_p) ? Z : N;
 
-  xsec*=NNucl; // nuclear xsec (no nuclear suppression factor) 
+  scale*=NNucl; // nuclear xsec (no nuclear suppression factor) 
   
   if (fUsePauliBlocking && A!=1)
   {
@@ -388,9 +347,138 @@ double ReinSehgalRESPXSec::XSec(
      if (2*P_Fermi >= k-q && 2*P_Fermi <= k+q)
         FactorPauli_RES = ((q+k)*(q+k)-4*P_Fermi*P_Fermi/5-TMath::Power(k-q, 3)/(2*P_Fermi)+TMath::Power(k-q, 5)/(40*TMath::Power(P_Fermi, 3)))/(4*q*k);
      
-     xsec *= FactorPauli_RES;
+     scale *= FactorPauli_RES;
   }
-  
+
+  kf.scale = scale;
+
+  return true;
+}
+//____________________________________________________________________________
+double ReinSehgalRESPXSec::ResonanceXSec(
+  Resonance_t resonance, const KineFactors_t & kf) const
+{
+// Compute the contribution of the input resonance, given the kinematical
+// factors computed by KineFactors()
+
+  string resname  = utils::res::AsString(resonance);
+  bool   is_delta = utils::res::IsDelta (resonance);
+
+  if(kf.is_CC && !is_delta && kf.nu_p) return 0;
+
+  // Get baryon resonance parameters
+  int    IR  = utils::res::ResonanceIndex    (resonance);
+  int    LR  = utils::res::OrbitalAngularMom (resonance);
+  double MR  = utils::res::Mass              (resonance);
+  double WR  = utils::res::Width             (resonance);
+  double NR  = fNormBW?utils::res::BWNorm    (resonance,fN0ResMaxNWidths,fN2ResMaxNWidths,fGnResMaxNWidths):1;
+
+  double W     = kf.W;
+  double q2    = kf.q2;
+  double Mnuc  = kf.Mnuc;
+
+  // Following NeuGEN, avoid problems with underlying unphysical
+  // model assumptions by restricting the allowed W phase space
+  // around the resonance peak
+  if (fNormBW) {
+	if      (W > MR + fN0ResMaxNWidths * WR && IR==0) return 0.;
+	else if (W > MR + fN2ResMaxNWidths * WR && IR==2) return 0.;
+	else if (W > MR + fGnResMaxNWidths * WR)          return 0.;
+  }
+
+  double W2     = TMath::Power(W,    2);
+  double Mnuc2  = TMath::Power(Mnuc, 2);
+  double Q2     = kf.Q2;
+  double Q      = TMath::Sqrt(Q2);
+
+  // Calculate the Feynman-Kislinger-Ravndall parameters
+
+  double Go  = TMath::Power(1 - 0.25 * q2/Mnuc2, 0.5-IR);
+  double GV  = Go * TMath::Power( 1./(1-q2/fMv2), 2);
+  double GA  = Go * TMath::Power( 1./(1-q2/fMa2), 2);
+
+  if(kf.is_EM) { 
+    GA = 0.; // zero the axial term for EM scattering
+  }
+
+  double d      = TMath::Power(W+Mnuc,2.) - q2;
+  double sq2omg = TMath::Sqrt(2./fOmega);
+  double nomg   = IR * fOmega;
+  double mq_w   = Mnuc*Q/W;
+
+  fFKR.Lamda  = sq2omg * mq_w;
+  fFKR.Tv     = GV / (3.*W*sq2omg);
+  fFKR.Rv     = kSqrt2 * mq_w*(W+Mnuc)*GV / d;
+  fFKR.S      = (-q2/Q2) * (3*W*Mnuc + q2 - Mnuc2) * GV / (6*Mnuc2);
+  fFKR.Ta     = (2./3.) * (fZeta/sq2omg) * mq_w * GA / d;
+  fFKR.Ra     = (kSqrt2/6.) * fZeta * (GA/W) * (W+Mnuc + 2*nomg*W/d );
+  fFKR.B      = fZeta/(3.*W*sq2omg) * (1 + (W2-Mnuc2+q2)/ d) * GA;
+  fFKR.C      = fZeta/(6.*Q) * (W2 - Mnuc2 + nomg*(W2-Mnuc2+q2)/d) * (GA/Mnuc);
+  fFKR.R      = fFKR.Rv;
+  fFKR.Rplus  = - (fFKR.Rv + fFKR.Ra);
+  fFKR.Rminus = - (fFKR.Rv - fFKR.Ra);
+  fFKR.T      = fFKR.Tv;
+  fFKR.Tplus  = - (fFKR.Tv + fFKR.Ta);
+  fFKR.Tminus = - (fFKR.Tv - fFKR.Ta);
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("FKR", pDEBUG) 
+     << "FKR params for RES = " << resname << " : " << fFKR;
+#endif
+
+  // Calculate the Rein-Sehgal Helicity Amplitudes
+
+  const RSHelicityAmpl & hampl = kf.hamplmod->Compute(resonance, fFKR); 
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("RSHAmpl", pDEBUG)
+     << "Helicity Amplitudes for RES = " << resname << " : " << hampl;
+#endif
+
+  // Compute the cross section
+
+  double sigL = kf.scLR* (hampl.Amp2Plus3 () + hampl.Amp2Plus1 ());
+  double sigR = kf.scLR* (hampl.Amp2Minus3() + hampl.Amp2Minus1());
+  double sigS = kf.scS * (hampl.Amp20Plus () + hampl.Amp20Minus());
+
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+  LOG("ReinSehgalRes", pDEBUG) << "sig_{0} = " << kf.sig0;
+  LOG("ReinSehgalRes", pDEBUG) << "sig_{L} = " << sigL;
+  LOG("ReinSehgalRes", pDEBUG) << "sig_{R} = " << sigR;
+  LOG("ReinSehgalRes", pDEBUG) << "sig_{S} = " << sigS;
+#endif
+
+  double xsec = kf.sig0*(kf.wR*sigR + kf.wL*sigL + kf.wS*sigS);
+  xsec = TMath::Max(0.,xsec);
+
+  double mult = 1.0;
+  if(kf.is_CC && is_delta) {
+    if(kf.nu_p) mult=3.0;
+  }
+  xsec *= mult;
+
+  // Check whether the cross section is to be weighted with a
+  // Breit-Wigner distribution (default: true)
+  double bw = 1.0;
+  if(fWghtBW) {
+     //different Delta photon decay branch
+     if(is_delta){
+     bw = utils::bwfunc::BreitWignerLGamma(W,LR,MR,WR,NR); 
+     }
+     else{
+     bw = utils::bwfunc::BreitWignerL(W,LR,MR,WR,NR); 
+     }
+  } 
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+     LOG("ReinSehgalRes", pDEBUG) 
+       << "BreitWigner(RES=" << resname << ", W=" << W << ") = " << bw;
+#endif
+  xsec *= bw; 
+
+  // Apply the resonance-independent factors: scaling, Jacobian, number of
+  // scattering centres & Pauli blocking
+  xsec *= kf.scale;
+
   return xsec;
 }
 //____________________________________________________________________________
@@ -53,6 +53,10 @@ public:
   double Integral     (const Interaction * i) const;
   bool   ValidProcess (const Interaction * i) const;
 
+  // compute the cross section for a list of resonances in a single call
+  void   ResonanceXSecs (const Interaction * i, KinePhaseSpace_t k,
+                         const BaryonResList & reslist, vector<double> & xsec) const;
+
   // overload the Algorithm::Configure() methods to load private data
   // members from configuration options
   void Configure(const Registry & config);
@@ -62,6 +66,20 @@ private:
 
   void LoadConfig (void);
 
+  //! kinematical factors common to all resonances
+  struct KineFactors_t {
+    const RSHelicityAmplModelI * hamplmod; ///< helicity amplitude model
+    double W, q2, E, Mnuc, Q2;
+    bool   is_EM, is_CC;
+    bool   nu_p;              ///< nu+p or nubar+n?
+    double wL, wR, wS;        ///< weights of the L, R & S xsec
+    double sig0, scLR, scS;
+    double scale;             ///< scaling, Jacobian, # of scattering centres & Pauli blocking
+  };
+
+  bool   KineFactors   (const Interaction * i, KinePhaseSpace_t k, KineFactors_t & kf) const;
+  double ResonanceXSec (Resonance_t res, const KineFactors_t & kf) const;
+
   mutable FKR fFKR;
 
   const RSHelicityAmplModelI * fHAmplModelCC;
@@ -38,6 +38,7 @@
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/XSectionIntegration/GSLXSecFunc.h"
 #include "Physics/Resonance/XSection/ReinSehgalRESXSec.h"
@@ -67,6 +68,7 @@ ReinSehgalRESXSec::~ReinSehgalRESXSec()
 double ReinSehgalRESXSec::Integrate(
           const XSecAlgorithmI * model, const Interaction * interaction) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(interaction) ) return 0.;
   fSingleResXSecModel = model;
 
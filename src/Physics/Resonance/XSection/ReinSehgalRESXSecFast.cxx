@@ -36,6 +36,7 @@
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/GSLUtils.h"
 
 using namespace genie;
@@ -63,6 +64,7 @@ ReinSehgalRESXSecFast::~ReinSehgalRESXSecFast()
 double ReinSehgalRESXSecFast::Integrate(
           const XSecAlgorithmI * model, const Interaction * interaction) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(interaction) ) return 0.;
   fSingleResXSecModel = model;
 
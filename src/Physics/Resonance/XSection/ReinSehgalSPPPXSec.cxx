@@ -10,10 +10,15 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   XSecNRES() computes the contributions of all resonances with a single call
+   to XSecAlgorithmI::ResonanceXSecs() of the single resonance xsec model.
 
 */
 //____________________________________________________________________________
 
+#include <vector>
+
 #include "Framework/Algorithm/AlgConfigPool.h"
 #include "Framework/Algorithm/AlgFactory.h"
 #include "Framework/ParticleData/BaryonResUtils.h"
@@ -26,6 +31,8 @@
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 #include "Physics/Resonance/XSection/ReinSehgalSPPPXSec.h"
 
+using std::vector;
+
 using namespace genie;
 using namespace genie::constants;
 
@@ -102,15 +109,18 @@ double ReinSehgalSPPPXSec::XSecNRES(
               << "SPP channel " << SppChannel::AsString(spp_channel);
 #endif
               
+  //-- Compute the Breit-Wigner weighted xsec for exciting each resonance,
+  //   in a single call so that the factors common to all resonances are
+  //   only computed once
+  vector<double> res_xsec;
+  fSingleResXSecModel->ResonanceXSecs(interaction,kps,fResList,res_xsec);
+
   double xsec = 0;
   for(unsigned int ires = 0; ires < nres; ires++) {
 
      //-- Get next resonance from the resonance list
      Resonance_t res = fResList.ResonanceId(ires);
 
-     //-- Set current resonance to interaction object
-     interaction->ExclTagPtr()->SetResonance(res);
-
      //-- Get the BR for the (resonance) -> (exclusive final state)
 	 double br = SppChannel::BranchingRatio(spp_channel, res);
 
@@ -120,7 +130,8 @@ double ReinSehgalSPPPXSec::XSecNRES(
 
 	 //-- Compute the weighted xsec
 	 //  (total weight = Breit-Wigner * BR * isospin Clebsch-Gordon)
-	 double res_xsec_contrib = fSingleResXSecModel->XSec(interaction,kps)*br*igg;
+	 double rxsec = res_xsec[ires];
+	 double res_xsec_contrib = rxsec*br*igg;
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 	 LOG("ReinSehgalSpp", pDEBUG)
      << "Contrib. from [" << utils::res::AsString(res) << "] = "
@@ -26,6 +26,7 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/Cache.h"
 #include "Framework/Utils/CacheBranchFx.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Physics/Resonance/XSection/ReinSehgalSPPXSec.h"
 
 using namespace genie;
@@ -52,6 +53,7 @@ ReinSehgalSPPXSec::~ReinSehgalSPPXSec()
 double ReinSehgalSPPXSec::Integrate(
           const XSecAlgorithmI * model, const Interaction * interaction) const
 {
+  GINSTR_ALG_SCOPE(this);
   if(! model->ValidProcess(interaction) ) return 0.;
 
   const KPhaseSpace & kps = interaction->PhaseSpace();
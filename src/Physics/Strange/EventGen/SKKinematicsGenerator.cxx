@@ -36,6 +36,7 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Physics/Strange/EventGen/SKKinematicsGenerator.h"
+#include "Physics/Strange/XSection/AlamSimoAtharVacasSKPXSec2014.h"
 
 using namespace genie;
 using namespace genie::constants;
@@ -91,6 +92,7 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
   //   If the kinematics are generated uniformly over the allowed phase
   //   space the max xsec is irrelevant
   double xsec_max = (fGenerateUniformly) ? -1 : this->MaxXSec(evrec);
+  if(!fGenerateUniformly && xsec_max <= 0) return; // thread stopped by MaxXSec()
 
   // Determine lepton and kaon masses
   int leppdg = interaction->FSPrimLeptonPdg();
@@ -100,8 +102,8 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
 
   double enu = P4_nu.E(); // in nucleon rest frame
   int kaon_pdgc = interaction->ExclTag().StrangeHadronPdg();
-  double mk = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass();
-  double ml = PDGLibrary::Instance()->Find(leppdg)->Mass();
+  double mk = PDGLibrary::Instance()->Mass(kaon_pdgc);
+  double ml = PDGLibrary::Instance()->Mass(leppdg);
 
   // Maximum possible kinetic energy
   const double Tkmax = enu - mk - ml;
@@ -129,6 +131,14 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
   const double dx = xmax - xmin;
   const double dphikq = phikqmax - phikqmin;
 
+  // The dependence of the cross section on phi_kq is known analytically for
+  // the Alam, Simo, Athar & Vacas model: select (tk, tl, costhetal) from the
+  // phi_kq-averaged cross section, then phi_kq at fixed (tk, tl, costhetal)
+  // without computing the matrix element again
+  const AlamSimoAtharVacasSKPXSec2014 * phikq_model =
+     dynamic_cast<const AlamSimoAtharVacasSKPXSec2014 *> (fXSecModel);
+  bool select_phikq = (!fGenerateUniformly && phikq_model != 0);
+
   //------ Try to select a valid tk, tl, costhetal, phikq quadruplet
 
   unsigned int iter = 0;
@@ -141,6 +151,7 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
 
   while(1) {
      iter++;
+     this->CountTrial();
      if(iter > kRjMaxIterations) {
         LOG("SKKinematics", pWARN)
              << "*** Could not select a valid (tk, tl, costhetal) triplet after "
@@ -163,7 +174,9 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
        tl = Tlmin + dtl * rnd->RndKine().Rndm();
        double x = xmin + dx * rnd->RndKine().Rndm(); // log(1-costheta)
        costhetal = 1.0 - TMath::Exp(x);
-       phikq = phikqmin + dphikq * rnd->RndKine().Rndm();
+       // the max xsec is found at phi_kq = pi
+       if(select_phikq) phikq = kPi;
+       else             phikq = phikqmin + dphikq * rnd->RndKine().Rndm();
      }
 
      LOG("SKKinematics", pDEBUG) << "Trying: Tk = " << tk << ", Tl = " << tl << ", cosThetal = " << costhetal << ", phikq = " << phikq;
@@ -206,6 +219,14 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
         }
 
         accept = (t< J*xsec);
+
+        // The xsec at phi_kq = pi bounds the phi_kq-averaged xsec: only if
+        // the kinematics pass the test above, compute the phi_kq-averaged
+        // xsec and finally accept them with probability (average/max)
+        if(accept && select_phikq) {
+          accept = this->SelectPhiKQ(interaction, phikq_model, xsec, t/J, phikq);
+          interaction->KinePtr()->SetKV(kKVphikq, phikq);
+        }
      }
      else {
         accept = (xsec>0);
@@ -248,6 +269,51 @@ void SKKinematicsGenerator::CalculateKin_AtharSingleKaon(GHepRecord * evrec) con
   }// iterations
 }
 //___________________________________________________________________________
+bool SKKinematicsGenerator::SelectPhiKQ(
+   const Interaction * interaction, const AlamSimoAtharVacasSKPXSec2014 * model,
+   double & xsec, double t, double & phikq) const
+{
+// Given the xsec at phi_kq = pi and the (xsec units) random number t of the
+// rejection test, accept the current (tk, tl, costhetal) with probability
+// (phi_kq-averaged xsec)/(xsec at phi_kq = pi) and select phi_kq.
+// The xsec is A + B*cos(phi_kq) + C*cos^2(phi_kq) and averages to A + C/2.
+
+  double A = 0, B = 0, C = 0;
+  if(!model->PhiKQCoefficients(interaction, A, B, C)) return false;
+
+  double xsec_avg = A + 0.5*C;
+  if(t >= xsec_avg) return false;
+
+  // max xsec over phi_kq
+  double xsec_max = TMath::Max(A + B + C, A - B + C);
+  if(C < 0. && TMath::Abs(B) < -2.*C) {
+    xsec_max = TMath::Max(xsec_max, A - 0.25*B*B/C);
+  }
+  if(xsec_max > xsec * (1. + 1E-6)) {
+    LOG("SKKinematics", pWARN)
+       << "Max xsec over phi_kq = " << xsec_max << " exceeds the xsec at phi_kq = pi = " << xsec;
+  }
+  if(xsec_max <= 0.) return false;
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  unsigned int iter = 0;
+  while(1) {
+     iter++;
+     this->CountTrial();
+     if(iter > kRjMaxIterations) {
+        LOG("SKKinematics", pWARN)
+             << "*** Could not select phi_kq after " << iter << " iterations";
+        return false;
+     }
+     phikq = 2.0 * kPi * rnd->RndKine().Rndm();
+     double cphi = TMath::Cos(phikq);
+     xsec = A + (B + C*cphi)*cphi;
+     if(xsec_max * rnd->RndKine().Rndm() < xsec) return true;
+  }
+  return false;
+}
+//___________________________________________________________________________
 double SKKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
 {
 // Computes the maximum differential cross section in the requested phase
@@ -273,8 +339,8 @@ double SKKinematicsGenerator::ComputeMaxXSec(const Interaction * in) const
   int leppdg = in->FSPrimLeptonPdg();
   double enu = in->InitState().ProbeE(kRfHitNucRest); // Enu in nucleon rest frame
   int kaon_pdgc = in->ExclTag().StrangeHadronPdg();
-  double mk = PDGLibrary::Instance()->Find(kaon_pdgc)->Mass();
-  double ml = PDGLibrary::Instance()->Find(leppdg)->Mass();
+  double mk = PDGLibrary::Instance()->Mass(kaon_pdgc);
+  double ml = PDGLibrary::Instance()->Mass(leppdg);
 
   const double Tkmax = enu - mk - ml;
   const double Tlmax = enu - mk - ml;
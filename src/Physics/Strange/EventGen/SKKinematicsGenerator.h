@@ -26,6 +26,8 @@
 
 namespace genie {
 
+class AlamSimoAtharVacasSKPXSec2014;
+
 class SKKinematicsGenerator : public KineGeneratorWithCache {
 
 public :
@@ -50,6 +52,11 @@ public:
 
   double ComputeMaxXSec (const Interaction * in) const;
 
+  // Accept the current (tk, tl, costhetal) and select phi_kq, using the
+  // analytical dependence of the xsec on phi_kq
+  bool SelectPhiKQ (const Interaction * in, const AlamSimoAtharVacasSKPXSec2014 * model,
+                    double & xsec, double t, double & phikq) const;
+
   // Overload KineGeneratorWithCache method to get energy
   double Energy (const Interaction * in) const;
 
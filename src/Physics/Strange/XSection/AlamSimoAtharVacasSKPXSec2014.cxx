@@ -52,6 +52,59 @@ AlamSimoAtharVacasSKPXSec2014::~AlamSimoAtharVacasSKPXSec2014()
 double AlamSimoAtharVacasSKPXSec2014::XSec(
               const Interaction * interaction, KinePhaseSpace_t /*kps*/) const
 {
+  double theta = 0.;
+  double factor = this->KinematicFactor(interaction, theta);
+  if(factor == 0.) return 0.;
+
+  double phikq = interaction->Kine().GetKV(kKVphikq);
+
+  return factor * this->Amatrix(theta, phikq);
+}
+//____________________________________________________________________________
+bool AlamSimoAtharVacasSKPXSec2014::PhiKQCoefficients(
+  const Interaction * interaction, double & A, double & B, double & C) const
+{
+// The kaon azimuthal angle around q only enters the matrix element through
+// the products of the kaon momentum with the neutrino and lepton momenta,
+// that are linear in cos(phi_kq): the matrix element is a quadratic
+// polynomial in cos(phi_kq). Get its coefficients from the matrix element
+// at phi_kq = 0, pi/2 and pi.
+
+  A = 0.;
+  B = 0.;
+  C = 0.;
+
+  double theta = 0.;
+  double factor = this->KinematicFactor(interaction, theta);
+  if(factor == 0.) return false;
+
+  double amat2_0   = this->Amatrix(theta, 0.);
+  double amat2_90  = this->Amatrix(theta, 0.5*kPi);
+  double amat2_180 = this->Amatrix(theta, kPi);
+
+  A = factor * amat2_90;
+  B = factor * 0.5 * (amat2_0 - amat2_180);
+  C = factor * (0.5 * (amat2_0 + amat2_180) - amat2_90);
+
+  return true;
+}
+//____________________________________________________________________________
+double AlamSimoAtharVacasSKPXSec2014::Amatrix(double theta, double phikq) const
+{
+  if      (reactionType == 1) return this->Amatrix_NN(theta, phikq);
+  else if (reactionType == 2) return this->Amatrix_NP(theta, phikq);
+  else if (reactionType == 3) return this->Amatrix_PP(theta, phikq);
+
+  return 0.;
+}
+//____________________________________________________________________________
+double AlamSimoAtharVacasSKPXSec2014::KinematicFactor(
+              const Interaction * interaction, double & theta) const
+{
+// Sets the (mutable) variables used in the matrix element calculation for
+// the kinematics of the input interaction and returns the factor multiplying
+// the matrix element in the cross section - or 0 if the cross section vanishes
+
   // Check whether interaction is valid
   if(! this -> ValidProcess    (interaction) ) return 0.;
   if(! this -> ValidKinematics (interaction) ) return 0.;
@@ -88,29 +141,28 @@ double AlamSimoAtharVacasSKPXSec2014::XSec(
   double Tlep = kinematics.GetKV(kKVTl);
   double Tkaon = kinematics.GetKV(kKVTk);
   double costheta = kinematics.GetKV(kKVctl);
-  double phikq = kinematics.GetKV(kKVphikq);
 
   // Set lepton mass
-  aml = PDGLibrary::Instance()->Find(leptonPDG)->Mass(); // mutable
+  aml = PDGLibrary::Instance()->Mass(leptonPDG); // mutable
 
-  double theta = TMath::ACos(costheta);
+  theta = TMath::ACos(costheta);
   
   // Set reaction parameters, which are mutables used in the matrix element calculations
   if (reactionType == 1) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigmaM)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgKP)->Mass();
+    amSig = PDGLibrary::Instance()->Mass(kPdgSigmaM);
+    amk   = PDGLibrary::Instance()->Mass(kPdgKP);
     ampi  = kPi0Mass;
     am    = kNeutronMass;
   }
   else if (reactionType == 2) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigma0)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgK0)->Mass();
+    amSig = PDGLibrary::Instance()->Mass(kPdgSigma0);
+    amk   = PDGLibrary::Instance()->Mass(kPdgK0);
     ampi  = kPionMass;
     am    = kNeutronMass;
   }
   else if (reactionType == 3) {
-    amSig = PDGLibrary::Instance()->Find(kPdgSigma0)->Mass();
-    amk   = PDGLibrary::Instance()->Find(kPdgKP)->Mass();
+    amSig = PDGLibrary::Instance()->Mass(kPdgSigma0);
+    amk   = PDGLibrary::Instance()->Mass(kPdgKP);
     ampi  = kPi0Mass;
     am    = kProtonMass;
   }
@@ -126,8 +178,6 @@ double AlamSimoAtharVacasSKPXSec2014::XSec(
   Ekaon = Tkaon+amk; // mutable
   pkvec = sqrt(Ekaon*Ekaon-amk*amk); // mutable
   
-  double xsec = 0.;
-  
   Elep = Tlep + aml; // mutable
   alepvec = sqrt(Elep*Elep - aml*aml); // mutable
   aq0 = Enu-Elep; // mutable
@@ -140,30 +190,23 @@ double AlamSimoAtharVacasSKPXSec2014::XSec(
   // if it is larger than 1, the kinematics are non-physical so we should return zero
   double check = (aqvec*aqvec+pkvec*pkvec+am*am-a1*a1)/(2.0*aqvec*pkvec);
   
-  double amat2; // the matrix element
-  if (fabs(check) <= 1.0) { // so it has to be smaller than 1, but it could be negative if the kaon backscatters in com frame
-    angkq = check;
-    if      (reactionType == 1) amat2 = this->Amatrix_NN(theta, phikq);
-    else if (reactionType == 2) amat2 = this->Amatrix_NP(theta, phikq);
-    else if (reactionType == 3) amat2 = this->Amatrix_PP(theta, phikq);
-    else    return 0.;
-    xsec = alepvec*alepvec*amat2/(32.0*pow(2.0*kPi,4)*am*Enu*Elep*aqvec); 
-  }
-  else {
-    xsec = 0.;
-  }
+  if (fabs(check) > 1.0) return 0.; // so it has to be smaller than 1, but it could be negative if the kaon backscatters in com frame
+  angkq = check;
+
+  // xsec = factor * matrix element
+  double factor = alepvec*alepvec/(32.0*pow(2.0*kPi,4)*am*Enu*Elep*aqvec);
 
   // the matrix element calculation is for d4sigma/dtk dpl dcosthetal dphi_kq
   // we have T_l instead of p_l so we multiply by dp/dT = E/p
-  xsec *= Elep / alepvec;
+  factor *= Elep / alepvec;
   
   // xsec is now the nucleon-level cross section
   // There are no fancy nuclear effects for this model, so the nucleus cross section is just 
   // the nucleon XS times the number of nucleons of the appropriate isospin for the process selected
-  if( reactionType == 1 || reactionType == 2 ) xsec *= nTargetNeutrons; // NN or NP
-  else xsec *= nTargetProtons; // PP
+  if( reactionType == 1 || reactionType == 2 ) factor *= nTargetNeutrons; // NN or NP
+  else factor *= nTargetProtons; // PP
 
-  return xsec;
+  return factor;
 }
 //____________________________________________________________________________
 double AlamSimoAtharVacasSKPXSec2014::Integral(const Interaction * interaction) const
@@ -200,9 +243,9 @@ void AlamSimoAtharVacasSKPXSec2014::LoadConfig(void)
       dynamic_cast<const XSecIntegratorI *> (this->SubAlg("XSec-Integrator"));
   assert(fXSecIntegrator);
   
-  amLam = PDGLibrary::Instance()->Find(kPdgLambda)->Mass();
+  amLam = PDGLibrary::Instance()->Mass(kPdgLambda);
   am = kNeutronMass; // this will be nucleon mass, set event by event
-  amEta = PDGLibrary::Instance()->Find(kPdgEta)->Mass();
+  amEta = PDGLibrary::Instance()->Mass(kPdgEta);
 
   GetParam( "CKM-Vus", Vus ) ;
   // fpi is 0.0924 in Athar's code, use the same one that is already in UserPhysicsOptions
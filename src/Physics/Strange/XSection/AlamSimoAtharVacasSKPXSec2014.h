@@ -40,6 +40,11 @@ public:
   double Integral        (const Interaction * i) const;
   bool   ValidProcess    (const Interaction * i) const;
 
+  // The cross section at the kinematics of the input interaction, as a
+  // function of phi_kq, is A + B*cos(phi_kq) + C*cos^2(phi_kq).
+  // Returns false if the cross section vanishes for all phi_kq.
+  bool   PhiKQCoefficients (const Interaction * i, double & A, double & B, double & C) const;
+
   // Override the Algorithm::Configure methods to load configuration
   // data to private data members
   void Configure (const Registry & config);
@@ -51,7 +56,11 @@ private:
 
   const XSecIntegratorI * fXSecIntegrator;  ///< cross section integrator
   
+  // Set the kinematics and return the factor multiplying the matrix element
+  double KinematicFactor(const Interaction * i, double & theta) const;
+
   // Calculate matrix elements
+  double Amatrix   (double theta, double phikq) const;
   double Amatrix_NN(double theta, double phikq) const;
   double Amatrix_NP(double theta, double phikq) const;
   double Amatrix_PP(double theta, double phikq) const;
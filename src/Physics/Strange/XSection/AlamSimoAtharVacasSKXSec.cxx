@@ -31,6 +31,7 @@
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Utils/Range1.h"
 #include "Framework/Utils/XSecSplineList.h"
+#include "Framework/Utils/ScopeProfiler.h"
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Numerical/GSLUtils.h"
 #include "Physics/Strange/XSection/AlamSimoAtharVacasSKXSec.h"
@@ -61,6 +62,7 @@ AlamSimoAtharVacasSKXSec::~AlamSimoAtharVacasSKXSec()
 double AlamSimoAtharVacasSKXSec::Integrate(
       const XSecAlgorithmI * model, const Interaction * in) const
 {
+  GINSTR_ALG_SCOPE(this);
   LOG("SKXSec", pDEBUG) << "Integrating the Alam Simo Athar Vacas model";
 
   const InitialState & init_state = in -> InitState();
@@ -109,8 +111,8 @@ double AlamSimoAtharVacasSKXSec::Integrate(
   // Check this
   double Enu = init_state.ProbeE(kRfLab);
   int kpdg = in->ExclTag().StrangeHadronPdg();
-  double mk   = PDGLibrary::Instance()->Find(kpdg)->Mass();
-  double ml   = PDGLibrary::Instance()->Find(in->FSPrimLeptonPdg())->Mass();
+  double mk   = PDGLibrary::Instance()->Mass(kpdg);
+  double ml   = PDGLibrary::Instance()->Mass(in->FSPrimLeptonPdg());
 
   // integration bounds for T (kinetic energy)
   double zero    = 0.0;
@@ -132,13 +134,8 @@ double AlamSimoAtharVacasSKXSec::Integrate(
   double kine_min[3] = { zero, zero, -20 }; // Tlep, Tkaon, cosine theta lep
   double kine_max[3] = { tmax, tmax,  0.69314718056 }; // Tlep, Tkaon, cosine theta lep
 
-  ROOT::Math::IntegrationMultiDim::Type ig_type =
-    utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
-
   double abstol = 1; //We mostly care about relative tolerance.
-  ROOT::Math::IntegratorMultiDim ig(*func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
-
-  xsec = ig.Integral(kine_min, kine_max) * (1E-38 * units::cm2);
+  xsec = this->IntegrateNDim(*func, kine_min, kine_max, abstol) * (1E-38 * units::cm2);
   delete func;
 
   delete interaction;
@@ -164,6 +161,7 @@ void AlamSimoAtharVacasSKXSec::LoadConfig(void)
   this->GetParamDef("gsl-integration-type" ,  fGSLIntgType,   string("vegas") );
   this->GetParamDef("gsl-max-evals",          fGSLMaxEval,    20000);
   this->GetParamDef("gsl-relative-tolerance", fGSLRelTol,     0.01);
+  this->BindParamDef(fGSLNWorkers, "gsl-integration-workers", 0);
   this->GetParamDef("split-integral",         fSplitIntegral, true);
 }
 //____________________________________________________________________________
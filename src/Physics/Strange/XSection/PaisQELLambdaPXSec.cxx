@@ -144,7 +144,7 @@ double PaisQELLambdaPXSec::MHyperon(const Interaction * interaction) const
   const XclsTag & xcls = interaction->ExclTag();
 
   int pdgc  = xcls.StrangeHadronPdg();
-  double MR = PDGLibrary::Instance()->Find(pdgc)->Mass();
+  double MR = PDGLibrary::Instance()->Mass(pdgc);
   return MR;
 }
 //____________________________________________________________________________
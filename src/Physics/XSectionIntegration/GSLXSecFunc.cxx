@@ -28,9 +28,98 @@
 #include "Framework/Numerical/MathUtils.h"
 #include "Framework/Utils/KineUtils.h"
 #include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Utils/ScopeProfiler.h"
 
 using namespace genie;
 
+namespace {
+  const unsigned int kNBatchChecks  = 3;    // points of the first batch checked
+  const double       kBatchCheckTol = 1E-6; // relative tolerance of the check
+}
+//____________________________________________________________________________
+genie::utils::gsl::XSecFuncMultiDim::XSecFuncMultiDim() :
+genie::BatchFunctionMultiDimI(),
+fOwnedInteraction(0),
+fBatchStatus(0)
+{
+
+}
+genie::utils::gsl::XSecFuncMultiDim::~XSecFuncMultiDim()
+{
+  delete fOwnedInteraction;
+  for(unsigned int i = 0; i < fBatchInteractions.size(); i++) {
+    delete fBatchInteractions[i];
+  }
+}
+Interaction * genie::utils::gsl::XSecFuncMultiDim::AdoptInteractionCopy(
+    const Interaction * in)
+{
+  delete fOwnedInteraction;
+  fOwnedInteraction = new Interaction(*in);
+  return fOwnedInteraction;
+}
+bool genie::utils::gsl::XSecFuncMultiDim::BatchSetup(
+    const XSecAlgorithmI * & /*model*/, const Interaction * & /*in*/,
+    KinePhaseSpace_t & /*kps*/, double & /*scale*/) const
+{
+  return false;
+}
+void genie::utils::gsl::XSecFuncMultiDim::SetBatchKinematics(
+    Interaction * /*in*/, const double * /*xin*/) const
+{
+
+}
+void genie::utils::gsl::XSecFuncMultiDim::EvalBatch(
+    unsigned int n, const double * x, double * f) const
+{
+  const XSecAlgorithmI * model = 0;
+  const Interaction *    in    = 0;
+  KinePhaseSpace_t       kps   = kPSNull;
+  double                 scale = 1.;
+  bool batch = (fBatchStatus >= 0 && n > 0 &&
+                this->BatchSetup(model, in, kps, scale) &&
+                model->HasXSecBatch());
+  if(!batch) {
+    genie::BatchFunctionMultiDimI::EvalBatch(n, x, f);
+    return;
+  }
+
+  unsigned int ndim = this->NDim();
+  while(fBatchInteractions.size() < n) {
+    fBatchInteractions.push_back(new Interaction(*in));
+  }
+  vector<const Interaction *> points(n);
+  for(unsigned int i = 0; i < n; i++) {
+    this->SetBatchKinematics(fBatchInteractions[i], &x[i*ndim]);
+    points[i] = fBatchInteractions[i];
+  }
+  {
+    GINSTR_ALG_SCOPE(model);
+    model->XSecBatch(n, &points[0], kps, f);
+  }
+  for(unsigned int i = 0; i < n; i++) f[i] *= scale;
+
+  if(fBatchStatus == 0) {
+    // reference check against the point by point evaluation
+    unsigned int nchk = TMath::Min(n, kNBatchChecks);
+    for(unsigned int ic = 0; ic < nchk; ic++) {
+      unsigned int i = (nchk > 1) ? (ic * (n-1)) / (nchk-1) : 0;
+      double ref = (*this)(&x[i*ndim]);
+      double tol = kBatchCheckTol * TMath::Max(TMath::Abs(ref), TMath::Abs(f[i]));
+      if(TMath::Abs(f[i] - ref) > tol) {
+        LOG("GSLXSecFunc", pWARN)
+          << "The batch cross section of " << model->Id().Key()
+          << " differs from the point by point one (" << f[i] << " vs "
+          << ref << ") - Evaluating it point by point";
+        fBatchStatus = -1;
+        genie::BatchFunctionMultiDimI::EvalBatch(n, x, f);
+        return;
+      }
+    }
+    fBatchStatus = 1;
+  }
+}
+
 //____________________________________________________________________________
 genie::utils::gsl::dXSec_dQ2_E::dXSec_dQ2_E(
     const XSecAlgorithmI * m, const Interaction * i) :
@@ -57,6 +146,7 @@ double genie::utils::gsl::dXSec_dQ2_E::DoEval(double xin) const
 //
   double Q2 = xin;
   fInteraction->KinePtr()->SetQ2(Q2);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSQ2fE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GSLXSecFunc", pDEBUG) << "xsec(Q2 = " << Q2 << ") = " << xsec;
@@ -95,6 +185,7 @@ double genie::utils::gsl::dXSec_dy_E::DoEval(double xin) const
 //
   double y = xin;
   fInteraction->KinePtr()->Sety(y);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSyfE);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
   LOG("GXSecFunc", pDEBUG) << "xsec(y = " << y << ") = " << xsec;
@@ -110,7 +201,7 @@ ROOT::Math::IBaseFunctionOneDim *
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dxdy_E::d2XSec_dxdy_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -137,6 +228,7 @@ double genie::utils::gsl::d2XSec_dxdy_E::DoEval(const double * xin) const
   fInteraction->KinePtr()->Setx(x);
   fInteraction->KinePtr()->Sety(y);
   kinematics::UpdateWQ2FromXY(fInteraction);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSxyfE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -146,10 +238,35 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dxdy_E(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d2XSec_dxdy_E::ThreadClone() const
+{
+  genie::utils::gsl::d2XSec_dxdy_E * f =
+     new genie::utils::gsl::d2XSec_dxdy_E(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  return f;
+}
+bool genie::utils::gsl::d2XSec_dxdy_E::BatchSetup(
+    const XSecAlgorithmI * & model, const Interaction * & in,
+    KinePhaseSpace_t & kps, double & scale) const
+{
+  model = fModel;
+  in    = fInteraction;
+  kps   = kPSxyfE;
+  scale = 1. / (1E-38 * units::cm2);
+  return true;
+}
+void genie::utils::gsl::d2XSec_dxdy_E::SetBatchKinematics(
+    Interaction * in, const double * xin) const
+{
+  in->KinePtr()->Setx(xin[0]);
+  in->KinePtr()->Sety(xin[1]);
+  kinematics::UpdateWQ2FromXY(in);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dy_E::d2XSec_dQ2dy_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -176,6 +293,7 @@ double genie::utils::gsl::d2XSec_dQ2dy_E::DoEval(const double * xin) const
   fInteraction->KinePtr()->SetQ2(Q2);
   fInteraction->KinePtr()->Sety(y);
   kinematics::UpdateXFromQ2Y(fInteraction);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSQ2yfE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -185,10 +303,35 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dQ2dy_E(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d2XSec_dQ2dy_E::ThreadClone() const
+{
+  genie::utils::gsl::d2XSec_dQ2dy_E * f =
+     new genie::utils::gsl::d2XSec_dQ2dy_E(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  return f;
+}
+bool genie::utils::gsl::d2XSec_dQ2dy_E::BatchSetup(
+    const XSecAlgorithmI * & model, const Interaction * & in,
+    KinePhaseSpace_t & kps, double & scale) const
+{
+  model = fModel;
+  in    = fInteraction;
+  kps   = kPSQ2yfE;
+  scale = 1. / (1E-38 * units::cm2);
+  return true;
+}
+void genie::utils::gsl::d2XSec_dQ2dy_E::SetBatchKinematics(
+    Interaction * in, const double * xin) const
+{
+  in->KinePtr()->SetQ2(xin[0]);
+  in->KinePtr()->Sety(xin[1]);
+  kinematics::UpdateXFromQ2Y(in);
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dQ2dydt_E::d2XSec_dQ2dydt_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -219,6 +362,7 @@ double genie::utils::gsl::d2XSec_dQ2dydt_E::DoEval(const double * xin) const
   fInteraction->KinePtr()->Sety(y);
   fInteraction->KinePtr()->Sett(t);
   kinematics::UpdateXFromQ2Y(fInteraction);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSQ2yfE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -228,10 +372,18 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dQ2dydt_E(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d2XSec_dQ2dydt_E::ThreadClone() const
+{
+  genie::utils::gsl::d2XSec_dQ2dydt_E * f =
+     new genie::utils::gsl::d2XSec_dQ2dydt_E(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  return f;
+}
 //____________________________________________________________________________
 genie::utils::gsl::d3XSec_dxdydt_E::d3XSec_dxdydt_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -261,6 +413,7 @@ double genie::utils::gsl::d3XSec_dxdydt_E::DoEval(const double * xin) const
   fInteraction->KinePtr()->Setx(x);
   fInteraction->KinePtr()->Sety(y);
   fInteraction->KinePtr()->Sett(t);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSxytfE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -270,10 +423,18 @@ ROOT::Math::IBaseFunctionMultiDim *
   return
     new genie::utils::gsl::d3XSec_dxdydt_E(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d3XSec_dxdydt_E::ThreadClone() const
+{
+  genie::utils::gsl::d3XSec_dxdydt_E * f =
+     new genie::utils::gsl::d3XSec_dxdydt_E(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  return f;
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dWdQ2_E::d2XSec_dWdQ2_E(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -309,6 +470,7 @@ double genie::utils::gsl::d2XSec_dWdQ2_E::DoEval(const double * xin) const
     fInteraction->KinePtr()->Setx(x);
     fInteraction->KinePtr()->Sety(y);
   }
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSWQ2fE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -318,6 +480,14 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d2XSec_dWdQ2_E(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d2XSec_dWdQ2_E::ThreadClone() const
+{
+  genie::utils::gsl::d2XSec_dWdQ2_E * f =
+     new genie::utils::gsl::d2XSec_dWdQ2_E(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  return f;
+}
 //____________________________________________________________________________
 genie::utils::gsl::d2XSec_dxdy_Ex::d2XSec_dxdy_Ex(
      const XSecAlgorithmI * m, const Interaction * i, double x) :
@@ -346,6 +516,7 @@ double genie::utils::gsl::d2XSec_dxdy_Ex::DoEval(double xin) const
   double y = xin;
   fInteraction->KinePtr()->Setx(fx);
   fInteraction->KinePtr()->Sety(y);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSxyfE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -383,6 +554,7 @@ double genie::utils::gsl::d2XSec_dxdy_Ey::DoEval(double xin) const
   double x = xin;
   fInteraction->KinePtr()->Setx(x);
   fInteraction->KinePtr()->Sety(fy);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSxyfE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -420,6 +592,7 @@ double genie::utils::gsl::d2XSec_dWdQ2_EW::DoEval(double xin) const
   double Q2 = xin;
   fInteraction->KinePtr()->SetW(fW);
   fInteraction->KinePtr()->SetQ2(Q2);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction, kPSWQ2fE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -457,6 +630,7 @@ double genie::utils::gsl::d2XSec_dWdQ2_EQ2::DoEval(double xin) const
   double W = xin;
   fInteraction->KinePtr()->SetW(W);
   fInteraction->KinePtr()->SetQ2(fQ2);
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction,kPSWQ2fE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -472,7 +646,7 @@ ROOT::Math::IBaseFunctionOneDim *
 //
 genie::utils::gsl::d5XSecAR::d5XSecAR(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i),
 flip(false)
@@ -551,6 +725,7 @@ double genie::utils::gsl::d5XSecAR::DoEval(const double * xin) const
   kinematics->SetFSLeptonP4(P4_lep );
   kinematics->SetHadSystP4 (P4_pion); // use Hadronic System variable to store pion momentum
  
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction);
   if (xsec>0 && flip) {
     xsec = xsec*-1.0;
@@ -566,6 +741,15 @@ ROOT::Math::IBaseFunctionMultiDim *
   return
     new genie::utils::gsl::d5XSecAR(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d5XSecAR::ThreadClone() const
+{
+  genie::utils::gsl::d5XSecAR * f =
+     new genie::utils::gsl::d5XSecAR(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  f->SetFlip(flip);
+  return f;
+}
 
 //____________________________________________________________________________
 //
@@ -573,7 +757,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 //
 genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::d5Xsec_dEldOmegaldOmegapi(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 { 
@@ -651,6 +835,7 @@ double genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::DoEval(const double * xin)
  
   delete P4_nu;
 
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = fModel->XSec(fInteraction)*TMath::Sin(theta_l)*TMath::Sin(theta_pi);
   return xsec/(1E-38 * units::cm2);
 }
@@ -661,6 +846,14 @@ ROOT::Math::IBaseFunctionMultiDim *
   return
     new genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi::ThreadClone() const
+{
+  genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi * f =
+     new genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  return f;
+}
 
 //____________________________________________________________________________
 //
@@ -670,7 +863,7 @@ ROOT::Math::IBaseFunctionMultiDim *
 
 genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::d4Xsec_dEldThetaldOmegapi(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i)
 {
@@ -753,6 +946,7 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::DoEval(const double * xin)
   
   delete P4_nu;
   
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = sin_theta_l * sin_theta_pi * fModel->XSec(fInteraction,kPSElOlTpifE);
   return fFactor * xsec/(1E-38 * units::cm2);
 }
@@ -762,6 +956,15 @@ ROOT::Math::IBaseFunctionMultiDim *
   return 
     new genie::utils::gsl::d4Xsec_dEldThetaldOmegapi(fModel,fInteraction);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::ThreadClone() const
+{
+  genie::utils::gsl::d4Xsec_dEldThetaldOmegapi * f =
+     new genie::utils::gsl::d4Xsec_dEldThetaldOmegapi(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  f->SetFactor(fFactor);
+  return f;
+}
 void genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::SetFactor(double factor)
 {
   fFactor = factor;
@@ -773,7 +976,7 @@ double genie::utils::gsl::d4Xsec_dEldThetaldOmegapi::GetFactor(void) const
 //____________________________________________________________________________
 genie::utils::gsl::d3Xsec_dOmegaldThetapi::d3Xsec_dOmegaldThetapi(
      const XSecAlgorithmI * m, const Interaction * i) :
-ROOT::Math::IBaseFunctionMultiDim(),
+XSecFuncMultiDim(),
 fModel(m),
 fInteraction(i),
 fElep(-1)
@@ -857,6 +1060,7 @@ double genie::utils::gsl::d3Xsec_dOmegaldThetapi::DoEval(const double * xin) con
   
   delete P4_nu;
   
+  GINSTR_ALG_SCOPE(fModel);
   double xsec = (sin_theta_l * sin_theta_pi) * fModel->XSec(fInteraction,kPSElOlTpifE);
   return xsec/(1E-38 * units::cm2);
 }
@@ -867,6 +1071,15 @@ genie::utils::gsl::d3Xsec_dOmegaldThetapi *
   out->SetE_lep(fElep);
   return out;
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::d3Xsec_dOmegaldThetapi::ThreadClone() const
+{
+  genie::utils::gsl::d3Xsec_dOmegaldThetapi * f =
+     new genie::utils::gsl::d3Xsec_dOmegaldThetapi(fModel,0);
+  f->fInteraction = f->AdoptInteractionCopy(fInteraction);
+  f->SetE_lep(fElep);
+  return f;
+}
 //____________________________________________________________________________
 void genie::utils::gsl::d3Xsec_dOmegaldThetapi::SetE_lep(double E_lepton) const
 {
@@ -917,7 +1130,9 @@ genie::utils::gsl::dXSec_dElep_AR *
 genie::utils::gsl::dXSec_Log_Wrapper::dXSec_Log_Wrapper(
       const ROOT::Math::IBaseFunctionMultiDim * fn,
       bool * ifLog, double * mins, double * maxes) :
+  genie::BatchFunctionMultiDimI(),
   fFn(fn),
+  fOwnedFn(0),
   fIfLog(ifLog),
   fMins(mins),
   fMaxes(maxes)
@@ -925,6 +1140,7 @@ genie::utils::gsl::dXSec_Log_Wrapper::dXSec_Log_Wrapper(
 }
 genie::utils::gsl::dXSec_Log_Wrapper::~dXSec_Log_Wrapper()
 {
+  delete fOwnedFn;
 } 
  
 // ROOT::Math::IBaseFunctionMultiDim interface
@@ -956,6 +1172,19 @@ ROOT::Math::IBaseFunctionMultiDim * genie::utils::gsl::dXSec_Log_Wrapper::Clone
 {
   return new dXSec_Log_Wrapper(fFn,fIfLog,fMins,fMaxes);
 }
+genie::BatchFunctionMultiDimI *
+   genie::utils::gsl::dXSec_Log_Wrapper::ThreadClone(void) const
+{
+  const genie::BatchFunctionMultiDimI * bfn =
+     dynamic_cast<const genie::BatchFunctionMultiDimI *>(fFn);
+  if(!bfn) return 0;
+  genie::BatchFunctionMultiDimI * fn = bfn->ThreadClone();
+  if(!fn) return 0;
+
+  dXSec_Log_Wrapper * f = new dXSec_Log_Wrapper(fn,fIfLog,fMins,fMaxes);
+  f->fOwnedFn = fn;
+  return f;
+}
     
 //____________________________________________________________________________
 
@@ -22,8 +22,13 @@
 #include <Math/IFunction.h>
 #include <Math/IntegratorMultiDim.h>
 
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Numerical/BatchFunctionMultiDimI.h"
+
 #include <string>
+#include <vector>
 using std::string;
+using std::vector;
 
 namespace genie {
 
@@ -33,6 +38,46 @@ class Interaction;
 namespace utils {
 namespace gsl   {
 
+//.....................................................................................
+//
+// genie::utils::gsl::XSecFuncMultiDim
+// Base of the multi-dimensional cross section functions. Their ThreadClone() holds
+// its own copy of the Interaction (whose kinematics DoEval sets), owned by the clone,
+// so that the clones can be evaluated concurrently (see genie::BatchFunctionMultiDimI).
+// That is only safe if the XSecAlgorithmI::XSec() of the model is itself reentrant.
+// Functions implementing BatchSetup() evaluate batches of points (as requested by
+// batch integrators, see genie::VegasIntegrator) with XSecAlgorithmI::XSecBatch(),
+// for models providing it, each point being set in its own copy of the Interaction.
+// The first batch is checked against the point by point evaluation at a few points:
+// batch evaluation is turned off for the function if they differ.
+//
+class XSecFuncMultiDim: public genie::BatchFunctionMultiDimI
+{
+public:
+  virtual ~XSecFuncMultiDim();
+
+  // genie::BatchFunctionMultiDimI interface
+  virtual void EvalBatch (unsigned int n, const double * x, double * f) const;
+
+protected:
+  XSecFuncMultiDim();
+
+  //! copy of in, deleted along with this function
+  Interaction * AdoptInteractionCopy(const Interaction * in);
+
+  //! the model, interaction and phase space of the batch evaluation, and the
+  //! factor scaling the model cross section; false if not supported (default)
+  virtual bool BatchSetup (const XSecAlgorithmI * & model, const Interaction * & in,
+                           KinePhaseSpace_t & kps, double & scale) const;
+  //! set the kinematics of the input point in an interaction of the batch
+  virtual void SetBatchKinematics (Interaction * in, const double * xin) const;
+
+private:
+  Interaction *                 fOwnedInteraction;
+  mutable vector<Interaction *> fBatchInteractions; ///< interaction copies, one per batch point
+  mutable int                   fBatchStatus;       ///< batch evaluation: 0 unchecked, 1 checked, -1 off
+};
+
 //.....................................................................................
 //
 // genie::utils::gsl::dXSec_dQ2_E
@@ -80,7 +125,7 @@ private:
 // genie::utils::gsl::d2XSec_dxdy_E
 // A 2-D cross section function: d2xsec/dxdy = f(x,y)|(fixed E)
 //
-class d2XSec_dxdy_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dxdy_E: public XSecFuncMultiDim
 {
 public:
   d2XSec_dxdy_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -91,6 +136,15 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
+
+protected:
+  // genie::utils::gsl::XSecFuncMultiDim batch evaluation
+  bool BatchSetup         (const XSecAlgorithmI * & model, const Interaction * & in,
+                           KinePhaseSpace_t & kps, double & scale) const;
+  void SetBatchKinematics (Interaction * in, const double * xin) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -101,7 +155,7 @@ private:
 // genie::utils::gsl::d2XSec_dQ2dy_E
 // A 2-D cross section function: d2xsec/dQ2dy = f(Q^2,y)|(fixed E)
 //
-class d2XSec_dQ2dy_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dQ2dy_E: public XSecFuncMultiDim
 {
 public:
   d2XSec_dQ2dy_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -112,6 +166,15 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
+
+protected:
+  // genie::utils::gsl::XSecFuncMultiDim batch evaluation
+  bool BatchSetup         (const XSecAlgorithmI * & model, const Interaction * & in,
+                           KinePhaseSpace_t & kps, double & scale) const;
+  void SetBatchKinematics (Interaction * in, const double * xin) const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -122,7 +185,7 @@ private:
 // genie::utils::gsl::d2XSec_dQ2dydt_E
 // A 3-D cross section function: d3xsec/dQ2dydt = f(Q^2,y,t)|(fixed E)
 //
-class d2XSec_dQ2dydt_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dQ2dydt_E: public XSecFuncMultiDim
 {
 public:
   d2XSec_dQ2dydt_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -133,6 +196,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -143,7 +209,7 @@ private:
 // genie::utils::gsl::d3XSec_dxdydt_E
 // A 3-D cross section function: d3xsec/dxdydt = f(x,y,t)|(fixed E)
 //
-class d3XSec_dxdydt_E: public ROOT::Math::IBaseFunctionMultiDim
+class d3XSec_dxdydt_E: public XSecFuncMultiDim
 {
 public:
   d3XSec_dxdydt_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -154,6 +220,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -164,7 +233,7 @@ private:
 // genie::utils::gsl::d2XSec_dWdQ2_E
 // A 2-D cross section function: d2xsec/dWdQ2 = f(W,Q2)|(fixed E)
 //
-class d2XSec_dWdQ2_E: public ROOT::Math::IBaseFunctionMultiDim
+class d2XSec_dWdQ2_E: public XSecFuncMultiDim
 {
 public:
   d2XSec_dWdQ2_E(const XSecAlgorithmI * m, const Interaction * i);
@@ -175,6 +244,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -274,7 +346,7 @@ private:
 //
 // 
 //
-class d5XSecAR : public ROOT::Math::IBaseFunctionMultiDim
+class d5XSecAR : public XSecFuncMultiDim
 {
 public:
   d5XSecAR(const XSecAlgorithmI * m, const Interaction * i);
@@ -283,6 +355,9 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
   void SetFlip(bool b) { flip = b; }
 
 private:
@@ -297,7 +372,7 @@ private:
 // genie::utils::gsl::d5Xsec_dEldOmegaldOmegapi
 // A 5-D cross section function (fixed E_nu)
 //
-class d5Xsec_dEldOmegaldOmegapi: public ROOT::Math::IBaseFunctionMultiDim
+class d5Xsec_dEldOmegaldOmegapi: public XSecFuncMultiDim
 {
 public:
   d5Xsec_dEldOmegaldOmegapi(const XSecAlgorithmI * m, const Interaction * i);
@@ -308,6 +383,9 @@ public:
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
 
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
+
 private:
   const XSecAlgorithmI * fModel;
   const Interaction *    fInteraction;
@@ -319,7 +397,7 @@ private:
 /// A 4-D cross section function (fixed E_nu)
 /// DANIEL - for the Alvarez-Russo cross-section
 ///
-class d4Xsec_dEldThetaldOmegapi: public ROOT::Math::IBaseFunctionMultiDim
+class d4Xsec_dEldThetaldOmegapi: public XSecFuncMultiDim
 {
 public:
   d4Xsec_dEldThetaldOmegapi(const XSecAlgorithmI * m, const Interaction * i);
@@ -329,6 +407,9 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
   
   double                              GetFactor()                 const;
   void                                SetFactor(double factor);
@@ -344,7 +425,7 @@ private:
 /// A 3-D cross section function (fixed E_nu)
 /// Steve Dennis - for the Alvarez-Russo cross-section
 ///
-class d3Xsec_dOmegaldThetapi: public ROOT::Math::IBaseFunctionMultiDim
+class d3Xsec_dOmegaldThetapi: public XSecFuncMultiDim
 {
 public:
   d3Xsec_dOmegaldThetapi(const XSecAlgorithmI * m, const Interaction * i);
@@ -354,6 +435,9 @@ public:
   unsigned int                        NDim   (void)               const;
   double                              DoEval (const double * xin) const;
   d3Xsec_dOmegaldThetapi            * Clone  (void)               const;
+
+  // genie::BatchFunctionMultiDimI interface
+  genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
   
   // Specific to this class
   void SetE_lep (double E_lepton) const;
@@ -405,7 +489,7 @@ private:
 /// dXSec_Log_Wrapper
 /// Redistributes variables over a range to a e^-x distribution.
 /// Allows the integrator to use a logarithmic series of points while calling uniformly.
-class dXSec_Log_Wrapper: public ROOT::Math::IBaseFunctionMultiDim
+class dXSec_Log_Wrapper: public genie::BatchFunctionMultiDimI
 {
   public:
     dXSec_Log_Wrapper(const ROOT::Math::IBaseFunctionMultiDim * fn,
@@ -416,9 +500,14 @@ class dXSec_Log_Wrapper: public ROOT::Math::IBaseFunctionMultiDim
     unsigned int                        NDim   (void)               const;
     double                              DoEval (const double * xin) const;
     ROOT::Math::IBaseFunctionMultiDim * Clone  (void)               const;
+
+    // genie::BatchFunctionMultiDimI interface
+    // (only available if the wrapped function provides one)
+    genie::BatchFunctionMultiDimI *     ThreadClone (void)          const;
   
   private:
     const ROOT::Math::IBaseFunctionMultiDim * fFn;
+    genie::BatchFunctionMultiDimI * fOwnedFn; ///< fFn, if owned (thread clones)
     bool * fIfLog;
     double * fMins;
     double * fMaxes;
@@ -10,10 +10,24 @@
  For the class documentation see the corresponding header file.
 
  Important revisions after version 2.0.0 :
+ @ Oct 14, 2026 - CA
+   Added IntegrateNDim(), dispatching multi-dimensional integrals either to
+   ROOT/GSL or to the "genie-vegas" integrator.
 
 */
 //____________________________________________________________________________
 
+#include <cstdlib>
+#include <cassert>
+
+#include <TMath.h>
+#include <Math/IntegratorMultiDim.h>
+#include <Math/AdaptiveIntegratorMultiDim.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/GSLUtils.h"
+#include "Framework/Numerical/VegasIntegrator.h"
+#include "Framework/Utils/StringUtils.h"
 #include "Physics/XSectionIntegration/XSecIntegratorI.h"
 
 using namespace genie;
@@ -42,3 +56,49 @@ XSecIntegratorI::~XSecIntegratorI()
 
 }
 //___________________________________________________________________________
+double XSecIntegratorI::IntegrateNDim(
+  const ROOT::Math::IBaseFunctionMultiDim & func,
+  const double * xmin, const double * xmax,
+  double abstol, unsigned int minpts) const
+{
+// The "genie-vegas" integrator can split the integrand evaluations among
+// worker processes: their number is given by the gsl-integration-workers
+// config parameter (bound in LoadConfig), or else by $GXSECINTGWORKERS
+// (default: 1). Integrands that can be copied for concurrent evaluation
+// (the multi-dimensional utils::gsl cross section functions) can instead be
+// evaluated in $GXSECINTGTHREADS threads (default: 1). Only set that for
+// models whose XSec() is reentrant.
+
+  if(utils::str::ToLower(fGSLIntgType) == "genie-vegas") {
+    int nworkers = 1;
+    if(fGSLNWorkers.Found()) {
+      nworkers = fGSLNWorkers();
+    } else {
+      const char * env = std::getenv("GXSECINTGWORKERS");
+      if(env) nworkers = TMath::Max(1, atoi(env));
+    }
+
+    int nthreads = 1;
+    const char * env = std::getenv("GXSECINTGTHREADS");
+    if(env) nthreads = TMath::Max(1, atoi(env));
+
+    VegasIntegrator ig(func, abstol, fGSLRelTol, fGSLMaxEval);
+    ig.SetNWorkers(nworkers);
+    ig.SetNThreads(nthreads);
+    return ig.Integral(xmin, xmax);
+  }
+
+  ROOT::Math::IntegrationMultiDim::Type ig_type =
+      utils::gsl::IntegrationNDimTypeFromString(fGSLIntgType);
+  ROOT::Math::IntegratorMultiDim ig(func, ig_type, abstol, fGSLRelTol, fGSLMaxEval);
+
+  if (minpts > 0 && ig_type == ROOT::Math::IntegrationMultiDim::kADAPTIVE) {
+     ROOT::Math::AdaptiveIntegratorMultiDim * cast =
+       dynamic_cast<ROOT::Math::AdaptiveIntegratorMultiDim*>( ig.GetIntegrator() );
+     assert(cast);
+     cast->SetMinPts(minpts);
+  }
+
+  return ig.Integral(xmin, xmax);
+}
+//___________________________________________________________________________
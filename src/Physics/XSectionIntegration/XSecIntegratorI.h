@@ -19,6 +19,8 @@
 #ifndef _XSEC_INTEGRATOR_I_H_
 #define _XSEC_INTEGRATOR_I_H_
 
+#include <Math/IFunction.h>
+
 #include "Framework/Algorithm/Algorithm.h"
 #include "Framework/EventGen/XSecAlgorithmI.h"
 #include "Framework/Interaction/Interaction.h"
@@ -40,6 +42,13 @@ protected:
   XSecIntegratorI(string name);
   XSecIntegratorI(string name, string config);
 
+  //! Integrate func over [xmin,xmax] with the configured multi-dimensional
+  //! integrator: a ROOT/GSL one or "genie-vegas" (see VegasIntegrator).
+  //! minpts sets the min # of evaluations of the GSL adaptive integrator.
+  double IntegrateNDim (const ROOT::Math::IBaseFunctionMultiDim & func,
+                        const double * xmin, const double * xmax,
+                        double abstol, unsigned int minpts = 0) const;
+
   const IntegratorI * fIntegrator; ///< GENIE numerical integrator 
 
   string fGSLIntgType;                     ///< name of GSL numerical integrator
@@ -48,6 +57,7 @@ protected:
   int    fGSLMinEval;                      ///< GSL min evaluations. Ignored by some integrators.
   unsigned int fGSLMaxSizeOfSubintervals;  ///< GSL maximum number of sub-intervals for 1D integrator
   unsigned int fGSLRule;                   ///< GSL Gauss-Kronrod integration rule (only for GSL 1D adaptive type)
+  AlgParam<int> fGSLNWorkers;              ///< # of processes for genie-vegas (if not set: $GXSECINTGWORKERS or 1)
 
 };
 
@@ -16,11 +16,20 @@
    Implemented dummy versions of the new GFluxI::Clear and GFluxI::Index as 
    these methods needed for pre-generation of flux interaction probabilities 
    in GMCJDriver. 
+ @ Oct 14, 2026 - CA
+   Un-weighted power-law energies are now drawn from the analytic inverse
+   cumulative distribution within the energy cuts, and any other spectrum
+   (see the new SetEnergySpectrum()) from its binned inverse cumulative
+   distribution restricted to the cuts, instead of rejecting the histogram
+   draws falling outside the cuts. Implemented GPointSourceAstroFlux::
+   GenerateNext(), sampling the neutrino position directly over the
+   cross-section disk of the sphere enclosing the detector.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cmath>
 
 #include <TH1D.h>
 #include <TH2D.h>
@@ -76,15 +85,12 @@ bool GAstroFlux::GenerateNext(void)
   // coordinate system
   //
 
-  double log10Emin = TMath::Log10(TMath::Max(kAstroDefMinEv,fMinEvCut));
-  double log10Emax = TMath::Log10(TMath::Min(kAstroDefMaxEv,fMaxEvCut));
-
   double wght_species = 1.;
   double wght_energy  = 1.;
   double wght_origin  = 1.;
 
   int    nupdg     = 0;
-  double log10E    = -99999;
+  double Ev        = 0;
   double phi       = -999999;
   double costheta  = -999999;
 
@@ -96,12 +102,10 @@ bool GAstroFlux::GenerateNext(void)
      return false;
   }
 
-  status = fNuGen->SelectEnergy(
-     fGenWeighted, *fEnergySpectrum, log10Emin, log10Emax, log10E, wght_energy);
+  status = this->GenerateEnergy(Ev, wght_energy);
   if(!status) {
      return false;
   }
-  double Ev = TMath::Power(10.,log10E);
 
   status = fNuGen->SelectOrigin(
     fGenWeighted, *fSolidAngleAcceptance, phi, costheta, wght_origin);
@@ -288,6 +292,67 @@ void GAstroFlux::SetEnergyPowLawIdx(double n)
   // normalize
   double max = fEnergySpectrum->GetMaximum();
   fEnergySpectrum->Scale(1./max);
+
+  fPowLawSpectrum = true;
+  fPowLawIdx      = n;
+}
+//___________________________________________________________________________
+void GAstroFlux::SetEnergySpectrum(const TH1D & log10e_spectrum)
+{
+// Set an arbitrary energy spectrum, binned in log10(E/GeV)
+
+  double max = log10e_spectrum.GetMaximum();
+  if(max <= 0.) {
+    LOG("Flux", pERROR) << "Empty energy spectrum - Ignored";
+    return;
+  }
+
+  if(fEnergySpectrum) delete fEnergySpectrum;
+
+  fEnergySpectrum = new TH1D(log10e_spectrum);
+  fEnergySpectrum->SetName("fEnergySpectrum");
+  fEnergySpectrum->SetDirectory(0);
+
+  // normalize
+  fEnergySpectrum->Scale(1./max);
+
+  fPowLawSpectrum = false;
+  fPowLawIdx      = 0;
+}
+//___________________________________________________________________________
+bool GAstroFlux::GenerateEnergy(double & Ev, double & wght)
+{
+// Select the neutrino energy within the energy cuts.
+// Un-weighted energies from a power-law spectrum are drawn directly from
+// its analytic inverse cumulative distribution.
+
+  Ev   = 0;
+  wght = 0;
+
+  if(!fEnergySpectrum) {
+    return false;
+  }
+
+  double log10Emin = TMath::Log10(TMath::Max(kAstroDefMinEv,fMinEvCut));
+  double log10Emax = TMath::Log10(TMath::Min(kAstroDefMaxEv,fMaxEvCut));
+  double log10E    = -99999;
+
+  bool status = true;
+  if(fPowLawSpectrum && !fGenWeighted) {
+     status = fNuGen->SelectPowLawEnergy(
+        fPowLawIdx, log10Emin, log10Emax, log10E);
+     wght = 1.;
+  } else {
+     status = fNuGen->SelectEnergy(
+        fGenWeighted, *fEnergySpectrum, log10Emin, log10Emax, log10E, wght);
+  }
+  if(!status) {
+     return false;
+  }
+
+  Ev = TMath::Power(10.,log10E);
+
+  return true;
 }
 //___________________________________________________________________________
 void GAstroFlux::SetUserCoordSystem(TRotation & rotation)
@@ -324,6 +389,8 @@ void GAstroFlux::Initialize(void)
   // To be set via SetEnergyPowLawIdx()
   // Can be trivially modified to accomodate different spectra
   fEnergySpectrum = 0;
+  fPowLawSpectrum = false;
+  fPowLawIdx      = 0;
 
   // Relative neutrino populations
   // To be set via SetRelNuPopulations()
@@ -443,18 +510,90 @@ bool GAstroFlux::NuGenerator::SelectEnergy(
   } 
 
   // Generate un-weighted flux:
+  // Draw from the inverse cumulative distribution of the spectrum,
+  // restricted to the energy cuts (no rejection)
   //
   else {
-     do {
-       log10E = log10Epdf.GetRandom();
+     double Fmin = this->CumulFraction(log10Epdf, log10Emin);
+     double Fmax = this->CumulFraction(log10Epdf, log10Emax);
+     if(Fmax <= Fmin) {
+       return false;
      }
-     while(log10E < log10Emin || log10E > log10Emax);
+     RandomGen * rnd = RandomGen::Instance();
+     double F = Fmin + (Fmax-Fmin) * rnd->RndFlux().Rndm();
+     log10E = this->InvCumulFraction(log10Epdf, F);
+     log10E = TMath::Max(log10Emin, TMath::Min(log10Emax, log10E));
      wght = 1.;
   }
 
   return true;
 }
 //___________________________________________________________________________
+bool GAstroFlux::NuGenerator::SelectPowLawEnergy(
+  double n, double log10Emin, double log10Emax, double & log10E)
+{
+// select an un-weighted neutrino energy from a power-law spectrum:
+// dN/dlog10(E) ~ E^-n = exp(a*log10(E)), with a = -n*ln(10), inverting
+// the cumulative distribution analytically. The form used depends on the
+// sign of a, so that the exponentials do not overflow over the (up to 23
+// decades wide) energy range.
+
+  log10E = -9999999;
+
+  if(log10Emax <= log10Emin) {
+    return false;
+  }
+
+  RandomGen * rnd = RandomGen::Instance();
+  double u  = rnd->RndFlux().Rndm();
+  double dx = log10Emax - log10Emin;
+  double a  = -1. * n * TMath::Ln10();
+
+  if(TMath::Abs(a*dx) < 1E-9) {
+     log10E = log10Emin + u * dx;
+  }
+  else if(a < 0) {
+     log10E = log10Emin + log1p(u * expm1(a*dx)) / a;
+  }
+  else {
+     log10E = log10Emax + log1p((1.-u) * expm1(-1.*a*dx)) / a;
+  }
+  log10E = TMath::Max(log10Emin, TMath::Min(log10Emax, log10E));
+
+  return true;
+}
+//___________________________________________________________________________
+double GAstroFlux::NuGenerator::CumulFraction(TH1D & pdf, double x)
+{
+// fraction of the histogram integral below x (linear within bins)
+
+  int nb = pdf.GetNbinsX();
+  if(x <= pdf.GetBinLowEdge(1)   ) return 0.;
+  if(x >= pdf.GetBinLowEdge(nb+1)) return 1.;
+
+  const double * integral = pdf.GetIntegral();
+  int    ib   = pdf.FindBin(x);
+  double frac = (x - pdf.GetBinLowEdge(ib)) / pdf.GetBinWidth(ib);
+
+  return integral[ib-1] + frac * (integral[ib] - integral[ib-1]);
+}
+//___________________________________________________________________________
+double GAstroFlux::NuGenerator::InvCumulFraction(TH1D & pdf, double F)
+{
+// inverse of CumulFraction()
+
+  int nb = pdf.GetNbinsX();
+  const double * integral = pdf.GetIntegral();
+
+  int j = TMath::BinarySearch(nb+1, integral, F); // integral[j] <= F
+  j = TMath::Max(0, TMath::Min(nb-1, j));
+
+  double dF   = integral[j+1] - integral[j];
+  double frac = (dF > 0.) ? (F - integral[j]) / dF : 0.5;
+
+  return pdf.GetBinLowEdge(j+1) + frac * pdf.GetBinWidth(j+1);
+}
+//___________________________________________________________________________
 bool GAstroFlux::NuGenerator::SelectOrigin(
   bool weighted, TH2D & opdf, 
   double & phi, double & costheta, double & wght)
@@ -580,6 +719,101 @@ GPointSourceAstroFlux::~GPointSourceAstroFlux()
 //___________________________________________________________________________
 bool GPointSourceAstroFlux::GenerateNext(void)
 {
+  // Reset previously generated neutrino code / 4-p / 4-x
+  this->ResetSelection();
+  fgWeight = 1.;
+
+  if(fRelNuPopulations.size() == 0) {
+    return false;
+  }
+  if(fDetSize <= 0.) {
+    LOG("Flux", pERROR) << "The detector position & size were not set";
+    return false;
+  }
+
+  //
+  // Select a point source (also updating the weight), the neutrino species
+  // and energy
+  //
+
+  bool status = this->SelectSource();
+  if(!status) {
+     return false;
+  }
+
+  double wght_species = 1.;
+  double wght_energy  = 1.;
+  int    nupdg        = 0;
+  double Ev           = 0;
+
+  status = fNuGen->SelectNuPdg(
+     fGenWeighted, fRelNuPopulations, nupdg, wght_species);
+  if(!status) {
+     return false;
+  }
+
+  status = this->GenerateEnergy(Ev, wght_energy);
+  if(!status) {
+     return false;
+  }
+
+  //
+  // Direction to the source (at a random time) & starting position on the
+  // Earth's surface, on the line from the source to the detector centre.
+  // Propagate through the Earth.
+  //
+
+  double   phi      = 0;
+  double   costheta = 0;
+  TVector3 srcdir;
+  this->SelectDirection(phi, costheta, srcdir);
+
+  status = fNuPropg->Go(phi, costheta, fDetCenter, fDetSize, nupdg, Ev);
+  if(!status) {
+     return false;
+  }
+
+  int      pnupdg = fNuPropg->NuPdgAtDetVolBoundary();
+  TVector3 pp3    = fNuPropg->P3AtDetVolBoundary();
+
+  //
+  // All neutrinos from the source are parallel: Sample the position
+  // directly, and uniformly, over the cross-section disk of the sphere
+  // enclosing the detector and project it on the upstream hemisphere
+  //
+
+  RandomGen * rnd = RandomGen::Instance();
+  double rt  = fDetSize * TMath::Sqrt(rnd->RndFlux().Rndm());
+  double psi = 2.*kPi * rnd->RndFlux().Rndm();
+
+  TVector3 transv = srcdir.Orthogonal();
+  transv.Rotate(psi, srcdir);
+  transv.SetMag(rt);
+
+  double   along = TMath::Sqrt(TMath::Max(0., fDetSize*fDetSize - rt*rt));
+  TVector3 px3   = transv + along * srcdir;
+
+  //
+  // Rotate vectors: 
+
+  // GEF translated to detector centre -> THZ
+  px3 = fRotGEF2THz * px3;
+  pp3 = fRotGEF2THz * pp3;
+
+  // THZ -> Topocentric user-defined detetor system
+  px3 = fRotTHz2User * px3;
+  pp3 = fRotTHz2User * pp3;
+
+  //
+  // Set position, momentum, pdg code and weight variables reported back
+  //
+  fgWeight *= wght_species * wght_energy;
+  fgPdgC    = pnupdg;
+  fgX4.SetVect(px3*(units::m/units::km));
+  fgX4.SetT(0.);
+  fgP4.SetVect(pp3);
+  fgP4.SetE(pp3.Mag());
+
   return true;
 }
 //___________________________________________________________________________
@@ -651,4 +885,38 @@ bool GPointSourceAstroFlux::SelectSource(void)
   return true;
 }
 //___________________________________________________________________________
+void GPointSourceAstroFlux::SelectDirection(
+   double & phi, double & costheta, TVector3 & dir)
+{
+// Unit vector (GEF) pointing to the selected source and the position on the
+// Earth's surface where the neutrino reaching the detector centre enters
+// (as the phi, costheta parameters of NuPropagator::Go()).
+// Time is randomized to account for the Earth's rotation: the source
+// longitude in GEF is its right ascension minus a random sidereal angle.
+
+  RandomGen * rnd = RandomGen::Instance();
+
+  double ra     = fPntSrcRA [fSelSourceId];
+  double dec    = fPntSrcDec[fSelSourceId];
+  double lon    = ra - 2.*kPi * rnd->RndFlux().Rndm();
+  double cosdec = TMath::Cos(dec);
+
+  dir.SetXYZ(cosdec*TMath::Cos(lon), cosdec*TMath::Sin(lon), TMath::Sin(dec));
+
+  // intersection of the line (detector centre + lambda * dir) with the
+  // Earth's surface
+  double REarth = constants::kREarth/units::km;
+  double ds     = fDetCenter.Dot(dir);
+  double disc   = ds*ds - fDetCenter.Mag2() + REarth*REarth;
+  double lambda = -ds + TMath::Sqrt(TMath::Max(0., disc));
+
+  TVector3 start = fDetCenter + lambda * dir;
+
+  // NuPropagator::Go() convention: x = R sin(theta) sin(phi),
+  //                                y = R sin(theta) cos(phi)
+  costheta = TMath::Max(-1., TMath::Min(1., start.Z()/REarth));
+  phi      = TMath::ATan2(start.X(), start.Y());
+  if(phi < 0.) phi += 2.*kPi;
+}
+//___________________________________________________________________________
 
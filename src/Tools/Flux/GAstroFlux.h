@@ -82,6 +82,16 @@
 
           The energy spectrum is follows a power law. The user needs to 
           specify the power-law index by calling SetEnergyPowLawIdx().
+          For a power-law spectrum, un-weighted energies are drawn directly
+          from the (analytic) inverse of the cumulative distribution within
+          the energy cuts. An arbitrary spectrum can be given instead, with
+          SetEnergySpectrum(); it is then sampled from its (binned) inverse
+          cumulative distribution, restricted to the energy cuts.
+
+          For point sources, the neutrino direction is fixed by the selected
+          source (and the randomized time) and the neutrino position is
+          sampled directly, and uniformly, over the cross-section disk of the
+          sphere enclosing the detector.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -154,6 +164,7 @@ public :
   void SetDetectorPosition (double latitude, double longitude, double depth, double size);
   void SetRelNuPopulations (double nnue=1, double nnumu=2, double nnutau=0, double nnuebar=1, double nnumubar=2, double nnutaubar=0);
   void SetEnergyPowLawIdx  (double n);
+  void SetEnergySpectrum   (const TH1D & log10e_spectrum); ///< arbitrary spectrum, binned in log10(E/GeV)
   void SetUserCoordSystem  (TRotation & rotation); ///< rotation Topocentric Horizontal -> User-defined Topocentric Coord System
 
 protected:
@@ -168,6 +179,7 @@ protected:
   void Initialize               (void);
   void CleanUp                  (void);
   void ResetSelection           (void);
+  bool GenerateEnergy           (double & Ev, double & wght);
 
   //
   // protected data members
@@ -193,6 +205,8 @@ protected:
   TVector3         fDetCenter;            ///<
   TH1D *           fEnergySpectrum;       ///<
   TH2D *           fSolidAngleAcceptance; ///<
+  bool             fPowLawSpectrum;       ///< is fEnergySpectrum a pure power law?
+  double           fPowLawIdx;            ///< power-law index, if so
   NuGenerator *    fNuGen;                ///<
   NuPropagator *   fNuPropg;              ///<
 
@@ -205,7 +219,11 @@ protected:
    ~NuGenerator() {}
     bool SelectNuPdg (bool weighted, const map<int,double> & nupdgpdf, int & nupdg, double & wght);
     bool SelectEnergy(bool weighted, TH1D & log10epdf, double log10emin, double log10emax, double & log10e, double & wght);
+    bool SelectPowLawEnergy(double n, double log10emin, double log10emax, double & log10e);
     bool SelectOrigin(bool weighted, TH2D & opdf, double & phi, double & costheta, double & wght);
+  private:
+    double CumulFraction   (TH1D & pdf, double x);
+    double InvCumulFraction(TH1D & pdf, double F);
   };
   class NuPropagator {
   public:
@@ -257,7 +275,8 @@ public :
 
 private:
 
-  bool SelectSource(void);
+  bool SelectSource    (void);
+  void SelectDirection (double & phi, double & costheta, TVector3 & dir);
 
   map<int, string> fPntSrcName;  ///< point source name
   map<int, double> fPntSrcRA;    ///< right ascension
@@ -48,18 +48,37 @@
    rather than a TH3D ptr input and it is expected to retrieve the TH3D flux
    itself. This change was made to easily fit HAKKM in the code already used
    by FLUKA and BGLRS.
+ @ Oct 14, 2026 - CA
+   Added ForceMinCosTheta() and ForceMaxCosTheta() to generate flux neutrinos
+   within a zenith angle band, and SelectedFlux() to get the flux within the
+   energy and cos(theta) cuts, for normalizing samples generated in strata of
+   energy and zenith angle (see gevgen_atmo --stratify).
+ @ Oct 14, 2026 - CA
+   Added SetCacheFile(): the flux histograms filled from the input data
+   files are cached in a binary file, keyed by the file checksums and the
+   flux binning, and reloaded from it in subsequent jobs.
+ @ Oct 14, 2026 - CA
+   Added SaveState() and RestoreState() for checkpointed MC jobs.
 
 */
 //____________________________________________________________________________
 
 #include <cassert>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <typeinfo>
+#include <stdint.h>
 
 #include <TH3D.h>
 #include <TMath.h>
+#include <TSystem.h>
 
 #include "Framework/Conventions/Constants.h"
+#include "Framework/EventGen/GMCJCheckpoint.h"
 #include "Tools/Flux/GAtmoFlux.h"
 #include "Framework/Messenger/Messenger.h"
 #include "Framework/Numerical/RandomGen.h"
@@ -69,10 +88,124 @@
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
 
+using std::ostringstream;
 using namespace genie;
 using namespace genie::flux;
 using namespace genie::constants;
 
+//
+// Flux cache file layout (native byte order, checked with the BOM):
+//   header : AtmoFluxCacheHeader_t
+//   entries: nentries x { AtmoFluxCacheEntryHeader_t,
+//                         raw flux[ncells], integrated flux[ncells] }
+// with the contents of all cells (incl. under/overflows) of the TH3D
+// flux histograms of one neutrino species, as filled from its data files
+// and as normalised by CreateNormalisedFluxHisto().
+//
+namespace {
+  const char     kAtmoFluxCacheMagic[8] = { 'G','A','T','M','O','F','L','X' };
+  const uint32_t kAtmoFluxCacheVersion  = 1;
+  const uint32_t kAtmoFluxCacheBOM      = 0x01020304;
+
+  struct AtmoFluxCacheHeader_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t bom;
+    uint32_t nentries;
+    uint32_t reserved;
+  };
+  struct AtmoFluxCacheEntryHeader_t {
+    uint64_t key;
+    int32_t  nu_pdg;
+    uint32_t ncells;
+  };
+  struct AtmoFluxCacheEntry_t {
+    int            nu_pdg;
+    vector<double> raw;
+    vector<double> intg;
+  };
+  typedef map<unsigned long long, AtmoFluxCacheEntry_t> AtmoFluxCache_t;
+
+  // 64-bit FNV-1a hash
+  void fnv1a(uint64_t & hash, const char * data, size_t n)
+  {
+    for(size_t i = 0; i < n; i++) {
+      hash ^= (unsigned char) data[i];
+      hash *= 1099511628211ULL;
+    }
+  }
+  bool read_flux_cache(string filename, AtmoFluxCache_t & cache)
+  {
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+    if(!in) return false;
+    AtmoFluxCacheHeader_t header;
+    in.read((char *) &header, sizeof(header));
+    bool valid = in.good() &&
+       memcmp(header.magic, kAtmoFluxCacheMagic, sizeof(header.magic)) == 0 &&
+       header.version == kAtmoFluxCacheVersion &&
+       header.bom     == kAtmoFluxCacheBOM;
+    if(!valid) {
+      LOG("Flux", pWARN)
+        << "Ignoring invalid or incompatible flux cache file: " << filename;
+      return false;
+    }
+    for(uint32_t i = 0; i < header.nentries; i++) {
+      AtmoFluxCacheEntryHeader_t eh;
+      in.read((char *) &eh, sizeof(eh));
+      if(!in.good()) break;
+      AtmoFluxCacheEntry_t & entry = cache[eh.key];
+      entry.nu_pdg = eh.nu_pdg;
+      entry.raw .resize(eh.ncells);
+      entry.intg.resize(eh.ncells);
+      if(eh.ncells > 0) {
+        in.read((char *) &entry.raw [0], eh.ncells * sizeof(double));
+        in.read((char *) &entry.intg[0], eh.ncells * sizeof(double));
+      }
+      if(!in.good()) {
+        cache.erase(eh.key);
+        break;
+      }
+    }
+    return true;
+  }
+  bool write_flux_cache(string filename, const AtmoFluxCache_t & cache)
+  {
+    // written under a temporary name and then renamed, so that concurrent
+    // jobs never read a partially written cache
+    AtmoFluxCacheHeader_t header;
+    memcpy(header.magic, kAtmoFluxCacheMagic, sizeof(header.magic));
+    header.version  = kAtmoFluxCacheVersion;
+    header.bom      = kAtmoFluxCacheBOM;
+    header.nentries = cache.size();
+    header.reserved = 0;
+
+    ostringstream tmpname;
+    tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+    std::ofstream out(tmpname.str().c_str(), std::ios::out | std::ios::binary);
+    out.write((const char *) &header, sizeof(header));
+    AtmoFluxCache_t::const_iterator it = cache.begin();
+    for( ; it != cache.end(); ++it) {
+      const AtmoFluxCacheEntry_t & entry = it->second;
+      AtmoFluxCacheEntryHeader_t eh;
+      eh.key    = it->first;
+      eh.nu_pdg = entry.nu_pdg;
+      eh.ncells = entry.raw.size();
+      out.write((const char *) &eh, sizeof(eh));
+      if(eh.ncells > 0) {
+        out.write((const char *) &entry.raw [0], eh.ncells * sizeof(double));
+        out.write((const char *) &entry.intg[0], eh.ncells * sizeof(double));
+      }
+    }
+    out.close();
+
+    if(out.fail() || std::rename(tmpname.str().c_str(), filename.c_str()) != 0) {
+      std::remove(tmpname.str().c_str());
+      return false;
+    }
+    return true;
+  }
+}
+
 //____________________________________________________________________________
 GAtmoFlux::GAtmoFlux()
 {
@@ -143,7 +276,8 @@ bool GAtmoFlux::GenerateNext_1try(void)
      double emin = TMath::Power(fEnergyBins[0],1.0-alpha);
      double emax = TMath::Power(fEnergyBins[fNumEnergyBins],1.0-alpha);
      Ev          = TMath::Power(emin+(emax-emin)*rnd->RndFlux().Rndm(),1.0/(1.0-alpha));
-     costheta    = -1+2*rnd->RndFlux().Rndm();
+     costheta    = fMinCosThetaCut
+                 + (fMaxCosThetaCut-fMinCosThetaCut)*rnd->RndFlux().Rndm();
      phi         = 2.*kPi* rnd->RndFlux().Rndm();
 
      unsigned int nnu = fPdgCList->size();
@@ -167,12 +301,41 @@ bool GAtmoFlux::GenerateNext_1try(void)
      // generate nominal flux
      //
 
-     Axis_t ax = 0, ay = 0, az = 0;
-     fTotalFluxHisto->GetRandom3(ax, ay, az);
-     Ev       = (double)ax;
-     costheta = (double)ay;
-     phi      = (double)az;
-     nu_pdg   = this->SelectNeutrino(Ev, costheta, phi);
+     // sample the cumulative tables built by BuildSamplingTables(): only
+     // the flux within the energy and cos(theta) cuts is included, so that
+     // the generated neutrino never needs to be rejected
+     if(fCdfFlux.empty()) {
+        LOG("Flux", pFATAL)
+          << "No flux within [" << this->MinEnergy() << ", "
+          << this->MaxEnergy() << "] GeV and cos(theta) within ["
+          << fMinCosThetaCut << ", " << fMaxCosThetaCut << "]";
+        exit(1);
+     }
+     double R = fCdfFlux.back() * rnd->RndFlux().Rndm();
+     unsigned int k = std::upper_bound(fCdfFlux.begin(), fCdfFlux.end(), R)
+                    - fCdfFlux.begin();
+     if(k >= fCdfFlux.size()) k = fCdfFlux.size() - 1;
+
+     // flat within the selected bin (as TH3::GetRandom3)
+     int ie = fCdfBins[3*k+0];
+     int ic = fCdfBins[3*k+1];
+     int ip = fCdfBins[3*k+2];
+     double elo = TMath::Max(fEnergyBins[ie],   this->MinEnergy());
+     double ehi = TMath::Min(fEnergyBins[ie+1], this->MaxEnergy());
+     double clo = TMath::Max(fCosThetaBins[ic],   fMinCosThetaCut);
+     double chi = TMath::Min(fCosThetaBins[ic+1], fMaxCosThetaCut);
+     Ev       = elo + (ehi - elo) * rnd->RndFlux().Rndm();
+     costheta = clo + (chi - clo) * rnd->RndFlux().Rndm();
+     phi      = fPhiBins[ip] 
+              + (fPhiBins[ip+1] - fPhiBins[ip]) * rnd->RndFlux().Rndm();
+
+     // select the neutrino species given their relative flux in this bin
+     unsigned int nnu = fPdgCList->size();
+     const double * cdfnu = &fCdfNu[nnu*k];
+     double Rnu = cdfnu[nnu-1] * rnd->RndFlux().Rndm();
+     unsigned int inu = 0;
+     while(inu < nnu-1 && Rnu >= cdfnu[inu]) inu++;
+     nu_pdg   = (*fPdgCList)[inu];
      weight   = 1.0;
   }
 
@@ -267,16 +430,48 @@ long int GAtmoFlux::NFluxNeutrinos(void) const
   return fNNeutrinos;
 }
 //___________________________________________________________________________
+bool GAtmoFlux::SaveState(TDirectory * dir) const
+{
+// The flux neutrinos are independent throws, so only their count is kept
+//
+  GMCJCheckpoint::SaveValue(dir, "NNeutrinos", fNNeutrinos);
+  return true;
+}
+//___________________________________________________________________________
+bool GAtmoFlux::RestoreState(TDirectory * dir)
+{
+  return GMCJCheckpoint::LoadValue(dir, "NNeutrinos", fNNeutrinos);
+}
+//___________________________________________________________________________
 void GAtmoFlux::ForceMinEnergy(double emin)
 {
   emin = TMath::Max(0., emin);
   fMinEvCut = emin;
+  if(fTotalFluxHisto) this->BuildSamplingTables();
 }
 //___________________________________________________________________________
 void GAtmoFlux::ForceMaxEnergy(double emax)
 {
   emax = TMath::Max(0., emax);
   fMaxEvCut = emax;
+  if(fTotalFluxHisto) this->BuildSamplingTables();
+}
+//___________________________________________________________________________
+void GAtmoFlux::ForceMinCosTheta(double cmin)
+{
+  fMinCosThetaCut = TMath::Max(-1., cmin);
+  if(fTotalFluxHisto) this->BuildSamplingTables();
+}
+//___________________________________________________________________________
+void GAtmoFlux::ForceMaxCosTheta(double cmax)
+{
+  fMaxCosThetaCut = TMath::Min(1., cmax);
+  if(fTotalFluxHisto) this->BuildSamplingTables();
+}
+//___________________________________________________________________________
+double GAtmoFlux::SelectedFlux(void) const
+{
+  return (fCdfFlux.empty()) ? 0. : fCdfFlux.back();
 }
 //___________________________________________________________________________
 void GAtmoFlux::Clear(Option_t * opt)
@@ -324,6 +519,9 @@ void GAtmoFlux::Initialize(void)
   fTotalFluxHisto = 0;
   fTotalFluxHistoIntg = 0;
 
+  const char * cache_file = gSystem->Getenv("GATMOFLUXCACHE");
+  fCacheFile = (cache_file) ? cache_file : "";
+
   bool allow_dup = false;
   fPdgCList = new PDGCodeList(allow_dup);
 
@@ -345,9 +543,11 @@ void GAtmoFlux::Initialize(void)
   // weighting switched off by default
   this->GenerateWeighted(false);
 
-  // Default: No min/max energy cut
+  // Default: No min/max energy or cos(theta) cut
   this->ForceMinEnergy(0.);
   this->ForceMaxEnergy(9999999999.);
+  this->ForceMinCosTheta(-1.);
+  this->ForceMaxCosTheta( 1.);
 
   // Default radii
   fRl = 0.0;
@@ -462,6 +662,11 @@ void GAtmoFlux::AddFluxFile(string filename)
 //  return AddFluxFile( nu_pdg, filename );
 //}
 //___________________________________________________________________________
+void GAtmoFlux::SetCacheFile(string filename)
+{
+  fCacheFile = filename;
+}
+//___________________________________________________________________________
 bool GAtmoFlux::LoadFluxData(void)
 {
   LOG("Flux", pNOTICE)
@@ -470,6 +675,22 @@ bool GAtmoFlux::LoadFluxData(void)
   fFluxHistoMap.clear();
   fPdgCList->clear();
 
+  // flux histograms cached by earlier jobs, by neutrino species key
+  bool use_cache = (fCacheFile.size() > 0);
+  AtmoFluxCache_t cache;
+  map<int, unsigned long long> cache_keys;
+  map<string, unsigned long long> checksums;
+  if(use_cache) {
+    read_flux_cache(fCacheFile, cache);
+    for( unsigned int n=0; n<fFluxFlavour.size(); n++ ){
+      int nu_pdg = fFluxFlavour.at(n);
+      if(cache_keys.count(nu_pdg) == 0) {
+        cache_keys[nu_pdg] = this->FluxCacheKey(nu_pdg, checksums);
+      }
+    }
+  }
+  bool cache_updated = false;
+
   bool loading_status = true;
 
   for( unsigned int n=0; n<fFluxFlavour.size(); n++ ){
@@ -488,6 +709,24 @@ bool GAtmoFlux::LoadFluxData(void)
         hist = this->CreateFluxHisto(pname.c_str(), pname.c_str());
         fRawFluxHistoMap.insert( map<int,TH3D*>::value_type(nu_pdg,hist) );
 //      }
+    } else {
+        hist = myMapEntry->second;
+    }
+    // reload the histogram from the cache, if it was cached from the same
+    // data files (only once for species read from several files)
+    if(use_cache) {
+      AtmoFluxCache_t::const_iterator cached = cache.find(cache_keys[nu_pdg]);
+      if(cached != cache.end() &&
+         (int) cached->second.raw.size() == hist->GetNcells()) {
+        if(myMapEntry == fRawFluxHistoMap.end()) {
+          LOG("Flux", pNOTICE)
+            << "Reloading the " << pname << " flux from: " << fCacheFile;
+          for(int ibin = 0; ibin < hist->GetNcells(); ibin++) {
+            hist->SetBinContent(ibin, cached->second.raw[ibin]);
+          }
+        }
+        continue;
+      }
     }
     // now let concrete instances to read the flux-specific data files
     // and fill the histogram
@@ -501,11 +740,44 @@ bool GAtmoFlux::LoadFluxData(void)
       int   nu_pdg = hist_iter->first;
       TH3D* hist   = hist_iter->second;
 
-      TH3D* hnorm = this->CreateNormalisedFluxHisto( hist );
+      TH3D* hnorm = 0;
+      AtmoFluxCache_t::const_iterator cached = cache.end();
+      if(use_cache) cached = cache.find(cache_keys[nu_pdg]);
+      if(cached != cache.end() &&
+         (int) cached->second.intg.size() == hist->GetNcells()) {
+        TString histname = hist->GetName();
+        histname.Append("_IntegratedFlux");
+        hnorm = (TH3D*)(hist->Clone(histname.Data()));
+        hnorm->Reset();
+        for(int ibin = 0; ibin < hnorm->GetNcells(); ibin++) {
+          hnorm->SetBinContent(ibin, cached->second.intg[ibin]);
+        }
+      } else {
+        hnorm = this->CreateNormalisedFluxHisto( hist );
+        if(use_cache) {
+          AtmoFluxCacheEntry_t & entry = cache[cache_keys[nu_pdg]];
+          entry.nu_pdg = nu_pdg;
+          entry.raw .resize(hist->GetNcells());
+          entry.intg.resize(hist->GetNcells());
+          for(int ibin = 0; ibin < hist->GetNcells(); ibin++) {
+            entry.raw [ibin] = hist ->GetBinContent(ibin);
+            entry.intg[ibin] = hnorm->GetBinContent(ibin);
+          }
+          cache_updated = true;
+        }
+      }
       fFluxHistoMap.insert( map<int,TH3D*>::value_type(nu_pdg,hnorm) );
       fPdgCList->push_back(nu_pdg);
     }
 
+    if(cache_updated) {
+      if(write_flux_cache(fCacheFile, cache)) {
+        LOG("Flux", pNOTICE) << "Cached the flux histograms in: " << fCacheFile;
+      } else {
+        LOG("Flux", pWARN) << "Could not write the flux cache file: " << fCacheFile;
+      }
+    }
+
     LOG("Flux", pNOTICE)
           << "Atmospheric neutrino flux simulation data loaded!";
     this->AddAllFluxes();
@@ -517,6 +789,49 @@ bool GAtmoFlux::LoadFluxData(void)
   return false;
 }
 //___________________________________________________________________________
+unsigned long long GAtmoFlux::FluxCacheKey(
+  int nu_pdg, map<string, unsigned long long> & checksums)
+{
+// Key of the cached flux histogram of the input neutrino species: a hash of
+// the flux driver, the flux binning and the checksums of the data files the
+// species is read from, in order. The file checksums are kept in the input
+// map, as a file may hold several species (eg HAKKM)
+
+  uint64_t hash = 14695981039346656037ULL;
+
+  const char * driver = typeid(*this).name();
+  fnv1a(hash, driver, strlen(driver) + 1);
+  fnv1a(hash, (const char *) &nu_pdg, sizeof(nu_pdg));
+
+  fnv1a(hash, (const char *) &fNumEnergyBins,   sizeof(fNumEnergyBins));
+  fnv1a(hash, (const char *) &fNumCosThetaBins, sizeof(fNumCosThetaBins));
+  fnv1a(hash, (const char *) &fNumPhiBins,      sizeof(fNumPhiBins));
+  fnv1a(hash, (const char *) fEnergyBins,   (fNumEnergyBins  +1) * sizeof(double));
+  fnv1a(hash, (const char *) fCosThetaBins, (fNumCosThetaBins+1) * sizeof(double));
+  fnv1a(hash, (const char *) fPhiBins,      (fNumPhiBins     +1) * sizeof(double));
+
+  for( unsigned int n=0; n<fFluxFlavour.size(); n++ ){
+    if(fFluxFlavour.at(n) != nu_pdg) continue;
+    string filename = fFluxFile.at(n);
+    map<string, unsigned long long>::const_iterator it = checksums.find(filename);
+    uint64_t checksum = 0;
+    if(it != checksums.end()) {
+      checksum = it->second;
+    } else {
+      checksum = 14695981039346656037ULL;
+      std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
+      vector<char> buffer(1<<20);
+      while(in) {
+        in.read(&buffer[0], buffer.size());
+        fnv1a(checksum, &buffer[0], in.gcount());
+      }
+      checksums[filename] = checksum;
+    }
+    fnv1a(hash, (const char *) &checksum, sizeof(checksum));
+  }
+  return hash;
+}
+//___________________________________________________________________________
 TH3D* GAtmoFlux::CreateNormalisedFluxHisto(TH3D* hist)
 {
 // return integrated flux
@@ -587,6 +902,67 @@ void GAtmoFlux::AddAllFluxes(void)
   }
 
   fTotalFluxHistoIntg = fTotalFluxHisto->Integral();
+
+  this->BuildSamplingTables();
+}
+//___________________________________________________________________________
+void GAtmoFlux::BuildSamplingTables(void)
+{
+// Build the cumulative flux over all (Ev,costheta,phi) bins overlapping
+// the [MinEnergy(), MaxEnergy()] and cos(theta) windows and, for each such
+// bin, the cumulative flux fractions of the neutrino species. Bins only
+// partially within the windows are included with the fraction of their
+// (uniform in energy and cos(theta)) content falling within them. Used for generating unweighted flux
+// neutrinos with a single random trial.
+
+  fCdfFlux.clear();
+  fCdfBins.clear();
+  fCdfNu.clear();
+  if(!fTotalFluxHisto) return;
+
+  double emin = this->MinEnergy();
+  double emax = this->MaxEnergy();
+  unsigned int nnu = fPdgCList->size();
+
+  double sum = 0;
+  for(unsigned int ie = 0; ie < fNumEnergyBins; ie++) {
+    double elo = TMath::Max(fEnergyBins[ie],   emin);
+    double ehi = TMath::Min(fEnergyBins[ie+1], emax);
+    if(ehi <= elo) continue;
+    double frac = (ehi - elo) / (fEnergyBins[ie+1] - fEnergyBins[ie]);
+
+    for(unsigned int ic = 0; ic < fNumCosThetaBins; ic++) {
+      double clo = TMath::Max(fCosThetaBins[ic],   fMinCosThetaCut);
+      double chi = TMath::Min(fCosThetaBins[ic+1], fMaxCosThetaCut);
+      if(chi <= clo) continue;
+      double cfrac = (chi - clo) / (fCosThetaBins[ic+1] - fCosThetaBins[ic]);
+
+      for(unsigned int ip = 0; ip < fNumPhiBins; ip++) {
+        double flux = frac * cfrac *
+           fTotalFluxHisto->GetBinContent(ie+1, ic+1, ip+1);
+        if(flux <= 0) continue;
+
+        sum += flux;
+        fCdfFlux.push_back(sum);
+        fCdfBins.push_back(ie);
+        fCdfBins.push_back(ic);
+        fCdfBins.push_back(ip);
+
+        double sumnu = 0;
+        map<int,TH3D*>::iterator it = fFluxHistoMap.begin();
+        for( ; it != fFluxHistoMap.end(); ++it) {
+          sumnu += it->second->GetBinContent(ie+1, ic+1, ip+1);
+          fCdfNu.push_back(sumnu);
+        }
+      }
+    }
+  }
+  assert(fCdfNu.size() == nnu * fCdfFlux.size());
+
+  LOG("Flux", pNOTICE)
+    << "Built flux sampling tables: " << fCdfFlux.size() 
+    << " bins within [" << emin << ", " << emax << "] GeV, cos(theta) within ["
+    << fMinCosThetaCut << ", " << fMaxCosThetaCut << "]";
 }
 //___________________________________________________________________________
 TH3D * GAtmoFlux::CreateFluxHisto(string name, string title)
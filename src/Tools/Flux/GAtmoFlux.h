@@ -22,9 +22,14 @@
              origin: detector centre
           Alternative user-defined topocentric systems can
           be defined by specifying the appropriate rotation from THZ.
-          The driver allows minimum and maximum energy cuts.
+          The driver allows minimum and maximum energy and cos(zenith angle)
+          cuts.
           Also it provides the options to generate wither unweighted or weighted 
           flux neutrinos (the latter giving smoother distributions at the tails).
+          The flux histograms filled from the input data files can be cached
+          in a binary file (see SetCacheFile() or the $GATMOFLUXCACHE variable)
+          and are then reloaded from it, rather than parsed again, as long as
+          the data files and the flux binning have not changed.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
@@ -75,6 +80,8 @@ public :
   virtual long int               Index         (void) { return -1;         }
   virtual void                   Clear            (Option_t * opt);
   virtual void                   GenerateWeighted (bool gen_weighted);
+  virtual bool                   SaveState        (TDirectory * dir) const;
+  virtual bool                   RestoreState     (TDirectory * dir);
 
   // get neutrino energy/direction of generated events
   double Enu        (void) { return fgP4.Energy(); }
@@ -86,11 +93,15 @@ public :
   long int NFluxNeutrinos     (void) const; ///< Number of flux nu's generated. Not the same as the number of nu's thrown towards the geometry (if there are cuts).
   void     ForceMinEnergy     (double emin);
   void     ForceMaxEnergy     (double emax);
+  void     ForceMinCosTheta   (double cmin);
+  void     ForceMaxCosTheta   (double cmax);
+  double   SelectedFlux       (void) const; ///< Flux (summed over the flux histogram bins) within the energy and cos(theta) cuts. For normalizing samples generated with different cuts.
   void     SetSpectralIndex   (double index); 
   void     SetRadii           (double Rlongitudinal, double Rtransverse);
   void     SetUserCoordSystem (TRotation & rotation); ///< Rotation: Topocentric Horizontal -> User-defined Topocentric Coord System.
   void     AddFluxFile        (int neutrino_pdg, string filename);
   void     AddFluxFile        (string filename);
+  void     SetCacheFile       (string filename); ///< Binary file caching the flux histograms across jobs ("": no cache).
   bool     LoadFluxData       (void);
 
   TH3D*    GetFluxHistogram   (int flavour);
@@ -115,6 +126,8 @@ protected:
   void    AddAllFluxes      (void);
   int     SelectNeutrino    (double Ev, double costheta, double phi); 
   TH3D*   CreateNormalisedFluxHisto ( TH3D* hist);  // normalise flux files
+  void    BuildSamplingTables (void);           // cumulative tables for unweighted flux
+  unsigned long long FluxCacheKey (int nu_pdg, map<string, unsigned long long> & checksums);
 
   // pure virtual methods; to be implemented by concrete flux drivers
   virtual bool FillFluxHisto (int nu_pdg, string filename) = 0;
@@ -129,6 +142,8 @@ protected:
   long int         fNNeutrinos;         ///< number of flux neutrinos thrown so far
   double           fMaxEvCut;           ///< user-defined cut: maximum energy 
   double           fMinEvCut;           ///< user-defined cut: minimum energy  
+  double           fMaxCosThetaCut;     ///< user-defined cut: maximum cos(theta)
+  double           fMinCosThetaCut;     ///< user-defined cut: minimum cos(theta)
   double           fRl;                 ///< defining flux neutrino generation surface: longitudinal radius
   double           fRt;                 ///< defining flux neutrino generation surface: transverse radius
   TRotation        fRotTHz2User;        ///< coord. system rotation: THZ -> Topocentric user-defined
@@ -144,9 +159,13 @@ protected:
   TH3D *           fTotalFluxHisto;     ///< flux = f(Ev,cos8,phi) summed over neutrino species
   double           fTotalFluxHistoIntg; ///< fFluxSum2D integral 
   map<int, TH3D*>  fFluxHistoMap;       ///< flux = f(Ev,cos8,phi) for each neutrino species
+  vector<double>   fCdfFlux;            ///< cumulative flux over the (Ev,cos8,phi) bins within the energy and cos8 cuts
+  vector<int>      fCdfBins;            ///< (Ev,cos8,phi) bin numbers for each fCdfFlux entry
+  vector<double>   fCdfNu;              ///< cumulative neutrino species fractions for each fCdfFlux entry
   map<int, TH3D*>  fRawFluxHistoMap;    ///< flux = f(Ev,cos8,phi) for each neutrino species
   vector<int>      fFluxFlavour;        ///< input flux file for each neutrino species
   vector<string>   fFluxFile;           ///< input flux file for each neutrino species
+  string           fCacheFile;          ///< binary file caching the flux histograms
 };
 
 } // flux namespace
@@ -0,0 +1,681 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <cstring>
+#include <cassert>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <TMath.h>
+
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Utils/PrintUtils.h"
+#include "Tools/Flux/GCompactFlux.h"
+
+#include "Tools/Flux/GFluxDriverFactory.h"
+FLUXDRIVERREG4(genie,flux,GCompactFlux,genie::flux::GCompactFlux)
+
+using namespace genie;
+using namespace genie::flux;
+
+//____________________________________________________________________________
+// Layout of the compact flux file (all numbers in native byte order, which
+// is checked at load time using the byte-order mark):
+//   header, padded to data_offset
+//   blocks : nblocks blocks of block_size entries (the last one is padded),
+//            each one holding the following columns in turn:
+//              9 x double  : E, px, py, pz, x, y, z, wgt, dist
+//              1 x int64   : entry # in the original beam sim file
+//              2 x int32   : pdg code, original beam sim file #
+//
+namespace {
+  const char     kCmpFlxMagic[8] = { 'G','N','F','L','X','C','M','P' };
+  const uint32_t kCmpFlxVersion  = 1;
+  const uint32_t kCmpFlxBOM      = 0x01020304;
+  const uint32_t kCmpFlxMaxPdg   = 8;
+  const int      kCmpFlxNDCols   = 9;
+
+  struct CmpFlxHeader_t {
+    char     magic[8];
+    uint32_t version;
+    uint32_t bom;
+    uint64_t block_size;
+    uint64_t nentries;
+    uint64_t nblocks;
+    uint64_t data_offset;
+    uint64_t file_size;
+    double   pots;
+    double   max_energy;
+    double   min_weight;
+    double   max_weight;
+    uint32_t has_window;
+    uint32_t npdg;
+    int32_t  pdg[kCmpFlxMaxPdg];
+    double   window[9];
+  };
+
+  inline uint64_t CmpFlxDataOffset(void)
+  {
+    return (sizeof(CmpFlxHeader_t) + 63) & ~63ULL;
+  }
+  inline uint64_t CmpFlxBlockStride(uint64_t bs)
+  {
+    return bs * (kCmpFlxNDCols*sizeof(double) + sizeof(int64_t) + 2*sizeof(int32_t));
+  }
+}
+//____________________________________________________________________________
+GCompactFlux::GCompactFlux() :
+  GFluxExposureI(genie::flux::kPOTs)
+{
+  this->Initialize();
+}
+//___________________________________________________________________________
+GCompactFlux::~GCompactFlux()
+{
+  this->CleanUp();
+}
+//___________________________________________________________________________
+double GCompactFlux::GetTotalExposure() const
+{
+  // complete the GFluxExposureI interface
+  return UsedPOTs();
+}
+//___________________________________________________________________________
+long int GCompactFlux::NFluxNeutrinos(void) const
+{
+  ///< number of flux neutrinos looped so far
+  return fNNeutrinos;
+}
+//___________________________________________________________________________
+bool GCompactFlux::GenerateNext(void)
+{
+// Get next (unweighted) flux entry
+//
+  RandomGen* rnd = RandomGen::Instance();
+  while ( true ) {
+     if ( this->End() ) {
+       LOG("Flux", pNOTICE) << "GenerateNext signaled End() ";
+       return false;
+     }
+
+     // Get next weighted flux entry
+     bool nextok = this->GenerateNext_weighted();
+     if ( fGenWeighted ) return nextok;
+     if ( ! nextok ) continue;
+     if ( fAlreadyUnwgt ) return true;
+
+     // Get fractional weight & decide whether to accept curr flux neutrino
+     double f = fWeight / fMaxWeight;
+     if (f > 1.) {
+       fMaxWeight = fWeight * 1.01; // bump the weight
+       LOG("Flux", pERROR)
+         << "** Fractional weight = " << f
+         << " > 1 !! Bump fMaxWeight estimate to " << fMaxWeight;
+     }
+     double r = (f < 1.) ? rnd->RndFlux().Rndm() : 0;
+     if ( r < f ) {
+       fWeight = 1.;
+       return true;
+     }
+  }
+  return false;
+}
+//___________________________________________________________________________
+bool GCompactFlux::GenerateNext_weighted(void)
+{
+// Get next (weighted) flux entry
+//
+  if ( fFiles.empty() ) {
+     LOG("Flux", pFATAL)
+          << "The flux driver has not been properly configured";
+     exit(1);
+  }
+
+  if ( fIUse < fNUse && fIEntry >= 0 ) {
+    // Reuse this entry (restoring the position, which MoveToZ0 may change)
+    fIUse++;
+    this->ReadEntry(fIEntry);
+  } else {
+    fIEntry = this->NextEntryInRange(fIEntry,fNEntries);
+    ++fNEntriesUsed;
+    if ( fIEntry >= fNEntries ) {
+      // Ran out of entries @ the current cycle of the flux files
+      if (fICycle < fNCycles || fNCycles == 0 ) {
+        fICycle++;
+        fIEntry = this->NextEntryInRange(-1,fNEntries);
+      } else {
+        LOG("Flux", pWARN)
+          << "No more entries in input compact flux files, cycle "
+          << fICycle << " of " << fNCycles;
+        fEnd = true;
+        return false;
+      }
+    }
+    this->ReadEntry(fIEntry);
+    fIUse = 1;
+
+    // update the # POTs, sum of weights & number of neutrinos before
+    // rejecting flavors, in order to keep the POT accounting correct
+    fAccumPOTs += fEffPOTsPerNu;
+    fSumWeight += fWeight;
+    fNNeutrinos++;
+
+    if ( ! fPdgCList->ExistsInPDGCodeList(fPdgC) ) {
+      if ( ! fPdgCListRej->ExistsInPDGCodeList(fPdgC) ) {
+        fPdgCListRej->push_back(fPdgC);
+        LOG("Flux", pWARN)
+          << "Encountered neutrino specie (" << fPdgC
+          << ") that wasn't in SetFluxParticles() list, "
+          << "\nDeclared list of neutrino species: " << *fPdgCList;
+      }
+      return false;
+    }
+  }
+
+  // if desired, move to user specified user coord z
+  if ( TMath::Abs(fZ0) < 1.0e30 ) this->MoveToZ0(fZ0);
+
+  if ( fP4.E() > fMaxEv ) {
+    LOG("Flux", pFATAL)
+      << "Generated neutrino had E_nu = " << fP4.E() << " > " << fMaxEv
+      << " maximum ";
+    assert(0);
+  }
+  return true;
+}
+//___________________________________________________________________________
+bool GCompactFlux::GenerateEntry(long int index)
+{
+// Random access to the (weighted) flux entry with the input index
+//
+  if ( index < 0 || index >= fNEntries ) return false;
+
+  fIEntry = index;
+  this->ReadEntry(fIEntry);
+  if ( TMath::Abs(fZ0) < 1.0e30 ) this->MoveToZ0(fZ0);
+  return true;
+}
+//___________________________________________________________________________
+int GCompactFlux::GenerateBatch(int n, FluxBatch & batch)
+{
+// Fill the batch straight from the current entry, with no virtual calls
+//
+  batch.Clear();
+  while ( batch.N() < n && ! fEnd ) {
+    if ( ! this->GCompactFlux::GenerateNext() ) continue;
+    batch.Add(fPdgC, fP4, fX4, fWeight, fIEntry);
+  }
+  return batch.N();
+}
+//___________________________________________________________________________
+void GCompactFlux::ReadEntry(long int index)
+{
+// Copy the fields of the input entry from the mapped columns
+//
+  int ifile = std::upper_bound(fFileFirstEntry.begin(), fFileFirstEntry.end(), index)
+            - fFileFirstEntry.begin() - 1;
+  const MappedFile_t & mf = fFiles[ifile];
+
+  long int bs    = mf.block_size;
+  long int local = index - fFileFirstEntry[ifile];
+  long int i     = local % bs;
+  const char *   block = mf.data + (local / bs) * CmpFlxBlockStride(bs);
+  const double * dcol  = (const double *) block;
+
+  fP4.SetPxPyPzE(dcol[1*bs+i], dcol[2*bs+i], dcol[3*bs+i], dcol[0*bs+i]);
+  fX4.SetXYZT   (dcol[4*bs+i], dcol[5*bs+i], dcol[6*bs+i], 0);
+  fWeight    = dcol[7*bs+i];
+  fDist      = dcol[8*bs+i];
+
+  const char * icols = block + kCmpFlxNDCols * bs * sizeof(double);
+  fOrigEntry = ((const int64_t *) icols)[i];
+  icols += bs * sizeof(int64_t);
+  fPdgC      = ((const int32_t *) icols)[i];
+  icols += bs * sizeof(int32_t);
+  fOrigFile  = ((const int32_t *) icols)[i];
+}
+//___________________________________________________________________________
+void GCompactFlux::MoveToZ0(double z0usr)
+{
+  // move ray origin to specified user z0
+
+  double pzusr = fP4.Pz();
+  if ( TMath::Abs(pzusr) < 1.0e-30 ) {
+    // neutrino is moving almost entirely in x-y plane
+    LOG("Flux", pWARN)
+      << "MoveToZ0(" << z0usr << ") not possible due to pz_usr (" << pzusr << ")";
+    return;
+  }
+  double scale = (z0usr - fX4.Z()) / pzusr;
+  fX4 += (scale*fP4);
+  fDist += scale*fP4.P();
+
+  // this scaling works for distances, but not the time component
+  fX4.SetT(0);
+}
+//___________________________________________________________________________
+double GCompactFlux::UsedPOTs(void) const
+{
+// Compute current number of flux POTs
+
+  if ( fFiles.empty() ) {
+     LOG("Flux", pWARN)
+          << "The flux driver has not been properly configured";
+     return 0;
+  }
+  return fAccumPOTs;
+}
+//___________________________________________________________________________
+bool GCompactFlux::IsCompactFluxFile(const string & filename)
+{
+// Check whether the input file is a compact flux file
+
+  std::ifstream inp(filename.c_str(), std::ios::in | std::ios::binary);
+  if(!inp.is_open()) return false;
+  char magic[8];
+  inp.read(magic, sizeof(magic));
+  if(!inp.good()) return false;
+  return (memcmp(magic, kCmpFlxMagic, sizeof(magic)) == 0);
+}
+//___________________________________________________________________________
+bool GCompactFlux::MapFile(const string & filename)
+{
+// Map a compact flux file and merge its header information
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if(fd < 0) {
+    LOG("Flux", pERROR) << "Compact flux file not found: " << filename;
+    return false;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t) st.st_size < CmpFlxDataOffset()) {
+    LOG("Flux", pERROR) << "Compact flux file is empty or truncated: " << filename;
+    close(fd);
+    return false;
+  }
+  size_t size = st.st_size;
+  void * addr = mmap(0, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if(addr == MAP_FAILED) {
+    LOG("Flux", pERROR) << "Compact flux file could not be mapped: " << filename;
+    return false;
+  }
+
+  const CmpFlxHeader_t * header = (const CmpFlxHeader_t *) addr;
+  bool valid =
+     memcmp(header->magic, kCmpFlxMagic, sizeof(header->magic)) == 0 &&
+     header->version    == kCmpFlxVersion &&
+     header->bom        == kCmpFlxBOM     &&
+     header->file_size  == size           &&
+     header->block_size >  0              &&
+     header->data_offset + header->nblocks * CmpFlxBlockStride(header->block_size) == size &&
+     header->nentries   <= header->nblocks * header->block_size;
+  if(!valid) {
+    LOG("Flux", pERROR)
+      << "Invalid, incompatible or truncated compact flux file: " << filename;
+    munmap(addr, size);
+    return false;
+  }
+
+  MappedFile_t mf;
+  mf.name       = filename;
+  mf.addr       = addr;
+  mf.size       = size;
+  mf.data       = (const char *) addr + header->data_offset;
+  mf.nentries   = header->nentries;
+  mf.block_size = header->block_size;
+
+  fFileFirstEntry.push_back(fNEntries);
+  fFiles.push_back(mf);
+  fNEntries += mf.nentries;
+  fFilePOTs += header->pots;
+
+  fMaxEv     = TMath::Max(fMaxEv,     header->max_energy);
+  fMaxWeight = TMath::Max(fMaxWeight, header->max_weight);
+  if ( header->min_weight != 1.0 || header->max_weight != 1.0 ) fAlreadyUnwgt = false;
+  for (uint32_t i = 0; i < header->npdg && i < kCmpFlxMaxPdg; ++i) {
+    if ( ! fPdgCList->ExistsInPDGCodeList(header->pdg[i]) )
+      fPdgCList->push_back(header->pdg[i]);
+  }
+
+  LOG("Flux", pINFO)
+    << "Mapped " << mf.nentries << " entries (" << header->pots
+    << " POTs) from compact flux file: " << filename;
+  return true;
+}
+//___________________________________________________________________________
+void GCompactFlux::LoadBeamSimData(const std::vector<string>& filenames,
+                                   const std::string&         det_loc)
+{
+// Map the input compact flux files. The detector location was fixed when
+// the files were written, so det_loc only serves to pass the config option
+// "no-offset-index" (start from the first entry rather than a random one)
+
+  LOG("Flux", pNOTICE)
+    << "Loading compact flux files (det_loc = \"" << det_loc << "\")";
+
+  fAlreadyUnwgt = true;
+  for (size_t i = 0; i < filenames.size(); ++i) {
+    if ( ! this->MapFile(filenames[i]) ) {
+      LOG("Flux", pFATAL) << "Can't load compact flux file: " << filenames[i];
+      exit(1);
+    }
+  }
+  if ( fNEntries == 0 ) {
+    LOG("Flux", pFATAL) << "No entries in the input compact flux files";
+    exit(1);
+  }
+  fEffPOTsPerNu = fFilePOTs / (double) fNEntries;
+
+  // pick a starting entry index [0:fNEntries-1]
+  // pretend we just used up the the previous one
+  RandomGen* rnd = RandomGen::Instance();
+  fICycle = 0;
+  fIUse   = 9999999;
+  fIEntry = rnd->RndFlux().Integer(fNEntries) - 1;
+  if ( det_loc.find("no-offset-index") != string::npos ) fIEntry = -1;
+  if ( fUseEntryRange ) {
+    // start from the beginning of the range
+    fIEntry = -1;
+    if ( this->NEntriesInRange(fNEntries) == 0 ) {
+      LOG("Flux", pFATAL) << "No flux entries in the requested entry range";
+      exit(1);
+    }
+  }
+
+  LOG("Flux",pINFO) << "Start with entry fIEntry=" << fIEntry;
+
+  this->PrintConfig();
+}
+//___________________________________________________________________________
+void GCompactFlux::SetMaxEnergy(double Ev)
+{
+  fMaxEv = TMath::Max(0.,Ev);
+
+  LOG("Flux", pINFO)
+    << "Declared maximum flux neutrino energy: " << fMaxEv;
+}
+//___________________________________________________________________________
+void GCompactFlux::SetEntryReuse(long int nuse)
+{
+// With nuse > 1 then the same entry in the file is used "nuse" times
+// before moving on to the next entry
+
+  fNUse = TMath::Max(1L, nuse);
+}
+//___________________________________________________________________________
+void GCompactFlux::PrintConfig(void)
+{
+  std::ostringstream s;
+  PDGCodeList::const_iterator itr = fPdgCList->begin();
+  for ( ; itr != fPdgCList->end(); ++itr) s << (*itr) << " ";
+  s << "[rejected: ";
+  itr = fPdgCListRej->begin();
+  for ( ; itr != fPdgCListRej->end(); ++itr) s << (*itr) << " ";
+  s << " ] ";
+
+  std::ostringstream flistout;
+  for (size_t i = 0; i < fFiles.size(); ++i)
+    flistout << "\n [" << std::setw(3) << i << "] " << fFiles[i].name
+             << " (" << fFiles[i].nentries << " entries)";
+
+  LOG("Flux", pNOTICE)
+    << "GCompactFlux Config:"
+    << "\n Enu_max " << fMaxEv
+    << "\n pdg-codes: " << s.str()
+    << "\n " << fNEntries << " entries (FilePOTs " << fFilePOTs << ") in files:"
+    << flistout.str()
+    << "\n wgt max=" << fMaxWeight
+    << "\n Z0 pushback " << fZ0
+    << "\n used entry " << fIEntry << " " << fIUse << "/" << fNUse
+    << " times, in " << fICycle << "/" << fNCycles << " cycles"
+    << "\n SumWeight " << fSumWeight << " for " << fNNeutrinos << " neutrinos"
+    << " with " << fNEntriesUsed << " entries read"
+    << "\n EffPOTsPerNu " << fEffPOTsPerNu << " AccumPOTs " << fAccumPOTs
+    << "\n GenWeighted \"" << (fGenWeighted?"true":"false") << "\""
+    << " AlreadyUnwgt \"" << (fAlreadyUnwgt?"true":"false") << "\"";
+}
+//___________________________________________________________________________
+void GCompactFlux::Clear(Option_t * opt)
+{
+// Clear the driver state
+//
+  LOG("Flux", pWARN) << "GCompactFlux::Clear(" << opt << ") called";
+
+  fICycle     = 0;
+  fSumWeight  = 0;
+  fNNeutrinos = 0;
+  fAccumPOTs  = 0;
+}
+//___________________________________________________________________________
+void GCompactFlux::GenerateWeighted(bool gen_weighted)
+{
+// Set whether to generate weighted rays
+//
+  fGenWeighted = gen_weighted;
+}
+//___________________________________________________________________________
+void GCompactFlux::Initialize(void)
+{
+  LOG("Flux", pINFO) << "Initializing GCompactFlux driver";
+
+  fMaxEv         =  0;
+  fEnd           =  false;
+  fNEntries      =  0;
+  fIEntry        = -1;
+  fFilePOTs      =  0;
+  fMaxWeight     =  0;
+  fAlreadyUnwgt  =  false;
+  fNUse          =  1;
+  fIUse          =  999999;
+  fSumWeight     =  0;
+  fNNeutrinos    =  0;
+  fNEntriesUsed  =  0;
+  fEffPOTsPerNu  =  0;
+  fAccumPOTs     =  0;
+  fGenWeighted   =  false;
+
+  this->SetUpstreamZ   (-3.4e38); // way upstream ==> use stored position
+  this->SetNumOfCycles (0);
+  this->ResetCurrent();
+}
+//___________________________________________________________________________
+void GCompactFlux::ResetCurrent(void)
+{
+// reset running values of neutrino pdg-code, 4-position & 4-momentum
+
+  fPdgC      = 0;
+  fWeight    = 0;
+  fDist      = 0;
+  fOrigFile  = -1;
+  fOrigEntry = -1;
+  fP4.SetPxPyPzE(0.,0.,0.,0.);
+  fX4.SetXYZT(0.,0.,0.,0.);
+}
+//___________________________________________________________________________
+void GCompactFlux::CleanUp(void)
+{
+  LOG("Flux", pINFO) << "Cleaning up...";
+
+  for (size_t i = 0; i < fFiles.size(); ++i) {
+    munmap(fFiles[i].addr, fFiles[i].size);
+  }
+  fFiles.clear();
+  fFileFirstEntry.clear();
+
+  if (fPdgCList)    delete fPdgCList;
+  if (fPdgCListRej) delete fPdgCListRej;
+  fPdgCList    = 0;
+  fPdgCListRej = 0;
+}
+//___________________________________________________________________________
+// GCompactFluxWriter
+//___________________________________________________________________________
+GCompactFluxWriter::GCompactFluxWriter(const string & filename, long int block_size) :
+fOut       (filename.c_str(), std::ios::out | std::ios::binary),
+fFileName  (filename),
+fBlockSize (TMath::Max(1L, block_size)),
+fNEntries  (0),
+fNInBlock  (0),
+fNBlocks   (0),
+fPOTs      (0),
+fMaxEv     (0),
+fMinWeight (0),
+fMaxWeight (0),
+fHasWindow (false)
+{
+  if ( ! fOut.is_open() ) {
+    LOG("Flux", pERROR) << "Couldn't create compact flux file: " << filename;
+    return;
+  }
+  for (int i = 0; i < 9; ++i) fWindow[i] = 0;
+
+  fDCols    .resize(kCmpFlxNDCols * fBlockSize, 0.);
+  fEntryCol .resize(fBlockSize, 0);
+  fPdgCol   .resize(fBlockSize, 0);
+  fFileCol  .resize(fBlockSize, 0);
+
+  // reserve space for the header, rewritten on Close()
+  this->WriteHeader();
+}
+//___________________________________________________________________________
+GCompactFluxWriter::~GCompactFluxWriter()
+{
+  this->Close();
+}
+//___________________________________________________________________________
+void GCompactFluxWriter::SetFluxWindow(
+    const TVector3 & p0, const TVector3 & p1, const TVector3 & p2)
+{
+  // record the flux window (3 points, user coordinates) for reference
+  const TVector3 * p[3] = { &p0, &p1, &p2 };
+  for (int i = 0; i < 3; ++i) {
+    fWindow[3*i+0] = p[i]->X();
+    fWindow[3*i+1] = p[i]->Y();
+    fWindow[3*i+2] = p[i]->Z();
+  }
+  fHasWindow = true;
+}
+//___________________________________________________________________________
+void GCompactFluxWriter::Fill(
+    int pdg, const TLorentzVector & p4, const TLorentzVector & x4,
+    double wgt, double dist, int ifile, long int ientry)
+{
+  if ( ! fOut.is_open() ) return;
+
+  long int bs = fBlockSize;
+  long int i  = fNInBlock;
+  fDCols[0*bs+i] = p4.E();
+  fDCols[1*bs+i] = p4.Px();
+  fDCols[2*bs+i] = p4.Py();
+  fDCols[3*bs+i] = p4.Pz();
+  fDCols[4*bs+i] = x4.X();
+  fDCols[5*bs+i] = x4.Y();
+  fDCols[6*bs+i] = x4.Z();
+  fDCols[7*bs+i] = wgt;
+  fDCols[8*bs+i] = dist;
+  fEntryCol[i]   = ientry;
+  fPdgCol[i]     = pdg;
+  fFileCol[i]    = ifile;
+
+  if ( fNEntries == 0 ) {
+    fMinWeight = wgt;
+    fMaxWeight = wgt;
+  }
+  fMaxEv     = TMath::Max(fMaxEv, p4.E());
+  fMinWeight = TMath::Min(fMinWeight, wgt);
+  fMaxWeight = TMath::Max(fMaxWeight, wgt);
+  if ( std::find(fPdgCodes.begin(), fPdgCodes.end(), pdg) == fPdgCodes.end() ) {
+    fPdgCodes.push_back(pdg);
+  }
+
+  fNEntries++;
+  if ( ++fNInBlock == fBlockSize ) this->FlushBlock();
+}
+//___________________________________________________________________________
+void GCompactFluxWriter::FlushBlock(void)
+{
+  if ( fNInBlock == 0 ) return;
+
+  // pad the (last) block
+  long int bs = fBlockSize;
+  for (long int i = fNInBlock; i < bs; ++i) {
+    for (int c = 0; c < kCmpFlxNDCols; ++c) fDCols[c*bs+i] = 0;
+    fEntryCol[i] = -1;
+    fPdgCol[i]   =  0;
+    fFileCol[i]  = -1;
+  }
+  fOut.write((const char *) &fDCols[0],    fDCols.size()    * sizeof(double));
+  fOut.write((const char *) &fEntryCol[0], fEntryCol.size() * sizeof(int64_t));
+  fOut.write((const char *) &fPdgCol[0],   fPdgCol.size()   * sizeof(int32_t));
+  fOut.write((const char *) &fFileCol[0],  fFileCol.size()  * sizeof(int32_t));
+
+  fNBlocks++;
+  fNInBlock = 0;
+}
+//___________________________________________________________________________
+void GCompactFluxWriter::WriteHeader(void)
+{
+  CmpFlxHeader_t header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, kCmpFlxMagic, sizeof(header.magic));
+  header.version     = kCmpFlxVersion;
+  header.bom         = kCmpFlxBOM;
+  header.block_size  = fBlockSize;
+  header.nentries    = fNEntries;
+  header.nblocks     = fNBlocks;
+  header.data_offset = CmpFlxDataOffset();
+  header.file_size   = CmpFlxDataOffset() + fNBlocks * CmpFlxBlockStride(fBlockSize);
+  header.pots        = fPOTs;
+  header.max_energy  = fMaxEv;
+  header.min_weight  = fMinWeight;
+  header.max_weight  = fMaxWeight;
+  header.has_window  = (fHasWindow ? 1 : 0);
+  header.npdg        = TMath::Min((size_t)kCmpFlxMaxPdg, fPdgCodes.size());
+  for (uint32_t i = 0; i < header.npdg; ++i) header.pdg[i] = fPdgCodes[i];
+  for (int i = 0; i < 9; ++i) header.window[i] = fWindow[i];
+
+  char pad[64];
+  memset(pad, 0, sizeof(pad));
+  fOut.write((const char *) &header, sizeof(header));
+  fOut.write(pad, CmpFlxDataOffset() - sizeof(header));
+}
+//___________________________________________________________________________
+void GCompactFluxWriter::Close(void)
+{
+  if ( ! fOut.is_open() ) return;
+
+  this->FlushBlock();
+  fOut.seekp(0);
+  this->WriteHeader();
+  fOut.close();
+
+  if ( fPdgCodes.size() > kCmpFlxMaxPdg ) {
+    LOG("Flux", pWARN)
+      << "Only the first " << kCmpFlxMaxPdg << " of " << fPdgCodes.size()
+      << " neutrino species are listed in the header of " << fFileName;
+  }
+  LOG("Flux", pNOTICE)
+    << "Wrote " << fNEntries << " entries in " << fNBlocks
+    << " blocks to compact flux file: " << fFileName;
+}
+//___________________________________________________________________________
@@ -0,0 +1,216 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::flux::GCompactFlux
+
+\brief    A GENIE flux driver reading a compact, columnar, memory-mapped
+          flux file.
+
+          The compact files hold only what the event generation needs (pdg
+          code, 4-momentum, 4-position, weight and decay distance) plus the
+          (file,entry) index of each ray in the original beam simulation
+          ntuples, where the full ancestry information remains available.
+          Entries are grouped in fixed-size blocks, each one storing its
+          fields as contiguous columns. Files are mapped read-only, so that
+          many jobs on the same node share a single copy in the page cache,
+          and any entry can be accessed in constant time (GenerateEntry()).
+
+          Compact files are written by GCompactFluxWriter (see the
+          gfluxcompact utility, converting gsimple and gnumi ntuples).
+          Positions and momenta are stored in the user coordinate system of
+          the detector location chosen at conversion time.
+
+\author   Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _G_COMPACT_FLUX_H_
+#define _G_COMPACT_FLUX_H_
+
+#include <string>
+#include <vector>
+#include <fstream>
+#include <stdint.h>
+
+#include <TLorentzVector.h>
+#include <TVector3.h>
+
+#include "Framework/EventGen/GFluxI.h"
+#include "Tools/Flux/GFluxExposureI.h"
+#include "Tools/Flux/GFluxFileConfigI.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+
+using std::string;
+using std::vector;
+
+namespace genie {
+namespace flux  {
+
+/// GCompactFlux:
+/// ==========
+/// An implementation of the GFluxI interface reading compact flux files
+///
+class GCompactFlux
+  : public genie::GFluxI
+  , public genie::flux::GFluxExposureI
+  , public genie::flux::GFluxFileConfigI
+{
+
+public :
+  GCompactFlux();
+ ~GCompactFlux();
+
+  // Methods implementing the GENIE GFluxI interface
+
+  const PDGCodeList &    FluxParticles (void) { return *fPdgCList; }
+  double                 MaxEnergy     (void) { return  fMaxEv;    }
+  bool                   GenerateNext  (void);
+  int                    PdgCode       (void) { return  fPdgC;     }
+  double                 Weight        (void) { return  fWeight;   }
+  const TLorentzVector & Momentum      (void) { return  fP4;       }
+  const TLorentzVector & Position      (void) { return  fX4;       }
+  bool                   End           (void) { return  fEnd;      }
+  long int               Index         (void) { return  fIEntry;   }
+  void                   Clear            (Option_t * opt);
+  void                   GenerateWeighted (bool gen_weighted);
+  bool                   GenerateEntry    (long int index);
+  int                    GenerateBatch    (int n, FluxBatch & batch);
+
+  //
+  // information about the current entry
+  //
+  double    GetDecayDist       (void) const { return fDist;       } ///< dist (user units) from dk to current pos
+  int       OriginalFileIndex  (void) const { return fOrigFile;   } ///< file # in the original list of beam sim files
+  long int  OriginalEntry      (void) const { return fOrigEntry;  } ///< entry # in the original beam sim file
+  void      MoveToZ0           (double z0);                          ///< move ray origin to user coord Z0
+
+  //
+  // information about the current state
+  //
+  virtual double    GetTotalExposure() const;  ///< GFluxExposureI interface
+  virtual long int  NFluxNeutrinos() const;    ///< # of rays generated
+
+  double    UsedPOTs     (void) const;                          ///< # of protons-on-target used
+  long int  NEntries     (void) const { return fNEntries;     } ///< # of entries in all files
+  long int  NEntriesUsed (void) const { return fNEntriesUsed; } ///< # of entries read from files
+  double    SumWeight    (void) const { return fSumWeight;    } ///< integrated weight for flux neutrinos looped so far
+
+  void      PrintConfig  (void);                                ///< print the current configuration
+
+  //
+  // GFluxFileConfigI interface
+  //
+  virtual void  LoadBeamSimData(const std::vector<string>& filenames,
+                                const std::string&         det_loc);
+  using GFluxFileConfigI::LoadBeamSimData; // inherit the rest
+
+  //
+  // configuration of GCompactFlux
+  //
+  void      SetMaxEnergy  (double Ev);        ///< specify maximum flux neutrino energy
+  void      SetEntryReuse (long int nuse=1);  ///< # of times to use entry before moving to next
+
+  static bool IsCompactFluxFile(const string & filename);
+
+private:
+
+  // A mapped compact flux file
+  struct MappedFile_t {
+    string         name;
+    void *         addr;
+    size_t         size;
+    const char *   data;        ///< start of the first block
+    long int       nentries;
+    long int       block_size;
+  };
+
+  bool GenerateNext_weighted (void);
+  void ReadEntry             (long int index);
+  void Initialize            (void);
+  void CleanUp               (void);
+  void ResetCurrent          (void);
+  bool MapFile               (const string & filename);
+
+  vector<MappedFile_t> fFiles;          ///< mapped compact files
+  vector<long int>     fFileFirstEntry; ///< global index of each file's first entry
+
+  double         fMaxEv;          ///< maximum energy
+  bool           fEnd;            ///< end condition reached
+  long int       fNEntries;       ///< number of entries in all files
+  long int       fIEntry;         ///< current entry
+  double         fFilePOTs;       ///< # of protons-on-target represented by all files
+  double         fMaxWeight;      ///< max flux neutrino weight in input files
+  bool           fAlreadyUnwgt;   ///< all input weights are 1
+
+  long int       fNUse;           ///< how often to use same entry in a row
+  long int       fIUse;           ///< current # of times an entry has been used
+  double         fSumWeight;      ///< sum of weights for nus thrown so far
+  long int       fNNeutrinos;     ///< number of flux neutrinos thrown so far
+  long int       fNEntriesUsed;   ///< number of entries read from files
+  double         fEffPOTsPerNu;   ///< what a entry is worth ...
+  double         fAccumPOTs;      ///< POTs used so far
+  bool           fGenWeighted;    ///< does GenerateNext() give weights?
+
+  int            fPdgC;           ///< current neutrino pdg code
+  double         fWeight;         ///< current neutrino weight
+  double         fDist;           ///< current decay distance
+  int            fOrigFile;       ///< current original file #
+  long int       fOrigEntry;      ///< current original entry #
+  TLorentzVector fP4;             ///< current neutrino 4-momentum
+  TLorentzVector fX4;             ///< current neutrino 4-position
+};
+
+/// GCompactFluxWriter:
+/// ==========
+/// Writes compact flux files, one block at a time
+///
+class GCompactFluxWriter
+{
+public :
+  GCompactFluxWriter(const string & filename, long int block_size = 65536);
+ ~GCompactFluxWriter();
+
+  bool      IsOpen      (void) const { return fOut.is_open(); }
+  long int  NEntries    (void) const { return fNEntries;      }
+
+  void      SetPOTs        (double pots) { fPOTs = pots; }
+  void      SetFluxWindow  (const TVector3 & p0, const TVector3 & p1, const TVector3 & p2);
+  void      Fill           (int pdg, const TLorentzVector & p4, const TLorentzVector & x4,
+                            double wgt, double dist, int ifile, long int ientry);
+  void      Close          (void);
+
+private:
+
+  void FlushBlock  (void);
+  void WriteHeader (void);
+
+  std::ofstream     fOut;
+  string            fFileName;
+  long int          fBlockSize;
+  long int          fNEntries;
+  long int          fNInBlock;
+  long int          fNBlocks;
+  double            fPOTs;
+  double            fMaxEv;
+  double            fMinWeight;
+  double            fMaxWeight;
+  bool              fHasWindow;
+  double            fWindow[9];
+  vector<int>       fPdgCodes;    ///< neutrino species seen so far
+  vector<double>    fDCols;       ///< E,px,py,pz,x,y,z,wgt,dist columns
+  vector<int64_t>   fEntryCol;
+  vector<int32_t>   fPdgCol;
+  vector<int32_t>   fFileCol;
+};
+
+} // flux namespace
+} // genie namespace
+
+#endif // _G_COMPACT_FLUX_H_
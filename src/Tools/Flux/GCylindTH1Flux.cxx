@@ -15,11 +15,18 @@
    Implemented dummy versions of the new GFluxI::Clear, GFluxI::Index and 
    GFluxI::GenerateWeighted methods needed for pre-generation of flux
    interaction probabilities in GMCJDriver.
+ @ Oct 14, 2026 - CA
+   The energy bin and the neutrino species are now selected together, in
+   constant time, from an alias table over the (bin,species) cells of the
+   input spectra, built when a spectrum is added. This replaces the
+   TH1D::GetRandom() binary search on the combined spectrum and the linear
+   search over the species at the selected energy. The energy is now
+   thrown from the flux random number stream.
 
 */
 //____________________________________________________________________________
 
-#include <cassert>
+#include <cstdlib>
 #include <algorithm>
 
 #include <TH1D.h>
@@ -56,18 +63,26 @@ bool GCylindTH1Flux::GenerateNext(void)
   //-- Reset previously generated neutrino code / 4-p / 4-x
   this->ResetSelection();
 
-  //-- Generate an energy from the 'combined' spectrum histogram
-  //   and compute the momentum vector
-  double Ev = (double) fTotSpectrum->GetRandom();
+  //-- Select an (energy bin, neutrino species) cell from the alias table,
+  //   generate an energy uniformly within the bin and compute the momentum
+  //   vector
+  RandomGen * rnd = RandomGen::Instance();
+
+  const int nnu  = fSpectrum.size();
+  const int cell = this->SelectCell();
+  const int ibin = cell / nnu;
+  const int inu  = cell % nnu;
+
+  double Elow = fBinEdges[ibin];
+  double Ev   = Elow + (fBinEdges[ibin+1] - Elow) * rnd->RndFlux().Rndm();
 
   TVector3 p3(*fDirVec); // momentum along the neutrino direction
   p3.SetMag(Ev);         // with |p|=Ev
 
   fgP4.SetPxPyPzE(p3.Px(), p3.Py(), p3.Pz(), Ev);
 
-  //-- Select a neutrino species from the flux fractions at the
-  //   selected energy
-  fgPdgC = (*fPdgCList)[this->SelectNeutrino(Ev)];
+  //-- The neutrino species was selected along with the energy bin
+  fgPdgC = (*fPdgCList)[inu];
 
   //-- Compute neutrino 4-x
 
@@ -236,40 +251,92 @@ void GCylindTH1Flux::AddAllFluxes(void)
      else       { fTotSpectrum->Add(spectrum);        }
      inu++;
   }
+
+  this->BuildAliasTable();
 }
 //___________________________________________________________________________
-int GCylindTH1Flux::SelectNeutrino(double Ev)
+void GCylindTH1Flux::BuildAliasTable(void)
 {
-  const unsigned int n = fPdgCList->size();
-  double fraction[n];
-
-  vector<TH1D *>::const_iterator spectrum_iter;
-
-  unsigned int inu=0;
-  for(spectrum_iter = fSpectrum.begin();
-                       spectrum_iter != fSpectrum.end(); ++spectrum_iter) {
-     TH1D * spectrum = *spectrum_iter;
-     fraction[inu++] = spectrum->GetBinContent(spectrum->FindBin(Ev));
+// Build an alias table (Vose's method) over all (energy bin, species) cells
+// of the input spectra, with probabilities proportional to the bin contents.
+// Cell c corresponds to energy bin c / nspecies and species c % nspecies.
+// All input spectra must share the same binning (as for AddAllFluxes).
+
+  fBinEdges.clear();
+  fAliasProb.clear();
+  fAliasIdx.clear();
+
+  const int nnu = fSpectrum.size();
+  if(nnu == 0) return;
+
+  const int nb = fSpectrum[0]->GetNbinsX();
+  fBinEdges.resize(nb+1);
+  for(int ib = 0; ib < nb; ib++) {
+     fBinEdges[ib] = fSpectrum[0]->GetBinLowEdge(ib+1);
   }
+  fBinEdges[nb] = fSpectrum[0]->GetBinLowEdge(nb)+fSpectrum[0]->GetBinWidth(nb);
 
+  const int n = nb * nnu;
+  vector<double> prob(n, 0.);
   double sum = 0;
-  for(inu = 0; inu < n; inu++) {
-     sum += fraction[inu];
-     fraction[inu] = sum;
-     LOG("Flux", pDEBUG) << "SUM-FRACTION(0->" << inu <<") = " << sum;
+  bool negative = false;
+  for(int ib = 0; ib < nb; ib++) {
+    for(int inu = 0; inu < nnu; inu++) {
+      double c = fSpectrum[inu]->GetBinContent(ib+1);
+      if(c < 0) { c = 0; negative = true; }
+      prob[ib*nnu+inu] = c;
+      sum += c;
+    }
+  }
+  if(negative) {
+     LOG("Flux", pWARN)
+        << "Negative flux bin contents were found and will never be sampled";
+  }
+  if(sum <= 0) {
+     LOG("Flux", pFATAL) << "The input flux spectra are empty!";
+     exit(1);
   }
 
-  RandomGen * rnd = RandomGen::Instance();
-  double R = sum * rnd->RndFlux().Rndm();
+  fAliasProb.resize(n);
+  fAliasIdx.resize(n);
 
-  LOG("Flux", pDEBUG) << "R e [0,SUM] = " << R;
+  vector<int> small, large;
+  for(int i = 0; i < n; i++) {
+    prob[i] *= n / sum;
+    fAliasIdx[i] = i;
+    if(prob[i] < 1.) small.push_back(i);
+    else             large.push_back(i);
+  }
+  while(!small.empty() && !large.empty()) {
+    int s = small.back(); small.pop_back();
+    int l = large.back();
+    fAliasProb[s] = prob[s];
+    fAliasIdx [s] = l;
+    prob[l] -= (1. - prob[s]);
+    if(prob[l] < 1.) { large.pop_back(); small.push_back(l); }
+  }
+  // leftovers (up to rounding) are always accepted
+  for(unsigned int i = 0; i < large.size(); i++) fAliasProb[large[i]] = 1.;
+  for(unsigned int i = 0; i < small.size(); i++) fAliasProb[small[i]] = 1.;
 
-  for(inu = 0; inu < n; inu++) {if ( R < fraction[inu] ) return inu;}
+  LOG("Flux", pNOTICE)
+     << "Built alias table over " << nb << " energy bins x "
+     << nnu << " neutrino species";
+}
+//___________________________________________________________________________
+int GCylindTH1Flux::SelectCell(void) const
+{
+  const int n = fAliasProb.size();
+  if(n == 0) {
+     LOG("Flux", pFATAL) << "No flux spectra were specified!";
+     exit(1);
+  }
 
-  LOG("Flux", pERROR) << "Could not select a neutrino species";
-  assert(false);
+  RandomGen * rnd = RandomGen::Instance();
+  double u = n * rnd->RndFlux().Rndm();
+  int    i = TMath::Min( (int)u, n-1 );
 
-  return -1;
+  return ( (u - i) < fAliasProb[i] ) ? i : fAliasIdx[i];
 }
 //___________________________________________________________________________
 double GCylindTH1Flux::GeneratePhi(void) const
@@ -9,6 +9,10 @@
          The energies are generated from the input energy spectrum (TH1D).
          Multiple neutrino species can be generated (you will need to supply
          an energy spectrum for each).
+         The (energy bin, neutrino species) pair is sampled in constant
+         time, from an alias table built over the bins of all the input
+         spectra whenever a spectrum is added; the energy is then thrown
+         uniformly within the selected bin.
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
@@ -74,7 +78,8 @@ private:
   void   CleanUp           (void);
   void   ResetSelection    (void);
   void   AddAllFluxes      (void);
-  int    SelectNeutrino    (double Ev);
+  void   BuildAliasTable   (void);
+  int    SelectCell        (void) const;
   double GeneratePhi       (void) const;
   double GenerateRt        (void) const;
 
@@ -90,6 +95,9 @@ private:
   TVector3 *     fBeamSpot;    ///< beam spot position
   double         fRt;          ///< transverse size of neutrino beam
   TF1 *          fRtDep;       ///< transverse radius dependence
+  vector<double> fBinEdges;    ///< energy bin edges of the input spectra
+  vector<double> fAliasProb;   ///< alias table over (bin,species) cells: acceptance prob.
+  vector<int>    fAliasIdx;    ///< alias table over (bin,species) cells: alias cell
 };
 
 } // flux namespace
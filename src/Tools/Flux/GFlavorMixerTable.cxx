@@ -0,0 +1,435 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  GFlavorMixerTable.cxx
+/// \brief GENIE interface for flavor modification
+///
+/// \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+///          University of Liverpool & STFC Rutherford Appleton Lab
+///
+/// \created October 14, 2026
+////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+
+#include "Tools/Flux/GFlavorMixerTable.h"
+#include "Tools/Flux/GFlavorMixerFactory.h"
+// self register with the factory
+FLAVORMIXREG4(genie,flux,GFlavorMixerTable,genie::flux::GFlavorMixerTable)
+
+#include "Framework/Messenger/Messenger.h"
+#define  LOG_BEGIN(a,b)   LOG(a,b)
+#define  LOG_END ""
+
+// GENIE includes
+#include "Framework/Utils/StringUtils.h"
+
+namespace {
+  // 6 initial flavors x 7 final flavors (including sterile)
+  const int kNTrans = 42;
+}
+
+namespace genie {
+namespace flux {
+//____________________________________________________________________________
+GFlavorMixerTable::GFlavorMixerTable() :
+  fMixer(0),
+  fEmin(0.1),
+  fEmax(100.),
+  fDmin(-1.),
+  fDmax(-1.),
+  fTolerance(1.0e-3),
+  fNInit(17),
+  fNMax(4096),
+  fMaxError(0),
+  fNDirect(0)
+{ ; }
+
+GFlavorMixerTable::~GFlavorMixerTable()
+{
+  if ( fMixer ) { delete fMixer; fMixer = 0; }
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::Config(std::string configIn)
+{
+  std::string config = genie::utils::str::TrimSpaces(configIn);
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "GFlavorMixerTable::Config \"" << config << "\"" << LOG_END;
+
+  // the table options come first, the wrapped mixer config after the ';'
+  std::string mixconfig = "";
+  size_t semi = config.find(";");
+  if ( semi != std::string::npos ) {
+    mixconfig = config.substr(semi+1);
+    config    = config.substr(0,semi);
+  }
+
+  std::string mixname = "";
+  vector<string> tokens = genie::utils::str::Split(config," ");
+  for (unsigned int jtok = 0; jtok < tokens.size(); ++jtok ) {
+    string tok1 = tokens[jtok];
+    if ( tok1 == "" ) continue;
+    if ( tok1 == "table" ) continue;
+    if ( tok1 == "genie::flux::GFlavorMixerTable" ) continue;
+    // should have the form  <key>=<value>
+    vector<string> pair = genie::utils::str::Split(tok1,"=");
+    if ( pair.size() != 2 ) {
+      LOG_BEGIN("FluxBlender", pWARN)
+        << "could not parse " << tok1 << " split size=" << pair.size()
+        << LOG_END;
+      continue;
+    }
+    const string & key = pair[0];
+    const char *   val = pair[1].c_str();
+    if      ( key == "mixer" ) mixname    = pair[1];
+    else if ( key == "emin"  ) fEmin      = strtod(val,NULL);
+    else if ( key == "emax"  ) fEmax      = strtod(val,NULL);
+    else if ( key == "dmin"  ) fDmin      = strtod(val,NULL);
+    else if ( key == "dmax"  ) fDmax      = strtod(val,NULL);
+    else if ( key == "dist"  ) fDmin      = fDmax = strtod(val,NULL);
+    else if ( key == "tol"   ) fTolerance = strtod(val,NULL);
+    else if ( key == "ninit" ) fNInit     = strtol(val,NULL,0);
+    else if ( key == "nmax"  ) fNMax      = strtol(val,NULL,0);
+    else {
+      LOG_BEGIN("FluxBlender", pWARN)
+        << "GFlavorMixerTable::Config unknown option \"" << key << "\""
+        << LOG_END;
+    }
+  }
+
+  if ( mixname != "" ) {
+    GFlavorMixerI* mixer =
+      GFlavorMixerFactory::Instance().GetFlavorMixer(mixname);
+    if ( ! mixer ) {
+      LOG_BEGIN("FluxBlender", pFATAL)
+        << "GFlavorMixerTable::Config no GFlavorMixerI named \""
+        << mixname << "\"" << LOG_END;
+      exit(1);
+    }
+    mixer->Config(mixconfig);
+    GFlavorMixerI* oldmix = this->AdoptFlavorMixer(mixer);
+    if ( oldmix ) delete oldmix;
+  }
+
+  this->BuildTable();
+}
+
+//____________________________________________________________________________
+GFlavorMixerI* GFlavorMixerTable::AdoptFlavorMixer(GFlavorMixerI* mixer)
+{
+  GFlavorMixerI* oldmix = fMixer;
+  fMixer = mixer;
+  // the table no longer describes the mixer
+  fLogE.clear();
+  fDist.clear();
+  fTable.clear();
+  return oldmix;
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::SetEnergyRange(double emin, double emax)
+{
+  fEmin = emin;
+  fEmax = emax;
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::SetDistRange(double dmin, double dmax)
+{
+  fDmin = dmin;
+  fDmax = dmax;
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::BuildTable(void)
+{
+  // Sample the wrapped mixer and refine the grid, one axis at a time:
+  // energy (at the initial distances), distance (at the refined energies)
+  // and energy again (at the refined distances)
+
+  fLogE.clear();
+  fDist.clear();
+  fTable.clear();
+  fMaxError = 0;
+
+  if ( ! fMixer ) {
+    LOG_BEGIN("FluxBlender", pFATAL)
+      << "GFlavorMixerTable has no GFlavorMixerI to tabulate" << LOG_END;
+    exit(1);
+  }
+  if ( fEmin <= 0 || fEmax <= fEmin || fDmin < 0 || fDmax < fDmin ) {
+    LOG_BEGIN("FluxBlender", pFATAL)
+      << "GFlavorMixerTable has an invalid range: E = [" << fEmin << ","
+      << fEmax << "] GeV, dist = [" << fDmin << "," << fDmax << "] m"
+      << LOG_END;
+    exit(1);
+  }
+  if ( fNInit < 2 ) fNInit = 2;
+  if ( fNMax < fNInit ) fNMax = fNInit;
+
+  bool fixed_dist = ( fDmax == fDmin );
+  size_t nd = ( fixed_dist ) ? 1 : fNInit;
+
+  double lemin = std::log10(fEmin);
+  double lemax = std::log10(fEmax);
+  std::vector<Node_t> enodes(fNInit);
+  for (size_t i = 0; i < fNInit; ++i)
+    enodes[i].x = lemin + (lemax-lemin)*i/(fNInit-1);
+  std::vector<Node_t> dnodes(nd);
+  for (size_t i = 0; i < nd; ++i)
+    dnodes[i].x = ( fixed_dist ) ? fDmin : fDmin + (fDmax-fDmin)*i/(nd-1);
+
+  // the errors along the two axes add up in the bilinear interpolation
+  double tol = ( fixed_dist ) ? fTolerance : 0.5*fTolerance;
+
+  std::vector<double> xother(nd);
+  for (size_t i = 0; i < nd; ++i) xother[i] = dnodes[i].x;
+  this->RefineAxis(enodes,xother,true,tol);
+
+  if ( ! fixed_dist ) {
+    xother.resize(enodes.size());
+    for (size_t i = 0; i < enodes.size(); ++i) xother[i] = enodes[i].x;
+    this->RefineAxis(dnodes,xother,false,tol);
+
+    xother.resize(dnodes.size());
+    for (size_t i = 0; i < dnodes.size(); ++i) xother[i] = dnodes[i].x;
+    for (size_t i = 0; i < enodes.size(); ++i) enodes[i].p.clear();
+    this->RefineAxis(enodes,xother,true,tol);
+  }
+
+  // the energy nodes now hold the samples at all the distance nodes
+  nd = dnodes.size();
+  fLogE.resize(enodes.size());
+  fDist.resize(nd);
+  for (size_t i = 0; i < nd; ++i) fDist[i] = dnodes[i].x;
+  fTable.reserve(enodes.size()*nd*kNTrans);
+  for (size_t i = 0; i < enodes.size(); ++i) {
+    fLogE[i] = enodes[i].x;
+    fTable.insert(fTable.end(),enodes[i].p.begin(),enodes[i].p.end());
+  }
+
+  this->Validate();
+
+  LOG_BEGIN("FluxBlender", pNOTICE)
+    << "GFlavorMixerTable: tabulated " << fLogE.size() << " energies x "
+    << fDist.size() << " distances, max error found " << fMaxError
+    << " (tolerance " << fTolerance << ")" << LOG_END;
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::Sample(double loge, double dist, double * p)
+{
+  double energy = std::pow(10.,loge);
+  for (int k = 0; k < kNTrans; ++k) {
+    p[k] = fMixer->Probability(Indx2PDG(k/7+1),Indx2PDG(k%7),energy,dist);
+  }
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::RefineAxis(std::vector<Node_t> & nodes,
+                                   const std::vector<double> & other,
+                                   bool is_energy, double tol)
+{
+  // Bisect the intervals whose midpoint or quarter points aren't reproduced
+  // to within the tolerance by linear interpolation (at any of the other
+  // axis nodes)
+
+  size_t np = other.size() * kNTrans;
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    Node_t & node = nodes[i];
+    if ( node.p.size() == np ) continue;
+    node.p.resize(np);
+    for (size_t j = 0; j < other.size(); ++j) {
+      if ( is_energy ) this->Sample(node.x,other[j],&node.p[j*kNTrans]);
+      else             this->Sample(other[j],node.x,&node.p[j*kNTrans]);
+    }
+  }
+
+  std::vector<char> done(nodes.size()-1,0);
+  bool changed = true;
+  while ( changed && nodes.size() < fNMax ) {
+    changed = false;
+    std::vector<Node_t> next;
+    std::vector<char>   nextdone;
+    next.reserve(2*nodes.size());
+    for (size_t i = 0; i+1 < nodes.size(); ++i) {
+      next.push_back(nodes[i]);
+      if ( done[i] || next.size() + (nodes.size()-i) > fNMax ) {
+        nextdone.push_back(done[i]);
+        continue;
+      }
+      // test the midpoint and the quarter points, as the midpoint alone
+      // can be fooled by an oscillation symmetric about it
+      Node_t mid;
+      mid.x = 0.5*(nodes[i].x + nodes[i+1].x);
+      mid.p.resize(np);
+      std::vector<double> ptest(kNTrans);
+      double err = 0;
+      for (int iq = 1; iq <= 3; ++iq) {
+        double f = 0.25*iq;
+        double x = (1.-f)*nodes[i].x + f*nodes[i+1].x;
+        double * p = ( iq == 2 ) ? &mid.p[0] : &ptest[0];
+        for (size_t j = 0; j < other.size(); ++j) {
+          double * pj = ( iq == 2 ) ? p + j*kNTrans : p;
+          if ( is_energy ) this->Sample(x,other[j],pj);
+          else             this->Sample(other[j],x,pj);
+          for (int k = 0; k < kNTrans; ++k) {
+            size_t ip = j*kNTrans + k;
+            double interp = (1.-f)*nodes[i].p[ip] + f*nodes[i+1].p[ip];
+            err = std::max(err,std::fabs(pj[k] - interp));
+          }
+        }
+      }
+      if ( err > tol ) {
+        next.push_back(mid);
+        nextdone.push_back(0);
+        nextdone.push_back(0);
+        changed = true;
+      } else {
+        nextdone.push_back(1);
+      }
+    }
+    next.push_back(nodes.back());
+    nodes.swap(next);
+    done.swap(nextdone);
+  }
+
+  if ( changed ) {
+    LOG_BEGIN("FluxBlender", pWARN)
+      << "GFlavorMixerTable: reached the max # of "
+      << ( is_energy ? "energy" : "distance" ) << " nodes (" << fNMax
+      << ") before the tolerance (" << tol << ")" << LOG_END;
+  }
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::Validate(void)
+{
+  // Compare the table to the wrapped mixer over a (deterministic)
+  // quasi-random set of points, so not to consume any random numbers
+
+  const int    npts = 1000;
+  const double a1 = 0.7548776662466927; // (R2 sequence)
+  const double a2 = 0.5698402909980532;
+  double p[kNTrans];
+  double lemin = fLogE.front();
+  double lemax = fLogE.back();
+  fMaxError = 0;
+  for (int i = 1; i <= npts; ++i) {
+    double u = std::fmod(0.5 + a1*i, 1.);
+    double v = std::fmod(0.5 + a2*i, 1.);
+    double loge = lemin + u*(lemax-lemin);
+    double dist = fDist.front() + v*(fDist.back()-fDist.front());
+    this->Sample(loge,dist,p);
+    for (int k = 0; k < kNTrans; ++k) {
+      double err = std::fabs(p[k] - this->Interpolate(k,loge,dist));
+      fMaxError = std::max(fMaxError,err);
+    }
+  }
+  if ( fMaxError > fTolerance ) {
+    LOG_BEGIN("FluxBlender", pWARN)
+      << "GFlavorMixerTable: max interpolation error found " << fMaxError
+      << " exceeds the tolerance " << fTolerance << LOG_END;
+  }
+}
+
+//____________________________________________________________________________
+double GFlavorMixerTable::Interpolate(int k, double loge, double dist) const
+{
+  size_t ne = fLogE.size();
+  size_t nd = fDist.size();
+
+  size_t ie = std::upper_bound(fLogE.begin(),fLogE.end(),loge) - fLogE.begin();
+  ie = ( ie == 0 ) ? 0 : std::min(ie-1,ne-2);
+  double te = (loge - fLogE[ie]) / (fLogE[ie+1] - fLogE[ie]);
+
+  if ( nd == 1 ) {
+    return (1.-te)*fTable[ie*kNTrans+k] + te*fTable[(ie+1)*kNTrans+k];
+  }
+
+  size_t id = std::upper_bound(fDist.begin(),fDist.end(),dist) - fDist.begin();
+  id = ( id == 0 ) ? 0 : std::min(id-1,nd-2);
+  double td = (dist - fDist[id]) / (fDist[id+1] - fDist[id]);
+
+  const double * p0 = &fTable[(ie*nd+id)*kNTrans+k];     // (ie  ,id)
+  const double * p1 = &fTable[((ie+1)*nd+id)*kNTrans+k]; // (ie+1,id)
+  return (1.-te)*((1.-td)*p0[0] + td*p0[kNTrans]) +
+             te *((1.-td)*p1[0] + td*p1[kNTrans]);
+}
+
+//____________________________________________________________________________
+double GFlavorMixerTable::Probability(int pdg_initial, int pdg_final,
+                                      double energy, double dist)
+{
+  if ( ! fMixer ) return ( pdg_initial == pdg_final ) ? 1. : 0.;
+
+  int indx_in = PDG2Indx(pdg_initial);
+  bool intable = ( ! fTable.empty() && indx_in > 0 &&
+                   energy >= fEmin && energy <= fEmax &&
+                   ( fDist.size() == 1 ||
+                     ( dist >= fDmin && dist <= fDmax ) ) );
+  if ( ! intable ) {
+    ++fNDirect;
+    return fMixer->Probability(pdg_initial,pdg_final,energy,dist);
+  }
+
+  int k = (indx_in-1)*7 + PDG2Indx(pdg_final);
+  return this->Interpolate(k,std::log10(energy),dist);
+}
+
+//____________________________________________________________________________
+void GFlavorMixerTable::PrintConfig(bool verbose)
+{
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "GFlavorMixerTable::PrintConfig():" << LOG_END;
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "   E = [" << fEmin << "," << fEmax << "] GeV, dist = ["
+    << fDmin << "," << fDmax << "] m, tolerance " << fTolerance << LOG_END;
+  LOG_BEGIN("FluxBlender", pINFO)
+    << "   " << fLogE.size() << " energies x " << fDist.size()
+    << " distances, max error found " << fMaxError
+    << ", " << fNDirect << " calls outside the table" << LOG_END;
+  if ( fMixer ) {
+    LOG_BEGIN("FluxBlender", pINFO)
+      << "   wrapped mixer:" << LOG_END;
+    fMixer->PrintConfig(verbose);
+  } else {
+    LOG_BEGIN("FluxBlender", pINFO)
+      << "   fMixer is not initialized" << LOG_END;
+  }
+}
+
+//____________________________________________________________________________
+int GFlavorMixerTable::PDG2Indx(int pdg) const
+{
+  // same indexing as GFlavorMap: sterile, nu_e, nu_mu, nu_tau, and bars
+  switch ( pdg ) {
+  case  12: return 1; break;
+  case  14: return 2; break;
+  case  16: return 3; break;
+  case -12: return 4; break;
+  case -14: return 5; break;
+  case -16: return 6; break;
+  default:  return 0; break;
+  }
+  return 0;
+}
+
+int GFlavorMixerTable::Indx2PDG(int indx) const
+{
+  switch ( indx ) {
+  case  1: return  12; break;
+  case  2: return  14; break;
+  case  3: return  16; break;
+  case  4: return -12; break;
+  case  5: return -14; break;
+  case  6: return -16; break;
+  default: return   0; break;
+  }
+  return 0;
+}
+
+//____________________________________________________________________________
+} // namespace flux
+} // namespace genie
@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////
+/// \file  GFlavorMixerTable.h
+/// \class genie::flux::GFlavorMixerTable
+/// \brief GENIE interface for flavor modification
+///
+///        Concrete instance of GFlavorMixerI that wraps any other
+///        GFlavorMixerI: the wrapped mixer is sampled on an adaptive
+///        (log10(energy), distance) grid when configured, and the
+///        transition probabilities are interpolated from the table
+///        afterwards.  Grid nodes are added (by bisection) until the
+///        linear interpolation at the midpoint and quarter points of
+///        every grid interval agrees with the wrapped mixer to within
+///        the requested tolerance, for all flavor transitions.
+///
+///        For accelerator beams the distance range can be collapsed to
+///        a single baseline (the distance then being ignored); in the
+///        atmospheric case the distance stands for the zenith angle.
+///        Outside the tabulated range the wrapped mixer is called.
+///
+///        Supported config string format:
+///          " table mixer=<name> [emin=E] [emax=E] [dist=L | dmin=L dmax=L]
+///                  [tol=t] [ninit=n] [nmax=n] ; <config of mixer> "
+///            <name>  : name of the wrapped GFlavorMixerI in the
+///                      GFlavorMixerFactory (e.g. genie::flux::GFlavorMap)
+///            emin/emax : tabulated energy range (GeV) [0.1,100]
+///            dist      : fixed baseline (meters)
+///            dmin/dmax : tabulated distance range (meters)
+///            tol       : max interpolation error at the test points [1e-3]
+///            ninit     : initial # of nodes per axis [17]
+///            nmax      : max # of nodes per axis [4096]
+///            everything after the ';' configures the wrapped mixer.
+///
+/// \author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+///          University of Liverpool & STFC Rutherford Appleton Lab
+///
+/// \created October 14, 2026
+////////////////////////////////////////////////////////////////////////
+
+#ifndef GENIE_FLUX_GFLAVORMIXERTABLE_H
+#define GENIE_FLUX_GFLAVORMIXERTABLE_H
+
+#include <string>
+#include <vector>
+#include "Tools/Flux/GFlavorMixerI.h"
+
+namespace genie {
+namespace flux {
+
+  class GFlavorMixerTable : public GFlavorMixerI {
+
+  public:
+
+    GFlavorMixerTable();
+    ~GFlavorMixerTable();
+
+    //
+    // implement the GFlavorMixerI interface:
+    //
+
+    /// configure the table and the wrapped mixer, then build the table
+    void      Config(std::string config);
+
+    /// interpolated transition probability (energy in GeV,
+    /// distance in meters)
+    double    Probability(int pdg_initial, int pdg_final,
+                          double energy, double dist);
+
+    /// provide a means of printing the configuration
+    void     PrintConfig(bool verbose=true);
+
+    //
+    // Additions to the GFlavorMixerI interface:
+    //
+    GFlavorMixerI* AdoptFlavorMixer(GFlavorMixerI* mixer);  ///< return previous
+    GFlavorMixerI* GetFlavorMixer() { return fMixer; }      ///< access, not ownership
+
+    void      SetEnergyRange  (double emin, double emax);
+    void      SetDistRange    (double dmin, double dmax);   ///< dmin==dmax: fixed baseline
+    void      SetTolerance    (double tol) { fTolerance = tol; }
+    void      BuildTable      (void);                       ///< (re)sample the wrapped mixer
+    double    MaxTableError   (void) const { return fMaxError; } ///< max error found in validation
+
+  private:
+
+    struct Node_t {
+      double              x;
+      std::vector<double> p;   ///< sampled probs, for each "other axis" node
+    };
+
+    void      Sample     (double loge, double dist, double * p);
+    void      RefineAxis (std::vector<Node_t> & nodes,
+                          const std::vector<double> & other,
+                          bool is_energy, double tol);
+    void      Validate   (void);
+    double    Interpolate(int k, double loge, double dist) const;
+
+    int       PDG2Indx   (int pdg) const;
+    int       Indx2PDG   (int indx) const;
+
+    GFlavorMixerI*      fMixer;       ///< wrapped flavor mixer (owned)
+    double              fEmin;        ///< tabulated energy range (GeV)
+    double              fEmax;
+    double              fDmin;        ///< tabulated distance range (m)
+    double              fDmax;
+    double              fTolerance;   ///< max interpolation error at the test points
+    size_t              fNInit;       ///< initial # of nodes per axis
+    size_t              fNMax;        ///< max # of nodes per axis
+
+    std::vector<double> fLogE;        ///< log10(energy) nodes
+    std::vector<double> fDist;        ///< distance nodes
+    std::vector<double> fTable;       ///< probs [iE][iD][(in-1)*7+out]
+    double              fMaxError;    ///< max error found in validation
+    long int            fNDirect;     ///< # of calls outside the table
+  };
+
+} // namespace flux
+} // namespace genie
+
+#endif //GENIE_FLUX_GFLAVORMIXERTABLE_H
@@ -12,6 +12,8 @@
 #include "Tools/Flux/GFluxFileConfigI.h"
 #include "Framework/Messenger/Messenger.h"
 #include "TMath.h"
+#include "TTree.h"
+#include "TEnv.h"
 
 namespace genie {
 namespace flux {
@@ -23,6 +25,12 @@ namespace flux {
     , fNCycles(0)
     , fICycle(0)
     , fZ0(-3.4e38)
+    , fTreeCacheSize(10000000)
+    , fAsyncPrefetch(false)
+    , fUseEntryRange(false)
+    , fFirstEntry(0)
+    , fLastEntry(-1)
+    , fEntryStride(1)
   { ; }
 
   GFluxFileConfigI::~GFluxFileConfigI() { ; }
@@ -97,6 +105,97 @@ namespace flux {
     fNCycles = TMath::Max(0L, ncycle);
   }
   //___________________________________________________________________________
+  void GFluxFileConfigI::SetEntryRange(long int first, long int last,
+                                       long int stride)
+  {
+    // Only entries first, first+stride, first+2*stride, ... < last are
+    // read, so that e.g. job i of n can use SetEntryRange(i,-1,n) or a
+    // contiguous block of entries, without overlap with other jobs.
+    // Each entry carries its share of the file POTs, so that the exposure
+    // of a complete cycle through the range is exact and the exposures
+    // of jobs with disjoint ranges add up to that of the files.
+    // Must be called before loading the flux files.
+
+    fUseEntryRange = true;
+    fFirstEntry    = TMath::Max(0L, first);
+    fLastEntry     = last;
+    fEntryStride   = TMath::Max(1L, stride);
+
+    LOG("Flux", pNOTICE)
+      << "Using flux entries [" << fFirstEntry << ", " << fLastEntry 
+      << ") with stride " << fEntryStride;
+  }
+  //___________________________________________________________________________
+  void GFluxFileConfigI::SplitEntryRange(int iworker, int nworkers)
+  {
+    // Unlike SetEntryRange(), used once the flux files were loaded, by
+    // worker processes forked from the same job: worker i of n reads the
+    // entries first+i*stride, first+(i+n)*stride, ... of the current range.
+    // The exposure of each entry is unchanged, so the exposures of all
+    // workers add up to that of the job.
+
+    if ( nworkers <= 1 ) return;
+    if ( ! fUseEntryRange ) {
+      fFirstEntry  = 0;
+      fLastEntry   = -1;
+      fEntryStride = 1;
+    }
+    fUseEntryRange = true;
+    fFirstEntry   += iworker * fEntryStride;
+    fEntryStride  *= nworkers;
+
+    LOG("Flux", pNOTICE)
+      << "Worker " << iworker << " of " << nworkers << " uses flux entries ["
+      << fFirstEntry << ", " << fLastEntry << ") with stride " << fEntryStride;
+  }
+  //___________________________________________________________________________
+  long int GFluxFileConfigI::NextEntryInRange(long int ientry, 
+                                              long int nentries) const
+  {
+    long int last = ( fLastEntry < 0 || fLastEntry > nentries ) ? 
+                      nentries : fLastEntry;
+    long int next = ( ientry < fFirstEntry ) ? 
+                      fFirstEntry : ientry + fEntryStride;
+    return ( next < last ) ? next : nentries;
+  }
+  //___________________________________________________________________________
+  long int GFluxFileConfigI::NEntriesInRange(long int nentries) const
+  {
+    long int last = ( fLastEntry < 0 || fLastEntry > nentries ) ? 
+                      nentries : fLastEntry;
+    if ( last <= fFirstEntry ) return 0;
+    return ( last - fFirstEntry + fEntryStride - 1 ) / fEntryStride;
+  }
+  //___________________________________________________________________________
+  void GFluxFileConfigI::ConfigTreeCache(TTree * tree, 
+                                         const std::vector<std::string> & branches)
+  {
+    // Flux entries are read sequentially, one GetEntry() per flux neutrino.
+    // Rather than having ROOT learn which branches are used, register them
+    // up front so that the cache is filled with whole clusters of baskets 
+    // of just those branches from the first entry on.  With asynchronous
+    // prefetching ROOT reads the next cluster in a background thread 
+    // while the current one is used (helps on high latency storage).
+
+    if ( ! tree || fTreeCacheSize <= 0 ) return;
+
+    if ( fAsyncPrefetch ) gEnv->SetValue("TFile.AsyncPrefetching", 1);
+
+    tree->SetCacheSize(fTreeCacheSize);
+    if ( branches.empty() ) {
+      tree->AddBranchToCache("*",true);
+    } else {
+      for (size_t i = 0; i < branches.size(); ++i)
+        tree->AddBranchToCache(branches[i].c_str(),true);
+    }
+    tree->StopCacheLearningPhase();
+
+    LOG("Flux", pINFO)
+      << "TTreeCache of " << fTreeCacheSize << " bytes for " 
+      << branches.size() << " branches (0: all)"
+      << ( fAsyncPrefetch ? ", asynchronous prefetching" : "" );
+  }
+  //___________________________________________________________________________
   void GFluxFileConfigI::SetFluxParticles(const PDGCodeList & particles)
   {
     fPdgCList->Copy(particles);
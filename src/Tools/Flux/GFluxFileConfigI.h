@@ -89,8 +89,36 @@ namespace flux {
     /// limit cycling through input files
     virtual void         SetNumOfCycles(long int ncycle);
 
+    /// configure the reading of the flux ntuple(s): size (in bytes) of the
+    /// TTreeCache (<=0 leaves ROOT's default) and whether its baskets are
+    /// to be read ahead in a background thread (must be set before loading)
+    virtual void         SetTreeCacheSize(long int nbytes) { fTreeCacheSize = nbytes; }
+    virtual void         SetAsyncPrefetch(bool async)      { fAsyncPrefetch = async;  }
+
+    /// restrict reading to entries first, first+stride, ... < last
+    /// (last < 0: up to the end), eg to split flux files among jobs:
+    /// cycles then loop over that range only, with no random starting
+    /// entry, and the exposure is that of the entries in the range
+    virtual void         SetEntryRange(long int first, long int last = -1,
+                                       long int stride = 1);
+
+    /// keep the share of worker iworker out of nworkers processes forked
+    /// after loading the flux files: every nworkers-th entry of the range
+    /// (drivers reading files override it to reopen them and restart)
+    virtual void         SplitEntryRange(int iworker, int nworkers);
+
   protected:  // visible to derived classes
 
+    /// set up the TTreeCache of the flux tree for the branches actually
+    /// read (all branches if the list is empty)
+    void ConfigTreeCache(TTree * tree, const std::vector<std::string> & branches);
+
+    /// entry following ientry (ientry < 0: first entry) in the entry range
+    /// of a flux ntuple with nentries entries; nentries at the end of range
+    long int NextEntryInRange (long int ientry, long int nentries) const;
+    /// # of entries in the entry range of a flux ntuple with nentries entries
+    long int NEntriesInRange  (long int nentries) const;
+
     PDGCodeList * fPdgCList;     ///< list of neutrino pdg-codes to generate  
     PDGCodeList * fPdgCListRej;  ///< list of nu pdg-codes seen but rejected
     std::string   fXMLbasename;  ///< XML file that might hold config param_sets
@@ -99,6 +127,12 @@ namespace flux {
                                  ///< default 0 = infinitely
     double        fZ0;           ///< configurable starting z position for 
                                  ///< each flux neutrino (in detector coord system)
+    long int      fTreeCacheSize; ///< TTreeCache size (bytes) for the flux tree
+    bool          fAsyncPrefetch; ///< prefetch the TTreeCache asynchronously
+    bool          fUseEntryRange; ///< was an entry range set?
+    long int      fFirstEntry;    ///< first entry of the range
+    long int      fLastEntry;     ///< end of the range (excluded; <0: all)
+    long int      fEntryStride;   ///< stride within the range
   };
 
 } // namespace flux
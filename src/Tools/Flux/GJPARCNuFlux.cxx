@@ -202,6 +202,24 @@ bool GJPARCNuFlux::GenerateNext(void)
   return false;
 }
 //___________________________________________________________________________
+bool GJPARCNuFlux::GenerateEntry(long int index)
+{
+// Get the (weighted) flux ntuple entry with the input index, as returned by
+// Index(), eg for importance sampling of flux neutrinos. The flux cycle 
+// bookkeeping is left untouched.
+//
+  if(index < 0 || index >= fNEntries) {
+     LOG("Flux", pERROR) << "No flux ntuple entry with index: " << index;
+     return false;
+  }
+  long int entries_this_cycle = fEntriesThisCycle;
+  fEntriesThisCycle = 0;
+  fIEntry = index;
+  bool ok = this->GenerateNext_weighted();
+  fEntriesThisCycle = entries_this_cycle;
+  return ok;
+}
+//___________________________________________________________________________
 bool GJPARCNuFlux::GenerateNext_weighted(void)
 {
 // Get next (weighted) flux ntuple entry on the specified detector location
@@ -220,7 +238,7 @@ bool GJPARCNuFlux::GenerateNext_weighted(void)
 
   // Read next flux ntuple entry. Use fEntriesThisCycle to keep track of when
   // in new cycle as fIEntry can now have an offset
-  if(fEntriesThisCycle >= fNEntries) {
+  if(fEntriesThisCycle >= fNEntriesRange) {
      // Exit if have not found neutrino at specified location for whole cycle
      if(fNDetLocIdFound == 0){
        LOG("Flux", pFATAL)
@@ -253,8 +271,10 @@ bool GJPARCNuFlux::GenerateNext_weighted(void)
     found_entry = fNuFluxChain->GetEntry(fIEntry) > 0;
   assert(found_entry);
   fLoadedNeutrino = true;
+  fReadEntry = fIEntry;
   fEntriesThisCycle++;
-  fIEntry = (fIEntry+1) % fNEntries;
+  fIEntry += fEntryStride;
+  if(fIEntry >= fLastEntry) fIEntry = fFirstEntry;
 
   if (fNuFluxUsingTree) {
     if(fNuFluxSumTree) fNuFluxSumTree->GetEntry(0); // get entry 0 as only 1 entry in tree
@@ -438,8 +458,12 @@ double GJPARCNuFlux::POT_1cycle(void)
 //
 // Use the max weight instead, since flux neutrinos get de-weighted
 // before thrown to the event generation driver
+//
+// With an entry range, the cycle only represents the range's share of the 
+// file entries
 //
   double pot = fFilePOT / fMaxWeight;
+  pot *= (double)fNEntriesRange / (double)fNEntries;
   return pot;
 }
 //___________________________________________________________________________
@@ -471,9 +495,8 @@ long int GJPARCNuFlux::Index(void)
 // called then return -1. 
 //
   if(fLoadedNeutrino){
-    // subtract 1 as fIEntry was incremented since call to TTree::GetEntry
-    // and deal with special case where fIEntry-1 is last entry in cycle 
-    return fIEntry == 0 ? fNEntries - 1 : fIEntry-1;
+    // fIEntry was moved on since the call to TTree::GetEntry
+    return fReadEntry;
   }
   // return -1 if no neutrino loaded since last call to this->ResetCurrent()
   return -1;
@@ -606,6 +629,20 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
 
   LOG("Flux", pNOTICE) 
     << "Loaded flux tree contains " <<  fNEntries << " entries";
+
+  // resolve the range of entries to loop over
+  if(!fUseEntryRange) {
+    fFirstEntry  = 0;
+    fLastEntry   = fNEntries;
+    fEntryStride = 1;
+  }
+  if(fLastEntry < 0 || fLastEntry > fNEntries) fLastEntry = fNEntries;
+  fNEntriesRange = (fLastEntry > fFirstEntry) ? 
+     (fLastEntry - fFirstEntry + fEntryStride - 1) / fEntryStride : 0;
+  if(fNEntriesRange == 0) {
+    LOG("Flux", pFATAL) << "No flux entries in the requested entry range";
+    exit(1);
+  }
   
   LOG("Flux", pDEBUG) 
     << "Getting tree branches & setting leaf addresses";
@@ -790,6 +827,8 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
   fNNeutrinosTot1c = 0;
   fNDetLocIdFound = 0;
   for(int ientry = 0; ientry < fNEntries; ientry++) {
+     bool inrange = ientry >= fFirstEntry && ientry < fLastEntry &&
+                    (ientry - fFirstEntry) % fEntryStride == 0;
      if (fNuFluxUsingTree)
        fNuFluxTree->GetEntry(ientry);
      else
@@ -804,6 +843,8 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
      fMaxWeight = TMath::Max(fMaxWeight, (double) fPassThroughInfo->norm); 
      // compare detector location (see GenerateNext_weighted() for details)
      if(fIsNDLoc && fDetLocId!=fPassThroughInfo->idfd) continue;
+     // the cycle totals only include the entries within the range
+     if(!inrange) continue;
      fSumWeightTot1c += fNorm;
      fNNeutrinosTot1c++;
      fNDetLocIdFound++;
@@ -827,7 +868,10 @@ bool GJPARCNuFlux::LoadBeamSimData(string filename, string detector_location)
     << "Totals / cycle: #neutrinos = " << fNNeutrinosTot1c 
     << ", Sum{Weights} = " << fSumWeightTot1c;
 
-  if(fUseRandomOffset){
+  if(fUseEntryRange){
+    fIEntry = fOffset = fFirstEntry; // jobs reading a range start at its beginning
+  }
+  else if(fUseRandomOffset){
     this->RandomOffset();  // Random start point when looping over ntuple
   }
 
@@ -892,6 +936,25 @@ void GJPARCNuFlux::GenerateWeighted(bool gen_weighted)
   fGenerateWeighted = gen_weighted;
 }
 //___________________________________________________________________________
+void GJPARCNuFlux::SetEntryRange(long int first, long int last, long int stride)
+{
+// Only loop over entries first, first+stride, first+2*stride, ... < last 
+// (last < 0: up to the last entry), e.g. to split a flux file among jobs 
+// with no overlap. The random offset is then disabled and the POT of a 
+// cycle is that of the entries within the range (see POT_1cycle), so that
+// the exposures of jobs with disjoint ranges add up to that of the file.
+// Must be called before LoadBeamSimData to have any effect.
+
+  fUseEntryRange = true;
+  fFirstEntry    = TMath::Max(0L, first);
+  fLastEntry     = last;
+  fEntryStride   = TMath::Max(1L, stride);
+
+  LOG("Flux", pNOTICE)
+    << "Using flux entries [" << fFirstEntry << ", " << fLastEntry 
+    << ") with stride " << fEntryStride;
+}
+//___________________________________________________________________________
 void GJPARCNuFlux::RandomOffset()
 {
 // Choose a random number between 0-->fNEntries to set as start point for 
@@ -952,6 +1015,12 @@ void GJPARCNuFlux::Initialize(void)
   fIEntry          = 0;
   fEntriesThisCycle= 0;
   fOffset          = 0;
+  fReadEntry       = -1;
+  fUseEntryRange   = false;
+  fFirstEntry      = 0;
+  fLastEntry       = -1;
+  fEntryStride     = 1;
+  fNEntriesRange   = 0;
   fNorm            = 0.;
   fMaxWeight       = 0;
   fFilePOT         = 0;
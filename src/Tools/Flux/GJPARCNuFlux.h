@@ -64,11 +64,12 @@ public :
   double                 Weight        (void) { return  fNorm / fMaxWeight;    }
   const TLorentzVector & Momentum      (void) { return  fgP4;                  }
   const TLorentzVector & Position      (void) { return  fgX4;                  }
-  bool                   End           (void) { return  fEntriesThisCycle >= fNEntries 
+  bool                   End           (void) { return  fEntriesThisCycle >= fNEntriesRange 
                                                      && fICycle == fNCycles && fNCycles > 0;   }
   long int               Index         (void);                              
   void                   Clear            (Option_t * opt); 
   void                   GenerateWeighted (bool gen_weighted = true);
+  bool                   GenerateEntry    (long int index);
 
   // Methods specific to the JPARC flux driver, 
   // for configuration/initialization of the flux & event generation drivers and
@@ -83,6 +84,7 @@ public :
   void SetNumOfCycles   (int n);                               ///< set how many times to cycle through the ntuple (default: 1 / n=0 means 'infinite')
   void DisableOffset    (void){fUseRandomOffset = false;}      ///< switch off random offset, must be called before LoadBeamSimData to have any effect 
   void RandomOffset     (void);                                ///< choose a random offset as starting entry in flux ntuple 
+  void SetEntryRange    (long int first, long int last=-1, long int stride=1); ///< only loop over entries first, first+stride, ... < last; must be called before LoadBeamSimData
 
   double   POT_1cycle     (void);                              ///< flux POT per cycle
   double   POT_curravg    (void);                              ///< current average POT
@@ -127,6 +129,12 @@ private:
   long int  fIEntry;           ///< current flux ntuple entry
   long int  fEntriesThisCycle; ///< keep track of number of entries used so far for this cycle   
   long int  fOffset;           ///< start looping at entry fOffset
+  long int  fReadEntry;        ///< flux ntuple entry last read
+  bool      fUseEntryRange;    ///< only loop over a range of entries?
+  long int  fFirstEntry;       ///< first entry of the range
+  long int  fLastEntry;        ///< end of the range (excluded)
+  long int  fEntryStride;      ///< stride within the range
+  long int  fNEntriesRange;    ///< number of entries in the range
   double    fNorm;             ///< current flux ntuple normalisation
   double    fMaxWeight;        ///< max flux  neutrino weight in input file for the specified detector location
   double    fFilePOT;          ///< file POT normalization, typically 1E+21
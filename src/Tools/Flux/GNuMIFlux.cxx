@@ -163,17 +163,30 @@
  @ Mar 14, 2014 - TD
    Prevent an infinite loop in GenerateNext() when the flux driver has not been
    properly configured by exiting within GenerateNext_weighted().
+ @ Oct 14, 2026 - CA
+   ScanForMaxWeight() results can be cached (SetMaxWgtCacheDir()), keyed by
+   the UUIDs of the flux files and the flux window & scan configuration, and
+   the scan can be split among worker processes (SetMaxWgtScanWorkers()).
+   Added SplitEntryRange() for event generation split among worker processes
+   forked after loading the flux files.
+ @ Oct 14, 2026 - CA
+   Added SaveState() and RestoreState() for checkpointed MC jobs.
 
 */
 //____________________________________________________________________________
 
 #include <cstdlib>
+#include <cstdio>
 #include <fstream>
 #include <vector>
 #include <sstream>
 #include <cassert>
 #include <climits>
 
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
 #include "libxml/xmlmemory.h"
 #include "libxml/parser.h"
 
@@ -188,6 +201,7 @@
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
+#include "Framework/EventGen/GMCJCheckpoint.h"
 
 #include "Tools/Flux/GNuMIFlux.h"
 #include "Tools/Flux/GNuMINtuple/g3numi.h"
@@ -380,14 +394,14 @@ bool GNuMIFlux::GenerateNext_weighted(void)
   } else {
     // Reset previously generated neutrino code / 4-p / 4-x
     this->ResetCurrent();
-    // Move on, read next flux ntuple entry
-    fIEntry++;
+    // Move on, read next flux ntuple entry (of the entry range, if any)
+    fIEntry = this->NextEntryInRange(fIEntry,fNEntries);
     if ( fIEntry >= fNEntries ) {
       // Ran out of entries @ the current cycle of this flux file
       // Check whether more (or infinite) number of cycles is requested
       if ( fICycle < fNCycles || fNCycles == 0 ) {
         fICycle++;
-        fIEntry=0;
+        fIEntry = this->NextEntryInRange(-1,fNEntries);
       } else {
         LOG("Flux", pWARN)
           << "No more entries in input flux neutrino ntuple, cycle "
@@ -398,17 +412,7 @@ bool GNuMIFlux::GenerateNext_weighted(void)
       }
     }
     
-    if ( fG3NuMI ) {
-      fG3NuMI->GetEntry(fIEntry); 
-      fCurEntry->MakeCopy(fG3NuMI); 
-    } else if ( fG4NuMI ) { 
-      fG4NuMI->GetEntry(fIEntry); 
-      fCurEntry->MakeCopy(fG4NuMI); 
-    } else if ( fFlugg ) { 
-      fFlugg->GetEntry(fIEntry); 
-      fCurEntry->MakeCopy(fFlugg); 
-    } else {
-      LOG("Flux", pERROR) << "No ntuple configured";
+    if ( ! this->ReadEntry(fIEntry) ) {
       fEnd = true;
       //assert(0);
       return false;	
@@ -420,14 +424,6 @@ bool GNuMIFlux::GenerateNext_weighted(void)
 #endif
 
     fIUse = 1; 
-    fCurEntry->pcodes = 0;  // fetched entry has geant codes
-    fCurEntry->units  = 0;  // fetched entry has original units
-
-    // Convert the current gnumi neutrino flavor mode into a neutrino pdg code
-    // Also convert other particle codes in GNuMIFluxPassThroughInfo to PDG
-    fCurEntry->ConvertPartCodes();
-    // here we might want to do flavor oscillations or simple mappings
-    fCurEntry->fgPdgC = fCurEntry->ntype;
   }
 
   // Check neutrino pdg against declared list of neutrino species declared
@@ -485,12 +481,23 @@ bool GNuMIFlux::GenerateNext_weighted(void)
     Ev       = fCurEntry->nenergyf;
     break;
   default:  // recalculate on x-y window
+  {
     RandomGen * rnd = RandomGen::Instance();
     fCurEntry->fgX4 += ( rnd->RndFlux().Rndm()*fFluxWindowDir1 +
                          rnd->RndFlux().Rndm()*fFluxWindowDir2   );
+#ifdef  GNUMI_TEST_XY_WGT
     fCurEntry->CalcEnuWgt(fCurEntry->fgX4,Ev,wgt_xy);
+#else
+    // the parent boost only changes with the entry, not on reuse
+    if ( fIUse == 1 ) fCurEntry->CalcDecayKinematics(fCurDecayKin);
+    double x = fCurEntry->fgX4.X();
+    double y = fCurEntry->fgX4.Y();
+    double z = fCurEntry->fgX4.Z();
+    GNuMIFluxPassThroughInfo::CalcEnuWgt(fCurDecayKin,1,&x,&y,&z,&Ev,&wgt_xy);
+#endif
     break;
   }
+  }
 
   if (Ev > fMaxEv) {
      LOG("Flux", pWARN)
@@ -742,6 +749,7 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
           } // sanity mix/match g3/g4
             // add the file to the chain
           this->AddFile(atree,filename);
+          fNuFluxFileIds.push_back(tf->GetUUID().AsString());
         } // found a tree
       } // loop over either g3 or g4
       tf->Close();
@@ -758,6 +766,9 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
   if ( fNuFluxGen == "g4numi" ) fG4NuMI = new g4numi(fNuFluxTree);
   if ( fNuFluxGen == "flugg"  ) fFlugg  = new flugg(fNuFluxTree);
 
+  // the ntuple classes read (and copy) all branches of an entry
+  this->ConfigTreeCache(fNuFluxTree,std::vector<std::string>());
+
   // this will open all files and read header!!
   fNEntries = fNuFluxTree->GetEntries();
 
@@ -805,6 +816,14 @@ void GNuMIFlux::LoadBeamSimData(const std::vector<std::string>& patterns,
   RandomGen* rnd = RandomGen::Instance();
   fIUse   =  9999999;
   fIEntry = rnd->RndFlux().Integer(fNEntries) - 1;
+  if ( fUseEntryRange ) {
+    // start from the beginning of the range
+    fIEntry = -1;
+    if ( this->NEntriesInRange(fNEntries) == 0 ) {
+      LOG("Flux", pFATAL) << "No flux entries in the requested entry range";
+      exit(1);
+    }
+  }
   
   // don't count things we used to estimate max weight
   fSumWeight  = 0;
@@ -841,58 +860,69 @@ void GNuMIFlux::ScanForMaxWeight(void)
      return;	
   }
 
-  // scan for the maximum weight
-  int ipos_estimator = fUseFluxAtDetCenter;
-  if ( ipos_estimator == 0 ) {
-    // within 100m of a known point?
-    double zbase = fFluxWindowBase.Z();
-    if ( TMath::Abs(zbase-103648.837) < 10000. ) ipos_estimator = -1; // use NearDet
-    if ( TMath::Abs(zbase-73534000. ) < 10000. ) ipos_estimator = +1; // use FarDet
-  }
-  if ( ipos_estimator != 0 ) {
-
-    //// one can't really be sure which Nwtfar/Nwtnear this refers to
-    //// some gnumi files have "NOvA" weights
-    const char* ntwgtstrv[4] = { "Nimpwt*Nwtnear", 
-                                 "Nimpwt*Nwtfar",
-                                 "Nimpwt*NWtNear[0]",
-                                 "Nimpwt*NWtFar[0]"  };
-    int strindx = 0;
-    if ( ipos_estimator > 0 ) strindx = 1;
-    if ( fG4NuMI ) strindx += 2;
-    // set upper limit on how many entries to scan
-    Long64_t nscan = TMath::Min(fNEntries,200000LL);
+  // re-use the results of an earlier scan of the same files & config
+  double ntpwgt = -1, wgtgenmx = 0, enumx = 0;
+  string cache_file = this->MaxWgtCacheFile();
+  bool cached = ( ! cache_file.empty() && 
+                  this->LoadCachedMaxWgt(cache_file,ntpwgt,wgtgenmx,enumx) );
+  if ( ! cached ) {
+    // scan for the maximum weight
+    int ipos_estimator = fUseFluxAtDetCenter;
+    if ( ipos_estimator == 0 ) {
+      // within 100m of a known point?
+      double zbase = fFluxWindowBase.Z();
+      if ( TMath::Abs(zbase-103648.837) < 10000. ) ipos_estimator = -1; // use NearDet
+      if ( TMath::Abs(zbase-73534000. ) < 10000. ) ipos_estimator = +1; // use FarDet
+    }
+    if ( ipos_estimator != 0 ) {
+
+      //// one can't really be sure which Nwtfar/Nwtnear this refers to
+      //// some gnumi files have "NOvA" weights
+      const char* ntwgtstrv[4] = { "Nimpwt*Nwtnear", 
+                                   "Nimpwt*Nwtfar",
+                                   "Nimpwt*NWtNear[0]",
+                                   "Nimpwt*NWtFar[0]"  };
+      int strindx = 0;
+      if ( ipos_estimator > 0 ) strindx = 1;
+      if ( fG4NuMI ) strindx += 2;
+      // set upper limit on how many entries to scan
+      Long64_t nscan = TMath::Min(fNEntries,200000LL);
     
-    fNuFluxTree->Draw(ntwgtstrv[strindx],"","goff",nscan);
-    //std::cout << " Draw \"" << ntwgtstrv[strindx] << "\"" << std::endl;
-    //std::cout << " SelectedRows " << fNuFluxTree->GetSelectedRows()
-    //          << " V1 " << fNuFluxTree->GetV1() << std::endl;
-
-    Long64_t idx = TMath::LocMax(fNuFluxTree->GetSelectedRows(),
-                                 fNuFluxTree->GetV1());
-    //std::cout << "idx " << idx << " of " << fNuFluxTree->GetSelectedRows() << std::endl;
-    fMaxWeight = fNuFluxTree->GetV1()[idx];
-    LOG("Flux", pNOTICE) << "Maximum flux weight from Nwt in ntuple = " 
-                         << fMaxWeight;
-    if ( fMaxWeight <= 0 ) {
-      LOG("Flux", pFATAL) << "Non-positive maximum flux weight!";
-      exit(1);
+      fNuFluxTree->Draw(ntwgtstrv[strindx],"","goff",nscan);
+      //std::cout << " Draw \"" << ntwgtstrv[strindx] << "\"" << std::endl;
+      //std::cout << " SelectedRows " << fNuFluxTree->GetSelectedRows()
+      //          << " V1 " << fNuFluxTree->GetV1() << std::endl;
+
+      Long64_t idx = TMath::LocMax(fNuFluxTree->GetSelectedRows(),
+                                   fNuFluxTree->GetV1());
+      //std::cout << "idx " << idx << " of " << fNuFluxTree->GetSelectedRows() << std::endl;
+      ntpwgt = fNuFluxTree->GetV1()[idx];
+      if ( ntpwgt <= 0 ) {
+        LOG("Flux", pFATAL) << "Non-positive maximum flux weight!";
+        exit(1);
+      }
+    }
+    // the above works only for things close to the MINOS stored weight
+    // values.  otherwise we need to work out our own estimate.
+    TStopwatch t;
+    t.Start();
+    if ( fMaxWgtScanWorkers <= 1 || 
+         ! this->ScanMaxWgtInWorkers(wgtgenmx,enumx) ) {
+      this->ScanMaxWgtEntries(fMaxWgtEntries,wgtgenmx,enumx);
     }
+    t.Stop();
+    t.Print("u");
+
+    if ( ! cache_file.empty() ) 
+      this->SaveCachedMaxWgt(cache_file,ntpwgt,wgtgenmx,enumx);
+
   }
-  // the above works only for things close to the MINOS stored weight
-  // values.  otherwise we need to work out our own estimate.
-  double wgtgenmx = 0, enumx = 0;
-  TStopwatch t;
-  t.Start();
-  for (int itry=0; itry < fMaxWgtEntries; ++itry) {
-    this->GenerateNext_weighted();
-    double wgt = this->Weight();
-    if ( wgt > wgtgenmx ) wgtgenmx = wgt;
-    double enu = fCurEntry->fgP4.Energy();
-    if ( enu > enumx ) enumx = enu;
+
+  if ( ntpwgt > 0 ) {
+    fMaxWeight = ntpwgt;
+    LOG("Flux", pNOTICE) << "Maximum flux weight from Nwt in ntuple = " 
+                         << fMaxWeight;
   }
-  t.Stop();
-  t.Print("u");
   LOG("Flux", pNOTICE) << "Maximum flux weight for spin = " 
                        << wgtgenmx << ", energy = " << enumx
                        << " (" << fMaxWgtEntries << ")";
@@ -913,6 +943,298 @@ void GNuMIFlux::ScanForMaxWeight(void)
 
 }
 //___________________________________________________________________________
+void GNuMIFlux::ScanMaxWgtEntries(long int ntries, 
+                                  double & wgtmx, double & enumx)
+{
+  // Find the max weight & energy of ntries weighted flux neutrinos
+
+  for (long int itry=0; itry < ntries; ++itry) {
+    this->GenerateNext_weighted();
+    double wgt = this->Weight();
+    if ( wgt > wgtmx ) wgtmx = wgt;
+    double enu = fCurEntry->fgP4.Energy();
+    if ( enu > enumx ) enumx = enu;
+  }
+}
+//___________________________________________________________________________
+bool GNuMIFlux::ScanMaxWgtInWorkers(double & wgtmx, double & enumx)
+{
+  // Split the max weight scan among fMaxWgtScanWorkers forked processes,
+  // each one reading the flux files through its own chain, starting at a 
+  // different entry and using its own random number stream. The results 
+  // are passed back in shared memory. Returns false if the workers could 
+  // not be run (the scan should then be done in this process).
+
+  int nworkers = fMaxWgtScanWorkers;
+  long int ntries = (fMaxWgtEntries + nworkers - 1) / nworkers;
+
+  size_t nbytes = 2 * nworkers * sizeof(double);
+  double * results = (double *) mmap(0, nbytes, PROT_READ | PROT_WRITE,
+                                     MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if ( (void *) results == MAP_FAILED ) {
+    LOG("Flux", pWARN) << "Couldn't allocate shared memory for scan workers";
+    return false;
+  }
+  for (int i = 0; i < 2*nworkers; ++i) results[i] = -1;
+
+  std::vector<pid_t> wpids;
+  for (int iw = 0; iw < nworkers; ++iw) {
+    pid_t pid = fork();
+    if ( pid < 0 ) {
+      LOG("Flux", pWARN) << "Couldn't fork max weight scan worker " << iw;
+      break;
+    }
+    if ( pid == 0 ) {
+      // worker: don't share the parent's open files
+      this->ReopenFluxTree();
+      RandomGen * rnd = RandomGen::Instance();
+      rnd->RndFlux().SetSeed(
+          RandomGen::StreamSeed(rnd->GetSeed(), kRndStrFlux, -2-iw));
+      fIUse   = 9999999;
+      fIEntry = ( fUseEntryRange ) ? -1 : (iw * fNEntries) / nworkers - 1;
+      double w = 0, e = 0;
+      this->ScanMaxWgtEntries(ntries,w,e);
+      results[2*iw]   = w;
+      results[2*iw+1] = e;
+      _exit(0);
+    }
+    wpids.push_back(pid);
+  }
+
+  bool ok = ( (int) wpids.size() == nworkers );
+  for (size_t iw = 0; iw < wpids.size(); ++iw) {
+    int status = 0;
+    waitpid(wpids[iw], &status, 0);
+    if ( ! WIFEXITED(status) || WEXITSTATUS(status) != 0 || 
+         results[2*iw] < 0 ) {
+      LOG("Flux", pWARN) << "Max weight scan worker " << iw << " failed";
+      ok = false;
+    }
+  }
+  if ( ok ) {
+    for (int iw = 0; iw < nworkers; ++iw) {
+      wgtmx = TMath::Max(wgtmx,results[2*iw]);
+      enumx = TMath::Max(enumx,results[2*iw+1]);
+    }
+    LOG("Flux", pNOTICE) 
+      << "Scanned for max weight with " << nworkers << " workers";
+  }
+  munmap((void *) results, nbytes);
+  return ok;
+}
+//___________________________________________________________________________
+bool GNuMIFlux::ReadEntry(Long64_t ientry)
+{
+  if ( fG3NuMI ) {
+    fG3NuMI->GetEntry(ientry); 
+    fCurEntry->MakeCopy(fG3NuMI); 
+  } else if ( fG4NuMI ) { 
+    fG4NuMI->GetEntry(ientry); 
+    fCurEntry->MakeCopy(fG4NuMI); 
+  } else if ( fFlugg ) { 
+    fFlugg->GetEntry(ientry); 
+    fCurEntry->MakeCopy(fFlugg); 
+  } else {
+    LOG("Flux", pERROR) << "No ntuple configured";
+    return false;
+  }
+
+  fCurEntry->pcodes = 0;  // fetched entry has geant codes
+  fCurEntry->units  = 0;  // fetched entry has original units
+
+  // Convert the current gnumi neutrino flavor mode into a neutrino pdg code
+  // Also convert other particle codes in GNuMIFluxPassThroughInfo to PDG
+  fCurEntry->ConvertPartCodes();
+  // here we might want to do flavor oscillations or simple mappings
+  fCurEntry->fgPdgC = fCurEntry->ntype;
+  return true;
+}
+//___________________________________________________________________________
+bool GNuMIFlux::SaveState(TDirectory * dir) const
+{
+  GMCJCheckpoint::SaveValue(dir, "IEntry",     fIEntry);
+  GMCJCheckpoint::SaveValue(dir, "ICycle",     fICycle);
+  GMCJCheckpoint::SaveValue(dir, "IUse",       fIUse);
+  GMCJCheckpoint::SaveValue(dir, "NNeutrinos", fNNeutrinos);
+  GMCJCheckpoint::SaveValue(dir, "SumWeight",  fSumWeight);
+  GMCJCheckpoint::SaveValue(dir, "AccumPOTs",  fAccumPOTs);
+  GMCJCheckpoint::SaveValue(dir, "MaxWeight",  fMaxWeight);
+  GMCJCheckpoint::SaveValue(dir, "Weight",     fWeight);
+  GMCJCheckpoint::SaveValue(dir, "End",        (long int) fEnd);
+  return true;
+}
+//___________________________________________________________________________
+bool GNuMIFlux::RestoreState(TDirectory * dir)
+{
+  // The current entry (and the decay kinematics computed from it) is read
+  // back, as it may be used again by the next GenerateNext() call
+
+  long int end = 0;
+  bool ok =
+    GMCJCheckpoint::LoadValue(dir, "IEntry",     fIEntry)     &&
+    GMCJCheckpoint::LoadValue(dir, "ICycle",     fICycle)     &&
+    GMCJCheckpoint::LoadValue(dir, "IUse",       fIUse)       &&
+    GMCJCheckpoint::LoadValue(dir, "NNeutrinos", fNNeutrinos) &&
+    GMCJCheckpoint::LoadValue(dir, "SumWeight",  fSumWeight)  &&
+    GMCJCheckpoint::LoadValue(dir, "AccumPOTs",  fAccumPOTs)  &&
+    GMCJCheckpoint::LoadValue(dir, "MaxWeight",  fMaxWeight)  &&
+    GMCJCheckpoint::LoadValue(dir, "Weight",     fWeight)     &&
+    GMCJCheckpoint::LoadValue(dir, "End",        end);
+  if ( ! ok ) return false;
+  fEnd = (end != 0);
+
+  this->ResetCurrent();
+  if ( fIEntry >= 0 && fIEntry < fNEntries ) {
+    if ( ! this->ReadEntry(fIEntry) ) return false;
+    if ( fIUse >= 1 ) fCurEntry->CalcDecayKinematics(fCurDecayKin);
+  }
+
+  LOG("Flux", pNOTICE)
+    << "Restored the flux driver state at entry " << fIEntry
+    << " (cycle " << fICycle << ", " << fAccumPOTs << " POTs used)";
+  return true;
+}
+//___________________________________________________________________________
+void GNuMIFlux::SplitEntryRange(int iworker, int nworkers)
+{
+  // Keep the share of entries of a forked event generation worker. The
+  // worker reads them through its own chain, from the start of its range,
+  // and only accounts for its own exposure.
+
+  if ( nworkers <= 1 ) return;
+
+  GFluxFileConfigI::SplitEntryRange(iworker,nworkers);
+  if ( this->NEntriesInRange(fNEntries) == 0 ) {
+    LOG("Flux", pFATAL) << "No flux entries left for worker " << iworker;
+    exit(1);
+  }
+  this->ReopenFluxTree();
+  this->Clear("CycleHistory");
+  fIUse   = 9999999;
+  fIEntry = -1;
+}
+//___________________________________________________________________________
+void GNuMIFlux::ReopenFluxTree(void)
+{
+  // Read the flux files through a new chain (and ntuple object). Used by
+  // forked scan workers, the original chain being left to the parent.
+
+  TChain * chain = new TChain(fNuFluxTreeName.c_str());
+  TObjArray * files = fNuFluxTree->GetListOfFiles();
+  for (int i = 0; i < files->GetEntries(); ++i) {
+    chain->Add(files->At(i)->GetTitle());
+  }
+  chain->SetMakeClass(1);
+  fNuFluxTree = chain;
+  if ( fG3NuMI ) fG3NuMI = new g3numi(fNuFluxTree);
+  if ( fG4NuMI ) fG4NuMI = new g4numi(fNuFluxTree);
+  if ( fFlugg  ) fFlugg  = new flugg(fNuFluxTree);
+  this->ConfigTreeCache(fNuFluxTree,std::vector<std::string>());
+}
+//___________________________________________________________________________
+string GNuMIFlux::MaxWgtCacheFile(void) const
+{
+  // Get the max weight scan cache file for the current flux files & config
+  // (empty if the scan results should not be cached). The file name is built
+  // from a hash of the UUIDs of the flux files, the flux window (in beam 
+  // coordinates) and everything else determining the scan results.
+
+  if ( fMaxWgtCacheDir.empty() ) return "";
+
+  std::ostringstream cfg;
+  cfg << std::setprecision(12);
+  cfg << fNuFluxGen << " " << fNuFluxTreeName << " n:" << fNEntries;
+  const TLorentzVector * win[3] = 
+    { &fFluxWindowBase, &fFluxWindowDir1, &fFluxWindowDir2 };
+  cfg << " win:";
+  for (int i = 0; i < 3; ++i) 
+    cfg << " " << win[i]->X() << " " << win[i]->Y() << " " << win[i]->Z();
+  cfg << " tilt:" << fApplyTiltWeight << " ctr:" << fUseFluxAtDetCenter
+      << " nuse:" << fNUse << " nscan:" << fMaxWgtEntries
+      << " range:" << fUseEntryRange << " " << fFirstEntry 
+      << " " << fLastEntry << " " << fEntryStride << " pdg:";
+  for (size_t i = 0; i < fPdgCList->size(); ++i) cfg << " " << (*fPdgCList)[i];
+  for (size_t i = 0; i < fNuFluxFileIds.size(); ++i) 
+    cfg << "\n" << fNuFluxFileIds[i];
+
+  // 64-bit FNV-1a hash of the configuration string
+  string cfgstr = cfg.str();
+  ULong64_t hash = 14695981039346656037ULL;
+  for (unsigned int i = 0; i < cfgstr.size(); i++) {
+    hash ^= (unsigned char) cfgstr[i];
+    hash *= 1099511628211ULL;
+  }
+
+  std::ostringstream filename;
+  filename << fMaxWgtCacheDir << "/gnumi_maxwgt_"
+           << std::hex << std::setfill('0') << std::setw(16) << hash
+           << ".txt";
+  return filename.str();
+}
+//___________________________________________________________________________
+bool GNuMIFlux::LoadCachedMaxWgt(string filename, double & ntpwgt,
+                                 double & wgtmx, double & enumx) const
+{
+  // Load the results of an earlier max weight scan
+
+  std::ifstream in(filename.c_str());
+  if ( ! in.good() ) return false;
+
+  int nfound = 0;
+  string key;
+  double val;
+  while ( in >> key ) {
+    if ( key[0] == '#' ) { std::getline(in,key); continue; }
+    if ( ! (in >> val) ) break;
+    if      ( key == "ntpwgt" ) { ntpwgt = val; nfound++; }
+    else if ( key == "wgtmax" ) { wgtmx  = val; nfound++; }
+    else if ( key == "enumax" ) { enumx  = val; nfound++; }
+  }
+  if ( nfound != 3 ) {
+    LOG("Flux", pWARN)
+      << "Could not read cached max weight scan from: " << filename;
+    ntpwgt = -1; wgtmx = 0; enumx = 0;
+    return false;
+  }
+  LOG("Flux", pNOTICE) 
+    << "Using cached max weight scan from: " << filename;
+  return true;
+}
+//___________________________________________________________________________
+void GNuMIFlux::SaveCachedMaxWgt(string filename, double ntpwgt,
+                                 double wgtmx, double enumx) const
+{
+  // Save the max weight scan results. The file is written under a temporary
+  // name and then renamed, so that jobs sharing the cache never read a 
+  // partially written file.
+
+  if ( gSystem->AccessPathName(fMaxWgtCacheDir.c_str()) ) {
+    gSystem->mkdir(fMaxWgtCacheDir.c_str(), true);
+  }
+
+  std::ostringstream tmpname;
+  tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+  std::ofstream out(tmpname.str().c_str());
+  out << std::setprecision(17)
+      << "# GNuMIFlux max weight scan of " << fNEntries << " entries ("
+      << fNuFluxFileIds.size() << " files), " << fMaxWgtEntries 
+      << " flux neutrinos\n"
+      << "ntpwgt " << ntpwgt << "\n"
+      << "wgtmax " << wgtmx  << "\n"
+      << "enumax " << enumx  << "\n";
+  out.close();
+
+  if ( out.fail() || 
+       std::rename(tmpname.str().c_str(), filename.c_str()) != 0 ) {
+    LOG("Flux", pWARN)
+      << "Could not store the max weight scan in: " << filename;
+    std::remove(tmpname.str().c_str());
+    return;
+  }
+  LOG("Flux", pNOTICE) 
+    << "Stored the max weight scan in: " << filename;
+}
+//___________________________________________________________________________
 void GNuMIFlux::SetMaxEnergy(double Ev)
 {
   fMaxEv = TMath::Max(0.,Ev);
@@ -1214,6 +1536,13 @@ void GNuMIFlux::Initialize(void)
   fMaxWgtEntries   = 2500000;
   fMaxEFudge       =  0;
 
+  // cache/parallelize the max weight scan if asked to
+  const char * cache_dir = std::getenv("GNUMIMAXWGTCACHE");
+  fMaxWgtCacheDir    = ( cache_dir ) ? cache_dir : "";
+  const char * nworkers  = std::getenv("GNUMISCANWORKERS");
+  fMaxWgtScanWorkers = ( nworkers ) ? std::atoi(nworkers) : 1;
+  fNuFluxFileIds.clear();
+
   fSumWeight       =  0;
   fNNeutrinos      =  0;
   fEffPOTsPerNu    =  0;
@@ -1881,6 +2210,37 @@ void GNuMIFluxPassThroughInfo::MakeCopy(const flugg* f )
 
 }
 
+//___________________________________________________________________________
+// for now ... these _should_ come from DB
+// but use these hard-coded values to "exactly" reproduce old code
+//
+namespace {
+  const double kPIMASS = 0.13957;
+  const double kKMASS  = 0.49368;
+  const double kK0MASS = 0.49767;
+  const double kMUMASS = 0.105658389;
+  const double kOMEGAMASS = 1.67245;
+
+  const int kpdg_nue       =   12;  // extended Geant 53
+  const int kpdg_nuebar    =  -12;  // extended Geant 52
+  const int kpdg_numu      =   14;  // extended Geant 56
+  const int kpdg_numubar   =  -14;  // extended Geant 55
+
+  const int kpdg_muplus     =   -13;  // Geant  5
+  const int kpdg_muminus    =    13;  // Geant  6
+  const int kpdg_pionplus   =   211;  // Geant  8
+  const int kpdg_pionminus  =  -211;  // Geant  9
+  const int kpdg_k0long     =   130;  // Geant 10  ( K0=311, K0S=310 )
+  const int kpdg_k0short    =   310;  // Geant 16
+  const int kpdg_k0mix      =   311;  
+  const int kpdg_kaonplus   =   321;  // Geant 11
+  const int kpdg_kaonminus  =  -321;  // Geant 12
+  const int kpdg_omegaminus =  3334;  // Geant 24
+  const int kpdg_omegaplus  = -3334;  // Geant 32
+
+  const double kRDET = 100.0;   // set to flux per 100 cm radius
+}
+
 //___________________________________________________________________________
 int GNuMIFluxPassThroughInfo::CalcEnuWgt(const TLorentzVector& xyz,
                                          double& enu, double& wgt_xy) const
@@ -1925,34 +2285,6 @@ int GNuMIFluxPassThroughInfo::CalcEnuWgt(const TLorentzVector& xyz,
   //    Energies given in GeV
   //    Particle codes have been translated from GEANT into PDG codes
 
-  // for now ... these _should_ come from DB
-  // but use these hard-coded values to "exactly" reproduce old code
-  //
-  const double kPIMASS = 0.13957;
-  const double kKMASS  = 0.49368;
-  const double kK0MASS = 0.49767;
-  const double kMUMASS = 0.105658389;
-  const double kOMEGAMASS = 1.67245;
-
-  const int kpdg_nue       =   12;  // extended Geant 53
-  const int kpdg_nuebar    =  -12;  // extended Geant 52
-  const int kpdg_numu      =   14;  // extended Geant 56
-  const int kpdg_numubar   =  -14;  // extended Geant 55
-
-  const int kpdg_muplus     =   -13;  // Geant  5
-  const int kpdg_muminus    =    13;  // Geant  6
-  const int kpdg_pionplus   =   211;  // Geant  8
-  const int kpdg_pionminus  =  -211;  // Geant  9
-  const int kpdg_k0long     =   130;  // Geant 10  ( K0=311, K0S=310 )
-  const int kpdg_k0short    =   310;  // Geant 16
-  const int kpdg_k0mix      =   311;  
-  const int kpdg_kaonplus   =   321;  // Geant 11
-  const int kpdg_kaonminus  =  -321;  // Geant 12
-  const int kpdg_omegaminus =  3334;  // Geant 24
-  const int kpdg_omegaplus  = -3334;  // Geant 32
-
-  const double kRDET = 100.0;   // set to flux per 100 cm radius
-
   double xpos = xyz.X();
   double ypos = xyz.Y();
   double zpos = xyz.Z();
@@ -2201,6 +2533,193 @@ int GNuMIFluxPassThroughInfo::CalcEnuWgt(const TLorentzVector& xyz,
   return 0;
 }
 
+//___________________________________________________________________________
+int GNuMIFluxPassThroughInfo::CalcDecayKinematics(GNuMIDecayKinematics& dk) const
+{
+  // Fill the part of CalcEnuWgt() that is independent of the point the
+  // neutrino is sent to: parent boost and, for muon decays, the muon
+  // parent momentum in the muon production CM.
+
+  double parent_mass = kPIMASS;
+  switch ( this->ptype ) {
+  case kpdg_pionplus:
+  case kpdg_pionminus:
+    parent_mass = kPIMASS;
+    break;
+  case kpdg_kaonplus:
+  case kpdg_kaonminus:
+    parent_mass = kKMASS;
+    break;
+  case kpdg_k0long:
+  case kpdg_k0short:
+  case kpdg_k0mix:
+    parent_mass = kK0MASS;
+    break;
+  case kpdg_muplus:
+  case kpdg_muminus:
+    parent_mass = kMUMASS;
+    break;
+  case kpdg_omegaminus:
+  case kpdg_omegaplus:
+    parent_mass = kOMEGAMASS;
+    break;
+  default:
+    LOG("Flux",pFATAL) << "NU_REWGT unknown particle type " << this->ptype;
+    assert(0);
+    dk.status = 1;
+    return 1;
+  }
+  dk.status = 0;
+
+  dk.vx   = this->vx;
+  dk.vy   = this->vy;
+  dk.vz   = this->vz;
+  dk.pdpx = this->pdpx;
+  dk.pdpy = this->pdpy;
+  dk.pdpz = this->pdpz;
+
+  double parentp2 = ( this->pdpx*this->pdpx +
+                      this->pdpy*this->pdpy +
+                      this->pdpz*this->pdpz );
+  dk.parent_energy = TMath::Sqrt( parentp2 +
+                                  parent_mass*parent_mass);
+  dk.parentp = TMath::Sqrt( parentp2 );
+
+  dk.gamma    = dk.parent_energy / parent_mass;
+  double gamma_sqr = dk.gamma * dk.gamma;
+  dk.beta_mag = TMath::Sqrt( ( gamma_sqr - 1.0 )/gamma_sqr );
+  dk.enuzr    = this->necm;
+
+  dk.is_muon = ( this->ptype == kpdg_muplus || this->ptype == kpdg_muminus );
+  dk.mu_nu   = 0;
+  dk.xnu     = 2.0 * dk.enuzr / kMUMASS;
+  dk.p_pcm   = 0;
+  if ( ! dk.is_muon ) return 0;
+
+  switch ( this->ntype ) {
+  case kpdg_nue:
+  case kpdg_nuebar:
+    dk.mu_nu = 1;
+    break;
+  case kpdg_numu:
+  case kpdg_numubar:
+    dk.mu_nu = 2;
+    break;
+  default:
+    dk.mu_nu = 0;
+  }
+
+  dk.beta[0] = this->pdpx / dk.parent_energy;
+  dk.beta[1] = this->pdpy / dk.parent_energy;
+  dk.beta[2] = this->pdpz / dk.parent_energy;
+
+  // Boost parent of mu to mu production CM
+  double particle_energy = this->ppenergy;
+  double gamma = particle_energy/parent_mass;
+  double beta[3];
+  beta[0] = this->ppdxdz * this->pppz / particle_energy;
+  beta[1] = this->ppdydz * this->pppz / particle_energy;
+  beta[2] =                    this->pppz / particle_energy;
+  double partial = gamma * ( beta[0]*this->muparpx +
+                             beta[1]*this->muparpy +
+                             beta[2]*this->muparpz );
+  partial = this->mupare - partial/(gamma+1.0);
+  dk.p_pcm_mp[0] = this->muparpx - beta[0]*gamma*partial;
+  dk.p_pcm_mp[1] = this->muparpy - beta[1]*gamma*partial;
+  dk.p_pcm_mp[2] = this->muparpz - beta[2]*gamma*partial;
+  dk.p_pcm = TMath::Sqrt ( dk.p_pcm_mp[0]*dk.p_pcm_mp[0] +
+                           dk.p_pcm_mp[1]*dk.p_pcm_mp[1] +
+                           dk.p_pcm_mp[2]*dk.p_pcm_mp[2] );
+  return 0;
+}
+
+//___________________________________________________________________________
+int GNuMIFluxPassThroughInfo::CalcEnuWgt(const GNuMIDecayKinematics& dk, int n,
+                                         const double* x, const double* y,
+                                         const double* z,
+                                         double* enu, double* wgt_xy)
+{
+  // Neutrino energy and weight at n points (beam coord, cm), same as
+  // CalcEnuWgt(xyz,enu,wgt_xy) but starting from the decay kinematics
+  // of CalcDecayKinematics().  Uses no shared state, so it may be called
+  // concurrently; the per point loop has no branches but for muon decays.
+
+  int status = dk.status;
+  for (int i = 0; i < n; ++i) {
+    enu   [i] = 0.0;
+    wgt_xy[i] = 0.0;
+  }
+  if ( status != 0 ) return status;
+
+  for (int i = 0; i < n; ++i) {
+    double dx = x[i] - dk.vx;
+    double dy = y[i] - dk.vy;
+    double dz = z[i] - dk.vz;
+    double rad = TMath::Sqrt( dx*dx + dy*dy + dz*dz );
+
+    // boost correction, but only if parent hasn't stopped
+    double emrat = 1.0;
+    if ( dk.parentp > 0. ) {
+      double costh_pardet = ( dk.pdpx*dx + dk.pdpy*dy + dk.pdpz*dz )
+                            / ( dk.parentp * rad );
+      if ( costh_pardet >  1.0 ) costh_pardet =  1.0;
+      if ( costh_pardet < -1.0 ) costh_pardet = -1.0;
+      emrat = 1.0 / ( dk.gamma * ( 1.0 - dk.beta_mag * costh_pardet ));
+    }
+    enu[i] = emrat * dk.enuzr;
+
+    // solid angle/4pi for detector element, and lorentz boost
+    double sangdet = ( 1.0 - TMath::Cos(TMath::ATan( kRDET / rad)))/2.0;
+    wgt_xy[i] = sangdet * ( emrat * emrat );
+  }
+  if ( ! dk.is_muon ) return 0;
+
+  // polarized muon decay: modify weight (as in CalcEnuWgt)
+  const double eps = 1.0e-30;
+  for (int i = 0; i < n; ++i) {
+    double dx = x[i] - dk.vx;
+    double dy = y[i] - dk.vy;
+    double dz = z[i] - dk.vz;
+    double rad = TMath::Sqrt( dx*dx + dy*dy + dz*dz );
+
+    // Boost neu neutrino to mu decay CM
+    double p_nu[3], p_dcm_nu[4];
+    p_nu[0] = dx*enu[i]/rad;
+    p_nu[1] = dy*enu[i]/rad;
+    p_nu[2] = dz*enu[i]/rad;
+    double partial = dk.gamma *
+      (dk.beta[0]*p_nu[0] + dk.beta[1]*p_nu[1] + dk.beta[2]*p_nu[2] );
+    partial = enu[i] - partial/(dk.gamma+1.0);
+    p_dcm_nu[0] = p_nu[0] - dk.beta[0]*dk.gamma*partial;
+    p_dcm_nu[1] = p_nu[1] - dk.beta[1]*dk.gamma*partial;
+    p_dcm_nu[2] = p_nu[2] - dk.beta[2]*dk.gamma*partial;
+    p_dcm_nu[3] = TMath::Sqrt( p_dcm_nu[0]*p_dcm_nu[0] +
+                               p_dcm_nu[1]*p_dcm_nu[1] +
+                               p_dcm_nu[2]*p_dcm_nu[2] );
+
+    if ( dk.p_pcm < eps || p_dcm_nu[3] < eps ) {
+      if ( status == 0 ) status = 3; // mu missing parent info?
+      continue;
+    }
+    if ( dk.mu_nu == 0 ) {
+      if ( status == 0 ) status = 2; // bad neutrino type
+      continue;
+    }
+    // Calc new decay angle w.r.t. (anti)spin direction
+    double costh = ( p_dcm_nu[0]*dk.p_pcm_mp[0] +
+                     p_dcm_nu[1]*dk.p_pcm_mp[1] +
+                     p_dcm_nu[2]*dk.p_pcm_mp[2] ) /
+                   ( p_dcm_nu[3]*dk.p_pcm );
+    if ( costh >  1.0 ) costh =  1.0;
+    if ( costh < -1.0 ) costh = -1.0;
+    // Calc relative weight due to angle difference
+    double wgt_ratio = ( dk.mu_nu == 1 ) ? 1.0 - costh :
+      ( (3.0-2.0*dk.xnu )  - (1.0-2.0*dk.xnu)*costh ) / (3.0-2.0*dk.xnu);
+    wgt_xy[i] = wgt_xy[i] * wgt_ratio;
+  }
+  return status;
+}
+
 //___________________________________________________________________________
 
 
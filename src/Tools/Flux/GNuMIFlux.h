@@ -41,6 +41,7 @@ class TFile;
 class TChain;
 class TTree;
 class TBranch;
+class TDirectory;
 
 // MakeClass created classes for handling NuMI flux files
 class g3numi;
@@ -56,6 +57,30 @@ namespace flux  {
 class GNuMIFluxPassThroughInfo;
 ostream & operator << (ostream & stream, const GNuMIFluxPassThroughInfo & info);
 
+/// GNuMIDecayKinematics:
+/// =====================
+/// The part of the parent decay re-weighting (CalcEnuWgt) that does not
+/// depend on the point the neutrino is sent to.  Computed once per flux
+/// entry, it allows evaluating (enu,wgt_xy) at many points without
+/// recomputing the parent boost or touching any shared state.
+///
+struct GNuMIDecayKinematics {
+   int    status;         ///< 0=ok, otherwise CalcEnuWgt error code
+   double vx, vy, vz;     ///< decay point (beam coord, cm)
+   double pdpx, pdpy, pdpz;
+   double parentp;        ///< parent momentum at decay
+   double parent_energy;
+   double gamma;
+   double beta_mag;
+   double enuzr;          ///< neutrino energy in the parent decay CM
+   bool   is_muon;        ///< polarized muon decay?
+   int    mu_nu;          ///< muon decay nu: 1=nue(bar), 2=numu(bar), 0=other
+   double xnu;            ///< 2*enuzr/mu_mass
+   double beta[3];        ///< parent (muon) velocity
+   double p_pcm_mp[3];    ///< muon parent momentum in its production CM
+   double p_pcm;
+};
+
 /// GNuMIFluxPassThroughInfo:
 /// =========================
 /// A small persistable C-struct -like class that mirrors (some of) the 
@@ -89,6 +114,14 @@ public:
 
    int CalcEnuWgt(const TLorentzVector& xyz, double& enu, double& wgt_xy) const;
 
+   /// split version of CalcEnuWgt(): point independent part, then
+   /// (enu,wgt_xy) at n points in one go (in beam coord, cm); returns
+   /// the first non-zero error code
+   int        CalcDecayKinematics(GNuMIDecayKinematics& dk) const;
+   static int CalcEnuWgt(const GNuMIDecayKinematics& dk, int n,
+                         const double* x, const double* y, const double* z,
+                         double* enu, double* wgt_xy);
+
    friend ostream & operator << (ostream & stream, const GNuMIFluxPassThroughInfo & info);
 
    int   pcodes;  // 0=original GEANT particle codes, 1=converted to PDG
@@ -238,6 +271,8 @@ public :
   long int               Index         (void) { return  fIEntry;              }
   void                   Clear            (Option_t * opt);
   void                   GenerateWeighted (bool gen_weighted);
+  bool                   SaveState        (TDirectory * dir) const;
+  bool                   RestoreState     (TDirectory * dir);
 
   // Methods specific to the NuMI flux driver,
   // for configuration/initialization of the flux & event generation drivers 
@@ -281,6 +316,7 @@ public :
                              std::vector<std::string>& branchClassNames,
                              std::vector<void**>&      branchObjPointers);
   virtual TTree* GetMetaDataTree();
+  virtual void   SplitEntryRange(int iworker, int nworkers);
 
   //
   // configuration of GNuMIFlux
@@ -299,6 +335,10 @@ public :
             { fMaxWgtFudge = fudge; fMaxWgtEntries = nentries; }
   void      SetMaxEFudge(double fudge = 1.05)                     ///< extra fudge factor in estimating maximum energy
             { fMaxEFudge = fudge; }
+  void      SetMaxWgtCacheDir(string dir)                         ///< re-use max weight scans of the same files & config (default: $GNUMIMAXWGTCACHE)
+            { fMaxWgtCacheDir = dir; }
+  void      SetMaxWgtScanWorkers(int nworkers)                    ///< # of worker processes scanning for max weight (default: $GNUMISCANWORKERS or 1)
+            { fMaxWgtScanWorkers = nworkers; }
   void      SetApplyWindowTiltWeight(bool apply = true)           ///< apply wgt due to tilt of flux window relative to beam
             { fApplyTiltWeight = apply; }
 
@@ -372,12 +412,19 @@ private:
   // Private methods
   //
   bool GenerateNext_weighted (void);
+  bool ReadEntry             (Long64_t ientry);
   void Initialize            (void);
   void SetDefaults           (void);
   void CleanUp               (void);
   void ResetCurrent          (void);
   void AddFile               (TTree* tree, string fname);
   void CalcEffPOTsPerNu      (void);
+  void ScanMaxWgtEntries     (long int ntries, double & wgtmx, double & enumx);
+  bool ScanMaxWgtInWorkers   (double & wgtmx, double & enumx);
+  void ReopenFluxTree        (void);
+  string MaxWgtCacheFile     (void) const;
+  bool LoadCachedMaxWgt      (string filename, double & ntpwgt, double & wgtmx, double & enumx) const;
+  void SaveCachedMaxWgt      (string filename, double ntpwgt, double wgtmx, double enumx) const;
   
   // Private data members
   //
@@ -401,6 +448,9 @@ private:
   double    fMaxWeight;           ///< max flux neutrino weight in input file
   double    fMaxWgtFudge;         ///< fudge factor for estimating max wgt
   long int  fMaxWgtEntries;       ///< # of entries in estimating max wgt
+  string    fMaxWgtCacheDir;      ///< directory of max wgt scan results ("" => no caching)
+  int       fMaxWgtScanWorkers;   ///< # of worker processes scanning for max wgt
+  std::vector<string> fNuFluxFileIds; ///< UUIDs of the files in the chain
   double    fMaxEFudge;           ///< fudge factor for estmating max enu (0=> use fixed 120GeV)
 
   long int  fNUse;                ///< how often to use same entry in a row
@@ -434,6 +484,7 @@ private:
   TLorentzVector   fgX4dkvtx;       ///< decay 4-position beam coord
 
   GNuMIFluxPassThroughInfo* fCurEntry;  ///< copy of current ntuple entry info (owned structure)
+  GNuMIDecayKinematics      fCurDecayKin; ///< point independent decay kinematics of fCurEntry
 
 };
 
@@ -16,6 +16,11 @@
  @ Mar 14, 2014 - TD
    Prevent an infinite loop in GenerateNext() when the flux driver has not been
    properly configured by exiting within GenerateNext_weighted().
+ @ Oct 14, 2026 - CA
+   Added SplitEntryRange() for event generation split among worker processes
+   forked after loading the flux files.
+ @ Oct 14, 2026 - CA
+   Added SaveState() and RestoreState() for checkpointed MC jobs.
 
 */
 //____________________________________________________________________________
@@ -35,6 +40,7 @@
 
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/GBuild.h"
+#include "Framework/EventGen/GMCJCheckpoint.h"
 
 #include "Tools/Flux/GSimpleNtpFlux.h"
 
@@ -186,15 +192,15 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
   } else {
     // Reset previously generated neutrino code / 4-p / 4-x
     this->ResetCurrent();
-    // Move on, read next flux ntuple entry
-    ++fIEntry;
+    // Move on, read next flux ntuple entry (of the entry range, if any)
+    fIEntry = this->NextEntryInRange(fIEntry,fNEntries);
     ++fNEntriesUsed;  // count total # used
     if ( fIEntry >= fNEntries ) {
       // Ran out of entries @ the current cycle of this flux file
       // Check whether more (or infinite) number of cycles is requested
       if (fICycle < fNCycles || fNCycles == 0 ) {
         fICycle++;
-        fIEntry=0;
+        fIEntry = this->NextEntryInRange(-1,fNEntries);
       } else {
         LOG("Flux", pWARN)
           << "No more entries in input flux neutrino ntuple, cycle "
@@ -205,40 +211,7 @@ bool GSimpleNtpFlux::GenerateNext_weighted(void)
       }
     }
     
-    int nbytes = fNuFluxTree->GetEntry(fIEntry);
-    UInt_t metakey = fCurEntry->metakey;
-    if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) ) {
-      UInt_t oldkey = fCurMeta->metakey;
-#ifdef USE_INDEX_FOR_META
-      int nbmeta = fNuMetaTree->GetEntryWithIndex(metakey);
-#else
-      // unordered indices makes ROOT call Error() which might,
-      // if not DefaultErrorHandler, be fatal.
-      // so find the right one by a simple linear search.
-      // not a large burden since it only happens infrequently and
-      // the list is normally quite short.
-      int nmeta = fNuMetaTree->GetEntries();
-      int nbmeta = 0;
-      for (int imeta = 0; imeta < nmeta; ++imeta ) {
-        nbmeta = fNuMetaTree->GetEntry(imeta);
-        if ( fCurMeta->metakey == metakey ) break;
-      }
-      // next condition should never happen
-      if ( fCurMeta->metakey != metakey ) {
-        fCurMeta = 0; // didn't find it!?
-        LOG("Flux",pERROR) << "Failed to find right metakey=" << metakey
-                           << " (was " << oldkey << ") out of " << nmeta 
-                           << " entries";
-      }
-#endif
-      LOG("Flux",pDEBUG) << "Get meta " << metakey 
-                         << " (was " << oldkey << ") "
-                         << fCurMeta->metakey 
-                         << " nb " << nbytes << " " << nbmeta;
-#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-      LOG("Flux",pDEBUG) << "Get meta " << *fCurMeta; 
-#endif
-    }
+    int nbytes = this->ReadEntry(fIEntry);
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
     Int_t ifile = fNuFluxTree->GetFileNumber();
     LOG("Flux",pDEBUG)
@@ -529,6 +502,13 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     << " \"numi\"=" << sba_status[1]
     << " \"aux\"=" << sba_status[2];
 
+  // read ahead only the attached branches
+  std::vector<std::string> branches;
+  branches.push_back("entry");
+  if ( fCurNuMI ) branches.push_back("numi");
+  if ( fCurAux  ) branches.push_back("aux");
+  this->ConfigTreeCache(fNuFluxTree,branches);
+
   // attach requested branches
 
   if (fMaxWeight<=0) {
@@ -548,6 +528,14 @@ void GSimpleNtpFlux::LoadBeamSimData(const std::vector<string>& patterns,
     LOG("Flux",pINFO) << "Config saw \"no-offset-index\"";  
     fIEntry = -1;
   }
+  if ( fUseEntryRange ) {
+    // start from the beginning of the range
+    fIEntry = -1;
+    if ( this->NEntriesInRange(fNEntries) == 0 ) {
+      LOG("Flux", pFATAL) << "No flux entries in the requested entry range";
+      exit(1);
+    }
+  }
   LOG("Flux",pINFO) << "Start with entry fIEntry=" << fIEntry;  
 
   // don't count things we used to estimate max weight
@@ -590,6 +578,151 @@ void GSimpleNtpFlux::GetBranchInfo(std::vector<std::string>& branchNames,
 }
 TTree* GSimpleNtpFlux::GetMetaDataTree() { return fNuMetaTree; }
 
+//___________________________________________________________________________
+int GSimpleNtpFlux::ReadEntry(Long64_t ientry)
+{
+// Read a flux ntuple entry, and the meta data it refers to
+//
+  int nbytes = fNuFluxTree->GetEntry(ientry);
+  UInt_t metakey = fCurEntry->metakey;
+  if ( fAllFilesMeta && ( fCurMeta->metakey != metakey ) ) {
+    UInt_t oldkey = fCurMeta->metakey;
+#ifdef USE_INDEX_FOR_META
+    int nbmeta = fNuMetaTree->GetEntryWithIndex(metakey);
+#else
+    // unordered indices makes ROOT call Error() which might,
+    // if not DefaultErrorHandler, be fatal.
+    // so find the right one by a simple linear search.
+    // not a large burden since it only happens infrequently and
+    // the list is normally quite short.
+    int nmeta = fNuMetaTree->GetEntries();
+    int nbmeta = 0;
+    for (int imeta = 0; imeta < nmeta; ++imeta ) {
+      nbmeta = fNuMetaTree->GetEntry(imeta);
+      if ( fCurMeta->metakey == metakey ) break;
+    }
+    // next condition should never happen
+    if ( fCurMeta->metakey != metakey ) {
+      fCurMeta = 0; // didn't find it!?
+      LOG("Flux",pERROR) << "Failed to find right metakey=" << metakey
+                         << " (was " << oldkey << ") out of " << nmeta 
+                         << " entries";
+    }
+#endif
+    LOG("Flux",pDEBUG) << "Get meta " << metakey 
+                       << " (was " << oldkey << ") "
+                       << fCurMeta->metakey 
+                       << " nb " << nbytes << " " << nbmeta;
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("Flux",pDEBUG) << "Get meta " << *fCurMeta; 
+#endif
+  }
+  return nbytes;
+}
+//___________________________________________________________________________
+bool GSimpleNtpFlux::SaveState(TDirectory * dir) const
+{
+  GMCJCheckpoint::SaveValue(dir, "IEntry",       fIEntry);
+  GMCJCheckpoint::SaveValue(dir, "ICycle",       fICycle);
+  GMCJCheckpoint::SaveValue(dir, "IUse",         fIUse);
+  GMCJCheckpoint::SaveValue(dir, "NNeutrinos",   fNNeutrinos);
+  GMCJCheckpoint::SaveValue(dir, "NEntriesUsed", fNEntriesUsed);
+  GMCJCheckpoint::SaveValue(dir, "SumWeight",    fSumWeight);
+  GMCJCheckpoint::SaveValue(dir, "AccumPOTs",    fAccumPOTs);
+  GMCJCheckpoint::SaveValue(dir, "MaxWeight",    fMaxWeight);
+  GMCJCheckpoint::SaveValue(dir, "Weight",       fWeight);
+  GMCJCheckpoint::SaveValue(dir, "End",          (long int) fEnd);
+  return true;
+}
+//___________________________________________________________________________
+bool GSimpleNtpFlux::RestoreState(TDirectory * dir)
+{
+  // The current entry is read back, as it may be used again by the next
+  // GenerateNext() call (see SetEntryReuse())
+
+  long int end = 0;
+  bool ok =
+    GMCJCheckpoint::LoadValue(dir, "IEntry",       fIEntry)      &&
+    GMCJCheckpoint::LoadValue(dir, "ICycle",       fICycle)      &&
+    GMCJCheckpoint::LoadValue(dir, "IUse",         fIUse)        &&
+    GMCJCheckpoint::LoadValue(dir, "NNeutrinos",   fNNeutrinos)  &&
+    GMCJCheckpoint::LoadValue(dir, "NEntriesUsed", fNEntriesUsed)&&
+    GMCJCheckpoint::LoadValue(dir, "SumWeight",    fSumWeight)   &&
+    GMCJCheckpoint::LoadValue(dir, "AccumPOTs",    fAccumPOTs)   &&
+    GMCJCheckpoint::LoadValue(dir, "MaxWeight",    fMaxWeight)   &&
+    GMCJCheckpoint::LoadValue(dir, "Weight",       fWeight)      &&
+    GMCJCheckpoint::LoadValue(dir, "End",          end);
+  if ( ! ok ) return false;
+  fEnd = (end != 0);
+
+  this->ResetCurrent();
+  if ( fIEntry >= 0 && fIEntry < fNEntries ) this->ReadEntry(fIEntry);
+
+  LOG("Flux", pNOTICE)
+    << "Restored the flux driver state at entry " << fIEntry
+    << " (cycle " << fICycle << ", " << fAccumPOTs << " POTs used)";
+  return true;
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::SplitEntryRange(int iworker, int nworkers)
+{
+  // Keep the share of entries of a forked event generation worker. The
+  // worker reads them through its own chains, from the start of its range,
+  // and only accounts for its own exposure.
+
+  if ( nworkers <= 1 ) return;
+
+  GFluxFileConfigI::SplitEntryRange(iworker,nworkers);
+  if ( this->NEntriesInRange(fNEntries) == 0 ) {
+    LOG("Flux", pFATAL) << "No flux entries left for worker " << iworker;
+    exit(1);
+  }
+  this->ReopenFluxTree();
+  this->Clear("CycleHistory");
+  fIUse         = 9999999;
+  fIEntry       = -1;
+  fNEntriesUsed = 0;
+}
+//___________________________________________________________________________
+void GSimpleNtpFlux::ReopenFluxTree(void)
+{
+  // Read the flux and meta data files through new chains, with the branches
+  // attached as in LoadBeamSimData(). The original chains (and the open files
+  // they share with the parent process) are left alone.
+
+  TChain * fluxchain = new TChain("flux");
+  TChain * metachain = new TChain("meta");
+  TObjArray * files = fNuFluxTree->GetListOfFiles();
+  for (int i = 0; i < files->GetEntries(); ++i) {
+    fluxchain->Add(files->At(i)->GetTitle());
+  }
+  files = fNuMetaTree->GetListOfFiles();
+  for (int i = 0; i < files->GetEntries(); ++i) {
+    metachain->Add(files->At(i)->GetTitle());
+  }
+  fNuFluxTree = fluxchain;
+  fNuMetaTree = metachain;
+
+  std::vector<std::string> branches;
+  fNuFluxTree->SetBranchAddress("entry",&fCurEntry);
+  branches.push_back("entry");
+  if ( fCurNuMI ) {
+    fNuFluxTree->SetBranchAddress("numi",&fCurNuMI);
+    branches.push_back("numi");
+  }
+  if ( fCurAux ) {
+    fNuFluxTree->SetBranchAddress("aux",&fCurAux);
+    branches.push_back("aux");
+  }
+  this->ConfigTreeCache(fNuFluxTree,branches);
+
+  if ( fAllFilesMeta ) {
+    fNuMetaTree->SetBranchAddress("meta",&fCurMeta);
+#ifdef USE_INDEX_FOR_META
+    fNuMetaTree->BuildIndex("metakey");
+#endif
+  }
+}
 //___________________________________________________________________________
 void GSimpleNtpFlux::ProcessMeta(void)
 {
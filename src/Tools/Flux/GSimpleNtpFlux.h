@@ -37,6 +37,7 @@ class TFile;
 class TChain;
 class TTree;
 class TBranch;
+class TDirectory;
 
 using std::string;
 using std::ostream;
@@ -220,6 +221,8 @@ public :
   long int               Index         (void) { return  fIEntry;              }
   void                   Clear            (Option_t * opt);
   void                   GenerateWeighted (bool gen_weighted);
+  bool                   SaveState        (TDirectory * dir) const;
+  bool                   RestoreState     (TDirectory * dir);
 
   // Methods specific to the NuMI flux driver,
   // for configuration/initialization of the flux & event generation drivers 
@@ -272,6 +275,7 @@ public :
                               std::vector<std::string>& branchClassNames,
                               std::vector<void**>&      branchObjPointers);
   virtual TTree* GetMetaDataTree();
+  virtual void   SplitEntryRange(int iworker, int nworkers);
 
   //
   // configuration of GSimpleNtpFlux
@@ -294,6 +298,7 @@ private:
   // Private methods
   //
   bool GenerateNext_weighted (void);
+  int  ReadEntry             (Long64_t ientry);
   void Initialize            (void);
   void SetDefaults           (void);
   void CleanUp               (void);
@@ -302,6 +307,7 @@ private:
   bool OptionalAttachBranch  (std::string bname);
   void CalcEffPOTsPerNu      (void);
   void ScanMeta              (void);
+  void ReopenFluxTree        (void);
 
   // Private data members
   //
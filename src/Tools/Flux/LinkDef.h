@@ -40,11 +40,15 @@
 
 #pragma link C++ class genie::flux::GSimpleNtpFlux;
 
+#pragma link C++ class genie::flux::GCompactFlux;
+#pragma link C++ class genie::flux::GCompactFluxWriter;
+
 #pragma link C++ class genie::flux::GFluxBlender;
 
 #pragma link C++ class genie::flux::GFlavorMixerI;
 #pragma link C++ class genie::flux::GFlavorMixerFactory;
 #pragma link C++ class genie::flux::GFlavorMap;
+#pragma link C++ class genie::flux::GFlavorMixerTable;
 
 #pragma link C++ class genie::flux::GFluxDriverFactory;
 
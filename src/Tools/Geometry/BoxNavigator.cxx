@@ -0,0 +1,257 @@
+//____________________________________________________________________________
+/*
+ Copyright (c) 2003-2019, The GENIE Collaboration
+ For the full text of the license visit http://copyright.genie-mc.org
+ or see $GENIE/LICENSE
+
+ Author: Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+         University of Liverpool & STFC Rutherford Appleton Lab 
+
+ For the class documentation see the corresponding header file.
+
+*/
+//____________________________________________________________________________
+
+#include <algorithm>
+
+#include <TMath.h>
+#include <TGeoVolume.h>
+#include <TGeoMedium.h>
+#include <TGeoMaterial.h>
+#include <TGeoMatrix.h>
+#include <TGeoNode.h>
+#include <TGeoBBox.h>
+
+#include "Tools/Geometry/BoxNavigator.h"
+#include "Tools/Geometry/PathSegmentList.h"
+#include "Framework/Messenger/Messenger.h"
+
+using namespace genie;
+using namespace genie::geometry;
+
+//___________________________________________________________________________
+BoxNavigator::BoxNavigator() :
+fNComplex(0)
+{
+
+}
+//___________________________________________________________________________
+BoxNavigator::~BoxNavigator()
+{
+
+}
+//___________________________________________________________________________
+bool BoxNavigator::Build(const TGeoVolume * top)
+{
+  fNodes.clear();
+  fNComplex = 0;
+
+  if (!top || !top->GetMedium() || 
+      top->GetShape()->IsA() != TGeoBBox::Class()) {
+    LOG("GBoxNav", pWARN) 
+      << "The top volume is not a box - Can not use the box navigation";
+    return false;
+  }
+
+  const TGeoBBox * box    = (const TGeoBBox *) top->GetShape();
+  const double   * origin = box->GetOrigin();
+  double           d[3]   = { box->GetDX(), box->GetDY(), box->GetDZ() };
+
+  BoxNode node;
+  node.fVolume     = top;
+  node.fMedium     = top->GetMedium();
+  node.fMaterial   = top->GetMedium()->GetMaterial();
+  for (int i = 0; i < 3; i++) {
+    node.fLo[i] = origin[i] - d[i];
+    node.fHi[i] = origin[i] + d[i];
+  }
+  node.fDepth      = 0;
+  node.fFirst      = 0;
+  node.fNDaughters = 0;
+  node.fSimple     = true;
+  fNodes.push_back(node);
+
+  double shift[3] = { 0., 0., 0. };
+  this->AddDaughters(0, shift);
+
+  LOG("GBoxNav", pNOTICE) 
+    << "Flattened the geometry into " << fNodes.size() << " boxes, "
+    << fNComplex << " of which are complex regions";
+
+  return true;
+}
+//___________________________________________________________________________
+void BoxNavigator::AddDaughters(int inode, const double * shift)
+{
+// Add the daughters of the input (simple) box, which is translated by the
+// input shift with respect to the top volume, and then their own daughters
+
+  const TGeoVolume * vol = fNodes[inode].fVolume;
+  int ndau  = vol->GetNdaughters();
+  int first = fNodes.size();
+
+  fNodes[inode].fFirst      = first;
+  fNodes[inode].fNDaughters = ndau;
+
+  for (int id = 0; id < ndau; id++) {
+    const TGeoNode   * gnode = vol->GetNode(id);
+    const TGeoVolume * dvol  = gnode->GetVolume();
+    const TGeoMatrix * mtx   = gnode->GetMatrix();
+    const TGeoBBox   * box   = (const TGeoBBox *) dvol->GetShape();
+
+    const double * rot    = mtx->GetRotationMatrix();
+    const double * tr     = mtx->GetTranslation();
+    const double * origin = box->GetOrigin();
+    double         d[3]   = { box->GetDX(), box->GetDY(), box->GetDZ() };
+
+    bool is_unrotated = true;
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) {
+        double rij = (i==j) ? 1. : 0.;
+        if (TMath::Abs(rot[3*i+j] - rij) > 1.e-12) is_unrotated = false;
+      }
+    }
+
+    BoxNode node;
+    node.fVolume     = dvol;
+    node.fMedium     = dvol->GetMedium();
+    node.fMaterial   = (node.fMedium) ? node.fMedium->GetMaterial() : 0;
+    node.fDepth      = fNodes[inode].fDepth + 1;
+    node.fFirst      = 0;
+    node.fNDaughters = 0;
+    node.fSimple     = 
+        (dvol->GetShape()->IsA() == TGeoBBox::Class()) && is_unrotated && 
+        !mtx->IsScale() && !mtx->IsReflection() && 
+        !gnode->IsOverlapping() && !dvol->IsAssembly() && node.fMaterial;
+
+    // (bounding) box in top vol coordinates
+    for (int i = 0; i < 3; i++) {
+      double c = tr[i] + shift[i];
+      double h = 0.;
+      for (int j = 0; j < 3; j++) {
+        c += rot[3*i+j] * origin[j];
+        h += TMath::Abs(rot[3*i+j]) * d[j];
+      }
+      node.fLo[i] = c - h;
+      node.fHi[i] = c + h;
+    }
+    if (!node.fSimple) fNComplex++;
+
+    fNodes.push_back(node);
+  }
+
+  for (int id = 0; id < ndau; id++) {
+    int idau = first + id;
+    if (!fNodes[idau].fSimple) continue;
+
+    const TGeoMatrix * mtx = vol->GetNode(id)->GetMatrix();
+    double dshift[3];
+    for (int i = 0; i < 3; i++) {
+      dshift[i] = shift[i] + mtx->GetTranslation()[i];
+    }
+    this->AddDaughters(idau, dshift);
+  }
+}
+//___________________________________________________________________________
+bool BoxNavigator::Intersect(const BoxNode & node, 
+      const TVector3 & r0, const TVector3 & udir, 
+      double & tin, double & tout) const
+{
+// Slab test: get the part [tin,tout] of the ray (t>=0) inside the box
+
+  tin  = 0.;
+  tout = 1.e+300;
+
+  for (int i = 0; i < 3; i++) {
+    if (udir[i] == 0.) {
+      if (r0[i] < node.fLo[i] || r0[i] > node.fHi[i]) return false;
+      continue;
+    }
+    double t1 = (node.fLo[i] - r0[i]) / udir[i];
+    double t2 = (node.fHi[i] - r0[i]) / udir[i];
+    if (t1 > t2) std::swap(t1,t2);
+    tin  = TMath::Max(tin,  t1);
+    tout = TMath::Min(tout, t2);
+    if (tout <= tin) return false;
+  }
+  return true;
+}
+//___________________________________________________________________________
+bool BoxNavigator::Swim(
+   const TVector3 & r0, const TVector3 & udir, PathSegmentList & psl) const
+{
+  if (fNodes.empty()) return false;
+
+  // find all boxes crossed by the ray, descending only into crossed boxes
+  vector<BoxHit> hits;
+  vector<int>    stack;
+  stack.push_back(0);
+  while (!stack.empty()) {
+    int inode = stack.back();
+    stack.pop_back();
+
+    const BoxNode & node = fNodes[inode];
+    BoxHit hit;
+    if (!this->Intersect(node, r0, udir, hit.fTin, hit.fTout)) continue;
+    if (!node.fSimple) return false; // needs the full navigation
+
+    hit.fNode = inode;
+    hits.push_back(hit);
+    for (int id = 0; id < node.fNDaughters; id++) {
+      stack.push_back(node.fFirst + id);
+    }
+  }
+  if (hits.empty()) return true; // the ray misses the detector
+
+  // split the ray at all box boundaries and assign each part to the
+  // innermost box containing it
+  vector<double> tb;
+  for (unsigned int ih = 0; ih < hits.size(); ih++) {
+    tb.push_back(hits[ih].fTin);
+    tb.push_back(hits[ih].fTout);
+  }
+  std::sort(tb.begin(), tb.end());
+
+  const double tmin = 1.e-9 * (hits[0].fTout - hits[0].fTin);
+
+  PathSegment ps;
+  int    last_node = -1;
+  double last_tout = 0.;
+  for (unsigned int ib = 0; ib+1 < tb.size(); ib++) {
+    double t1 = tb[ib];
+    double t2 = tb[ib+1];
+    if (t2 - t1 <= tmin) continue;
+
+    double tmid = 0.5*(t1+t2);
+    int inner = -1;
+    for (unsigned int ih = 0; ih < hits.size(); ih++) {
+      const BoxHit & hit = hits[ih];
+      if (tmid < hit.fTin || tmid > hit.fTout) continue;
+      if (inner < 0 || fNodes[hit.fNode].fDepth > fNodes[inner].fDepth) {
+        inner = hit.fNode;
+      }
+    }
+    if (inner < 0) continue;
+
+    // extend the previous segment if still in the same box
+    if (inner == last_node && t1 - last_tout <= tmin) {
+      ps.SetExit(r0 + t2*udir);
+      ps.SetStep(t2 - ps.fRayDist);
+      last_tout = t2;
+      continue;
+    }
+    if (last_node >= 0) psl.AddSegment(ps);
+
+    const BoxNode & node = fNodes[inner];
+    ps.SetEnter(r0 + t1*udir, t1);
+    ps.SetExit (r0 + t2*udir);
+    ps.SetGeo  (node.fVolume, node.fMedium, node.fMaterial);
+    ps.SetStep (t2 - t1);
+    last_node = inner;
+    last_tout = t2;
+  }
+  if (last_node >= 0) psl.AddSegment(ps);
+
+  return true;
+}
+//___________________________________________________________________________
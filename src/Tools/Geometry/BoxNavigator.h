@@ -0,0 +1,101 @@
+//____________________________________________________________________________
+/*!
+
+\class    genie::geometry::BoxNavigator
+
+\brief    An optional, faster alternative to the TGeo navigation used by the
+          ROOTGeomAnalyzer for detectors built mostly out of boxes.
+
+          The volume tree below the top volume is flattened into a list of
+          axis-aligned boxes (in top volume coordinates) with their material.
+          Rays are then intersected analytically with the boxes (slab method),
+          descending in the volume tree only into the boxes that are crossed,
+          and the path segments are built from the innermost box found along
+          each part of the ray.
+          Volumes that are not unrotated boxes (or that are assemblies, are
+          overlapping etc) are kept as 'complex' regions, represented by their
+          bounding box: Rays crossing a complex region are not handled and
+          must be swum with the full TGeo navigation.
+
+\author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
+          University of Liverpool & STFC Rutherford Appleton Lab
+
+\created  October 14, 2026
+
+\cpright  Copyright (c) 2003-2019, The GENIE Collaboration
+          For the full text of the license visit http://copyright.genie-mc.org
+          or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#ifndef _BOX_NAVIGATOR_H_
+#define _BOX_NAVIGATOR_H_
+
+#include <vector>
+
+#include <TVector3.h>
+
+class TGeoVolume;
+class TGeoMedium;
+class TGeoMaterial;
+
+using std::vector;
+
+namespace genie    {
+namespace geometry {
+
+class PathSegmentList;
+
+class BoxNavigator {
+
+public :
+  BoxNavigator();
+ ~BoxNavigator();
+
+  /// flatten the volume tree of the input top volume (false if the top
+  /// volume itself is not a box)
+  bool Build (const TGeoVolume * top);
+
+  /// add the path segments of the input ray (top vol coord & units) to the
+  /// input list; false, with the list untouched, if the ray crosses a
+  /// complex region or no geometry was built
+  bool Swim  (const TVector3 & r0, const TVector3 & udir, 
+              PathSegmentList & psl) const;
+
+  bool         IsBuilt    (void) const { return !fNodes.empty(); }
+  unsigned int NBoxes     (void) const { return fNodes.size();   }
+  unsigned int NComplex   (void) const { return fNComplex;       }
+
+private:
+
+  struct BoxNode {
+    const TGeoVolume *   fVolume;   ///< ref only ptr to TGeoVolume
+    const TGeoMedium *   fMedium;   ///< ref only ptr to TGeoMedium
+    const TGeoMaterial * fMaterial; ///< ref only ptr to TGeoMaterial
+    double               fLo[3];    ///< lower box corner (top vol coord)
+    double               fHi[3];    ///< upper box corner (top vol coord)
+    int                  fDepth;    ///< depth in the volume tree (top: 0)
+    int                  fFirst;    ///< index of the first daughter box
+    int                  fNDaughters; ///< number of daughter boxes
+    bool                 fSimple;   ///< unrotated box? (else complex region)
+  };
+
+  struct BoxHit {
+    double fTin;   ///< ray distance at box entry
+    double fTout;  ///< ray distance at box exit
+    int    fNode;  ///< box index
+  };
+
+  void AddDaughters (int inode, const double * shift);
+  bool Intersect    (const BoxNode & node, 
+                     const TVector3 & r0, const TVector3 & udir,
+                     double & tin, double & tout) const;
+
+  vector<BoxNode> fNodes;     ///< flattened volume tree (daughters contiguous)
+  unsigned int    fNComplex;  ///< number of complex regions
+};
+
+}      // geometry namespace
+}      // genie    namespace
+
+#endif // _BOX_NAVIGATOR_H_
@@ -177,6 +177,21 @@ void GeomVolSelectorFiducial::EndPSList() const
   fCurrPathSegmentList = 0;
 }
 
+//___________________________________________________________________________
+bool GeomVolSelectorFiducial::RayMayBeSelected(const TVector3& start,
+                                               const TVector3& dir) const
+{
+  // Analytic ray vs. shape test so that rays that can't reach the 
+  // fiducial volume needn't be swum through the geometry at all.
+  // A miss (or an intercept entirely behind the ray origin) would have 
+  // every step trimmed away by TrimSegment() anyway.
+
+  if ( fSelectReverse || ! fShape ) return true;
+
+  RayIntercept intercept = fShape->Intercept(start,dir);
+  return ( intercept.fIsHit && intercept.fDistOut > 0 );
+}
+
 //___________________________________________________________________________
 void GeomVolSelectorFiducial::AdoptFidShape(FidShape* shape)
 {
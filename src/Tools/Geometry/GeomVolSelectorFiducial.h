@@ -55,6 +55,9 @@ public :
   void BeginPSList(const PathSegmentList* untrimmed) const;
   void EndPSList() const;
 
+  // early rejection of rays that miss the fiducial shape
+  bool RayMayBeSelected(const TVector3& start, const TVector3& dir) const;
+
   // allow the selection to be reversed (i.e. exclude "fid" region)
   void SetReverseFiducial(Bool_t reverse=true) { fSelectReverse = reverse; }
 
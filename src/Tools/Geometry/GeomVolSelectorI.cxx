@@ -55,10 +55,18 @@ GeomVolSelectorI::~GeomVolSelectorI()
 
 PathSegmentList* 
 GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed) const
+{
+  PathSegmentList* trimmed = new PathSegmentList();
+  this->TrimList(untrimmed,trimmed);
+  return trimmed;
+}
+//___________________________________________________________________________
+void GeomVolSelectorI::TrimList(const PathSegmentList* untrimmed,
+                                PathSegmentList* trimmed) const
 {
   this->BeginPSList(untrimmed);
 
-  PathSegmentList* trimmed = new PathSegmentList();
+  trimmed->SetAllToZero();
   trimmed->SetStartInfo(untrimmed->GetStartPos(),untrimmed->GetDirection());
 
   const genie::geometry::PathSegmentList::PathSegmentV_t& segments = 
@@ -67,15 +75,14 @@ GeomVolSelectorI::GenerateTrimmedList(const PathSegmentList* untrimmed) const
   genie::geometry::PathSegmentList::PathSegVCItr_t sitr_end = segments.end();
 
   for ( ; sitr != sitr_end ; ++sitr ) {
-    PathSegment ps = *sitr;  // new PathSegment is a copy of old
+    // put a copy of the old entry on the trimmed list, then adjust it
+    PathSegment & ps = trimmed->AddSegment(*sitr);
     this->TrimSegment(ps);
-    if ( fRemoveEntries && ps.GetSummedStepRange() == 0 ) continue; // remove null segments
-    // now put (adjusted) entry on trimmed list
-    trimmed->AddSegment(ps);
+    if ( fRemoveEntries && ps.GetSummedStepRange() == 0 ) {
+      trimmed->RemoveLastSegment(); // remove null segments
+    }
   }
 
   this->EndPSList();
-
-  return trimmed;
 }
 //___________________________________________________________________________
@@ -40,6 +40,10 @@ public :
   /// relinquishes ownership of returned object
   virtual PathSegmentList* GenerateTrimmedList(const PathSegmentList* untrimmed) const;
 
+  /// fill (in place, re-using its storage) a trimmed copy of the old list
+  virtual void TrimList(const PathSegmentList* untrimmed, 
+                        PathSegmentList* trimmed) const;
+
   /// This is the method every derived version must implement
   /// To reject a segment outright:  segment.fStepRangeSet.clear()
   virtual void TrimSegment(PathSegment& segment) const = 0;
@@ -51,6 +55,14 @@ public :
   virtual void BeginPSList(const PathSegmentList* untrimmed) const = 0;
   virtual void EndPSList() const = 0;
 
+  /// Cheap test, done before the ray is swum through the geometry, of
+  /// whether any part of the ray (start & dir in "top vol" coords and
+  /// units) could survive the trimming.  Returning false lets the caller
+  /// skip the navigation altogether; the default is to always swim.
+  virtual bool RayMayBeSelected(const TVector3& /* start */,
+                                const TVector3& /* dir */) const
+  { return true; }
+
   /// configure for individual neutrino ray
   void SetCurrentRay(const TLorentzVector& x4, const TLorentzVector& p4)
   { fX4 = x4; fP4 = p4; }
@@ -251,8 +251,36 @@ void PathSegmentList::SetAllToZero(void)
 
   this->fStartPos.SetXYZ(0,0,1e37); // clear cache of position/direction
   this->fDirection.SetXYZ(0,0,0);   //
-  this->fSegmentList.clear();       // clear the vector
-  this->fMatStepSum.clear();        // clear the re-factorized info
+
+  // recycle the segments rather than freeing them
+  this->fSpareSegments.splice(fSpareSegments.end(),fSegmentList);
+
+  // zero (but keep) the re-factorized info
+  MaterialMap_t::iterator mitr = fMatStepSum.begin();
+  for ( ; mitr != fMatStepSum.end(); ++mitr ) mitr->second = 0;
+}
+
+//___________________________________________________________________________
+PathSegment & PathSegmentList::AddSegment(const PathSegment& ps)
+{
+  // append a copy of the segment, re-using a spare one if there is any
+  if ( fSpareSegments.empty() ) {
+    fSegmentList.push_back(ps);
+  } else {
+    fSegmentList.splice(fSegmentList.end(),fSpareSegments,
+                        fSpareSegments.begin());
+    fSegmentList.back() = ps;
+  }
+  return fSegmentList.back();
+}
+
+//___________________________________________________________________________
+void PathSegmentList::RemoveLastSegment(void)
+{
+  if ( fSegmentList.empty() ) return;
+  PathSegmentV_t::iterator last = fSegmentList.end();
+  --last;
+  fSpareSegments.splice(fSpareSegments.end(),fSegmentList,last);
 }
 
 //___________________________________________________________________________
@@ -271,7 +299,8 @@ bool PathSegmentList::IsSameStart(const TVector3& pos, const TVector3& dir) cons
 //___________________________________________________________________________
 void PathSegmentList::FillMatStepSum(void) 
 {
-  fMatStepSum.clear();
+  MaterialMap_t::iterator mitr = fMatStepSum.begin();
+  for ( ; mitr != fMatStepSum.end(); ++mitr ) mitr->second = 0;
 
   PathSegmentList::PathSegVCItr_t sitr = fSegmentList.begin();
   PathSegmentList::PathSegVCItr_t sitr_end = fSegmentList.end();
@@ -287,8 +316,7 @@ void PathSegmentList::FillMatStepSum(void)
 //___________________________________________________________________________
 void PathSegmentList::Copy(const PathSegmentList & plist)
 {
-  fSegmentList.clear();
-  fMatStepSum.clear();
+  this->SetAllToZero();
 
   // copy the segments
   //vector<PathSegment>::const_iterator pl_iter;
@@ -299,7 +327,8 @@ void PathSegmentList::Copy(const PathSegmentList & plist)
   // other elements
   fStartPos     = plist.fStartPos;
   fDirection    = plist.fDirection;
-  fSegmentList  = plist.fSegmentList;
+  PathSegmentList::PathSegVCItr_t sitr = plist.fSegmentList.begin();
+  for ( ; sitr != plist.fSegmentList.end() ; ++sitr ) this->AddSegment(*sitr);
   fMatStepSum   = plist.fMatStepSum;
   fDoCrossCheck = plist.fDoCrossCheck;
   fPrintVerbose = plist.fPrintVerbose;
@@ -134,7 +134,8 @@ public :
   void    SetStartInfo    (const TVector3& pos = TVector3(0,0,1e37), 
                            const TVector3& dir = TVector3(0,0,0)     );
   bool    IsSameStart     (const TVector3& pos, const TVector3& dir) const;
-  void    AddSegment      (const PathSegment& ps) { fSegmentList.push_back(ps); }
+  PathSegment & AddSegment        (const PathSegment& ps);
+  void          RemoveLastSegment (void);
 
   const TVector3& GetDirection() const { return fDirection; }
   const TVector3& GetStartPos() const  { return fStartPos; }
@@ -173,7 +174,12 @@ public :
   /// Actual list of segments
   PathSegmentV_t   fSegmentList;
 
+  /// Segments released by SetAllToZero(), kept (with their step range and
+  /// path storage) so that AddSegment() needn't allocate for the next ray
+  PathSegmentV_t   fSpareSegments;
+
   /// Segment list re-evaluated by material for fast lookup of path lengths
+  /// (materials seen by earlier rays are kept, with a zero sum)
   MaterialMap_t    fMatStepSum;
 
   bool             fDoCrossCheck;
@@ -86,9 +86,12 @@
 */
 //____________________________________________________________________________
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <cstdio>
 #include <iomanip>
+#include <sstream>
 #include <set>
 
 #include <TGeoVolume.h>
@@ -105,11 +108,14 @@
 #include <TMath.h>
 #include <TPolyMarker3D.h>
 #include <TGeoBBox.h>
+#include <TGeoNavigator.h>
 
 #include "Framework/Conventions/GBuild.h"
 #include "Framework/Conventions/Units.h"
 #include "Framework/Conventions/Controls.h"
+#include "Framework/Conventions/XmlParserStatus.h"
 #include "Tools/Geometry/PathSegmentList.h"
+#include "Tools/Geometry/BoxNavigator.h"
 #include "Framework/EventGen/PathLengthList.h"
 #include "Framework/EventGen/GFluxI.h"
 #include "Tools/Geometry/ROOTGeomAnalyzer.h"
@@ -119,7 +125,9 @@
 #include "Framework/ParticleData/PDGCodeList.h"
 #include "Framework/ParticleData/PDGLibrary.h"
 #include "Framework/Utils/PrintUtils.h"
+#include "Framework/Utils/PhaseTimer.h"
 
+using std::ostringstream;
 using namespace genie;
 using namespace genie::geometry;
 using namespace genie::controls;
@@ -204,6 +212,12 @@ const PathLengthList & ROOTGeomAnalyzer::ComputeMaxPathLengths(void)
   //-- initialize max path lengths
   fCurrMaxPathLengthList->SetAllToZero();
 
+  //-- re-use the max path lengths of an earlier job with the same setup
+  string cache_file = this->MaxPlCacheFile();
+  if ( !cache_file.empty() && this->LoadCachedMaxPathLengths(cache_file) ) {
+    return *fCurrMaxPathLengthList;
+  }
+
   //-- select maximum path length calculation method
   if ( fFlux ) {
     this->MaxPathLengthsFluxMethod();
@@ -214,6 +228,8 @@ const PathLengthList & ROOTGeomAnalyzer::ComputeMaxPathLengths(void)
     this->MaxPathLengthsBoxMethod();
   }
 
+  if ( !cache_file.empty() ) this->SaveCachedMaxPathLengths(cache_file);
+
   return *fCurrMaxPathLengthList;
 }
 
@@ -254,27 +270,93 @@ const PathLengthList & ROOTGeomAnalyzer::ComputePathLengths(
   // reset current list of path-lengths
   fCurrPathLengthList->SetAllToZero();
 
-  //loop over materials & compute the path-length
-  vector<int>::iterator itr;
-  for (itr=fCurrPDGCodeList->begin();itr!=fCurrPDGCodeList->end();itr++) {
+  // swim (once) along the ray and distribute the step summed in each
+  // material over all the target nuclei found in it
+  this->SwimOnce(pos,udir);
 
-    int pdgc = *itr;
-
-    Double_t pl = this->ComputePathLengthPDG(pos,udir,pdgc);
-    fCurrPathLengthList->AddPathLength(pdgc,pl);
+  PathSegmentList::MaterialMapCItr_t itr     = 
+    fCurrPathSegmentList->GetMatStepSumMap().begin();
+  PathSegmentList::MaterialMapCItr_t itr_end = 
+    fCurrPathSegmentList->GetMatStepSumMap().end();
+  for ( ; itr != itr_end; ++itr ) {
+    const TGeoMaterial * mat = itr->first;
+    if ( ! mat ) continue;  // segment outside geometry has no material
+    double step = itr->second;
+    const vector< pair<int,double> > & weights = this->GetWeights(mat);
+    for (unsigned int iw = 0; iw < weights.size(); iw++) {
+      fCurrPathLengthList->AddPathLength(
+                               weights[iw].first, step*weights[iw].second);
+    }
+  } // loop over materials
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
-    LOG("GROOTGeom", pINFO)
-      <<"Calculated path length for material: " << pdgc << " = " << pl;
+  LOG("GROOTGeom", pINFO)
+    << "Calculated path lengths (curr geom units): " << *fCurrPathLengthList;
 #endif
 
-  } // loop over materials
-
   this->Local2SI(*fCurrPathLengthList); // curr geom units -> SI
 
   return *fCurrPathLengthList;
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::ComputePathLengthMatrix(int nrays, 
+     const TLorentzVector * x, const TLorentzVector * p, vector<double> & pl)
+{
+/// Computes the path-lengths of a batch of rays (x[i], p[i]) (master coord,
+/// SI units) as a dense matrix pl[iray * ntgt + itgt], with the targets in
+/// the order of ListOfTargetNuclei(). Equivalent to ComputePathLengths() for
+/// each ray, but filling the matrix rows directly rather than a path-length
+/// map, and with the unit conversions set up once per batch.
+
+  const PDGCodeList & tgtlist = *fCurrPDGCodeList; // sorted
+  unsigned int ntgt = tgtlist.size();
+
+  pl.assign(nrays * ntgt, 0.);
+
+  double scaling_factor = this->LengthUnits();
+  if (this->WeightWithDensity()) { scaling_factor *= this->DensityUnits(); }
+
+  double si2local = 1/this->LengthUnits();
+  if ( fGeomVolSelector ) fGeomVolSelector->SetSI2Local(si2local);
+
+  for (int iray = 0; iray < nrays; iray++) {
+
+    if ( fGeomVolSelector ) fGeomVolSelector->SetCurrentRay(x[iray],p[iray]);
+
+    TVector3 udir = p[iray].Vect().Unit(); // unit vector along direction
+    TVector3 pos  = x[iray].Vect();        // initial position
+    pos *= si2local;                       // SI -> curr geom units
+    if (!fMasterToTopIsIdentity) {
+      this->Master2Top(pos);         // transform position (master -> top)
+      this->Master2TopDir(udir);     // transform direction (master -> top)
+    }
+
+    this->SwimOnce(pos,udir);
+
+    double * row = &pl[iray * ntgt];
+
+    PathSegmentList::MaterialMapCItr_t itr     = 
+      fCurrPathSegmentList->GetMatStepSumMap().begin();
+    PathSegmentList::MaterialMapCItr_t itr_end = 
+      fCurrPathSegmentList->GetMatStepSumMap().end();
+    for ( ; itr != itr_end; ++itr ) {
+      const TGeoMaterial * mat = itr->first;
+      if ( ! mat ) continue;  // segment outside geometry has no material
+      double step = itr->second;
+      const vector< pair<int,double> > & weights = this->GetWeights(mat);
+      for (unsigned int iw = 0; iw < weights.size(); iw++) {
+        unsigned int itgt = std::lower_bound(tgtlist.begin(), tgtlist.end(), 
+                                     weights[iw].first) - tgtlist.begin();
+        row[itgt] += step*weights[iw].second;
+      }
+    }
+    for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+      row[itgt] *= scaling_factor;  // curr geom units -> SI
+    }
+  } // rays
+}
+
 //___________________________________________________________________________
 const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
               const TLorentzVector & x, const TLorentzVector & p, int tgtpdg)
@@ -345,25 +427,8 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
   }
 #endif
 
-  // compute the pdg weight for each material just once, then use a stl map 
-  PathSegmentList::MaterialMap_t wgtmap;
-  PathSegmentList::MaterialMapCItr_t mitr     = 
-    fCurrPathSegmentList->GetMatStepSumMap().begin();
-  PathSegmentList::MaterialMapCItr_t mitr_end = 
-    fCurrPathSegmentList->GetMatStepSumMap().end();
-  // loop over map to get tgt weight for each material (once)
-  // steps outside the geometry may have no assigned material
-  for ( ; mitr != mitr_end; ++mitr ) {
-    const TGeoMaterial* mat = mitr->first;
-    double wgt = ( mat ) ? this->GetWeight(mat,tgtpdg) : 0;
-    wgtmap[mat] = wgt;
-#ifdef RWH_DEBUG
-    if ( ( fDebugFlags & 0x02 ) ) {
-      LOG("GROOTGeom", pINFO)
-        << " wgtmap[" << mat->GetName() << "] pdg " << tgtpdg << " wgt " << Form("%.6f",wgt);
-    }
-#endif
-  }
+  // the pdg weight of each material is taken from the GetWeights() cache
+  // (no per-vertex map has to be built)
 
   // walk down the path to pick the vertex
   const genie::geometry::PathSegmentList::PathSegmentV_t& segments = 
@@ -374,7 +439,14 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
     const genie::geometry::PathSegment& seg = *sitr;
     const TGeoMaterial* mat = seg.fMaterial;
     double trimmed_step = seg.GetSummedStepRange();
-    double wgtstep = trimmed_step * wgtmap[mat];
+    double wgt = this->GetCachedWeight(mat,tgtpdg);
+#ifdef RWH_DEBUG
+    if ( ( fDebugFlags & 0x02 ) && mat ) {
+      LOG("GROOTGeom", pINFO)
+        << " wgt[" << mat->GetName() << "] pdg " << tgtpdg << " wgt " << Form("%.6f",wgt);
+    }
+#endif
+    double wgtstep = trimmed_step * wgt;
     double beyond = walked + wgtstep;
 #ifdef RWH_DEBUG
     if ( ( fDebugFlags & 0x04 ) ) {
@@ -391,7 +463,7 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
           << "Choose vertex pos walked=" << walked 
           << " beyond=" << beyond 
           << " wgtstep " << wgtstep
-          << " ( " << trimmed_step << "*" << wgtmap[mat] << ")"
+          << " ( " << trimmed_step << "*" << wgt << ")"
           << " look for " << genwgt_dist
           << " in " << seg.fVolume->GetName() << " "
           << mat->GetName();
@@ -405,8 +477,8 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
           << genwgt_dist << " " << walked << " " << wgtstep;
       }
       pos = seg.GetPosition(frac);
-      fGeometry -> SetCurrentPoint (pos[0],pos[1],pos[2]);
-      fGeometry -> FindNode();
+      this->Navigator() -> SetCurrentPoint (pos[0],pos[1],pos[2]);
+      this->Navigator() -> FindNode();
       LOG("GROOTGeom", pINFO)
         << "Choose vertex position in " << seg.fVolume->GetName() << " "
          << utils::print::Vec3AsString(&pos);
@@ -417,8 +489,8 @@ const TVector3 & ROOTGeomAnalyzer::GenerateVertex(
 
   LOG("GROOTGeom", pNOTICE)
      << "The vertex was placed in volume: " 
-     << fGeometry->GetCurrentVolume()->GetName()
-     << ", path: " << fGeometry->GetPath();
+     << this->Navigator()->GetCurrentVolume()->GetName()
+     << ", path: " << this->Navigator()->GetPath();
 
   // warn for any volume overshoots
   bool ok = this->FindMaterialInCurrentVol(tgtpdg);
@@ -508,6 +580,7 @@ void ROOTGeomAnalyzer::SetMixtureWeightsSum(double sum)
 /// compute the correct weight normalization.
 
   fMixtWghtSum = sum;
+  fMatWeights.clear();
 }
 
 //___________________________________________________________________________
@@ -557,6 +630,8 @@ void ROOTGeomAnalyzer::SetTopVolName(string name)
   // set volume name
   fTopVolume = gvol;
   fGeometry->SetTopVolume(fTopVolume);
+  if (fNavigator) fNavigator->ResetAll();
+  if (fBoxNav) { delete fBoxNav; fBoxNav = 0; }
 }
 
 //===========================================================================
@@ -726,15 +801,26 @@ void ROOTGeomAnalyzer::Initialize(void)
   fCurrMaxPathLengthList = 0;
   fCurrPathLengthList    = 0;
   fCurrPathSegmentList   = 0;
+  fTrimPathSegmentList   = 0;
   fGeomVolSelector       = 0;
   fCurrPDGCodeList       = 0;
+  fNavigator             = 0;
+  fUseBoxNav             = false;
+  fBoxNav                = 0;
   fTopVolume             = 0;
   fTopVolumeName         = "";
   fKeepSegPath           = false;
+  fMaxPlCacheDir         = "";
+
+  // cache the max path lengths found by the box scanner if asked to
+  const char * cache_dir = std::getenv("GMAXPLCACHE");
+  if ( cache_dir ) fMaxPlCacheDir = cache_dir;
 
   // some defaults:
   this -> SetScannerNPoints    (200);
   this -> SetScannerNRays      (200);
+  this -> SetScannerNRefineRays(0);
+  this -> SetScannerRefineTol  (1.e-3);
   this -> SetScannerNParticles (10000);
   this -> SetScannerFlux       (0);
   this -> SetMaxPlSafetyFactor (1.1);
@@ -748,6 +834,7 @@ void ROOTGeomAnalyzer::Initialize(void)
   fmxddist = 0;
   fmxdstep = 0;
   fDebugFlags = 0;
+  fNNavSteps  = 0;
 }
 
 //___________________________________________________________________________
@@ -756,10 +843,12 @@ void ROOTGeomAnalyzer::CleanUp(void)
   LOG("GROOTGeom", pNOTICE) << "Cleaning up...";
 
   if ( fCurrPathSegmentList   ) delete fCurrPathSegmentList;
+  if ( fTrimPathSegmentList   ) delete fTrimPathSegmentList;
   if ( fCurrPathLengthList    ) delete fCurrPathLengthList;
   if ( fCurrMaxPathLengthList ) delete fCurrMaxPathLengthList;
   if ( fCurrPDGCodeList       ) delete fCurrPDGCodeList;
   if ( fMasterToTop           ) delete fMasterToTop;
+  if ( fBoxNav                ) delete fBoxNav;
 }
 
 //___________________________________________________________________________
@@ -767,6 +856,8 @@ void ROOTGeomAnalyzer::Load(string filename)
 {
 /// Load the detector geometry from the input ROOT file
 ///
+  PhaseTimerGuard timer("ROOTGeomAnalyzer::Load");
+
   LOG("GROOTGeom", pNOTICE) << "Loading geometry from: " << filename;
 
   bool is_accessible = ! (gSystem->AccessPathName( filename.c_str() ));
@@ -787,7 +878,8 @@ void ROOTGeomAnalyzer::Load(TGeoManager * gm)
 
   LOG("GROOTGeom", pNOTICE)
          << "A TGeoManager is being loaded to the geometry driver";
-  fGeometry = gm;
+  fGeometry  = gm;
+  fNavigator = 0;
 
   if (!fGeometry) {
     LOG("GROOTGeom", pFATAL) << "Null TGeoManager! Aborting";
@@ -833,6 +925,7 @@ void ROOTGeomAnalyzer::BuildListOfTargetNuclei(void)
 /// found in materials outside the top volume.
 
   fCurrPDGCodeList = new PDGCodeList;
+  fMatWeights.clear();
 
   if (!fGeometry) {
     LOG("GROOTGeom", pFATAL) << "No ROOT geometry is loaded!!";
@@ -1042,6 +1135,60 @@ double ROOTGeomAnalyzer::GetWeight(const TGeoMixture* mixt, int ielement, int pd
   return weight;
 }
 
+//___________________________________________________________________________
+const vector< pair<int,double> > & 
+ROOTGeomAnalyzer::GetWeights(const TGeoMaterial * mat)
+{
+/// Get the (target pdg code, weight) pairs for all target nuclei found in
+/// the input material, as given by GetWeight(mat,pdgc).
+/// The list is built the first time a material is seen and then re-used.
+
+  map<const TGeoMaterial *, vector< pair<int,double> > >::iterator 
+    mitr = fMatWeights.find(mat);
+  if (mitr != fMatWeights.end()) return mitr->second;
+
+  vector< pair<int,double> > & weights = fMatWeights[mat];
+
+  // target nuclei in the material
+  vector<int> pdgv;
+  const TGeoMixture * mixt = (mat->IsMixture()) ? 
+                       dynamic_cast <const TGeoMixture*> (mat) : 0;
+  if (mixt) {
+    for (int i = 0; i < mixt->GetNelements(); i++) {
+      int pdgc = this->GetTargetPdgCode(mixt,i);
+      if (std::find(pdgv.begin(),pdgv.end(),pdgc) == pdgv.end()) 
+        pdgv.push_back(pdgc);
+    }
+  } else {
+    pdgv.push_back(this->GetTargetPdgCode(mat));
+  }
+
+  for (unsigned int i = 0; i < pdgv.size(); i++) {
+    int pdgc = pdgv[i];
+    if (!fCurrPDGCodeList->ExistsInPDGCodeList(pdgc)) continue;
+    double weight = this->GetWeight(mat,pdgc);
+    if (weight != 0.) weights.push_back(pair<int,double>(pdgc,weight));
+  }
+
+  return weights;
+}
+
+//___________________________________________________________________________
+double ROOTGeomAnalyzer::GetCachedWeight(const TGeoMaterial * mat, int pdgc)
+{
+/// The weight GetWeight(mat,pdgc) of one of the target nuclei, looked up in
+/// the GetWeights() cache. Returns 0 if there is no material or the target
+/// is not found in it.
+
+  if ( ! mat ) return 0;
+
+  const vector< pair<int,double> > & weights = this->GetWeights(mat);
+  for (unsigned int iw = 0; iw < weights.size(); iw++) {
+    if (weights[iw].first == pdgc) return weights[iw].second;
+  }
+  return 0;
+}
+
 //___________________________________________________________________________
 void ROOTGeomAnalyzer::MaxPathLengthsFluxMethod(void)
 {
@@ -1119,35 +1266,60 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
   accum_vol_stat = true;
 #endif
 
+  const int kNRaysPerBatch = 1000;
+
   int  iparticle = 0;
   bool ok = true;
   TLorentzVector nux4;
   TLorentzVector nup4;
 
-  PathLengthList::const_iterator pl_iter;
+  const PDGCodeList & tgtlist = *fCurrPDGCodeList;
+  unsigned int ntgt = tgtlist.size();
 
-  while ( (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
+  // ray giving the current max path length, for each material
+  map<int, pair<TLorentzVector,TLorentzVector> > maxpl_rays;
 
-    //LOG("GMCJDriver", pNOTICE)
-    //  << "\n [-] Generated flux neutrino: "
-    //  << "\n  |----o 4-momentum : " << utils::print::P4AsString(&nup4)
-    //  << "\n  |----o 4-position : " << utils::print::X4AsString(&nux4);
+  // generate the rays and compute their path lengths in batches
+  vector<TLorentzVector> batchx4, batchp4;
+  vector<double> batchpl;
+  batchx4.reserve(kNRaysPerBatch);
+  batchp4.reserve(kNRaysPerBatch);
+
+  while ( ok ) {
+
+    batchx4.clear();
+    batchp4.clear();
+    while ( (int)batchx4.size() < kNRaysPerBatch && 
+            (ok = this->GenBoxRay(iparticle++,nux4,nup4)) ) {
+      batchx4.push_back(nux4);
+      batchp4.push_back(nup4);
+    }
+    int nrays = batchx4.size();
+    if ( nrays == 0 ) break;
 
-    const PathLengthList & pllst = this->ComputePathLengths(nux4, nup4);
+    this->ComputePathLengthMatrix(nrays, &batchx4[0], &batchp4[0], batchpl);
 
-    for (pl_iter = pllst.begin(); pl_iter != pllst.end(); ++pl_iter) {
-       int    pdgc = pl_iter->first;
-       double pl   = pl_iter->second;
+    for (int iray = 0; iray < nrays; iray++) {
+      for (unsigned int itgt = 0; itgt < ntgt; itgt++) {
+        int    pdgc = tgtlist[itgt];
+        double pl   = batchpl[iray * ntgt + itgt];
 
-       if (pl>0) {
+        if (pl>0) {
           pl *= (this->MaxPlSafetyFactor());
 
-          pl = TMath::Max(pl, fCurrMaxPathLengthList->PathLength(pdgc));
-          fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
-       }
+          if (pl > fCurrMaxPathLengthList->PathLength(pdgc)) {
+            fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
+            maxpl_rays[pdgc] = 
+              pair<TLorentzVector,TLorentzVector>(batchx4[iray],batchp4[iray]);
+          }
+        }
+      }
     }
   }
 
+  // look for longer paths around the rays giving the max path lengths
+  if ( fNRefineRays > 0 ) this->RefineMaxPathLengths(maxpl_rays);
+
   // print out the results
   LOG("GROOTGeom", pDEBUG)
     << "DensWeight \"" << (fDensWeight?"true":"false") 
@@ -1178,6 +1350,98 @@ void ROOTGeomAnalyzer::MaxPathLengthsBoxMethod(void)
 
 }
 
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::RefineMaxPathLengths(
+                 map<int, pair<TLorentzVector,TLorentzVector> > & rays)
+{
+/// Refine the max path lengths found by the box scanner: The rays that gave
+/// the max path length of each material are randomly tilted and shifted
+/// (fNRefineRays times per material and iteration) and any longer path found
+/// replaces the max path length and its ray. Whenever an iteration improves
+/// no max path length by more than a fraction fRefineTol, the tilts & shifts
+/// are halved. The scan stops after a few such contractions.
+/// This converges much faster than uniform rays for thin dense layers, where
+/// the max path length is given by a narrow set of grazing rays.
+/// Rays are always started outside of the detector (moved back along their
+/// direction), so that they cross it entirely.
+
+  const int    kNMaxIter  = 1000; // safety cap on the number of iterations
+  const int    kNContract = 4;    // stop after that many contractions
+
+  TGeoBBox * box = (TGeoBBox *) fTopVolume->GetShape();
+  double diag = 2. * fLengthScale * TMath::Sqrt(
+                         TMath::Power(box->GetDX(),2) + 
+                         TMath::Power(box->GetDY(),2) + 
+                         TMath::Power(box->GetDZ(),2) ); // SI
+
+  double dx    = 0.05 * diag; // position shift scale (SI)
+  double dtilt = 0.05;        // direction tilt scale
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Refining the max path lengths of " << rays.size() << " materials "
+    << "with " << fNRefineRays << " rays/material/iteration";
+
+  RandomGen * rnd = RandomGen::Instance();
+  PathLengthList::const_iterator pl_iter;
+
+  int ncontract = 0;
+  int iter      = 0;
+  for ( ; iter < kNMaxIter && ncontract < kNContract; iter++) {
+
+    // rays of this iteration: the current max path-length rays
+    map<int, pair<TLorentzVector,TLorentzVector> > seeds = rays;
+
+    bool improved = false;
+
+    map<int, pair<TLorentzVector,TLorentzVector> >::const_iterator seed_iter;
+    for (seed_iter = seeds.begin(); seed_iter != seeds.end(); ++seed_iter) {
+      const TLorentzVector & x4 = seed_iter->second.first;
+      const TLorentzVector & p4 = seed_iter->second.second;
+      double pmom = p4.Vect().Mag();
+
+      for (int iray = 0; iray < fNRefineRays; iray++) {
+
+        TVector3 udir = p4.Vect().Unit();
+        udir += TVector3( dtilt * rnd->RndGeom().Gaus(),
+                          dtilt * rnd->RndGeom().Gaus(),
+                          dtilt * rnd->RndGeom().Gaus() );
+        udir = udir.Unit();
+
+        TVector3 pos = x4.Vect();
+        pos += TVector3( dx * rnd->RndGeom().Gaus(),
+                         dx * rnd->RndGeom().Gaus(),
+                         dx * rnd->RndGeom().Gaus() );
+        pos -= (diag * udir);
+
+        TLorentzVector rx4(pos, x4.T());
+        TLorentzVector rp4(pmom * udir, p4.E());
+
+        const PathLengthList & pllst = this->ComputePathLengths(rx4, rp4);
+
+        for (pl_iter = pllst.begin(); pl_iter != pllst.end(); ++pl_iter) {
+          int    pdgc = pl_iter->first;
+          double pl   = pl_iter->second * (this->MaxPlSafetyFactor());
+          double plmax = fCurrMaxPathLengthList->PathLength(pdgc);
+          if (pl > plmax) {
+            if (pl > plmax * (1. + fRefineTol)) improved = true;
+            fCurrMaxPathLengthList->SetPathLength(pdgc,pl);
+            rays[pdgc] = pair<TLorentzVector,TLorentzVector>(rx4,rp4);
+          }
+        }
+      } // rays
+    } // materials
+
+    if ( !improved ) {
+      ncontract++;
+      dx    *= 0.5;
+      dtilt *= 0.5;
+    }
+  } // iterations
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Max path length refinement stopped after " << iter << " iterations";
+}
+
 //___________________________________________________________________________
 bool ROOTGeomAnalyzer::GenBoxRay(int indx, TLorentzVector& x4, TLorentzVector& p4)
 {
@@ -1386,7 +1650,7 @@ double ROOTGeomAnalyzer::ComputePathLengthPDG(
     mat  = itr->first;
     if ( ! mat ) continue;  // segment outside geometry has no material
     step = itr->second;
-    weight = this->GetWeight(mat,pdgc);
+    weight = this->GetCachedWeight(mat,pdgc);
     pl += (step*weight);
   }
 
@@ -1440,38 +1704,50 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
     << "] udir [" << udir[0] << "," << udir[1] << "," << udir[2];
 #endif
 
-  fGeometry -> SetCurrentDirection (udir[0],udir[1],udir[2]);
-  fGeometry -> SetCurrentPoint     (r0[0],  r0[1],  r0[2]  );
+  // skip the navigation for rays the volume selector would trim entirely
+  if ( fGeomVolSelector && 
+       ! fGeomVolSelector->RayMayBeSelected(r0,udir) ) {
+    fCurrPathSegmentList->FillMatStepSum();
+    return;
+  }
+
+  // use the (faster) box navigation if possible for this ray
+  if ( fUseBoxNav && !fill_path && this->SwimBoxes(r0,udir) ) return;
+
+  TGeoNavigator * nav = this->Navigator();
+
+  nav -> SetCurrentDirection (udir[0],udir[1],udir[2]);
+  nav -> SetCurrentPoint     (r0[0],  r0[1],  r0[2]  );
 
   while (!found_vol || keep_on) {
      keep_on = true;
 
-     fGeometry->FindNode();
+     nav->FindNode();
 
-     ps_curr.SetEnter( fGeometry->GetCurrentPoint() , raydist );
-     vol = fGeometry->GetCurrentVolume();
+     ps_curr.SetEnter( nav->GetCurrentPoint() , raydist );
+     vol = nav->GetCurrentVolume();
      med = vol->GetMedium();
      mat = med->GetMaterial();
      ps_curr.SetGeo(vol,med,mat);
 #ifdef PATHSEG_KEEP_PATH
-     if (fill_path) ps_curr.SetPath(fGeometry->GetPath());
+     if (fill_path) ps_curr.SetPath(nav->GetPath());
 #endif
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 #ifdef DUMP_SWIM
        LOG("GROOTGeom", pDEBUG) << "Current volume: " << vol->GetName()
-                             << " pos " << fGeometry->GetCurrentPoint()[0]
-                             << " "     << fGeometry->GetCurrentPoint()[1]
-                             << " "     << fGeometry->GetCurrentPoint()[2]
-                             << " dir " << fGeometry->GetCurrentDirection()[0]
-                             << " "     << fGeometry->GetCurrentDirection()[1]
-                             << " "     << fGeometry->GetCurrentDirection()[2]
-                             << "[path: " << fGeometry->GetPath() << "]";
+                             << " pos " << nav->GetCurrentPoint()[0]
+                             << " "     << nav->GetCurrentPoint()[1]
+                             << " "     << nav->GetCurrentPoint()[2]
+                             << " dir " << nav->GetCurrentDirection()[0]
+                             << " "     << nav->GetCurrentDirection()[1]
+                             << " "     << nav->GetCurrentDirection()[2]
+                             << "[path: " << nav->GetPath() << "]";
 #endif
 #endif
 
      // find the start of top
-     if (fGeometry->IsOutside() || !vol) {
+     if (nav->IsOutside() || !vol) {
         keep_on = false;
         if (found_vol) break;
         step = 0;
@@ -1485,7 +1761,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 #endif
 #endif
 
-        while (!fGeometry->IsEntering()) {
+        while (!nav->IsEntering()) {
           step = this->Step();
           raydist += step;
 #ifdef RWH_DEBUG
@@ -1516,7 +1792,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
           }
         } // finished while
 
-        ps_curr.SetExit(fGeometry->GetCurrentPoint());
+        ps_curr.SetExit(nav->GetCurrentPoint());
         ps_curr.SetStep(step);
         if ( ( fDebugFlags & 0x10 ) ) {
           // In general don't add the path segments from the start point to
@@ -1536,7 +1812,7 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
        step   = this->StepUntilEntering();
        raydist += step;
 
-       ps_curr.SetExit(fGeometry->GetCurrentPoint());
+       ps_curr.SetExit(nav->GetCurrentPoint());
        ps_curr.SetStep(step);
        fCurrPathSegmentList->AddSegment(ps_curr);
 
@@ -1585,10 +1861,9 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
 
   // PathSegmentList trimming occurs here!
   if ( fGeomVolSelector ) {
-    PathSegmentList* altlist = 
-      fGeomVolSelector->GenerateTrimmedList(fCurrPathSegmentList);
-    std::swap(altlist,fCurrPathSegmentList);
-    delete altlist;  // after swap delete original
+    if ( ! fTrimPathSegmentList ) fTrimPathSegmentList = new PathSegmentList();
+    fGeomVolSelector->TrimList(fCurrPathSegmentList,fTrimPathSegmentList);
+    std::swap(fTrimPathSegmentList,fCurrPathSegmentList); // untrimmed is re-used next
   }
 
   fCurrPathSegmentList->FillMatStepSum();
@@ -1608,10 +1883,226 @@ void ROOTGeomAnalyzer::SwimOnce(const TVector3 & r0, const TVector3 & udir)
   return;
 }
 
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::SwimBoxes(const TVector3 & r0, const TVector3 & udir)
+{
+/// Fill the current PathSegmentList (already reset for the input ray) using
+/// the analytic box navigation. Returns false if the ray crosses a region
+/// of the geometry that is not made of unrotated boxes, which then needs
+/// the usual TGeo swim.
+/// If debug flag 0x80 is set, the ray is swum again with TGeo and the step
+/// summed in each material by the two methods is compared.
+
+  if ( ! fBoxNav ) {
+    fBoxNav = new BoxNavigator;
+    fBoxNav->Build(fTopVolume);
+  }
+  if ( ! fBoxNav->Swim(r0,udir,*fCurrPathSegmentList) ) return false;
+
+  // PathSegmentList trimming occurs here!
+  if ( fGeomVolSelector ) {
+    if ( ! fTrimPathSegmentList ) fTrimPathSegmentList = new PathSegmentList();
+    fGeomVolSelector->TrimList(fCurrPathSegmentList,fTrimPathSegmentList);
+    std::swap(fTrimPathSegmentList,fCurrPathSegmentList); // untrimmed is re-used next
+  }
+
+  fCurrPathSegmentList->FillMatStepSum();
+
+  if ( ( fDebugFlags & 0x80 ) ) {
+    PathSegmentList::MaterialMap_t boxsum = 
+                             fCurrPathSegmentList->GetMatStepSumMap();
+
+    // swim the same ray with TGeo (whose result is then kept)
+    fCurrPathSegmentList->SetStartInfo();
+    fUseBoxNav = false;
+    this->SwimOnce(r0,udir);
+    fUseBoxNav = true;
+
+    const PathSegmentList::MaterialMap_t & geosum = 
+                             fCurrPathSegmentList->GetMatStepSumMap();
+    PathSegmentList::MaterialMap_t diff = boxsum;
+    PathSegmentList::MaterialMapCItr_t itr = geosum.begin();
+    for ( ; itr != geosum.end(); ++itr) diff[itr->first] -= itr->second;
+    for (itr = diff.begin(); itr != diff.end(); ++itr) {
+      if ( ! itr->first ) continue;
+      double step = (geosum.count(itr->first)) ? 
+                                  geosum.find(itr->first)->second : 0.;
+      if ( TMath::Abs(itr->second) > 1.e-6 * TMath::Max(step,1.) ) {
+        LOG("GROOTGeom", pWARN)
+          << "Box navigation step in " << itr->first->GetName()
+          << " differs from TGeo by " << itr->second 
+          << " (TGeo step = " << step << ")";
+      }
+    }
+  }
+
+  return true;
+}
+
+//___________________________________________________________________________
+string ROOTGeomAnalyzer::MaxPlCacheFile(void) const
+{
+/// Get the max path-length cache file for the current geometry & scanner
+/// configuration (empty if the max path lengths should not be cached).
+/// The file name is built from a hash of everything that determines the box
+/// scanner results: the volumes (shape, material & placement of daughters),
+/// the top volume, the units, the weighting options and the scanner settings.
+/// Results of the flux scanner, or of a geometry trimmed by a volume selector,
+/// depend on configuration not known to this driver and are never cached.
+
+  if ( fMaxPlCacheDir.empty() ) return "";
+
+  if ( fFlux || fGeomVolSelector ) {
+    LOG("GROOTGeom", pNOTICE)
+      << "Max path lengths are only cached for the BOX method "
+      << "with no volume selector";
+    return "";
+  }
+
+  ostringstream cfg;
+  cfg << std::setprecision(12);
+  cfg << "top:" << fTopVolume->GetName()
+      << " dw:" << fDensWeight << " mw:" << fMixtWghtSum
+      << " lu:" << fLengthScale << " du:" << fDensityScale
+      << " sf:" << fMaxPlSafetyFactor
+      << " np:" << fNPoints << " nr:" << fNRays;
+  if ( fNRefineRays > 0 ) cfg << " nrr:" << fNRefineRays << " rt:" << fRefineTol;
+
+  const double * t = fMasterToTop->GetTranslation();
+  const double * r = fMasterToTop->GetRotationMatrix();
+  cfg << " m2t:";
+  for (int i = 0; i < 3; i++) cfg << " " << t[i];
+  for (int i = 0; i < 9; i++) cfg << " " << r[i];
+
+  TObjArray * volume_list = fGeometry->GetListOfVolumes();
+  int nvol = (volume_list) ? volume_list->GetEntries() : 0;
+  for (int ivol = 0; ivol < nvol; ivol++) {
+    TGeoVolume * vol = dynamic_cast <TGeoVolume *> (volume_list->At(ivol));
+    if (!vol) continue;
+    cfg << "\n" << vol->GetName();
+    TGeoShape * shape = vol->GetShape();
+    if (shape) cfg << " " << shape->ClassName() << " " << shape->Capacity();
+    TGeoMaterial * mat = (vol->GetMedium()) ? 
+                                 vol->GetMedium()->GetMaterial() : 0;
+    if (mat) {
+      cfg << " " << mat->GetName() << " " << mat->GetDensity();
+      if (mat->IsMixture()) {
+        TGeoMixture * mixt = dynamic_cast <TGeoMixture*> (mat);
+        for (int i = 0; mixt && i < mixt->GetNelements(); i++) {
+          cfg << " " << mixt->GetZmixt()[i] << "/" << mixt->GetAmixt()[i]
+              << ":" << mixt->GetWmixt()[i];
+        }
+      } else {
+        cfg << " " << mat->GetZ() << "/" << mat->GetA();
+      }
+    }
+    for (int id = 0; id < vol->GetNdaughters(); id++) {
+      TGeoNode * node = vol->GetNode(id);
+      cfg << " [" << node->GetVolume()->GetName();
+      const double * nt = node->GetMatrix()->GetTranslation();
+      const double * nr = node->GetMatrix()->GetRotationMatrix();
+      for (int i = 0; i < 3; i++) cfg << " " << nt[i];
+      for (int i = 0; i < 9; i++) cfg << " " << nr[i];
+      cfg << "]";
+    }
+  }
+
+  // 64-bit FNV-1a hash of the configuration string
+  string cfgstr = cfg.str();
+  ULong64_t hash = 14695981039346656037ULL;
+  for (unsigned int i = 0; i < cfgstr.size(); i++) {
+    hash ^= (unsigned char) cfgstr[i];
+    hash *= 1099511628211ULL;
+  }
+
+  ostringstream filename;
+  filename << fMaxPlCacheDir << "/maxpl_"
+           << std::hex << std::setfill('0') << std::setw(16) << hash
+           << ".xml";
+  return filename.str();
+}
+
+//___________________________________________________________________________
+bool ROOTGeomAnalyzer::LoadCachedMaxPathLengths(string filename)
+{
+/// Load the max path lengths from the input cache file. They are used only
+/// if the file lists exactly the target nuclei of the current geometry.
+
+  if ( gSystem->AccessPathName(filename.c_str()) ) return false;
+
+  PathLengthList cached;
+  XmlParserStatus_t status = cached.LoadFromXml(filename);
+  if ( status != kXmlOK ) {
+    LOG("GROOTGeom", pWARN)
+      << "Could not read cached max path lengths from: " << filename;
+    return false;
+  }
+  if ( cached.size() != fCurrMaxPathLengthList->size() ) return false;
+
+  PathLengthList::const_iterator pl_iter;
+  for (pl_iter = cached.begin(); pl_iter != cached.end(); ++pl_iter) {
+    if ( fCurrMaxPathLengthList->count(pl_iter->first) == 0 ) {
+      fCurrMaxPathLengthList->SetAllToZero();
+      return false;
+    }
+    fCurrMaxPathLengthList->SetPathLength(pl_iter->first, pl_iter->second);
+  }
+
+  LOG("GROOTGeom", pNOTICE)
+    << "Using cached max path lengths from: " << filename;
+  LOG("GROOTGeom", pDEBUG) << "CurrMaxPathLengthList: "
+    << *fCurrMaxPathLengthList;
+
+  return true;
+}
+
+//___________________________________________________________________________
+void ROOTGeomAnalyzer::SaveCachedMaxPathLengths(string filename) const
+{
+/// Save the computed max path lengths to the input cache file. The file is
+/// written under a temporary name and then renamed, so that jobs sharing the
+/// cache never read a partially written file.
+
+  if ( gSystem->AccessPathName(fMaxPlCacheDir.c_str()) ) {
+    gSystem->mkdir(fMaxPlCacheDir.c_str(), true);
+  }
+
+  ostringstream tmpname;
+  tmpname << filename << "." << gSystem->GetPid() << ".tmp";
+  fCurrMaxPathLengthList->SaveAsXml(tmpname.str());
+
+  if ( std::rename(tmpname.str().c_str(), filename.c_str()) != 0 ) {
+    LOG("GROOTGeom", pWARN)
+      << "Could not store the max path lengths in: " << filename;
+    std::remove(tmpname.str().c_str());
+    return;
+  }
+  LOG("GROOTGeom", pNOTICE)
+    << "Stored the max path lengths in: " << filename;
+}
+
+//___________________________________________________________________________
+TGeoNavigator * ROOTGeomAnalyzer::Navigator(void)
+{
+/// Get the navigator used by this driver for swimming through the geometry.
+/// It is added to the TGeoManager (which owns it) on first use, so that the
+/// state of the driver's navigation is not shared with the TGeoManager's
+/// default navigator or with other drivers using the same geometry. With
+/// TGeoManager multi-threading enabled (TGeoManager::SetMaxThreads()) the
+/// navigator belongs to the thread that first used the driver.
+
+  if (!fNavigator) {
+    fNavigator = fGeometry->AddNavigator();
+#ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
+    LOG("GROOTGeom", pDEBUG) << "Added a TGeoNavigator to the geometry";
+#endif
+  }
+  return fNavigator;
+}
 //___________________________________________________________________________
 bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
 {
-  TGeoVolume * vol = fGeometry -> GetCurrentVolume();
+  TGeoVolume * vol = this->Navigator() -> GetCurrentVolume();
   if(vol) {
     TGeoMaterial * mat = vol->GetMedium()->GetMaterial();
     if(mat->IsMixture()) {
@@ -1633,15 +2124,18 @@ bool ROOTGeomAnalyzer::FindMaterialInCurrentVol(int tgtpdg)
 //___________________________________________________________________________
 double ROOTGeomAnalyzer::StepToNextBoundary(void)
 {
-  fGeometry->FindNextBoundary();
-  double step=fGeometry->GetStep();
+  TGeoNavigator * nav = this->Navigator();
+  nav->FindNextBoundary();
+  double step=nav->GetStep();
   return step;
 }
 //___________________________________________________________________________
 double ROOTGeomAnalyzer::Step(void)
 {
-  fGeometry->Step();
-  double step=fGeometry->GetStep();
+  TGeoNavigator * nav = this->Navigator();
+  nav->Step();
+  fNNavSteps++;
+  double step=nav->GetStep();
   return step;
 }
 //___________________________________________________________________________
@@ -1650,14 +2144,15 @@ double ROOTGeomAnalyzer::StepUntilEntering(void)
   this->StepToNextBoundary();  // doesn't actually step, so don't include in sum
   double step = 0; // 
 
-  while(!fGeometry->IsEntering()) {
+  TGeoNavigator * nav = this->Navigator();
+  while(!nav->IsEntering()) {
     step += this->Step();
   }
 
 #ifdef __GENIE_LOW_LEVEL_MESG_ENABLED__
 
-  bool isen = fGeometry->IsEntering();
-  bool isob = fGeometry->IsOnBoundary();
+  bool isen = nav->IsEntering();
+  bool isob = nav->IsOnBoundary();
 
   LOG("GROOTGeom",pDEBUG)
       << "IsEntering = "     << utils::print::BoolAsYNString(isen)
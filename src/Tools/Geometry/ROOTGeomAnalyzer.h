@@ -22,9 +22,13 @@
 
 #include <string>
 #include <algorithm>
+#include <map>
+#include <vector>
+#include <utility>
 
 #include <TGeoManager.h>
 #include <TVector3.h>
+#include <TLorentzVector.h>
 
 #include "Framework/EventGen/GeomAnalyzerI.h"
 #include "Framework/ParticleData/PDGUtils.h"
@@ -34,8 +38,12 @@ class TGeoMaterial;
 class TGeoMixture;
 class TGeoElement;
 class TGeoHMatrix;
+class TGeoNavigator;
 
 using std::string;
+using std::map;
+using std::vector;
+using std::pair;
 
 namespace genie    {
 
@@ -45,6 +53,7 @@ namespace geometry {
 
 class PathSegmentList;
 class GeomVolSelectorI;
+class BoxNavigator;
 
 class ROOTGeomAnalyzer : public GeomAnalyzerI {
 
@@ -63,14 +72,19 @@ public :
                                                      const TLorentzVector & p);
   virtual const  TVector3 &       GenerateVertex(const TLorentzVector & x, 
                                                  const TLorentzVector & p, int tgtpdg);
+  virtual void                    ComputePathLengthMatrix(int nrays, 
+                                         const TLorentzVector * x, const TLorentzVector * p,
+                                         vector<double> & pl);
 
   /// set geometry driver's configuration options
 
   virtual void SetScannerNPoints    (int    np) { fNPoints    = np; } /* box  scanner */
   virtual void SetScannerNRays      (int    nr) { fNRays      = nr; } /* box  scanner */
+  virtual void SetScannerNRefineRays(int    nr) { fNRefineRays = nr; } /* box  scanner refinement */
+  virtual void SetScannerRefineTol  (double tl) { fRefineTol   = tl; } /* box  scanner refinement */
   virtual void SetScannerNParticles (int    np) { fNParticles = np; } /* flux scanner */
   virtual void SetScannerFlux       (GFluxI* f) { fFlux       = f;  } /* flux scanner */
-  virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; }
+  virtual void SetWeightWithDensity (bool   wt) { fDensWeight = wt; fMatWeights.clear(); }
   virtual void SetMixtureWeightsSum (double sum);
   virtual void SetLengthUnits       (double lu);
   virtual void SetDensityUnits      (double du);
@@ -78,11 +92,15 @@ public :
   virtual void SetTopVolName        (string nm);
   virtual void SetKeepSegPath       (bool keep) { fKeepSegPath = keep; }
   virtual void SetDebugFlags        (int  flgs) { fDebugFlags  = flgs; }
+  virtual void SetUseBoxNavigation  (bool  use) { fUseBoxNav   = use;  }
+  virtual void SetMaxPlCacheDir     (string dir) { fMaxPlCacheDir = dir; } /* box scanner results cache */
 
   /// retrieve geometry driver's configuration options
 
   virtual int           ScannerNPoints    (void) const { return fNPoints;           }
   virtual int           ScannerNRays      (void) const { return fNRays;             }
+  virtual int           ScannerNRefineRays(void) const { return fNRefineRays;       }
+  virtual double        ScannerRefineTol  (void) const { return fRefineTol;         }
   virtual int           ScannerNParticles (void) const { return fNParticles;        }
   virtual bool          WeightWithDensity (void) const { return fDensWeight;        }
   virtual double        LengthUnits       (void) const { return fLengthScale;       }
@@ -92,6 +110,8 @@ public :
   virtual string        TopVolName        (void) const { return fTopVolumeName;     }
   virtual TGeoManager * GetGeometry       (void) const { return fGeometry;          }
   virtual bool          GetKeepSegPath    (void) const { return fKeepSegPath;       }
+  virtual bool          UseBoxNavigation  (void) const { return fUseBoxNav;         }
+  virtual string        MaxPlCacheDir     (void) const { return fMaxPlCacheDir;     }
   virtual const PathLengthList& GetMaxPathLengths(void) const { return *fCurrMaxPathLengthList; } // call only after ComputeMaxPathLengths() has been called 
 
   /// access to geometry coordinate/unit transforms for validation/test purposes
@@ -104,6 +124,12 @@ public :
   virtual void   Top2Master    (TVector3 & v) const;
   virtual void   Top2MasterDir (TVector3 & v) const;
 
+  /// access to the navigation state for benchmarking/test purposes
+
+  virtual const PathSegmentList * GetCurrentPathSegmentList(void) const { return fCurrPathSegmentList; }
+  virtual long int NavigationSteps     (void) const { return fNNavSteps; } ///< geometry steps taken so far
+  virtual void     ResetNavigationSteps(void)       { fNNavSteps = 0;    }
+
   /// configure processing to perform path segment trimming
 
   virtual GeomVolSelectorI* AdoptGeomVolSelector (GeomVolSelectorI* selector) /// take ownership, return old
@@ -123,28 +149,40 @@ protected:
   virtual double GetWeight               (const TGeoMaterial * mat, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int pdgc);
   virtual double GetWeight               (const TGeoMixture * mixt, int ielement, int pdgc);
+  virtual const vector< pair<int,double> > & 
+                 GetWeights              (const TGeoMaterial * mat);
+  virtual double GetCachedWeight         (const TGeoMaterial * mat, int pdgc);
 
   virtual void   MaxPathLengthsFluxMethod(void);
   virtual void   MaxPathLengthsBoxMethod (void);
+  virtual void   RefineMaxPathLengths    (map<int, pair<TLorentzVector,TLorentzVector> > & rays);
   virtual bool   GenBoxRay               (int indx, TLorentzVector& x4, TLorentzVector& p4);
 
   virtual double ComputePathLengthPDG    (const TVector3 & r, const TVector3 & udir, int pdgc);
   virtual void   SwimOnce                (const TVector3 & r, const TVector3 & udir);
+  virtual bool   SwimBoxes               (const TVector3 & r, const TVector3 & udir);
 
+  virtual TGeoNavigator * Navigator      (void);
   virtual bool   FindMaterialInCurrentVol(int pdgc);
   virtual bool   WillNeverEnter          (double step);
   virtual double StepToNextBoundary      (void);
   virtual double Step                    (void);
   virtual double StepUntilEntering       (void);
+  virtual string MaxPlCacheFile          (void) const;
+  virtual bool   LoadCachedMaxPathLengths(string filename);
+  virtual void   SaveCachedMaxPathLengths(string filename) const;
 
 
 
   int              fMaterial;              ///< input selected material for vertex generation
   TGeoManager *    fGeometry;              ///< input detector geometry
+  TGeoNavigator *  fNavigator;             ///< navigator used by this driver (owned by fGeometry)
   string           fTopVolumeName;         ///< input top vol [other than TGeoManager::GetTopVolume()]
   int              fNPoints;               ///< max path length scanner (box method): points/surface [def:200]
   int              fNRays;                 ///< max path length scanner (box method): rays/point [def:200]
   int              fNParticles;            ///< max path length scanner (flux method): particles in [def:10000]
+  int              fNRefineRays;           ///< max path length scanner (box method): refinement rays/material/iteration [def:0, no refinement]
+  double           fRefineTol;             ///< max path length scanner (box method): refinement convergence tolerance [def:1E-3]
   GFluxI *         fFlux;                  ///< a flux objects that can be used to scan the max path lengths
   bool             fDensWeight;            ///< if true pathlengths are weighted with density [def:true]
   double           fLengthScale;           ///< conversion factor: input geometry length units -> meters
@@ -161,7 +199,12 @@ protected:
 
   bool             fKeepSegPath;           ///< need to fill path segment "path"
   PathSegmentList* fCurrPathSegmentList;   ///< current list of path-segments
+  PathSegmentList* fTrimPathSegmentList;   ///< work list the trimmed path-segments are written to
+  map<const TGeoMaterial *, vector< pair<int,double> > > fMatWeights; ///< (target pdg, weight) pairs of each material, see GetWeights()
   GeomVolSelectorI* fGeomVolSelector;      ///< optional path seg trimmer (owned)
+  bool             fUseBoxNav;             ///< swim through boxes analytically where possible [def:false]
+  BoxNavigator *   fBoxNav;                ///< flattened box geometry, built on first use
+  string           fMaxPlCacheDir;         ///< directory of cached max path-lengths [def:$GMAXPLCACHE, none if unset]
 
   // used by GenBoxRay to retain history between calls
   TVector3         fGenBoxRayPos;
@@ -173,6 +216,7 @@ protected:
   // test purposes
   double           fmxddist, fmxdstep;   ///< max errors in pathsegmentlist
   int              fDebugFlags;
+  long int         fNNavSteps;           ///< number of navigator steps taken
 
 };
 
@@ -30,7 +30,8 @@ using namespace genie;
 using namespace genie::masterclass;
 
 //______________________________________________________________________________
-FastSimCherenkov::FastSimCherenkov() 
+FastSimCherenkov::FastSimCherenkov() :
+fEmbeddedCanvas(0)
 {
 
 }
@@ -47,6 +48,8 @@ void FastSimCherenkov::SetEmbeddedCanvas(TRootEmbeddedCanvas * ec)
 //______________________________________________________________________________
 void FastSimCherenkov::Draw(EventRecord * /*event*/) 
 {
+   if(!fEmbeddedCanvas) return;
+
    LOG("MasterClass", pINFO) << "Drawing input event";
 
    fEmbeddedCanvas->GetCanvas()->cd();
@@ -30,7 +30,8 @@ using namespace genie;
 using namespace genie::masterclass;
 
 //______________________________________________________________________________
-FastSimScintCalo::FastSimScintCalo() 
+FastSimScintCalo::FastSimScintCalo() :
+fEmbeddedCanvas(0)
 {
 
 }
@@ -47,6 +48,8 @@ void FastSimScintCalo::SetEmbeddedCanvas(TRootEmbeddedCanvas * ec)
 //______________________________________________________________________________
 void FastSimScintCalo::Draw(EventRecord * /*event*/) 
 {
+   if(!fEmbeddedCanvas) return;
+
    LOG("MasterClass", pINFO) << "Drawing input event";
 
    fEmbeddedCanvas->GetCanvas()->cd();
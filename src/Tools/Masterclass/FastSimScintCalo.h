@@ -4,6 +4,9 @@
 \class    genie::masterclass::FastSimScintCalo
 
 \brief    Fast simulation of the response of a scintillator calorimeter.
+          Placeholder: the detector response is not simulated yet and Draw()
+          only prepares the display canvas. Without a canvas (SetEmbeddedCanvas
+          not called, eg in batch jobs) Draw() does nothing.
 
 \author   Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
           University of Liverpool & STFC Rutherford Appleton Lab
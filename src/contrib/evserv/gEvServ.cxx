@@ -5,19 +5,47 @@
 
 \brief   GENIE v+A event generation server 
 
+         A persistent event generation process: the tune, the cross section
+         splines and the event generation drivers are loaded once and kept
+         warm for all requests, of all clients connecting one after the
+         other, until a client sends SHUTDOWN.
+
+         Besides the original one-event-per-request EVTVTX command, the
+         server accepts batched requests:
+
+           EVTBATCH: ipdgnu ipdgtgt energy nev seed
+
+         where energy is either a fixed energy (`E') or an energy range
+         (`Emin,Emax'), optionally followed by a flux function of energy
+         in ROOT TFormula syntax (`Emin,Emax,1/x'). The default flux over the
+         range is flat. The server replies with `EVTBATCH: nev', then sends
+         nev EventRecord objects (one kMESS_OBJECT TMessage per event) and
+         finally `BATCH GENERATED'. Event generation drivers for initial
+         states not given at CONFIG are created on the fly. See
+         client_test.C for an example client.
+
          Syntax :
-           gevserv [-p port]
+           gevserv [-p port] --tune tune_name [--cross-sections xml_file]
+                   [--message-thresholds xml_file]
 
          Options :
            [] denotes an optional argument
            -p port number (default: 9090)
+           --tune
+              the tune to generate with
+           --cross-sections
+              XML file with the cross section splines, loaded at start-up
+              (falls back to $GSPLOAD, used by the `load-splines' CONFIG
+              option)
+           --message-thresholds
+              XML file with the message stream thresholds
 
 \author  Costas Andreopoulos <costas.andreopoulos \at stfc.ac.uk>
          University of Liverpool & STFC Rutherford Appleton Lab
 
 \created September 18, 2007
 
-\cpright Copyright (c) 2003-2016, GENIE Neutrino MC Generator Collaboration
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
          For the full text of the license visit http://copyright.genie-mc.org
          or see $GENIE/LICENSE
 */
@@ -35,22 +63,24 @@
 #include <TMessage.h>
 #include <TBits.h>
 #include <TMath.h>
-
-#include "Conventions/Units.h"
-#include "EVGCore/EventRecord.h"
-#include "EVGDrivers/GEVGDriver.h"
-#include "EVGDrivers/GEVGPool.h"
-#include "EVGDrivers/GMCJMonitor.h"
-#include "GHEP/GHepFlags.h"
-#include "GHEP/GHepParticle.h"
-#include "GHEP/GHepRecord.h"
-#include "Interaction/Interaction.h"
-#include "Messenger/Messenger.h"
-#include "Numerical/Spline.h"
-#include "PDG/PDGCodeList.h"
-#include "Utils/XSecSplineList.h"
-#include "Utils/StringUtils.h"
-#include "Utils/CmdLnArgParser.h"
+#include <TF1.h>
+
+#include "Framework/Conventions/Units.h"
+#include "Framework/EventGen/EventRecord.h"
+#include "Framework/EventGen/GEVGDriver.h"
+#include "Framework/EventGen/GEVGPool.h"
+#include "Framework/GHEP/GHepFlags.h"
+#include "Framework/GHEP/GHepParticle.h"
+#include "Framework/GHEP/GHepRecord.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodeList.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Framework/Utils/StringUtils.h"
+#include "Framework/Utils/CmdLnArgParser.h"
 
 using std::string;
 using std::vector;
@@ -69,7 +99,9 @@ void Handshake          (void);
 void Configure          (string mesg);
 void CalcTotalXSec      (string mesg);
 void GenerateEvent      (string mesg);
+void GenerateBatch      (string mesg);
 void Shutdown           (void);
+GEVGDriver * EvGenDriver(const InitialState & init_state, bool create);
 
 // ** Consts & Defaults
 //
@@ -88,16 +120,22 @@ const string kEvgenCmdRecv         = "EVTVTX";
 const string kEvgenHdrCmdSent      = "EVTREC";
 const string kEvgenStdhepCmdSent   = "STDHEP";
 const string kEvgenOkMesgSent      = "EVENT GENERATED";
+const string kBatchCmdRecv         = "EVTBATCH";
+const string kBatchHdrCmdSent      = "EVTBATCH";
+const string kBatchOkMesgSent      = "BATCH GENERATED";
 const string kShutdownCmdRecv      = "SHUTDOWN";
 const string kShutdownOkMesgSent   = "SHUTTING DOWN";
 const string kErrNoConf            = "*** NOT CONFIGURED! ***";
 const string kErrNoDriver          = "*** NO EVENT GENERATION DRIVER! ***";
 const string kErrNoEvent           = "*** NULL OR UNPHYSICAL EVENT! ***";
+const string kErrBadRequest        = "*** INVALID REQUEST! ***";
+const int    kMaxBatchAttempts     = 100;   // max failed attempts per batch event
 const string kErr                  = "FAILED";
 
 // ** User-specified options:
 //
-int gOptPortNum;   // port number
+int    gOptPortNum;   // port number
+string gOptXSecFile;  // cross section splines file
 
 // ** Globals
 //
@@ -112,43 +150,69 @@ int main(int argc, char ** argv)
   // Parse command line arguments
   GetCommandLineArgs(argc,argv);
 
+  // Load the tune and the cross section splines once, for all requests
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gevserv", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+  utils::app_init::XSecTable(gOptXSecFile, false);
+
   // Run some checks
   RunInitChecks();
 
   // Open a server socket
   TServerSocket * serv_sock = new TServerSocket(gOptPortNum, kTRUE);
-
-  // Accept a connection
-  gSock = serv_sock->Accept();
-
-  if(!gSock) exit(1);
+  if(!serv_sock->IsValid()) {
+    LOG("gevserv", pFATAL) << "Can not open a server socket on port: " << gOptPortNum;
+    exit(1);
+  }
   LOG("gevserv", pNOTICE) << "Listening on port: " << gOptPortNum;
-  
-  // Set no TCP/IP NODELAY
-  int delay_ok = gSock->SetOption(kNoDelay,1);
-  LOG("gevserv", pNOTICE) << "TCP_NODELAY > " << delay_ok;
-
-  // Start listening for messages & take the corresponding actions
 
-  while(1) {
+  // Serve one client after the other, until shut down
+  while(!gShutDown) {
 
-    if(gShutDown) break;
+    // Accept a connection
+    gSock = serv_sock->Accept();
+    if(!gSock || !gSock->IsValid()) exit(1);
+    LOG("gevserv", pNOTICE) << "Accepted a client connection";
+  
+    // Set no TCP/IP NODELAY
+    int delay_ok = gSock->SetOption(kNoDelay,1);
+    LOG("gevserv", pNOTICE) << "TCP_NODELAY > " << delay_ok;
+
+    // Start listening for messages & take the corresponding actions
+    while(!gShutDown) {
+
+      TMessage * mesg = 0;
+      if(gSock->Recv(mesg) <= 0) {
+        // connection closed by the client
+        delete mesg;
+        break;
+      }
+      if(!mesg) continue;
+      if(mesg->What() != kMESS_STRING) { delete mesg; continue; }
 
-    TMessage * mesg = 0;
+      char mesg_content[2048];
+      mesg->ReadString(mesg_content, 2048);
+      delete mesg;
 
-    gSock->Recv(mesg);
+      LOG("gevserv", pNOTICE) << "Processing mesg > " << mesg_content;
 
-    if(!mesg) continue;
-    if(mesg->What() != kMESS_STRING) continue;
+      HandleMesg(mesg_content);
 
-    char mesg_content[2048];
-    mesg->ReadString(mesg_content, 2048);
+    } // messages
 
-    LOG("gevserv", pNOTICE) << "Processing mesg > " << mesg_content;
+    LOG("gevserv", pNOTICE) << "Closing the client connection";
+    gSock->Close();
+    delete gSock;
+    gSock = 0;
 
-    HandleMesg(mesg_content);
+  } // clients
 
-  } // while(1)
+  serv_sock->Close();
+  delete serv_sock;
 
   return 0;
 }
@@ -170,6 +234,11 @@ void HandleMesg(string mesg)
     CalcTotalXSec(mesg);
   }
   else
+  if (mesg.find(kBatchCmdRecv.c_str()) != string::npos) 
+  {
+    GenerateBatch(mesg);
+  } 
+  else
   if (mesg.find(kEvgenCmdRecv.c_str()) != string::npos) 
   {
     GenerateEvent(mesg);
@@ -225,8 +294,9 @@ void Configure(string mesg)
   // (if set at the server side)
   //
   if(mesg.find(kConfigCmdLdSpl) != string::npos) {
-     XSecSplineList * xspl = XSecSplineList::Instance();
-     xspl->AutoLoad();
+     if(gSystem->Getenv("GSPLOAD")) {
+       utils::app_init::XSecTable(gSystem->Getenv("GSPLOAD"), false);
+     }
 
      mesg.erase(mesg.find(kConfigCmdLdSpl),12);
      mesg = str::TrimSpaces(mesg);             
@@ -288,16 +358,7 @@ void Configure(string mesg)
      int neutrino_code = *nuiter;
 
      InitialState init_state(target_code, neutrino_code);
-
-     LOG("gevserv", pNOTICE)
-       << "\n\n ---- Creating a GEVGDriver object configured for init-state: "
-       << init_state.AsString() << " ----\n\n";
-
-     GEVGDriver * evgdriver = new GEVGDriver;
-     evgdriver->Configure(init_state);
-     evgdriver->UseSplines(); // will also check if all splines needed are loaded
-
-     gGPool.insert( GEVGPool::value_type(init_state.AsString(), evgdriver) );
+     EvGenDriver(init_state, true);
 
    } // targets
   } // neutrinos
@@ -558,6 +619,138 @@ void GenerateEvent(string mesg)
   LOG("gevserv", pINFO) << "...done!";
 }
 //____________________________________________________________________________
+void GenerateBatch(string mesg)
+{
+// Generate a batch of events for the requested initial state, energy (or
+// energy range and flux) and seed, and stream them back to the client
+//   mesg recv:
+//      EVTBATCH: ipdgnu ipdgtgt energy nev seed
+//   mesg sent:
+//      EVTBATCH: nev, nev x EventRecord (kMESS_OBJECT), BATCH GENERATED
+
+  LOG("gevserv", pNOTICE) << "Generating event batch - Input info : " << mesg;
+
+  // Extract info from the input mesg
+
+  mesg = str::FilterString(kBatchCmdRecv, mesg); 
+  mesg = str::FilterString(":", mesg); 
+  mesg = str::TrimSpaces(mesg);             
+
+  vector<string> sv = str::Split(mesg," "); 
+  if(sv.size() != 5) {
+     LOG("gevserv", pERROR) << "Invalid event batch request";
+     gSock->Send(kErrBadRequest.c_str());
+     gSock->Send(kErr.c_str());
+     return;
+  }
+  int    ipdgnu  = atoi(sv[0].c_str());  // neutrino code
+  int    ipdgtgt = atoi(sv[1].c_str());  // target code
+  string energy  = sv[2];                // E, or Emin,Emax[,flux function]
+  int    nev     = atoi(sv[3].c_str());  // number of events
+  long   seed    = atol(sv[4].c_str());  // random number seed
+
+  vector<string> ev = str::Split(energy, ",");
+  if(nev <= 0 || ev.size() < 1 || ev.size() > 3) {
+     LOG("gevserv", pERROR) << "Invalid event batch request";
+     gSock->Send(kErrBadRequest.c_str());
+     gSock->Send(kErr.c_str());
+     return;
+  }
+  double emin = atof(ev[0].c_str());
+  double emax = (ev.size() > 1) ? atof(ev[1].c_str()) : emin;
+  if(emin <= 0 || emax < emin) {
+     LOG("gevserv", pERROR) << "Invalid neutrino energy: " << energy;
+     gSock->Send(kErrBadRequest.c_str());
+     gSock->Send(kErr.c_str());
+     return;
+  }
+  TF1 * flux = 0;
+  if(ev.size() == 3) {
+     flux = new TF1("gevserv_flux", ev[2].c_str(), emin, emax);
+  }
+
+  // Find (or create) the event generation driver for the initial state
+
+  InitialState init_state(ipdgtgt, ipdgnu);
+  GEVGDriver * evg_driver = EvGenDriver(init_state, true);
+  if(!evg_driver) {
+     delete flux;
+     gSock->Send(kErrNoDriver.c_str());
+     gSock->Send(kErr.c_str());
+     return;
+  }
+
+  // Generate and stream back the events
+
+  utils::app_init::RandGen(seed);
+  RandomGen * rnd = RandomGen::Instance();
+
+  ostringstream batch_hdr;
+  batch_hdr << kBatchHdrCmdSent << ": " << nev;
+  gSock->Send(batch_hdr.str().c_str());
+
+  int nfailed = 0;
+  int ievent  = 0;
+  while(ievent < nev) {
+     double E = emin;
+     if(flux)             E = flux->GetRandom();
+     else if(emax > emin) E = emin + (emax - emin) * rnd->RndFlux().Rndm();
+     TLorentzVector p4(0., 0., E, E);
+
+     EventRecord * event = evg_driver->GenerateEvent(p4);
+     if(event == 0 || event->IsUnphysical()) {
+        delete event;
+        if(++nfailed > kMaxBatchAttempts * nev) break;
+        continue;
+     }
+
+     TMessage event_mesg(kMESS_OBJECT);
+     event_mesg.WriteObject(event);
+     gSock->Send(event_mesg);
+
+     delete event;
+     ievent++;
+  }
+  delete flux;
+
+  if(ievent < nev) {
+     LOG("gevserv", pWARN) 
+       << "Failed to generate the requested events (generated " 
+       << ievent << "/" << nev << ")";
+     gSock->Send(kErrNoEvent.c_str());
+     gSock->Send(kErr.c_str());
+     return;
+  }
+
+  gSock->Send(kBatchOkMesgSent.c_str());
+
+  LOG("gevserv", pINFO) << "...done!";
+}
+//____________________________________________________________________________
+GEVGDriver * EvGenDriver(const InitialState & init_state, bool create)
+{
+// Return the event generation driver for the input initial state.
+// If there is none yet and create is set, configure one and keep it in the
+// pool for any later requests.
+
+  GEVGDriver * evgdriver = gGPool.FindDriver(init_state);
+  if(evgdriver || !create) return evgdriver;
+
+  LOG("gevserv", pNOTICE)
+    << "\n\n ---- Creating a GEVGDriver object configured for init-state: "
+    << init_state.AsString() << " ----\n\n";
+
+  evgdriver = new GEVGDriver;
+  evgdriver->SetEventGeneratorList(RunOpt::Instance()->EventGeneratorList());
+  evgdriver->SetUnphysEventMask(*RunOpt::Instance()->UnphysEventMask());
+  evgdriver->Configure(init_state);
+  evgdriver->UseSplines(); // will also check if all splines needed are loaded
+
+  gGPool.insert( GEVGPool::value_type(init_state.AsString(), evgdriver) );
+
+  return evgdriver;
+}
+//____________________________________________________________________________
 void Shutdown(void)
 {
   LOG("gevserv", pNOTICE) << "Shutting GENIE event server down ...";
@@ -591,6 +784,9 @@ void GetCommandLineArgs(int argc, char ** argv)
 {
   LOG("gevserv", pNOTICE) << "Parsing command line arguments";
 
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
   CmdLnArgParser parser(argc,argv);
 
   // port number:
@@ -602,13 +798,22 @@ void GetCommandLineArgs(int argc, char ** argv)
 	<< "Unspecified port number - Using default (" << kDefPortNum << ")";
     gOptPortNum = kDefPortNum;
   }
+
+  // cross section splines:
+  if( parser.OptionExists("cross-sections") ) {
+    LOG("gevserv", pINFO) << "Reading cross-section file";
+    gOptXSecFile = parser.ArgAsString("cross-sections");
+  } else if(gSystem->Getenv("GSPLOAD")) {
+    gOptXSecFile = gSystem->Getenv("GSPLOAD");
+  }
 }
 //____________________________________________________________________________
 void PrintSyntax(void)
 {
   LOG("gevserv", pNOTICE)
     << "\n\n" << "Syntax:" << "\n"
-    << "   gevserv [-p port] \n";
+    << "   gevserv [-p port] --tune tune_name [--cross-sections xml_file]\n"
+    << "           [--message-thresholds xml_file]\n";
 }
 //____________________________________________________________________________
 
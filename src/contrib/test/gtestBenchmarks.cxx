@@ -0,0 +1,554 @@
+//____________________________________________________________________________
+/*!
+
+\program gtestBenchmarks
+
+\brief   Micro-benchmarks of GENIE's hot kernels: interpolation (Spline,
+         BLI2DUnifGrid, BLI2DNonUnifGrid, Interpolator2D), hadron transport
+         (INukeHadroData2018::XSec, MeanFreePath), differential cross
+         sections (Nieves QEL, Berger-Sehgal RES, QPM DIS, Alvarez-Ruso COH,
+         Alam-Simo-Athar-Vacas single kaon), kinematic limits (KPhaseSpace)
+         and nuclear model samplers (LocalFGM, SpectralFunc).
+
+         Every benchmark calls its kernel over a fixed set of inputs
+         (generated with a fixed seed) and is repeated several times. The
+         fastest and median repetitions are reported in ns/call, with a
+         checksum of the kernel outputs (for catching changes in results
+         alongside changes in speed). The results are written in JSON, for
+         use by regression jobs.
+
+         Syntax :
+           gtestBenchmarks --tune tune_name [-n ncalls] [-r nrep]
+                           [-b name_filter] [-o output_file]
+                           [--message-thresholds xml_file]
+
+         Options :
+           [] denotes an optional argument
+           -n number of kernel calls per repetition [default: 100000]
+           -r number of repetitions [default: 5]
+           -b run only the benchmarks whose name contains the given string
+           -o output JSON file [default: print on stdout]
+
+         Example :
+           gtestBenchmarks --tune G18_10a_02_11a -b XSec -o bench.json
+
+\author  Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+         University of Liverpool & STFC Rutherford Appleton Lab
+
+\created October 14, 2026
+
+\cpright Copyright (c) 2003-2019, The GENIE Collaboration
+         For the full text of the license visit http://copyright.genie-mc.org
+         or see $GENIE/LICENSE
+*/
+//____________________________________________________________________________
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+
+#include <TMath.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TLorentzVector.h>
+
+#include "Framework/Algorithm/AlgFactory.h"
+#include "Framework/Conventions/Constants.h"
+#include "Framework/Conventions/KinePhaseSpace.h"
+#include "Framework/Conventions/KineVar.h"
+#include "Framework/EventGen/XSecAlgorithmI.h"
+#include "Framework/Interaction/Interaction.h"
+#include "Framework/Interaction/KPhaseSpace.h"
+#include "Framework/Messenger/Messenger.h"
+#include "Framework/Numerical/BLI2D.h"
+#include "Framework/Numerical/Interpolator2D.h"
+#include "Framework/Numerical/RandomGen.h"
+#include "Framework/Numerical/Spline.h"
+#include "Framework/ParticleData/PDGCodes.h"
+#include "Framework/ParticleData/PDGLibrary.h"
+#include "Framework/Utils/AppInit.h"
+#include "Framework/Utils/CmdLnArgParser.h"
+#include "Framework/Utils/RunOpt.h"
+#include "Physics/HadronTransport/INukeHadroData2018.h"
+#include "Physics/HadronTransport/INukeHadroFates.h"
+#include "Physics/HadronTransport/INukeUtils2018.h"
+#include "Physics/NuclearState/NuclearModelI.h"
+
+using std::string;
+using std::vector;
+using std::ostream;
+using std::ofstream;
+using std::cout;
+using std::endl;
+
+using namespace genie;
+using namespace genie::constants;
+
+// a benchmark: a setup function (returns false if the benchmark can not run)
+// and a kernel, called with the index of the input to use
+typedef bool   (*BenchSetup)  (void);
+typedef double (*BenchKernel) (unsigned int i);
+
+struct Benchmark {
+  const char * name;
+  BenchSetup   setup;
+  BenchKernel  kernel;
+};
+
+void   GetCommandLineArgs (int argc, char ** argv);
+void   PrintSyntax        (void);
+void   RunBenchmark       (const Benchmark & bench, ostream & out, bool & first);
+
+// inputs
+const unsigned int kNInputs = 1024;   // # of distinct inputs per benchmark
+const unsigned int kSeed    = 20261014;
+
+vector<double>  gX, gY;                           // generic random inputs
+Spline *              gSpline       = 0;
+BLI2DUnifGrid *       gBLIUnif      = 0;
+BLI2DNonUnifGrid *    gBLINonUnif   = 0;
+Interpolator2D *      gInterp2D     = 0;
+INukeHadroData2018 *  gHadroData    = 0;
+vector<TLorentzVector> gX4, gP4;                  // hadron positions & momenta
+vector<Interaction *> gInteractions;              // xsec benchmark inputs
+const XSecAlgorithmI * gXSecModel   = 0;
+KinePhaseSpace_t      gXSecPhSp     = kPSNull;
+const NuclearModelI * gNuclModel    = 0;
+Target *              gTarget       = 0;
+
+// user-specified options
+unsigned int gOptNCalls = 100000;
+unsigned int gOptNRep   = 5;
+string       gOptFilter = "";
+string       gOptOutFile = "";
+
+//____________________________________________________________________________
+// helpers
+//
+double Func2D(double x, double y)
+{
+  return TMath::Sin(x)/x * TMath::Sin(y)/y;
+}
+//............................................................................
+void ClearInteractions(void)
+{
+  for(unsigned int i = 0; i < gInteractions.size(); i++) {
+    delete gInteractions[i];
+  }
+  gInteractions.clear();
+}
+//............................................................................
+bool GetXSecModel(string name, string config, KinePhaseSpace_t kps)
+{
+  gXSecModel = dynamic_cast<const XSecAlgorithmI *> (
+      AlgFactory::Instance()->GetAlgorithm(name, config));
+  gXSecPhSp = kps;
+  if(!gXSecModel) {
+    LOG("gbench", pWARN) << "Couldn't get: " << name << "/" << config;
+    return false;
+  }
+  return true;
+}
+//............................................................................
+void SetQELKinematics(Interaction * in, double Q2)
+{
+// Lepton & outgoing nucleon momenta of a QEL interaction on a free nucleon
+// at rest, for the input Q2
+
+  const InitialState & init = in->InitState();
+  double E  = init.ProbeE(kRfLab);
+  double M  = init.Tgt().HitNucMass();
+  double Mf = PDGLibrary::Instance()->Find(kPdgProton)->Mass();
+  double ml = in->FSPrimLepton()->Mass();
+
+  double q0 = (Q2 + Mf*Mf - M*M) / (2*M);
+  double El = TMath::Max(ml, E - q0);
+  double pl = TMath::Sqrt(TMath::Max(0., El*El - ml*ml));
+  double ct = (pl > 0) ? (2*E*El - ml*ml - Q2) / (2*E*pl) : 1.;
+  ct = TMath::Max(-1., TMath::Min(1., ct));
+  double st = TMath::Sqrt(1. - ct*ct);
+
+  TLorentzVector p4l(pl*st, 0., pl*ct, El);
+  TLorentzVector p4n(0., 0., E, E + M);
+  in->KinePtr()->SetQ2(Q2);
+  in->KinePtr()->SetFSLeptonP4(p4l);
+  in->KinePtr()->SetHadSystP4(p4n - p4l);
+}
+//____________________________________________________________________________
+// interpolation
+//
+bool SetupSpline(void)
+{
+  const int n = 500;
+  double x[n], y[n];
+  for(int i = 0; i < n; i++) {
+    x[i] = 0.01 + 100. * i / (n-1);
+    y[i] = TMath::Sin(x[i]) / x[i];
+  }
+  delete gSpline;
+  gSpline = new Spline(n, x, y);
+  return true;
+}
+double KernelSpline(unsigned int i) { return gSpline->Evaluate(100. * gX[i]); }
+//............................................................................
+bool SetupBLI2D(void)
+{
+  const int nx = 100, ny = 100;
+  const double xmin = -5, xmax = 5, ymin = -5, ymax = 5;
+  delete gBLIUnif;
+  delete gBLINonUnif;
+  gBLIUnif    = new BLI2DUnifGrid   (nx, xmin, xmax, ny, ymin, ymax);
+  gBLINonUnif = new BLI2DNonUnifGrid(nx, xmin, xmax, ny, ymin, ymax);
+  for(int ix = 0; ix < nx; ix++) {
+    double x = xmin + ix * (xmax-xmin)/(nx-1);
+    for(int iy = 0; iy < ny; iy++) {
+      double y = ymin + iy * (ymax-ymin)/(ny-1);
+      gBLIUnif   ->AddPoint(x, y, Func2D(x,y));
+      gBLINonUnif->AddPoint(x, y, Func2D(x,y));
+    }
+  }
+  return true;
+}
+double KernelBLIUnif(unsigned int i)
+{
+  return gBLIUnif->Evaluate(-5. + 10.*gX[i], -5. + 10.*gY[i]);
+}
+double KernelBLINonUnif(unsigned int i)
+{
+  return gBLINonUnif->Evaluate(-5. + 10.*gX[i], -5. + 10.*gY[i]);
+}
+//............................................................................
+bool SetupInterpolator2D(void)
+{
+  const size_t nx = 100, ny = 100;
+  double x[nx], y[ny];
+  vector<double> z(nx*ny);
+  for(size_t ix = 0; ix < nx; ix++) x[ix] = -5. + ix * 10./(nx-1);
+  for(size_t iy = 0; iy < ny; iy++) y[iy] = -5. + iy * 10./(ny-1);
+  for(size_t ix = 0; ix < nx; ix++) {
+    for(size_t iy = 0; iy < ny; iy++) z[iy*nx+ix] = Func2D(x[ix], y[iy]);
+  }
+  delete gInterp2D;
+  gInterp2D = new Interpolator2D(nx, x, ny, y, &z[0]);
+  return true;
+}
+double KernelInterpolator2D(unsigned int i)
+{
+  return gInterp2D->Eval(-4.9 + 9.8*gX[i], -4.9 + 9.8*gY[i]);
+}
+//____________________________________________________________________________
+// hadron transport
+//
+bool SetupHadroData(void)
+{
+  gHadroData = INukeHadroData2018::Instance();
+  return (gHadroData != 0);
+}
+double KernelHadroDataHN(unsigned int i)
+{
+  return gHadroData->XSec(kPdgPiP, kIHNFtElas, 1000. * gX[i], 56, 26);
+}
+double KernelHadroDataNN(unsigned int i)
+{
+  return gHadroData->XSec(
+     kPdgProton, kPdgProton, kPdgProton, kIHNFtElas, 1000. * gX[i], -1. + 2.*gY[i]);
+}
+//............................................................................
+bool SetupMeanFreePath(void)
+{
+  if(!SetupHadroData()) return false;
+  TRandom3 rnd(kSeed);
+  gX4.resize(kNInputs);
+  gP4.resize(kNInputs);
+  double mpi = PDGLibrary::Instance()->Find(kPdgPiP)->Mass();
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    double r = 6. * rnd.Rndm();  // fm
+    double p = 0.05 + rnd.Rndm();
+    gX4[i].SetXYZT(0., 0., r, 0.);
+    gP4[i].SetXYZT(0., p*0.6, p*0.8, TMath::Sqrt(p*p + mpi*mpi));
+  }
+  return true;
+}
+double KernelMeanFreePath(unsigned int i)
+{
+  return utils::intranuke2018::MeanFreePath(kPdgPiP, gX4[i], gP4[i], 56, 26);
+}
+//____________________________________________________________________________
+// cross sections
+//
+bool SetupNievesQEL(void)
+{
+  if(!GetXSecModel("genie::NievesQELCCPXSec", "Default", kPSQELEvGen)) return false;
+  ClearInteractions();
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    Interaction * in = Interaction::QELCC(
+        kPdgTgtC12, kPdgNeutron, kPdgNuMu, 0.5 + 2.5*gX[i]);
+    Range1D_t Q2l = in->PhaseSpace().Limits(kKVQ2);
+    SetQELKinematics(in, Q2l.min + gY[i] * (Q2l.max - Q2l.min));
+    gInteractions.push_back(in);
+  }
+  return true;
+}
+//............................................................................
+bool SetupBSRES(void)
+{
+  if(!GetXSecModel("genie::BergerSehgalRESPXSec2014", "Default", kPSWQ2fE)) return false;
+  ClearInteractions();
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    Interaction * in = Interaction::RESCC(
+        kPdgTgtC12, kPdgProton, kPdgNuMu, 1. + 4.*gX[i]);
+    in->ExclTagPtr()->SetResonance(kP33_1232);
+    Range1D_t Wl  = in->PhaseSpace().Limits(kKVW);
+    double W = Wl.min + gY[i] * (TMath::Min(Wl.max, 1.6) - Wl.min);
+    in->KinePtr()->SetW(W);
+    Range1D_t Q2l = in->PhaseSpace().Limits(kKVQ2);
+    in->KinePtr()->SetQ2(Q2l.min + gX[(i+1)%kNInputs] * (Q2l.max - Q2l.min));
+    gInteractions.push_back(in);
+  }
+  return true;
+}
+//............................................................................
+bool SetupQPMDIS(void)
+{
+  if(!GetXSecModel("genie::QPMDISPXSec", "Default", kPSxyfE)) return false;
+  ClearInteractions();
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    Interaction * in = Interaction::DISCC(
+        kPdgTgtC12, kPdgProton, kPdgNuMu, 2. + 48.*gX[i]);
+    in->KinePtr()->Setx(0.01 + 0.98 * gY[i]);
+    in->KinePtr()->Sety(0.01 + 0.98 * gX[(i+1)%kNInputs]);
+    gInteractions.push_back(in);
+  }
+  return true;
+}
+//............................................................................
+bool SetupARCOH(void)
+{
+  if(!GetXSecModel("genie::AlvarezRusoCOHPiPXSec", "Default", kPSElOlOpifE)) return false;
+  ClearInteractions();
+  double mmu = PDGLibrary::Instance()->Find(kPdgMuon)->Mass();
+  double mpi = PDGLibrary::Instance()->Find(kPdgPiP )->Mass();
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    double E   = 1. + gX[i];
+    Interaction * in = Interaction::COHCC(kPdgTgtC12, kPdgNuMu, E);
+    double Epi = 0.2 + 0.3 * gY[i];
+    double El  = E - Epi;
+    double pl  = TMath::Sqrt(TMath::Max(0., El*El  - mmu*mmu));
+    double ppi = TMath::Sqrt(TMath::Max(0., Epi*Epi - mpi*mpi));
+    double tl  = 0.02 + 0.2 * gX[(i+1)%kNInputs];
+    double tpi = 0.3  + 0.5 * gY[(i+1)%kNInputs];
+    in->KinePtr()->SetFSLeptonP4(
+        pl*TMath::Sin(tl), 0., pl*TMath::Cos(tl), El);
+    in->KinePtr()->SetHadSystP4(
+        -ppi*TMath::Sin(tpi), 0., ppi*TMath::Cos(tpi), Epi);
+    gInteractions.push_back(in);
+  }
+  return true;
+}
+//............................................................................
+bool SetupASAVSK(void)
+{
+  if(!GetXSecModel("genie::AlamSimoAtharVacasSKPXSec2014", "Default", kPSTkTlctl)) return false;
+  ClearInteractions();
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    Interaction * in = Interaction::ASK(kPdgTgtC12, kPdgNuMu, 1. + 2.*gX[i]);
+    in->InitStatePtr()->TgtPtr()->SetHitNucPdg(kPdgNeutron);
+    in->KinePtr()->SetKV(kKVTl,    0.1 + 0.4 * gY[i]);
+    in->KinePtr()->SetKV(kKVTk,    0.05 + 0.2 * gX[(i+1)%kNInputs]);
+    in->KinePtr()->SetKV(kKVctl,   0.5 + 0.5 * gY[(i+1)%kNInputs]);
+    in->KinePtr()->SetKV(kKVphikq, 2. * kPi * gX[(i+2)%kNInputs]);
+    gInteractions.push_back(in);
+  }
+  return true;
+}
+double KernelXSec(unsigned int i)
+{
+  return gXSecModel->XSec(gInteractions[i], gXSecPhSp);
+}
+//____________________________________________________________________________
+// kinematic limits
+//
+bool SetupKPhaseSpace(void)
+{
+  ClearInteractions();
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    gInteractions.push_back(
+      Interaction::RESCC(kPdgTgtFe56, kPdgProton, kPdgNuMu, 0.5 + 10.*gX[i]));
+  }
+  return true;
+}
+double KernelKPhaseSpaceW(unsigned int i)
+{
+  return gInteractions[i]->PhaseSpace().Limits(kKVW).max;
+}
+double KernelKPhaseSpaceQ2(unsigned int i)
+{
+  // the Q2 limits depend on W
+  gInteractions[i]->KinePtr()->SetW(1.1 + 0.5*gY[i]);
+  return gInteractions[i]->PhaseSpace().Limits(kKVQ2).max;
+}
+//____________________________________________________________________________
+// nuclear model samplers
+//
+bool SetupNuclModel(string name)
+{
+  gNuclModel = dynamic_cast<const NuclearModelI *> (
+      AlgFactory::Instance()->GetAlgorithm(name, "Default"));
+  if(!gNuclModel) {
+    LOG("gbench", pWARN) << "Couldn't get: " << name << "/Default";
+    return false;
+  }
+  delete gTarget;
+  gTarget = new Target(kPdgTgtC12);
+  gTarget->SetHitNucPdg(kPdgNeutron);
+  return true;
+}
+bool SetupLocalFGM     (void) { return SetupNuclModel("genie::LocalFGM");     }
+bool SetupSpectralFunc (void) { return SetupNuclModel("genie::SpectralFunc"); }
+double KernelNuclModel(unsigned int i)
+{
+  gNuclModel->GenerateNucleon(*gTarget, 3. * gX[i]);
+  return gNuclModel->Momentum();
+}
+//____________________________________________________________________________
+const Benchmark kBenchmarks[] = {
+  { "Spline::Evaluate",                      SetupSpline,         KernelSpline         },
+  { "BLI2DUnifGrid::Evaluate",               SetupBLI2D,          KernelBLIUnif        },
+  { "BLI2DNonUnifGrid::Evaluate",            SetupBLI2D,          KernelBLINonUnif     },
+  { "Interpolator2D::Eval",                  SetupInterpolator2D, KernelInterpolator2D },
+  { "INukeHadroData2018::XSec/hN",           SetupHadroData,      KernelHadroDataHN    },
+  { "INukeHadroData2018::XSec/NN",           SetupHadroData,      KernelHadroDataNN    },
+  { "intranuke2018::MeanFreePath",           SetupMeanFreePath,   KernelMeanFreePath   },
+  { "NievesQELCCPXSec::XSec",                SetupNievesQEL,      KernelXSec           },
+  { "BergerSehgalRESPXSec2014::XSec",        SetupBSRES,          KernelXSec           },
+  { "QPMDISPXSec::XSec",                     SetupQPMDIS,         KernelXSec           },
+  { "AlvarezRusoCOHPiPXSec::XSec",           SetupARCOH,          KernelXSec           },
+  { "AlamSimoAtharVacasSKPXSec2014::XSec",   SetupASAVSK,         KernelXSec           },
+  { "KPhaseSpace::Limits/W",                 SetupKPhaseSpace,    KernelKPhaseSpaceW   },
+  { "KPhaseSpace::Limits/Q2",                SetupKPhaseSpace,    KernelKPhaseSpaceQ2  },
+  { "LocalFGM::GenerateNucleon",             SetupLocalFGM,       KernelNuclModel      },
+  { "SpectralFunc::GenerateNucleon",         SetupSpectralFunc,   KernelNuclModel      }
+};
+const unsigned int kNBenchmarks = sizeof(kBenchmarks) / sizeof(Benchmark);
+
+//____________________________________________________________________________
+int main(int argc, char ** argv)
+{
+  GetCommandLineArgs(argc, argv);
+
+  if ( ! RunOpt::Instance()->Tune() ) {
+    LOG("gbench", pFATAL) << " No TuneId in RunOption";
+    exit(-1);
+  }
+  RunOpt::Instance()->BuildTune();
+  utils::app_init::MesgThresholds(RunOpt::Instance()->MesgThresholdFiles());
+
+  // fixed inputs & fixed seeds for the kernels that draw random numbers
+  TRandom3 rnd(kSeed);
+  gX.resize(kNInputs);
+  gY.resize(kNInputs);
+  for(unsigned int i = 0; i < kNInputs; i++) {
+    gX[i] = rnd.Rndm();
+    gY[i] = rnd.Rndm();
+  }
+
+  ofstream fout;
+  if(gOptOutFile.size() > 0) fout.open(gOptOutFile.c_str());
+  ostream & out = (gOptOutFile.size() > 0) ? fout : cout;
+
+  out << "{" << endl;
+  out << "  \"ncalls\": " << gOptNCalls << "," << endl;
+  out << "  \"nrep\": "   << gOptNRep   << "," << endl;
+  out << "  \"benchmarks\": [";
+  bool first = true;
+  for(unsigned int ib = 0; ib < kNBenchmarks; ib++) {
+    const Benchmark & bench = kBenchmarks[ib];
+    if(gOptFilter.size() > 0 &&
+       string(bench.name).find(gOptFilter) == string::npos) continue;
+    RunBenchmark(bench, out, first);
+  }
+  out << endl << "  ]" << endl;
+  out << "}" << endl;
+
+  ClearInteractions();
+  return 0;
+}
+//____________________________________________________________________________
+void RunBenchmark(const Benchmark & bench, ostream & out, bool & first)
+{
+  LOG("gbench", pNOTICE) << "Running benchmark: " << bench.name;
+
+  utils::app_init::RandGen(kSeed);
+  if(!bench.setup()) {
+    LOG("gbench", pWARN) << "Skipping benchmark: " << bench.name;
+    return;
+  }
+
+  // warm-up (fills caches, as they would be filled in event generation)
+  double checksum = 0.;
+  for(unsigned int i = 0; i < kNInputs; i++) checksum += bench.kernel(i);
+
+  vector<double> tcall(gOptNRep);
+  TStopwatch watch;
+  for(unsigned int irep = 0; irep < gOptNRep; irep++) {
+    checksum = 0.;
+    watch.Start(kTRUE);
+    for(unsigned int i = 0; i < gOptNCalls; i++) {
+      checksum += bench.kernel(i % kNInputs);
+    }
+    watch.Stop();
+    tcall[irep] = 1.E+9 * watch.RealTime() / gOptNCalls;
+  }
+  std::sort(tcall.begin(), tcall.end());
+
+  out << ((first) ? "" : ",") << endl;
+  out << "    { \"name\": \"" << bench.name << "\""
+      << ", \"ns_per_call_min\": "    << tcall[0]
+      << ", \"ns_per_call_median\": " << tcall[gOptNRep/2]
+      << ", \"checksum\": "           << checksum << " }";
+  first = false;
+
+  LOG("gbench", pNOTICE)
+    << bench.name << ": " << tcall[0] << " ns/call (min), "
+    << tcall[gOptNRep/2] << " ns/call (median)";
+}
+//____________________________________________________________________________
+void GetCommandLineArgs(int argc, char ** argv)
+{
+  LOG("gbench", pNOTICE) << "Parsing command line arguments";
+
+  // Common run options.
+  RunOpt::Instance()->ReadFromCommandLine(argc,argv);
+
+  CmdLnArgParser parser(argc,argv);
+
+  if( parser.OptionExists('h') ) {
+    PrintSyntax();
+    exit(0);
+  }
+  if( parser.OptionExists('n') ) {
+    gOptNCalls = TMath::Max(1, parser.ArgAsInt('n'));
+  }
+  if( parser.OptionExists('r') ) {
+    gOptNRep = TMath::Max(1, parser.ArgAsInt('r'));
+  }
+  if( parser.OptionExists('b') ) {
+    gOptFilter = parser.ArgAsString('b');
+  }
+  if( parser.OptionExists('o') ) {
+    gOptOutFile = parser.ArgAsString('o');
+  }
+}
+//____________________________________________________________________________
+void PrintSyntax(void)
+{
+  LOG("gbench", pNOTICE)
+    << "\n\n" << "Syntax:" << "\n"
+    << "   gtestBenchmarks --tune tune_name [-n ncalls] [-r nrep]\n"
+    << "                   [-b name_filter] [-o output_file]\n"
+    << "                   [--message-thresholds xml_file]\n";
+}
+//____________________________________________________________________________
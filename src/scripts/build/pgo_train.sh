@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+
+#
+# The training workload of the profile-guided optimization (PGO) build of
+# GENIE (see 'make pgo-train' and the --enable-pgo configure option).
+#
+# Runs, with an instrumented GENIE build (make PGO_PHASE=generate), a small
+# cross section spline build and the generation of numu and numubar events
+# on argon, for a NuMI-like (low-energy, peaked at ~3 GeV) spectrum, with the
+# full G18_10a_02_11a tune: the cross section models and integrators, the
+# interaction selection, the kinematics generators, the hadronization and
+# the hadron transport (FSI) are all exercised. The instrumented libraries
+# write their execution profiles in the profile directory; for clang builds,
+# the raw profiles are then merged in the genie.profdata file the optimized
+# build (make PGO_PHASE=use) reads.
+#
+# Usage:  ./pgo_train.sh profile_dir [n_events]
+#
+# The GENIE environment ($GENIE, $PATH and the library path) must be set up.
+#
+# Author: Costas Andreopoulos <constantinos.andreopoulos \at cern.ch>
+#
+
+pgo_dir=$1
+nev=${2:-2000}
+
+if [ -z "${pgo_dir}" ] ; then
+  echo "Usage: ./pgo_train.sh profile_dir [n_events]"
+  exit 1
+fi
+
+tune=G18_10a_02_11a
+target=1000180400
+flux="x*x*exp(-x/1.5)"
+emin=0.5
+emax=20
+mesg=Messenger_whisper.xml
+
+workdir=${pgo_dir}/train
+mkdir -p ${workdir} || exit 1
+cd ${workdir} || exit 1
+
+echo "** PGO training: building cross section splines (in ${workdir})..."
+gmkspl -p 14,-14 -t ${target} -n 15 -e ${emax} \
+       --tune ${tune} --message-thresholds ${mesg} \
+       -o pgo_xsec.xml || exit 1
+
+echo "** PGO training: generating ${nev} numu events on argon..."
+gevgen -n ${nev} -p 14 -t ${target} -e ${emin},${emax} -f "${flux}" \
+       -r 1 --seed 1 --cross-sections pgo_xsec.xml \
+       --tune ${tune} --message-thresholds ${mesg} || exit 1
+
+echo "** PGO training: generating $((nev/4)) numubar events on argon..."
+gevgen -n $((nev/4)) -p -14 -t ${target} -e ${emin},${emax} -f "${flux}" \
+       -r 2 --seed 2 --cross-sections pgo_xsec.xml \
+       --tune ${tune} --message-thresholds ${mesg} || exit 1
+
+# clang: merge the raw profiles of all the runs
+if ls ${pgo_dir}/*.profraw > /dev/null 2>&1 ; then
+  echo "** PGO training: merging the raw profiles..."
+  ${LLVM_PROFDATA:-llvm-profdata} merge -output=${pgo_dir}/genie.profdata \
+       ${pgo_dir}/*.profraw || exit 1
+fi
+
+echo "** PGO training: done - profiles written in ${pgo_dir}"
+exit 0